@@ -1397,6 +1397,28 @@ void Cppyy::AddSmartPtrType(const std::string& type_name)
 
 
 // type offsets --------------------------------------------------------------
+// The offsets between classes without virtual bases do not depend on the object and
+// are needed for every call of a base class method through a derived object, so they
+// are cached (the values are the up-cast offsets).
+static std::map<std::pair<Cppyy::TCppType_t, Cppyy::TCppType_t>, ptrdiff_t> gStaticBaseOffsets;
+
+static bool has_virtual_bases(TClass* klass)
+{
+// conservatively, classes whose bases are not known have virtual ones
+    TList* bases = klass->GetListOfBases();
+    if (!bases)
+        return true;
+    for (auto obj : *bases) {
+        TBaseClass* base = (TBaseClass*)obj;
+        if (base->Property() & kIsVirtualBase)
+            return true;
+        TClass* cb = base->GetClassPointer();
+        if (!cb || has_virtual_bases(cb))
+            return true;
+    }
+    return false;
+}
+
 ptrdiff_t Cppyy::GetBaseOffset(TCppType_t derived, TCppType_t base,
     TCppObject_t address, int direction, bool rerror)
 {
@@ -1404,6 +1426,10 @@ ptrdiff_t Cppyy::GetBaseOffset(TCppType_t derived, TCppType_t base,
     if (derived == base || !(base && derived))
         return (ptrdiff_t)0;
 
+    auto icache = gStaticBaseOffsets.find(std::make_pair(derived, base));
+    if (icache != gStaticBaseOffsets.end())
+        return direction < 0 ? -icache->second : icache->second;
+
     TClassRef& cd = type_from_handle(derived);
     TClassRef& cb = type_from_handle(base);
 
@@ -1433,6 +1459,9 @@ ptrdiff_t Cppyy::GetBaseOffset(TCppType_t derived, TCppType_t base,
     if (offset == -1)   // Cling error, treat silently
         return rerror ? (ptrdiff_t)offset : 0;
 
+    if (!has_virtual_bases(cd.GetClass()))
+        gStaticBaseOffsets[std::make_pair(derived, base)] = offset;
+
     return (ptrdiff_t)(direction < 0 ? -offset : offset);
 }
 
@@ -1,7 +1,7 @@
 from cppyy import gbl as gbl_namespace
 
 
-def _NumbaDeclareDecorator(input_types, return_type = None, name=None):
+def _NumbaDeclareDecorator(input_types, return_type = None, name=None, vectorize=False):
     '''
     Decorator for making Python callables accessible in C++ by just-in-time compilation
     with numba and cling
@@ -22,6 +22,15 @@ def _NumbaDeclareDecorator(input_types, return_type = None, name=None):
     Note that the callable is fully compiled without side-effects. The numba jitting uses the nopython
     option which does not allow interaction with the Python interpreter. This means that you can use
     the resulting function also safely in multi-threaded environments.
+
+    With vectorize=True, the Python callable works on arrays instead: it receives one numpy array per input
+    type and returns an array of the same length, the input and return types being fundamental types. The
+    C++ wrapper is then a functor object, Numba::<name>, which calls the jitted function with arrays of length
+    one and can also process whole bulks of entries in one call. Passed to RDataFrame's Filter or Define,
+    together with ROOT.RDF.Experimental.EnableBulkProcessing, the Python callable gets views of the column
+    values of a bulk of entries instead of being called once per entry. Since the values of the entries that
+    do not pass the upstream filters are passed too, the callable is jitted with numpy's error model
+    (error_model='numpy'), e.g. divisions by zero give infinities rather than raising.
     '''
     # Make required imports
     try:
@@ -162,10 +171,134 @@ def _NumbaDeclareDecorator(input_types, return_type = None, name=None):
 
         func_ptr_input_types += ['{}{}*, int'.format(const_mod, innert)]
 
+    # C++ typenames of the numba types returned by the Python callables
+    cpp_type_map = {
+        nb.types.boolean: 'bool',
+        nb.types.uint8: 'unsigned int',
+        nb.types.uint16: 'unsigned int',
+        nb.types.uint32: 'unsigned int',
+        nb.types.uint64: 'unsigned long',
+        nb.types.char: 'int',
+        nb.types.int8: 'int',
+        nb.types.int16: 'int',
+        nb.types.int32: 'int',
+        nb.types.int64: 'long',
+        nb.types.float32: 'float',
+        nb.types.float64: 'double',
+    }
+
+    def inner_vectorized(func, input_types, return_type, name):
+        '''
+        Inner decorator for Python callables working on arrays, see outer decorator for documentation
+        '''
+        if not input_types:
+            raise Exception('Vectorized Python callables need at least one input type')
+        for t in input_types + ([return_type] if return_type is not None else []):
+            if 'RVec' in t:
+                raise Exception(
+                    'Vectorized Python callables only support fundamental input and return types, not {}'.format(t))
+
+        # Jit the given Python callable with numba, with one array per input type
+        nb_input_types = [get_numba_type(t)[:] for t in input_types]
+        try:
+            if return_type is not None:
+                nbjit = nb.jit(get_numba_type(return_type)[:](*nb_input_types), nopython=True, inline='always',
+                               error_model='numpy')(func)
+            else:
+                nbjit = nb.jit(tuple(nb_input_types), nopython=True, inline='always', error_model='numpy')(func)
+        except:
+            raise Exception('Failed to jit Python callable {} with numba.jit'.format(func))
+        nb_return_type = nbjit.nopython_signatures[-1].return_type
+        if not isinstance(nb_return_type, nb.types.Array) or nb_return_type.dtype not in cpp_type_map:
+            raise Exception(
+                'Vectorized Python callable {} must return an array of fundamental type, not {}'.format(
+                    func, nb_return_type))
+        if return_type is None:
+            return_type = cpp_type_map[nb_return_type.dtype]
+        func.numba_func = nbjit
+
+        # Create Python wrapper with C friendly signature: the number of entries, the pointer to the results and
+        # the pointers to the input values
+        args = ['x_{}'.format(i) for i in range(len(input_types))]
+        pywrappercode = '''\
+def pywrapper(size, ptr_r, {SIGNATURE}):
+    """
+    Wrapper function for the jitted Python callable working on arrays
+    """
+    # Define numba carray wrappers for the input values
+    {ARGS_DEF}
+    # Call the jitted Python function and copy the results
+    r = nbjit({ARGS})
+    x_r = nb.carray(ptr_r, (size,))
+    x_r[:] = r
+        '''.format(
+                SIGNATURE=', '.join('ptr_{}'.format(i) for i in range(len(input_types))),
+                ARGS_DEF='\n    '.join('x_{0} = nb.carray(ptr_{0}, (size,))'.format(i) for i in range(len(input_types))),
+                ARGS=', '.join(args))
+
+        glob = dict(globals()) # Make a shallow copy of the dictionary so we don't pollute the global scope
+        glob['nb'] = nb
+        glob['nbjit'] = nbjit
+        loc = {}
+        exec(pywrappercode, glob, loc)
+
+        try:
+            c_input_types = [nb.int64, nb.types.CPointer(get_numba_type(return_type))] + \
+                [nb.types.CPointer(get_numba_type(t)) for t in input_types]
+            nbcfunc = nb.cfunc(nb.void(*c_input_types), nopython=True, error_model='numpy')(loc['pywrapper'])
+        except:
+            raise Exception('Failed to jit Python wrapper with numba.cfunc')
+        func.__py_wrapper__ = pywrappercode
+        func.__numba_cfunc__ = nbcfunc
+
+        if not name:
+            name = func.__name__
+
+        # Build C++ functor for jitting with cling, providing the "bulk callable" interface of RDataFrame
+        cppwrappercode = """\
+namespace Numba {{
+/*
+ * C++ functor around the jitted Python wrapper which calls the jitted Python callable on arrays
+ */
+struct {FUNC_NAME}_t {{
+    using FuncPtr_t = void (*)(long, {RETURN_TYPE}*, {FUNC_PTR_INPUT_TYPES});
+    {RETURN_TYPE} operator()({INPUT_SIGNATURE}) const {{
+        {RETURN_TYPE} r;
+        reinterpret_cast<FuncPtr_t>({FUNC_PTR})(1, &r, {SCALAR_ARGS});
+        return r;
+    }}
+    // Evaluate all entries of a bulk, the results of the entries whose mask is not set being ignored
+    void CallBulk(std::size_t size, const bool * /*mask*/, {RETURN_TYPE} *results, {BULK_SIGNATURE}) const {{
+        reinterpret_cast<FuncPtr_t>({FUNC_PTR})(size, results, {ARGS});
+    }}
+}};
+inline {FUNC_NAME}_t {FUNC_NAME};
+}}""".format(
+                FUNC_NAME=name,
+                RETURN_TYPE=return_type,
+                FUNC_PTR=nbcfunc.address,
+                FUNC_PTR_INPUT_TYPES=', '.join('const {}*'.format(t) for t in input_types),
+                INPUT_SIGNATURE=', '.join('{} x_{}'.format(t, i) for i, t in enumerate(input_types)),
+                SCALAR_ARGS=', '.join('&' + a for a in args),
+                BULK_SIGNATURE=', '.join('const {} *x_{}'.format(t, i) for i, t in enumerate(input_types)),
+                ARGS=', '.join(args))
+
+        # Jit wrapper C++ code
+        err = gbl_namespace.gInterpreter.Declare(cppwrappercode)
+        if not err:
+            raise Exception('Failed to jit C++ wrapper code with cling:\n{}'.format(cppwrappercode))
+        func.__cpp_wrapper__ = cppwrappercode
+        # The functor object, passed to RDataFrame's Filter and Define in place of the Python callable
+        func.__cpp_functor__ = getattr(gbl_namespace.Numba, name)
+
+        return func
+
     def inner(func, input_types=input_types, return_type=return_type, name=name):
         '''
         Inner decorator without arguments, see outer decorator for documentation
         '''
+        if vectorize:
+            return inner_vectorized(func, input_types, return_type, name)
 
         # Jit the given Python callable with numba
         nb_return_type, nb_input_types = get_numba_signature(input_types, return_type)
@@ -180,20 +313,7 @@ def _NumbaDeclareDecorator(input_types, return_type = None, name=None):
         func.numba_func = nbjit
         # return_type = "int"
         if return_type is None:
-            type_map = {
-                nb.types.boolean: 'bool',
-                nb.types.uint8: 'unsigned int',
-                nb.types.uint16: 'unsigned int',
-                nb.types.uint32: 'unsigned int',
-                nb.types.uint64: 'unsigned long',
-                nb.types.char: 'int',
-                nb.types.int8: 'int',
-                nb.types.int16: 'int',
-                nb.types.int32: 'int',
-                nb.types.int64: 'long',
-                nb.types.float32: 'float',
-                nb.types.float64: 'double',
-            }
+            type_map = cpp_type_map
 
             if nb_return_type in type_map:
                 return_type = type_map[nb_return_type]
@@ -111,6 +111,17 @@ cols = df.Filter("x > 10").AsNumpy(["x", "y"]) # retrieve columns "x" and "y" as
 print(cols["x"], cols["y"]) # the values of the cols dictionary are NumPy arrays
 ~~~
 
+Columns holding collections of fundamental types (e.g. `ROOT::RVec<float>` or `std::vector<int>`) are by default
+returned as arrays of RVec objects. With `jagged="offsets"` they are instead returned as a pair of flat NumPy arrays
+`(offsets, values)`, filled in bulk by a single C++ action, and with `jagged="arrow"` as a `pyarrow.LargeListArray`
+built on these same buffers without copy:
+
+~~~{.py}
+offsets, values = df.AsNumpy(["jets_pt"], jagged="offsets")["jets_pt"]
+pt_of_first_event = values[offsets[0]:offsets[1]]
+jets_pt = df.AsNumpy(["jets_pt"], jagged="arrow")["jets_pt"] # pyarrow.LargeListArray
+~~~
+
 #### Processing data stored in NumPy arrays
 
 In case you have data in NumPy arrays in Python and you want to process the data with ROOT, you can easily
@@ -177,7 +188,26 @@ from . import pythonization
 from ._pyz_utils import MethodTemplateGetter, MethodTemplateWrapper
 
 
-def RDataFrameAsNumpy(df, columns=None, exclude=None, lazy=False):
+_flattenable_types = {
+    "bool", "Bool_t", "char", "Char_t", "unsigned char", "UChar_t", "short", "Short_t", "unsigned short", "UShort_t",
+    "int", "Int_t", "unsigned int", "UInt_t", "long", "Long_t", "unsigned long", "ULong_t", "long long", "Long64_t",
+    "unsigned long long", "ULong64_t", "float", "Float_t", "double", "Double_t"
+}
+
+_collection_prefixes = ("ROOT::VecOps::RVec<", "ROOT::RVec<", "RVec<", "std::vector<", "vector<")
+
+
+def _flattenable_value_type(column_type):
+    """Return the value type of a collection of fundamental types, None for other column types."""
+    column_type = column_type.strip()
+    for prefix in _collection_prefixes:
+        if column_type.startswith(prefix) and column_type.endswith(">"):
+            value_type = column_type[len(prefix):-1].strip()
+            return value_type if value_type in _flattenable_types else None
+    return None
+
+
+def RDataFrameAsNumpy(df, columns=None, exclude=None, lazy=False, jagged="object"):
     """Read-out the RDataFrame as a collection of numpy arrays.
 
     The values of the dataframe are read out as numpy array of the respective type
@@ -198,6 +228,9 @@ def RDataFrameAsNumpy(df, columns=None, exclude=None, lazy=False):
         columns: If None return all branches as columns, otherwise specify names in iterable.
         exclude: Exclude branches from selection.
         lazy: Determines whether this action is instant (False, default) or lazy (True).
+        jagged: How columns holding collections of fundamental types are returned: "object" (default)
+            as an array of RVec objects, "offsets" as a tuple (offsets, values) of flat NumPy arrays and
+            "arrow" as a pyarrow.LargeListArray sharing these buffers.
 
     Returns:
         dict or AsNumpyResult: if instant (default), dict with column names as keys and
@@ -209,6 +242,8 @@ def RDataFrameAsNumpy(df, columns=None, exclude=None, lazy=False):
         raise TypeError("The columns argument requires a list of strings")
     if isinstance(exclude, str):
         raise TypeError("The exclude argument requires a list of strings")
+    if jagged not in ("object", "offsets", "arrow"):
+        raise ValueError("The jagged argument must be one of 'object', 'offsets' or 'arrow'")
 
     # Early check for numpy
     try:
@@ -225,13 +260,22 @@ def RDataFrameAsNumpy(df, columns=None, exclude=None, lazy=False):
         exclude = []
     columns = [col for col in columns if not col in exclude]
 
-    # Register Take action for each column
+    # Register Take action for each column, collections of fundamental types are
+    # flattened into contiguous buffers unless returned as objects
     result_ptrs = {}
+    flattened = {}
     for column in columns:
         column_type = df.GetColumnType(column)
-        result_ptrs[column] = df.Take[column_type](column)
+        value_type = _flattenable_value_type(column_type) if jagged != "object" else None
+        if value_type is not None:
+            import ROOT
+            take_flattened = ROOT.Internal.RDF.RDataFrameTakeFlattened[value_type]
+            result_ptrs[column] = take_flattened(ROOT.RDF.AsRNode(df), column)
+            flattened[column] = value_type
+        else:
+            result_ptrs[column] = df.Take[column_type](column)
 
-    result = AsNumpyResult(result_ptrs, columns)
+    result = AsNumpyResult(result_ptrs, columns, flattened, jagged)
 
     if lazy:
         return result
@@ -251,8 +295,11 @@ class AsNumpyResult(object):
             column name, the value is the NumPy array for that column.
         _result_ptrs (dict): results of the AsNumpy action. The key is the
             column name, the value is the result pointer for that column.
+        _flattened (dict): value type of the collection columns read as
+            flat buffers, by column name.
+        _jagged (str): format of the flattened columns, "offsets" or "arrow".
     """
-    def __init__(self, result_ptrs, columns):
+    def __init__(self, result_ptrs, columns, flattened=None, jagged="object"):
         """Constructs an AsNumpyResult object.
 
         Parameters:
@@ -260,10 +307,15 @@ class AsNumpyResult(object):
                 column name, the value is the result pointer for that column.
             columns (list): list of the names of the columns returned by
                 AsNumpy.
+            flattened (dict): value type of the collection columns read as
+                flat buffers, by column name.
+            jagged (str): format of the flattened columns.
         """
 
         self._result_ptrs = result_ptrs
         self._columns = columns
+        self._flattened = flattened if flattened else {}
+        self._jagged = jagged
         self._py_arrays = None
 
     def GetValue(self):
@@ -283,7 +335,9 @@ class AsNumpyResult(object):
             self._py_arrays = {}
             for column in self._columns:
                 cpp_reference = self._result_ptrs[column].GetValue()
-                if hasattr(cpp_reference, "__array_interface__"):
+                if column in self._flattened:
+                    self._py_arrays[column] = self._make_jagged(column, cpp_reference)
+                elif hasattr(cpp_reference, "__array_interface__"):
                     tmp = numpy.asarray(cpp_reference) # This adopts the memory of the C++ object.
                     self._py_arrays[column] = ndarray(tmp, self._result_ptrs[column])
                 else:
@@ -294,6 +348,27 @@ class AsNumpyResult(object):
 
         return self._py_arrays
 
+    def _make_jagged(self, column, flat_column):
+        """Wrap the buffers of a flattened collection column without copying them."""
+        import numpy
+        from ROOT._pythonization._rdf_utils import ndarray
+
+        result_ptr = self._result_ptrs[column]
+        offsets = ndarray(numpy.asarray(flat_column.fOffsets), result_ptr)
+        values = ndarray(numpy.asarray(flat_column.fValues), result_ptr)
+        if self._flattened[column] in ("bool", "Bool_t"):
+            values = values.view(numpy.bool_)
+
+        if self._jagged == "arrow":
+            try:
+                import pyarrow
+            except ImportError:
+                raise ImportError("Failed to import pyarrow during call of RDataFrame.AsNumpy with jagged='arrow'.")
+            # The arrays reference the numpy buffers, which keep the C++ result alive
+            return pyarrow.LargeListArray.from_arrays(pyarrow.array(offsets), pyarrow.array(values))
+
+        return (offsets, values)
+
     def Merge(self, other):
         """
         Merges the numpy arrays in the dictionary of this object with the numpy
@@ -321,9 +396,17 @@ class AsNumpyResult(object):
         if not self._py_arrays.keys() == other._py_arrays.keys():
             raise ValueError("The two dictionary of numpy arrays have different keys.")
 
+        def merge(this, that):
+            if isinstance(this, tuple):
+                offsets = numpy.concatenate([this[0], that[0][1:] + this[0][-1]])
+                return (offsets, numpy.concatenate([this[1], that[1]]))
+            if not isinstance(this, numpy.ndarray):
+                import pyarrow
+                return pyarrow.concat_arrays([this, that])
+            return numpy.concatenate([this, that])
+
         self._py_arrays = {
-            key: numpy.concatenate([self._py_arrays[key],
-                                    other._py_arrays[key]])
+            key: merge(self._py_arrays[key], other._py_arrays[key])
             for key in self._py_arrays
         }
 
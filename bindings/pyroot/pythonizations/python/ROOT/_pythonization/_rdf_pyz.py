@@ -252,6 +252,15 @@ def _convert_to_vector(args):
 
     return (v, *args[1:])
 
+def _get_parameter_names(func):
+    """
+    Returns the names of the parameters of the Python callable `func`, used as
+    column names of vectorized Numba callables if none are given.
+    """
+    import inspect
+
+    return list(inspect.signature(func).parameters)
+
 def _handle_cpp_callables(func, original_template, *args):
     """
     Checks whether the callable `func` is a cppyy proxy of one of these:
@@ -314,6 +323,12 @@ def _PyFilter(rdf, callable_or_str, *args, extra_args={}):
        rdf.Filter(x_more_than_y)
        Here the value of y is captured from scope. Thus this is equivalent to the filter "x>0.5".
        Note: Any modifications to the value of y will not be reflected in the function as y would be treated as a compile time constant during the first jit.
+    5. @ROOT.Numba.Declare(["float"], "bool", vectorize=True)
+       def pt_cut(pt):
+           return pt > 100
+       rdf.Filter(pt_cut, ["pt"])
+       Filter using a vectorized Numba callable, which receives numpy arrays. With bulk processing enabled
+       (ROOT.RDF.Experimental.EnableBulkProcessing), it is called once per bulk of entries.
 
 
     """
@@ -329,6 +344,12 @@ def _PyFilter(rdf, callable_or_str, *args, extra_args={}):
             f"Filter takes at most 3 positional arguments but {len(args) + 1} were given")
 
     func = callable_or_str
+    if hasattr(func, '__cpp_functor__'):
+        # Vectorized Numba callable, see ROOT.Numba.Declare: the C++ functor is used, which also evaluates whole
+        # bulks of entries. Without a column list, the parameters of the callable name the columns.
+        if not args or not isinstance(args[0], list):
+            args = (_get_parameter_names(func), *args)
+        func = func.__cpp_functor__
     rdf_node = _handle_cpp_callables(func, rdf._OriginalFilter, func, *_convert_to_vector(args))
     if rdf_node is not None:
         return rdf_node
@@ -385,6 +406,11 @@ def _PyDefine(rdf, col_name, callable_or_str, cols = [] , extra_args = {} ):
     4. def x_scaled(x, u):
             return x*u
        rdf.Define("x_scaled", x_scaled, extra_args = {"u":0.5})
+    5. @ROOT.Numba.Declare(["float"], "double", vectorize=True)
+       def twice(x):
+           return 2. * x
+       rdf.Define("x2", twice, ["x"])
+       Define using a vectorized Numba callable, see the Filter pythonization.
 
     """
     if not isinstance(col_name, str):
@@ -400,6 +426,10 @@ def _PyDefine(rdf, col_name, callable_or_str, cols = [] , extra_args = {} ):
         raise TypeError(f"Define takes a column list as third arguments but {type(cols).__name__} was given.")
     
     func = callable_or_str
+    if hasattr(func, '__cpp_functor__'):
+        # Vectorized Numba callable, see _PyFilter
+        cols = cols if cols else _get_parameter_names(func)
+        func = func.__cpp_functor__
     rdf_node = _handle_cpp_callables(func, rdf._OriginalDefine, col_name, func, cols)
     if rdf_node is not None:
         return rdf_node
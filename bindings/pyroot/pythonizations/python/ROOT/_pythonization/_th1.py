@@ -8,6 +8,8 @@
 # For the list of contributors see $ROOTSYS/README/CREDITS.                    #
 ################################################################################
 
+import cppyy
+
 from . import pythonization
 
 
@@ -23,6 +25,71 @@ def _imul(self, c):
     return self
 
 
+# Filling and setting bin contents with NumPy arrays
+
+def _is_array(obj):
+    # One-dimensional NumPy arrays and other objects exposing the array interface.
+    # Scalars are excluded first, as this check is done for every Fill call
+    return not isinstance(obj, (int, float, str)) and getattr(obj, 'ndim', 0) == 1 and \
+        hasattr(obj, '__array_interface__')
+
+
+def _fill_arrays(self, ncoords, arrays):
+    # Fill the histogram with arrays of coordinates and, optionally, weights
+    # in a single call of FillN
+    import numpy
+
+    if len(arrays) not in (ncoords, ncoords + 1):
+        raise TypeError('Fill takes {} arrays of coordinates and optionally an array of weights ({} given)'
+                        .format(ncoords, len(arrays)))
+    arrays = [numpy.ascontiguousarray(a, dtype=numpy.float64) for a in arrays]
+    n = len(arrays[0])
+    if any(len(a) != n for a in arrays):
+        raise ValueError('The arrays passed to Fill must have the same length')
+    weights = arrays[ncoords] if len(arrays) > ncoords else cppyy.nullptr
+    self.FillN(n, *arrays[:ncoords], weights)
+
+
+def _make_fill(ncoords):
+    # Parameters:
+    # - ncoords: number of coordinates of the entries, i.e. of arrays taken by FillN
+    # Returns:
+    # - A Fill method that also accepts arrays of coordinates and weights
+    def _fill(self, *args, **kwargs):
+        if args and _is_array(args[0]):
+            return _fill_arrays(self, ncoords, args)
+        return self._OriginalFill(*args, **kwargs)
+    return _fill
+
+
+def _set_bin_content(self, *args, **kwargs):
+    # Parameters:
+    # - self: histogram
+    # - args: as for SetBinContent, or an array of global bin numbers and an
+    #   array of contents, which are set in a single call of SetBinContentN
+    if len(args) == 2 and _is_array(args[0]):
+        import numpy
+
+        bins = numpy.ascontiguousarray(args[0], dtype=numpy.int32)
+        contents = numpy.ascontiguousarray(args[1], dtype=numpy.float64)
+        if len(bins) != len(contents):
+            raise ValueError('The arrays of bins and contents passed to SetBinContent must have the same length')
+        self.SetBinContentN(len(bins), bins, contents)
+        return
+    return self._OriginalSetBinContent(*args, **kwargs)
+
+
+def _add_array_methods(klass, ncoords):
+    # Support hist.Fill(x_array[, y_array], [w_array]) and
+    # hist.SetBinContent(bins_array, contents_array). TH3 has no FillN, so
+    # ncoords is None for it and only SetBinContent is pythonized.
+    if ncoords is not None:
+        klass._OriginalFill = klass.Fill
+        klass.Fill = _make_fill(ncoords)
+    klass._OriginalSetBinContent = klass.SetBinContent
+    klass.SetBinContent = _set_bin_content
+
+
 @pythonization('TH1')
 def pythonize_th1(klass):
     # Parameters:
@@ -30,3 +97,21 @@ def pythonize_th1(klass):
 
     # Support hist *= scalar
     klass.__imul__ = _imul
+
+    _add_array_methods(klass, 1)
+
+
+@pythonization('TH2')
+def pythonize_th2(klass):
+    # Parameters:
+    # klass: class to be pythonized
+
+    _add_array_methods(klass, 2)
+
+
+@pythonization('TH3')
+def pythonize_th3(klass):
+    # Parameters:
+    # klass: class to be pythonized
+
+    _add_array_methods(klass, None)
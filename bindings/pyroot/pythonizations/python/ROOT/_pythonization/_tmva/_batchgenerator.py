@@ -13,7 +13,7 @@ class BaseGenerator:
     def get_template(
         self,
         tree_name: str,
-        file_name: str,
+        file_name: str | list[str],
         columns: list[str] = list(),
         max_vec_sizes: dict[str, int] = dict(),
     ) -> Tuple[str, list[int]]:
@@ -89,7 +89,7 @@ class BaseGenerator:
     def __init__(
         self,
         tree_name: str,
-        file_name: str,
+        file_name: str | list[str],
         batch_size: int,
         chunk_size: int,
         columns: list[str] = list(),
@@ -101,12 +101,14 @@ class BaseGenerator:
         validation_split: float = 0.0,
         max_chunks: int = 0,
         shuffle: bool = True,
+        num_loading_threads: int = 1,
     ):
         """Wrapper around the Cpp RBatchGenerator
 
         Args:
             tree_name (str): Name of the tree in the ROOT file
-            file_name (str): Path to the ROOT file
+            file_name (str | list[str]): Path to the ROOT file, or list of
+                paths (glob patterns are accepted) read as a chain
             batch_size (int): Size of the returned chunks.
             chunk_size (int):
                 The size of the chunks loaded from the ROOT file. Higher chunk
@@ -135,6 +137,10 @@ class BaseGenerator:
             shuffle (bool):
                 Batches consist of random events and are shuffled every epoch.
                 Defaults to True.
+            num_loading_threads (int):
+                Number of threads loading chunks in parallel. Only used when
+                no filters are given. The batches keep the order of the chunks
+                whatever the number of threads. Defaults to 1.
         """
 
         try:
@@ -218,6 +224,7 @@ class BaseGenerator:
             max_chunks,
             self.num_columns,
             shuffle,
+            num_loading_threads,
         )
 
         atexit.register(self.DeActivate)
@@ -559,7 +566,7 @@ class ValidationRBatchGenerator:
 
 def CreateNumPyGenerators(
     tree_name: str,
-    file_name: str,
+    file_name: str | list[str],
     batch_size: int,
     chunk_size: int,
     columns: list[str] = list(),
@@ -571,6 +578,7 @@ def CreateNumPyGenerators(
     validation_split: float = 0.0,
     max_chunks: int = 0,
     shuffle: bool = True,
+    num_loading_threads: int = 1,
 ) -> Tuple[TrainRBatchGenerator, ValidationRBatchGenerator]:
     """
     Return two batch generators based on the given ROOT file and tree.
@@ -579,7 +587,8 @@ def CreateNumPyGenerators(
 
     Args:
         tree_name (str): Name of the tree in the ROOT file
-        file_name (str): Path to the ROOT file
+        file_name (str | list[str]): Path to the ROOT file, or list of
+            paths (glob patterns are accepted) read as a chain
         batch_size (int): Size of the returned chunks.
         chunk_size (int):
             The size of the chunks loaded from the ROOT file. Higher chunk size
@@ -604,6 +613,10 @@ def CreateNumPyGenerators(
             If not given, the whole file is used
         shuffle (bool):
             randomize the training batches every epoch. Defaults to True
+        num_loading_threads (int):
+            Number of threads loading chunks in parallel. Only used when
+            no filters are given. The batches keep the order of the chunks
+            whatever the number of threads. Defaults to 1.
 
     Returns:
         Tuple[TrainRBatchGenerator, ValidationRBatchGenerator]:
@@ -626,6 +639,7 @@ def CreateNumPyGenerators(
         validation_split,
         max_chunks,
         shuffle,
+        num_loading_threads,
     )
 
     train_generator = TrainRBatchGenerator(
@@ -640,7 +654,7 @@ def CreateNumPyGenerators(
 
 def CreateTFDatasets(
     tree_name: str,
-    file_name: str,
+    file_name: str | list[str],
     batch_size: int,
     chunk_size: int,
     columns: list[str] = list(),
@@ -652,6 +666,7 @@ def CreateTFDatasets(
     validation_split: float = 0.0,
     max_chunks: int = 0,
     shuffle: bool = True,
+    num_loading_threads: int = 1,
 ) -> Tuple[tf.data.Dataset, tf.data.Dataset]:
     """
     Return two Tensorflow Datasets based on the given ROOT file and tree
@@ -660,7 +675,8 @@ def CreateTFDatasets(
 
     Args:
         tree_name (str): Name of the tree in the ROOT file
-        file_name (str): Path to the ROOT file
+        file_name (str | list[str]): Path to the ROOT file, or list of
+            paths (glob patterns are accepted) read as a chain
         batch_size (int): Size of the returned chunks.
         chunk_size (int):
             The size of the chunks loaded from the ROOT file. Higher chunk size
@@ -685,6 +701,10 @@ def CreateTFDatasets(
             If not given, the whole file is used
         shuffle (bool):
             randomize the training batches every epoch. Defaults to True
+        num_loading_threads (int):
+            Number of threads loading chunks in parallel. Only used when
+            no filters are given. The batches keep the order of the chunks
+            whatever the number of threads. Defaults to 1.
 
     Returns:
         Tuple[TrainRBatchGenerator, ValidationRBatchGenerator]:
@@ -709,6 +729,7 @@ def CreateTFDatasets(
         validation_split,
         max_chunks,
         shuffle,
+        num_loading_threads,
     )
 
     train_generator = TrainRBatchGenerator(
@@ -766,7 +787,7 @@ def CreateTFDatasets(
 
 def CreatePyTorchGenerators(
     tree_name: str,
-    file_name: str,
+    file_name: str | list[str],
     batch_size: int,
     chunk_size: int,
     columns: list[str] = list(),
@@ -778,6 +799,7 @@ def CreatePyTorchGenerators(
     validation_split: float = 0.0,
     max_chunks: int = 0,
     shuffle: bool = True,
+    num_loading_threads: int = 1,
 ) -> Tuple[TrainRBatchGenerator, ValidationRBatchGenerator]:
     """
     Return two Tensorflow Datasets based on the given ROOT file and tree
@@ -786,7 +808,8 @@ def CreatePyTorchGenerators(
 
     Args:
         tree_name (str): Name of the tree in the ROOT file
-        file_name (str): Path to the ROOT file
+        file_name (str | list[str]): Path to the ROOT file, or list of
+            paths (glob patterns are accepted) read as a chain
         batch_size (int): Size of the returned chunks.
         chunk_size (int):
             The size of the chunks loaded from the ROOT file. Higher chunk size
@@ -811,6 +834,10 @@ def CreatePyTorchGenerators(
             If not given, the whole file is used
         shuffle (bool):
             randomize the training batches every epoch. Defaults to True
+        num_loading_threads (int):
+            Number of threads loading chunks in parallel. Only used when
+            no filters are given. The batches keep the order of the chunks
+            whatever the number of threads. Defaults to 1.
 
     Returns:
         Tuple[TrainRBatchGenerator, ValidationRBatchGenerator]:
@@ -833,6 +860,7 @@ def CreatePyTorchGenerators(
         validation_split,
         max_chunks,
         shuffle,
+        num_loading_threads,
     )
 
     train_generator = TrainRBatchGenerator(
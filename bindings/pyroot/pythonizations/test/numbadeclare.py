@@ -600,5 +600,50 @@ class NumbaDeclareArray(unittest.TestCase):
         self.assertTrue(np.array_equal(rvecf, np.array([1.,4.])))
 
 
+class NumbaDeclareVectorized(unittest.TestCase):
+    """
+    Test decorator to create C++ functors for Python callables working on arrays
+    """
+
+    @unittest.skipIf(skip, skip_reason)
+    def test_wrapper_scalar_call(self):
+        """
+        Test calling the functor entry by entry
+        """
+        @ROOT.Numba.Declare(["float", "int"], "double", vectorize=True)
+        def vec_scale(x, n):
+            return x * n
+
+        self.assertEqual(ROOT.Numba.vec_scale(1.5, 2), 3.0)
+        self.assertTrue(hasattr(vec_scale, "__cpp_functor__"))
+
+    @unittest.skipIf(skip, skip_reason)
+    def test_wrapper_rvec_input(self):
+        """
+        Test that RVec input types are rejected
+        """
+        with self.assertRaises(Exception):
+            ROOT.Numba.Declare(["RVecF"], "float", vectorize=True)(lambda v: v)
+
+    @unittest.skipIf(skip, skip_reason)
+    def test_rdataframe_bulks(self):
+        """
+        Test Filter and Define with vectorized callables, with and without bulk processing
+        """
+        @ROOT.Numba.Declare(["unsigned long"], "bool", vectorize=True)
+        def vec_even(rdfentry_):
+            return rdfentry_ % 2 == 0
+
+        @ROOT.Numba.Declare(["unsigned long"], vectorize=True)
+        def vec_half(e):
+            return e / 2.
+
+        for bulk_size in [0, 16]:
+            df = ROOT.RDataFrame(100)
+            ROOT.RDF.Experimental.EnableBulkProcessing(ROOT.RDF.AsRNode(df), bulk_size)
+            s = df.Filter(vec_even).Define("half", vec_half, ["rdfentry_"]).Sum("half")
+            self.assertEqual(s.GetValue(), sum(e / 2. for e in range(0, 100, 2)))
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -308,6 +308,33 @@ class RDataFrameAsNumpy(unittest.TestCase):
         pyarr[0][0] = 42
         self.assertTrue(cpparr[0][0] == pyarr[0][0])
 
+    def test_jagged_offsets(self):
+        """
+        Testing readout of collections as flat offsets and values arrays
+        """
+        df = ROOT.ROOT.RDataFrame(4).Define("x", "ROOT::RVec<float>(rdfentry_, rdfentry_)") \
+                                    .Define("y", "(int)rdfentry_")
+        npy = df.AsNumpy(["x", "y"], jagged="offsets")
+        offsets, values = npy["x"]
+        self.assertTrue(all(offsets == np.array([0, 0, 1, 3, 6])))
+        self.assertEqual(values.dtype, np.float32)
+        self.assertTrue(all(values == np.array([1, 2, 2, 3, 3, 3])))
+        self.assertTrue(all(npy["y"] == np.array([0, 1, 2, 3])))
+
+    def test_jagged_offsets_merge(self):
+        """
+        Testing merging of AsNumpy results with flattened collections
+        """
+        df = ROOT.ROOT.RDataFrame(3).Define("x", "std::vector<int>(rdfentry_, rdfentry_)")
+        res1 = df.AsNumpy(["x"], jagged="offsets", lazy=True)
+        res2 = df.AsNumpy(["x"], jagged="offsets", lazy=True)
+        res1.GetValue()
+        res2.GetValue()
+        res1.Merge(res2)
+        offsets, values = res1.GetValue()["x"]
+        self.assertTrue(all(offsets == np.array([0, 0, 1, 3, 3, 4, 6])))
+        self.assertTrue(all(values == np.array([1, 2, 2, 1, 2, 2])))
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,62 @@
+import unittest
+
+import numpy as np
+
+import ROOT
+
+
+class TH1NumPy(unittest.TestCase):
+    """
+    Test for the Fill and SetBinContent pythonizations of TH1, TH2 and TH3,
+    which accept NumPy arrays.
+    """
+
+    # Tests
+    def test_fill_1d(self):
+        x = np.array([0.5, 1.5, 1.5, 2.5])
+        h = ROOT.TH1D("h1", "", 4, 0, 4)
+        h.Fill(x)
+        ref = ROOT.TH1D("ref1", "", 4, 0, 4)
+        for v in x:
+            ref.Fill(v)
+        for i in range(h.GetNcells()):
+            self.assertEqual(h.GetBinContent(i), ref.GetBinContent(i))
+        self.assertEqual(h.GetEntries(), 4)
+
+        # Weights, and arrays of other types
+        h.Reset()
+        h.Fill(np.array([0, 1], dtype=np.float32), np.array([2, 3], dtype=np.int64))
+        self.assertEqual(h.GetBinContent(1), 2)
+        self.assertEqual(h.GetBinContent(2), 3)
+
+        # Scalars still work
+        self.assertEqual(h.Fill(3.5), 4)
+
+    def test_fill_2d(self):
+        h = ROOT.TH2D("h2", "", 2, 0, 2, 2, 0, 2)
+        h.Fill(np.array([0.5, 1.5]), np.array([1.5, 1.5]), np.array([1., 4.]))
+        self.assertEqual(h.GetBinContent(1, 2), 1)
+        self.assertEqual(h.GetBinContent(2, 2), 4)
+        self.assertEqual(h.GetBinContent(1, 1), 0)
+
+    def test_fill_errors(self):
+        h = ROOT.TH1D("h3", "", 2, 0, 2)
+        with self.assertRaises(ValueError):
+            h.Fill(np.array([0.5, 1.5]), np.array([1.]))
+        with self.assertRaises(TypeError):
+            h.Fill(np.array([0.5]), np.array([1.]), np.array([1.]))
+
+    def test_set_bin_content(self):
+        for h in [ROOT.TH1F("h4", "", 4, 0, 4), ROOT.TH2F("h5", "", 2, 0, 2, 2, 0, 2),
+                  ROOT.TH3F("h6", "", 2, 0, 2, 2, 0, 2, 2, 0, 2)]:
+            bins = np.array([h.GetBin(1, 1, 1), h.GetBin(2, 1, 1)])
+            h.SetBinContent(bins, np.array([3., 5.]))
+            self.assertEqual(h.GetBinContent(int(bins[0])), 3)
+            self.assertEqual(h.GetBinContent(int(bins[1])), 5)
+            # the usual signatures are preserved
+            h.SetBinContent(int(bins[0]), 7.)
+            self.assertEqual(h.GetBinContent(int(bins[0])), 7)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,21 @@
+# Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.
+# All rights reserved.
+#
+# For the licensing terms see $ROOTSYS/LICENSE.
+# For the list of contributors see $ROOTSYS/README/CREDITS.
+
+# - Locate libdeflate library
+#
+# Defines:
+#
+# LIBDEFLATE_FOUND
+# LIBDEFLATE_LIBRARY
+# LIBDEFLATE_INCLUDE_DIR
+
+find_library(LIBDEFLATE_LIBRARY NAMES deflate libdeflate)
+find_path(LIBDEFLATE_INCLUDE_DIR NAMES libdeflate.h)
+
+include(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(libdeflate DEFAULT_MSG LIBDEFLATE_LIBRARY LIBDEFLATE_INCLUDE_DIR)
+
+mark_as_advanced(LIBDEFLATE_FOUND LIBDEFLATE_LIBRARY LIBDEFLATE_INCLUDE_DIR)
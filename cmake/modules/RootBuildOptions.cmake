@@ -139,15 +139,19 @@ ROOT_BUILD_OPTION(gviz OFF "Enable support for Graphviz (graph visualization sof
 ROOT_BUILD_OPTION(http ON "Enable support for HTTP server")
 ROOT_BUILD_OPTION(fcgi OFF "Enable FastCGI support in HTTP server")
 ROOT_BUILD_OPTION(imt ON "Enable support for implicit multi-threading via Intel® Thread Building Blocks (TBB)")
+ROOT_BUILD_OPTION(interpreter_free_io OFF "Run programs without the C++ interpreter by default, for I/O with the compiled dictionaries only (requires runtime_cxxmodules=OFF)")
 ROOT_BUILD_OPTION(jemalloc OFF "Use jemalloc memory allocator, deprecated")
 ROOT_BUILD_OPTION(libcxx OFF "Build using libc++")
+ROOT_BUILD_OPTION(libdeflate OFF "Enable libdeflate for decompressing zlib buffers (requires libdeflate)")
 ROOT_BUILD_OPTION(macos_native OFF "Disable looking for libraries, includes and binaries in locations other than a native installation (MacOS only)")
 ROOT_BUILD_OPTION(mathmore OFF "Build libMathMore extended math library (requires GSL) [GPL]")
+ROOT_BUILD_OPTION(matrix-blas OFF "Use BLAS and LAPACK for the multiplications and decompositions of large TMatrixT matrices")
 ROOT_BUILD_OPTION(memory_termination OFF "Free internal ROOT memory before process termination (experimental, used for leak checking)")
 ROOT_BUILD_OPTION(mlp ON "Enable support for TMultilayerPerceptron classes' federation")
 ROOT_BUILD_OPTION(minuit2 ON "Build Minuit2 minimization library")
 ROOT_BUILD_OPTION(minuit2_mpi OFF "Enable support for MPI in Minuit2")
 ROOT_BUILD_OPTION(minuit2_omp OFF "Enable support for OpenMP in Minuit2")
+ROOT_BUILD_OPTION(minuit2_blas OFF "Use BLAS and LAPACK for the linear algebra of Minuit2 (for fits with many parameters)")
 ROOT_BUILD_OPTION(monalisa OFF "Enable support for monitoring with Monalisa (requires libapmoncpp), deprecated")
 ROOT_BUILD_OPTION(mpi OFF "Enable support for Message Passing Interface (MPI)")
 ROOT_BUILD_OPTION(mysql ON "Enable support for MySQL databases")
@@ -183,6 +187,7 @@ ROOT_BUILD_OPTION(tmva-gpu OFF "Build TMVA with GPU support for deep learning (r
 ROOT_BUILD_OPTION(tmva-sofie OFF "Build TMVA with support for sofie - fast inference code generation (requires protobuf 3)")
 ROOT_BUILD_OPTION(tmva-pymva ON "Enable support for Python in TMVA (requires numpy)")
 ROOT_BUILD_OPTION(tmva-rmva OFF "Enable support for R in TMVA")
+ROOT_BUILD_OPTION(tracing OFF "Enable the recording of timelines of ROOT internal tasks, toggled at runtime with the Root.Tracing rootrc variable")
 ROOT_BUILD_OPTION(spectrum ON "Enable support for TSpectrum")
 ROOT_BUILD_OPTION(unuran OFF "Enable support for UNURAN (package for generating non-uniform random numbers) [GPL]")
 ROOT_BUILD_OPTION(uring OFF "Enable support for io_uring (requires liburing and Linux kernel >= 5.1)")
@@ -362,6 +367,15 @@ if(roofit_multiprocess AND NOT minuit2)
     set(minuit2 ON CACHE BOOL "" FORCE)
 endif()
 
+# Without interpreter, the rdict.pcm files must be on disk: with runtime C++ modules they are stored
+# in the module files, which only cling can read.
+if(interpreter_free_io AND runtime_cxxmodules)
+    message(FATAL_ERROR ">>> Option 'interpreter_free_io' requires runtime_cxxmodules=OFF.")
+endif()
+if(interpreter_free_io AND WIN32)
+    message(FATAL_ERROR ">>> Option 'interpreter_free_io' is not supported on Windows.")
+endif()
+
 #---Options depending of CMake Generator-------------------------------------------------------
 if( CMAKE_GENERATOR STREQUAL Ninja)
    set(fortran_defvalue OFF)
@@ -415,6 +415,11 @@ if(dataframe)
 else()
   set(hasdataframe undef)
 endif()
+if(root7)
+  set(hasroot7 define)
+else()
+  set(hasroot7 undef)
+endif()
 if(dev)
   set(use_less_includes define)
 else()
@@ -504,6 +509,21 @@ if (uring)
 else()
   set(hasuring undef)
 endif()
+if (libdeflate)
+  set(haslibdeflate define)
+else()
+  set(haslibdeflate undef)
+endif()
+if (tracing)
+  set(hastracing define)
+else()
+  set(hastracing undef)
+endif()
+if (interpreter_free_io)
+  set(hasinterpreterfreeio define)
+else()
+  set(hasinterpreterfreeio undef)
+endif()
 if (roofit_multiprocess)
   set(hasroofit_multiprocess define)
 else()
@@ -863,16 +863,17 @@ if(builtin_fftw3)
   set(FFTW_VERSION 3.3.8)
   message(STATUS "Downloading and building FFTW version ${FFTW_VERSION}")
   set(FFTW_LIBRARIES ${CMAKE_BINARY_DIR}/lib/libfftw3.a)
+  set(FFTW_THREADS_LIBRARY ${CMAKE_BINARY_DIR}/lib/libfftw3_threads.a)
   ExternalProject_Add(
     FFTW3
     URL ${lcgpackages}/fftw-${FFTW_VERSION}.tar.gz
     URL_HASH SHA256=6113262f6e92c5bd474f2875fa1b01054c4ad5040f6b0da7c03c98821d9ae303
     INSTALL_DIR ${CMAKE_BINARY_DIR}
-    CONFIGURE_COMMAND ./configure --prefix=<INSTALL_DIR>
+    CONFIGURE_COMMAND ./configure --prefix=<INSTALL_DIR> --enable-threads
     BUILD_COMMAND make CFLAGS=-fPIC
     LOG_DOWNLOAD 1 LOG_CONFIGURE 1 LOG_BUILD 1 LOG_INSTALL 1
     BUILD_IN_SOURCE 1
-    BUILD_BYPRODUCTS ${FFTW_LIBRARIES}
+    BUILD_BYPRODUCTS ${FFTW_LIBRARIES} ${FFTW_THREADS_LIBRARY}
     TIMEOUT 600
   )
   set(FFTW_INCLUDE_DIR ${CMAKE_BINARY_DIR}/include)
@@ -1247,6 +1248,20 @@ if (uring)
   endif()
 endif()
 
+#---Check for libdeflate--------------------------------------------------------------
+if (libdeflate)
+  message(STATUS "Looking for libdeflate")
+  find_package(libdeflate)
+  if(NOT LIBDEFLATE_FOUND)
+    if(fail-on-missing)
+      message(FATAL_ERROR "libdeflate not found and libdeflate option required")
+    else()
+      message(STATUS "libdeflate not found. Switching off libdeflate option")
+      set(libdeflate OFF CACHE BOOL "Disabled because libdeflate was not found (${libdeflate_description})" FORCE)
+    endif()
+  endif()
+endif()
+
 #---Check for DAOS----------------------------------------------------------------
 if (daos AND daos_mock)
   message(FATAL_ERROR "Options `daos` and `daos_mock` are mutually exclusive; only one of them should be specified.")
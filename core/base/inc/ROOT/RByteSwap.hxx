@@ -0,0 +1,33 @@
+// @(#)root/base
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RByteSwap
+#define ROOT_RByteSwap
+
+#include <cstddef>
+
+namespace ROOT {
+namespace Internal {
+
+/// \name Byte-swapping copies of arrays
+/// Copy n elements of 2, 4 or 8 bytes from `from` to `to`, reversing the byte order of each element,
+/// e.g. to convert arrays between the big-endian ROOT file format and a little-endian host.
+/// `to` and `from` may be identical (in-place swap) but must not otherwise overlap, and need no alignment.
+/// SSSE3 or AVX2 kernels are selected at run time on x86, NEON kernels are used on ARM.
+///@{
+void ByteSwapCopy16(void *to, const void *from, std::size_t n);
+void ByteSwapCopy32(void *to, const void *from, std::size_t n);
+void ByteSwapCopy64(void *to, const void *from, std::size_t n);
+///@}
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,142 @@
+// @(#)root/base
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RMetricsRegistry
+#define ROOT_RMetricsRegistry
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+/**
+\class ROOT::Experimental::RMetric
+\ingroup Base
+\brief A process-wide performance counter or gauge, updated with relaxed atomic operations
+
+Metrics are created and owned by the RMetricsRegistry; the references it hands out stay valid until the end of the
+process, so that instrumented code can keep them in function-local statics.
+*/
+class RMetric {
+public:
+   enum class EKind {
+      kCounter, ///< monotonically increasing, e.g. bytes read
+      kGauge    ///< current value, e.g. busy threads
+   };
+
+private:
+   std::string fName;
+   std::string fHelp;
+   std::string fUnit;
+   EKind fKind;
+   double fScale;
+   std::atomic<std::int64_t> fValue{0};
+
+public:
+   RMetric(const std::string &name, const std::string &help, EKind kind, const std::string &unit, double scale)
+      : fName(name), fHelp(help), fUnit(unit), fKind(kind), fScale(scale)
+   {
+   }
+   RMetric(const RMetric &) = delete;
+   RMetric &operator=(const RMetric &) = delete;
+
+   void Add(std::int64_t value) { fValue.fetch_add(value, std::memory_order_relaxed); }
+   void Inc() { Add(1); }
+   void Dec() { Add(-1); }
+   void Set(std::int64_t value) { fValue.store(value, std::memory_order_relaxed); }
+   std::int64_t GetValue() const { return fValue.load(std::memory_order_relaxed); }
+   /// The value in the exported unit, e.g. seconds for a counter of nanoseconds with scale 1e-9
+   double GetScaledValue() const { return GetValue() * fScale; }
+
+   const std::string &GetName() const { return fName; }
+   const std::string &GetHelp() const { return fHelp; }
+   const std::string &GetUnit() const { return fUnit; }
+   EKind GetKind() const { return fKind; }
+};
+
+/**
+\class ROOT::Experimental::RMetricsRegistry
+\ingroup Base
+\brief The process-wide registry of the I/O, CPU and thread pool performance metrics of ROOT
+
+The registry holds two kinds of metrics:
+ - RMetric counters and gauges that instrumented code updates as it runs, e.g. the decompression time of TTree baskets,
+   the TTreeCache hits and misses or the number of entries processed by RDataFrame event loops;
+ - collectors, callbacks that sample statistics kept elsewhere when the metrics are exported, e.g. the bytes read by
+   all TFiles or the size of the thread pool.
+
+Updating an RMetric costs one relaxed atomic operation. Metrics that require taking timestamps in hot code paths are
+only measured if IsEnabled() returns true, which is the case if the `Root.Metrics` rootrc variable is set or after a
+call to Enable(). ToOpenMetrics() returns all metrics in the OpenMetrics text format, as served by THttpServer on its
+`metrics` page (see THttpServer::SetMetrics()).
+
+Metric names follow the OpenMetrics conventions: they start with `root_`, use underscores and end with their unit;
+counters are exported with the `_total` suffix.
+*/
+class RMetricsRegistry {
+public:
+   /// A value produced by a collector
+   struct RSample {
+      std::string fName;
+      std::string fHelp;
+      RMetric::EKind fKind = RMetric::EKind::kGauge;
+      std::string fUnit;
+      double fValue = 0.;
+   };
+   using Collector_t = std::function<void(std::vector<RSample> &)>;
+
+private:
+   mutable std::mutex fMutex;
+   std::map<std::string, std::unique_ptr<RMetric>> fMetrics;
+   std::map<std::size_t, Collector_t> fCollectors;
+   std::size_t fLastCollectorId = 0;
+
+   static std::atomic<bool> &GetEnabledFlag();
+
+   RMetricsRegistry() = default;
+
+public:
+   RMetricsRegistry(const RMetricsRegistry &) = delete;
+   RMetricsRegistry &operator=(const RMetricsRegistry &) = delete;
+
+   static RMetricsRegistry &Instance();
+
+   /// Whether the metrics that have a measurable cost, e.g. timings in hot code paths, are measured
+   static bool IsEnabled() { return GetEnabledFlag().load(std::memory_order_relaxed); }
+   static void Enable(bool on = true) { GetEnabledFlag().store(on, std::memory_order_relaxed); }
+
+   /// Return the metric with the given name, creating it if it does not exist yet. The exported value is the stored
+   /// integer multiplied by `scale`, e.g. 1e-9 to store nanoseconds and export seconds.
+   /// Throws std::logic_error if a metric with the same name but of a different kind exists.
+   RMetric &GetMetric(const std::string &name, const std::string &help, RMetric::EKind kind = RMetric::EKind::kCounter,
+                      const std::string &unit = "", double scale = 1.);
+
+   /// Register a callback that adds samples to the exported metrics, return its identifier for RemoveCollector()
+   std::size_t AddCollector(Collector_t collector);
+   void RemoveCollector(std::size_t id);
+
+   /// Return the current values of all the metrics and of the samples of all the collectors, sorted by name
+   std::vector<RSample> Collect() const;
+
+   /// Return all the metrics in the OpenMetrics text exposition format
+   std::string ToOpenMetrics() const;
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
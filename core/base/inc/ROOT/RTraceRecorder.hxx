@@ -0,0 +1,125 @@
+// @(#)root/base
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RTraceRecorder
+#define ROOT_RTraceRecorder
+
+#include "RConfigure.h" // R__HAS_TRACING
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+/**
+\class ROOT::Experimental::RTraceRecorder
+\ingroup Base
+\brief Records a timeline of the ROOT internal tasks, written in the Chrome trace event format
+
+Instrumented code marks the stages it wants to appear on the timeline with R__TRACE_SCOPE(category, name), e.g. the
+cluster reading of RNTuple, the TTreeCacheUnzip tasks, the RDataFrame tasks and the TThreadExecutor tasks. Each
+thread records its events in its own ring buffer of `Root.Tracing.BufferSize` events, so that recording only takes
+an uncontended lock; when a buffer is full, the oldest events are overwritten.
+
+The macros compile to nothing unless ROOT is built with `-Dtracing=ON`; recording is then switched on at runtime with
+the `Root.Tracing` rootrc variable or with Enable(). If `Root.Tracing.File` is set, the trace is written to that file
+at the end of the process. The file can be opened with https://ui.perfetto.dev or chrome://tracing.
+
+The category and name of the events must be string literals: only the pointers are stored.
+*/
+class RTraceRecorder {
+public:
+   /// A completed stage of a task
+   struct REvent {
+      const char *fCategory = nullptr;
+      const char *fName = nullptr;
+      const char *fArgName = nullptr; ///< name of fArg, nullptr if the event has no argument
+      std::int64_t fArg = 0;
+      std::int64_t fStart = 0;    ///< in nanoseconds, see Now()
+      std::int64_t fDuration = 0; ///< in nanoseconds
+   };
+
+private:
+   static std::atomic<bool> &GetEnabledFlag();
+
+public:
+   static bool IsEnabled() { return GetEnabledFlag().load(std::memory_order_relaxed); }
+   static void Enable(bool on = true) { GetEnabledFlag().store(on, std::memory_order_relaxed); }
+
+   /// Nanoseconds since the start of the recording clock
+   static std::int64_t Now();
+
+   /// Record an event of the calling thread, lasting from `start` to `end` (as returned by Now())
+   static void Record(const char *category, const char *name, std::int64_t start, std::int64_t end,
+                      const char *argName = nullptr, std::int64_t arg = 0);
+
+   /// Return the events currently held by the buffers of all threads, each with the index of its thread
+   static std::vector<std::pair<unsigned int, REvent>> GetEvents();
+   /// Discard all the recorded events
+   static void Clear();
+
+   /// Write the recorded events as a Chrome trace JSON document
+   static void WriteChromeTrace(std::ostream &os);
+   /// Write the recorded events as a Chrome trace JSON document to the given file; return false on error
+   static bool WriteChromeTrace(const std::string &fileName);
+};
+
+/**
+\class ROOT::Experimental::RTraceScope
+\ingroup Base
+\brief Records an event lasting for the lifetime of the object, if tracing is enabled. Use R__TRACE_SCOPE.
+*/
+class RTraceScope {
+   const char *fCategory;
+   const char *fName;
+   const char *fArgName;
+   std::int64_t fArg;
+   std::int64_t fStart = -1;
+
+public:
+   RTraceScope(const char *category, const char *name, const char *argName = nullptr, std::int64_t arg = 0)
+      : fCategory(category), fName(name), fArgName(argName), fArg(arg)
+   {
+      if (RTraceRecorder::IsEnabled())
+         fStart = RTraceRecorder::Now();
+   }
+   ~RTraceScope()
+   {
+      if (fStart >= 0)
+         RTraceRecorder::Record(fCategory, fName, fStart, RTraceRecorder::Now(), fArgName, fArg);
+   }
+   RTraceScope(const RTraceScope &) = delete;
+   RTraceScope &operator=(const RTraceScope &) = delete;
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#define R__TRACE_CONCAT_IMPL(A, B) A##B
+#define R__TRACE_CONCAT(A, B) R__TRACE_CONCAT_IMPL(A, B)
+
+#ifdef R__HAS_TRACING
+/// Record the rest of the enclosing scope as an event of the timeline, see ROOT::Experimental::RTraceRecorder
+#define R__TRACE_SCOPE(CATEGORY, NAME) \
+   ::ROOT::Experimental::RTraceScope R__TRACE_CONCAT(R__traceScope, __LINE__)(CATEGORY, NAME)
+/// Same as R__TRACE_SCOPE, with an integer argument shown with the event, e.g. the processing slot
+#define R__TRACE_SCOPE_ARG(CATEGORY, NAME, ARGNAME, ARG) \
+   ::ROOT::Experimental::RTraceScope R__TRACE_CONCAT(R__traceScope, __LINE__)(CATEGORY, NAME, ARGNAME, ARG)
+#else
+#define R__TRACE_SCOPE(CATEGORY, NAME)
+#define R__TRACE_SCOPE_ARG(CATEGORY, NAME, ARGNAME, ARG)
+#endif
+
+#endif
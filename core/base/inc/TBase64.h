@@ -34,6 +34,7 @@ public:
    static TString Encode(const char *data);
    static TString Encode(const char *data, Int_t len);
    static TString Decode(const char *data);
+   static Int_t   Decode(const char *data, Int_t len, char *out, Int_t maxlen);
 
    ClassDef(TBase64,0)  // Base64 encoding/decoding
 };
@@ -344,6 +344,8 @@ public:
    static void        IndentLevel();
    static void        Initialize();
    static Bool_t      Initialized();
+   static void        DisableInterpreter();
+   static Bool_t      IsInterpreterDisabled();
    static void        SetDirLevel(Int_t level = 0);
    static Int_t       ConvertVersionCode2Int(Int_t code);
    static Int_t       ConvertVersionInt2Code(Int_t v);
@@ -74,10 +74,18 @@ public:
    virtual void  SetType(Int_t /*type*/ = -111) { }
    virtual Int_t GetType() const { return 111; }
 
+   static TVirtualPS *&PS();  // Return the current PostScript driver for this thread.
+
    ClassDefOverride(TVirtualPS,0)  //Abstract interface to a PostScript driver
 };
 
 
+#ifndef __CINT__
+#define gVirtualPS (TVirtualPS::PS())
+
+#elif defined(__MAKECINT__)
+// To properly handle the use of gVirtualPS in header files (in static declarations)
 R__EXTERN TVirtualPS  *gVirtualPS;
+#endif
 
 #endif
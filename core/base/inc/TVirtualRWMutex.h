@@ -71,6 +71,17 @@ public:
       virtual ~StateDelta(); // implemented in TVirtualMutex.cxx
    };
 
+   /// \class ContentionStats
+   /// Counters of the lock acquisitions which had to wait, as returned by
+   /// `GetContentionStats()`. The uncontended acquisitions are not timed.
+   struct ContentionStats {
+      ULong64_t fNWriteLocks = 0;          ///< Number of write locks, including re-entries
+      ULong64_t fNContendedReadLocks = 0;  ///< Number of read locks which waited for a writer
+      ULong64_t fNContendedWriteLocks = 0; ///< Number of write locks which waited for another writer or for readers
+      Double_t fReadWaitTime = 0;          ///< Total time spent waiting for read locks, in seconds
+      Double_t fWriteWaitTime = 0;         ///< Total time spent waiting for write locks, in seconds
+   };
+
    virtual Hint_t *ReadLock() = 0;
    virtual void ReadUnLock(Hint_t *) = 0;
    virtual Hint_t *WriteLock() = 0;
@@ -85,6 +96,12 @@ public:
    virtual std::unique_ptr<StateDelta> Rewind(const State& earlierState) = 0;
    virtual void Apply(std::unique_ptr<StateDelta> &&delta) = 0;
 
+   /// Return the statistics of the lock acquisitions which had to wait, e.g.
+   /// `ROOT::gCoreMutex->GetContentionStats()` to find whether the global lock
+   /// is a bottleneck; implementations without statistics return zeros.
+   virtual ContentionStats GetContentionStats() { return {}; }
+   virtual void ResetContentionStats() {}
+
    TVirtualRWMutex *Factory(Bool_t /*recursive*/ = kFALSE) override = 0;
 
    ClassDefOverride(TVirtualRWMutex, 0)  // Virtual mutex lock class
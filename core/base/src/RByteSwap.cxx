@@ -0,0 +1,164 @@
+// @(#)root/base
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RByteSwap.hxx"
+#include "Byteswap.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define R__BYTESWAP_X86
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#define R__BYTESWAP_NEON
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+inline std::uint16_t Swap(std::uint16_t x)
+{
+   return Rbswap_16(x);
+}
+inline std::uint32_t Swap(std::uint32_t x)
+{
+   return Rbswap_32(x);
+}
+inline std::uint64_t Swap(std::uint64_t x)
+{
+   return Rbswap_64(x);
+}
+
+template <typename T>
+void ByteSwapCopyScalar(char *to, const char *from, std::size_t n)
+{
+   for (std::size_t i = 0; i < n; ++i) {
+      T value;
+      memcpy(&value, from + i * sizeof(T), sizeof(T));
+      value = Swap(value);
+      memcpy(to + i * sizeof(T), &value, sizeof(T));
+   }
+}
+
+using Kernel_t = void (*)(char *, const char *, std::size_t);
+
+#ifdef R__BYTESWAP_X86
+/// The pshufb mask reversing the bytes of each element of sizeof(T) bytes in a register of Width bytes
+template <typename T, std::size_t Width>
+struct ShuffleMask {
+   alignas(32) char fBytes[Width];
+   ShuffleMask()
+   {
+      for (std::size_t j = 0; j < Width; ++j)
+         fBytes[j] = static_cast<char>((j / sizeof(T)) * sizeof(T) + (sizeof(T) - 1 - j % sizeof(T)));
+   }
+};
+
+template <typename T>
+__attribute__((target("ssse3"))) void ByteSwapCopySSSE3(char *to, const char *from, std::size_t n)
+{
+   static const ShuffleMask<T, 16> kMask;
+   const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i *>(kMask.fBytes));
+   const std::size_t nbytes = n * sizeof(T);
+   std::size_t i = 0;
+   for (; i + 16 <= nbytes; i += 16) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(to + i), _mm_shuffle_epi8(v, mask));
+   }
+   ByteSwapCopyScalar<T>(to + i, from + i, (nbytes - i) / sizeof(T));
+}
+
+template <typename T>
+__attribute__((target("avx2"))) void ByteSwapCopyAVX2(char *to, const char *from, std::size_t n)
+{
+   // _mm256_shuffle_epi8 shuffles within each 128 bit lane, the mask is the same in both lanes.
+   static const ShuffleMask<T, 32> kMask;
+   const __m256i mask = _mm256_load_si256(reinterpret_cast<const __m256i *>(kMask.fBytes));
+   const std::size_t nbytes = n * sizeof(T);
+   std::size_t i = 0;
+   for (; i + 64 <= nbytes; i += 64) {
+      const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + i));
+      const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + i + 32));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(to + i), _mm256_shuffle_epi8(v0, mask));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(to + i + 32), _mm256_shuffle_epi8(v1, mask));
+   }
+   for (; i + 32 <= nbytes; i += 32) {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(from + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(to + i), _mm256_shuffle_epi8(v, mask));
+   }
+   ByteSwapCopyScalar<T>(to + i, from + i, (nbytes - i) / sizeof(T));
+}
+#endif
+
+#ifdef R__BYTESWAP_NEON
+template <typename T>
+void ByteSwapCopyNEON(char *to, const char *from, std::size_t n)
+{
+   const std::size_t nbytes = n * sizeof(T);
+   std::size_t i = 0;
+   for (; i + 16 <= nbytes; i += 16) {
+      const uint8x16_t v = vld1q_u8(reinterpret_cast<const std::uint8_t *>(from + i));
+      uint8x16_t swapped;
+      if (sizeof(T) == 2)
+         swapped = vrev16q_u8(v);
+      else if (sizeof(T) == 4)
+         swapped = vrev32q_u8(v);
+      else
+         swapped = vrev64q_u8(v);
+      vst1q_u8(reinterpret_cast<std::uint8_t *>(to + i), swapped);
+   }
+   ByteSwapCopyScalar<T>(to + i, from + i, (nbytes - i) / sizeof(T));
+}
+#endif
+
+template <typename T>
+Kernel_t SelectKernel()
+{
+#if defined(R__BYTESWAP_X86)
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx2"))
+      return &ByteSwapCopyAVX2<T>;
+   if (__builtin_cpu_supports("ssse3"))
+      return &ByteSwapCopySSSE3<T>;
+#elif defined(R__BYTESWAP_NEON)
+   return &ByteSwapCopyNEON<T>;
+#endif
+   return &ByteSwapCopyScalar<T>;
+}
+
+template <typename T>
+void ByteSwapCopy(void *to, const void *from, std::size_t n)
+{
+   // Arrays shorter than a vector register are not worth the indirect call.
+   if (n * sizeof(T) < 16) {
+      ByteSwapCopyScalar<T>(static_cast<char *>(to), static_cast<const char *>(from), n);
+      return;
+   }
+   static const Kernel_t kernel = SelectKernel<T>();
+   kernel(static_cast<char *>(to), static_cast<const char *>(from), n);
+}
+
+} // anonymous namespace
+
+void ROOT::Internal::ByteSwapCopy16(void *to, const void *from, std::size_t n)
+{
+   ByteSwapCopy<std::uint16_t>(to, from, n);
+}
+
+void ROOT::Internal::ByteSwapCopy32(void *to, const void *from, std::size_t n)
+{
+   ByteSwapCopy<std::uint32_t>(to, from, n);
+}
+
+void ROOT::Internal::ByteSwapCopy64(void *to, const void *from, std::size_t n)
+{
+   ByteSwapCopy<std::uint64_t>(to, from, n);
+}
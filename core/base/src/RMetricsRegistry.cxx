@@ -0,0 +1,127 @@
+// @(#)root/base
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RMetricsRegistry.hxx"
+
+#include "TEnv.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+using ROOT::Experimental::RMetric;
+using ROOT::Experimental::RMetricsRegistry;
+
+std::atomic<bool> &RMetricsRegistry::GetEnabledFlag()
+{
+   static std::atomic<bool> enabled{gEnv && gEnv->GetValue("Root.Metrics", 0) != 0};
+   return enabled;
+}
+
+RMetricsRegistry &RMetricsRegistry::Instance()
+{
+   // Never destructed: instrumented code may update metrics during the tear down of the process
+   static RMetricsRegistry *registry = new RMetricsRegistry();
+   return *registry;
+}
+
+RMetric &RMetricsRegistry::GetMetric(const std::string &name, const std::string &help, RMetric::EKind kind,
+                                     const std::string &unit, double scale)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   auto &metric = fMetrics[name];
+   if (!metric)
+      metric = std::make_unique<RMetric>(name, help, kind, unit, scale);
+   else if (metric->GetKind() != kind)
+      throw std::logic_error("RMetricsRegistry: metric '" + name + "' already exists with a different kind");
+   return *metric;
+}
+
+std::size_t RMetricsRegistry::AddCollector(Collector_t collector)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   fCollectors[++fLastCollectorId] = std::move(collector);
+   return fLastCollectorId;
+}
+
+void RMetricsRegistry::RemoveCollector(std::size_t id)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   fCollectors.erase(id);
+}
+
+std::vector<RMetricsRegistry::RSample> RMetricsRegistry::Collect() const
+{
+   std::vector<RSample> samples;
+   std::vector<Collector_t> collectors;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      for (const auto &nameAndMetric : fMetrics) {
+         const auto &m = *nameAndMetric.second;
+         samples.push_back({m.GetName(), m.GetHelp(), m.GetKind(), m.GetUnit(), m.GetScaledValue()});
+      }
+      for (const auto &idAndCollector : fCollectors)
+         collectors.push_back(idAndCollector.second);
+   }
+   // collectors may take locks of their own: call them without holding the registry lock
+   for (const auto &collector : collectors)
+      collector(samples);
+
+   std::stable_sort(samples.begin(), samples.end(),
+                    [](const RSample &a, const RSample &b) { return a.fName < b.fName; });
+   return samples;
+}
+
+static std::string EscapeHelp(const std::string &help)
+{
+   std::string res;
+   for (const char c : help) {
+      if (c == '\\')
+         res += "\\\\";
+      else if (c == '\n')
+         res += "\\n";
+      else
+         res += c;
+   }
+   return res;
+}
+
+static std::string FormatValue(double value)
+{
+   if (std::isnan(value))
+      return "NaN";
+   if (std::isinf(value))
+      return value > 0 ? "+Inf" : "-Inf";
+   std::ostringstream os;
+   os.precision(17);
+   os << value;
+   return os.str();
+}
+
+std::string RMetricsRegistry::ToOpenMetrics() const
+{
+   std::ostringstream os;
+   std::string lastFamily;
+   for (const auto &s : Collect()) {
+      const bool isCounter = s.fKind == RMetric::EKind::kCounter;
+      if (s.fName != lastFamily) {
+         os << "# TYPE " << s.fName << (isCounter ? " counter\n" : " gauge\n");
+         if (!s.fUnit.empty())
+            os << "# UNIT " << s.fName << ' ' << s.fUnit << '\n';
+         if (!s.fHelp.empty())
+            os << "# HELP " << s.fName << ' ' << EscapeHelp(s.fHelp) << '\n';
+         lastFamily = s.fName;
+      }
+      os << s.fName << (isCounter ? "_total " : " ") << FormatValue(s.fValue) << '\n';
+   }
+   os << "# EOF\n";
+   return os.str();
+}
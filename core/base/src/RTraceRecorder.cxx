@@ -0,0 +1,211 @@
+// @(#)root/base
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RTraceRecorder.hxx"
+
+#include "TEnv.h"
+#include "TError.h"
+#include "TSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+using ROOT::Experimental::RTraceRecorder;
+
+namespace {
+
+/// The ring buffer of the events of one thread
+struct RThreadBuffer {
+   std::mutex fMutex; ///< only contended while the events are collected
+   std::vector<RTraceRecorder::REvent> fEvents;
+   std::size_t fNext = 0; ///< where the next event goes once fEvents reached its capacity
+   unsigned int fThreadIndex = 0;
+};
+
+struct RThreadBuffers {
+   std::mutex fMutex;
+   std::vector<std::unique_ptr<RThreadBuffer>> fBuffers;
+   std::size_t fCapacity = 0;
+};
+
+/// Never destructed: threads may record events during the tear down of the process
+RThreadBuffers &GetThreadBuffers()
+{
+   static RThreadBuffers *buffers = [] {
+      auto b = new RThreadBuffers();
+      b->fCapacity = std::max(1, gEnv ? gEnv->GetValue("Root.Tracing.BufferSize", 100000) : 100000);
+      return b;
+   }();
+   return *buffers;
+}
+
+RThreadBuffer &GetThreadBuffer()
+{
+   // Buffers are kept after the end of their thread, so that their events can still be written
+   thread_local RThreadBuffer *buffer = nullptr;
+   if (!buffer) {
+      auto &buffers = GetThreadBuffers();
+      std::lock_guard<std::mutex> lock(buffers.fMutex);
+      buffers.fBuffers.emplace_back(std::make_unique<RThreadBuffer>());
+      buffer = buffers.fBuffers.back().get();
+      buffer->fThreadIndex = buffers.fBuffers.size() - 1;
+   }
+   return *buffer;
+}
+
+const std::chrono::steady_clock::time_point &GetClockStart()
+{
+   static const auto start = std::chrono::steady_clock::now();
+   return start;
+}
+
+int GetProcessId()
+{
+   static const int pid = gSystem ? gSystem->GetPid() : 0;
+   return pid;
+}
+
+std::string &GetTraceFileName()
+{
+   static std::string fileName;
+   return fileName;
+}
+
+void WriteTraceAtExit()
+{
+   const auto &fileName = GetTraceFileName();
+   if (!RTraceRecorder::WriteChromeTrace(fileName))
+      ::Error("RTraceRecorder", "cannot write the trace to %s", fileName.c_str());
+}
+
+void WriteJSONString(std::ostream &os, const char *str)
+{
+   os << '"';
+   for (const char *c = str; *c; ++c) {
+      if (*c == '"' || *c == '\\')
+         os << '\\';
+      os << *c;
+   }
+   os << '"';
+}
+
+} // anonymous namespace
+
+std::atomic<bool> &RTraceRecorder::GetEnabledFlag()
+{
+   static std::atomic<bool> enabled{[] {
+      // The process id and the clock start are fixed before any event is recorded
+      GetProcessId();
+      GetClockStart();
+      if (!gEnv || gEnv->GetValue("Root.Tracing", 0) == 0)
+         return false;
+      GetTraceFileName() = gEnv->GetValue("Root.Tracing.File", "");
+      if (!GetTraceFileName().empty())
+         std::atexit(WriteTraceAtExit);
+      return true;
+   }()};
+   return enabled;
+}
+
+std::int64_t RTraceRecorder::Now()
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - GetClockStart())
+      .count();
+}
+
+void RTraceRecorder::Record(const char *category, const char *name, std::int64_t start, std::int64_t end,
+                            const char *argName, std::int64_t arg)
+{
+   auto &buffer = GetThreadBuffer();
+   const REvent event{category, name, argName, arg, start, end - start};
+   const auto capacity = GetThreadBuffers().fCapacity;
+
+   std::lock_guard<std::mutex> lock(buffer.fMutex);
+   if (buffer.fEvents.size() < capacity) {
+      buffer.fEvents.push_back(event);
+   } else {
+      buffer.fEvents[buffer.fNext] = event;
+      buffer.fNext = (buffer.fNext + 1) % capacity;
+   }
+}
+
+std::vector<std::pair<unsigned int, RTraceRecorder::REvent>> RTraceRecorder::GetEvents()
+{
+   std::vector<std::pair<unsigned int, REvent>> events;
+   auto &buffers = GetThreadBuffers();
+   std::lock_guard<std::mutex> lock(buffers.fMutex);
+   for (auto &buffer : buffers.fBuffers) {
+      std::lock_guard<std::mutex> bufferLock(buffer->fMutex);
+      // oldest events first
+      const auto n = buffer->fEvents.size();
+      for (std::size_t i = 0; i < n; ++i)
+         events.emplace_back(buffer->fThreadIndex, buffer->fEvents[(buffer->fNext + i) % n]);
+   }
+   return events;
+}
+
+void RTraceRecorder::Clear()
+{
+   auto &buffers = GetThreadBuffers();
+   std::lock_guard<std::mutex> lock(buffers.fMutex);
+   for (auto &buffer : buffers.fBuffers) {
+      std::lock_guard<std::mutex> bufferLock(buffer->fMutex);
+      buffer->fEvents.clear();
+      buffer->fNext = 0;
+   }
+}
+
+void RTraceRecorder::WriteChromeTrace(std::ostream &os)
+{
+   const auto events = GetEvents();
+   const auto pid = GetProcessId();
+
+   // Timestamps are in microseconds
+   os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+   unsigned int nThreads = 0;
+   for (const auto &e : events)
+      nThreads = std::max(nThreads, e.first + 1);
+   for (unsigned int t = 0; t < nThreads; ++t) {
+      os << (t ? ",\n" : "\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << t
+         << ",\"args\":{\"name\":\"ROOT thread " << t << "\"}}";
+   }
+   bool first = nThreads == 0;
+   for (const auto &threadAndEvent : events) {
+      const auto &e = threadAndEvent.second;
+      os << (first ? "\n" : ",\n") << "{\"name\":";
+      WriteJSONString(os, e.fName);
+      os << ",\"cat\":";
+      WriteJSONString(os, e.fCategory);
+      os << ",\"ph\":\"X\",\"ts\":" << e.fStart / 1000 << '.' << e.fStart % 1000 / 100
+         << ",\"dur\":" << e.fDuration / 1000 << '.' << e.fDuration % 1000 / 100 << ",\"pid\":" << pid
+         << ",\"tid\":" << threadAndEvent.first;
+      if (e.fArgName) {
+         os << ",\"args\":{";
+         WriteJSONString(os, e.fArgName);
+         os << ':' << e.fArg << '}';
+      }
+      os << '}';
+      first = false;
+   }
+   os << "\n]}\n";
+}
+
+bool RTraceRecorder::WriteChromeTrace(const std::string &fileName)
+{
+   std::ofstream file(fileName);
+   if (!file)
+      return false;
+   WriteChromeTrace(file);
+   return static_cast<bool>(file);
+}
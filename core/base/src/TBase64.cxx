@@ -22,6 +22,8 @@ protocols and to pack binary data in HTTP messages.
 
 #include <ROOT/RConfig.hxx>
 
+#include <cstring>
+
 ClassImp(TBase64);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -61,10 +63,10 @@ static void ToB64low(const char *in, char *out, int mod)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Base64 decoding of 4 bytes from in.
-/// Output (3 bytes) appended to out.
+/// Output (up to 3 bytes) written to out, returns the number of bytes.
 /// No check for base64-ness of input characters.
 
-static void FromB64low(const char *in, TString &out)
+static int FromB64low(const char *in, char *out)
 {
    static int b64inv[256] = {
       -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
@@ -89,15 +91,16 @@ static void FromB64low(const char *in, TString &out)
    const UInt_t i1 = (UInt_t)(in[1]);
    const UInt_t i2 = (UInt_t)(in[2]);
    const UInt_t i3 = (UInt_t)(in[3]);
+   out[0] = (char)((0xFC & (b64inv[i0] << 2)) | (0x03 & (b64inv[i1] >> 4)));
    if (R__likely(in[3] != '=')) {
-      out.Append((char)(0xFC & (b64inv[i0] << 2)) | (0x03 & (b64inv[i1] >> 4)));
-      out.Append((char)(0xF0 & (b64inv[i1] << 4)) | (0x0F & (b64inv[i2] >> 2)));
-      out.Append((char)(0xC0 & (b64inv[i2] << 6)) | (0x3F &  b64inv[i3]));
+      out[1] = (char)((0xF0 & (b64inv[i1] << 4)) | (0x0F & (b64inv[i2] >> 2)));
+      out[2] = (char)((0xC0 & (b64inv[i2] << 6)) | (0x3F &  b64inv[i3]));
+      return 3;
    } else if (in[2] == '=') {
-      out.Append((char)(0xFC & (b64inv[i0] << 2)) | (0x03 & (b64inv[i1] >> 4)));
+      return 1;
    } else {
-      out.Append((char)(0xFC & (b64inv[i0] << 2)) | (0x03 & (b64inv[i1] >> 4)));
-      out.Append((char)(0xF0 & (b64inv[i1] << 4)) | (0x0F & (b64inv[i2] >> 2)));
+      out[1] = (char)((0xF0 & (b64inv[i1] << 4)) | (0x0F & (b64inv[i2] >> 2)));
+      return 2;
    }
 }
 
@@ -133,8 +136,29 @@ TString TBase64::Decode(const char *data)
    int len = strlen(data);
    TString ret(len);
 
+   char oo[3];
    for (int i = 0; i < len; i += 4)
-      FromB64low(data+i, ret);
+      ret.Append(oo, FromB64low(data+i, oo));
 
    return ret;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Decode len characters of the base64 string data directly into the buffer
+/// out of maxlen bytes, without intermediate string.
+/// Returns the number of decoded bytes, -1 if they do not fit into out.
+/// No check for base64-ness of input characters.
+
+Int_t TBase64::Decode(const char *data, Int_t len, char *out, Int_t maxlen)
+{
+   Int_t nout = 0;
+   char oo[3];
+   for (int i = 0; i + 4 <= len; i += 4) {
+      int n = FromB64low(data+i, oo);
+      if (nout + n > maxlen)
+         return -1;
+      memcpy(out + nout, oo, n);
+      nout += n;
+   }
+   return nout;
+}
@@ -125,6 +125,7 @@ FARPROC dlsym(void *library, const char *function_name)
 #include "TClassTable.h"
 #include "TSystem.h"
 #include "THashList.h"
+#include "TOpenHashTable.h"
 #include "TObjArray.h"
 #include "TEnv.h"
 #include "TError.h"
@@ -132,6 +133,7 @@ FARPROC dlsym(void *library, const char *function_name)
 #include "TGlobal.h"
 #include "TFunction.h"
 #include "TVirtualPad.h"
+#include "TVirtualPS.h"
 #include "TBrowser.h"
 #include "TSystemDirectory.h"
 #include "TApplication.h"
@@ -165,9 +167,11 @@ FARPROC dlsym(void *library, const char *function_name)
 #endif
 
 extern "C" void R__SetZipMode(int);
+extern "C" int R__SetZLIBDecompressor(const char *name);
 
 static DestroyInterpreter_t *gDestroyInterpreter = nullptr;
 static void *gInterpreterLib = nullptr;
+static Bool_t gInterpreterDisabled = kFALSE; // set by TROOT::DisableInterpreter()
 
 // Mutex for protection of concurrent gROOT access
 TVirtualMutex* gROOTMutex = nullptr;
@@ -532,6 +536,10 @@ namespace Internal {
    /// variable `ROOT_MAX_THREADS`: `export ROOT_MAX_THREADS=2` will try to set
    /// the maximum number of active threads to 2, if the scheduling library
    /// (such as tbb) "permits".
+   /// On machines with several NUMA nodes, `export ROOT_NUMA_ARENAS=1` splits
+   /// the threads in one pool per node, pinned to its cores, such that the
+   /// parallel loops process their work items with memory local to the node
+   /// (see ROOT::Internal::RTaskArenaWrapper).
    ///
    /// \note Use `DisableImplicitMT()` to disable multi-threading (some locks will remain in place as
    /// described in EnableThreadSafety()). `EnableImplicitMT(1)` creates a thread-pool of size 1.
@@ -707,7 +715,7 @@ TROOT::TROOT(const char *name, const char *title, VoidFuncPtr_t *initfunc)
 
    ReadGitInfo();
 
-   fClasses         = new THashTable(800,3); fClasses->UseRWLock();
+   fClasses         = new TOpenHashTable(800); fClasses->UseRWLock();
    //fIdMap           = new IdMap_t;
    fStreamerInfo    = new TObjArray(100); fStreamerInfo->UseRWLock();
    fClassGenerators = new TList;
@@ -1292,7 +1300,7 @@ TObject *TROOT::FindObject(const char *name) const
    temp   = fFiles->FindObject(name);       if (temp) return temp;
    temp   = fMappedFiles->FindObject(name); if (temp) return temp;
    {
-      R__LOCKGUARD(gROOTMutex);
+      R__READ_LOCKGUARD(ROOT::gCoreMutex);
       temp   = fFunctions->FindObject(name);if (temp) return temp;
    }
    temp   = fGeometries->FindObject(name);  if (temp) return temp;
@@ -1351,7 +1359,7 @@ TObject *TROOT::FindSpecialObject(const char *name, void *&where)
       where = fMappedFiles;
    }
    if (!temp) {
-      R__LOCKGUARD(gROOTMutex);
+      R__READ_LOCKGUARD(ROOT::gCoreMutex);
       temp  = fFunctions->FindObject(name);
       where = fFunctions;
    }
@@ -1408,7 +1416,7 @@ TObject *TROOT::FindObjectAny(const char *name) const
 
 TObject *TROOT::FindObjectAnyFile(const char *name) const
 {
-   R__LOCKGUARD(gROOTMutex);
+   R__READ_LOCKGUARD(ROOT::gCoreMutex);
    TDirectory *d;
    TIter next(GetListOfFiles());
    while ((d = (TDirectory*)next())) {
@@ -1542,7 +1550,7 @@ TDataType *TROOT::GetType(const char *name, Bool_t /* load */) const
 
 TFile *TROOT::GetFile(const char *name) const
 {
-   R__LOCKGUARD(gROOTMutex);
+   R__READ_LOCKGUARD(ROOT::gCoreMutex);
    return (TFile*)GetListOfFiles()->FindObject(name);
 }
 
@@ -1564,14 +1572,14 @@ TObject *TROOT::GetFunction(const char *name) const
    }
 
    {
-      R__LOCKGUARD(gROOTMutex);
+      R__READ_LOCKGUARD(ROOT::gCoreMutex);
       TObject *f1 = fFunctions->FindObject(name);
       if (f1) return f1;
    }
 
    gROOT->ProcessLine("TF1::InitStandardFunctions();");
 
-   R__LOCKGUARD(gROOTMutex);
+   R__READ_LOCKGUARD(ROOT::gCoreMutex);
    return fFunctions->FindObject(name);
 }
 
@@ -1761,6 +1769,7 @@ TCollection *TROOT::GetListOfGlobals(Bool_t load)
 
       TGlobalMappedFunction::MakeFunctor("gPad", "TVirtualPad*", TVirtualPad::Pad);
       TGlobalMappedFunction::MakeFunctor("gVirtualX", "TVirtualX*", TVirtualX::Instance);
+      TGlobalMappedFunction::MakeFunctor("gVirtualPS", "TVirtualPS*", TVirtualPS::PS);
       TGlobalMappedFunction::MakeFunctor("gDirectory", "TDirectory*", TDirectory::CurrentDirectory);
 
       // Don't let TGlobalMappedFunction delete our globals, now that we take them.
@@ -1991,6 +2000,11 @@ void TROOT::InitSystem()
       Int_t zipmode = gEnv->GetValue("Root.CompressionAlgorithm", oldzipmode);
       if (zipmode != 0) R__SetZipMode(zipmode);
 
+      const char *zlibdecompressor = gEnv->GetValue("Root.ZLIBDecompressor", "zlib");
+      if (!R__SetZLIBDecompressor(zlibdecompressor))
+         fprintf(stderr, "Warning in <TROOT::InitSystem>: ZLIB decompressor \"%s\" not available, using zlib\n",
+                 zlibdecompressor);
+
       const char *sdeb;
       if ((sdeb = gSystem->Getenv("ROOTDEBUG")))
          gDebug = atoi(sdeb);
@@ -2027,8 +2041,10 @@ void TROOT::InitInterpreter()
 {
    // usedToIdentifyRootClingByDlSym is available when TROOT is part of
    // rootcling.
-   if (!dlsym(RTLD_DEFAULT, "usedToIdentifyRootClingByDlSym")
-       && !dlsym(RTLD_DEFAULT, "usedToIdentifyStaticRoot")) {
+   const Bool_t fromRootCling = dlsym(RTLD_DEFAULT, "usedToIdentifyRootClingByDlSym") != nullptr;
+   // Without interpreter, libRIO provides the TInterpreter implementation.
+   const Bool_t noInterpreter = !fromRootCling && IsInterpreterDisabled();
+   if (!fromRootCling && !dlsym(RTLD_DEFAULT, "usedToIdentifyStaticRoot")) {
       char *libRIO = gSystem->DynamicPathName("libRIO");
       void *libRIOHandle = dlopen(libRIO, RTLD_NOW|RTLD_GLOBAL);
       delete [] libRIO;
@@ -2038,9 +2054,13 @@ void TROOT::InitInterpreter()
          exit(1);
       }
 
-      char *libcling = gSystem->DynamicPathName("libCling");
-      gInterpreterLib = dlopen(libcling, RTLD_LAZY|RTLD_LOCAL);
-      delete [] libcling;
+      if (noInterpreter) {
+         gInterpreterLib = libRIOHandle;
+      } else {
+         char *libcling = gSystem->DynamicPathName("libCling");
+         gInterpreterLib = dlopen(libcling, RTLD_LAZY|RTLD_LOCAL);
+         delete [] libcling;
+      }
 
       if (!gInterpreterLib) {
          TString err = dlerror();
@@ -2051,7 +2071,8 @@ void TROOT::InitInterpreter()
    } else {
       gInterpreterLib = RTLD_DEFAULT;
    }
-   CreateInterpreter_t *CreateInterpreter = (CreateInterpreter_t*) dlsym(gInterpreterLib, "CreateInterpreter");
+   CreateInterpreter_t *CreateInterpreter = (CreateInterpreter_t*) dlsym(gInterpreterLib,
+      noInterpreter ? "CreateNoInterpreter" : "CreateInterpreter");
    if (!CreateInterpreter) {
       TString err = dlerror();
       fprintf(stderr, "Fatal in <TROOT::InitInterpreter>: cannot load symbol %s\n", err.Data());
@@ -2060,7 +2081,8 @@ void TROOT::InitInterpreter()
    // Schedule the destruction of TROOT.
    atexit(at_exit_of_TROOT);
 
-   gDestroyInterpreter = (DestroyInterpreter_t*) dlsym(gInterpreterLib, "DestroyInterpreter");
+   gDestroyInterpreter = (DestroyInterpreter_t*) dlsym(gInterpreterLib,
+      noInterpreter ? "DestroyNoInterpreter" : "DestroyInterpreter");
    if (!gDestroyInterpreter) {
       TString err = dlerror();
       fprintf(stderr, "Fatal in <TROOT::InitInterpreter>: cannot load symbol %s\n", err.Data());
@@ -2849,6 +2871,46 @@ void TROOT::Initialize() {
    (void) gROOT;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Run the program without the C++ interpreter: no cling instance is created,
+/// and TClass and the I/O rely only on the compiled dictionaries and their
+/// rdict.pcm files, saving the time and memory of the interpreter startup.
+/// Macros, ProcessLine(), TMethodCall and the plugins of TPluginManager are
+/// not available. This must be called at the beginning of main(), before gROOT
+/// is used. The mode can also be selected with the ROOT_NO_INTERPRETER
+/// environment variable, see IsInterpreterDisabled().
+
+void TROOT::DisableInterpreter()
+{
+   if (fgRootInit) {
+      ::Error("TROOT::DisableInterpreter", "the interpreter is already initialized");
+      return;
+   }
+   gInterpreterDisabled = kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if the program runs, or will run, without the C++ interpreter.
+/// This is the case if DisableInterpreter() was called, or if the
+/// ROOT_NO_INTERPRETER environment variable is set to a value other than 0.
+/// If ROOT was built with the `interpreter_free_io` option, this is the
+/// default, and ROOT_NO_INTERPRETER=0 enables the interpreter.
+
+Bool_t TROOT::IsInterpreterDisabled()
+{
+   if (gInterpreterDisabled)
+      return kTRUE;
+   static const Bool_t fromEnv = [] {
+      const char *env = getenv("ROOT_NO_INTERPRETER");
+#ifdef R__INTERPRETER_FREE_IO
+      return Bool_t(!env || strcmp(env, "0") != 0);
+#else
+      return Bool_t(env && *env && strcmp(env, "0") != 0);
+#endif
+   }();
+   return fromEnv;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return kTRUE if the TROOT object has been initialized.
 
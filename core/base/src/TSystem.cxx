@@ -2397,6 +2397,26 @@ int TSystem::SendRaw(int, const void *, int, int)
    return -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Send exactly lengths[i] bytes from each of the nbuffers buffers, in order,
+/// as one contiguous stream (scatter-gather send). Returns the total number
+/// of bytes sent or the error code of SendRaw(). This default implementation
+/// sends the buffers one after the other with SendRaw().
+
+int TSystem::SendRawBuffers(int sock, const void *const *buffers, const int *lengths, int nbuffers, int flag)
+{
+   int nsent = 0;
+   for (int i = 0; i < nbuffers; ++i) {
+      if (lengths[i] <= 0)
+         continue;
+      int n = SendRaw(sock, buffers[i], lengths[i], flag);
+      if (n <= 0)
+         return n;
+      nsent += n;
+   }
+   return nsent;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Receive a buffer headed by a length indicator.
 
@@ -19,13 +19,26 @@ TVirtualPS is an abstract interface to Postscript, PDF, SVG. TeX etc... drivers
 #include <fstream>
 #include "strlcpy.h"
 #include "TVirtualPS.h"
-
-TVirtualPS *gVirtualPS = nullptr;
+#include "TThreadSlots.h"
 
 const Int_t  kMaxBuffer = 250;
 
 ClassImp(TVirtualPS);
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the current PostScript, PDF, SVG or image driver.
+/// When thread safety is enabled, each thread has its own driver, so that
+/// independent canvases can be printed at the same time in several threads.
+
+TVirtualPS *&TVirtualPS::PS()
+{
+   static TVirtualPS *currentPS = nullptr;
+   if (!gThreadTsd)
+      return currentPS;
+   else
+      return *(TVirtualPS**)(*gThreadTsd)(&currentPS,ROOT::kVirtualPSThreadSlot);
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// VirtualPS default constructor.
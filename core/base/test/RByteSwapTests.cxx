@@ -0,0 +1,49 @@
+#include "ROOT/RByteSwap.hxx"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+using Kernel_t = void (*)(void *, const void *, std::size_t);
+
+void CheckKernel(Kernel_t kernel, std::size_t size)
+{
+   // Lengths around the SIMD register widths, and unaligned source and destination
+   for (std::size_t n = 0; n < 100; ++n) {
+      std::vector<unsigned char> input(n * size + 1);
+      for (std::size_t i = 0; i < input.size(); ++i)
+         input[i] = static_cast<unsigned char>(i * 7 + 1);
+      std::vector<unsigned char> expected(n * size);
+      for (std::size_t e = 0; e < n; ++e)
+         for (std::size_t b = 0; b < size; ++b)
+            expected[e * size + b] = input[1 + e * size + size - 1 - b];
+
+      std::vector<unsigned char> output(n * size + 3);
+      kernel(output.data() + 3, input.data() + 1, n);
+      EXPECT_EQ(expected, std::vector<unsigned char>(output.begin() + 3, output.end())) << "n = " << n;
+
+      std::vector<unsigned char> inplace(input.begin() + 1, input.end());
+      kernel(inplace.data(), inplace.data(), n);
+      EXPECT_EQ(expected, inplace) << "in place, n = " << n;
+   }
+}
+
+} // anonymous namespace
+
+TEST(RByteSwap, ByteSwapCopy16)
+{
+   CheckKernel(&ROOT::Internal::ByteSwapCopy16, 2);
+}
+
+TEST(RByteSwap, ByteSwapCopy32)
+{
+   CheckKernel(&ROOT::Internal::ByteSwapCopy32, 4);
+}
+
+TEST(RByteSwap, ByteSwapCopy64)
+{
+   CheckKernel(&ROOT::Internal::ByteSwapCopy64, 8);
+}
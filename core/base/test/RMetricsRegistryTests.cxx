@@ -0,0 +1,75 @@
+#include "ROOT/RMetricsRegistry.hxx"
+
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using ROOT::Experimental::RMetric;
+using ROOT::Experimental::RMetricsRegistry;
+
+TEST(RMetricsRegistry, Counter)
+{
+   auto &registry = RMetricsRegistry::Instance();
+   auto &counter = registry.GetMetric("test_counter", "A test counter");
+   EXPECT_EQ(&counter, &registry.GetMetric("test_counter", "A test counter"));
+   counter.Set(0);
+
+   std::vector<std::thread> threads;
+   for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([&counter] {
+         for (int i = 0; i < 1000; ++i)
+            counter.Inc();
+      });
+   }
+   for (auto &t : threads)
+      t.join();
+   EXPECT_EQ(4000, counter.GetValue());
+
+   EXPECT_THROW(registry.GetMetric("test_counter", "", RMetric::EKind::kGauge), std::logic_error);
+}
+
+TEST(RMetricsRegistry, Gauge)
+{
+   auto &gauge = RMetricsRegistry::Instance().GetMetric("test_gauge_seconds", "A test gauge", RMetric::EKind::kGauge,
+                                                        "seconds", 1e-3);
+   gauge.Set(1500);
+   gauge.Dec();
+   EXPECT_EQ(1499, gauge.GetValue());
+   EXPECT_DOUBLE_EQ(1.499, gauge.GetScaledValue());
+}
+
+TEST(RMetricsRegistry, Collector)
+{
+   auto &registry = RMetricsRegistry::Instance();
+   const auto id = registry.AddCollector(
+      [](auto &samples) { samples.push_back({"test_collected", "", RMetric::EKind::kGauge, "", 42.}); });
+
+   auto hasSample = [&registry] {
+      for (const auto &s : registry.Collect()) {
+         if (s.fName == "test_collected")
+            return s.fValue == 42.;
+      }
+      return false;
+   };
+   EXPECT_TRUE(hasSample());
+   registry.RemoveCollector(id);
+   EXPECT_FALSE(hasSample());
+}
+
+TEST(RMetricsRegistry, OpenMetrics)
+{
+   auto &registry = RMetricsRegistry::Instance();
+   registry.GetMetric("test_om_bytes", "Bytes\nread", RMetric::EKind::kCounter, "bytes").Set(7);
+   registry.GetMetric("test_om_threads", "", RMetric::EKind::kGauge).Set(2);
+
+   const auto text = registry.ToOpenMetrics();
+   EXPECT_NE(std::string::npos, text.find("# TYPE test_om_bytes counter\n"
+                                          "# UNIT test_om_bytes bytes\n"
+                                          "# HELP test_om_bytes Bytes\\nread\n"
+                                          "test_om_bytes_total 7\n"));
+   EXPECT_NE(std::string::npos, text.find("# TYPE test_om_threads gauge\ntest_om_threads 2\n"));
+   EXPECT_EQ(text.size() - 6, text.rfind("# EOF\n"));
+}
@@ -0,0 +1,65 @@
+#include "ROOT/RTraceRecorder.hxx"
+
+#include "gtest/gtest.h"
+
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using ROOT::Experimental::RTraceRecorder;
+using ROOT::Experimental::RTraceScope;
+
+TEST(RTraceRecorder, ScopesPerThread)
+{
+   RTraceRecorder::Clear();
+   RTraceRecorder::Enable();
+   {
+      RTraceScope scope("test", "outer");
+      std::thread t([] { RTraceScope inner("test", "inner", "slot", 3); });
+      t.join();
+   }
+   RTraceRecorder::Enable(false);
+   {
+      RTraceScope scope("test", "disabled");
+   }
+
+   const auto events = RTraceRecorder::GetEvents();
+   ASSERT_EQ(2u, events.size());
+   std::set<std::string> names;
+   std::set<unsigned int> threads;
+   for (const auto &e : events) {
+      names.insert(e.second.fName);
+      threads.insert(e.first);
+      EXPECT_GE(e.second.fDuration, 0);
+   }
+   EXPECT_EQ((std::set<std::string>{"inner", "outer"}), names);
+   EXPECT_EQ(2u, threads.size());
+
+   std::ostringstream os;
+   RTraceRecorder::WriteChromeTrace(os);
+   const auto json = os.str();
+   EXPECT_NE(std::string::npos, json.find("\"traceEvents\":["));
+   EXPECT_NE(std::string::npos, json.find("\"name\":\"inner\",\"cat\":\"test\",\"ph\":\"X\""));
+   EXPECT_NE(std::string::npos, json.find("\"args\":{\"slot\":3}"));
+   EXPECT_NE(std::string::npos, json.find("\"ph\":\"M\""));
+
+   RTraceRecorder::Clear();
+   EXPECT_TRUE(RTraceRecorder::GetEvents().empty());
+}
+
+TEST(RTraceRecorder, RingBuffer)
+{
+   RTraceRecorder::Clear();
+   // The default buffer holds 100000 events per thread: only the most recent ones are kept
+   std::thread t([] {
+      for (int i = 0; i < 100010; ++i)
+         RTraceRecorder::Record("test", "ring", i, i + 1);
+   });
+   t.join();
+   const auto events = RTraceRecorder::GetEvents();
+   ASSERT_EQ(100000u, events.size());
+   EXPECT_EQ(10, events.front().second.fStart);
+   EXPECT_EQ(100009, events.back().second.fStart);
+   RTraceRecorder::Clear();
+}
@@ -0,0 +1,137 @@
+#include "Compression.h"
+#include "RConfigure.h"
+#include "RZip.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using ROOT::RCompressionSetting;
+
+namespace {
+
+std::string MakeInput(int seed, int n)
+{
+   std::string input;
+   for (int i = 0; i < n; ++i)
+      input += std::to_string((i * 7 + seed) % 1000) + ",";
+   return input;
+}
+
+} // anonymous namespace
+
+// The compression algorithms keep their contexts per thread; they must give correct results when the level and the
+// algorithm change from one buffer to the next, on several threads at once
+TEST(Zip, ThreadContexts)
+{
+   const RCompressionSetting::EAlgorithm::EValues algorithms[] = {
+      RCompressionSetting::EAlgorithm::kZLIB, RCompressionSetting::EAlgorithm::kLZMA,
+      RCompressionSetting::EAlgorithm::kLZ4, RCompressionSetting::EAlgorithm::kZSTD};
+
+   std::vector<std::thread> threads;
+   std::vector<int> nErrors(4, 0);
+   for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([&, t] {
+         for (int iter = 0; iter < 10; ++iter) {
+            for (auto algorithm : algorithms) {
+               for (int level : {1, 5, 9}) {
+                  auto input = MakeInput(t, 2000 + 300 * iter);
+                  std::vector<char> zipped(input.size() + 100);
+                  int srcSize = input.size();
+                  int tgtSize = zipped.size();
+                  int nzip = 0;
+                  R__zipMultipleAlgorithm(level, &srcSize, &input[0], &tgtSize, zipped.data(), &nzip, algorithm);
+
+                  std::string unzipped(input.size(), '\0');
+                  int zipSize = nzip;
+                  int unzipSize = unzipped.size();
+                  int nunzip = 0;
+                  R__unzip(&zipSize, reinterpret_cast<unsigned char *>(zipped.data()), &unzipSize,
+                           reinterpret_cast<unsigned char *>(&unzipped[0]), &nunzip);
+                  if (nzip == 0 || nunzip != static_cast<int>(input.size()) || unzipped != input)
+                     nErrors[t]++;
+               }
+            }
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+   for (int t = 0; t < 4; ++t)
+      EXPECT_EQ(0, nErrors[t]) << "thread " << t;
+}
+
+TEST(Zip, ZLIBDecompressor)
+{
+   EXPECT_EQ(0, R__SetZLIBDecompressor("unknown"));
+#ifdef R__HAS_LIBDEFLATE
+   ASSERT_EQ(1, R__SetZLIBDecompressor("libdeflate"));
+#endif
+
+   for (auto algorithm :
+        {RCompressionSetting::EAlgorithm::kZLIB, RCompressionSetting::EAlgorithm::kOldCompressionAlgo}) {
+      auto input = MakeInput(0, 5000);
+      std::vector<char> zipped(input.size() + 100);
+      int srcSize = input.size();
+      int tgtSize = zipped.size();
+      int nzip = 0;
+      R__zipMultipleAlgorithm(6, &srcSize, &input[0], &tgtSize, zipped.data(), &nzip, algorithm);
+      ASSERT_GT(nzip, 0);
+
+      std::string unzipped(input.size(), '\0');
+      int unzipSize = unzipped.size();
+      int nunzip = 0;
+      R__unzip(&nzip, reinterpret_cast<unsigned char *>(zipped.data()), &unzipSize,
+               reinterpret_cast<unsigned char *>(&unzipped[0]), &nunzip);
+      EXPECT_EQ(static_cast<int>(input.size()), nunzip);
+      EXPECT_EQ(input, unzipped);
+   }
+
+   EXPECT_EQ(1, R__SetZLIBDecompressor("zlib"));
+}
+
+TEST(Zip, Adaptive)
+{
+   auto compress = [](std::string &input, int level) {
+      std::vector<char> zipped(input.size() + 100);
+      int srcSize = input.size();
+      int tgtSize = zipped.size();
+      int nzip = 0;
+      R__zipMultipleAlgorithm(level, &srcSize, &input[0], &tgtSize, zipped.data(), &nzip,
+                              RCompressionSetting::EAlgorithm::kAdaptive);
+      zipped.resize(nzip);
+      return zipped;
+   };
+   auto unzip = [](std::vector<char> &zipped, std::size_t size) {
+      std::string unzipped(size, '\0');
+      int zipSize = zipped.size();
+      int unzipSize = unzipped.size();
+      int nunzip = 0;
+      R__unzip(&zipSize, reinterpret_cast<unsigned char *>(zipped.data()), &unzipSize,
+               reinterpret_cast<unsigned char *>(&unzipped[0]), &nunzip);
+      unzipped.resize(nunzip);
+      return unzipped;
+   };
+
+   // Random bytes are left uncompressed
+   std::string noise(64 * 1024, '\0');
+   unsigned int state = 42;
+   for (auto &c : noise) {
+      state = state * 1664525u + 1013904223u;
+      c = static_cast<char>(state >> 24);
+   }
+   EXPECT_TRUE(compress(noise, 9).empty());
+
+   // The level selects the algorithm for compressible buffers
+   auto input = MakeInput(0, 20000);
+   const std::pair<int, std::string> expected[] = {{1, "L4"}, {5, "ZS"}, {9, "XZ"}};
+   for (const auto &[level, signature] : expected) {
+      auto zipped = compress(input, level);
+      ASSERT_GT(zipped.size(), 9u);
+      EXPECT_EQ(signature, std::string(zipped.data(), 2)) << "level " << level;
+      EXPECT_EQ(input, unzip(zipped, input.size()));
+   }
+}
@@ -0,0 +1,77 @@
+#include "RZip.h"
+#include "ZipZSTD.h"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string MakeRecord(int i)
+{
+   char record[256];
+   snprintf(record, sizeof(record), "{\"run\": %d, \"event\": %d, \"px\": %.3f, \"py\": %.3f, \"charge\": %d}",
+            1000 + i % 7, i * 13, (i % 101) * 0.731, (i % 37) * -1.29, i % 2 ? 1 : -1);
+   return record;
+}
+
+int Compress(const std::string &input, std::vector<char> &output)
+{
+   int srcSize = input.size();
+   int tgtSize = output.size();
+   int nout = 0;
+   R__zipMultipleAlgorithm(5, &srcSize, const_cast<char *>(input.data()), &tgtSize, output.data(), &nout,
+                           ROOT::RCompressionSetting::EAlgorithm::kZSTD);
+   return nout;
+}
+
+} // anonymous namespace
+
+TEST(ZipZSTD, Dictionary)
+{
+   std::string samples;
+   std::vector<std::size_t> sampleSizes;
+   for (int i = 0; i < 2000; ++i) {
+      auto record = MakeRecord(i);
+      samples += record;
+      sampleSizes.push_back(record.size());
+   }
+   std::vector<char> dict(4096);
+   auto dictSize = R__zstdTrainDictionary(dict.data(), dict.size(), samples.data(), sampleSizes.data(),
+                                          sampleSizes.size());
+   ASSERT_GT(dictSize, 0u);
+   auto dictId = R__zstdRegisterDictionary(dict.data(), dictSize);
+   ASSERT_NE(dictId, 0u);
+   EXPECT_EQ(dictId, R__zstdRegisterDictionary(dict.data(), dictSize));
+   EXPECT_EQ(dictSize, R__zstdGetDictionary(dictId, nullptr, 0));
+   EXPECT_EQ(0u, R__zstdGetDictionary(dictId + 1, nullptr, 0));
+
+   std::string input;
+   for (int i = 5000; i < 5010; ++i)
+      input += MakeRecord(i);
+   std::vector<char> plain(input.size() + 64);
+   const int nPlain = Compress(input, plain);
+   ASSERT_GT(nPlain, 0);
+
+   EXPECT_EQ(0u, R__zstdSetThreadDictionary(dictId));
+   std::vector<char> withDict(input.size() + 64);
+   const int nWithDict = Compress(input, withDict);
+   EXPECT_EQ(dictId, R__zstdSetThreadDictionary(0));
+   ASSERT_GT(nWithDict, 0);
+   EXPECT_LT(nWithDict, nPlain);
+
+   // Decompression finds the dictionary from the frame header, independently of the thread selection
+   for (auto *compressed : {&plain, &withDict}) {
+      int srcSize = compressed == &plain ? nPlain : nWithDict;
+      int tgtSize = input.size();
+      int nout = 0;
+      std::string output(input.size(), '\0');
+      R__unzip(&srcSize, reinterpret_cast<unsigned char *>(compressed->data()), &tgtSize,
+               reinterpret_cast<unsigned char *>(&output[0]), &nout);
+      EXPECT_EQ(static_cast<int>(input.size()), nout);
+      EXPECT_EQ(input, output);
+   }
+}
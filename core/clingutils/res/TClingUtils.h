@@ -202,6 +202,7 @@ private:
    bool fRequestNoInputOperator;
    bool fRequestOnlyTClass;
    int  fRequestedVersionNumber;
+   bool fRequestFastStreamer = false;
 
 public:
    enum ERootFlag {
@@ -277,6 +278,8 @@ public:
    bool RequestNoStreamer() const { return fRequestNoStreamer; }
    bool RequestOnlyTClass() const { return fRequestOnlyTClass; }
    int  RequestedVersionNumber() const { return fRequestedVersionNumber; }
+   bool RequestFastStreamer() const { return fRequestFastStreamer; }
+   void SetRequestFastStreamer(bool val) { fRequestFastStreamer = val; }
    int  RootFlag() const {
       // Return the request (streamerInfo, has_version, etc.) combined in a single
       // int.  See RScanner::AnnotatedRecordDecl::ERootFlag.
@@ -556,6 +559,14 @@ bool HasCustomConvStreamerMemberFunction(const AnnotatedRecordDecl &cl,
                                          const cling::Interpreter &interp,
                                          const TNormalizedCtxt &normCtxt);
 
+//______________________________________________________________________________
+const char *GetFastStreamerTypeName(clang::QualType type);
+
+//______________________________________________________________________________
+bool CanGenerateFastStreamer(const clang::CXXRecordDecl *clxx,
+                             const cling::Interpreter &interp,
+                             std::string *reason = nullptr);
+
 //______________________________________________________________________________
 // Return the header file to be included to declare the Decl
 std::string GetFileName(const clang::Decl& decl, const cling::Interpreter& interp);
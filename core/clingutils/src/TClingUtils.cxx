@@ -1288,7 +1288,8 @@ bool ROOT::TMetaUtils::HasCustomStreamerMemberFunction(const AnnotatedRecordDecl
    const clang::DeclContext *clxx_as_context = llvm::dyn_cast<clang::DeclContext>(clxx);
 
    return (method && method->getDeclContext() == clxx_as_context
-           && ( cl.RequestNoStreamer() || !cl.RequestStreamerInfo()));
+           && ( cl.RequestNoStreamer() || !cl.RequestStreamerInfo()
+                || (cl.RequestFastStreamer() && CanGenerateFastStreamer(clxx, interp))));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1310,6 +1311,92 @@ bool ROOT::TMetaUtils::HasCustomConvStreamerMemberFunction(const AnnotatedRecord
            && ( cl.RequestNoStreamer() || !cl.RequestStreamerInfo()));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name of the ROOT type (e.g. "Int_t") as which a data member of the given
+/// fundamental type is streamed by a generated straight-line Streamer, or nullptr if
+/// the type is not supported (e.g. Float16_t, Double32_t or signed char).
+
+const char *ROOT::TMetaUtils::GetFastStreamerTypeName(clang::QualType type)
+{
+   const std::string typeName = type.getAsString();
+   if (typeName.find("Float16_t") != std::string::npos || typeName.find("Double32_t") != std::string::npos)
+      return nullptr;
+
+   const clang::BuiltinType *builtin = llvm::dyn_cast<clang::BuiltinType>(type.getCanonicalType().getTypePtr());
+   if (!builtin)
+      return nullptr;
+   switch (builtin->getKind()) {
+   case clang::BuiltinType::Bool: return "Bool_t";
+   case clang::BuiltinType::Char_S:
+   case clang::BuiltinType::Char_U: return "Char_t";
+   case clang::BuiltinType::UChar: return "UChar_t";
+   case clang::BuiltinType::Short: return "Short_t";
+   case clang::BuiltinType::UShort: return "UShort_t";
+   case clang::BuiltinType::Int: return "Int_t";
+   case clang::BuiltinType::UInt: return "UInt_t";
+   case clang::BuiltinType::Long: return "Long_t";
+   case clang::BuiltinType::ULong: return "ULong_t";
+   case clang::BuiltinType::LongLong: return "Long64_t";
+   case clang::BuiltinType::ULongLong: return "ULong64_t";
+   case clang::BuiltinType::Float: return "Float_t";
+   case clang::BuiltinType::Double: return "Double_t";
+   default: return nullptr;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if a straight-line Streamer producing the same bytes as the
+/// StreamerInfo of the class can be generated for it (LinkDef option 'faststreamer'):
+/// the class has a ClassDef, all its base classes have a Streamer and all its
+/// persistent data members are fundamental types, enums or fixed-size arrays of
+/// fundamental types. Otherwise, describe the first obstacle in reason.
+
+bool ROOT::TMetaUtils::CanGenerateFastStreamer(const clang::CXXRecordDecl *clxx,
+                                               const cling::Interpreter &interp,
+                                               std::string *reason)
+{
+   auto reject = [reason](const std::string &why) {
+      if (reason)
+         *reason = why;
+      return false;
+   };
+
+   if (!clxx || GetClassVersion(clxx, interp) <= 0)
+      return reject("the class has no ClassDef with a positive version");
+
+   for (const auto &base : clxx->bases()) {
+      const clang::CXXRecordDecl *baseDecl = base.getType()->getAsCXXRecordDecl();
+      if (base.isVirtual() || !baseDecl || !ClassInfo__HasMethod(baseDecl, "Streamer", interp))
+         return reject("the base class " + base.getType().getAsString() + " has no Streamer");
+   }
+
+   for (const clang::FieldDecl *field : clxx->fields()) {
+      const char *comment = GetComment(*field).data();
+      if (comment && comment[0] == '!')
+         continue;
+      const std::string memberName = field->getName().str();
+      clang::QualType type = field->getType();
+      if (field->isBitField() || field->isAnonymousStructOrUnion() || type.isConstQualified())
+         return reject("the data member " + memberName + " is a bit-field, const or anonymous");
+      if (const clang::ConstantArrayType *arrayType = llvm::dyn_cast<clang::ConstantArrayType>(type.getTypePtr())) {
+         while (const clang::ConstantArrayType *subArray =
+                   llvm::dyn_cast<clang::ConstantArrayType>(arrayType->getArrayElementTypeNoTypeQual()))
+            arrayType = subArray;
+         if (!GetFastStreamerTypeName(arrayType->getElementType()))
+            return reject("the data member " + memberName + " is an array of a non-fundamental type");
+         continue;
+      }
+      if (const clang::EnumType *enumType = llvm::dyn_cast<clang::EnumType>(type.getCanonicalType().getTypePtr())) {
+         if (enumType->getDecl()->getIntegerType().getCanonicalType().getAsString() != "int")
+            return reject("the data member " + memberName + " is an enum whose underlying type is not int");
+         continue;
+      }
+      if (!GetFastStreamerTypeName(type))
+         return reject("the data member " + memberName + " has the unsupported type " + type.getAsString());
+   }
+   return true;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Main implementation relying on GetFullyQualifiedTypeName
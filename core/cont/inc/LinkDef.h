@@ -44,6 +44,8 @@
 #pragma link C++ class TObjArray-;
 #pragma link C++ class TObjArrayIter;
 #pragma link C++ class TObjectTable;
+#pragma link C++ class TOpenHashTable;
+#pragma link C++ class TOpenHashTableIter;
 #pragma link C++ class TOrdCollection;
 #pragma link C++ class TOrdCollectionIter;
 #pragma link C++ class TSeqCollection;
@@ -51,10 +51,13 @@ private:
    static std::atomic<UInt_t> fgTally;
    static Bool_t              fgSorted;
    static UInt_t              fgCursor;
+   static std::atomic<ULong64_t> fgGeneration;
 
    TClassTable();
 
    static ROOT::TClassRec   *FindElement(const char *cname, Bool_t insert);
+   static UInt_t       FindSlot(const char *cname, UInt_t hash);
+   static void         Expand();
    static void         SortTable();
 
    static Bool_t CheckClassTableInit();
@@ -83,6 +86,8 @@ public:
    static DictFuncPtr_t    GetDictNorm(const char *cname);
    static TProtoClass     *GetProto(const char *cname);
    static TProtoClass     *GetProtoNorm(const char *cname);
+   static ULong64_t        GetGeneration();
+   static void             IncrementGeneration();
    static void             Init();
    static char            *Next();
    void                    Print(Option_t *option="") const override;
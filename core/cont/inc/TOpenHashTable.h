@@ -0,0 +1,114 @@
+// @(#)root/cont:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TOpenHashTable
+#define ROOT_TOpenHashTable
+
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TOpenHashTable                                                       //
+//                                                                      //
+// TOpenHashTable implements a hash table to store TObject's using an   //
+// open addressing method (linear probing) on a single array of slots,  //
+// each holding the object and its hash value.                          //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "TCollection.h"
+
+class TOpenHashTableIter;
+
+
+class TOpenHashTable : public TCollection {
+
+friend class  TOpenHashTableIter;
+
+private:
+   struct Slot_t {
+      ULong64_t   fHash;      // hash value with bit(0) set, 0 when the slot was never used
+      TObject    *fObject;    // nullptr when the slot is empty or its object was removed
+      Bool_t      InUse() const { return fObject != nullptr; }
+      Bool_t      IsEmpty() const { return fHash == 0; }
+   };
+
+   Slot_t     *fSlots;        //Slots of the table, fSize is their number (a power of 2)
+   Int_t       fEntries;      //Number of objects in table
+   Int_t       fRemoved;      //Number of slots whose object was removed
+
+   static ULong64_t CheckedSlotHash(TObject *obj) { return obj->CheckedHash() | 1; }
+   static ULong64_t SlotHash(const TObject *obj) { return obj->Hash() | 1; }
+   static ULong64_t SlotHash(const char *name);
+   Int_t       FirstSlot(ULong64_t hash) const;
+   Int_t       NextSlot(Int_t slot) const { return (slot + 1) & (fSize - 1); }
+   Bool_t      HighWaterMark() const { return 4 * (fEntries + fRemoved + 1) > 3 * fSize; }
+   void        AddImpl(ULong64_t hash, TObject *obj);
+   void        RemoveAt(Int_t slot);
+   void        Resize(Int_t nEntries, Bool_t rehash = kFALSE);
+
+   TOpenHashTable(const TOpenHashTable&) = delete;
+   TOpenHashTable& operator=(const TOpenHashTable&) = delete;
+
+public:
+   TOpenHashTable(Int_t capacity = TCollection::kInitHashTableCapacity);
+   virtual       ~TOpenHashTable();
+   void          Add(TObject *obj) override;
+   void          AddAll(const TCollection *col) override;
+   void          Clear(Option_t *option="") override;
+   void          Delete(Option_t *option="") override;
+   Bool_t        Empty() const { return fEntries == 0; }
+   TObject      *FindObject(const char *name) const override;
+   TObject      *FindObject(const TObject *obj) const override;
+   TObject     **GetObjectRef(const TObject *obj) const override;
+   Int_t         GetSize() const override { return fEntries; }
+   TIterator    *MakeIterator(Bool_t dir = kIterForward) const override;
+   void          Rehash(Int_t newCapacity);
+   TObject      *Remove(TObject *obj) override;
+   TObject      *RemoveSlow(TObject *obj);
+
+   ClassDefOverride(TOpenHashTable,0)  //A hash table with open addressing
+};
+
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TOpenHashTableIter                                                   //
+//                                                                      //
+// Iterator of an open addressing hash table.                           //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+class TOpenHashTableIter : public TIterator {
+
+private:
+   const TOpenHashTable *fTable;   //hash table being iterated
+   Int_t             fCursor;      //next slot to look at
+   TObject          *fCurrent;     //current object
+   Bool_t            fDirection;   //iteration direction
+
+   TOpenHashTableIter() : fTable(nullptr), fCursor(0), fCurrent(nullptr), fDirection(kIterForward) { }
+
+public:
+   TOpenHashTableIter(const TOpenHashTable *ht, Bool_t dir = kIterForward);
+   TOpenHashTableIter(const TOpenHashTableIter &iter) = default;
+   TIterator          &operator=(const TIterator &rhs) override;
+   TOpenHashTableIter &operator=(const TOpenHashTableIter &rhs);
+
+   const TCollection *GetCollection() const override { return fTable; }
+   TObject           *Next() override;
+   void               Reset() override;
+   Bool_t             operator!=(const TIterator &aIter) const override;
+   Bool_t             operator!=(const TOpenHashTableIter &aIter) const;
+   TObject           *operator*() const override { return fCurrent; }
+
+   ClassDefOverride(TOpenHashTableIter,0)  //Open addressing hash table iterator
+};
+
+#endif
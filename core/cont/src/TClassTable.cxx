@@ -16,6 +16,11 @@ function in a hash table. Classes are automatically added by the
 ctor of a special init class when a global of this init class is
 initialized when the program starts (see the ClassImp macro).
 
+The records are kept in an open addressing hash table (linear probing)
+which grows when it is three quarters full; each slot points to its
+record, which caches the hash value of the class name so that lookups
+only compare names of records with the same hash.
+
 All functions in TClassTable are thread-safe.
 */
 
@@ -41,6 +46,7 @@ All functions in TClassTable are thread-safe.
 #include <cstdlib>
 #include <string>
 #include <mutex>
+#include <shared_mutex>
 
 using namespace ROOT;
 
@@ -53,13 +59,16 @@ UInt_t                TClassTable::fgSize;
 std::atomic<UInt_t>   TClassTable::fgTally;
 Bool_t                TClassTable::fgSorted;
 UInt_t                TClassTable::fgCursor;
+std::atomic<ULong64_t> TClassTable::fgGeneration{1};
 TClassTable::IdMap_t *TClassTable::fgIdMap;
 
 ClassImp(TClassTable);
 
-static std::mutex &GetClassTableMutex()
+// The lookups, by far the most frequent operations, only take a shared lock
+// so that threads looking up classes do not serialize each other.
+static std::shared_mutex &GetClassTableMutex()
 {
-   static std::mutex sMutex;
+   static std::shared_mutex sMutex;
    return sMutex;
 }
 
@@ -88,11 +97,11 @@ public:
       // outside of the `TClassTable` critical section.
       TClassEdit::GetNormalizedName(fNormalizedName, cname);
 
-      GetClassTableMutex().lock();
+      GetClassTableMutex().lock_shared();
    }
 
    ~NormalizeThenLock() {
-      GetClassTableMutex().unlock();
+      GetClassTableMutex().unlock_shared();
    }
 
    const std::string &GetNormalizedName() const {
@@ -105,15 +114,14 @@ public:
 namespace ROOT {
    class TClassRec {
    public:
-      TClassRec(TClassRec *next) :
-        fName(nullptr), fId(0), fDict(nullptr), fInfo(nullptr), fProto(nullptr), fNext(next)
+      TClassRec() :
+        fName(nullptr), fId(0), fDict(nullptr), fInfo(nullptr), fProto(nullptr), fHash(0)
       {}
 
       ~TClassRec() {
          // TClassTable::fgIdMap->Remove(r->fInfo->name());
          delete [] fName;
          delete fProto;
-         delete fNext;
       }
 
       char            *fName;
@@ -122,7 +130,7 @@ namespace ROOT {
       DictFuncPtr_t    fDict;
       const std::type_info *fInfo;
       TProtoClass     *fProto;
-      TClassRec       *fNext;
+      UInt_t           fHash;  // hash value of fName, see ClassRecHash
    };
 
    class TClassAlt {
@@ -234,6 +242,24 @@ namespace ROOT {
 #endif
    };
 
+   // Number of the chained buckets of the alternate names.
+   constexpr UInt_t kAlternateSize = 1009;  //this is the result of (int)TMath::NextPrime(1000);
+
+   // Initial number of slots of the class record table, must be a power of 2.
+   constexpr UInt_t kInitialTableSize = 1024;
+
+   // FNV-1a hash of a class name; contrary to ClassTableHash, all the
+   // characters of long template names contribute to it.
+   static UInt_t ClassRecHash(const char *name)
+   {
+      auto p = reinterpret_cast<const unsigned char*>( name );
+      UInt_t hash = 2166136261u;
+
+      while (*p) hash = (hash ^ *p++) * 16777619u;
+
+      return hash;
+   }
+
    static UInt_t ClassTableHash(const char *name, UInt_t size)
    {
       auto p = reinterpret_cast<const unsigned char*>( name );
@@ -265,12 +291,12 @@ TClassTable::TClassTable()
 {
    if (gClassTable) return;
 
-   fgSize  = 1009;  //this is the result of (int)TMath::NextPrime(1000);
+   fgSize  = kInitialTableSize;
    fgTable = new TClassRec* [fgSize];
-   fgAlternate = new TClassAlt* [fgSize];
+   fgAlternate = new TClassAlt* [kAlternateSize];
    fgIdMap = new IdMap_t;
    memset(fgTable, 0, fgSize * sizeof(TClassRec*));
-   memset(fgAlternate, 0, fgSize * sizeof(TClassAlt*));
+   memset(fgAlternate, 0, kAlternateSize * sizeof(TClassAlt*));
    gClassTable = this;
 
    for (auto &&r : GetDelayedAddClass()) {
@@ -293,7 +319,7 @@ TClassTable::~TClassTable()
    if (gClassTable != this) return;
 
    for (UInt_t i = 0; i < fgSize; i++) {
-      delete fgTable[i]; // Will delete all the elements in the chain.
+      delete fgTable[i];
    }
    delete [] fgTable; fgTable = nullptr;
    delete [] fgSortedTable; fgSortedTable = nullptr;
@@ -327,7 +353,7 @@ inline Bool_t TClassTable::CheckClassTableInit()
 
 void TClassTable::Print(Option_t *option) const
 {
-   std::lock_guard<std::mutex> lock(GetClassTableMutex());
+   std::lock_guard<std::shared_mutex> lock(GetClassTableMutex());
 
    // This is the very rare case (i.e. called before any dictionary load)
    // so we don't need to execute this outside of the critical section.
@@ -374,7 +400,7 @@ void TClassTable::Print(Option_t *option) const
 char *TClassTable::At(UInt_t index)
 {
    if (index < fgTally) {
-      std::lock_guard<std::mutex> lock(GetClassTableMutex());
+      std::lock_guard<std::shared_mutex> lock(GetClassTableMutex());
 
       SortTable();
       TClassRec *r = fgSortedTable[index];
@@ -384,6 +410,26 @@ char *TClassTable::At(UInt_t index)
    return nullptr;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the generation of the class table. It changes whenever a class
+/// or an alternate name is added to or removed from the table, or a TClass
+/// is registered or removed (see TClass::AddClass()). Caches of class lookups,
+/// like the ones of TClass::GetClass(), are valid as long as the generation
+/// they were filled at is current.
+
+ULong64_t TClassTable::GetGeneration()
+{
+   return fgGeneration.load(std::memory_order_acquire);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Invalidate the caches of class lookups, see GetGeneration().
+
+void TClassTable::IncrementGeneration()
+{
+   fgGeneration.fetch_add(1, std::memory_order_acq_rel);
+}
+
 //______________________________________________________________________________
 int   TClassTable::Classes() { return fgTally; }
 //______________________________________________________________________________
@@ -406,7 +452,7 @@ void TClassTable::Add(const char *cname, Version_t id,  const std::type_info &in
    if (!gClassTable)
       new TClassTable;
 
-   std::unique_lock<std::mutex> lock(GetClassTableMutex());
+   std::unique_lock<std::shared_mutex> lock(GetClassTableMutex());
 
    // check if already in table, if so return
    TClassRec *r = FindElement(cname, kTRUE);
@@ -450,6 +496,7 @@ void TClassTable::Add(const char *cname, Version_t id,  const std::type_info &in
    fgIdMap->Add(info.name(),r);
 
    fgSorted = kFALSE;
+   IncrementGeneration();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -462,7 +509,7 @@ void TClassTable::Add(TProtoClass *proto)
    if (!gClassTable)
       new TClassTable;
 
-   std::unique_lock<std::mutex> lock(GetClassTableMutex());
+   std::unique_lock<std::shared_mutex> lock(GetClassTableMutex());
 
    // By definition the name in the TProtoClass is (must be) the normalized
    // name, so there is no need to tweak it.
@@ -492,7 +539,8 @@ void TClassTable::Add(TProtoClass *proto)
       }
    }
 
-   r->fName = StrDup(cname);
+   if (!r->fName)
+      r->fName = StrDup(cname);
    r->fId   = 0;
    r->fBits = 0;
    r->fDict = nullptr;
@@ -500,6 +548,7 @@ void TClassTable::Add(TProtoClass *proto)
    r->fProto= proto;
 
    fgSorted = kFALSE;
+   IncrementGeneration();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -511,9 +560,9 @@ ROOT::TClassAlt* TClassTable::AddAlternate(const char *normName, const char *alt
    if (!gClassTable)
       new TClassTable;
 
-   std::lock_guard<std::mutex> lock(GetClassTableMutex());
+   std::lock_guard<std::shared_mutex> lock(GetClassTableMutex());
 
-   UInt_t slot = ROOT::ClassTableHash(alternate, fgSize);
+   UInt_t slot = ROOT::ClassTableHash(alternate, kAlternateSize);
 
    for (const TClassAlt *a = fgAlternate[slot]; a; a = a->fNext.get()) {
       if (strcmp(alternate,a->fName)==0) {
@@ -527,6 +576,7 @@ ROOT::TClassAlt* TClassTable::AddAlternate(const char *normName, const char *alt
    }
 
    fgAlternate[slot] = new TClassAlt(alternate,normName,fgAlternate[slot]);
+   IncrementGeneration();
    return fgAlternate[slot];
 }
 
@@ -537,9 +587,9 @@ void TClassTable::RemoveAlternate(ROOT::TClassAlt *alt)
    if (!alt || !gClassTable)
       return;
 
-   std::lock_guard<std::mutex> lock(GetClassTableMutex());
+   std::lock_guard<std::shared_mutex> lock(GetClassTableMutex());
 
-   UInt_t slot = ROOT::ClassTableHash(alt->fName, fgSize);
+   UInt_t slot = ROOT::ClassTableHash(alt->fName, kAlternateSize);
 
    if (!fgAlternate[slot])
       return;
@@ -556,6 +606,7 @@ void TClassTable::RemoveAlternate(ROOT::TClassAlt *alt)
       }
    }
    delete alt;
+   IncrementGeneration();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -565,15 +616,14 @@ Bool_t TClassTable::Check(const char *cname, std::string &normname)
    if (!CheckClassTableInit())
       return kFALSE;
 
-   std::lock_guard<std::mutex> lock(GetClassTableMutex());
-
-   UInt_t slot = ROOT::ClassTableHash(cname, fgSize);
+   std::shared_lock<std::shared_mutex> lock(GetClassTableMutex());
 
    // Check if 'cname' is a known normalized name.
-   for (TClassRec *r = fgTable[slot]; r; r = r->fNext)
-      if (strcmp(cname,r->fName)==0) return kTRUE;
+   if (fgTable[FindSlot(cname, ROOT::ClassRecHash(cname))])
+      return kTRUE;
 
    // See if 'cname' is register in the list of alternate names
+   UInt_t slot = ROOT::ClassTableHash(cname, kAlternateSize);
    for (const TClassAlt *a = fgAlternate[slot]; a; a = a->fNext.get()) {
       if (strcmp(cname,a->fName)==0) {
          normname = a->fNormName;
@@ -593,27 +643,77 @@ void TClassTable::Remove(const char *cname)
    if (!CheckClassTableInit())
       return;
 
-   std::lock_guard<std::mutex> lock(GetClassTableMutex());
-
-   UInt_t slot = ROOT::ClassTableHash(cname, fgSize);
-
-   TClassRec *r;
-   TClassRec *prev = nullptr;
-   for (r = fgTable[slot]; r; r = r->fNext) {
-      if (!strcmp(r->fName, cname)) {
-         if (prev)
-            prev->fNext = r->fNext;
-         else
-            fgTable[slot] = r->fNext;
-         fgIdMap->Remove(r->fInfo->name());
-         r->fNext = nullptr; // Do not delete the others.
-         delete r;
-         fgTally--;
-         fgSorted = kFALSE;
+   std::lock_guard<std::shared_mutex> lock(GetClassTableMutex());
+
+   UInt_t slot = FindSlot(cname, ROOT::ClassRecHash(cname));
+   TClassRec *r = fgTable[slot];
+   if (!r)
+      return;
+
+   fgIdMap->Remove(r->fInfo->name());
+   delete r;
+   fgTally--;
+   fgSorted = kFALSE;
+
+   // Shift back the following records of the probe sequence which would
+   // not be found anymore through the emptied slot.
+   const UInt_t mask = fgSize - 1;
+   UInt_t hole = slot;
+   for (UInt_t next = (slot + 1) & mask; fgTable[next]; next = (next + 1) & mask) {
+      UInt_t home = fgTable[next]->fHash & mask;
+      // Move the record unless its home slot lies cyclically in (hole, next].
+      if (((next - home) & mask) >= ((next - hole) & mask)) {
+         fgTable[hole] = fgTable[next];
+         hole = next;
+      }
+   }
+   fgTable[hole] = nullptr;
+   IncrementGeneration();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the slot of the record of the class `cname` whose hash is `hash`,
+/// or the empty slot where such a record would be inserted.
+
+UInt_t TClassTable::FindSlot(const char *cname, UInt_t hash)
+{
+   // Internal routine, no explicit lock needed here.
+
+   const UInt_t mask = fgSize - 1;
+   UInt_t slot = hash & mask;
+   for (TClassRec *r = fgTable[slot]; r; r = fgTable[slot]) {
+      if (r->fHash == hash && strcmp(cname, r->fName) == 0)
          break;
+      slot = (slot + 1) & mask;
+   }
+   return slot;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Double the number of slots of the class record table and re-insert all
+/// the records. The records themselves do not move.
+
+void TClassTable::Expand()
+{
+   // Internal routine, no explicit lock needed here.
+
+   TClassRec **old = fgTable;
+   UInt_t oldSize = fgSize;
+
+   fgSize  = 2 * oldSize;
+   fgTable = new TClassRec* [fgSize];
+   memset(fgTable, 0, fgSize * sizeof(TClassRec*));
+
+   const UInt_t mask = fgSize - 1;
+   for (UInt_t i = 0; i < oldSize; i++) {
+      if (TClassRec *r = old[i]) {
+         UInt_t slot = r->fHash & mask;
+         while (fgTable[slot])
+            slot = (slot + 1) & mask;
+         fgTable[slot] = r;
       }
-      prev = r;
    }
+   delete [] old;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -626,19 +726,28 @@ TClassRec *TClassTable::FindElement(const char *cname, Bool_t insert)
 {
    // Internal routine, no explicit lock needed here.
 
-   UInt_t slot = ROOT::ClassTableHash(cname, fgSize);
+   UInt_t hash = ROOT::ClassRecHash(cname);
+   UInt_t slot = FindSlot(cname, hash);
 
-   for (TClassRec *r = fgTable[slot]; r; r = r->fNext)
-      if (strcmp(cname, r->fName) == 0)
-         return r;
+   if (fgTable[slot] || !insert)
+      return fgTable[slot];
 
-   if (!insert)
-      return nullptr;
+   // Keep at least a quarter of the slots empty, so that probe sequences
+   // stay short.
+   if (4 * (fgTally + 1) > 3 * fgSize) {
+      Expand();
+      slot = FindSlot(cname, hash);
+   }
 
-   fgTable[slot] = new TClassRec(fgTable[slot]);
+   // The name is set right away: it is compared by the lookups of the
+   // records with the same hash.
+   TClassRec *r = new TClassRec;
+   r->fName = StrDup(cname);
+   r->fHash = hash;
+   fgTable[slot] = r;
 
    fgTally++;
-   return fgTable[slot];
+   return r;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -697,7 +806,7 @@ DictFuncPtr_t TClassTable::GetDict(const std::type_info& info)
    if (gDebug > 9)
       ROOT::GetROOT(); // Info might recursively call TClassTable during the gROOT init
 
-   std::lock_guard<std::mutex> lock(GetClassTableMutex());
+   std::shared_lock<std::shared_mutex> lock(GetClassTableMutex());
 
    if (gDebug > 9) {
       ::Info("GetDict", "searches for %s at 0x%zx", info.name(), (size_t)&info);
@@ -722,7 +831,7 @@ DictFuncPtr_t TClassTable::GetDictNorm(const char *cname)
    if (gDebug > 9)
       ROOT::GetROOT(); // Info might recursively call TClassTable during the gROOT init
 
-   std::lock_guard<std::mutex> lock(GetClassTableMutex());
+   std::shared_lock<std::shared_mutex> lock(GetClassTableMutex());
 
    if (gDebug > 9) {
       ::Info("GetDict", "searches for %s", cname);
@@ -776,7 +885,7 @@ TProtoClass *TClassTable::GetProtoNorm(const char *cname)
    if (!CheckClassTableInit())
       return nullptr;
 
-   std::lock_guard<std::mutex> lock(GetClassTableMutex());
+   std::shared_lock<std::shared_mutex> lock(GetClassTableMutex());
 
    if (gDebug > 9) {
       fgIdMap->Print();
@@ -806,7 +915,7 @@ extern "C" {
 
 char *TClassTable::Next()
 {
-   std::lock_guard<std::mutex> lock(GetClassTableMutex());
+   std::lock_guard<std::shared_mutex> lock(GetClassTableMutex());
 
    if (fgCursor < fgTally) {
       TClassRec *r = fgSortedTable[fgCursor++];
@@ -825,7 +934,7 @@ void TClassTable::PrintTable()
    if (fgTally == 0 || !fgTable)
       return;
 
-   std::lock_guard<std::mutex> lock(GetClassTableMutex());
+   std::lock_guard<std::shared_mutex> lock(GetClassTableMutex());
 
    SortTable();
 
@@ -864,8 +973,8 @@ void TClassTable::SortTable()
 
       int j = 0;
       for (UInt_t i = 0; i < fgSize; i++)
-         for (TClassRec *r = fgTable[i]; r; r = r->fNext)
-            fgSortedTable[j++] = r;
+         if (fgTable[i])
+            fgSortedTable[j++] = fgTable[i];
 
       ::qsort(fgSortedTable, fgTally, sizeof(TClassRec *), ::ClassComp);
       fgSorted = kTRUE;
@@ -879,7 +988,7 @@ void TClassTable::Terminate()
 {
    if (gClassTable) {
       for (UInt_t i = 0; i < fgSize; i++)
-         delete fgTable[i]; // Will delete all the elements in the chain.
+         delete fgTable[i];
 
       delete [] fgTable; fgTable = nullptr;
       delete [] fgSortedTable; fgSortedTable = nullptr;
@@ -899,7 +1008,7 @@ void ROOT::AddClass(const char *cname, Version_t id,
                     Int_t pragmabits)
 {
    if (!TROOT::Initialized() && !gClassTable) {
-      auto r = std::unique_ptr<TClassRec>(new TClassRec(nullptr));
+      auto r = std::unique_ptr<TClassRec>(new TClassRec);
       r->fName = StrDup(cname);
       r->fId   = id;
       r->fBits = pragmabits;
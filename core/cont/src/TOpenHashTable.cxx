@@ -0,0 +1,444 @@
+// @(#)root/cont:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TOpenHashTable
+\ingroup Containers
+TOpenHashTable implements a hash table to store TObject's, with the
+same interface and lookup semantics as THashTable: the hash value is
+the one returned by the TObject's Hash() function, objects are found
+by name or with their IsEqual() function.
+
+Contrary to THashTable, whose slots are linked lists of objects, the
+objects are stored in a single array of slots using open addressing
+(linear probing). Each slot also holds the hash value of its object,
+such that a lookup only calls the (virtual) GetName() or IsEqual() of
+the objects whose hash matches, and colliding objects are in adjacent
+slots instead of in separate list nodes. The table grows automatically
+to keep at least a quarter of its slots free, there is no rehash level
+to tune.
+
+Removing objects while iterating over the table is supported, adding
+objects is not, as it can move all objects if the table grows.
+Like THashTable, TOpenHashTable does not preserve the insertion order
+of the objects.
+*/
+
+#include "TOpenHashTable.h"
+#include "TObjectTable.h"
+#include "TError.h"
+#include "TMathBase.h"
+#include "TString.h"
+
+#include <cstring>
+
+ClassImp(TOpenHashTable);
+
+namespace {
+// minimum number of slots of a table
+constexpr Int_t kMinCapacity = 16;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a TOpenHashTable object able to hold capacity objects without
+/// growing, by default kInitHashTableCapacity = 17.
+
+TOpenHashTable::TOpenHashTable(Int_t capacity) : fSlots(nullptr), fEntries(0), fRemoved(0)
+{
+   if (capacity < 0) {
+      Warning("TOpenHashTable", "capacity (%d) < 0", capacity);
+      capacity = TCollection::kInitHashTableCapacity;
+   }
+   fSize = 0;
+   Resize(capacity);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete a hashtable. Objects are not deleted unless the TOpenHashTable is the
+/// owner (set via SetOwner()).
+
+TOpenHashTable::~TOpenHashTable()
+{
+   if (fSlots) Clear();
+   delete [] fSlots;
+   fSlots = nullptr;
+   fSize = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the hash value stored with an object of this name.
+
+ULong64_t TOpenHashTable::SlotHash(const char *name)
+{
+   return ::Hash(name) | 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the first slot of the probe sequence of a hash value. The hash
+/// value is mixed such that hash functions which do not randomize their
+/// low bits, e.g. those based on addresses, still spread the objects.
+
+Int_t TOpenHashTable::FirstSlot(ULong64_t hash) const
+{
+   ULong64_t h = hash * 0x9E3779B97F4A7C15ULL;
+   h ^= h >> 32;
+   return Int_t(h & ULong64_t(fSize - 1));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Helper function doing the actual add to the table, growing it if needed.
+/// This does not take any lock.
+
+void TOpenHashTable::AddImpl(ULong64_t hash, TObject *obj)
+{
+   if (HighWaterMark())
+      Resize(2 * (fEntries + 1));
+
+   Int_t slot = FirstSlot(hash);
+   // the slots of removed objects are reused, the table always has empty slots
+   while (fSlots[slot].InUse())
+      slot = NextSlot(slot);
+   if (!fSlots[slot].IsEmpty())
+      --fRemoved;
+   fSlots[slot].fHash = hash;
+   fSlots[slot].fObject = obj;
+   ++fEntries;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the object of a slot. The slot keeps its hash value such that
+/// the probe sequences going through it are not interrupted.
+
+void TOpenHashTable::RemoveAt(Int_t slot)
+{
+   fSlots[slot].fObject = nullptr;
+   --fEntries;
+   ++fRemoved;
+   // if the next slot is empty, no probe sequence goes through this one anymore
+   while (fSlots[NextSlot(slot)].IsEmpty() && !fSlots[slot].InUse() && !fSlots[slot].IsEmpty()) {
+      fSlots[slot].fHash = 0;
+      --fRemoved;
+      slot = (slot - 1) & (fSize - 1);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Resize the table to hold nEntries objects without growing, and refill it.
+/// If rehash is true, the hash values of the objects are recomputed instead
+/// of reusing the stored ones. This does not take any lock.
+
+void TOpenHashTable::Resize(Int_t nEntries, Bool_t rehash)
+{
+   Int_t newSize = kMinCapacity;
+   while (3 * newSize < 4 * (nEntries + 1))
+      newSize *= 2;
+
+   Slot_t *oldSlots = fSlots;
+   const Int_t oldSize = fSize;
+   fSlots = new Slot_t[newSize];
+   memset(fSlots, 0, newSize * sizeof(Slot_t));
+   fSize = newSize;
+   fEntries = 0;
+   fRemoved = 0;
+
+   for (Int_t i = 0; i < oldSize; ++i) {
+      if (oldSlots[i].InUse()) {
+         const ULong64_t hash = rehash ? SlotHash(oldSlots[i].fObject) : oldSlots[i].fHash;
+         Int_t slot = FirstSlot(hash);
+         while (fSlots[slot].InUse())
+            slot = NextSlot(slot);
+         fSlots[slot].fHash = hash;
+         fSlots[slot].fObject = oldSlots[i].fObject;
+         ++fEntries;
+      }
+   }
+   delete [] oldSlots;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add object to the hash table. Its position in the table will be
+/// determined by the value returned by its Hash() function.
+
+void TOpenHashTable::Add(TObject *obj)
+{
+   if (IsArgNull("Add", obj)) return;
+
+   const ULong64_t hash = CheckedSlotHash(obj);
+
+   R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+
+   AddImpl(hash, obj);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add all objects from collection col to this collection.
+/// The table is grown once for all of them.
+
+void TOpenHashTable::AddAll(const TCollection *col)
+{
+   R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+
+   const Int_t sumEntries = fEntries + col->GetEntries();
+   if (4 * (sumEntries + fRemoved + 1) > 3 * fSize)
+      Resize(sumEntries);
+
+   TCollection::AddAll(col);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all objects from the table. Does not delete the objects
+/// unless the TOpenHashTable is the owner (set via SetOwner()).
+
+void TOpenHashTable::Clear(Option_t *option)
+{
+   const Bool_t nodelete = option && !strcmp(option, "nodelete");
+   if (IsOwner() && !nodelete) {
+      Delete(option);
+      return;
+   }
+
+   R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+
+   memset(fSlots, 0, fSize * sizeof(Slot_t));
+   fEntries = 0;
+   fRemoved = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all objects from the table AND delete all heap based objects.
+
+void TOpenHashTable::Delete(Option_t *)
+{
+   R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+
+   // the objects are removed before being deleted, as their destructor
+   // may look for them in, or remove them from, this table
+   for (Int_t i = 0; i < fSize; ++i) {
+      TObject *obj = fSlots[i].fObject;
+      if (obj) {
+         RemoveAt(i);
+         if (obj->IsOnHeap())
+            TCollection::GarbageCollect(obj);
+      }
+   }
+   memset(fSlots, 0, fSize * sizeof(Slot_t));
+   fEntries = 0;
+   fRemoved = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find object using its name. Only the objects whose hash value is the
+/// one of the name, returned by TString::Hash(), are compared.
+
+TObject *TOpenHashTable::FindObject(const char *name) const
+{
+   if (!name) return nullptr;
+
+   const ULong64_t hash = SlotHash(name);
+
+   R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
+
+   for (Int_t slot = FirstSlot(hash); !fSlots[slot].IsEmpty(); slot = NextSlot(slot)) {
+      const Slot_t &s = fSlots[slot];
+      if (s.fHash == hash && s.fObject) {
+         const char *objname = s.fObject->GetName();
+         if (objname && strcmp(name, objname) == 0)
+            return s.fObject;
+      }
+   }
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find object using its hash value (returned by its Hash() member) and
+/// its IsEqual() member.
+
+TObject *TOpenHashTable::FindObject(const TObject *obj) const
+{
+   TObject **ref = GetObjectRef(obj);
+   return ref ? *ref : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return address of pointer to obj. It is invalidated when objects are added.
+
+TObject **TOpenHashTable::GetObjectRef(const TObject *obj) const
+{
+   if (IsArgNull("GetObjectRef", obj)) return nullptr;
+
+   const ULong64_t hash = SlotHash(obj);
+
+   R__COLLECTION_READ_LOCKGUARD(ROOT::gCoreMutex);
+
+   for (Int_t slot = FirstSlot(hash); !fSlots[slot].IsEmpty(); slot = NextSlot(slot)) {
+      Slot_t &s = fSlots[slot];
+      if (s.fHash == hash && s.fObject && s.fObject->IsEqual(obj))
+         return &s.fObject;
+   }
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns a hash table iterator.
+
+TIterator *TOpenHashTable::MakeIterator(Bool_t dir) const
+{
+   return new TOpenHashTableIter(this, dir);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Resize the table to hold newCapacity objects without growing, and refill
+/// it with the current hash values of the objects, e.g. after some of them
+/// were renamed. This also discards the slots of the objects removed so far.
+
+void TOpenHashTable::Rehash(Int_t newCapacity)
+{
+   R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+
+   Resize(TMath::Max(newCapacity, fEntries), kTRUE);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove object from the hashtable. The object is found with its hash
+/// value and its IsEqual() member. If its hash value changed since it was
+/// added, e.g. because it was renamed, use RemoveSlow().
+
+TObject *TOpenHashTable::Remove(TObject *obj)
+{
+   if (!obj) return nullptr;
+
+   const ULong64_t hash = SlotHash(obj);
+
+   R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+
+   Int_t found = -1;
+   for (Int_t slot = FirstSlot(hash); !fSlots[slot].IsEmpty(); slot = NextSlot(slot)) {
+      const Slot_t &s = fSlots[slot];
+      if (s.fHash == hash && s.fObject) {
+         // prefer the object itself over another one which compares equal
+         if (s.fObject == obj) {
+            found = slot;
+            break;
+         }
+         if (found < 0 && !ROOT::Detail::HasBeenDeleted(s.fObject) && s.fObject->IsEqual(obj))
+            found = slot;
+      }
+   }
+   if (found < 0) return nullptr;
+
+   TObject *ob = fSlots[found].fObject;
+   RemoveAt(found);
+   return ob;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove object from the hashtable without using the hash value.
+
+TObject *TOpenHashTable::RemoveSlow(TObject *obj)
+{
+   R__COLLECTION_WRITE_LOCKGUARD(ROOT::gCoreMutex);
+
+   for (Int_t i = 0; i < fSize; ++i) {
+      TObject *ob = fSlots[i].fObject;
+      if (ob && (ob == obj || ob->IsEqual(obj))) {
+         RemoveAt(i);
+         return ob;
+      }
+   }
+   return nullptr;
+}
+
+/** \class TOpenHashTableIter
+Iterator of an open addressing hash table.
+*/
+
+ClassImp(TOpenHashTableIter);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a hashtable iterator. By default the iteration direction
+/// is kIterForward. To go backward use kIterBackward.
+
+TOpenHashTableIter::TOpenHashTableIter(const TOpenHashTable *ht, Bool_t dir)
+   : fTable(ht), fCursor(0), fCurrent(nullptr), fDirection(dir)
+{
+   Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Overridden assignment operator.
+
+TIterator &TOpenHashTableIter::operator=(const TIterator &rhs)
+{
+   if (this != &rhs && rhs.IsA() == TOpenHashTableIter::Class())
+      *this = static_cast<const TOpenHashTableIter &>(rhs);
+   return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Overloaded assignment operator.
+
+TOpenHashTableIter &TOpenHashTableIter::operator=(const TOpenHashTableIter &rhs)
+{
+   if (this != &rhs) {
+      fTable     = rhs.fTable;
+      fCursor    = rhs.fCursor;
+      fCurrent   = rhs.fCurrent;
+      fDirection = rhs.fDirection;
+   }
+   return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return next object in hashtable. Returns 0 when no more objects in table.
+
+TObject *TOpenHashTableIter::Next()
+{
+   fCurrent = nullptr;
+   if (fDirection == kIterForward) {
+      for ( ; fCursor < fTable->fSize && !fCurrent; fCursor++)
+         fCurrent = fTable->fSlots[fCursor].fObject;
+   } else {
+      for ( ; fCursor >= 0 && !fCurrent; fCursor--)
+         fCurrent = fTable->fSlots[fCursor].fObject;
+   }
+   return fCurrent;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reset the hashtable iterator. Either to beginning or end, depending on
+/// the initial iteration direction.
+
+void TOpenHashTableIter::Reset()
+{
+   if (fDirection == kIterForward)
+      fCursor = 0;
+   else
+      fCursor = fTable->fSize - 1;
+   fCurrent = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// This operator compares two TIterator objects.
+
+Bool_t TOpenHashTableIter::operator!=(const TIterator &aIter) const
+{
+   if (aIter.IsA() == TOpenHashTableIter::Class()) {
+      const TOpenHashTableIter &iter(dynamic_cast<const TOpenHashTableIter &>(aIter));
+      return (fCurrent != iter.fCurrent);
+   }
+   return false; // for base class we don't implement a comparison
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// This operator compares two TOpenHashTableIter objects.
+
+Bool_t TOpenHashTableIter::operator!=(const TOpenHashTableIter &aIter) const
+{
+   return (fCurrent != aIter.fCurrent);
+}
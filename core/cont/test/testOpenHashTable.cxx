@@ -0,0 +1,120 @@
+#include "TOpenHashTable.h"
+#include "TNamed.h"
+#include "TObjString.h"
+
+#include "gtest/gtest.h"
+
+#include <set>
+#include <string>
+
+TEST(TOpenHashTable, AddFindRemove)
+{
+   TOpenHashTable table;
+   table.SetOwner(kTRUE);
+   const int n = 1000;
+   for (int i = 0; i < n; ++i)
+      table.Add(new TNamed(("obj" + std::to_string(i)).c_str(), "title"));
+   EXPECT_EQ(n, table.GetSize());
+
+   for (int i = 0; i < n; ++i) {
+      std::string name = "obj" + std::to_string(i);
+      TObject *obj = table.FindObject(name.c_str());
+      ASSERT_NE(nullptr, obj);
+      EXPECT_STREQ(name.c_str(), obj->GetName());
+   }
+   EXPECT_EQ(nullptr, table.FindObject("missing"));
+
+   // remove every other object, the others must still be found
+   for (int i = 0; i < n; i += 2) {
+      TObject *obj = table.FindObject(("obj" + std::to_string(i)).c_str());
+      EXPECT_EQ(obj, table.Remove(obj));
+      delete obj;
+   }
+   EXPECT_EQ(n / 2, table.GetSize());
+   for (int i = 0; i < n; ++i) {
+      TObject *obj = table.FindObject(("obj" + std::to_string(i)).c_str());
+      EXPECT_EQ(i % 2 == 1, obj != nullptr);
+   }
+
+   // the slots of the removed objects are reused
+   for (int i = 0; i < n; i += 2)
+      table.Add(new TNamed(("obj" + std::to_string(i)).c_str(), "title"));
+   EXPECT_EQ(n, table.GetSize());
+   EXPECT_NE(nullptr, table.FindObject("obj0"));
+}
+
+TEST(TOpenHashTable, FindByValue)
+{
+   TOpenHashTable table;
+   table.SetOwner(kTRUE);
+   table.Add(new TObjString("alpha"));
+   table.Add(new TObjString("beta"));
+
+   TObjString key("beta");
+   TObject *obj = table.FindObject(&key);
+   ASSERT_NE(nullptr, obj);
+   EXPECT_NE(&key, obj);
+   EXPECT_STREQ("beta", obj->GetName());
+
+   // Remove() with an object comparing equal removes the stored one
+   EXPECT_EQ(obj, table.Remove(&key));
+   delete obj;
+   EXPECT_EQ(1, table.GetSize());
+   EXPECT_EQ(nullptr, table.FindObject(&key));
+}
+
+TEST(TOpenHashTable, Iteration)
+{
+   TOpenHashTable table(4);
+   table.SetOwner(kTRUE);
+   std::set<std::string> names;
+   for (int i = 0; i < 100; ++i) {
+      names.insert("obj" + std::to_string(i));
+      table.Add(new TNamed(("obj" + std::to_string(i)).c_str(), "title"));
+   }
+
+   std::set<std::string> seen;
+   for (auto obj : table)
+      seen.insert(obj->GetName());
+   EXPECT_EQ(names, seen);
+
+   std::set<std::string> seenBackward;
+   TIter backward(&table, kIterBackward);
+   while (TObject *obj = backward())
+      seenBackward.insert(obj->GetName());
+   EXPECT_EQ(names, seenBackward);
+
+   // removing the current object does not disturb the iteration
+   int count = 0;
+   TIter next(&table);
+   while (TObject *obj = next()) {
+      ++count;
+      delete table.Remove(obj);
+   }
+   EXPECT_EQ(100, count);
+   EXPECT_EQ(0, table.GetSize());
+   EXPECT_TRUE(table.Empty());
+}
+
+TEST(TOpenHashTable, RemoveSlowAndRehash)
+{
+   TOpenHashTable table;
+   TNamed a("a", ""), b("b", "");
+   table.Add(&a);
+   table.Add(&b);
+
+   // after a rename the object is not found by its hash anymore
+   b.SetName("c");
+   EXPECT_EQ(nullptr, table.FindObject("c"));
+   table.Rehash(1000);
+   EXPECT_EQ(&b, table.FindObject("c"));
+   EXPECT_EQ(&a, table.FindObject("a"));
+
+   b.SetName("d");
+   EXPECT_EQ(&b, table.RemoveSlow(&b));
+   EXPECT_EQ(1, table.GetSize());
+
+   table.Clear();
+   EXPECT_EQ(0, table.GetSize());
+   EXPECT_EQ(nullptr, table.FindObject("a"));
+}
@@ -44,6 +44,7 @@ private:
    bool fRequestProtected;       // Explicit request to be able to access protected member from the interpreter.
    bool fRequestPrivate;         // Explicit request to be able to access private member from the interpreter.
    int  fRequestedVersionNumber; // Explicit request for a specific version number (default to no request with -1).
+   bool fRequestFastStreamer = false; // for linkdef.h: true if we had the 'faststreamer' option
 
 public:
 
@@ -78,6 +79,7 @@ public:
    void SetRequestProtected(bool val);
    void SetRequestPrivate(bool val);
    void SetRequestedVersionNumber(int version);
+   void SetRequestFastStreamer(bool val);
 
    bool RequestOnlyTClass() const;      // True if the user want the TClass intiliazer but *not* the interpreter meta data
    bool RequestNoStreamer() const;      // Request no Streamer function in the dictionary
@@ -86,6 +88,7 @@ public:
    bool RequestProtected() const;
    bool RequestPrivate() const;
    int  RequestedVersionNumber() const;
+   bool RequestFastStreamer() const;    // Request a generated straight-line Streamer
 };
 
 #endif
@@ -157,6 +157,16 @@ void ClassSelectionRule::SetRequestedVersionNumber(int version)
    fRequestedVersionNumber = version;
 }
 
+void ClassSelectionRule::SetRequestFastStreamer(bool value)
+{
+   fRequestFastStreamer = value;
+}
+
+bool ClassSelectionRule::RequestFastStreamer() const
+{
+   return fRequestFastStreamer;
+}
+
 bool ClassSelectionRule::RequestOnlyTClass() const
 {
    return fRequestOnlyTClass;
@@ -47,7 +47,7 @@ std::map<std::string, LinkdefReader::EPragmaNames> LinkdefReader::fgMapPragmaNam
 std::map<std::string, LinkdefReader::ECppNames> LinkdefReader::fgMapCppNames;
 
 struct LinkdefReader::Options {
-   Options() : fNoStreamer(0), fNoInputOper(0), fUseByteCount(0), fVersionNumber(-1) {}
+   Options() : fNoStreamer(0), fNoInputOper(0), fUseByteCount(0), fVersionNumber(-1), fFastStreamer(0) {}
 
    int fNoStreamer;
    int fNoInputOper;
@@ -56,6 +56,7 @@ struct LinkdefReader::Options {
       int fRequestStreamerInfo;
    };
    int fVersionNumber;
+   int fFastStreamer;
 };
 
 /*
@@ -406,6 +407,7 @@ bool LinkdefReader::AddRule(const std::string& ruletype,
                   if (options->fNoInputOper) csr.SetRequestNoInputOperator(true);
                   if (options->fRequestStreamerInfo) csr.SetRequestStreamerInfo(true);
                   if (options->fVersionNumber >= 0) csr.SetRequestedVersionNumber(options->fVersionNumber);
+                  if (options->fFastStreamer) csr.SetRequestFastStreamer(true);
                }
                if (csr.RequestStreamerInfo() && csr.RequestNoStreamer()) {
                   std::cerr << "Warning: " << localIdentifier << " option + mutual exclusive with -, + prevails\n";
@@ -660,6 +662,7 @@ public:
        *   nomap: (ignored by roocling; prevents entry in ROOT's rootmap file)
        *   stub: (ignored by rootcling was a directly for CINT code generation)
        *   version(x): sets the version number of the class to x
+       *   faststreamer: generate a straight-line Streamer for a class with '+' (see WriteFastStreamer)
        */
 
       // We assume that the first toke in option or options
@@ -681,6 +684,7 @@ public:
          } else if (tok.getIdentifierInfo()->getName() == "nostreamer") options.fNoStreamer = 1;
          else if (tok.getIdentifierInfo()->getName() == "noinputoper") options.fNoInputOper = 1;
          else if (tok.getIdentifierInfo()->getName() == "evolution") options.fRequestStreamerInfo = 1;
+         else if (tok.getIdentifierInfo()->getName() == "faststreamer") options.fFastStreamer = 1;
          else if (tok.getIdentifierInfo()->getName() == "stub") {
             // This was solely for CINT dictionary, ignore for now.
             // options.fUseStubs = 1;
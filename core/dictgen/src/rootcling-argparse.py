@@ -136,6 +136,15 @@ Instead, rely on the environment variable $ROOT_INCLUDE_PATH at runtime
 """)
 	parser.add_argument('-excludePath', help="""Specify a path to be excluded from the include paths
 specified for building this dictionary
+""")
+	parser.add_argument('-incremental', help="""Skip the generation if the dictionary is up to date
+The command line arguments and the content hash of every file read are
+recorded next to the dictionary in <output dictionary file>.inputs. If none
+of them changed since the last generation, the outputs are just touched.
+""")
+	parser.add_argument('-batch', help="""Run several rootcling invocations: rootcling -batch <file> [-j <N>]
+Each non empty line of <file> holds the arguments of one invocation. Up to
+N invocations (by default the number of cores) run in parallel.
 """)
 	parser.add_argument('--lib-list-prefix', help="""Specify libraries needed by the header files parsed
 This feature is used by ACliC (the automatic library generator).
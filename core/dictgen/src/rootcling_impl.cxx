@@ -33,6 +33,8 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <numeric>
+#include <chrono>
+#include <thread>
 
 
 #ifdef _WIN32
@@ -82,15 +84,22 @@
 #include "clang/Lex/ModuleMap.h"
 #include "clang/Lex/Pragma.h"
 #include "clang/Sema/Sema.h"
+#include "clang/Serialization/ASTReader.h"
 #include "clang/Serialization/ASTWriter.h"
 #include "cling/Utils/AST.h"
 
 #include "llvm/ADT/StringRef.h"
 
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/PrettyStackTrace.h"
+#include "llvm/Support/Process.h"
+#include "llvm/Support/Program.h"
 #include "llvm/Support/Signals.h"
+#include "llvm/Support/StringSaver.h"
+#include "llvm/Support/xxhash.h"
 
 #include "RtypesCore.h"
 #include "TModuleGenerator.h"
@@ -1829,6 +1838,111 @@ void WriteAutoStreamer(const ROOT::TMetaUtils::AnnotatedRecordDecl &cl,
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Write a Streamer() method for a class selected with the 'faststreamer' option:
+/// the data members are read and written by straight-line code producing the same
+/// bytes as the StreamerInfo of the current class version, without going through
+/// the StreamerInfo actions. Data written with another version of the class, or
+/// that needs schema evolution rules, is read with ReadClassBuffer() instead.
+
+void WriteFastStreamer(const ROOT::TMetaUtils::AnnotatedRecordDecl &cl,
+                       const cling::Interpreter &interp,
+                       const ROOT::TMetaUtils::TNormalizedCtxt &normCtxt,
+                       std::ostream &dictStream)
+{
+   const clang::CXXRecordDecl *clxx = llvm::dyn_cast<clang::CXXRecordDecl>(cl.GetRecordDecl());
+   if (clxx == nullptr) return;
+
+   std::string reason;
+   if (!ROOT::TMetaUtils::CanGenerateFastStreamer(clxx, interp, &reason)) {
+      ROOT::TMetaUtils::Warning(nullptr, "Option faststreamer ignored for class %s: %s\n",
+                                cl.GetNormalizedName(), reason.c_str());
+      WriteAutoStreamer(cl, interp, normCtxt, dictStream);
+      return;
+   }
+
+   bool add_template_keyword = ROOT::TMetaUtils::NeedTemplateKeyword(clxx);
+
+   string fullname;
+   string clsname;
+   string nsname;
+   int enclSpaceNesting = 0;
+
+   if (ROOT::TMetaUtils::GetNameWithinNamespace(fullname, clsname, nsname, clxx)) {
+      enclSpaceNesting = ROOT::TMetaUtils::WriteNamespaceHeader(dictStream, cl);
+   }
+
+   const std::string classExpr = fullname + "::Class()";
+   dictStream << "//_______________________________________"
+              << "_______________________________________" << std::endl;
+   if (add_template_keyword) dictStream << "template <> ";
+   dictStream << "void " << clsname << "::Streamer(TBuffer &R__b)" << std::endl
+              << "{" << std::endl
+              << "   // Stream an object of class " << fullname << "." << std::endl << std::endl
+              << "   UInt_t R__s, R__c;" << std::endl;
+
+   for (int i = 0; i < 2; i++) {
+      const bool reading = (i == 0);
+      if (reading) {
+         dictStream << "   if (R__b.IsReading()) {" << std::endl
+                    << "      Version_t R__v = R__b.ReadVersion(&R__s, &R__c, " << classExpr << ");" << std::endl
+                    << "      if (!" << classExpr << "->IsFastStreamerCompatible(R__v)) {" << std::endl
+                    << "         R__b.ReadClassBuffer(" << classExpr << ", this, R__v, R__s, R__c);" << std::endl
+                    << "         return;" << std::endl
+                    << "      }" << std::endl;
+      } else {
+         dictStream << "      R__b.CheckByteCount(R__s, R__c, " << classExpr << ");" << std::endl
+                    << "   } else {" << std::endl
+                    << "      if (!" << classExpr << "->IsFastStreamerCompatible(" << fullname
+                    << "::Class_Version())) {" << std::endl
+                    << "         R__b.WriteClassBuffer(" << classExpr << ", this);" << std::endl
+                    << "         return;" << std::endl
+                    << "      }" << std::endl
+                    << "      R__c = R__b.WriteVersion(" << classExpr << ", kTRUE);" << std::endl
+                    << "      R__b.TagStreamerInfo(" << classExpr << "->GetStreamerInfo());" << std::endl;
+      }
+
+      // The base classes come first in the StreamerInfo, then the data members in declaration order.
+      for (const auto &base : clxx->bases()) {
+         string base_fullname;
+         ROOT::TMetaUtils::GetQualifiedName(base_fullname, *base.getType()->getAsCXXRecordDecl());
+         dictStream << "      " << base_fullname << "::Streamer(R__b);" << std::endl;
+      }
+      for (const clang::FieldDecl *field : clxx->fields()) {
+         const char *comment = ROOT::TMetaUtils::GetComment(*field).data();
+         if (comment && comment[0] == '!')
+            continue;
+         const std::string name = field->getName().str();
+         clang::QualType type = field->getType();
+         if (const clang::ConstantArrayType *arrayType = llvm::dyn_cast<clang::ConstantArrayType>(type.getTypePtr())) {
+            const size_t len = GetFullArrayLength(arrayType);
+            while (const clang::ConstantArrayType *subArray =
+                      llvm::dyn_cast<clang::ConstantArrayType>(arrayType->getArrayElementTypeNoTypeQual()))
+               arrayType = subArray;
+            const char *elementType = ROOT::TMetaUtils::GetFastStreamerTypeName(arrayType->getElementType());
+            dictStream << "      R__b." << (reading ? "ReadFastArray" : "WriteFastArray") << "(reinterpret_cast<"
+                       << elementType << " *>(" << name << "), " << len << ");" << std::endl;
+         } else if (llvm::isa<clang::EnumType>(type.getCanonicalType().getTypePtr())) {
+            if (reading)
+               dictStream << "      { Int_t R__e; R__b >> R__e; " << name << " = static_cast<decltype(" << name
+                          << ")>(R__e); }" << std::endl;
+            else
+               dictStream << "      R__b << static_cast<Int_t>(" << name << ");" << std::endl;
+         } else {
+            dictStream << "      R__b " << (reading ? ">> " : "<< ") << name << ";" << std::endl;
+         }
+      }
+   }
+   dictStream << "      R__b.SetByteCount(R__c, kTRUE);" << std::endl
+              << "   }" << std::endl
+              << "}" << std::endl << std::endl;
+
+   while (enclSpaceNesting) {
+      dictStream << "} // namespace " << nsname << std::endl;
+      --enclSpaceNesting;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 void CallWriteStreamer(const ROOT::TMetaUtils::AnnotatedRecordDecl &cl,
@@ -1837,7 +1951,9 @@ void CallWriteStreamer(const ROOT::TMetaUtils::AnnotatedRecordDecl &cl,
                        std::ostream &dictStream,
                        bool isAutoStreamer)
 {
-   if (isAutoStreamer) {
+   if (isAutoStreamer && cl.RequestFastStreamer()) {
+      WriteFastStreamer(cl, interp, normCtxt, dictStream);
+   } else if (isAutoStreamer) {
       WriteAutoStreamer(cl, interp, normCtxt, dictStream);
    } else {
       WriteStreamer(cl, interp, normCtxt, dictStream);
@@ -2983,6 +3099,12 @@ public:
 
    /////////////////////////////////////////////////////////////////////////////
 
+   const std::vector<std::string> &getFileNames() const {
+      return m_names;
+   }
+
+   /////////////////////////////////////////////////////////////////////////////
+
    const std::string &getFileName(const std::string &tmpFileName) {
       size_t i = std::distance(m_tempNames.begin(),
                                find(m_tempNames.begin(), m_tempNames.end(), tmpFileName));
@@ -3807,6 +3929,10 @@ static llvm::cl::opt<bool>
 gOptNoIncludePaths("noIncludePaths",
                   llvm::cl::desc("Do not store include paths but rely on the env variable ROOT_INCLUDE_PATH."),
                   llvm::cl::cat(gRootclingOptions));
+static llvm::cl::opt<bool>
+gOptIncremental("incremental",
+                llvm::cl::desc("Skip the generation if neither the arguments nor the content of the files read changed."),
+                llvm::cl::cat(gRootclingOptions));
 static llvm::cl::opt<std::string>
 gOptISysRoot("isysroot", llvm::cl::Prefix, llvm::cl::Hidden,
             llvm::cl::desc("Specify an isysroot."),
@@ -4002,6 +4128,130 @@ static llvm::StringRef GetModuleNameFromRdictName(llvm::StringRef rdictName)
    return moduleName;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Hash of the arguments of a rootcling invocation, the executable excepted.
+
+static uint64_t GetArgumentsHash(int argc, char **argv)
+{
+   std::string args;
+   for (int i = 1; i < argc; ++i) {
+      args += argv[i];
+      args += '\0';
+   }
+   return llvm::xxHash64(args);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Hash of the content of a file, false if it cannot be read.
+
+static bool GetContentHash(const std::string &fileName, uint64_t &hash)
+{
+   auto buffer = llvm::MemoryBuffer::getFile(fileName);
+   if (!buffer)
+      return false;
+   hash = llvm::xxHash64((*buffer)->getBuffer());
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Check, for -incremental, whether the dictionary recorded in inputsFileName
+/// was generated with the same arguments from files with the same content.
+/// If so, touch its outputs to let the build system know they are up to date.
+///
+/// The file has one line per item:
+///
+///     args <hash of the arguments>
+///     input <hash of the content> <file name>
+///     output <file name>
+
+static bool IsDictionaryUpToDate(const std::string &inputsFileName, int argc, char **argv)
+{
+   std::ifstream inputs(inputsFileName);
+   if (!inputs)
+      return false;
+
+   std::vector<std::string> outputs;
+   bool argsChecked = false;
+   std::string line;
+   while (std::getline(inputs, line)) {
+      std::istringstream fields(line);
+      std::string kind;
+      uint64_t hash = 0;
+      fields >> kind;
+      if (kind == "args") {
+         fields >> std::hex >> hash;
+         if (hash != GetArgumentsHash(argc, argv))
+            return false;
+         argsChecked = true;
+      } else if (kind == "input") {
+         std::string fileName;
+         fields >> std::hex >> hash >> std::ws;
+         std::getline(fields, fileName);
+         uint64_t currentHash = 0;
+         if (!GetContentHash(fileName, currentHash) || currentHash != hash)
+            return false;
+      } else if (kind == "output") {
+         std::string fileName;
+         fields >> std::ws;
+         std::getline(fields, fileName);
+         if (!llvm::sys::fs::exists(fileName))
+            return false;
+         outputs.emplace_back(fileName);
+      } else {
+         return false;
+      }
+   }
+   if (!argsChecked)
+      return false;
+
+   outputs.emplace_back(inputsFileName);
+   const auto now = std::chrono::system_clock::now();
+   for (const auto &output : outputs) {
+      int fd = -1;
+      if (llvm::sys::fs::openFileForWrite(output, fd, llvm::sys::fs::CD_OpenExisting, llvm::sys::fs::OF_Append))
+         return false;
+      llvm::sys::fs::setLastAccessAndModificationTime(fd, now);
+      llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+   }
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Record, for -incremental, the arguments, the files read (headers and C++
+/// modules) and the outputs of a successful dictionary generation.
+
+static void WriteDictionaryInputs(const std::string &inputsFileName, int argc, char **argv,
+                                  clang::CompilerInstance &CI, const std::vector<std::string> &outputs)
+{
+   std::set<std::string> inputFiles;
+   const clang::SourceManager &SM = CI.getSourceManager();
+   for (auto it = SM.fileinfo_begin(), end = SM.fileinfo_end(); it != end; ++it) {
+      llvm::StringRef name = it->first->tryGetRealPathName();
+      if (!name.empty())
+         inputFiles.insert(name.str());
+   }
+   if (auto reader = CI.getASTReader()) {
+      for (const clang::serialization::ModuleFile &moduleFile : reader->getModuleManager())
+         inputFiles.insert(moduleFile.FileName);
+   }
+
+   std::ofstream out(inputsFileName);
+   out << "args " << std::hex << GetArgumentsHash(argc, argv) << '\n';
+   for (const auto &fileName : inputFiles) {
+      uint64_t hash = 0;
+      // Skip the files which disappeared, e.g. temporary ones.
+      if (GetContentHash(fileName, hash))
+         out << "input " << hash << ' ' << fileName << '\n';
+   }
+   for (const auto &fileName : outputs) {
+      if (llvm::sys::fs::exists(fileName))
+         out << "output " << fileName << '\n';
+   }
+   if (!out)
+      ROOT::TMetaUtils::Warning(nullptr, "Cannot write %s, the next generation will not be incremental.\n",
+                                inputsFileName.c_str());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 int RootClingMain(int argc,
@@ -4077,6 +4327,17 @@ int RootClingMain(int argc,
       return interp->getDiagnostics().hasFatalErrorOccurred();
    }
 
+   // The dictionary file name is changed into a temporary one below.
+   const std::string dictInputsFileName = gOptDictionaryFileName + ".inputs";
+   if (gOptIncremental) {
+      if (IsDictionaryUpToDate(dictInputsFileName, argc, argv)) {
+         ROOT::TMetaUtils::Info(nullptr, "%s is up to date.\n", gOptDictionaryFileName.c_str());
+         return 0;
+      }
+      // Do not leave stale information, in case of failure.
+      llvm::sys::fs::remove(dictInputsFileName);
+   }
+
    std::string dictname;
 
    if (!gDriverConfig->fBuildingROOTStage1) {
@@ -5132,6 +5393,12 @@ int RootClingMain(int argc,
       tmpCatalog.clean();
    }
 
+   if (rootclingRetCode == 0 && gOptIncremental) {
+      std::vector<std::string> outputs = tmpCatalog.getFileNames();
+      outputs.push_back(modGen.GetModuleFileName());
+      WriteDictionaryInputs(dictInputsFileName, argc, argv, *CI, outputs);
+   }
+
    return rootclingRetCode;
 
 }
@@ -6156,6 +6423,88 @@ int GenReflexMain(int argc, char **argv)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Run the rootcling invocations listed in a file, one per line, in parallel
+/// child processes: `rootcling -batch <file> [-j <N>]`.
+/// Returns the number of failed invocations.
+
+static int RootClingBatch(int argc, char **argv)
+{
+   if (argc != 3 && !(argc == 5 && strcmp(argv[3], "-j") == 0)) {
+      ROOT::TMetaUtils::Error(nullptr, "Usage: %s -batch <file> [-j <N>]\n", argv[0]);
+      return 1;
+   }
+   unsigned maxJobs = argc == 5 ? std::atoi(argv[4]) : std::thread::hardware_concurrency();
+   if (maxJobs == 0)
+      maxJobs = 1;
+
+   auto buffer = llvm::MemoryBuffer::getFile(argv[2]);
+   if (!buffer) {
+      ROOT::TMetaUtils::Error(nullptr, "Cannot read the batch file %s\n", argv[2]);
+      return 1;
+   }
+
+   // Each line is tokenized as a shell would do, quotes included.
+   llvm::BumpPtrAllocator allocator;
+   llvm::StringSaver saver(allocator);
+   std::vector<std::vector<llvm::StringRef>> invocations;
+   const std::string executable = GetExePath();
+   llvm::SmallVector<llvm::StringRef, 16> lines;
+   (*buffer)->getBuffer().split(lines, '\n', /*MaxSplit*/ -1, /*KeepEmpty*/ false);
+   for (llvm::StringRef line : lines) {
+      llvm::SmallVector<const char *, 32> args;
+      llvm::cl::TokenizeGNUCommandLine(line, saver, args);
+      if (args.empty())
+         continue;
+      invocations.emplace_back(1, executable);
+      invocations.back().insert(invocations.back().end(), args.begin(), args.end());
+   }
+
+   struct Job {
+      llvm::sys::ProcessInfo fProcess;
+      size_t fInvocation;
+   };
+   std::vector<Job> running;
+   size_t next = 0;
+   int failures = 0;
+   auto reportFailure = [&](size_t invocation, const std::string &reason) {
+      std::string cmd;
+      for (auto arg : invocations[invocation])
+         cmd += " " + arg.str();
+      ROOT::TMetaUtils::Error(nullptr, "Failed (%s):%s\n", reason.c_str(), cmd.c_str());
+      ++failures;
+   };
+   while (next < invocations.size() || !running.empty()) {
+      while (next < invocations.size() && running.size() < maxJobs) {
+         std::string errMsg;
+         bool execFailed = false;
+         auto process = llvm::sys::ExecuteNoWait(executable, invocations[next], llvm::None, {}, 0, &errMsg,
+                                                 &execFailed);
+         if (execFailed)
+            reportFailure(next, errMsg);
+         else
+            running.push_back({process, next});
+         ++next;
+      }
+      bool finished = false;
+      for (auto it = running.begin(); it != running.end();) {
+         std::string errMsg;
+         auto status = llvm::sys::Wait(it->fProcess, 0, /*WaitUntilTerminates*/ false, &errMsg);
+         if (status.Pid == 0) {
+            ++it;
+            continue;
+         }
+         if (status.ReturnCode != 0)
+            reportFailure(it->fInvocation, errMsg.empty() ? "exit code " + std::to_string(status.ReturnCode) : errMsg);
+         it = running.erase(it);
+         finished = true;
+      }
+      if (!finished && !running.empty())
+         std::this_thread::sleep_for(std::chrono::milliseconds(10));
+   }
+   return failures;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 extern "C"
@@ -6184,6 +6533,8 @@ int ROOT_rootcling_Driver(int argc, char **argv, const ROOT::Internal::RootCling
 
    if (std::string::npos != exeName.find("genreflex"))
       retVal = GenReflexMain(argc, argv);
+   else if (argc > 1 && strcmp(argv[1], "-batch") == 0)
+      retVal = RootClingBatch(argc, argv) ? 1 : 0;
    else // rootcling or default
       retVal = RootClingMain(argc, argv);
 
@@ -9,6 +9,7 @@
 #ifdef R__USE_IMT
 #pragma link C++ class ROOT::TThreadExecutor-;
 #pragma link C++ class ROOT::Experimental::TTaskGroup-;
+#pragma link C++ class ROOT::Experimental::RTaskGraph-;
 #endif
 
 #endif
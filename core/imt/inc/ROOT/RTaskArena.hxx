@@ -25,6 +25,7 @@
 
 #include "RConfigure.h"
 #include <memory>
+#include <vector>
 
 // exclude in case ROOT does not have IMT support
 #ifndef R__USE_IMT
@@ -53,6 +54,13 @@ namespace Internal {
 ////////////////////////////////////////////////////////////////////////////////
 int LogicalCPUBandwidthControl();
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns whether the work of TThreadExecutor should be split among one task
+/// arena per NUMA node, as requested by the environment variable
+/// `ROOT_NUMA_ARENAS`.
+////////////////////////////////////////////////////////////////////////////////
+bool NumaArenasRequested();
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Wrapper for tbb::task_arena.
@@ -65,10 +73,15 @@ public:
    ~RTaskArenaWrapper(); // necessary to set size back to zero
    static unsigned TaskArenaSize(); // A static getter lets us check for RTaskArenaWrapper's existence
    ROOT::ROpaqueTaskArena &Access();
+   /// Number of task arenas bound to a NUMA node, 0 unless `ROOT_NUMA_ARENAS` is set on a NUMA machine
+   unsigned GetNNumaArenas() const { return fNumaArenas.size(); }
+   ROOT::ROpaqueTaskArena &AccessNumaArena(unsigned i);
 private:
    RTaskArenaWrapper(unsigned maxConcurrency = 0);
+   void InitializeNumaArenas(unsigned maxConcurrency);
    friend std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> GetGlobalTaskArena(unsigned maxConcurrency);
    std::unique_ptr<ROOT::ROpaqueTaskArena> fTBBArena;
+   std::vector<std::unique_ptr<ROOT::ROpaqueTaskArena>> fNumaArenas; ///< one arena per NUMA node, by default none
    static unsigned fNWorkers;
 };
 
@@ -0,0 +1,60 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RTaskGraph
+#define ROOT_RTaskGraph
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+namespace Internal {
+struct RTaskGraphState;
+}
+
+class RTaskGraph {
+   /**
+   \class ROOT::Experimental::RTaskGraph
+   \ingroup Parallelism
+   \brief A graph of tasks with dependencies, executed by the threads of ROOT's task arena.
+
+   A task starts as soon as all the tasks it depends on are completed. Tasks may be added while the graph is
+   executing, also by the tasks of the graph themselves, e.g. to schedule a pipeline stage for the data they produced.
+   */
+public:
+   using TaskId_t = std::size_t;
+
+   /// Among the tasks ready to run, those with a higher priority are started first
+   enum class EPriority { kLow = 0, kNormal, kHigh };
+
+private:
+   std::unique_ptr<Internal::RTaskGraphState> fState;
+
+public:
+   RTaskGraph();
+   RTaskGraph(const RTaskGraph &) = delete;
+   RTaskGraph &operator=(const RTaskGraph &) = delete;
+   ~RTaskGraph();
+
+   TaskId_t AddTask(const std::function<void(void)> &task, const std::vector<TaskId_t> &dependencies = {},
+                    EPriority priority = EPriority::kNormal);
+   void Wait();
+   std::size_t GetNTasks() const;
+   bool IsParallel() const;
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
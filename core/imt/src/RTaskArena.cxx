@@ -7,6 +7,8 @@
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TThread.h"
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
 #include <mutex>
 #include <string>
@@ -14,6 +16,14 @@
 #include "tbb/task_arena.h"
 #define TBB_PREVIEW_GLOBAL_CONTROL 1 // required for TBB versions preceding 2019_U4
 #include "tbb/global_control.h"
+#if __has_include("tbb/version.h") // oneTBB, for older versions tbb_stddef.h defines the version
+#include "tbb/version.h"
+#endif
+#if defined(TBB_VERSION_MAJOR) && TBB_VERSION_MAJOR >= 2021
+// task arenas constrained to a NUMA node, their threads are pinned to the cores of the node
+#include "tbb/info.h"
+#define R__HAS_TBB_NUMA_ARENAS
+#endif
 
 //////////////////////////////////////////////////////////////////////////
 ///
@@ -40,6 +50,16 @@
 /// root[] gTA->Access().max_concurrency() // call to tbb::task_arena::max_concurrency()
 /// ~~~
 ///
+/// If the environment variable `ROOT_NUMA_ARENAS` is set to a non-zero value
+/// on a machine with several NUMA nodes, the wrapper also creates one arena
+/// per node, whose threads are pinned to the cores of the node, and the
+/// arena threads are shared among the nodes in proportion to their cores.
+/// TThreadExecutor::Foreach then splits its iterations among these arenas,
+/// such that the data allocated by a task, e.g. the per-slot copies of
+/// TThreadedObject or of the RDataFrame results, which are created by the
+/// thread that first uses them, stay local to the node that processes them.
+/// This requires oneTBB with its hwloc-based tbbbind library.
+///
 //////////////////////////////////////////////////////////////////////////
 
 namespace ROOT {
@@ -90,6 +110,12 @@ int LogicalCPUBandwidthControl()
 /// * If no BC in place and maxConcurrency<1, defaults to the default tbb number of threads,
 /// which is CPU affinity aware
 ////////////////////////////////////////////////////////////////////////////////
+bool NumaArenasRequested()
+{
+   const char *env = gSystem->Getenv("ROOT_NUMA_ARENAS");
+   return env && std::strtol(env, nullptr, 0) != 0;
+}
+
 RTaskArenaWrapper::RTaskArenaWrapper(unsigned maxConcurrency) : fTBBArena(new ROpaqueTaskArena{})
 {
    const unsigned tbbDefaultNumberThreads = fTBBArena->max_concurrency(); // not initialized, automatic state
@@ -105,9 +131,48 @@ RTaskArenaWrapper::RTaskArenaWrapper(unsigned maxConcurrency) : fTBBArena(new RO
    }
    fTBBArena->initialize(maxConcurrency);
    fNWorkers = maxConcurrency;
+   if (NumaArenasRequested())
+      InitializeNumaArenas(maxConcurrency);
    ROOT::EnableThreadSafety();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Create one arena per NUMA node, sharing the maxConcurrency threads in
+/// proportion to the number of cores of each node; nothing is done on a
+/// machine with one node or if the nodes cannot get at least one thread each.
+void RTaskArenaWrapper::InitializeNumaArenas(unsigned maxConcurrency)
+{
+#ifdef R__HAS_TBB_NUMA_ARENAS
+   const std::vector<tbb::numa_node_id> nodes = tbb::info::numa_nodes();
+   if (nodes.size() < 2 || maxConcurrency < nodes.size())
+      return;
+   std::vector<unsigned> nodeCores;
+   unsigned nCores = 0;
+   for (auto node : nodes) {
+      nodeCores.push_back(std::max(1, tbb::info::default_concurrency(node)));
+      nCores += nodeCores.back();
+   }
+   // at least one thread per node, the others in proportion to the cores, the total being maxConcurrency
+   std::vector<unsigned> nodeThreads(nodes.size(), 1);
+   unsigned assigned = nodes.size();
+   for (std::size_t i = 0; i < nodes.size(); ++i) {
+      const unsigned share = static_cast<unsigned>(static_cast<unsigned long>(maxConcurrency) * nodeCores[i] / nCores);
+      const unsigned extra = std::min(share > 0 ? share - 1 : 0u, maxConcurrency - assigned);
+      nodeThreads[i] += extra;
+      assigned += extra;
+   }
+   for (std::size_t i = 0; assigned < maxConcurrency; i = (i + 1) % nodes.size(), ++assigned)
+      ++nodeThreads[i];
+   for (std::size_t i = 0; i < nodes.size(); ++i) {
+      fNumaArenas.emplace_back(new ROpaqueTaskArena{});
+      fNumaArenas.back()->initialize(tbb::task_arena::constraints(nodes[i], nodeThreads[i]));
+   }
+#else
+   (void)maxConcurrency;
+   Warning("RTaskArenaWrapper", "ROOT_NUMA_ARENAS is set but the TBB version does not support NUMA arenas, ignoring.");
+#endif
+}
+
 RTaskArenaWrapper::~RTaskArenaWrapper()
 {
    fNWorkers = 0u;
@@ -127,6 +192,11 @@ ROOT::ROpaqueTaskArena &RTaskArenaWrapper::Access()
    return *fTBBArena;
 }
 
+ROOT::ROpaqueTaskArena &RTaskArenaWrapper::AccessNumaArena(unsigned i)
+{
+   return *fNumaArenas[i];
+}
+
 std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> GetGlobalTaskArena(unsigned maxConcurrency)
 {
    static std::weak_ptr<ROOT::Internal::RTaskArenaWrapper> weak_GTAWrapper;
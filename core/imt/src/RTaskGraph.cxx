@@ -0,0 +1,273 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RConfigure.h"
+
+#include "ROOT/RTaskGraph.hxx"
+
+#ifdef R__USE_IMT
+#include "TROOT.h"
+#include "ROOT/RTaskArena.hxx"
+#include "ROpaqueTaskArena.hxx"
+#include "tbb/task_group.h"
+#endif
+
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+/**
+\class ROOT::Experimental::RTaskGraph
+\ingroup Parallelism
+\brief A graph of tasks with dependencies, executed by the threads of ROOT's task arena.
+
+Each task is added with the list of the tasks it depends on, which must have been added before, such that the graph
+has no cycles. A task is started as soon as all its dependencies are completed; among the tasks ready to run, those
+with a higher priority are started first. The tasks are executed by the threads of the global task arena which also
+runs the TThreadExecutor and TTaskGroup work, so that several subsystems can share the threads of the process instead
+of each running its own:
+
+~~~{.cpp}
+ROOT::EnableImplicitMT();
+ROOT::Experimental::RTaskGraph graph;
+for (auto &cluster : clusters) {
+   auto read = graph.AddTask([&] { cluster.ReadPages(); }, {}, RTaskGraph::EPriority::kHigh);
+   auto unzip = graph.AddTask([&] { cluster.Unzip(); }, {read});
+   graph.AddTask([&] { cluster.Process(); }, {unzip});
+}
+graph.Wait();
+~~~
+
+Tasks may be added at any time, also by the tasks of the graph: a task depending on tasks that are already
+completed is ready right away. Wait() blocks until all the tasks added so far, and those they add, are completed.
+If a task throws, the tasks that depend on it, directly or not, are not executed, and Wait() rethrows the first
+exception.
+
+If implicit multi-threading is not enabled when the graph is created, the tasks are executed in the thread calling
+Wait(), in the order of their dependencies and priorities.
+*/
+
+namespace ROOT {
+namespace Experimental {
+namespace Internal {
+
+struct RTaskGraphState {
+   struct RTask {
+      std::function<void(void)> fFunc;
+      std::vector<RTaskGraph::TaskId_t> fSuccessors; ///< tasks which depend on this one
+      std::size_t fNPending = 0;                     ///< number of dependencies not completed yet
+      RTaskGraph::EPriority fPriority = RTaskGraph::EPriority::kNormal;
+      bool fDone = false;
+      bool fFailed = false; ///< the task, or one of its dependencies, threw an exception
+   };
+
+   static constexpr int kNPriorities = static_cast<int>(RTaskGraph::EPriority::kHigh) + 1;
+
+   std::mutex fMutex;
+   std::deque<RTask> fTasks;                           ///< the elements of a deque keep their address on push_back
+   std::deque<RTaskGraph::TaskId_t> fReady[kNPriorities]; ///< tasks ready to run, by priority
+   std::exception_ptr fException;                      ///< first exception thrown by a task
+#ifdef R__USE_IMT
+   std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> fArena; ///< null unless implicit MT is enabled
+   tbb::task_group fGroup;
+#endif
+
+   /// Queue a task which has no pending dependencies; must be called with the lock held
+   void MakeReady(RTaskGraph::TaskId_t id) { fReady[static_cast<int>(fTasks[id].fPriority)].push_back(id); }
+
+   /// Pop the ready task with the highest priority, return false if there is none
+   bool PopReady(RTaskGraph::TaskId_t &id)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      for (int p = kNPriorities - 1; p >= 0; --p) {
+         if (!fReady[p].empty()) {
+            id = fReady[p].front();
+            fReady[p].pop_front();
+            return true;
+         }
+      }
+      return false;
+   }
+
+   /// Start n arena tasks, each of which runs the ready task with the highest priority at the time it starts
+   void Spawn(std::size_t n)
+   {
+#ifdef R__USE_IMT
+      if (!fArena || n == 0)
+         return;
+      fArena->Access().execute([this, n] {
+         for (std::size_t i = 0; i < n; ++i)
+            fGroup.run([this] { RunNext(); });
+      });
+#else
+      (void)n;
+#endif
+   }
+
+   void RunNext()
+   {
+      RTaskGraph::TaskId_t id;
+      if (PopReady(id))
+         Execute(id);
+   }
+
+   /// Run a ready task, then release the tasks which depend on it
+   void Execute(RTaskGraph::TaskId_t id)
+   {
+      RTask *task;
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         task = &fTasks[id];
+      }
+      bool failed = task->fFailed;
+      if (!failed) {
+         try {
+            task->fFunc();
+         } catch (...) {
+            failed = true;
+            std::lock_guard<std::mutex> lock(fMutex);
+            if (!fException)
+               fException = std::current_exception();
+         }
+      }
+      // release the resources captured by the task
+      task->fFunc = nullptr;
+
+      std::size_t nReady = 0;
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         task->fDone = true;
+         task->fFailed = failed;
+         for (auto s : task->fSuccessors) {
+            auto &successor = fTasks[s];
+            successor.fFailed |= failed;
+            if (--successor.fNPending == 0) {
+               MakeReady(s);
+               ++nReady;
+            }
+         }
+         task->fSuccessors.clear();
+      }
+      Spawn(nReady);
+   }
+
+   /// Wait for the completion of all the tasks, without rethrowing their exceptions
+   void WaitAll()
+   {
+#ifdef R__USE_IMT
+      if (fArena) {
+         fArena->Access().execute([this] { fGroup.wait(); });
+         return;
+      }
+#endif
+      RTaskGraph::TaskId_t id;
+      while (PopReady(id))
+         Execute(id);
+   }
+};
+
+} // namespace Internal
+
+RTaskGraph::RTaskGraph() : fState(new Internal::RTaskGraphState())
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled())
+      fState->fArena = ROOT::Internal::GetGlobalTaskArena();
+#endif
+}
+
+RTaskGraph::~RTaskGraph()
+{
+   fState->WaitAll();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+/// Add a task to the graph and return its identifier.
+/// \param[in] task the function to execute
+/// \param[in] dependencies the identifiers of the tasks that must be completed before this one starts; they must
+///            have been returned by previous calls of AddTask
+/// \param[in] priority the priority of the task among the tasks ready to run
+///
+/// The task is started right away if all its dependencies are completed. This method can be called concurrently,
+/// also by the tasks of the graph.
+RTaskGraph::TaskId_t
+RTaskGraph::AddTask(const std::function<void(void)> &task, const std::vector<TaskId_t> &dependencies,
+                    EPriority priority)
+{
+   TaskId_t id;
+   bool ready;
+   {
+      std::lock_guard<std::mutex> lock(fState->fMutex);
+      id = fState->fTasks.size();
+      for (auto d : dependencies) {
+         if (d >= id)
+            throw std::invalid_argument("RTaskGraph::AddTask: unknown dependency " + std::to_string(d));
+      }
+      fState->fTasks.emplace_back();
+      auto &t = fState->fTasks.back();
+      t.fFunc = task;
+      t.fPriority = priority;
+      for (auto d : dependencies) {
+         auto &dependency = fState->fTasks[d];
+         if (dependency.fDone) {
+            t.fFailed |= dependency.fFailed;
+         } else {
+            dependency.fSuccessors.push_back(id);
+            ++t.fNPending;
+         }
+      }
+      ready = t.fNPending == 0;
+      if (ready)
+         fState->MakeReady(id);
+   }
+   if (ready)
+      fState->Spawn(1);
+   return id;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+/// Wait until all the tasks of the graph are completed, including those added in the meantime. If tasks threw
+/// exceptions, rethrow the first one. This method must not be called by the tasks of the graph.
+void RTaskGraph::Wait()
+{
+   fState->WaitAll();
+   std::exception_ptr e;
+   {
+      std::lock_guard<std::mutex> lock(fState->fMutex);
+      std::swap(e, fState->fException);
+   }
+   if (e)
+      std::rethrow_exception(e);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+/// Return the number of tasks added to the graph since its creation.
+std::size_t RTaskGraph::GetNTasks() const
+{
+   std::lock_guard<std::mutex> lock(fState->fMutex);
+   return fState->fTasks.size();
+}
+
+/////////////////////////////////////////////////////////////////////////////
+/// Return whether the tasks are executed by the threads of the task arena, i.e. whether implicit multi-threading
+/// was enabled when the graph was created.
+bool RTaskGraph::IsParallel() const
+{
+#ifdef R__USE_IMT
+   return fState->fArena != nullptr;
+#else
+   return false;
+#endif
+}
+
+} // namespace Experimental
+} // namespace ROOT
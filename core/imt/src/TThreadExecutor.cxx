@@ -2,7 +2,12 @@
 #define TBB_USE_CAPTURED_EXCEPTION 0
 
 #include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/RMetricsRegistry.hxx"
+#include "ROOT/RTaskArena.hxx"
+#include "ROOT/RTraceRecorder.hxx"
 #include "ROpaqueTaskArena.hxx"
+
+#include <chrono>
 #if !defined(_MSC_VER)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wshadow"
@@ -137,6 +142,69 @@ static T ParallelReduceHelper(const std::vector<T> &objs, const std::function<T(
 
 } // End NS Internal
 
+namespace {
+/// The NUMA arena running the current iteration of a ParallelFor, if any
+thread_local ROOT::ROpaqueTaskArena *gCurrentNumaArena = nullptr;
+
+struct RNumaArenaScope {
+   ROOT::ROpaqueTaskArena *fPrevious;
+   RNumaArenaScope(ROOT::ROpaqueTaskArena *arena) : fPrevious(gCurrentNumaArena) { gCurrentNumaArena = arena; }
+   ~RNumaArenaScope() { gCurrentNumaArena = fPrevious; }
+};
+
+/// Nesting level of the ParallelFor iterations running in the current thread
+thread_local unsigned gTaskDepth = 0;
+
+/// Account for an iteration of a ParallelFor in the process-wide metrics. Iterations of nested loops are only counted
+/// as part of the outermost one, so that the busy workers and busy time are not counted twice.
+struct RTaskMetricsScope {
+   std::chrono::steady_clock::time_point fStart;
+
+   static ROOT::Experimental::RMetric &BusyWorkers()
+   {
+      static auto &m = ROOT::Experimental::RMetricsRegistry::Instance().GetMetric(
+         "root_imt_busy_workers", "Threads running TThreadExecutor tasks", ROOT::Experimental::RMetric::EKind::kGauge);
+      return m;
+   }
+
+   RTaskMetricsScope()
+   {
+      if (gTaskDepth++ > 0)
+         return;
+      BusyWorkers().Inc();
+      fStart = std::chrono::steady_clock::now();
+   }
+
+   ~RTaskMetricsScope()
+   {
+      if (--gTaskDepth > 0)
+         return;
+      using ROOT::Experimental::RMetric;
+      using ROOT::Experimental::RMetricsRegistry;
+      static auto &tasks = RMetricsRegistry::Instance().GetMetric("root_imt_tasks", "TThreadExecutor tasks run");
+      static auto &busyTime = RMetricsRegistry::Instance().GetMetric(
+         "root_imt_busy_seconds", "Time spent by the threads running TThreadExecutor tasks", RMetric::EKind::kCounter,
+         "seconds", 1e-9);
+      busyTime.Add(
+         std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - fStart).count());
+      tasks.Inc();
+      BusyWorkers().Dec();
+   }
+};
+
+/// Export the size of the thread pool, to relate the busy time to the available threads
+struct RPoolMetricsCollector {
+   RPoolMetricsCollector()
+   {
+      ROOT::Experimental::RMetricsRegistry::Instance().AddCollector([](auto &samples) {
+         samples.push_back({"root_imt_pool_size", "Number of threads of ROOT's thread pool",
+                            ROOT::Experimental::RMetric::EKind::kGauge, "",
+                            double(ROOT::Internal::RTaskArenaWrapper::TaskArenaSize())});
+      });
+   }
+} gPoolMetricsCollector;
+} // anonymous namespace
+
 //////////////////////////////////////////////////////////////////////////
 /// \brief Class constructor.
 /// If the scheduler is active (e.g. because another TThreadExecutor is in flight, or ROOT::EnableImplicitMT() was
@@ -158,20 +226,80 @@ TThreadExecutor::TThreadExecutor(UInt_t nThreads)
 /// \param end End index of the loop.
 /// \param step Step size of the loop.
 /// \param f function to execute.
+///
+/// If the task arena has one arena per NUMA node (see RTaskArenaWrapper), the
+/// iterations are split in contiguous ranges processed by the threads of each
+/// node, and the loops nested in an iteration stay on its node.
 void TThreadExecutor::ParallelFor(unsigned start, unsigned end, unsigned step,
-                                  const std::function<void(unsigned int i)> &f)
+                                  const std::function<void(unsigned int i)> &userFunc)
 {
+   // with the metrics enabled, account for the tasks and the time the workers spend running them
+   std::function<void(unsigned int i)> countingFunc;
+   if (ROOT::Experimental::RMetricsRegistry::IsEnabled())
+      countingFunc = [&userFunc](unsigned int i) {
+         RTaskMetricsScope scope;
+         R__TRACE_SCOPE_ARG("imt", "ParallelFor task", "index", i);
+         userFunc(i);
+      };
+#ifdef R__HAS_TRACING
+   else if (ROOT::Experimental::RTraceRecorder::IsEnabled())
+      countingFunc = [&userFunc](unsigned int i) {
+         R__TRACE_SCOPE_ARG("imt", "ParallelFor task", "index", i);
+         userFunc(i);
+      };
+#endif
+   const auto &f = countingFunc ? countingFunc : userFunc;
+
    if (GetPoolSize() > tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism)) {
       Warning("TThreadExecutor::ParallelFor",
               "tbb::global_control is limiting the number of parallel workers."
               " Proceeding with %zu threads this time",
               tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism));
    }
-   fTaskArenaW->Access().execute([&] {
-      tbb::this_task_arena::isolate([&] {
-         tbb::parallel_for(start, end, step, f);
+   if (gCurrentNumaArena) {
+      // nested in an iteration running in a NUMA arena: stay on its node
+      tbb::this_task_arena::isolate([&] { tbb::parallel_for(start, end, step, f); });
+      return;
+   }
+   const unsigned nArenas = fTaskArenaW->GetNNumaArenas();
+   if (nArenas == 0 || step == 0 || start >= end) {
+      fTaskArenaW->Access().execute([&] {
+         tbb::this_task_arena::isolate([&] {
+            tbb::parallel_for(start, end, step, f);
+         });
       });
-   });
+      return;
+   }
+
+   // split the iterations in contiguous ranges, one per NUMA node in proportion to the threads of its arena,
+   // and process the ranges concurrently in the arenas
+   const unsigned nIterations = (end - start - 1) / step + 1;
+   unsigned long totalConcurrency = 0;
+   for (unsigned a = 0; a < nArenas; ++a)
+      totalConcurrency += fTaskArenaW->AccessNumaArena(a).max_concurrency();
+   std::vector<tbb::task_group> groups(nArenas);
+   unsigned long cumulatedConcurrency = 0;
+   unsigned first = 0;
+   for (unsigned a = 0; a < nArenas; ++a) {
+      ROOT::ROpaqueTaskArena *arena = &fTaskArenaW->AccessNumaArena(a);
+      cumulatedConcurrency += arena->max_concurrency();
+      const unsigned last = nIterations * cumulatedConcurrency / totalConcurrency;
+      if (last > first) {
+         arena->execute([&, a, first, last, arena] {
+            groups[a].run([&, first, last, arena] {
+               tbb::this_task_arena::isolate([&] {
+                  tbb::parallel_for(first, last, [&](unsigned k) {
+                     RNumaArenaScope scope(arena);
+                     f(start + k * step);
+                  });
+               });
+            });
+         });
+      }
+      first = last;
+   }
+   for (unsigned a = 0; a < nArenas; ++a)
+      fTaskArenaW->AccessNumaArena(a).execute([&, a] { groups[a].wait(); });
 }
 
 //////////////////////////////////////////////////////////////////////////
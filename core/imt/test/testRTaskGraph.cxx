@@ -0,0 +1,104 @@
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include "ROOT/RTaskGraph.hxx"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ROOT::Experimental::RTaskGraph;
+
+TEST(RTaskGraph, Dependencies)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   RTaskGraph graph;
+   std::atomic<int> step{0};
+   std::vector<int> order(4, -1);
+   auto a = graph.AddTask([&] { order[0] = step++; });
+   auto b = graph.AddTask([&] { order[1] = step++; }, {a});
+   auto c = graph.AddTask([&] { order[2] = step++; }, {a}, RTaskGraph::EPriority::kHigh);
+   graph.AddTask([&] { order[3] = step++; }, {b, c});
+   graph.Wait();
+   EXPECT_EQ(4u, graph.GetNTasks());
+   EXPECT_EQ(0, order[0]);
+   EXPECT_GT(order[3], order[1]);
+   EXPECT_GT(order[3], order[2]);
+   EXPECT_EQ(3, order[3]);
+
+   // a task depending on completed tasks runs right away
+   bool done = false;
+   graph.AddTask([&] { done = true; }, {a, b});
+   graph.Wait();
+   EXPECT_TRUE(done);
+
+   EXPECT_THROW(graph.AddTask([] {}, {100}), std::invalid_argument);
+}
+
+TEST(RTaskGraph, TasksAddingTasks)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   RTaskGraph graph;
+   const int n = 100;
+   std::vector<int> read(n, 0), processed(n, 0);
+   std::atomic<int> sum{0};
+   // each task of the first stage of the pipeline schedules the task of the second stage for its data
+   for (int i = 0; i < n; ++i) {
+      graph.AddTask([&, i] {
+         read[i] = i;
+         graph.AddTask([&, i] {
+            processed[i] = 2 * read[i];
+            sum += processed[i];
+         });
+      });
+   }
+   graph.Wait();
+   EXPECT_EQ(n * (n - 1), sum.load());
+   EXPECT_EQ(2 * (n - 1), processed[n - 1]);
+   EXPECT_EQ(2u * n, graph.GetNTasks());
+}
+
+TEST(RTaskGraph, Exceptions)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(2);
+#endif
+   RTaskGraph graph;
+   bool skipped = true, independent = false;
+   auto a = graph.AddTask([] { throw std::runtime_error("task failed"); });
+   auto b = graph.AddTask([&] { skipped = false; }, {a});
+   graph.AddTask([&] { skipped = false; }, {b});
+   graph.AddTask([&] { independent = true; });
+   EXPECT_THROW(graph.Wait(), std::runtime_error);
+   EXPECT_TRUE(skipped);
+   EXPECT_TRUE(independent);
+
+   // the exception is reported once, the tasks depending on a failed task are not executed
+   graph.AddTask([&] { skipped = false; }, {a});
+   EXPECT_NO_THROW(graph.Wait());
+   EXPECT_TRUE(skipped);
+}
+
+TEST(RTaskGraph, SequentialPriorities)
+{
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+   RTaskGraph graph;
+   EXPECT_FALSE(graph.IsParallel());
+   std::string order;
+   auto low = graph.AddTask([&] { order += 'l'; }, {}, RTaskGraph::EPriority::kLow);
+   graph.AddTask([&] { order += 'h'; }, {}, RTaskGraph::EPriority::kHigh);
+   graph.AddTask([&] { order += 'n'; });
+   graph.AddTask([&] { order += 'H'; }, {low}, RTaskGraph::EPriority::kHigh);
+   // without implicit MT the tasks are executed by Wait()
+   EXPECT_TRUE(order.empty());
+   graph.Wait();
+   EXPECT_EQ("hnlH", order);
+}
@@ -16,6 +16,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <memory>
 #include <lz4.h>
 #include <lz4hc.h>
 #include <xxhash.h>
@@ -30,6 +31,23 @@ static const int kChecksumOffset = 2 + 1 + 3 + 3;
 static const int kChecksumSize = sizeof(XXH64_canonical_t);
 static const int kHeaderSize = kChecksumOffset + kChecksumSize;
 
+namespace {
+
+/// The compression states of a thread, created on first use and kept across buffers. Without them, LZ4 sets up a
+/// state on the stack for every buffer and LZ4HC allocates its (much larger) state on the heap for every buffer.
+struct RLZ4ThreadContext {
+   std::unique_ptr<LZ4_stream_t, decltype(&LZ4_freeStream)> fState{nullptr, &LZ4_freeStream};
+   std::unique_ptr<LZ4_streamHC_t, decltype(&LZ4_freeStreamHC)> fStateHC{nullptr, &LZ4_freeStreamHC};
+
+   static RLZ4ThreadContext &Get()
+   {
+      thread_local RLZ4ThreadContext context;
+      return context;
+   }
+};
+
+} // anonymous namespace
+
 void R__zipLZ4(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
 {
    int LZ4_version = LZ4_versionNumber();
@@ -51,10 +69,21 @@ void R__zipLZ4(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, in
    if (cxlevel > 9) {
       cxlevel = 9;
    }
+   auto &context = RLZ4ThreadContext::Get();
    if (cxlevel >= 4) {
-      returnStatus = LZ4_compress_HC(src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize, cxlevel);
+      if (!context.fStateHC)
+         context.fStateHC.reset(LZ4_createStreamHC());
+      if (R__unlikely(!context.fStateHC))
+         return;
+      returnStatus = LZ4_compress_HC_extStateHC(context.fStateHC.get(), src, &tgt[kHeaderSize], *srcsize,
+                                                *tgtsize - kHeaderSize, cxlevel);
    } else {
-      returnStatus = LZ4_compress_default(src, &tgt[kHeaderSize], *srcsize, *tgtsize - kHeaderSize);
+      if (!context.fState)
+         context.fState.reset(LZ4_createStream());
+      if (R__unlikely(!context.fState))
+         return;
+      returnStatus = LZ4_compress_fast_extState(context.fState.get(), src, &tgt[kHeaderSize], *srcsize,
+                                                *tgtsize - kHeaderSize, 1 /* acceleration, as LZ4_compress_default */);
    }
 
    if (R__unlikely(returnStatus == 0)) { /* LZ4 compression failed */
@@ -14,20 +14,43 @@
 #endif
 #include "ZipLZMA.h"
 #include "lzma.h"
-#include <stdio.h>
+#include <cstdio>
 
 static const int kHeaderSize = 9;
 
+namespace {
+
+/// The liblzma streams of a thread. Initializing a coder on a stream that was used before reuses the allocations of
+/// the previous coder where possible, which avoids allocating and clearing the match finder for every buffer.
+struct RLzmaThreadContext {
+   lzma_stream fEncoder = LZMA_STREAM_INIT;
+   lzma_stream fDecoder = LZMA_STREAM_INIT;
+
+   ~RLzmaThreadContext()
+   {
+      lzma_end(&fEncoder);
+      lzma_end(&fDecoder);
+   }
+
+   static RLzmaThreadContext &Get()
+   {
+      thread_local RLzmaThreadContext context;
+      return context;
+   }
+};
+
+} // anonymous namespace
+
 void R__zipLZMA(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
 {
    uint64_t out_size;             /* compressed size */
    unsigned in_size   = (unsigned) (*srcsize);
    uint32_t dict_size_est = in_size/4;
-   lzma_stream stream = LZMA_STREAM_INIT;
+   lzma_stream &stream = RLzmaThreadContext::Get().fEncoder;
    lzma_options_lzma opt_lzma2;
    lzma_filter filters[] = {
-      { .id = LZMA_FILTER_LZMA2, .options = &opt_lzma2 },
-      { .id = LZMA_VLI_UNKNOWN,  .options = NULL },
+      { LZMA_FILTER_LZMA2, &opt_lzma2 },
+      { LZMA_VLI_UNKNOWN,  nullptr },
    };
    lzma_ret returnStatus;
 
@@ -75,10 +98,8 @@ void R__zipLZMA(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
       /* No need to print an error message. We simply abandon the compression
          the buffer cannot be compressed or compressed buffer would be larger than original buffer
       */
-      lzma_end(&stream);
       return;
    }
-   lzma_end(&stream);
 
 
    tgt[0] = 'X';  /* Signature of LZMA from XZ Utils */
@@ -101,7 +122,7 @@ void R__zipLZMA(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
 
 void R__unzipLZMA(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
-   lzma_stream stream = LZMA_STREAM_INIT;
+   lzma_stream &stream = RLzmaThreadContext::Get().fDecoder;
    lzma_ret returnStatus;
 
    *irep = 0;
@@ -126,10 +147,8 @@ void R__unzipLZMA(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       fprintf(stderr,
               "R__unzipLZMA: error %d in lzma_code\n",
               returnStatus);
-      lzma_end(&stream);
       return;
    }
-   lzma_end(&stream);
 
    *irep = (int)stream.total_out;
 }
@@ -512,6 +512,7 @@ public:
    void               InterpretedShowMembers(void* obj, TMemberInspector &insp, Bool_t isTransient);
    Bool_t             IsFolder() const override { return kTRUE; }
    Bool_t             IsLoaded() const;
+   Bool_t             IsFastStreamerCompatible(Version_t onfileVersion) const;
    Bool_t             IsForeign() const;
    Bool_t             IsStartingWithTObject() const;
    Bool_t             IsSyntheticPair() const { return fIsSyntheticPair; }
@@ -53,11 +53,12 @@ public:
    TString      fOptions;                  // Additional text based option being passed down to customize the merge.
    TObject     *fUserData{nullptr};        // Place holder to pass extra information.  This object will be deleted at the end of each series of objects.
    TIOFeatures *fIOFeatures{nullptr};      // Any ROOT IO features that should be explicitly enabled.
+   TString      fReport;                   // Filled by the Merge functions with the method used and, if slower than the default, why.
 
    TFileMergeInfo(TDirectory *outputfile) : fOutputDirectory(outputfile) {}
    virtual ~TFileMergeInfo() { delete fUserData; } ;
 
-   void Reset() { fIsFirst = kTRUE; delete fUserData; fUserData = nullptr; }
+   void Reset() { fIsFirst = kTRUE; delete fUserData; fUserData = nullptr; fReport.Clear(); }
 
    ClassDef(TFileMergeInfo, 0);
 };
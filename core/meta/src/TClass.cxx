@@ -99,6 +99,7 @@ In order to access the name of a class within the ROOT type system, the method T
 #include <cassert>
 #include <vector>
 #include <memory>
+#include <cstdint>
 
 #include "TSpinLockGuard.h"
 
@@ -167,6 +168,58 @@ namespace {
      }
    };
 
+   // Per thread caches of the results of TClass::GetClass, by (non normalized)
+   // class name and by std::type_info. They avoid the locks, the lookup in
+   // the list of classes and the normalization of the name when the same
+   // classes are requested over and over, e.g. by I/O loops.  Only loaded
+   // classes are remembered; the entries are stale as soon as the generation
+   // of the class table changed (see TClassTable::GetGeneration).
+   // The entries are trivially destructible, so that the caches can still be
+   // used by the destructors of static objects at the end of the process.
+   constexpr std::size_t kClassLookupCacheSize = 64;
+   constexpr std::size_t kClassLookupMaxName = 160;
+
+   struct TClassNameCacheEntry {
+      char       fName[kClassLookupMaxName] = {};
+      TClass    *fClass = nullptr;
+      ULong64_t  fGeneration = 0;
+   };
+
+   struct TClassTypeCacheEntry {
+      const std::type_info *fInfo = nullptr;
+      TClass               *fClass = nullptr;
+      ULong64_t             fGeneration = 0;
+   };
+
+   TClassNameCacheEntry &GetClassNameCacheEntry(const char *name)
+   {
+      thread_local TClassNameCacheEntry cache[kClassLookupCacheSize];
+      return cache[TString::Hash(name, strlen(name)) % kClassLookupCacheSize];
+   }
+
+   TClassTypeCacheEntry &GetClassTypeCacheEntry(const std::type_info &info)
+   {
+      thread_local TClassTypeCacheEntry cache[kClassLookupCacheSize];
+      return cache[(reinterpret_cast<std::uintptr_t>(&info) / alignof(std::type_info)) % kClassLookupCacheSize];
+   }
+
+   bool IsCacheableClass(const TClass *cl)
+   {
+      return cl && cl->IsLoaded();
+   }
+
+   // Remember the result of a lookup done while the class table was at
+   // generation `generation`.
+   TClass *CacheClassByName(TClassNameCacheEntry &entry, const char *name, TClass *cl, ULong64_t generation)
+   {
+      if (IsCacheableClass(cl) && strlen(name) < kClassLookupMaxName) {
+         strlcpy(entry.fName, name, kClassLookupMaxName);
+         entry.fClass = cl;
+         entry.fGeneration = generation;
+      }
+      return cl;
+   }
+
 }
 
 std::atomic<Int_t> TClass::fgClassCount;
@@ -503,6 +556,8 @@ void TClass::AddClass(TClass *cl)
    if (cl->fClassInfo) {
       GetDeclIdMap()->Add((void*)(cl->fClassInfo), cl);
    }
+   // The new TClass may replace one remembered by the GetClass caches.
+   TClassTable::IncrementGeneration();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -529,6 +584,7 @@ void TClass::RemoveClass(TClass *oldcl)
    if (oldcl->fClassInfo) {
       //GetDeclIdMap()->Remove((void*)(oldcl->fClassInfo));
    }
+   TClassTable::IncrementGeneration();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2981,6 +3037,13 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    if (!gROOT->GetListOfClasses())  return nullptr;
 
+   // Lock free path: this thread already looked this name up since the
+   // last change of the class table.
+   const ULong64_t generation = TClassTable::GetGeneration();
+   TClassNameCacheEntry &cacheEntry = GetClassNameCacheEntry(name);
+   if (cacheEntry.fGeneration == generation && strcmp(cacheEntry.fName, name) == 0)
+      return cacheEntry.fClass;
+
    // FindObject will take the read lock before actually getting the
    // TClass pointer so we will need not get a partially initialized
    // object.
@@ -2988,7 +3051,7 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    // Early return to release the lock without having to execute the
    // long-ish normalization.
-   if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading))) return cl;
+   if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading))) return CacheClassByName(cacheEntry, name, cl, generation);
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -2997,7 +3060,7 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    cl = (TClass*)gROOT->GetListOfClasses()->FindObject(name);
    if (cl) {
-      if (cl->IsLoaded() || cl->TestBit(kUnloading)) return cl;
+      if (cl->IsLoaded() || cl->TestBit(kUnloading)) return CacheClassByName(cacheEntry, name, cl, generation);
 
       // We could speed-up some of the search by adding (the equivalent of)
       //
@@ -3039,7 +3102,7 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
       TClass *loadedcl = (dict)();
       if (loadedcl) {
          loadedcl->PostLoadCheck();
-         return loadedcl;
+         return CacheClassByName(cacheEntry, name, loadedcl, generation);
       }
 
       // We should really not fall through to here, but if we do, let's just
@@ -3059,7 +3122,7 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
          cl = (TClass*)gROOT->GetListOfClasses()->FindObject(normalizedName.c_str());
 
          if (cl) {
-            if (cl->IsLoaded() || cl->TestBit(kUnloading)) return cl;
+            if (cl->IsLoaded() || cl->TestBit(kUnloading)) return CacheClassByName(cacheEntry, name, cl, generation);
 
             //we may pass here in case of a dummy class created by TVirtualStreamerInfo
             load = kTRUE;
@@ -3132,11 +3195,11 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
          }
       }
    }
-   if (loadedcl) return loadedcl;
+   if (loadedcl) return CacheClassByName(cacheEntry, name, loadedcl, generation);
 
    // See if the TClassGenerator can produce the TClass we need.
    loadedcl = LoadClassCustom(normalizedName.c_str(),silent);
-   if (loadedcl) return loadedcl;
+   if (loadedcl) return CacheClassByName(cacheEntry, name, loadedcl, generation);
 
    // We have not been able to find a loaded TClass, return the Emulated
    // TClass if we have one.
@@ -3256,11 +3319,22 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    if (!gROOT->GetListOfClasses())
       return nullptr;
 
+   // Lock free path, see GetClass(const char*).
+   const ULong64_t generation = TClassTable::GetGeneration();
+   TClassTypeCacheEntry &cacheEntry = GetClassTypeCacheEntry(typeinfo);
+   if (cacheEntry.fGeneration == generation && cacheEntry.fInfo == &typeinfo)
+      return cacheEntry.fClass;
+
    //protect access to TROOT::GetIdMap
    R__READ_LOCKGUARD(ROOT::gCoreMutex);
 
    TClass* cl = GetIdMap()->Find(typeinfo.name());
 
+   if (IsCacheableClass(cl)) {
+      cacheEntry.fInfo = &typeinfo;
+      cacheEntry.fClass = cl;
+      cacheEntry.fGeneration = generation;
+   }
    if (cl && cl->IsLoaded()) return cl;
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
@@ -5941,6 +6015,26 @@ Bool_t  TClass::IsTObject() const
    return TestBit(kIsTObject);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if data written with the given version of this class can be streamed
+/// by a Streamer generated by rootcling for the in-memory layout of the class, i.e.
+/// with the LinkDef option `faststreamer`:
+/// ~~~ {.cpp}
+///     #pragma link C++ options=faststreamer class MyEvent+;
+/// ~~~
+/// This is not the case if the version differs from the current one, if schema
+/// evolution rules apply to the version or if the TObject part is not streamed.
+/// The generated Streamer then uses ReadClassBuffer() and WriteClassBuffer().
+
+Bool_t TClass::IsFastStreamerCompatible(Version_t onfileVersion) const
+{
+   if (onfileVersion != fClassVersion || TestBit(kIgnoreTObjectStreamer))
+      return kFALSE;
+   if (fSchemaRules && !fSchemaRules->FindRules(GetName(), (Int_t)onfileVersion).empty())
+      return kFALSE;
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return kTRUE is the class is Foreign (the class does not have a Streamer method).
 
@@ -6324,6 +6418,8 @@ void TClass::SetUnloaded()
 
    // Make sure SetClassInfo, re-calculated the state.
    fState = kForwardDeclared;
+   // The TClass is not loaded anymore, forget it in the GetClass caches.
+   TClassTable::IncrementGeneration();
 
    delete fIsA; fIsA = nullptr;
    // Disable the autoloader while calling SetClassInfo, to prevent
@@ -1,9 +1,14 @@
 #include "TClass.h"
+#include "TClassTable.h"
 #include "THashTable.h"
 #include "TInterpreter.h"
+#include "TNamed.h"
 
 #include "gtest/gtest.h"
 
+#include <thread>
+#include <vector>
+
 TEST(TClass, DictCheck)
 {
    gInterpreter->ProcessLine(".L stlDictCheck.h+");
@@ -22,3 +27,36 @@ TEST(TClass, DictCheck)
 
    EXPECT_STREQ(errMsg.c_str(), "Missing dictionary for C, ") << errMsg;
 }
+
+TEST(TClass, GetClassCache)
+{
+   TClass *named = TNamed::Class();
+   ASSERT_NE(nullptr, named);
+
+   // Repeated lookups, served by the per thread caches, always agree with
+   // the list of classes, from several threads.
+   std::vector<std::thread> threads;
+   std::vector<int> mismatches(4, 0);
+   for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([&, t] {
+         for (int i = 0; i < 1000; ++i) {
+            if (TClass::GetClass("TNamed") != named || TClass::GetClass(typeid(TNamed)) != named ||
+                TClass::GetClass("class TNamed") != named)
+               ++mismatches[t];
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+   for (int t = 0; t < 4; ++t)
+      EXPECT_EQ(0, mismatches[t]);
+
+   // Registering a new class invalidates the caches.
+   auto generation = TClassTable::GetGeneration();
+   gInterpreter->Declare("struct GetClassCacheTest { int fI; };");
+   TClass *cl = TClass::GetClass("GetClassCacheTest");
+   ASSERT_NE(nullptr, cl);
+   EXPECT_NE(generation, TClassTable::GetGeneration());
+   EXPECT_EQ(cl, TClass::GetClass("GetClassCacheTest"));
+   EXPECT_EQ(named, TClass::GetClass("TNamed"));
+}
@@ -130,6 +130,7 @@ clang/LLVM technology.
 #include <algorithm>
 #include <iostream>
 #include <cassert>
+#include <chrono>
 #include <map>
 #include <set>
 #include <stdexcept>
@@ -1062,6 +1063,56 @@ static void LoadModules(const std::vector<std::string> &modules, cling::Interpre
       LoadModule(modName, interp);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if the C++ modules which are not required by every ROOT
+/// program should only be loaded when one of their entities is needed, i.e.
+/// if the `ROOT_LAZY_MODULES` environment variable is set to a value other
+/// than 0. The modules are then loaded when their library is loaded, e.g.
+/// by the autoloading triggered by TClass::GetClass, or when the global
+/// module index refers to them for an identifier being looked up.
+static bool IsLazyModuleLoading()
+{
+   static const bool lazy = [] {
+      const char *env = getenv("ROOT_LAZY_MODULES");
+      return env && *env && strcmp(env, "0") != 0;
+   }();
+   return lazy;
+}
+
+namespace {
+////////////////////////////////////////////////////////////////////////////////
+/// Reports the time spent in a step of the interpreter startup on stderr,
+/// when its scope ends, if the `ROOT_STARTUP_TRACE` environment variable is
+/// set. The steps are nested, e.g. "RegisterCxxModules/Core".
+class TStartupTraceRAII {
+   using Clock_t = std::chrono::steady_clock;
+
+   const char *fStep;
+   Clock_t::time_point fStart;
+
+public:
+   static bool IsEnabled()
+   {
+      static const bool enabled = getenv("ROOT_STARTUP_TRACE") != nullptr;
+      return enabled;
+   }
+
+   TStartupTraceRAII(const char *step) : fStep(step)
+   {
+      if (IsEnabled())
+         fStart = Clock_t::now();
+   }
+
+   ~TStartupTraceRAII()
+   {
+      if (!IsEnabled())
+         return;
+      std::chrono::duration<double, std::milli> elapsed = Clock_t::now() - fStart;
+      fprintf(stderr, "ROOT startup: %-40s %9.1f ms\n", fStep, elapsed.count());
+   }
+};
+} // namespace
+
 static bool IsFromRootCling() {
   // rootcling also uses TCling for generating the dictionary ROOT files.
   const static bool foundSymbol = dlsym(RTLD_DEFAULT, "usedToIdentifyRootClingByDlSym");
@@ -1103,7 +1154,8 @@ static GlobalModuleIndex *loadGlobalModuleIndex(cling::Interpreter &interp)
 
    // For finding modules needing to be imported for fixit messages,
    // we need to make the global index cover all modules, so we do that here.
-   if (!GlobalIndex && !HaveFullGlobalModuleIndex) {
+   // Building it loads all modules: in lazy mode only an existing index is used.
+   if (!GlobalIndex && !HaveFullGlobalModuleIndex && !IsLazyModuleLoading()) {
       ModuleMap &MMap = PP.getHeaderSearchInfo().getModuleMap();
       bool RecreateIndex = false;
       for (ModuleMap::module_iterator I = MMap.module_begin(), E = MMap.module_end(); I != E; ++I) {
@@ -1195,6 +1247,8 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
    // Loading of a module might deserialize.
    cling::Interpreter::PushTransactionRAII deserRAII(&clingInterp);
 
+   TStartupTraceRAII traceAll("RegisterCxxModules");
+
    // Setup core C++ modules if we have any to setup.
 
    // Load libc and stl first.
@@ -1223,10 +1277,14 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
                                            "Rint",
                                            "RIO"};
 
-   LoadModules(CoreModules, clingInterp);
+   {
+      TStartupTraceRAII trace("RegisterCxxModules/Core");
+      LoadModules(CoreModules, clingInterp);
+   }
 
    // Take this branch only from ROOT because we don't need to preload modules in rootcling
    if (!IsFromRootCling()) {
+      TStartupTraceRAII traceCommon("RegisterCxxModules/Common");
       std::vector<std::string> CommonModules = {"MathCore"};
       LoadModules(CommonModules, clingInterp);
 
@@ -1243,7 +1301,10 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
       LoadModules(FIXMEModules, clingInterp);
 
       GlobalModuleIndex *GlobalIndex = nullptr;
-      loadGlobalModuleIndex(clingInterp);
+      {
+         TStartupTraceRAII trace("RegisterCxxModules/GlobalModuleIndex");
+         loadGlobalModuleIndex(clingInterp);
+      }
       // FIXME: The ASTReader still calls loadGlobalIndex and loads the file
       // We should investigate how to suppress it completely.
       GlobalIndex = CI.getASTReader()->getGlobalIndex();
@@ -1252,6 +1313,9 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
       if (GlobalIndex)
          GlobalIndex->getKnownModuleFileNames(KnownModuleFileNames);
 
+      const bool lazy = IsLazyModuleLoading();
+      TStartupTraceRAII tracePreload(lazy ? "RegisterCxxModules/Preload (lazy)" : "RegisterCxxModules/Preload");
+
       std::vector<std::string> PendingModules;
       PendingModules.reserve(256);
       for (auto I = MMap.module_begin(), E = MMap.module_end(); I != E; ++I) {
@@ -1269,6 +1333,11 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
          if (M->IsUnimportable)
             continue;
 
+         // In lazy mode, the other modules stay registered through the modulemaps
+         // and are loaded on demand, see IsLazyModuleLoading().
+         if (lazy && !M->IsSystem)
+            continue;
+
          if (GlobalIndex)
             LoadModule(M->Name, clingInterp);
          else {
@@ -1347,6 +1416,7 @@ TCling::TCling(const char *name, const char *title, const char* const argv[], vo
   fPrevLoadedDynLibInfo(nullptr), fClingCallbacks(nullptr), fAutoLoadCallBack(nullptr),
   fTransactionCount(0), fHeaderParsingOnDemand(true), fIsAutoParsingSuspended(kFALSE)
 {
+   TStartupTraceRAII traceCtor("TCling::TCling");
    fPrompt[0] = 0;
    const bool fromRootCling = IsFromRootCling();
 
@@ -1538,10 +1608,13 @@ TCling::TCling(const char *name, const char *title, const char* const argv[], vo
    if (!EnvOpt.hasValue())
       extensions.push_back(std::make_shared<TClingRdictModuleFileExtension>());
 
-   fInterpreter = std::make_unique<cling::Interpreter>(interpArgs.size(),
-                                                       &(interpArgs[0]),
-                                                       llvmResourceDir, extensions,
-                                                       interpLibHandle);
+   {
+      TStartupTraceRAII trace("cling::Interpreter");
+      fInterpreter = std::make_unique<cling::Interpreter>(interpArgs.size(),
+                                                          &(interpArgs[0]),
+                                                          llvmResourceDir, extensions,
+                                                          interpLibHandle);
+   }
 
    // Don't check whether modules' files exist.
    fInterpreter->getCI()->getPreprocessorOpts().DisablePCHOrModuleValidation =
@@ -1563,7 +1636,10 @@ TCling::TCling(const char *name, const char *title, const char* const argv[], vo
    fMetaProcessor = std::make_unique<cling::MetaProcessor>(*fInterpreter, fMPOuts);
 
    RegisterCxxModules(*fInterpreter);
-   RegisterPreIncludedHeaders(*fInterpreter);
+   {
+      TStartupTraceRAII trace("RegisterPreIncludedHeaders");
+      RegisterPreIncludedHeaders(*fInterpreter);
+   }
 
    // We are now ready (enough is loaded) to init the list of opaque typedefs.
    fNormalizedCtxt = new ROOT::TMetaUtils::TNormalizedCtxt(fInterpreter->getLookupHelper());
@@ -1642,6 +1718,7 @@ TCling::~TCling()
 
 void TCling::Initialize()
 {
+   TStartupTraceRAII traceInit("TCling::Initialize");
    fClingCallbacks->Initialize();
 
    // We are set up. Enable ROOT's AutoLoading.
@@ -1653,9 +1730,15 @@ void TCling::Initialize()
    // *not* using them.
    // Note this call must happen before the first call to LoadLibraryMap.
    assert(GetRootMapFiles() == nullptr && "Must be called before LoadLibraryMap!");
-   TClass::ReadRules(); // Read the default customization rules ...
+   {
+      TStartupTraceRAII trace("TClass::ReadRules");
+      TClass::ReadRules(); // Read the default customization rules ...
+   }
 
-   LoadLibraryMap();
+   {
+      TStartupTraceRAII trace("LoadLibraryMap");
+      LoadLibraryMap();
+   }
    SetClassAutoLoading(true);
 }
 
@@ -48,6 +48,7 @@ C++ interpreter and the Clang C++ compiler, not CINT.
 #include "clang/AST/QualTypeNames.h"
 #include "clang/AST/RecordLayout.h"
 #include "clang/AST/Type.h"
+#include "clang/Basic/SourceManager.h"
 #include "clang/Frontend/CompilerInstance.h"
 #include "clang/Lex/Preprocessor.h"
 #include "clang/Sema/Sema.h"
@@ -67,9 +68,13 @@ C++ interpreter and the Clang C++ compiler, not CINT.
 
 #include "clang/Sema/SemaInternal.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
 #include <map>
 #include <string>
 #include <sstream>
+#include <vector>
 
 using namespace ROOT;
 using namespace llvm;
@@ -93,6 +98,174 @@ indent(ostringstream &buf, int indent_level)
    }
 }
 
+// On-disk cache of the method wrappers made by make_wrapper().
+//
+// When the environment variable ROOT_CALLFUNC_CACHE names a directory, the
+// source of each wrapper is saved there, preceded by the include of the
+// header declaring the function, under a name derived from its content.
+// The first process finding saved wrappers newer than the cache library
+// compiles them all at once with ACLiC into libCallFuncWrappers; later
+// processes just load the library and take the wrappers from it instead
+// of compiling them with cling.  Wrappers of functions not declared in a
+// header (e.g. typed at the prompt) are not cached.
+
+static const string kWrapperCachePrefix("__cf_cache_");
+
+static
+const string &
+GetWrapperCacheDir()
+{
+   static const string dir = [] {
+      const char *env = getenv("ROOT_CALLFUNC_CACHE");
+      if (!env || !*env)
+         return string();
+      if (gSystem->AccessPathName(env) && gSystem->mkdir(env, kTRUE) != 0) {
+         ::Warning("TClingCallFunc", "Cannot create the wrapper cache directory %s, the cache is disabled.", env);
+         return string();
+      }
+      return string(env);
+   }();
+   return dir;
+}
+
+static
+string
+GetWrapperCacheHeader(const cling::Interpreter &interp, const Decl *D)
+{
+   // Return the header to include to declare D: the file of its declaration
+   // or, for the internal headers of system libraries, the outermost system
+   // header including it (e.g. <vector> rather than bits/stl_vector.h).
+   const SourceManager &SM = interp.getCI()->getSourceManager();
+   SourceLocation loc = SM.getExpansionLoc(D->getLocation());
+   if (loc.isInvalid())
+      return string();
+   FileID fid = SM.getFileID(loc);
+   while (SM.isInSystemHeader(SM.getLocForStartOfFile(fid))) {
+      SourceLocation includeLoc = SM.getIncludeLoc(fid);
+      if (includeLoc.isInvalid() || !SM.isInSystemHeader(includeLoc))
+         break;
+      fid = SM.getFileID(SM.getExpansionLoc(includeLoc));
+   }
+   const FileEntry *FE = SM.getFileEntryForID(fid);
+   if (!FE)
+      return string();
+   string header = FE->tryGetRealPathName().str();
+   if (header.empty() || gSystem->AccessPathName(header.c_str()))
+      return string();
+   // Do not include source files, e.g. ACLiC'ed macros.
+   TString ext = header.c_str();
+   ext.Remove(0, ext.Last('.') + 1);
+   if (ext == "C" || ext == "cxx" || ext == "cpp" || ext == "cc" || ext == "c")
+      return string();
+   return header;
+}
+
+static
+string
+GetWrapperCacheName(const string &wrapper, const string &header)
+{
+   // FNV-1a, contrary to std::hash it is stable across processes.  The
+   // modification time of the header and the ROOT version are part of the
+   // hash so that outdated wrappers are not picked up.
+   unsigned long long hash = 14695981039346656037ULL;
+   auto add = [&hash](const string &str) {
+      for (unsigned char c : str) {
+         hash ^= c;
+         hash *= 1099511628211ULL;
+      }
+   };
+   FileStat_t stat;
+   gSystem->GetPathInfo(header.c_str(), stat);
+   add(wrapper);
+   add(header);
+   add(to_string(stat.fMtime));
+   add(to_string(ROOT_VERSION_CODE));
+   ostringstream buf;
+   buf << kWrapperCachePrefix << hex << hash;
+   return buf.str();
+}
+
+static
+bool
+LoadWrapperCache(const string &dir)
+{
+   // Load the library of cached wrappers, after (re)building it if saved
+   // wrappers are missing from it.
+   vector<string> sources;
+   Long_t newest = 0;
+   if (void *dirp = gSystem->OpenDirectory(dir.c_str())) {
+      while (const char *entry = gSystem->GetDirEntry(dirp)) {
+         TString name = entry;
+         if (!name.BeginsWith(kWrapperCachePrefix.c_str()) || !name.EndsWith(".cxx"))
+            continue;
+         FileStat_t stat;
+         if (gSystem->GetPathInfo((dir + "/" + entry).c_str(), stat) == 0) {
+            sources.emplace_back(entry);
+            newest = std::max(newest, stat.fMtime);
+         }
+      }
+      gSystem->FreeDirectory(dirp);
+   }
+   if (sources.empty())
+      return false;
+
+   const string library = dir + "/libCallFuncWrappers";
+   const string libraryFile = library + "." + gSystem->GetSoExt();
+   FileStat_t libraryStat;
+   if (gSystem->GetPathInfo(libraryFile.c_str(), libraryStat) == 0 && libraryStat.fMtime >= newest)
+      return gSystem->Load(libraryFile.c_str()) >= 0;
+
+   std::sort(sources.begin(), sources.end());
+   const string all = dir + "/CallFuncWrappers.cxx";
+   {
+      ofstream out(all);
+      out << "// Generated by TClingCallFunc, see ROOT_CALLFUNC_CACHE.\n"
+             "#include <new>\n";
+      for (const auto &source : sources)
+         out << "#include \"" << source << "\"\n";
+   }
+   if (gSystem->CompileMacro(all.c_str(), "kOfs", library.c_str()))
+      return true;
+
+   // Compiling any wrapper outside of cling might fail (e.g. a header needs
+   // another one to be included first): start over with an empty cache.
+   ::Warning("TClingCallFunc", "Failed to build the wrapper cache library %s, clearing the cache.",
+             libraryFile.c_str());
+   for (const auto &source : sources)
+      gSystem->Unlink((dir + "/" + source).c_str());
+   return false;
+}
+
+static
+void *
+FindCachedWrapper(const cling::Interpreter &interp, const string &wrapper_name)
+{
+   static const bool loaded = LoadWrapperCache(GetWrapperCacheDir());
+   (void)loaded;
+   // Besides the library, a wrapper with the same content might have been
+   // compiled by cling earlier in this process, e.g. for a redeclaration of
+   // the function.
+   return interp.getAddressOfGlobal(wrapper_name);
+}
+
+static
+void
+SaveCachedWrapper(const string &dir, const string &wrapper_name, const string &header, const string &wrapper)
+{
+   // Write to a temporary file first, so that a concurrent process never
+   // compiles a partial wrapper.
+   const string file = dir + "/" + wrapper_name + ".cxx";
+   const string tmpFile = file + ".tmp" + to_string(gSystem->GetPid());
+   {
+      ofstream out(tmpFile);
+      out << "#include \"" << header << "\"\n" << wrapper << "\n";
+      if (!out)
+         return;
+   }
+   if (gSystem->Rename(tmpFile.c_str(), file.c_str()) != 0)
+      gSystem->Unlink(tmpFile.c_str());
+}
+
 static
 void
 EvaluateExpr(cling::Interpreter &interp, const Expr *E, cling::Value &V)
@@ -1001,6 +1174,25 @@ tcling_callfunc_Wrapper_t TClingCallFunc::make_wrapper()
 
    if (get_wrapper_code(wrapper_name, wrapper) == 0) return nullptr;
 
+   //
+   //  Use the on-disk cache, giving the wrapper a name derived from its content.
+   //
+   const string &cacheDir = GetWrapperCacheDir();
+   string cacheHeader;
+   if (!cacheDir.empty())
+      cacheHeader = GetWrapperCacheHeader(*fInterp, GetDecl());
+   if (!cacheHeader.empty()) {
+      const string::size_type pos = wrapper.find(wrapper_name + "(");
+      const string cacheName = GetWrapperCacheName(wrapper.substr(0, pos) + wrapper.substr(pos + wrapper_name.size()),
+                                                   cacheHeader);
+      wrapper.replace(pos, wrapper_name.size(), cacheName);
+      wrapper_name = cacheName;
+      if (void *F = FindCachedWrapper(*fInterp, wrapper_name)) {
+         gWrapperStore.insert(make_pair(D, F));
+         return (tcling_callfunc_Wrapper_t)F;
+      }
+   }
+
    //fprintf(stderr, "%s\n", wrapper.c_str());
    //
    //  Compile the wrapper code.
@@ -1008,6 +1200,8 @@ tcling_callfunc_Wrapper_t TClingCallFunc::make_wrapper()
    void *F = compile_wrapper(wrapper_name, wrapper);
    if (F) {
       gWrapperStore.insert(make_pair(D, F));
+      if (!cacheHeader.empty())
+         SaveCachedWrapper(cacheDir, wrapper_name, cacheHeader, wrapper);
    } else {
       ::Error("TClingCallFunc::make_wrapper",
             "Failed to compile\n  ==== SOURCE BEGIN ====\n%s\n  ==== SOURCE END ====",
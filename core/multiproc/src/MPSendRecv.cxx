@@ -11,8 +11,81 @@
  
 #include "MPSendRecv.h"
 #include "TBufferFile.h"
+#include "TEnv.h"
 #include "MPCode.h"
+#include <atomic>
+#include <cstdio> //snprintf
+#include <cstring> //memcpy
 #include <memory> //unique_ptr
+#include <fcntl.h> //O_* constants
+#include <sys/mman.h> //shm_open, mmap
+#include <unistd.h> //ftruncate, getpid
+
+namespace {
+
+/// Flag set in the size field of a message whose object is in a shared memory segment;
+/// the name of the segment follows the size, in a field of kShmNameLength bytes.
+constexpr ULong_t kSharedMemoryBit = 1UL << 63;
+constexpr unsigned kShmNameLength = 32;
+
+std::atomic<ULong_t> &SharedMemoryThreshold()
+{
+   static std::atomic<ULong_t> threshold{
+      (ULong_t)gEnv->GetValue("MultiProc.SharedMemoryThreshold", 1024 * 1024)};
+   return threshold;
+}
+
+/// A read buffer on a mapped shared memory segment, unmapped on destruction.
+class TMPSharedBuffer : public TBufferFile {
+   void *fAddress;
+   size_t fLength;
+
+public:
+   TMPSharedBuffer(void *address, size_t length)
+      : TBufferFile(TBuffer::kRead, length, address, false), fAddress(address), fLength(length)
+   {
+   }
+   ~TMPSharedBuffer() override { munmap(fAddress, fLength); }
+};
+
+/// Copy the buffer into a new shared memory segment, whose name is written
+/// to name. Returns false if the segment could not be created.
+bool WriteSharedMemory(const char *buf, ULong_t len, char *name)
+{
+   static std::atomic<unsigned> counter{0};
+   snprintf(name, kShmNameLength, "/ROOTMP-%d-%u", (int)getpid(), counter++);
+   int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+   if (fd < 0)
+      return false;
+   void *address = MAP_FAILED;
+   if (ftruncate(fd, len) == 0)
+      address = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   close(fd);
+   if (address == MAP_FAILED) {
+      shm_unlink(name);
+      return false;
+   }
+   memcpy(address, buf, len);
+   munmap(address, len);
+   return true;
+}
+
+/// Map the shared memory segment of the given name, and remove its name.
+TBufferFile *ReadSharedMemory(const char *name, ULong_t len)
+{
+   int fd = shm_open(name, O_RDONLY, 0);
+   if (fd < 0)
+      return nullptr;
+   shm_unlink(name);
+   // Private mapping, so that the buffer can be used like any other buffer
+   void *address = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (address == MAP_FAILED)
+      return nullptr;
+   return new TMPSharedBuffer(address, len);
+}
+
+} // anonymous namespace
 
 //////////////////////////////////////////////////////////////////////////
 /// Send a message with the specified code on the specified socket.
@@ -76,7 +149,17 @@ MPCodeBufPair MPRecv(TSocket *s)
 
    //receive object if needed
    std::unique_ptr<TBufferFile> objBuf; //defaults to nullptr
-   if (classBufSize != 0) {
+   if (classBufSize & kSharedMemoryBit) {
+      //the object is in a shared memory segment, of which we receive the name
+      char name[kShmNameLength];
+      s->RecvRaw(name, kShmNameLength);
+      name[kShmNameLength - 1] = '\0';
+      objBuf.reset(ReadSharedMemory(name, classBufSize & ~kSharedMemoryBit));
+      if (!objBuf) {
+         Error("MPRecv", "[E] Could not map the shared memory segment %s\n", name);
+         return std::make_pair(MPCode::kRecvError, nullptr);
+      }
+   } else if (classBufSize != 0) {
       char *classBuf = new char[classBufSize];
       s->RecvRaw(classBuf, classBufSize);
       objBuf.reset(new TBufferFile(TBuffer::kRead, classBufSize, classBuf, true)); //the buffer is deleted by TBuffer's dtor
@@ -84,3 +167,56 @@ MPCodeBufPair MPRecv(TSocket *s)
 
    return std::make_pair(code, std::move(objBuf));
 }
+
+
+//////////////////////////////////////////////////////////////////////////
+/// Send a message with the specified code and the given buffer, usually
+/// holding a streamed object, on the specified socket.
+/// Buffers of at least MPGetSharedMemoryThreshold() bytes are copied into a
+/// POSIX shared memory segment and only its name is sent: the receiver maps
+/// the segment instead of reading the data from the socket, which is faster
+/// for large objects such as histograms. If the segment cannot be created,
+/// the buffer is sent over the socket.
+/// \param s a pointer to a valid TSocket. No validity checks are performed\n
+/// \param code the code to be sent
+/// \param buf the buffer to be sent, can be null if len is 0
+/// \param len the number of bytes in buf
+/// \return the number of bytes sent, as per TSocket::SendRaw
+int MPSendBuffer(TSocket *s, unsigned code, const char *buf, ULong_t len)
+{
+   TBufferFile wBuf(TBuffer::kWrite);
+   wBuf.WriteUInt(code);
+   const ULong_t threshold = MPGetSharedMemoryThreshold();
+   char name[kShmNameLength] = {};
+   if (threshold && len >= threshold && WriteSharedMemory(buf, len, name)) {
+      wBuf.WriteULong(len | kSharedMemoryBit);
+      wBuf.WriteFastArray(name, kShmNameLength);
+      int nsent = s->SendRaw(wBuf.Buffer(), wBuf.Length());
+      if (nsent <= 0)
+         shm_unlink(name);
+      return nsent;
+   }
+   wBuf.WriteULong(len);
+   if (len)
+      wBuf.WriteBuf(buf, len);
+   return s->SendRaw(wBuf.Buffer(), wBuf.Length());
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Return the size above which objects are transferred through a shared
+/// memory segment rather than through the socket. The default, 1 MB, can be
+/// changed with the MultiProc.SharedMemoryThreshold rootrc variable; 0 means
+/// that the socket is always used.
+ULong_t MPGetSharedMemoryThreshold()
+{
+   return SharedMemoryThreshold();
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Set the size above which objects are transferred through a shared
+/// memory segment, 0 to always use the socket. To have an effect on the
+/// results of TProcessExecutor, it must be set before forking the workers.
+void MPSetSharedMemoryThreshold(ULong_t nbytes)
+{
+   SharedMemoryThreshold() = nbytes;
+}
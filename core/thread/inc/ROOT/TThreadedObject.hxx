@@ -20,6 +20,8 @@
 
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <exception>
 #include <deque>
 #include <functional>
@@ -99,7 +101,8 @@ namespace ROOT {
          struct DirCreator {
             static TDirectory *Create()
             {
-               static unsigned dirCounter = 0;
+               // the slots of different TThreadedObjects can be created concurrently
+               static std::atomic<unsigned> dirCounter{0};
                const std::string dirName = "__TThreaded_dir_" + std::to_string(dirCounter++) + "_";
                return gROOT->mkdir(dirName.c_str());
             }
@@ -110,6 +113,16 @@ namespace ROOT {
             static TDirectory *Create() { return nullptr; }
          };
 
+         /// The slot of a TThreadedObject used by a thread, remembered by the thread to find it without locking.
+         struct SlotCacheEntry {
+            std::uint64_t fObjectId = 0;      ///< Identifier of the TThreadedObject, 0 for an empty entry
+            void *fObject = nullptr;          ///< Address of the std::shared_ptr<T> of the slot
+            TDirectory *fDirectory = nullptr; ///< Directory of the slot
+         };
+
+         std::uint64_t NewObjectId();
+         SlotCacheEntry &GetSlotCacheEntry(std::uint64_t objectId);
+
       } // End of namespace TThreadedObjectUtils
    } // End of namespace Internal
 
@@ -146,6 +159,16 @@ namespace ROOT {
     * In case an elaborate thread management is in place, e.g. in presence of
     * stream of operations or "processing slots", it is also possible to
     * manually select the correct object pointer explicitly.
+    *
+    * Each thread remembers the slots of the TThreadedObjects it used recently, such that,
+    * after the first call in a thread, Get() and the arrow operator do not need to lock.
+    * The thread private objects can be merged concurrently by an executor, e.g. a
+    * ROOT::TThreadExecutor, with a tree reduction:
+    * ~~~{.cpp}
+    * ROOT::TThreadExecutor pool;
+    * auto monitoring = threadedHisto.ParallelSnapshotMerge(pool); // while the threads keep filling
+    * auto result = threadedHisto.ParallelMerge(pool);
+    * ~~~
     */
    template<class T>
    class TThreadedObject {
@@ -164,7 +187,8 @@ namespace ROOT {
       /// This form of the constructor is useful to manually pre-set the content of a given number of slots
       /// when used in combination with TThreadedObject::SetAtSlot().
       template <class... ARGS>
-      TThreadedObject(TNumSlots initSlots, ARGS &&... args) : fIsMerged(false)
+      TThreadedObject(TNumSlots initSlots, ARGS &&... args)
+         : fObjectId(Internal::TThreadedObjectUtils::NewObjectId()), fIsMerged(false)
       {
          const auto nSlots = initSlots.fVal;
          fObjPointers.resize(nSlots);
@@ -262,9 +286,11 @@ namespace ROOT {
          return fObjPointers[i].get();
       }
 
-      /// Access the pointer corresponding to the current slot. This method is
-      /// not adequate for being called inside tight loops as it implies a
-      /// lookup in a mapping between the threadIDs and the slot indices.
+      /// Access the pointer corresponding to the current slot. The first call
+      /// in a thread looks the slot up in a mapping between the threadIDs and
+      /// the slot indices; the following ones find it in a cache of the thread,
+      /// without locking. This method still implies an atomic reference count
+      /// increment, so it is not adequate for being called inside tight loops.
       /// A good practice consists in copying the pointer onto the stack and
       /// proceed with the loop as shown in this work item (psudo-code) which
       /// will be sent to different threads:
@@ -279,13 +305,13 @@ namespace ROOT {
       /// ~~~
       std::shared_ptr<T> Get()
       {
-         return GetAtSlot(GetThisSlotNumber());
+         return GetThisSlot();
       }
 
       /// Access the wrapped object and allow to call its methods.
       T *operator->()
       {
-         return Get().get();
+         return GetThisSlot().get();
       }
 
       /// Merge all the thread private objects. Can be called once: it does not
@@ -305,6 +331,33 @@ namespace ROOT {
          return fObjPointers[0];
       }
 
+      /// Merge all the thread private objects with a tree reduction executed by
+      /// the executor, e.g. a ROOT::TThreadExecutor: the objects are merged in
+      /// pairs concurrently, then the results in pairs, and so on. As Merge(),
+      /// it can be called once and collapses all objects into the one at slot 0.
+      /// The merge function is called with a target and a vector of two objects,
+      /// the target and the object to merge into it, concurrently for different
+      /// targets.
+      template <class Executor>
+      std::shared_ptr<T> ParallelMerge(Executor &executor, TThreadedObjectUtils::MergeFunctionType<T> mergeFunction =
+                                                              TThreadedObjectUtils::MergeTObjects<T>)
+      {
+         if (fIsMerged) {
+            Warning("TThreadedObject::ParallelMerge", "This object was already merged. Returning the previous result.");
+            return fObjPointers[0];
+         }
+         std::vector<std::shared_ptr<T>> objs;
+         for (auto &obj : fObjPointers) {
+            if (obj)
+               objs.emplace_back(obj);
+         }
+         TreeMerge(executor, objs, mergeFunction);
+         if (!objs.empty())
+            fObjPointers[0] = objs[0];
+         fIsMerged = true;
+         return fObjPointers[0];
+      }
+
       /// Merge all the thread private objects. Can be called many times. It
       /// does create a new instance of class T to represent the "Sum" object.
       /// This method is not thread safe: correct or acceptable behaviours
@@ -323,6 +376,50 @@ namespace ROOT {
          return std::unique_ptr<T>(targetPtr);
       }
 
+      /// Merge all the thread private objects into a new instance of class T
+      /// with a tree reduction executed by the executor, e.g. to publish the
+      /// partial results periodically. The objects are merged in pairs into
+      /// new instances, which are then merged in pairs, and so on; the thread
+      /// private objects are only read. As for SnapshotMerge(), acceptable
+      /// behaviours while other threads fill the objects depend on T.
+      template <class Executor>
+      std::unique_ptr<T>
+      ParallelSnapshotMerge(Executor &executor,
+                            TThreadedObjectUtils::MergeFunctionType<T> mergeFunction = TThreadedObjectUtils::MergeTObjects<T>)
+      {
+         if (fIsMerged) {
+            Warning("TThreadedObject::ParallelSnapshotMerge", "This object was already merged. Returning the previous result.");
+            return std::unique_ptr<T>(Internal::TThreadedObjectUtils::Cloner<T>::Clone(fObjPointers[0].get()));
+         }
+         std::vector<std::shared_ptr<T>> objs;
+         for (auto &obj : fObjPointers) {
+            if (obj)
+               objs.emplace_back(obj);
+         }
+         if (objs.empty())
+            return std::unique_ptr<T>(Internal::TThreadedObjectUtils::Cloner<T>::Clone(fModel.get()));
+         // the first round merges pairs of thread private objects into new instances, created in this thread
+         std::vector<std::unique_ptr<T>> newObjs((objs.size() + 1) / 2);
+         std::vector<std::shared_ptr<T>> sums;
+         for (auto &newObj : newObjs) {
+            newObj.reset(Internal::TThreadedObjectUtils::Cloner<T>::Clone(fModel.get()));
+            sums.emplace_back(newObj.get(), [](T *) {});
+         }
+         std::vector<unsigned> indices(sums.size());
+         for (auto i = 0u; i < indices.size(); ++i)
+            indices[i] = i;
+         executor.Foreach(
+            [&](unsigned i) {
+               std::vector<std::shared_ptr<T>> pair{objs[2 * i]};
+               if (2 * i + 1 < objs.size())
+                  pair.emplace_back(objs[2 * i + 1]);
+               mergeFunction(sums[i], pair);
+            },
+            indices);
+         TreeMerge(executor, sums, mergeFunction);
+         return std::move(newObjs[0]);
+      }
+
    private:
       std::unique_ptr<T> fModel;                         ///< Use to store a "model" of the object
       // std::deque's guarantee that references to the elements are not invalidated when appending new slots
@@ -332,13 +429,52 @@ namespace ROOT {
       std::deque<TDirectory*> fDirectories;              ///< A TDirectory per slot
       std::map<std::thread::id, unsigned> fThrIDSlotMap; ///< A mapping between the thread IDs and the slots
       mutable ROOT::TSpinMutex fSpinMutex;               ///< Protects concurrent access to fThrIDSlotMap, fObjPointers
+      const std::uint64_t fObjectId;                     ///< Identifies this object in the slot caches of the threads
       bool fIsMerged : 1;                                ///< Remember if the objects have been merged already
 
-      /// Get the slot number for this threadID, make a slot if needed
+      /// Return the object pointer of the slot of this thread, creating the object if needed. The slot is
+      /// looked up in the cache of the thread first: the elements of fObjPointers and fDirectories do not move
+      /// when slots are added, so the cache can refer to them directly.
+      std::shared_ptr<T> &GetThisSlot()
+      {
+         auto &entry = Internal::TThreadedObjectUtils::GetSlotCacheEntry(fObjectId);
+         if (entry.fObjectId != fObjectId) {
+            std::lock_guard<ROOT::TSpinMutex> lg(fSpinMutex);
+            const auto slot = GetThisSlotNumber();
+            entry.fObjectId = fObjectId;
+            entry.fObject = &fObjPointers[slot];
+            entry.fDirectory = fDirectories[slot];
+         }
+         auto &objPointer = *static_cast<std::shared_ptr<T> *>(entry.fObject);
+         if (!objPointer)
+            objPointer.reset(Internal::TThreadedObjectUtils::Cloner<T>::Clone(fModel.get(), entry.fDirectory));
+         return objPointer;
+      }
+
+      /// Merge the objects in pairs, then the results in pairs, and so on, until objs[0] holds the sum of all of
+      /// them. The merges of each round are executed concurrently by the executor.
+      template <class Executor>
+      static void TreeMerge(Executor &executor, std::vector<std::shared_ptr<T>> &objs,
+                            const TThreadedObjectUtils::MergeFunctionType<T> &mergeFunction)
+      {
+         std::vector<unsigned> targets;
+         for (std::size_t stride = 1; stride < objs.size(); stride *= 2) {
+            targets.clear();
+            for (std::size_t i = 0; i + stride < objs.size(); i += 2 * stride)
+               targets.emplace_back(i);
+            executor.Foreach(
+               [&](unsigned i) {
+                  std::vector<std::shared_ptr<T>> pair{objs[i], objs[i + stride]};
+                  mergeFunction(objs[i], pair);
+               },
+               targets);
+         }
+      }
+
+      /// Get the slot number for this threadID, make a slot if needed. Must be called with fSpinMutex held.
       unsigned GetThisSlotNumber()
       {
          const auto thisThreadID = std::this_thread::get_id();
-         std::lock_guard<ROOT::TSpinMutex> lg(fSpinMutex);
          const auto thisSlotNumIt = fThrIDSlotMap.find(thisThreadID);
          if (thisSlotNumIt != fThrIDSlotMap.end())
             return thisSlotNumIt->second;
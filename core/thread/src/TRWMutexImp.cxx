@@ -97,6 +97,24 @@ void TRWMutexImp<MutexT, RecurseCountsT>::Apply(std::unique_ptr<TVirtualRWMutex:
    fMutexImp.Apply(std::move(delta));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the statistics of the lock acquisitions which had to wait.
+
+template <typename MutexT, typename RecurseCountsT>
+TVirtualRWMutex::ContentionStats TRWMutexImp<MutexT, RecurseCountsT>::GetContentionStats()
+{
+   return fMutexImp.GetContentionStats();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reset the statistics of the lock acquisitions.
+
+template <typename MutexT, typename RecurseCountsT>
+void TRWMutexImp<MutexT, RecurseCountsT>::ResetContentionStats()
+{
+   fMutexImp.ResetContentionStats();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get the mutex state *before* the current lock was taken. This function must
 /// only be called while the mutex is locked.
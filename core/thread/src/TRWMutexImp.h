@@ -32,6 +32,8 @@ public:
    std::unique_ptr<State> GetStateBefore() override;
    std::unique_ptr<StateDelta> Rewind(const State &earlierState) override;
    void Apply(std::unique_ptr<StateDelta> &&delta) override;
+   ContentionStats GetContentionStats() override;
+   void ResetContentionStats() override;
 
    ClassDefInlineOverride(TRWMutexImp,0)  // Concrete RW mutex lock class
 };
@@ -36,6 +36,7 @@ thus preventing starvation.
 #include "TMutex.h"
 #include "TError.h"
 #include <assert.h>
+#include <chrono>
 
 using namespace ROOT;
 
@@ -106,8 +107,12 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::ReadLock()
       // Wait for writers, if any
       if (fWriter && fRecurseCounts.IsNotCurrentWriter(local)) {
          auto readerCount = fRecurseCounts.GetLocalReadersCount(local);
-         if (readerCount == 0)
+         if (readerCount == 0) {
+            const auto start = std::chrono::steady_clock::now();
             fCond.wait(lock, [this] { return !fWriter; });
+            ++fStats.fNContendedReadLocks;
+            fStats.fReadWaitTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+         }
          // else
          //   There is a writer **but** we have outstanding readers
          //   locks, this must mean that the writer is actually
@@ -180,6 +185,11 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::WriteLock()
 
    fReaders -= readerCount;
 
+   ++fStats.fNWriteLocks;
+   // the waits are only timed if they are needed
+   bool contended = false;
+   std::chrono::steady_clock::time_point start;
+
    // Wait for other writers, if any
    if (fWriter && fRecurseCounts.IsNotCurrentWriter(local)) {
       if (readerCount && fReaders == 0) {
@@ -187,6 +197,8 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::WriteLock()
          // other writer.
          fCond.notify_all();
       }
+      contended = true;
+      start = std::chrono::steady_clock::now();
       fCond.wait(lock, [this] { return !fWriter; });
    }
 
@@ -199,8 +211,17 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::WriteLock()
    };
 
    // Wait for remaining readers
+   if (fReaders != 0 && !contended) {
+      contended = true;
+      start = std::chrono::steady_clock::now();
+   }
    fCond.wait(lock, [this] { return fReaders == 0; });
 
+   if (contended) {
+      ++fStats.fNContendedWriteLocks;
+      fStats.fWriteWaitTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+   }
+
    // Restore this thread's reader lock(s)
    fReaders += readerCount;
 
@@ -236,6 +257,25 @@ void TReentrantRWLock<MutexT, RecurseCountsT>::WriteUnLock(TVirtualRWMutex::Hint
       fCond.notify_all();
    }
 }
+
+//////////////////////////////////////////////////////////////////////////
+/// Return the statistics of the lock acquisitions which had to wait.
+template <typename MutexT, typename RecurseCountsT>
+TVirtualRWMutex::ContentionStats TReentrantRWLock<MutexT, RecurseCountsT>::GetContentionStats()
+{
+   std::lock_guard<MutexT> lock(fMutex);
+   return fStats;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Reset the statistics of the lock acquisitions.
+template <typename MutexT, typename RecurseCountsT>
+void TReentrantRWLock<MutexT, RecurseCountsT>::ResetContentionStats()
+{
+   std::lock_guard<MutexT> lock(fMutex);
+   fStats = TVirtualRWMutex::ContentionStats();
+}
+
 namespace {
 template <typename MutexT, typename RecurseCountsT>
 struct TReentrantRWLockState: public TVirtualRWMutex::State {
@@ -288,6 +288,8 @@ private:
 
    RecurseCountsT fRecurseCounts;        ///<! Trackers for re-entry in the lock by the same thread.
 
+   TVirtualRWMutex::ContentionStats fStats; ///<! Statistics of the waits, updated with fMutex held
+
    // size_t fWriteRecurse;                ///<! Number of re-entry in the lock by the same thread.
 
    // std::thread::id fWriterThread; ///<! Holder of the write lock
@@ -311,6 +313,9 @@ public:
    std::unique_ptr<State> GetStateBefore();
    std::unique_ptr<StateDelta> Rewind(const State &earlierState);
    void Apply(std::unique_ptr<StateDelta> &&delta);
+
+   TVirtualRWMutex::ContentionStats GetContentionStats();
+   void ResetContentionStats();
    };
 } // end of namespace ROOT
 
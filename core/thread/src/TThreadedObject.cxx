@@ -0,0 +1,46 @@
+// @(#)root/thread:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/TThreadedObject.hxx"
+
+#include <atomic>
+
+namespace ROOT {
+namespace Internal {
+namespace TThreadedObjectUtils {
+
+namespace {
+// Number of TThreadedObjects whose slot a thread remembers. Several objects are typically used in the same loop,
+// e.g. one per histogram being filled; objects with colliding identifiers fall back to the locked lookup.
+constexpr unsigned kSlotCacheSize = 16;
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return an identifier for a new TThreadedObject, unique during the lifetime of the process.
+/// Contrary to the address of the object, it is never reused, so that the slot caches of the threads never
+/// return the slot of a destroyed object.
+std::uint64_t NewObjectId()
+{
+   static std::atomic<std::uint64_t> gLastId{0};
+   return ++gLastId;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the entry of the slot cache of this thread where the slot of the given object is stored. The entry belongs
+/// to the object only if its fObjectId matches, otherwise the caller must look the slot up and store it there.
+SlotCacheEntry &GetSlotCacheEntry(std::uint64_t objectId)
+{
+   thread_local SlotCacheEntry cache[kSlotCacheSize];
+   return cache[objectId % kSlotCacheSize];
+}
+
+} // namespace TThreadedObjectUtils
+} // namespace Internal
+} // namespace ROOT
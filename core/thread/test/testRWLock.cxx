@@ -14,6 +14,10 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 using namespace ROOT;
 
 void testWriteLockV(TVirtualMutex *m, size_t repetition)
@@ -743,3 +747,45 @@ TEST(RWLock, VeryLargeconcurrentReadsTL)
 {
    concurrentReadsAndWrites(gRWMutexTL, 0, 200, gRepetition / 10000);
 }
+
+TEST(RWLock, ContentionStats)
+{
+   TRWMutexImp<std::mutex> m;
+   TVirtualRWMutex &vm = m;
+
+   // uncontended locks are counted but not timed
+   auto hint = vm.WriteLock();
+   vm.WriteUnLock(hint);
+   hint = vm.ReadLock();
+   vm.ReadUnLock(hint);
+   auto stats = vm.GetContentionStats();
+   EXPECT_EQ(1u, stats.fNWriteLocks);
+   EXPECT_EQ(0u, stats.fNContendedReadLocks);
+   EXPECT_EQ(0u, stats.fNContendedWriteLocks);
+   EXPECT_EQ(0., stats.fWriteWaitTime);
+
+   // a reader waits for the writer
+   hint = vm.WriteLock();
+   std::atomic<bool> started{false};
+   std::thread reader([&]() {
+      started = true;
+      auto h = vm.ReadLock();
+      vm.ReadUnLock(h);
+   });
+   while (!started) {
+   }
+   std::this_thread::sleep_for(std::chrono::milliseconds(50));
+   vm.WriteUnLock(hint);
+   reader.join();
+
+   stats = vm.GetContentionStats();
+   EXPECT_EQ(2u, stats.fNWriteLocks);
+   EXPECT_EQ(1u, stats.fNContendedReadLocks);
+   EXPECT_GT(stats.fReadWaitTime, 0.);
+
+   vm.ResetContentionStats();
+   stats = vm.GetContentionStats();
+   EXPECT_EQ(0u, stats.fNWriteLocks);
+   EXPECT_EQ(0u, stats.fNContendedReadLocks);
+   EXPECT_EQ(0., stats.fReadWaitTime);
+}
@@ -1,3 +1,4 @@
+#include "ROOT/TSequentialExecutor.hxx"
 #include "ROOT/TThreadedObject.hxx"
 #include "TH1F.h"
 #include "TRandom.h"
@@ -5,8 +6,23 @@
 #include "gtest/gtest.h"
 
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
+
+// Minimal executor running each task in its own thread, to merge concurrently without depending on Imt
+struct ThreadPerTaskExecutor {
+   template <class F>
+   void Foreach(F func, std::vector<unsigned> &args)
+   {
+      std::vector<std::thread> threads;
+      for (auto arg : args)
+         threads.emplace_back(func, arg);
+      for (auto &t : threads)
+         t.join();
+   }
+};
 
 void IsHistEqual(const TH1F &a, const TH1F &b)
 {
@@ -180,3 +196,68 @@ TEST(TThreadedObject, GetNSlots)
 
    EXPECT_EQ(tto.GetNSlots(), 4u);
 }
+
+TEST(TThreadedObject, ManyObjectsPerThread)
+{
+   // more objects than the slot cache of a thread can hold, used alternately by each thread
+   const int nObjs = 40, nThreads = 4, nIter = 100;
+   std::vector<std::unique_ptr<ROOT::TThreadedObject<int>>> ttos;
+   for (int i = 0; i < nObjs; ++i)
+      ttos.emplace_back(new ROOT::TThreadedObject<int>(ROOT::TNumSlots{1}, 0));
+   auto task = [&] {
+      for (int n = 0; n < nIter; ++n)
+         for (auto &tto : ttos)
+            ++*tto->Get();
+   };
+   std::vector<std::thread> threads;
+   for (int i = 0; i < nThreads; ++i)
+      threads.emplace_back(task);
+   for (auto &t : threads)
+      t.join();
+
+   auto sum_ints = [](std::shared_ptr<int> first, std::vector<std::shared_ptr<int>> &all) {
+      for (auto &e : all)
+         if (e != first)
+            *first += *e;
+   };
+   for (auto &tto : ttos) {
+      for (auto i = 0u; i < tto->GetNSlots(); ++i)
+         EXPECT_EQ(nIter, *tto->GetAtSlot(i));
+      EXPECT_EQ(nThreads * nIter, *tto->Merge(sum_ints));
+   }
+
+   // a new object never finds the slot of a destroyed one
+   ttos.clear();
+   ROOT::TThreadedObject<int> tto(ROOT::TNumSlots{0}, 42);
+   EXPECT_EQ(42, *tto.Get());
+}
+
+TEST(TThreadedObject, TreeMerge)
+{
+   TH1::AddDirectory(false);
+   const int nSlots = 7;
+
+   TH1F expected("h", "h", 64, -4, 4);
+   ROOT::TThreadedObject<TH1F> tto(ROOT::TNumSlots{nSlots}, "h", "h", 64, -4, 4);
+   gRandom->SetSeed(1);
+   for (int i = 0; i < nSlots; ++i) {
+      // leave one slot empty
+      if (i == 3)
+         continue;
+      tto.GetAtSlot(i)->FillRandom("gaus", 100 * (i + 1));
+      expected.Add(tto.GetAtSlot(i).get());
+   }
+
+   ThreadPerTaskExecutor executor;
+   auto snapshot0 = tto.ParallelSnapshotMerge(executor);
+   IsHistEqual(*snapshot0, expected);
+   ROOT::TSequentialExecutor sequential;
+   auto snapshot1 = tto.ParallelSnapshotMerge(sequential);
+   IsHistEqual(*snapshot1, expected);
+   // the thread private objects are left untouched by the snapshots
+   EXPECT_DOUBLE_EQ(100., tto.GetAtSlot(0)->GetEntries());
+
+   auto hsum = tto.ParallelMerge(executor);
+   IsHistEqual(*hsum, expected);
+   EXPECT_EQ(hsum, tto.GetAtSlot(0));
+}
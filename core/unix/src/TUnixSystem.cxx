@@ -42,6 +42,8 @@
 #include <map>
 #include <algorithm>
 #include <atomic>
+#include <climits>
+#include <vector>
 
 //#define G__OLDEXPAND
 
@@ -106,6 +108,7 @@
 #include <sys/time.h>
 #include <sys/file.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #if defined(R__AIX)
@@ -3394,6 +3397,74 @@ int TUnixSystem::SendRaw(int sock, const void *buf, int length, int opt)
    return n;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Send the nbuffers buffers as one stream with sendmsg(), without copying
+/// them into a contiguous buffer first. Only the default option is supported
+/// this way, other options are handled by TSystem::SendRawBuffers().
+/// Returns the total number of bytes sent or -1 in case of error.
+/// Returns -5 if pipe broken or reset by peer (EPIPE || ECONNRESET).
+
+int TUnixSystem::SendRawBuffers(int sock, const void *const *buffers, const int *lengths, int nbuffers, int opt)
+{
+   if (opt != kDefault)
+      return TSystem::SendRawBuffers(sock, buffers, lengths, nbuffers, opt);
+
+   if (sock < 0) return -1;
+
+   // sendmsg() accepts at most IOV_MAX vectors, larger lists are sent in several calls
+#ifdef IOV_MAX
+   const int maxiov = IOV_MAX;
+#else
+   const int maxiov = 16;
+#endif
+
+   int total = 0;
+   int first = 0;           // first buffer not completely sent
+   int offset = 0;          // bytes of the first buffer already sent
+   std::vector<struct iovec> iov;
+   while (first < nbuffers) {
+      iov.clear();
+      for (int i = first; i < nbuffers && (int)iov.size() < maxiov; ++i) {
+         int skip = (i == first) ? offset : 0;
+         if (lengths[i] - skip <= 0)
+            continue;
+         struct iovec v;
+         v.iov_base = (char *)buffers[i] + skip;
+         v.iov_len = lengths[i] - skip;
+         iov.push_back(v);
+      }
+      if (iov.empty())
+         break;
+
+      struct msghdr msg;
+      memset(&msg, 0, sizeof(msg));
+      msg.msg_iov = iov.data();
+      msg.msg_iovlen = iov.size();
+
+      ssize_t nsent = sendmsg(sock, &msg, 0);
+      if (nsent <= 0) {
+         if (nsent == 0)
+            break;
+         if (GetErrno() == EINTR)
+            continue;
+         ::SysError("TUnixSystem::SendRawBuffers", "sendmsg");
+         if (GetErrno() == EPIPE || GetErrno() == ECONNRESET)
+            return -5;
+         return -1;
+      }
+      total += nsent;
+
+      // advance over the buffers which were completely sent
+      while (first < nbuffers && nsent >= lengths[first] - offset) {
+         nsent -= std::max(0, lengths[first] - offset);
+         offset = 0;
+         ++first;
+      }
+      offset += nsent;
+   }
+   return total;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set socket option.
 
@@ -39,6 +39,11 @@ namespace ROOT {
 ///   [207 - 208]
 ///  - LZ4 is recommended to be used with compression level 4 [404]
 ///  - ZSTD is recommended to be used with compression level 5 [505]
+///
+/// The adaptive setting chooses the algorithm for every buffer: it estimates the entropy of a sample of the buffer
+/// and leaves buffers that look incompressible uncompressed. Otherwise, the level is the trade-off between CPU and
+/// size: levels 1-3 use LZ4, levels 4-6 ZSTD, and levels 7-9 LZMA for well compressible buffers and ZSTD for the
+/// others. The chosen algorithm is recorded in the header of each compressed block, so reading needs no setting.
 
 struct RCompressionSetting {
    struct EDefaults { /// Note: this is only temporarily a struct and will become a enum class hence the name convention
@@ -96,6 +101,8 @@ struct RCompressionSetting {
          kLZ4,
          /// Use ZSTD compression
          kZSTD,
+         /// Choose between no compression, LZ4, ZSTD and LZMA for every buffer, see above
+         kAdaptive,
          /// Undefined compression algorithm (must be kept the last of the list in case a new algorithm is added).
          kUndefined
       };
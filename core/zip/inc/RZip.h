@@ -33,6 +33,13 @@ extern "C" void R__unzip(int *srcsize, unsigned char *src, int *tgtsize, unsigne
 
 extern "C" int R__unzip_header(int *srcsize, unsigned char *src, int *tgtsize);
 
+/**
+ * Selects the implementation that R__unzip uses for zlib buffers and buffers of the old ROOT algorithm: "zlib" (the
+ * default) or "libdeflate", if ROOT is built with it. The output does not depend on the implementation. Returns 0,
+ * leaving the selection unchanged, if the implementation is unknown or not available.
+ */
+extern "C" int R__SetZLIBDecompressor(const char *name);
+
 enum { kMAXZIPBUF = 0xffffff };
 
 #endif
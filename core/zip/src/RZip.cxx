@@ -15,8 +15,14 @@
 #include "ZipZSTD.h"
 
 #include "zlib.h"
+#ifdef R__HAS_LIBDEFLATE
+#include <libdeflate.h>
+#endif
 
+#include <atomic>
+#include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <cassert>
 
 // The size of the ROOT block framing headers for compression:
@@ -25,6 +31,105 @@
 // - 3 bytes to identify the inflated buffer size.
 #define HDRSIZE 9
 
+namespace {
+
+/// The zlib streams of a thread. Resetting a stream is much cheaper than initializing a new one, which allocates
+/// and clears the window and hash tables, so the streams are kept across buffers.
+class RZlibThreadContext {
+   z_stream fDeflate;
+   z_stream fInflate;
+   int fDeflateLevel = -1; ///< -1 if fDeflate is not initialized
+   bool fHasInflate = false;
+#ifdef R__HAS_LIBDEFLATE
+   libdeflate_decompressor *fLibdeflate = nullptr;
+#endif
+
+   static void InitStream(z_stream &stream)
+   {
+      stream.zalloc = (alloc_func)0;
+      stream.zfree = (free_func)0;
+      stream.opaque = (voidpf)0;
+   }
+
+public:
+   ~RZlibThreadContext()
+   {
+      if (fDeflateLevel >= 0)
+         deflateEnd(&fDeflate);
+      if (fHasInflate)
+         inflateEnd(&fInflate);
+#ifdef R__HAS_LIBDEFLATE
+      if (fLibdeflate)
+         libdeflate_free_decompressor(fLibdeflate);
+#endif
+   }
+
+   /// Returns a deflate stream for the given level, ready for a new buffer; nullptr on error
+   z_stream *GetDeflate(int level)
+   {
+      if (fDeflateLevel == level) {
+         if (deflateReset(&fDeflate) == Z_OK)
+            return &fDeflate;
+      }
+      if (fDeflateLevel >= 0) {
+         deflateEnd(&fDeflate);
+         fDeflateLevel = -1;
+      }
+      InitStream(fDeflate);
+      int err = deflateInit(&fDeflate, level);
+      if (err != Z_OK) {
+         printf("error %d in deflateInit (zlib)\n", err);
+         return nullptr;
+      }
+      fDeflateLevel = level;
+      return &fDeflate;
+   }
+
+   /// Returns an inflate stream ready for a new buffer; nullptr on error
+   z_stream *GetInflate()
+   {
+      if (fHasInflate) {
+         if (inflateReset(&fInflate) == Z_OK)
+            return &fInflate;
+         inflateEnd(&fInflate);
+         fHasInflate = false;
+      }
+      InitStream(fInflate);
+      fInflate.next_in = Z_NULL;
+      fInflate.avail_in = 0;
+      int err = inflateInit(&fInflate);
+      if (err != Z_OK) {
+         fprintf(stderr, "R__unzip: error %d in inflateInit (zlib)\n", err);
+         return nullptr;
+      }
+      fHasInflate = true;
+      return &fInflate;
+   }
+
+#ifdef R__HAS_LIBDEFLATE
+   /// Returns the libdeflate decompressor of the thread; nullptr on error
+   libdeflate_decompressor *GetLibdeflate()
+   {
+      if (!fLibdeflate)
+         fLibdeflate = libdeflate_alloc_decompressor();
+      return fLibdeflate;
+   }
+#endif
+
+   static RZlibThreadContext &Get()
+   {
+      thread_local RZlibThreadContext context;
+      return context;
+   }
+};
+
+enum EZLIBDecompressor { kZLIBDecompressorZlib, kZLIBDecompressorLibdeflate };
+
+/// The implementation of the decompression of zlib and old ROOT buffers, see R__SetZLIBDecompressor
+std::atomic<int> gZLIBDecompressor{kZLIBDecompressorZlib};
+
+} // anonymous namespace
+
 /**
  * Forward decl's
  */
@@ -64,11 +169,89 @@ extern "C" void R__SetZipMode(ROOT::RCompressionSetting::EAlgorithm::EValues mod
    R__ZipMode = mode;
 }
 
+extern "C" int R__SetZLIBDecompressor(const char *name)
+{
+   if (!name)
+      return 0;
+   if (strcmp(name, "zlib") == 0) {
+      gZLIBDecompressor = kZLIBDecompressorZlib;
+      return 1;
+   }
+#ifdef R__HAS_LIBDEFLATE
+   if (strcmp(name, "libdeflate") == 0) {
+      gZLIBDecompressor = kZLIBDecompressorLibdeflate;
+      return 1;
+   }
+#endif
+   return 0;
+}
+
 unsigned long R__crc32(unsigned long crc, const unsigned char* buf, unsigned int len)
 {
    return crc32(crc, buf, len);
 }
 
+/// The number and size of the chunks of a buffer that R__estimateEntropy samples
+static const int kEntropyNSamples = 16;
+static const int kEntropySampleSize = 256;
+
+/**
+ * Estimate the order-0 entropy of the buffer in bits per byte, from up to kEntropyNSamples chunks spread over the
+ * buffer.
+ */
+static double R__estimateEntropy(const unsigned char *src, int srcsize)
+{
+   unsigned int counts[256] = {0};
+   int ntotal = 0;
+   if (srcsize <= kEntropyNSamples * kEntropySampleSize) {
+      for (int i = 0; i < srcsize; ++i)
+         counts[src[i]]++;
+      ntotal = srcsize;
+   } else {
+      const int stride = srcsize / kEntropyNSamples;
+      for (int s = 0; s < kEntropyNSamples; ++s) {
+         const unsigned char *chunk = src + s * stride;
+         for (int i = 0; i < kEntropySampleSize; ++i)
+            counts[chunk[i]]++;
+      }
+      ntotal = kEntropyNSamples * kEntropySampleSize;
+   }
+
+   double entropy = 0;
+   for (unsigned int c : counts) {
+      if (c == 0)
+         continue;
+      const double p = static_cast<double>(c) / ntotal;
+      entropy -= p * std::log2(p);
+   }
+   return entropy;
+}
+
+/**
+ * Choose the algorithm and level for a buffer compressed with the adaptive setting, see RCompressionSetting. Returns
+ * kUndefined if the buffer should not be compressed.
+ */
+static ROOT::RCompressionSetting::EAlgorithm::EValues R__chooseAlgorithm(int &cxlevel, const char *src, int srcsize)
+{
+   using EAlgorithm = ROOT::RCompressionSetting::EAlgorithm;
+   // Above this entropy, in bits per byte, the buffer is assumed to be incompressible. The estimate from a sample of
+   // random bytes is around 7.95.
+   static constexpr double kEntropyIncompressible = 7.9;
+   // Below this entropy, the gain of LZMA over ZSTD is worth its CPU time
+   static constexpr double kEntropyLZMA = 6.0;
+
+   const double entropy = R__estimateEntropy(reinterpret_cast<const unsigned char *>(src), srcsize);
+   if (entropy > kEntropyIncompressible)
+      return EAlgorithm::kUndefined;
+   if (cxlevel > 9)
+      cxlevel = 9;
+   if (cxlevel <= 3)
+      return EAlgorithm::kLZ4;
+   if (cxlevel <= 6 || entropy >= kEntropyLZMA)
+      return EAlgorithm::kZSTD;
+   return EAlgorithm::kLZMA;
+}
+
 /* int cxlevel;                      compression level */
 /* int  *srcsize, *tgtsize, *irep;   source and target sizes, replay */
 /* char *tgt, *src;                  source and target buffers */
@@ -76,6 +259,9 @@ unsigned long R__crc32(unsigned long crc, const unsigned char* buf, unsigned int
 /*                      1 = zlib */
 /*                      2 = lzma */
 /*                      3 = old */
+/*                      4 = lz4 */
+/*                      5 = zstd */
+/*                      6 = adaptive, see R__chooseAlgorithm */
 void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm)
 {
 
@@ -93,6 +279,14 @@ void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize,
     compressionAlgorithm = R__ZipMode;
   }
 
+  if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kAdaptive) {
+    compressionAlgorithm = R__chooseAlgorithm(cxlevel, src, *srcsize);
+    if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kUndefined) {
+      *irep = 0;
+      return;
+    }
+  }
+
   // The LZMA compression algorithm from the XZ package
   if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kLZMA) {
      R__zipLZMA(cxlevel, srcsize, src, tgtsize, tgt, irep);
@@ -179,7 +373,6 @@ static void R__zipZLIB(int cxlevel, int *srcsize, char *src, int *tgtsize, char
   int err;
   int method   = Z_DEFLATED;
 
-    z_stream stream;
     //Don't use the globals but want name similar to help see similarities in code
     unsigned l_in_size, l_out_size;
     *irep = 0;
@@ -193,40 +386,30 @@ static void R__zipZLIB(int cxlevel, int *srcsize, char *src, int *tgtsize, char
        return;
     }
 
-    stream.next_in   = (Bytef*)src;
-    stream.avail_in  = (uInt)(*srcsize);
-
-    stream.next_out  = (Bytef*)(&tgt[HDRSIZE]);
-    stream.avail_out = (uInt)(*tgtsize);
-
-    stream.zalloc    = (alloc_func)0;
-    stream.zfree     = (free_func)0;
-    stream.opaque    = (voidpf)0;
-
     if (cxlevel > 9) cxlevel = 9;
-    err = deflateInit(&stream, cxlevel);
-    if (err != Z_OK) {
-       printf("error %d in deflateInit (zlib)\n",err);
+    z_stream *stream = RZlibThreadContext::Get().GetDeflate(cxlevel);
+    if (!stream)
        return;
-    }
 
-    while ((err = deflate(&stream, Z_FINISH)) != Z_STREAM_END) {
+    stream->next_in   = (Bytef*)src;
+    stream->avail_in  = (uInt)(*srcsize);
+
+    stream->next_out  = (Bytef*)(&tgt[HDRSIZE]);
+    stream->avail_out = (uInt)(*tgtsize);
+
+    while ((err = deflate(stream, Z_FINISH)) != Z_STREAM_END) {
        if (err != Z_OK) {
-          deflateEnd(&stream);
+          // The stream is reset by the next call
           return;
        }
     }
 
-    err = deflateEnd(&stream);
-    if (err != Z_OK)
-       printf("error %d in deflateEnd (zlib)\n",err);
-
     tgt[0] = 'Z';               /* Signature ZLib */
     tgt[1] = 'L';
     tgt[2] = (char) method;
 
     l_in_size   = (unsigned) (*srcsize);
-    l_out_size  = stream.total_out;             /* compressed size */
+    l_out_size  = stream->total_out;            /* compressed size */
     tgt[3] = (char)(l_out_size & 0xff);
     tgt[4] = (char)((l_out_size >> 8) & 0xff);
     tgt[5] = (char)((l_out_size >> 16) & 0xff);
@@ -235,7 +418,7 @@ static void R__zipZLIB(int cxlevel, int *srcsize, char *src, int *tgtsize, char
     tgt[7] = (char)((l_in_size >> 8) & 0xff);
     tgt[8] = (char)((l_in_size >> 16) & 0xff);
 
-    *irep = stream.total_out + HDRSIZE;
+    *irep = stream->total_out + HDRSIZE;
 }
 
 
@@ -372,6 +555,21 @@ void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
    }
 
    /* Old zlib format */
+#ifdef R__HAS_LIBDEFLATE
+   if (gZLIBDecompressor == kZLIBDecompressorLibdeflate) {
+      // The old format is a raw deflate stream. If libdeflate fails, R__Inflate decompresses the buffer again and
+      // reports the error.
+      if (auto decompressor = RZlibThreadContext::Get().GetLibdeflate()) {
+         size_t nout = 0;
+         if (libdeflate_deflate_decompress(decompressor, ibufptr, ibufcnt, tgt, *tgtsize, &nout) ==
+                LIBDEFLATE_SUCCESS &&
+             static_cast<long>(nout) == isize) {
+            *irep = isize;
+            return;
+         }
+      }
+   }
+#endif
    if (R__Inflate(&ibufptr, &ibufcnt, &obufptr, &obufcnt)) {
       fprintf(stderr, "R__unzip: error during decompression\n");
       return;
@@ -391,33 +589,37 @@ void R__unzip(int *srcsize, uch *src, int *tgtsize, uch *tgt, int *irep)
 
 void R__unzipZLIB(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
-     z_stream stream; /* decompression stream */
-     int err = 0;
+#ifdef R__HAS_LIBDEFLATE
+     if (gZLIBDecompressor == kZLIBDecompressorLibdeflate) {
+        // On failure, zlib decompresses the buffer again and reports the error
+        if (auto decompressor = RZlibThreadContext::Get().GetLibdeflate()) {
+           size_t nout = 0;
+           if (libdeflate_zlib_decompress(decompressor, &src[HDRSIZE], *srcsize - HDRSIZE, tgt, *tgtsize, &nout) ==
+               LIBDEFLATE_SUCCESS) {
+              *irep = nout;
+              return;
+           }
+        }
+     }
+#endif
 
-     stream.next_in = (Bytef *)(&src[HDRSIZE]);
-     stream.avail_in = (uInt)(*srcsize) - HDRSIZE;
-     stream.next_out = (Bytef *)tgt;
-     stream.avail_out = (uInt)(*tgtsize);
-     stream.zalloc = (alloc_func)0;
-     stream.zfree = (free_func)0;
-     stream.opaque = (voidpf)0;
-
-     err = inflateInit(&stream);
-     if (err != Z_OK) {
-        fprintf(stderr, "R__unzip: error %d in inflateInit (zlib)\n", err);
+     z_stream *stream = RZlibThreadContext::Get().GetInflate(); /* decompression stream */
+     int err = 0;
+     if (!stream)
         return;
-     }
 
-     while ((err = inflate(&stream, Z_FINISH)) != Z_STREAM_END) {
+     stream->next_in = (Bytef *)(&src[HDRSIZE]);
+     stream->avail_in = (uInt)(*srcsize) - HDRSIZE;
+     stream->next_out = (Bytef *)tgt;
+     stream->avail_out = (uInt)(*tgtsize);
+
+     while ((err = inflate(stream, Z_FINISH)) != Z_STREAM_END) {
         if (err != Z_OK) {
-           inflateEnd(&stream);
            fprintf(stderr, "R__unzip: error %d in inflate (zlib)\n", err);
            return;
         }
      }
 
-     inflateEnd(&stream);
-
-     *irep = stream.total_out;
+     *irep = stream->total_out;
      return;
 }
@@ -10,6 +10,8 @@
 #ifndef ROOT_ZipZSTD
 #define ROOT_ZipZSTD
 
+#include <stddef.h>
+
 // NOTE: the ROOT compression libraries aren't consistently written in C++; hence the
 // #ifdef's to avoid problems with C code.
 #ifdef __cplusplus
@@ -17,6 +19,22 @@ extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+
+// Dictionaries make small buffers, e.g. small baskets or pages, compress much better. zstd stores the id of the
+// dictionary in the header of every frame compressed with it; R__unzipZSTD() uses the registered dictionary with
+// that id. Dictionaries stay registered until the end of the process.
+
+/// Train a dictionary from nSamples samples concatenated in samples; returns the dictionary size, 0 on error
+size_t R__zstdTrainDictionary(void *dictBuffer, size_t dictCapacity, const void *samples, const size_t *sampleSizes,
+                              unsigned nSamples);
+/// Register a dictionary, e.g. read back from a file, for compression and decompression. Returns its id, or 0 if
+/// dict is not a zstd dictionary.
+unsigned R__zstdRegisterDictionary(const void *dict, size_t dictSize);
+/// Copy the registered dictionary to buffer if it fits, e.g. to store it with the data. Returns the dictionary size,
+/// 0 if there is no such dictionary.
+size_t R__zstdGetDictionary(unsigned dictId, void *buffer, size_t capacity);
+/// Select the dictionary used by R__zipZSTD() on the calling thread, 0 for none. Returns the previous selection.
+unsigned R__zstdSetThreadDictionary(unsigned dictId);
 #ifdef __cplusplus
 }
 #endif
@@ -16,23 +16,153 @@
 #include <zstd.h>
 #include <memory>
 
+#include <algorithm>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
-void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+namespace {
+
+/// A registered dictionary with its digested forms; the compression one depends on the compression level
+struct RZstdDictionary {
+    std::vector<char> fDict;
+    std::unique_ptr<ZSTD_DDict, decltype(&ZSTD_freeDDict)> fDDict{nullptr, &ZSTD_freeDDict};
+    std::map<int, std::unique_ptr<ZSTD_CDict, decltype(&ZSTD_freeCDict)>> fCDicts;
+};
+
+std::mutex gDictionaryMutex;
+
+/// Entries are never removed, so that the pointers to them remain valid
+std::unordered_map<unsigned, std::unique_ptr<RZstdDictionary>> &GetDictionaries()
+{
+    static std::unordered_map<unsigned, std::unique_ptr<RZstdDictionary>> dictionaries;
+    return dictionaries;
+}
+
+RZstdDictionary *FindDictionary(unsigned dictId)
+{
+    std::lock_guard<std::mutex> lock(gDictionaryMutex);
+    auto itr = GetDictionaries().find(dictId);
+    return itr == GetDictionaries().end() ? nullptr : itr->second.get();
+}
+
+const ZSTD_CDict *GetCDict(RZstdDictionary &dict, int level)
+{
+    std::lock_guard<std::mutex> lock(gDictionaryMutex);
+    auto itr = dict.fCDicts.find(level);
+    if (itr == dict.fCDicts.end()) {
+        itr = dict.fCDicts
+                  .emplace(level, std::unique_ptr<ZSTD_CDict, decltype(&ZSTD_freeCDict)>(
+                                     ZSTD_createCDict(dict.fDict.data(), dict.fDict.size(), level), &ZSTD_freeCDict))
+                  .first;
+    }
+    return itr->second.get();
+}
+
+/// The dictionary selected for compression on this thread, with the digested form of the last compression level
+struct RThreadDictionary {
+    unsigned fId = 0;
+    RZstdDictionary *fDict = nullptr;
+    int fLevel = 0;
+    const ZSTD_CDict *fCDict = nullptr;
+};
+thread_local RThreadDictionary gThreadDictionary;
+
+// The contexts are reused by all the compressions and decompressions of a thread
+ZSTD_CCtx *GetThreadCCtx()
+{
+    thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> ctx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    return ctx.get();
+}
+
+ZSTD_DCtx *GetThreadDCtx()
+{
+    thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> ctx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    return ctx.get();
+}
+
+} // anonymous namespace
+
+size_t R__zstdTrainDictionary(void *dictBuffer, size_t dictCapacity, const void *samples, const size_t *sampleSizes,
+                              unsigned nSamples)
+{
+    size_t retval = ZDICT_trainFromBuffer(dictBuffer, dictCapacity, samples, sampleSizes, nSamples);
+    if (ZDICT_isError(retval)) {
+        std::cerr << "Error in training ZSTD dictionary. Type = " << ZDICT_getErrorName(retval) << std::endl;
+        return 0;
+    }
+    return retval;
+}
+
+unsigned R__zstdRegisterDictionary(const void *dict, size_t dictSize)
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
-    Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    unsigned dictId = ZDICT_getDictID(dict, dictSize);
+    if (dictId == 0)
+        return 0;
+
+    std::lock_guard<std::mutex> lock(gDictionaryMutex);
+    auto &entry = GetDictionaries()[dictId];
+    if (!entry) {
+        entry = std::make_unique<RZstdDictionary>();
+        entry->fDict.assign(static_cast<const char *>(dict), static_cast<const char *>(dict) + dictSize);
+        entry->fDDict.reset(ZSTD_createDDict(entry->fDict.data(), entry->fDict.size()));
+    }
+    return dictId;
+}
+
+size_t R__zstdGetDictionary(unsigned dictId, void *buffer, size_t capacity)
+{
+    RZstdDictionary *dict = FindDictionary(dictId);
+    if (!dict)
+        return 0;
+    if (dict->fDict.size() <= capacity)
+        std::copy(dict->fDict.begin(), dict->fDict.end(), static_cast<char *>(buffer));
+    return dict->fDict.size();
+}
+
+unsigned R__zstdSetThreadDictionary(unsigned dictId)
+{
+    unsigned previous = gThreadDictionary.fId;
+    if (dictId != previous)
+        gThreadDictionary = RThreadDictionary{dictId};
+    return previous;
+}
 
+void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
     *irep = 0;
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
-                                        &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+    auto &threadDict = gThreadDictionary;
+    if (threadDict.fId && !threadDict.fDict) {
+        threadDict.fDict = FindDictionary(threadDict.fId);
+        if (R__unlikely(!threadDict.fDict)) {
+            std::cerr << "Error in zip ZSTD. Dictionary " << threadDict.fId << " is not registered" << std::endl;
+            return;
+        }
+    }
+
+    size_t retval;
+    if (threadDict.fDict) {
+        if (!threadDict.fCDict || threadDict.fLevel != 2*cxlevel) {
+            threadDict.fLevel = 2*cxlevel;
+            threadDict.fCDict = GetCDict(*threadDict.fDict, threadDict.fLevel);
+        }
+        retval = ZSTD_compress_usingCDict(GetThreadCCtx(),
+                                          &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                          src, static_cast<size_t>(*srcsize),
+                                          threadDict.fCDict);
+    } else {
+        retval = ZSTD_compressCCtx(GetThreadCCtx(),
+                                   &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                   src, static_cast<size_t>(*srcsize),
+                                   2*cxlevel);
+    }
 
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
@@ -60,8 +190,6 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
 
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
-    using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
-    Ctx_ptr fCtx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
     *irep = 0;
 
     if (R__unlikely(src[0] != 'Z' || src[1] != 'S')) {
@@ -77,9 +205,24 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
-                                        (char *)tgt, static_cast<size_t>(*tgtsize),
-                                        (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    const size_t zsize = static_cast<size_t>(*srcsize - kHeaderSize);
+    unsigned dictId = ZSTD_getDictID_fromFrame(&src[kHeaderSize], zsize);
+    size_t retval;
+    if (dictId) {
+        RZstdDictionary *dict = FindDictionary(dictId);
+        if (R__unlikely(!dict)) {
+            std::cerr << "R__unzipZSTD: the buffer was compressed with the ZSTD dictionary " << dictId <<
+            ", which is not registered" << std::endl;
+            return;
+        }
+        retval = ZSTD_decompress_usingDDict(GetThreadDCtx(),
+                                            (char *)tgt, static_cast<size_t>(*tgtsize),
+                                            (char *)&src[kHeaderSize], zsize, dict->fDDict.get());
+    } else {
+        retval = ZSTD_decompressDCtx(GetThreadDCtx(),
+                                     (char *)tgt, static_cast<size_t>(*tgtsize),
+                                     (char *)&src[kHeaderSize], zsize);
+    }
 
     /* The error code 18446744073709551546 arises when the tgt buffer is too small
      * However this error is already handled outside of the compression algorithm
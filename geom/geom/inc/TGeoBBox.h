@@ -51,12 +51,16 @@ public:
                            Double_t *safe = nullptr) const override;
    void DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
                          Double_t *step) const override;
+   void DistFromInsideSoA(const Double_t *const *points, const Double_t *const *dirs, Double_t *dists, Int_t vecsize,
+                          const Double_t *step) const override;
    static Double_t DistFromInside(const Double_t *point, const Double_t *dir, Double_t dx, Double_t dy, Double_t dz,
                                   const Double_t *origin, Double_t stepmax = TGeoShape::Big());
    Double_t DistFromOutside(const Double_t *point, const Double_t *dir, Int_t iact = 1,
                             Double_t step = TGeoShape::Big(), Double_t *safe = nullptr) const override;
    void DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
                           Double_t *step) const override;
+   void DistFromOutsideSoA(const Double_t *const *points, const Double_t *const *dirs, Double_t *dists,
+                           Int_t vecsize, const Double_t *step) const override;
    static Double_t DistFromOutside(const Double_t *point, const Double_t *dir, Double_t dx, Double_t dy, Double_t dz,
                                    const Double_t *origin, Double_t stepmax = TGeoShape::Big());
    TGeoVolume *
@@ -0,0 +1,66 @@
+// @(#)root/geom:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TGeoBVHVoxelFinder
+#define ROOT_TGeoBVHVoxelFinder
+
+#include "TGeoVoxelFinder.h"
+
+#include <vector>
+
+class TGeoBVHVoxelFinder : public TGeoVoxelFinder {
+public:
+   enum { kMaxLeafSize = 8, kMaxDepth = 64 };
+
+protected:
+   /// Node of the hierarchy. Internal nodes have fCount = 0 and point to their two
+   /// children, leaves point to a range of fIndices.
+   struct BVHNode {
+      Double_t fMin[3]; // lower corner of the node box
+      Double_t fMax[3]; // upper corner of the node box
+      Int_t fFirst;     // left child, or first entry in fIndices for leaves
+      Int_t fRight;     // right child, unused for leaves
+      Int_t fCount;     // number of daughters in the leaf, 0 for internal nodes
+   };
+
+   std::vector<BVHNode> fTree;       //! nodes of the hierarchy, the root being the first one
+   std::vector<Int_t> fIndices;      //! daughter indices, ordered by leaf
+   std::vector<Double_t> fLeafBoxes; //! xmin, ymin, zmin, xmax, ymax, zmax arrays of the boxes in fIndices order
+   Int_t fDepth{0};                  //! depth of the hierarchy
+
+   void BuildTree();
+   Int_t BuildNode(std::vector<BVHNode> &tree, Int_t begin, Int_t end, Int_t depth, Int_t nparallel);
+   Bool_t CheckRebuild();
+
+private:
+   TGeoBVHVoxelFinder(const TGeoBVHVoxelFinder &) = delete;
+   TGeoBVHVoxelFinder &operator=(const TGeoBVHVoxelFinder &) = delete;
+
+public:
+   TGeoBVHVoxelFinder() {}
+   TGeoBVHVoxelFinder(TGeoVolume *vol);
+   ~TGeoBVHVoxelFinder() override;
+
+   using TGeoVoxelFinder::GetCheckList;
+
+   Double_t Efficiency() override;
+   Int_t *GetCheckList(const Double_t *point, Int_t &nelem, TGeoStateInfo &td) override;
+   Int_t *GetNextCandidates(const Double_t *point, Int_t &ncheck, TGeoStateInfo &td) override;
+   Int_t *GetNextVoxel(const Double_t *point, const Double_t *dir, Int_t &ncheck, TGeoStateInfo &td) override;
+   Int_t GetNnodes() const { return (Int_t)fTree.size(); }
+   Int_t GetDepth() const { return fDepth; }
+   void Print(Option_t *option = "") const override;
+   void SortCrossedVoxels(const Double_t *point, const Double_t *dir, TGeoStateInfo &td) override;
+   void Voxelize(Option_t *option = "") override;
+
+   ClassDefOverride(TGeoBVHVoxelFinder, 1) // bounding volume hierarchy of the daughter nodes
+};
+
+#endif
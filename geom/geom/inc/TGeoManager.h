@@ -12,6 +12,7 @@
 #ifndef ROOT_TGeoManager
 #define ROOT_TGeoManager
 
+#include <atomic>
 #include <mutex>
 #include <thread>
 #include <map>
@@ -47,6 +48,9 @@ public:
 
 protected:
    static std::mutex fgMutex;           //! mutex for navigator booking in MT mode
+   static std::mutex fgMapsMutex;       //! mutex protecting the maps of threads and navigators
+   static std::atomic<UInt_t> fgThreadsGeneration;    //! incremented when the thread ids cached by threads become invalid
+   static std::atomic<UInt_t> fgNavigatorsGeneration; //! incremented when the navigators cached by threads become invalid
    static Bool_t fgLock;                //! Lock preventing a second geometry to be loaded
    static Int_t fgVerboseLevel;         //! Verbosity level for Info messages (no IO).
    static Int_t fgMaxLevel;             //! Maximum level in geometry
@@ -106,6 +106,10 @@ public:
    virtual Double_t DistFromOutside(const Double_t *point, const Double_t *dir, Int_t iact = 1,
                                     Double_t step = TGeoShape::Big(), Double_t *safe = nullptr) const = 0;
    virtual void DistFromOutside_v(const Double_t *, const Double_t *, Double_t *, Int_t, Double_t *) const {}
+   virtual void DistFromInsideSoA(const Double_t *const *points, const Double_t *const *dirs, Double_t *dists,
+                                  Int_t vecsize, const Double_t *step) const;
+   virtual void DistFromOutsideSoA(const Double_t *const *points, const Double_t *const *dirs, Double_t *dists,
+                                   Int_t vecsize, const Double_t *step) const;
    static Double_t DistToPhiMin(const Double_t *point, const Double_t *dir, Double_t s1, Double_t c1, Double_t s2,
                                 Double_t c2, Double_t sm, Double_t cm, Bool_t in = kTRUE);
    virtual TGeoVolume *
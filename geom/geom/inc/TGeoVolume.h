@@ -79,7 +79,8 @@ public:
       kVoxelsCyl = BIT(21), // not used
       kVolumeClone = BIT(22),
       kVolumeAdded = BIT(23),
-      kVolumeOC = BIT(21) // overlapping candidates
+      kVolumeOC = BIT(21),  // overlapping candidates
+      kVoxelsBVH = BIT(24)  // voxels organized as bounding volume hierarchy
    };
    // constructors
    TGeoVolume();
@@ -148,6 +149,7 @@ public:
    Bool_t IsOverlappingCandidate() const { return TObject::TestBit(kVolumeOC); }
    Bool_t IsReplicated() const { return TObject::TestBit(kVolumeReplicated); }
    Bool_t IsSelected() const { return TObject::TestBit(kVolumeSelected); }
+   Bool_t IsBVHVoxels() const { return TObject::TestBit(kVoxelsBVH); }
    Bool_t IsCylVoxels() const { return TObject::TestBit(kVoxelsCyl); }
    Bool_t IsXYZVoxels() const { return TObject::TestBit(kVoxelsXYZ); }
    Bool_t IsTopVolume() const;
@@ -214,6 +216,7 @@ public:
    void SetAsTopVolume(); // *TOGGLE* *GETTER=IsTopVolume
    void SetAdded() { TObject::SetBit(kVolumeAdded); }
    void SetReplicated() { TObject::SetBit(kVolumeReplicated); }
+   void SetBVHVoxels(Bool_t flag = kTRUE);
    void SetCurrentPoint(Double_t x, Double_t y, Double_t z);
    void SetCylVoxels(Bool_t flag = kTRUE)
    {
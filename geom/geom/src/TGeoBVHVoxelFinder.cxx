@@ -0,0 +1,471 @@
+// @(#)root/geom:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TGeoBVHVoxelFinder
+\ingroup Geometry_classes
+
+Voxel finder organizing the bounding boxes of the daughters of a volume in a
+bounding volume hierarchy (BVH).
+
+The slices built by TGeoVoxelFinder become inefficient for volumes having
+thousands of daughters of very different sizes, since large daughters end up in
+many slices. The hierarchy is a binary tree of boxes built with the surface area
+heuristic, each daughter being referenced by exactly one leaf. The time to build
+it grows as N*log(N) with the number of daughters and, when implicit
+multi-threading is enabled, the upper levels of the tree are built in parallel.
+The leaves keep the boxes of their daughters as separate arrays of coordinates,
+so that they are tested with loops which the compiler can vectorize.
+
+The hierarchy is selected per volume before the geometry is closed:
+
+~~~ {.cpp}
+   calo->SetBVHVoxels();
+   gGeoManager->CloseGeometry();
+~~~
+
+The navigator uses it through the TGeoVoxelFinder interface. For a ray, all the
+daughters whose boxes are crossed within the current step are returned at once,
+ordered by the distance to their box, so that the step shrinks as early as
+possible. The hierarchy is not persistent and is rebuilt after reading.
+*/
+
+#include "TGeoBVHVoxelFinder.h"
+
+#include "TGeoBBox.h"
+#include "TGeoManager.h"
+#include "TGeoNode.h"
+#include "TGeoStateInfo.h"
+#include "TGeoVolume.h"
+#include "TMath.h"
+#include "TROOT.h"
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <utility>
+
+ClassImp(TGeoBVHVoxelFinder);
+
+namespace {
+
+constexpr Int_t kNbins = 16;            // number of bins used to evaluate the split positions
+constexpr Int_t kMinParallel = 4096;    // minimal number of daughters of a subtree built in a separate thread
+
+/// Half of the surface of a box
+Double_t HalfArea(const Double_t *bmin, const Double_t *bmax)
+{
+   Double_t dx = bmax[0] - bmin[0], dy = bmax[1] - bmin[1], dz = bmax[2] - bmin[2];
+   return dx * dy + dy * dz + dz * dx;
+}
+
+/// Extend box with another one
+void Grow(Double_t *bmin, Double_t *bmax, const Double_t *omin, const Double_t *omax)
+{
+   for (Int_t i = 0; i < 3; i++) {
+      bmin[i] = TMath::Min(bmin[i], omin[i]);
+      bmax[i] = TMath::Max(bmax[i], omax[i]);
+   }
+}
+
+/// Entry and exit distances of a ray on the slab [bmin, bmax] of one axis
+void Slab(Double_t p, Double_t d, Double_t inv, Double_t bmin, Double_t bmax, Double_t &tnear, Double_t &tfar)
+{
+   Double_t t1 = (bmin - p) * inv, t2 = (bmax - p) * inv;
+   Bool_t within = (p >= bmin) && (p <= bmax);
+   tnear = (d != 0) ? TMath::Min(t1, t2) : (within ? -TGeoShape::Big() : TGeoShape::Big());
+   tfar = (d != 0) ? TMath::Max(t1, t2) : (within ? TGeoShape::Big() : -TGeoShape::Big());
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor
+
+TGeoBVHVoxelFinder::TGeoBVHVoxelFinder(TGeoVolume *vol) : TGeoVoxelFinder(vol) {}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor
+
+TGeoBVHVoxelFinder::~TGeoBVHVoxelFinder() {}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the hierarchy if needed. Returns kFALSE if there is none.
+
+Bool_t TGeoBVHVoxelFinder::CheckRebuild()
+{
+   if (NeedRebuild() || fTree.empty()) {
+      Voxelize();
+      fVolume->FindOverlaps();
+   }
+   return !fTree.empty();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the hierarchy from the bounding boxes of the daughters, stored in fBoxes
+
+void TGeoBVHVoxelFinder::BuildTree()
+{
+   fTree.clear();
+   fIndices.clear();
+   fLeafBoxes.clear();
+   fDepth = 0;
+   Int_t nd = fVolume->GetNdaughters();
+   if (!nd || !fBoxes)
+      return;
+   fIndices.resize(nd);
+   std::iota(fIndices.begin(), fIndices.end(), 0);
+
+   Int_t nthreads = 1;
+   if (nd >= kMinParallel && ROOT::IsImplicitMTEnabled())
+      nthreads = TMath::Max(1, (Int_t)ROOT::GetThreadPoolSize());
+   fTree.reserve(2 * (nd / kMaxLeafSize + 1));
+   fDepth = BuildNode(fTree, 0, nd, 0, nthreads);
+
+   // boxes of the leaves, in the order of fIndices
+   const Double_t tol = TGeoShape::Tolerance();
+   fLeafBoxes.resize(6 * nd);
+   for (Int_t j = 0; j < nd; j++) {
+      const Double_t *box = &fBoxes[6 * fIndices[j]];
+      for (Int_t i = 0; i < 3; i++) {
+         fLeafBoxes[i * nd + j] = box[i + 3] - box[i] - tol;
+         fLeafBoxes[(i + 3) * nd + j] = box[i + 3] + box[i] + tol;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Append to tree the subtree of the daughters fIndices[begin, end) and return
+/// its depth. The subtree is split using the surface area heuristic evaluated on
+/// kNbins positions along the axis where the centers of the boxes spread most.
+/// The two halves of large subtrees are built in parallel when nparallel > 1.
+
+Int_t TGeoBVHVoxelFinder::BuildNode(std::vector<BVHNode> &tree, Int_t begin, Int_t end, Int_t depth, Int_t nparallel)
+{
+   const Double_t tol = TGeoShape::Tolerance();
+   Int_t inode = tree.size();
+   tree.emplace_back();
+   BVHNode node;
+   node.fFirst = begin;
+   node.fRight = -1;
+   node.fCount = end - begin;
+
+   // bounds of the boxes and of their centers
+   Double_t cmin[3], cmax[3];
+   for (Int_t i = 0; i < 3; i++) {
+      node.fMin[i] = cmin[i] = TGeoShape::Big();
+      node.fMax[i] = cmax[i] = -TGeoShape::Big();
+   }
+   for (Int_t j = begin; j < end; j++) {
+      const Double_t *box = &fBoxes[6 * fIndices[j]];
+      for (Int_t i = 0; i < 3; i++) {
+         node.fMin[i] = TMath::Min(node.fMin[i], box[i + 3] - box[i] - tol);
+         node.fMax[i] = TMath::Max(node.fMax[i], box[i + 3] + box[i] + tol);
+         cmin[i] = TMath::Min(cmin[i], box[i + 3]);
+         cmax[i] = TMath::Max(cmax[i], box[i + 3]);
+      }
+   }
+   Int_t n = end - begin;
+   Int_t axis = 0;
+   for (Int_t i = 1; i < 3; i++)
+      if (cmax[i] - cmin[i] > cmax[axis] - cmin[axis])
+         axis = i;
+   Double_t extent = cmax[axis] - cmin[axis];
+   if ((n == 1) || (depth >= kMaxDepth - 1) || (extent < tol)) {
+      tree[inode] = node;
+      return depth + 1;
+   }
+
+   // bin the centers along the axis and evaluate the cost of the splits between bins
+   Int_t counts[kNbins] = {0};
+   Double_t bmin[kNbins][3], bmax[kNbins][3];
+   for (Int_t b = 0; b < kNbins; b++)
+      for (Int_t i = 0; i < 3; i++) {
+         bmin[b][i] = TGeoShape::Big();
+         bmax[b][i] = -TGeoShape::Big();
+      }
+   const Double_t scale = kNbins / extent;
+   auto binOf = [&](Int_t id) {
+      return TMath::Min(kNbins - 1, (Int_t)((fBoxes[6 * id + 3 + axis] - cmin[axis]) * scale));
+   };
+   for (Int_t j = begin; j < end; j++) {
+      const Double_t *box = &fBoxes[6 * fIndices[j]];
+      Int_t b = binOf(fIndices[j]);
+      counts[b]++;
+      Double_t lo[3] = {box[3] - box[0], box[4] - box[1], box[5] - box[2]};
+      Double_t hi[3] = {box[3] + box[0], box[4] + box[1], box[5] + box[2]};
+      Grow(bmin[b], bmax[b], lo, hi);
+   }
+   Double_t rcost[kNbins];
+   Double_t rmin[3], rmax[3];
+   Int_t rcount = 0;
+   for (Int_t i = 0; i < 3; i++) {
+      rmin[i] = TGeoShape::Big();
+      rmax[i] = -TGeoShape::Big();
+   }
+   for (Int_t b = kNbins - 1; b > 0; b--) {
+      rcount += counts[b];
+      if (counts[b])
+         Grow(rmin, rmax, bmin[b], bmax[b]);
+      rcost[b] = rcount ? rcount * HalfArea(rmin, rmax) : 0.;
+   }
+   Double_t lmin[3], lmax[3];
+   Int_t lcount = 0;
+   for (Int_t i = 0; i < 3; i++) {
+      lmin[i] = TGeoShape::Big();
+      lmax[i] = -TGeoShape::Big();
+   }
+   Int_t split = -1;
+   Double_t best = TGeoShape::Big();
+   for (Int_t b = 0; b < kNbins - 1; b++) {
+      lcount += counts[b];
+      if (counts[b])
+         Grow(lmin, lmax, bmin[b], bmax[b]);
+      if (!lcount || (lcount == n))
+         continue;
+      Double_t cost = lcount * HalfArea(lmin, lmax) + rcost[b + 1];
+      if (cost < best) {
+         best = cost;
+         split = b + 1;
+      }
+   }
+   // keep small sets in one leaf if splitting does not reduce the cost of traversal
+   if ((n <= kMaxLeafSize) && ((split < 0) || (best >= n * HalfArea(node.fMin, node.fMax)))) {
+      tree[inode] = node;
+      return depth + 1;
+   }
+
+   Int_t *first = fIndices.data() + begin, *last = fIndices.data() + end;
+   Int_t *middle = first;
+   if (split > 0)
+      middle = std::partition(first, last, [&](Int_t id) { return binOf(id) < split; });
+   if ((middle == first) || (middle == last)) {
+      // all centers in one bin, split in the middle
+      middle = first + n / 2;
+      std::nth_element(first, middle, last, [&](Int_t a, Int_t b) {
+         return fBoxes[6 * a + 3 + axis] < fBoxes[6 * b + 3 + axis];
+      });
+   }
+   Int_t mid = begin + (middle - first);
+
+   node.fCount = 0;
+   Int_t ldepth = 0, rdepth = 0;
+   if ((nparallel > 1) && (n >= kMinParallel)) {
+      // build the two halves in separate trees and append them
+      std::vector<BVHNode> ltree, rtree;
+      std::thread worker([&]() { ldepth = BuildNode(ltree, begin, mid, depth + 1, nparallel / 2); });
+      rdepth = BuildNode(rtree, mid, end, depth + 1, nparallel - nparallel / 2);
+      worker.join();
+      auto append = [&tree](std::vector<BVHNode> &sub) {
+         Int_t offset = tree.size();
+         for (auto &child : sub) {
+            if (!child.fCount) {
+               child.fFirst += offset;
+               child.fRight += offset;
+            }
+            tree.push_back(child);
+         }
+         return offset;
+      };
+      node.fFirst = append(ltree);
+      node.fRight = append(rtree);
+   } else {
+      node.fFirst = tree.size();
+      ldepth = BuildNode(tree, begin, mid, depth + 1, 1);
+      node.fRight = tree.size();
+      rdepth = BuildNode(tree, mid, end, depth + 1, 1);
+   }
+   tree[inode] = node;
+   return TMath::Max(ldepth, rdepth);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the number of daughters per leaf and return its inverse
+
+Double_t TGeoBVHVoxelFinder::Efficiency()
+{
+   printf("Voxelization efficiency for %s\n", fVolume->GetName());
+   if (!CheckRebuild())
+      return 0.;
+   Int_t nleaves = 0;
+   for (auto &node : fTree)
+      if (node.fCount)
+         nleaves++;
+   Double_t eff = Double_t(nleaves) / fIndices.size();
+   printf("BVH with %d nodes, %d leaves, depth %d\n", (Int_t)fTree.size(), nleaves, fDepth);
+   printf("Total efficiency : %g\n", eff);
+   return eff;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the list of daughter indices for which point is inside their bbox
+
+Int_t *TGeoBVHVoxelFinder::GetCheckList(const Double_t *point, Int_t &nelem, TGeoStateInfo &td)
+{
+   nelem = 0;
+   td.fVoxNcandidates = 0;
+   if (!CheckRebuild())
+      return nullptr;
+   const Int_t nd = fIndices.size();
+   const Double_t *xmin = &fLeafBoxes[0], *ymin = xmin + nd, *zmin = ymin + nd;
+   const Double_t *xmax = zmin + nd, *ymax = xmax + nd, *zmax = ymax + nd;
+   const Double_t px = point[0], py = point[1], pz = point[2];
+   Int_t *list = td.fVoxCheckList;
+   Int_t stack[kMaxDepth + 2];
+   Int_t nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack) {
+      const BVHNode &node = fTree[stack[--nstack]];
+      if ((px < node.fMin[0]) || (px > node.fMax[0]) || (py < node.fMin[1]) || (py > node.fMax[1]) ||
+          (pz < node.fMin[2]) || (pz > node.fMax[2]))
+         continue;
+      if (!node.fCount) {
+         stack[nstack++] = node.fRight;
+         stack[nstack++] = node.fFirst;
+         continue;
+      }
+      for (Int_t j = node.fFirst; j < node.fFirst + node.fCount; j++) {
+         Bool_t inside = (px >= xmin[j]) & (px <= xmax[j]) & (py >= ymin[j]) & (py <= ymax[j]) & (pz >= zmin[j]) &
+                         (pz <= zmax[j]);
+         list[nelem] = fIndices[j];
+         nelem += inside;
+      }
+   }
+   td.fVoxNcandidates = nelem;
+   return nelem ? list : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// All candidates crossed by the ray are returned with the first voxel
+
+Int_t *TGeoBVHVoxelFinder::GetNextCandidates(const Double_t * /*point*/, Int_t &ncheck, TGeoStateInfo & /*td*/)
+{
+   ncheck = 0;
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the list of candidates sorted by SortCrossedVoxels() at the first call,
+/// nullptr afterwards
+
+Int_t *TGeoBVHVoxelFinder::GetNextVoxel(const Double_t *point, const Double_t * /*dir*/, Int_t &ncheck,
+                                        TGeoStateInfo &td)
+{
+   if (td.fVoxCurrent == 0) {
+      td.fVoxCurrent++;
+      ncheck = td.fVoxNcandidates;
+      return ncheck ? td.fVoxCheckList : nullptr;
+   }
+   td.fVoxCurrent++;
+   return GetNextCandidates(point, ncheck, td);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the hierarchy
+
+void TGeoBVHVoxelFinder::Print(Option_t *) const
+{
+   printf("BVH voxels for volume %s (nd=%i)\n", fVolume->GetName(), fVolume->GetNdaughters());
+   printf("   %d nodes, depth %d\n", (Int_t)fTree.size(), fDepth);
+   for (UInt_t inode = 0; inode < fTree.size(); inode++) {
+      const BVHNode &node = fTree[inode];
+      printf("   node %u: (%g, %g, %g) - (%g, %g, %g)", inode, node.fMin[0], node.fMin[1], node.fMin[2], node.fMax[0],
+             node.fMax[1], node.fMax[2]);
+      if (!node.fCount) {
+         printf(" children %d %d\n", node.fFirst, node.fRight);
+         continue;
+      }
+      printf(" daughters");
+      for (Int_t j = node.fFirst; j < node.fFirst + node.fCount; j++)
+         printf(" %d", fIndices[j]);
+      printf("\n");
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Collect the daughters whose boxes are crossed by the ray within the current
+/// step of the navigator, ordered by the distance to their box
+
+void TGeoBVHVoxelFinder::SortCrossedVoxels(const Double_t *point, const Double_t *dir, TGeoStateInfo &td)
+{
+   td.fVoxCurrent = 0;
+   td.fVoxNcandidates = 0;
+   if (!CheckRebuild())
+      return;
+   const Int_t nd = fIndices.size();
+   const Double_t *xmin = &fLeafBoxes[0], *ymin = xmin + nd, *zmin = ymin + nd;
+   const Double_t *xmax = zmin + nd, *ymax = xmax + nd, *zmax = ymax + nd;
+   const Double_t px = point[0], py = point[1], pz = point[2];
+   const Double_t ux = dir[0], uy = dir[1], uz = dir[2];
+   const Double_t ix = (ux != 0) ? 1. / ux : 0., iy = (uy != 0) ? 1. / uy : 0., iz = (uz != 0) ? 1. / uz : 0.;
+   const Double_t maxstep = gGeoManager->GetStep();
+
+   thread_local std::vector<std::pair<Double_t, Int_t>> crossed;
+   crossed.clear();
+   Double_t entry[kMaxLeafSize];
+   Int_t stack[kMaxDepth + 2];
+   Int_t nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack) {
+      const BVHNode &node = fTree[stack[--nstack]];
+      Double_t nx, fx, ny, fy, nz, fz;
+      Slab(px, ux, ix, node.fMin[0], node.fMax[0], nx, fx);
+      Slab(py, uy, iy, node.fMin[1], node.fMax[1], ny, fy);
+      Slab(pz, uz, iz, node.fMin[2], node.fMax[2], nz, fz);
+      Double_t tin = TMath::Max(nx, TMath::Max(ny, nz));
+      Double_t tout = TMath::Min(fx, TMath::Min(fy, fz));
+      if ((tin > tout) || (tout < 0) || (tin > maxstep))
+         continue;
+      if (!node.fCount) {
+         stack[nstack++] = node.fRight;
+         stack[nstack++] = node.fFirst;
+         continue;
+      }
+      // test the boxes of the leaf by chunks of kMaxLeafSize
+      for (Int_t first = node.fFirst; first < node.fFirst + node.fCount; first += kMaxLeafSize) {
+         Int_t ncheck = TMath::Min((Int_t)kMaxLeafSize, node.fFirst + node.fCount - first);
+         for (Int_t k = 0; k < ncheck; k++) {
+            Int_t j = first + k;
+            Slab(px, ux, ix, xmin[j], xmax[j], nx, fx);
+            Slab(py, uy, iy, ymin[j], ymax[j], ny, fy);
+            Slab(pz, uz, iz, zmin[j], zmax[j], nz, fz);
+            Double_t t1 = TMath::Max(nx, TMath::Max(ny, nz));
+            Double_t t2 = TMath::Min(fx, TMath::Min(fy, fz));
+            entry[k] = ((t1 <= t2) && (t2 >= 0) && (t1 <= maxstep)) ? TMath::Max(t1, 0.) : -1.;
+         }
+         for (Int_t k = 0; k < ncheck; k++)
+            if (entry[k] >= 0)
+               crossed.emplace_back(entry[k], fIndices[first + k]);
+      }
+   }
+   std::sort(crossed.begin(), crossed.end());
+   for (auto &cand : crossed)
+      td.fVoxCheckList[td.fVoxNcandidates++] = cand.second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the hierarchy for the attached volume.
+/// If the volume is an assembly, make sure the bbox is computed.
+
+void TGeoBVHVoxelFinder::Voxelize(Option_t * /*option*/)
+{
+   if (fVolume->IsAssembly())
+      fVolume->GetShape()->ComputeBBox();
+   Int_t nd = fVolume->GetNdaughters();
+   for (Int_t i = 0; i < nd; i++) {
+      TGeoVolume *vd = fVolume->GetNode(i)->GetVolume();
+      if (vd->IsAssembly())
+         vd->GetShape()->ComputeBBox();
+   }
+   BuildVoxelLimits();
+   BuildTree();
+   if (fTree.empty())
+      SetInvalid();
+   SetNeedRebuild(kFALSE);
+}
@@ -249,6 +249,9 @@ in order to enhance rays.
 #include "TClass.h"
 #include "ThreadLocalStorage.h"
 #include "TBufferText.h"
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 #include "TGeoVoxelFinder.h"
 #include "TGeoElement.h"
@@ -279,6 +282,7 @@ in order to enhance rays.
 #include "TQObject.h"
 #include "TMath.h"
 #include "TEnv.h"
+#include "TSystem.h"
 #include "TGeoParallelWorld.h"
 #include "TGeoRegion.h"
 #include "TGDMLMatrix.h"
@@ -291,6 +295,9 @@ TGeoManager *gGeoManager = nullptr;
 ClassImp(TGeoManager);
 
 std::mutex TGeoManager::fgMutex;
+std::mutex TGeoManager::fgMapsMutex;
+std::atomic<UInt_t> TGeoManager::fgThreadsGeneration{0};
+std::atomic<UInt_t> TGeoManager::fgNavigatorsGeneration{0};
 Bool_t TGeoManager::fgLock = kFALSE;
 Bool_t TGeoManager::fgLockNavigators = kFALSE;
 Int_t TGeoManager::fgVerboseLevel = 1;
@@ -786,45 +793,59 @@ Int_t TGeoManager::AddVolume(TGeoVolume *volume)
 
 TGeoNavigator *TGeoManager::AddNavigator()
 {
-   if (fMultiThread) {
+   if (fMultiThread)
       TGeoManager::ThreadId();
-      fgMutex.lock();
-   }
    std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   TGeoNavigatorArray *array = 0;
-   if (it != fNavigators.end())
-      array = it->second;
-   else {
-      array = new TGeoNavigatorArray(this);
-      fNavigators.insert(NavigatorsMap_t::value_type(threadId, array));
+   TGeoNavigatorArray *array = nullptr;
+   {
+      std::unique_lock<std::mutex> guard(fgMapsMutex, std::defer_lock);
+      if (fMultiThread)
+         guard.lock();
+      NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
+      if (it != fNavigators.end())
+         array = it->second;
+      else {
+         array = new TGeoNavigatorArray(this);
+         fNavigators.insert(NavigatorsMap_t::value_type(threadId, array));
+      }
    }
+   // the array is only used by the calling thread
    TGeoNavigator *nav = array->AddNavigator();
    if (fClosed)
       nav->GetCache()->BuildInfoBranch();
-   if (fMultiThread)
-      fgMutex.unlock();
+   fgNavigatorsGeneration++;
    return nav;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns current navigator for the calling thread.
+///
+/// In multi-threaded mode the navigator is cached by the calling thread, so that
+/// the map of navigators is looked up only after the navigators were changed.
 
 TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 {
-   TTHREAD_TLS(TGeoNavigator *) tnav = 0;
    if (!fMultiThread)
       return fCurrentNavigator;
-   TGeoNavigator *nav = tnav; // TTHREAD_TLS_GET(TGeoNavigator*,tnav);
-   if (nav)
-      return nav;
-   std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end())
-      return 0;
-   TGeoNavigatorArray *array = it->second;
-   nav = array->GetCurrentNavigator();
-   tnav = nav; // TTHREAD_TLS_SET(TGeoNavigator*,tnav,nav);
+   struct TCachedNavigator {
+      const TGeoManager *fManager;
+      UInt_t fGeneration;
+      TGeoNavigator *fNavigator;
+   };
+   TTHREAD_TLS(TCachedNavigator) cached = {nullptr, 0, nullptr};
+   UInt_t generation = fgNavigatorsGeneration.load(std::memory_order_acquire);
+   if (cached.fNavigator && (cached.fManager == this) && (cached.fGeneration == generation))
+      return cached.fNavigator;
+   TGeoNavigator *nav = nullptr;
+   {
+      std::lock_guard<std::mutex> guard(fgMapsMutex);
+      generation = fgNavigatorsGeneration.load(std::memory_order_acquire);
+      NavigatorsMap_t::const_iterator it = fNavigators.find(std::this_thread::get_id());
+      if (it == fNavigators.end())
+         return nullptr;
+      nav = it->second->GetCurrentNavigator();
+   }
+   cached = {this, generation, nav};
    return nav;
 }
 
@@ -833,6 +854,9 @@ TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 
 TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 {
+   std::unique_lock<std::mutex> guard(fgMapsMutex, std::defer_lock);
+   if (fMultiThread)
+      guard.lock();
    std::thread::id threadId = std::this_thread::get_id();
    NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
    if (it == fNavigators.end())
@@ -847,13 +871,12 @@ TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 Bool_t TGeoManager::SetCurrentNavigator(Int_t index)
 {
    std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end()) {
+   TGeoNavigatorArray *array = GetListOfNavigators();
+   if (!array) {
       Error("SetCurrentNavigator", "No navigator defined for this thread\n");
       std::cout << "  thread id: " << threadId << std::endl;
       return kFALSE;
    }
-   TGeoNavigatorArray *array = it->second;
    TGeoNavigator *nav = array->SetCurrentNavigator(index);
    if (!nav) {
       Error("SetCurrentNavigator", "Navigator %d not existing for this thread\n", index);
@@ -862,6 +885,7 @@ Bool_t TGeoManager::SetCurrentNavigator(Int_t index)
    }
    if (!fMultiThread)
       fCurrentNavigator = nav;
+   fgNavigatorsGeneration++;
    return kTRUE;
 }
 
@@ -878,8 +902,9 @@ void TGeoManager::SetNavigatorsLock(Bool_t flag)
 
 void TGeoManager::ClearNavigators()
 {
+   std::unique_lock<std::mutex> guard(fgMapsMutex, std::defer_lock);
    if (fMultiThread)
-      fgMutex.lock();
+      guard.lock();
    TGeoNavigatorArray *arr = 0;
    for (NavigatorsMap_t::iterator it = fNavigators.begin(); it != fNavigators.end(); ++it) {
       arr = (*it).second;
@@ -887,8 +912,7 @@ void TGeoManager::ClearNavigators()
          delete arr;
    }
    fNavigators.clear();
-   if (fMultiThread)
-      fgMutex.unlock();
+   fgNavigatorsGeneration++;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -896,8 +920,9 @@ void TGeoManager::ClearNavigators()
 
 void TGeoManager::RemoveNavigator(const TGeoNavigator *nav)
 {
+   std::unique_lock<std::mutex> guard(fgMapsMutex, std::defer_lock);
    if (fMultiThread)
-      fgMutex.lock();
+      guard.lock();
    for (NavigatorsMap_t::iterator it = fNavigators.begin(); it != fNavigators.end(); ++it) {
       TGeoNavigatorArray *arr = (*it).second;
       if (arr) {
@@ -905,15 +930,12 @@ void TGeoManager::RemoveNavigator(const TGeoNavigator *nav)
             delete nav;
             if (!arr->GetEntries())
                fNavigators.erase(it);
-            if (fMultiThread)
-               fgMutex.unlock();
+            fgNavigatorsGeneration++;
             return;
          }
       }
    }
    Error("Remove navigator", "Navigator %p not found", nav);
-   if (fMultiThread)
-      fgMutex.unlock();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -983,36 +1005,46 @@ void TGeoManager::ClearThreadsMap()
 {
    if (gGeoManager && !gGeoManager->IsMultiThread())
       return;
-   fgMutex.lock();
+   std::lock_guard<std::mutex> guard(fgMapsMutex);
    if (!fgThreadId->empty())
       fgThreadId->clear();
    fgNumThreads = 0;
-   fgMutex.unlock();
+   fgThreadsGeneration++;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Translates the current thread id to an ordinal number. This can be used to
 /// manage data which is specific for a given thread.
+///
+/// The number is cached by the calling thread, the map of threads is only looked
+/// up at the first call and after the map was cleared.
 
 Int_t TGeoManager::ThreadId()
 {
-   TTHREAD_TLS(Int_t) tid = -1;
-   Int_t ttid = tid; // TTHREAD_TLS_GET(Int_t,tid);
-   if (ttid > -1)
-      return ttid;
+   struct TCachedId {
+      UInt_t fGeneration;
+      Int_t fId;
+   };
+   TTHREAD_TLS(TCachedId) cached = {0, -1};
+   UInt_t generation = fgThreadsGeneration.load(std::memory_order_acquire);
+   if ((cached.fId > -1) && (cached.fGeneration == generation))
+      return cached.fId;
    if (gGeoManager && !gGeoManager->IsMultiThread())
       return 0;
    std::thread::id threadId = std::this_thread::get_id();
+   std::lock_guard<std::mutex> guard(fgMapsMutex);
+   generation = fgThreadsGeneration.load(std::memory_order_acquire);
+   Int_t tid;
    TGeoManager::ThreadsMapIt_t it = fgThreadId->find(threadId);
-   if (it != fgThreadId->end())
-      return it->second;
-   // Map needs to be updated.
-   fgMutex.lock();
-   (*fgThreadId)[threadId] = fgNumThreads;
-   tid = fgNumThreads; // TTHREAD_TLS_SET(Int_t,tid,fgNumThreads);
-   ttid = fgNumThreads++;
-   fgMutex.unlock();
-   return ttid;
+   if (it != fgThreadId->end()) {
+      tid = it->second;
+   } else {
+      // Map needs to be updated.
+      tid = fgNumThreads++;
+      (*fgThreadId)[threadId] = tid;
+   }
+   cached = {generation, tid};
+   return tid;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3122,7 +3154,8 @@ void TGeoManager::RestoreMasterVolume()
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Voxelize all non-divided volumes.
+/// Voxelize all non-divided volumes. When implicit multi-threading is enabled,
+/// the volumes are voxelized in parallel.
 
 void TGeoManager::Voxelize(Option_t *option)
 {
@@ -3130,6 +3163,27 @@ void TGeoManager::Voxelize(Option_t *option)
    //   TGeoVoxelFinder *vox = 0;
    if (!fStreamVoxels && fgVerboseLevel > 0)
       Info("Voxelize", "Voxelizing...");
+#ifdef R__USE_IMT
+   if (!fStreamVoxels && ROOT::IsImplicitMTEnabled() && (fVolumes->GetEntriesFast() > 1)) {
+      // Volumes are voxelized in parallel. Everything shared between volumes is
+      // prepared first: the order of the nodes and the bounding boxes of assemblies.
+      std::vector<TGeoVolume *> volumes;
+      TIter nextvol(fVolumes);
+      while ((vol = (TGeoVolume *)nextvol())) {
+         if (!fIsGeomReading)
+            vol->SortNodes();
+         if (vol->IsAssembly())
+            vol->GetShape()->ComputeBBox();
+         volumes.push_back(vol);
+      }
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([option](TGeoVolume *v) { v->Voxelize(option); }, volumes);
+      if (!fIsGeomReading)
+         for (auto v : volumes)
+            v->FindOverlaps();
+      return;
+   }
+#endif
    //   Int_t nentries = fVolumes->GetSize();
    TIter next(fVolumes);
    while ((vol = (TGeoVolume *)next())) {
@@ -4088,10 +4142,16 @@ void TGeoManager::SetVerboseLevel(Int_t vl)
 ///    Import in memory from filename the geometry with key=name.
 ///    if name="" (default), the first TGeoManager object in the file is returned.
 ///
+/// For GDML files, the option "cache" (or Geometry.GDMLCache set in .rootrc)
+/// keeps a copy of the closed geometry, including the voxels, in a ROOT file
+/// named after the GDML file (detector_gdml.root for detector.gdml). This copy is imported instead of parsing the GDML file as
+/// long as it is not older than the GDML file, which avoids both the parsing
+/// and the voxelization of the geometry.
+///
 /// Note that this function deletes the current gGeoManager (if one)
 /// before importing the new object.
 
-TGeoManager *TGeoManager::Import(const char *filename, const char *name, Option_t * /*option*/)
+TGeoManager *TGeoManager::Import(const char *filename, const char *name, Option_t *option)
 {
    if (fgLock) {
       ::Warning("TGeoManager::Import", "TGeoMananager in lock mode. NOT IMPORTING new geometry");
@@ -4106,6 +4166,26 @@ TGeoManager *TGeoManager::Import(const char *filename, const char *name, Option_
       delete gGeoManager;
    gGeoManager = nullptr;
 
+   TString opt(option);
+   opt.ToLower();
+   Bool_t usecache = opt.Contains("cache") || gEnv->GetValue("Geometry.GDMLCache", 0);
+   TString cachefile;
+   if (strstr(filename, ".gdml") && usecache) {
+      // the name of the cache must not contain ".gdml", see Export()
+      cachefile = filename;
+      cachefile.Replace(cachefile.Index(".gdml"), 5, "_gdml");
+      cachefile += ".root";
+      FileStat_t gdmlstat, cachestat;
+      if (!gSystem->GetPathInfo(filename, gdmlstat) && !gSystem->GetPathInfo(cachefile, cachestat) &&
+          (cachestat.fMtime >= gdmlstat.fMtime)) {
+         if (fgVerboseLevel > 0)
+            ::Info("TGeoManager::Import", "Using geometry cache: %s", cachefile.Data());
+         if (Import(cachefile, name))
+            return gGeoManager;
+         ::Warning("TGeoManager::Import", "Cannot read geometry cache %s, parsing %s", cachefile.Data(), filename);
+      }
+   }
+
    if (strstr(filename, ".gdml")) {
       // import from a gdml file
       new TGeoManager("GDMLImport", "Geometry imported from GDML");
@@ -4120,6 +4200,9 @@ TGeoManager *TGeoManager::Import(const char *filename, const char *name, Option_
          gGeoManager->SetTopVolume(world);
          gGeoManager->CloseGeometry();
          gGeoManager->DefaultColors();
+         TString cachedir = gSystem->GetDirName(cachefile);
+         if (!cachefile.IsNull() && !gSystem->AccessPathName(cachedir, kWritePermission))
+            gGeoManager->Export(cachefile, "", "v");
       }
    } else {
       // import from a root file
@@ -43,6 +43,8 @@ gGeoManager->SetCurrentNavigator(0);
 #include "TGeoParallelWorld.h"
 #include "TGeoPhysicalNode.h"
 
+#include <vector>
+
 static Double_t gTolerance = TGeoShape::Tolerance();
 const char *kGeoOutsidePath = " ";
 const Int_t kN3 = 3 * sizeof(Double_t);
@@ -976,6 +978,104 @@ TGeoNode *TGeoNavigator::FindNextBoundary(Double_t stepmax, const char *path, Bo
    return fNextNode;
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Convert a basket of points (vect = kFALSE) or directions (vect = kTRUE) given
+/// as x, y and z arrays from the master frame to the local frame of the matrix.
+
+void MasterToLocalSoA(const TGeoMatrix *mat, const Double_t *const *in, Double_t *const *out, Int_t n, Bool_t vect)
+{
+   const Double_t *tr = mat->GetTranslation();
+   const Double_t *rot = mat->GetRotationMatrix();
+   const Bool_t identity = mat->IsIdentity();
+   const Bool_t rotation = mat->IsRotation();
+   const Double_t t0 = (vect || identity) ? 0. : tr[0];
+   const Double_t t1 = (vect || identity) ? 0. : tr[1];
+   const Double_t t2 = (vect || identity) ? 0. : tr[2];
+   for (Int_t k = 0; k < 3; k++) {
+      Double_t *o = out[k];
+      const Double_t *x = in[0], *y = in[1], *z = in[2];
+      if (!rotation) {
+         const Double_t *c = in[k];
+         const Double_t t = (k == 0) ? t0 : ((k == 1) ? t1 : t2);
+         for (Int_t i = 0; i < n; i++)
+            o[i] = c[i] - t;
+         continue;
+      }
+      const Double_t r0 = rot[k], r1 = rot[k + 3], r2 = rot[k + 6];
+      for (Int_t i = 0; i < n; i++)
+         o[i] = (x[i] - t0) * r0 + (y[i] - t1) * r1 + (z[i] - t2) * r2;
+   }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the distances to the next boundary for a basket of tracks located in
+/// the current volume. The points and directions are given in the master frame
+/// as arrays of x, y and z coordinates (points[0], points[1], points[2]). For
+/// each track, steps[i] is set to the distance to the next boundary and
+/// idaughters[i] to the index of the daughter node which is entered, -1 when
+/// leaving the current volume and -2 when no boundary is reached within stepmax[i].
+///
+/// The distances are computed once per shape for the whole basket with
+/// TGeoShape::DistFromInsideSoA() and TGeoShape::DistFromOutsideSoA(), which are
+/// vectorized for the most common shapes. All the daughters are checked, the
+/// voxelization is not used, therefore this is faster than FindNextBoundary()
+/// for baskets of tracks in volumes with few daughters. Overlapping (MANY)
+/// nodes and parallel worlds are not considered. The state of the navigator is
+/// not changed, except that the navigator goes up from assemblies like
+/// FindNextBoundary() does.
+
+void TGeoNavigator::FindNextBoundaryBasket(Int_t ntracks, const Double_t *const *points, const Double_t *const *dirs,
+                                           const Double_t *stepmax, Double_t *steps, Int_t *idaughters)
+{
+   if (ntracks <= 0)
+      return;
+   while (fCurrentNode->GetVolume()->IsAssembly() && fLevel)
+      CdUp();
+
+   std::vector<Double_t> buffer(13 * ntracks);
+   Double_t *lpoint[3] = {&buffer[0], &buffer[ntracks], &buffer[2 * ntracks]};
+   Double_t *ldir[3] = {&buffer[3 * ntracks], &buffer[4 * ntracks], &buffer[5 * ntracks]};
+   Double_t *dists = &buffer[6 * ntracks];
+
+   // distances to the boundary of the current volume
+   TGeoVolume *vol = fCurrentNode->GetVolume();
+   TGeoHMatrix *mat = GetCurrentMatrix();
+   MasterToLocalSoA(mat, points, lpoint, ntracks, kFALSE);
+   MasterToLocalSoA(mat, dirs, ldir, ntracks, kTRUE);
+   vol->GetShape()->DistFromInsideSoA(lpoint, ldir, steps, ntracks, stepmax);
+   for (Int_t i = 0; i < ntracks; i++) {
+      idaughters[i] = -1;
+      if (steps[i] >= stepmax[i]) {
+         steps[i] = stepmax[i];
+         idaughters[i] = -2;
+      }
+   }
+
+   // distances to the daughters, in the frame of the current volume
+   const Double_t *cpoint[3] = {lpoint[0], lpoint[1], lpoint[2]};
+   const Double_t *cdir[3] = {ldir[0], ldir[1], ldir[2]};
+   Double_t *dpoint[3] = {&buffer[7 * ntracks], &buffer[8 * ntracks], &buffer[9 * ntracks]};
+   Double_t *ddir[3] = {&buffer[10 * ntracks], &buffer[11 * ntracks], &buffer[12 * ntracks]};
+   Int_t nd = vol->GetNdaughters();
+   for (Int_t id = 0; id < nd; id++) {
+      TGeoNode *node = vol->GetNode(id);
+      TGeoMatrix *nmat = node->GetMatrix();
+      MasterToLocalSoA(nmat, cpoint, dpoint, ntracks, kFALSE);
+      MasterToLocalSoA(nmat, cdir, ddir, ntracks, kTRUE);
+      node->GetVolume()->GetShape()->DistFromOutsideSoA(dpoint, ddir, dists, ntracks, steps);
+      for (Int_t i = 0; i < ntracks; i++) {
+         if (dists[i] < steps[i]) {
+            steps[i] = dists[i];
+            idaughters[i] = id;
+         }
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Computes as fStep the distance to next daughter of the current volume.
 /// The point and direction must be converted in the coordinate system of the current volume.
@@ -244,6 +244,47 @@ Double_t TGeoShape::EpsMch()
    return fgEpsMch;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the distances from a basket of points inside the shape to its surface.
+/// Points and directions are given as structures of arrays: points[0], points[1]
+/// and points[2] are the arrays of x, y and z coordinates, same for dirs. The
+/// distance of point i is stored in dists[i], step[i] being the step proposed
+/// for it. The shapes used most in navigation implement this with loops over
+/// the basket which the compiler can vectorize, this default calls
+/// DistFromInside() for each point.
+
+void TGeoShape::DistFromInsideSoA(const Double_t *const *points, const Double_t *const *dirs, Double_t *dists,
+                                  Int_t vecsize, const Double_t *step) const
+{
+   Double_t point[3], dir[3];
+   for (Int_t i = 0; i < vecsize; i++) {
+      for (Int_t j = 0; j < 3; j++) {
+         point[j] = points[j][i];
+         dir[j] = dirs[j][i];
+      }
+      dists[i] = DistFromInside(point, dir, 3, step[i]);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the distances from a basket of points outside the shape to its surface,
+/// see DistFromInsideSoA() for the layout of the arrays. Distances which are not
+/// smaller than step[i] may be returned as TGeoShape::Big(). This default calls
+/// DistFromOutside() for each point.
+
+void TGeoShape::DistFromOutsideSoA(const Double_t *const *points, const Double_t *const *dirs, Double_t *dists,
+                                   Int_t vecsize, const Double_t *step) const
+{
+   Double_t point[3], dir[3];
+   for (Int_t i = 0; i < vecsize; i++) {
+      for (Int_t j = 0; j < 3; j++) {
+         point[j] = points[j][i];
+         dir[j] = dirs[j][i];
+      }
+      dists[i] = DistFromOutside(point, dir, 3, step[i]);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get the shape name.
 
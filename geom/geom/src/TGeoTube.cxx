@@ -1260,6 +1260,50 @@ void TGeoTube::DistFromInside_v(const Double_t *points, const Double_t *dirs, Do
       dists[i] = DistFromInside(&points[3 * i], &dirs[3 * i], 3, step[i]);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distances from a basket of inside points to the tube surface, see
+/// TGeoShape::DistFromInsideSoA(). Same algorithm as DistFromInsideS(), written
+/// with selections instead of branches so that the loop can be vectorized.
+/// Shapes deriving from TGeoTube use the generic implementation.
+
+void TGeoTube::DistFromInsideSoA(const Double_t *const *points, const Double_t *const *dirs, Double_t *dists,
+                                 Int_t vecsize, const Double_t *step) const
+{
+   if (IsA() != TGeoTube::Class()) {
+      TGeoShape::DistFromInsideSoA(points, dirs, dists, vecsize, step);
+      return;
+   }
+   const Double_t *px = points[0], *py = points[1], *pz = points[2];
+   const Double_t *ux = dirs[0], *uy = dirs[1], *uz = dirs[2];
+   const Double_t rmin = fRmin, rmax = fRmax, dz = fDz;
+   const Double_t rmin2 = rmin * rmin, rmax2 = rmax * rmax;
+   const Double_t tol = TGeoShape::Tolerance(), big = TGeoShape::Big();
+   for (Int_t i = 0; i < vecsize; i++) {
+      // Z
+      Bool_t hasz = uz[i] != 0;
+      Double_t sz = hasz ? (((uz[i] > 0) ? dz : -dz) - pz[i]) / uz[i] : big;
+      // R
+      Double_t nsq = ux[i] * ux[i] + uy[i] * uy[i];
+      Bool_t smalln = TMath::Abs(nsq) < tol;
+      Double_t rsq = px[i] * px[i] + py[i] * py[i];
+      Double_t rdotn = px[i] * ux[i] + py[i] * uy[i];
+      Double_t invn = 1. / (smalln ? 1. : nsq);
+      Double_t b = invn * rdotn;
+      // inner cylinder
+      Double_t din = b * b - invn * (rsq - rmin2);
+      Double_t srin = -b - TMath::Sqrt(TMath::Max(din, 0.));
+      Bool_t nearin = rsq <= rmin2 + tol;
+      Bool_t inner = (rmin > 0) && (rdotn < 0) && (nearin || ((din > 0) && (srin > 0)));
+      Double_t resin = nearin ? 0. : TMath::Min(sz, srin);
+      // outer cylinder
+      Double_t dout = b * b - invn * (rsq - rmax2);
+      Double_t srout = -b + TMath::Sqrt(TMath::Max(dout, 0.));
+      Bool_t outer0 = (rsq >= rmax2 - tol) && (rdotn >= 0);
+      Double_t resout = outer0 ? 0. : (((dout > 0) && (srout > 0)) ? TMath::Min(sz, srout) : 0.);
+      dists[i] = (hasz && (sz <= 0)) ? 0. : (smalln ? sz : (inner ? resin : resout));
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Compute distance from array of input points having directions specified by dirs. Store output in dists
 
@@ -400,6 +400,7 @@ volumes (or volume assemblies) as content.
 #include "TGeoScaledShape.h"
 #include "TGeoCompositeShape.h"
 #include "TGeoVoxelFinder.h"
+#include "TGeoBVHVoxelFinder.h"
 #include "TGeoExtension.h"
 
 ClassImp(TGeoVolume);
@@ -2051,6 +2052,19 @@ void TGeoVolume::SetAsTopVolume()
    fGeoManager->SetTopVolume(this);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Use a bounding volume hierarchy (TGeoBVHVoxelFinder) instead of the default
+/// slices for finding the daughters of this volume. This is more efficient for
+/// volumes with many daughters of very different sizes. If the volume is already
+/// voxelized, the voxels are rebuilt.
+
+void TGeoVolume::SetBVHVoxels(Bool_t flag)
+{
+   TObject::SetBit(kVoxelsBVH, flag);
+   if (fVoxels && (fVoxels->InheritsFrom(TGeoBVHVoxelFinder::Class()) != flag))
+      Voxelize("");
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the current tracking point.
 
@@ -2482,7 +2496,10 @@ void TGeoVolume::Voxelize(Option_t *option)
       fVoxels = 0;
    }
    // Create the voxels structure
-   fVoxels = new TGeoVoxelFinder(this);
+   if (IsBVHVoxels())
+      fVoxels = new TGeoBVHVoxelFinder(this);
+   else
+      fVoxels = new TGeoVoxelFinder(this);
    fVoxels->Voxelize(option);
    if (fVoxels) {
       if (fVoxels->IsInvalid()) {
@@ -3109,7 +3126,10 @@ TGeoVolumeAssembly *TGeoVolumeAssembly::MakeAssemblyFromVolume(TGeoVolume *volor
    // copy voxels
    TGeoVoxelFinder *voxels = 0;
    if (volorig->GetVoxels()) {
-      voxels = new TGeoVoxelFinder(vol);
+      if (volorig->IsBVHVoxels())
+         voxels = new TGeoBVHVoxelFinder(vol);
+      else
+         voxels = new TGeoVoxelFinder(vol);
       vol->SetVoxelFinder(voxels);
    }
    // copy option, uid
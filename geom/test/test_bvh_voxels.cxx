@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <TGeoBBox.h>
+#include <TGeoBVHVoxelFinder.h>
+#include <TGeoManager.h>
+#include <TGeoMaterial.h>
+#include <TGeoMatrix.h>
+#include <TGeoMedium.h>
+#include <TGeoVolume.h>
+#include <TList.h>
+#include <TMath.h>
+#include <TRandom3.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+struct NavigationResult {
+   std::vector<std::string> fPaths; // FindNode for the sampled points
+   std::vector<std::string> fSteps; // crossed nodes along the sampled rays
+   std::vector<double> fStepSizes;  // steps along the sampled rays
+};
+
+/// Build a world filled with daughters of very different sizes on a grid of
+/// non-uniform cells, some of them containing daughters themselves. The geometry
+/// does not depend on `bvh`, which only selects the voxel finder.
+void BuildGeometry(bool bvh)
+{
+   TGeoManager::SetVerboseLevel(0);
+   new TGeoManager("bvh", "BVH voxel finder test");
+   auto mat = new TGeoMaterial("vacuum", 0, 0, 0);
+   auto med = new TGeoMedium("vacuum", 1, mat);
+
+   const std::vector<double> wx{1, 4, 7, 10, 1, 4, 7, 10, 1, 4, 7, 10};
+   const std::vector<double> wy(8, 2.);
+   const std::vector<double> wz{1, 2, 3, 1, 2, 3};
+   auto sum = [](const std::vector<double> &w) {
+      double s = 0;
+      for (auto x : w)
+         s += x;
+      return s;
+   };
+   const double lx = sum(wx), ly = sum(wy), lz = sum(wz);
+   auto world = gGeoManager->MakeBox("world", med, lx / 2 + 1, ly / 2 + 1, lz / 2 + 1);
+   gGeoManager->SetTopVolume(world);
+
+   TRandom3 rng(4321);
+   int icell = 0;
+   double x0 = -lx / 2;
+   for (auto dx : wx) {
+      double y0 = -ly / 2;
+      for (auto dy : wy) {
+         double z0 = -lz / 2;
+         for (auto dz : wz) {
+            const double minw = std::min(dx, std::min(dy, dz));
+            const int kind = icell % 5;
+            const std::string name = "vol" + std::to_string(icell);
+            TGeoVolume *vol = nullptr;
+            double extent = 0; // radius of a sphere enclosing the daughter
+            switch (kind) {
+            case 0: break; // empty cell
+            case 1:
+               extent = rng.Uniform(0.1, 0.45) * minw;
+               vol = gGeoManager->MakeSphere(name.c_str(), med, 0, extent);
+               break;
+            case 2: {
+               const double h = rng.Uniform(0.05, 0.28) * minw;
+               vol = gGeoManager->MakeBox(name.c_str(), med, h, 0.8 * h, 0.6 * h);
+               extent = TMath::Sqrt(1 + 0.64 + 0.36) * h;
+               break;
+            }
+            case 3: {
+               const double r = rng.Uniform(0.05, 0.2) * minw;
+               vol = gGeoManager->MakeTube(name.c_str(), med, 0.3 * r, r, r);
+               extent = TMath::Sqrt2() * r;
+               break;
+            }
+            case 4: {
+               // a holder box containing a few small spheres
+               const double h = 0.28 * minw;
+               vol = gGeoManager->MakeBox(name.c_str(), med, h, h, h);
+               auto sphere = gGeoManager->MakeSphere((name + "_s").c_str(), med, 0, h / 4);
+               int copy = 0;
+               for (double sx : {-0.5, 0.5})
+                  for (double sy : {-0.5, 0.5})
+                     for (double sz : {-0.5, 0.5})
+                        vol->AddNode(sphere, copy++, new TGeoTranslation(sx * h, sy * h, sz * h));
+               extent = TMath::Sqrt(3.) * h;
+               break;
+            }
+            }
+            if (vol) {
+               const double slack = 0.5 * minw - extent;
+               auto rot = new TGeoRotation("", rng.Uniform(0, 360), rng.Uniform(0, 180), rng.Uniform(0, 360));
+               world->AddNode(vol, icell,
+                              new TGeoCombiTrans(x0 + dx / 2 + rng.Uniform(-slack, slack),
+                                                 y0 + dy / 2 + rng.Uniform(-slack, slack),
+                                                 z0 + dz / 2 + rng.Uniform(-slack, slack), rot));
+            }
+            ++icell;
+            z0 += dz;
+         }
+         y0 += dy;
+      }
+      x0 += dx;
+   }
+
+   if (bvh) {
+      for (auto obj : *gGeoManager->GetListOfVolumes())
+         static_cast<TGeoVolume *>(obj)->SetBVHVoxels();
+   }
+   gGeoManager->CloseGeometry();
+}
+
+NavigationResult Navigate()
+{
+   NavigationResult result;
+   auto world = static_cast<TGeoBBox *>(gGeoManager->GetTopVolume()->GetShape());
+   const double dx = world->GetDX(), dy = world->GetDY(), dz = world->GetDZ();
+
+   TRandom3 rng(1234);
+   for (int i = 0; i < 20000; ++i) {
+      gGeoManager->FindNode(rng.Uniform(-dx, dx), rng.Uniform(-dy, dy), rng.Uniform(-dz, dz));
+      result.fPaths.emplace_back(gGeoManager->GetPath());
+   }
+
+   for (int i = 0; i < 500; ++i) {
+      double point[3] = {rng.Uniform(-dx, dx), rng.Uniform(-dy, dy), rng.Uniform(-dz, dz)};
+      double dir[3];
+      rng.Sphere(dir[0], dir[1], dir[2], 1.);
+      gGeoManager->InitTrack(point, dir);
+      for (int istep = 0; istep < 1000 && !gGeoManager->IsOutside(); ++istep) {
+         gGeoManager->FindNextBoundaryAndStep();
+         result.fSteps.emplace_back(gGeoManager->IsOutside() ? "outside" : gGeoManager->GetPath());
+         result.fStepSizes.push_back(gGeoManager->GetStep());
+      }
+   }
+   return result;
+}
+
+} // namespace
+
+// The BVH must find the same nodes as the default slices along random points and rays
+TEST(Geometry, BVHVoxelFinder)
+{
+   BuildGeometry(false);
+   ASSERT_NE(gGeoManager->GetTopVolume()->GetVoxels(), nullptr);
+   EXPECT_FALSE(gGeoManager->GetTopVolume()->GetVoxels()->InheritsFrom(TGeoBVHVoxelFinder::Class()));
+   const auto ref = Navigate();
+   delete gGeoManager;
+
+   BuildGeometry(true);
+   ASSERT_NE(gGeoManager->GetTopVolume()->GetVoxels(), nullptr);
+   EXPECT_TRUE(gGeoManager->GetTopVolume()->GetVoxels()->InheritsFrom(TGeoBVHVoxelFinder::Class()));
+   const auto bvh = Navigate();
+   delete gGeoManager;
+
+   ASSERT_EQ(bvh.fPaths.size(), ref.fPaths.size());
+   int ninside = 0;
+   for (std::size_t i = 0; i < ref.fPaths.size(); ++i) {
+      EXPECT_EQ(bvh.fPaths[i], ref.fPaths[i]) << "point " << i;
+      if (ref.fPaths[i] != "/world_1")
+         ++ninside;
+   }
+   // make sure the sampling is not trivial
+   EXPECT_GT(ninside, 100);
+
+   ASSERT_EQ(bvh.fSteps.size(), ref.fSteps.size());
+   for (std::size_t i = 0; i < ref.fSteps.size(); ++i) {
+      EXPECT_EQ(bvh.fSteps[i], ref.fSteps[i]) << "step " << i;
+      EXPECT_NEAR(bvh.fStepSizes[i], ref.fStepSizes[i], 1e-9) << "step " << i;
+   }
+}
@@ -113,6 +113,7 @@ protected:
    TObject      *fPadPointer{nullptr};///<! free pointer
    TObject      *fPadView3D{nullptr};///<! 3D View of this TPad
    static Int_t  fgMaxPickDistance; ///<  Maximum Pick Distance
+   static Int_t  fgDecimationThreshold; ///< Number of points above which polylines and polymarkers are decimated
    Int_t         fNumPaletteColor;  ///<  Number of objects with an automatic color
    Int_t         fNextPaletteColor; ///<  Next automatic color
    std::vector<Bool_t> fCollideGrid;///<! Grid used to find empty space when adding a box (Legend) in a pad
@@ -182,6 +183,7 @@ public:
    virtual void      Closed() { Emit("Closed()"); } // *SIGNAL*
    void              CopyPixmap() override;
    void              CopyPixmaps() override;
+   static  Int_t     DecimatePolyLine(Int_t n, const Double_t *x, const Double_t *y, Double_t xmin, Double_t xmax, Int_t ncolumns, std::vector<Int_t> &selected);
    void              DeleteExec(const char *name) override;
    void              Divide(Int_t nx=1, Int_t ny=1, Float_t xmargin=0.01, Float_t ymargin=0.01, Int_t color=0) override; // *MENU*
    virtual void      DivideSquare(Int_t n, Float_t xmargin=0.01, Float_t ymargin=0.01, Int_t color=0);
@@ -240,6 +242,7 @@ public:
    Double_t          GetY1() const override { return fY1; }
    Double_t          GetY2() const override { return fY2; }
    static Int_t      GetMaxPickDistance();
+   static Int_t      GetDecimationThreshold();
    TList            *GetListOfPrimitives() const override { return fPrimitives; }
    TList            *GetListOfExecs() const override { return fExecs; }
    TObject          *GetPrimitive(const char *name) const override;  //obsolete, use FindObject instead
@@ -345,6 +348,7 @@ public:
    void              SetAttMarkerPS(Color_t color, Style_t style, Size_t msize) override;
    void              SetAttTextPS(Int_t align, Float_t angle, Color_t color, Style_t font, Float_t tsize) override;
    static  void      SetMaxPickDistance(Int_t maxPick=5);
+   static  void      SetDecimationThreshold(Int_t npoints=100000);
    void              SetName(const char *name) override { fName = name; } // *MENU*
    void              SetSelected(TObject *obj) override;
    void              SetTicks(Int_t valuex = 1, Int_t valuey = 1) override { fTickx = valuex; fTicky = valuey; Modified(); }
@@ -13,6 +13,8 @@
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
+#include <atomic>
+#include <thread>
 
 #include "TROOT.h"
 #include "TBuffer.h"
@@ -631,7 +633,10 @@ void TCanvas::Build()
       fContextMenu = new TContextMenu("ContextMenu");
    }
 
-   gROOT->GetListOfCanvases()->Add(this);
+   {
+      R__LOCKGUARD(gROOTMutex);
+      gROOT->GetListOfCanvases()->Add(this);
+   }
 
    if (!fPrimitives) {
       fPrimitives     = new TList;
@@ -2646,6 +2651,9 @@ void TCanvas::DeleteCanvasPainter()
 /// In last case PDF or ROOT file will contain all pads.
 /// Parameter option only used when output into PDF/PS files
 /// If TCanvas::SaveAll() called without arguments - all existing canvases will be stored in allcanvases.pdf file.
+/// In batch mode with implicit multi-threading enabled (ROOT::EnableImplicitMT()), image files are produced
+/// on several threads: the pads are painted one after the other, while the images are encoded and written
+/// in parallel.
 
 Bool_t TCanvas::SaveAll(const std::vector<TPad *> &pads, const char *filename, Option_t *option)
 {
@@ -2751,6 +2759,7 @@ Bool_t TCanvas::SaveAll(const std::vector<TPad *> &pads, const char *filename, O
       return !isError;
    }
 
+   std::vector<TString> fnames(pads.size());
    for (unsigned n = 0; n < pads.size(); ++n) {
       TString fn = TString::Format(fname.Data(), (int) n);
       gSystem->ExpandPathName(fn);
@@ -2758,9 +2767,38 @@ Bool_t TCanvas::SaveAll(const std::vector<TPad *> &pads, const char *filename, O
          fn.Form("%s%d.%s", pads[n]->GetName(), (int) n, ext.Data());
          ::Warning("TCanvas::SaveAll", "Filename %s cannot be used - use pad name %s as pattern", fname.Data(), fn.Data());
       }
+      fnames[n] = fn;
+   }
+
+   static const std::vector<TString> imageExtensions = { "png", "gif", "jpg", "jpeg", "tiff", "xpm", "bmp", "svg" };
+
+   Bool_t isImage = kFALSE;
+   for (auto &iext : imageExtensions) {
+      if ((isImage = (iext == ext)))
+         break;
+   }
+
+   UInt_t nthreads = ROOT::IsImplicitMTEnabled() ? ROOT::GetThreadPoolSize() : 1;
+   if (nthreads > pads.size())
+      nthreads = pads.size();
+
+   if (!isImage || !gROOT->IsBatch() || !gGlobalMutex || (nthreads < 2)) {
+      for (unsigned n = 0; n < pads.size(); ++n)
+         pads[n]->SaveAs(fnames[n].Data());
+      return kTRUE;
+   }
 
-      pads[n]->SaveAs(fn.Data());
+   std::atomic<unsigned> next{0};
+   std::vector<std::thread> workers;
+   for (UInt_t i = 0; i < nthreads; ++i) {
+      workers.emplace_back([&]() {
+         unsigned n;
+         while ((n = next++) < pads.size())
+            pads[n]->SaveAs(fnames[n].Data());
+      });
    }
+   for (auto &w : workers)
+      w.join();
 
    return kTRUE;
 
@@ -9,6 +9,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <algorithm>
 #include <cstring>
 #include <cstdlib>
 #include <iostream>
@@ -64,8 +65,10 @@
 #include "TVirtualMutex.h"
 
 static Int_t gReadLevel = 0;
+static TVirtualMutex *gPrintMutex = nullptr; // serializes TPad::Print between threads
 
 Int_t TPad::fgMaxPickDistance = 5;
+Int_t TPad::fgDecimationThreshold = -1;
 
 ClassImpQ(TPad)
 
@@ -2700,6 +2703,80 @@ Int_t TPad::GetMaxPickDistance()
    return fgMaxPickDistance;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function (see also TPad::SetDecimationThreshold)
+/// When not set explicitly, the threshold is taken from the
+/// `Canvas.DecimationThreshold` resource, 100000 by default.
+
+Int_t TPad::GetDecimationThreshold()
+{
+   if (fgDecimationThreshold < 0)
+      fgDecimationThreshold = gEnv->GetValue("Canvas.DecimationThreshold", 100000);
+   return fgDecimationThreshold;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Select the points of a polyline which are enough to paint it on `ncolumns`
+/// columns spanning the range [xmin, xmax].
+///
+/// Each run of consecutive points falling in the same column is reduced to its
+/// first, lowest, highest and last point: the painted line covers exactly the same
+/// pixels as the full one, while the number of points is bounded by four times the
+/// number of times the line changes column. Points outside the range are grouped in
+/// the two columns bounding it. The indices of the selected points are returned in
+/// increasing order in `selected`; the function returns their number.
+
+Int_t TPad::DecimatePolyLine(Int_t n, const Double_t *x, const Double_t *y, Double_t xmin, Double_t xmax,
+                             Int_t ncolumns, std::vector<Int_t> &selected)
+{
+   selected.clear();
+   if (n <= 0)
+      return 0;
+
+   if (ncolumns <= 0 || !(xmax > xmin)) {
+      selected.resize(n);
+      for (Int_t i = 0; i < n; i++)
+         selected[i] = i;
+      return n;
+   }
+
+   const Double_t scale = ncolumns / (xmax - xmin);
+   auto column = [&](Int_t i) -> Long64_t {
+      Double_t c = (x[i] - xmin) * scale;
+      if (!(c >= 0))
+         return -1;
+      if (c >= ncolumns)
+         return ncolumns;
+      return (Long64_t)c;
+   };
+
+   Int_t first = 0, imin = 0, imax = 0;
+   auto flush = [&](Int_t last) {
+      const Int_t idx[4] = {first, std::min(imin, imax), std::max(imin, imax), last};
+      for (Int_t k = 0; k < 4; k++)
+         if (selected.empty() || idx[k] != selected.back())
+            selected.push_back(idx[k]);
+   };
+
+   Long64_t col = column(0);
+   for (Int_t i = 1; i < n; i++) {
+      Long64_t c = column(i);
+      if (c != col) {
+         flush(i - 1);
+         first = imin = imax = i;
+         col = c;
+         continue;
+      }
+      if (y[i] < y[imin])
+         imin = i;
+      if (y[i] > y[imax])
+         imax = i;
+   }
+   flush(n - 1);
+
+   return (Int_t)selected.size();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get selected.
 
@@ -4320,11 +4397,33 @@ void TPad::PaintPolyLine(Int_t n, Float_t *x, Float_t *y, Option_t *)
 /// Paint polyline in CurrentPad World coordinates.
 ///
 ///  If option[0] == 'C' no clipping
+///
+/// Polylines with more points than TPad::GetDecimationThreshold() are decimated
+/// before painting, keeping for each half pixel column only the points needed to
+/// paint the same pixels (see TPad::DecimatePolyLine).
 
 void TPad::PaintPolyLine(Int_t n, Double_t *x, Double_t *y, Option_t *option)
 {
    if (n < 2) return;
 
+   std::vector<Double_t> xd, yd;
+   Int_t threshold = GetDecimationThreshold();
+   if (threshold > 0 && n > threshold) {
+      std::vector<Int_t> selected;
+      Int_t nd = DecimatePolyLine(n, x, y, fX1, fX2, 2 * TMath::Abs(UtoPixel(1.) - UtoPixel(0.)), selected);
+      if (nd < n) {
+         xd.resize(nd);
+         yd.resize(nd);
+         for (Int_t i = 0; i < nd; i++) {
+            xd[i] = x[selected[i]];
+            yd[i] = y[selected[i]];
+         }
+         n = nd;
+         x = xd.data();
+         y = yd.data();
+      }
+   }
+
    Double_t xmin,xmax,ymin,ymax;
    Bool_t mustClip = kTRUE;
    if (TestBit(TGraph::kClipFrame)) {
@@ -4437,6 +4536,10 @@ void TPad::PaintPolyMarker(Int_t nn, Float_t *x, Float_t *y, Option_t *)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Paint polymarker in CurrentPad World coordinates.
+///
+/// When there are more markers than TPad::GetDecimationThreshold(), only one
+/// marker per half pixel cell is painted: the others would be painted at the
+/// same place.
 
 void TPad::PaintPolyMarker(Int_t nn, Double_t *x, Double_t *y, Option_t *)
 {
@@ -4447,6 +4550,30 @@ void TPad::PaintPolyMarker(Int_t nn, Double_t *x, Double_t *y, Option_t *)
    } else {
       xmin = fX1; ymin = fY1; xmax = fX2; ymax = fY2;
    }
+
+   std::vector<Double_t> xd, yd;
+   Int_t threshold = GetDecimationThreshold();
+   Int_t ncx = 2 * TMath::Abs(UtoPixel(1.) - UtoPixel(0.));
+   Int_t ncy = 2 * TMath::Abs(VtoPixel(1.) - VtoPixel(0.));
+   if (threshold > 0 && n > threshold && ncx > 0 && ncy > 0 && xmax > xmin && ymax > ymin) {
+      std::vector<bool> filled((size_t)ncx * ncy, false);
+      const Double_t sx = ncx / (xmax - xmin), sy = ncy / (ymax - ymin);
+      for (Int_t i = 0; i < n; i++) {
+         if (!(x[i] >= xmin && x[i] <= xmax && y[i] >= ymin && y[i] <= ymax))
+            continue;
+         Int_t cx = std::min((Int_t)((x[i] - xmin) * sx), ncx - 1);
+         Int_t cy = std::min((Int_t)((y[i] - ymin) * sy), ncy - 1);
+         size_t cell = (size_t)cy * ncx + cx;
+         if (filled[cell])
+            continue;
+         filled[cell] = true;
+         xd.push_back(x[i]);
+         yd.push_back(y[i]);
+      }
+      n = (Int_t)xd.size();
+      x = xd.data();
+      y = yd.data();
+   }
    Int_t i,i1=-1,np=0;
    for (i=0; i<n; i++) {
       if (x[i] >= xmin && x[i] <= xmax && y[i] >= ymin && y[i] <= ymax) {
@@ -4932,6 +5059,16 @@ void TPad::Print(const char *filename, Option_t *option)
       return;
    }
 
+   // Painting relies on global state (style, colors, fonts, painters): when thread safety is enabled,
+   // canvases printed in several threads are painted one after the other, each thread having its own
+   // gPad and gVirtualPS. The encoding and writing of the produced image is done outside of the lock.
+   if (gGlobalMutex && !gPrintMutex) {
+      R__LOCKGUARD(gGlobalMutex);
+      if (!gPrintMutex)
+         gPrintMutex = gGlobalMutex->Factory(kTRUE);
+   }
+   TLockGuard printGuard(gPrintMutex);
+
    if (!GetCanvas()->IsBatch() && GetPainter())
       GetPainter()->SelectDrawable(GetCanvasID());
 
@@ -5160,7 +5297,10 @@ void TPad::Print(const char *filename, Option_t *option)
 
       if (mustClose) {
          gROOT->GetListOfSpecials()->Remove(gVirtualPS);
-         delete gVirtualPS;
+         TVirtualPS *ps = gVirtualPS;
+         if (image)
+            printGuard.UnLock(); // the image is written when deleting the driver, no painting anymore
+         delete ps;
          gVirtualPS = psave;
       } else {
          gROOT->GetListOfSpecials()->Add(gVirtualPS);
@@ -6538,6 +6678,17 @@ void TPad::SetCrosshair(Int_t crhair)
    if (this != (TPad*)fCanvas) fCanvas->SetCrosshair(crhair);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function to set the number of points above which polylines and
+/// polymarkers painted with TPad::PaintPolyLine and TPad::PaintPolyMarker are
+/// decimated to the resolution of the pad. A value of 0 disables the decimation.
+/// The default is taken from the `Canvas.DecimationThreshold` resource.
+
+void TPad::SetDecimationThreshold(Int_t npoints)
+{
+   fgDecimationThreshold = npoints < 0 ? 0 : npoints;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// static function to set the maximum Pick Distance fgMaxPickDistance
 /// This parameter is used in TPad::Pick to select an object if
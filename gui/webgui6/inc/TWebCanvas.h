@@ -60,6 +60,7 @@ protected:
       Long64_t fSendVersion{0};        ///<! canvas version send to the client
       Long64_t fDrawVersion{0};        ///<! canvas version drawn (confirmed) by client
       UInt_t fLastSendHash{0};         ///<! hash of last send draw message, avoid looping
+      std::map<std::string, std::size_t> fSentHashes; ///<! hash of the objects already sent to the client, by pad and object id
       std::map<std::string, std::string> fCtrl; ///<! different ctrl parameters which can be send at once
       std::queue<std::string> fSend;   ///<! send queue, processed after sending draw data
 
@@ -70,6 +71,7 @@ protected:
       {
          fCheckedVersion = fSendVersion = fDrawVersion = 0;
          fLastSendHash = 0;
+         fSentHashes.clear();
       }
    };
 
@@ -106,6 +108,8 @@ protected:
    Long64_t fColorsVersion{0};     ///<! current colors/palette version, checked every time when new snapshot created
    UInt_t fColorsHash{0};          ///<! last hash of colors/palette
    Bool_t fTF1UseSave{kFALSE};     ///<! use save buffer for TF1/TF2, need when evaluation failed on client side
+   Int_t fGraphDecimation{0};      ///<! number of points above which TGraph is decimated to the pad resolution before sending, 0 - never
+   Bool_t fIncrementalUpdate{kTRUE}; ///<! do not send again objects which were not changed since last update
    std::vector<int> fWindowGeometry; ///<! last received window geometry
    Bool_t fFixedSize{kFALSE};      ///<! is canvas size fixed
 
@@ -129,6 +133,8 @@ protected:
    void CreateObjectSnapshot(TPadWebSnapshot &master, TPad *pad, TObject *obj, const char *opt, TWebPS *masterps = nullptr);
    void CreatePadSnapshot(TPadWebSnapshot &paddata, TPad *pad, Long64_t version, PadPaintingReady_t func);
 
+   void SuppressUnchangedPrimitives(WebConn &conn, TPadWebSnapshot &paddata, std::size_t basehash);
+
    void CheckPadModified(TPad *pad);
 
    Bool_t CheckCanvasModified(bool force_modified = false);
@@ -229,6 +235,12 @@ public:
    void SetPrimitivesMerge(Int_t cnt) { fPrimitivesMerge = cnt; }
    Int_t GetPrimitivesMerge() const { return fPrimitivesMerge; }
 
+   void SetGraphDecimation(Int_t npoints) { fGraphDecimation = npoints; }
+   Int_t GetGraphDecimation() const { return fGraphDecimation; }
+
+   void SetIncrementalUpdate(Bool_t on = kTRUE) { fIncrementalUpdate = on; }
+   Bool_t GetIncrementalUpdate() const { return fIncrementalUpdate; }
+
    void SetLongerPolling(Bool_t on) { fLongerPolling = on; }
    Bool_t GetLongerPolling() const { return fLongerPolling; }
 
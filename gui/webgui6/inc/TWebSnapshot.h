@@ -46,6 +46,7 @@ public:
    const char* GetObjectID() const { return fObjectID.c_str(); }
 
    void SetOption(const std::string &opt) { fOption = opt; }
+   const char *GetOption() const { return fOption.c_str(); }
 
    void SetSnapshot(Int_t kind, TObject *snapshot, Bool_t owner = kFALSE);
    Int_t GetKind() const { return fKind; }
@@ -78,6 +79,7 @@ public:
    void SetActive(bool on = true) { fActive = on; }
 
    void SetWithoutPrimitives(bool on = true) { fWithoutPrimitives = on; }
+   bool IsWithoutPrimitives() const { return fWithoutPrimitives; }
 
    void SetHasExecs(bool on = true) { fHasExecs = on; }
 
@@ -89,6 +91,9 @@ public:
 
    TWebSnapshot &NewPrimitive(TObject *obj = nullptr, const std::string &opt = "");
 
+   unsigned NumPrimitives() const { return fPrimitives.size(); }
+   TWebSnapshot *GetPrimitive(unsigned n) const { return n < fPrimitives.size() ? fPrimitives[n].get() : nullptr; }
+
    TPadWebSnapshot &NewSubPad();
 
    TWebSnapshot &NewSpecials();
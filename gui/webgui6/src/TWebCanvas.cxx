@@ -22,6 +22,7 @@
 #include "TFrame.h"
 #include "TPaveText.h"
 #include "TPaveStats.h"
+#include "TPave.h"
 #include "TText.h"
 #include "TROOT.h"
 #include "TClass.h"
@@ -43,6 +44,7 @@
 #include "TScatter.h"
 #include "TCutG.h"
 #include "TBufferJSON.h"
+#include "TBufferFile.h"
 #include "TBase64.h"
 #include "TAtt3D.h"
 #include "TView.h"
@@ -57,6 +59,7 @@
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <string_view>
 
 class TWebCanvasTimer : public TTimer {
    TWebCanvas &fCanv;
@@ -128,6 +131,8 @@ TWebCanvas::TWebCanvas(TCanvas *c, const char *name, Int_t x, Int_t y, UInt_t wi
    fPaletteDelivery = gEnv->GetValue("WebGui.PaletteDelivery", 1);
    fPrimitivesMerge = gEnv->GetValue("WebGui.PrimitivesMerge", 100);
    fTF1UseSave = gEnv->GetValue("WebGui.TF1UseSave", (Int_t) 0) > 0;
+   fGraphDecimation = gEnv->GetValue("WebGui.GraphDecimation", (Int_t) 0);
+   fIncrementalUpdate = gEnv->GetValue("WebGui.IncrementalUpdate", (Int_t) 1) > 0;
    fJsonComp = gEnv->GetValue("WebGui.JsonComp", TBufferJSON::kSameSuppression + TBufferJSON::kNoSpaces);
 
    fWebConn.emplace_back(0); // add special connection which only used to perform updates
@@ -663,7 +668,31 @@ void TWebCanvas::CreatePadSnapshot(TPadWebSnapshot &paddata, TPad *pad, Long64_t
          if (title && first_obj) gropt.Append(";;use_pad_title");
          if (stats) gropt.Append(";;use_pad_stats");
 
-         paddata.NewPrimitive(obj, gropt.Data()).SetSnapshot(TWebSnapshot::kObject, obj);
+         // for very large graphs only send the points which are visible at the pad resolution over
+         // the full range of the graph, the object stays associated with the original graph on the client side
+         TGraph *decimated = nullptr;
+         if ((fGraphDecimation > 0) && (gr->GetN() > fGraphDecimation) && (gr->IsA() == TGraph::Class()) &&
+             !pad->GetLogx()) {
+            std::vector<Int_t> selected;
+            Int_t ncolumns = 2 * TMath::Abs(pad->UtoPixel(1.) - pad->UtoPixel(0.));
+            Int_t nd = TPad::DecimatePolyLine(gr->GetN(), gr->GetX(), gr->GetY(),
+                                              TMath::MinElement(gr->GetN(), gr->GetX()),
+                                              TMath::MaxElement(gr->GetN(), gr->GetX()), ncolumns, selected);
+            if (nd < gr->GetN()) {
+               decimated = (TGraph *)gr->Clone();
+               Double_t *x = decimated->GetX(), *y = decimated->GetY();
+               for (Int_t i = 0; i < nd; i++) {
+                  x[i] = x[selected[i]];
+                  y[i] = y[selected[i]];
+               }
+               decimated->Set(nd);
+            }
+         }
+
+         if (decimated)
+            paddata.NewPrimitive(obj, gropt.Data()).SetSnapshot(TWebSnapshot::kObject, decimated, kTRUE);
+         else
+            paddata.NewPrimitive(obj, gropt.Data()).SetSnapshot(TWebSnapshot::kObject, obj);
 
          fiter.Reset();
          while ((fobj = fiter()) != nullptr)
@@ -815,6 +844,74 @@ void TWebCanvas::CreatePadSnapshot(TPadWebSnapshot &paddata, TPad *pad, Long64_t
    fPrimitivesLists.Clear("nodelete");
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Replace in the pad snapshot the objects which did not change since they were sent to the connection
+/// by empty entries with the same object id. The client keeps the painters of such objects without
+/// redrawing them, so only the modified objects of a modified pad are transferred and painted again.
+/// Objects are compared with the hash of their binary streaming, combined with the draw option,
+/// the pad ranges and attributes and `basehash` (style and colors): any change there repaints everything.
+/// Small objects and the panes like title and stats, which are searched by other painters, are always sent.
+
+void TWebCanvas::SuppressUnchangedPrimitives(WebConn &conn, TPadWebSnapshot &paddata, std::size_t basehash)
+{
+   if (paddata.IsWithoutPrimitives())
+      return;
+
+   const Int_t kMinSize = 1024; // not worth to check smaller objects
+
+   std::size_t padhash = basehash;
+   auto combine = [&padhash](std::size_t h) { padhash ^= h + 0x9e3779b97f4a7c15ULL + (padhash << 6) + (padhash >> 2); };
+
+   if (auto pad = dynamic_cast<TPad *>(paddata.GetSnapshot())) {
+      const Double_t attr[] = {pad->GetX1(), pad->GetX2(), pad->GetY1(), pad->GetY2(),
+                               pad->GetUxmin(), pad->GetUxmax(), pad->GetUymin(), pad->GetUymax(),
+                               pad->GetAbsXlowNDC(), pad->GetAbsYlowNDC(), pad->GetAbsWNDC(), pad->GetAbsHNDC(),
+                               pad->GetTheta(), pad->GetPhi(),
+                               (Double_t)pad->GetLogx(), (Double_t)pad->GetLogy(), (Double_t)pad->GetLogz(),
+                               (Double_t)pad->GetGridx(), (Double_t)pad->GetGridy(),
+                               (Double_t)pad->GetTickx(), (Double_t)pad->GetTicky()};
+      combine(std::hash<std::string_view>{}(std::string_view((const char *)attr, sizeof(attr))));
+   }
+
+   std::string prefix = paddata.GetObjectID() + "/"s;
+   std::map<std::string, std::size_t> hashes;
+
+   for (unsigned n = 0; n < paddata.NumPrimitives(); ++n) {
+      auto snap = paddata.GetPrimitive(n);
+
+      if (snap->GetKind() == TWebSnapshot::kSubPad) {
+         SuppressUnchangedPrimitives(conn, *static_cast<TPadWebSnapshot *>(snap), basehash);
+         continue;
+      }
+
+      TObject *obj = snap->GetSnapshot();
+      if ((snap->GetKind() != TWebSnapshot::kObject) || !obj || !*snap->GetObjectID() ||
+          !strcmp(snap->GetOption(), "__ignore_drawing__") || obj->InheritsFrom(TPave::Class()))
+         continue;
+
+      TBufferFile buf(TBuffer::kWrite, 16 * 1024);
+      obj->Streamer(buf);
+      if (buf.Length() < kMinSize)
+         continue;
+
+      std::string key = prefix + snap->GetObjectID() + ":"s + snap->GetOption();
+      std::size_t hash = std::hash<std::string_view>{}(std::string_view(buf.Buffer(), buf.Length()));
+      hash ^= padhash + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+
+      auto iter = conn.fSentHashes.find(key);
+      if ((iter != conn.fSentHashes.end()) && (iter->second == hash))
+         snap->SetSnapshot(TWebSnapshot::kNone, nullptr);
+
+      hashes[key] = hash;
+   }
+
+   // forget objects which are no longer in the pad, keys of sub-pads use their own prefix
+   auto iter = conn.fSentHashes.lower_bound(prefix);
+   while ((iter != conn.fSentHashes.end()) && (iter->first.compare(0, prefix.length(), prefix) == 0))
+      iter = conn.fSentHashes.erase(iter);
+   conn.fSentHashes.insert(hashes.begin(), hashes.end());
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 /// Add control message for specified connection
 /// Same control message can be overwritten many time before it really sends to the client
@@ -898,6 +995,12 @@ Bool_t TWebCanvas::CheckDataToSend(unsigned connid)
                   return;
                }
 
+               // objects already on the client and not changed since are not send again
+               if (fIncrementalUpdate) {
+                  auto basehash = std::hash<std::string>{}(std::to_string(fStyleHash) + ":"s + std::to_string(fColorsHash));
+                  SuppressUnchangedPrimitives(conn, *snap, basehash);
+               }
+
                auto json = TBufferJSON::ToJSON(snap, fJsonComp);
                auto hash = json.Hash();
                if (conn.fLastSendHash && (conn.fLastSendHash == hash) && conn.fSendVersion) {
@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <type_traits>
 
 namespace ROOT {
 
@@ -153,6 +154,9 @@ namespace ROOT {
          /// By calling this method the class manages now the passed TF1 pointer
          void SetAndCopyFunction(const TF1 *f = nullptr);
 
+         /// functions defined by a formula evaluate a set of points in a single loop, see TF1::EvalN
+         bool HasEvalN() const override { return std::is_same<T, double>::value && fFunc->GetFormula() != nullptr; }
+
       private:
          /// evaluate function passing coordinates x and vector of parameters
          T DoEvalPar(const T *x, const double *p) const override
@@ -160,6 +164,21 @@ namespace ROOT {
             return fFunc->EvalPar(x, p);
          }
 
+         /// evaluate function at n points passing one array of coordinates per dimension and vector of parameters
+         void DoEvalN(std::size_t n, const T *const *x, const double *p, T *result) const override
+         {
+            if constexpr (std::is_same<T, double>::value) {
+               fFunc->EvalN(n, x, result, p);
+            } else {
+               std::vector<T> point(fDim);
+               for (std::size_t i = 0; i < n; ++i) {
+                  for (unsigned int j = 0; j < fDim; ++j)
+                     point[j] = x[j][i];
+                  result[i] = fFunc->EvalPar(point.data(), p);
+               }
+            }
+         }
+
          /// evaluate function using the cached parameter values (of TF1)
          /// re-implement for better efficiency
          T DoEvalVec(const T *x) const
@@ -108,6 +108,13 @@ public:
    virtual Int_t      FindBin(const char *label);
    virtual Int_t      FindFixBin(Double_t x) const;
    virtual Int_t      FindFixBin(const char *label) const;
+   /// Same as FindFixBin(x) for axes with fixed bin widths; inline, for the fill fast paths of the histograms
+           Int_t      FindFixBinUniform(Double_t x) const
+                      {
+                         if (x < fXmin) return 0;
+                         if (!(x < fXmax)) return fNbins + 1; // also catches NaN
+                         return 1 + int(fNbins * (x - fXmin) / (fXmax - fXmin));
+                      }
    virtual Double_t   GetBinCenter(Int_t bin) const;
    virtual Double_t   GetBinCenterLog(Int_t bin) const;
    const char        *GetBinLabel(Int_t bin) const;
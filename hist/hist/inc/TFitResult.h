@@ -68,6 +68,9 @@ public:
    using ROOT::Fit::FitResult::Contour;
    bool  Contour(unsigned int ipar, unsigned int jpar, TGraph * gr , double confLevel = 0.683);
 
+   // set the model function, e.g. a scalar copy of the vectorized function used in the fit
+   using ROOT::Fit::FitResult::SetModelFunction;
+
    using TObject::Error;
 
    // need to re-implement to solve conflict with TObject::Error
@@ -105,6 +105,8 @@ private:
    CallFuncSignature fFuncPtr = nullptr;           ///<! Function pointer, owned by the JIT.
    CallFuncSignature fGradFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
    CallFuncSignature fHessFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
+   std::string       fEvalNGenerationInput;        ///<! Input to Cling of the loop evaluating a span of points
+   CallFuncSignature fEvalNFuncPtr = nullptr;      ///<! Function pointer, owned by the JIT.
    void *   fLambdaPtr = nullptr;                  ///<! Pointer to the lambda function
    static bool       fIsCladRuntimeIncluded;
 
@@ -131,6 +133,13 @@ private:
       assert(fClingName.Length() && "TFormula is not initialized yet!");
       return std::string(fClingName.Data()) + "_hessian_1";
    }
+   std::string GetEvalNFuncName() const {
+      assert(fClingName.Length() && "TFormula is not initialized yet!");
+      return std::string(fClingName.Data()) + "_evaln";
+   }
+   bool HasEvalNGenerationFailed() const {
+      return !fEvalNFuncPtr && !fEvalNGenerationInput.empty();
+   }
    bool HasGradientGenerationFailed() const {
       return !fGradFuncPtr && !fGradGenerationInput.empty();
    }
@@ -203,6 +212,19 @@ public:
    Double_t       Eval(Double_t x, Double_t y , Double_t z , Double_t t ) const;
    Double_t       EvalPar(const Double_t *x, const Double_t *params = nullptr) const;
 
+   /// Generate the loop that evaluates the formula for a span of points, see EvalN().
+   /// \returns true if the loop was generated; not possible for lambda and vectorized formulas.
+   bool GenerateEvalN();
+
+   /// Evaluate the formula at `n` points with the same parameters, in a loop compiled by Cling that the compiler can
+   /// vectorize. The formulas that have no such loop (see GenerateEvalN()) are evaluated point by point.
+   ///
+   /// \param[in] n - The number of points.
+   /// \param[in] x - One array of `n` coordinates per dimension of the formula.
+   /// \param[out] result - The `n` values of the formula.
+   /// \param[in] params - The parameters, if nullptr the stored parameters are used.
+   void EvalN(std::size_t n, const Double_t *const *x, Double_t *result, const Double_t *params = nullptr) const;
+
    /// Generate gradient computation routine with respect to the parameters.
    /// \returns true if a gradient was generated and GradientPar can be called.
    bool GenerateGradientPar();
@@ -267,6 +289,7 @@ public:
    TString        GetVarName(Int_t ivar) const;
    Bool_t         IsValid() const { return fReadyToExecute && fClingInitialized; }
    Bool_t IsVectorized() const { return fVectorized; }
+   Bool_t         IsVectorizable() const;
    Bool_t         IsLinear() const { return TestBit(kLinear); }
    void           Print(Option_t *option = "") const override;
    void           SetName(const char* name) override;
@@ -148,6 +148,20 @@ protected:
                                Option_t * opt, Bool_t doerr = kFALSE) const;
 
    virtual void     DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride=1);
+   /// True if the fill fast paths of TH1D, TH1F, TH2D and TH3D apply: no buffer, and axes with fixed bin widths
+   /// that are neither extendable nor alphanumeric
+   Bool_t   CanFillFast() const
+   {
+      auto isUniform = [](const TAxis &axis) {
+         return !axis.IsVariableBinSize() && !axis.CanExtend() && !axis.IsAlphanumeric();
+      };
+      return !fBuffer && isUniform(fXaxis) && (fDimension < 2 || isUniform(fYaxis)) &&
+             (fDimension < 3 || isUniform(fZaxis));
+   }
+   template <typename T>
+   Int_t    DoFillFast(T *array, Double_t x, Double_t w);
+   template <typename T>
+   void     DoFillNFast(T *array, Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride);
    Bool_t    GetStatOverflowsBehaviour() const { return EStatOverflows::kNeutral == fStatOverflows ? fgStatOverflows : EStatOverflows::kConsider == fStatOverflows; }
 
    static bool CheckAxisLimits(const TAxis* a1, const TAxis* a2);
@@ -363,6 +377,7 @@ public:
    virtual void     SetBinContent(Int_t bin, Double_t content);
    virtual void     SetBinContent(Int_t bin, Int_t, Double_t content) { SetBinContent(bin, content); }
    virtual void     SetBinContent(Int_t bin, Int_t, Int_t, Double_t content) { SetBinContent(bin, content); }
+           void     SetBinContentN(Int_t n, const Int_t *bins, const Double_t *contents);
    virtual void     SetBinError(Int_t bin, Double_t error);
    virtual void     SetBinError(Int_t binx, Int_t biny, Double_t error);
    virtual void     SetBinError(Int_t binx, Int_t biny, Int_t binz, Double_t error);
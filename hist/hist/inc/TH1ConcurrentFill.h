@@ -0,0 +1,174 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TH1ConcurrentFill
+#define ROOT_TH1ConcurrentFill
+
+#include "RtypesCore.h"
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+class TH1;
+class TH3;
+class TProfile;
+class TProfile2D;
+
+namespace ROOT {
+
+class TH1ConcurrentFillManager;
+
+/**
+ \class ROOT::TH1ConcurrentFiller
+ \ingroup Histograms
+ Buffers the Fill() calls of one thread and submits them to the histogram of its TH1ConcurrentFillManager.
+
+ The buffered entries are filled into the histogram when the buffer is full, on Flush() and on destruction.
+ The arguments of Fill() are those of the Fill() of the histogram: Fill(x, w) for 1D, Fill(x, y, w) for 2D and
+ Fill(x, y, z, w) for 3D histograms, each with an optional weight; and Fill(x, y, w) for TProfile and
+ Fill(x, y, z, w) for TProfile2D.
+ **/
+
+class TH1ConcurrentFiller {
+private:
+   TH1ConcurrentFillManager *fManager;
+   Int_t fNCoords; ///< Number of coordinates per entry: the dimension, plus one for profiles
+   std::size_t fBufferSize;
+   std::vector<Double_t> fX;
+   std::vector<Double_t> fY;
+   std::vector<Double_t> fZ;
+   std::vector<Double_t> fW;
+
+   void Push(Double_t x, Double_t y, Double_t z, Double_t w)
+   {
+      fX.push_back(x);
+      if (fNCoords > 1)
+         fY.push_back(y);
+      if (fNCoords > 2)
+         fZ.push_back(z);
+      fW.push_back(w);
+      if (fW.size() >= fBufferSize)
+         Flush();
+   }
+   void InvalidSignature() const;
+
+public:
+   TH1ConcurrentFiller(TH1ConcurrentFillManager &manager, std::size_t bufferSize);
+   TH1ConcurrentFiller(const TH1ConcurrentFiller &) = delete;
+   TH1ConcurrentFiller &operator=(const TH1ConcurrentFiller &) = delete;
+   TH1ConcurrentFiller(TH1ConcurrentFiller &&) = default;
+   ~TH1ConcurrentFiller() { Flush(); }
+
+   void Fill(Double_t x)
+   {
+      if (fNCoords == 1)
+         Push(x, 0., 0., 1.);
+      else
+         InvalidSignature();
+   }
+   /// Fill(x, w) for 1D, Fill(x, y) for 2D histograms and TProfile
+   void Fill(Double_t x, Double_t yw)
+   {
+      if (fNCoords == 1)
+         Push(x, 0., 0., yw);
+      else if (fNCoords == 2)
+         Push(x, yw, 0., 1.);
+      else
+         InvalidSignature();
+   }
+   /// Fill(x, y, w) for 2D histograms and TProfile, Fill(x, y, z) for 3D histograms and TProfile2D
+   void Fill(Double_t x, Double_t y, Double_t zw)
+   {
+      if (fNCoords == 2)
+         Push(x, y, 0., zw);
+      else if (fNCoords == 3)
+         Push(x, y, zw, 1.);
+      else
+         InvalidSignature();
+   }
+   void Fill(Double_t x, Double_t y, Double_t z, Double_t w)
+   {
+      if (fNCoords == 3)
+         Push(x, y, z, w);
+      else
+         InvalidSignature();
+   }
+
+   /// Fill the buffered entries into the histogram
+   void Flush();
+};
+
+/**
+ \class ROOT::TH1ConcurrentFillManager
+ \ingroup Histograms
+ Lets several threads fill the same TH1, TH2, TH3, TProfile or TProfile2D without a clone of the histogram per
+ thread.
+
+ Each thread fills through its own TH1ConcurrentFiller, obtained from MakeFiller(). The fillers buffer the entries
+ and fill them into the histogram in bulk, with FillN() where the histogram supports it, under the lock of the
+ manager. Bin contents, errors and statistics (fEntries, fTsumw, ...) are thus always updated together, as for a
+ single-threaded fill; only the order of the entries of different threads is undefined.
+
+ While threads are filling, the histogram must be accessed only while holding the lock returned by Lock(), e.g.
+ to draw or write it. Entries that are still buffered in the fillers are not visible: call the Flush() of the
+ fillers, e.g. at the end of an update cycle, to make them so.
+
+ This is particularly useful for large profiles, e.g. detector maps: a TProfile2D keeps four arrays of doubles
+ per bin (sums of w*y, w*y*y and w, and w*w with weights), which per-thread clones multiply by the number of
+ threads. The fillers only add their buffers; the accumulation stays in the double precision of the profile.
+ TProfile3D is not supported.
+
+~~~ {.cpp}
+TH1D h("h", "h", 100, 0, 1);
+ROOT::TH1ConcurrentFillManager manager(h);
+auto work = [&manager]() {
+   auto filler = manager.MakeFiller();
+   for (int i = 0; i < 1000000; ++i)
+      filler.Fill(gRandom->Rndm());
+};
+std::thread t1(work), t2(work);
+t1.join();
+t2.join();
+~~~
+ **/
+
+class TH1ConcurrentFillManager {
+   friend class TH1ConcurrentFiller;
+
+private:
+   TH1 &fHist;
+   TH3 *fHist3 = nullptr;            ///< fHist if it is a 3D histogram
+   TProfile *fProfile = nullptr;     ///< fHist if it is a TProfile
+   TProfile2D *fProfile2D = nullptr; ///< fHist if it is a TProfile2D
+   Int_t fNDim;
+   Int_t fNCoords; ///< Number of coordinates per entry: fNDim, plus one for profiles
+   std::mutex fMutex;
+
+   void FillN(Int_t n, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w);
+
+public:
+   explicit TH1ConcurrentFillManager(TH1 &hist);
+
+   /// A filler for the calling thread; bufferSize is the number of entries buffered before they are filled
+   TH1ConcurrentFiller MakeFiller(std::size_t bufferSize = 1024) { return TH1ConcurrentFiller(*this, bufferSize); }
+
+   /// Keeps the fillers from modifying the histogram while the returned lock is held
+   std::unique_lock<std::mutex> Lock() { return std::unique_lock<std::mutex>(fMutex); }
+
+   TH1 &GetHist() const { return fHist; }
+   Int_t GetDimension() const { return fNDim; }
+   /// The number of coordinates of an entry: the dimension of the histogram, plus one for profiles
+   Int_t GetNCoordinates() const { return fNCoords; }
+};
+
+} // namespace ROOT
+
+#endif
@@ -52,6 +52,8 @@ protected:
    virtual TProfile *DoProfile(bool onX, const char *name, Int_t firstbin, Int_t lastbin, Option_t *option) const;
    virtual TH1D     *DoQuantiles(bool onX, const char *name, Double_t prob) const;
    virtual void      DoFitSlices(bool onX, TF1 *f1, Int_t firstbin, Int_t lastbin, Int_t cut, Option_t *option, TObjArray* arr);
+   template <typename T>
+   Int_t             DoFillFast(T *array, Double_t x, Double_t y, Double_t w);
 
    Int_t    BufferFill(Double_t, Double_t) override {return -2;} //may not use
    Int_t    Fill(Double_t) override; //MayNotUse
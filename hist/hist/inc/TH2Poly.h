@@ -22,6 +22,8 @@
 
 #include "TH2.h"
 
+#include <vector>
+
 class TH2PolyBin: public TObject{
 
 public:
@@ -165,8 +167,13 @@ protected:
    Bool_t   fNewBinAdded;          ///<!For the 3D Painter
    Bool_t   fBinContentChanged;    ///<!For the 3D Painter
    TList   *fBins;                 ///< List of bins. The list owns the contained objects
+   std::vector<Double_t> fBVHBounds;  ///<!Bounding box of each node of the bin search tree: xmin, xmax, ymin, ymax
+   std::vector<Int_t>    fBVHNodes;   ///<!Per node: first child or first bin, number of bins (0 if inner), lowest bin number
+   std::vector<TH2PolyBin *> fBVHBins; ///<!The bins, in the order of the leaves of the tree
 
    void   AddBinToPartition(TH2PolyBin *bin);  // Adds the input bin into the partition matrix
+   void   BuildBVH();                          // Builds the bounding volume hierarchy of the bins
+   TH2PolyBin *FindBinInBVH(Double_t x, Double_t y); // The lowest-numbered bin containing (x,y), or nullptr
    void   Initialize(Double_t xlow, Double_t xup, Double_t ylow, Double_t yup, Int_t n, Int_t m);
    Bool_t IsIntersecting(TH2PolyBin *bin, Double_t xclipl, Double_t xclipr, Double_t yclipb, Double_t yclipt);
    Bool_t IsIntersectingPolygon(Int_t bn, Double_t *x, Double_t *y, Double_t xclipl, Double_t xclipr, Double_t yclipb, Double_t yclipt);
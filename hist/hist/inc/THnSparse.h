@@ -21,7 +21,6 @@
 
 
 #include "THnBase.h"
-#include "TExMap.h"
 #include "THnSparse_Internal.h"
 
 // needed only for template instantiations of THnSparseT:
@@ -31,6 +30,8 @@
 #include "TArrayS.h"
 #include "TArrayC.h"
 
+#include <vector>
+
 class THnSparseCompactBinCoord;
 
 class THnSparse: public THnBase {
@@ -38,8 +39,8 @@ class THnSparse: public THnBase {
    Int_t      fChunkSize;                   ///<  Number of entries for each chunk
    Long64_t   fFilledBins;                  ///<  Number of filled bins
    TObjArray  fBinContent;                  ///<  Array of THnSparseArrayChunk
-   TExMap     fBins;                        ///<! Filled bins
-   TExMap     fBinsContinued;               ///<! Filled bins for non-unique hashes, containing pairs of (bin index 0, bin index 1)
+   std::vector<ULong64_t> fBinTable;        ///<! Hash table of the filled bins: pairs of hash and bin index + 1
+   Int_t      fBinTableBits;                ///<! log2 of the number of slots of fBinTable
    THnSparseCompactBinCoord *fCompactCoord; ///<! Compact coordinate
 
    THnSparse(const THnSparse&) = delete;
@@ -58,8 +59,14 @@ class THnSparse: public THnBase {
    THnSparseArrayChunk* AddChunk();
    void Reserve(Long64_t nbins) override;
    void FillExMap();
+   void ResizeBinTable(Long64_t nbins);
+   /// The first slot of fBinTable to probe for the hash. The Fibonacci hashing spreads the packed coordinates, which
+   /// are the hashes of small coordinate buffers, over all slots.
+   ULong64_t GetBinTableSlot(ULong64_t hash) const { return (hash * 0x9E3779B97F4A7C15ULL) >> (64 - fBinTableBits); }
+   void InsertBinTable(ULong64_t hash, Long64_t bin);
    virtual TArray* GenerateArray() const = 0;
    Long64_t GetBinIndexForCurrentBin(Bool_t allocate);
+   Long64_t GetBinIndexForBuffer(const Char_t* buf, ULong64_t hash, Bool_t allocate);
 
    /// Increment the bin content of "bin" by "w",
    /// return the bin index.
@@ -69,6 +76,7 @@ class THnSparse: public THnBase {
       FillBinBase(w);
    }
    void InitStorage(Int_t* nbins, Int_t chunkSize) override;
+   void AddBins(const THnBase* h, Double_t c, Bool_t rebinned) override;
 
  public:
    ~THnSparse() override;
@@ -121,6 +121,7 @@ public:
    void SetBinning(EBinning);
    void SetNBins(UInt_t nbins);
    void SetUseBinsNEvents(UInt_t nEvents);
+   void SetGridEvaluation(Bool_t on = kTRUE);
    void SetTuneFactor(Double_t rho);
    void SetRange(Double_t xMin, Double_t xMax); ///< By default computed from the data
 
@@ -164,9 +165,14 @@ public:
       TKDE *fKDE;
       UInt_t fNWeights;               ///< Number of kernel weights (bandwidth as vectorized for binning)
       std::vector<Double_t> fWeights; ///< Kernel weights (bandwidth)
+      std::vector<Double_t> fGrid;    ///< Estimate at the nodes of the evaluation grid, empty if not used
+      Double_t fGridMin = 0;          ///< Position of the first grid node
+      Double_t fGridStep = 0;         ///< Distance between the grid nodes, the bin width
+      void ComputeFixedEstimate(Int_t qmin, Int_t qmax, std::vector<Double_t> &values) const;
    public:
       TKernel(Double_t weight, TKDE *kde);
       void ComputeAdaptiveWeights();
+      void ComputeGrid();
       Double_t operator()(Double_t x) const;
       Double_t GetWeight(Double_t x) const;
       Double_t GetFixedWeight() const;
@@ -206,6 +212,7 @@ private:
    Bool_t fUseBins;
    Bool_t fNewData;                    ///< Flag to control when new data are given
    Bool_t fUseMinMaxFromData;          ///< Flag top control if min and max must be used from data
+   Bool_t fUseGrid;                    ///< Flag to evaluate binned estimates by interpolation on a grid
 
    UInt_t fNBins;                      ///< Number of bins for binned data option
    UInt_t fNEvents;                    ///< Data's number of events
@@ -261,6 +268,7 @@ private:
    Double_t ComputeKernelSigma2() const;
    Double_t ComputeKernelMu() const;
    Double_t ComputeKernelIntegral() const;
+   Double_t GetKernelSupport() const;
    Double_t ComputeMidspread() ;
    void ComputeDataStats() ;
 
@@ -298,7 +306,7 @@ private:
    TF1* GetPDFUpperConfidenceInterval(Double_t confidenceLevel = 0.95, UInt_t npx = 100, Double_t xMin = 1.0, Double_t xMax = 0.0);
    TF1* GetPDFLowerConfidenceInterval(Double_t confidenceLevel = 0.95, UInt_t npx = 100, Double_t xMin = 1.0, Double_t xMax = 0.0);
 
-   ClassDefOverride(TKDE, 3) // One dimensional semi-parametric Kernel Density Estimation
+   ClassDefOverride(TKDE, 4) // One dimensional semi-parametric Kernel Density Estimation
 
 };
 
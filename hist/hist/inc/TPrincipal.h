@@ -16,6 +16,7 @@
 #include "TVectorD.h"
 #include "TMatrixD.h"
 
+class TCollection;
 class TList;
 
 class TPrincipal : public TNamed {
@@ -54,6 +55,7 @@ public:
    TPrincipal(Int_t nVariables, Option_t *opt="ND");
 
    virtual void       AddRow(const Double_t *x);
+   void               AddRows(Long64_t nRows, const Double_t *x);
    void       Browse(TBrowser *b) override;
    void       Clear(Option_t *option="") override;
    const TMatrixD    *GetCovarianceMatrix() const {return &fCovarianceMatrix;}
@@ -69,6 +71,7 @@ public:
    virtual void       MakeHistograms(const char *name = "pca", Option_t *option="epsdx"); // *MENU*
    virtual void       MakeMethods(const char *classname = "PCA", Option_t *option=""); // *MENU*
    virtual void       MakePrincipals();            // *MENU*
+   virtual Long64_t   Merge(TCollection *list);
    virtual void       P2X(const Double_t *p, Double_t *x, Int_t nTest);
    void       Print(Option_t *opt="MSE") const override;         // *MENU*
    virtual void       SumOfSquareResiduals(const Double_t *x, Double_t *s);
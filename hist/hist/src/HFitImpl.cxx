@@ -25,6 +25,7 @@
 #include "Math/WrappedTF1.h"
 #include "Math/WrappedMultiTF1.h"
 
+#include "TEnv.h"
 #include "TList.h"
 #include "TMath.h"
 #include "TROOT.h"
@@ -55,6 +56,11 @@ namespace HFit {
 
    int CheckFitFunction(const TF1 * f1, int hdim);
 
+#ifdef R__HAS_VECCORE
+   std::unique_ptr<TF1> MakeVectorizedCopy(const TF1 &f1);
+#endif
+
+   bool GenerateGradient(TF1 &f1);
 
    void GetFunctionRange(const TF1 & f1, ROOT::Fit::DataRange & range);
 
@@ -117,6 +123,33 @@ int HFit::CheckFitFunction(const TF1 * f1, int dim) {
 }
 
 
+#ifdef R__HAS_VECCORE
+std::unique_ptr<TF1> HFit::MakeVectorizedCopy(const TF1 &f1) {
+   // return a vectorized copy of a formula-based function, or nullptr if the formula cannot be vectorized
+   const TFormula *formula = f1.GetFormula();
+   if (!formula || formula->IsVectorized() || !formula->IsVectorizable())
+      return nullptr;
+   std::unique_ptr<TF1> fvec(ROOT::Math::Internal::CopyTF1Ptr(&f1));
+   fvec->SetVectorized(true);
+   if (!fvec->IsVectorized() || !fvec->GetFormula()->IsValid())
+      return nullptr;
+   return fvec;
+}
+#endif
+
+
+bool HFit::GenerateGradient(TF1 &f1) {
+   // generate the gradient of a formula-based function with respect to its parameters using automatic
+   // differentiation (clad), if enabled; the generated code is kept by the formula and reused in the next fits
+   if (!gEnv->GetValue("Hist.Fit.GenerateGradient", 1))
+      return false;
+   TFormula *formula = f1.GetFormula();
+   if (!formula || !formula->IsValid() || formula->IsVectorized() || formula->TestBit(TFormula::kLambda))
+      return false;
+   return formula->GenerateGradientPar();
+}
+
+
 void HFit::GetFunctionRange(const TF1 & f1, ROOT::Fit::DataRange & range) {
    // get the range form the function and fill and return the DataRange object
    Double_t fxmin, fymin, fzmin, fxmax, fymax, fzmax;
@@ -236,12 +269,42 @@ TFitResultPtr HFit::Fit(FitObject * h1, TF1 *f1 , Foption_t & fitOption , const
 
 
    // set the fit function
-   // if option grad is specified use gradient
-   if ( (linear || fitOption.Gradient) )
+   // Fumili and GSLMultiFit use the residuals, which are neither vectorized nor use the generated gradient
+   std::string minType = minOption.MinimizerType();
+   bool residualFit = minType.find("Fumili") != std::string::npos ||
+                      std::string(minOption.MinimizerAlgorithm()).find("Fumili") != std::string::npos ||
+                      minType == "GSLMultiFit";
+   bool vectorized = false;
+   std::unique_ptr<TF1> fvec;
+#ifdef R__HAS_VECCORE
+   // for large data sets, fit with a vectorized copy of a formula-based function when the fit supports it
+   // (the minimum number of points is set by Hist.Fit.VectorizeFormula in the rootrc file, 0 to disable)
+   int minVecSize = gEnv->GetValue("Hist.Fit.VectorizeFormula", 10000);
+   if (!linear && !fitOption.Gradient && !fitOption.User && !f1->IsVectorized() && !residualFit && minVecSize > 0 &&
+       fitdata->Size() >= (unsigned int)minVecSize && !opt.fIntegral && !opt.fBinVolume && !opt.fExpErrors &&
+       fitdata->GetErrorType() == ROOT::Fit::BinData::kValueError)
+      fvec = HFit::MakeVectorizedCopy(*f1);
+#endif
+   // if option grad is specified use gradient; otherwise use by default the gradient generated with automatic
+   // differentiation for formula-based functions (Hist.Fit.GenerateGradient in the rootrc file, 0 to disable)
+   bool gradient = fitOption.Gradient;
+   if (!gradient && !linear && !fitOption.User && !f1->IsVectorized() && !fvec && !residualFit && !opt.fIntegral &&
+       !opt.fExpErrors && !(fitdata->GetErrorType() == ROOT::Fit::BinData::kCoordError && fitdata->Opt().fCoordErrors))
+      gradient = HFit::GenerateGradient(*f1);
+   if ( (linear || gradient) )
       fitter->SetFunction(ROOT::Math::WrappedMultiTF1(*f1));
 #ifdef R__HAS_VECCORE
-   else if(f1->IsVectorized())
+   else if(f1->IsVectorized()) {
       fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiFunctionTempl<ROOT::Double_v> &>(ROOT::Math::WrappedMultiTF1Templ<ROOT::Double_v>(*f1)));
+      vectorized = true;
+   }
+   else if (fvec) {
+      // the fitter can outlive the fit (see TBackCompFitter): its function must own the copy
+      ROOT::Math::WrappedMultiTF1Templ<ROOT::Double_v> wfvec(*fvec);
+      wfvec.SetAndCopyFunction();
+      fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiFunctionTempl<ROOT::Double_v> &>(wfvec));
+      vectorized = true;
+   }
 #endif
    else
       fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiFunction &>(ROOT::Math::WrappedMultiTF1(*f1) ) );
@@ -394,6 +457,9 @@ TFitResultPtr HFit::Fit(FitObject * h1, TF1 *f1 , Foption_t & fitOption , const
       if ( int( fitResult.Errors().size()) >= f1->GetNpar() )
          f1->SetParErrors( &(fitResult.Errors().front()) );
 
+      // a vectorized fit has no scalar model function, needed e.g. for the confidence intervals
+      if (vectorized && !fitResult.FittedFunction())
+         tfr->SetModelFunction(std::make_shared<ROOT::Math::WrappedMultiTF1>(*f1));
 
    }
 
@@ -1448,6 +1448,39 @@ Double_t TF1::Eval(Double_t x, Double_t y, Double_t z, Double_t t) const
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the function at `n` points with the same parameters.
+///
+/// `x` holds one array of `n` coordinates per dimension of the function. Functions defined by a formula are
+/// evaluated with TFormula::EvalN(), in a single loop compiled by Cling; the other functions are evaluated point
+/// by point with EvalPar().
+///
+/// \param[in] n the number of points
+/// \param[in] x the coordinates of the points, one array per dimension
+/// \param[out] result the `n` function values
+/// \param[in] params the parameters, if nullptr the parameters of the function are used
+
+void TF1::EvalN(std::size_t n, const Double_t *const *x, Double_t *result, const Double_t *params)
+{
+   if (fType == EFType::kFormula) {
+      assert(fFormula);
+      fFormula->EvalN(n, x, result, params);
+      if (fNormalized && fNormIntegral != 0) {
+         for (std::size_t i = 0; i < n; ++i)
+            result[i] /= fNormIntegral;
+      }
+      return;
+   }
+
+   std::vector<Double_t> point(std::max(fNdim, 1));
+   InitArgs(point.data(), params);
+   for (std::size_t i = 0; i < n; ++i) {
+      for (Int_t d = 0; d < fNdim; ++d)
+         point[d] = x[d][i];
+      result[i] = EvalPar(point.data(), params);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Evaluate function with given coordinates and parameters.
 ///
@@ -3050,7 +3083,6 @@ void TF1::Paint(Option_t *choptin)
 TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
 {
    Int_t i;
-   Double_t xv[1];
 
    TH1 *histogram = nullptr;
 
@@ -3120,11 +3152,14 @@ TH1   *TF1::DoCreateHistogram(Double_t xmin, Double_t  xmax, Bool_t recreate)
    histogram->GetYaxis()->SetTitle(ytitle.Data());
    Double_t *parameters = GetParameters();
 
-   InitArgs(xv, parameters);
-   for (i = 1; i <= fNpx; i++) {
-      xv[0] = histogram->GetBinCenter(i);
-      histogram->SetBinContent(i, EvalPar(xv, parameters));
-   }
+   std::vector<Double_t> xs(fNpx);
+   std::vector<Double_t> values(fNpx);
+   for (i = 1; i <= fNpx; i++)
+      xs[i - 1] = histogram->GetBinCenter(i);
+   const Double_t *xsPtr = xs.data();
+   EvalN(fNpx, &xsPtr, values.data(), parameters);
+   for (i = 1; i <= fNpx; i++)
+      histogram->SetBinContent(i, values[i - 1]);
 
    // Copy Function attributes to histogram attributes.
    histogram->SetBit(TH1::kNoStats);
@@ -169,6 +169,15 @@ Double_t TF12::EvalPar(const Double_t *x, const Double_t *params)
    return fF2->EvalPar(xx,params);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the projection at `n` points, one after the other: the formula of a TF12 is only a placeholder.
+
+void TF12::EvalN(std::size_t n, const Double_t *const *x, Double_t *result, const Double_t *params)
+{
+   for (std::size_t i = 0; i < n; ++i)
+      result[i] = EvalPar(&x[0][i], params);
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Save primitive as a C++ statement(s) on output stream out
@@ -21,12 +21,18 @@
 #include "TInterpreterValue.h"
 #include "TFormula.h"
 #include "TRegexp.h"
+#include "TEnv.h"
+#include "TSystem.h"
 
 #include "ROOT/StringUtils.hxx"
 
 #include <array>
 #include <cassert>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <map>
 #include <unordered_map>
 #include <functional>
 #include <set>
@@ -264,6 +270,148 @@ static const TString gNamePrefix = "TFormula__";
 //static std::unordered_map<std::string,  TInterpreter::CallFuncIFacePtr_t::Generic_t> gClingFunctions = std::unordered_map<TString,  TInterpreter::CallFuncIFacePtr_t::Generic_t>();
 static std::unordered_map<std::string,  void *> gClingFunctions = std::unordered_map<std::string,  void * >();
 
+// Formula functions persisted across processes in the directory given by the Hist.TFormula.CacheDir rootrc variable.
+// The definitions are collected in a macro compiled with ACLiC, which reuses its library as long as the macro is
+// unchanged; the definitions declared by a process are added to the macro at the end of the process.
+// All the members are protected by gROOTMutex.
+struct TFormulaPersistentCache {
+   bool fInitialized = false;
+   std::string fSource;                                 ///< the macro, empty if the cache is disabled
+   std::unordered_map<std::string, std::string> fLoaded; ///< cling name -> definition, from the macro or declared since
+   std::map<std::string, std::string> fNew;             ///< cling name -> definition, to add to the macro at exit
+};
+
+static TFormulaPersistentCache &GetPersistentCache()
+{
+   static TFormulaPersistentCache cache;
+   return cache;
+}
+
+/// Read the definitions of the cache macro, one per line, by cling name. The name contains the hash of the
+/// expression, so duplicated definitions are only read once. Return false if the macro is not well formed, e.g. if
+/// a definition is repeated or truncated, and must be written again without them.
+static bool ReadPersistentCache(const std::string &source, std::map<std::string, std::string> &definitions)
+{
+   std::ifstream file(source);
+   if (!file)
+      return true;
+   bool wellFormed = true;
+   std::string line;
+   const std::string returnType = "Double_t ";
+   while (std::getline(file, line)) {
+      if (line.empty() || line.compare(0, 2, "//") == 0 || line.compare(0, 8, "#include") == 0)
+         continue;
+      const auto nameEnd = line.find('(');
+      if (line.compare(0, returnType.size(), returnType) != 0 || nameEnd == std::string::npos || line.back() != '}') {
+         wellFormed = false;
+         continue;
+      }
+      if (!definitions.emplace(line.substr(returnType.size(), nameEnd - returnType.size()), line).second)
+         wellFormed = false;
+   }
+   return wellFormed;
+}
+
+/// Replace the cache macro by the given definitions. The macro is written to a temporary file that is then renamed,
+/// so that concurrent processes, or a process that crashes while writing, never leave a partial macro
+static bool WritePersistentCacheFile(const std::string &source, const std::map<std::string, std::string> &definitions)
+{
+   const std::string tmpName = source + "." + std::to_string(gSystem->GetPid()) + ".tmp";
+   std::ofstream file(tmpName);
+   file << "// TFormula functions cached across processes, see Hist.TFormula.CacheDir\n"
+        << "#include \"TMath.h\"\n"
+        << "#include \"Math/PdfFuncMathCore.h\"\n"
+        << "#include \"Math/ProbFuncMathCore.h\"\n"
+        << "#include \"Math/SpecFuncMathCore.h\"\n";
+   for (const auto &nameAndDefinition : definitions)
+      file << nameAndDefinition.second << '\n';
+   file.close();
+   if (file.fail() || gSystem->Rename(tmpName.c_str(), source.c_str()) != 0) {
+      gSystem->Unlink(tmpName.c_str());
+      return false;
+   }
+   return true;
+}
+
+static void WritePersistentCache()
+{
+   auto &cache = GetPersistentCache();
+   if (cache.fSource.empty() || cache.fNew.empty())
+      return;
+   // start from the current macro, which other processes may have extended since it was loaded
+   std::map<std::string, std::string> definitions;
+   bool changed = !ReadPersistentCache(cache.fSource, definitions);
+   for (const auto &nameAndDefinition : cache.fNew)
+      changed |= definitions.insert(nameAndDefinition).second;
+   cache.fNew.clear();
+   if (changed && !WritePersistentCacheFile(cache.fSource, definitions))
+      ::Warning("TFormula", "cannot write the formula cache %s", cache.fSource.c_str());
+}
+
+/// Compile and load the persisted formula functions, on the first call in the process
+static TFormulaPersistentCache &InitPersistentCache()
+{
+   auto &cache = GetPersistentCache();
+   if (cache.fInitialized)
+      return cache;
+   cache.fInitialized = true;
+
+   TString dir = gEnv->GetValue("Hist.TFormula.CacheDir", "");
+   if (dir.IsNull() || gSystem->ExpandPathName(dir))
+      return cache;
+   if (gSystem->AccessPathName(dir) && gSystem->mkdir(dir, kTRUE) != 0) {
+      ::Warning("TFormula", "cannot create the formula cache directory %s, the cache is disabled", dir.Data());
+      return cache;
+   }
+   TString sourceName = "TFormulaCache.C";
+   const std::string source = gSystem->PrependPathName(dir, sourceName);
+
+   std::map<std::string, std::string> definitions;
+   if (!ReadPersistentCache(source, definitions))
+      WritePersistentCacheFile(source, definitions);
+   if (!definitions.empty() && gSystem->CompileMacro(source.c_str(), "kOs") != 1) {
+      const std::string badName = source + ".bad";
+      ::Warning("TFormula", "cannot compile the formula cache %s, it is moved to %s and rebuilt", source.c_str(),
+                badName.c_str());
+      gSystem->Rename(source.c_str(), badName.c_str());
+      definitions.clear();
+   }
+   cache.fLoaded.insert(definitions.begin(), definitions.end());
+
+   cache.fSource = source;
+   std::atexit(WritePersistentCache);
+   return cache;
+}
+
+/// Whether the formula function can be compiled outside of the interpreter session: its expression may only use the
+/// variables, the parameters and functions of TMath, ROOT::Math and the standard library
+static bool IsPersistable(const std::string &expression)
+{
+   std::size_t i = 0;
+   while (i < expression.size()) {
+      const char c = expression[i];
+      if (!std::isalpha(c) && c != '_') {
+         // skip numbers including their exponent, e.g. 1e-3
+         if (std::isdigit(c))
+            while (i < expression.size() && (std::isalnum(expression[i]) || expression[i] == '.'))
+               ++i;
+         else
+            ++i;
+         continue;
+      }
+      std::size_t end = i;
+      while (end < expression.size() &&
+             (std::isalnum(expression[end]) || expression[end] == '_' || expression[end] == ':'))
+         ++end;
+      const std::string identifier = expression.substr(i, end - i);
+      if (identifier != "x" && identifier != "p" && identifier.compare(0, 7, "TMath::") != 0 &&
+          identifier.compare(0, 12, "ROOT::Math::") != 0 && identifier.compare(0, 5, "std::") != 0)
+         return false;
+      i = end;
+   }
+   return true;
+}
+
 static void R__v5TFormulaUpdater(Int_t nobjects, TObject **from, TObject **to)
 {
    auto **fromv5 = (ROOT::v5::TFormula **)from;
@@ -758,6 +906,8 @@ void TFormula::Copy(TObject &obj) const
    fnew.fHessGenerationInput = fHessGenerationInput;
    fnew.fGradFuncPtr = fGradFuncPtr;
    fnew.fHessFuncPtr = fHessFuncPtr;
+   fnew.fEvalNGenerationInput = fEvalNGenerationInput;
+   fnew.fEvalNFuncPtr = fEvalNFuncPtr;
 
 }
 
@@ -774,6 +924,8 @@ void TFormula::Clear(Option_t * )
    fClingName = "";
 
    fMethod.reset();
+   fEvalNFuncPtr = nullptr;
+   fEvalNGenerationInput.clear();
 
    fClingVariables.clear();
    fClingParameters.clear();
@@ -882,6 +1034,20 @@ void TFormula::InputFormulaIntoCling()
       ROOT::GetROOT();
       R__ASSERT(gCling);
 
+      // The function may have been compiled by a previous process, see Hist.TFormula.CacheDir
+      const bool persistable = !fVectorized && !fLambdaPtr && fClingInput.BeginsWith("Double_t ");
+      if (persistable) {
+         R__LOCKGUARD(gROOTMutex);
+         auto &cache = InitPersistentCache();
+         auto it = cache.fLoaded.find(fClingName.Data());
+         if (it != cache.fLoaded.end() && it->second == fClingInput.Data()) {
+            fClingInitialized = PrepareEvalMethod();
+            if (fClingInitialized)
+               return;
+         }
+      }
+      const std::string definition = fClingInput.Data();
+
       // Trigger autoloading / autoparsing (ROOT-9840):
       TString triggerAutoparsing = "namespace ROOT_TFormula_triggerAutoParse {\n"; triggerAutoparsing += fClingInput + "\n}";
       gCling->ProcessLine(triggerAutoparsing);
@@ -894,6 +1060,17 @@ void TFormula::InputFormulaIntoCling()
       gCling->Declare(fClingInput);
       fClingInitialized = PrepareEvalMethod();
       if (!fClingInitialized) Error("InputFormulaIntoCling","Error compiling formula expression in Cling");
+
+      if (fClingInitialized && persistable) {
+         const auto bodyStart = definition.find("{ return ");
+         R__LOCKGUARD(gROOTMutex);
+         auto &cache = GetPersistentCache();
+         if (!cache.fSource.empty() && bodyStart != std::string::npos && !cache.fLoaded.count(fClingName.Data()) &&
+             IsPersistable(definition.substr(bodyStart + 9))) {
+            cache.fLoaded[fClingName.Data()] = definition;
+            cache.fNew[fClingName.Data()] = definition;
+         }
+      }
    }
 }
 
@@ -3114,6 +3291,13 @@ void TFormula::SetVectorized(Bool_t vectorized)
       fClingInput = fFormula;
 
       fMethod.reset();
+      // the generated gradient and hessian have the signature of the previous evaluation
+      fGradFuncPtr = nullptr;
+      fHessFuncPtr = nullptr;
+      fGradGenerationInput.clear();
+      fHessGenerationInput.clear();
+      fEvalNFuncPtr = nullptr;
+      fEvalNGenerationInput.clear();
 
       FillVecFunctionsShurtCuts();   // to replace with the right vectorized signature (e.g. sin  -> vecCore::math::Sin)
       PreProcessFormula(fFormula);
@@ -3125,6 +3309,51 @@ void TFormula::SetVectorized(Bool_t vectorized)
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the formula can be evaluated with vectorized input, i.e. if SetVectorized(true) is expected to
+/// succeed: the formula has variables and uses only operators and single-argument mathematical functions which
+/// have a vectorized version (sin, exp, sqrt, ...). Functions with several arguments (pow, which is also used for
+/// `^`, min, max, atan2), other functions (e.g. TMath::Landau) and comparison or logical operators are not
+/// supported. Always false without VecCore support.
+
+Bool_t TFormula::IsVectorizable() const
+{
+#ifdef R__HAS_VECCORE
+   if (fNdim == 0 || !fFormula.Length() || TestBit(TFormula::kLambda))
+      return false;
+   static const std::set<std::string> vecFunctions = {"sin",  "cos",  "exp",  "log",  "log10", "tan",  "asin",
+                                                      "acos", "atan", "sqrt", "ceil", "floor", "cbrt", "abs"};
+   const Ssiz_t n = fFormula.Length();
+   for (Ssiz_t i = 0; i < n;) {
+      const char c = fFormula[i];
+      if (c == '[') {
+         // skip the parameter names
+         while (i < n && fFormula[i] != ']')
+            ++i;
+         ++i;
+      } else if (isalnum(c) || c == '_' || c == ':') {
+         Ssiz_t j = i;
+         while (j < n && (isalnum(fFormula[j]) || fFormula[j] == '_' || fFormula[j] == ':'))
+            ++j;
+         Ssiz_t k = j;
+         while (k < n && fFormula[k] == ' ')
+            ++k;
+         // numbers (such as 1e-3) are not names
+         if (k < n && fFormula[k] == '(' && !isdigit(c) && !vecFunctions.count(std::string(fFormula.Data() + i, j - i)))
+            return false;
+         i = j;
+      } else if (strchr("<>=!&|?", c)) {
+         return false;
+      } else {
+         ++i;
+      }
+   }
+   return true;
+#else
+   return false;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 Double_t TFormula::EvalPar(const Double_t *x,const Double_t *params) const
 {
@@ -3169,6 +3398,88 @@ Double_t TFormula::EvalPar(const Double_t *x,const Double_t *params) const
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Declare to Cling a function that evaluates the expression of the formula in a loop over a span of points,
+///
+///     void TFormula____idN_evaln(Double_t **xs, Double_t *p, Double_t *result, unsigned long n)
+///
+/// The expression is inlined in the loop body, so that the compiler can vectorize the loop instead of calling
+/// the compiled formula through a function pointer for every point.
+
+bool TFormula::GenerateEvalN()
+{
+   if (fEvalNFuncPtr)
+      return true;
+   if (HasEvalNGenerationFailed() || !fClingInitialized || fVectorized || TestBit(kLambda) || fClingName.IsNull())
+      return false;
+
+   // Formulas with the same expression share their cling name and thus the loop
+   if (!gInterpreter->GetFunction(/*cl*/ nullptr, GetEvalNFuncName().c_str())) {
+      // Recover the expression from the definition of the formula, see PrepareFormula()
+      const std::string clingInput(fClingInput.Data());
+      const auto begin = clingInput.find("{ return ");
+      const auto end = clingInput.rfind(" ; }");
+      if (begin == std::string::npos || end == std::string::npos || end < begin) {
+         fEvalNGenerationInput = "// no expression found in the definition of " + std::string(fClingName.Data());
+         return false;
+      }
+      const auto expression = clingInput.substr(begin + 9, end - begin - 9);
+
+      std::string point;
+      if (fNdim > 0) {
+         point = "      Double_t x[" + std::to_string(fNdim) + "] = {";
+         for (int i = 0; i < fNdim; ++i)
+            point += (i ? ", xs[" : "xs[") + std::to_string(i) + "][i]";
+         point += "};\n";
+      }
+      fEvalNGenerationInput = "#pragma cling optimize(2)\n"
+                              "void " + GetEvalNFuncName() +
+                              "(Double_t **xs, Double_t *p, Double_t *result, unsigned long n) {\n"
+                              "   (void)xs; (void)p;\n"
+                              "   for (unsigned long i = 0; i < n; ++i) {\n" +
+                              point + "      result[i] = " + expression + ";\n   }\n}";
+      if (!gInterpreter->Declare(fEvalNGenerationInput.c_str()))
+         return false;
+   } else if (fEvalNGenerationInput.empty()) {
+      fEvalNGenerationInput = GetEvalNFuncName();
+   }
+
+   TMethodCall method;
+   method.InitWithPrototype(GetEvalNFuncName().c_str(), "Double_t**,Double_t*,Double_t*,unsigned long");
+   if (method.IsValid())
+      fEvalNFuncPtr = prepareFuncPtr(&method);
+   return fEvalNFuncPtr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void TFormula::EvalN(std::size_t n, const Double_t *const *x, Double_t *result, const Double_t *params) const
+{
+   if (n == 0)
+      return;
+
+   if (!fEvalNFuncPtr && !HasEvalNGenerationFailed()) {
+      R__LOCKGUARD(gROOTMutex);
+      const_cast<TFormula *>(this)->GenerateEvalN();
+   }
+
+   if (fEvalNFuncPtr) {
+      Double_t **xs = const_cast<Double_t **>(x);
+      Double_t *pars = const_cast<Double_t *>(params ? params : fClingParameters.data());
+      unsigned long nPoints = n;
+      void *args[4] = {&xs, &pars, &result, &nPoints};
+      (*fEvalNFuncPtr)(nullptr, 4, args, /*ret*/ nullptr);
+      return;
+   }
+
+   std::vector<Double_t> point(std::max(fNdim, 1));
+   for (std::size_t i = 0; i < n; ++i) {
+      for (int d = 0; d < fNdim; ++d)
+         point[d] = x[d][i];
+      result[i] = EvalPar(point.data(), params);
+   }
+}
+
 bool TFormula::fIsCladRuntimeIncluded = false;
 
 static bool functionExists(const string &Name) {
@@ -9,6 +9,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <cstdio>
@@ -17,6 +18,7 @@
 #include <sstream>
 #include <cmath>
 #include <iostream>
+#include <typeinfo>
 
 #include "TROOT.h"
 #include "TBuffer.h"
@@ -3328,6 +3330,84 @@ TH1* TH1::FFT(TH1* h_output, Option_t *option)
    return h_output;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fast path of Fill(x, w) for TH1D and TH1F with CanFillFast(): the same as Fill(x, w), but with the bin contents
+/// `array` of the derived class instead of the virtual AddBinContent() and with the inline
+/// TAxis::FindFixBinUniform().
+
+template <typename T>
+Int_t TH1::DoFillFast(T *array, Double_t x, Double_t w)
+{
+   fEntries++;
+   const Int_t bin = fXaxis.FindFixBinUniform(x);
+   if (!fSumw2.fN && w != 1.0 && !TestBit(TH1::kIsNotW))
+      Sumw2(); // must be called before adding to the bin content
+   if (fSumw2.fN)
+      fSumw2.fArray[bin] += w * w;
+   array[bin] += T(w);
+   if (bin == 0 || bin > fXaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour())
+         return -1;
+   }
+   fTsumw += w;
+   fTsumw2 += w * w;
+   fTsumwx += w * x;
+   fTsumwx2 += w * x * x;
+   return bin;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fast path of DoFillN() for TH1D and TH1F with CanFillFast(). The bins of a block of entries are computed first,
+/// in a loop without branches that the compiler vectorizes; then the block is added to the bin contents and the
+/// statistics, in the order of the entries, so that the result is the same as that of DoFillN().
+
+template <typename T>
+void TH1::DoFillNFast(T *array, Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
+{
+   constexpr Int_t kBlockSize = 256;
+   Int_t bins[kBlockSize];
+
+   fEntries += ntimes;
+   const Int_t nbins = fXaxis.GetNbins();
+   const Double_t xmin = fXaxis.GetXmin();
+   const Double_t xmax = fXaxis.GetXmax();
+   const Double_t width = xmax - xmin;
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+
+   for (Int_t first = 0; first < ntimes; first += kBlockSize) {
+      const Int_t n = std::min(kBlockSize, ntimes - first);
+      const Double_t *xblock = x + Long64_t(first) * stride;
+      for (Int_t i = 0; i < n; ++i) {
+         // As TAxis::FindFixBinUniform(), but everything is computed unconditionally, which lets the compiler
+         // vectorize the loop. The clamping only keeps the conversion defined for values outside of the axis.
+         const Double_t xi = xblock[i * stride];
+         const Double_t pos = std::max(-1., std::min(Double_t(nbins), nbins * (xi - xmin) / width));
+         const Int_t bin = 1 + int(pos);
+         const Int_t underflow = xi < xmin;
+         const Int_t overflow = !(xi < xmax); // also catches NaN
+         bins[i] = underflow ? 0 : (overflow ? nbins + 1 : bin);
+      }
+
+      const Double_t *wblock = w ? w + Long64_t(first) * stride : nullptr;
+      for (Int_t i = 0; i < n; ++i) {
+         const Int_t bin = bins[i];
+         const Double_t ww = wblock ? wblock[i * stride] : 1.;
+         if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))
+            Sumw2();
+         if (fSumw2.fN)
+            fSumw2.fArray[bin] += ww * ww;
+         array[bin] += T(ww);
+         if ((bin == 0 || bin > nbins) && !statOverflows)
+            continue;
+         const Double_t xi = xblock[i * stride];
+         fTsumw += ww;
+         fTsumw2 += ww * ww;
+         fTsumwx += ww * xi;
+         fTsumwx2 += ww * xi * xi;
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment bin with abscissa X by 1.
 ///
@@ -3344,6 +3424,13 @@ Int_t TH1::Fill(Double_t x)
 {
    if (fBuffer)  return BufferFill(x,1);
 
+   if (CanFillFast()) {
+      if (typeid(*this) == typeid(TH1D))
+         return DoFillFast(static_cast<TH1D *>(this)->GetArray(), x, 1.);
+      if (typeid(*this) == typeid(TH1F))
+         return DoFillFast(static_cast<TH1F *>(this)->GetArray(), x, 1.);
+   }
+
    Int_t bin;
    fEntries++;
    bin =fXaxis.FindBin(x);
@@ -3377,6 +3464,13 @@ Int_t TH1::Fill(Double_t x, Double_t w)
 
    if (fBuffer) return BufferFill(x,w);
 
+   if (CanFillFast()) {
+      if (typeid(*this) == typeid(TH1D))
+         return DoFillFast(static_cast<TH1D *>(this)->GetArray(), x, w);
+      if (typeid(*this) == typeid(TH1F))
+         return DoFillFast(static_cast<TH1F *>(this)->GetArray(), x, w);
+   }
+
    Int_t bin;
    fEntries++;
    bin =fXaxis.FindBin(x);
@@ -3471,6 +3565,17 @@ void TH1::FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride
 
 void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
 {
+   if (CanFillFast()) {
+      if (typeid(*this) == typeid(TH1D)) {
+         DoFillNFast(static_cast<TH1D *>(this)->GetArray(), ntimes, x, w, stride);
+         return;
+      }
+      if (typeid(*this) == typeid(TH1F)) {
+         DoFillNFast(static_cast<TH1F *>(this)->GetArray(), ntimes, x, w, stride);
+         return;
+      }
+   }
+
    Int_t bin,i;
 
    fEntries += ntimes;
@@ -3972,6 +4077,11 @@ TFitResultPtr TH1::Fit(const char *fname ,Option_t *option ,Option_t *goption, D
 ///   - for linear functions (`polN`, `chenbyshev` or formula expressions combined using operator `++`) a linear minimization is used.
 ///   - only the status of the fit is returned;
 ///   - the fit is performed in Multithread whenever is enabled in ROOT;
+///   - a formula-based function is evaluated in vectorized mode on large data sets (see TFormula::IsVectorizable and
+///     `Hist.Fit.VectorizeFormula` in the rootrc file) when ROOT is built with VecCore;
+///   - otherwise, for a formula-based function, the minimizer uses the gradient (and, with Minuit2, the Hessian)
+///     with respect to the parameters generated by automatic differentiation, as with option "G" (see
+///     TFormula::GenerateGradientPar and `Hist.Fit.GenerateGradient` in the rootrc file);
 ///   - only the last fitted function is saved in the histogram;
 ///   - the histogram is drawn after fitting overalyed with the resulting fitting function
 ///
@@ -9106,6 +9216,17 @@ void TH1::SetBinContent(Int_t bin, Double_t content)
    UpdateBinContent(bin, content);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the content of n bins, given by their global bin numbers (see TH1::GetBin).
+/// This is equivalent to calling SetBinContent(bins[i], contents[i]) for every i,
+/// with a single call, e.g. from Python with NumPy arrays.
+
+void TH1::SetBinContentN(Int_t n, const Int_t *bins, const Double_t *contents)
+{
+   for (Int_t i = 0; i < n; ++i)
+      SetBinContent(bins[i], contents[i]);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// See convention for numbering bins in TH1::GetBin
 
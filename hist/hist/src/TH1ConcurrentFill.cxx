@@ -0,0 +1,87 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TH1ConcurrentFill.h"
+
+#include "TError.h"
+#include "TH1.h"
+#include "TH3.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor; fillers are usually obtained with TH1ConcurrentFillManager::MakeFiller().
+
+ROOT::TH1ConcurrentFiller::TH1ConcurrentFiller(TH1ConcurrentFillManager &manager, std::size_t bufferSize)
+   : fManager(&manager), fNCoords(manager.GetNCoordinates()), fBufferSize(bufferSize > 0 ? bufferSize : 1)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ROOT::TH1ConcurrentFiller::InvalidSignature() const
+{
+   Error("TH1ConcurrentFiller::Fill", "Invalid signature for a histogram with %d coordinates - do nothing", fNCoords);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the buffered entries into the histogram; waits for the other fillers of the histogram, if necessary.
+
+void ROOT::TH1ConcurrentFiller::Flush()
+{
+   if (fW.empty())
+      return;
+   fManager->FillN(fW.size(), fX.data(), fY.data(), fZ.data(), fW.data());
+   fX.clear();
+   fY.clear();
+   fZ.clear();
+   fW.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The histogram must outlive the manager and its fillers.
+
+ROOT::TH1ConcurrentFillManager::TH1ConcurrentFillManager(TH1 &hist)
+   : fHist(hist), fNDim(hist.GetDimension()), fNCoords(fNDim)
+{
+   if (hist.InheritsFrom(TProfile::Class())) {
+      fProfile = static_cast<TProfile *>(&hist);
+      fNCoords = 2;
+   } else if (hist.InheritsFrom(TProfile2D::Class())) {
+      fProfile2D = static_cast<TProfile2D *>(&hist);
+      fNCoords = 3;
+   } else if (fNDim == 3 && hist.InheritsFrom(TH3::Class()) && !hist.InheritsFrom("TProfile3D")) {
+      fHist3 = static_cast<TH3 *>(&hist);
+   } else if (fNDim == 3) {
+      Error("TH1ConcurrentFillManager", "%s is not supported, its entries will be lost", hist.GetName());
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill n entries into the histogram, under the lock of the manager.
+
+void ROOT::TH1ConcurrentFillManager::FillN(Int_t n, const Double_t *x, const Double_t *y, const Double_t *z,
+                                           const Double_t *w)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   if (fProfile) {
+      fProfile->FillN(n, x, y, w);
+   } else if (fProfile2D) {
+      for (Int_t i = 0; i < n; ++i)
+         fProfile2D->Fill(x[i], y[i], z[i], w[i]);
+   } else if (fNDim == 1) {
+      fHist.FillN(n, x, w);
+   } else if (fNDim == 2) {
+      fHist.FillN(n, x, y, w, 1);
+   } else if (fHist3) {
+      for (Int_t i = 0; i < n; ++i)
+         fHist3->Fill(x[i], y[i], z[i], w[i]);
+   }
+}
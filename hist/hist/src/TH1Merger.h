@@ -17,6 +17,8 @@
 #include "TProfile3D.h"
 #include "TList.h"
 
+#include <vector>
+
 class TH1Merger {
 
 public:
@@ -116,6 +118,13 @@ private:
 
    Bool_t SameAxesMerge();
 
+   void MergeBins(const std::vector<const TH1 *> &hists);
+
+   void MergeBinRange(const std::vector<const TH1 *> &hists, Int_t first, Int_t last);
+
+   template <class TArrayType>
+   Bool_t MergeArrays(const TH1 *hist, Int_t first, Int_t last);
+
    Bool_t DifferentAxesMerge();
 
    Bool_t LabelMerge(bool newLimits = false);
@@ -136,6 +145,7 @@ private:
    Bool_t fIsProfile1D = kFALSE;
    Bool_t fIsProfile2D = kFALSE;
    Bool_t fIsProfile3D = kFALSE;
+   Bool_t fIsArrayMerge = kFALSE; // bins of inputs of the same class as fH0 are merged as arrays (see SameAxesMerge)
    TH1 *fH0;                      //! histogram on which the list is merged
    TH1 *fHClone;                  //! copy of fH0 - managed by this class
    TList fInputList;              // input histogram List
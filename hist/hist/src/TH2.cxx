@@ -28,6 +28,8 @@
 #include "TVirtualHistPainter.h"
 #include "snprintf.h"
 
+#include <typeinfo>
+
 ClassImp(TH2);
 
 /** \addtogroup Histograms
@@ -351,6 +353,37 @@ Int_t TH2::Fill(Double_t )
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fast path of Fill(x, y, w) for TH2D with CanFillFast(): the same as Fill(x, y, w), but with the bin contents
+/// `array` of the derived class instead of the virtual AddBinContent() and with the inline
+/// TAxis::FindFixBinUniform().
+
+template <typename T>
+Int_t TH2::DoFillFast(T *array, Double_t x, Double_t y, Double_t w)
+{
+   fEntries++;
+   const Int_t binx = fXaxis.FindFixBinUniform(x);
+   const Int_t biny = fYaxis.FindFixBinUniform(y);
+   const Int_t bin = biny * (fXaxis.GetNbins() + 2) + binx;
+   if (!fSumw2.fN && w != 1.0 && !TestBit(TH1::kIsNotW))
+      Sumw2(); // must be called before adding to the bin content
+   if (fSumw2.fN)
+      fSumw2.fArray[bin] += w * w;
+   array[bin] += T(w);
+   if (binx == 0 || binx > fXaxis.GetNbins() || biny == 0 || biny > fYaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour())
+         return -1;
+   }
+   fTsumw += w;
+   fTsumw2 += w * w;
+   fTsumwx += w * x;
+   fTsumwx2 += w * x * x;
+   fTsumwy += w * y;
+   fTsumwy2 += w * y * y;
+   fTsumwxy += w * x * y;
+   return bin;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment cell defined by x,y by 1.
 ///
@@ -370,6 +403,9 @@ Int_t TH2::Fill(Double_t x,Double_t y)
 {
    if (fBuffer) return BufferFill(x,y,1);
 
+   if (CanFillFast() && typeid(*this) == typeid(TH2D))
+      return DoFillFast(static_cast<TH2D *>(this)->GetArray(), x, y, 1.);
+
    Int_t binx, biny, bin;
    fEntries++;
    binx = fXaxis.FindBin(x);
@@ -414,6 +450,9 @@ Int_t TH2::Fill(Double_t x, Double_t y, Double_t w)
 {
    if (fBuffer) return BufferFill(x,y,w);
 
+   if (CanFillFast() && typeid(*this) == typeid(TH2D))
+      return DoFillFast(static_cast<TH2D *>(this)->GetArray(), x, y, w);
+
    Int_t binx, biny, bin;
    fEntries++;
    binx = fXaxis.FindBin(x);
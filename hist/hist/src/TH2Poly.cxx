@@ -16,7 +16,10 @@
 #include "Riostream.h"
 #include "TList.h"
 #include "TMath.h"
+
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
 ClassImp(TH2Poly);
 
@@ -57,7 +60,9 @@ histogram limits is added. This is done when the default constructor (with no
 arguments) is used. It generates a histogram with no limits along the X and Y
 axis. Adding bins to it will extend it up to a proper size.
 
-`TH2Poly` implements a partitioning algorithm to speed up bins' filling
+`TH2Poly` finds the bin containing a coordinate with a search tree over the
+bounding boxes of the bins (see the "Bin Search Tree" section for details).
+It also implements a partitioning algorithm
 (see the "Partitioning Algorithm" section for details).
 The partitioning algorithm divides the histogram into regions called cells.
 The bins that each cell intersects are recorded in an array of `TList`s.
@@ -139,6 +144,18 @@ filling, it also adds a constant time delay into the code. When `Fill()`
 is to be called many times, it is more efficient to divide the histogram into
 a large number cells. However, if the histogram is to be filled only a few
 times, it is better to divide into a small number of cells.
+
+## Bin Search Tree
+`FindBin()`, `Fill()` and `FillN()` do not use the partition: with many
+irregular bins, e.g. tens of thousands of detector cells, the cells of a
+uniform partition contain either many bins or none. Instead, the bins are
+searched with a bounding volume hierarchy, a binary tree whose leaves hold a
+few bins each and whose nodes store the bounding box of the bins below them.
+`IsInside()` is thus only called for the bins whose bounding box contains the
+coordinate, and the cost of a lookup grows with the logarithm of the number of
+bins. The tree is built on the first lookup after bins were added, and does
+not need to be tuned. As with the partition, a coordinate contained in several
+bins belongs to the bin with the lowest bin number.
 */
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -252,6 +269,8 @@ Int_t TH2Poly::AddBin(TObject *poly)
 
    fBins->Add((TObject*) bin);
    SetNewBinAdded(kTRUE);
+   // The search tree is rebuilt on the next lookup
+   fBVHNodes.clear();
 
    // Adds the bin to the partition matrix
    AddBinToPartition(bin);
@@ -433,6 +452,146 @@ void TH2Poly::AddBinToPartition(TH2PolyBin *bin)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Builds the bounding volume hierarchy used by FindBin() and Fill() to find
+/// the bin containing a point. Called on the first lookup after bins were added.
+///
+/// The tree is built top-down: the bins of a node are split at the median of
+/// the centers of their bounding boxes, along the axis on which the centers are
+/// the most spread, until at most kBVHLeafSize bins remain in a node. Each node
+/// stores the bounding box of its bins and their lowest bin number.
+
+void TH2Poly::BuildBVH()
+{
+   constexpr Int_t kBVHLeafSize = 4;
+
+   fBVHBounds.clear();
+   fBVHNodes.clear();
+   fBVHBins.clear();
+   const Int_t nbins = fBins ? fBins->GetSize() : 0;
+   if (nbins == 0) return;
+
+   std::vector<TH2PolyBin *> bins;
+   std::vector<Double_t> boxes;   // xmin, xmax, ymin, ymax of each bin
+   bins.reserve(nbins);
+   boxes.reserve(4 * nbins);
+   TIter next(fBins);
+   TObject *obj;
+   while ((obj = next())) {
+      auto bin = (TH2PolyBin *)obj;
+      bins.push_back(bin);
+      boxes.push_back(bin->GetXMin());
+      boxes.push_back(bin->GetXMax());
+      boxes.push_back(bin->GetYMin());
+      boxes.push_back(bin->GetYMax());
+   }
+   std::vector<Int_t> order(nbins);
+   for (Int_t i = 0; i < nbins; i++) order[i] = i;
+
+   struct RTask { Int_t fNode, fBegin, fEnd; };
+   std::vector<RTask> tasks{{0, 0, nbins}};
+   fBVHNodes.resize(3);
+   fBVHBounds.resize(4);
+   while (!tasks.empty()) {
+      const RTask task = tasks.back();
+      tasks.pop_back();
+
+      Double_t box[4] = {boxes[4 * order[task.fBegin]], boxes[4 * order[task.fBegin] + 1],
+                         boxes[4 * order[task.fBegin] + 2], boxes[4 * order[task.fBegin] + 3]};
+      Double_t center[4] = {box[0] + box[1], box[0] + box[1], box[2] + box[3], box[2] + box[3]};
+      Int_t minNumber = bins[order[task.fBegin]]->GetBinNumber();
+      for (Int_t i = task.fBegin + 1; i < task.fEnd; i++) {
+         const Double_t *b = &boxes[4 * order[i]];
+         box[0] = std::min(box[0], b[0]);
+         box[1] = std::max(box[1], b[1]);
+         box[2] = std::min(box[2], b[2]);
+         box[3] = std::max(box[3], b[3]);
+         center[0] = std::min(center[0], b[0] + b[1]);
+         center[1] = std::max(center[1], b[0] + b[1]);
+         center[2] = std::min(center[2], b[2] + b[3]);
+         center[3] = std::max(center[3], b[2] + b[3]);
+         minNumber = std::min(minNumber, bins[order[i]]->GetBinNumber());
+      }
+      std::copy(box, box + 4, &fBVHBounds[4 * task.fNode]);
+      fBVHNodes[3 * task.fNode + 2] = minNumber;
+
+      if (task.fEnd - task.fBegin <= kBVHLeafSize) {
+         fBVHNodes[3 * task.fNode] = task.fBegin;
+         fBVHNodes[3 * task.fNode + 1] = task.fEnd - task.fBegin;
+         continue;
+      }
+
+      // Split at the median (twice the center, which orders the same) along the longer axis
+      const Int_t axis = (center[1] - center[0] >= center[3] - center[2]) ? 0 : 2;
+      const Int_t mid = (task.fBegin + task.fEnd) / 2;
+      std::nth_element(order.begin() + task.fBegin, order.begin() + mid, order.begin() + task.fEnd,
+                       [&boxes, axis](Int_t a, Int_t b) {
+                          return boxes[4 * a + axis] + boxes[4 * a + axis + 1] <
+                                 boxes[4 * b + axis] + boxes[4 * b + axis + 1];
+                       });
+      const Int_t left = fBVHNodes.size() / 3;
+      fBVHNodes[3 * task.fNode] = left;
+      fBVHNodes[3 * task.fNode + 1] = 0;
+      fBVHNodes.resize(fBVHNodes.size() + 6);
+      fBVHBounds.resize(fBVHBounds.size() + 8);
+      tasks.push_back({left, task.fBegin, mid});
+      tasks.push_back({left + 1, mid, task.fEnd});
+   }
+
+   fBVHBins.resize(nbins);
+   for (Int_t i = 0; i < nbins; i++) fBVHBins[i] = bins[order[i]];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the bin with the lowest bin number among the bins containing (x,y),
+/// or nullptr if there is none, i.e. if (x,y) is in the sea. Builds the bin
+/// search tree if needed.
+///
+/// Only the nodes whose bounding box contains (x,y) are visited, and among those
+/// only the ones that can contain a bin with a lower number than the one found.
+
+TH2PolyBin *TH2Poly::FindBinInBVH(Double_t x, Double_t y)
+{
+   if (fBVHNodes.empty()) BuildBVH();
+   if (fBVHNodes.empty()) return nullptr;
+
+   TH2PolyBin *found = nullptr;
+   Int_t foundNumber = std::numeric_limits<Int_t>::max();
+
+   // The median splits keep the depth of the tree below log2 of the number of bins
+   Int_t stack[64];
+   Int_t nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack > 0) {
+      const Int_t node = stack[--nstack];
+      const Double_t *box = &fBVHBounds[4 * node];
+      if (fBVHNodes[3 * node + 2] >= foundNumber ||
+          x < box[0] || x > box[1] || y < box[2] || y > box[3]) continue;
+
+      const Int_t first = fBVHNodes[3 * node];
+      const Int_t count = fBVHNodes[3 * node + 1];
+      if (count == 0) {
+         // Visit first the child which has the lower bin number
+         if (fBVHNodes[3 * first + 2] < fBVHNodes[3 * (first + 1) + 2]) {
+            stack[nstack++] = first + 1;
+            stack[nstack++] = first;
+         } else {
+            stack[nstack++] = first;
+            stack[nstack++] = first + 1;
+         }
+         continue;
+      }
+      for (Int_t i = first; i < first + count; i++) {
+         TH2PolyBin *bin = fBVHBins[i];
+         if (bin->GetBinNumber() < foundNumber && bin->IsInside(x, y)) {
+            found = bin;
+            foundNumber = bin->GetBinNumber();
+         }
+      }
+   }
+   return found;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Changes the number of partition cells in the histogram.
 /// Deletes the old partition and constructs a new one.
@@ -555,36 +714,14 @@ Int_t TH2Poly::FindBin(Double_t x, Double_t y, Double_t)
    else if (x > fXaxis.GetXmin()) overflow += -1;
    if (overflow != -5) return overflow;
 
-   // Finds the cell (x,y) coordinates belong to
-   Int_t n = (Int_t)(floor((x-fXaxis.GetXmin())/fStepX));
-   Int_t m = (Int_t)(floor((y-fYaxis.GetXmin())/fStepY));
-
-   // Make sure the array indices are correct.
-   if (n>=fCellX) n = fCellX-1;
-   if (m>=fCellY) m = fCellY-1;
-   if (n<0)       n = 0;
-   if (m<0)       m = 0;
-
-   if (fIsEmpty[n+fCellX*m]) return -5;
-
-   TH2PolyBin *bin;
-
-   TIter next(&fCells[n+fCellX*m]);
-   TObject *obj;
-
-   // Search for the bin in the cell
-   while ((obj=next())) {
-      bin  = (TH2PolyBin*)obj;
-      if (bin->IsInside(x,y)) return bin->GetBinNumber();
-   }
-
-   // If the search has not returned a bin, the point must be on "the sea"
-   return -5;
+   // If the search does not return a bin, the point must be on "the sea"
+   TH2PolyBin *bin = FindBinInBVH(x, y);
+   return bin ? bin->GetBinNumber() : -5;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment the bin containing (x,y) by 1.
-/// Uses the partitioning algorithm.
+/// Uses the bin search tree, see FindBin().
 
 Int_t TH2Poly::Fill(Double_t x, Double_t y)
 {
@@ -593,7 +730,7 @@ Int_t TH2Poly::Fill(Double_t x, Double_t y)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment the bin containing (x,y) by w.
-/// Uses the partitioning algorithm.
+/// Uses the bin search tree, see FindBin().
 
 Int_t TH2Poly::Fill(Double_t x, Double_t y, Double_t w)
 {
@@ -621,57 +758,33 @@ Int_t TH2Poly::Fill(Double_t x, Double_t y, Double_t w)
       return overflow;
    }
 
-   // Finds the cell (x,y) coordinates belong to
-   Int_t n = (Int_t)(floor((x-fXaxis.GetXmin())/fStepX));
-   Int_t m = (Int_t)(floor((y-fYaxis.GetXmin())/fStepY));
-
-   // Make sure the array indices are correct.
-   if (n>=fCellX) n = fCellX-1;
-   if (m>=fCellY) m = fCellY-1;
-   if (n<0)       n = 0;
-   if (m<0)       m = 0;
-
-   if (fIsEmpty[n+fCellX*m]) {
+   TH2PolyBin *bin = FindBinInBVH(x, y);
+   if (!bin) {
       fOverflow[4]+= w;
       if (fSumw2.fN) fSumw2.fArray[4] += w*w;
       return -5;
    }
 
-   TH2PolyBin *bin;
-   Int_t bi;
-
-   TIter next(&fCells[n+fCellX*m]);
-   TObject *obj;
-
-   while ((obj=next())) {
-      bin  = (TH2PolyBin*)obj;
-      // needs to account offset in array for overflow bins
-      bi = bin->GetBinNumber()-1+kNOverflow;
-      if (bin->IsInside(x,y)) {
-         bin->Fill(w);
-
-         // Statistics
-         fTsumw   = fTsumw + w;
-         fTsumw2  = fTsumw2 + w*w;
-         fTsumwx  = fTsumwx + w*x;
-         fTsumwx2 = fTsumwx2 + w*x*x;
-         fTsumwy  = fTsumwy + w*y;
-         fTsumwy2 = fTsumwy2 + w*y*y;
-         if (fSumw2.fN) {
-            assert(bi < fSumw2.fN);
-            fSumw2.fArray[bi] += w*w;
-         }
-         fEntries++;
-
-         SetBinContentChanged(kTRUE);
+   // needs to account offset in array for overflow bins
+   Int_t bi = bin->GetBinNumber()-1+kNOverflow;
+   bin->Fill(w);
 
-         return bin->GetBinNumber();
-      }
+   // Statistics
+   fTsumw   = fTsumw + w;
+   fTsumw2  = fTsumw2 + w*w;
+   fTsumwx  = fTsumwx + w*x;
+   fTsumwx2 = fTsumwx2 + w*x*x;
+   fTsumwy  = fTsumwy + w*y;
+   fTsumwy2 = fTsumwy2 + w*y*y;
+   if (fSumw2.fN) {
+      assert(bi < fSumw2.fN);
+      fSumw2.fArray[bi] += w*w;
    }
+   fEntries++;
+
+   SetBinContentChanged(kTRUE);
 
-   fOverflow[4]+= w;
-   if (fSumw2.fN) fSumw2.fArray[4] += w*w;
-   return -5;
+   return bin->GetBinNumber();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -705,14 +818,15 @@ Int_t TH2Poly::Fill(const char* name, Double_t w)
 ///                      (array size must be ntimes*stride)
 /// \param [in] x:       array of x values to be histogrammed
 /// \param [in] y:       array of y values to be histogrammed
-/// \param [in] w:       array of weights
+/// \param [in] w:       array of weights, or nullptr for unit weights
 /// \param [in] stride:  step size through arrays x, y and w
 
 void TH2Poly::FillN(Int_t ntimes, const Double_t* x, const Double_t* y,
                                const Double_t* w, Int_t stride)
 {
+   ntimes *= stride;
    for (int i = 0; i < ntimes; i += stride) {
-      Fill(x[i], y[i], w[i]);
+      Fill(x[i], y[i], w ? w[i] : 1.);
    }
 }
 
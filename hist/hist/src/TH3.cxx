@@ -25,6 +25,8 @@
 #include "TMath.h"
 #include "TObjString.h"
 
+#include <typeinfo>
+
 ClassImp(TH3);
 
 /** \addtogroup Histograms
@@ -330,6 +332,43 @@ Int_t TH3::Fill(Double_t )
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fast path of Fill(x, y, z, w) for TH3D with CanFillFast(): the same as Fill(x, y, z, w), but with the bin
+/// contents `array` of the derived class instead of the virtual AddBinContent() and with the inline
+/// TAxis::FindFixBinUniform().
+
+template <typename T>
+Int_t TH3::DoFillFast(T *array, Double_t x, Double_t y, Double_t z, Double_t w)
+{
+   fEntries++;
+   const Int_t binx = fXaxis.FindFixBinUniform(x);
+   const Int_t biny = fYaxis.FindFixBinUniform(y);
+   const Int_t binz = fZaxis.FindFixBinUniform(z);
+   const Int_t bin = binx + (fXaxis.GetNbins() + 2) * (biny + (fYaxis.GetNbins() + 2) * binz);
+   if (!fSumw2.fN && w != 1.0 && !TestBit(TH1::kIsNotW))
+      Sumw2(); // must be called before adding to the bin content
+   if (fSumw2.fN)
+      fSumw2.fArray[bin] += w * w;
+   array[bin] += T(w);
+   if (binx == 0 || binx > fXaxis.GetNbins() || biny == 0 || biny > fYaxis.GetNbins() || binz == 0 ||
+       binz > fZaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour())
+         return -1;
+   }
+   fTsumw += w;
+   fTsumw2 += w * w;
+   fTsumwx += w * x;
+   fTsumwx2 += w * x * x;
+   fTsumwy += w * y;
+   fTsumwy2 += w * y * y;
+   fTsumwxy += w * x * y;
+   fTsumwz += w * z;
+   fTsumwz2 += w * z * z;
+   fTsumwxz += w * x * z;
+   fTsumwyz += w * y * z;
+   return bin;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment cell defined by x,y,z by 1 .
 ///
@@ -340,6 +379,9 @@ Int_t TH3::Fill(Double_t x, Double_t y, Double_t z)
 {
    if (fBuffer) return BufferFill(x,y,z,1);
 
+   if (CanFillFast() && typeid(*this) == typeid(TH3D))
+      return DoFillFast(static_cast<TH3D *>(this)->GetArray(), x, y, z, 1.);
+
    Int_t binx, biny, binz, bin;
    fEntries++;
    binx = fXaxis.FindBin(x);
@@ -388,6 +430,9 @@ Int_t TH3::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
 {
    if (fBuffer) return BufferFill(x,y,z,w);
 
+   if (CanFillFast() && typeid(*this) == typeid(TH3D))
+      return DoFillFast(static_cast<TH3D *>(this)->GetArray(), x, y, z, w);
+
    Int_t binx, biny, binz, bin;
    fEntries++;
    binx = fXaxis.FindBin(x);
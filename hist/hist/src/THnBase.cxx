@@ -743,6 +743,34 @@ void THnBase::AddInternal(const THnBase* h, Double_t c, Bool_t rebinned)
       Sumw2();
    Bool_t haveErrors = GetCalculateErrors();
 
+   AddBins(h, c, rebinned);
+
+   // add also the statistics
+   fTsumw += c * h->fTsumw;
+   if (haveErrors) {
+      fTsumw2 += c * c * h->fTsumw2;
+      if (h->fTsumwx.fN == fNdimensions && h->fTsumwx2.fN == fNdimensions) {
+         for (Int_t d = 0; d < fNdimensions; ++d) {
+            fTsumwx[d] += c * h->fTsumwx[d];
+            fTsumwx2[d] += c * h->fTsumwx2[d];
+         }
+      }
+   }
+
+   Double_t nEntries = GetEntries() + c * h->GetEntries();
+   SetEntries(nEntries);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the bin contents and errors of h scaled by c to this histogram, for
+/// AddInternal(). Errors are added if this histogram has them enabled.
+/// Derived classes can override it with a faster implementation for their
+/// own storage.
+
+void THnBase::AddBins(const THnBase* h, Double_t c, Bool_t rebinned)
+{
+   Bool_t haveErrors = GetCalculateErrors();
+
    Double_t* x = nullptr;
    if (rebinned) {
       x = new Double_t[fNdimensions];
@@ -781,21 +809,6 @@ void THnBase::AddInternal(const THnBase* h, Double_t c, Bool_t rebinned)
 
    delete [] coord;
    delete [] x;
-
-   // add also the statistics
-   fTsumw += c * h->fTsumw;
-   if (haveErrors) {
-      fTsumw2 += c * c * h->fTsumw2;
-      if (h->fTsumwx.fN == fNdimensions && h->fTsumwx2.fN == fNdimensions) {
-         for (Int_t d = 0; d < fNdimensions; ++d) {
-            fTsumwx[d] += c * h->fTsumwx[d];
-            fTsumwx2[d] += c * h->fTsumwx2[d];
-         }
-      }
-   }
-
-   Double_t nEntries = GetEntries() + c * h->GetEntries();
-   SetEntries(nEntries);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
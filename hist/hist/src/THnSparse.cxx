@@ -16,6 +16,9 @@
 #include "TDataMember.h"
 #include "TDataType.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace {
 //______________________________________________________________________________
 //
@@ -318,9 +321,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromBuffer(const Char_t* buf) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the hash table of THnSparse.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -570,14 +573,19 @@ Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
 if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+This hash is used to lookup the linear index in fBinTable, an open-addressing
+hash table with linear probing that stores the hash and the linear index of
+each filled bin in one contiguous array. A lookup thus usually touches a
+single cache line of the table; the coordinates in the chunk are only compared
+for the slots that have the same hash. Two different coordinates can have the
+same hash only if the compact bin coordinates are larger than 8 bytes; this is
+extremely unlikely, and the following slots are probed in that case.
+The table is transient: it is rebuilt from the chunks after reading a
+THnSparse from a file. It is kept at most 3/4 full.
+
+Add() and Merge() of histograms with the same binning add the chunks of the
+other THnSparse directly, using its compact coordinates as they are: the bins
+are neither decompressed into coordinates nor looked up through GetBin().
 */
 
 
@@ -587,7 +595,7 @@ ClassImp(THnSparse);
 /// Construct an empty THnSparse.
 
 THnSparse::THnSparse():
-   fChunkSize(1024), fFilledBins(0), fCompactCoord(nullptr)
+   fChunkSize(1024), fFilledBins(0), fBinTableBits(0), fCompactCoord(nullptr)
 {
    fBinContent.SetOwner();
 }
@@ -604,7 +612,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
                      const Int_t* nbins, const Double_t* xmin, const Double_t* xmax,
                      Int_t chunksize):
    THnBase(name, title, dim, nbins, xmin, xmax),
-   fChunkSize(chunksize), fFilledBins(0), fCompactCoord(nullptr)
+   fChunkSize(chunksize), fFilledBins(0), fBinTableBits(0), fCompactCoord(nullptr)
 {
    fCompactCoord = new THnSparseCompactBinCoord(dim, nbins);
    fBinContent.SetOwner();
@@ -650,49 +658,68 @@ void THnSparse::InitStorage(Int_t* nbins, Int_t chunkSize)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///We have been streamed; set up fBins
+/// Build the hash table of the filled bins from the chunks, e.g. after the
+/// histogram has been read from a file.
 
 void THnSparse::FillExMap()
 {
-   TIter iChunk(&fBinContent);
-   THnSparseArrayChunk* chunk = nullptr;
-   THnSparseCoordCompression compactCoord(*GetCompactCoord());
+   fBinTable.clear();
+   fBinTableBits = 0;
+   ResizeBinTable(fFilledBins);
+   const THnSparseCompactBinCoord* cc = GetCompactCoord();
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
-   while ((chunk = (THnSparseArrayChunk*) iChunk())) {
-      const Int_t chunkSize = chunk->GetEntries();
-      Char_t* buf = chunk->fCoordinates;
+   for (Int_t iChunk = 0; iChunk < GetNChunks(); ++iChunk) {
+      THnSparseArrayChunk* chunk = GetChunk(iChunk);
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
-      const Char_t* endbuf = buf + singleCoordSize * chunkSize;
-      for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
-      }
+      const Char_t* buf = chunk->fCoordinates;
+      const Char_t* endbuf = buf + singleCoordSize * chunk->GetEntries();
+      for (; buf < endbuf; buf += singleCoordSize, ++idx)
+         InsertBinTable(cc->GetHashFromBuffer(buf), idx);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Grow the hash table of the filled bins such that it can hold nbins bins;
+/// the bins in the table are moved using their stored hashes.
+
+void THnSparse::ResizeBinTable(Long64_t nbins)
+{
+   Int_t bits = std::max(fBinTableBits, 4);
+   while (4 * nbins > 3 * (Long64_t(1) << bits))
+      ++bits;
+   if (bits == fBinTableBits)
+      return;
+
+   std::vector<ULong64_t> oldTable(ULong64_t(2) << bits, 0);
+   std::swap(oldTable, fBinTable);
+   fBinTableBits = bits;
+   for (std::size_t i = 0; i < oldTable.size(); i += 2) {
+      if (oldTable[i + 1])
+         InsertBinTable(oldTable[i], oldTable[i + 1] - 1);
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Add the bin with linear index "bin" and hash "hash" to the hash table of
+/// the filled bins, which must not contain it yet and must have a free slot.
+
+void THnSparse::InsertBinTable(ULong64_t hash, Long64_t bin)
+{
+   const ULong64_t mask = (ULong64_t(1) << fBinTableBits) - 1;
+   ULong64_t slot = GetBinTableSlot(hash);
+   while (fBinTable[2 * slot + 1])
+      slot = (slot + 1) & mask;
+   fBinTable[2 * slot] = hash;
+   fBinTable[2 * slot + 1] = bin + 1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Initialize storage for nbins
 
 void THnSparse::Reserve(Long64_t nbins) {
-   if (!fBins.GetSize() && fBinContent.GetSize()) {
+   if (fBinTable.empty())
       FillExMap();
-   }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
-   }
+   ResizeBinTable(nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -789,20 +816,27 @@ Double_t THnSparse::GetBinError2(Long64_t linidx) const {
 Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 {
    THnSparseCompactBinCoord* cc = GetCompactCoord();
-   ULong64_t hash = cc->GetHash();
-   if (fBinContent.GetSize() && !fBins.GetSize())
-      FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
+   return GetBinIndexForBuffer(cc->GetBuffer(), cc->GetHash(), allocate);
+}
 
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
+////////////////////////////////////////////////////////////////////////////////
+/// Return the index of the bin with the compact coordinates buf and their hash.
+/// If it doesn't exist then return -1, or allocate a new bin if allocate is set
 
-      linidx = nextlinidx;
+Long64_t THnSparse::GetBinIndexForBuffer(const Char_t* buf, ULong64_t hash, Bool_t allocate)
+{
+   if (fBinTable.empty())
+      FillExMap();
+   const ULong64_t mask = (ULong64_t(1) << fBinTableBits) - 1;
+   ULong64_t slot = GetBinTableSlot(hash);
+   while (ULong64_t linidx = fBinTable[2 * slot + 1]) {
+      // fBinTable stores idx + 1, 0 is "empty slot"
+      if (fBinTable[2 * slot] == hash) {
+         THnSparseArrayChunk* chunk = GetChunk((linidx - 1) / fChunkSize);
+         if (chunk->Matches((linidx - 1) % fChunkSize, buf))
+            return linidx - 1;
+      }
+      slot = (slot + 1) & mask;
    }
    if (!allocate) return -1;
 
@@ -815,19 +849,16 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
       chunk = AddChunk();
       newidx = 0;
    }
-   chunk->AddBin(newidx, cc->GetBuffer());
+   chunk->AddBin(newidx, buf);
 
    // store translation between hash and bin
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
+   if (4 * fFilledBins > 3 * (Long64_t(1) << fBinTableBits)) {
+      ResizeBinTable(fFilledBins);
+      InsertBinTable(hash, newidx);
    } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
+      fBinTable[2 * slot] = hash;
+      fBinTable[2 * slot + 1] = newidx + 1;
    }
    return newidx;
 }
@@ -880,7 +911,7 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   size += sizeof(ULong64_t) * fBinTable.size();
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -962,9 +993,48 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   fBinTable.clear();
+   fBinTableBits = 0;
    fBinContent.Delete();
    ResetBase(option);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Add the bins of h scaled by c, for Add() and Merge(). If h is a THnSparse
+/// with the same binning, its chunks are added directly: the compact
+/// coordinates of its bins are looked up as they are, without converting them
+/// to coordinates and back.
+
+void THnSparse::AddBins(const THnBase* h, Double_t c, Bool_t rebinned)
+{
+   const THnSparse* other = rebinned ? nullptr : dynamic_cast<const THnSparse*>(h);
+   THnSparseCompactBinCoord* cc = GetCompactCoord();
+   if (!other || other->GetCompactCoord()->GetBufferSize() != cc->GetBufferSize()) {
+      THnBase::AddBins(h, c, rebinned);
+      return;
+   }
+   // Add() checked that the binnings are the same, so are the compact coordinates
+
+   Reserve(GetNbins() + other->GetNbins());
+
+   const Bool_t haveErrors = GetCalculateErrors();
+   const Bool_t otherErrors = other->GetCalculateErrors();
+   const Int_t singleCoordSize = cc->GetBufferSize();
+   for (Int_t iChunk = 0; iChunk < other->GetNChunks(); ++iChunk) {
+      const THnSparseArrayChunk* chunk = other->GetChunk(iChunk);
+      const Int_t nbins = chunk->GetEntries();
+      for (Int_t i = 0; i < nbins; ++i) {
+         const Char_t* buf = chunk->fCoordinates + i * singleCoordSize;
+         const Long64_t bin = GetBinIndexForBuffer(buf, cc->GetHashFromBuffer(buf), kTRUE);
+         THnSparseArrayChunk* myChunk = GetChunk(bin / fChunkSize);
+         const Int_t myIdx = bin % fChunkSize;
+         const Double_t v = chunk->fContent->GetAt(i);
+         if (haveErrors) {
+            // as GetBinError2() of other
+            const Double_t err2 = otherErrors ? chunk->fSumw2->GetAt(i) : v;
+            (*myChunk->fSumw2)[myIdx] += c * c * err2;
+         }
+         myChunk->fContent->SetAt(myChunk->fContent->GetAt(myIdx) + c * v, myIdx);
+      }
+   }
+}
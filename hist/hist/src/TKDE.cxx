@@ -22,6 +22,15 @@
 
  The algorithm is briefly described in (4). A binned version is also implemented to address the
  performance issue due to its data size dependance.
+
+ For large samples, binned estimates can in addition be evaluated on a grid, see SetGridEvaluation().
+ The estimate is then computed once at the bin centres, extended on both sides by the range of the kernel,
+ and interpolated linearly in between. With a fixed bandwidth, the estimate at the grid nodes is a discrete
+ convolution of the bin counts with the kernel: it is computed with TVirtualFFT when FFTW is available and the
+ kernel extends over many bins, and by direct summation otherwise. The same convolution gives the pilot estimate
+ for the adaptive bandwidths. Outside the grid, the estimate is evaluated as without grid.
+ With implicit multi-threading enabled, the adaptive estimate on the grid and, without grid, the pilot estimate
+ for the adaptive bandwidths are computed in parallel for the built-in kernels.
  */
 
 
@@ -42,7 +51,13 @@
 #include "TF1.h"
 #include "TH1.h"
 #include "TVirtualPad.h"
+#include "TVirtualFFT.h"
+#include "TROOT.h"
 #include "TKDE.h"
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 ClassImp(TKDE);
 
@@ -67,7 +82,7 @@ TKDE::TKDE() :
    fApproximateBias(nullptr),
    fGraph(nullptr),
    fUseMirroring(false), fMirrorLeft(false), fMirrorRight(false), fAsymLeft(false), fAsymRight(false),
-   fUseBins(false), fNewData(false), fUseMinMaxFromData(false),
+   fUseBins(false), fNewData(false), fUseMinMaxFromData(false), fUseGrid(false),
    fNBins(0), fNEvents(0), fSumOfCounts(0), fUseBinsNEvents(0),
    fMean(0.),fSigma(0.), fSigmaRob(0.), fXMin(0.), fXMax(0.),
    fRho(0.), fAdaptiveBandwidthFactor(0.), fWeightSize(0)
@@ -107,6 +122,7 @@ void TKDE::Instantiate(KernelFunction_Ptr kernfunc, UInt_t events, const Double_
    fXMin = xMin;
    fXMax = xMax;
    fUseMinMaxFromData = (fXMin >= fXMax);
+   fUseGrid = false;
    fSumOfCounts = 0;
    fAdaptiveBandwidthFactor = 1.;
    fRho = rho;
@@ -367,6 +383,15 @@ void TKDE::SetUseBinsNEvents(UInt_t nEvents) {
    SetUseBins();
 }
 
+void TKDE::SetGridEvaluation(Bool_t on) {
+   // Sets User option for evaluating a binned estimate by linear interpolation between its values at the bin
+   // centres, which are computed once; see the class documentation
+   fUseGrid = on;
+   if (fUseGrid && !fUseBins)
+      Warning("SetGridEvaluation", "Bin type using SetBinning must be set for using the grid evaluation");
+   fKernel.reset();
+}
+
 void TKDE::SetTuneFactor(Double_t rho) {
    // Factor which can be used to tune the smoothing.
    // It is used as multiplicative factor for the fixed and adaptive bandwidth.
@@ -608,6 +633,9 @@ void TKDE::SetKernel() {
    if (fIteration == kAdaptive) {
       fKernel->ComputeAdaptiveWeights();
    }
+   if (fUseGrid && fUseBins) {
+      fKernel->ComputeGrid();
+   }
    if (gDebug) {
       if (fIteration != kAdaptive)
          Info("SetKernel",
@@ -780,6 +808,36 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
    // we will store computed adaptive weights in weights
    std::vector<Double_t> weights(n, fWeights[0]);
    bool useDataWeights = (fKDE->fBinCount.size() == n);
+   // pilot estimate, with the fixed bandwidth, at the data points
+   std::vector<Double_t> pilot(n, 0.);
+   if (fKDE->fUseGrid && fKDE->fUseBins && n > 0) {
+      // the data are on the lattice of the bin centres
+      const Double_t step = (fKDE->fXMax - fKDE->fXMin) / fKDE->fNBins;
+      std::vector<Int_t> pos(n);
+      for (unsigned int i = 0; i < n; ++i)
+         pos[i] = TMath::Nint((fKDE->fData[i] - fKDE->fXMin) / step - 0.5);
+      const Int_t qmin = *std::min_element(pos.begin(), pos.end());
+      std::vector<Double_t> values;
+      ComputeFixedEstimate(qmin, *std::max_element(pos.begin(), pos.end()), values);
+      for (unsigned int i = 0; i < n; ++i)
+         pilot[i] = values[pos[i] - qmin] / fKDE->fSumOfCounts;
+   } else {
+      auto computePilot = [&](unsigned int i) {
+         if (!useDataWeights || fKDE->fBinCount[i] > 0)
+            pilot[i] = (*fKDE->fKernel)(fKDE->fData[i]);
+      };
+#ifdef R__USE_IMT
+      // user defined kernels are not known to be thread-safe
+      if (ROOT::IsImplicitMTEnabled() && fKDE->fKernelType != kUserDefined && n >= 1000) {
+         ROOT::TThreadExecutor pool;
+         pool.Foreach(computePilot, ROOT::TSeqU(n));
+      } else
+#endif
+      {
+         for (unsigned int i = 0; i < n; ++i)
+            computePilot(i);
+      }
+   }
    Double_t f = 0.0;
    for (unsigned int i = 0; i < n; ++i) {
       // for negative or null bin contents use the fixed weight value (fWeights[0])
@@ -787,7 +845,7 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
          weights[i] = fWeights[0];
          continue; // skip negative or null weights
       }
-      f = (*fKDE->fKernel)(fKDE->fData[i]);
+      f = pilot[i];
       if (f <= 0) {
          // this can happen when data are outside range and fAsymLeft or fAsymRight is on
          fKDE->Warning("ComputeAdativeWeights","function value is zero or negative for x = %f w = %f - set their bandwidth to zero",
@@ -816,6 +874,161 @@ Double_t TKDE::TKernel::GetWeight(Double_t x) const {
    return fWeights[fKDE->Index(x)];
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Computes the binned estimate with the fixed bandwidth fWeights[0], not yet divided by the sum of counts,
+/// at the nodes qmin to qmax of the lattice of the bin centres, where node q is at fXMin + (q + 0.5) * bin width.
+/// The estimate is the convolution of the bin counts, mirrored bins included, with the kernel sampled on the
+/// lattice; it is computed with an FFT if the kernel extends over many bins and TVirtualFFT is available.
+void TKDE::TKernel::ComputeFixedEstimate(Int_t qmin, Int_t qmax, std::vector<Double_t> &values) const {
+   const Double_t step = (fKDE->fXMax - fKDE->fXMin) / fKDE->fNBins;
+   const Double_t weight = fWeights[0];
+   values.assign(qmax - qmin + 1, 0.);
+
+   // bin counts on the lattice, including the reflections of the asymmetric mirroring
+   std::vector<Int_t> pos;
+   std::vector<Double_t> counts;
+   auto addPoint = [&](Double_t x, Double_t count) {
+      pos.push_back(TMath::Nint((x - fKDE->fXMin) / step - 0.5));
+      counts.push_back(count);
+   };
+   for (UInt_t i = 0; i < fKDE->fData.size(); ++i) {
+      const Double_t x = fKDE->fData[i];
+      addPoint(x, fKDE->fBinCount[i]);
+      if (fKDE->fAsymLeft) addPoint(2. * fKDE->fXMin - x, fKDE->fBinCount[i]);
+      if (fKDE->fAsymRight) addPoint(2. * fKDE->fXMax - x, fKDE->fBinCount[i]);
+   }
+   if (pos.empty()) return;
+   const Int_t pmin = *std::min_element(pos.begin(), pos.end());
+   const Int_t nc = *std::max_element(pos.begin(), pos.end()) - pmin + 1;
+   std::vector<Double_t> lattice(nc, 0.);
+   for (UInt_t i = 0; i < pos.size(); ++i)
+      lattice[pos[i] - pmin] += counts[i];
+
+   // kernel on the lattice offsets -s to s, truncated at its support if known
+   Int_t s = std::max(qmax - pmin, pmin + nc - 1 - qmin);
+   const Double_t support = fKDE->GetKernelSupport();
+   if (support > 0) s = std::min(s, Int_t(support * weight / step) + 1);
+   if (s < 0) return;
+   std::vector<Double_t> kernel(2 * s + 1);
+   for (Int_t m = -s; m <= s; ++m)
+      kernel[m + s] = (*fKDE->fKernelFunction)(m * step / weight) / weight;
+
+   // below this number of multiplications the direct summation is faster
+   constexpr Double_t kMinFFTCost = 1.E7;
+   if (Double_t(qmax - qmin + 1) * (2 * s + 1) > kMinFFTCost) {
+      Int_t n = nc + 2 * s;
+      std::unique_ptr<TVirtualFFT> fft(TVirtualFFT::FFT(1, &n, "R2C K"));
+      std::unique_ptr<TVirtualFFT> fftKernel(TVirtualFFT::FFT(1, &n, "R2C K"));
+      std::unique_ptr<TVirtualFFT> fftInverse(TVirtualFFT::FFT(1, &n, "C2R K"));
+      if (fft && fftKernel && fftInverse) {
+         for (Int_t i = 0; i < n; ++i) {
+            fft->SetPoint(i, i < nc ? lattice[i] : 0.);
+            // negative offsets are wrapped around
+            const Int_t m = (i <= s) ? i : i - n;
+            fftKernel->SetPoint(i, (m >= -s) ? kernel[m + s] : 0.);
+         }
+         fft->Transform();
+         fftKernel->Transform();
+         for (Int_t i = 0; i <= n / 2; ++i) {
+            Double_t re1, im1, re2, im2;
+            fft->GetPointComplex(i, re1, im1);
+            fftKernel->GetPointComplex(i, re2, im2);
+            fftInverse->SetPoint(i, re1 * re2 - im1 * im2, re1 * im2 + re2 * im1);
+         }
+         fftInverse->Transform();
+         Double_t maxValue = 0;
+         for (Int_t q = qmin; q <= qmax; ++q) {
+            const Int_t t = q - pmin;
+            if (t < -s || t > nc - 1 + s) continue;
+            values[q - qmin] = fftInverse->GetPointReal((t + n) % n) / n;
+            maxValue = std::max(maxValue, std::abs(values[q - qmin]));
+         }
+         // remove the round-off of the transforms from the tails
+         for (auto &value : values) {
+            if (std::abs(value) < 1.E-13 * maxValue) value = 0;
+         }
+         return;
+      }
+      fKDE->Warning("ComputeFixedEstimate", "Cannot use FFT, probably FFTW package is not available. "
+                    "Switch to direct summation");
+   }
+
+   for (Int_t q = qmin; q <= qmax; ++q) {
+      Double_t sum = 0;
+      const Int_t first = std::max(pmin, q - s);
+      const Int_t last = std::min(pmin + nc - 1, q + s);
+      for (Int_t p = first; p <= last; ++p)
+         sum += lattice[p - pmin] * kernel[q - p + s];
+      values[q - qmin] = sum;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Computes the estimate on the grid of the bin centres, extended on both sides by the range of the kernel
+/// with the largest bandwidth, or by the data range for user defined kernels.
+void TKDE::TKernel::ComputeGrid() {
+   fGrid.clear();
+   const UInt_t n = fKDE->fData.size();
+   const Int_t nbins = fKDE->fNBins;
+   if (n == 0 || nbins == 0 || fKDE->fBinCount.size() != n) return;
+
+   const Double_t step = (fKDE->fXMax - fKDE->fXMin) / nbins;
+   const Double_t support = fKDE->GetKernelSupport();
+   const Double_t maxWeight = *std::max_element(fWeights.begin(), fWeights.end());
+   Int_t margin = nbins;
+   if (support > 0) margin = std::min<Double_t>(nbins, std::ceil(support * maxWeight / step));
+   const Int_t qmin = -margin;
+   const Int_t qmax = nbins - 1 + margin;
+   if (qmax <= qmin) return;
+   fGridStep = step;
+   fGridMin = fKDE->fXMin + (qmin + 0.5) * step;
+
+   if (fWeights.size() != n) {
+      ComputeFixedEstimate(qmin, qmax, fGrid);
+   } else {
+      // adaptive bandwidths: sum the kernels of the data points at the grid nodes within their range
+      const Int_t ngrid = qmax - qmin + 1;
+      fGrid.assign(ngrid, 0.);
+      auto addKernels = [&](Int_t first, Int_t last) {
+         auto addPoint = [&](Double_t x, Double_t count, Double_t weight) {
+            Int_t begin = first;
+            Int_t end = last;
+            if (support > 0) {
+               begin = std::max<Double_t>(begin, std::ceil((x - support * weight - fGridMin) / step));
+               end = std::min<Double_t>(end, std::floor((x + support * weight - fGridMin) / step) + 1);
+            }
+            const Double_t invWeight = 1. / weight;
+            for (Int_t j = begin; j < end; ++j)
+               fGrid[j] += count * invWeight * (*fKDE->fKernelFunction)((fGridMin + j * step - x) * invWeight);
+         };
+         for (UInt_t i = 0; i < n; ++i) {
+            // skip data points that have 0 bandwidth (see ComputeAdaptiveWeights)
+            if (fWeights[i] == 0) continue;
+            const Double_t x = fKDE->fData[i];
+            addPoint(x, fKDE->fBinCount[i], fWeights[i]);
+            if (fKDE->fAsymLeft) addPoint(2. * fKDE->fXMin - x, fKDE->fBinCount[i], fWeights[i]);
+            if (fKDE->fAsymRight) addPoint(2. * fKDE->fXMax - x, fKDE->fBinCount[i], fWeights[i]);
+         }
+      };
+#ifdef R__USE_IMT
+      // user defined kernels are not known to be thread-safe
+      constexpr Int_t kNodesPerTask = 256;
+      if (ROOT::IsImplicitMTEnabled() && fKDE->fKernelType != kUserDefined && ngrid >= 2 * kNodesPerTask) {
+         const Int_t ntasks = (ngrid + kNodesPerTask - 1) / kNodesPerTask;
+         ROOT::TThreadExecutor pool;
+         pool.Foreach(
+            [&](Int_t task) { addKernels(task * kNodesPerTask, std::min(ngrid, (task + 1) * kNodesPerTask)); },
+            ROOT::TSeqI(ntasks));
+      } else
+#endif
+      {
+         addKernels(0, ngrid);
+      }
+   }
+   for (auto &value : fGrid)
+      value /= fKDE->fSumOfCounts;
+}
+
 void TKDE::SetBinCentreData(Double_t xmin, Double_t xmax) {
    // Returns the bins' centres from the data for using with the binned option
    fData.assign(fNBins, 0.0);
@@ -1009,6 +1222,16 @@ const std::vector<Double_t> & TKDE::TKernel::GetAdaptiveWeights() const {
 
 Double_t TKDE::TKernel::operator()(Double_t x) const {
    // The internal class's unary function: returns the kernel density estimate
+   if (!fGrid.empty()) {
+      // linear interpolation between the grid nodes
+      const Double_t u = (x - fGridMin) / fGridStep;
+      const Int_t last = fGrid.size() - 1;
+      if (u >= 0 && u <= last) {
+         const Int_t j = std::min(Int_t(u), last - 1);
+         const Double_t t = u - j;
+         return (1. - t) * fGrid[j] + t * fGrid[j + 1];
+      }
+   }
    Double_t result(0.0);
    UInt_t n = fKDE->fData.size();
    // case of bins or weighted data
@@ -1121,6 +1344,20 @@ void TKDE::CheckKernelValidity() {
    }
 }
 
+Double_t TKDE::GetKernelSupport() const {
+   // Returns the value beyond which the kernel is zero, or 0 if it is not known (user defined kernels)
+   switch (fKernelType) {
+      case kGaussian:
+         return 9.;
+      case kEpanechnikov:
+      case kBiweight:
+      case kCosineArch:
+         return 1.;
+      default:
+         return 0.;
+   }
+}
+
 Double_t TKDE::ComputeKernelL2Norm() const {
    // Computes the kernel's L2 norm
    ROOT::Math::IntegratorOneDim ig(ROOT::Math::IntegrationOneDim::kGAUSS);
@@ -204,6 +204,16 @@ This is an orthogonal transformation, or rotation, of the pattern
 space and feature selection results in ignoring certain coordinates
 in the transformed space.
 
+### Large samples
+
+Only the mean values and the covariance matrix are needed by MakePrincipals(),
+and they are updated at each call of AddRow(). For large samples, create the object
+without the "D" option, so that the data points are not stored. Many data points can be
+added at once with AddRows(), which processes chunks of the data points in parallel if
+the implicit multi-threading is enabled. Objects filled with separate parts of a sample,
+e.g. by different threads or processes, can be combined with Merge(), hence with hadd
+or with ROOT::TThreadedObject.
+
 Christian Holm August 2000, CERN
 */
 
@@ -219,6 +229,73 @@ Christian Holm August 2000, CERN
 #include "TBrowser.h"
 #include "TROOT.h"
 #include "Riostream.h"
+#include "RConfigure.h" // R__USE_IMT
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+/// Update the mean values and the covariance matrix (lower triangle) of n-1 data points with the data point p,
+/// n being the new number of data points
+void UpdateMoments(Int_t nVariables, Long64_t n, Double_t *meanValues, Double_t *covMatrix, const Double_t *p)
+{
+   if (n == 1) {
+      for (Int_t i = 0; i < nVariables; i++)
+         meanValues[i] = p[i];
+      return;
+   }
+   const Double_t invnp = 1. / Double_t(n);
+   const Double_t invnpM1 = 1. / (Double_t(n - 1));
+   const Double_t cor = 1. - invnp;
+   for (Int_t i = 0; i < nVariables; i++) {
+
+      meanValues[i] *= cor;
+      meanValues[i] += p[i] * invnp;
+      const Double_t t1 = (p[i] - meanValues[i]) * invnpM1;
+
+      // Setting Matrix (lower triangle) elements
+      for (Int_t j = 0; j < i + 1; j++) {
+         const Int_t index = i * nVariables + j;
+         covMatrix[index] *= cor;
+         covMatrix[index] += t1 * (p[j] - meanValues[j]);
+      }
+   }
+}
+
+/// Combine the mean values and the covariance matrix (lower triangle) of n data points with those of n2 other
+/// data points
+void MergeMoments(Int_t nVariables, Long64_t &n, Double_t *meanValues, Double_t *covMatrix, Long64_t n2,
+                  const Double_t *meanValues2, const Double_t *covMatrix2)
+{
+   if (n2 == 0)
+      return;
+   if (n == 0) {
+      std::copy(meanValues2, meanValues2 + nVariables, meanValues);
+      std::copy(covMatrix2, covMatrix2 + nVariables * nVariables, covMatrix);
+      n = n2;
+      return;
+   }
+   const Double_t f1 = Double_t(n) / Double_t(n + n2);
+   const Double_t f2 = Double_t(n2) / Double_t(n + n2);
+   std::vector<Double_t> delta(nVariables);
+   for (Int_t i = 0; i < nVariables; i++)
+      delta[i] = meanValues2[i] - meanValues[i];
+   for (Int_t i = 0; i < nVariables; i++) {
+      for (Int_t j = 0; j < i + 1; j++) {
+         const Int_t index = i * nVariables + j;
+         covMatrix[index] = f1 * covMatrix[index] + f2 * covMatrix2[index] + f1 * f2 * delta[i] * delta[j];
+      }
+      meanValues[i] += f2 * delta[i];
+   }
+   n += n2;
+}
+
+} // namespace
 
 
 ClassImp(TPrincipal);
@@ -414,32 +491,10 @@ void TPrincipal::AddRow(const Double_t *p)
 
    // Increment the data point counter
    Int_t i,j;
-   if (++fNumberOfDataPoints == 1) {
-      for (i = 0; i < fNumberOfVariables; i++)
-         fMeanValues(i) = p[i];
-   }
-   else {
-
-      const Double_t invnp = 1. / Double_t(fNumberOfDataPoints);
-      const Double_t invnpM1 = 1. /(Double_t(fNumberOfDataPoints - 1));
-      const Double_t cor = 1. - invnp;
-      // use directly vector array for faster element access
-      Double_t * meanValues = fMeanValues.GetMatrixArray();
-      Double_t * covMatrix =  fCovarianceMatrix.GetMatrixArray();
-      for (i = 0; i < fNumberOfVariables; i++) {
-
-         meanValues[i] *= cor;
-         meanValues[i] += p[i] * invnp;
-         const Double_t t1 = (p[i] - meanValues[i]) * invnpM1;
-
-         // Setting Matrix (lower triangle) elements
-         for (j = 0; j < i + 1; j++) {
-            const Int_t index = i * fNumberOfVariables + j;
-            covMatrix[index] *= cor;
-            covMatrix[index] += t1 * (p[j] - meanValues[j]);
-         }
-      }
-   }
+   ++fNumberOfDataPoints;
+   // use directly vector array for faster element access
+   UpdateMoments(fNumberOfVariables, fNumberOfDataPoints, fMeanValues.GetMatrixArray(),
+                 fCovarianceMatrix.GetMatrixArray(), p);
 
    // Store data point in internal vector
    // If the vector isn't big enough to hold the new data, then
@@ -457,6 +512,104 @@ void TPrincipal::AddRow(const Double_t *p)
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Add nRows data points, stored one after the other in x.
+///
+/// If the data points are not stored (no "D" option) and the implicit multi-threading
+/// is enabled, the mean values and the covariance matrix of chunks of the data points
+/// are computed in parallel and then combined as in Merge(). The chunks do not depend
+/// on the number of threads, and neither does the result.
+
+void TPrincipal::AddRows(Long64_t nRows, const Double_t *x)
+{
+   if (!x || nRows <= 0)
+      return;
+
+#ifdef R__USE_IMT
+   const Long64_t chunkSize = 65536;
+   if (!fStoreData && ROOT::IsImplicitMTEnabled() && nRows >= 2 * chunkSize) {
+      const Int_t nVariables = fNumberOfVariables;
+      const Long64_t nChunks = (nRows + chunkSize - 1) / chunkSize;
+      std::vector<Long64_t> counts(nChunks, 0);
+      std::vector<Double_t> means(nChunks * nVariables, 0.);
+      std::vector<Double_t> covs(nChunks * nVariables * nVariables, 0.);
+      auto processChunk = [&](Long64_t c) {
+         Double_t *mean = means.data() + c * nVariables;
+         Double_t *cov = covs.data() + c * nVariables * nVariables;
+         const Long64_t end = std::min(nRows, (c + 1) * chunkSize);
+         for (Long64_t row = c * chunkSize; row < end; row++)
+            UpdateMoments(nVariables, ++counts[c], mean, cov, x + row * nVariables);
+      };
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(processChunk, ROOT::TSeq<Long64_t>(nChunks));
+
+      Long64_t n = fNumberOfDataPoints;
+      for (Long64_t c = 0; c < nChunks; c++)
+         MergeMoments(nVariables, n, fMeanValues.GetMatrixArray(), fCovarianceMatrix.GetMatrixArray(), counts[c],
+                      means.data() + c * nVariables, covs.data() + c * nVariables * nVariables);
+      fNumberOfDataPoints = n;
+      return;
+   }
+#endif
+
+   for (Long64_t row = 0; row < nRows; row++)
+      AddRow(x + row * fNumberOfVariables);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the data points of the TPrincipal objects in list to this object.
+///
+/// The mean values and the covariance matrices are combined exactly, so that merging
+/// the objects filled with the parts of a sample gives the same principal components as
+/// filling one object with the whole sample, up to rounding. The data points are only
+/// kept if this object and all the merged ones store them.
+/// As MakePrincipals() normalises the covariance matrix in place, the objects must be
+/// merged before it is called.
+/// Returns the number of data points, or -1 in case of error.
+
+Long64_t TPrincipal::Merge(TCollection *list)
+{
+   if (!list)
+      return fNumberOfDataPoints;
+
+   TIter next(list);
+   while (TObject *obj = next()) {
+      auto other = dynamic_cast<TPrincipal *>(obj);
+      if (!other) {
+         Error("Merge", "Attempt to merge object of class %s to a TPrincipal", obj->ClassName());
+         return -1;
+      }
+      if (other->fNumberOfVariables != fNumberOfVariables) {
+         Error("Merge", "Cannot merge a TPrincipal of %d variables to a TPrincipal of %d variables",
+               other->fNumberOfVariables, fNumberOfVariables);
+         return -1;
+      }
+      if (other->fNumberOfDataPoints == 0)
+         continue;
+
+      if (fStoreData && !other->fStoreData) {
+         Warning("Merge", "%s does not store its data points, the data points are not kept", other->GetName());
+         fStoreData = kFALSE;
+         fUserData.ResizeTo(0);
+      }
+      if (fStoreData) {
+         const Int_t nStored = fNumberOfDataPoints * fNumberOfVariables;
+         const Int_t nOther = other->fNumberOfDataPoints * fNumberOfVariables;
+         if (fUserData.GetNrows() < nStored + nOther)
+            fUserData.ResizeTo(nStored + nOther);
+         std::copy(other->fUserData.GetMatrixArray(), other->fUserData.GetMatrixArray() + nOther,
+                   fUserData.GetMatrixArray() + nStored);
+      }
+
+      Long64_t n = fNumberOfDataPoints;
+      MergeMoments(fNumberOfVariables, n, fMeanValues.GetMatrixArray(), fCovarianceMatrix.GetMatrixArray(),
+                   other->fNumberOfDataPoints, other->fMeanValues.GetMatrixArray(),
+                   other->fCovarianceMatrix.GetMatrixArray());
+      fNumberOfDataPoints = n;
+   }
+   return fNumberOfDataPoints;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Browse the TPrincipal object in the TBrowser.
 
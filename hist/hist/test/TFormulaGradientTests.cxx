@@ -22,6 +22,9 @@
 #include <TF1.h>
 #include <TF2.h>
 #include <TFitResult.h>
+#include <TEnv.h>
+#include <TH1.h>
+#include <TRandom.h>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -152,6 +155,32 @@ TEST(TFormulaGradientPar, BigausCrossCheck)
 
 // FIXME: Add more: crystalball, cheb3?
 
+// Fits of formula-based functions use the generated gradient by default
+TEST(TFormulaGradientPar, FitWithGeneratedGradient)
+{
+   gRandom->SetSeed(111);
+   TH1D h("hgrad", "", 50, -5, 5);
+   for (int i = 0; i < 10000; ++i)
+      h.Fill(gRandom->Gaus(0.5, 1.5));
+
+   TF1 f("fgrad", "[0]*exp(-0.5*((x-[1])/[2])*((x-[1])/[2]))", -5, 5);
+   f.SetParameters(500, 0, 1);
+   auto res = h.Fit(&f, "Q N S");
+   ASSERT_TRUE(f.GetFormula()->HasGeneratedGradient());
+   EXPECT_EQ(0, res->Status());
+
+   // same fit with numerical derivatives
+   gEnv->SetValue("Hist.Fit.GenerateGradient", 0);
+   TF1 fnum("fnum", "[0]*exp(-0.5*((x-[1])/[2])*((x-[1])/[2]))", -5, 5);
+   fnum.SetParameters(500, 0, 1);
+   auto resNum = h.Fit(&fnum, "Q N S");
+   gEnv->SetValue("Hist.Fit.GenerateGradient", 1);
+   EXPECT_EQ(0, resNum->Status());
+   for (int i = 0; i < 3; ++i)
+      EXPECT_NEAR(resNum->Parameter(i), res->Parameter(i), 0.01 * resNum->ParError(i));
+   EXPECT_NEAR(resNum->Chi2(), res->Chi2(), 1e-4 * resNum->Chi2());
+}
+
 TEST(TFormulaGradientPar, GetGradFormula)
 {
    TFormula f("f", "gaus");
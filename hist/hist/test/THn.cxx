@@ -1,9 +1,12 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
 #include "TH1.h"
 #include "TH2.h"
 
+#include <vector>
+
 // Filling THn
 TEST(THn, Fill) {
    Int_t bins[2] = {2, 3};
@@ -111,3 +114,67 @@ TEST(THn, Projection) {
    }
 
 }
+
+// Bin lookup and Add() of THnSparse, with compact coordinates smaller and larger than 8 bytes
+TEST(THnSparse, BinTable) {
+   for (Int_t ndim : {3, 12}) {
+      std::vector<Int_t> bins(ndim, 1000);
+      std::vector<Double_t> xmin(ndim, 0.);
+      std::vector<Double_t> xmax(ndim, 1000.);
+      THnSparseD hs("hs", "hs", ndim, bins.data(), xmin.data(), xmax.data(), 100);
+      THnSparseD other("other", "other", ndim, bins.data(), xmin.data(), xmax.data(), 100);
+      other.Sumw2();
+
+      std::vector<Int_t> coord(ndim);
+      auto setCoord = [&coord](Int_t i) {
+         coord[0] = 1 + i % 1000;
+         coord[1] = 1 + i / 1000;
+         for (std::size_t d = 2; d < coord.size(); ++d)
+            coord[d] = 1 + (i * (d + 7) + d) % 1000;
+      };
+      for (Int_t i = 0; i < 5000; ++i) {
+         setCoord(i);
+         EXPECT_EQ(i, hs.GetBin(coord.data(), kTRUE));
+         hs.SetBinContent(i, i);
+         if (i % 2) {
+            Long64_t bin = other.GetBin(coord.data(), kTRUE);
+            other.SetBinContent(bin, 1.);
+            other.SetBinError2(bin, 0.5);
+         }
+      }
+      // Bins only in other
+      for (Int_t i = 5000; i < 6000; ++i) {
+         setCoord(i);
+         Long64_t bin = other.GetBin(coord.data(), kTRUE);
+         other.SetBinContent(bin, 2.);
+         other.SetBinError2(bin, 0.5);
+      }
+      EXPECT_EQ(5000, hs.GetNbins());
+      for (Int_t i = 0; i < 5000; ++i) {
+         setCoord(i);
+         EXPECT_EQ(i, hs.GetBin(coord.data()));
+      }
+      setCoord(7000);
+      EXPECT_EQ(-1, hs.GetBin(coord.data()));
+
+      hs.Add(&other, 2.);
+      EXPECT_EQ(6000, hs.GetNbins());
+      for (Int_t i = 0; i < 6000; ++i) {
+         setCoord(i);
+         Long64_t bin = hs.GetBin(coord.data());
+         ASSERT_GE(bin, 0);
+         Double_t expected = i < 5000 ? i + (i % 2) * 2. : 4.;
+         EXPECT_DOUBLE_EQ(expected, hs.GetBinContent(bin));
+         // hs had no errors, so they start from its content
+         Double_t expectedErr2 = (i < 5000 ? i : 0.) + ((i % 2 || i >= 5000) ? 4. * 0.5 : 0.);
+         EXPECT_DOUBLE_EQ(expectedErr2, hs.GetBinError2(bin));
+      }
+
+      // The hash table is rebuilt after a reset
+      hs.Reset();
+      EXPECT_EQ(0, hs.GetNbins());
+      setCoord(3);
+      EXPECT_EQ(-1, hs.GetBin(coord.data()));
+      EXPECT_EQ(0, hs.GetBin(coord.data(), kTRUE));
+   }
+}
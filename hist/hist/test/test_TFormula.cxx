@@ -7,3 +7,50 @@ TEST(TFormula, Interp)
 {
   TFormula f("func", "TGeoBBox::DeclFileLine()");
 }
+
+TEST(TFormula, IsVectorizable)
+{
+#ifdef R__HAS_VECCORE
+  EXPECT_TRUE(TFormula("vf1", "gaus").IsVectorizable());
+  EXPECT_TRUE(TFormula("vf2", "[0]*exp(-x*[1]) + 1e-3*sqrt(abs(x))").IsVectorizable());
+  EXPECT_TRUE(TFormula("vf3", "[A]*x*x+[B]*x+[C]").IsVectorizable());
+  EXPECT_FALSE(TFormula("vf4", "landau").IsVectorizable());
+  EXPECT_FALSE(TFormula("vf5", "[0]*x^2").IsVectorizable());
+  EXPECT_FALSE(TFormula("vf6", "(x>0)*x").IsVectorizable());
+#endif
+  // no variables
+  EXPECT_FALSE(TFormula("vf7", "[0]+[1]").IsVectorizable());
+}
+
+TEST(TFormula, EvalN)
+{
+  TFormula f("evaln1", "[0]*exp(-x*[1]) + y");
+  f.SetParameters(2., 0.5);
+  EXPECT_TRUE(f.GenerateEvalN());
+
+  const std::size_t n = 10;
+  double xs[n], ys[n], res[n];
+  for (std::size_t i = 0; i < n; ++i) {
+    xs[i] = 0.1 * i;
+    ys[i] = i;
+  }
+  const double *x[2] = {xs, ys};
+  f.EvalN(n, x, res);
+  for (std::size_t i = 0; i < n; ++i) {
+    double point[2] = {xs[i], ys[i]};
+    EXPECT_DOUBLE_EQ(f.EvalPar(point), res[i]);
+  }
+
+  const double params[2] = {1., 0.};
+  f.EvalN(n, x, res, params);
+  for (std::size_t i = 0; i < n; ++i)
+    EXPECT_DOUBLE_EQ(1. + ys[i], res[i]);
+
+  // Formulas from lambda expressions are evaluated point by point
+  TFormula fl("evaln2", "[](double *x, double *p){ return p[0] * x[0]; }", 1, 1);
+  fl.SetParameter(0, 3.);
+  EXPECT_FALSE(fl.GenerateEvalN());
+  fl.EvalN(n, x, res);
+  for (std::size_t i = 0; i < n; ++i)
+    EXPECT_DOUBLE_EQ(3. * xs[i], res[i]);
+}
@@ -0,0 +1,154 @@
+// Tests of the formula cache shared by processes, see Hist.TFormula.CacheDir
+
+#include "gtest/gtest.h"
+
+#include "TEnv.h"
+#include "TError.h"
+#include "TFormula.h"
+#include "TSystem.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+int gNumWarnings = 0;
+
+void CountingErrorHandler(int level, Bool_t abort, const char *location, const char *msg)
+{
+   if (level >= kWarning)
+      ++gNumWarnings;
+   DefaultErrorHandler(level, abort, location, msg);
+}
+
+/// Start a process evaluating formulas with the cache in dir. Its exit code is 0 if the formulas give the
+/// expected values without warnings, and if the cache library was loaded when expectCacheLibrary is set.
+pid_t StartProcess(const std::string &dir, const std::vector<std::string> &constants, bool expectCacheLibrary = false)
+{
+   const pid_t pid = fork();
+   if (pid != 0)
+      return pid;
+
+   // the cache is written by an atexit handler: the process must end with exit()
+   SetErrorHandler(CountingErrorHandler);
+   gEnv->SetValue("Hist.TFormula.CacheDir", dir.c_str());
+   int status = 0;
+   for (const auto &constant : constants) {
+      TFormula f(("f" + constant).c_str(), ("x*[0]+" + constant).c_str());
+      f.SetParameter(0, 3.);
+      if (f.Eval(2.) != 6. + std::stod(constant))
+         status = 1;
+   }
+   if (gNumWarnings > 0)
+      status = 2;
+   if (expectCacheLibrary && !TString(gSystem->GetLibraries()).Contains("TFormulaCache_C"))
+      status = 3;
+   std::exit(status);
+}
+
+int Wait(pid_t pid)
+{
+   int status = 0;
+   if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status))
+      return -1;
+   return WEXITSTATUS(status);
+}
+
+std::vector<std::string> ReadDefinitions(const std::string &source)
+{
+   std::vector<std::string> definitions;
+   std::ifstream file(source);
+   std::string line;
+   while (std::getline(file, line)) {
+      if (line.compare(0, 9, "Double_t ") == 0)
+         definitions.push_back(line);
+   }
+   return definitions;
+}
+
+std::size_t CountContaining(const std::vector<std::string> &definitions, const std::string &text)
+{
+   std::size_t n = 0;
+   for (const auto &definition : definitions)
+      n += definition.find(text) != std::string::npos;
+   return n;
+}
+
+class TFormulaCacheTest : public ::testing::Test {
+protected:
+   std::string fDir;
+   std::string fSource;
+
+   void SetUp() override
+   {
+      fDir = std::string(gSystem->TempDirectory()) + "/TFormulaCacheTest_" + std::to_string(gSystem->GetPid());
+      gSystem->mkdir(fDir.c_str(), kTRUE);
+      fSource = fDir + "/TFormulaCache.C";
+   }
+   void TearDown() override { gSystem->Exec(("rm -rf " + fDir).c_str()); }
+};
+
+} // namespace
+
+// Formulas declared by concurrent processes are written once, and compiled by the next process
+TEST_F(TFormulaCacheTest, ConcurrentProcesses)
+{
+   const pid_t p1 = StartProcess(fDir, {"1234.5", "11.25"});
+   const pid_t p2 = StartProcess(fDir, {"1234.5", "22.75"});
+   ASSERT_EQ(Wait(p1), 0);
+   ASSERT_EQ(Wait(p2), 0);
+
+   auto definitions = ReadDefinitions(fSource);
+   EXPECT_EQ(CountContaining(definitions, "1234.5"), 1u);
+   EXPECT_LE(definitions.size(), 3u);
+   EXPECT_EQ(std::set<std::string>(definitions.begin(), definitions.end()).size(), definitions.size());
+
+   // a later process uses the compiled functions, and adds the ones lost by the concurrent writes
+   EXPECT_EQ(Wait(StartProcess(fDir, {"1234.5", "11.25", "22.75"}, /*expectCacheLibrary=*/true)), 0);
+   definitions = ReadDefinitions(fSource);
+   EXPECT_EQ(definitions.size(), 3u);
+   EXPECT_EQ(CountContaining(definitions, "1234.5"), 1u);
+}
+
+// A cache with a duplicated and a truncated definition is repaired instead of being disabled
+TEST_F(TFormulaCacheTest, DamagedCache)
+{
+   ASSERT_EQ(Wait(StartProcess(fDir, {"1234.5"})), 0);
+   auto definitions = ReadDefinitions(fSource);
+   ASSERT_EQ(definitions.size(), 1u);
+   {
+      std::ofstream file(fSource, std::ios::app);
+      file << definitions[0] << '\n' << definitions[0].substr(0, definitions[0].size() / 2);
+   }
+
+   EXPECT_EQ(Wait(StartProcess(fDir, {"1234.5", "33.5"}, /*expectCacheLibrary=*/true)), 0);
+   definitions = ReadDefinitions(fSource);
+   EXPECT_EQ(definitions.size(), 2u);
+   EXPECT_EQ(CountContaining(definitions, "1234.5"), 1u);
+   for (const auto &definition : definitions)
+      EXPECT_EQ(definition.back(), '}');
+}
+
+// A cache that cannot be compiled is moved aside and rebuilt
+TEST_F(TFormulaCacheTest, UncompilableCache)
+{
+   {
+      std::ofstream file(fSource);
+      file << "Double_t TFormula____id1(Double_t *x){ return undeclared_function(x[0]) ; }\n";
+   }
+   // the process warns about the broken cache
+   EXPECT_EQ(Wait(StartProcess(fDir, {"44.5"})), 2);
+   EXPECT_FALSE(gSystem->AccessPathName((fSource + ".bad").c_str()));
+
+   const auto definitions = ReadDefinitions(fSource);
+   ASSERT_EQ(definitions.size(), 1u);
+   EXPECT_EQ(CountContaining(definitions, "44.5"), 1u);
+   EXPECT_EQ(Wait(StartProcess(fDir, {"44.5"}, /*expectCacheLibrary=*/true)), 0);
+}
@@ -1,8 +1,15 @@
 #include "gtest/gtest.h"
 
 #include "TH1.h"
+#include "TH1D.h"
 #include "TH1F.h"
+#include "TH2D.h"
+#include "TH3D.h"
 #include "THLimitsFinder.h"
+#include "TList.h"
+
+#include <cmath>
+#include <vector>
 
 // StatOverflows TH1
 TEST(TH1, StatOverflows)
@@ -32,6 +39,113 @@ TEST(TH1, StatOverflows)
    EXPECT_EQ(TH1::EStatOverflows::kNeutral,  h2.GetStatOverflows());
 }
 
+// Subclasses do not take the fill fast path of the fixed-bin histograms
+template <typename H>
+struct RGenericFill : public H {
+   using H::H;
+};
+
+// The fill fast path must give the same result as the generic one
+TEST(TH1, FillFastPath)
+{
+   TH1D hFast("hFast", "", 10, -1., 2.);
+   RGenericFill<TH1D> hRef("hRef", "", 10, -1., 2.);
+   TH2D h2Fast("h2Fast", "", 10, -1., 2., 7, -1., 2.);
+   RGenericFill<TH2D> h2Ref("h2Ref", "", 10, -1., 2., 7, -1., 2.);
+   TH3D h3Fast("h3Fast", "", 10, -1., 2., 7, -1., 2., 5, -1., 2.);
+   RGenericFill<TH3D> h3Ref("h3Ref", "", 10, -1., 2., 7, -1., 2., 5, -1., 2.);
+
+   std::vector<double> x, w;
+   for (int i = 0; i < 1000; ++i) {
+      x.push_back(-1.5 + 0.0041 * i);
+      w.push_back(0.5 + (i % 7));
+   }
+   x.push_back(-1.);
+   x.push_back(2.);
+   x.push_back(std::nan(""));
+   w.resize(x.size(), 1.);
+
+   for (std::size_t i = 0; i < x.size(); ++i) {
+      const double y = x[x.size() - 1 - i];
+      // Unweighted entries first, so that the weighted ones create the sum of squares of weights on the way
+      if (i < 100) {
+         hFast.Fill(x[i]);
+         hRef.Fill(x[i]);
+         h2Fast.Fill(x[i], y);
+         h2Ref.Fill(x[i], y);
+         h3Fast.Fill(x[i], y, x[i]);
+         h3Ref.Fill(x[i], y, x[i]);
+      } else {
+         hFast.Fill(x[i], w[i]);
+         hRef.Fill(x[i], w[i]);
+         h2Fast.Fill(x[i], y, w[i]);
+         h2Ref.Fill(x[i], y, w[i]);
+         h3Fast.Fill(x[i], y, x[i], w[i]);
+         h3Ref.Fill(x[i], y, x[i], w[i]);
+      }
+   }
+   hFast.FillN(x.size(), x.data(), w.data());
+   hRef.FillN(x.size(), x.data(), w.data());
+   hFast.FillN(x.size(), x.data(), nullptr);
+   hRef.FillN(x.size(), x.data(), nullptr);
+
+   auto expectEqual = [](const TH1 &h1, const TH1 &h2) {
+      EXPECT_EQ(h1.GetNcells(), h2.GetNcells());
+      for (int bin = 0; bin < h1.GetNcells(); ++bin) {
+         EXPECT_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin));
+         EXPECT_EQ(h1.GetBinError(bin), h2.GetBinError(bin));
+      }
+      EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+      double stats1[TH1::kNstat];
+      double stats2[TH1::kNstat];
+      h1.GetStats(stats1);
+      h2.GetStats(stats2);
+      for (int i = 0; i < TH1::kNstat; ++i)
+         EXPECT_DOUBLE_EQ(stats1[i], stats2[i]);
+   };
+   expectEqual(hFast, hRef);
+   expectEqual(h2Fast, h2Ref);
+   expectEqual(h3Fast, h3Ref);
+}
+
+// Merge of histograms with the same axes, array-wise for inputs of the same class and bin-wise for the others;
+// large enough for a parallel merge if implicit multi-threading is enabled
+TEST(TH1, MergeSameAxes)
+{
+   constexpr int kNbins = 1 << 16;
+   TH1D h("h", "", kNbins, 0., 1.);
+   h.Sumw2();
+   TList inputs;
+   inputs.SetOwner();
+   for (int i = 0; i < 20; ++i) {
+      TH1 *input = nullptr;
+      if (i % 3 == 2)
+         input = new TH1F(TString::Format("in%d", i), "", kNbins, 0., 1.);
+      else
+         input = new TH1D(TString::Format("in%d", i), "", kNbins, 0., 1.);
+      input->SetDirectory(nullptr);
+      if (i % 2)
+         input->Sumw2();
+      for (int bin = 0; bin < input->GetNcells(); bin += 1 + i)
+         input->Fill(input->GetBinCenter(bin), 1. + i % 2);
+      inputs.Add(input);
+   }
+   h.Merge(&inputs);
+
+   for (int bin = 0; bin < h.GetNcells(); bin += 7) {
+      double content = 0.;
+      double err2 = 0.;
+      for (int i = 0; i < 20; ++i) {
+         if (bin % (1 + i) == 0) {
+            content += 1. + i % 2;
+            err2 += (1. + i % 2) * (1. + i % 2);
+         }
+      }
+      EXPECT_EQ(content, h.GetBinContent(bin));
+      EXPECT_EQ(err2, h.GetSumw2()->At(bin));
+   }
+}
+
 // THLimitsFinder, borderline cases
 TEST(THLimitsFinder, Degenerate)
 {
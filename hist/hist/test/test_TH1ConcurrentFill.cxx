@@ -0,0 +1,169 @@
+#include "gtest/gtest.h"
+
+#include "TH1ConcurrentFill.h"
+#include "TH1D.h"
+#include "TH2D.h"
+#include "TH3D.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kNThreads = 4;
+constexpr int kNEntries = 10000;
+
+// Entries of thread `t`; the weights are integers, so that the bin contents do not depend on the order of filling
+double Coord(int t, int i, int axis)
+{
+   return ((t * kNEntries + i) * (7 + axis) % 1300) / 1000. - 0.1;
+}
+
+double Weight(int t, int i)
+{
+   return 1 + (t + i) % 2;
+}
+
+void ExpectEqual(const TH1 &h, const TH1 &ref)
+{
+   for (int bin = 0; bin < ref.GetNcells(); ++bin) {
+      EXPECT_EQ(ref.GetBinContent(bin), h.GetBinContent(bin));
+      EXPECT_EQ(ref.GetBinError(bin), h.GetBinError(bin));
+   }
+   EXPECT_EQ(ref.GetEntries(), h.GetEntries());
+   double stats[TH1::kNstat];
+   double refStats[TH1::kNstat];
+   h.GetStats(stats);
+   ref.GetStats(refStats);
+   for (int i = 0; i < TH1::kNstat; ++i)
+      EXPECT_NEAR(refStats[i], stats[i], 1e-9 * std::abs(refStats[i]));
+}
+
+template <typename FILL>
+void FillConcurrently(ROOT::TH1ConcurrentFillManager &manager, FILL fill)
+{
+   std::vector<std::thread> threads;
+   for (int t = 0; t < kNThreads; ++t) {
+      threads.emplace_back([&manager, &fill, t]() {
+         // A small buffer, to have many flushes
+         auto filler = manager.MakeFiller(100);
+         for (int i = 0; i < kNEntries; ++i)
+            fill(filler, t, i);
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+}
+
+} // anonymous namespace
+
+TEST(TH1ConcurrentFill, Fill1D)
+{
+   TH1D h("h", "", 100, 0., 1.);
+   TH1D ref("ref", "", 100, 0., 1.);
+   ROOT::TH1ConcurrentFillManager manager(h);
+   FillConcurrently(manager, [](ROOT::TH1ConcurrentFiller &filler, int t, int i) {
+      filler.Fill(Coord(t, i, 0), Weight(t, i));
+   });
+   for (int t = 0; t < kNThreads; ++t) {
+      for (int i = 0; i < kNEntries; ++i)
+         ref.Fill(Coord(t, i, 0), Weight(t, i));
+   }
+   ExpectEqual(h, ref);
+}
+
+TEST(TH1ConcurrentFill, Fill2D)
+{
+   TH2D h("h", "", 20, 0., 1., 30, 0., 1.);
+   TH2D ref("ref", "", 20, 0., 1., 30, 0., 1.);
+   ROOT::TH1ConcurrentFillManager manager(h);
+   FillConcurrently(manager, [](ROOT::TH1ConcurrentFiller &filler, int t, int i) {
+      filler.Fill(Coord(t, i, 0), Coord(t, i, 1), Weight(t, i));
+   });
+   for (int t = 0; t < kNThreads; ++t) {
+      for (int i = 0; i < kNEntries; ++i)
+         ref.Fill(Coord(t, i, 0), Coord(t, i, 1), Weight(t, i));
+   }
+   ExpectEqual(h, ref);
+}
+
+TEST(TH1ConcurrentFill, Fill3D)
+{
+   TH3D h("h", "", 10, 0., 1., 8, 0., 1., 6, 0., 1.);
+   TH3D ref("ref", "", 10, 0., 1., 8, 0., 1., 6, 0., 1.);
+   ROOT::TH1ConcurrentFillManager manager(h);
+   FillConcurrently(manager, [](ROOT::TH1ConcurrentFiller &filler, int t, int i) {
+      // Unweighted
+      filler.Fill(Coord(t, i, 0), Coord(t, i, 1), Coord(t, i, 2));
+   });
+   for (int t = 0; t < kNThreads; ++t) {
+      for (int i = 0; i < kNEntries; ++i)
+         ref.Fill(Coord(t, i, 0), Coord(t, i, 1), Coord(t, i, 2));
+   }
+   ExpectEqual(h, ref);
+}
+
+TEST(TH1ConcurrentFill, Flush)
+{
+   TH1D h("h", "", 10, 0., 1.);
+   ROOT::TH1ConcurrentFillManager manager(h);
+   auto filler = manager.MakeFiller();
+   filler.Fill(0.5);
+   EXPECT_EQ(0, h.GetEntries());
+   filler.Flush();
+   EXPECT_EQ(1, h.GetEntries());
+   {
+      auto other = manager.MakeFiller();
+      other.Fill(0.5, 2.);
+   }
+   EXPECT_EQ(2, h.GetEntries());
+   EXPECT_EQ(3, h.GetBinContent(6));
+}
+
+TEST(TH1ConcurrentFill, FillProfile)
+{
+   TProfile h("h", "", 100, 0., 1.);
+   TProfile ref("ref", "", 100, 0., 1.);
+   ROOT::TH1ConcurrentFillManager manager(h);
+   EXPECT_EQ(2, manager.GetNCoordinates());
+   FillConcurrently(manager, [](ROOT::TH1ConcurrentFiller &filler, int t, int i) {
+      filler.Fill(Coord(t, i, 0), Coord(t, i, 1), Weight(t, i));
+   });
+   for (int t = 0; t < kNThreads; ++t) {
+      for (int i = 0; i < kNEntries; ++i)
+         ref.Fill(Coord(t, i, 0), Coord(t, i, 1), Weight(t, i));
+   }
+   // The sums of y values depend on the order of filling
+   for (int bin = 0; bin < ref.GetNcells(); ++bin) {
+      EXPECT_EQ(ref.GetBinEntries(bin), h.GetBinEntries(bin));
+      EXPECT_NEAR(ref.GetBinContent(bin), h.GetBinContent(bin), 1e-12);
+      EXPECT_NEAR(ref.GetBinError(bin), h.GetBinError(bin), 1e-12);
+   }
+   EXPECT_EQ(ref.GetEntries(), h.GetEntries());
+}
+
+TEST(TH1ConcurrentFill, FillProfile2D)
+{
+   TProfile2D h("h", "", 20, 0., 1., 30, 0., 1.);
+   TProfile2D ref("ref", "", 20, 0., 1., 30, 0., 1.);
+   ROOT::TH1ConcurrentFillManager manager(h);
+   EXPECT_EQ(3, manager.GetNCoordinates());
+   FillConcurrently(manager, [](ROOT::TH1ConcurrentFiller &filler, int t, int i) {
+      // Unweighted
+      filler.Fill(Coord(t, i, 0), Coord(t, i, 1), Coord(t, i, 2));
+   });
+   for (int t = 0; t < kNThreads; ++t) {
+      for (int i = 0; i < kNEntries; ++i)
+         ref.Fill(Coord(t, i, 0), Coord(t, i, 1), Coord(t, i, 2));
+   }
+   for (int bin = 0; bin < ref.GetNcells(); ++bin) {
+      EXPECT_EQ(ref.GetBinEntries(bin), h.GetBinEntries(bin));
+      EXPECT_NEAR(ref.GetBinContent(bin), h.GetBinContent(bin), 1e-12);
+      EXPECT_NEAR(ref.GetBinError(bin), h.GetBinError(bin), 1e-12);
+   }
+   EXPECT_EQ(ref.GetEntries(), h.GetEntries());
+   EXPECT_EQ(0, h.GetBinSumw2()->GetSize());
+}
@@ -0,0 +1,102 @@
+// test the bin lookup of TH2Poly against a brute force search
+
+#include "gtest/gtest.h"
+
+#include "TH2Poly.h"
+#include "TList.h"
+#include "TRandom3.h"
+
+#include <vector>
+
+namespace {
+
+// The lowest bin number of the bins containing (x,y), or -5 for the sea
+Int_t BruteForceFindBin(TH2Poly &h2p, Double_t x, Double_t y)
+{
+   TIter next(h2p.GetBins());
+   while (auto bin = static_cast<TH2PolyBin *>(next())) {
+      if (bin->IsInside(x, y))
+         return bin->GetBinNumber();
+   }
+   return -5;
+}
+
+} // anonymous namespace
+
+TEST(TH2Poly, FindBinHoneycomb)
+{
+   TH2Poly h2p("h2p", "", 0., 10., 0., 10.);
+   h2p.Honeycomb(0., 0., 0.1, 50, 60);
+   // Rows of alternately 50 and 49 hexagons
+   ASSERT_EQ(30 * 50 + 30 * 49, h2p.GetNumberOfBins());
+
+   TRandom3 ran(1);
+   for (int i = 0; i < 20000; i++) {
+      Double_t x = ran.Uniform(-1., 11.);
+      Double_t y = ran.Uniform(-1., 11.);
+      Int_t expected = BruteForceFindBin(h2p, x, y);
+      Int_t bin = h2p.FindBin(x, y);
+      if (bin > 0 || bin == -5) {
+         ASSERT_EQ(expected, bin) << "at (" << x << ", " << y << ")";
+      } else {
+         ASSERT_TRUE(x <= h2p.GetXaxis()->GetXmin() || x > h2p.GetXaxis()->GetXmax() ||
+                     y <= h2p.GetYaxis()->GetXmin() || y > h2p.GetYaxis()->GetXmax());
+      }
+   }
+}
+
+TEST(TH2Poly, FindBinOverlapping)
+{
+   TH2Poly h2p("h2p", "", 0., 10., 0., 10.);
+   TRandom3 ran(2);
+   for (int i = 0; i < 500; i++) {
+      Double_t x = ran.Uniform(0., 9.);
+      Double_t y = ran.Uniform(0., 9.);
+      // Triangles, with overlaps, which must be resolved in favor of the lowest bin number
+      Double_t px[] = {x, x + ran.Uniform(0.1, 1.), x + ran.Uniform(0., 1.), x};
+      Double_t py[] = {y, y + ran.Uniform(0., 1.), y + ran.Uniform(0.1, 1.), y};
+      h2p.AddBin(4, px, py);
+   }
+   for (int i = 0; i < 20000; i++) {
+      Double_t x = ran.Uniform(0.01, 10.);
+      Double_t y = ran.Uniform(0.01, 10.);
+      ASSERT_EQ(BruteForceFindBin(h2p, x, y), h2p.FindBin(x, y));
+   }
+
+   // Bins added after a lookup are found as well
+   h2p.AddBin(0.5, 0.5, 9.5, 9.5);
+   Int_t expected = BruteForceFindBin(h2p, 5., 5.);
+   EXPECT_EQ(expected, h2p.FindBin(5., 5.));
+   EXPECT_EQ(expected, h2p.Fill(5., 5.));
+}
+
+TEST(TH2Poly, FillN)
+{
+   TH2Poly h2p("h2p", "", 0., 4., 0., 4.);
+   TH2Poly ref("ref", "", 0., 4., 0., 4.);
+   h2p.Honeycomb(0., 0., 0.2, 10, 12);
+   ref.Honeycomb(0., 0., 0.2, 10, 12);
+
+   TRandom3 ran(3);
+   const int n = 1000;
+   const int stride = 2;
+   std::vector<Double_t> x(n * stride), y(n * stride), w(n * stride);
+   for (int i = 0; i < n * stride; i++) {
+      x[i] = ran.Uniform(-0.5, 4.5);
+      y[i] = ran.Uniform(-0.5, 4.5);
+      w[i] = ran.Uniform(0., 2.);
+   }
+   h2p.FillN(n, x.data(), y.data(), w.data(), stride);
+   h2p.FillN(n, x.data(), y.data(), nullptr, stride);
+   for (int i = 0; i < n * stride; i += stride) {
+      ref.Fill(x[i], y[i], w[i]);
+      ref.Fill(x[i], y[i]);
+   }
+   for (int bin = -9; bin <= ref.GetNumberOfBins(); bin++) {
+      if (bin == 0)
+         continue;
+      EXPECT_DOUBLE_EQ(ref.GetBinContent(bin), h2p.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(ref.GetBinError(bin), h2p.GetBinError(bin));
+   }
+   EXPECT_EQ(ref.GetEntries(), h2p.GetEntries());
+}
@@ -0,0 +1,80 @@
+#include "TPrincipal.h"
+#include "TList.h"
+#include "TRandom3.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace {
+
+std::vector<double> makeRows(int nRows, int nVariables)
+{
+   TRandom3 rng(1);
+   std::vector<double> rows(nRows * nVariables);
+   for (int i = 0; i < nRows; ++i) {
+      const double common = rng.Gaus();
+      for (int j = 0; j < nVariables; ++j)
+         rows[i * nVariables + j] = (j + 1) * common + rng.Gaus(j, 1.);
+   }
+   return rows;
+}
+
+void expectSameMoments(const TPrincipal &a, const TPrincipal &b)
+{
+   const int n = a.GetMeanValues()->GetNrows();
+   for (int i = 0; i < n; ++i) {
+      EXPECT_NEAR((*a.GetMeanValues())(i), (*b.GetMeanValues())(i), 1e-10);
+      for (int j = 0; j <= i; ++j)
+         EXPECT_NEAR((*a.GetCovarianceMatrix())(i, j), (*b.GetCovarianceMatrix())(i, j), 1e-10);
+   }
+}
+
+} // namespace
+
+// Merging the objects filled with parts of a sample must give the moments of the whole sample
+TEST(TPrincipal, Merge)
+{
+   const int nVariables = 3;
+   const int nRows = 1000;
+   const auto rows = makeRows(nRows, nVariables);
+
+   TPrincipal all(nVariables, "ND");
+   TPrincipal part1(nVariables, "ND");
+   TPrincipal part2(nVariables, "ND");
+   for (int i = 0; i < nRows; ++i) {
+      all.AddRow(&rows[i * nVariables]);
+      (i < 300 ? part1 : part2).AddRow(&rows[i * nVariables]);
+   }
+
+   TList list;
+   list.Add(&part2);
+   EXPECT_EQ(part1.Merge(&list), nRows);
+   expectSameMoments(all, part1);
+   for (int i = 0; i < nRows * nVariables; ++i)
+      EXPECT_EQ((*part1.GetUserData())(i), (*all.GetUserData())(i));
+}
+
+TEST(TPrincipal, AddRows)
+{
+   const int nVariables = 4;
+   const int nRows = 200000;
+   const auto rows = makeRows(nRows, nVariables);
+
+   TPrincipal rowByRow(nVariables, "N");
+   for (int i = 0; i < nRows; ++i)
+      rowByRow.AddRow(&rows[i * nVariables]);
+
+   TPrincipal sequential(nVariables, "N");
+   sequential.AddRows(nRows, rows.data());
+   expectSameMoments(rowByRow, sequential);
+
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+   TPrincipal parallel(nVariables, "N");
+   parallel.AddRows(nRows, rows.data());
+   ROOT::DisableImplicitMT();
+   expectSameMoments(rowByRow, parallel);
+#endif
+}
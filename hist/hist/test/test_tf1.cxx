@@ -223,3 +223,23 @@ TEST(TF1, Constructors)
    for (auto tf1 : vtf1)
       EXPECT_EQ(tf1(&x, &p), 2);
 }
+
+TEST(TF1, EvalN)
+{
+   const std::size_t n = 5;
+   double xs[n] = {-1., -0.5, 0., 0.5, 1.};
+   const double *x[1] = {xs};
+   double res[n];
+
+   TF1 fformula("fformula", "[0]*x*x + [1]", -1, 1);
+   fformula.SetParameters(2., 1.);
+   fformula.EvalN(n, x, res);
+   for (std::size_t i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(fformula.Eval(xs[i]), res[i]);
+
+   TF1 flambda("flambda", [](double *v, double *p) { return p[0] * v[0]; }, -1, 1, 1);
+   flambda.SetParameter(0, 3.);
+   flambda.EvalN(n, x, res);
+   for (std::size_t i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(3. * xs[i], res[i]);
+}
@@ -496,4 +496,46 @@ TEST(TKDE, tkde_io_mirror)
    for (size_t i = 0; i < t.xtest.size(); ++i) {
       EXPECT_NEAR(t.values1[i], t.values2[i], delta);
    }
-}
\ No newline at end of file
+}
+/// Grid evaluation tests
+/// In this test we compare the evaluation on the grid with the direct evaluation of the binned estimate, which
+/// must be equal at the bin centres (the grid nodes) and close in between
+void CompareGridEvaluation(const char *iteration, const char *mirror)
+{
+   const int n = 20000;
+   const int nbins = 400;
+   TRandom3 r(4321);
+   std::vector<double> data(n);
+   for (auto &x : data)
+      x = (r.Rndm() < 0.2) ? r.Gaus(10, 1) : r.Gaus(10, 7);
+
+   TString opt = TString::Format("KernelType:Gaussian;Iteration:%s;Mirror:%s;Binning:ForcedBinning", iteration, mirror);
+   TKDE kde(n, data.data(), 0., 20., opt, 1);
+   TKDE kdeGrid(n, data.data(), 0., 20., opt, 1);
+   kde.SetNBins(nbins);
+   kdeGrid.SetNBins(nbins);
+   kdeGrid.SetGridEvaluation();
+
+   const double step = 20. / nbins;
+   for (int i = 0; i < nbins; i += 7) {
+      double x = (i + 0.5) * step;
+      EXPECT_NEAR(kde(x), kdeGrid(x), 1.E-10 * kde(x)) << iteration << " " << mirror << " at x = " << x;
+   }
+   for (double x = -5.; x < 25.; x += 0.37) {
+      EXPECT_NEAR(kde(x), kdeGrid(x), 1.E-3 * kde(x) + 1.E-5) << iteration << " " << mirror << " at x = " << x;
+   }
+}
+
+TEST(TKDE, tkde_grid)
+{
+   CompareGridEvaluation("Fixed", "noMirror");
+   CompareGridEvaluation("Fixed", "mirrorBoth");
+   CompareGridEvaluation("Fixed", "mirrorAsymBoth");
+}
+
+TEST(TKDE, tkde_grid_adaptive)
+{
+   CompareGridEvaluation("Adaptive", "noMirror");
+   CompareGridEvaluation("Adaptive", "mirrorBoth");
+   CompareGridEvaluation("Adaptive", "mirrorLeftAsymRight");
+}
@@ -28,6 +28,12 @@
 #pragma link C++ class ROOT::Experimental::Detail::RHistImplPrecisionAgnosticBase<1>+;
 #pragma link C++ class ROOT::Experimental::Detail::RHistImplPrecisionAgnosticBase<2>+;
 #pragma link C++ class ROOT::Experimental::Detail::RHistImplPrecisionAgnosticBase<3>+;
+#pragma link C++ class ROOT::Experimental::Detail::RHistStatContentImpl<1,double,vector<double>>+;
+#pragma link C++ class ROOT::Experimental::Detail::RHistStatContentImpl<2,double,vector<double>>+;
+#pragma link C++ class ROOT::Experimental::Detail::RHistStatContentImpl<3,double,vector<double>>+;
+#pragma link C++ class ROOT::Experimental::Detail::RHistStatUncertaintyImpl<1,double,vector<double>>+;
+#pragma link C++ class ROOT::Experimental::Detail::RHistStatUncertaintyImpl<2,double,vector<double>>+;
+#pragma link C++ class ROOT::Experimental::Detail::RHistStatUncertaintyImpl<3,double,vector<double>>+;
 #pragma link C++ class ROOT::Experimental::RHistStatContent<1,double>+;
 #pragma link C++ class ROOT::Experimental::RHistStatContent<2,double>+;
 #pragma link C++ class ROOT::Experimental::RHistStatContent<3,double>+;
@@ -16,7 +16,10 @@
 #ifndef ROOT7_RHistData
 #define ROOT7_RHistData
 
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <type_traits>
 #include <vector>
 #include "ROOT/RSpan.hxx"
 #include "ROOT/RHistUtils.hxx"
@@ -27,20 +30,116 @@ namespace Experimental {
 template <int DIMENSIONS, class PRECISION, template <int D_, class P_> class... STAT>
 class RHist;
 
+namespace Hist {
 /**
- \class RHistStatContent
- Basic histogram statistics, keeping track of the bin content and the total
- number of calls to Fill().
+ \class RAtomicBinContent
+ A bin content that can be incremented by several threads concurrently,
+ without locking. Meant as element type of a `RHistData` storage, see
+ `AtomicStorage_t`.
+
+ Integral types are incremented with `fetch_add()`, floating point types with a
+ compare-and-swap loop. All operations use relaxed memory ordering: the
+ increments are atomic, but they do not synchronize other memory accesses.
  */
-template <int DIMENSIONS, class PRECISION>
-class RHistStatContent {
+template <class T>
+class RAtomicBinContent {
+private:
+   /// The wrapped atomic value.
+   std::atomic<T> fVal;
+
+   template <class U = T>
+   typename std::enable_if<std::is_integral<U>::value>::type AddImpl(T rhs)
+   {
+      fVal.fetch_add(rhs, std::memory_order_relaxed);
+   }
+
+   template <class U = T>
+   typename std::enable_if<!std::is_integral<U>::value>::type AddImpl(T rhs)
+   {
+      T oldVal = fVal.load(std::memory_order_relaxed);
+      // On failure, `oldVal` is updated to the current value.
+      while (!fVal.compare_exchange_weak(oldVal, oldVal + rhs, std::memory_order_relaxed))
+         ;
+   }
+
+public:
+   /// Value-initialize the atomic.
+   RAtomicBinContent(): fVal(T{}) {}
+
+   /// Construct the atomic from the underlying type.
+   RAtomicBinContent(T val): fVal(val) {}
+
+   /// Copy-construct the atomic, needed for copying the storage.
+   RAtomicBinContent(const RAtomicBinContent &other): fVal(other.fVal.load(std::memory_order_relaxed)) {}
+
+   /// Copy-assign the atomic.
+   RAtomicBinContent &operator=(const RAtomicBinContent &other)
+   {
+      fVal.store(other.fVal.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      return *this;
+   }
+
+   /// Atomically increment the value, as needed by histogram filling.
+   RAtomicBinContent &operator+=(T rhs)
+   {
+      AddImpl(rhs);
+      return *this;
+   }
+
+   /// Implicitly convert to the underlying type.
+   operator T() const { return fVal.load(std::memory_order_relaxed); }
+};
+
+/// \name Storage policies
+/// Types of the bin content arrays, to be passed as `STORAGE` parameter of `Detail::RHistData`. They apply to all
+/// statistics that keep per-bin arrays, i.e. `RHistStatContent` and `RHistStatUncertainty`.
+///\{
+
+/// Plain `PRECISION` bin contents; the default of `RHist`.
+template <class PRECISION>
+using VectorStorage_t = std::vector<PRECISION>;
+
+/// Bin contents that can be filled concurrently from several threads without locking; see `RAtomicBinContent`.
+template <class PRECISION>
+using AtomicStorage_t = std::vector<RAtomicBinContent<PRECISION>>;
+
+/// 32 bit integer bin contents, halving the memory of a `double` histogram for unweighted counting. Weights are
+/// converted to `std::int32_t` before they are added, and the uncertainty is computed from the integral sum of
+/// squared weights.
+using Int32CountStorage_t = std::vector<std::int32_t>;
+///\}
+
+/// Whether the elements of `STORAGE` are `RAtomicBinContent`s.
+template <class STORAGE>
+struct IsAtomicStorage: std::false_type {
+};
+
+template <class T, class ALLOC>
+struct IsAtomicStorage<std::vector<RAtomicBinContent<T>, ALLOC>>: std::true_type {
+};
+} // namespace Hist
+
+namespace Detail {
+/**
+ \class RHistStatContentImpl
+ Implementation of `RHistStatContent` for a given type `STORAGE` of the bin
+ content arrays, see the storage policies in namespace `Hist`. The element type
+ of `STORAGE` must be convertible to, and support `+=` of, `PRECISION`.
+ */
+template <int DIMENSIONS, class PRECISION, class STORAGE>
+class RHistStatContentImpl {
 public:
    /// The type of a (possibly multi-dimensional) coordinate.
    using CoordArray_t = Hist::CoordArray_t<DIMENSIONS>;
    /// The type of the weight and the bin content.
    using Weight_t = PRECISION;
    /// Type of the bin content array.
-   using Content_t = std::vector<PRECISION>;
+   using Content_t = STORAGE;
+   /// Type of a modifying reference to a bin content; `Weight_t &` for the default storage.
+   using BinRef_t = typename Content_t::reference;
+   /// Type of the number of entries; atomic if the bin contents are.
+   using Entries_t = typename std::conditional<Hist::IsAtomicStorage<STORAGE>::value, Hist::RAtomicBinContent<int64_t>,
+                                               int64_t>::type;
 
    /**
     \class RConstBinStat
@@ -48,7 +147,7 @@ public:
    */
    class RConstBinStat {
    public:
-      RConstBinStat(const RHistStatContent &stat, int index): fContent(stat.GetBinContent(index)) {}
+      RConstBinStat(const RHistStatContentImpl &stat, int index): fContent(stat.GetBinContent(index)) {}
       PRECISION GetContent() const { return fContent; }
 
    private:
@@ -61,11 +160,11 @@ public:
    */
    class RBinStat {
    public:
-      RBinStat(RHistStatContent &stat, int index): fContent(stat.GetBinContent(index)) {}
-      PRECISION &GetContent() const { return fContent; }
+      RBinStat(RHistStatContentImpl &stat, int index): fContent(stat.GetBinContent(index)) {}
+      BinRef_t GetContent() const { return fContent; }
 
    private:
-      PRECISION &fContent; ///< The content of this bin.
+      BinRef_t fContent; ///< The content of this bin.
    };
 
    using ConstBinStat_t = RConstBinStat;
@@ -73,7 +172,7 @@ public:
 
 private:
    /// Number of calls to Fill().
-   int64_t fEntries = 0;
+   Entries_t fEntries = 0;
 
    /// Bin content.
    Content_t fBinContent;
@@ -82,8 +181,11 @@ private:
    Content_t fOverflowBinContent;
 
 public:
-   RHistStatContent() = default;
-   RHistStatContent(size_t bin_size, size_t overflow_size): fBinContent(bin_size), fOverflowBinContent(overflow_size) {}
+   RHistStatContentImpl() = default;
+   RHistStatContentImpl(size_t bin_size, size_t overflow_size)
+      : fBinContent(bin_size), fOverflowBinContent(overflow_size)
+   {
+   }
 
    /// Get a reference to the bin corresponding to `binidx` of the correct bin
    /// content array
@@ -100,7 +202,7 @@ public:
    /// Get a reference to the bin corresponding to `binidx` of the correct bin
    /// content array (non-const)
    /// i.e. depending if `binidx` is a regular bin or an under- / overflow bin.
-   Weight_t& GetBinArray(int binidx)
+   BinRef_t GetBinArray(int binidx)
    {
       if (binidx < 0){
          return fOverflowBinContent[-binidx - 1];
@@ -113,7 +215,7 @@ public:
    void Fill(const CoordArray_t & /*x*/, int binidx, Weight_t weight = 1.)
    {
       GetBinArray(binidx) += weight;
-      ++fEntries;
+      fEntries += 1;
    }
 
    /// Get the number of entries filled into the histogram - i.e. the number of
@@ -132,12 +234,12 @@ public:
    /// Get the bin content for the given bin.
    Weight_t operator[](int binidx) const { return GetBinArray(binidx); }
    /// Get the bin content for the given bin (non-const).
-   Weight_t &operator[](int binidx) { return GetBinArray(binidx); }
+   BinRef_t operator[](int binidx) { return GetBinArray(binidx); }
 
    /// Get the bin content for the given bin.
    Weight_t GetBinContent(int binidx) const { return GetBinArray(binidx); }
    /// Get the bin content for the given bin (non-const).
-   Weight_t &GetBinContent(int binidx) { return GetBinArray(binidx); }
+   BinRef_t GetBinContent(int binidx) { return GetBinArray(binidx); }
 
    /// Retrieve the content array.
    const Content_t &GetContentArray() const { return fBinContent; }
@@ -149,19 +251,43 @@ public:
    /// Retrieve the under-/overflow content array (non-const).
    Content_t &GetOverflowContentArray() { return fOverflowBinContent; }
 
-   /// Merge with other RHistStatContent, assuming same bin configuration.
-   void Add(const RHistStatContent& other) {
-      assert(fBinContent.size() == other.fBinContent.size()
+   /// Merge with other RHistStatContent, assuming same bin configuration. The
+   /// storage of `other` can differ from this one's.
+   template <class OTHERSTORAGE>
+   void Add(const RHistStatContentImpl<DIMENSIONS, PRECISION, OTHERSTORAGE> &other)
+   {
+      const auto &otherContent = other.GetContentArray();
+      const auto &otherOverflowContent = other.GetOverflowContentArray();
+      assert(fBinContent.size() == otherContent.size()
                && "this and other have incompatible bin configuration!");
-      assert(fOverflowBinContent.size() == other.fOverflowBinContent.size()
+      assert(fOverflowBinContent.size() == otherOverflowContent.size()
                && "this and other have incompatible bin configuration!");
-      fEntries += other.fEntries;
+      fEntries += other.GetEntries();
       for (size_t b = 0; b < fBinContent.size(); ++b)
-         fBinContent[b] += other.fBinContent[b];
+         fBinContent[b] += static_cast<PRECISION>(otherContent[b]);
       for (size_t b = 0; b < fOverflowBinContent.size(); ++b)
-         fOverflowBinContent[b] += other.fOverflowBinContent[b];
+         fOverflowBinContent[b] += static_cast<PRECISION>(otherOverflowContent[b]);
    }
 };
+} // namespace Detail
+
+/**
+ \class RHistStatContent
+ Basic histogram statistics, keeping track of the bin content and the total
+ number of calls to Fill().
+
+ The bin contents are kept in a `std::vector<PRECISION>`; `RHistData` uses
+ `WithStorage_t` for other storage policies.
+ */
+template <int DIMENSIONS, class PRECISION>
+class RHistStatContent: public Detail::RHistStatContentImpl<DIMENSIONS, PRECISION, std::vector<PRECISION>> {
+public:
+   using Detail::RHistStatContentImpl<DIMENSIONS, PRECISION, std::vector<PRECISION>>::RHistStatContentImpl;
+
+   /// These statistics, with bin content arrays of type `STORAGE`.
+   template <class STORAGE>
+   using WithStorage_t = Detail::RHistStatContentImpl<DIMENSIONS, PRECISION, STORAGE>;
+};
 
 /**
  \class RHistStatTotalSumOfWeights
@@ -251,12 +377,14 @@ public:
    }
 };
 
+namespace Detail {
 /**
- \class RHistStatUncertainty
- Histogram statistics to keep track of the Poisson uncertainty per bin.
+ \class RHistStatUncertaintyImpl
+ Implementation of `RHistStatUncertainty` for a given type `STORAGE` of the
+ arrays of the sums of squared weights, see `RHistStatContentImpl`.
  */
-template <int DIMENSIONS, class PRECISION>
-class RHistStatUncertainty {
+template <int DIMENSIONS, class PRECISION, class STORAGE>
+class RHistStatUncertaintyImpl {
 
 public:
    /// The type of a (possibly multi-dimensional) coordinate.
@@ -264,7 +392,9 @@ public:
    /// The type of the weight and the bin content.
    using Weight_t = PRECISION;
    /// Type of the bin content array.
-   using Content_t = std::vector<PRECISION>;
+   using Content_t = STORAGE;
+   /// Type of a modifying reference to a bin's sum of squared weights; `Weight_t &` for the default storage.
+   using BinRef_t = typename Content_t::reference;
 
    /**
     \class RConstBinStat
@@ -272,7 +402,7 @@ public:
    */
    class RConstBinStat {
    public:
-      RConstBinStat(const RHistStatUncertainty &stat, int index): fSumW2(stat.GetSumOfSquaredWeights(index)) {}
+      RConstBinStat(const RHistStatUncertaintyImpl &stat, int index): fSumW2(stat.GetSumOfSquaredWeights(index)) {}
       PRECISION GetSumW2() const { return fSumW2; }
 
       double GetUncertaintyImpl() const { return std::sqrt(std::abs(fSumW2)); }
@@ -287,13 +417,13 @@ public:
    */
    class RBinStat {
    public:
-      RBinStat(RHistStatUncertainty &stat, int index): fSumW2(stat.GetSumOfSquaredWeights(index)) {}
-      PRECISION &GetSumW2() const { return fSumW2; }
+      RBinStat(RHistStatUncertaintyImpl &stat, int index): fSumW2(stat.GetSumOfSquaredWeights(index)) {}
+      BinRef_t GetSumW2() const { return fSumW2; }
       // Can never modify this. Set GetSumW2() instead.
-      double GetUncertaintyImpl() const { return std::sqrt(std::abs(fSumW2)); }
+      double GetUncertaintyImpl() const { return std::sqrt(std::abs(static_cast<PRECISION>(fSumW2))); }
 
    private:
-      PRECISION &fSumW2; ///< The bin's sum of square of weights.
+      BinRef_t fSumW2; ///< The bin's sum of square of weights.
    };
 
    using ConstBinStat_t = RConstBinStat;
@@ -306,8 +436,11 @@ private:
    Content_t fOverflowSumWeightsSquared; ///< Sum of squared weights for under-/overflow.
 
 public:
-   RHistStatUncertainty() = default;
-   RHistStatUncertainty(size_t bin_size, size_t overflow_size): fSumWeightsSquared(bin_size), fOverflowSumWeightsSquared(overflow_size) {}
+   RHistStatUncertaintyImpl() = default;
+   RHistStatUncertaintyImpl(size_t bin_size, size_t overflow_size)
+      : fSumWeightsSquared(bin_size), fOverflowSumWeightsSquared(overflow_size)
+   {
+   }
 
    /// Get a reference to the bin corresponding to `binidx` of the correct bin
    /// content array
@@ -324,7 +457,7 @@ public:
    /// Get a reference to the bin corresponding to `binidx` of the correct bin
    /// content array (non-const)
    /// i.e. depending if `binidx` is a regular bin or an under- / overflow bin.
-   Weight_t& GetBinArray(int binidx)
+   BinRef_t GetBinArray(int binidx)
    {
       if (binidx < 0){
          return fOverflowSumWeightsSquared[-binidx - 1];
@@ -346,30 +479,53 @@ public:
    /// Get a bin's sum of squared weights.
    Weight_t GetSumOfSquaredWeights(int binidx) const { return GetBinArray(binidx); }
    /// Get a bin's sum of squared weights.
-   Weight_t &GetSumOfSquaredWeights(int binidx) { return GetBinArray(binidx); }
+   BinRef_t GetSumOfSquaredWeights(int binidx) { return GetBinArray(binidx); }
 
    /// Get the structure holding the sum of squares of weights.
-   const std::vector<double> &GetSumOfSquaredWeights() const { return fSumWeightsSquared; }
+   const Content_t &GetSumOfSquaredWeights() const { return fSumWeightsSquared; }
    /// Get the structure holding the sum of squares of weights (non-const).
-   std::vector<double> &GetSumOfSquaredWeights() { return fSumWeightsSquared; }
+   Content_t &GetSumOfSquaredWeights() { return fSumWeightsSquared; }
 
    /// Get the structure holding the under-/overflow sum of squares of weights.
-   const std::vector<double> &GetOverflowSumOfSquaredWeights() const { return fOverflowSumWeightsSquared; }
+   const Content_t &GetOverflowSumOfSquaredWeights() const { return fOverflowSumWeightsSquared; }
    /// Get the structure holding the under-/overflow sum of squares of weights (non-const).
-   std::vector<double> &GetOverflowSumOfSquaredWeights() { return fOverflowSumWeightsSquared; }
+   Content_t &GetOverflowSumOfSquaredWeights() { return fOverflowSumWeightsSquared; }
 
    /// Merge with other `RHistStatUncertainty` data, assuming same bin configuration.
-   void Add(const RHistStatUncertainty& other) {
-      assert(fSumWeightsSquared.size() == other.fSumWeightsSquared.size()
+   /// The storage of `other` can differ from this one's.
+   template <class OTHERSTORAGE>
+   void Add(const RHistStatUncertaintyImpl<DIMENSIONS, PRECISION, OTHERSTORAGE> &other)
+   {
+      const auto &otherSumW2 = other.GetSumOfSquaredWeights();
+      const auto &otherOverflowSumW2 = other.GetOverflowSumOfSquaredWeights();
+      assert(fSumWeightsSquared.size() == otherSumW2.size()
                && "this and other have incompatible bin configuration!");
-      assert(fOverflowSumWeightsSquared.size() == other.fOverflowSumWeightsSquared.size()
+      assert(fOverflowSumWeightsSquared.size() == otherOverflowSumW2.size()
                && "this and other have incompatible bin configuration!");
       for (size_t b = 0; b < fSumWeightsSquared.size(); ++b)
-         fSumWeightsSquared[b] += other.fSumWeightsSquared[b];
+         fSumWeightsSquared[b] += static_cast<PRECISION>(otherSumW2[b]);
       for (size_t b = 0; b < fOverflowSumWeightsSquared.size(); ++b)
-         fOverflowSumWeightsSquared[b] += other.fOverflowSumWeightsSquared[b];
+         fOverflowSumWeightsSquared[b] += static_cast<PRECISION>(otherOverflowSumW2[b]);
    }
 };
+} // namespace Detail
+
+/**
+ \class RHistStatUncertainty
+ Histogram statistics to keep track of the Poisson uncertainty per bin.
+
+ The sums of squared weights are kept in a `std::vector<PRECISION>`;
+ `RHistData` uses `WithStorage_t` for other storage policies.
+ */
+template <int DIMENSIONS, class PRECISION>
+class RHistStatUncertainty: public Detail::RHistStatUncertaintyImpl<DIMENSIONS, PRECISION, std::vector<PRECISION>> {
+public:
+   using Detail::RHistStatUncertaintyImpl<DIMENSIONS, PRECISION, std::vector<PRECISION>>::RHistStatUncertaintyImpl;
+
+   /// These statistics, with arrays of sums of squared weights of type `STORAGE`.
+   template <class STORAGE>
+   using WithStorage_t = Detail::RHistStatUncertaintyImpl<DIMENSIONS, PRECISION, STORAGE>;
+};
 
 /** \class RHistDataMomentUncert
   For now do as `RH1`: calculate first (xw) and second (x^2w) moment.
@@ -503,11 +659,35 @@ public:
    }
 };
 
+/// Selects the base class of `RHistData` for statistics `STAT`: `STAT::WithStorage_t<STORAGE>` if `STAT` supports
+/// storage policies and `STORAGE` is not its default storage, else `STAT` itself.
+template <class STAT, class STORAGE, class = void>
+struct RHistStatWithStorage {
+   using type = STAT;
+};
+
+template <class STAT, class STORAGE>
+struct RHistStatWithStorage<STAT, STORAGE,
+                            typename std::enable_if<!std::is_same<typename STAT::Content_t, STORAGE>::value,
+                                                    decltype((typename STAT::template WithStorage_t<STORAGE> *)nullptr,
+                                                             void())>::type> {
+   using type = typename STAT::template WithStorage_t<STORAGE>;
+};
+
+/// The base class of `RHistData<DIMENSIONS, PRECISION, STORAGE, ...>` for the statistics `STAT`.
+template <int DIMENSIONS, class PRECISION, class STORAGE, template <int D_, class P_> class STAT>
+using RHistStatBase_t = typename RHistStatWithStorage<STAT<DIMENSIONS, PRECISION>, STORAGE>::type;
+
 /** \class RHistData
   A `RHistImplBase`'s data, provides accessors to all its statistics.
+
+  `STORAGE` is the type of the per-bin arrays of the statistics that support it,
+  see the storage policies in namespace `Hist`; e.g. `Hist::AtomicStorage_t`
+  for concurrent filling. Statistics that do not support it keep their own
+  storage.
   */
 template <int DIMENSIONS, class PRECISION, class STORAGE, template <int D_, class P_> class... STAT>
-class RHistData: public STAT<DIMENSIONS, PRECISION>... {
+class RHistData: public RHistStatBase_t<DIMENSIONS, PRECISION, STORAGE, STAT>... {
 private:
    /// Check whether `double T::GetBinUncertaintyImpl(int)` can be called.
    template <class T>
@@ -528,10 +708,11 @@ public:
 
    /// The type of a non-modifying view on a bin.
    using ConstHistBinStat_t =
-      RHistBinStat<const RHistData, typename STAT<DIMENSIONS, PRECISION>::ConstBinStat_t...>;
+      RHistBinStat<const RHistData, typename RHistStatBase_t<DIMENSIONS, PRECISION, STORAGE, STAT>::ConstBinStat_t...>;
 
    /// The type of a modifying view on a bin.
-   using HistBinStat_t = RHistBinStat<RHistData, typename STAT<DIMENSIONS, PRECISION>::BinStat_t...>;
+   using HistBinStat_t =
+      RHistBinStat<RHistData, typename RHistStatBase_t<DIMENSIONS, PRECISION, STORAGE, STAT>::BinStat_t...>;
 
    /// Number of dimensions of the coordinates.
    static constexpr int GetNDim() noexcept { return DIMENSIONS; }
@@ -540,7 +721,10 @@ public:
 
    /// Constructor providing the number of bins (incl under, overflow) to the
    /// base classes.
-   RHistData(size_t bin_size, size_t overflow_size): STAT<DIMENSIONS, PRECISION>(bin_size, overflow_size)... {}
+   RHistData(size_t bin_size, size_t overflow_size)
+      : RHistStatBase_t<DIMENSIONS, PRECISION, STORAGE, STAT>(bin_size, overflow_size)...
+   {
+   }
 
    /// Fill weight at x to the bin content at binidx.
    void Fill(const CoordArray_t &x, int binidx, Weight_t weight = 1.)
@@ -552,7 +736,8 @@ public:
       //           that needs to be instantiated before it can be used.
       // - "...":  template parameter pack expansion; the expression is evaluated
       //           for each `STAT`. The expression is
-      //           `(STAT<DIMENSIONS, PRECISION>::Fill(x, binidx, weight), 0)`.
+      //           `(STAT<DIMENSIONS, PRECISION>::Fill(x, binidx, weight), 0)`, with
+      //           `STAT<DIMENSIONS, PRECISION>` adapted to `STORAGE` by `RHistStatBase_t`.
       // - "trigger_base_fill{}":
       //           initialization, provides a context in which template parameter
       //           pack expansion happens.
@@ -560,7 +745,7 @@ public:
       //           expression. The trailing ", 0" gives it the type of the trailing
       //           comma-separated expression - int.
       using trigger_base_fill = int[];
-      (void)trigger_base_fill{(STAT<DIMENSIONS, PRECISION>::Fill(x, binidx, weight), 0)...};
+      (void)trigger_base_fill{(RHistStatBase_t<DIMENSIONS, PRECISION, STORAGE, STAT>::Fill(x, binidx, weight), 0)...};
    }
 
    /// Integrate other statistical data into the current data.
@@ -573,14 +758,14 @@ public:
    {
       // Call `Add()` on all base classes, using the same tricks as `Fill()`.
       using trigger_base_add = int[];
-      (void)trigger_base_add{(STAT<DIMENSIONS, PRECISION>::Add(other), 0)...};
+      (void)trigger_base_add{(RHistStatBase_t<DIMENSIONS, PRECISION, STORAGE, STAT>::Add(other), 0)...};
    }
 
    /// Whether this provides storage for uncertainties, or whether uncertainties
    /// are determined as poisson uncertainty of the content.
    static constexpr bool HasBinUncertainty()
    {
-      struct AllYourBaseAreBelongToUs: public STAT<DIMENSIONS, PRECISION>... {
+      struct AllYourBaseAreBelongToUs: public RHistStatBase_t<DIMENSIONS, PRECISION, STORAGE, STAT>... {
       };
       return sizeof(HaveUncertainty<AllYourBaseAreBelongToUs>(nullptr)) == sizeof(double);
    }
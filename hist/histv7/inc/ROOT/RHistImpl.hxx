@@ -16,9 +16,11 @@
 #ifndef ROOT7_RHistImpl
 #define ROOT7_RHistImpl
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <functional>
+#include <type_traits>
 #include "ROOT/RSpan.hxx"
 #include "ROOT/RTupleApply.hxx"
 
@@ -217,7 +219,8 @@ public:
    }
 
    /// Get the bin content (sum of weights) for bin index `binidx` (non-const).
-   Weight_t &GetBinContent(int binidx)
+   /// Returns a `Weight_t &`, or the storage's reference type, see `RHistData`.
+   decltype(auto) GetBinContent(int binidx)
    {
       assert(binidx != 0);
       return fStatistics[binidx];
@@ -736,6 +739,61 @@ public:
 private:
    std::tuple<AXISCONFIG...> fAxes; ///< The histogram's axes
 
+   /// Whether `FillN()` computes the bin indices in batches: all axes are `RAxisEquidistant` (which cannot grow).
+   static constexpr bool kFillBatched = (std::is_same<AXISCONFIG, RAxisEquidistant>::value && ...);
+
+   /// Fill `xN` with the weights `weightN`, or with weight 1 if `weightN` is `nullptr`. The bin indices are computed
+   /// for blocks of coordinates, one axis at a time, in branch-free loops that the compiler can vectorize; only the
+   /// coordinates in under- or overflow bins go through `GetBinIndex()`. Requires `kFillBatched`.
+   void FillBatched(const std::span<const CoordArray_t> xN, const Weight_t *weightN)
+   {
+      constexpr int kNDim = DATA::GetNDim();
+      constexpr std::size_t kBlockSize = 256;
+
+      std::array<double, kNDim> low;
+      std::array<double, kNDim> invBinWidth;
+      std::array<double, kNDim> maxVirtualBin;
+      std::array<unsigned int, kNDim> nBins;
+      std::array<int, kNDim> stride;
+      {
+         int d = 0;
+         int nextStride = 1;
+         std::apply(
+            [&](const AXISCONFIG &...axis) {
+               ((low[d] = axis.GetMinimum(), invBinWidth[d] = axis.GetInverseBinWidth(),
+                 nBins[d] = axis.GetNBinsNoOver(), maxVirtualBin[d] = nBins[d] + 1., stride[d] = nextStride,
+                 nextStride *= axis.GetNBinsNoOver(), ++d),
+                ...);
+            },
+            fAxes);
+      }
+
+      int bins[kBlockSize];
+      int overflow[kBlockSize];
+      for (std::size_t first = 0; first < xN.size(); first += kBlockSize) {
+         const std::size_t n = std::min(kBlockSize, xN.size() - first);
+         const CoordArray_t *x = xN.data() + first;
+         for (std::size_t i = 0; i < n; ++i) {
+            bins[i] = 1;
+            overflow[i] = 0;
+         }
+         for (int d = 0; d < kNDim; ++d) {
+            for (std::size_t i = 0; i < n; ++i) {
+               // Same as `RAxisEquidistant::FindBin()`, with 0 for underflow and `nBins + 1` for overflow
+               const double virtualBin = std::min(std::max(0., (x[i][d] - low[d]) * invBinWidth[d] + 1.),
+                                                  maxVirtualBin[d]);
+               const int localBin = static_cast<int>(virtualBin);
+               bins[i] += (localBin - 1) * stride[d];
+               overflow[i] |= static_cast<unsigned int>(localBin - 1) >= nBins[d];
+            }
+         }
+         for (std::size_t i = 0; i < n; ++i) {
+            const int bin = overflow[i] ? GetBinIndex(x[i]) : bins[i];
+            this->GetStat().Fill(x[i], bin, weightN ? weightN[first + i] : Weight_t(1));
+         }
+      }
+   }
+
 public:
    RHistImpl(TRootIOCtor *);
    RHistImpl(AXISCONFIG... axisArgs);
@@ -1048,6 +1106,7 @@ public:
    /// Fill an array of `weightN` to the bins specified by coordinates `xN`.
    /// For each element `i`, the weight `weightN[i]` will be added to the bin
    /// at the coordinate `xN[i]`
+   /// If all axes are equidistant, the bin indices are computed in vectorizable batches.
    /// \note `xN` and `weightN` must have the same size!
    void FillN(const std::span<const CoordArray_t> xN, const std::span<const Weight_t> weightN) final
    {
@@ -1058,18 +1117,27 @@ public:
       }
 #endif
 
-      for (size_t i = 0; i < xN.size(); ++i) {
-         Fill(xN[i], weightN[i]);
+      if constexpr (kFillBatched) {
+         FillBatched(xN, weightN.data());
+      } else {
+         for (size_t i = 0; i < xN.size(); ++i) {
+            Fill(xN[i], weightN[i]);
+         }
       }
    }
 
    /// Fill an array of `weightN` to the bins specified by coordinates `xN`.
    /// For each element `i`, the weight `weightN[i]` will be added to the bin
    /// at the coordinate `xN[i]`
+   /// If all axes are equidistant, the bin indices are computed in vectorizable batches.
    void FillN(const std::span<const CoordArray_t> xN) final
    {
-      for (auto &&x: xN) {
-         Fill(x);
+      if constexpr (kFillBatched) {
+         FillBatched(xN, nullptr);
+      } else {
+         for (auto &&x: xN) {
+            Fill(x);
+         }
       }
    }
 
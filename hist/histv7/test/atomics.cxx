@@ -1,62 +1,8 @@
 #include "gtest/gtest.h"
 
-#include <atomic>
+#include <thread>
 #include <vector>
 
-// Implementation of op+= for integral.
-template <class INTEGRAL>
-std::atomic<INTEGRAL> &atomic_addeq(std::atomic<INTEGRAL> &lhs, INTEGRAL rhs,
-                                    decltype(std::declval<std::atomic<INTEGRAL>>().fetch_add(INTEGRAL())) * = nullptr)
-{
-   lhs.fetch_add(rhs);
-   return lhs;
-}
-
-// Implementation of op+= for floats.
-template <class FLOAT>
-std::atomic<FLOAT> &atomic_addeq(std::atomic<FLOAT> &lhs, FLOAT rhs,
-                                 typename std::enable_if<std::is_floating_point<FLOAT>::value>::type * = nullptr)
-{
-   auto oldval = lhs.load(std::memory_order_relaxed);
-   auto newval = oldval + rhs;
-   while (lhs.compare_exchange_strong(oldval, newval)) {
-      // oldval is changed to what bin holds at the call to compare_exchange_strong
-      newval = oldval + rhs;
-   }
-   return lhs;
-}
-
-/// \class WrappedAtomic.
-/// \brief Provides copy constructor for `atomic` and `+=` even for floats.
-///
-/// It provides the operations needed for `Hist` with atomic bin content.
-template <class T>
-class WrappedAtomic {
-private:
-   /// The wrapped atomic value.
-   std::atomic<T> fVal;
-public:
-   /// Value-initialize the atomic.
-   WrappedAtomic(): fVal(T{}) {}
-
-   /// Copy-construct the atomic.
-   WrappedAtomic(const WrappedAtomic &other):
-      fVal(other.fVal.load(std::memory_order_relaxed))
-   {}
-
-   /// Construct the atomic from the underlying type.
-   WrappedAtomic(T other): fVal(other) {}
-
-   /// Increment operator, as needed by histogram filling.
-   WrappedAtomic &operator+=(T rhs) {
-      atomic_addeq(fVal, rhs);
-      return *this;
-   }
-
-   /// Implicitly convert to the underlying type.
-   operator T() const { return fVal.load(std::memory_order_relaxed); }
-};
-
 /** Basic tests for histograms of integral precision using vector<atomic> storage.
    */
 
@@ -67,7 +13,7 @@ using namespace ROOT::Experimental;
 
 // Storage using vector<atomic<>>
 template <class PRECISION>
-using atomicvec_t = std::vector<WrappedAtomic<PRECISION>>;
+using atomicvec_t = Hist::AtomicStorage_t<PRECISION>;
 
 // A RHistData using vector<atomic<>> as storage.
 template <int DIM, class PRECISION>
@@ -124,3 +70,53 @@ TEST(HistAtomicPrecisionTest, Fill1Float)
    EXPECT_FLOAT_EQ(-9., hist.GetBinContent({0.9999}));
    EXPECT_FLOAT_EQ(9., hist.GetBinUncertainty(hist.GetBinIndex({0.9999})));
 }
+
+// Test concurrent filling of RHistImpl with atomic precision, without locks.
+TEST(HistAtomicPrecisionTest, FillConcurrent)
+{
+   Detail::RHistImpl<uncert_t<1, double>, RAxisEquidistant> hist(RAxisEquidistant{10, 0., 1});
+   Detail::RHistImpl<content_t<1, long long>, RAxisEquidistant> histLL(RAxisEquidistant{10, 0., 1});
+   std::vector<std::thread> threads;
+   for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([&hist, &histLL]() {
+         for (int i = 0; i < 10000; ++i) {
+            hist.Fill({(i % 10) / 10. + 0.05}, 2.);
+            histLL.Fill({(i % 10) / 10. + 0.05});
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+   for (double x = 0.05; x < 1.; x += 0.1) {
+      EXPECT_DOUBLE_EQ(8000., hist.GetBinContent({x}));
+      EXPECT_DOUBLE_EQ(std::sqrt(16000.), hist.GetBinUncertainty(hist.GetBinIndex({x})));
+      EXPECT_EQ(4000ll, histLL.GetBinContent({x}));
+   }
+   EXPECT_EQ(40000, hist.GetStat().GetEntries());
+}
+
+// Test a double histogram with 32 bit integer counts.
+TEST(HistStoragePolicyTest, Int32Counts)
+{
+   using int32data_t = Detail::RHistData<2, double, Hist::Int32CountStorage_t, RHistStatContent, RHistStatUncertainty>;
+   Detail::RHistImpl<int32data_t, RAxisEquidistant, RAxisIrregular> hist(RAxisEquidistant{10, 0., 1},
+                                                                         RAxisIrregular{{0., 0.1, 0.5, 1}});
+   static_assert(std::is_same<decltype(hist.GetStat().GetContentArray()), std::vector<std::int32_t> &>::value,
+                 "Content storage must be the selected policy");
+   hist.Fill({0.25, 0.25});
+   hist.Fill({0.25, 0.25}, 2.);
+   hist.Fill({1.5, 0.25});
+   EXPECT_DOUBLE_EQ(3., hist.GetBinContent({0.25, 0.25}));
+   EXPECT_DOUBLE_EQ(std::sqrt(5.), hist.GetBinUncertainty(hist.GetBinIndex({0.25, 0.25})));
+   EXPECT_DOUBLE_EQ(1., hist.GetBinContent({1.5, 0.25}));
+   EXPECT_EQ(3, hist.GetStat().GetEntries());
+
+   // Merge into a histogram with the default storage
+   Detail::RHistImpl<Detail::RHistData<2, double, std::vector<double>, RHistStatContent, RHistStatUncertainty>,
+                     RAxisEquidistant, RAxisIrregular>
+      histD(RAxisEquidistant{10, 0., 1}, RAxisIrregular{{0., 0.1, 0.5, 1}});
+   histD.Fill({0.25, 0.25}, 0.5);
+   histD.GetStat().Add(hist.GetStat());
+   EXPECT_DOUBLE_EQ(3.5, histD.GetBinContent({0.25, 0.25}));
+   EXPECT_EQ(4, histD.GetStat().GetEntries());
+}
@@ -2,6 +2,8 @@
 
 #include "ROOT/RHist.hxx"
 
+#include <vector>
+
 // Test Fill(), FillN(), GetEntries(), GetBinContent(), GetBinUncertainty()
 
 
@@ -629,3 +631,35 @@ TEST(HistFillTest, FillN3DCoordsWeightsUncertainty)
    EXPECT_FLOAT_EQ(std::sqrt(weight2 * weight2), hist.GetBinUncertainty({0.2222, 4.33, 7.11}));
    EXPECT_FLOAT_EQ(std::sqrt((weight3 * weight3) + (weight2 * weight2)), hist.GetBinUncertainty({0.3333, 4.11, 7.22}));
 }
+
+// Test that the batched FillN() of equidistant axes agrees with Fill(), also for under- and overflow.
+TEST(HistFillTest, FillNBatchedEquidistant)
+{
+   ROOT::Experimental::RH3D hist({10, 0., 1.}, {7, -1., 2.}, {3, 5., 6.});
+   ROOT::Experimental::RH3D ref({10, 0., 1.}, {7, -1., 2.}, {3, 5., 6.});
+   std::vector<ROOT::Experimental::Hist::CoordArray_t<3>> coords;
+   std::vector<double> weights;
+   // More than one block of coordinates, covering all bins including under- and overflow
+   for (int i = 0; i < 1000; ++i) {
+      coords.push_back({(i % 13) / 10. - 0.15, (i % 11) / 3. - 1.5, (i % 5) / 3. + 4.7});
+      weights.push_back(1. + i % 3);
+   }
+   hist.FillN(coords, weights);
+   hist.FillN(coords);
+   for (size_t i = 0; i < coords.size(); ++i) {
+      ref.Fill(coords[i], weights[i]);
+      ref.Fill(coords[i]);
+   }
+   EXPECT_EQ(ref.GetEntries(), hist.GetEntries());
+   const auto &impl = *hist.GetImpl();
+   const auto &refImpl = *ref.GetImpl();
+   ASSERT_EQ(refImpl.GetNBins(), impl.GetNBins());
+   for (int bin = 1; bin <= refImpl.GetNBinsNoOver(); ++bin) {
+      EXPECT_EQ(refImpl.GetBinContent(bin), impl.GetBinContent(bin));
+      EXPECT_EQ(refImpl.GetBinUncertainty(bin), impl.GetBinUncertainty(bin));
+   }
+   for (int bin = -1; bin >= -refImpl.GetNOverflowBins(); --bin) {
+      EXPECT_EQ(refImpl.GetBinContent(bin), impl.GetBinContent(bin));
+      EXPECT_EQ(refImpl.GetBinUncertainty(bin), impl.GetBinUncertainty(bin));
+   }
+}
@@ -0,0 +1,81 @@
+// @(#)root/spectrum
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_SpectrumHelpers
+#define ROOT_SpectrumHelpers
+
+// Internal helpers of the multi-dimensional deconvolutions, not installed
+
+#include "RConfigure.h" // R__USE_IMT
+#include "RtypesCore.h"
+
+#include <memory>
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+namespace ROOT {
+namespace Internal {
+namespace Spectrum {
+
+/// Return the sum of a[i] * b[i] for i in [0, n). The four partial sums let the compiler use SIMD instructions while
+/// keeping an order of the additions that only depends on n.
+inline Double_t DotProduct(const Double_t *a, const Double_t *b, Int_t n)
+{
+   Double_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+   Int_t i = 0;
+   for (; i + 4 <= n; i += 4) {
+      s0 += a[i] * b[i];
+      s1 += a[i + 1] * b[i + 1];
+      s2 += a[i + 2] * b[i + 2];
+      s3 += a[i + 3] * b[i + 3];
+   }
+   for (; i < n; ++i)
+      s0 += a[i] * b[i];
+   return (s0 + s1) + (s2 + s3);
+}
+
+/// Runs the loops of one deconvolution over the ROOT thread pool. The TThreadExecutor is created at the first
+/// parallel loop and reused by the following ones.
+class RIndexExecutor {
+#ifdef R__USE_IMT
+   std::unique_ptr<ROOT::TThreadExecutor> fPool;
+#endif
+
+public:
+   /// Call func(i) for i in [0, n), in parallel if the implicit multi-threading is enabled and the total amount of
+   /// work, in multiply-adds, is large enough. Each call must only write its own part of the output, so that the
+   /// results are identical whatever the number of threads.
+   template <typename F>
+   void ForEachIndex(Int_t n, Double_t work, F &&func)
+   {
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && n > 1 && work > 1e6) {
+         if (!fPool)
+            fPool = std::make_unique<ROOT::TThreadExecutor>();
+         fPool->Foreach(func, ROOT::TSeqI(n));
+         return;
+      }
+#else
+      (void)work;
+#endif
+      for (Int_t i = 0; i < n; ++i)
+         func(i);
+   }
+};
+
+} // namespace Spectrum
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -46,6 +46,10 @@
 #include "TList.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "SpectrumHelpers.h"
+
+#include <algorithm>
+
 #define PEAK_WINDOW 1024
 
 Int_t TSpectrum2::fgIterations    = 3;
@@ -838,9 +842,8 @@ const char *TSpectrum2::Deconvolution(Double_t **source, Double_t **resp,
                                        Int_t numberRepetitions,
                                        Double_t boost)
 {
-   Int_t i, j, lhx, lhy, i1, i2, j1, j2, k1, k2, lindex, i1min, i1max,
-       i2min, i2max, j1min, j1max, j2min, j2max, positx = 0, posity = 0, repet;
-   Double_t lda, ldb, ldc, area, maximum = 0;
+   Int_t i, j, lhx, lhy, i1, i2, lindex, i1min, i1max, i2min, i2max, positx = 0, posity = 0, repet;
+   Double_t lda, area, maximum = 0;
    if (ssizex <= 0 || ssizey <= 0)
       return "Wrong parameters";
    if (numberIterations <= 0)
@@ -876,55 +879,38 @@ const char *TSpectrum2::Deconvolution(Double_t **source, Double_t **resp,
       return ("Zero response data");
    }
 
+   using ROOT::Internal::Spectrum::DotProduct;
+   ROOT::Internal::Spectrum::RIndexExecutor executor;
+   const Double_t area2 = Double_t(ssizex) * ssizey;
+   const Double_t respArea = Double_t(lhx) * lhy;
+
 //calculate ht*y and write into p
-   for (i2 = 0; i2 < ssizey; i2++) {
-      for (i1 = 0; i1 < ssizex; i1++) {
-         ldc = 0;
-         for (j2 = 0; j2 <= (lhy - 1); j2++) {
-            for (j1 = 0; j1 <= (lhx - 1); j1++) {
-               k2 = i2 + j2, k1 = i1 + j1;
-               if (k2 >= 0 && k2 < ssizey && k1 >= 0 && k1 < ssizex) {
-                  lda = working_space[j1][j2];
-                  ldb = source[k1][k2];
-                  ldc = ldc + lda * ldb;
-               }
-            }
-         }
-         working_space[i1][i2 + ssizey] = ldc;
+   executor.ForEachIndex(ssizex, area2 * respArea, [&](Int_t ii1) {
+      const Int_t n1 = std::min(lhx, ssizex - ii1);
+      for (Int_t ii2 = 0; ii2 < ssizey; ii2++) {
+         const Int_t n2 = std::min(lhy, ssizey - ii2);
+         Double_t sum = 0;
+         for (Int_t jj1 = 0; jj1 < n1; jj1++)
+            sum += DotProduct(working_space[jj1], source[ii1 + jj1] + ii2, n2);
+         working_space[ii1][ii2 + ssizey] = sum;
       }
-   }
+   });
 
 //calculate matrix b=ht*h
    i1min = -(lhx - 1), i1max = lhx - 1;
    i2min = -(lhy - 1), i2max = lhy - 1;
-   for (i2 = i2min; i2 <= i2max; i2++) {
-      for (i1 = i1min; i1 <= i1max; i1++) {
-         ldc = 0;
-         j2min = -i2;
-         if (j2min < 0)
-            j2min = 0;
-         j2max = lhy - 1 - i2;
-         if (j2max > lhy - 1)
-            j2max = lhy - 1;
-         for (j2 = j2min; j2 <= j2max; j2++) {
-            j1min = -i1;
-            if (j1min < 0)
-               j1min = 0;
-            j1max = lhx - 1 - i1;
-            if (j1max > lhx - 1)
-               j1max = lhx - 1;
-            for (j1 = j1min; j1 <= j1max; j1++) {
-               lda = working_space[j1][j2];
-               if (i1 + j1 < ssizex && i2 + j2 < ssizey)
-                  ldb = working_space[i1 + j1][i2 + j2];
-               else
-                  ldb = 0;
-               ldc = ldc + lda * ldb;
-            }
-         }
-         working_space[i1 - i1min][i2 - i2min + 2 * ssizey ] = ldc;
+   executor.ForEachIndex(i1max - i1min + 1, 4 * respArea * respArea, [&](Int_t index) {
+      const Int_t ii1 = index + i1min;
+      const Int_t jj1min = std::max(0, -ii1), jj1max = std::min(lhx - 1, lhx - 1 - ii1);
+      for (Int_t ii2 = i2min; ii2 <= i2max; ii2++) {
+         const Int_t jj2min = std::max(0, -ii2), jj2max = std::min(lhy - 1, lhy - 1 - ii2);
+         Double_t sum = 0;
+         for (Int_t jj1 = jj1min; jj1 <= jj1max; jj1++)
+            sum += DotProduct(working_space[jj1] + jj2min, working_space[ii1 + jj1] + ii2 + jj2min,
+                              jj2max - jj2min + 1);
+         working_space[ii1 - i1min][ii2 - i2min + 2 * ssizey] = sum;
       }
-   }
+   });
 
 //initialization in x1 matrix
    for (i2 = 0; i2 < ssizey; i2++) {
@@ -945,46 +931,27 @@ const char *TSpectrum2::Deconvolution(Double_t **source, Double_t **resp,
          }
       }
       for (lindex = 0; lindex < numberIterations; lindex++) {
-         for (i2 = 0; i2 < ssizey; i2++) {
-            for (i1 = 0; i1 < ssizex; i1++) {
-               ldb = 0;
-               j2min = i2;
-               if (j2min > lhy - 1)
-                  j2min = lhy - 1;
-               j2min = -j2min;
-               j2max = ssizey - i2 - 1;
-               if (j2max > lhy - 1)
-                  j2max = lhy - 1;
-               j1min = i1;
-               if (j1min > lhx - 1)
-                  j1min = lhx - 1;
-               j1min = -j1min;
-               j1max = ssizex - i1 - 1;
-               if (j1max > lhx - 1)
-                  j1max = lhx - 1;
-               for (j2 = j2min; j2 <= j2max; j2++) {
-                  for (j1 = j1min; j1 <= j1max; j1++) {
-                     ldc =  working_space[j1 - i1min][j2 - i2min + 2 * ssizey];
-                     lda = working_space[i1 + j1][i2 + j2 + 3 * ssizey];
-                     ldb = ldb + lda * ldc;
-                  }
-               }
-               lda = working_space[i1][i2 + 3 * ssizey];
-               ldc = working_space[i1][i2 + 1 * ssizey];
-               if (ldc * lda != 0 && ldb != 0) {
-                  lda = lda * ldc / ldb;
-               }
-
+         // the points of an x row only depend on the previous iteration: the rows are computed in parallel
+         executor.ForEachIndex(ssizex, area2 * respArea, [&](Int_t ii1) {
+            const Int_t jj1min = -std::min(ii1, lhx - 1), jj1max = std::min(ssizex - ii1 - 1, lhx - 1);
+            for (Int_t ii2 = 0; ii2 < ssizey; ii2++) {
+               const Int_t jj2min = -std::min(ii2, lhy - 1), jj2max = std::min(ssizey - ii2 - 1, lhy - 1);
+               Double_t sum = 0;
+               // the y rows of b and of the current solution are contiguous
+               for (Int_t jj1 = jj1min; jj1 <= jj1max; jj1++)
+                  sum += DotProduct(working_space[jj1 - i1min] + jj2min - i2min + 2 * ssizey,
+                                    working_space[ii1 + jj1] + ii2 + jj2min + 3 * ssizey, jj2max - jj2min + 1);
+               Double_t x = working_space[ii1][ii2 + 3 * ssizey];
+               const Double_t p = working_space[ii1][ii2 + 1 * ssizey];
+               if (p * x != 0 && sum != 0)
+                  x = x * p / sum;
                else
-                  lda = 0;
-               working_space[i1][i2 + 4 * ssizey] = lda;
+                  x = 0;
+               working_space[ii1][ii2 + 4 * ssizey] = x;
             }
-         }
-         for (i2 = 0; i2 < ssizey; i2++) {
-            for (i1 = 0; i1 < ssizex; i1++)
-               working_space[i1][i2 + 3 * ssizey] =
-                   working_space[i1][i2 + 4 * ssizey];
-         }
+         });
+         for (i1 = 0; i1 < ssizex; i1++)
+            std::copy_n(working_space[i1] + 4 * ssizey, ssizey, working_space[i1] + 3 * ssizey);
       }
    }
    for (i = 0; i < ssizex; i++) {
@@ -50,6 +50,10 @@
 #include "TSpectrum3.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "SpectrumHelpers.h"
+
+#include <algorithm>
+
 #define PEAK_WINDOW 1024
 
 ClassImp(TSpectrum3);
@@ -1602,8 +1606,8 @@ const char *TSpectrum3::Deconvolution(Double_t***source, const Double_t***resp,
                                        Int_t numberRepetitions,
                                        Double_t boost)
 {
-   Int_t i, j, k, lhx, lhy, lhz, i1, i2, i3, j1, j2, j3, k1, k2, k3, lindex, i1min, i1max, i2min, i2max, i3min, i3max, j1min, j1max, j2min, j2max, j3min, j3max, positx = 0, posity = 0, positz = 0, repet;
-   Double_t lda, ldb, ldc, area, maximum = 0;
+   Int_t i, j, k, lhx, lhy, lhz, i1, i2, i3, lindex, i1min, i1max, i2min, i2max, i3min, i3max, positx = 0, posity = 0, positz = 0, repet;
+   Double_t lda, area, maximum = 0;
    if (ssizex <= 0 || ssizey <= 0 || ssizez <= 0)
       return "Wrong parameters";
    if (numberIterations <= 0)
@@ -1649,70 +1653,49 @@ const char *TSpectrum3::Deconvolution(Double_t***source, const Double_t***resp,
       return ("Zero response data");
    }
 
+   using ROOT::Internal::Spectrum::DotProduct;
+   ROOT::Internal::Spectrum::RIndexExecutor executor;
+   const Double_t volume = Double_t(ssizex) * ssizey * ssizez;
+   const Double_t respVolume = Double_t(lhx) * lhy * lhz;
+
 //calculate ht*y and write into p
-   for (i3 = 0; i3 < ssizez; i3++) {
-      for (i2 = 0; i2 < ssizey; i2++) {
-         for (i1 = 0; i1 < ssizex; i1++) {
-            ldc = 0;
-            for (j3 = 0; j3 <= (lhz - 1); j3++) {
-               for (j2 = 0; j2 <= (lhy - 1); j2++) {
-                  for (j1 = 0; j1 <= (lhx - 1); j1++) {
-                     k3 = i3 + j3, k2 = i2 + j2, k1 = i1 + j1;
-                     if (k3 >= 0 && k3 < ssizez && k2 >= 0 && k2 < ssizey && k1 >= 0 && k1 < ssizex) {
-                        lda = working_space[j1][j2][j3];
-                        ldb = source[k1][k2][k3];
-                        ldc = ldc + lda * ldb;
-                     }
-                  }
-               }
+   executor.ForEachIndex(ssizex, volume * respVolume, [&](Int_t ii1) {
+      const Int_t n1 = std::min(lhx, ssizex - ii1);
+      for (Int_t ii2 = 0; ii2 < ssizey; ii2++) {
+         const Int_t n2 = std::min(lhy, ssizey - ii2);
+         for (Int_t ii3 = 0; ii3 < ssizez; ii3++) {
+            const Int_t n3 = std::min(lhz, ssizez - ii3);
+            Double_t sum = 0;
+            for (Int_t jj1 = 0; jj1 < n1; jj1++) {
+               for (Int_t jj2 = 0; jj2 < n2; jj2++)
+                  sum += DotProduct(working_space[jj1][jj2], source[ii1 + jj1][ii2 + jj2] + ii3, n3);
             }
-            working_space[i1][i2][i3 + ssizez] = ldc;
+            working_space[ii1][ii2][ii3 + ssizez] = sum;
          }
       }
-   }
+   });
 
 //calculate matrix b=ht*h
    i1min = -(lhx - 1), i1max = lhx - 1;
    i2min = -(lhy - 1), i2max = lhy - 1;
    i3min = -(lhz - 1), i3max = lhz - 1;
-   for (i3 = i3min; i3 <= i3max; i3++) {
-      for (i2 = i2min; i2 <= i2max; i2++) {
-         for (i1 = i1min; i1 <= i1max; i1++) {
-            ldc = 0;
-            j3min = -i3;
-            if (j3min < 0)
-               j3min = 0;
-            j3max = lhz - 1 - i3;
-            if (j3max > lhz - 1)
-               j3max = lhz - 1;
-            for (j3 = j3min; j3 <= j3max; j3++) {
-               j2min = -i2;
-               if (j2min < 0)
-                  j2min = 0;
-               j2max = lhy - 1 - i2;
-               if (j2max > lhy - 1)
-                  j2max = lhy - 1;
-               for (j2 = j2min; j2 <= j2max; j2++) {
-                  j1min = -i1;
-                  if (j1min < 0)
-                     j1min = 0;
-                  j1max = lhx - 1 - i1;
-                  if (j1max > lhx - 1)
-                     j1max = lhx - 1;
-                  for (j1 = j1min; j1 <= j1max; j1++) {
-                     lda = working_space[j1][j2][j3];
-                     if (i1 + j1 < ssizex && i2 + j2 < ssizey)
-                        ldb = working_space[i1 + j1][i2 + j2][i3 + j3];
-                     else
-                        ldb = 0;
-                     ldc = ldc + lda * ldb;
-                  }
-               }
+   executor.ForEachIndex(i1max - i1min + 1, 8 * respVolume * respVolume, [&](Int_t index) {
+      const Int_t ii1 = index + i1min;
+      const Int_t jj1min = std::max(0, -ii1), jj1max = std::min(lhx - 1, lhx - 1 - ii1);
+      for (Int_t ii2 = i2min; ii2 <= i2max; ii2++) {
+         const Int_t jj2min = std::max(0, -ii2), jj2max = std::min(lhy - 1, lhy - 1 - ii2);
+         for (Int_t ii3 = i3min; ii3 <= i3max; ii3++) {
+            const Int_t jj3min = std::max(0, -ii3), jj3max = std::min(lhz - 1, lhz - 1 - ii3);
+            Double_t sum = 0;
+            for (Int_t jj1 = jj1min; jj1 <= jj1max; jj1++) {
+               for (Int_t jj2 = jj2min; jj2 <= jj2max; jj2++)
+                  sum += DotProduct(working_space[jj1][jj2] + jj3min,
+                                    working_space[ii1 + jj1][ii2 + jj2] + ii3 + jj3min, jj3max - jj3min + 1);
             }
-            working_space[i1 - i1min][i2 - i2min][i3 - i3min + 2 * ssizez ] = ldc;
+            working_space[ii1 - i1min][ii2 - i2min][ii3 - i3min + 2 * ssizez] = sum;
          }
       }
-   }
+   });
 
 //initialization in x1 matrix
    for (i3 = 0; i3 < ssizez; i3++) {
@@ -1736,57 +1719,35 @@ const char *TSpectrum3::Deconvolution(Double_t***source, const Double_t***resp,
          }
       }
       for (lindex = 0; lindex < numberIterations; lindex++) {
-         for (i3 = 0; i3 < ssizez; i3++) {
-            for (i2 = 0; i2 < ssizey; i2++) {
-               for (i1 = 0; i1 < ssizex; i1++) {
-                  ldb = 0;
-                  j3min = i3;
-                  if (j3min > lhz - 1)
-                     j3min = lhz - 1;
-                  j3min = -j3min;
-                  j3max = ssizez - i3 - 1;
-                  if (j3max > lhz - 1)
-                     j3max = lhz - 1;
-                  j2min = i2;
-                  if (j2min > lhy - 1)
-                     j2min = lhy - 1;
-                  j2min = -j2min;
-                  j2max = ssizey - i2 - 1;
-                  if (j2max > lhy - 1)
-                     j2max = lhy - 1;
-                  j1min = i1;
-                  if (j1min > lhx - 1)
-                     j1min = lhx - 1;
-                  j1min = -j1min;
-                  j1max = ssizex - i1 - 1;
-                  if (j1max > lhx - 1)
-                     j1max = lhx - 1;
-                  for (j3 = j3min; j3 <= j3max; j3++) {
-                     for (j2 = j2min; j2 <= j2max; j2++) {
-                        for (j1 = j1min; j1 <= j1max; j1++) {
-                           ldc =  working_space[j1 - i1min][j2 - i2min][j3 - i3min + 2 * ssizez];
-                           lda = working_space[i1 + j1][i2 + j2][i3 + j3 + 3 * ssizez];
-                           ldb = ldb + lda * ldc;
-                        }
+         // the points of an x plane only depend on the previous iteration: the planes are computed in parallel
+         executor.ForEachIndex(ssizex, volume * respVolume, [&](Int_t ii1) {
+            const Int_t jj1min = -std::min(ii1, lhx - 1), jj1max = std::min(ssizex - ii1 - 1, lhx - 1);
+            for (Int_t ii2 = 0; ii2 < ssizey; ii2++) {
+               const Int_t jj2min = -std::min(ii2, lhy - 1), jj2max = std::min(ssizey - ii2 - 1, lhy - 1);
+               for (Int_t ii3 = 0; ii3 < ssizez; ii3++) {
+                  const Int_t jj3min = -std::min(ii3, lhz - 1), jj3max = std::min(ssizez - ii3 - 1, lhz - 1);
+                  Double_t sum = 0;
+                  for (Int_t jj1 = jj1min; jj1 <= jj1max; jj1++) {
+                     for (Int_t jj2 = jj2min; jj2 <= jj2max; jj2++) {
+                        // the z rows of b and of the current solution are contiguous
+                        sum += DotProduct(working_space[jj1 - i1min][jj2 - i2min] + jj3min - i3min + 2 * ssizez,
+                                          working_space[ii1 + jj1][ii2 + jj2] + ii3 + jj3min + 3 * ssizez,
+                                          jj3max - jj3min + 1);
                      }
                   }
-                  lda = working_space[i1][i2][i3 + 3 * ssizez];
-                  ldc = working_space[i1][i2][i3 + 1 * ssizez];
-                  if (ldc * lda != 0 && ldb != 0) {
-                     lda = lda * ldc / ldb;
-                  }
-
+                  Double_t x = working_space[ii1][ii2][ii3 + 3 * ssizez];
+                  const Double_t p = working_space[ii1][ii2][ii3 + 1 * ssizez];
+                  if (p * x != 0 && sum != 0)
+                     x = x * p / sum;
                   else
-                     lda = 0;
-                  working_space[i1][i2][i3 + 4 * ssizez] = lda;
+                     x = 0;
+                  working_space[ii1][ii2][ii3 + 4 * ssizez] = x;
                }
             }
-         }
-         for (i3 = 0; i3 < ssizez; i3++) {
-            for (i2 = 0; i2 < ssizey; i2++) {
-               for (i1 = 0; i1 < ssizex; i1++)
-                  working_space[i1][i2][i3 + 3 * ssizez] = working_space[i1][i2][i3 + 4 * ssizez];
-            }
+         });
+         for (i1 = 0; i1 < ssizex; i1++) {
+            for (i2 = 0; i2 < ssizey; i2++)
+               std::copy_n(working_space[i1][i2] + 4 * ssizez, ssizez, working_space[i1][i2] + 3 * ssizez);
          }
       }
    }
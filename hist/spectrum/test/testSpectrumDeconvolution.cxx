@@ -0,0 +1,98 @@
+#include "TROOT.h"
+#include "TSpectrum2.h"
+#include "TSpectrum3.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+// The deconvolutions give bitwise identical results with and without implicit multi-threading. The sizes are chosen
+// so that the loops over the source are run in parallel.
+
+namespace {
+
+Double_t Gauss(Double_t x, Double_t sigma)
+{
+   return std::exp(-0.5 * x * x / (sigma * sigma));
+}
+
+/// Peaks on a flat background
+Double_t Source(Int_t i, Int_t j, Int_t k = 0)
+{
+   return 10 + 100 * Gauss(i - 20, 2) * Gauss(j - 30, 2) * Gauss(k - 10, 2) +
+          50 * Gauss(i - 45, 3) * Gauss(j - 12, 2) * Gauss(k - 20, 3) + (i * 7 + j * 3 + k) % 5;
+}
+
+std::vector<Double_t> Deconvolution2(Int_t size, Int_t lh)
+{
+   std::vector<std::vector<Double_t>> source(size, std::vector<Double_t>(size));
+   std::vector<std::vector<Double_t>> resp(size, std::vector<Double_t>(size));
+   std::vector<Double_t *> sourceRows, respRows;
+   for (Int_t i = 0; i < size; ++i) {
+      for (Int_t j = 0; j < size; ++j) {
+         source[i][j] = Source(i, j);
+         resp[i][j] = (i < lh && j < lh) ? Gauss(i, 2) * Gauss(j, 2) : 0;
+      }
+      sourceRows.push_back(source[i].data());
+      respRows.push_back(resp[i].data());
+   }
+   TSpectrum2 spectrum;
+   EXPECT_EQ(nullptr, spectrum.Deconvolution(sourceRows.data(), respRows.data(), size, size, 20, 2, 1.1));
+
+   std::vector<Double_t> result;
+   for (Int_t i = 0; i < size; ++i)
+      result.insert(result.end(), source[i].begin(), source[i].end());
+   return result;
+}
+
+std::vector<Double_t> Deconvolution3(Int_t size, Int_t lh)
+{
+   using Plane_t = std::vector<std::vector<Double_t>>;
+   std::vector<Plane_t> source(size, Plane_t(size, std::vector<Double_t>(size)));
+   auto resp = source;
+   std::vector<std::vector<Double_t *>> sourceRows(size), respRows(size);
+   std::vector<Double_t **> sourcePlanes, respPlanes;
+   for (Int_t i = 0; i < size; ++i) {
+      for (Int_t j = 0; j < size; ++j) {
+         for (Int_t k = 0; k < size; ++k) {
+            source[i][j][k] = Source(i, j, k);
+            resp[i][j][k] = (i < lh && j < lh && k < lh) ? Gauss(i, 1) * Gauss(j, 1) * Gauss(k, 1) : 0;
+         }
+         sourceRows[i].push_back(source[i][j].data());
+         respRows[i].push_back(resp[i][j].data());
+      }
+      sourcePlanes.push_back(sourceRows[i].data());
+      respPlanes.push_back(respRows[i].data());
+   }
+   TSpectrum3 spectrum;
+   EXPECT_EQ(nullptr, spectrum.Deconvolution(sourcePlanes.data(), const_cast<const Double_t ***>(respPlanes.data()),
+                                             size, size, size, 10, 2, 1.1));
+
+   std::vector<Double_t> result;
+   for (Int_t i = 0; i < size; ++i)
+      for (Int_t j = 0; j < size; ++j)
+         result.insert(result.end(), source[i][j].begin(), source[i][j].end());
+   return result;
+}
+
+} // namespace
+
+TEST(SpectrumDeconvolution, IMT)
+{
+   ASSERT_FALSE(ROOT::IsImplicitMTEnabled());
+   const auto ref2 = Deconvolution2(128, 9);
+   const auto ref3 = Deconvolution3(32, 5);
+
+   ROOT::EnableImplicitMT(4);
+   const auto imt2 = Deconvolution2(128, 9);
+   const auto imt3 = Deconvolution3(32, 5);
+   ROOT::DisableImplicitMT();
+
+   ASSERT_EQ(ref2.size(), imt2.size());
+   for (std::size_t i = 0; i < ref2.size(); ++i)
+      ASSERT_EQ(ref2[i], imt2[i]) << "2D bin " << i;
+   ASSERT_EQ(ref3.size(), imt3.size());
+   for (std::size_t i = 0; i < ref3.size(); ++i)
+      ASSERT_EQ(ref3[i], imt3[i]) << "3D bin " << i;
+}
@@ -0,0 +1,148 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RFileWriteEngine
+#define ROOT_RFileWriteEngine
+
+#include <RConfigure.h> // R__HAS_URING
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace ROOT {
+namespace Internal {
+
+class RIoUring;
+
+/**
+ * \class RFileWriteEngine RFileWriteEngine.hxx
+ * \ingroup IO
+ *
+ * Gathers the writes to a local file in two large, page-aligned buffers. Contiguous writes are copied into the
+ * current buffer; a full buffer is written to the file on a background thread, or with io_uring, while the other
+ * buffer is filled. A write at a different position, Flush() and reading back data that did not reach the file yet
+ * end the current buffer.
+ *
+ * With direct I/O, the engine opens the file a second time with O_DIRECT (Linux only) and writes the aligned part of
+ * the buffers through it, so that bulk data does not go through the page cache. The buffers always start at an
+ * aligned file position: if necessary, the preceding bytes are read back from the file. The unaligned tail of a
+ * buffer is written through the file descriptor given to the constructor.
+ *
+ * The engine does not own that file descriptor, nor move its file position; every write is positional. Errors throw
+ * std::runtime_error, for errors of the background writes in the next call that waits for them.
+ */
+class RFileWriteEngine {
+public:
+   struct ROptions {
+      /// Size of each of the two buffers, rounded up to a multiple of the alignment
+      std::size_t fBufferSize = 8 * 1024 * 1024;
+      /// If false, full buffers are written synchronously
+      bool fAsync = true;
+      /// Bypass the page cache with O_DIRECT for the aligned part of the data, where supported
+      bool fDirectIO = false;
+      /// Write the buffers with io_uring instead of a background thread, if ROOT is built with io_uring support
+      bool fUseIoUring = false;
+      /// Sync the data to storage whenever this many bytes have been written since the last sync; zero never syncs
+      std::uint64_t fSyncInterval = 0;
+      /// After each sync, advise the kernel to drop the file from the page cache
+      bool fDropPageCache = false;
+   };
+
+   /// File positions and sizes of direct I/O are multiples of this
+   static constexpr std::size_t kAlignment = 4096;
+
+private:
+   struct RFreeAligned {
+      void operator()(unsigned char *ptr) const;
+   };
+
+   /// Contiguous data to be written at fOffset
+   struct RBlock {
+      std::unique_ptr<unsigned char[], RFreeAligned> fData;
+      std::uint64_t fOffset = 0; ///< File position of fData[0]
+      std::size_t fSize = 0;     ///< Bytes used in fData, including fHead; zero if the block is free
+      std::size_t fHead = 0;     ///< Leading bytes read back from the file to align fOffset for direct I/O
+   };
+
+   /// A write of part of a block to one of the file descriptors
+   struct RPendingWrite {
+      int fFileDes = -1;
+      const unsigned char *fData = nullptr;
+      std::size_t fSize = 0;
+      std::uint64_t fOffset = 0;
+   };
+
+   ROptions fOptions;
+   int fFileDes;            ///< Not owned
+   int fDirectFileDes = -1; ///< Opened with O_DIRECT; -1 if direct I/O is not used
+   RBlock fBlocks[2];
+   int fCurrent = 0;                  ///< The block being filled; the other one may be in flight
+   std::uint64_t fBytesWritten = 0;   ///< Bytes passed to Write()
+   std::uint64_t fBytesSinceSync = 0; ///< Bytes written to the file since the last sync
+
+   std::thread fWorker;
+   std::mutex fMutex;
+   std::condition_variable fCv;
+   RBlock *fInFlight = nullptr; ///< Protected by fMutex
+   bool fStop = false;          ///< Protected by fMutex
+   std::exception_ptr fError;   ///< Protected by fMutex
+
+#ifdef R__HAS_URING
+   std::unique_ptr<RIoUring> fRing;
+   RPendingWrite fRingWrites[2];
+   unsigned int fNRingWrites = 0;
+#endif
+
+   /// Split the block into its direct and buffered writes; returns the number of writes
+   unsigned int GetWrites(const RBlock &block, RPendingWrite *writes) const;
+   void DoWrite(const RPendingWrite &write);
+   /// Free the written block and sync if the sync interval is reached
+   void FinishBlock(RBlock &block);
+   /// Write the block to the file and free it
+   void WriteBlock(RBlock &block);
+   void Sync();
+   /// Start writing the given block; waits for the block in flight, if any
+   void Submit(RBlock &block);
+   /// Wait for the block in flight, if any, and rethrow its error
+   void WaitInFlight();
+   /// Make the current block start at the given file position
+   void StartBlock(std::uint64_t offset);
+   /// Loop of the background thread
+   void Work();
+
+public:
+   RFileWriteEngine(int fileDes, const ROptions &options);
+   RFileWriteEngine(const RFileWriteEngine &) = delete;
+   RFileWriteEngine &operator=(const RFileWriteEngine &) = delete;
+   /// Writes the remaining data; errors are reported but not thrown
+   ~RFileWriteEngine();
+
+   /// Write nbytes at the given file position
+   void Write(const void *buffer, std::size_t nbytes, std::uint64_t offset);
+   /// Copy the given range to buffer if it is entirely in the current block and return true. Otherwise, make sure
+   /// that all data written so far reached the file and return false.
+   bool ReadBack(void *buffer, std::size_t nbytes, std::uint64_t offset);
+   /// Write all buffered data to the file and wait for the writes to complete
+   void Flush();
+
+   std::uint64_t GetBytesWritten() const { return fBytesWritten; }
+   bool IsDirectIO() const { return fDirectFileDes >= 0; }
+   bool IsAsync() const { return fOptions.fAsync; }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
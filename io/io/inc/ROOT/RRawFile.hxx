@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -52,7 +53,7 @@ public:
    static constexpr int kFeatureHasSize = 0x01;
    /// Map() and Unmap() are implemented
    static constexpr int kFeatureHasMmap = 0x02;
-   /// File supports async IO
+   /// File supports async IO: ReadVAsync() returns before the data is read and several reads can be in flight
    static constexpr int kFeatureHasAsyncIo = 0x04;
 
    /// On construction, an ROptions parameter can customize the RRawFile behavior
@@ -137,6 +138,9 @@ protected:
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// By default, reads synchronously with ReadVImpl() and returns a ready future. Derived classes that set
+   /// kFeatureHasAsyncIo override it to issue the read without waiting; they must support concurrent calls.
+   virtual std::future<void> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq);
 
 public:
    RRawFile(std::string_view url, ROptions options);
@@ -172,6 +176,9 @@ public:
 
    /// Opens the file if necessary and calls ReadVImpl
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Opens the file if necessary and starts a vector read with ReadVAsyncImpl. The buffers of ioVec and the file
+   /// object must remain valid until the returned future is ready; its get() rethrows read errors.
+   std::future<void> ReadVAsync(RIOVec *ioVec, unsigned int nReq);
 
    /// Memory mapping according to POSIX standard; in particular, new mappings of the same range replace older ones.
    /// Mappings need to be aligned at page boundaries, therefore the real offset can be smaller than the desired value.
@@ -0,0 +1,150 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RRawFileCached
+#define ROOT_RRawFileCached
+
+#include <ROOT/RRawFile.hxx>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ * \class RRawFileBlockCache RRawFileCached.hxx
+ * \ingroup IO
+ *
+ * A thread-safe cache of fixed-size, aligned blocks of files, keyed by the file URL and the block index. It is
+ * shared by the RRawFileCached objects that use it, typically all of them in the process (see GetGlobal()), so that
+ * concurrent readers of the same file on a node read each block from storage only once.
+ *
+ * Blocks are evicted in least-recently-used order once the blocks in memory exceed the memory capacity. If a disk
+ * directory is set, e.g. on a local SSD, evicted blocks are kept in files in that directory, again up to a capacity
+ * and with LRU eviction; blocks found on disk are brought back to memory. The cache assumes that the files do not
+ * change while it is in use. The block files are removed when the cache is destructed.
+ */
+class RRawFileBlockCache {
+public:
+   struct ROptions {
+      /// Files are cached in blocks of this size, starting at multiples of it
+      std::size_t fBlockSize = 1024 * 1024;
+      /// The maximum number of bytes of the blocks in memory
+      std::uint64_t fMemoryCapacity = 256 * 1024 * 1024;
+      /// If not empty, blocks evicted from memory are kept in files in this directory
+      std::string fDiskDirectory;
+      /// The maximum number of bytes of the blocks on disk
+      std::uint64_t fDiskCapacity = 0;
+   };
+
+   struct RStatistics {
+      std::uint64_t fNHits = 0;     ///< Blocks found in memory
+      std::uint64_t fNDiskHits = 0; ///< Blocks found on disk
+      std::uint64_t fNMisses = 0;   ///< Blocks not found
+      std::uint64_t fNEvictions = 0;
+      std::uint64_t fNDiskEvictions = 0;
+      std::uint64_t fNBytesInMemory = 0;
+      std::uint64_t fNBytesOnDisk = 0;
+   };
+
+   /// The content of a block; smaller than the block size for the last block of a file
+   using Block_t = std::shared_ptr<const std::vector<unsigned char>>;
+
+private:
+   struct RKey {
+      std::string fUrl;
+      std::uint64_t fBlockIdx;
+      bool operator==(const RKey &other) const { return fBlockIdx == other.fBlockIdx && fUrl == other.fUrl; }
+   };
+   struct RKeyHash {
+      std::size_t operator()(const RKey &key) const;
+   };
+   struct REntry {
+      RKey fKey;
+      Block_t fBlock;
+   };
+   struct RDiskEntry {
+      RKey fKey;
+      std::string fPath;
+      std::size_t fSize;
+   };
+
+   ROptions fOptions;
+   mutable std::mutex fMutex;
+   /// Most recently used first
+   std::list<REntry> fEntries;
+   std::unordered_map<RKey, std::list<REntry>::iterator, RKeyHash> fIndex;
+   std::list<RDiskEntry> fDiskEntries;
+   std::unordered_map<RKey, std::list<RDiskEntry>::iterator, RKeyHash> fDiskIndex;
+   RStatistics fStats;
+   /// The block files are named by this prefix, which contains the process id, and a counter
+   std::string fDiskFilePrefix;
+   std::atomic<std::uint64_t> fNDiskFiles{0};
+
+   /// Called without holding the lock
+   void WriteToDisk(std::vector<REntry> &entries);
+
+public:
+   explicit RRawFileBlockCache(const ROptions &options);
+   RRawFileBlockCache(const RRawFileBlockCache &) = delete;
+   RRawFileBlockCache &operator=(const RRawFileBlockCache &) = delete;
+   ~RRawFileBlockCache();
+
+   /// The process-wide cache, configured by the RRawFile.BlockCache settings of gEnv on first use
+   static std::shared_ptr<RRawFileBlockCache> GetGlobal();
+
+   std::size_t GetBlockSize() const { return fOptions.fBlockSize; }
+   /// Returns nullptr if the block is neither in memory nor on disk
+   Block_t Get(const std::string &url, std::uint64_t blockIdx);
+   void Put(const std::string &url, std::uint64_t blockIdx, Block_t block);
+   RStatistics GetStatistics() const;
+   /// Removes all blocks, in memory and on disk
+   void Clear();
+};
+
+/**
+ * \class RRawFileCached RRawFileCached.hxx
+ * \ingroup IO
+ *
+ * An RRawFile that reads another RRawFile through an RRawFileBlockCache. All reads, including vector reads, are
+ * served block-wise from the cache; the missing blocks of a request are read from the wrapped file in a single vector
+ * read. The RRawFile's own buffering is turned off since the cache takes its role.
+ */
+class RRawFileCached : public RRawFile {
+private:
+   std::unique_ptr<RRawFile> fFile;
+   std::shared_ptr<RRawFileBlockCache> fCache;
+
+protected:
+   void OpenImpl() final;
+   size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
+   void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::uint64_t GetSizeImpl() final;
+
+public:
+   explicit RRawFileCached(std::unique_ptr<RRawFile> file,
+                           std::shared_ptr<RRawFileBlockCache> cache = RRawFileBlockCache::GetGlobal());
+   std::unique_ptr<RRawFile> Clone() const final;
+   int GetFeatures() const final { return fFile->GetFeatures() & kFeatureHasSize; }
+   RRawFileBlockCache &GetCache() const { return *fCache; }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
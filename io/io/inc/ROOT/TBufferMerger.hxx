@@ -15,10 +15,11 @@
 #include "TFileMerger.h"
 #include "TMemFile.h"
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <vector>
 
 namespace ROOT {
 
@@ -35,6 +36,12 @@ class TBufferMergerFile;
  * socket, TBufferMerger uses threads that each write to a
  * TBufferMergerFile, which in turn push data into a queue
  * managed by the TBufferMerger.
+ *
+ * The baskets are compressed by the threads writing to the
+ * TBufferMergerFiles, which also deserialize the resulting
+ * in-memory files before pushing them onto a lock-free queue.
+ * The thread that merges the queue only copies the compressed
+ * baskets into the output file and updates the TTree metadata.
  */
 
 class TBufferMerger {
@@ -154,16 +161,23 @@ private:
    void MergeImpl();
 
    void Merge();
-   void Push(TBufferFile *buffer);
+   void Push(TMemFile *memfile, size_t size);
    bool TryMerge(TBufferMergerFile *memfile);
 
+   /** Node of the intrusive multiple-producer single-consumer queue of files to merge */
+   struct RQueueNode {
+      TMemFile *fFile;
+      size_t fSize;
+      RQueueNode *fNext;
+   };
+
    bool fCompressTemporaryKeys{false};                           //< Enable compression of the TKeys in the TMemFile (save memory at the expense of time, end result is unchanged)
    size_t fAutoSave{0};                                          //< AutoSave only every fAutoSave bytes
    std::atomic<size_t> fBuffered{0};                             //< Number of bytes currently buffered
    TFileMerger fMerger{false, false};                            //< TFileMerger used to merge all buffers
    std::mutex fMergeMutex;                                       //< Mutex used to lock fMerger
-   mutable std::mutex fQueueMutex;                               //< Mutex used to lock fQueue
-   std::queue<TBufferFile *> fQueue;                             //< Queue to which data is pushed and merged
+   std::atomic<RQueueNode *> fQueue{nullptr};                    //< Most recently pushed node of the queue
+   std::atomic<size_t> fQueueSize{0};                            //< Number of files in the queue
    std::vector<std::weak_ptr<TBufferMergerFile>> fAttachedFiles; //< Attached files
 };
 
@@ -16,6 +16,7 @@
 #include "TString.h"
 
 #include <deque>
+#include <iosfwd>
 #include <memory>
 #include <string>
 #include <vector>
@@ -58,6 +59,7 @@ public:
    Bool_t IsSkipClassInfo(const TClass *cl) const;
 
    TString StoreObject(const void *obj, const TClass *cl);
+   Long64_t StoreObject(std::ostream &out, const void *obj, const TClass *cl);
    void *RestoreObject(const char *str, TClass **cl);
 
    static TString ConvertToJSON(const TObject *obj, Int_t compact = 0, const char *member_name = nullptr);
@@ -67,6 +69,7 @@ public:
 
    static Int_t ExportToFile(const char *filename, const TObject *obj, const char *option = nullptr);
    static Int_t ExportToFile(const char *filename, const void *obj, const TClass *cl, const char *option = nullptr);
+   static Long64_t ExportToStream(std::ostream &out, const void *obj, const TClass *cl, Int_t compact = 0);
 
    static TObject *ConvertFromJSON(const char *str);
    static void *ConvertFromJSONAny(const char *str, TClass **cl = nullptr);
@@ -296,11 +299,16 @@ protected:
 
    void AppendOutput(const char *line0, const char *line1 = nullptr);
 
+   void FlushOutput();
+
    void JsonPushValue();
 
    template <typename T>
    R__ALWAYS_INLINE void JsonWriteArrayCompress(const T *vname, Int_t arrsize, const char *typname);
 
+   template <typename T>
+   R__ALWAYS_INLINE void JsonWriteInteger(T value);
+
    template <typename T>
    R__ALWAYS_INLINE void JsonReadBasic(T &value);
 
@@ -314,6 +322,8 @@ protected:
    R__ALWAYS_INLINE void JsonWriteFastArray(const T *arr, Int_t arrsize, const char *typname,
                                             void (TBufferJSON::*method)(const T *, Int_t, const char *));
 
+   static constexpr Int_t kSinkChunkSize = 64 * 1024; ///<!  output buffer size passed at once to the stream
+
    TString fOutBuffer;                 ///<!  main output buffer for json code
    TString *fOutput{nullptr};          ///<!  current output buffer for json code
    TString fValue;                     ///<!  buffer for current value
@@ -328,6 +338,8 @@ protected:
    TString fTypeNameTag;               ///<! JSON member used for storing class name, when empty - no class name will be stored
    TString fTypeVersionTag;            ///<! JSON member used to store class version, default empty
    std::vector<const TClass *> fSkipClasses; ///<! list of classes, which class info is not stored
+   std::ostream *fSink{nullptr};       ///<!  stream where the main output buffer is flushed, see StoreObject(std::ostream &, ...)
+   Long64_t fSinkBytes{0};             ///<!  number of bytes written into the stream
 
    ClassDefOverride(TBufferJSON, 0) // a specialized TBuffer to only write objects into JSON format
 };
@@ -26,9 +26,17 @@
 #include "TDatime.h"
 #include "TList.h"
 
+#include <memory>
+
 class TKey;
 class TFile;
 
+namespace ROOT {
+namespace Internal {
+struct RKeysRecord;
+}
+}
+
 class TDirectoryFile : public TDirectory {
 
 protected:
@@ -44,15 +52,22 @@ protected:
    Long64_t    fSeekKeys{0};             ///< Location of Keys record on file
    TFile      *fFile{nullptr};           ///< Pointer to current file in memory
    TList      *fKeys{nullptr};           ///< Pointer to keys list in memory
+   /// Keys record of a directory read from a file, as long as not all of its keys are in fKeys
+   mutable std::unique_ptr<ROOT::Internal::RKeysRecord> fKeysRecord; //!
 
    void        CleanTargets();
    void        InitDirectoryFile(TClass *cl = nullptr);
    void        BuildDirectoryFile(TFile* motherFile, TDirectory* motherDir);
+   void        DeferReadKeys();
 
 private:
    TDirectoryFile(const TDirectoryFile &directory) = delete;  //Directories cannot be copied
    void operator=(const TDirectoryFile &) = delete; //Directories cannot be copied
 
+   void        ReadKeysRecord() const;
+   void        LoadKeys() const;
+   void        LoadKeys(const char *name) const;
+
 public:
    // TDirectory status bits
    enum EStatusBits { kCloseDirectory = BIT(7) }; // Unused in ROOT, never set. Maybe only in external code.
@@ -91,10 +106,10 @@ public:
    const TDatime      &GetCreationDate() const { return fDatimeC; }
            TFile      *GetFile() const override { return fFile; }
            TKey       *GetKey(const char *name, Short_t cycle=9999) const override;
-           TList      *GetListOfKeys() const override { return fKeys; }
+           TList      *GetListOfKeys() const override;
    const TDatime      &GetModificationDate() const { return fDatimeM; }
            Int_t       GetNbytesKeys() const override { return fNbytesKeys; }
-           Int_t       GetNkeys() const override { return fKeys->GetSize(); }
+           Int_t       GetNkeys() const override;
            Long64_t    GetSeekDir() const override { return fSeekDir; }
            Long64_t    GetSeekParent() const override { return fSeekParent; }
            Long64_t    GetSeekKeys() const override { return fSeekKeys; }
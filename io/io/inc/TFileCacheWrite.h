@@ -14,8 +14,16 @@
 
 #include "TObject.h"
 
+#include <memory>
+
 class TFile;
 
+namespace ROOT {
+namespace Internal {
+class RFileWriteEngine;
+}
+} // namespace ROOT
+
 class TFileCacheWrite : public TObject {
 
 protected:
@@ -25,6 +33,7 @@ protected:
    TFile        *fFile;           ///< Pointer to file
    char         *fBuffer;         ///< [fBufferSize] buffer of contiguous prefetched blocks
    Bool_t        fRecursive;      ///< flag to avoid recursive calls
+   std::unique_ptr<ROOT::Internal::RFileWriteEngine> fEngine; ///<! Aligned, double-buffered writes to a local file
 
 private:
    TFileCacheWrite(const TFileCacheWrite &) = delete;            //cannot be copied
@@ -33,9 +42,11 @@ private:
 public:
    TFileCacheWrite();
    TFileCacheWrite(TFile *file, Int_t buffersize);
+   TFileCacheWrite(TFile *file, std::unique_ptr<ROOT::Internal::RFileWriteEngine> engine);
    ~TFileCacheWrite() override;
    virtual Bool_t      Flush();
    virtual Int_t       GetBytesInCache() const { return fNtot; }
+           Long64_t    GetEngineBytesWritten() const;
            void        Print(Option_t *option="") const override;
    virtual Int_t       ReadBuffer(char *buf, Long64_t pos, Int_t len);
    virtual Int_t       WriteBuffer(const char *buf, Long64_t pos, Int_t len);
@@ -47,6 +47,10 @@ protected:
    TString        fMergeOptions;              ///< Options (in string format) to be passed down to the Merge functions
    TIOFeatures   *fIOFeatures{nullptr};       ///< IO features to use in the output file.
    TString        fMsgPrefix{"TFileMerger"};  ///< Prefix to be used when printing informational message (default TFileMerger)
+   Int_t          fNThreads{0};               ///< Number of threads reading the inputs and writing the output, 0 or 1 for none (default 0)
+   Int_t          fNPrefetch{0};              ///< Number of excess files opened in the background while the current ones are merged (default 0)
+   Long64_t       fMaxMemory{0};              ///< Resident memory (bytes) above which the merged objects are flushed to the output between two sets of files, 0 for no limit
+   Bool_t         fReport{kFALSE};            ///< Print, for each merged object, the merge method used and the throughput (default kFALSE)
 
    Int_t          fMaxOpenedFiles;            ///< Maximum number of files opened at the same time by the TFileMerger
    Bool_t         fLocal;                     ///< Makes local copies of merging files if True (default is kTRUE)
@@ -94,6 +98,14 @@ public:
    void        SetMaxOpenedFiles(Int_t newmax);
    const char *GetMsgPrefix() const { return fMsgPrefix; }
    void        SetMsgPrefix(const char *prefix);
+   Int_t       GetNThreads() const { return fNThreads; }
+   void        SetNThreads(Int_t nthreads) { fNThreads = nthreads; }
+   Int_t       GetPrefetchFiles() const { return fNPrefetch; }
+   void        SetPrefetchFiles(Int_t nfiles) { fNPrefetch = nfiles; }
+   Long64_t    GetMaxMemory() const { return fMaxMemory; }
+   void        SetMaxMemory(Long64_t bytes) { fMaxMemory = bytes; }
+   Bool_t      GetReport() const { return fReport; }
+   void        SetReport(Bool_t report = kTRUE) { fReport = report; }
    const char *GetMergeOptions() { return fMergeOptions; }
    void        SetMergeOptions(const TString &options) { fMergeOptions = options; }
    void        SetMergeOptions(const std::string_view &options) { fMergeOptions = options; }
@@ -124,7 +136,7 @@ public:
    virtual void   SetNotrees(Bool_t notrees=kFALSE) {fNoTrees = notrees;}
            void   RecursiveRemove(TObject *obj) override;
 
-   ClassDefOverride(TFileMerger, 6)  // File copying and merging services
+   ClassDefOverride(TFileMerger, 9)  // File copying and merging services
 };
 
 #endif
@@ -18,6 +18,8 @@
 
 #include "TObject.h"
 
+#include <atomic>
+
 class TDirectory;
 class TList;
 class TMapRec;
@@ -105,10 +107,12 @@ public:
 
    void          Add(const TObject *obj, const char *name = "");
    void          Update(TObject *obj = nullptr);
+   void          UpdateArray(TObject *obj);
    TObject      *Remove(TObject *obj) { return Remove(obj, kTRUE); }
    TObject      *Remove(const char *name) { return Remove(name, kTRUE); }
    void          RemoveAll();
    TObject      *Get(const char *name, TObject *retObj = nullptr);
+   Bool_t        GetArray(const char *name, TObject *obj) const;
 
    static TMapFile *Create(const char *name, Option_t *option="READ", Int_t size=kDefaultMapSize, const char *title="");
    static TMapFile *WhichMapFile(void *addr);
@@ -140,6 +144,9 @@ private:
    void            *fBuffer;     ///< Buffer containing object of class name
    Int_t            fBufSize;    ///< Buffer size
    TMapRec         *fNext;       ///< Next MapRec in list
+   void            *fArray;      ///<! Copy of the content of the TArray the object derives from, see TMapFile::UpdateArray()
+   Int_t            fArraySize;  ///<! Size of fArray in bytes, 0 if its content is no longer published
+   std::atomic<UInt_t> fArraySeq; ///<! Sequence number of fArray, odd while the content is being updated
 
    TMapRec(const TMapRec&) = delete;
    TMapRec &operator=(const TMapRec&) = delete;
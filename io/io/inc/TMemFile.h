@@ -47,6 +47,7 @@ protected:
    TMemBlock    fBlockList;               ///< Collection of memory blocks of size fgDefaultBlockSize
    ExternalDataPtr_t fExternalData;       ///< shared file data / content
    Bool_t       fIsOwnedByROOT{kFALSE};   ///< if this is a C-style memory region
+   Bool_t       fIsCopyOnWrite{kFALSE};   ///< if the external data is copied when the file is first written to
    Long64_t     fSize{0};                 ///< Total file size (sum of the size of the chunks)
    Long64_t     fSysOffset{0};            ///< Seek offset in file
    TMemBlock   *fBlockSeek{nullptr};      ///< Pointer to the block we seeked to.
@@ -58,6 +59,7 @@ protected:
    Bool_t IsExternalData() const { return !fIsOwnedByROOT; }
 
    Long64_t MemRead(Int_t fd, void *buf, Long64_t len) const;
+   void     CopyExternalData();
 
    // Overload TFile interfaces.
    Int_t    SysOpen(const char *pathname, Int_t flags, UInt_t mode) override;
@@ -91,16 +93,19 @@ public:
             Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault, Long64_t defBlockSize = 0LL);
    TMemFile(const char *name, char *buffer, Long64_t size, Option_t *option = "", const char *ftitle = "",
             Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault, Long64_t defBlockSize = 0LL);
-   TMemFile(const char *name, ExternalDataPtr_t data);
-   TMemFile(const char *name, const ZeroCopyView_t &datarange);
+   TMemFile(const char *name, ExternalDataPtr_t data, Option_t *option = "READ");
+   TMemFile(const char *name, const ZeroCopyView_t &datarange, Option_t *option = "READ");
    TMemFile(const char *name, std::unique_ptr<TBufferFile> buffer);
    TMemFile(const TMemFile &orig);
    ~TMemFile() override;
 
    virtual Long64_t CopyTo(void *to, Long64_t maxsize) const;
    virtual void     CopyTo(TBuffer &tobuf) const;
+           std::vector<ZeroCopyView_t> GetBlocks() const;
            Long64_t GetSize() const override;
 
+           void Close(Option_t *option = "") override;
+
            void ResetAfterMerge(TFileMergeInfo *) override;
            void ResetErrno() const override;
 
@@ -0,0 +1,420 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RFileWriteEngine.hxx"
+#ifdef R__HAS_URING
+#include "ROOT/RIoUring.hxx"
+#endif
+
+#include "ROOT/RConfig.hxx"
+#include "TError.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+unsigned char *AllocAligned(std::size_t size)
+{
+   void *ptr = nullptr;
+#ifdef _WIN32
+   ptr = _aligned_malloc(size, ROOT::Internal::RFileWriteEngine::kAlignment);
+   if (!ptr)
+      throw std::bad_alloc();
+#else
+   if (posix_memalign(&ptr, ROOT::Internal::RFileWriteEngine::kAlignment, size) != 0)
+      throw std::bad_alloc();
+#endif
+   return static_cast<unsigned char *>(ptr);
+}
+
+/// Write size bytes at offset, returning 0 or the errno of the failed write
+int WriteAt(int fileDes, const unsigned char *data, std::size_t size, std::uint64_t offset)
+{
+#ifdef _WIN32
+   // No positional writes: restore the file position that the caller relies on
+   const auto position = _lseeki64(fileDes, 0, SEEK_CUR);
+   if (_lseeki64(fileDes, offset, SEEK_SET) < 0)
+      return errno;
+#endif
+   while (size > 0) {
+#ifdef _WIN32
+      const auto n = _write(fileDes, data, static_cast<unsigned int>(std::min<std::size_t>(size, 1 << 30)));
+#elif defined(R__SEEK64)
+      const auto n = pwrite64(fileDes, data, size, offset);
+#else
+      const auto n = pwrite(fileDes, data, size, offset);
+#endif
+      if (n < 0) {
+         if (errno == EINTR)
+            continue;
+         return errno;
+      }
+      data += n;
+      size -= n;
+      offset += n;
+   }
+#ifdef _WIN32
+   _lseeki64(fileDes, position, SEEK_SET);
+#endif
+   return 0;
+}
+
+/// Read up to size bytes at offset; returns the number of bytes read, which is smaller than size at the end of file
+std::size_t ReadAt(int fileDes, unsigned char *data, std::size_t size, std::uint64_t offset)
+{
+#ifdef _WIN32
+   const auto position = _lseeki64(fileDes, 0, SEEK_CUR);
+   _lseeki64(fileDes, offset, SEEK_SET);
+#endif
+   std::size_t nread = 0;
+   while (nread < size) {
+#ifdef _WIN32
+      const auto n = _read(fileDes, data + nread, static_cast<unsigned int>(size - nread));
+#elif defined(R__SEEK64)
+      const auto n = pread64(fileDes, data + nread, size - nread, offset + nread);
+#else
+      const auto n = pread(fileDes, data + nread, size - nread, offset + nread);
+#endif
+      if (n < 0 && errno == EINTR)
+         continue;
+      if (n < 0)
+         throw std::runtime_error(std::string("RFileWriteEngine: cannot read from file: ") + std::strerror(errno));
+      if (n == 0)
+         break;
+      nread += n;
+   }
+#ifdef _WIN32
+   _lseeki64(fileDes, position, SEEK_SET);
+#endif
+   return nread;
+}
+
+} // anonymous namespace
+
+void ROOT::Internal::RFileWriteEngine::RFreeAligned::operator()(unsigned char *ptr) const
+{
+#ifdef _WIN32
+   _aligned_free(ptr);
+#else
+   free(ptr);
+#endif
+}
+
+ROOT::Internal::RFileWriteEngine::RFileWriteEngine(int fileDes, const ROptions &options)
+   : fOptions(options), fFileDes(fileDes)
+{
+   fOptions.fBufferSize = std::max(fOptions.fBufferSize, kAlignment);
+   fOptions.fBufferSize = (fOptions.fBufferSize + kAlignment - 1) / kAlignment * kAlignment;
+   for (auto &block : fBlocks)
+      block.fData.reset(AllocAligned(fOptions.fBufferSize));
+
+#if defined(__linux__) && defined(O_DIRECT)
+   if (fOptions.fDirectIO) {
+      // A second descriptor for the same file: O_DIRECT on fileDes would break the unaligned I/O of its owner
+      const std::string path = "/proc/self/fd/" + std::to_string(fileDes);
+      fDirectFileDes = open(path.c_str(), O_WRONLY | O_DIRECT | O_CLOEXEC);
+      if (fDirectFileDes < 0)
+         Warning("RFileWriteEngine", "direct I/O is not available (%s), using buffered I/O", std::strerror(errno));
+   }
+#endif
+
+#ifdef _WIN32
+   // Without positional writes, the background writes would move the file position under the feet of the owner
+   fOptions.fAsync = false;
+#endif
+   if (!fOptions.fAsync)
+      return;
+
+#ifdef R__HAS_URING
+   if (fOptions.fUseIoUring) {
+      try {
+         fRing = std::make_unique<RIoUring>(2);
+      } catch (const std::runtime_error &e) {
+         Warning("RFileWriteEngine", "io_uring is not available, using a background thread:\n%s", e.what());
+      }
+   }
+   if (!fRing)
+#endif
+      fWorker = std::thread(&RFileWriteEngine::Work, this);
+}
+
+ROOT::Internal::RFileWriteEngine::~RFileWriteEngine()
+{
+   try {
+      Flush();
+   } catch (const std::exception &e) {
+      Error("~RFileWriteEngine", "%s", e.what());
+   }
+   if (fWorker.joinable()) {
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fStop = true;
+      }
+      fCv.notify_all();
+      fWorker.join();
+   }
+   if (fDirectFileDes >= 0)
+      close(fDirectFileDes);
+}
+
+unsigned int ROOT::Internal::RFileWriteEngine::GetWrites(const RBlock &block, RPendingWrite *writes) const
+{
+   unsigned int nWrites = 0;
+   const unsigned char *data = block.fData.get();
+   std::uint64_t offset = block.fOffset;
+   std::size_t size = block.fSize;
+   if (IsDirectIO()) {
+      const std::size_t nAligned = size - size % kAlignment;
+      if (nAligned > 0)
+         writes[nWrites++] = {fDirectFileDes, data, nAligned, offset};
+      data += nAligned;
+      offset += nAligned;
+      size -= nAligned;
+   }
+   if (size > 0)
+      writes[nWrites++] = {fFileDes, data, size, offset};
+   return nWrites;
+}
+
+void ROOT::Internal::RFileWriteEngine::DoWrite(const RPendingWrite &write)
+{
+   int error = WriteAt(write.fFileDes, write.fData, write.fSize, write.fOffset);
+   // Some file systems accept O_DIRECT when opening the file but refuse the writes
+   if (error == EINVAL && write.fFileDes == fDirectFileDes)
+      error = WriteAt(fFileDes, write.fData, write.fSize, write.fOffset);
+   if (error)
+      throw std::runtime_error(std::string("RFileWriteEngine: cannot write to file: ") + std::strerror(error));
+}
+
+void ROOT::Internal::RFileWriteEngine::FinishBlock(RBlock &block)
+{
+   fBytesSinceSync += block.fSize - block.fHead;
+   block.fSize = 0;
+   if (fOptions.fSyncInterval > 0 && fBytesSinceSync >= fOptions.fSyncInterval) {
+      Sync();
+      fBytesSinceSync = 0;
+   }
+}
+
+void ROOT::Internal::RFileWriteEngine::WriteBlock(RBlock &block)
+{
+   RPendingWrite writes[2];
+   const auto nWrites = GetWrites(block, writes);
+   try {
+      for (unsigned int i = 0; i < nWrites; ++i)
+         DoWrite(writes[i]);
+   } catch (...) {
+      block.fSize = 0;
+      throw;
+   }
+   FinishBlock(block);
+}
+
+void ROOT::Internal::RFileWriteEngine::Sync()
+{
+#if defined(_WIN32)
+   const int res = _commit(fFileDes);
+#elif defined(__linux__)
+   const int res = fdatasync(fFileDes);
+#else
+   const int res = fsync(fFileDes);
+#endif
+   if (res < 0)
+      throw std::runtime_error(std::string("RFileWriteEngine: cannot sync file: ") + std::strerror(errno));
+#ifdef POSIX_FADV_DONTNEED
+   if (fOptions.fDropPageCache)
+      posix_fadvise(fFileDes, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+}
+
+void ROOT::Internal::RFileWriteEngine::Submit(RBlock &block)
+{
+   WaitInFlight();
+   if (!fOptions.fAsync) {
+      WriteBlock(block);
+      return;
+   }
+
+#ifdef R__HAS_URING
+   if (fRing) {
+      auto ring = fRing->GetRawRing();
+      fNRingWrites = GetWrites(block, fRingWrites);
+      for (unsigned int i = 0; i < fNRingWrites; ++i) {
+         struct io_uring_sqe *sqe = io_uring_get_sqe(ring);
+         if (!sqe)
+            throw std::runtime_error("RFileWriteEngine: io_uring submission queue is full");
+         const auto &write = fRingWrites[i];
+         io_uring_prep_write(sqe, write.fFileDes, write.fData, write.fSize, write.fOffset);
+         sqe->user_data = i;
+      }
+      const int ret = io_uring_submit(ring);
+      if (ret < 0)
+         throw std::runtime_error(std::string("RFileWriteEngine: io_uring submit failed: ") + std::strerror(-ret));
+      fInFlight = &block;
+      return;
+   }
+#endif
+
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fInFlight = &block;
+   }
+   fCv.notify_all();
+}
+
+void ROOT::Internal::RFileWriteEngine::WaitInFlight()
+{
+#ifdef R__HAS_URING
+   if (fRing) {
+      if (!fInFlight)
+         return;
+      RBlock *block = fInFlight;
+      fInFlight = nullptr;
+      auto ring = fRing->GetRawRing();
+      for (unsigned int i = 0; i < fNRingWrites; ++i) {
+         struct io_uring_cqe *cqe;
+         const int ret = io_uring_wait_cqe(ring, &cqe);
+         if (ret < 0)
+            throw std::runtime_error(std::string("RFileWriteEngine: io_uring wait failed: ") + std::strerror(-ret));
+         const auto &write = fRingWrites[cqe->user_data];
+         const int res = cqe->res;
+         io_uring_cqe_seen(ring, cqe);
+         if (res < 0 && -res != EINVAL)
+            throw std::runtime_error(std::string("RFileWriteEngine: cannot write to file: ") + std::strerror(-res));
+         // Refused direct write or short write: write the rest synchronously
+         const std::size_t nwritten = res < 0 ? 0 : res;
+         if (nwritten < write.fSize)
+            DoWrite({write.fFileDes, write.fData + nwritten, write.fSize - nwritten, write.fOffset + nwritten});
+      }
+      FinishBlock(*block);
+      return;
+   }
+#endif
+
+   std::unique_lock<std::mutex> lock(fMutex);
+   fCv.wait(lock, [this] { return !fInFlight; });
+   if (fError) {
+      auto error = fError;
+      fError = nullptr;
+      std::rethrow_exception(error);
+   }
+}
+
+void ROOT::Internal::RFileWriteEngine::StartBlock(std::uint64_t offset)
+{
+   RBlock &block = fBlocks[fCurrent];
+   block.fHead = IsDirectIO() ? offset % kAlignment : 0;
+   block.fOffset = offset - block.fHead;
+   block.fSize = block.fHead;
+   if (block.fHead > 0) {
+      // The block in flight may contain the bytes before offset
+      WaitInFlight();
+      const auto nread = ReadAt(fFileDes, block.fData.get(), block.fHead, block.fOffset);
+      memset(block.fData.get() + nread, 0, block.fHead - nread);
+   }
+}
+
+void ROOT::Internal::RFileWriteEngine::Work()
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   while (true) {
+      fCv.wait(lock, [this] { return fInFlight || fStop; });
+      if (!fInFlight)
+         return;
+      RBlock *block = fInFlight;
+      lock.unlock();
+      std::exception_ptr error;
+      try {
+         WriteBlock(*block);
+      } catch (...) {
+         error = std::current_exception();
+      }
+      lock.lock();
+      fInFlight = nullptr;
+      fError = error;
+      fCv.notify_all();
+   }
+}
+
+void ROOT::Internal::RFileWriteEngine::Write(const void *buffer, std::size_t nbytes, std::uint64_t offset)
+{
+   if (nbytes == 0)
+      return;
+   auto data = static_cast<const unsigned char *>(buffer);
+   fBytesWritten += nbytes;
+
+   RBlock *block = &fBlocks[fCurrent];
+   if (block->fSize > 0 && offset != block->fOffset + block->fSize) {
+      Submit(*block);
+      fCurrent = 1 - fCurrent;
+      block = &fBlocks[fCurrent];
+   }
+   if (block->fSize == 0)
+      StartBlock(offset);
+
+   while (nbytes > 0) {
+      const std::size_t n = std::min(nbytes, fOptions.fBufferSize - block->fSize);
+      memcpy(block->fData.get() + block->fSize, data, n);
+      block->fSize += n;
+      data += n;
+      nbytes -= n;
+      offset += n;
+      if (block->fSize == fOptions.fBufferSize) {
+         // Submit() waits for the other block to be written
+         Submit(*block);
+         fCurrent = 1 - fCurrent;
+         block = &fBlocks[fCurrent];
+         if (nbytes > 0)
+            StartBlock(offset);
+      }
+   }
+}
+
+bool ROOT::Internal::RFileWriteEngine::ReadBack(void *buffer, std::size_t nbytes, std::uint64_t offset)
+{
+   WaitInFlight();
+   const RBlock &block = fBlocks[fCurrent];
+   if (block.fSize == 0)
+      return false;
+   const std::uint64_t begin = block.fOffset + block.fHead;
+   const std::uint64_t end = block.fOffset + block.fSize;
+   if (offset >= begin && offset + nbytes <= end) {
+      memcpy(buffer, block.fData.get() + (offset - block.fOffset), nbytes);
+      return true;
+   }
+   if (offset < end && offset + nbytes > begin)
+      Flush();
+   return false;
+}
+
+void ROOT::Internal::RFileWriteEngine::Flush()
+{
+   RBlock &block = fBlocks[fCurrent];
+   if (block.fSize > block.fHead) {
+      Submit(block);
+      fCurrent = 1 - fCurrent;
+   } else {
+      block.fSize = 0;
+   }
+   WaitInFlight();
+}
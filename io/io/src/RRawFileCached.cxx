@@ -0,0 +1,304 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RRawFileCached.hxx>
+
+#include "TEnv.h"
+#include "TError.h"
+#include "TSystem.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+bool WriteBlockFile(const std::string &path, const std::vector<unsigned char> &data)
+{
+   FILE *f = fopen(path.c_str(), "wb");
+   if (!f)
+      return false;
+   const bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+   return (fclose(f) == 0) && ok;
+}
+
+bool ReadBlockFile(const std::string &path, std::vector<unsigned char> &data)
+{
+   FILE *f = fopen(path.c_str(), "rb");
+   if (!f)
+      return false;
+   const bool ok = fread(data.data(), 1, data.size(), f) == data.size();
+   fclose(f);
+   return ok;
+}
+
+} // anonymous namespace
+
+std::size_t ROOT::Internal::RRawFileBlockCache::RKeyHash::operator()(const RKey &key) const
+{
+   return std::hash<std::string>()(key.fUrl) ^ (std::hash<std::uint64_t>()(key.fBlockIdx) * 0x9e3779b97f4a7c15ULL);
+}
+
+ROOT::Internal::RRawFileBlockCache::RRawFileBlockCache(const ROptions &options) : fOptions(options)
+{
+   if (fOptions.fBlockSize == 0)
+      throw std::invalid_argument("RRawFileBlockCache: block size must not be zero");
+   const auto &dir = fOptions.fDiskDirectory;
+   if (!dir.empty() && gSystem->AccessPathName(dir.c_str(), kWritePermission)) {
+      Warning("RRawFileBlockCache", "cannot write to %s, disabling the disk cache", fOptions.fDiskDirectory.c_str());
+      fOptions.fDiskDirectory.clear();
+   }
+   fDiskFilePrefix = fOptions.fDiskDirectory + "/rawfile-block-" + std::to_string(gSystem->GetPid()) + "-";
+}
+
+ROOT::Internal::RRawFileBlockCache::~RRawFileBlockCache()
+{
+   Clear();
+}
+
+std::shared_ptr<ROOT::Internal::RRawFileBlockCache> ROOT::Internal::RRawFileBlockCache::GetGlobal()
+{
+   static std::shared_ptr<RRawFileBlockCache> gCache = [] {
+      ROptions options;
+      options.fBlockSize = gEnv->GetValue("RRawFile.BlockCache.BlockSize", static_cast<int>(options.fBlockSize));
+      options.fMemoryCapacity =
+         std::uint64_t(gEnv->GetValue("RRawFile.BlockCache.MemoryMB", int(options.fMemoryCapacity >> 20))) << 20;
+      options.fDiskDirectory = gEnv->GetValue("RRawFile.BlockCache.Directory", "");
+      options.fDiskCapacity = std::uint64_t(gEnv->GetValue("RRawFile.BlockCache.DiskMB", 0)) << 20;
+      return std::make_shared<RRawFileBlockCache>(options);
+   }();
+   return gCache;
+}
+
+ROOT::Internal::RRawFileBlockCache::Block_t
+ROOT::Internal::RRawFileBlockCache::Get(const std::string &url, std::uint64_t blockIdx)
+{
+   RKey key{url, blockIdx};
+   std::string path;
+   std::size_t size = 0;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      auto itr = fIndex.find(key);
+      if (itr != fIndex.end()) {
+         fEntries.splice(fEntries.begin(), fEntries, itr->second);
+         fStats.fNHits++;
+         return itr->second->fBlock;
+      }
+      auto itrDisk = fDiskIndex.find(key);
+      if (itrDisk == fDiskIndex.end()) {
+         fStats.fNMisses++;
+         return nullptr;
+      }
+      fDiskEntries.splice(fDiskEntries.begin(), fDiskEntries, itrDisk->second);
+      path = itrDisk->second->fPath;
+      size = itrDisk->second->fSize;
+   }
+
+   // The block file may be removed in the meantime by a disk eviction, in which case this is a miss
+   auto data = std::make_shared<std::vector<unsigned char>>(size);
+   const bool found = ReadBlockFile(path, *data);
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      if (found)
+         fStats.fNDiskHits++;
+      else
+         fStats.fNMisses++;
+   }
+   if (!found)
+      return nullptr;
+   Put(url, blockIdx, data);
+   return data;
+}
+
+void ROOT::Internal::RRawFileBlockCache::Put(const std::string &url, std::uint64_t blockIdx, Block_t block)
+{
+   std::vector<REntry> evicted;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      RKey key{url, blockIdx};
+      auto itr = fIndex.find(key);
+      if (itr != fIndex.end()) {
+         // Concurrent readers of the same block
+         fEntries.splice(fEntries.begin(), fEntries, itr->second);
+         return;
+      }
+      fStats.fNBytesInMemory += block->size();
+      fEntries.push_front({key, std::move(block)});
+      fIndex[fEntries.front().fKey] = fEntries.begin();
+
+      while (fStats.fNBytesInMemory > fOptions.fMemoryCapacity && fEntries.size() > 1) {
+         auto &victim = fEntries.back();
+         fStats.fNBytesInMemory -= victim.fBlock->size();
+         fStats.fNEvictions++;
+         fIndex.erase(victim.fKey);
+         if (!fOptions.fDiskDirectory.empty() && fOptions.fDiskCapacity > 0 &&
+             fDiskIndex.count(victim.fKey) == 0) {
+            evicted.emplace_back(std::move(victim));
+         }
+         fEntries.pop_back();
+      }
+   }
+   if (!evicted.empty())
+      WriteToDisk(evicted);
+}
+
+void ROOT::Internal::RRawFileBlockCache::WriteToDisk(std::vector<REntry> &entries)
+{
+   std::vector<std::string> garbage;
+   for (auto &entry : entries) {
+      const std::string path = fDiskFilePrefix + std::to_string(fNDiskFiles++);
+      if (!WriteBlockFile(path, *entry.fBlock)) {
+         std::remove(path.c_str());
+         continue;
+      }
+
+      std::lock_guard<std::mutex> lock(fMutex);
+      if (fDiskIndex.count(entry.fKey)) {
+         garbage.emplace_back(path);
+         continue;
+      }
+      fStats.fNBytesOnDisk += entry.fBlock->size();
+      fDiskEntries.push_front({entry.fKey, path, entry.fBlock->size()});
+      fDiskIndex[entry.fKey] = fDiskEntries.begin();
+      while (fStats.fNBytesOnDisk > fOptions.fDiskCapacity && !fDiskEntries.empty()) {
+         auto &victim = fDiskEntries.back();
+         fStats.fNBytesOnDisk -= victim.fSize;
+         fStats.fNDiskEvictions++;
+         fDiskIndex.erase(victim.fKey);
+         garbage.emplace_back(std::move(victim.fPath));
+         fDiskEntries.pop_back();
+      }
+   }
+   for (const auto &path : garbage)
+      std::remove(path.c_str());
+}
+
+ROOT::Internal::RRawFileBlockCache::RStatistics ROOT::Internal::RRawFileBlockCache::GetStatistics() const
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   return fStats;
+}
+
+void ROOT::Internal::RRawFileBlockCache::Clear()
+{
+   std::list<RDiskEntry> diskEntries;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fIndex.clear();
+      fEntries.clear();
+      fDiskIndex.clear();
+      std::swap(diskEntries, fDiskEntries);
+      fStats.fNBytesInMemory = 0;
+      fStats.fNBytesOnDisk = 0;
+   }
+   for (const auto &entry : diskEntries)
+      std::remove(entry.fPath.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+ROOT::Internal::RRawFileCached::RRawFileCached(std::unique_ptr<RRawFile> file,
+                                               std::shared_ptr<RRawFileBlockCache> cache)
+   : RRawFile(file->GetUrl(), ROptions()), fFile(std::move(file)), fCache(std::move(cache))
+{
+   // Buffering of the base class is redundant with the block cache
+   fOptions.fBlockSize = 0;
+}
+
+std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileCached::Clone() const
+{
+   return std::make_unique<RRawFileCached>(fFile->Clone(), fCache);
+}
+
+void ROOT::Internal::RRawFileCached::OpenImpl()
+{
+   // The wrapped file opens itself on the first read
+}
+
+std::uint64_t ROOT::Internal::RRawFileCached::GetSizeImpl()
+{
+   return fFile->GetSize();
+}
+
+size_t ROOT::Internal::RRawFileCached::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
+{
+   RIOVec ioVec;
+   ioVec.fBuffer = buffer;
+   ioVec.fOffset = offset;
+   ioVec.fSize = nbytes;
+   ReadVImpl(&ioVec, 1);
+   return ioVec.fOutBytes;
+}
+
+void ROOT::Internal::RRawFileCached::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   const std::uint64_t blockSize = fCache->GetBlockSize();
+
+   // Collect the blocks of all requests, from the cache if possible
+   std::map<std::uint64_t, RRawFileBlockCache::Block_t> blocks;
+   std::vector<std::uint64_t> missing;
+   for (unsigned int i = 0; i < nReq; ++i) {
+      if (ioVec[i].fSize == 0)
+         continue;
+      const auto first = ioVec[i].fOffset / blockSize;
+      const auto last = (ioVec[i].fOffset + ioVec[i].fSize - 1) / blockSize;
+      for (auto idx = first; idx <= last; ++idx) {
+         if (blocks.count(idx))
+            continue;
+         auto block = fCache->Get(fUrl, idx);
+         if (!block)
+            missing.emplace_back(idx);
+         blocks[idx] = std::move(block);
+      }
+   }
+
+   if (!missing.empty()) {
+      std::vector<std::shared_ptr<std::vector<unsigned char>>> data;
+      std::vector<RIOVec> reads(missing.size());
+      for (std::size_t i = 0; i < missing.size(); ++i) {
+         data.emplace_back(std::make_shared<std::vector<unsigned char>>(blockSize));
+         reads[i].fBuffer = data.back()->data();
+         reads[i].fOffset = missing[i] * blockSize;
+         reads[i].fSize = blockSize;
+      }
+      fFile->ReadV(reads.data(), reads.size());
+      for (std::size_t i = 0; i < missing.size(); ++i) {
+         data[i]->resize(reads[i].fOutBytes);
+         data[i]->shrink_to_fit();
+         // Blocks beyond the end of the file are not cached
+         if (!data[i]->empty())
+            fCache->Put(fUrl, missing[i], data[i]);
+         blocks[missing[i]] = std::move(data[i]);
+      }
+   }
+
+   for (unsigned int i = 0; i < nReq; ++i) {
+      auto dest = reinterpret_cast<unsigned char *>(ioVec[i].fBuffer);
+      std::uint64_t pos = ioVec[i].fOffset;
+      std::size_t remaining = ioVec[i].fSize;
+      ioVec[i].fOutBytes = 0;
+      while (remaining > 0) {
+         const auto &block = *blocks[pos / blockSize];
+         const std::size_t posInBlock = pos % blockSize;
+         if (posInBlock >= block.size())
+            break; // end of file
+         const std::size_t n = std::min(remaining, block.size() - posInBlock);
+         memcpy(dest, block.data() + posInBlock, n);
+         dest += n;
+         pos += n;
+         remaining -= n;
+         ioVec[i].fOutBytes += n;
+      }
+   }
+}
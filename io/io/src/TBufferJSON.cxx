@@ -100,6 +100,8 @@ class Container {
 #include <memory>
 #include <cstdlib>
 #include <fstream>
+#include <charconv>
+#include <ostream>
 
 #include "Compression.h"
 
@@ -715,6 +717,58 @@ TString TBufferJSON::StoreObject(const void *obj, const TClass *cl)
    return fOutBuffer.Length() ? fOutBuffer : fValue;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Store provided object as JSON structure directly into the output stream
+/// Contrary to StoreObject(const void *, const TClass *), the JSON code is not kept
+/// in memory - it is passed to the stream by chunks while the object is converted.
+/// Returns number of bytes written into the stream
+/// Code should look like:
+///
+///   std::ofstream out("hist.json");
+///   TBufferJSON buf;
+///   buf.SetCompact(TBufferJSON::kNoSpaces);
+///   buf.StoreObject(out, hist, TH1F::Class());
+///
+
+Long64_t TBufferJSON::StoreObject(std::ostream &out, const void *obj, const TClass *cl)
+{
+   fSink = &out;
+   fSinkBytes = 0;
+   fOutBuffer.Clear();
+
+   TString rest = StoreObject(obj, cl);
+
+   // when nothing was written in the main buffer, the JSON code is the value itself
+   if (fSinkBytes == 0)
+      fOutBuffer = rest;
+   FlushOutput();
+
+   fSink = nullptr;
+   return fSinkBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Converts any type of object to JSON and writes it into the output stream
+/// See ConvertToJSON(const void *, const TClass *, Int_t, const char *) for the compact parameter
+/// Returns number of bytes written into the stream
+
+Long64_t TBufferJSON::ExportToStream(std::ostream &out, const void *obj, const TClass *cl, Int_t compact)
+{
+   TClass *clActual = obj ? cl->GetActualClass(obj) : nullptr;
+   const void *actualStart = obj;
+   if (clActual && (clActual != cl)) {
+      actualStart = (char *)obj - clActual->GetBaseClassOffset(cl);
+   } else {
+      clActual = const_cast<TClass *>(cl);
+   }
+
+   TBufferJSON buf;
+
+   buf.SetCompact(compact);
+
+   return buf.StoreObject(out, actualStart, clActual);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Converts selected data member into json
 /// Parameter ptr specifies address in memory, where data member is located
@@ -837,6 +891,12 @@ Int_t TBufferJSON::ExportToFile(const char *filename, const void *obj, const TCl
    if (option && (*option >= '0') && (*option <= '3'))
       compact = TString(option).Atoi();
 
+   // plain JSON is streamed into the file without keeping it in memory
+   if (!strstr(filename, ".json.gz")) {
+      std::ofstream ofs(filename);
+      return (Int_t) ExportToStream(ofs, obj, cl, compact);
+   }
+
    TString json = TBufferJSON::ConvertToJSON(obj, cl, compact);
 
    std::ofstream ofs(filename);
@@ -1170,6 +1230,22 @@ void TBufferJSON::AppendOutput(const char *line0, const char *line1)
          fOutput->Append(line1);
       }
    }
+
+   // Content of the main output buffer is final, it can be passed to the stream
+   if (fSink && (fOutput == &fOutBuffer) && (fOutBuffer.Length() > kSinkChunkSize))
+      FlushOutput();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write content of the main output buffer into the output stream, if any
+
+void TBufferJSON::FlushOutput()
+{
+   if (!fSink || (fOutBuffer.Length() == 0))
+      return;
+   fSink->write(fOutBuffer.Data(), fOutBuffer.Length());
+   fSinkBytes += fOutBuffer.Length();
+   fOutBuffer.Clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2781,19 +2857,18 @@ R__ALWAYS_INLINE void TBufferJSON::JsonReadFastArray(T *arr, Int_t arrsize, bool
          arr[cnt] = 0;
 
       if (json->count("b") == 1) {
-         auto base64 = json->at("b").get<std::string>();
+         // decode directly into the target array, without intermediate copies
+         const auto &base64 = json->at("b").get_ref<const std::string &>();
 
          int offset = (json->count("o") == 1) ? json->at("o").get<int>() : 0;
 
-         // TODO: provide TBase64::Decode with direct write into target buffer
-         auto decode = TBase64::Decode(base64.c_str());
+         Int_t maxlen = arrsize * (Int_t) sizeof(T) - offset;
+         Int_t len = (offset < 0) || (maxlen < 0) ? -1 : TBase64::Decode(base64.data(), base64.length(), (char *) arr + offset, maxlen);
 
-         if (arrsize * (long) sizeof(T) < (offset + decode.Length())) {
-            Error("ReadFastArray", "Base64 data %ld larger than target array size %ld", (long) decode.Length() + offset, (long) (arrsize*sizeof(T)));
-         } else if ((sizeof(T) > 1) && (decode.Length() % sizeof(T) != 0)) {
-            Error("ReadFastArray", "Base64 data size %ld not matches with element size %ld", (long) decode.Length(), (long) sizeof(T));
-         } else {
-            memcpy((char *) arr + offset, decode.Data(), decode.Length());
+         if (len < 0) {
+            Error("ReadFastArray", "Base64 data larger than target array size %ld", (long) (arrsize*sizeof(T)));
+         } else if ((sizeof(T) > 1) && (len % sizeof(T) != 0)) {
+            Error("ReadFastArray", "Base64 data size %ld not matches with element size %ld", (long) len, (long) sizeof(T));
          }
          return;
       }
@@ -3046,8 +3121,12 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
    } else if (is_base64 && !arrsize) {
       fValue.Append("[]");
    } else {
-      fValue.Append("{");
-      fValue.Append(TString::Format("\"$arr\":\"%s\"%s\"len\":%d", typname, fArraySepar.Data(), arrsize));
+      fValue.Append("{\"$arr\":\"");
+      fValue.Append(typname);
+      fValue.Append("\"");
+      fValue.Append(fArraySepar);
+      fValue.Append("\"len\":");
+      JsonWriteInteger(arrsize);
       Int_t aindx(0), bindx(arrsize);
       while ((aindx < arrsize) && (vname[aindx] == 0))
          aindx++;
@@ -3059,8 +3138,11 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
          if ((aindx * sizeof(T) < 5) && (aindx < bindx))
             aindx = 0;
 
-         if ((aindx > 0) && (aindx < bindx))
-            fValue.Append(TString::Format("%s\"o\":%ld", fArraySepar.Data(), (long) (aindx * (int) sizeof(T))));
+         if ((aindx > 0) && (aindx < bindx)) {
+            fValue.Append(fArraySepar);
+            fValue.Append("\"o\":");
+            JsonWriteInteger(aindx * (Int_t) sizeof(T));
+         }
 
          fValue.Append(fArraySepar);
          fValue.Append("\"b\":\"");
@@ -3108,14 +3190,27 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
                continue;
             if (++suffixcnt > 0)
                suffix.Form("%d", suffixcnt);
-            if (p0 != lastp)
-               fValue.Append(TString::Format("%s\"p%s\":%d", fArraySepar.Data(), suffix.Data(), p0));
+            if (p0 != lastp) {
+               fValue.Append(fArraySepar);
+               fValue.Append("\"p");
+               fValue.Append(suffix);
+               fValue.Append("\":");
+               JsonWriteInteger(p0);
+            }
             lastp = pp; /* remember cursor, it may be the same */
-            fValue.Append(TString::Format("%s\"v%s\":", fArraySepar.Data(), suffix.Data()));
+            fValue.Append(fArraySepar);
+            fValue.Append("\"v");
+            fValue.Append(suffix);
+            fValue.Append("\":");
             if ((nsame > 1) || (pp - p0 == 1)) {
                JsonWriteBasic(vname[p0]);
-               if (nsame > 1)
-                  fValue.Append(TString::Format("%s\"n%s\":%d", fArraySepar.Data(), suffix.Data(), nsame));
+               if (nsame > 1) {
+                  fValue.Append(fArraySepar);
+                  fValue.Append("\"n");
+                  fValue.Append(suffix);
+                  fValue.Append("\":");
+                  JsonWriteInteger(nsame);
+               }
             } else {
                fValue.Append("[");
                for (Int_t indx = p0; indx < pp; indx++) {
@@ -3875,14 +3970,24 @@ void TBufferJSON::WriteCharStar(char *s)
    JsonWriteConstChar(s);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// converts integer to string and add to json value buffer, without
+/// going through the printf machinery
+
+template <typename T>
+R__ALWAYS_INLINE void TBufferJSON::JsonWriteInteger(T value)
+{
+   char buf[32];
+   auto res = std::to_chars(buf, buf + sizeof(buf), static_cast<std::conditional_t<(sizeof(T) > 1), T, Int_t>>(value));
+   fValue.Append(buf, res.ptr - buf);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// converts Char_t to string and add to json value buffer
 
 void TBufferJSON::JsonWriteBasic(Char_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3890,9 +3995,7 @@ void TBufferJSON::JsonWriteBasic(Char_t value)
 
 void TBufferJSON::JsonWriteBasic(Short_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hd", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3900,9 +4003,7 @@ void TBufferJSON::JsonWriteBasic(Short_t value)
 
 void TBufferJSON::JsonWriteBasic(Int_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3910,9 +4011,7 @@ void TBufferJSON::JsonWriteBasic(Int_t value)
 
 void TBufferJSON::JsonWriteBasic(Long_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%ld", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3920,7 +4019,7 @@ void TBufferJSON::JsonWriteBasic(Long_t value)
 
 void TBufferJSON::JsonWriteBasic(Long64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3968,9 +4067,7 @@ void TBufferJSON::JsonWriteBasic(Bool_t value)
 
 void TBufferJSON::JsonWriteBasic(UChar_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3978,9 +4075,7 @@ void TBufferJSON::JsonWriteBasic(UChar_t value)
 
 void TBufferJSON::JsonWriteBasic(UShort_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hu", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3988,9 +4083,7 @@ void TBufferJSON::JsonWriteBasic(UShort_t value)
 
 void TBufferJSON::JsonWriteBasic(UInt_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3998,9 +4091,7 @@ void TBufferJSON::JsonWriteBasic(UInt_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%lu", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -4008,7 +4099,7 @@ void TBufferJSON::JsonWriteBasic(ULong_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
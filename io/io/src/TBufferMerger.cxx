@@ -46,7 +46,7 @@ TBufferMerger::~TBufferMerger()
    for (const auto &f : fAttachedFiles)
       if (!f.expired()) Fatal("TBufferMerger", " TBufferMergerFiles must be destroyed before the server");
 
-   if (!fQueue.empty())
+   if (fQueue.load())
       Merge();
 
    // Since we support purely incremental merging, Merge does not write the target objects
@@ -67,19 +67,17 @@ std::shared_ptr<TBufferMergerFile> TBufferMerger::GetFile()
 
 size_t TBufferMerger::GetQueueSize() const
 {
-   std::lock_guard<std::mutex> lock(fQueueMutex);
-   return fQueue.size();
+   return fQueueSize;
 }
 
-void TBufferMerger::Push(TBufferFile *buffer)
+void TBufferMerger::Push(TMemFile *memfile, size_t size)
 {
-   {
-      std::lock_guard<std::mutex> lock(fQueueMutex);
-      fBuffered += buffer->BufferSize();
-      fQueue.push(buffer);
-   }
+   auto node = new RQueueNode{memfile, size, fQueue.load(std::memory_order_relaxed)};
+   while (!fQueue.compare_exchange_weak(node->fNext, node, std::memory_order_release, std::memory_order_relaxed))
+      ;
+   ++fQueueSize;
 
-   if (fBuffered > fAutoSave)
+   if ((fBuffered += size) > fAutoSave)
       Merge();
 }
 
@@ -114,17 +112,17 @@ void TBufferMerger::Merge()
 
 void TBufferMerger::MergeImpl()
 {
-   std::queue<TBufferFile *> queue;
-   {
-      std::lock_guard<std::mutex> q(fQueueMutex);
-      std::swap(queue, fQueue);
-      fBuffered = 0;
-   }
-
-   while (!queue.empty()) {
-      std::unique_ptr<TBufferFile> buffer{queue.front()};
-      fMerger.AddAdoptFile(new TMemFile(fMerger.GetOutputFileName(), std::move(buffer)));
-      queue.pop();
+   // Take the whole queue at once; the nodes are linked from the most recent to the oldest.
+   RQueueNode *node = fQueue.exchange(nullptr, std::memory_order_acquire);
+   std::vector<RQueueNode *> nodes;
+   for (; node; node = node->fNext)
+      nodes.push_back(node);
+   fQueueSize -= nodes.size();
+
+   for (auto it = nodes.rbegin(); it != nodes.rend(); ++it) {
+      fBuffered -= (*it)->fSize;
+      fMerger.AddAdoptFile((*it)->fFile);
+      delete *it;
    }
 
    fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
@@ -13,6 +13,8 @@
 
 #include "TBufferFile.h"
 
+#include <memory>
+
 namespace ROOT {
 
 TBufferMergerFile::TBufferMergerFile(TBufferMerger &m)
@@ -48,10 +50,17 @@ Int_t TBufferMergerFile::Write(const char *name, Int_t opt, Int_t bufsize)
    SetCompressionLevel(oldCompLevel);
 
    if (nbytes) {
-      TBufferFile *buffer = new TBufferFile(TBuffer::kWrite, GetSize());
+      auto buffer = std::make_unique<TBufferFile>(TBuffer::kWrite, GetSize());
       CopyTo(*buffer);
       buffer->SetReadMode();
-      fMerger.Push(buffer);
+      const size_t size = buffer->BufferSize();
+      // Reading back the file header and keys is done here, in parallel, rather than by the merging thread.
+      TMemFile *memfile = nullptr;
+      {
+         TDirectory::TContext ctxt;
+         memfile = new TMemFile(GetName(), std::move(buffer));
+      }
+      fMerger.Push(memfile, size);
       ResetAfterMerge(0);
    }
    return nbytes;
@@ -49,11 +49,97 @@ End_Macro
 #include "TVirtualMutex.h"
 #include "TEmulatedCollectionProxy.h"
 
+#include <algorithm>
+#include <string_view>
+#include <thread>
+#include <vector>
+
 const UInt_t kIsBigFile = BIT(16);
 const Int_t  kMaxLen = 2048;
 
 ClassImp(TDirectoryFile);
 
+namespace ROOT {
+namespace Internal {
+
+/// The keys record of a directory as read from the file. TKeys are created from it on demand: a lookup by name only
+/// creates the keys with that name, any other access to the list of keys creates all of them.
+struct RKeysRecord {
+   struct REntry {
+      std::string_view fName; ///< Points into fBuffer
+      Int_t fOffset = 0;      ///< Position of the key header in fBuffer
+      TKey *fKey = nullptr;   ///< Once created, owned by TDirectoryFile::fKeys
+   };
+
+   bool fIsRead = false; ///< Whether fBuffer has been read from the file and indexed
+   std::unique_ptr<char[]> fBuffer;
+   std::vector<REntry> fEntries;     ///< In the order of the record, i.e. highest cycle first
+   std::vector<std::size_t> fByName; ///< Indexes of fEntries sorted by name, in record order for equal names
+   std::size_t fNCreated = 0;        ///< Number of entries for which the TKey was created
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+namespace {
+
+/// Minimum number of keys created by each thread when a keys record is loaded in parallel
+constexpr std::size_t kMinKeysPerThread = 4096;
+
+/// Read a string written by TString::FillBuffer() without copying it. Returns false if it does not fit into
+/// the buffer.
+bool ReadStringView(char *&buffer, const char *end, std::string_view &str)
+{
+   if (buffer >= end)
+      return false;
+   UChar_t nwh;
+   frombuf(buffer, &nwh);
+   Int_t nchars = nwh;
+   if (nwh == 255) {
+      if (end - buffer < 4)
+         return false;
+      frombuf(buffer, &nchars);
+   }
+   if (nchars < 0 || end - buffer < nchars)
+      return false;
+   str = std::string_view(buffer, nchars);
+   buffer += nchars;
+   return true;
+}
+
+/// Decode the parts of a key header written by TKey::FillBuffer() that are needed to index a keys record and
+/// advance buffer past the header. Returns false if the header does not fit into the buffer.
+bool ReadKeyHeader(char *&buffer, const char *end, std::string_view &name, Long64_t &seekKey, Long64_t &seekPdir)
+{
+   // fNbytes, version, fObjlen, fDatime, fKeylen and fCycle
+   constexpr Int_t kFixedSize = 4 + 2 + 4 + 4 + 2 + 2;
+   if (end - buffer < kFixedSize + 8)
+      return false;
+   char *version = buffer + 4;
+   Version_t keyVersion;
+   frombuf(version, &keyVersion);
+   buffer += kFixedSize;
+   if (keyVersion > 1000) {
+      if (end - buffer < 16)
+         return false;
+      frombuf(buffer, &seekKey);
+      frombuf(buffer, &seekPdir);
+      // The 16 highest bits hold the pid offset, see TKey::ReadKeyBuffer()
+      seekPdir &= 0xffffffffffffLL;
+   } else {
+      UInt_t seekKey32, seekPdir32;
+      frombuf(buffer, &seekKey32);
+      frombuf(buffer, &seekPdir32);
+      seekKey = seekKey32;
+      seekPdir = seekPdir32;
+   }
+   std::string_view className, title;
+   return ReadStringView(buffer, end, className) && ReadStringView(buffer, end, name) &&
+          ReadStringView(buffer, end, title);
+}
+
+} // anonymous namespace
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Default TDirectoryFile constructor
@@ -177,6 +263,8 @@ void TDirectoryFile::InitDirectoryFile(TClass *cl)
 
 TDirectoryFile::~TDirectoryFile()
 {
+   // The keys remove themselves from the list of keys: don't create the missing ones now
+   fKeysRecord.reset();
    if (fKeys) {
       fKeys->Delete("slow");
       SafeDelete(fKeys);
@@ -230,6 +318,7 @@ Int_t TDirectoryFile::AppendKey(TKey *key)
       return 0;
    }
 
+   LoadKeys();
    fModified = kTRUE;
 
    key->SetMotherDir(this);
@@ -266,7 +355,7 @@ void TDirectoryFile::Browse(TBrowser *b)
       TObject *obj = nullptr;
       TIter nextin(fList);
       TKey *key = nullptr, *keyo = nullptr;
-      TIter next(fKeys);
+      TIter next(GetListOfKeys());
 
       cd();
 
@@ -588,6 +677,7 @@ void TDirectoryFile::Close(Option_t *option)
    }
 
    // Delete keys from key list (but don't delete the list header)
+   fKeysRecord.reset();
    if (fKeys) {
       fKeys->Delete("slow");
    }
@@ -801,7 +891,8 @@ TKey *TDirectoryFile::FindKeyAny(const char *keyname) const
 
    DecodeNameCycle(keyname, name, cycle, kMaxLen);
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   LoadKeys(name);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("FindKeyAny", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -853,7 +944,8 @@ TObject *TDirectoryFile::FindObjectAny(const char *aname) const
 
    DecodeNameCycle(aname, name, cycle, kMaxLen);
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   LoadKeys(name);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("FindObjectAny", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -974,7 +1066,8 @@ TObject *TDirectoryFile::Get(const char *namecycle)
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   LoadKeys(namobj);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("Get", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1097,7 +1190,8 @@ void *TDirectoryFile::GetObjectChecked(const char *namecycle, const TClass* expe
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   LoadKeys(namobj);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("GetObjectChecked", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1129,6 +1223,29 @@ Int_t TDirectoryFile::GetBufferSize() const
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the list of keys of this directory.
+///
+/// The keys of a directory read from a file are only created when they are first needed.
+
+TList *TDirectoryFile::GetListOfKeys() const
+{
+   LoadKeys();
+   return fKeys;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of keys of this directory, without creating the keys that are not loaded yet.
+
+Int_t TDirectoryFile::GetNkeys() const
+{
+   if (fKeysRecord) {
+      ReadKeysRecord();
+      return fKeysRecord->fEntries.size();
+   }
+   return fKeys->GetSize();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return pointer to key with name,cycle
 ///
@@ -1138,7 +1255,8 @@ TKey *TDirectoryFile::GetKey(const char *name, Short_t cycle) const
 {
    if (!fKeys) return nullptr;
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   LoadKeys(name);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("GetKey", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1204,6 +1322,7 @@ void TDirectoryFile::ls(Option_t *option) const
    }
 
    if (diskobj && fKeys) {
+      LoadKeys();
       //*-* Loop on all the keys
       for (TObjLink *lnk = fKeys->FirstLink(); lnk != nullptr; lnk = lnk->Next()) {
          TKey *key = (TKey*)lnk->GetObject();
@@ -1383,6 +1502,7 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
    char *buffer;
    if (forceRead) {
+      fKeysRecord.reset();
       fKeys->Delete();
       //In case directory was updated by another process, read new
       //position for the keys
@@ -1415,37 +1535,165 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
       delete [] header;
    }
 
-   Int_t nkeys = 0;
-   Long64_t fsize = fFile->GetSize();
-   if ( fSeekKeys >  0) {
-      TKey *headerkey    = new TKey(fSeekKeys, fNbytesKeys, this);
-      headerkey->ReadFile();
-      buffer = headerkey->GetBuffer();
-      headerkey->ReadKeyBuffer(buffer);
-
-      TKey *key;
-      frombuf(buffer, &nkeys);
-      for (Int_t i = 0; i < nkeys; i++) {
-         key = new TKey(this);
-         key->ReadKeyBuffer(buffer);
-         if (key->GetSeekKey() < 64 || key->GetSeekKey() > fsize) {
-            Error("ReadKeys","reading illegal key, exiting after %d keys",i);
-            fKeys->Remove(key);
-            nkeys = i;
-            break;
-         }
-         if (key->GetSeekPdir() < 64 || key->GetSeekPdir() > fsize) {
-            Error("ReadKeys","reading illegal key, exiting after %d keys",i);
-            fKeys->Remove(key);
-            nkeys = i;
-            break;
+   if (!fKeysRecord)
+      fKeysRecord = std::make_unique<ROOT::Internal::RKeysRecord>();
+   ReadKeysRecord();
+   const Int_t nkeys = fKeysRecord->fEntries.size();
+   LoadKeys();
+
+   return nkeys;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the keys of this directory from the file only when they are first accessed.
+///
+/// Called when the directory is read from a file. Lookups by name, e.g. Get() and GetKey(), then only create
+/// the keys with the requested name; GetListOfKeys() creates all of them.
+
+void TDirectoryFile::DeferReadKeys()
+{
+   if (!fFile || !fKeys) return;
+
+   if (!fFile->IsBinary()) {
+      ReadKeys();
+      return;
+   }
+
+   fKeysRecord = std::make_unique<ROOT::Internal::RKeysRecord>();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the keys record of this directory from the file, if not done yet, and index it by key name.
+///
+/// No TKey is created. Keys that point outside of the file end the record, as in older versions of ReadKeys().
+
+void TDirectoryFile::ReadKeysRecord() const
+{
+   auto &record = *fKeysRecord;
+   if (record.fIsRead) return;
+   record.fIsRead = true;
+
+   if (fSeekKeys <= 0 || fNbytesKeys <= 0 || !fFile) return;
+
+   record.fBuffer = std::make_unique<char[]>(fNbytesKeys);
+   fFile->Seek(fSeekKeys);
+   if (fFile->ReadBuffer(record.fBuffer.get(), fNbytesKeys)) {
+      Error("ReadKeys", "Failed to read the keys of directory %s", GetName());
+      record.fBuffer.reset();
+      return;
+   }
+
+   char *buffer = record.fBuffer.get();
+   const char *end = buffer + fNbytesKeys;
+   std::string_view name;
+   Long64_t seekKey, seekPdir;
+   // The record starts with the header of the key of the record itself
+   if (!ReadKeyHeader(buffer, end, name, seekKey, seekPdir) || end - buffer < 4) {
+      Error("ReadKeys", "Corrupted keys record of directory %s", GetName());
+      return;
+   }
+   Int_t nkeys;
+   frombuf(buffer, &nkeys);
+
+   const Long64_t fsize = fFile->GetSize();
+   record.fEntries.reserve(std::max(nkeys, 0));
+   for (Int_t i = 0; i < nkeys; i++) {
+      const Int_t offset = buffer - record.fBuffer.get();
+      if (!ReadKeyHeader(buffer, end, name, seekKey, seekPdir) || seekKey < 64 || seekKey > fsize ||
+          seekPdir < 64 || seekPdir > fsize) {
+         Error("ReadKeys","reading illegal key, exiting after %d keys",i);
+         break;
+      }
+      record.fEntries.push_back({name, offset, nullptr});
+   }
+
+   record.fByName.resize(record.fEntries.size());
+   for (std::size_t i = 0; i < record.fByName.size(); ++i)
+      record.fByName[i] = i;
+   std::stable_sort(record.fByName.begin(), record.fByName.end(),
+                    [&](std::size_t a, std::size_t b) { return record.fEntries[a].fName < record.fEntries[b].fName; });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create the keys of the keys record that were not created yet, in parallel if implicit multi-threading is
+/// enabled, and add them to fKeys in the order of the record.
+
+void TDirectoryFile::LoadKeys() const
+{
+   if (!fKeysRecord) return;
+   ReadKeysRecord();
+
+   // From now on the keys belong to fKeys only: keys removed from it, e.g. in their destructor, must not come back
+   std::unique_ptr<ROOT::Internal::RKeysRecord> record = std::move(fKeysRecord);
+   auto &entries = record->fEntries;
+   auto createKeys = [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+         if (entries[i].fKey)
+            continue;
+         char *buffer = record->fBuffer.get() + entries[i].fOffset;
+         entries[i].fKey = new TKey(const_cast<TDirectoryFile *>(this));
+         entries[i].fKey->ReadKeyBuffer(buffer);
+      }
+   };
+
+   std::size_t nThreads = 1;
+   // TObjectTable::AddObj() cannot be called concurrently
+   if (ROOT::IsImplicitMTEnabled() && !TObject::GetObjectStat())
+      nThreads =
+         std::min<std::size_t>(ROOT::GetThreadPoolSize(), (entries.size() - record->fNCreated) / kMinKeysPerThread);
+   if (nThreads > 1) {
+      std::vector<std::thread> threads;
+      const std::size_t chunkSize = (entries.size() + nThreads - 1) / nThreads;
+      for (std::size_t begin = 0; begin < entries.size(); begin += chunkSize)
+         threads.emplace_back(createKeys, begin, std::min(begin + chunkSize, entries.size()));
+      for (auto &thread : threads)
+         thread.join();
+   } else {
+      createKeys(0, entries.size());
+   }
+
+   // Keys created by lookups by name are at the wrong place in the list
+   if (record->fNCreated > 0) {
+      if (fKeys->GetSize() == (Int_t)record->fNCreated) {
+         fKeys->Clear("nodelete");
+      } else {
+         for (auto &entry : entries) {
+            if (entry.fKey)
+               fKeys->Remove(entry.fKey);
          }
-         fKeys->Add(key);
       }
-      delete headerkey;
    }
+   // Size the hash table once instead of letting it grow while the keys are added
+   const Int_t nTotal = fKeys->GetSize() + entries.size();
+   auto hashList = dynamic_cast<THashList *>(fKeys);
+   if (hashList && nTotal > 100)
+      hashList->Rehash(nTotal);
+   for (auto &entry : entries)
+      fKeys->Add(entry.fKey);
+}
 
-   return nkeys;
+////////////////////////////////////////////////////////////////////////////////
+/// Create the keys with the given name from the keys record, if they were not created yet.
+
+void TDirectoryFile::LoadKeys(const char *name) const
+{
+   if (!fKeysRecord) return;
+   ReadKeysRecord();
+
+   auto &record = *fKeysRecord;
+   const std::string_view keyName(name);
+   auto it = std::lower_bound(record.fByName.begin(), record.fByName.end(), keyName,
+                              [&](std::size_t i, std::string_view n) { return record.fEntries[i].fName < n; });
+   for (; it != record.fByName.end() && record.fEntries[*it].fName == keyName; ++it) {
+      auto &entry = record.fEntries[*it];
+      if (entry.fKey)
+         return;
+      char *buffer = record.fBuffer.get() + entry.fOffset;
+      entry.fKey = new TKey(const_cast<TDirectoryFile *>(this));
+      entry.fKey->ReadKeyBuffer(buffer);
+      fKeys->Add(entry.fKey);
+      ++record.fNCreated;
+   }
 }
 
 
@@ -1461,7 +1709,8 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 Int_t TDirectoryFile::ReadTObject(TObject *obj, const char *keyname)
 {
    if (!fFile) { Error("ReadTObject","No file open"); return 0; }
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   LoadKeys(keyname);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("ReadTObject", "Unexpected type of TDirectoryFile::fKeys!");
       return 0;
@@ -1502,7 +1751,7 @@ void TDirectoryFile::ResetAfterMerge(TFileMergeInfo *info)
    fSeekParent = 0; // updated by Init
    fSeekKeys = 0;   // updated by Init
    // Does not change: fFile
-   TKey *key = fKeys ? (TKey*)fKeys->FindObject(fName) : nullptr;
+   TKey *key = fKeys ? (TKey*)GetListOfKeys()->FindObject(fName) : nullptr;
    TClass *cl = IsA();
    if (key) {
       cl = TClass::GetClass(key->GetClassName());
@@ -1777,7 +2026,7 @@ void TDirectoryFile::Streamer(TBuffer &b)
       fList->UseRWLock();
       R__LOCKGUARD(gROOTMutex);
       gROOT->GetUUIDs()->AddUUID(fUUID,this);
-      if (fSeekKeys) ReadKeys();
+      if (fSeekKeys) DeferReadKeys();
    } else {
       if (fFile && !fFile->IsBinary()) {
          b.WriteVersion(TDirectoryFile::Class());
@@ -2178,6 +2427,7 @@ void TDirectoryFile::WriteKeys()
       f->MakeFree(fSeekKeys, fSeekKeys + fNbytesKeys -1);
    }
 //*-* Write new keys record
+   LoadKeys();
    TIter next(fKeys);
    TKey *key;
    Int_t nkeys  = fKeys->GetSize();
@@ -128,6 +128,7 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "TEnv.h"
 #include "TVirtualMonitoring.h"
 #include "TVirtualMutex.h"
+#include "TVirtualRWMutex.h"
 #include "TMap.h"
 #include "TMathBase.h"
 #include "TObjString.h"
@@ -135,12 +136,17 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "compiledata.h"
 #include <cmath>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <set>
+#include <vector>
 #include "TSchemaRule.h"
 #include "TSchemaRuleSet.h"
 #include "TThreadSlots.h"
 #include "TGlobal.h"
 #include "ROOT/RConcurrentHashColl.hxx"
+#include "ROOT/RFileWriteEngine.hxx"
+#include "ROOT/RMetricsRegistry.hxx"
 #include <memory>
 
 #ifdef R__FBSD
@@ -161,9 +167,25 @@ Bool_t   TFile::fgCacheFileForce = kFALSE;
 Bool_t   TFile::fgCacheFileDisconnected = kTRUE;
 UInt_t   TFile::fgOpenTimeout = TFile::kEternalTimeout;
 Bool_t   TFile::fgOnlyStaged = kFALSE;
-#ifdef R__USE_IMT
 ROOT::Internal::RConcurrentHashColl TFile::fgTsSIHashes;
-#endif
+
+namespace {
+/// Export the global I/O statistics of all TFiles through the metrics registry
+struct RFileMetricsCollector {
+   RFileMetricsCollector()
+   {
+      using ROOT::Experimental::RMetric;
+      ROOT::Experimental::RMetricsRegistry::Instance().AddCollector([](auto &samples) {
+         samples.push_back({"root_file_read_bytes", "Bytes read by all TFiles", RMetric::EKind::kCounter, "bytes",
+                            double(TFile::GetFileBytesRead())});
+         samples.push_back({"root_file_read_calls", "Read calls of all TFiles", RMetric::EKind::kCounter, "",
+                            double(TFile::GetFileReadCalls())});
+         samples.push_back({"root_file_written_bytes", "Bytes written by all TFiles", RMetric::EKind::kCounter, "bytes",
+                            double(TFile::GetFileBytesWritten())});
+      });
+   }
+} gFileMetricsCollector;
+} // namespace
 
 #ifdef R__MACOSX
 /* On macOS getxattr takes two extra arguments that should be set to 0 */
@@ -187,6 +209,20 @@ AddPseudoGlobals() {
    TGlobalMappedFunction::MakeFunctor("gFile", "TFile*", TFile::CurrentFile);
 }
 } gAddPseudoGlobals;
+
+/// Numbers of the TStreamerInfo (i.e. the slots of TFile::fClassIndex) found in each StreamerInfo record
+/// already processed by TFile::ReadStreamerInfo, keyed by the hash of the record. Files sharing a record,
+/// like the files of a TChain, skip reading and checking it again but still learn which classes they use.
+struct StreamerInfoRecordNumbers {
+   std::mutex fMutex;
+   std::map<ROOT::Internal::RConcurrentHashColl::HashValue, std::vector<Int_t>> fNumbers;
+};
+
+StreamerInfoRecordNumbers &GetStreamerInfoRecordNumbers()
+{
+   static StreamerInfoRecordNumbers numbers;
+   return numbers;
+}
 }
 ////////////////////////////////////////////////////////////////////////////////
 /// File default Constructor.
@@ -822,7 +858,7 @@ void TFile::Init(Bool_t create)
       //*-* -------------Read keys of the top directory
       if (fSeekKeys > fBEGIN && fEND <= size) {
          //normal case. Recover only if file has no keys
-         TDirectoryFile::ReadKeys(kFALSE);
+         DeferReadKeys();
          gDirectory = this;
          if (!GetNkeys()) {
             if (tryrecover) {
@@ -1377,7 +1413,6 @@ TFile::InfoListRet TFile::GetStreamerInfoListImpl(bool lookupSICache)
          return {nullptr, 1, hash};
       }
 
-#ifdef R__USE_IMT
       if (lookupSICache) {
          // key data must be excluded from the hash, otherwise the timestamp will
          // always lead to unique hashes for each file
@@ -1387,9 +1422,6 @@ TFile::InfoListRet TFile::GetStreamerInfoListImpl(bool lookupSICache)
             return {nullptr, 0, hash};
          }
       }
-#else
-      (void) lookupSICache;
-#endif
       key->ReadKeyBuffer(buf);
       list = dynamic_cast<TList*>(key->ReadObjWithBuffer(buffer.data()));
       if (list) list->SetOwner();
@@ -2175,6 +2207,8 @@ Int_t TFile::ReOpen(Option_t *mode)
          }
 
          FlushWriteCache();
+         // a write engine cache holds the descriptor closed below
+         SetCacheWrite(nullptr);
 
          // delete free segments from free list
          fFree->Delete();
@@ -3592,7 +3626,22 @@ void TFile::ReadStreamerInfo()
    TList *list = listRetcode.fList;
    auto retcode = listRetcode.fReturnCode;
    if (!list) {
-      if (retcode) MakeZombie();
+      if (retcode) {
+         MakeZombie();
+         return;
+      }
+      // The record has already been treated, the StreamerInfos it describes are known to their classes.
+      auto &recordNumbers = GetStreamerInfoRecordNumbers();
+      std::lock_guard<std::mutex> lock(recordNumbers.fMutex);
+      auto numbers = recordNumbers.fNumbers.find(listRetcode.fHash);
+      if (numbers != recordNumbers.fNumbers.end()) {
+         for (Int_t uid : numbers->second) {
+            if (uid >= fClassIndex->GetSize())
+               fClassIndex->Set(TMath::Max(2 * fClassIndex->GetSize(), uid + 1));
+            fClassIndex->fArray[uid] = 1;
+         }
+         fClassIndex->fArray[0] = 0;
+      }
       return;
    }
 
@@ -3601,6 +3650,7 @@ void TFile::ReadStreamerInfo()
    if (gDebug > 0) Info("ReadStreamerInfo", "called for file %s",GetName());
 
    TStreamerInfo *info;
+   std::vector<Int_t> numbers;
 
    Int_t version = fVersion;
    if (version > 1000000) version -= 1000000;
@@ -3680,8 +3730,10 @@ void TFile::ReadStreamerInfo()
             Int_t uid = info->GetNumber();
             Int_t asize = fClassIndex->GetSize();
             if (uid >= asize && uid <100000) fClassIndex->Set(2*asize);
-            if (uid >= 0 && uid < fClassIndex->GetSize()) fClassIndex->fArray[uid] = 1;
-            else if (!isstl && !info->GetClass()->IsSyntheticPair()) {
+            if (uid >= 0 && uid < fClassIndex->GetSize()) {
+               fClassIndex->fArray[uid] = 1;
+               numbers.push_back(uid);
+            } else if (!isstl && !info->GetClass()->IsSyntheticPair()) {
                printf("ReadStreamerInfo, class:%s, illegal uid=%d\n",info->GetName(),uid);
             }
             if (gDebug > 0) printf(" -class: %s version: %d info read at slot %d\n",info->GetName(), info->GetClassVersion(),uid);
@@ -3693,11 +3745,14 @@ void TFile::ReadStreamerInfo()
    list->Clear();  //this will delete all TStreamerInfo objects with kCanDelete bit set
    delete list;
 
-#ifdef R__USE_IMT
    // We are done processing the record, let future calls and other threads that it
    // has been done.
+   {
+      auto &recordNumbers = GetStreamerInfoRecordNumbers();
+      std::lock_guard<std::mutex> lock(recordNumbers.fMutex);
+      recordNumbers.fNumbers.emplace(listRetcode.fHash, std::move(numbers));
+   }
    fgTsSIHashes.Insert(listRetcode.fHash);
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3846,12 +3901,28 @@ void TFile::WriteStreamerInfo()
    list.RemoveLast(); // remove the listOfRules.
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the file is opened by TWebFile or a class derived from it,
+/// which can read through a cache of blocks.
+
+static Bool_t IsWebFileClass(const TUrl &fileurl)
+{
+   TPluginHandler *h = gROOT->GetPluginManager()->FindHandler("TFile", fileurl.GetUrl());
+   if (!h || (h->LoadPlugin() == -1))
+      return kFALSE;
+   TClass *cl = TClass::GetClass(h->GetClass());
+   return cl && cl->InheritsFrom("TWebFile");
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Open a file for reading through the file cache.
 ///
 /// The file will be downloaded to the cache and opened from there.
 /// If the download fails, it will be opened remotely.
 /// The file will be downloaded to the directory specified by SetCacheFileDir().
+/// Files read by TWebFile (http, https, s3) are not downloaded: only the blocks
+/// which are read are kept in the cache directory and validated against the
+/// size, ETag and Last-Modified date of the remote file.
 
 TFile *TFile::OpenFromCache(const char *name, Option_t *, const char *ftitle,
                    Int_t compress, Int_t netopt)
@@ -3872,6 +3943,14 @@ TFile *TFile::OpenFromCache(const char *name, Option_t *, const char *ftitle,
             ::Warning("TFile::OpenFromCache",
                       "you want to read through a cache, but you are reading "
                       "local files - CACHEREAD disabled");
+      } else if (IsWebFileClass(fileurl)) {
+         // TWebFile keeps in the cache only the blocks of the file which are read,
+         // instead of a copy of the whole file
+         Bool_t forcedcache = fgCacheFileForce;
+         fgCacheFileForce = kFALSE;
+         f = TFile::Open(name, "BLOCKCACHE", ftitle, compress, netopt);
+         fgCacheFileForce = forcedcache;
+         return f;
       } else {
          // this is a remote file and worthwhile to be put into the local cache
          // now create cachepath to put it
@@ -4061,6 +4140,8 @@ TFile *TFile::OpenFromCache(const char *name, Option_t *, const char *ftitle,
 /// file for reading through the file cache. The file will be downloaded to
 /// the cache and opened from there. If the download fails, it will be opened remotely.
 /// The file will be downloaded to the directory specified by SetCacheFileDir().
+/// Files read by TWebFile are not downloaded, only their blocks which are read
+/// are kept in the cache directory (see OpenFromCache()).
 ///
 /// *The caller is responsible for deleting the pointer.*
 /// In READ mode, a nullptr is returned if the file does not exist or cannot be opened.
@@ -4299,6 +4380,18 @@ TFile *TFile::Open(const char *url, Option_t *options, const char *ftitle,
       new TFileCacheWrite(f, 1);
    }
 
+   // local files can be written through the aligned, double-buffered write engine
+   if ((type == kLocal || type == kFile) && f && f->IsWritable() && !f->IsRaw() && f->fD >= 0 &&
+       !f->GetCacheWrite() && gEnv->GetValue("TFile.WriteEngine", 0)) {
+      ROOT::Internal::RFileWriteEngine::ROptions engineOptions;
+      engineOptions.fBufferSize = gEnv->GetValue("TFile.WriteEngine.BufferSize", 8 * 1024 * 1024);
+      engineOptions.fDirectIO = gEnv->GetValue("TFile.WriteEngine.DirectIO", 0);
+      engineOptions.fUseIoUring = gEnv->GetValue("TFile.WriteEngine.IoUring", 0);
+      engineOptions.fSyncInterval = gEnv->GetValue("TFile.WriteEngine.SyncInterval", 0);
+      engineOptions.fDropPageCache = gEnv->GetValue("TFile.WriteEngine.DropPageCache", 0);
+      new TFileCacheWrite(f, std::make_unique<ROOT::Internal::RFileWriteEngine>(f->fD, engineOptions));
+   }
+
    return f;
 }
 
@@ -4546,7 +4639,9 @@ Int_t TFile::SysSync(Int_t fd)
 
 Long64_t TFile::GetBytesWritten() const
 {
-   return fCacheWrite ? fCacheWrite->GetBytesInCache() + fBytesWrite : fBytesWrite;
+   if (!fCacheWrite)
+      return fBytesWrite;
+   return fCacheWrite->GetBytesInCache() + fCacheWrite->GetEngineBytesWritten() + fBytesWrite;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -4890,7 +4985,7 @@ TFile::EAsyncOpenStatus TFile::GetAsyncOpenStatus(const char* name)
    }
 
    // Check also the list of files open
-   R__LOCKGUARD(gROOTMutex);
+   R__READ_LOCKGUARD(ROOT::gCoreMutex);
    TSeqCollection *of = gROOT->GetListOfFiles();
    if (of && (of->GetSize() > 0)) {
       TIter nxf(of);
@@ -4937,7 +5032,7 @@ const TUrl *TFile::GetEndpointUrl(const char* name)
    }
 
    // Check also the list of files open
-   R__LOCKGUARD(gROOTMutex);
+   R__READ_LOCKGUARD(ROOT::gCoreMutex);
    TSeqCollection *of = gROOT->GetListOfFiles();
    if (of && (of->GetSize() > 0)) {
       TIter nxf(of);
@@ -23,11 +23,20 @@ TXNetFile and TWebFile (via TFile::WriteBuffers()).
 
 The write cache is automatically created when writing a remote file
 (created in TFile::Open()).
+
+For local files, TFile::Open() can instead create a write cache that
+passes the data to an ROOT::Internal::RFileWriteEngine (see the
+TFile.WriteEngine settings in system.rootrc): the data is gathered in
+two large aligned buffers, written in the background, optionally with
+direct I/O, while the file keeps being written.
 */
 
 
 #include "TFile.h"
 #include "TFileCacheWrite.h"
+#include "ROOT/RFileWriteEngine.hxx"
+
+#include <exception>
 
 ClassImp(TFileCacheWrite);
 
@@ -64,11 +73,26 @@ TFileCacheWrite::TFileCacheWrite(TFile *file, Int_t buffersize)
    if (gDebug > 0) Info("TFileCacheWrite","Creating a write cache with buffersize=%d bytes",buffersize);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Creates a write cache that writes the data of file with the given engine.
+/// The engine must write to the file descriptor of file.
+
+TFileCacheWrite::TFileCacheWrite(TFile *file, std::unique_ptr<ROOT::Internal::RFileWriteEngine> engine)
+   : TObject(), fSeekStart(0), fBufferSize(0), fNtot(0), fFile(file), fBuffer(nullptr), fRecursive(kFALSE),
+     fEngine(std::move(engine))
+{
+   if (file) file->SetCacheWrite(this);
+   if (gDebug > 0)
+      Info("TFileCacheWrite", "Creating a write engine cache (direct I/O: %d, asynchronous: %d)",
+           fEngine->IsDirectIO(), fEngine->IsAsync());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Destructor.
 
 TFileCacheWrite::~TFileCacheWrite()
 {
+   if (fEngine) Flush();
    delete [] fBuffer;
 }
 
@@ -78,6 +102,15 @@ TFileCacheWrite::~TFileCacheWrite()
 
 Bool_t TFileCacheWrite::Flush()
 {
+   if (fEngine) {
+      try {
+         fEngine->Flush();
+      } catch (const std::exception &e) {
+         Error("Flush", "%s", e.what());
+         return kTRUE;
+      }
+      return kFALSE;
+   }
    if (!fNtot) return kFALSE;
    fFile->Seek(fSeekStart);
    //printf("Flushing buffer at fSeekStart=%lld, fNtot=%d\n",fSeekStart,fNtot);
@@ -88,6 +121,15 @@ Bool_t TFileCacheWrite::Flush()
    return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of bytes written with the write engine, if any. The
+/// engine writes them without going through the file.
+
+Long64_t TFileCacheWrite::GetEngineBytesWritten() const
+{
+   return fEngine ? fEngine->GetBytesWritten() : 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Print class internal structure.
 
@@ -107,6 +149,14 @@ void TFileCacheWrite::Print(Option_t *option) const
 
 Int_t TFileCacheWrite::ReadBuffer(char *buf, Long64_t pos, Int_t len)
 {
+   if (fEngine) {
+      try {
+         return fEngine->ReadBack(buf, len, pos) ? 0 : -1;
+      } catch (const std::exception &e) {
+         Error("ReadBuffer", "%s", e.what());
+         return -1;
+      }
+   }
    if (pos < fSeekStart || pos+len > fSeekStart+fNtot) return -1;
    memcpy(buf,fBuffer+pos-fSeekStart,len);
    return 0;
@@ -122,6 +172,17 @@ Int_t TFileCacheWrite::WriteBuffer(const char *buf, Long64_t pos, Int_t len)
 {
    if (fRecursive) return 0;
 
+   if (fEngine) {
+      try {
+         fEngine->Write(buf, len, pos);
+      } catch (const std::exception &e) {
+         Error("WriteBuffer", "%s", e.what());
+         return -1;
+      }
+      TFile::SetFileBytesWritten(TFile::GetFileBytesWritten() + len);
+      return 1;
+   }
+
    //printf("TFileCacheWrite::WriteBuffer, pos=%lld, len=%d, fSeekStart=%lld, fNtot=%d\n",pos,len,fSeekStart,fNtot);
 
    if (fSeekStart + fNtot != pos) {
@@ -20,6 +20,22 @@ any of its remote file access plugins. It is therefore useful in
 a Grid environment where the files might be accessible only remotely.
 The merging interface allows files containing histograms and trees
 to be merged, like the standalone hadd program.
+
+With SetNThreads(), the same-name objects of several input files are read,
+and decompressed, concurrently (one thread per file) and a local output file
+is written on a background thread. This requires ROOT::EnableThreadSafety().
+
+When more files are added than can be opened at once (see SetMaxOpenedFiles()),
+they are merged by sets. SetPrefetchFiles() opens the first files of the next
+set in the background while the current set is merged, which hides the latency
+of remote inputs; SetMaxMemory() bounds the memory held by the merged objects,
+which are otherwise kept in memory until the end of the merge.
+
+With SetReport(), a line is printed for each merged object (TTree, RNTuple,
+histogram, ...) with the method used, for instance whether the baskets of a
+TTree could be copied without being unzipped and, if not, why, together with
+the read and write throughput. This helps finding the configurations which
+make a merge slow.
 */
 
 #include "TFileMerger.h"
@@ -39,6 +55,8 @@ to be merged, like the standalone hadd program.
 #include "TROOT.h"
 #include "TMemFile.h"
 #include "TVirtualMutex.h"
+#include "TFileCacheWrite.h"
+#include "ROOT/RFileWriteEngine.hxx"
 
 #ifdef WIN32
 // For _getmaxstdio
@@ -50,6 +68,9 @@ to be merged, like the standalone hadd program.
 #endif
 
 #include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
 
 ClassImp(TFileMerger);
 
@@ -58,6 +79,7 @@ TClassRef R__TTree_Class("TTree");
 
 static const Int_t kCpProgress = BIT(14);
 static const Int_t kCintFileNumber = 100;
+static const Int_t kMinBytesPerThread = 64 * 1024;
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the maximum number of allowed opened files minus some wiggle room
 /// for CINT or at least of the standard library (stdio).
@@ -85,6 +107,42 @@ static Int_t R__GetSystemMaxOpenedFiles()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Open an input file, or a local copy of it. Returns nullptr if the copy fails.
+
+static TFile *R__OpenInput(const char *url, Bool_t local, Bool_t cpProgress, TString &localcopy)
+{
+   if (local) {
+      TUUID uuid;
+      localcopy.Form("file:%s/ROOTMERGE-%s.root", gSystem->TempDirectory(), uuid.AsString());
+      if (!TFile::Cp(url, localcopy, cpProgress))
+         return nullptr;
+      return TFile::Open(localcopy, "READ");
+   }
+   return TFile::Open(url, "READ");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete the objects of dir and of its subdirectories which were written to the
+/// output, except the trees which keep on being filled.
+
+static void R__DeleteWrittenObjects(TDirectory *dir)
+{
+   std::vector<TObject *> objs;
+   TIter next(dir->GetList());
+   while (TObject *obj = next())
+      objs.push_back(obj);
+   for (auto obj : objs) {
+      if (auto subdir = dynamic_cast<TDirectory *>(obj)) {
+         R__DeleteWrittenObjects(subdir);
+      } else if (!obj->InheritsFrom(R__TTree_Class)) {
+         dir->GetList()->Remove(obj);
+         obj->ResetBit(kMustCleanup);
+         delete obj;
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create file merger object.
 
@@ -386,6 +444,49 @@ Long64_t MergeRNTuples(TClass* rntupleHandle, const TString& /* target */, const
    return func(static_cast<void*>(rntupleHandle), nullptr, nullptr);
 }
 
+/// Read the objects of the given keys into objs, the keys to be read being those of the sources
+/// without an object in memory. Each key belongs to a different file, so that the keys can be read,
+/// and their buffers decompressed, on a thread each; this is only done if the thread safety of ROOT
+/// is enabled and the keys hold enough bytes to be worth it.
+void ReadKeys(const std::vector<TDirectory *> &dirs, const std::vector<TKey *> &keys, std::vector<TObject *> &objs)
+{
+   Long64_t nbytes = 0;
+   std::size_t nkeys = 0;
+   for (auto key : keys) {
+      if (key) {
+         nbytes += key->GetNbytes();
+         ++nkeys;
+      }
+   }
+
+   auto readKey = [&](std::size_t i) {
+      if (!keys[i])
+         return;
+      // gDirectory is thread local when the thread safety is enabled
+      TDirectory::TContext ctxt(dirs[i]);
+      objs[i] = keys[i]->ReadObj();
+   };
+
+   // TObjectTable::AddObj() cannot be called concurrently
+   if (nkeys < 2 || nbytes < kMinBytesPerThread * (Long64_t)nkeys || !gGlobalMutex || TObject::GetObjectStat()) {
+      for (std::size_t i = 0; i < keys.size(); ++i) {
+         if (keys[i]) {
+            dirs[i]->cd();
+            objs[i] = keys[i]->ReadObj();
+         }
+      }
+      return;
+   }
+
+   std::vector<std::thread> threads;
+   for (std::size_t i = 0; i < keys.size(); ++i) {
+      if (keys[i])
+         threads.emplace_back(readKey, i);
+   }
+   for (auto &thread : threads)
+      thread.join();
+}
+
 Bool_t IsMergeable(TClass *cl)
 {
    return (cl->GetMerge() || cl->InheritsFrom(TDirectory::Class()) ||
@@ -519,6 +620,10 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
          }
       }
    }
+   TStopwatch watch;
+   const Long64_t bytesRead = TFile::GetFileBytesRead();
+   const Long64_t bytesWritten = TFile::GetFileBytesWritten();
+
    // read object from first source file
    if (type & kIncremental) {
       if (!obj)
@@ -604,6 +709,7 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
             Error("MergeRecursive", "error merging RNTuples");
             return kFALSE;
          }
+         info.fReport = "RNTupleMerger";
       } else {
          TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
          Error("MergeRecursive", "Merging objects that don't inherit from TObject is unimplemented (key: %s of type %s in file %s)",
@@ -626,49 +732,69 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
          func(obj, &inputs, &info);
          info.fIsFirst = kFALSE;
       } else {
+         // The sources are taken by groups of fNThreads, whose keys are read concurrently
+         const std::size_t ngroup = fNThreads > 1 ? fNThreads : 1;
+         std::vector<TFile *> sources;
+         std::vector<TDirectory *> dirs;
+         std::vector<TKey *> keys;
+         std::vector<TObject *> objs;
          do {
-            // make sure we are at the correct directory level by cd'ing to path
-            TDirectory *ndir = getDirectory(nextsource, target->GetName(), path);
-            if (ndir) {
+            sources.clear();
+            dirs.clear();
+            keys.clear();
+            objs.clear();
+            for (; nextsource && sources.size() < ngroup; nextsource = (TFile *)sourcelist->After(nextsource)) {
+               // make sure we are at the correct directory level by cd'ing to path
+               TDirectory *ndir = getDirectory(nextsource, target->GetName(), path);
+               if (!ndir)
+                  continue;
                // For consistency (and persformance), we reset the MustCleanup be also for those
                // 'key' retrieved indirectly.
                // ndir->ResetBit(kMustCleanup);
-               ndir->cd();
                TObject *hobj = ndir->GetList()->FindObject(keyname);
-               if (!hobj) {
-                  TKey *key2 = (TKey*)ndir->GetListOfKeys()->FindObject(keyname);
-                  if (key2) {
-                     hobj = key2->ReadObj();
-                     if (!hobj) {
-                        Info("MergeRecursive", "could not read object for key {%s, %s}; skipping file %s",
-                           keyname, keytitle, nextsource->GetName());
-                              nextsource = (TFile*)sourcelist->After(nextsource);
-                              return kTRUE;
+               TKey *key2 = hobj ? nullptr : (TKey *)ndir->GetListOfKeys()->FindObject(keyname);
+               if (!hobj && !key2)
+                  continue;
+               sources.push_back(nextsource);
+               dirs.push_back(ndir);
+               keys.push_back(key2);
+               objs.push_back(hobj);
+            }
+            ReadKeys(dirs, keys, objs);
+
+            for (std::size_t isource = 0; isource < sources.size(); ++isource) {
+               dirs[isource]->cd();
+               TObject *hobj = objs[isource];
+               if (keys[isource]) {
+                  if (!hobj) {
+                     Info("MergeRecursive", "could not read object for key {%s, %s}; skipping file %s",
+                        keyname, keytitle, sources[isource]->GetName());
+                     for (std::size_t iother = isource + 1; iother < sources.size(); ++iother) {
+                        if (keys[iother])
+                           delete objs[iother];
                      }
-                     todelete.Add(hobj);
+                     return kTRUE;
                   }
+                  todelete.Add(hobj);
                }
-               if (hobj) {
-                  // Set ownership for collections
-                  if (hobj->InheritsFrom(TCollection::Class())) {
-                     ((TCollection*)hobj)->SetOwner();
-                  }
-                  hobj->ResetBit(kMustCleanup);
-                  inputs.Add(hobj);
-                  if (!oneGo) {
-                     ROOT::MergeFunc_t func = cl->GetMerge();
-                     Long64_t result = func(obj, &inputs, &info);
-                     info.fIsFirst = kFALSE;
-                     if (result < 0) {
-                        Error("MergeRecursive", "calling Merge() on '%s' with the corresponding object in '%s'",
-                              keyname, nextsource->GetName());
-                     }
-                     inputs.Clear();
-                     todelete.Delete();
+               // Set ownership for collections
+               if (hobj->InheritsFrom(TCollection::Class())) {
+                  ((TCollection*)hobj)->SetOwner();
+               }
+               hobj->ResetBit(kMustCleanup);
+               inputs.Add(hobj);
+               if (!oneGo) {
+                  ROOT::MergeFunc_t func = cl->GetMerge();
+                  Long64_t result = func(obj, &inputs, &info);
+                  info.fIsFirst = kFALSE;
+                  if (result < 0) {
+                     Error("MergeRecursive", "calling Merge() on '%s' with the corresponding object in '%s'",
+                           keyname, sources[isource]->GetName());
                   }
+                  inputs.Clear();
+                  todelete.Delete();
                }
             }
-            nextsource = (TFile*)sourcelist->After( nextsource );
          } while (nextsource);
          // Merge the list, if still to be done
          if (oneGo || info.fIsFirst) {
@@ -799,6 +925,23 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
          status = WriteOneAndDelete(oldkeyname, cl, obj, kTRUE, ownobj, target) && status;
       }
    }
+   if (fReport && !cl->InheritsFrom(TDirectory::Class())) {
+      watch.Stop();
+      TString method = info.fReport;
+      if (method.IsNull())
+         method = canBeMerged ? "Merge()" : "copied, not mergeable";
+      if (cl->InheritsFrom(R__TTree_Class)) {
+         if (!info.fOptions.Contains("fast"))
+            method += "; the fast cloning is disabled (SetFastMethod(kFALSE))";
+         else if (info.fOptions.Contains("recompress"))
+            method += "; the compression settings of the input and output files differ";
+      }
+      const Double_t elapsed = TMath::Max(watch.RealTime(), 1e-6);
+      Printf("%s Merged %s%s%s (%s) in %.3f s, read %.1f MB/s, written %.1f MB/s: %s", fMsgPrefix.Data(),
+             path.Data(), path.IsNull() ? "" : "/", oldkeyname.Data(), cl->GetName(), elapsed,
+             (TFile::GetFileBytesRead() - bytesRead) / elapsed / 1e6,
+             (TFile::GetFileBytesWritten() - bytesWritten) / elapsed / 1e6, method.Data());
+   }
    info.Reset();
    dirtodelete.Clear("nodelete");  // If needed the delete is done explicitly above.
    return kTRUE;
@@ -841,6 +984,9 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
    info.fOptions = fMergeOptions;
    if (fFastMethod && ((type&kKeepCompression) || !fCompressionChange) ) {
       info.fOptions.Append(" fast");
+   } else if (fFastMethod) {
+      // The baskets are copied without being unstreamed but need to be recompressed
+      info.fOptions.Append(" fast recompress");
    }
 
    TFile      *current_file;
@@ -960,13 +1106,45 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
 
    fOutputFile->SetBit(kMustCleanup);
 
+   // With several threads, a local output is written on the background thread of a write engine
+   // while the merging goes on.
+   if (fNThreads > 1 && fOutputFile->IsA() == TFile::Class() && fOutputFile->GetFd() >= 0 &&
+       !fOutputFile->GetCacheWrite()) {
+      ROOT::Internal::RFileWriteEngine::ROptions engineOptions;
+      new TFileCacheWrite(fOutputFile,
+                          std::make_unique<ROOT::Internal::RFileWriteEngine>(fOutputFile->GetFd(), engineOptions));
+   }
+
    TDirectory::TContext ctxt;
 
    Bool_t result = kTRUE;
    Int_t type = in_type;
    while (result && fFileList.GetEntries()>0) {
+      // Open the first files of the next set while this one is merged
+      std::vector<TFile *> prefetched;
+      std::thread prefetcher;
+      if (fNPrefetch > 0 && gGlobalMutex && fExcessFiles.GetEntries() > 0) {
+         std::vector<std::pair<TString, Bool_t>> urls;
+         TIter nexturl(&fExcessFiles);
+         while (auto url = (TObjString *)nexturl()) {
+            if ((Int_t)urls.size() >= TMath::Min(fNPrefetch, fMaxOpenedFiles - 1))
+               break;
+            urls.emplace_back(url->GetString(), url->TestBit(kCpProgress));
+         }
+         prefetched.resize(urls.size(), nullptr);
+         prefetcher = std::thread([this, urls, &prefetched]() {
+            TDirectory::TContext prefetchCtxt;
+            TString localcopy;
+            for (std::size_t i = 0; i < urls.size(); ++i)
+               prefetched[i] = R__OpenInput(urls[i].first, fLocal, urls[i].second, localcopy);
+         });
+      }
+
       result = MergeRecursive(fOutputFile, &fFileList, type);
 
+      if (prefetcher.joinable())
+         prefetcher.join();
+
       // Remove local copies if there are any
       TIter next(&fFileList);
       TFile *file;
@@ -988,7 +1166,40 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
          // sure we accumulate into the output, so we
          // switch to incremental merging (if not already set)
          type = type | kIncremental;
-         result = OpenExcessFiles();
+
+         // Bound the memory used by the objects merged so far: they are read back
+         // from the output when merging the next set.
+         ProcInfo_t procInfo;
+         if (fMaxMemory > 0 && gSystem->GetProcInfo(&procInfo) == 0 &&
+             (Long64_t)procInfo.fMemResident * 1024 > fMaxMemory) {
+            if (fPrintLevel > 0)
+               Printf("%s Flushing the merged objects (resident memory %ld kB)", fMsgPrefix.Data(),
+                      procInfo.fMemResident);
+            if (fOutputFile->Write("", TObject::kOverwrite) < 0)
+               result = kFALSE;
+            R__DeleteWrittenObjects(fOutputFile);
+         }
+
+         // Take the files opened in the background, up to the first that could not be opened;
+         // OpenExcessFiles() then reports the error.
+         Bool_t usable = result;
+         for (auto file : prefetched) {
+            if (usable && file && !file->IsZombie()) {
+               if (fOutputFile->GetCompressionLevel() != file->GetCompressionLevel())
+                  fCompressionChange = kTRUE;
+               file->SetBit(kCanDelete);
+               fFileList.Add(file);
+               delete fExcessFiles.Remove(fExcessFiles.First());
+            } else {
+               usable = kFALSE;
+               delete file;
+            }
+         }
+         if (result)
+            result = OpenExcessFiles();
+      } else {
+         for (auto file : prefetched)
+            delete file;
       }
    }
    if (!result) {
@@ -1033,25 +1244,15 @@ Bool_t TFileMerger::OpenExcessFiles()
    if (fPrintLevel > 0) {
       Printf("%s Opening the next %d files", fMsgPrefix.Data(), TMath::Min(fExcessFiles.GetEntries(), fMaxOpenedFiles - 1));
    }
-   Int_t nfiles = 0;
+   // Files opened in the background (see PartialMerge()) are already in the list
+   Int_t nfiles = fFileList.GetEntries();
    TIter next(&fExcessFiles);
    TObjString *url = 0;
    TString localcopy;
    // We want gDirectory untouched by anything going on here
    TDirectory::TContext ctxt;
    while( nfiles < (fMaxOpenedFiles-1) && ( url = (TObjString*)next() ) ) {
-      TFile *newfile = 0;
-      if (fLocal) {
-         TUUID uuid;
-         localcopy.Form("file:%s/ROOTMERGE-%s.root", gSystem->TempDirectory(), uuid.AsString());
-         if (!TFile::Cp(url->GetName(), localcopy, url->TestBit(kCpProgress))) {
-            Error("OpenExcessFiles", "cannot get a local copy of file %s", url->GetName());
-            return kFALSE;
-         }
-         newfile = TFile::Open(localcopy, "READ");
-      } else {
-         newfile = TFile::Open(url->GetName(), "READ");
-      }
+      TFile *newfile = R__OpenInput(url->GetName(), fLocal, url->TestBit(kCpProgress), localcopy);
 
       if (!newfile) {
          if (fLocal)
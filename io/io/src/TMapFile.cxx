@@ -53,6 +53,12 @@ classes don't provide these copy ctor's, especially not when objects
 contain collections, etc. 2) is too limiting or dangerous (calling
 accidentally a virtual function will segv). So since we have a
 robust Streamer mechanism I opted for 3).
+
+For objects deriving from a TArray, e.g. histograms, the content of the
+array can also be published directly with UpdateArray(). Consumers first
+Get() the object and then refresh its content with GetArray(), which
+neither locks the map file nor streams the object; a sequence number
+(seqlock) lets them detect and retry reads overlapping an update.
 **/
 
 
@@ -98,9 +104,18 @@ robust Streamer mechanism I opted for 3).
 #include "TROOT.h"
 #include "TBufferFile.h"
 #include "TVirtualMutex.h"
+#include "TArrayC.h"
+#include "TArrayD.h"
+#include "TArrayF.h"
+#include "TArrayI.h"
+#include "TArrayL.h"
+#include "TArrayL64.h"
+#include "TArrayS.h"
 #include "mmprivate.h"
 
 #include <cmath>
+#include <cstring>
+#include <thread>
 
 #if defined(R__UNIX) && !defined(R__MACOSX) && !defined(R__WINGCC)
 #define HAVE_SEMOP
@@ -138,6 +153,29 @@ namespace {
       }
       return false;
    }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the address and size in bytes of the content of the Array_t obj
+/// derives from, return false if it does not derive from one.
+   template <typename Array_t>
+   static bool GetContentOf(TObject *obj, void *&data, Int_t &nbytes) {
+      auto array = dynamic_cast<Array_t *>(obj);
+      if (!array)
+         return false;
+      data = array->GetArray();
+      nbytes = array->GetSize() * sizeof(*array->GetArray());
+      return true;
+   }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the address and size in bytes of the content of the TArray obj
+/// derives from, return false if it does not derive from one.
+   static bool GetArrayContent(TObject *obj, void *&data, Int_t &nbytes) {
+      return GetContentOf<TArrayD>(obj, data, nbytes) || GetContentOf<TArrayF>(obj, data, nbytes) ||
+             GetContentOf<TArrayI>(obj, data, nbytes) || GetContentOf<TArrayS>(obj, data, nbytes) ||
+             GetContentOf<TArrayC>(obj, data, nbytes) || GetContentOf<TArrayL64>(obj, data, nbytes) ||
+             GetContentOf<TArrayL>(obj, data, nbytes);
+   }
 }
 
 
@@ -165,6 +203,9 @@ TMapRec::TMapRec(const char *name, const TObject *obj, Int_t size, void *buf)
    fBuffer    = buf;
    fBufSize   = size;
    fNext      = 0;
+   fArray     = 0;
+   fArraySize = 0;
+   fArraySeq  = 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -174,6 +215,7 @@ TMapRec::~TMapRec()
 {
    delete [] fName;
    delete [] fClassName;
+   delete [] (char *)fArray;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -666,6 +708,65 @@ void TMapFile::Update(TObject *obj)
    ReleaseSemaphore();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Update in shared memory the content of the TArray obj derives from, e.g.
+/// the bin contents of a histogram, without streaming the object.
+///
+/// The object must have been added with Add(); its other data members (e.g.
+/// the axes or the statistics of a histogram) are only updated by Update(),
+/// which is called the first time if needed. Consumers read the content with
+/// GetArray(); the readers are not locked out, they retry the reads which
+/// overlap an update. If the size of the array changes, e.g. because the histogram
+/// was rebinned, the object is streamed by Update() from then on and GetArray()
+/// fails: consumers must Get() it again.
+
+void TMapFile::UpdateArray(TObject *obj)
+{
+   if (!fWritable || !fMmallocDesc || !obj) return;
+
+   void *data;
+   Int_t nbytes;
+   if (!GetArrayContent(obj, data, nbytes)) {
+      Error("UpdateArray", "%s does not derive from a TArray, use Update()", obj->GetName());
+      return;
+   }
+
+   TMapRec *mr = fFirst;
+   while (mr && mr->fObject != obj)
+      mr = mr->fNext;
+   if (!mr) {
+      Error("UpdateArray", "%s has not been added to the map file", obj->GetName());
+      return;
+   }
+
+   if (!mr->fArray) {
+      if (!mr->fBufSize)
+         Update(obj);
+
+      AcquireSemaphore();
+      ROOT::Internal::gMmallocDesc = fMmallocDesc;
+      char *array = new char[nbytes > 0 ? nbytes : 1];
+      ROOT::Internal::gMmallocDesc = nullptr;
+      mr->fArraySize = nbytes;
+      mr->fArray = array;
+      ReleaseSemaphore();
+   }
+
+   // The content is never reallocated: a consumer might still be reading it.
+   const Bool_t sameSize = mr->fArraySize == nbytes;
+   const UInt_t seq = mr->fArraySeq.load(std::memory_order_relaxed);
+   mr->fArraySeq.store(seq + 1, std::memory_order_relaxed);
+   std::atomic_thread_fence(std::memory_order_release);
+   if (sameSize)
+      memcpy(mr->fArray, data, nbytes);
+   else
+      mr->fArraySize = 0;
+   mr->fArraySeq.store(seq + 2, std::memory_order_release);
+
+   if (!sameSize)
+      Update(obj);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Remove object from shared memory.
 ///
@@ -815,6 +916,49 @@ release:
    return obj;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Copy into the TArray obj derives from the content published by the producer
+/// with UpdateArray() for the object with the given name, without streaming
+/// the object and without locking the map file. obj is typically the object
+/// previously returned by Get(), the array must have the same type and size.
+///
+/// Returns kFALSE if there is no such object, if its content is not published
+/// or if it does not match obj; Get() must then be used to read the object.
+/// Note that the object itself, e.g. the statistics of a histogram, is not
+/// updated (see TH1::ResetStats()). The objects of the map file must not be
+/// removed while consumers read them this way.
+
+Bool_t TMapFile::GetArray(const char *name, TObject *obj) const
+{
+   if (!fMmallocDesc || !obj) return kFALSE;
+
+   void *data;
+   Int_t nbytes;
+   if (!GetArrayContent(obj, data, nbytes))
+      return kFALSE;
+
+   TMapRec *mr = GetFirst();
+   while (OrgAddress(mr) && strcmp(mr->GetName(fOffset), name))
+      mr = mr->GetNext(fOffset);
+   if (!OrgAddress(mr))
+      return kFALSE;
+
+   while (true) {
+      const UInt_t seq = mr->fArraySeq.load(std::memory_order_acquire);
+      if (seq & 1) {
+         // The producer is updating the content.
+         std::this_thread::yield();
+         continue;
+      }
+      const Bool_t match = mr->fArray && mr->fArraySize == nbytes;
+      if (match)
+         memcpy(data, (char *)mr->fArray + fOffset, nbytes);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (mr->fArraySeq.load(std::memory_order_relaxed) == seq)
+         return match;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create semaphore used for synchronizing access to shared memory.
 
@@ -27,6 +27,7 @@ only from memory.
 #include "TKey.h"
 #include "TClass.h"
 #include "TVirtualMutex.h"
+#include "TFileCacheWrite.h"
 #include <errno.h>
 #include <stdio.h>
 #include <sys/stat.h>
@@ -107,17 +108,31 @@ TMemFile::EMode TMemFile::ParseOption(Option_t *option)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor to create a TMemFile re-using external C-Style storage.
+///
+/// With the option "READ" (default) the file is read-only. With the option
+/// "UPDATE" the file can be written to: the external data is then copied, and
+/// no longer used, the first time the file is written to (copy-on-write).
+/// Closing a file which was not written to does not copy the data.
 
-TMemFile::TMemFile(const char *path, const ZeroCopyView_t &datarange)
+TMemFile::TMemFile(const char *path, const ZeroCopyView_t &datarange, Option_t *option)
    : TFile(path, "WEB", "read-only TMemFile", 0 /*compress*/),
      fBlockList(reinterpret_cast<UChar_t *>(const_cast<char *>(datarange.fStart)), datarange.fSize),
      fSize(datarange.fSize), fBlockSeek(&(fBlockList))
 {
    fD = 0;
-   fOption = "READ";
-   fWritable = kFALSE;
+   EMode optmode = ParseOption(option);
+   if (!NeedsExistingFile(optmode)) {
+      Error("TMemFile", "file %s re-uses external data, it can only be opened in READ or UPDATE mode", path);
+      MakeZombie();
+      gDirectory = gROOT;
+      return;
+   }
+   fWritable = NeedsToWrite(optmode);
+   fIsCopyOnWrite = fWritable;
+   if (fIsCopyOnWrite)
+      SetTitle("copy-on-write TMemFile");
 
-   // This is read-only, so become a zombie if created with an empty buffer
+   // The data is read first, so become a zombie if created with an empty buffer
    if (!fBlockList.fBuffer) {
       MakeZombie();
       gDirectory = gROOT;
@@ -129,11 +144,14 @@ TMemFile::TMemFile(const char *path, const ZeroCopyView_t &datarange)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor to create a TMemFile re-using external storage.
+/// See the constructor taking a ZeroCopyView_t for the supported options.
 
-TMemFile::TMemFile(const char *path, ExternalDataPtr_t data)
-   : TMemFile(path, ZeroCopyView_t(data->data(), data->size()))
+TMemFile::TMemFile(const char *path, ExternalDataPtr_t data, Option_t *option)
+   : TMemFile(path, ZeroCopyView_t(data->data(), data->size()), option)
 {
-   fExternalData = data;
+   // Unless it was already copied while initializing the file.
+   if (IsExternalData())
+      fExternalData = data;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////
@@ -284,6 +302,49 @@ void TMemFile::CopyTo(TBuffer &tobuf) const
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the memory blocks holding the binary representation of the TMemFile,
+/// in order, i.e. the content copied by CopyTo().  They can be used to send the
+/// file without copying it, e.g. as the `iovec` array of a scatter-gather write.
+/// The blocks are valid until the file is written to, reset or destroyed.
+
+std::vector<TMemFile::ZeroCopyView_t> TMemFile::GetBlocks() const
+{
+   std::vector<ZeroCopyView_t> blocks;
+   const TMemBlock *current = &fBlockList;
+   while(current) {
+      if (current->fBuffer)
+         blocks.emplace_back(reinterpret_cast<const char *>(current->fBuffer), current->fSize);
+      current = current->fNext;
+   }
+   return blocks;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Close the file.  A copy-on-write file which was not written to is closed as
+/// a read-only file, its header is not updated and its external data is not copied.
+
+void TMemFile::Close(Option_t *option)
+{
+   if (fIsCopyOnWrite && IsExternalData() && !(fCacheWrite && fCacheWrite->GetBytesInCache()))
+      fWritable = kFALSE;
+   TFile::Close(option);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the external data of a copy-on-write file into a block owned by the
+/// TMemFile, from which the file is read from and written to from now on.
+
+void TMemFile::CopyExternalData()
+{
+   R__ASSERT(IsExternalData() && !fBlockList.fNext);
+   UChar_t *buffer = new UChar_t[fBlockList.fSize];
+   memcpy(buffer, fBlockList.fBuffer, fBlockList.fSize);
+   fBlockList.fBuffer = buffer;
+   fIsOwnedByROOT = kTRUE;
+   fExternalData.reset();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the current size of the memory file
 
@@ -600,8 +661,11 @@ Int_t TMemFile::SysWriteImpl(Int_t /* fd */, const void *buf, Long64_t len)
    TRACE("WRITE")
 
    if (IsExternalData()) {
-      gSystem->SetErrorStr("A memory file with shared data is read-only.");
-      return 0;
+      if (!fIsCopyOnWrite) {
+         gSystem->SetErrorStr("A memory file with shared data is read-only.");
+         return 0;
+      }
+      CopyExternalData();
    }
 
    if (fBlockList.fBuffer == 0) {
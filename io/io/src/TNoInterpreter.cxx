@@ -0,0 +1,505 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/**
+\class TNoInterpreter
+\ingroup IO
+
+TNoInterpreter is the TInterpreter used by compiled programs which run
+without the C++ interpreter (see TROOT::DisableInterpreter()).
+
+It only provides what the I/O needs from an interpreter: it registers the
+compiled dictionaries of the libraries, reading the TProtoClass, TEnum and
+typedef information of their rdict.pcm file, and it loads shared libraries
+with dlopen. The TClass objects are then set up from the dictionaries and
+the rdict.pcm information only, and the classes without dictionary are
+emulated from the streamer infos of the files being read.
+
+Everything that requires a C++ interpreter, e.g. ProcessLine(), macros,
+method calls through TMethodCall, or the plugins of TPluginManager (which
+are created by calling their constructor through a TMethodCall), is not
+available and reports an error.
+*/
+
+#include "TInterpreter.h"
+
+#include "TClass.h"
+#include "TClassEdit.h"
+#include "TClassTable.h"
+#include "TDataType.h"
+#include "TDirectory.h"
+#include "TEnum.h"
+#include "TError.h"
+#include "TFile.h"
+#include "THashList.h"
+#include "TKey.h"
+#include "TList.h"
+#include "TObjArray.h"
+#include "TProtoClass.h"
+#include "TROOT.h"
+#include "TStreamerInfo.h"
+#include "TString.h"
+#include "TSystem.h"
+
+#include <dlfcn.h>
+
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+class TNoInterpreter : public TInterpreter {
+private:
+   std::set<std::string> fLoadedLibraries; ///< Libraries loaded through Load()
+   TString fSharedLibs;                     ///< Space separated list of fLoadedLibraries
+   TString fIncludePath;                    ///< Include paths added by the dictionaries, for GetIncludePath()
+   Bool_t fIsAutoParsingSuspended = kFALSE;
+   Bool_t fErrorMessages = kTRUE;
+   Bool_t fProcessLineLock = kTRUE;
+   char fPrompt[1] = {0};
+
+   void LoadPCM(const std::string &pcmFileName);
+   void NotAvailable(const char *method) const
+   {
+      ::Error(method, "not available: ROOT runs without the C++ interpreter");
+   }
+   Longptr_t NotAvailable(const char *method, EErrorCode *error) const
+   {
+      NotAvailable(method);
+      if (error)
+         *error = kFatal;
+      return 0;
+   }
+
+protected:
+   void Execute(TMethod *, TObjArray *, int *error = nullptr) override
+   {
+      NotAvailable("TNoInterpreter::Execute");
+      if (error)
+         *error = kFatal;
+   }
+   Bool_t SetSuspendAutoParsing(Bool_t value) override
+   {
+      Bool_t old = fIsAutoParsingSuspended;
+      fIsAutoParsingSuspended = value;
+      return old;
+   }
+
+public:
+   TNoInterpreter() : TInterpreter("NoInterpreter", "I/O without C++ interpreter") {}
+
+   Bool_t IsAutoParsingSuspended() const override { return fIsAutoParsingSuspended; }
+
+   void AddIncludePath(const char *path) override
+   {
+      fIncludePath += " -I";
+      fIncludePath += path;
+   }
+   Int_t AutoLoad(const char *, Bool_t = kFALSE) override { return 0; }
+   Int_t AutoLoad(const std::type_info &, Bool_t = kFALSE) override { return 0; }
+   Int_t AutoParse(const char *) override { return 0; }
+   void ClearFileBusy() override {}
+   void ClearStack() override {}
+   Bool_t Declare(const char *) override
+   {
+      NotAvailable("TNoInterpreter::Declare");
+      return kFALSE;
+   }
+   void EndOfLineAction() override {}
+   TClass *GetClass(const std::type_info &, Bool_t) const override { return nullptr; }
+   Int_t GetExitCode() const override { return 0; }
+   Int_t GetMore() const override { return 0; }
+   TClass *GenerateTClass(const char *classname, Bool_t emulation, Bool_t silent = kFALSE) override;
+   TClass *GenerateTClass(ClassInfo_t *, Bool_t = kFALSE) override { return nullptr; }
+   Int_t GenerateDictionary(const char *, const char * = nullptr, const char * = nullptr) override
+   {
+      NotAvailable("TNoInterpreter::GenerateDictionary");
+      return 0;
+   }
+   char *GetPrompt() override { return fPrompt; }
+   const char *GetSharedLibs() override { return fSharedLibs.Data(); }
+   const char *GetClassSharedLibs(const char *) override { return nullptr; }
+   const char *GetSharedLibDeps(const char *, bool = false) override { return nullptr; }
+   const char *GetIncludePath() override { return fIncludePath.Data(); }
+   TObjArray *GetRootMapFiles() const override { return nullptr; }
+   void Initialize() override;
+   void ShutDown() override {}
+   void InspectMembers(TMemberInspector &, const void *, const TClass *, Bool_t) override {}
+   Bool_t IsLoaded(const char *filename) const override { return IsLibraryLoaded(filename); }
+   Bool_t IsLibraryLoaded(const char *libname) const override;
+   Bool_t HasPCMForLibrary(const char *) const override { return kFALSE; }
+   Int_t Load(const char *filenam, Bool_t system = kFALSE) override;
+   void LoadMacro(const char *, EErrorCode *error = nullptr) override
+   {
+      NotAvailable("TNoInterpreter::LoadMacro", error);
+   }
+   Int_t LoadLibraryMap(const char * = nullptr) override { return 0; }
+   Int_t RescanLibraryMap() override { return 0; }
+   Int_t ReloadAllSharedLibraryMaps() override { return 0; }
+   Int_t UnloadAllSharedLibraryMaps() override { return 0; }
+   Int_t UnloadLibraryMap(const char *) override { return 0; }
+   Longptr_t ProcessLine(const char *, EErrorCode *error = nullptr) override
+   {
+      return NotAvailable("TNoInterpreter::ProcessLine", error);
+   }
+   Longptr_t ProcessLineSynch(const char *line, EErrorCode *error = nullptr) override
+   {
+      return ProcessLine(line, error);
+   }
+   void PrintIntro() override {}
+   bool RegisterPrebuiltModulePath(const std::string &, const std::string & = "module.modulemap") const override
+   {
+      return false;
+   }
+   void RegisterModule(const char *modulename, const char **headers, const char **includePaths,
+                       const char *payloadCode, const char *fwdDeclsCode, void (*triggerFunc)(),
+                       const FwdDeclArgsToKeepCollection_t &fwdDeclArgsToKeep, const char **classesHeaders,
+                       Bool_t lateRegistration = false, Bool_t hasCxxModule = false) override;
+   void AddAvailableIndentifiers(TSeqCollection &) override {}
+   void RegisterTClassUpdate(TClass *, DictFuncPtr_t) override {}
+   void UnRegisterTClassUpdate(const TClass *) override {}
+   Int_t SetClassSharedLibs(const char *, const char *) override { return 0; }
+   void SetGetline(const char *(*)(const char *), void (*)(const char *)) override {}
+   void Reset() override {}
+   void ResetAll() override {}
+   void ResetGlobals() override {}
+   void ResetGlobalVar(void *) override {}
+   void RewindDictionary() override {}
+   Int_t DeleteGlobal(void *) override { return 0; }
+   Int_t DeleteVariable(const char *) override { return 0; }
+   void SaveContext() override {}
+   void SaveGlobalsContext() override {}
+   void UpdateListOfGlobals() override {}
+   void UpdateListOfGlobalFunctions() override {}
+   void UpdateListOfTypes() override {}
+   void SetClassInfo(TClass *, Bool_t = kFALSE) override {}
+   ECheckClassInfo CheckClassInfo(const char *, Bool_t, Bool_t = kFALSE) override { return kUnknown; }
+   Bool_t CheckClassTemplate(const char *) override { return kFALSE; }
+   Longptr_t Calc(const char *, EErrorCode *error = nullptr) override
+   {
+      return NotAvailable("TNoInterpreter::Calc", error);
+   }
+   void CreateListOfBaseClasses(TClass *) const override {}
+   void CreateListOfDataMembers(TClass *) const override {}
+   void CreateListOfMethods(TClass *) const override {}
+   void CreateListOfMethodArgs(TFunction *) const override {}
+   void UpdateListOfMethods(TClass *) const override {}
+   TString GetMangledName(TClass *, const char *, const char *, Bool_t = kFALSE) override { return ""; }
+   TString GetMangledNameWithPrototype(TClass *, const char *, const char *, Bool_t = kFALSE,
+                                       ROOT::EFunctionMatchMode = ROOT::kConversionMatch) override
+   {
+      return "";
+   }
+   void GetInterpreterTypeName(const char *name, std::string &output, Bool_t = kFALSE) override { output = name; }
+   void *GetInterfaceMethod(TClass *, const char *, const char *, Bool_t = kFALSE) override { return nullptr; }
+   void *GetInterfaceMethodWithPrototype(TClass *, const char *, const char *, Bool_t = kFALSE,
+                                         ROOT::EFunctionMatchMode = ROOT::kConversionMatch) override
+   {
+      return nullptr;
+   }
+   void Execute(const char *, const char *, int *error = nullptr) override
+   {
+      Execute(static_cast<TMethod *>(nullptr), nullptr, error);
+   }
+   void Execute(TObject *, TClass *, const char *, const char *, int *error = nullptr) override
+   {
+      Execute(static_cast<TMethod *>(nullptr), nullptr, error);
+   }
+   void Execute(TObject *, TClass *, TMethod *, TObjArray *, int *error = nullptr) override
+   {
+      Execute(static_cast<TMethod *>(nullptr), nullptr, error);
+   }
+   void ExecuteWithArgsAndReturn(TMethod *, void *, const void *[] = nullptr, int = 0, void * = nullptr) const override
+   {
+      NotAvailable("TNoInterpreter::ExecuteWithArgsAndReturn");
+   }
+   Longptr_t ExecuteMacro(const char *, EErrorCode *error = nullptr) override
+   {
+      return NotAvailable("TNoInterpreter::ExecuteMacro", error);
+   }
+   Bool_t IsErrorMessagesEnabled() const override { return fErrorMessages; }
+   Bool_t SetErrorMessages(Bool_t enable = kTRUE) override
+   {
+      Bool_t old = fErrorMessages;
+      fErrorMessages = enable;
+      return old;
+   }
+   Bool_t IsProcessLineLocked() const override { return fProcessLineLock; }
+   void SetProcessLineLock(Bool_t lock = kTRUE) override { fProcessLineLock = lock; }
+   const char *TypeName(const char *s) override;
+   std::string ToString(const char *, void *) override { return ""; }
+
+   void SnapshotMutexState(ROOT::TVirtualRWMutex *) override {}
+   void ForgetMutexState() override {}
+
+   void *FindSym(const char *entry) const override { return dlsym(RTLD_DEFAULT, entry); }
+
+   EReturnType MethodCallReturnType(TFunction *) const override { return EReturnType::kOther; }
+   ULong64_t GetInterpreterStateMarker() const override { return 0; }
+   bool DiagnoseIfInterpreterException(const std::exception &) const override { return false; }
+
+   DeclId_t GetDeclId(CallFunc_t *) const override { return nullptr; }
+   DeclId_t GetDeclId(ClassInfo_t *) const override { return nullptr; }
+   DeclId_t GetDeclId(DataMemberInfo_t *) const override { return nullptr; }
+   DeclId_t GetDeclId(FuncTempInfo_t *) const override { return nullptr; }
+   DeclId_t GetDeclId(MethodInfo_t *) const override { return nullptr; }
+   DeclId_t GetDeclId(TypedefInfo_t *) const override { return nullptr; }
+
+   void SetDeclAttr(DeclId_t, const char *) override {}
+
+   DeclId_t GetDataMember(ClassInfo_t *, const char *) const override { return nullptr; }
+   DeclId_t GetDataMemberAtAddr(const void *) const override { return nullptr; }
+   DeclId_t GetDataMemberWithValue(const void *) const override { return nullptr; }
+   DeclId_t GetEnum(TClass *, const char *) const override { return nullptr; }
+   TEnum *CreateEnum(void *, TClass *) const override { return nullptr; }
+   void UpdateEnumConstants(TEnum *, TClass *) const override {}
+   void LoadEnums(TListOfEnums &) const override {}
+   DeclId_t GetFunction(ClassInfo_t *, const char *) override { return nullptr; }
+   DeclId_t GetFunctionWithPrototype(ClassInfo_t *, const char *, const char *, Bool_t = kFALSE,
+                                     ROOT::EFunctionMatchMode = ROOT::kConversionMatch) override
+   {
+      return nullptr;
+   }
+   DeclId_t GetFunctionWithValues(ClassInfo_t *, const char *, const char *, Bool_t = kFALSE) override
+   {
+      return nullptr;
+   }
+   DeclId_t GetFunctionTemplate(ClassInfo_t *, const char *) override { return nullptr; }
+   void GetFunctionOverloads(ClassInfo_t *, const char *, std::vector<DeclId_t> &) const override {}
+   void LoadFunctionTemplates(TClass *) const override {}
+   std::vector<std::string> GetUsingNamespaces(ClassInfo_t *) const override { return {}; }
+
+   void CallFunc_SetArg(CallFunc_t *, Long_t) const override {}
+   void CallFunc_SetArg(CallFunc_t *, ULong_t) const override {}
+   void CallFunc_SetArg(CallFunc_t *, Float_t) const override {}
+   void CallFunc_SetArg(CallFunc_t *, Double_t) const override {}
+   void CallFunc_SetArg(CallFunc_t *, Long64_t) const override {}
+   void CallFunc_SetArg(CallFunc_t *, ULong64_t) const override {}
+   void CallFunc_SetFuncProto(CallFunc_t *, ClassInfo_t *, const char *, const std::vector<TypeInfo_t *> &,
+                              Longptr_t *, ROOT::EFunctionMatchMode = ROOT::kConversionMatch) const override
+   {
+   }
+   void CallFunc_SetFuncProto(CallFunc_t *, ClassInfo_t *, const char *, const std::vector<TypeInfo_t *> &, bool,
+                              Longptr_t *, ROOT::EFunctionMatchMode = ROOT::kConversionMatch) const override
+   {
+   }
+   std::string CallFunc_GetWrapperCode(CallFunc_t *) const override { return ""; }
+
+   Bool_t ClassInfo_Contains(ClassInfo_t *, DeclId_t) const override { return kFALSE; }
+   ClassInfo_t *ClassInfo_Factory(Bool_t = kTRUE) const override { return nullptr; }
+   ClassInfo_t *ClassInfo_Factory(ClassInfo_t *) const override { return nullptr; }
+   ClassInfo_t *ClassInfo_Factory(const char *) const override { return nullptr; }
+   ClassInfo_t *ClassInfo_Factory(DeclId_t) const override { return nullptr; }
+
+   ClassInfo_t *BaseClassInfo_ClassInfo(BaseClassInfo_t *) const override { return nullptr; }
+
+   DataMemberInfo_t *DataMemberInfo_Factory(DeclId_t, ClassInfo_t *) const override { return nullptr; }
+
+   void FuncTempInfo_Delete(FuncTempInfo_t *) const override {}
+   FuncTempInfo_t *FuncTempInfo_Factory(DeclId_t) const override { return nullptr; }
+   FuncTempInfo_t *FuncTempInfo_FactoryCopy(FuncTempInfo_t *) const override { return nullptr; }
+   Bool_t FuncTempInfo_IsValid(FuncTempInfo_t *) const override { return kFALSE; }
+   UInt_t FuncTempInfo_TemplateNargs(FuncTempInfo_t *) const override { return 0; }
+   UInt_t FuncTempInfo_TemplateMinReqArgs(FuncTempInfo_t *) const override { return 0; }
+   Long_t FuncTempInfo_Property(FuncTempInfo_t *) const override { return 0; }
+   Long_t FuncTempInfo_ExtraProperty(FuncTempInfo_t *) const override { return 0; }
+   void FuncTempInfo_Name(FuncTempInfo_t *, TString &name) const override { name = ""; }
+   void FuncTempInfo_Title(FuncTempInfo_t *, TString &title) const override { title = ""; }
+
+   MethodInfo_t *MethodInfo_Factory(DeclId_t) const override { return nullptr; }
+   Long_t MethodInfo_Property(MethodInfo_t *) const override { return 0; }
+   Long_t MethodInfo_ExtraProperty(MethodInfo_t *) const override { return 0; }
+   EReturnType MethodInfo_MethodCallReturnType(MethodInfo_t *) const override { return EReturnType::kOther; }
+
+   std::string MethodArgInfo_TypeNormalizedName(MethodArgInfo_t *) const override { return ""; }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set up the streamer info factory, which is otherwise created through the
+/// plugin manager, and read the I/O customization rules.
+
+void TNoInterpreter::Initialize()
+{
+   TVirtualStreamerInfo::SetFactory(new TStreamerInfo());
+   TClass::ReadRules();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create an emulated TClass for a class without dictionary, like TCling
+/// does for classes it does not know either.
+
+TClass *TNoInterpreter::GenerateTClass(const char *classname, Bool_t emulation, Bool_t silent)
+{
+   Version_t version = 1;
+   if (TClassEdit::IsSTLCont(classname))
+      version = TClass::GetClass("TVirtualStreamerInfo")->GetClassVersion();
+   R__LOCKGUARD(gInterpreterMutex);
+   TClass *cl = new TClass(classname, version, silent);
+   if (emulation)
+      cl->SetBit(TClass::kIsEmulation);
+   return cl;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns whether a library was loaded through Load(), or is linked to the
+/// program.
+
+Bool_t TNoInterpreter::IsLibraryLoaded(const char *libname) const
+{
+   if (!libname || !*libname)
+      return kFALSE;
+   if (fLoadedLibraries.count(libname))
+      return kTRUE;
+   void *handle = dlopen(libname, RTLD_LAZY | RTLD_NOLOAD);
+   if (handle)
+      dlclose(handle);
+   return handle != nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Load a shared library, whose path is resolved by TSystem::Load(). The
+/// dictionaries it contains register themselves through RegisterModule().
+/// Returns 0 on success, 1 if the library was already loaded, -1 on failure.
+
+Int_t TNoInterpreter::Load(const char *filenam, Bool_t system)
+{
+   R__LOCKGUARD(gInterpreterMutex);
+   if (fLoadedLibraries.count(filenam))
+      return 1;
+   if (!dlopen(filenam, RTLD_LAZY | RTLD_GLOBAL)) {
+      if (!system)
+         ::Error("TNoInterpreter::Load", "%s", dlerror());
+      return -1;
+   }
+   fLoadedLibraries.insert(filenam);
+   if (!fSharedLibs.IsNull())
+      fSharedLibs += " ";
+   fSharedLibs += filenam;
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register the dictionary of a library: the rdict.pcm file next to the
+/// library (or program) containing the dictionary provides the TProtoClass
+/// objects from which the TClass objects are set up. The headers, payload
+/// and forward declarations are only needed by an interpreter.
+
+void TNoInterpreter::RegisterModule(const char *modulename, const char ** /*headers*/, const char **includePaths,
+                                    const char * /*payloadCode*/, const char * /*fwdDeclsCode*/,
+                                    void (*triggerFunc)(), const FwdDeclArgsToKeepCollection_t & /*fwdDeclArgsToKeep*/,
+                                    const char ** /*classesHeaders*/, Bool_t /*lateRegistration*/,
+                                    Bool_t /*hasCxxModule*/)
+{
+   for (const char **inclPath = includePaths; inclPath && *inclPath; ++inclPath)
+      AddIncludePath(*inclPath);
+
+   Dl_info info;
+   if (!triggerFunc || !dladdr(reinterpret_cast<void *>(triggerFunc), &info) || !info.dli_fname) {
+      ::Error("TNoInterpreter::RegisterModule", "Dictionary trigger function for %s not found", modulename);
+      return;
+   }
+
+   TString pcmFileName = TString(modulename) + "_rdict.pcm";
+   gSystem->PrependPathName(gSystem->GetDirName(info.dli_fname), pcmFileName);
+   if (gSystem->AccessPathName(pcmFileName)) {
+      // With C++ modules, the rdict.pcm content is stored in the module file
+      // which only the interpreter can read.
+      if (gDebug > 0)
+         ::Info("TNoInterpreter::RegisterModule", "No %s for %s", pcmFileName.Data(), modulename);
+      return;
+   }
+   LoadPCM(pcmFileName.Data());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the TProtoClass, TEnum and typedef information of a rdict.pcm file,
+/// like TCling::LoadPCM().
+
+void TNoInterpreter::LoadPCM(const std::string &pcmFileName)
+{
+   TDirectory::TContext ctxt;
+   TFile pcmFile((pcmFileName + "?filetype=pcm").c_str(), "READ");
+   if (pcmFile.IsZombie())
+      return;
+
+   TObjArray *enums = nullptr;
+   pcmFile.GetObject("__Enums", enums);
+   if (enums) {
+      // Only the global enums are registered, the TClass objects of the
+      // scopes of the other ones get them from their TProtoClass.
+      auto listOfEnums = dynamic_cast<THashList *>(gROOT->GetListOfEnums());
+      auto listOfGlobals = gROOT->GetListOfGlobals();
+      TIter next(enums);
+      while (auto selEnum = static_cast<TEnum *>(next())) {
+         if (strcmp(selEnum->GetTitle(), "") != 0 || !listOfEnums ||
+             listOfEnums->THashList::FindObject(selEnum->GetName())) {
+            delete selEnum;
+            continue;
+         }
+         selEnum->SetClass(nullptr);
+         listOfEnums->Add(selEnum);
+         for (auto enumConstant : *selEnum->GetConstants()) {
+            if (!listOfGlobals->FindObject(enumConstant))
+               listOfGlobals->Add(enumConstant);
+         }
+      }
+      enums->Clear();
+      delete enums;
+   }
+
+   TObjArray *protoClasses = nullptr;
+   pcmFile.GetObject("__ProtoClasses", protoClasses);
+   if (protoClasses) {
+      for (auto obj : *protoClasses)
+         TClassTable::Add(static_cast<TProtoClass *>(obj));
+      protoClasses->Clear(); // Ownership was transfered to TClassTable.
+      delete protoClasses;
+   }
+
+   TObjArray *dataTypes = nullptr;
+   pcmFile.GetObject("__Typedefs", dataTypes);
+   if (dataTypes) {
+      for (auto typedf : *dataTypes)
+         gROOT->GetListOfTypes()->Add(typedf);
+      dataTypes->Clear(); // Ownership was transfered to TListOfTypes.
+      delete dataTypes;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name of the type `s` without its qualifiers, pointers and
+/// references, e.g. "TNamed" for "const TNamed*&".
+
+const char *TNoInterpreter::TypeName(const char *s)
+{
+   thread_local std::string result;
+   result = s ? s : "";
+   if (result.compare(0, 6, "const ") == 0)
+      result.erase(0, 6);
+   auto end = result.find_first_of("*&");
+   if (end != std::string::npos)
+      result.erase(end);
+   while (!result.empty() && result.back() == ' ')
+      result.pop_back();
+   return result.c_str();
+}
+
+} // namespace
+
+extern "C" R__DLLEXPORT TInterpreter *CreateNoInterpreter(void * /*interpLibHandle*/, const char * /*argv*/[])
+{
+   return new TNoInterpreter();
+}
+
+extern "C" R__DLLEXPORT void DestroyNoInterpreter(TInterpreter *interp)
+{
+   delete interp;
+}
@@ -25,6 +25,8 @@
 #include "TProcessID.h"
 #include "TFile.h"
 
+#include <algorithm>
+
 static const Int_t kRegrouped = TStreamerInfo::kOffsetL;
 
 // More possible optimizations:
@@ -1716,6 +1718,27 @@ namespace TStreamerInfoActions
       }
    }
 
+   /// Read the values of a data member of `n` objects from a binary buffer, `address(i)` returning where the value of
+   /// the i-th object goes. The values are read in chunks with ReadFastArray, which byte swaps a whole chunk in one
+   /// tight loop, instead of one virtual `operator>>` call per object. Return false, without reading anything, if
+   /// `buf` is not a binary buffer: text buffers do not store an array like a sequence of single values.
+   template <typename T, typename Address>
+   static bool ReadBasicTypeChunks(TBuffer &buf, Int_t n, Address &&address)
+   {
+      auto bufFile = dynamic_cast<TBufferFile *>(&buf);
+      if (!bufFile)
+         return false;
+      constexpr Int_t kChunkSize = 256;
+      T values[kChunkSize];
+      for (Int_t first = 0; first < n; first += kChunkSize) {
+         const Int_t len = std::min(kChunkSize, n - first);
+         bufFile->ReadFastArray(values, len);
+         for (Int_t i = 0; i < len; ++i)
+            *address(first + i) = values[i];
+      }
+      return true;
+   }
+
    struct VectorLooper {
 
       template <typename T>
@@ -1724,6 +1747,9 @@ namespace TStreamerInfoActions
          const Int_t incr = ((TVectorLoopConfig*)loopconfig)->fIncrement;
          iter = (char*)iter + config->fOffset;
          end = (char*)end + config->fOffset;
+         const Int_t n = ((char*)end - (char*)iter) / incr;
+         if (ReadBasicTypeChunks<T>(buf, n, [iter, incr](Int_t i) { return (T*)((char*)iter + i * incr); }))
+            return 0;
          for(; iter != end; iter = (char*)iter + incr ) {
             T *x = (T*) ((char*) iter);
             buf >> *x;
@@ -2099,6 +2125,11 @@ namespace TStreamerInfoActions
       {
          const Int_t offset = config->fOffset;
 
+         // e.g. the split data members of a TClonesArray
+         void **objects = (void**)iter;
+         const Int_t n = (void**)end - objects;
+         if (ReadBasicTypeChunks<T>(buf, n, [objects, offset](Int_t i) { return (T*)((char*)objects[i] + offset); }))
+            return 0;
          for(; iter != end; iter = (char*)iter + sizeof(void*) ) {
             T *x = (T*)( ((char*) (*(void**)iter) ) + offset );
             buf >> *x;
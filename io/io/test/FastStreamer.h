@@ -0,0 +1,35 @@
+#ifndef ROOT_IO_TEST_FASTSTREAMER
+#define ROOT_IO_TEST_FASTSTREAMER
+
+#include "TObject.h"
+
+#include <string>
+
+enum EFastKind { kFastA, kFastB, kFastC };
+
+/// Selected with the faststreamer LinkDef option: its Streamer is straight-line code.
+class FastEvent : public TObject {
+public:
+   Int_t fNumber = 0;
+   Double_t fEnergy = 0.;
+   Float_t fPos[3] = {};
+   Short_t fMatrix[2][2] = {};
+   Bool_t fValid = false;
+   ULong64_t fId = 0;
+   EFastKind fKind = kFastA;
+   Int_t fCache = 0; //! not streamed
+
+   ClassDefOverride(FastEvent, 2)
+};
+
+/// Selected with the faststreamer LinkDef option, but std::string is not supported: the
+/// usual StreamerInfo based Streamer is generated.
+class FastEventWithName : public TObject {
+public:
+   std::string fName;
+   Int_t fNumber = 0;
+
+   ClassDefOverride(FastEventWithName, 1)
+};
+
+#endif
@@ -0,0 +1,11 @@
+#ifdef __CINT__
+
+#pragma link off all globals;
+#pragma link off all classes;
+#pragma link off all functions;
+
+#pragma link C++ enum EFastKind;
+#pragma link C++ options=faststreamer class FastEvent+;
+#pragma link C++ options=faststreamer class FastEventWithName+;
+
+#endif
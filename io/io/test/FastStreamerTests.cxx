@@ -0,0 +1,110 @@
+#include "FastStreamer.h"
+
+#include "TBufferFile.h"
+#include "TClass.h"
+#include "TFile.h"
+#include "TSystem.h"
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+FastEvent MakeEvent()
+{
+   FastEvent event;
+   event.SetUniqueID(7);
+   event.fNumber = 42;
+   event.fEnergy = 3.25;
+   event.fPos[0] = 1.f;
+   event.fPos[1] = -2.f;
+   event.fPos[2] = 0.5f;
+   event.fMatrix[0][0] = 1;
+   event.fMatrix[0][1] = 2;
+   event.fMatrix[1][0] = 3;
+   event.fMatrix[1][1] = 4;
+   event.fValid = true;
+   event.fId = 1ull << 40;
+   event.fKind = kFastC;
+   event.fCache = 13;
+   return event;
+}
+
+void ExpectEqual(const FastEvent &expected, const FastEvent &actual)
+{
+   EXPECT_EQ(expected.GetUniqueID(), actual.GetUniqueID());
+   EXPECT_EQ(expected.fNumber, actual.fNumber);
+   EXPECT_EQ(expected.fEnergy, actual.fEnergy);
+   for (int i = 0; i < 3; ++i)
+      EXPECT_EQ(expected.fPos[i], actual.fPos[i]);
+   for (int i = 0; i < 2; ++i)
+      for (int j = 0; j < 2; ++j)
+         EXPECT_EQ(expected.fMatrix[i][j], actual.fMatrix[i][j]);
+   EXPECT_EQ(expected.fValid, actual.fValid);
+   EXPECT_EQ(expected.fId, actual.fId);
+   EXPECT_EQ(expected.fKind, actual.fKind);
+   EXPECT_EQ(0, actual.fCache);
+}
+
+} // anonymous namespace
+
+TEST(FastStreamer, RegisteredWithTClass)
+{
+   EXPECT_NE(nullptr, FastEvent::Class()->GetStreamerFunc());
+   EXPECT_TRUE(FastEvent::Class()->IsFastStreamerCompatible(FastEvent::Class_Version()));
+   EXPECT_FALSE(FastEvent::Class()->IsFastStreamerCompatible(FastEvent::Class_Version() - 1));
+   // Not eligible: the StreamerInfo based streaming is kept, and the class can still be split.
+   EXPECT_EQ(nullptr, FastEventWithName::Class()->GetStreamerFunc());
+}
+
+TEST(FastStreamer, SameBytesAsStreamerInfo)
+{
+   const auto event = MakeEvent();
+
+   // Written by the generated Streamer, read through the StreamerInfo
+   {
+      TBufferFile buf(TBuffer::kWrite);
+      const_cast<FastEvent &>(event).Streamer(buf);
+      buf.SetReadMode();
+      buf.SetBufferOffset(0);
+      FastEvent read;
+      buf.ReadClassBuffer(FastEvent::Class(), &read);
+      ExpectEqual(event, read);
+   }
+   // Written through the StreamerInfo, read by the generated Streamer
+   {
+      TBufferFile buf(TBuffer::kWrite);
+      buf.WriteClassBuffer(FastEvent::Class(), const_cast<FastEvent *>(&event));
+      buf.SetReadMode();
+      buf.SetBufferOffset(0);
+      FastEvent read;
+      read.Streamer(buf);
+      ExpectEqual(event, read);
+   }
+}
+
+TEST(FastStreamer, WriteAndReadFile)
+{
+   const auto filename = "faststreamer_writeandread.root";
+   const auto event = MakeEvent();
+   {
+      TFile f(filename, "RECREATE");
+      f.WriteObject(&event, "event");
+      FastEventWithName named;
+      named.fName = "name";
+      named.fNumber = 3;
+      f.WriteObject(&named, "named");
+   }
+   {
+      TFile f(filename);
+      std::unique_ptr<FastEvent> read(f.Get<FastEvent>("event"));
+      ASSERT_NE(nullptr, read);
+      ExpectEqual(event, *read);
+      std::unique_ptr<FastEventWithName> named(f.Get<FastEventWithName>("named"));
+      ASSERT_NE(nullptr, named);
+      EXPECT_EQ("name", named->fName);
+      EXPECT_EQ(3, named->fNumber);
+   }
+   gSystem->Unlink(filename);
+}
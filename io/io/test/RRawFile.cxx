@@ -1,5 +1,10 @@
 #include "io_test.hxx"
 
+#include "ROOT/RRawFileCached.hxx"
+
+using RRawFileBlockCache = ROOT::Internal::RRawFileBlockCache;
+using RRawFileCached = ROOT::Internal::RRawFileCached;
+
 namespace {
 
 /**
@@ -138,6 +143,35 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, ReadVAsync)
+{
+   FileRaii readvGuard("test_rawfile_readv_async", "Hello, World");
+   auto f = RRawFile::Create("test_rawfile_readv_async");
+
+   char buffer[2];
+   buffer[0] = buffer[1] = 0;
+   RRawFile::RIOVec iovec[2];
+   iovec[0].fBuffer = &buffer[0];
+   iovec[0].fOffset = 0;
+   iovec[0].fSize = 1;
+   iovec[1].fBuffer = &buffer[1];
+   iovec[1].fOffset = 7;
+   iovec[1].fSize = 1;
+   auto first = f->ReadVAsync(&iovec[0], 1);
+   auto second = f->ReadVAsync(&iovec[1], 1);
+   first.get();
+   second.get();
+
+   EXPECT_EQ(1U, iovec[0].fOutBytes);
+   EXPECT_EQ(1U, iovec[1].fOutBytes);
+   EXPECT_EQ('H', buffer[0]);
+   EXPECT_EQ('W', buffer[1]);
+
+   auto missing = RRawFile::Create("test_rawfile_readv_async_missing");
+   EXPECT_THROW(missing->ReadVAsync(iovec, 1).get(), std::runtime_error);
+}
+
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
@@ -228,3 +262,63 @@ TEST(RRawFile, Mmap)
    auto mapdLength = 2 + innerOffset;
    f->Unmap(region, mapdLength);
 }
+
+
+TEST(RRawFile, BlockCache)
+{
+   RRawFileBlockCache::ROptions cacheOptions;
+   cacheOptions.fBlockSize = 4;
+   cacheOptions.fMemoryCapacity = 8;
+   cacheOptions.fDiskDirectory = ".";
+   cacheOptions.fDiskCapacity = 8;
+   auto cache = std::make_shared<RRawFileBlockCache>(cacheOptions);
+
+   RRawFile::ROptions options;
+   options.fBlockSize = 0;
+   auto mock1 = new RRawFileMock("abcdefghijk", options);
+   auto mock2 = new RRawFileMock("abcdefghijk", options);
+   RRawFileCached f1(std::unique_ptr<RRawFile>(mock1), cache);
+   RRawFileCached f2(std::unique_ptr<RRawFile>(mock2), cache);
+
+   char buf[16];
+   EXPECT_EQ(3u, f1.ReadAt(buf, 3, 2));
+   EXPECT_EQ("cde", std::string(buf, 3));
+   EXPECT_EQ(2u, mock1->fNumReadAt);
+   EXPECT_EQ(2u, cache->GetStatistics().fNMisses);
+
+   // The second file shares the cached blocks of the same URL
+   EXPECT_EQ(4u, f2.ReadAt(buf, 4, 4));
+   EXPECT_EQ("efgh", std::string(buf, 4));
+   EXPECT_EQ(0u, mock2->fNumReadAt);
+   EXPECT_EQ(1u, cache->GetStatistics().fNHits);
+
+   // The last block is short; the first block is evicted to disk
+   EXPECT_EQ(5u, f1.ReadAt(buf, 10, 6));
+   EXPECT_EQ("ghijk", std::string(buf, 5));
+   auto stats = cache->GetStatistics();
+   EXPECT_EQ(1u, stats.fNEvictions);
+   EXPECT_EQ(7u, stats.fNBytesInMemory);
+   EXPECT_EQ(4u, stats.fNBytesOnDisk);
+
+   EXPECT_EQ(2u, f2.ReadAt(buf, 2, 0));
+   EXPECT_EQ("ab", std::string(buf, 2));
+   EXPECT_EQ(0u, mock2->fNumReadAt);
+   EXPECT_EQ(1u, cache->GetStatistics().fNDiskHits);
+
+   EXPECT_EQ(0u, f1.ReadAt(buf, 4, 20));
+
+   RRawFile::RIOVec iovec[2];
+   iovec[0].fBuffer = &buf[0];
+   iovec[0].fOffset = 1;
+   iovec[0].fSize = 2;
+   iovec[1].fBuffer = &buf[2];
+   iovec[1].fOffset = 9;
+   iovec[1].fSize = 4;
+   f2.ReadV(iovec, 2);
+   EXPECT_EQ(2u, iovec[0].fOutBytes);
+   EXPECT_EQ(2u, iovec[1].fOutBytes);
+   EXPECT_EQ("bcjk", std::string(buf, 4));
+
+   cache->Clear();
+   EXPECT_EQ(0u, cache->GetStatistics().fNBytesOnDisk);
+}
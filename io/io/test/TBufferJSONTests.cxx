@@ -1,5 +1,8 @@
 #include "TBufferJSON.h"
+#include "TArrayD.h"
+#include "TList.h"
 #include "TNamed.h"
+#include <sstream>
 #include <string>
 
 #include "gtest/gtest.h"
@@ -47,3 +50,45 @@ TEST(TBufferJSON, utf8_3)
    EXPECT_EQ(str0, named1->GetTitle());
 }
 
+
+// streamed JSON must be the same as the one kept in memory, also when larger than the chunks passed to the stream
+TEST(TBufferJSON, StreamOutput)
+{
+   TList lst;
+   lst.SetOwner(kTRUE);
+   for (int n = 0; n < 5000; ++n)
+      lst.Add(new TNamed(("name" + std::to_string(n)).c_str(), "some title of the object"));
+
+   auto json = TBufferJSON::ToJSON(&lst);
+   EXPECT_GT(json.Length(), 100000);
+
+   std::ostringstream out;
+   auto len = TBufferJSON::ExportToStream(out, &lst, TList::Class());
+   EXPECT_EQ(len, json.Length());
+   EXPECT_EQ(out.str(), json.Data());
+
+   // special class, where JSON code is produced as single value
+   TArrayD arr(10);
+   arr[3] = 7;
+   std::ostringstream out2;
+   TBufferJSON::ExportToStream(out2, &arr, TArrayD::Class());
+   EXPECT_EQ(out2.str(), TBufferJSON::ToJSON(&arr).Data());
+}
+
+// compact and base64 array encodings must be read back
+TEST(TBufferJSON, ArrayEncodings)
+{
+   TArrayD arr0(100);
+   for (int n = 20; n < 80; ++n)
+      arr0[n] = (n < 50) ? 5. : n * 0.5;
+
+   for (int compact : {TBufferJSON::kZeroSuppression, TBufferJSON::kSameSuppression, TBufferJSON::kBase64}) {
+      auto json = TBufferJSON::ToJSON(&arr0, compact);
+      EXPECT_NE(json.Index("$arr"), kNPOS);
+      auto arr1 = TBufferJSON::FromJSON<TArrayD>(json.Data());
+      ASSERT_NE(arr1, nullptr);
+      ASSERT_EQ(arr1->GetSize(), arr0.GetSize());
+      for (int n = 0; n < arr0.GetSize(); ++n)
+         EXPECT_EQ(arr1->At(n), arr0[n]) << "compact " << compact << " index " << n;
+   }
+}
@@ -266,3 +266,59 @@ TEST(TBufferMerger, SetMaxTreeSize)
 
    RemoveFile("tbuffermerger_setmaxtreesize.root");
 }
+
+TEST(TBufferMerger, ManyWritersManyWrites)
+{
+   const int nthreads = 16;
+   const int nwrites = 8;
+   const int events_per_write = 100;
+   const auto filename = "tbuffermerger_manywriters.root";
+
+   ROOT::EnableThreadSafety();
+
+   {
+      TBufferMerger merger(filename);
+
+      std::vector<std::thread> threads;
+      for (int i = 0; i < nthreads; ++i) {
+         threads.emplace_back([=, &merger]() {
+            auto myfile = merger.GetFile();
+            auto mytree = new TTree("mytree", "mytree");
+            mytree->ResetBit(kMustCleanup);
+            int n = 0;
+            mytree->Branch("n", &n, "n/I");
+            for (int w = 0; w < nwrites; ++w) {
+               for (int e = 0; e < events_per_write; ++e) {
+                  n = (i * nwrites + w) * events_per_write + e;
+                  mytree->Fill();
+               }
+               myfile->Write();
+            }
+         });
+      }
+
+      for (auto &&t : threads)
+         t.join();
+   }
+
+   ASSERT_TRUE(FileExists(filename));
+
+   {
+      TFile f(filename);
+      auto t = f.Get<TTree>("mytree");
+      ASSERT_TRUE(t != nullptr);
+      const Long64_t nevents = nthreads * nwrites * events_per_write;
+      EXPECT_EQ(nevents, t->GetEntries());
+
+      int n = 0;
+      Long64_t sum = 0;
+      t->SetBranchAddress("n", &n);
+      for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+         t->GetEntry(i);
+         sum += n;
+      }
+      EXPECT_EQ(nevents * (nevents - 1) / 2, sum);
+   }
+
+   RemoveFile(filename);
+}
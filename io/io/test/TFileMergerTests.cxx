@@ -2,6 +2,8 @@
 
 #include "TFileMerger.h"
 
+#include "TFileMergeInfo.h"
+#include "TList.h"
 #include "TMemFile.h"
 #include "TTree.h"
 
@@ -68,3 +70,27 @@ TEST(TFileMerger, CreateWithUnwritableTFilePointer)
    ROOT_EXPECT_ERROR(merger.OutputFile(std::move(output)), "TFileMerger::OutputFile",
                      "output file output.root is not writable");
 }
+
+TEST(TFileMerger, MergeReport)
+{
+   for (const char *options : {" fast", ""}) {
+      TMemFile a("a.root", "RECREATE");
+      CreateATuple(a, "tree", 1.);
+      TMemFile b("b.root", "RECREATE");
+      CreateATuple(b, "tree", 2.);
+      TMemFile output("output.root", "CREATE");
+
+      TFileMergeInfo info(&output);
+      info.fOptions = options;
+      TList inputs;
+      inputs.Add(b.Get<TTree>("tree"));
+      EXPECT_EQ(2, a.Get<TTree>("tree")->Merge(&inputs, &info));
+      if (*options)
+         EXPECT_EQ(TString("fast cloning"), info.fReport);
+      else
+         EXPECT_EQ(TString("entry by entry copy"), info.fReport);
+
+      info.Reset();
+      EXPECT_TRUE(info.fReport.IsNull());
+   }
+}
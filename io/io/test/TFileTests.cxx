@@ -1,14 +1,20 @@
+#include <cstring>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
 
+#include "TArrayC.h"
+#include "TEnv.h"
 #include "TFile.h"
+#include "TFileCacheWrite.h"
 #include "TKey.h"
 #include "TNamed.h"
 #include "TPluginManager.h"
 #include "TROOT.h" // gROOT
 #include "TSystem.h"
+#include "TVirtualStreamerInfo.h"
 
 TEST(TFile, WriteObjectTObject)
 {
@@ -109,6 +115,107 @@ TEST(TFile, ReadWithoutGlobalRegistrationLocal)
    gSystem->Unlink(localFile);
 }
 
+TEST(TFile, LazyKeys)
+{
+   auto filename{"tfile_lazykeys.root"};
+   const int nKeys = 10000;
+   {
+      TFile f{filename, "recreate"};
+      auto dir = f.mkdir("dir");
+      for (int i = 0; i < nKeys; ++i) {
+         TNamed named{("n" + std::to_string(i)).c_str(), "cycle1"};
+         dir->WriteTObject(&named);
+      }
+      TNamed named{"n42", "cycle2"};
+      dir->WriteTObject(&named);
+      f.Close();
+   }
+
+   for (bool imt : {false, true}) {
+#ifdef R__USE_IMT
+      if (imt)
+         ROOT::EnableImplicitMT(4);
+#else
+      if (imt)
+         break;
+#endif
+      TFile f{filename};
+      auto dir = f.Get<TDirectory>("dir");
+      ASSERT_NE(dir, nullptr);
+      EXPECT_EQ(dir->GetNkeys(), nKeys + 1);
+
+      // lookups by name only create the keys with that name
+      auto named = dir->Get<TNamed>("n42");
+      ASSERT_NE(named, nullptr);
+      EXPECT_STREQ(named->GetTitle(), "cycle2");
+      TKey *cycle1 = dir->GetKey("n42", 1);
+      ASSERT_NE(cycle1, nullptr);
+      EXPECT_EQ(cycle1->GetCycle(), 1);
+      EXPECT_EQ(dir->GetKey("n43")->GetCycle(), 1);
+      EXPECT_EQ(dir->GetKey("nope"), nullptr);
+
+      // the full list keeps the keys created so far and the order of the record, highest cycle first
+      TList *keys = dir->GetListOfKeys();
+      ASSERT_EQ(keys->GetSize(), nKeys + 1);
+      TKey *first = nullptr;
+      for (auto key : TRangeDynCast<TKey>(*keys)) {
+         if (!first && !strcmp(key->GetName(), "n42"))
+            first = key;
+      }
+      ASSERT_NE(first, nullptr);
+      EXPECT_EQ(first->GetCycle(), 2);
+      EXPECT_EQ(keys->After(first), cycle1);
+      EXPECT_EQ(dir->GetKey("n42", 1), cycle1);
+
+      EXPECT_EQ(dir->ReadKeys(), nKeys + 1);
+      EXPECT_EQ(dir->GetListOfKeys()->GetSize(), nKeys + 1);
+   }
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, WriteEngine)
+{
+   auto filename{"tfile_writeengine.root"};
+   const std::string longTitle(100000, 'x');
+   gEnv->SetValue("TFile.WriteEngine", 1);
+   gEnv->SetValue("TFile.WriteEngine.BufferSize", 64 * 1024);
+   for (bool directIO : {false, true}) {
+      gEnv->SetValue("TFile.WriteEngine.DirectIO", directIO);
+      {
+         std::unique_ptr<TFile> f{TFile::Open(filename, "RECREATE")};
+         ASSERT_TRUE(f);
+         ASSERT_NE(f->GetCacheWrite(), nullptr);
+         for (int i = 0; i < 1000; ++i) {
+            TNamed named{("n" + std::to_string(i)).c_str(), i % 100 ? "title" : longTitle.c_str()};
+            f->WriteTObject(&named);
+         }
+         // reading back data that may still be in the engine buffers
+         auto named = f->Get<TNamed>("n999");
+         ASSERT_NE(named, nullptr);
+         EXPECT_STREQ(named->GetTitle(), "title");
+         named = f->Get<TNamed>("n900");
+         ASSERT_NE(named, nullptr);
+         EXPECT_EQ(longTitle, named->GetTitle());
+         f->Close();
+      }
+
+      std::unique_ptr<TFile> f{TFile::Open(filename)};
+      ASSERT_TRUE(f && !f->IsZombie());
+      EXPECT_EQ(f->GetNkeys(), 1000);
+      for (int i = 0; i < 1000; i += 7) {
+         auto named = f->Get<TNamed>(("n" + std::to_string(i)).c_str());
+         ASSERT_NE(named, nullptr);
+         EXPECT_EQ(i % 100 ? std::string("title") : longTitle, named->GetTitle());
+      }
+   }
+   gEnv->SetValue("TFile.WriteEngine", 0);
+   gSystem->Unlink(filename);
+}
+
 void TestReadWithoutGlobalRegistrationIfPossible(const char *fname)
 {
    TPluginHandler *h;
@@ -135,3 +242,42 @@ TEST(TFile, ReadWithoutGlobalRegistrationNet)
    const auto netFile = "root://eospublic.cern.ch//eos/root-eos/h1/dstarmb.root";
    TestReadWithoutGlobalRegistrationIfPossible(netFile);
 }
+
+TEST(TFile, SharedStreamerInfoRecord)
+{
+   // Files with the same content have the same StreamerInfo record, it is processed only for the first one
+   const std::vector<std::string> filenames{"tfile_sharedsirecord_1.root", "tfile_sharedsirecord_2.root"};
+   for (const auto &filename : filenames) {
+      TFile f{filename.c_str(), "recreate"};
+      TNamed named{"named", "title"};
+      f.WriteObject(&named, named.GetName());
+   }
+
+   const Int_t number = TNamed::Class()->GetStreamerInfo()->GetNumber();
+   for (const auto &filename : filenames) {
+      TFile f{filename.c_str()};
+      ASSERT_FALSE(f.IsZombie());
+      ASSERT_LT(number, f.GetClassIndex()->GetSize());
+      EXPECT_EQ(1, f.GetClassIndex()->At(number));
+      auto named = f.Get<TNamed>("named");
+      ASSERT_NE(nullptr, named);
+      EXPECT_STREQ("title", named->GetTitle());
+   }
+
+   // Updating a file whose record was skipped keeps its StreamerInfos
+   {
+      TFile f{filenames[1].c_str(), "update"};
+      TObject obj;
+      f.WriteObject(&obj, "obj");
+   }
+   {
+      TFile f{filenames[1].c_str()};
+      std::unique_ptr<TList> infos{f.GetStreamerInfoList()};
+      ASSERT_NE(nullptr, infos);
+      EXPECT_NE(nullptr, infos->FindObject("TNamed"));
+      EXPECT_NE(nullptr, infos->FindObject("TObject"));
+   }
+
+   for (const auto &filename : filenames)
+      gSystem->Unlink(filename.c_str());
+}
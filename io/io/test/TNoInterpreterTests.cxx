@@ -0,0 +1,34 @@
+#include "TInterpreter.h"
+#include "TMemFile.h"
+#include "TNamed.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+namespace {
+// gROOT initializes the interpreter at its first use after the start of main()
+struct DisableInterpreterAtStartup {
+   DisableInterpreterAtStartup() { TROOT::DisableInterpreter(); }
+} gDisableInterpreterAtStartup;
+} // namespace
+
+TEST(TNoInterpreter, WriteRead)
+{
+   EXPECT_TRUE(TROOT::IsInterpreterDisabled());
+   EXPECT_STREQ("NoInterpreter", gInterpreter->GetName());
+
+   TMemFile file("nointerpreter.root", "RECREATE");
+   TNamed named("name", "title");
+   file.WriteObject(&named, "named");
+
+   auto read = std::unique_ptr<TNamed>(file.Get<TNamed>("named"));
+   ASSERT_NE(nullptr, read);
+   EXPECT_STREQ("name", read->GetName());
+   EXPECT_STREQ("title", read->GetTitle());
+
+   // the TClass comes from the dictionary and its rdict.pcm information
+   EXPECT_EQ(TNamed::Class(), read->IsA());
+   EXPECT_NE(nullptr, TNamed::Class()->GetListOfDataMembers()->FindObject("fName"));
+}
@@ -84,3 +84,53 @@ TEST(TROMemFile, RealNoMemCopy)
    };
    ASSERT_EQ(expected.c_str(), MemBlockPtrGetter::GetBlockStart(&rosmf));
 }
+
+/// Check that a copy-on-write TMemFile copies the external data only when written to
+TEST(TROMemFile, CopyOnWrite)
+{
+   constexpr const char title[] = "This is a title for TMemFile shared data test CopyOnWrite";
+   std::shared_ptr<const std::vector<char>> dataPtr(CreateBuffer(title));
+   const std::vector<char> original = *dataPtr;
+
+   struct MemBlockPtrGetter : public TMemFile {
+      static void *GetBlockStart(TMemFile *M) { return static_cast<MemBlockPtrGetter *>(M)->fBlockList.fBuffer; }
+   };
+
+   {
+      TMemFile cowmf("cowmemfile.root", dataPtr, "UPDATE");
+      ASSERT_FALSE(cowmf.IsZombie());
+      EXPECT_TRUE(cowmf.IsWritable());
+      EXPECT_EQ(dataPtr->data(), MemBlockPtrGetter::GetBlockStart(&cowmf));
+      TObject *readN = cowmf.Get("name");
+      ASSERT_NE(nullptr, readN);
+      EXPECT_STREQ(title, readN->GetTitle());
+   }
+   // Closing the unmodified file did not touch the external data
+   EXPECT_EQ(original, *dataPtr);
+
+   TMemFile cowmf("cowmemfile.root", dataPtr, "UPDATE");
+   TNamed added("added", "added title");
+   EXPECT_LT(0, cowmf.WriteTObject(&added));
+   EXPECT_NE(dataPtr->data(), MemBlockPtrGetter::GetBlockStart(&cowmf));
+   EXPECT_EQ(original, *dataPtr);
+   cowmf.Write();
+
+   // Reading the updated file through its blocks
+   std::vector<char> updated;
+   for (const auto &block : cowmf.GetBlocks())
+      updated.insert(updated.end(), block.fStart, block.fStart + block.fSize);
+   ASSERT_EQ(static_cast<size_t>(cowmf.GetSize()), updated.size());
+   TMemFile::ZeroCopyView_t updatedRange{updated.data(), updated.size()};
+   TMemFile rosmf("romemfile.root", updatedRange);
+   ASSERT_NE(nullptr, rosmf.Get("name"));
+   TObject *readAdded = rosmf.Get("added");
+   ASSERT_NE(nullptr, readAdded);
+   EXPECT_STREQ("added title", readAdded->GetTitle());
+
+   // External data can not be recreated
+   auto oldIgnoreLevel = gErrorIgnoreLevel;
+   gErrorIgnoreLevel = kBreak;
+   TMemFile recreated("recreated.root", dataPtr, "RECREATE");
+   gErrorIgnoreLevel = oldIgnoreLevel;
+   EXPECT_TRUE(recreated.IsZombie());
+}
@@ -27,7 +27,13 @@ def get_argparse():
     parser.add_argument("-O", help="Re-optimize basket size when merging TTree")
     parser.add_argument("-v", help=textwrap.fill(
         "Explicitly set the verbosity level: 0 request no output, 99 is the default"))
+    parser.add_argument("-report", help=textwrap.fill(
+        "Print, for each merged object, the merge method used (and why a TTree could not be fast cloned) "
+        "with the read and write throughput"))
     parser.add_argument("-j", help="Parallelize the execution in multiple processes")
+    parser.add_argument("-mt", help=textwrap.fill(
+        "Merge in this process with N threads (default: number of logical cores) reading the inputs concurrently, "
+        "compressing the output baskets and writing the output; takes precedence over -j"))
     parser.add_argument("-dbg", help=textwrap.fill(
         "Parallelize the execution in multiple processes in debug mode "
         "(Does not delete partial files stored inside working directory)"))
@@ -35,6 +41,11 @@ def get_argparse():
         "Carry out the partial multiprocess execution in the specified directory"))
     parser.add_argument("-n", help=textwrap.fill(
         "Open at most 'maxopenedfiles' at once (use 0 to request to use the system maximum)"))
+    parser.add_argument("-prefetch", help=textwrap.fill(
+        "Open the next 'K' input files in the background while the current ones are merged"))
+    parser.add_argument("-memory", help=textwrap.fill(
+        "Flush the merged objects to the target between two sets of '-n' files when the resident memory "
+        "exceeds the given size"))
     parser.add_argument("-cachesize", help=textwrap.fill(
         "Resize the prefetching cache use to speed up I/O operations(use 0 to disable)"))
     parser.add_argument("-experimental-io-features", help=textwrap.fill(
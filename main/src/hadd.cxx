@@ -26,11 +26,18 @@
   \param -k   Skip corrupt or non-existent files, do not exit
   \param -O   Re-optimize basket size when merging TTree
   \param -v   Explicitly set the verbosity level: 0 request no output, 99 is the default
+  \param -report Print, for each merged object, the merge method used (and why a TTree could not be fast
+              cloned) with the read and write throughput
   \param -j   Parallelise the execution in multiple processes
+  \param -mt  Merge in this process with `N` threads (default: number of logical cores) reading the inputs
+              concurrently, compressing the output baskets and writing the output; takes precedence over -j
   \param -dbg  Parallelise the execution in multiple processes in debug mode (Does not delete  partial  files  stored
               inside working directory)
   \param -d   Carry out the partial multiprocess execution in the specified directory
   \param -n   Open at most `n` at once (use 0 to request to use the system maximum)
+  \param -prefetch Open the next `K` input files in the background while the current ones are merged
+  \param -memory Flush the merged objects to the target between two sets of `-n` files when the resident
+              memory exceeds the given size
   \param -experimental-io-features `<feature>` Enables the corresponding experimental feature for output trees
   \return hadd returns a status code: 0 if OK, -1 otherwise
 
@@ -72,7 +79,14 @@
   and all files in the indirect text file list.txt ("@" as the first
   character of the file indicates an indirect file. An indirect file
   is a text file containing a list of other files, including other
-  indirect files, one line per file).
+  indirect files, one line per file). "@-" reads the list of files from
+  the standard input, for instance
+  ```
+      find /data -name '*.root' | hadd -n 200 -prefetch 50 -memory 4G result.root @-
+  ```
+  merges the input files by sets of 200, opening the next 50 files while a
+  set is merged and freeing the merged histograms whenever the process
+  uses more than 4 GB.
 
   If the sources and and target compression levels are identical (default),
   the program uses the TChain::Merge function with option "fast", ie
@@ -104,6 +118,7 @@
 #include "TKey.h"
 #include "TClass.h"
 #include "TSystem.h"
+#include "TROOT.h"
 #include "TUUID.h"
 #include "ROOT/StringConv.hxx"
 #include "snprintf.h"
@@ -139,13 +154,18 @@ int main( int argc, char **argv )
    Bool_t keepCompressionAsIs = kFALSE;
    Bool_t useFirstInputCompression = kFALSE;
    Bool_t multiproc = kFALSE;
+   Bool_t multithread = kFALSE;
    Bool_t debug = kFALSE;
+   Bool_t report = kFALSE;
    Int_t maxopenedfiles = 0;
+   Int_t prefetchfiles = 0;
+   Long64_t maxmemory = 0;
    Int_t verbosity = 99;
    TString cacheSize;
    SysInfo_t s;
    gSystem->GetSysInfo(&s);
    auto nProcesses = s.fCpus;
+   auto nThreads = s.fCpus;
    auto workingDir = gSystem->TempDirectory();
    int outputPlace = 0;
    int ffirst = 2;
@@ -166,6 +186,9 @@ int main( int argc, char **argv )
       } else if ( strcmp(argv[a],"-O") == 0 ) {
          reoptimize = kTRUE;
          ++ffirst;
+      } else if ( strcmp(argv[a],"-report") == 0 ) {
+         report = kTRUE;
+         ++ffirst;
       } else if (strcmp(argv[a], "-dbg") == 0) {
          debug = kTRUE;
          verbosity = kTRUE;
@@ -213,6 +236,33 @@ int main( int argc, char **argv )
          }
          multiproc = kTRUE;
          ++ffirst;
+      } else if (strcmp(argv[a], "-mt") == 0) {
+         // If the number of threads is not specified, use the default.
+         if (a + 1 != argc && argv[a + 1][0] != '-') {
+            Long_t request = 1;
+            for (char *c = argv[a + 1]; *c != '\0'; ++c) {
+               if (!isdigit(*c)) {
+                  std::cerr << "Error: could not parse the number of threads passed after -mt: " << argv[a + 1]
+                            << ". We will use the default value (number of logical cores).\n";
+                  request = 0;
+                  break;
+               }
+            }
+            if (request == 1) {
+               request = strtol(argv[a + 1], 0, 10);
+               if (request < kMaxLong && request >= 0) {
+                  nThreads = (Int_t)request;
+                  ++a;
+                  ++ffirst;
+                  std::cout << "Merging with " << nThreads << " threads.\n";
+               } else {
+                  std::cerr << "Error: could not parse the number of threads passed after -mt: " << argv[a + 1]
+                            << ". We will use the default value (number of logical cores).\n";
+               }
+            }
+         }
+         multithread = kTRUE;
+         ++ffirst;
       } else if ( strcmp(argv[a],"-cachesize=") == 0 ) {
          int size;
          static const size_t arglen = strlen("-cachesize=");
@@ -287,6 +337,34 @@ int main( int argc, char **argv )
             }
          }
          ++ffirst;
+      } else if ( strcmp(argv[a],"-prefetch") == 0 ) {
+         if (a+1 >= argc) {
+            std::cerr << "Error: no number of files to prefetch was provided after -prefetch.\n";
+         } else {
+            Long_t request = strtol(argv[a+1], 0, 10);
+            if (request < kMaxInt && request >= 0) {
+               prefetchfiles = (Int_t)request;
+               ++a;
+               ++ffirst;
+            } else {
+               std::cerr << "Error: could not parse the number of files to prefetch passed after -prefetch: " << argv[a+1] << ". No file will be prefetched.\n";
+            }
+         }
+         ++ffirst;
+      } else if ( strcmp(argv[a],"-memory") == 0 ) {
+         if (a+1 >= argc) {
+            std::cerr << "Error: no memory size was provided after -memory.\n";
+         } else {
+            auto parseResult = ROOT::FromHumanReadableSize(argv[a+1], maxmemory);
+            if (parseResult != ROOT::EFromHumanReadableSize::kSuccess) {
+               std::cerr << "Error: could not parse the memory size passed after -memory: "
+                         << argv[a + 1] << ". The memory will not be limited.\n";
+               maxmemory = 0;
+            }
+            ++a;
+            ++ffirst;
+         }
+         ++ffirst;
       } else if ( strcmp(argv[a],"-v") == 0 ) {
          if (a+1 == argc || argv[a+1][0] == '-') {
             // Verbosity level was not specified use the default:
@@ -363,6 +441,19 @@ int main( int argc, char **argv )
 
    gSystem->Load("libTreePlayer");
 
+   // The list of files given with "@-" is read once from the standard input
+   std::vector<std::string> stdinFiles;
+   for (int a = ffirst; a < argc; ++a) {
+      if (!strcmp(argv[a], "@-")) {
+         std::string line;
+         while (std::getline(std::cin, line)) {
+            if (line.length())
+               stdinFiles.emplace_back(line);
+         }
+         break;
+      }
+   }
+
    const char *targetname = 0;
    if (outputPlace) {
       targetname = argv[outputPlace];
@@ -380,11 +471,20 @@ int main( int argc, char **argv )
    if (maxopenedfiles > 0) {
       fileMerger.SetMaxOpenedFiles(maxopenedfiles);
    }
+   if (prefetchfiles > 0) {
+      // The files are opened on a background thread
+      ROOT::EnableThreadSafety();
+      fileMerger.SetPrefetchFiles(prefetchfiles);
+   }
+   fileMerger.SetMaxMemory(maxmemory);
    if (newcomp == -1) {
       if (useFirstInputCompression || keepCompressionAsIs) {
          // grab from the first file.
          TFile *firstInput = nullptr;
-         if (argv[ffirst] && argv[ffirst][0]=='@') {
+         if (argv[ffirst] && !strcmp(argv[ffirst], "@-")) {
+            if (!stdinFiles.empty())
+               firstInput = TFile::Open(stdinFiles.front().c_str());
+         } else if (argv[ffirst] && argv[ffirst][0]=='@') {
             std::ifstream indirect_file(argv[ffirst]+1);
             if( ! indirect_file.is_open() ) {
                std::cerr<< "hadd could not open indirect file " << (argv[ffirst]+1) << std::endl;
@@ -424,6 +524,18 @@ int main( int argc, char **argv )
       exit(1);
    }
 
+   if (multithread) {
+      if (multiproc) {
+         std::cout << "hadd merges in this process with threads, ignoring -j.\n";
+         multiproc = kFALSE;
+      }
+      if (nThreads > 1) {
+         // Also compresses the baskets of the output trees in parallel when they are not copied as they are
+         ROOT::EnableImplicitMT(nThreads);
+         fileMerger.SetNThreads(nThreads);
+      }
+   }
+
    auto filesToProcess = argc - ffirst;
    auto step = (filesToProcess + nProcesses - 1) / nProcesses;
    if (multiproc && step < 3) {
@@ -460,10 +572,11 @@ int main( int argc, char **argv )
          if (!keepCompressionAsIs && merger.HasCompressionChange()) {
             // Don't warn if the user any request re-optimization.
             std::cout << "hadd Sources and Target have different compression levels" << std::endl;
-            std::cout << "hadd merging will be slower" << std::endl;
+            std::cout << "hadd the baskets of the trees will be recompressed, merging will be slower" << std::endl;
          }
       }
       merger.SetNotrees(noTrees);
+      merger.SetReport(report);
       merger.SetMergeOptions(cacheSize);
       merger.SetIOFeatures(features);
       Bool_t status;
@@ -477,7 +590,17 @@ int main( int argc, char **argv )
    auto sequentialMerge = [&](TFileMerger &merger, int start, int nFiles) {
 
       for (auto i = start; i < (start + nFiles) && i < argc; i++) {
-         if (argv[i] && argv[i][0] == '@') {
+         if (argv[i] && !strcmp(argv[i], "@-")) {
+            for (const auto &name : stdinFiles) {
+               if (!merger.AddFile(name.c_str())) {
+                  if (!skip_errors) {
+                     std::cerr << "hadd exiting due to error in " << name << std::endl;
+                     return kFALSE;
+                  }
+                  std::cerr << "hadd skipping file with error: " << name << std::endl;
+               }
+            }
+         } else if (argv[i] && argv[i][0] == '@') {
             std::ifstream indirect_file(argv[i] + 1);
             if (!indirect_file.is_open()) {
                std::cerr << "hadd could not open indirect file " << (argv[i] + 1) << std::endl;
@@ -508,6 +631,11 @@ int main( int argc, char **argv )
       if (maxopenedfiles > 0) {
          mergerP.SetMaxOpenedFiles(maxopenedfiles / nProcesses);
       }
+      if (prefetchfiles > 0) {
+         ROOT::EnableThreadSafety();
+         mergerP.SetPrefetchFiles(prefetchfiles);
+      }
+      mergerP.SetMaxMemory(maxmemory / nProcesses);
       if (!mergerP.OutputFile(partialFiles[(start - ffirst) / step].c_str(), newcomp)) {
          std::cerr << "hadd error opening target partial file" << std::endl;
          exit(1);
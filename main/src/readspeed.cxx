@@ -11,6 +11,10 @@
 #include "ReadSpeedCLI.hxx"
 #include "ReadSpeed.hxx"
 
+#include <fstream>
+#include <iostream>
+#include <vector>
+
 using namespace ReadSpeed;
 
 int main(int argc, char **argv)
@@ -20,7 +24,27 @@ int main(int argc, char **argv)
    if (!args.fShouldRun)
       return 1; // ParseArgs has printed the --help, has run the --test or has encountered an issue and logged about it
 
-   PrintThroughput(EvalThroughput(args.fData, args.fNThreads));
+   std::vector<Result> results;
+   for (auto mode : args.fReadModes) {
+      if (!results.empty())
+         std::cout << '\n';
+      args.fData.fReadMode = mode;
+      results.emplace_back(EvalThroughput(args.fData, args.fNThreads));
+      PrintThroughput(results.back());
+   }
+   if (results.size() > 1) {
+      std::cout << '\n';
+      PrintTimeSplit(results);
+   }
+
+   if (!args.fJSONFileName.empty()) {
+      std::ofstream json(args.fJSONFileName);
+      if (!json) {
+         std::cerr << "Could not open '" << args.fJSONFileName << "' to write the results\n";
+         return 1;
+      }
+      WriteJSON(json, args, results);
+   }
 
    return 0;
 }
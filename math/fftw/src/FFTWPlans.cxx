@@ -0,0 +1,108 @@
+// @(#)root/fft
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "FFTWPlans.h"
+
+#include "fftw3.h"
+#include "TEnv.h"
+#include "TError.h"
+#include "TROOT.h"
+#include "TString.h"
+#include "TSystem.h"
+
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+struct RPlanCache {
+   std::mutex fMutex;
+   std::unordered_map<std::string, void *> fPlans;
+   bool fInitialized = false;
+   bool fNewPlans = false; ///< whether plans were created since the wisdom was imported
+   std::string fWisdomFile;
+};
+
+/// Never destructed: the plans are used by TFFT objects until the end of the process
+RPlanCache &GetPlanCache()
+{
+   static RPlanCache *cache = new RPlanCache();
+   return *cache;
+}
+
+void ExportWisdomAtExit()
+{
+   auto &cache = GetPlanCache();
+   std::lock_guard<std::mutex> lock(cache.fMutex);
+   if (cache.fNewPlans && !fftw_export_wisdom_to_filename(cache.fWisdomFile.c_str()))
+      ::Warning("TFFT", "cannot write the FFTW wisdom to %s", cache.fWisdomFile.c_str());
+}
+
+void InitPlanner(RPlanCache &cache)
+{
+   cache.fInitialized = true;
+
+   Int_t nThreads = gEnv->GetValue("FFTW.Threads", 1);
+   if (nThreads == 0)
+      nThreads = ROOT::IsImplicitMTEnabled() ? ROOT::GetThreadPoolSize() : 1;
+   if (nThreads > 1) {
+#ifdef R__HAS_FFTW_THREADS
+      if (fftw_init_threads())
+         fftw_plan_with_nthreads(nThreads);
+      else
+         ::Warning("TFFT", "cannot initialise the threads of FFTW, the transforms are single-threaded");
+#else
+      ::Warning("TFFT", "FFTW.Threads is %d but ROOT is built without the fftw3_threads library", nThreads);
+#endif
+   }
+
+   TString wisdomFile = gEnv->GetValue("FFTW.WisdomFile", "");
+   if (!wisdomFile.IsNull() && !gSystem->ExpandPathName(wisdomFile)) {
+      cache.fWisdomFile = wisdomFile.Data();
+      // a missing file is not an error: it is written at the end of the first process
+      if (!gSystem->AccessPathName(wisdomFile) && !fftw_import_wisdom_from_filename(wisdomFile))
+         ::Warning("TFFT", "cannot read the FFTW wisdom from %s", wisdomFile.Data());
+      std::atexit(ExportWisdomAtExit);
+   }
+}
+
+} // anonymous namespace
+
+std::string
+ROOT::Internal::FFTW::MakePlanKey(const char *type, Int_t ndim, const Int_t *n, UInt_t flags, bool inPlace)
+{
+   std::string key = type;
+   for (Int_t i = 0; i < ndim; ++i)
+      key += (i ? "x" : " ") + std::to_string(n[i]);
+   key += " flags " + std::to_string(flags);
+   if (inPlace)
+      key += " in-place";
+   return key;
+}
+
+void *ROOT::Internal::FFTW::GetPlan(const std::string &key, const std::function<void *()> &makePlan)
+{
+   auto &cache = GetPlanCache();
+   std::lock_guard<std::mutex> lock(cache.fMutex);
+   if (!cache.fInitialized)
+      InitPlanner(cache);
+
+   auto it = cache.fPlans.find(key);
+   if (it != cache.fPlans.end())
+      return it->second;
+
+   void *plan = makePlan();
+   if (plan) {
+      cache.fPlans[key] = plan;
+      cache.fNewPlans = true;
+   }
+   return plan;
+}
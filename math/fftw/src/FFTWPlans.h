@@ -0,0 +1,44 @@
+// @(#)root/fft
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_FFTWPlans
+#define ROOT_FFTWPlans
+
+// Internal process-wide cache of the FFTW plans of the TFFT classes, not installed.
+
+#include "RtypesCore.h"
+
+#include <functional>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+namespace FFTW {
+
+/// Return a string identifying a transform, to be completed with its sign or kinds
+std::string MakePlanKey(const char *type, Int_t ndim, const Int_t *n, UInt_t flags, bool inPlace);
+
+/// Return the cached plan of the transform identified by `key`, calling `makePlan` to create it if it is not cached
+/// yet. The plans are kept until the end of the process: they are executed with the new-array execute functions of
+/// FFTW on the arrays of each TFFT object, which are all allocated by fftw_malloc and thus identically aligned.
+///
+/// The FFTW planner is not thread-safe, so that `makePlan` is called with a lock held. On the first call, the
+/// planner is set up according to the rootrc variables
+///  - `FFTW.Threads`: the number of threads used by the transforms planned from then on (requires the fftw3_threads
+///    library; 0 uses the size of the ROOT thread pool if the implicit multi-threading is enabled);
+///  - `FFTW.WisdomFile`: a file from which the FFTW wisdom is imported and to which it is exported at the end of the
+///    process, so that the planning cost of "M", "P" and "EX" flags is only paid once.
+void *GetPlan(const std::string &key, const std::function<void *()> &makePlan);
+
+} // namespace FFTW
+} // namespace Internal
+} // namespace ROOT
+
+#endif
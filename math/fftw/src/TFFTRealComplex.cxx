@@ -44,6 +44,7 @@
 
 #include "TFFTRealComplex.h"
 #include "fftw3.h"
+#include "FFTWPlans.h"
 #include "TComplex.h"
 
 
@@ -112,13 +113,11 @@ TFFTRealComplex::TFFTRealComplex(Int_t ndim, Int_t *n, Bool_t inPlace)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays. The plan is kept until the end of the process, and is
+///reused by the other transforms of the same size and type
 
 TFFTRealComplex::~TFFTRealComplex()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = nullptr;
    fftw_free(fIn);
    fIn = nullptr;
@@ -153,14 +152,12 @@ void TFFTRealComplex::Init(Option_t *flags,Int_t /*sign*/, const Int_t* /*kind*/
 {
    fFlags = flags;
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
-   fPlan = nullptr;
-
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fOut,MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fIn, MapFlag(flags));
+   const UInt_t flag = MapFlag(flags);
+   const std::string key = ROOT::Internal::FFTW::MakePlanKey("R2C", fNdim, fN, flag, !fOut);
+   fPlan = ROOT::Internal::FFTW::GetPlan(key, [&]() -> void * {
+      fftw_complex *out = fOut ? (fftw_complex *)fOut : (fftw_complex *)fIn;
+      return fftw_plan_dft_r2c(fNdim, fN, (Double_t *)fIn, out, flag);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -170,7 +167,7 @@ void TFFTRealComplex::Transform()
 {
 
    if (fPlan){
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_dft_r2c((fftw_plan)fPlan, (Double_t *)fIn, (fftw_complex *)(fOut ? fOut : fIn));
    }
    else {
       Error("Transform", "transform hasn't been initialised");
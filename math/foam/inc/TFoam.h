@@ -31,6 +31,7 @@ protected:
    Int_t   fOptDrive;         ///< Optimization switch =1,2 for variance or maximum weight optimization
    Int_t   fChat;             ///< Chat=0,1,2 chat level in output, Chat=1 normal level
    Int_t   fOptRej;           ///< Switch =0 for weighted events; =1 for unweighted events in MC
+   Int_t   fOptPar = 0;       ///<! Switch =1 for evaluating the distribution in parallel in the cell exploration
 
    Int_t   fNBin;             ///< No. of bins in the edge histogram for cell MC exploration
    Int_t   fNSampl;           ///< No. of MC events, when dividing (exploring) cell
@@ -99,6 +100,7 @@ public:
    virtual void     GetMCwt(Double_t &);     // Provides generated MC weight
    virtual Double_t GetMCwt();               // Provides generates MC weight
    virtual Double_t MCgenerate(Double_t *MCvect);// All three above function in one
+   virtual void     MakeEvents(Long_t n, Double_t *MCvect, Double_t *MCwt = nullptr); // Makes n MC events at once
    // Finalization
    virtual void GetIntegMC(Double_t&, Double_t&);// Provides Integrand and abs. error from MC run
    virtual void GetIntNorm(Double_t&, Double_t&);// Provides normalization Inegrand
@@ -118,6 +120,7 @@ public:
    virtual void SetnBin(Int_t nBin){fNBin = nBin;}          // Sets no of bins in histogs in cell exploration
    virtual void SetChat(Int_t Chat){fChat = Chat;}          // Sets option Chat, chat level
    virtual void SetOptRej(Int_t OptRej){fOptRej =OptRej;}   // Sets option for MC rejection
+   virtual void SetOptPar(Int_t OptPar){fOptPar =OptPar;}   // Sets option for parallel cell exploration
    virtual void SetOptDrive(Int_t OptDrive){fOptDrive =OptDrive;}  // Sets optimization switch
    virtual void SetEvPerBin(Int_t EvPerBin){fEvPerBin =EvPerBin;}  // Sets max. no. of effective events per bin
    virtual void SetMaxWtRej(Double_t MaxWtRej){fMaxWtRej=MaxWtRej;}  // Sets max. weight for rejection
@@ -139,6 +142,7 @@ public:
 private:
    Double_t Sqr(Double_t x) const { return x*x;}      // Square function
    TFoamCell* getCell(std::size_t i) const;
+   void EvalPoints(Long_t n, const Double_t *points, Double_t *values);
 
    ClassDefOverride(TFoam,2);   // General purpose self-adapting Monte Carlo event generator
 };
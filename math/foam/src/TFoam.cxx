@@ -68,6 +68,20 @@ Only `kDim` HAS TO BE redefined, the other parameters may be left at their defau
 Increasing `nSampl` sometimes helps, but it may cost CPU time.
 `MaxWtRej` may need to be increased for wild a distribution, while using `OptRej=0`.
 
+### Parallel build-up of the foam
+
+For distributions that are expensive to evaluate, most of the time of Initialize() is spent
+in the MC exploration of the cells. With `FoamObject->SetOptPar(1)` and the implicit multi-threading
+enabled (ROOT::EnableImplicitMT()), the points of the exploration are drawn in chunks
+and the distribution is evaluated on all points of a chunk in parallel.
+The distribution must then be given as a TFoamIntegrand (SetRho() or SetRhoInt()) whose Density()
+is thread safe. The random numbers are still drawn sequentially from the generator of the FOAM,
+so that the foam does not depend on the number of threads; it differs from the foam
+built with `OptPar=0` because the points of a chunk drawn after the end of the exploration of a cell
+are discarded.
+
+Many events can be generated in one call with MakeEvents().
+
 Past versions of FOAM: August 2003, v.1.00; September 2003 v.1.01
 Adopted starting from FOAM-2.06 by P. Sawicki
 
@@ -90,6 +104,14 @@ S. Jadach, Computer Physics Communications 152 (2003) 55.
 #include "TRandom.h"
 #include "TMath.h"
 #include "TInterpreter.h"
+#include "RConfigure.h" // R__USE_IMT
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+#include <algorithm>
 
 ClassImp(TFoam);
 
@@ -557,36 +579,57 @@ void TFoam::Explore(TFoamCell *cell)
    for(i=0;i<fDim;i++) ((TH1D *)(*fHistEdg)[i])->Reset(); // Reset histograms
    fHistWt->Reset();
    //
+   // With OptPar=1 the points are drawn in chunks, on which the distribution is evaluated in parallel
+   Long_t nChunk = 1;
+#ifdef R__USE_IMT
+   if (fOptPar == 1 && fRho && ROOT::IsImplicitMTEnabled() && fDim > 0)
+      nChunk = std::min<Long_t>(std::max<Long_t>(fNSampl, 1), 256);
+#endif
+   std::vector<Double_t> alphas(nChunk * fDim), points(nChunk * fDim), values(nChunk);
    // ||||||||||||||||||||||||||BEGIN MC LOOP|||||||||||||||||||||||||||||
    Double_t nevEff=0.;
-   for(iev=0;iev<fNSampl;iev++){
-      MakeAlpha();               // generate uniformly vector inside hypercube
-
-      if(fDim>0){
-      for(j=0; j<fDim; j++)
-         xRand[j]= cellPosi[j] +fAlpha[j]*(cellSize[j]);
+   Bool_t done = kFALSE;
+   for(iev=0; iev<fNSampl && !done; iev+=nChunk){
+      const Long_t nPoints = std::min(nChunk, fNSampl - iev);
+      for(Long_t ip=0; ip<nPoints; ip++){
+         MakeAlpha();               // generate uniformly vector inside hypercube
+         for(j=0; j<fDim; j++){
+            alphas[ip*fDim + j] = fAlpha[j];
+            points[ip*fDim + j] = cellPosi[j] +fAlpha[j]*(cellSize[j]);
+         }
+      }
+      if (nChunk == 1) {
+         for(j=0; j<fDim; j++) xRand[j] = points[j];
+         values[0] = Eval(xRand);
+      } else {
+         EvalPoints(nPoints, points.data(), values.data());
       }
+      fNCalls += nPoints;
 
-      wt=dx*Eval(xRand);
+      for(Long_t ip=0; ip<nPoints; ip++){
+         wt=dx*values[ip];
 
-      nProj = 0;
-      if(fDim>0) {
-         for(k=0; k<fDim; k++) {
-            xproj =fAlpha[k];
-            ((TH1D *)(*fHistEdg)[nProj])->Fill(xproj,wt);
-            nProj++;
+         nProj = 0;
+         if(fDim>0) {
+            for(k=0; k<fDim; k++) {
+               xproj =alphas[ip*fDim + k];
+               ((TH1D *)(*fHistEdg)[nProj])->Fill(xproj,wt);
+               nProj++;
+            }
+         }
+         //
+         ceSum[0] += wt;    // sum of weights
+         ceSum[1] += wt*wt; // sum of weights squared
+         ceSum[2]++;        // sum of 1
+         if (ceSum[3]>wt) ceSum[3]=wt;  // minimum weight;
+         if (ceSum[4]<wt) ceSum[4]=wt;  // maximum weight
+         // test MC loop exit condition
+         nevEff = ceSum[1] == 0. ? 0. : ceSum[0]*ceSum[0]/ceSum[1];
+         if( nevEff >= fNBin*fEvPerBin) {
+            done = kTRUE;
+            break;
          }
       }
-      //
-      fNCalls++;
-      ceSum[0] += wt;    // sum of weights
-      ceSum[1] += wt*wt; // sum of weights squared
-      ceSum[2]++;        // sum of 1
-      if (ceSum[3]>wt) ceSum[3]=wt;  // minimum weight;
-      if (ceSum[4]<wt) ceSum[4]=wt;  // maximum weight
-      // test MC loop exit condition
-      nevEff = ceSum[1] == 0. ? 0. : ceSum[0]*ceSum[0]/ceSum[1];
-      if( nevEff >= fNBin*fEvPerBin) break;
    }   // ||||||||||||||||||||||||||END MC LOOP|||||||||||||||||||||||||||||
    //------------------------------------------------------------------
    //---  predefine logics of searching for the best division edge ---
@@ -1076,6 +1119,27 @@ Double_t TFoam::Eval(Double_t *xRand)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method used by Explore with OptPar=1.
+/// Evaluates the distribution on n points of fDim coordinates, in parallel.
+/// The distribution object fRho is called directly, Eval is not used.
+
+void TFoam::EvalPoints(Long_t n, const Double_t *points, Double_t *values)
+{
+   // Density() takes a non-const pointer: each point gets a copy of its coordinates
+   auto evalPoint = [&](Long_t i) {
+      std::vector<Double_t> x(points + i * fDim, points + (i + 1) * fDim);
+      values[i] = fRho->Density(fDim, x.data());
+   };
+#ifdef R__USE_IMT
+   ROOT::TThreadExecutor pool;
+   pool.Foreach(evalPoint, ROOT::TSeq<Long_t>(n));
+#else
+   for (Long_t i = 0; i < n; i++)
+      evalPoint(i);
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Internal method.
 /// Return randomly chosen active cell with probability equal to its
@@ -1199,6 +1263,21 @@ Double_t TFoam::MCgenerate(Double_t *MCvect)
    return(fMCwt);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// User method which generates n MC events at once.
+/// The MC vectors are written one after the other to MCvect, which must hold
+/// n*kDim values; if MCwt is not null, it receives the n MC weights.
+
+void TFoam::MakeEvents(Long_t n, Double_t *MCvect, Double_t *MCwt)
+{
+   for (Long_t i = 0; i < n; i++) {
+      MakeEvent();
+      std::copy(fMCvect, fMCvect + fDim, MCvect + i * fDim);
+      if (MCwt)
+         MCwt[i] = fMCwt;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// User method.
 /// It provides the value of the integral calculated from the averages of the MC run
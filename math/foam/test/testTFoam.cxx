@@ -4,9 +4,14 @@
 #include "TFoam.h"
 #include "TFile.h"
 #include "TMath.h"
+#include "TRandom3.h"
+#include "TROOT.h"
 
 #include "gtest/gtest.h"
 
+#include <memory>
+#include <vector>
+
 Double_t sqr(Double_t x){
    return x*x;
 }
@@ -50,3 +55,57 @@ TEST(TFoam, Readv1) {
     EXPECT_NEAR(x[1], results[i][1], 1.E-9);
   }
 }
+
+std::unique_ptr<TFoam> makeCamelFoam(TRandom &rng, Int_t optPar)
+{
+  auto foam = std::make_unique<TFoam>("foam");
+  foam->SetkDim(2);
+  foam->SetnCells(500);
+  foam->SetChat(0);
+  foam->SetOptPar(optPar);
+  foam->SetRhoInt(Camel2);
+  foam->SetPseRan(&rng);
+  foam->Initialize();
+  return foam;
+}
+
+// MakeEvents must give the same events as repeated calls of MakeEvent
+TEST(TFoam, MakeEvents) {
+  TRandom3 rng1(42), rng2(42);
+  auto foam1 = makeCamelFoam(rng1, 0);
+  auto foam2 = makeCamelFoam(rng2, 0);
+
+  constexpr Long_t n = 100;
+  std::vector<double> x(2 * n), wt(n);
+  foam1->MakeEvents(n, x.data(), wt.data());
+  for (Long_t i = 0; i < n; ++i) {
+    double y[2];
+    const double w = foam2->MCgenerate(y);
+    EXPECT_EQ(x[2 * i], y[0]);
+    EXPECT_EQ(x[2 * i + 1], y[1]);
+    EXPECT_EQ(wt[i], w);
+  }
+}
+
+#ifdef R__USE_IMT
+// The foam built with a parallel exploration must not depend on the number of threads
+TEST(TFoam, ParallelExploration) {
+  TRandom3 rng1(1), rng2(1);
+  ROOT::EnableImplicitMT(2);
+  auto foam1 = makeCamelFoam(rng1, 1);
+  ROOT::DisableImplicitMT();
+  ROOT::EnableImplicitMT(4);
+  auto foam2 = makeCamelFoam(rng2, 1);
+  ROOT::DisableImplicitMT();
+
+  EXPECT_EQ(foam1->GetnCalls(), foam2->GetnCalls());
+  EXPECT_EQ(foam1->GetPrimary(), foam2->GetPrimary());
+  for (int i = 0; i < 10; ++i) {
+    double x1[2], x2[2];
+    foam1->MCgenerate(x1);
+    foam2->MCgenerate(x2);
+    EXPECT_EQ(x1[0], x2[0]);
+    EXPECT_EQ(x1[1], x2[1]);
+  }
+}
+#endif
@@ -0,0 +1,495 @@
+// @(#)root/mathcore:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2005 , LCG ROOT MathLib Team                         *
+ *                                                                    *
+ *                                                                    *
+ **********************************************************************/
+
+// Header file for class LorentzVectorBatch
+
+#ifndef ROOT_Math_GenVector_LorentzVectorBatch
+#define ROOT_Math_GenVector_LorentzVectorBatch 1
+
+#include "Math/GenVector/LorentzVector.h"
+
+#include "Math/GenVector/GenVector_exception.h"
+#include "Math/GenVector/etaMax.h"
+
+#include "RConfigure.h" // for R__HAS_VDT
+
+#ifdef R__HAS_VDT
+#include <vdt/vdtMath.h>
+#endif
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace ROOT {
+
+namespace Math {
+
+namespace Impl {
+
+/**
+   Elementary functions used in the loops of LorentzVectorBatch. For float and double they are the inline and
+   branchless vdt functions when ROOT is built with vdt, which the compiler can vectorize, and the standard ones
+   otherwise. The vdt functions differ from the standard ones by a few units in the last place.
+*/
+template <class Scalar>
+inline void BatchSinCos(Scalar x, Scalar &s, Scalar &c)
+{
+   using std::cos;
+   using std::sin;
+   s = sin(x);
+   c = cos(x);
+}
+template <class Scalar>
+inline Scalar BatchExp(Scalar x)
+{
+   using std::exp;
+   return exp(x);
+}
+template <class Scalar>
+inline Scalar BatchLog(Scalar x)
+{
+   using std::log;
+   return log(x);
+}
+template <class Scalar>
+inline Scalar BatchAtan2(Scalar y, Scalar x)
+{
+   using std::atan2;
+   return atan2(y, x);
+}
+template <class Scalar>
+inline Scalar BatchSinh(Scalar x)
+{
+   using std::sinh;
+   return sinh(x);
+}
+
+#ifdef R__HAS_VDT
+inline void BatchSinCos(double x, double &s, double &c)
+{
+   vdt::fast_sincos(x, s, c);
+}
+inline void BatchSinCos(float x, float &s, float &c)
+{
+   vdt::fast_sincosf(x, s, c);
+}
+inline double BatchExp(double x)
+{
+   return vdt::fast_exp(x);
+}
+inline float BatchExp(float x)
+{
+   return vdt::fast_expf(x);
+}
+inline double BatchLog(double x)
+{
+   return vdt::fast_log(x);
+}
+inline float BatchLog(float x)
+{
+   return vdt::fast_logf(x);
+}
+inline double BatchAtan2(double y, double x)
+{
+   return vdt::fast_atan2(y, x);
+}
+inline float BatchAtan2(float y, float x)
+{
+   return vdt::fast_atan2f(y, x);
+}
+// sinh(x) from a single exponential
+inline double BatchSinh(double x)
+{
+   const double e = vdt::fast_exp(x);
+   return 0.5 * (e - 1. / e);
+}
+inline float BatchSinh(float x)
+{
+   const float e = vdt::fast_expf(x);
+   return 0.5f * (e - 1.f / e);
+}
+#endif
+
+
+} // namespace Impl
+
+//__________________________________________________________________________________________
+/** @ingroup GenVector
+
+Class holding a collection of Lorentz vectors as four arrays of the Cartesian components (px, py, pz, E),
+i.e. as a structure of arrays.
+
+The operations on the whole collection (Boost(), M(), Pt(), the sum of two collections, ...) are loops over the
+contiguous components, which the compiler vectorizes, while a container of LorentzVector objects is processed one
+object at a time. The results are the same as those of the corresponding LorentzVector operations, up to the
+rounding of the elementary functions: the conversions from and to the pt, eta, phi coordinates use the vdt
+functions when ROOT is built with vdt, which agree with the standard ones to a few units in the last place.
+
+The Container of the components is std::vector<double> by default. With ROOT::RVec the components and the results
+of M(), Pt(), ... are RVecs, so that the class can be used on the columns of an RDataFrame:
+
+~~~ {.cpp}
+using ROOT::RVecD;
+using Batch = ROOT::Math::LorentzVectorBatch<RVecD>;
+df.Define("mll", [](const RVecD &pt, const RVecD &eta, const RVecD &phi, const RVecD &m) {
+   auto l = Batch::FromPtEtaPhiM(pt, eta, phi, m);
+   return InvariantMasses(l, l.Boosted(0., 0., 0.5));
+}, {"lep_pt", "lep_eta", "lep_phi", "lep_m"});
+~~~
+
+This replaces the RVec<PtEtaPhiMVector> built by VecOps::Construct, whose conversions call the transcendental
+functions object by object. The collections are converted back with Pt(), Eta(), Phi() and M(), and Sum() gives
+the sum of all the vectors, e.g. of all the jets of an event.
+
+The Container must provide size(), resize(n), push_back(x) and operator[].
+
+@sa Overview of the @ref GenVector "physics vector library"
+*/
+
+template <class Container = std::vector<double>>
+class LorentzVectorBatch {
+
+public:
+   typedef typename Container::value_type Scalar;
+   typedef LorentzVector<PxPyPzE4D<Scalar>> value_type;
+
+   /// empty collection
+   LorentzVectorBatch() {}
+
+   /// collection of n null vectors
+   explicit LorentzVectorBatch(std::size_t n)
+   {
+      fX.resize(n);
+      fY.resize(n);
+      fZ.resize(n);
+      fT.resize(n);
+      for (std::size_t i = 0; i < n; ++i)
+         fX[i] = fY[i] = fZ[i] = fT[i] = Scalar(0);
+   }
+
+   /// collection from the components px, py, pz and E, which must have the same size
+   LorentzVectorBatch(const Container &x, const Container &y, const Container &z, const Container &t)
+      : fX(x), fY(y), fZ(z), fT(t)
+   {
+      if (fY.size() != fX.size() || fZ.size() != fX.size() || fT.size() != fX.size()) {
+         GenVector::Throw("LorentzVectorBatch: the components have different sizes");
+         *this = LorentzVectorBatch();
+      }
+   }
+
+   /// collection from the collections of pt, eta, phi and mass, which must have the same size
+   template <class C>
+   static LorentzVectorBatch FromPtEtaPhiM(const C &pt, const C &eta, const C &phi, const C &m)
+   {
+      const std::size_t n = pt.size();
+      if (eta.size() != n || phi.size() != n || m.size() != n) {
+         GenVector::Throw("LorentzVectorBatch::FromPtEtaPhiM: the collections have different sizes");
+         return LorentzVectorBatch();
+      }
+      LorentzVectorBatch v(n);
+      v.SetTransverse(pt, eta, phi);
+      for (std::size_t i = 0; i < n; ++i) {
+         using std::sqrt;
+         const Scalar mm = m[i];
+         v.fT[i] = sqrt(v.fX[i] * v.fX[i] + v.fY[i] * v.fY[i] + v.fZ[i] * v.fZ[i] + mm * mm);
+      }
+      return v;
+   }
+
+   /// collection from the collections of pt, eta, phi and energy, which must have the same size
+   template <class C>
+   static LorentzVectorBatch FromPtEtaPhiE(const C &pt, const C &eta, const C &phi, const C &e)
+   {
+      const std::size_t n = pt.size();
+      if (eta.size() != n || phi.size() != n || e.size() != n) {
+         GenVector::Throw("LorentzVectorBatch::FromPtEtaPhiE: the collections have different sizes");
+         return LorentzVectorBatch();
+      }
+      LorentzVectorBatch v(n);
+      v.SetTransverse(pt, eta, phi);
+      for (std::size_t i = 0; i < n; ++i)
+         v.fT[i] = e[i];
+      return v;
+   }
+
+   /// collection from the collections of px, py, pz and mass, which must have the same size
+   template <class C>
+   static LorentzVectorBatch FromPxPyPzM(const C &x, const C &y, const C &z, const C &m)
+   {
+      const std::size_t n = x.size();
+      if (y.size() != n || z.size() != n || m.size() != n) {
+         GenVector::Throw("LorentzVectorBatch::FromPxPyPzM: the collections have different sizes");
+         return LorentzVectorBatch();
+      }
+      LorentzVectorBatch v(n);
+      for (std::size_t i = 0; i < n; ++i) {
+         using std::sqrt;
+         const Scalar px = x[i];
+         const Scalar py = y[i];
+         const Scalar pz = z[i];
+         const Scalar mm = m[i];
+         v.fX[i] = px;
+         v.fY[i] = py;
+         v.fZ[i] = pz;
+         v.fT[i] = sqrt(px * px + py * py + pz * pz + mm * mm);
+      }
+      return v;
+   }
+
+   std::size_t size() const { return fX.size(); }
+
+   /// vector i of the collection
+   value_type operator[](std::size_t i) const { return value_type(fX[i], fY[i], fZ[i], fT[i]); }
+
+   /// append a Lorentz vector in any coordinate system
+   template <class CoordSystem>
+   void push_back(const LorentzVector<CoordSystem> &v)
+   {
+      fX.push_back(v.Px());
+      fY.push_back(v.Py());
+      fZ.push_back(v.Pz());
+      fT.push_back(v.E());
+   }
+
+   const Container &X() const { return fX; }
+   const Container &Y() const { return fY; }
+   const Container &Z() const { return fZ; }
+   const Container &T() const { return fT; }
+
+   /// the squared masses
+   Container M2() const
+   {
+      Container m2(fX);
+      for (std::size_t i = 0; i < size(); ++i)
+         m2[i] = fT[i] * fT[i] - fX[i] * fX[i] - fY[i] * fY[i] - fZ[i] * fZ[i];
+      return m2;
+   }
+
+   /// the masses; as for PxPyPzE4D::M(), the mass is -sqrt(-M2) for a space-like vector, but no error is reported
+   Container M() const
+   {
+      Container m(M2());
+      for (std::size_t i = 0; i < size(); ++i) {
+         using std::sqrt;
+         const Scalar mm = m[i];
+         m[i] = mm >= 0 ? sqrt(mm) : -sqrt(-mm);
+      }
+      return m;
+   }
+
+   /// the transverse momenta
+   Container Pt() const
+   {
+      Container pt(fX);
+      for (std::size_t i = 0; i < size(); ++i) {
+         using std::sqrt;
+         pt[i] = sqrt(fX[i] * fX[i] + fY[i] * fY[i]);
+      }
+      return pt;
+   }
+
+   /// the pseudorapidities, as PxPyPzE4D::Eta()
+   Container Eta() const
+   {
+      Container eta(fX);
+      for (std::size_t i = 0; i < size(); ++i) {
+         using std::abs;
+         using std::copysign;
+         using std::sqrt;
+         const Scalar z = fZ[i];
+         const Scalar rho = sqrt(fX[i] * fX[i] + fY[i] * fY[i]);
+         // eta = sign(z) * log(|z|/rho + sqrt((z/rho)^2 + 1)), without the cancellation of the formula for z < 0
+         const Scalar zs = abs(z) / (rho > 0 ? rho : Scalar(1));
+         const Scalar e = copysign(Impl::BatchLog(zs + sqrt(zs * zs + Scalar(1))), z);
+         eta[i] = rho > 0 ? e : (z == 0 ? Scalar(0) : z + copysign(etaMax<Scalar>(), z));
+      }
+      return eta;
+   }
+
+   /// the azimuthal angles in (-pi, pi], 0 for the vectors along the z axis
+   Container Phi() const
+   {
+      Container phi(fX);
+      for (std::size_t i = 0; i < size(); ++i) {
+         const Scalar x = fX[i];
+         const Scalar y = fY[i];
+         phi[i] = (x == 0 && y == 0) ? Scalar(0) : Impl::BatchAtan2(y, x);
+      }
+      return phi;
+   }
+
+   /// the rapidities, 0.5 * log((E + pz) / (E - pz))
+   Container Rapidity() const
+   {
+      Container y(fX);
+      for (std::size_t i = 0; i < size(); ++i)
+         y[i] = Scalar(0.5) * Impl::BatchLog((fT[i] + fZ[i]) / (fT[i] - fZ[i]));
+      return y;
+   }
+
+   /// the sum of all the vectors of the collection
+   value_type Sum() const
+   {
+      Scalar x = 0, y = 0, z = 0, t = 0;
+      for (std::size_t i = 0; i < size(); ++i) {
+         x += fX[i];
+         y += fY[i];
+         z += fZ[i];
+         t += fT[i];
+      }
+      return value_type(x, y, z, t);
+   }
+
+   /**
+      Boost all the vectors with the velocity (bx, by, bz), as VectorUtil::boost() does; the beta of the boost must
+      be smaller than 1, otherwise the collection is left unchanged
+   */
+   void Boost(Scalar bx, Scalar by, Scalar bz)
+   {
+      const Scalar b2 = bx * bx + by * by + bz * bz;
+      if (b2 >= 1) {
+         GenVector::Throw("LorentzVectorBatch::Boost: beta vector supplied to set Boost represents speed >= c");
+         return;
+      }
+      using std::sqrt;
+      const Scalar gamma = 1.0 / sqrt(1.0 - b2);
+      const Scalar gamma2 = b2 > 0 ? (gamma - 1.0) / b2 : 0.0;
+      for (std::size_t i = 0; i < size(); ++i) {
+         const Scalar bp = bx * fX[i] + by * fY[i] + bz * fZ[i];
+         const Scalar t = fT[i];
+         fX[i] = fX[i] + gamma2 * bp * bx + gamma * bx * t;
+         fY[i] = fY[i] + gamma2 * bp * by + gamma * by * t;
+         fZ[i] = fZ[i] + gamma2 * bp * bz + gamma * bz * t;
+         fT[i] = gamma * (t + bp);
+      }
+   }
+
+   /**
+      Boost each vector i with its own velocity (bx[i], by[i], bz[i]); the collections of the velocity components
+      must have the size of this collection and all the betas must be smaller than 1, otherwise the collection is
+      left unchanged
+   */
+   template <class C>
+   void Boost(const C &bx, const C &by, const C &bz)
+   {
+      if (bx.size() != size() || by.size() != size() || bz.size() != size()) {
+         GenVector::Throw("LorentzVectorBatch::Boost: the collections of the boost components have a different size");
+         return;
+      }
+      bool ok = true;
+      for (std::size_t i = 0; i < size(); ++i)
+         ok &= bx[i] * bx[i] + by[i] * by[i] + bz[i] * bz[i] < 1;
+      if (!ok) {
+         GenVector::Throw("LorentzVectorBatch::Boost: beta vector supplied to set Boost represents speed >= c");
+         return;
+      }
+      for (std::size_t i = 0; i < size(); ++i) {
+         using std::sqrt;
+         const Scalar x = bx[i];
+         const Scalar y = by[i];
+         const Scalar z = bz[i];
+         const Scalar b2 = x * x + y * y + z * z;
+         const Scalar gamma = Scalar(1) / sqrt(Scalar(1) - b2);
+         const Scalar gamma2 = b2 > 0 ? (gamma - Scalar(1)) / b2 : Scalar(0);
+         const Scalar bp = x * fX[i] + y * fY[i] + z * fZ[i];
+         const Scalar t = fT[i];
+         fX[i] = fX[i] + gamma2 * bp * x + gamma * x * t;
+         fY[i] = fY[i] + gamma2 * bp * y + gamma * y * t;
+         fZ[i] = fZ[i] + gamma2 * bp * z + gamma * z * t;
+         fT[i] = gamma * (t + bp);
+      }
+   }
+
+   /**
+      Boost each vector i to the rest frame of frames[i], i.e. with the velocity frames[i].BoostToCM(), e.g. the
+      decay products of a collection of particles; the frames must be time-like, otherwise the collection is left
+      unchanged
+   */
+   void BoostToRestFrames(const LorentzVectorBatch &frames)
+   {
+      if (frames.size() != size()) {
+         GenVector::Throw("LorentzVectorBatch::BoostToRestFrames: the collections have different sizes");
+         return;
+      }
+      Container bx(frames.fX), by(frames.fY), bz(frames.fZ);
+      for (std::size_t i = 0; i < size(); ++i) {
+         const Scalar invE = Scalar(-1) / frames.fT[i];
+         bx[i] *= invE;
+         by[i] *= invE;
+         bz[i] *= invE;
+      }
+      Boost(bx, by, bz);
+   }
+
+   /// copy of the collection, boosted with the velocity (bx, by, bz)
+   LorentzVectorBatch Boosted(Scalar bx, Scalar by, Scalar bz) const
+   {
+      LorentzVectorBatch v(*this);
+      v.Boost(bx, by, bz);
+      return v;
+   }
+
+   /// add the vectors of v, which must have the same size, one by one
+   LorentzVectorBatch &operator+=(const LorentzVectorBatch &v)
+   {
+      if (v.size() != size()) {
+         GenVector::Throw("LorentzVectorBatch::operator+=: the collections have different sizes");
+         return *this;
+      }
+      for (std::size_t i = 0; i < size(); ++i) {
+         fX[i] += v.fX[i];
+         fY[i] += v.fY[i];
+         fZ[i] += v.fZ[i];
+         fT[i] += v.fT[i];
+      }
+      return *this;
+   }
+
+private:
+   /// set the Cartesian spatial components from pt, eta and phi
+   template <class C>
+   void SetTransverse(const C &pt, const C &eta, const C &phi)
+   {
+      for (std::size_t i = 0; i < size(); ++i) {
+         Scalar s, c;
+         Impl::BatchSinCos(Scalar(phi[i]), s, c);
+         const Scalar p = pt[i];
+         fX[i] = p * c;
+         fY[i] = p * s;
+         fZ[i] = p * Impl::BatchSinh(Scalar(eta[i]));
+      }
+   }
+
+   Container fX;
+   Container fY;
+   Container fZ;
+   Container fT;
+};
+
+/// the vectors of a and b, which must have the same size, added one by one
+template <class Container>
+LorentzVectorBatch<Container> operator+(LorentzVectorBatch<Container> a, const LorentzVectorBatch<Container> &b)
+{
+   a += b;
+   return a;
+}
+
+/// the invariant masses of the pairs (a[i], b[i]), for collections a and b of the same size
+template <class Container>
+Container InvariantMasses(const LorentzVectorBatch<Container> &a, const LorentzVectorBatch<Container> &b)
+{
+   return (a + b).M();
+}
+
+} // namespace Math
+
+} // namespace ROOT
+
+#endif
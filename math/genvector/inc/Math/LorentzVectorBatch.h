@@ -0,0 +1,10 @@
+// @(#)root/mathcore:$Id$
+
+#ifndef ROOT_Math_LorentzVectorBatch
+#define ROOT_Math_LorentzVectorBatch
+
+
+#include "Math/GenVector/LorentzVectorBatch.h"
+
+
+#endif
@@ -0,0 +1,198 @@
+// test the batch types SMatrixBatch and LorentzVectorBatch against the operations on single objects
+
+#include "Math/LorentzVectorBatch.h"
+#include "Math/SMatrixBatch.h"
+#include "Math/Vector3D.h"
+#include "Math/Vector4D.h"
+#include "Math/VectorUtil.h"
+#include "ROOT/RVec.hxx"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace ROOT::Math;
+
+namespace {
+
+constexpr unsigned int kN = 13;
+
+typedef SMatrix<double, 5, 5> Matrix5;
+typedef SMatrix<double, 5, 5, MatRepSym<double, 5>> SymMatrix5;
+
+// a deterministic matrix, symmetric positive definite for diag > 0
+Matrix5 TestMatrix(unsigned int k, double diag)
+{
+   Matrix5 a;
+   for (unsigned int i = 0; i < 5; ++i)
+      for (unsigned int j = 0; j < 5; ++j)
+         a(i, j) = std::sin(1. + k + 7 * i + 3 * j);
+   Matrix5 s = a * Transpose(a);
+   for (unsigned int i = 0; i < 5; ++i)
+      s(i, i) += diag;
+   return s;
+}
+
+} // anonymous namespace
+
+TEST(SMatrixBatch, Multiply)
+{
+   SMatrixBatch<double, 5, 5, kN> a, b, c;
+   for (unsigned int k = 0; k < kN; ++k) {
+      a.Set(k, TestMatrix(k, 0.));
+      b.Set(k, TestMatrix(k + 100, 1.));
+   }
+   Multiply(a, b, c);
+   for (unsigned int k = 0; k < kN; ++k) {
+      Matrix5 ref = a.Get(k) * b.Get(k);
+      for (unsigned int i = 0; i < 5; ++i)
+         for (unsigned int j = 0; j < 5; ++j)
+            EXPECT_NEAR(ref(i, j), c(i, j, k), 1e-13);
+   }
+}
+
+TEST(SMatrixBatch, Similarity)
+{
+   SMatrixBatch<double, 5, 5, kN> a, s, c;
+   for (unsigned int k = 0; k < kN; ++k) {
+      a.Set(k, TestMatrix(k, -2.));
+      s.Set(k, SymMatrix5(TestMatrix(k + 100, 1.).LowerBlock()));
+   }
+   Similarity(a, s, c);
+   for (unsigned int k = 0; k < kN; ++k) {
+      SymMatrix5 ref = Similarity(a.Get(k), SymMatrix5(s.Get(k).LowerBlock()));
+      for (unsigned int i = 0; i < 5; ++i)
+         for (unsigned int j = 0; j < 5; ++j)
+            EXPECT_NEAR(ref(i, j), c(i, j, k), 1e-12);
+   }
+}
+
+TEST(SMatrixBatch, InvertChol)
+{
+   SMatrixBatch<double, 5, 5, kN> m;
+   for (unsigned int k = 0; k < kN; ++k)
+      m.Set(k, TestMatrix(k, k == 4 ? -10. : 0.1));
+   SMatrixBatch<double, 5, 5, kN> inv(m);
+   bool ok[kN];
+   EXPECT_FALSE(inv.InvertChol(ok));
+   for (unsigned int k = 0; k < kN; ++k) {
+      SymMatrix5 ref(m.Get(k).LowerBlock());
+      EXPECT_EQ(ref.InvertChol(), ok[k]);
+      EXPECT_EQ(k != 4, ok[k]);
+      // the matrix which is not positive definite is unchanged
+      if (!ok[k])
+         ref = SymMatrix5(m.Get(k).LowerBlock());
+      for (unsigned int i = 0; i < 5; ++i)
+         for (unsigned int j = 0; j < 5; ++j)
+            EXPECT_NEAR(ref(i, j), inv(i, j, k), 1e-12 * std::abs(ref(i, i)));
+   }
+}
+
+TEST(LorentzVectorBatch, Operations)
+{
+   ROOT::RVecD pt{10., 20., 30.};
+   ROOT::RVecD eta{0.1, -1., 2.};
+   ROOT::RVecD phi{0.3, 2., -2.};
+   ROOT::RVecD m{0.1, 0.5, 100.};
+   auto batch = LorentzVectorBatch<ROOT::RVecD>::FromPtEtaPhiM(pt, eta, phi, m);
+   auto boosted = batch.Boosted(0.1, -0.2, 0.5);
+   ROOT::RVecD masses = batch.M();
+   ROOT::RVecD pairMasses = InvariantMasses(batch, boosted);
+   ASSERT_EQ(3u, batch.size());
+   for (unsigned int i = 0; i < 3; ++i) {
+      PxPyPzEVector v(PtEtaPhiMVector(pt[i], eta[i], phi[i], m[i]));
+      PxPyPzEVector w = VectorUtil::boost(v, XYZVector(0.1, -0.2, 0.5));
+      // the conversion from pt, eta, phi may use the vdt functions
+      EXPECT_NEAR(v.Px(), batch[i].Px(), 1e-14 * v.E());
+      EXPECT_NEAR(v.E(), batch[i].E(), 1e-14 * v.E());
+      EXPECT_NEAR(w.Pz(), boosted[i].Pz(), 1e-14 * w.E());
+      EXPECT_NEAR(w.E(), boosted[i].E(), 1e-14 * w.E());
+      EXPECT_NEAR(m[i], masses[i], 1e-9 * v.E());
+      EXPECT_NEAR((v + w).M(), pairMasses[i], 1e-12 * (v + w).E());
+      EXPECT_NEAR(pt[i], batch.Pt()[i], 1e-12 * pt[i]);
+   }
+   batch.push_back(PtEtaPhiMVector(1., 1., 1., 1.));
+   EXPECT_EQ(4u, batch.size());
+   EXPECT_DOUBLE_EQ(1., batch.Pt()[3]);
+}
+
+TEST(LorentzVectorBatch, Conversions)
+{
+   ROOT::RVecD pt{10., 20., 30., 0., 0.};
+   ROOT::RVecD eta{0.1, -1., -4.5, 0., 0.};
+   ROOT::RVecD phi{0.3, 2., -3., 0., 0.};
+   ROOT::RVecD m{0.1, 0.5, 100., 1., 1.};
+   auto batch = LorentzVectorBatch<ROOT::RVecD>::FromPtEtaPhiM(pt, eta, phi, m);
+   auto fromE = LorentzVectorBatch<ROOT::RVecD>::FromPtEtaPhiE(pt, eta, phi, batch.T());
+   auto fromM = LorentzVectorBatch<ROOT::RVecD>::FromPxPyPzM(batch.X(), batch.Y(), batch.Z(), m);
+   ROOT::RVecD etaOut = batch.Eta();
+   ROOT::RVecD phiOut = batch.Phi();
+   ROOT::RVecD y = batch.Rapidity();
+   PxPyPzEVector sum;
+   for (unsigned int i = 0; i < pt.size(); ++i) {
+      PtEtaPhiMVector v(pt[i], eta[i], phi[i], m[i]);
+      sum += PxPyPzEVector(v);
+      const double tol = 1e-14 * v.E();
+      EXPECT_NEAR(v.Px(), batch[i].Px(), tol);
+      EXPECT_NEAR(v.Py(), batch[i].Py(), tol);
+      EXPECT_NEAR(v.Pz(), batch[i].Pz(), tol);
+      EXPECT_NEAR(v.E(), batch[i].E(), tol);
+      EXPECT_NEAR(v.Pz(), fromE[i].Pz(), tol);
+      EXPECT_EQ(batch[i].E(), fromE[i].E());
+      EXPECT_NEAR(v.E(), fromM[i].E(), tol);
+      EXPECT_NEAR(v.Eta(), etaOut[i], 1e-12);
+      EXPECT_NEAR(v.Phi(), phiOut[i], 1e-14);
+      EXPECT_NEAR(v.Rapidity(), y[i], 1e-12);
+   }
+   // a vector along the z axis has eta = z +- etaMax, as PxPyPzE4D::Eta()
+   auto axis = LorentzVectorBatch<ROOT::RVecD>::FromPxPyPzM(ROOT::RVecD{0., 0.}, ROOT::RVecD{0., 0.},
+                                                            ROOT::RVecD{2., -2.}, ROOT::RVecD{1., 1.});
+   EXPECT_EQ(PxPyPzEVector(0., 0., 2., 1.).Eta(), axis.Eta()[0]);
+   EXPECT_EQ(PxPyPzEVector(0., 0., -2., 1.).Eta(), axis.Eta()[1]);
+   EXPECT_EQ(0., axis.Phi()[0]);
+   auto total = batch.Sum();
+   EXPECT_NEAR(sum.Px(), total.Px(), 1e-12);
+   EXPECT_NEAR(sum.E(), total.E(), 1e-12 * sum.E());
+   EXPECT_EQ(0., LorentzVectorBatch<ROOT::RVecD>().Sum().E());
+
+   // float collections
+   ROOT::RVecF ptF{10.f, 20.f};
+   ROOT::RVecF etaF{0.5f, -2.f};
+   ROOT::RVecF phiF{1.f, -1.f};
+   ROOT::RVecF mF{1.f, 2.f};
+   auto batchF = LorentzVectorBatch<ROOT::RVecF>::FromPtEtaPhiM(ptF, etaF, phiF, mF);
+   for (unsigned int i = 0; i < ptF.size(); ++i) {
+      EXPECT_NEAR(etaF[i], batchF.Eta()[i], 1e-5f);
+      EXPECT_NEAR(phiF[i], batchF.Phi()[i], 1e-6f);
+      EXPECT_NEAR(ptF[i], batchF.Pt()[i], 1e-5f);
+   }
+}
+
+TEST(LorentzVectorBatch, RestFrames)
+{
+   ROOT::RVecD pt{10., 20., 30.};
+   ROOT::RVecD eta{0.1, -1., 2.};
+   ROOT::RVecD phi{0.3, 2., -2.};
+   ROOT::RVecD m{0.1, 0.5, 100.};
+   auto batch = LorentzVectorBatch<ROOT::RVecD>::FromPtEtaPhiM(pt, eta, phi, m);
+   auto frames = LorentzVectorBatch<ROOT::RVecD>::FromPtEtaPhiM(ROOT::RVecD{5., 50., 1.}, ROOT::RVecD{0., 1., -1.},
+                                                               ROOT::RVecD{1., -1., 0.}, ROOT::RVecD{10., 90., 3.});
+   auto boosted = batch;
+   boosted.BoostToRestFrames(frames);
+   auto restFrames = frames;
+   restFrames.BoostToRestFrames(frames);
+   for (unsigned int i = 0; i < 3; ++i) {
+      PxPyPzEVector w = VectorUtil::boost(batch[i], frames[i].BoostToCM());
+      EXPECT_NEAR(w.Px(), boosted[i].Px(), 1e-12 * w.E());
+      EXPECT_NEAR(w.Pz(), boosted[i].Pz(), 1e-12 * w.E());
+      EXPECT_NEAR(w.E(), boosted[i].E(), 1e-12 * w.E());
+      // a frame is at rest in its own rest frame
+      EXPECT_NEAR(0., restFrames[i].P(), 1e-12 * frames[i].E());
+      EXPECT_NEAR(frames[i].M(), restFrames[i].E(), 1e-12 * frames[i].E());
+   }
+   // a boost with a beta >= 1 leaves the collection unchanged
+   auto unchanged = batch;
+   unchanged.Boost(ROOT::RVecD{0., 0., 1.}, ROOT::RVecD{0., 0., 0.}, ROOT::RVecD{0., 0., 0.});
+   EXPECT_EQ(batch[2].E(), unchanged[2].E());
+}
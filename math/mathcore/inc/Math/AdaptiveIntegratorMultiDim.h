@@ -15,9 +15,12 @@
 #define ROOT_Math_AdaptiveIntegratorMultiDim
 
 #include "Math/IFunctionfwd.h"
+#include "Math/Types.h"
 
 #include "Math/VirtualIntegrator.h"
 
+#include "ROOT/EExecutionPolicy.hxx"
+
 namespace ROOT {
 namespace Math {
 
@@ -66,7 +69,12 @@ For a more detailed description of the method see References.
   1..Multi-dimensional integration is time-consuming. For each rectangular
      subregion, the routine requires function evaluations.
      Careful programming of the integrand might result in substantial saving
-     of time.
+     of time. The nodes of the two halves of a divided region are evaluated
+     together: with a vectorized integrand (a ROOT::Math::IBaseFunctionMultiDimTempl<ROOT::Double_v>,
+     when ROOT is built with VecCore) several nodes are evaluated per call, and with
+     the ROOT::EExecutionPolicy::kMultiThread policy the nodes are distributed over
+     the threads of the ROOT thread pool, in which case the integrand must be thread-safe.
+     The result does not depend on the way the nodes are evaluated.
   2..Numerical integration usually works best for smooth functions.
      Some analysis or suitable transformations of the integral prior to
      numerical work may contribute to numerical efficiency.
@@ -127,6 +135,18 @@ public:
    /// set the integration function (must implement multi-dim function interface: IBaseFunctionMultiDim)
    void SetFunction(const IMultiGenFunction &f) override;
 
+#ifdef R__HAS_VECCORE
+   /// set a vectorized integration function, evaluated at ROOT::Double_v nodes at once
+   void SetFunction(const IBaseFunctionMultiDimTempl<ROOT::Double_v> &f);
+#endif
+
+   /// set the execution policy for evaluating the nodes of the regions: ROOT::EExecutionPolicy::kSequential
+   /// (default) or ROOT::EExecutionPolicy::kMultiThread, which requires a thread-safe integrand
+   void SetExecutionPolicy(ROOT::EExecutionPolicy policy) { fExecutionPolicy = policy; }
+
+   /// return the execution policy
+   ROOT::EExecutionPolicy ExecutionPolicy() const { return fExecutionPolicy; }
+
    /// return result of integration
    double Result() const override { return fResult; }
 
@@ -193,6 +213,8 @@ protected:
    int fStatus;           ///< status of algorithm (error if not zero)
 
    const IMultiGenFunction* fFun;   // pointer to integrand function
+   const IBaseFunctionMultiDimTempl<ROOT::Double_v> *fVecFun = nullptr; //! vectorized integrand, used instead of fFun
+   ROOT::EExecutionPolicy fExecutionPolicy = ROOT::EExecutionPolicy::kSequential; ///< policy for evaluating the nodes
 
 };
 
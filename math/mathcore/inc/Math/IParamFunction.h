@@ -23,7 +23,9 @@
 #include "Math/Util.h"
 
 #include <cassert>
+#include <cstddef>
 #include <string>
+#include <vector>
 
 /**
    @defgroup ParamFunc Parametric Function Evaluation Interfaces.
@@ -130,6 +132,19 @@ namespace ROOT {
             return DoEval(x);
          }
 
+         /**
+            Evaluate the function at n points for the given parameters p, writing the n values in result.
+            x holds one array of n coordinates per dimension, as the coordinates of ROOT::Fit::FitData.
+            Use HasEvalN() to know whether this is faster than evaluating the points one by one.
+         */
+         void EvalN(std::size_t n, const T *const *x, const double *p, T *result) const
+         {
+            DoEvalN(n, x, p, result);
+         }
+
+         /// Return true if the function implements a faster evaluation of a set of points than one by one
+         virtual bool HasEvalN() const { return false; }
+
       private:
          /**
             Implementation of the evaluation function using the x values and the parameters.
@@ -137,6 +152,19 @@ namespace ROOT {
          */
          virtual T DoEvalPar(const T *x, const double *p) const = 0;
 
+         /**
+            Implementation of the evaluation of a set of points; by default the points are evaluated one by one
+         */
+         virtual void DoEvalN(std::size_t n, const T *const *x, const double *p, T *result) const
+         {
+            std::vector<T> point(this->NDim());
+            for (std::size_t i = 0; i < n; ++i) {
+               for (unsigned int j = 0; j < point.size(); ++j)
+                  point[j] = x[j][i];
+               result[i] = DoEvalPar(point.data(), p);
+            }
+         }
+
          /**
             Implement the ROOT::Math::IBaseFunctionMultiDim interface DoEval(x) using the cached parameter values
          */
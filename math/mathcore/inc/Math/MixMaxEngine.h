@@ -131,14 +131,18 @@ http://dx.doi.org/10.1016/j.chaos.2016.05.003
          /// set the generator seed
          void  SetSeed(Result_t seed);
 
+         /// set the generator seed and select one of \f$2^{64}\f$ streams for this seed.
+         /// The streams of all seeds are guaranteed not to overlap; SetSeedStream(seed, 0) is SetSeed(seed)
+         void  SetSeedStream(Result_t seed, uint64_t stream);
+
          // generate a random number (virtual interface)
          double Rndm() override { return Rndm_impl(); }
 
          /// generate a double random number (faster interface)
          inline double operator() () { return Rndm_impl(); }
 
-         /// generate an array of random numbers
-         void RndmArray (int n, double * array);
+         /// generate an array of random numbers, identical to n calls to operator()
+         void RndmArray (int n, double * array) override;
 
          /// generate a 64  bit integer number
          Result_t IntRndm();
@@ -38,11 +38,15 @@ public:
    double Rndm() override;
    /// Generate a double-precision random number (non-virtual method)
    double operator()();
+   /// Generate `n` double-precision random numbers, identical to `n` calls to operator()
+   void RndmArray(int n, double *array) override;
    /// Generate a random integer value with 48 bits
    uint64_t IntRndm();
 
    /// Initialize and seed the state of the generator
    void SetSeed(uint64_t seed);
+   /// Initialize and seed the state of the generator, selecting one of \f$2^{64}\f$ non-overlapping streams
+   void SetSeedStream(uint64_t seed, uint64_t stream);
    /// Skip `n` random numbers without generating them
    void Skip(uint64_t n);
 
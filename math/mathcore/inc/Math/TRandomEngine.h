@@ -19,6 +19,12 @@ namespace ROOT {
       class TRandomEngine  {
       public:
          virtual double Rndm() = 0;
+         /// generate an array of random numbers; engines producing several numbers per state
+         /// update override it to fill the array block-wise
+         virtual void RndmArray(int n, double *array) {
+            for (int i = 0; i < n; ++i)
+               array[i] = Rndm();
+         }
          virtual ~TRandomEngine() {}
       };
       
@@ -37,6 +37,18 @@
 //   * TRandomMT64 for the  StdEngine<std::mt19937_64> ( MersenneTwister 64 bits)
 //   * TRandomRanlux48 for the  StdEngine<std::ranlux48> (Ranlux 48 bits)
 //
+//  RndmArray generates the numbers in bulk with the engine, as successive
+//  calls to Rndm() would do. For the MIXMAX and RANLUX++ engines,
+//  SetSeedStream(seed, stream) selects one of 2^64 streams of a seed: the
+//  sequences of all seed and stream pairs are guaranteed not to overlap, e.g.
+//
+//     ROOT::TThreadExecutor pool;
+//     pool.Foreach([](UInt_t task) {
+//        TRandomRanluxpp rng;
+//        rng.SetSeedStream(4357, task);
+//        ...
+//     }, ROOT::TSeq<UInt_t>(ntasks));
+//
 //                                                                     //
 //////////////////////////////////////////////////////////////////////////
 
@@ -61,14 +73,23 @@ public:
    using TRandom::Rndm;
     Double_t Rndm( ) override { return fEngine(); }
     void     RndmArray(Int_t n, Float_t *array) override {
-      for (int i = 0; i < n; ++i) array[i] = fEngine();
+      Double_t buffer[256];
+      for (Int_t i = 0; i < n; i += 256) {
+         const Int_t m = (n - i < 256) ? n - i : 256;
+         fEngine.RndmArray(m, buffer);
+         for (Int_t j = 0; j < m; ++j) array[i + j] = buffer[j];
+      }
    }
     void     RndmArray(Int_t n, Double_t *array) override {
-            for (int i = 0; i < n; ++i) array[i] = fEngine();
+      fEngine.RndmArray(n, array);
    }
     void     SetSeed(ULong_t seed=0) override {
       fEngine.SetSeed(seed);
    }
+   /// Set the seed and select one of the non-overlapping streams of the seed (MIXMAX and RANLUX++ engines only)
+    void     SetSeedStream(ULong_t seed, ULong64_t stream) {
+      fEngine.SetSeedStream(seed, stream);
+   }
 
    ClassDefOverride(TRandomGen,1)  //Generic Random number generator template on the Engine type
 };
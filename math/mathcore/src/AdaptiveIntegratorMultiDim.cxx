@@ -8,10 +8,203 @@
 
 #include <cmath>
 #include <algorithm>
+#include <memory>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
 
 namespace ROOT {
 namespace Math {
 
+namespace {
+
+// Nodes of the degree seven rule for the region of center ctr and half widths wth, written to x in the order
+// in which the rule uses them: the center, the four nodes on each axis, the four nodes of each pair of axes
+// and the corners. Returns the number of nodes, which is 2^n + 2n(n+1) + 1 unless a width is zero.
+unsigned int RuleNodes(unsigned int n, const double *ctr, const double *wth, double *x)
+{
+   static const double xl2 = 0.358568582800318073;//lambda_2
+   static const double xl4 = 0.948683298050513796;//lambda_4
+   static const double xl5 = 0.688247201611685289;//lambda_5
+
+   double wthl[15], z[15];
+   unsigned int j, j1, k, l, m;
+   unsigned int nnodes = 0;
+   auto store = [&]() {
+      std::copy(z, z + n, x + nnodes * n);
+      ++nnodes;
+   };
+
+   for (j=0; j<n; j++)
+      z[j] = ctr[j];
+   store();
+
+   for (j=0; j<n; j++) {
+      z[j]    = ctr[j] - xl2*wth[j];
+      store();
+      z[j]    = ctr[j] + xl2*wth[j];
+      store();
+      wthl[j] = xl4*wth[j];
+      z[j]    = ctr[j] - wthl[j];
+      store();
+      z[j]    = ctr[j] + wthl[j];
+      store();
+      z[j]    = ctr[j];
+   }
+
+   for (j=1;j<n;j++) {
+      j1 = j-1;
+      for (k=j;k<n;k++) {
+         for (l=0;l<2;l++) {
+            wthl[j1] = -wthl[j1];
+            z[j1]    = ctr[j1] + wthl[j1];
+            for (m=0;m<2;m++) {
+               wthl[k] = -wthl[k];
+               z[k]    = ctr[k] + wthl[k];
+               store();
+            }
+         }
+         z[k] = ctr[k];
+      }
+      z[j1] = ctr[j1];
+   }
+
+   for (j=0;j<n;j++) {
+      wthl[j] = -xl5*wth[j];
+      z[j] = ctr[j] + wthl[j];
+   }
+   bool next;
+   do { //end nodes ~gray codes
+      store();
+      next = false;
+      for (j=0;j<n;j++) {
+         wthl[j] = -wthl[j];
+         z[j] = ctr[j] + wthl[j];
+         if (wthl[j] > 0) {
+            next = true;
+            break;
+         }
+      }
+   } while (next);
+
+   return nnodes;
+}
+
+// Sums of the function values f at the nodes of RuleNodes, as weighted by the rule, and the coordinate (from 1)
+// with the largest fourth difference, which is left unchanged if no difference is a number. If absValue is true
+// the absolute values are used, except at the center.
+void RuleSums(unsigned int n, unsigned int nnodes, const double *f, bool absValue, double *sum, unsigned int &idvaxn)
+{
+   auto value = [&](unsigned int i) { return absValue ? std::abs(f[i]) : f[i]; };
+   unsigned int i = 0;
+   double sum1 = f[i++];
+   double sum2 = 0, sum3 = 0, sum4 = 0, sum5 = 0, difmax = 0;
+   for (unsigned int j=0; j<n; j++) {
+      double f2 = value(i++);
+      f2 += value(i++);
+      double f3 = value(i++);
+      f3 += value(i++);
+      sum2   += f2;//sum func eval with different weights separately
+      sum3   += f3;//for a given region
+      double dif = std::abs(7*f2-f3-12*sum1);
+      //storing dimension with biggest error/difference (?)
+      if (dif >= difmax) {
+         difmax=dif;
+         idvaxn=j+1;
+      }
+   }
+   for (unsigned int npairs = 2*n*(n-1); npairs > 0; npairs--)
+      sum4 += value(i++);
+   while (i < nnodes) //sum over end nodes
+      sum5 += value(i++);
+   sum[0] = sum1;
+   sum[1] = sum2;
+   sum[2] = sum3;
+   sum[3] = sum4;
+   sum[4] = sum5;
+}
+
+// Evaluates the integrand at the nodes of the rule, in bunches of ROOT::Double_v if vecFun is given, and
+// distributing them on the threads of the pool with the multi-thread policy
+class NodeEvaluator {
+public:
+   NodeEvaluator(const IMultiGenFunction *fun, const IBaseFunctionMultiDimTempl<ROOT::Double_v> *vecFun,
+                 unsigned int dim, ROOT::EExecutionPolicy policy)
+      : fFun(fun), fVecFun(vecFun), fDim(dim)
+   {
+#ifdef R__USE_IMT
+      if (policy == ROOT::EExecutionPolicy::kMultiThread)
+         fPool = std::make_unique<ROOT::TThreadExecutor>();
+#else
+      if (policy == ROOT::EExecutionPolicy::kMultiThread)
+         MATH_WARN_MSG("AdaptiveIntegratorMultiDim::Integral",
+                       "Multithread execution policy requires IMT, which is disabled - evaluate sequentially");
+#endif
+   }
+
+   // evaluate the function at the npoints points of x (npoints * dim coordinates)
+   void operator()(unsigned int npoints, const double *x, double *f) const
+   {
+#ifdef R__USE_IMT
+      if (fPool && npoints > 1) {
+         unsigned int nchunks = std::min(npoints, ROOT::GetThreadPoolSize());
+         unsigned int chunkSize = (npoints + nchunks - 1) / nchunks;
+#ifdef R__HAS_VECCORE
+         // whole vectors per chunk
+         const unsigned int vecSize = vecCore::VectorSize<ROOT::Double_v>();
+         chunkSize = (chunkSize + vecSize - 1) / vecSize * vecSize;
+#endif
+         nchunks = (npoints + chunkSize - 1) / chunkSize;
+         auto evalChunk = [&](unsigned int ichunk) {
+            unsigned int begin = ichunk * chunkSize;
+            EvalRange(begin, std::min(npoints, begin + chunkSize), x, f);
+         };
+         fPool->Foreach(evalChunk, ROOT::TSeq<unsigned int>(nchunks));
+         return;
+      }
+#endif
+      EvalRange(0, npoints, x, f);
+   }
+
+private:
+   void EvalRange(unsigned int begin, unsigned int end, const double *x, double *f) const
+   {
+#ifdef R__HAS_VECCORE
+      if (fVecFun) {
+         const unsigned int vecSize = vecCore::VectorSize<ROOT::Double_v>();
+         std::vector<ROOT::Double_v> xv(fDim);
+         for (unsigned int i = begin; i < end; i += vecSize) {
+            // fill the lanes beyond the end with the last point
+            for (unsigned int lane = 0; lane < vecSize; ++lane) {
+               const double *point = x + std::min(i + lane, end - 1) * fDim;
+               for (unsigned int j = 0; j < fDim; ++j)
+                  vecCore::Set(xv[j], lane, point[j]);
+            }
+            ROOT::Double_v fv = (*fVecFun)(xv.data());
+            for (unsigned int lane = 0; lane < vecSize && i + lane < end; ++lane)
+               f[i + lane] = vecCore::Get(fv, lane);
+         }
+         return;
+      }
+#endif
+      for (unsigned int i = begin; i < end; ++i)
+         f[i] = (*fFun)(x + i * fDim);
+   }
+
+   const IMultiGenFunction *fFun;
+   const IBaseFunctionMultiDimTempl<ROOT::Double_v> *fVecFun;
+   unsigned int fDim;
+#ifdef R__USE_IMT
+   std::unique_ptr<ROOT::TThreadExecutor> fPool;
+#endif
+};
+
+} // anonymous namespace
+
 
 
 AdaptiveIntegratorMultiDim::AdaptiveIntegratorMultiDim(double absTol, double relTol, unsigned int maxpts, unsigned int size):
@@ -64,8 +257,19 @@ void AdaptiveIntegratorMultiDim::SetFunction(const IMultiGenFunction &f)
 {
    // set the integration function
    fFun = &f;
+   fVecFun = nullptr;
+   fDim = f.NDim();
+}
+
+#ifdef R__HAS_VECCORE
+void AdaptiveIntegratorMultiDim::SetFunction(const IBaseFunctionMultiDimTempl<ROOT::Double_v> &f)
+{
+   // set the vectorized integration function
+   fFun = nullptr;
+   fVecFun = &f;
    fDim = f.NDim();
 }
+#endif
 
 void AdaptiveIntegratorMultiDim::SetRelTolerance(double relTol){ this->fRelTol = relTol; }
 
@@ -96,11 +300,8 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
    double relerr; //an estimation of the relative accuracy of the result
 
 
-   double ctr[15], wth[15], wthl[15], z[15];
+   double ctr[15], wth[15];
 
-   static const double xl2 = 0.358568582800318073;//lambda_2
-   static const double xl4 = 0.948683298050513796;//lambda_4
-   static const double xl5 = 0.688247201611685289;//lambda_5
    static const double w2  = 980./6561; //weights/2^n
    static const double w4  = 200./19683;
    static const double wp2 = 245./486;//error weights/2^n
@@ -146,6 +347,10 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
       MATH_WARN_MSGVAL("AdaptiveIntegratorMultiDim::Integral","Wrong function dimension",n);
       return 0;
    }
+   if (!fFun && !fVecFun) {
+      MATH_ERROR_MSG("AdaptiveIntegratorMultiDim::Integral","No function has been set");
+      return 0;
+   }
 
    double twondm = std::pow(2.0,static_cast<int>(n));
    //unsigned int minpts = Int_t(twondm)+ 2*n*(n+1)+1;
@@ -177,83 +382,45 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
       wth[j] = (xmax[j] - xmin[j])*0.5;//its width
    }
 
-   double rgnvol, sum1, sum2, sum3, sum4, sum5, difmax, f2, f3, dif, aresult;
+   double rgnvol, sum1, sum2, sum3, sum4, sum5, aresult;
    double rgncmp=0, rgnval, rgnerr;
 
-   unsigned int j1, k, l, m, idvaxn=0, idvax0=0, isbtmp, isbtpp;
+   unsigned int k, idvaxn=0, idvax0=0, isbtmp, isbtpp;
 
-   //InitArgs(z,fParams);
+   // nodes and function values of a region, together with those of the second half of a divided region
+   std::vector<double> nodes(2*irlcls*n);
+   std::vector<double> fval(2*irlcls);
+   NodeEvaluator evalNodes(fFun, fVecFun, n, fExecutionPolicy);
+   double ctr2[15], sums[2][5];
+   unsigned int nnodes[2], idvax2 = 0;
+   bool pendingSecond = kFALSE;
 
 L20:
    rgnvol = twondm;//=2^n
    for (j=0; j<n; j++) {
       rgnvol *= wth[j]; //region volume
-      z[j]    = ctr[j]; //temporary node
    }
-   sum1 = (*fFun)((const double*)z);//EvalPar(z,fParams); //evaluate function
-
-   difmax = 0;
-   sum2   = 0;
-   sum3   = 0;
-
-   //loop over coordinates
-   for (j=0; j<n; j++) {
-      z[j]    = ctr[j] - xl2*wth[j];
-      if (absValue) f2 = std::abs((*fFun)(z));
-      else          f2 = (*fFun)(z);
-      z[j]    = ctr[j] + xl2*wth[j];
-      if (absValue) f2 += std::abs((*fFun)(z));
-      else          f2 += (*fFun)(z);
-      wthl[j] = xl4*wth[j];
-      z[j]    = ctr[j] - wthl[j];
-      if (absValue) f3 = std::abs((*fFun)(z));
-      else          f3 = (*fFun)(z);
-      z[j]    = ctr[j] + wthl[j];
-      if (absValue) f3 += std::abs((*fFun)(z));
-      else          f3 += (*fFun)(z);
-      sum2   += f2;//sum func eval with different weights separately
-      sum3   += f3;//for a given region
-      dif     = std::abs(7*f2-f3-12*sum1);
-      //storing dimension with biggest error/difference (?)
-      if (dif >= difmax) {
-         difmax=dif;
-         idvaxn=j+1;
+   if (pendingSecond) {
+      // the second half has been evaluated together with the first one
+      pendingSecond = kFALSE;
+      idvaxn = idvax2;
+      sum1 = sums[1][0]; sum2 = sums[1][1]; sum3 = sums[1][2]; sum4 = sums[1][3]; sum5 = sums[1][4];
+   } else {
+      nnodes[0] = RuleNodes(n, ctr, wth, nodes.data());
+      nnodes[1] = 0;
+      if (ldv) {
+         std::copy(ctr, ctr + n, ctr2);
+         ctr2[idvax0-1] += 2*wth[idvax0-1];
+         nnodes[1] = RuleNodes(n, ctr2, wth, nodes.data() + nnodes[0]*n);
       }
-      z[j]    = ctr[j];
-   }
-
-   sum4 = 0;
-   for (j=1;j<n;j++) {
-      j1 = j-1;
-      for (k=j;k<n;k++) {
-         for (l=0;l<2;l++) {
-            wthl[j1] = -wthl[j1];
-            z[j1]    = ctr[j1] + wthl[j1];
-            for (m=0;m<2;m++) {
-               wthl[k] = -wthl[k];
-               z[k]    = ctr[k] + wthl[k];
-               if (absValue) sum4 += std::abs((*fFun)(z));
-               else            sum4 += (*fFun)(z);
-            }
-         }
-         z[k] = ctr[k];
+      evalNodes(nnodes[0] + nnodes[1], nodes.data(), fval.data()); //evaluate function
+      RuleSums(n, nnodes[0], fval.data(), absValue, sums[0], idvaxn);
+      if (ldv) {
+         idvax2 = idvaxn;
+         RuleSums(n, nnodes[1], fval.data() + nnodes[0], absValue, sums[1], idvax2);
+         pendingSecond = kTRUE;
       }
-      z[j1] = ctr[j1];
-   }
-
-   sum5 = 0;
-
-   for (j=0;j<n;j++) {
-      wthl[j] = -xl5*wth[j];
-      z[j] = ctr[j] + wthl[j];
-   }
-L90: //sum over end nodes ~gray codes
-   if (absValue) sum5 += std::abs((*fFun)(z));
-   else          sum5 += (*fFun)(z);
-   for (j=0;j<n;j++) {
-      wthl[j] = -wthl[j];
-      z[j] = ctr[j] + wthl[j];
-      if (wthl[j] > 0) goto L90;
+      sum1 = sums[0][0]; sum2 = sums[0][1]; sum3 = sums[0][2]; sum4 = sums[0][3]; sum5 = sums[0][4];
    }
 
    rgncmp  = rgnvol*(wpn1[n-2]*sum1+wp2*sum2+wpn3[n-2]*sum3+wp4*sum4);
@@ -386,7 +553,7 @@ L160: //to divide or not
 double AdaptiveIntegratorMultiDim::Integral(const IMultiGenFunction &f, const double* xmin, const double * xmax)
 {
    // calculate integral passing a function object
-   fFun = &f;
+   SetFunction(f);
    return Integral(xmin, xmax);
 
 }
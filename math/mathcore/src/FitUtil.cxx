@@ -276,6 +276,14 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
 
    (const_cast<IModelFunction &>(func)).SetParameters(p);
 
+   // In the sequential case, functions that can evaluate all the points at once, e.g. TF1 defined by a formula,
+   // do so before the loop; this is only possible if the function is evaluated at the coordinates of the points
+   std::vector<double> fvals;
+   if (executionPolicy == ROOT::EExecutionPolicy::kSequential && !useBinIntegral && !useBinVolume && func.HasEvalN()) {
+      fvals.resize(n);
+      func.EvalN(n, data.GetCoordDataPtrs().data(), p, fvals.data());
+   }
+
    auto mapFunction = [&](const unsigned i){
 
       double chi2{};
@@ -316,7 +324,10 @@ double FitUtil::EvaluateChi2(const IModelFunction &func, const BinData &data, co
       }
 
 
-      if (!useBinIntegral) {
+      if (!fvals.empty()) {
+         fval = fvals[i];
+      }
+      else if (!useBinIntegral) {
 #ifdef USE_PARAMCACHE
          fval = func ( x );
 #else
@@ -1493,6 +1504,13 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
    IntegralEvaluator<> igEval(func, p, useBinIntegral, igType);
 #endif
 
+   // as in EvaluateChi2, functions that can evaluate all the points at once do so before the sequential loop
+   std::vector<double> fvals;
+   if (executionPolicy == ROOT::EExecutionPolicy::kSequential && !useBinIntegral && !useBinVolume && func.HasEvalN()) {
+      fvals.resize(n);
+      func.EvalN(n, data.GetCoordDataPtrs().data(), p, fvals.data());
+   }
+
    auto mapFunction = [&](const unsigned i) {
       auto x1 = data.GetCoordComponent(i, 0);
       auto y = *data.ValuePtr(i);
@@ -1525,7 +1543,9 @@ double FitUtil::EvaluatePoissonLogL(const IModelFunction &func, const BinData &d
          x = x1;
       }
 
-      if (!useBinIntegral) {
+      if (!fvals.empty()) {
+         fval = fvals[i];
+      } else if (!useBinIntegral) {
 #ifdef USE_PARAMCACHE
          fval = func(x);
 #else
@@ -56,6 +56,7 @@ namespace ROOT {
       }
       ~MixMaxEngineImpl() {}
       void SetSeed(uint64_t) { }
+      void SetSeedStream(uint64_t, uint64_t) { }
       double Rndm() { return -1; }
       double IntRndm() { return 0; }
       void SetState(const std::vector<uint64_t> &) { }
@@ -63,6 +64,7 @@ namespace ROOT {
       int Counter() { return -1; }
       void SetCounter(int) {}
       void Iterate() {} 
+      void IterateAndFill(double *) {}
    };
 
 
@@ -88,6 +90,10 @@ public:
       //seed_spbox(fRngState, seed);
       seed_uniquestream(fRngState, 0, 0, (uint32_t)(seed>>32), (uint32_t)seed );
    }
+   // the stream number is used as cluster and machine ID of the unique stream
+   void SetSeedStream(Result_t seed, uint64_t stream) {
+      seed_uniquestream(fRngState, (uint32_t)(stream>>32), (uint32_t)stream, (uint32_t)(seed>>32), (uint32_t)seed );
+   }
    double Rndm() {
        return get_next_float(fRngState);
    }
@@ -122,6 +128,14 @@ public:
    void RndmArray(int n, double * array) {
       fill_array(fRngState, n, array); 
    }
+   // iterate and convert the Size()-1 new numbers of the state, as successive Rndm() calls would do
+   void IterateAndFill(double * array) {
+      iterate(fRngState);
+      const myuint * v = fRngState->V;
+      for (int i = 1; i < ROOT_MM_N; ++i)
+         array[i-1] = double(int64_t(v[i])) * INV_MERSBASE;
+      fRngState->counter = ROOT_MM_N;
+   }
    void ReadState(const char filename[] ) {
       read_state(fRngState, filename);
    }
@@ -34,6 +34,14 @@ implementation draws 48 random bits for each generated floating point number
 (instead of 52 bits as in the original generator) to maintain the theoretical
 properties from understanding the original transition function of RANLUX as a
 chaotic dynamical system.
+
+The generator is seeded by skipping \f$ 2^{96} \f$ states per seed, so that the
+sequences of different seeds do not overlap within \f$ 2^{96} \f$ states (more
+than \f$ 10^{29} \f$ numbers). For parallel applications, SetSeedStream()
+additionally selects one of \f$ 2^{64} \f$ streams per seed, \f$ 2^{160} \f$ states
+apart: the sequences of all pairs of seed and stream are equally guaranteed not to
+overlap, e.g. when each task of a ROOT::TThreadExecutor uses its task number as
+the stream.
 */
 
 #include "Math/RanluxppEngine.h"
@@ -41,6 +49,7 @@ chaotic dynamical system.
 #include "ranluxpp/mulmod.h"
 #include "ranluxpp/ranlux_lcg.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 
@@ -181,6 +190,20 @@ private:
       Advance(RanluxppData<24>::kA);
    }
 
+   /// Extract the random bits at the given position of the current block
+   uint64_t ExtractBits(int position) const
+   {
+      int idx = position / 64;
+      int offset = position % 64;
+      int numBits = 64 - offset;
+
+      uint64_t bits = fState[idx] >> offset;
+      if (numBits < w) {
+         bits |= fState[idx + 1] << numBits;
+      }
+      return bits & ((uint64_t(1) << w) - 1);
+   }
+
 public:
    /// Return the next random bits, generate a new block if necessary
    uint64_t NextRandomBits()
@@ -189,15 +212,7 @@ public:
          Advance();
       }
 
-      int idx = fPosition / 64;
-      int offset = fPosition % 64;
-      int numBits = 64 - offset;
-
-      uint64_t bits = fState[idx] >> offset;
-      if (numBits < w) {
-         bits |= fState[idx + 1] << numBits;
-      }
-      bits &= ((uint64_t(1) << w) - 1);
+      uint64_t bits = ExtractBits(fPosition);
 
       fPosition += w;
       assert(fPosition <= kMaxPos && "position out of range!");
@@ -213,6 +228,25 @@ public:
       return bits * div;
    }
 
+   /// Fill an array with `n` floating point numbers, converting all numbers of a block at once.
+   void NextRandomFloats(int n, double *array)
+   {
+      static constexpr double div = 1.0 / (uint64_t(1) << w);
+      while (n > 0) {
+         if (fPosition + w > kMaxPos) {
+            Advance();
+         }
+         int numbers = std::min(n, (kMaxPos - fPosition) / w);
+         for (int i = 0; i < numbers; i++) {
+            array[i] = ExtractBits(fPosition + i * w) * div;
+         }
+         fPosition += numbers * w;
+         assert(fPosition <= kMaxPos && "position out of range!");
+         array += numbers;
+         n -= numbers;
+      }
+   }
+
    /// Initialize and seed the state of the generator as in James' implementation
    void SetSeedJames(uint64_t s)
    {
@@ -289,8 +323,10 @@ public:
       Advance();
    }
 
-   /// Initialize and seed the state of the generator as proposed by Sibidanov
-   void SetSeedSibidanov(uint64_t s)
+   /// Initialize and seed the state of the generator as proposed by Sibidanov.
+   /// The seeds are \f$2^{96}\f$ states apart, a non-zero stream adds \f$2^{160}\f$ states
+   /// per stream: all combinations of 64 bit seeds and streams give non-overlapping sequences.
+   void SetSeedSibidanov(uint64_t s, uint64_t stream = 0)
    {
       uint64_t lcg[9];
       lcg[0] = 1;
@@ -306,6 +342,17 @@ public:
       powermod(a_seed, a_seed, s);
       mulmod(a_seed, lcg);
 
+      if (stream != 0) {
+         uint64_t a_stream[9];
+         // Skip 2 ** 160 states, more than all 64 bit seeds, for each stream.
+         powermod(kA, a_stream, uint64_t(1) << 40);
+         for (int i = 0; i < 3; i++) {
+            powermod(a_stream, a_stream, uint64_t(1) << 40);
+         }
+         powermod(a_stream, a_stream, stream);
+         mulmod(a_stream, lcg);
+      }
+
       to_ranlux(lcg, fState, fCarry);
       fPosition = 0;
    }
@@ -419,6 +466,12 @@ double RanluxppEngine<p>::operator()()
    return fImpl->NextRandomFloat();
 }
 
+template <int p>
+void RanluxppEngine<p>::RndmArray(int n, double *array)
+{
+   fImpl->NextRandomFloats(n, array);
+}
+
 template <int p>
 uint64_t RanluxppEngine<p>::IntRndm()
 {
@@ -431,6 +484,12 @@ void RanluxppEngine<p>::SetSeed(uint64_t seed)
    fImpl->SetSeedSibidanov(seed);
 }
 
+template <int p>
+void RanluxppEngine<p>::SetSeedStream(uint64_t seed, uint64_t stream)
+{
+   fImpl->SetSeedSibidanov(seed, stream);
+}
+
 template <int p>
 void RanluxppEngine<p>::Skip(uint64_t n)
 {
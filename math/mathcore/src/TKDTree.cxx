@@ -14,7 +14,15 @@
 
 #include "TString.h"
 #include <string.h>
+#include <algorithm>
 #include <limits>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
 
 templateClassImp(TKDTree);
 
@@ -159,6 +167,14 @@ in the 2 subtrees as close as possible. The following section gives more details
     part of the index array. To find the number of point in the node
     (not only terminal), call TKDTree::GetNpointsNode(Index inode).
 
+#### 3c. Nearest neighbors
+
+    TKDTree::FindNearestNeighbors(const Value *point, Int_t k, Index *ind, Value *dist) finds the k nearest
+    neighbors of a point. The overload TKDTree::FindNearestNeighbors(Index npoints, const Value *points, Int_t k,
+    Index *ind, Value *dist) does so for many points at once (given row-wise), in parallel when implicit
+    multi-threading is enabled (ROOT::EnableImplicitMT()). The queries do not modify the tree, which is
+    also built in parallel in this case.
+
 ### 4.  TKDtree implementation details - internal information, not needed to use the kd-tree.
 
 ####  4a. Order of nodes in the node information arrays:
@@ -449,71 +465,69 @@ void TKDTree<Index, Value>::Build()
    //
    //
    //4.
+#ifdef R__USE_IMT
+   // with implicit multi-threading, split the first rows sequentially and build the subtrees below them in
+   // parallel: the subtrees have separate nodes and ranges of fIndPoints, so the tree does not depend on it
+   if (ROOT::IsImplicitMTEnabled() && fNPoints >= 100000) {
+      struct SubTree {
+         Int_t fNode, fRow, fPos, fNPoints;
+      };
+      std::vector<SubTree> subtrees{{0, 0, 0, fNPoints}};
+      const std::size_t nsubtrees = 8 * ROOT::GetThreadPoolSize();
+      while (subtrees.size() < nsubtrees) {
+         std::vector<SubTree> next;
+         for (const SubTree &tree : subtrees) {
+            if (tree.fNPoints <= fBucketSize)
+               continue; // terminal node
+            Int_t nleft = SplitNode(tree.fNode, tree.fRow, tree.fPos, tree.fNPoints);
+            next.push_back({GetLeft(tree.fNode), tree.fRow + 1, tree.fPos, nleft});
+            next.push_back({GetRight(tree.fNode), tree.fRow + 1, tree.fPos + nleft, tree.fNPoints - nleft});
+         }
+         subtrees.swap(next);
+         if (subtrees.empty())
+            return;
+      }
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([this](SubTree &tree) { BuildSubTree(tree.fNode, tree.fRow, tree.fPos, tree.fNPoints); },
+                   subtrees);
+      return;
+   }
+#endif
+   BuildSubTree(0, 0, 0, fNPoints);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Non recursive building of the subtree of node cnode, in row crow, made of the npoints
+/// points starting at cpos in fIndPoints
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::BuildSubTree(Int_t cnode, Int_t crow, Int_t cpos, Int_t npoints)
+{
    //    stack for non recursive build - size 128 bytes enough
    Int_t rowStack[128];
    Int_t nodeStack[128];
    Int_t npointStack[128];
    Int_t posStack[128];
    Int_t currentIndex = 0;
-   rowStack[0]    = 0;
-   nodeStack[0]   = 0;
-   npointStack[0] = fNPoints;
-   posStack[0]   = 0;
+   rowStack[0]    = crow;
+   nodeStack[0]   = cnode;
+   npointStack[0] = npoints;
+   posStack[0]   = cpos;
    //
    while (currentIndex>=0){
       //
-      Int_t npoints  = npointStack[currentIndex];
+      npoints  = npointStack[currentIndex];
       if (npoints<=fBucketSize) {
          currentIndex--;
          continue; // terminal node
       }
-      Int_t crow     = rowStack[currentIndex];
-      Int_t cpos     = posStack[currentIndex];
-      Int_t cnode    = nodeStack[currentIndex];
+      crow     = rowStack[currentIndex];
+      cpos     = posStack[currentIndex];
+      cnode    = nodeStack[currentIndex];
       //printf("currentIndex %d npoints %d node %d\n", currentIndex, npoints, cnode);
       //
-      // divide points
-      Int_t nbuckets0 = npoints/fBucketSize;           //current number of  buckets
-      if (npoints%fBucketSize) nbuckets0++;            //
-      Int_t restRows = fRowT0-rowStack[currentIndex];  // rest of fully occupied node row
-      if (restRows<0) restRows =0;
-      for (;nbuckets0>(2<<restRows); restRows++) {}
-      Int_t nfull = 1<<restRows;
-      Int_t nrest = nbuckets0-nfull;
-      Int_t nleft =0, nright =0;
-      //
-      if (nrest>(nfull/2)){
-         nleft  = nfull*fBucketSize;
-         nright = npoints-nleft;
-      }else{
-         nright = nfull*fBucketSize/2;
-         nleft  = npoints-nright;
-      }
-
-      //
-      //find the axis with biggest spread
-      Value maxspread=0;
-      Value tempspread, min, max;
-      Index axspread=0;
-      Value *array;
-      for (Int_t idim=0; idim<fNDim; idim++){
-         array = fData[idim];
-         Spread(npoints, array, fIndPoints+cpos, min, max);
-         tempspread = max - min;
-         if (maxspread < tempspread) {
-            maxspread=tempspread;
-            axspread = idim;
-         }
-         if(cnode) continue;
-         //printf("set %d %6.3f %6.3f\n", idim, min, max);
-         fRange[2*idim] = min; fRange[2*idim+1] = max;
-      }
-      array = fData[axspread];
-      KOrdStat(npoints, array, nleft, fIndPoints+cpos);
-      fAxis[cnode]  = axspread;
-      fValue[cnode] = array[fIndPoints[cpos+nleft]];
-      //printf("Set node %d : ax %d val %f\n", cnode, node->fAxis, node->fValue);
-      //
+      Int_t nleft = SplitNode(cnode, crow, cpos, npoints);
+      Int_t nright = npoints - nleft;
       //
       npointStack[currentIndex] = nleft;
       rowStack[currentIndex]    = crow+1;
@@ -534,6 +548,57 @@ void TKDTree<Index, Value>::Build()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Divide the npoints points of node cnode, in row crow, starting at cpos in fIndPoints:
+/// set the cutting axis and value of the node and return the number of points of the left daughter
+
+template <typename  Index, typename Value>
+Int_t TKDTree<Index, Value>::SplitNode(Int_t cnode, Int_t crow, Int_t cpos, Int_t npoints)
+{
+   // divide points
+   Int_t nbuckets0 = npoints/fBucketSize;           //current number of  buckets
+   if (npoints%fBucketSize) nbuckets0++;            //
+   Int_t restRows = fRowT0-crow;                    // rest of fully occupied node row
+   if (restRows<0) restRows =0;
+   for (;nbuckets0>(2<<restRows); restRows++) {}
+   Int_t nfull = 1<<restRows;
+   Int_t nrest = nbuckets0-nfull;
+   Int_t nleft =0, nright =0;
+   //
+   if (nrest>(nfull/2)){
+      nleft  = nfull*fBucketSize;
+      nright = npoints-nleft;
+   }else{
+      nright = nfull*fBucketSize/2;
+      nleft  = npoints-nright;
+   }
+
+   //
+   //find the axis with biggest spread
+   Value maxspread=0;
+   Value tempspread, min, max;
+   Index axspread=0;
+   Value *array;
+   for (Int_t idim=0; idim<fNDim; idim++){
+      array = fData[idim];
+      Spread(npoints, array, fIndPoints+cpos, min, max);
+      tempspread = max - min;
+      if (maxspread < tempspread) {
+         maxspread=tempspread;
+         axspread = idim;
+      }
+      if(cnode) continue;
+      //printf("set %d %6.3f %6.3f\n", idim, min, max);
+      fRange[2*idim] = min; fRange[2*idim+1] = max;
+   }
+   array = fData[axspread];
+   KOrdStat(npoints, array, nleft, fIndPoints+cpos);
+   fAxis[cnode]  = axspread;
+   fValue[cnode] = array[fIndPoints[cpos+nleft]];
+   //printf("Set node %d : ax %d val %f\n", cnode, node->fAxis, node->fValue);
+   return nleft;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Find kNN nearest neighbors to the point in the first argument
 ///Returns 1 on success, 0 on failure
@@ -552,15 +617,61 @@ void TKDTree<Index, Value>::FindNearestNeighbors(const Value *point, const Int_t
       ind[i]=-1;
    }
    MakeBoundariesExact();
-   UpdateNearestNeighbors(0, point, kNN, ind, dist);
+   std::vector<Double_t> work(fBucketSize);
+   UpdateNearestNeighbors(0, point, kNN, ind, dist, work.data());
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Find the kNN nearest neighbors of each of the npoints points in the second argument:
+///the coordinates of point i are points[i*ndim], ..., points[i*ndim+ndim-1].
+///The indexes and distances of the neighbors of point i are returned in ind[i*kNN], ..., ind[i*kNN+kNN-1]
+///and dist[i*kNN], ..., dist[i*kNN+kNN-1], as in FindNearestNeighbors(const Value*, Int_t, Index*, Value*).
+///Arrays ind and dist are provided by the user and are assumed to be at least npoints*kNN elements long.
+///With implicit multi-threading enabled, the points are processed in parallel.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::FindNearestNeighbors(Index npoints, const Value *points, Int_t kNN, Index *ind,
+                                                 Value *dist)
+{
+   if (!ind || !dist) {
+      Error("FindNearestNeighbors", "Working arrays must be allocated by the user!");
+      return;
+   }
+   // the tree is only read by the queries
+   MakeBoundariesExact();
+   const Index chunkSize = 256;
+   auto findChunk = [&](Index ichunk) {
+      std::vector<Double_t> work(fBucketSize);
+      const Index last = std::min(npoints, (ichunk + 1) * chunkSize);
+      for (Index ipoint = ichunk * chunkSize; ipoint < last; ipoint++) {
+         Index *indp = ind + ipoint * kNN;
+         Value *distp = dist + ipoint * kNN;
+         for (Int_t i=0; i<kNN; i++){
+            distp[i]=std::numeric_limits<Value>::max();
+            indp[i]=-1;
+         }
+         UpdateNearestNeighbors(0, points + ipoint * fNDim, kNN, indp, distp, work.data());
+      }
+   };
+   const Index nchunks = (npoints + chunkSize - 1) / chunkSize;
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nchunks > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(findChunk, ROOT::TSeq<Index>(nchunks));
+      return;
+   }
+#endif
+   for (Index ichunk = 0; ichunk < nchunks; ichunk++)
+      findChunk(ichunk);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Update the nearest neighbors values by examining the node inode
 
 template <typename Index, typename Value>
-void TKDTree<Index, Value>::UpdateNearestNeighbors(Index inode, const Value *point, Int_t kNN, Index *ind, Value *dist)
+void TKDTree<Index, Value>::UpdateNearestNeighbors(Index inode, const Value *point, Int_t kNN, Index *ind, Value *dist,
+                                                   Double_t *work)
 {
    Value min=0;
    Value max=0;
@@ -573,8 +684,22 @@ void TKDTree<Index, Value>::UpdateNearestNeighbors(Index inode, const Value *poi
       //examine points one by one
       Index f1, l1, f2, l2;
       GetNodePointsIndexes(inode, f1, l1, f2, l2);
+      // compute the distances to all the points of the bucket first (the loops over the points vectorize),
+      // as in Distance()
+      const Index *indPoints = fIndPoints + f1;
+      const Int_t nbucket = l1 - f1 + 1;
+      for (Int_t ipoint=0; ipoint<nbucket; ipoint++)
+         work[ipoint] = 0;
+      for (Int_t idim=0; idim<fNDim; idim++){
+         const Value *data = fData[idim];
+         const Value x = point[idim];
+         for (Int_t ipoint=0; ipoint<nbucket; ipoint++)
+            work[ipoint] += (x-data[indPoints[ipoint]])*(x-data[indPoints[ipoint]]);
+      }
+      for (Int_t ipoint=0; ipoint<nbucket; ipoint++)
+         work[ipoint] = TMath::Sqrt(work[ipoint]);
       for (Int_t ipoint=f1; ipoint<=l1; ipoint++){
-         Double_t d = Distance(point, fIndPoints[ipoint]);
+         Double_t d = work[ipoint-f1];
          if (d<dist[kNN-1]){
             //found a closer point
             Int_t ishift=0;
@@ -594,11 +719,11 @@ void TKDTree<Index, Value>::UpdateNearestNeighbors(Index inode, const Value *poi
    }
    if (point[fAxis[inode]]<fValue[inode]){
       //first examine the node that contains the point
-      UpdateNearestNeighbors(GetLeft(inode), point, kNN, ind, dist);
-      UpdateNearestNeighbors(GetRight(inode), point, kNN, ind, dist);
+      UpdateNearestNeighbors(GetLeft(inode), point, kNN, ind, dist, work);
+      UpdateNearestNeighbors(GetRight(inode), point, kNN, ind, dist, work);
    } else {
-      UpdateNearestNeighbors(GetRight(inode), point, kNN, ind, dist);
-      UpdateNearestNeighbors(GetLeft(inode), point, kNN, ind, dist);
+      UpdateNearestNeighbors(GetRight(inode), point, kNN, ind, dist, work);
+      UpdateNearestNeighbors(GetLeft(inode), point, kNN, ind, dist, work);
    }
 }
 
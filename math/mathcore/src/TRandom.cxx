@@ -96,6 +96,15 @@ The following methods are provided to generate random numbers disctributed accor
 - Poisson(Double_t mean)
 - Binomial(Int_t ntot, Double_t prob)
 
+RndmArray(), ExpArray(), GausArray() and PoissonArray() fill arrays of random numbers. They obtain the uniform numbers
+in bulk from RndmArray(), which the MIXMAX and RANLUX++ generators implement block-wise, and transform them with
+vectorized code when ROOT is built with VecCore and Vc. GausArray() and PoissonArray() use different algorithms than
+Gaus() and Poisson() (Box-Muller and the inversion of the cumulative distribution for mean < 25), so they do not
+return the same numbers as successive calls to Gaus() and Poisson().
+
+For parallel generation, e.g. with ROOT::TThreadExecutor, TRandomGen::SetSeedStream() gives each task its own stream of
+a MIXMAX or RANLUX++ generator, with the guarantee that the sequences of the streams do not overlap.
+
 Random numbers distributed according to 1-d, 2-d or 3-d distributions contained in TF1, TF2 or TF3 objects can also be
 generated. For example, to get a random number distributed following abs(sin(x)/x)*sqrt(x) you can do : \code{.cpp} TF1
 *f1 = new TF1("f1","abs(sin(x)/x)*sqrt(x)",0,10); double r = f1->GetRandom(); \endcode or you can use the UNURAN
@@ -176,10 +185,53 @@ A TRandom object may be written to a Root file
 #include "TSystem.h"
 #include "TDirectory.h"
 #include "Math/QuantFuncMathCore.h"
+#include "Math/Types.h"
 #include "TUUID.h"
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 ClassImp(TRandom);
 
+namespace {
+
+/// Number of uniform numbers obtained per RndmArray() call by the array methods
+constexpr Int_t kArrayChunk = 256;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Box-Muller transformation, in place, of the uniform numbers u1 and u2 into the normal numbers
+/// sqrt(-2 log(u1)) cos(2 pi u2) and sqrt(-2 log(u1)) sin(2 pi u2).
+
+void BoxMuller(Int_t n, Double_t *u1, Double_t *u2)
+{
+   // some engines can return 0
+   const Double_t kMin = std::numeric_limits<Double_t>::min();
+   Int_t i = 0;
+#if defined(R__HAS_VECCORE) && defined(R__HAS_VC)
+   using ROOT::Double_v;
+   const Int_t vecSize = vecCore::VectorSize<Double_v>();
+   for (; i + vecSize <= n; i += vecSize) {
+      Double_v x1, x2;
+      vecCore::Load<Double_v>(x1, &u1[i]);
+      vecCore::Load<Double_v>(x2, &u2[i]);
+      x1 = vecCore::Blend<Double_v>(x1 > Double_v(0.), x1, Double_v(kMin));
+      Double_v r = vecCore::math::Sqrt(Double_v(-2.) * vecCore::math::Log(x1));
+      Double_v phi = Double_v(TMath::TwoPi()) * x2;
+      vecCore::Store<Double_v>(r * vecCore::math::Cos(phi), &u1[i]);
+      vecCore::Store<Double_v>(r * vecCore::math::Sin(phi), &u2[i]);
+   }
+#endif
+   for (; i < n; ++i) {
+      Double_t r = TMath::Sqrt(-2. * TMath::Log(u1[i] > 0 ? u1[i] : kMin));
+      Double_t phi = TMath::TwoPi() * u2[i];
+      u1[i] = r * TMath::Cos(phi);
+      u2[i] = r * TMath::Sin(phi);
+   }
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor. For seed see SetSeed().
 
@@ -255,6 +307,27 @@ Double_t TRandom::Exp(Double_t tau)
    return t;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fills an array with n exponential deviates, as successive calls to Exp(tau).
+/// The uniform numbers are obtained with RndmArray().
+
+void TRandom::ExpArray(Int_t n, Double_t *array, Double_t tau)
+{
+   RndmArray(n, array);
+   Int_t i = 0;
+#if defined(R__HAS_VECCORE) && defined(R__HAS_VC)
+   using ROOT::Double_v;
+   const Int_t vecSize = vecCore::VectorSize<Double_v>();
+   for (; i + vecSize <= n; i += vecSize) {
+      Double_v x;
+      vecCore::Load<Double_v>(x, &array[i]);
+      vecCore::Store<Double_v>(Double_v(-tau) * vecCore::math::Log(x), &array[i]);
+   }
+#endif
+   for (; i < n; ++i)
+      array[i] = -tau * TMath::Log(array[i]);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Samples a random number from the standard Normal (Gaussian) Distribution
 /// with the given mean and sigma.
@@ -353,6 +426,25 @@ Double_t TRandom::Gaus(Double_t mean, Double_t sigma)
    return mean + sigma * result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fills an array with n numbers from the Normal (Gaussian) distribution with the given mean and sigma.
+/// The numbers are obtained in pairs with the Box-Muller transformation of uniform numbers from
+/// RndmArray(), which is vectorized when ROOT is built with VecCore and Vc. The numbers thus
+/// differ from those of successive Gaus() calls.
+
+void TRandom::GausArray(Int_t n, Double_t *array, Double_t mean, Double_t sigma)
+{
+   Double_t u[2 * kArrayChunk];
+   for (Int_t i = 0; i < n; i += 2 * kArrayChunk) {
+      const Int_t m = std::min(n - i, 2 * kArrayChunk);
+      const Int_t npairs = (m + 1) / 2;
+      RndmArray(2 * npairs, u);
+      BoxMuller(npairs, u, u + npairs);
+      for (Int_t j = 0; j < m; ++j)
+         array[i + j] = mean + sigma * u[j];
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns a random integer uniformly distributed on the interval [ 0, imax-1 ].
 /// Note that the interval contains the values of 0 and imax-1 but not imax.
@@ -444,6 +536,42 @@ Int_t TRandom::Poisson(Double_t mean)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fills an array with n random integers according to a Poisson law.
+/// For mean < 25, each number is obtained from one uniform number of RndmArray(), by a binary search in the
+/// cumulative distribution, which is computed once for all numbers; the numbers thus differ from those of
+/// successive Poisson() calls. For larger means, the numbers are obtained with Poisson().
+
+void TRandom::PoissonArray(Int_t n, Int_t *array, Double_t mean)
+{
+   if (mean <= 0) {
+      std::fill(array, array + n, 0);
+      return;
+   }
+   if (mean >= 25) {
+      for (Int_t i = 0; i < n; ++i)
+         array[i] = Poisson(mean);
+      return;
+   }
+   // cumulative distribution, up to where the terms are negligible in double precision
+   std::vector<Double_t> cdf;
+   Double_t p = TMath::Exp(-mean);
+   Double_t sum = p;
+   cdf.push_back(sum);
+   for (Int_t k = 1; p > std::numeric_limits<Double_t>::epsilon() * sum; ++k) {
+      p *= mean / k;
+      sum += p;
+      cdf.push_back(sum);
+   }
+   Double_t u[kArrayChunk];
+   for (Int_t i = 0; i < n; i += kArrayChunk) {
+      const Int_t m = std::min(n - i, kArrayChunk);
+      RndmArray(m, u);
+      for (Int_t j = 0; j < m; ++j)
+         array[i + j] = std::lower_bound(cdf.begin(), cdf.end(), u[j]) - cdf.begin();
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Generates a random number according to a Poisson law.
 /// Prob(N) = exp(-mean)*mean^N/Factorial(N)
@@ -47,6 +47,43 @@ TEST(RanluxppEngine, random2048)
    EXPECT_EQ(rng.Rndm(), 0.74670661284082484599);
 }
 
+TEST(RanluxppEngine, RndmArray)
+{
+   RanluxppEngine2048 rng(314159265);
+   RanluxppEngine2048 ref(314159265);
+
+   // Start in the middle of a block, and cover several blocks.
+   rng.Skip(5);
+   ref.Skip(5);
+   double array[100];
+   rng.RndmArray(100, array);
+   for (int i = 0; i < 100; i++) {
+      EXPECT_EQ(array[i], ref.Rndm());
+   }
+   EXPECT_EQ(rng.IntRndm(), ref.IntRndm());
+}
+
+TEST(RanluxppEngine, SetSeedStream)
+{
+   RanluxppEngine2048 rng;
+   RanluxppEngine2048 ref(42);
+
+   // Stream 0 is the sequence of the seed.
+   rng.SetSeedStream(42, 0);
+   EXPECT_EQ(rng.IntRndm(), ref.IntRndm());
+
+   // Other streams start somewhere else.
+   ref.SetSeedStream(42, 0);
+   uint64_t first = ref.IntRndm();
+   rng.SetSeedStream(42, 1);
+   uint64_t stream1 = rng.IntRndm();
+   EXPECT_NE(stream1, first);
+   rng.SetSeedStream(43, 1);
+   EXPECT_NE(rng.IntRndm(), stream1);
+   rng.SetSeedStream(42, 1);
+   EXPECT_EQ(rng.IntRndm(), stream1);
+}
+
 TEST(RanluxppCompatEngineJames, P3)
 {
    RanluxppCompatEngineJamesP3 rng(314159265);
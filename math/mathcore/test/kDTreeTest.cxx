@@ -18,6 +18,7 @@
 #include "TApplication.h"
 #include "TVirtualPad.h"
 #include <iostream>
+#include <vector>
 
 
 bool showGraphics = false;
@@ -26,6 +27,7 @@ bool showGraphics = false;
 void TestBuild(const Int_t npoints = 1000000, const Int_t bsize = 100);
 void TestConstr(const Int_t npoints = 1000000, const Int_t bsize = 100);
 void TestSpeed(Int_t npower2 = 20, Int_t bsize = 10);
+void TestNeighborsBatch();
 
 //void TestkdtreeIF(Int_t npoints=1000, Int_t bsize=9, Int_t nloop=1000, Int_t mode = 2);
 //void TestSizeIF(Int_t nsec=36, Int_t nrows=159, Int_t npoints=1000,  Int_t bsize=10, Int_t mode=1);
@@ -51,6 +53,8 @@ void kDTreeTest()
   TestBuild();
   printf("\n\tTesting kDTree speed ...\n");
   TestSpeed();
+  printf("\n\tTesting kDTree batch nearest neighbors ...\n");
+  TestNeighborsBatch();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -552,6 +556,47 @@ void TestRange()
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+///Test the batch TKDTree::FindNearestNeighbors() against the single point one
+
+void TestNeighborsBatch()
+{
+   Int_t npoints = 100000;
+   Int_t nquery = 10000;
+   Int_t nn = 10;
+   Int_t bsize = 10;
+
+   std::vector<Double_t> x(npoints), y(npoints), query(2 * nquery);
+   for (Int_t i=0; i<npoints; i++){
+      x[i] = gRandom->Uniform(-100, 100);
+      y[i] = gRandom->Uniform(-100, 100);
+   }
+   for (Int_t i=0; i<2*nquery; i++)
+      query[i] = gRandom->Uniform(-100, 100);
+
+   TKDTreeID kdtree(npoints, 2, bsize);
+   kdtree.SetData(0, x.data());
+   kdtree.SetData(1, y.data());
+   kdtree.Build();
+
+   std::vector<Int_t> index(nquery * nn), index2(nn);
+   std::vector<Double_t> dist(nquery * nn), dist2(nn);
+   TStopwatch timer;
+   kdtree.FindNearestNeighbors(nquery, query.data(), nn, index.data(), dist.data());
+   timer.Stop();
+
+   Int_t diff = 0;
+   for (Int_t i=0; i<nquery; i++){
+      kdtree.FindNearestNeighbors(&query[2*i], nn, index2.data(), dist2.data());
+      for (Int_t inn=0; inn<nn; inn++){
+         if (index[i*nn+inn] != index2[inn] || dist[i*nn+inn] != dist2[inn])
+            diff++;
+      }
+   }
+   printf("Nearest neighbors of %d points found in %f s\n", nquery, timer.RealTime());
+   printf("%d neighbors differ from the single point search\n", diff);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 int main(int argc, char **argv) {
@@ -0,0 +1,48 @@
+// test that the evaluation mode of AdaptiveIntegratorMultiDim does not change its result
+
+#include "Math/AdaptiveIntegratorMultiDim.h"
+#include "Math/Functor.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+namespace {
+
+double Gaus4(const double *x)
+{
+   double r = 0;
+   for (int i = 0; i < 4; ++i)
+      r += (x[i] - 0.3) * (x[i] - 0.3) / (0.04 * (i + 1));
+   return std::exp(-r);
+}
+
+} // anonymous namespace
+
+TEST(AdaptiveIntegratorMultiDim, Integral)
+{
+   ROOT::Math::Functor f(&Gaus4, 4);
+   double a[4] = {0., 0., 0., 0.};
+   double b[4] = {1., 1., 1., 1.};
+   ROOT::Math::AdaptiveIntegratorMultiDim ig(0., 1e-6, 1000000);
+   // the dimension is taken from the function
+   double result = ig.Integral(f, a, b);
+   EXPECT_EQ(0, ig.Status());
+   EXPECT_NEAR(0.0534579204, result, 1e-7);
+   EXPECT_GT(1e-7, ig.Error());
+}
+
+TEST(AdaptiveIntegratorMultiDim, ExecutionPolicy)
+{
+   ROOT::Math::Functor f(&Gaus4, 4);
+   double a[4] = {0., 0., 0., 0.};
+   double b[4] = {1., 1., 1., 1.};
+   ROOT::Math::AdaptiveIntegratorMultiDim seq(1e-9, 1e-7, 200000);
+   ROOT::Math::AdaptiveIntegratorMultiDim mt(1e-9, 1e-7, 200000);
+   mt.SetExecutionPolicy(ROOT::EExecutionPolicy::kMultiThread);
+   EXPECT_EQ(ROOT::EExecutionPolicy::kMultiThread, mt.ExecutionPolicy());
+   EXPECT_EQ(seq.Integral(f, a, b), mt.Integral(f, a, b));
+   EXPECT_EQ(seq.Error(), mt.Error());
+   EXPECT_EQ(seq.NEval(), mt.NEval());
+   EXPECT_EQ(seq.Status(), mt.Status());
+}
@@ -0,0 +1,122 @@
+// test the array methods of TRandom and the streams of TRandomGen
+
+#include "TRandom3.h"
+#include "TRandomGen.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+// RndmArray must return the numbers of successive Rndm() calls, also when starting in the middle of a state
+template <class Generator>
+void CheckRndmArray()
+{
+   Generator rng(7);
+   Generator ref(7);
+   for (int i = 0; i < 5; ++i) {
+      rng.Rndm();
+      ref.Rndm();
+   }
+   for (int n : {1, 16, 239, 1000}) {
+      std::vector<Double_t> array(n);
+      rng.RndmArray(n, array.data());
+      for (int i = 0; i < n; ++i)
+         ASSERT_EQ(ref.Rndm(), array[i]) << "at " << i << " of " << n;
+   }
+   std::vector<Float_t> farray(300);
+   rng.RndmArray(300, farray.data());
+   for (int i = 0; i < 300; ++i)
+      ASSERT_EQ(Float_t(ref.Rndm()), farray[i]);
+   EXPECT_EQ(ref.Rndm(), rng.Rndm());
+}
+
+template <class Generator>
+void CheckSeedStream()
+{
+   Generator rng;
+   Generator ref(42);
+   rng.SetSeedStream(42, 0);
+   EXPECT_EQ(ref.Rndm(), rng.Rndm());
+
+   ref.SetSeedStream(42, 3);
+   rng.SetSeedStream(42, 4);
+   EXPECT_NE(ref.Rndm(), rng.Rndm());
+   rng.SetSeedStream(42, 3);
+   ref.SetSeedStream(42, 3);
+   EXPECT_EQ(ref.Rndm(), rng.Rndm());
+}
+
+void MeanAndVariance(const std::vector<Double_t> &x, Double_t &mean, Double_t &variance)
+{
+   Double_t sum = 0;
+   Double_t sum2 = 0;
+   for (auto v : x) {
+      sum += v;
+      sum2 += v * v;
+   }
+   mean = sum / x.size();
+   variance = sum2 / x.size() - mean * mean;
+}
+
+} // anonymous namespace
+
+TEST(TRandomGen, RndmArray)
+{
+   CheckRndmArray<TRandomMixMax>();
+   CheckRndmArray<TRandomMixMax17>();
+   CheckRndmArray<TRandomMixMax256>();
+   CheckRndmArray<TRandomRanluxpp>();
+   CheckRndmArray<TRandomMT64>();
+}
+
+TEST(TRandomGen, SetSeedStream)
+{
+   CheckSeedStream<TRandomMixMax>();
+   CheckSeedStream<TRandomMixMax17>();
+   CheckSeedStream<TRandomRanluxpp>();
+}
+
+TEST(TRandom, ExpArray)
+{
+   TRandomMixMax rng(1);
+   TRandomMixMax ref(1);
+   std::vector<Double_t> x(1001);
+   rng.ExpArray(x.size(), x.data(), 2.5);
+   for (auto v : x)
+      EXPECT_NEAR(ref.Exp(2.5), v, 1e-14 * v);
+}
+
+TEST(TRandom, GausArray)
+{
+   TRandomRanluxpp rng(1);
+   const int n = 200001;
+   std::vector<Double_t> x(n);
+   rng.GausArray(n, x.data(), 1., 2.);
+   Double_t mean, variance;
+   MeanAndVariance(x, mean, variance);
+   // about 5 standard deviations
+   EXPECT_NEAR(1., mean, 5 * 2. / std::sqrt(n));
+   EXPECT_NEAR(4., variance, 5 * 4. * std::sqrt(2. / n));
+   Int_t within = 0;
+   for (auto v : x)
+      within += std::abs(v - 1.) < 2.;
+   EXPECT_NEAR(0.682689, Double_t(within) / n, 5 * 0.466 / std::sqrt(n));
+}
+
+TEST(TRandom, PoissonArray)
+{
+   TRandom3 rng(1);
+   const int n = 200000;
+   for (Double_t mu : {0., 0.1, 3., 24.9, 40.}) {
+      std::vector<Int_t> k(n);
+      rng.PoissonArray(n, k.data(), mu);
+      std::vector<Double_t> x(k.begin(), k.end());
+      Double_t mean, variance;
+      MeanAndVariance(x, mean, variance);
+      EXPECT_NEAR(mu, mean, 5 * std::sqrt(mu / n) + 1e-12) << "mean " << mu;
+      EXPECT_NEAR(mu, variance, 5 * mu * std::sqrt(2. / n) + 5 * std::sqrt(mu / n) + 1e-12) << "mean " << mu;
+   }
+}
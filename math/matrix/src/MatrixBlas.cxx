@@ -0,0 +1,148 @@
+// @(#)root/matrix
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "MatrixBlas.h"
+
+#ifdef R__HAS_MATRIX_BLAS
+
+#include "TEnv.h"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+extern "C" {
+void dgemm_(const char *transa, const char *transb, const int *m, const int *n, const int *k, const double *alpha,
+            const double *a, const int *lda, const double *b, const int *ldb, const double *beta, double *c,
+            const int *ldc);
+void sgemm_(const char *transa, const char *transb, const int *m, const int *n, const int *k, const float *alpha,
+            const float *a, const int *lda, const float *b, const int *ldb, const float *beta, float *c,
+            const int *ldc);
+void dgetrf_(const int *m, const int *n, double *a, const int *lda, int *ipiv, int *info);
+void dpotrf_(const char *uplo, const int *n, double *a, const int *lda, int *info);
+}
+
+namespace {
+
+std::atomic<bool> &UseBlasFlag()
+{
+   static std::atomic<bool> flag{!gEnv || gEnv->GetValue("Matrix.UseBlas", 1) != 0};
+   return flag;
+}
+
+bool UseBlas(Double_t nOperations)
+{
+   return nOperations >= ROOT::Internal::Matrix::kBlasMinOperations && UseBlasFlag();
+}
+
+template <typename Element, typename Gemm_t>
+bool GemmImpl(Gemm_t gemm, bool transA, bool transB, Int_t m, Int_t n, Int_t k, const Element *a, const Element *b,
+              Element *c)
+{
+   if (m <= 0 || n <= 0 || k <= 0 || !UseBlas(Double_t(m) * n * k))
+      return false;
+   // BLAS stores matrices by columns: the row-major c = op(a) * op(b) is the column-major c^T = op(b)^T * op(a)^T
+   const char ta = transA ? 'T' : 'N';
+   const char tb = transB ? 'T' : 'N';
+   const int lda = transA ? m : k;
+   const int ldb = transB ? k : n;
+   const Element alpha = 1;
+   const Element beta = 0;
+   gemm(&tb, &ta, &n, &m, &k, &alpha, b, &ldb, a, &lda, &beta, c, &n);
+   return true;
+}
+
+void TransposeInPlace(Int_t n, Double_t *a)
+{
+   for (Int_t i = 0; i < n; ++i) {
+      for (Int_t j = i + 1; j < n; ++j)
+         std::swap(a[i * n + j], a[j * n + i]);
+   }
+}
+
+} // anonymous namespace
+
+void ROOT::Internal::Matrix::SetUseBlas(bool on)
+{
+   UseBlasFlag() = on;
+}
+
+bool ROOT::Internal::Matrix::IsUseBlas()
+{
+   return UseBlasFlag();
+}
+
+bool ROOT::Internal::Matrix::BlasGemm(bool transA, bool transB, Int_t m, Int_t n, Int_t k, const Double_t *a,
+                                      const Double_t *b, Double_t *c)
+{
+   return GemmImpl(dgemm_, transA, transB, m, n, k, a, b, c);
+}
+
+bool ROOT::Internal::Matrix::BlasGemm(bool transA, bool transB, Int_t m, Int_t n, Int_t k, const Float_t *a,
+                                      const Float_t *b, Float_t *c)
+{
+   return GemmImpl(sgemm_, transA, transB, m, n, k, a, b, c);
+}
+
+bool ROOT::Internal::Matrix::LapackGetrf(Int_t n, Double_t *a, Int_t *index, Int_t &info)
+{
+   if (n <= 0 || !UseBlas(Double_t(n) * n * n / 3))
+      return false;
+   // LAPACK factorizes column-major matrices: transpose before and after to keep the row interchanges
+   TransposeInPlace(n, a);
+   dgetrf_(&n, &n, a, &n, index, &info);
+   TransposeInPlace(n, a);
+   for (Int_t i = 0; i < n; ++i)
+      index[i] -= 1;
+   return true;
+}
+
+bool ROOT::Internal::Matrix::LapackPotrf(Int_t n, Double_t *a, Int_t &info)
+{
+   if (n <= 0 || !UseBlas(Double_t(n) * n * n / 6))
+      return false;
+   // The row-major upper triangle is the column-major lower triangle: a = L * L^T with L = U^T
+   const char uplo = 'L';
+   dpotrf_(&uplo, &n, a, &n, &info);
+   for (Int_t i = 0; i < n; ++i)
+      std::fill(a + i * n, a + i * n + i, 0.);
+   return true;
+}
+
+#else
+
+void ROOT::Internal::Matrix::SetUseBlas(bool) {}
+
+bool ROOT::Internal::Matrix::IsUseBlas()
+{
+   return false;
+}
+
+bool ROOT::Internal::Matrix::BlasGemm(bool, bool, Int_t, Int_t, Int_t, const Double_t *, const Double_t *, Double_t *)
+{
+   return false;
+}
+
+bool ROOT::Internal::Matrix::BlasGemm(bool, bool, Int_t, Int_t, Int_t, const Float_t *, const Float_t *, Float_t *)
+{
+   return false;
+}
+
+bool ROOT::Internal::Matrix::LapackGetrf(Int_t, Double_t *, Int_t *, Int_t &)
+{
+   return false;
+}
+
+bool ROOT::Internal::Matrix::LapackPotrf(Int_t, Double_t *, Int_t &)
+{
+   return false;
+}
+
+#endif
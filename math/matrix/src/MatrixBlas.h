@@ -0,0 +1,61 @@
+// @(#)root/matrix
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_MatrixBlas
+#define ROOT_MatrixBlas
+
+// Internal interface of the Matrix library to BLAS and LAPACK, not installed.
+//
+// ROOT built with -Dmatrix-blas=ON hands the multiplications and decompositions of large dense matrices to the BLAS
+// and LAPACK libraries found at configuration time, which are usually optimized and multi-threaded (OpenBLAS, MKL,
+// Accelerate). Each function returns false if the caller has to do the work with the built-in algorithms: if ROOT is
+// built without BLAS, if the use of BLAS is disabled (`Matrix.UseBlas` rootrc variable set to 0, or SetUseBlas()) or
+// if the matrices are too small to benefit.
+//
+// The size threshold is kBlasMinOperations multiply-adds: m * n * k for a product, n^3 / 3 for an LU and n^3 / 6 for
+// a Cholesky decomposition of an n x n matrix. Below it the built-in loops are as fast as a call to the libraries.
+// Above it the results agree with the built-in algorithms up to rounding, because the libraries sum in a different
+// order; singular and non-positive-definite matrices are reported in the same way.
+
+#include "RtypesCore.h"
+
+namespace ROOT {
+namespace Internal {
+namespace Matrix {
+
+/// Number of multiply-adds from which BLAS and LAPACK are used, see above
+constexpr Double_t kBlasMinOperations = 32. * 32. * 32.;
+
+/// Enable or disable the use of BLAS and LAPACK, by default given by the `Matrix.UseBlas` rootrc variable. This has
+/// no effect if ROOT is built without BLAS.
+void SetUseBlas(bool on);
+bool IsUseBlas();
+
+/// Compute the row-major m x n matrix c = op(a) * op(b), where op(a) is m x k and op(b) is k x n, and op transposes
+/// its argument if the corresponding trans flag is set
+bool BlasGemm(bool transA, bool transB, Int_t m, Int_t n, Int_t k, const Double_t *a, const Double_t *b, Double_t *c);
+bool BlasGemm(bool transA, bool transB, Int_t m, Int_t n, Int_t k, const Float_t *a, const Float_t *b, Float_t *c);
+
+/// LU decomposition with partial pivoting of the row-major n x n matrix a in place, in the layout of
+/// TDecompLU::DecomposeLUGauss: U in the upper triangle, the multipliers of L below the diagonal and the row
+/// interchanged with row j at step j in index[j]. `info` is set to the LAPACK result: 0 on success and i > 0 if the
+/// i-th pivot (starting from 1) is exactly zero.
+bool LapackGetrf(Int_t n, Double_t *a, Int_t *index, Int_t &info);
+
+/// Cholesky decomposition a = U^T * U of the symmetric positive definite n x n matrix a in place, leaving U in the
+/// upper triangle and zeros below. `info` is set to the LAPACK result: 0 on success and i > 0 if the leading minor
+/// of order i is not positive definite.
+bool LapackPotrf(Int_t n, Double_t *a, Int_t &info);
+
+} // namespace Matrix
+} // namespace Internal
+} // namespace ROOT
+
+#endif
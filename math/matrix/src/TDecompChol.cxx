@@ -26,6 +26,7 @@
 
 #include "TDecompChol.h"
 #include "TMath.h"
+#include "MatrixBlas.h"
 
 ClassImp(TDecompChol);
 
@@ -115,6 +116,17 @@ Bool_t TDecompChol::Decompose()
    Int_t i,j,icol,irow;
    const Int_t     n  = fU.GetNrows();
          Double_t *pU = fU.GetMatrixArray();
+
+   Int_t info = 0;
+   if (ROOT::Internal::Matrix::LapackPotrf(n, pU, info)) {
+      if (info != 0) {
+         Error("Decompose()","matrix not positive definite");
+         return kFALSE;
+      }
+      SetBit(kDecomposed);
+      return kTRUE;
+   }
+
    for (icol = 0; icol < n; icol++) {
       const Int_t rowOff = icol*n;
 
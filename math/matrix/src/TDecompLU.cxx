@@ -11,6 +11,7 @@
 
 #include "TDecompLU.h"
 #include "TMath.h"
+#include "MatrixBlas.h"
 
 ClassImp(TDecompLU);
 
@@ -714,6 +715,22 @@ Bool_t TDecompLU::DecomposeLUGauss(TMatrixD &lu,Int_t *index,Double_t &sign,
    sign    = 1.0;
    nrZeros = 0;
 
+   Int_t info = 0;
+   if (ROOT::Internal::Matrix::LapackGetrf(n, pLU, index, info)) {
+      // like below, a zero last pivot is left to the tolerance checks of the users of the decomposition
+      if (info > 0 && info < n) {
+         ::Error("TDecompLU::DecomposeLUGauss","matrix is singular");
+         return kFALSE;
+      }
+      for (Int_t j = 0; j < n-1; j++) {
+         if (index[j] != j)
+            sign = -sign;
+         if (TMath::Abs(pLU[j*n+j]) < tol)
+            nrZeros++;
+      }
+      return kTRUE;
+   }
+
    index[n-1] = n-1;
    for (Int_t j = 0; j < n-1; j++) {
       const Int_t off_j = j*n;
@@ -31,6 +31,7 @@ object persistent only the upper right triangle is stored .
 #include "TDecompLU.h"
 #include "TMatrixDSymEigen.h"
 #include "TMath.h"
+#include "MatrixBlas.h"
 
 templateClassImp(TMatrixTSym);
 
@@ -382,18 +383,10 @@ void TMatrixTSym<Element>::TMult(const TMatrixT<Element> &a)
 {
    R__ASSERT(a.IsValid());
 
-#ifdef CBLAS
-   const Element *ap = a.GetMatrixArray();
-         Element *cp = this->GetMatrixArray();
-   if (typeid(Element) == typeid(Double_t))
-      cblas_dgemm (CblasRowMajor,CblasTrans,CblasNoTrans,this->fNrows,this->fNcols,a.GetNrows(),
-                   1.0,ap,a.GetNcols(),ap,a.GetNcols(),1.0,cp,this->fNcols);
-   else if (typeid(Element) != typeid(Float_t))
-      cblas_sgemm (CblasRowMajor,CblasTrans,CblasNoTrans,fNrows,fNcols,a.GetNrows(),
-                   1.0,ap,a.GetNcols(),ap,a.GetNcols(),1.0,cp,fNcols);
-  else
-      Error("TMult","type %s not implemented in BLAS library",typeid(Element));
-#else
+   if (ROOT::Internal::Matrix::BlasGemm(true, false, this->fNrows, this->fNcols, a.GetNrows(),
+                                        a.GetMatrixArray(), a.GetMatrixArray(), this->GetMatrixArray()))
+      return;
+
    const Int_t nb     = a.GetNoElements();
    const Int_t ncolsa = a.GetNcols();
    const Int_t ncolsb = ncolsa;
@@ -418,7 +411,6 @@ void TMatrixTSym<Element>::TMult(const TMatrixT<Element> &a)
    }
 
    R__ASSERT(cp == this->GetMatrixArray()+this->fNelems && acp0 == ap+ncolsa);
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -430,18 +422,10 @@ void TMatrixTSym<Element>::TMult(const TMatrixTSym<Element> &a)
 {
    R__ASSERT(a.IsValid());
 
-#ifdef CBLAS
-   const Element *ap = a.GetMatrixArray();
-         Element *cp = this->GetMatrixArray();
-   if (typeid(Element) == typeid(Double_t))
-      cblas_dsymm (CblasRowMajor,CblasLeft,CblasUpper,this->fNrows,this->fNcols,1.0,
-                   ap,a.GetNcols(),ap,a.GetNcols(),0.0,cp,this->fNcols);
-   else if (typeid(Element) != typeid(Float_t))
-      cblas_ssymm (CblasRowMajor,CblasLeft,CblasUpper,fNrows,fNcols,1.0,
-                   ap1,a.GetNcols(),ap,a.GetNcols(),0.0,cp,fNcols);
-   else
-      Error("TMult","type %s not implemented in BLAS library",typeid(Element));
-#else
+   if (ROOT::Internal::Matrix::BlasGemm(false, false, this->fNrows, this->fNcols, a.GetNcols(),
+                                        a.GetMatrixArray(), a.GetMatrixArray(), this->GetMatrixArray()))
+      return;
+
    const Int_t nb     = a.GetNoElements();
    const Int_t ncolsa = a.GetNcols();
    const Int_t ncolsb = ncolsa;
@@ -466,7 +450,6 @@ void TMatrixTSym<Element>::TMult(const TMatrixTSym<Element> &a)
    }
 
    R__ASSERT(cp == this->GetMatrixArray()+this->fNelems && acp0 == ap+ncolsa);
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,182 @@
+#include "MatrixBlas.h"
+
+#include "TDecompChol.h"
+#include "TDecompLU.h"
+#include "TMatrixD.h"
+#include "TMatrixDSym.h"
+#include "TMatrixF.h"
+#include "TMath.h"
+#include "TRandom3.h"
+#include "TVectorD.h"
+
+#include "ROOT/TestSupport.hxx"
+#include "gtest/gtest.h"
+
+// The matrices are above the size from which BLAS and LAPACK are used, if ROOT is built with them; the results with
+// and without must agree up to rounding.
+
+namespace {
+
+constexpr Int_t kN = 80;
+static_assert(Double_t(kN) * kN * kN / 6 > ROOT::Internal::Matrix::kBlasMinOperations,
+              "the matrices of the test must be large enough to use BLAS");
+
+/// Run f with the use of BLAS set to on, restoring the previous setting
+template <typename F>
+auto WithBlas(bool on, F &&f) -> decltype(f())
+{
+   const bool previous = ROOT::Internal::Matrix::IsUseBlas();
+   ROOT::Internal::Matrix::SetUseBlas(on);
+   auto result = f();
+   ROOT::Internal::Matrix::SetUseBlas(previous);
+   return result;
+}
+
+template <typename Matrix_t>
+Matrix_t RandomMatrix(Int_t nrows, Int_t ncols, UInt_t seed)
+{
+   TRandom3 rng(seed);
+   Matrix_t m(nrows, ncols);
+   for (Int_t i = 0; i < nrows; ++i)
+      for (Int_t j = 0; j < ncols; ++j)
+         m(i, j) = rng.Uniform(-1, 1);
+   return m;
+}
+
+template <typename Matrix_t>
+Double_t RelativeDifference(const Matrix_t &a, const Matrix_t &b)
+{
+   Matrix_t diff(a);
+   diff -= b;
+   return TMath::Sqrt(diff.E2Norm() / b.E2Norm());
+}
+
+Double_t RelativeDifference(const TVectorD &a, const TVectorD &b)
+{
+   TVectorD diff(a);
+   diff -= b;
+   return TMath::Sqrt(diff.Norm2Sqr() / b.Norm2Sqr());
+}
+
+TMatrixDSym PositiveDefiniteMatrix(Int_t n)
+{
+   const auto a = RandomMatrix<TMatrixD>(n, n, 7);
+   TMatrixDSym spd(TMatrixDSym::kAtA, a);
+   for (Int_t i = 0; i < n; ++i)
+      spd(i, i) += n;
+   return spd;
+}
+
+} // namespace
+
+TEST(MatrixBlas, Mult)
+{
+   const auto a = RandomMatrix<TMatrixD>(kN, kN + 3, 1);
+   const auto b = RandomMatrix<TMatrixD>(kN + 3, kN - 5, 2);
+   const auto blas = WithBlas(true, [&] { return TMatrixD(a, TMatrixD::kMult, b); });
+   const auto ref = WithBlas(false, [&] { return TMatrixD(a, TMatrixD::kMult, b); });
+   EXPECT_LT(RelativeDifference(blas, ref), 1e-14);
+}
+
+TEST(MatrixBlas, TMult)
+{
+   const auto a = RandomMatrix<TMatrixD>(kN + 3, kN, 1);
+   const auto b = RandomMatrix<TMatrixD>(kN + 3, kN - 5, 2);
+   const auto blas = WithBlas(true, [&] { return TMatrixD(a, TMatrixD::kTransposeMult, b); });
+   const auto ref = WithBlas(false, [&] { return TMatrixD(a, TMatrixD::kTransposeMult, b); });
+   EXPECT_LT(RelativeDifference(blas, ref), 1e-14);
+}
+
+TEST(MatrixBlas, MultT)
+{
+   const auto a = RandomMatrix<TMatrixD>(kN, kN + 3, 1);
+   const auto b = RandomMatrix<TMatrixD>(kN - 5, kN + 3, 2);
+   const auto blas = WithBlas(true, [&] { return TMatrixD(a, TMatrixD::kMultTranspose, b); });
+   const auto ref = WithBlas(false, [&] { return TMatrixD(a, TMatrixD::kMultTranspose, b); });
+   EXPECT_LT(RelativeDifference(blas, ref), 1e-14);
+}
+
+TEST(MatrixBlas, MultFloat)
+{
+   const auto a = RandomMatrix<TMatrixF>(kN, kN, 1);
+   const auto b = RandomMatrix<TMatrixF>(kN, kN, 2);
+   const auto blas = WithBlas(true, [&] { return TMatrixF(a, TMatrixF::kMult, b); });
+   const auto ref = WithBlas(false, [&] { return TMatrixF(a, TMatrixF::kMult, b); });
+   EXPECT_LT(RelativeDifference(blas, ref), 1e-5);
+}
+
+TEST(MatrixBlas, SymAtA)
+{
+   const auto a = RandomMatrix<TMatrixD>(kN + 3, kN, 1);
+   const auto blas = WithBlas(true, [&] { return TMatrixDSym(TMatrixDSym::kAtA, a); });
+   const auto ref = WithBlas(false, [&] { return TMatrixDSym(TMatrixDSym::kAtA, a); });
+   EXPECT_LT(RelativeDifference(blas, ref), 1e-14);
+   EXPECT_TRUE(blas.IsSymmetric());
+}
+
+TEST(MatrixBlas, LU)
+{
+   const auto a = RandomMatrix<TMatrixD>(kN, kN, 3);
+   TVectorD rhs(kN);
+   for (Int_t i = 0; i < kN; ++i)
+      rhs(i) = i - kN / 2;
+
+   auto decompose = [&] {
+      TDecompLU lu(a);
+      EXPECT_TRUE(lu.Decompose());
+      Double_t d1, d2;
+      lu.Det(d1, d2);
+      TVectorD x(rhs);
+      EXPECT_TRUE(lu.Solve(x));
+      return std::make_pair(d1 * TMath::Power(2., d2), x);
+   };
+   const auto blas = WithBlas(true, decompose);
+   const auto ref = WithBlas(false, decompose);
+   EXPECT_NEAR(blas.first, ref.first, 1e-10 * TMath::Abs(ref.first));
+   EXPECT_LT(RelativeDifference(blas.second, ref.second), 1e-10);
+   // the solution is the one of the system
+   EXPECT_LT(RelativeDifference(TVectorD(a * blas.second), rhs), 1e-12);
+}
+
+TEST(MatrixBlas, LUSingular)
+{
+   auto a = RandomMatrix<TMatrixD>(kN, kN, 3);
+   for (Int_t i = 0; i < kN; ++i)
+      a(i, 0) = 0;
+   for (bool on : {true, false}) {
+      TDecompLU lu(a);
+      WithBlas(on, [&] {
+         ROOT_EXPECT_ERROR(EXPECT_FALSE(lu.Decompose()), "TDecompLU::DecomposeLUGauss", "matrix is singular");
+         return 0;
+      });
+   }
+}
+
+TEST(MatrixBlas, Cholesky)
+{
+   const auto spd = PositiveDefiniteMatrix(kN);
+   auto decompose = [&] {
+      TDecompChol chol(spd);
+      EXPECT_TRUE(chol.Decompose());
+      return TMatrixD(chol.GetU());
+   };
+   const auto blas = WithBlas(true, decompose);
+   const auto ref = WithBlas(false, decompose);
+   EXPECT_LT(RelativeDifference(blas, ref), 1e-13);
+   for (Int_t i = 0; i < kN; ++i)
+      for (Int_t j = 0; j < i; ++j)
+         EXPECT_EQ(blas(i, j), 0.);
+}
+
+TEST(MatrixBlas, CholeskyNotPositiveDefinite)
+{
+   auto a = PositiveDefiniteMatrix(kN);
+   a(kN / 2, kN / 2) = -1;
+   for (bool on : {true, false}) {
+      TDecompChol chol(a);
+      WithBlas(on, [&] {
+         ROOT_EXPECT_ERROR(EXPECT_FALSE(chol.Decompose()), "TDecompChol::Decompose()", "matrix not positive definite");
+         return 0;
+      });
+   }
+}
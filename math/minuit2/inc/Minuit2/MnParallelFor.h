@@ -0,0 +1,81 @@
+// @(#)root/minuit2:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2005 LCG ROOT Math team,  CERN/PH-SFT                *
+ *                                                                    *
+ **********************************************************************/
+
+#ifndef ROOT_Minuit2_MnParallelFor
+#define ROOT_Minuit2_MnParallelFor
+
+#include "Minuit2/MnPrint.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ROOT {
+
+namespace Minuit2 {
+
+/**
+    Calls work(k) for k = begin, ..., end - 1 from nthreads threads (0 = the number of hardware threads),
+    the calling thread being one of them; each thread takes the next index as soon as it is done with the
+    previous one. The other threads use the print level of the calling thread.
+    The work, and thus the FCN which it calls, must be thread-safe. The first exception thrown by the work
+    stops the distribution of the indices and is rethrown in the calling thread.
+ */
+
+template <class Work>
+void MnParallelFor(unsigned int nthreads, unsigned int begin, unsigned int end, Work &&work)
+{
+   if (end <= begin)
+      return;
+   if (nthreads == 0)
+      nthreads = std::thread::hardware_concurrency();
+   nthreads = std::min(nthreads, end - begin);
+   if (nthreads <= 1) {
+      for (unsigned int k = begin; k < end; ++k)
+         work(k);
+      return;
+   }
+
+   const int printLevel = MnPrint::GlobalLevel();
+   std::atomic<unsigned int> next{begin};
+   std::exception_ptr exception;
+   std::mutex exceptionMutex;
+   auto loop = [&]() {
+      try {
+         for (unsigned int k = next++; k < end; k = next++)
+            work(k);
+      } catch (...) {
+         std::lock_guard<std::mutex> lock(exceptionMutex);
+         if (!exception)
+            exception = std::current_exception();
+         next = end;
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for (unsigned int t = 1; t < nthreads; ++t) {
+      threads.emplace_back([&]() {
+         MnPrint::SetGlobalLevel(printLevel);
+         loop();
+      });
+   }
+   loop();
+   for (auto &thread : threads)
+      thread.join();
+   if (exception)
+      std::rethrow_exception(exception);
+}
+
+} // namespace Minuit2
+
+} // namespace ROOT
+
+#endif // ROOT_Minuit2_MnParallelFor
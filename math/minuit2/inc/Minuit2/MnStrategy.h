@@ -46,6 +46,10 @@ public:
    double HessianG2Tolerance() const { return fHessTlrG2; }
    unsigned int HessianGradientNCycles() const { return fHessGradNCyc; }
 
+   unsigned int GradientNThreads() const { return fGradNThreads; }
+   unsigned int HessianNThreads() const { return fHessNThreads; }
+   unsigned int MinosNThreads() const { return fMinosNThreads; }
+
    int StorageLevel() const { return fStoreLevel; }
 
    bool IsLow() const { return fStrategy == 0; }
@@ -65,6 +69,17 @@ public:
    void SetHessianG2Tolerance(double toler) { fHessTlrG2 = toler; }
    void SetHessianGradientNCycles(unsigned int n) { fHessGradNCyc = n; }
 
+   // set the number of threads computing the numerical gradient, one parameter at a time
+   // 1 = sequential (default), 0 = the number of hardware threads
+   // A value other than 1 declares that the FCN can be called concurrently from several threads
+   void SetGradientNThreads(unsigned int n) { fGradNThreads = n; }
+   // set the number of threads computing the numerical second derivatives in MnHesse (same values as above);
+   // the result does not depend on the number of threads
+   void SetHessianNThreads(unsigned int n) { fHessNThreads = n; }
+   // set the number of threads running the independent constrained minimizations of MnMinos and MnContours,
+   // i.e. the lower and upper errors of the parameters and the first contour points (same values as above)
+   void SetMinosNThreads(unsigned int n) { fMinosNThreads = n; }
+
    // set storage level of iteration quantities
    // 0 = store only last iterations 1 = full storage (default)
    void SetStorageLevel(unsigned int level) { fStoreLevel = level; }
@@ -79,6 +94,9 @@ private:
    double fHessTlrStp;
    double fHessTlrG2;
    unsigned int fHessGradNCyc;
+   unsigned int fGradNThreads;
+   unsigned int fHessNThreads;
+   unsigned int fMinosNThreads;
    int fStoreLevel;
 };
 
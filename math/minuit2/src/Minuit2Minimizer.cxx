@@ -35,6 +35,7 @@
 #include "Minuit2/FumiliMinimizer.h"
 #include "Minuit2/MnParameterScan.h"
 #include "Minuit2/MnContours.h"
+#include "Minuit2/MnParallelFor.h"
 #include "Minuit2/MnTraceObject.h"
 #include "Minuit2/MinimumBuilder.h"
 
@@ -83,6 +84,28 @@ int ControlPrintLevel()
 void RestoreGlobalPrintLevel(int) {}
 #endif
 
+namespace {
+
+// set the numbers of threads of the strategy from the Minuit2 extra options
+// (0 = hardware threads); a value other than 1 requires a thread-safe function
+void SetThreadOptions(MnStrategy &strategy)
+{
+   ROOT::Math::IOptions *minuit2Opt = ROOT::Math::MinimizerOptions::FindDefault("Minuit2");
+   if (!minuit2Opt)
+      return;
+   int nthreads = 1;
+   if (minuit2Opt->GetValue("GradientNThreads", nthreads) && nthreads >= 0)
+      strategy.SetGradientNThreads(nthreads);
+   nthreads = 1;
+   if (minuit2Opt->GetValue("HessianNThreads", nthreads) && nthreads >= 0)
+      strategy.SetHessianNThreads(nthreads);
+   nthreads = 1;
+   if (minuit2Opt->GetValue("MinosNThreads", nthreads) && nthreads >= 0)
+      strategy.SetMinosNThreads(nthreads);
+}
+
+} // namespace
+
 Minuit2Minimizer::Minuit2Minimizer(ROOT::Minuit2::EMinimizerType type)
    : Minimizer(), fDim(0), fMinimizer(nullptr), fMinuitFCN(nullptr), fMinimum(nullptr)
 {
@@ -497,6 +520,8 @@ bool Minuit2Minimizer::Minimize()
       strategy.SetHessianStepTolerance(hessStepTol);
       strategy.SetHessianG2Tolerance(hessStepTol);
 
+      SetThreadOptions(strategy);
+
       int storageLevel = 1;
       bool ret = minuit2Opt->GetValue("StorageLevel", storageLevel);
       if (ret)
@@ -922,7 +947,9 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
    if (Precision() > 0)
       fState.SetPrecision(Precision());
 
-   ROOT::Minuit2::MnMinos minos(*fMinuitFCN, *fMinimum);
+   ROOT::Minuit2::MnStrategy minosStrategy(1);
+   SetThreadOptions(minosStrategy);
+   ROOT::Minuit2::MnMinos minos(*fMinuitFCN, *fMinimum, minosStrategy);
 
    // run MnCross
    MnCross low;
@@ -944,23 +971,40 @@ int Minuit2Minimizer::RunMinosError(unsigned int i, double &errLow, double &errU
       maxfcn_used = 2 * (nvar + 1) * (200 + 100 * nvar + 5 * nvar * nvar);
    }
 
-   if (runLower) {
+   // with more than one thread the lower and upper errors are computed concurrently
+   if (runLower && runUpper && minosStrategy.MinosNThreads() != 1) {
       if (debugLevel >= 1) {
          std::cout << "************************************************************************************************"
                       "******\n";
-         std::cout << "Minuit2Minimizer::GetMinosError - Run MINOS LOWER error for parameter #" << i << " : "
-                   << par_name << " using max-calls " << maxfcn_used << ", tolerance " << tol << std::endl;
+         std::cout << "Minuit2Minimizer::GetMinosError - Run MINOS LOWER and UPPER errors concurrently for parameter #"
+                   << i << " : " << par_name << " using max-calls " << maxfcn_used << ", tolerance " << tol
+                   << std::endl;
       }
-      low = minos.Loval(i, maxfcn, tol);
-   }
-   if (runUpper) {
-      if (debugLevel >= 1) {
-         std::cout << "************************************************************************************************"
-                      "******\n";
-         std::cout << "Minuit2Minimizer::GetMinosError - Run MINOS UPPER error for parameter #" << i << " : "
-                   << par_name << " using max-calls " << maxfcn_used << ", tolerance " << tol << std::endl;
+      MnParallelFor(minosStrategy.MinosNThreads(), 0, 2, [&](unsigned int k) {
+         if (k == 0)
+            low = minos.Loval(i, maxfcn, tol);
+         else
+            up = minos.Upval(i, maxfcn, tol);
+      });
+   } else {
+      if (runLower) {
+         if (debugLevel >= 1) {
+            std::cout << "*********************************************************************************************"
+                         "*********\n";
+            std::cout << "Minuit2Minimizer::GetMinosError - Run MINOS LOWER error for parameter #" << i << " : "
+                      << par_name << " using max-calls " << maxfcn_used << ", tolerance " << tol << std::endl;
+         }
+         low = minos.Loval(i, maxfcn, tol);
+      }
+      if (runUpper) {
+         if (debugLevel >= 1) {
+            std::cout << "*********************************************************************************************"
+                         "*********\n";
+            std::cout << "Minuit2Minimizer::GetMinosError - Run MINOS UPPER error for parameter #" << i << " : "
+                      << par_name << " using max-calls " << maxfcn_used << ", tolerance " << tol << std::endl;
+         }
+         up = minos.Upval(i, maxfcn, tol);
       }
-      up = minos.Upval(i, maxfcn, tol);
    }
 
    ROOT::Minuit2::MinosError me(i, fMinimum->UserState().Value(i), low, up);
@@ -1167,7 +1211,9 @@ bool Minuit2Minimizer::Contour(unsigned int ipar, unsigned int jpar, unsigned in
       fState.SetPrecision(Precision());
 
    // eventually one should specify tolerance in contours
-   MnContours contour(*fMinuitFCN, *fMinimum, Strategy());
+   MnStrategy contourStrategy(Strategy());
+   SetThreadOptions(contourStrategy);
+   MnContours contour(*fMinuitFCN, *fMinimum, contourStrategy);
 
    // restore global print level
    if (prev_level > -2)
@@ -1214,7 +1260,11 @@ bool Minuit2Minimizer::Hesse()
    if (Precision() > 0)
       fState.SetPrecision(Precision());
 
-   ROOT::Minuit2::MnHesse hesse(strategy);
+   // the threading options are taken from the extra options, as in Minimize
+   ROOT::Minuit2::MnStrategy hessStrategy(strategy);
+   SetThreadOptions(hessStrategy);
+
+   ROOT::Minuit2::MnHesse hesse(hessStrategy);
 
    // case when function minimum exists
    if (fMinimum) {
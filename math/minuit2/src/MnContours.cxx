@@ -17,6 +17,9 @@
 #include "Minuit2/MinosError.h"
 #include "Minuit2/ContoursError.h"
 #include "Minuit2/MnPrint.h"
+#include "Minuit2/MnParallelFor.h"
+
+#include <memory>
 
 namespace ROOT {
 
@@ -56,7 +59,15 @@ ContoursError MnContours::Contour(unsigned int px, unsigned int py, unsigned int
    double valx = fMinimum.UserState().Value(px);
    double valy = fMinimum.UserState().Value(py);
 
-   MinosError mex = minos.Minos(px);
+   // with MnStrategy::SetMinosNThreads the Minos errors of both parameters and then the four minimizations through
+   // the Minos points are computed concurrently; the latter start then all from the minimum, instead of the
+   // minimizations with the same fixed parameter starting from the result of the previous one
+   const bool parallel = fStrategy.MinosNThreads() != 1;
+   std::vector<MinosError> mexy;
+   if (parallel)
+      mexy = minos.Minos(std::vector<unsigned int>{px, py});
+
+   MinosError mex = parallel ? mexy[0] : minos.Minos(px);
    nfcn += mex.NFcn();
    if (!mex.IsValid()) {
       print.Error("unable to find first two points");
@@ -64,7 +75,7 @@ ContoursError MnContours::Contour(unsigned int px, unsigned int py, unsigned int
    }
    std::pair<double, double> ex = mex();
 
-   MinosError mey = minos.Minos(py);
+   MinosError mey = parallel ? mexy[1] : minos.Minos(py);
    nfcn += mey.NFcn();
    if (!mey.IsValid()) {
       print.Error("unable to find second two points");
@@ -72,11 +83,25 @@ ContoursError MnContours::Contour(unsigned int px, unsigned int py, unsigned int
    }
    std::pair<double, double> ey = mey();
 
+   // upper and lower y value for the x parameter fixed at its Minos errors, then the same for x
+   std::unique_ptr<FunctionMinimum> exy[4];
+   if (parallel) {
+      MnParallelFor(fStrategy.MinosNThreads(), 0, 4, [&](unsigned int k) {
+         const unsigned int ipar = k < 2 ? px : py;
+         const double val = k < 2 ? valx : valy;
+         const std::pair<double, double> &e = k < 2 ? ex : ey;
+         MnMigrad migradk(fFCN, fMinimum.UserState(), MnStrategy(std::max(0, int(fStrategy.Strategy() - 1))));
+         migradk.Fix(ipar);
+         migradk.SetValue(ipar, val + (k % 2 == 0 ? e.second : e.first));
+         exy[k] = std::make_unique<FunctionMinimum>(migradk());
+      });
+   }
+
    MnMigrad migrad(fFCN, fMinimum.UserState(), MnStrategy(std::max(0, int(fStrategy.Strategy() - 1))));
 
    migrad.Fix(px);
    migrad.SetValue(px, valx + ex.second);
-   FunctionMinimum exy_up = migrad();
+   FunctionMinimum exy_up = parallel ? *exy[0] : migrad();
    nfcn += exy_up.NFcn();
    if (!exy_up.IsValid()) {
       print.Error("unable to find Upper y Value for x Parameter", px);
@@ -84,7 +109,7 @@ ContoursError MnContours::Contour(unsigned int px, unsigned int py, unsigned int
    }
 
    migrad.SetValue(px, valx + ex.first);
-   FunctionMinimum exy_lo = migrad();
+   FunctionMinimum exy_lo = parallel ? *exy[1] : migrad();
    nfcn += exy_lo.NFcn();
    if (!exy_lo.IsValid()) {
       print.Error("unable to find Lower y Value for x Parameter", px);
@@ -94,7 +119,7 @@ ContoursError MnContours::Contour(unsigned int px, unsigned int py, unsigned int
    MnMigrad migrad1(fFCN, fMinimum.UserState(), MnStrategy(std::max(0, int(fStrategy.Strategy() - 1))));
    migrad1.Fix(py);
    migrad1.SetValue(py, valy + ey.second);
-   FunctionMinimum eyx_up = migrad1();
+   FunctionMinimum eyx_up = parallel ? *exy[2] : migrad1();
    nfcn += eyx_up.NFcn();
    if (!eyx_up.IsValid()) {
       print.Error("unable to find Upper x Value for y Parameter", py);
@@ -102,7 +127,7 @@ ContoursError MnContours::Contour(unsigned int px, unsigned int py, unsigned int
    }
 
    migrad1.SetValue(py, valy + ey.first);
-   FunctionMinimum eyx_lo = migrad1();
+   FunctionMinimum eyx_lo = parallel ? *exy[3] : migrad1();
    nfcn += eyx_lo.NFcn();
    if (!eyx_lo.IsValid()) {
       print.Error("unable to find Lower x Value for y Parameter", py);
@@ -23,6 +23,11 @@
 #include "Minuit2/FunctionMinimum.h"
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/MPIProcess.h"
+#include "Minuit2/MnParallelFor.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
 
 namespace ROOT {
 
@@ -228,15 +233,24 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
    print.Debug("Gradient is", st.Gradient().IsAnalytical() ? "analytical" : "numerical", "\n  point:", x,
                "\n  fcn  :", amin, "\n  grad :", grd, "\n  step :", gst, "\n  g2   :", g2);
 
-   for (unsigned int i = 0; i < n; i++) {
+   const unsigned int nthreads = fStrategy.HessianNThreads();
 
+   // computes the second derivative for parameter i around the point x, which is restored on return, and adds the
+   // number of function calls to ncalls; returns false if it is zero
+   std::mutex printMutex;
+   auto computeDiagonal = [&](unsigned int i, MnAlgebraicVector &x, MnPrint &printer, unsigned int &ncalls) {
       double xtf = x(i);
       double dmin = 8. * prec.Eps2() * (std::fabs(xtf) + prec.Eps2());
       double d = std::fabs(gst(i));
       if (d < dmin)
          d = dmin;
 
-      print.Debug("Derivative parameter", i, "d =", d, "dmin =", dmin);
+      auto debug = [&](const auto &...args) {
+         std::lock_guard<std::mutex> lock(printMutex);
+         printer.Debug(args...);
+      };
+
+      debug("Derivative parameter", i, "d =", d, "dmin =", dmin);
 
       for (unsigned int icyc = 0; icyc < Ncycles(); icyc++) {
          double sag = 0.;
@@ -248,16 +262,17 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
             x(i) = xtf - d;
             fs2 = mfcn(x);
             x(i) = xtf;
+            ncalls += 2;
             sag = 0.5 * (fs1 + fs2 - 2. * amin);
 
-            print.Debug("cycle", icyc, "mul", multpy, "\tsag =", sag, "d =", d);
+            debug("cycle", icyc, "mul", multpy, "\tsag =", sag, "d =", d);
 
             //  Now as F77 Minuit - check that sag is not zero
             if (sag != 0)
                goto L30; // break
             if (trafo.Parameter(i).HasLimits()) {
                if (d > 0.5)
-                  goto L26;
+                  return false;
                d *= 10.;
                if (d > 0.5)
                   d = 0.51;
@@ -266,19 +281,7 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
             d *= 10.;
          }
 
-      L26:
-         // get parameter name for i
-         // (need separate scope for avoiding compl error when declaring name)
-         print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(i)),
-                    "; MnHesse fails and will return diagonal matrix");
-
-         for (unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
-            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
-         }
-
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
-                             mfcn.NumOfCalls());
+         return false;
 
       L30:
          double g2bfor = g2(i);
@@ -294,8 +297,8 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
          if (d < dmin)
             d = dmin;
 
-         print.Debug("g1 =", grd(i), "g2 =", g2(i), "step =", gst(i), "d =", d, "diffd =", std::fabs(d - dlast) / d,
-                     "diffg2 =", std::fabs(g2(i) - g2bfor) / g2(i));
+         debug("g1 =", grd(i), "g2 =", g2(i), "step =", gst(i), "d =", d, "diffd =", std::fabs(d - dlast) / d,
+               "diffg2 =", std::fabs(g2(i) - g2bfor) / g2(i));
 
          // see if converged
          if (std::fabs((d - dlast) / d) < Tolerstp())
@@ -305,19 +308,56 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
          d = std::min(d, 10. * dlast);
          d = std::max(d, 0.1 * dlast);
       }
+      return true;
+   };
+
+   // the state returned when the computation fails at parameter i, whose successors keep their input g2
+   const MnAlgebraicVector g2Input = g2;
+   auto failed = [&](unsigned int i, MinimumError::Status status) {
+      for (unsigned int j = 0; j < n; j++) {
+         double g2j = j > i ? g2Input(j) : g2(j);
+         double tmp = g2j < prec.Eps2() ? 1. : 1. / g2j;
+         vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
+      }
+      return MinimumState(st.Parameters(), MinimumError(vhmat, status), st.Gradient(), st.Edm(), mfcn.NumOfCalls());
+   };
+
+   // in parallel, the diagonal elements of all parameters are computed before the failures are checked, in the
+   // order of the parameters as in the sequential computation; the result is thus independent of the number of
+   // threads, only the reported number of function calls includes those after a failure
+   const bool parallel = nthreads != 1 && n > 1;
+   std::vector<char> diagonalOk(n, true);
+   std::vector<unsigned int> diagonalNCalls(n, 0);
+   if (parallel) {
+      MnParallelFor(nthreads, 0, n, [&](unsigned int i) {
+         // each thread uses its own copy of the point and its own MnPrint instance
+         MnPrint printtl("MnHesse[thread]");
+         MnAlgebraicVector xtl = x;
+         diagonalOk[i] = computeDiagonal(i, xtl, printtl, diagonalNCalls[i]);
+      });
+   }
+
+   unsigned int ncalls = mfcn.NumOfCalls();
+   for (unsigned int i = 0; i < n; i++) {
+      if (parallel)
+         ncalls += diagonalNCalls[i];
+      else
+         diagonalOk[i] = computeDiagonal(i, x, print, ncalls);
+
+      if (!diagonalOk[i]) {
+         // get parameter name for i
+         // (need separate scope for avoiding compl error when declaring name)
+         print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(i)),
+                    "; MnHesse fails and will return diagonal matrix");
+         return failed(i, MinimumError::MnHesseFailed);
+      }
+
       vhmat(i, i) = g2(i);
-      if (mfcn.NumOfCalls() > maxcalls) {
+      if (ncalls > maxcalls) {
 
          // std::cout<<"maxcalls " << maxcalls << " " << mfcn.NumOfCalls() << "  " <<   st.NFcn() << std::endl;
          print.Warn("Maximum number of allowed function calls exhausted; will return diagonal matrix");
-
-         for (unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
-            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
-         }
-
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnReachedCallLimit), st.Gradient(),
-                             st.Edm(), mfcn.NumOfCalls());
+         return failed(i, MinimumError::MnReachedCallLimit);
       }
    }
 
@@ -339,31 +379,35 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
       unsigned int startParIndexOffDiagonal = mpiprocOffDiagonal.StartElementIndex();
       unsigned int endParIndexOffDiagonal = mpiprocOffDiagonal.EndElementIndex();
 
-      unsigned int offsetVect = 0;
-      for (unsigned int in = 0; in < startParIndexOffDiagonal; in++)
-         if ((in + offsetVect) % (n - 1) == 0)
-            offsetVect += (in + offsetVect) / (n - 1);
-
-      for (unsigned int in = startParIndexOffDiagonal; in < endParIndexOffDiagonal; in++) {
-
-         int i = (in + offsetVect) / (n - 1);
-         if ((in + offsetVect) % (n - 1) == 0)
-            offsetVect += i;
-         int j = (in + offsetVect) % (n - 1) + 1;
-
-         if ((i + 1) == j || in == startParIndexOffDiagonal)
-            x(i) += dirin(i);
-
-         x(j) += dirin(j);
-
-         double fs1 = mfcn(x);
-         double elem = (fs1 + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
-         vhmat(i, j) = elem;
-
-         x(j) -= dirin(j);
-
-         if (j % (n - 1) == 0 || in == endParIndexOffDiagonal - 1)
-            x(i) -= dirin(i);
+      // computes the elements (i, j > i) of row i which belong to this process, with the off-diagonal elements
+      // numbered row by row; the point x is restored exactly after each element, whichever thread computes it
+      auto computeRow = [&](unsigned int i, MnAlgebraicVector &x) {
+         const unsigned int rowStart = i * (2 * n - i - 1) / 2;
+         const double xi = x(i);
+         x(i) = xi + dirin(i);
+         for (unsigned int j = i + 1; j < n; j++) {
+            const unsigned int in = rowStart + j - i - 1;
+            if (in < startParIndexOffDiagonal || in >= endParIndexOffDiagonal)
+               continue;
+            const double xj = x(j);
+            x(j) = xj + dirin(j);
+            double fs1 = mfcn(x);
+            double elem = (fs1 + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
+            vhmat(i, j) = elem;
+            x(j) = xj;
+         }
+         x(i) = xi;
+      };
+
+      // the rows are distributed dynamically to the threads, the longest first
+      if (parallel) {
+         MnParallelFor(nthreads, 0, n - 1, [&](unsigned int i) {
+            MnAlgebraicVector xtl = x;
+            computeRow(i, xtl);
+         });
+      } else {
+         for (unsigned int i = 0; i + 1 < n; i++)
+            computeRow(i, x);
       }
 
       mpiprocOffDiagonal.SyncSymMatrixOffDiagonal(vhmat);
@@ -14,6 +14,7 @@
 #include "Minuit2/MnCross.h"
 #include "Minuit2/MinosError.h"
 #include "Minuit2/MnPrint.h"
+#include "Minuit2/MnParallelFor.h"
 
 namespace ROOT {
 
@@ -41,6 +42,10 @@ MnMinos::MnMinos(const FCNBase &fcn, const FunctionMinimum &min, const MnStrateg
    if (fcn.Up() != min.Up()) {
       print.Warn("UP value has changed, need to update FunctionMinimum class");
    }
+
+   // the user state of the minimum is created on first access, which must not happen in concurrent crossings
+   if (fStrategy.MinosNThreads() != 1)
+      min.UserState();
 }
 
 std::pair<double, double> MnMinos::operator()(unsigned int par, unsigned int maxcalls, double toler) const
@@ -76,6 +81,9 @@ MinosError MnMinos::Minos(unsigned int par, unsigned int maxcalls, double toler)
 {
    // do full minos error anlysis (lower + upper) for parameter par
 
+   if (fStrategy.MinosNThreads() != 1)
+      return Minos(std::vector<unsigned int>(1, par), maxcalls, toler).front();
+
    MnPrint print("MnMinos");
 
    MnCross up = Upval(par, maxcalls, toler);
@@ -91,6 +99,36 @@ MinosError MnMinos::Minos(unsigned int par, unsigned int maxcalls, double toler)
    return MinosError(par, fMinimum.UserState().Value(par), lo, up);
 }
 
+std::vector<MinosError> MnMinos::Minos(const std::vector<unsigned int> &pars, unsigned int maxcalls, double toler) const
+{
+   // do full minos error analysis for the parameters pars: the crossings of all parameters and directions are
+   // independent constrained minimizations, which run concurrently with MnStrategy::SetMinosNThreads
+
+   MnPrint print("MnMinos");
+
+   std::vector<MnCross> crosses(2 * pars.size());
+   MnParallelFor(fStrategy.MinosNThreads(), 0, crosses.size(), [&](unsigned int k) {
+      // the upper error first, as in Minos(par)
+      if (k % 2 == 0)
+         crosses[k] = Upval(pars[k / 2], maxcalls, toler);
+      else
+         crosses[k] = Loval(pars[k / 2], maxcalls, toler);
+   });
+
+   std::vector<MinosError> result;
+   result.reserve(pars.size());
+   for (unsigned int i = 0; i < pars.size(); i++) {
+      const MnCross &up = crosses[2 * i];
+      const MnCross &lo = crosses[2 * i + 1];
+
+      print.Debug("Function calls to find upper and lower error of parameter", pars[i], ":", up.NFcn(), lo.NFcn());
+      print.Debug("return Minos error", lo.Value(), ",", up.Value());
+
+      result.emplace_back(pars[i], fMinimum.UserState().Value(pars[i]), lo, up);
+   }
+   return result;
+}
+
 MnCross MnMinos::FindCrossValue(int direction, unsigned int par, unsigned int maxcalls, double toler) const
 {
    // get crossing value in the parameter direction :
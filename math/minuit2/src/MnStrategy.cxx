@@ -13,13 +13,13 @@ namespace ROOT {
 
 namespace Minuit2 {
 
-MnStrategy::MnStrategy() : fStoreLevel(1)
+MnStrategy::MnStrategy() : fGradNThreads(1), fHessNThreads(1), fMinosNThreads(1), fStoreLevel(1)
 {
    // default strategy
    SetMediumStrategy();
 }
 
-MnStrategy::MnStrategy(unsigned int stra) : fStoreLevel(1)
+MnStrategy::MnStrategy(unsigned int stra) : fGradNThreads(1), fHessNThreads(1), fMinosNThreads(1), fStoreLevel(1)
 {
    // user defined strategy (0, 1, >=2)
    if (stra == 0)
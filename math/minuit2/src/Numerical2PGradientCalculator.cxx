@@ -16,6 +16,7 @@
 #include "Minuit2/FunctionGradient.h"
 #include "Minuit2/MnStrategy.h"
 #include "Minuit2/MnPrint.h"
+#include "Minuit2/MnParallelFor.h"
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -24,6 +25,7 @@
 #include <cmath>
 #include <cassert>
 #include <iomanip>
+#include <mutex>
 
 #include "Minuit2/MPIProcess.h"
 
@@ -97,35 +99,10 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 
    print.Debug("Calculating gradient around function value", fcnmin, "\n\t at point", par.Vec());
 
-#ifndef _OPENMP
-
-   MPIProcess mpiproc(n, 0);
-
-   // for serial execution this can be outside the loop
-   MnAlgebraicVector x = par.Vec();
-
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
-
-#else
-
-   // parallelize this loop using OpenMP
-//#define N_PARALLEL_PAR 5
-#pragma omp parallel
-#pragma omp for
-   //#pragma omp for schedule (static, N_PARALLEL_PAR)
-
-   for (int i = 0; i < int(n); i++) {
-
-#endif
-
-#ifdef _OPENMP
-      // create in loop since each thread will use its own copy
-      MnAlgebraicVector x = par.Vec();
-#endif
-
+   // computes the derivatives for parameter i around the point x, which is restored on return;
+   // per-cycle printing goes through the MnPrint of the calling thread, serialized by printMutex
+   std::mutex printMutex;
+   auto computeDerivatives = [&](unsigned int i, MnAlgebraicVector &x, MnPrint &printer) {
       double xtf = x(i);
       double epspri = eps2 + std::fabs(grd(i) * eps2);
       double stepb4 = 0.;
@@ -169,30 +146,16 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
          grd(i) = 0.5 * (fs1 - fs2) / step;
          g2(i) = (fs1 + fs2 - 2. * fcnmin) / step / step;
 
-#ifdef _OPENMP
-#pragma omp critical
-#endif
          {
-#ifdef _OPENMP
-            // must create thread-local MnPrint instances when printing inside threads
-            MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
-#endif
+            std::lock_guard<std::mutex> lock(printMutex);
             if (i == 0 && j == 0) {
-#ifdef _OPENMP
-               printtl.Trace([&](std::ostream &os) {
-#else
-               print.Trace([&](std::ostream &os) {
-#endif
+               printer.Trace([&](std::ostream &os) {
                   os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x" << std::setw(15)
                      << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15) << "grd"
                      << std::setw(15) << "g2" << std::endl;
                });
             }
-#ifdef _OPENMP
-            printtl.Trace([&](std::ostream &os) {
-#else
-            print.Trace([&](std::ostream &os) {
-#endif
+            printer.Trace([&](std::ostream &os) {
                const int pr = os.precision(13);
                const int iext = Trafo().ExtOfInt(i);
                os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " "
@@ -209,16 +172,50 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
             break;
          }
       }
+   };
+
+#ifndef _OPENMP
 
-      //     vgrd(i) = grd;
-      //     vgrd2(i) = g2;
-      //     vgstp(i) = gstep;
+   MPIProcess mpiproc(n, 0);
+
+   unsigned int startElementIndex = mpiproc.StartElementIndex();
+   unsigned int endElementIndex = mpiproc.EndElementIndex();
+
+   // the parameters are distributed dynamically to the threads, since the number of cycles differs
+   if (Strategy().GradientNThreads() != 1) {
+      MnParallelFor(Strategy().GradientNThreads(), startElementIndex, endElementIndex, [&](unsigned int i) {
+         // each thread uses its own copy of the point and its own MnPrint instance
+         MnPrint printtl("Numerical2PGradientCalculator[thread]");
+         MnAlgebraicVector x = par.Vec();
+         computeDerivatives(i, x, printtl);
+      });
+   } else {
+      // for serial execution this can be outside the loop
+      MnAlgebraicVector x = par.Vec();
+      for (unsigned int i = startElementIndex; i < endElementIndex; i++)
+         computeDerivatives(i, x, print);
    }
 
-#ifndef _OPENMP
    mpiproc.SyncVector(grd);
    mpiproc.SyncVector(g2);
    mpiproc.SyncVector(gstep);
+
+#else
+
+   // parallelize this loop using OpenMP
+//#define N_PARALLEL_PAR 5
+#pragma omp parallel
+#pragma omp for
+   //#pragma omp for schedule (static, N_PARALLEL_PAR)
+
+   for (int i = 0; i < int(n); i++) {
+      // create in loop since each thread will use its own copy
+      MnAlgebraicVector x = par.Vec();
+      // must create thread-local MnPrint instances when printing inside threads
+      MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
+      computeDerivatives(i, x, printtl);
+   }
+
 #endif
 
    // print after parallel processing to avoid synchronization issues
@@ -12,6 +12,11 @@
    -lf2c -lm   (in that order)
 */
 
+#ifdef MINUIT2_BLAS
+extern "C" void dspmv_(const char *uplo, const int *n, const double *alpha, const double *ap, const double *x,
+                       const int *incx, const double *beta, double *y, const int *incy);
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -22,6 +27,13 @@ int mnxerbla(const char *, int);
 int Mndspmv(const char *uplo, unsigned int n, double alpha, const double *ap, const double *x, int incx, double beta,
             double *y, int incy)
 {
+#ifdef MINUIT2_BLAS
+   // the translated reference implementation below is used only without an optimized BLAS
+   const int nn = n;
+   dspmv_(uplo, &nn, &alpha, ap, x, &incx, &beta, y, &incy);
+   return 0;
+#endif
+
    /* System generated locals */
    int i__1, i__2;
 
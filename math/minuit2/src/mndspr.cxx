@@ -12,6 +12,11 @@
    -lf2c -lm   (in that order)
 */
 
+#ifdef MINUIT2_BLAS
+extern "C" void dspr_(const char *uplo, const int *n, const double *alpha, const double *x, const int *incx,
+                      double *ap);
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -21,6 +26,13 @@ int mnxerbla(const char *, int);
 
 int mndspr(const char *uplo, unsigned int n, double alpha, const double *x, int incx, double *ap)
 {
+#ifdef MINUIT2_BLAS
+   // the translated reference implementation below is used only without an optimized BLAS
+   const int nn = n;
+   dspr_(uplo, &nn, &alpha, x, &incx, ap);
+   return 0;
+#endif
+
    /* System generated locals */
    int i__1, i__2;
 
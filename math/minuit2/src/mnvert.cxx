@@ -11,6 +11,13 @@
 
 #include <cmath>
 
+#ifdef MINUIT2_BLAS
+extern "C" {
+void dpptrf_(const char *uplo, const int *n, double *ap, int *info);
+void dpptri_(const char *uplo, const int *n, double *ap, int *info);
+}
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -18,12 +25,30 @@ namespace Minuit2 {
 /** Inverts a symmetric matrix. Matrix is first scaled to have all ones on
     the diagonal (equivalent to change of units) but no pivoting is done
     since matrix is positive-definite.
+    With BLAS support the inversion is done by the Cholesky factorization of LAPACK
+    (the packed storage of MnAlgebraicSymMatrix is the upper packed storage of LAPACK);
+    a matrix which is not positive-definite is still passed to the algorithm below,
+    which may invert it.
  */
 
 int mnvert(MnAlgebraicSymMatrix &a)
 {
 
    unsigned int nrow = a.Nrow();
+#ifdef MINUIT2_BLAS
+   if (nrow > 0) {
+      MnAlgebraicSymMatrix c(a);
+      const int n = nrow;
+      int info = 0;
+      dpptrf_("U", &n, c.Data(), &info);
+      if (info == 0)
+         dpptri_("U", &n, c.Data(), &info);
+      if (info == 0) {
+         a = c;
+         return 0;
+      }
+   }
+#endif
    MnAlgebraicVector s(nrow);
    MnAlgebraicVector q(nrow);
    MnAlgebraicVector pp(nrow);
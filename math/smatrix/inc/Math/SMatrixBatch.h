@@ -0,0 +1,283 @@
+// @(#)root/smatrix:$Id$
+
+#ifndef ROOT_Math_SMatrixBatch
+#define ROOT_Math_SMatrixBatch
+
+#include "Math/SMatrix.h"
+
+#include <cmath>
+
+namespace ROOT {
+
+namespace Math {
+
+//__________________________________________________________________________
+/**
+    SMatrixBatch: N matrices of the same type and size D1 x D2, stored as a structure of arrays.
+
+    The N values of each matrix element are contiguous in memory, so that the operations below, which are
+    written as loops over the N matrices in the innermost loop, are vectorized by the compiler for any scalar
+    type T. This is the layout to use when the same operation is applied to many small matrices, e.g. the
+    covariance matrices of the tracks in a Kalman filter:
+
+    @code
+    SMatrixBatch<double, 5, 5, 64> F, C, tmp;
+    // ... set the N propagation matrices F and covariance matrices C with Set(k, m)
+    Similarity(F, C, tmp);   // tmp = F C F^T for each of the 64 tracks
+    bool ok[64];
+    tmp.InvertChol(ok);      // invert where positive definite
+    SMatrix<double, 5, 5> m = tmp.Get(3);
+    @endcode
+
+    The matrices given to Similarity() and InvertChol() must be symmetric: only their lower triangle is read.
+    SMatrix with a Vc vector type as scalar, e.g. SMatrix<ROOT::Double_v, 5, 5>, is the array-of-structures
+    alternative for a batch of the width of the SIMD registers.
+
+    @ingroup SMatrixGroup
+*/
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+class SMatrixBatch {
+public:
+   typedef T value_type;
+
+   enum {
+      /// number of rows
+      kRows = D1,
+      /// number of columns
+      kCols = D2,
+      /// number of elements of a matrix
+      kSize = D1 * D2,
+      /// number of matrices
+      kBatch = N
+   };
+
+   /// default constructor: the elements are not initialized
+   SMatrixBatch() {}
+
+   /// set all the elements of all the matrices to value
+   explicit SMatrixBatch(T value)
+   {
+      for (unsigned int i = 0; i < kSize; ++i)
+         for (unsigned int k = 0; k < N; ++k)
+            fArray[i][k] = value;
+   }
+
+   /// element (i,j) of matrix k
+   T &operator()(unsigned int i, unsigned int j, unsigned int k) { return fArray[i * D2 + j][k]; }
+   const T &operator()(unsigned int i, unsigned int j, unsigned int k) const { return fArray[i * D2 + j][k]; }
+
+   /// the N contiguous values of element (i,j)
+   T *Element(unsigned int i, unsigned int j) { return fArray[i * D2 + j]; }
+   const T *Element(unsigned int i, unsigned int j) const { return fArray[i * D2 + j]; }
+
+   /// copy of matrix k
+   SMatrix<T, D1, D2> Get(unsigned int k) const
+   {
+      SMatrix<T, D1, D2> m(SMatrixNoInit{});
+      for (unsigned int i = 0; i < kSize; ++i)
+         m.Array()[i] = fArray[i][k];
+      return m;
+   }
+
+   /// set matrix k from m, in any representation
+   template <class R>
+   void Set(unsigned int k, const SMatrix<T, D1, D2, R> &m)
+   {
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j < D2; ++j)
+            fArray[i * D2 + j][k] = m(i, j);
+   }
+
+   SMatrixBatch &operator+=(const SMatrixBatch &rhs)
+   {
+      for (unsigned int i = 0; i < kSize; ++i)
+         for (unsigned int k = 0; k < N; ++k)
+            fArray[i][k] += rhs.fArray[i][k];
+      return *this;
+   }
+
+   SMatrixBatch &operator-=(const SMatrixBatch &rhs)
+   {
+      for (unsigned int i = 0; i < kSize; ++i)
+         for (unsigned int k = 0; k < N; ++k)
+            fArray[i][k] -= rhs.fArray[i][k];
+      return *this;
+   }
+
+   SMatrixBatch &operator*=(T factor)
+   {
+      for (unsigned int i = 0; i < kSize; ++i)
+         for (unsigned int k = 0; k < N; ++k)
+            fArray[i][k] *= factor;
+      return *this;
+   }
+
+   /**
+      Invert the symmetric positive definite matrices using the Cholesky decomposition, with the algorithm of
+      CholeskyDecomp. The matrices which are not positive definite are left unchanged; if ok is given, ok[k]
+      tells whether matrix k was inverted.
+      Returns true if all the matrices were inverted.
+   */
+   bool InvertChol(bool *ok = nullptr);
+
+private:
+   T fArray[kSize][N];
+};
+
+/// c = a * b for each of the N matrices
+template <class T, unsigned int D1, unsigned int D, unsigned int D2, unsigned int N>
+void Multiply(const SMatrixBatch<T, D1, D, N> &a, const SMatrixBatch<T, D, D2, N> &b, SMatrixBatch<T, D1, D2, N> &c)
+{
+   for (unsigned int i = 0; i < D1; ++i) {
+      for (unsigned int j = 0; j < D2; ++j) {
+         T *cij = c.Element(i, j);
+         for (unsigned int k = 0; k < N; ++k)
+            cij[k] = T(0);
+         for (unsigned int l = 0; l < D; ++l) {
+            const T *ail = a.Element(i, l);
+            const T *blj = b.Element(l, j);
+            for (unsigned int k = 0; k < N; ++k)
+               cij[k] += ail[k] * blj[k];
+         }
+      }
+   }
+}
+
+/// c = a^T for each of the N matrices
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+void Transpose(const SMatrixBatch<T, D1, D2, N> &a, SMatrixBatch<T, D2, D1, N> &c)
+{
+   for (unsigned int i = 0; i < D1; ++i) {
+      for (unsigned int j = 0; j < D2; ++j) {
+         const T *aij = a.Element(i, j);
+         T *cji = c.Element(j, i);
+         for (unsigned int k = 0; k < N; ++k)
+            cji[k] = aij[k];
+      }
+   }
+}
+
+/// c = a * s * a^T for each of the N matrices, with s symmetric; c is symmetric
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+void Similarity(const SMatrixBatch<T, D1, D2, N> &a, const SMatrixBatch<T, D2, D2, N> &s,
+                SMatrixBatch<T, D1, D1, N> &c)
+{
+   // as = a * s, one row at a time
+   T as[D2][N];
+   for (unsigned int i = 0; i < D1; ++i) {
+      for (unsigned int j = 0; j < D2; ++j) {
+         for (unsigned int k = 0; k < N; ++k)
+            as[j][k] = T(0);
+         for (unsigned int l = 0; l < D2; ++l) {
+            const T *ail = a.Element(i, l);
+            const T *slj = l >= j ? s.Element(l, j) : s.Element(j, l);
+            for (unsigned int k = 0; k < N; ++k)
+               as[j][k] += ail[k] * slj[k];
+         }
+      }
+      for (unsigned int j = 0; j <= i; ++j) {
+         T *cij = c.Element(i, j);
+         for (unsigned int k = 0; k < N; ++k)
+            cij[k] = T(0);
+         for (unsigned int l = 0; l < D2; ++l) {
+            const T *ajl = a.Element(j, l);
+            for (unsigned int k = 0; k < N; ++k)
+               cij[k] += as[l][k] * ajl[k];
+         }
+         if (j < i) {
+            T *cji = c.Element(j, i);
+            for (unsigned int k = 0; k < N; ++k)
+               cji[k] = cij[k];
+         }
+      }
+   }
+}
+
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+bool SMatrixBatch<T, D1, D2, N>::InvertChol(bool *ok)
+{
+   STATIC_CHECK(D1 == D2, SMatrixBatch_not_square);
+   constexpr unsigned int D = D1;
+   // the lower triangular matrix L in packed storage, L(i,j) at (i * (i+1)) / 2 + j, with the diagonal
+   // elements inverted, for each matrix
+   T l[(D * (D + 1)) / 2][N];
+   bool posDef[N];
+   for (unsigned int k = 0; k < N; ++k)
+      posDef[k] = true;
+
+   // decomposition M = L L^T; the matrices which are not positive definite continue with a diagonal element
+   // of 1, to keep the loops over the matrices free of branches
+   T tmp[N];
+   T tmpdiag[N];
+   for (unsigned int i = 0; i < D; ++i) {
+      T(*base1)[N] = &l[(i * (i + 1)) / 2];
+      for (unsigned int k = 0; k < N; ++k)
+         tmpdiag[k] = T(0);
+      for (unsigned int j = 0; j < i; ++j) {
+         T(*base2)[N] = &l[(j * (j + 1)) / 2];
+         const T *mij = Element(i, j);
+         for (unsigned int k = 0; k < N; ++k)
+            tmp[k] = mij[k];
+         for (unsigned int m = j; m--;)
+            for (unsigned int k = 0; k < N; ++k)
+               tmp[k] -= base1[m][k] * base2[m][k];
+         for (unsigned int k = 0; k < N; ++k) {
+            base1[j][k] = tmp[k] * base2[j][k];
+            tmpdiag[k] += base1[j][k] * base1[j][k];
+         }
+      }
+      const T *mii = Element(i, i);
+      for (unsigned int k = 0; k < N; ++k) {
+         T diag = mii[k] - tmpdiag[k];
+         posDef[k] = posDef[k] && diag > T(0);
+         base1[i][k] = std::sqrt(T(1) / (posDef[k] ? diag : T(1)));
+      }
+   }
+
+   // invert the off-diagonal part of L
+   for (unsigned int i = 1; i < D; ++i) {
+      T(*base1)[N] = &l[(i * (i + 1)) / 2];
+      for (unsigned int j = 0; j < i; ++j) {
+         for (unsigned int k = 0; k < N; ++k)
+            tmp[k] = T(0);
+         const T(*base2)[N] = &l[(i * (i - 1)) / 2];
+         for (unsigned int m = i; m-- > j; base2 -= m)
+            for (unsigned int k = 0; k < N; ++k)
+               tmp[k] -= base1[m][k] * base2[j][k];
+         for (unsigned int k = 0; k < N; ++k)
+            base1[j][k] = tmp[k] * base1[i][k];
+      }
+   }
+
+   // M^(-1) = Li^T Li, written only to the positive definite matrices
+   for (unsigned int i = D; i--;) {
+      for (unsigned int j = i + 1; j--;) {
+         for (unsigned int k = 0; k < N; ++k)
+            tmp[k] = T(0);
+         const T(*base1)[N] = &l[(D * (D - 1)) / 2];
+         for (unsigned int m = D; m-- > i; base1 -= m)
+            for (unsigned int k = 0; k < N; ++k)
+               tmp[k] += base1[i][k] * base1[j][k];
+         T *mij = Element(i, j);
+         T *mji = Element(j, i);
+         for (unsigned int k = 0; k < N; ++k) {
+            mij[k] = posDef[k] ? tmp[k] : mij[k];
+            mji[k] = posDef[k] ? tmp[k] : mji[k];
+         }
+      }
+   }
+
+   bool allOk = true;
+   for (unsigned int k = 0; k < N; ++k) {
+      allOk = allOk && posDef[k];
+      if (ok)
+         ok[k] = posDef[k];
+   }
+   return allOk;
+}
+
+} // namespace Math
+
+} // namespace ROOT
+
+#endif
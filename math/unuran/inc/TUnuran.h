@@ -211,6 +211,23 @@ public:
    */
    int SampleDiscr();
 
+   /**
+      Sample n values of a 1D distribution and write them to x.
+      This avoids one call per value through the TUnuran interface when many values are needed.
+   */
+   void Sample(double * x, unsigned int n);
+
+   /**
+      Sample n vectors of a multidimensional distribution and write them one after the other to x,
+      which must hold n times GetDimension() values. Return false if the generator is not initialized.
+   */
+   bool SampleMulti(double * x, unsigned int n);
+
+   /**
+      Sample n values of a discrete distribution and write them to x.
+   */
+   void SampleDiscr(int * x, unsigned int n);
+
    /**
       Set the random engine.
       Must be called before init to have effect
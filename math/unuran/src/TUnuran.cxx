@@ -441,6 +441,32 @@ bool TUnuran::SampleMulti(double * x)
    return true;
 }
 
+void TUnuran::Sample(double * x, unsigned int n)
+{
+   // sample n values of a one-dimensional distribution
+   assert(fGen != nullptr);
+   for (unsigned int i = 0; i < n; ++i)
+      x[i] = unur_sample_cont(fGen);
+}
+
+bool TUnuran::SampleMulti(double * x, unsigned int n)
+{
+   // sample n vectors of a multidimensional distribution
+   if (fGen == nullptr) return false;
+   const int dim = unur_get_dimension(fGen);
+   for (unsigned int i = 0; i < n; ++i)
+      unur_sample_vec(fGen, x + i * dim);
+   return true;
+}
+
+void TUnuran::SampleDiscr(int * x, unsigned int n)
+{
+   // sample n values of a discrete distribution
+   assert(fGen != nullptr);
+   for (unsigned int i = 0; i < n; ++i)
+      x[i] = unur_sample_discr(fGen);
+}
+
 void TUnuran::SetSeed(unsigned int seed) {
    return fRng->SetSeed(seed);
 }
@@ -37,6 +37,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef> // std::max_align_t
 #include <cstring>
 #include <limits> // for numeric_limits
 #include <memory> // uninitialized_value_construct
@@ -146,7 +147,8 @@ protected:
    /// Always >= 0.
    // Type is signed only for consistency with fCapacity.
    Size_T fSize = 0;
-   /// Always >= -1. fCapacity == -1 indicates the RVec is in "memory adoption" mode.
+   /// fCapacity == -1 indicates the RVec is in "memory adoption" mode.
+   /// fCapacity < -1 indicates a buffer allocated in an RVecArena, with capacity -(fCapacity + 2).
    Size_T fCapacity;
 
    /// The maximum value of the Size_T used.
@@ -170,9 +172,15 @@ protected:
    /// If false, the RVec is in "memory adoption" mode, i.e. it is acting as a view on a memory buffer it does not own.
    bool Owns() const { return fCapacity != -1; }
 
+   /// If true, the buffer was allocated in an RVecArena and must not be freed.
+   bool InArena() const { return fCapacity < -1; }
+
 public:
    size_t size() const { return fSize; }
-   size_t capacity() const noexcept { return Owns() ? fCapacity : fSize; }
+   size_t capacity() const noexcept
+   {
+      return fCapacity >= 0 ? fCapacity : (Owns() ? static_cast<size_t>(-(fCapacity + 2)) : fSize);
+   }
 
    R__RVEC_NODISCARD bool empty() const { return !fSize; }
 
@@ -549,6 +557,92 @@ void ResetView(RVec<T> &v, T* addr, std::size_t sz)
    v.fSize = sz;
 }
 
+/// Arrays shorter than this are reduced inline rather than with the kernels below.
+constexpr std::size_t kMinKernelSize = 16;
+
+/// \name Reduction kernels
+/// Reductions of float and double arrays used by Sum, Max, Min, ArgMax and ArgMin.
+/// The implementation is selected at the first call for the instruction set of
+/// the CPU (AVX-512, AVX2 or the baseline one, e.g. SSE2 or NEON), see RVec.cxx.
+/// The sums add the elements in several independent partial sums, in a different
+/// order than a sequential loop. ArgMax and ArgMin return the first occurrence,
+/// like std::max_element and std::min_element, also in presence of NaNs.
+///@{
+float SumKernel(const float *v, std::size_t n);
+double SumKernel(const double *v, std::size_t n);
+std::size_t ArgMaxKernel(const float *v, std::size_t n);
+std::size_t ArgMaxKernel(const double *v, std::size_t n);
+std::size_t ArgMinKernel(const float *v, std::size_t n);
+std::size_t ArgMinKernel(const double *v, std::size_t n);
+///@}
+
+/// \name Distance kernels
+/// Write \f$\Delta R^2\f$ between the point (eta, phi) and the n points (eta2[j], phi2[j]) to out[j], used by
+/// DeltaR2AllPairs and MatchDeltaR. The angle difference is brought into \f$[-c, c)\f$ without branches.
+/// The implementation is selected at the first call like the one of the reduction kernels.
+///@{
+void DeltaR2RowKernel(float eta, float phi, const float *eta2, const float *phi2, std::size_t n, float c, float *out);
+void DeltaR2RowKernel(double eta, double phi, const double *eta2, const double *phi2, std::size_t n, double c,
+                      double *out);
+///@}
+
+template <typename T>
+struct IsReductionKernelType : std::integral_constant<bool, std::is_same<T, float>::value || std::is_same<T, double>::value> {
+};
+
+/// \brief A bump allocator for the buffers of short-lived RVecs.
+///
+/// While an RVecArenaScope is active on a thread, the RVecs of trivially copyable types that grow beyond their
+/// inline storage on that thread allocate their buffer in the arena instead of on the heap. The buffers are never
+/// freed individually: Reset() makes the whole memory of the arena available again, without releasing it.
+/// RVecs with a buffer in the arena must therefore not be used after the next call to Reset(), nor after the
+/// destruction of the arena (destroying them is fine).
+/// Buffers larger than a quarter of the chunk size are allocated on the heap as usual.
+///
+/// RDataFrame uses one arena per processing slot, reset after each entry, see
+/// ROOT::RDF::Experimental::EnableRVecArenas.
+class RVecArena {
+   std::size_t fChunkSize;
+   std::vector<std::unique_ptr<char[]>> fChunks;
+   std::size_t fCurrentChunk = 0; ///< Index of the chunk in which the next buffer is allocated
+   std::size_t fOffset = 0;       ///< Offset of the first free byte in the current chunk
+
+public:
+   /// The alignment of the buffers, the same guaranteed by malloc for all fundamental types.
+   static constexpr std::size_t kAlignment = alignof(std::max_align_t);
+
+   explicit RVecArena(std::size_t chunkSize = 1024 * 1024) : fChunkSize(chunkSize) {}
+   RVecArena(const RVecArena &) = delete;
+   RVecArena &operator=(const RVecArena &) = delete;
+
+   /// Return a buffer of the given size, or nullptr if it is too large for the arena.
+   void *Allocate(std::size_t nBytes);
+   /// Make all the memory of the arena available again. Previously allocated buffers become invalid.
+   void Reset()
+   {
+      fCurrentChunk = 0;
+      fOffset = 0;
+   }
+   std::size_t GetChunkSize() const { return fChunkSize; }
+   /// The number of chunks allocated so far, they are kept by Reset().
+   std::size_t GetNChunks() const { return fChunks.size(); }
+};
+
+/// \brief Make the RVecs growing on this thread allocate their buffers in the given arena for the lifetime of the
+/// scope. The previous arena, if any, is restored by the destructor. A null arena disables arena allocations.
+class RVecArenaScope {
+   RVecArena *fPrevArena;
+
+public:
+   explicit RVecArenaScope(RVecArena *arena);
+   ~RVecArenaScope();
+   RVecArenaScope(const RVecArenaScope &) = delete;
+   RVecArenaScope &operator=(const RVecArenaScope &) = delete;
+};
+
+/// The arena the RVecs growing on this thread allocate their buffers in, nullptr if none.
+RVecArena *GetCurrentRVecArena();
+
 } // namespace VecOps
 } // namespace Internal
 
@@ -578,7 +672,7 @@ public:
    {
       // Subclass has already destructed this vector's elements.
       // If this wasn't grown from the inline copy, deallocate the old space.
-      if (!this->isSmall() && this->Owns())
+      if (!this->isSmall() && this->Owns() && !this->InArena())
          free(this->begin());
    }
 
@@ -1055,7 +1149,7 @@ RVecImpl<T> &RVecImpl<T>::operator=(RVecImpl<T> &&RHS)
    if (!RHS.isSmall()) {
       if (this->Owns()) {
          this->destroy_range(this->begin(), this->end());
-         if (!this->isSmall())
+         if (!this->isSmall() && !this->InArena())
             free(this->begin());
       }
       this->fBeginX = RHS.fBeginX;
@@ -1265,6 +1359,19 @@ public:
 
       RVecN ret;
       ret.reserve(n_true);
+      if constexpr (std::is_trivially_copyable<T>::value) {
+         // branchless selection: every element is copied to the next free slot, which is only
+         // taken when its condition is true. The loop stops at the last selected element, so
+         // that no element is written past the capacity.
+         T *out = ret.data();
+         size_type j = 0u;
+         for (size_type i = 0u; j < n_true; ++i) {
+            out[j] = this->operator[](i);
+            j += (conds[i] != 0);
+         }
+         ret.set_size(n_true);
+         return ret;
+      }
       size_type j = 0u;
       for (size_type i = 0u; i < n; ++i) {
          if (conds[i]) {
@@ -1916,6 +2023,10 @@ auto Dot(const RVec<T> &v0, const RVec<V> &v1) -> decltype(v0[0] * v1[0])
 template <typename T>
 T Sum(const RVec<T> &v, const T zero = T(0))
 {
+   if constexpr (Internal::VecOps::IsReductionKernelType<T>::value) {
+      if (v.size() >= Internal::VecOps::kMinKernelSize)
+         return zero + Internal::VecOps::SumKernel(v.data(), v.size());
+   }
    return std::accumulate(v.begin(), v.end(), zero);
 }
 
@@ -1995,6 +2106,10 @@ R Mean(const RVec<T> &v, const R zero)
 template <typename T>
 T Max(const RVec<T> &v)
 {
+   if constexpr (Internal::VecOps::IsReductionKernelType<T>::value) {
+      if (v.size() >= Internal::VecOps::kMinKernelSize)
+         return v[Internal::VecOps::ArgMaxKernel(v.data(), v.size())];
+   }
    return *std::max_element(v.begin(), v.end());
 }
 
@@ -2011,6 +2126,10 @@ T Max(const RVec<T> &v)
 template <typename T>
 T Min(const RVec<T> &v)
 {
+   if constexpr (Internal::VecOps::IsReductionKernelType<T>::value) {
+      if (v.size() >= Internal::VecOps::kMinKernelSize)
+         return v[Internal::VecOps::ArgMinKernel(v.data(), v.size())];
+   }
    return *std::min_element(v.begin(), v.end());
 }
 
@@ -2029,6 +2148,10 @@ T Min(const RVec<T> &v)
 template <typename T>
 std::size_t ArgMax(const RVec<T> &v)
 {
+   if constexpr (Internal::VecOps::IsReductionKernelType<T>::value) {
+      if (v.size() >= Internal::VecOps::kMinKernelSize)
+         return Internal::VecOps::ArgMaxKernel(v.data(), v.size());
+   }
    return std::distance(v.begin(), std::max_element(v.begin(), v.end()));
 }
 
@@ -2047,6 +2170,10 @@ std::size_t ArgMax(const RVec<T> &v)
 template <typename T>
 std::size_t ArgMin(const RVec<T> &v)
 {
+   if constexpr (Internal::VecOps::IsReductionKernelType<T>::value) {
+      if (v.size() >= Internal::VecOps::kMinKernelSize)
+         return Internal::VecOps::ArgMinKernel(v.data(), v.size());
+   }
    return std::distance(v.begin(), std::min_element(v.begin(), v.end()));
 }
 
@@ -2951,8 +3078,18 @@ RVec<T> DeltaPhi(T v1, const RVec<T>& v2, const T c = M_PI)
 template <typename T>
 RVec<T> DeltaR2(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, const RVec<T>& phi2, const T c = M_PI)
 {
-   const auto dphi = DeltaPhi(phi1, phi2, c);
-   return (eta1 - eta2) * (eta1 - eta2) + dphi * dphi;
+   using size_type = typename RVec<T>::size_type;
+   const size_type size = eta1.size();
+   if (eta2.size() != size || phi1.size() != size || phi2.size() != size)
+      throw std::runtime_error("Cannot call DeltaR2 on vectors of different sizes.");
+   // single loop over the elements instead of one per operation on the vectors
+   RVec<T> r(size);
+   for (size_type i = 0; i < size; i++) {
+      const T deta = eta1[i] - eta2[i];
+      const T dphi = DeltaPhi(phi1[i], phi2[i], c);
+      r[i] = deta * deta + dphi * dphi;
+   }
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -2965,7 +3102,10 @@ RVec<T> DeltaR2(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, c
 template <typename T>
 RVec<T> DeltaR(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, const RVec<T>& phi2, const T c = M_PI)
 {
-   return sqrt(DeltaR2(eta1, eta2, phi1, phi2, c));
+   auto r = DeltaR2(eta1, eta2, phi1, phi2, c);
+   for (auto &x : r)
+      x = std::sqrt(x);
+   return r;
 }
 
 /// Return the distance on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R\f$) from
@@ -2982,6 +3122,110 @@ T DeltaR(T eta1, T eta2, T phi1, T phi2, const T c = M_PI)
    return std::sqrt((eta1 - eta2) * (eta1 - eta2) + dphi * dphi);
 }
 
+/// Return the squares of the distances on the \f$\eta\f$-\f$\phi\f$ plane (\f$\Delta R^2\f$) between all the
+/// pairs of elements of two collections, without building the indices of the combinations.
+///
+/// The collections (eta1, phi1) and (eta2, phi2) can have different sizes n1 and n2. The result has n1 * n2
+/// elements: the distance between the i-th element of the first collection and the j-th element of the second one
+/// is at position i * n2 + j, i.e. in the order of Combinations(eta1, eta2). The distances of float and double
+/// collections are computed with vectorized kernels. The angle \f$\phi\f$ can be set to radian or degrees using
+/// the optional argument c, see the documentation of the DeltaPhi helper.
+///
+/// Example code, at the ROOT prompt:
+/// ~~~{.cpp}
+/// using namespace ROOT::VecOps;
+/// RVecF eta1{0.f, 1.f}, phi1{0.f, 0.f}, eta2{0.f, 0.5f, 2.f}, phi2{0.f, 0.f, 0.f};
+/// DeltaR2AllPairs(eta1, eta2, phi1, phi2)
+/// // (ROOT::VecOps::RVec<float>) { 0.00000f, 0.250000f, 4.00000f, 1.00000f, 0.250000f, 1.00000f }
+/// ~~~
+template <typename T>
+RVec<T> DeltaR2AllPairs(const RVec<T> &eta1, const RVec<T> &eta2, const RVec<T> &phi1, const RVec<T> &phi2,
+                        const T c = M_PI)
+{
+   static_assert(std::is_floating_point<T>::value, "DeltaR2AllPairs must be called with floating point values.");
+   using size_type = typename RVec<T>::size_type;
+   const size_type n1 = eta1.size();
+   const size_type n2 = eta2.size();
+   if (phi1.size() != n1 || phi2.size() != n2)
+      throw std::runtime_error("Cannot call DeltaR2AllPairs on eta and phi vectors of different sizes.");
+   RVec<T> r(n1 * n2);
+   for (size_type i = 0; i < n1; i++) {
+      if constexpr (Internal::VecOps::IsReductionKernelType<T>::value) {
+         Internal::VecOps::DeltaR2RowKernel(eta1[i], phi1[i], eta2.data(), phi2.data(), n2, c, r.data() + i * n2);
+      } else {
+         for (size_type j = 0; j < n2; j++) {
+            const T deta = eta1[i] - eta2[j];
+            const T dphi = DeltaPhi(phi1[i], phi2[j], c);
+            r[i * n2 + j] = deta * deta + dphi * dphi;
+         }
+      }
+   }
+   return r;
+}
+
+/// Return, for every element of the first collection, the index of the closest element of the second collection
+/// on the \f$\eta\f$-\f$\phi\f$ plane, or -1 if no element is closer than maxDeltaR.
+///
+/// Several elements of the first collection can be matched to the same element of the second one. Among elements
+/// at the same distance, the one with the lowest index is chosen. The second collection is sorted by \f$\eta\f$
+/// once, so that only its elements with \f$|\Delta\eta| < \f$ maxDeltaR are compared to each element of the
+/// first collection: the cost is \f$O((n_1 + n_2) \log n_2)\f$ plus the number of candidates, instead of
+/// \f$n_1 n_2\f$ for all the combinations. The collections must not contain NaNs. The angle \f$\phi\f$ can be
+/// set to radian or degrees using the optional argument c, see the documentation of the DeltaPhi helper.
+///
+/// Example code, at the ROOT prompt:
+/// ~~~{.cpp}
+/// using namespace ROOT::VecOps;
+/// RVecF jetEta{0.f, 1.f, 3.f}, jetPhi{0.f, 0.f, 0.f}, muEta{1.1f, 0.05f}, muPhi{0.f, 0.f};
+/// MatchDeltaR(jetEta, muEta, jetPhi, muPhi, 0.4f)
+/// // (ROOT::VecOps::RVec<int>) { 1, 0, -1 }
+/// ~~~
+template <typename T>
+RVec<int> MatchDeltaR(const RVec<T> &eta1, const RVec<T> &eta2, const RVec<T> &phi1, const RVec<T> &phi2,
+                      const T maxDeltaR, const T c = M_PI)
+{
+   static_assert(std::is_floating_point<T>::value, "MatchDeltaR must be called with floating point values.");
+   using size_type = typename RVec<T>::size_type;
+   const size_type n1 = eta1.size();
+   const size_type n2 = eta2.size();
+   if (phi1.size() != n1 || phi2.size() != n2)
+      throw std::runtime_error("Cannot call MatchDeltaR on eta and phi vectors of different sizes.");
+
+   const auto order = Argsort(eta2);
+   const auto sortedEta = Take(eta2, order);
+   const auto sortedPhi = Take(phi2, order);
+   const T maxDeltaR2 = maxDeltaR * maxDeltaR;
+   RVec<T> dr2;
+   RVec<int> r(n1, -1);
+   for (size_type i = 0; i < n1; i++) {
+      const auto first = std::lower_bound(sortedEta.begin(), sortedEta.end(), eta1[i] - maxDeltaR) - sortedEta.begin();
+      const auto last = std::upper_bound(sortedEta.begin(), sortedEta.end(), eta1[i] + maxDeltaR) - sortedEta.begin();
+      if (first >= last)
+         continue;
+      const size_type nCandidates = last - first;
+      dr2.resize(nCandidates);
+      if constexpr (Internal::VecOps::IsReductionKernelType<T>::value) {
+         Internal::VecOps::DeltaR2RowKernel(eta1[i], phi1[i], sortedEta.data() + first, sortedPhi.data() + first,
+                                            nCandidates, c, dr2.data());
+      } else {
+         for (size_type k = 0; k < nCandidates; k++) {
+            const T deta = eta1[i] - sortedEta[first + k];
+            const T dphi = DeltaPhi(phi1[i], sortedPhi[first + k], c);
+            dr2[k] = deta * deta + dphi * dphi;
+         }
+      }
+      T best = maxDeltaR2;
+      for (size_type k = 0; k < nCandidates; k++) {
+         const int index = order[first + k];
+         if (dr2[k] < best || (dr2[k] == best && r[i] >= 0 && index < r[i])) {
+            best = dr2[k];
+            r[i] = index;
+         }
+      }
+   }
+   return r;
+}
+
 /// Return the invariant mass of two particles given the collections of the quantities
 /// transverse momentum (pt), rapidity (eta), azimuth (phi) and mass.
 ///
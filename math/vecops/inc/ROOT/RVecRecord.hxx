@@ -0,0 +1,204 @@
+// See /math/vecops/ARCHITECTURE.md for more information.
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVECRECORD
+#define ROOT_RVECRECORD
+
+#include "ROOT/RVec.hxx"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ROOT {
+namespace VecOps {
+
+// clang-format off
+/**
+\class ROOT::VecOps::RVecRecord
+\brief A collection of objects stored as a structure of arrays, one RVec per data member
+\tparam T The types of the data members
+
+An RVecRecord groups RVecs of the same size, e.g. the pt, eta, phi and mass of the jets of an event, such that they
+can be filtered, sorted and combined at once: the selection or permutation of the objects is computed once and
+applied to all the members. The members are accessed by index with Get(); an enum gives them names:
+
+~~~{.cpp}
+using namespace ROOT::VecOps;
+enum { kPt, kEta, kPhi, kMass };
+RVecRecord jets(pt, eta, phi, mass);     // copies the four RVec<float>
+auto central = jets[abs(jets.Get<kEta>()) < 2.4];
+auto sorted = central.SortBy<kPt>([](float x, float y) { return x > y; });
+auto leadingPt = sorted.Get<kPt>()[0];
+~~~
+
+RecordView() makes a record that views the RVecs without copying them, e.g. the RVec columns that RDataFrame
+reads from TTree or RNTuple collections. The operations on a record always return new records that own their data.
+*/
+// clang-format on
+template <typename... T>
+class RVecRecord {
+   static_assert(sizeof...(T) > 0, "An RVecRecord needs at least one data member.");
+
+public:
+   using size_type = std::size_t;
+   using Indices_t = RVec<size_type>;
+   template <std::size_t I>
+   using member_type = std::tuple_element_t<I, std::tuple<T...>>;
+
+private:
+   std::tuple<RVec<T>...> fMembers;
+
+   template <std::size_t... I>
+   void CheckSizes(std::index_sequence<I...>) const
+   {
+      const size_type sizes[] = {std::get<I>(fMembers).size()...};
+      for (auto s : sizes) {
+         if (s != sizes[0])
+            throw std::runtime_error("Cannot make an RVecRecord of RVecs of different sizes (" +
+                                     std::to_string(sizes[0]) + " and " + std::to_string(s) + ").");
+      }
+   }
+
+   template <std::size_t... I>
+   RVecRecord TakeImpl(const Indices_t &indices, std::index_sequence<I...>) const
+   {
+      return RVecRecord(ROOT::VecOps::Take(std::get<I>(fMembers), indices)...);
+   }
+
+   template <typename V, std::size_t... I>
+   RVecRecord FilterImpl(const RVec<V> &mask, std::index_sequence<I...>) const
+   {
+      return RVecRecord(std::get<I>(fMembers)[mask]...);
+   }
+
+   template <std::size_t... I>
+   std::tuple<const T &...> ObjectImpl(size_type i, std::index_sequence<I...>) const
+   {
+      return std::tuple<const T &...>(std::get<I>(fMembers)[i]...);
+   }
+
+public:
+   RVecRecord() = default;
+
+   /// Construct a record from its data members, which must have the same size. Throws otherwise.
+   explicit RVecRecord(RVec<T>... members) : fMembers(std::move(members)...)
+   {
+      CheckSizes(std::index_sequence_for<T...>{});
+   }
+
+   size_type size() const { return std::get<0>(fMembers).size(); }
+   R__RVEC_NODISCARD bool empty() const { return size() == 0; }
+
+   /// The values of the I-th data member of all the objects
+   template <std::size_t I>
+   const RVec<member_type<I>> &Get() const
+   {
+      return std::get<I>(fMembers);
+   }
+
+   /// The data members of the i-th object
+   std::tuple<const T &...> operator[](size_type i) const { return ObjectImpl(i, std::index_sequence_for<T...>{}); }
+
+   /// The objects for which the mask is true, e.g. `jets[jets.Get<0>() > 30]`.
+   template <typename V, typename = std::enable_if<std::is_convertible<V, bool>::value>>
+   RVecRecord operator[](const RVec<V> &mask) const
+   {
+      if (mask.size() != size())
+         throw std::runtime_error("Cannot filter an RVecRecord of size " + std::to_string(size()) +
+                                  " with a mask of size " + std::to_string(mask.size()) + ".");
+      return FilterImpl(mask, std::index_sequence_for<T...>{});
+   }
+
+   /// The objects at the given indices, in that order, as with VecOps::Take.
+   RVecRecord Take(const Indices_t &indices) const { return TakeImpl(indices, std::index_sequence_for<T...>{}); }
+
+   /// The objects sorted in ascending order of their I-th data member.
+   template <std::size_t I>
+   RVecRecord SortBy() const
+   {
+      return Take(Argsort(Get<I>()));
+   }
+
+   /// The objects sorted by their I-th data member according to the comparison function.
+   template <std::size_t I, typename Compare>
+   RVecRecord SortBy(Compare &&c) const
+   {
+      return Take(Argsort(Get<I>(), std::forward<Compare>(c)));
+   }
+};
+
+/// Return a record that views the given RVecs, without copying them. The RVecs must outlive the record and have
+/// the same size.
+///
+/// ~~~{.cpp}
+/// df.Define("goodJet_pt", [](const RVecF &pt, const RVecF &eta) {
+///      auto jets = RecordView(pt, eta);
+///      return jets[abs(jets.Get<1>()) < 2.4].SortBy<0>().Get<0>();
+///   }, {"Jet_pt", "Jet_eta"});
+/// ~~~
+template <typename... T>
+RVecRecord<T...> RecordView(const RVec<T> &...members)
+{
+   return RVecRecord<T...>(RVec<T>(const_cast<T *>(members.data()), members.size())...);
+}
+
+/// Return the objects of a record at the given indices
+template <typename... T>
+RVecRecord<T...> Take(const RVecRecord<T...> &r, const typename RVecRecord<T...>::Indices_t &i)
+{
+   return r.Take(i);
+}
+
+/// Return the objects of a record in reverse order
+template <typename... T>
+RVecRecord<T...> Reverse(const RVecRecord<T...> &r)
+{
+   typename RVecRecord<T...>::Indices_t i(r.size());
+   for (std::size_t k = 0; k < i.size(); ++k)
+      i[k] = i.size() - 1 - k;
+   return r.Take(i);
+}
+
+/// Return all the unique combinations of n objects of a record, as n records: the k-th one holds the k-th object
+/// of every combination, in the order of Combinations(v, n).
+///
+/// ~~~{.cpp}
+/// auto pairs = Combinations(jets, 2);
+/// auto mjj = InvariantMasses(pairs[0].Get<0>(), pairs[0].Get<1>(), pairs[0].Get<2>(), pairs[0].Get<3>(),
+///                            pairs[1].Get<0>(), pairs[1].Get<1>(), pairs[1].Get<2>(), pairs[1].Get<3>());
+/// ~~~
+template <typename... T>
+RVec<RVecRecord<T...>> Combinations(const RVecRecord<T...> &r, std::size_t n)
+{
+   const auto indices = Combinations(r.template Get<0>(), n);
+   RVec<RVecRecord<T...>> c;
+   c.reserve(n);
+   for (const auto &i : indices)
+      c.emplace_back(r.Take(i));
+   return c;
+}
+
+/// Return all the combinations of one object of each record, as a pair of records of the first and second objects
+/// of every combination, in the order of Combinations(v1, v2).
+template <typename... T, typename... U>
+std::pair<RVecRecord<T...>, RVecRecord<U...>> Combinations(const RVecRecord<T...> &r1, const RVecRecord<U...> &r2)
+{
+   const auto indices = Combinations(r1.size(), r2.size());
+   return {r1.Take(indices[0]), r2.Take(indices[1])};
+}
+
+} // namespace VecOps
+} // namespace ROOT
+
+#endif
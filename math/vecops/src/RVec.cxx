@@ -47,6 +47,43 @@ void ROOT::Internal::VecOps::SmallVectorBase::report_at_maximum_capacity()
    throw std::length_error(Reason);
 }
 
+namespace {
+thread_local ROOT::Internal::VecOps::RVecArena *gCurrentRVecArena = nullptr;
+}
+
+void *ROOT::Internal::VecOps::RVecArena::Allocate(std::size_t nBytes)
+{
+   nBytes = (nBytes + kAlignment - 1) / kAlignment * kAlignment;
+   if (nBytes > fChunkSize / 4)
+      return nullptr;
+   if (fCurrentChunk == fChunks.size() || fOffset + nBytes > fChunkSize) {
+      // move to the next chunk, allocating it if this is the first time the arena grows this much
+      if (fCurrentChunk < fChunks.size())
+         ++fCurrentChunk;
+      if (fCurrentChunk == fChunks.size())
+         fChunks.emplace_back(new char[fChunkSize]);
+      fOffset = 0;
+   }
+   void *buffer = fChunks[fCurrentChunk].get() + fOffset;
+   fOffset += nBytes;
+   return buffer;
+}
+
+ROOT::Internal::VecOps::RVecArenaScope::RVecArenaScope(RVecArena *arena) : fPrevArena(gCurrentRVecArena)
+{
+   gCurrentRVecArena = arena;
+}
+
+ROOT::Internal::VecOps::RVecArenaScope::~RVecArenaScope()
+{
+   gCurrentRVecArena = fPrevArena;
+}
+
+ROOT::Internal::VecOps::RVecArena *ROOT::Internal::VecOps::GetCurrentRVecArena()
+{
+   return gCurrentRVecArena;
+}
+
 // Note: Moving this function into the header may cause performance regression.
 void ROOT::Internal::VecOps::SmallVectorBase::grow_pod(void *FirstEl, size_t MinSize, size_t TSize)
 {
@@ -67,8 +104,20 @@ void ROOT::Internal::VecOps::SmallVectorBase::grow_pod(void *FirstEl, size_t Min
    size_t NewCapacity = 2 * capacity() + 1; // Always grow.
    NewCapacity = std::min(std::max(NewCapacity, MinSize), SizeTypeMax());
 
+   // Inside an RVecArenaScope, allocate in the arena. The old buffer is released if it was on the heap.
+   if (gCurrentRVecArena != nullptr) {
+      if (void *ArenaElts = gCurrentRVecArena->Allocate(NewCapacity * TSize)) {
+         memcpy(ArenaElts, this->fBeginX, size() * TSize);
+         if (fBeginX != FirstEl && this->Owns() && !this->InArena())
+            free(this->fBeginX);
+         this->fBeginX = ArenaElts;
+         this->fCapacity = -static_cast<Size_T>(NewCapacity) - 2;
+         return;
+      }
+   }
+
    void *NewElts;
-   if (fBeginX == FirstEl || !this->Owns()) {
+   if (fBeginX == FirstEl || !this->Owns() || this->InArena()) {
       NewElts = malloc(NewCapacity * TSize);
       R__ASSERT(NewElts != nullptr);
 
@@ -263,3 +312,296 @@ RVEC_DECLARE_VDT_UNARY_FUNCTION(double, fast_atan)
 } // namespace ROOT
 
 #endif // _VECOPS_USE_EXTERN_TEMPLATES
+
+////////////////////////////////////////////////////////////////////////////////
+// Reduction and distance kernels of float and double arrays.
+//
+// The reductions are written with several independent accumulators (lanes), which
+// the compiler maps onto the lanes of the vector registers. The same code is
+// compiled for the baseline instruction set and, on x86-64, for AVX2 and
+// AVX-512, and the implementation is selected once at runtime.
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#define R__RVEC_KERNELS_X86
+#endif
+
+#if defined(__GNUC__)
+// the kernels are inlined in the functions compiled for a given instruction set
+#define R__RVEC_KERNEL_INLINE inline __attribute__((always_inline))
+#else
+#define R__RVEC_KERNEL_INLINE inline
+#endif
+
+namespace {
+
+template <typename T>
+struct Lanes {
+   // two 512 bit registers, enough to hide the latency of the additions
+   static constexpr std::size_t value = 128 / sizeof(T);
+};
+
+template <typename T>
+R__RVEC_KERNEL_INLINE T SumImpl(const T *v, std::size_t n)
+{
+   constexpr std::size_t L = Lanes<T>::value;
+   T acc[L] = {};
+   std::size_t i = 0;
+   for (; i + L <= n; i += L)
+      for (std::size_t l = 0; l < L; ++l)
+         acc[l] += v[i + l];
+   T sum = 0;
+   for (std::size_t l = 0; l < L; ++l)
+      sum += acc[l];
+   for (; i < n; ++i)
+      sum += v[i];
+   return sum;
+}
+
+/// Index of the first maximum (Greater == true) or minimum of the array, as std::max_element
+/// or std::min_element. Each lane keeps its best value and the block of its first occurrence.
+template <bool Greater, typename T>
+R__RVEC_KERNEL_INLINE std::size_t ArgExtremumImpl(const T *v, std::size_t n)
+{
+   constexpr std::size_t L = Lanes<T>::value;
+   std::size_t i = 0;
+   if (n >= L) {
+      T best[L];
+      std::size_t block[L] = {};
+      bool nan = false;
+      for (std::size_t l = 0; l < L; ++l) {
+         best[l] = v[l];
+         nan |= (v[l] != v[l]);
+      }
+      for (i = L; i + L <= n; i += L) {
+         for (std::size_t l = 0; l < L; ++l) {
+            const T x = v[i + l];
+            const bool better = Greater ? (best[l] < x) : (x < best[l]);
+            best[l] = better ? x : best[l];
+            block[l] = better ? i : block[l];
+            nan |= (x != x);
+         }
+      }
+      // with NaNs the result depends on the order of the comparisons: use the sequential loop
+      if (!nan) {
+         std::size_t result = block[0];
+         T bestValue = best[0];
+         for (std::size_t l = 1; l < L; ++l) {
+            const std::size_t index = block[l] + l;
+            const bool better = Greater ? (bestValue < best[l]) : (best[l] < bestValue);
+            if (better || (best[l] == bestValue && index < result)) {
+               bestValue = best[l];
+               result = index;
+            }
+         }
+         for (; i < n; ++i) {
+            const bool better = Greater ? (bestValue < v[i]) : (v[i] < bestValue);
+            if (better) {
+               bestValue = v[i];
+               result = i;
+            }
+         }
+         return result;
+      }
+   }
+   return Greater ? std::distance(v, std::max_element(v, v + n)) : std::distance(v, std::min_element(v, v + n));
+}
+
+/// The n elements are processed in blocks of a fixed number of lanes: at -O2 the compiler only vectorizes loops
+/// whose trip count is a multiple of the vector width and that do not need runtime alias checks.
+template <typename T>
+R__RVEC_KERNEL_INLINE void DeltaR2BlockImpl(T eta, T phi, const T *__restrict eta2, const T *__restrict phi2,
+                                            std::size_t n, T twoC, T invTwoC, T *__restrict out)
+{
+   for (std::size_t j = 0; j < n; ++j) {
+      const T deta = eta2[j] - eta;
+      T dphi = phi2[j] - phi;
+      // subtract the closest multiple of 2c. The rounding goes through a conversion to int, as std::fmod and
+      // std::floor (with trapping math) are not vectorized.
+      const T x = dphi * invTwoC + T(0.5);
+      const int k = static_cast<int>(x);
+      dphi -= twoC * T(k - (x < T(k)));
+      out[j] = deta * deta + dphi * dphi;
+   }
+}
+
+template <typename T>
+R__RVEC_KERNEL_INLINE void DeltaR2RowImpl(T eta, T phi, const T *eta2, const T *phi2, std::size_t n, T c, T *out)
+{
+   constexpr std::size_t L = Lanes<T>::value;
+   const T twoC = 2 * c;
+   const T invTwoC = 1 / twoC;
+   std::size_t j = 0;
+   for (; j + L <= n; j += L)
+      DeltaR2BlockImpl(eta, phi, eta2 + j, phi2 + j, L, twoC, invTwoC, out + j);
+   DeltaR2BlockImpl(eta, phi, eta2 + j, phi2 + j, n - j, twoC, invTwoC, out + j);
+}
+
+template <typename T>
+using SumKernel_t = T (*)(const T *, std::size_t);
+template <typename T>
+using ArgKernel_t = std::size_t (*)(const T *, std::size_t);
+
+template <typename T>
+using DeltaR2RowKernel_t = void (*)(T, T, const T *, const T *, std::size_t, T, T *);
+
+template <typename T>
+T SumBaseline(const T *v, std::size_t n)
+{
+   return SumImpl(v, n);
+}
+
+template <bool Greater, typename T>
+std::size_t ArgExtremumBaseline(const T *v, std::size_t n)
+{
+   return ArgExtremumImpl<Greater>(v, n);
+}
+
+template <typename T>
+void DeltaR2RowBaseline(T eta, T phi, const T *eta2, const T *phi2, std::size_t n, T c, T *out)
+{
+   DeltaR2RowImpl(eta, phi, eta2, phi2, n, c, out);
+}
+
+#ifdef R__RVEC_KERNELS_X86
+template <typename T>
+__attribute__((target("avx2"))) T SumAVX2(const T *v, std::size_t n)
+{
+   return SumImpl(v, n);
+}
+
+template <typename T>
+__attribute__((target("avx512f"))) T SumAVX512(const T *v, std::size_t n)
+{
+   return SumImpl(v, n);
+}
+
+template <bool Greater, typename T>
+__attribute__((target("avx2"))) std::size_t ArgExtremumAVX2(const T *v, std::size_t n)
+{
+   return ArgExtremumImpl<Greater>(v, n);
+}
+
+template <bool Greater, typename T>
+__attribute__((target("avx512f"))) std::size_t ArgExtremumAVX512(const T *v, std::size_t n)
+{
+   return ArgExtremumImpl<Greater>(v, n);
+}
+
+template <typename T>
+__attribute__((target("avx2,fma"))) void
+DeltaR2RowAVX2(T eta, T phi, const T *eta2, const T *phi2, std::size_t n, T c, T *out)
+{
+   DeltaR2RowImpl(eta, phi, eta2, phi2, n, c, out);
+}
+
+template <typename T>
+__attribute__((target("avx512f"))) void
+DeltaR2RowAVX512(T eta, T phi, const T *eta2, const T *phi2, std::size_t n, T c, T *out)
+{
+   DeltaR2RowImpl(eta, phi, eta2, phi2, n, c, out);
+}
+#endif
+
+template <typename T>
+SumKernel_t<T> SelectSumKernel()
+{
+#ifdef R__RVEC_KERNELS_X86
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx512f"))
+      return &SumAVX512<T>;
+   if (__builtin_cpu_supports("avx2"))
+      return &SumAVX2<T>;
+#endif
+   return &SumBaseline<T>;
+}
+
+template <bool Greater, typename T>
+ArgKernel_t<T> SelectArgExtremumKernel()
+{
+#ifdef R__RVEC_KERNELS_X86
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx512f"))
+      return &ArgExtremumAVX512<Greater, T>;
+   if (__builtin_cpu_supports("avx2"))
+      return &ArgExtremumAVX2<Greater, T>;
+#endif
+   return &ArgExtremumBaseline<Greater, T>;
+}
+
+template <typename T>
+DeltaR2RowKernel_t<T> SelectDeltaR2RowKernel()
+{
+#ifdef R__RVEC_KERNELS_X86
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx512f"))
+      return &DeltaR2RowAVX512<T>;
+   if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      return &DeltaR2RowAVX2<T>;
+#endif
+   return &DeltaR2RowBaseline<T>;
+}
+
+template <typename T>
+T Sum(const T *v, std::size_t n)
+{
+   static const SumKernel_t<T> kernel = SelectSumKernel<T>();
+   return kernel(v, n);
+}
+
+template <bool Greater, typename T>
+std::size_t ArgExtremum(const T *v, std::size_t n)
+{
+   static const ArgKernel_t<T> kernel = SelectArgExtremumKernel<Greater, T>();
+   return kernel(v, n);
+}
+
+template <typename T>
+void DeltaR2Row(T eta, T phi, const T *eta2, const T *phi2, std::size_t n, T c, T *out)
+{
+   static const DeltaR2RowKernel_t<T> kernel = SelectDeltaR2RowKernel<T>();
+   kernel(eta, phi, eta2, phi2, n, c, out);
+}
+
+} // anonymous namespace
+
+float ROOT::Internal::VecOps::SumKernel(const float *v, std::size_t n)
+{
+   return Sum(v, n);
+}
+
+double ROOT::Internal::VecOps::SumKernel(const double *v, std::size_t n)
+{
+   return Sum(v, n);
+}
+
+std::size_t ROOT::Internal::VecOps::ArgMaxKernel(const float *v, std::size_t n)
+{
+   return ArgExtremum<true>(v, n);
+}
+
+std::size_t ROOT::Internal::VecOps::ArgMaxKernel(const double *v, std::size_t n)
+{
+   return ArgExtremum<true>(v, n);
+}
+
+std::size_t ROOT::Internal::VecOps::ArgMinKernel(const float *v, std::size_t n)
+{
+   return ArgExtremum<false>(v, n);
+}
+
+std::size_t ROOT::Internal::VecOps::ArgMinKernel(const double *v, std::size_t n)
+{
+   return ArgExtremum<false>(v, n);
+}
+
+void ROOT::Internal::VecOps::DeltaR2RowKernel(float eta, float phi, const float *eta2, const float *phi2,
+                                              std::size_t n, float c, float *out)
+{
+   DeltaR2Row(eta, phi, eta2, phi2, n, c, out);
+}
+
+void ROOT::Internal::VecOps::DeltaR2RowKernel(double eta, double phi, const double *eta2, const double *phi2,
+                                              std::size_t n, double c, double *out)
+{
+   DeltaR2Row(eta, phi, eta2, phi2, n, c, out);
+}
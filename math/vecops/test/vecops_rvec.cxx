@@ -3,6 +3,7 @@
 #include <Math/PtEtaPhiM4D.h>
 #include <Math/Vector4Dfwd.h>
 #include <ROOT/RVec.hxx>
+#include <ROOT/RVecRecord.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TFile.h>
 #include <TInterpreter.h>
@@ -321,6 +322,30 @@ TEST(VecOps, Filter)
    CheckEqual(vOdd, vOddRef, "Odd check");
 }
 
+TEST(VecOps, MaskedSelection)
+{
+   for (auto n : {0u, 1u, 7u, 1000u}) {
+      RVec<double> v(n);
+      RVec<std::string> s(n);
+      for (std::size_t i = 0; i < n; ++i) {
+         v[i] = (i * 7919) % 13;
+         s[i] = std::to_string(v[i]);
+      }
+      for (RVec<int> mask : {v > 6., v < 0., v >= 0.}) {
+         std::vector<double> ref;
+         std::vector<std::string> refStrings;
+         for (std::size_t i = 0; i < n; ++i) {
+            if (mask[i]) {
+               ref.push_back(v[i]);
+               refStrings.push_back(s[i]);
+            }
+         }
+         CheckEqual(v[mask], ref, "Trivially copyable type");
+         CheckEqual(s[mask], refStrings, "Non trivially copyable type");
+      }
+   }
+}
+
 template <typename T, typename V>
 std::string PrintRVec(RVec<T> v, V w)
 {
@@ -703,6 +728,36 @@ TEST(VecOps, SimpleStatOps)
    CheckEqual(lv_mean, lv_mean_ref);
 }
 
+// Sizes at which Sum, Max, Min, ArgMax and ArgMin of float and double vectors use the vectorized kernels
+template <typename T>
+void CheckLargeStatOps()
+{
+   for (std::size_t n : {16u, 31u, 32u, 33u, 100u, 1000u, 4097u}) {
+      RVec<T> v(n);
+      for (std::size_t i = 0; i < n; ++i)
+         v[i] = static_cast<T>((i * 7919) % 101) - 50; // integers, partial sums are exact
+      EXPECT_EQ(Sum(v), std::accumulate(v.begin(), v.end(), T(0)));
+      EXPECT_EQ(Sum(v, T(1.5)), std::accumulate(v.begin(), v.end(), T(1.5)));
+      EXPECT_EQ(Max(v), *std::max_element(v.begin(), v.end()));
+      EXPECT_EQ(Min(v), *std::min_element(v.begin(), v.end()));
+      // several occurrences of the extrema: the first one is returned
+      EXPECT_EQ(ArgMax(v), std::size_t(std::distance(v.begin(), std::max_element(v.begin(), v.end()))));
+      EXPECT_EQ(ArgMin(v), std::size_t(std::distance(v.begin(), std::min_element(v.begin(), v.end()))));
+
+      // same as the sequential comparisons in presence of NaNs
+      v[n / 2] = std::numeric_limits<T>::quiet_NaN();
+      EXPECT_EQ(ArgMax(v), std::size_t(std::distance(v.begin(), std::max_element(v.begin(), v.end()))));
+      v[0] = std::numeric_limits<T>::quiet_NaN();
+      EXPECT_EQ(ArgMin(v), 0u);
+   }
+}
+
+TEST(VecOps, LargeStatOps)
+{
+   CheckLargeStatOps<float>();
+   CheckLargeStatOps<double>();
+}
+
 // #11569
 TEST(VecOps, SumOfBools)
 {
@@ -1290,6 +1345,56 @@ TEST(VecOps, DeltaR)
    }
 }
 
+template <typename T>
+void CheckAllPairsAndMatching(std::size_t n1, std::size_t n2)
+{
+   // deterministic pseudo-random points, with some angles outside of [-pi, pi]
+   RVec<T> eta1(n1), phi1(n1), eta2(n2), phi2(n2);
+   for (std::size_t i = 0; i < n1; ++i) {
+      eta1[i] = std::sin(1.3 * i) * 2.5;
+      phi1[i] = std::cos(0.7 * i) * 4.;
+   }
+   for (std::size_t j = 0; j < n2; ++j) {
+      eta2[j] = std::sin(2.1 * j + 0.3) * 2.5;
+      phi2[j] = std::cos(1.9 * j + 0.4) * 3.;
+   }
+
+   const auto idx = Combinations(eta1, eta2);
+   const auto expected = DeltaR2(Take(eta1, idx[0]), Take(eta2, idx[1]), Take(phi1, idx[0]), Take(phi2, idx[1]));
+   const auto dr2 = DeltaR2AllPairs(eta1, eta2, phi1, phi2);
+   ASSERT_EQ(dr2.size(), n1 * n2);
+   for (std::size_t k = 0; k < dr2.size(); ++k)
+      EXPECT_NEAR(dr2[k], expected[k], 1e-4);
+
+   const T maxDeltaR = 0.5;
+   const auto match = MatchDeltaR(eta1, eta2, phi1, phi2, maxDeltaR);
+   ASSERT_EQ(match.size(), n1);
+   for (std::size_t i = 0; i < n1; ++i) {
+      int best = -1;
+      for (std::size_t j = 0; j < n2; ++j) {
+         if (expected[i * n2 + j] < maxDeltaR * maxDeltaR && (best < 0 || expected[i * n2 + j] < expected[i * n2 + best]))
+            best = j;
+      }
+      EXPECT_EQ(match[i], best) << "element " << i;
+   }
+}
+
+TEST(VecOps, DeltaRAllPairsAndMatching)
+{
+   CheckAllPairsAndMatching<float>(3, 5);
+   CheckAllPairsAndMatching<float>(100, 300);
+   CheckAllPairsAndMatching<double>(100, 300);
+   CheckAllPairsAndMatching<long double>(20, 30);
+   CheckAllPairsAndMatching<double>(0, 10);
+
+   RVecF jetEta{0.f, 1.f, 3.f}, jetPhi{0.f, 0.f, 0.f}, muEta{1.1f, 0.05f}, muPhi{0.f, 0.f};
+   CheckEqual(MatchDeltaR(jetEta, muEta, jetPhi, muPhi, 0.4f), RVecI{1, 0, -1});
+   // the angles are compared modulo 2 pi
+   RVecD eta{0.}, phi{3.1}, otherEta{0., 0.}, otherPhi{-3.1, 2.5};
+   CheckEqual(MatchDeltaR(eta, otherEta, phi, otherPhi, 0.4), RVecI{0});
+   EXPECT_THROW(DeltaR2AllPairs(eta, otherEta, phi, RVecD{}), std::runtime_error);
+}
+
 TEST(VecOps, Map)
 {
    RVec<float> a({1.f, 2.f, 3.f});
@@ -1938,5 +2043,95 @@ TEST_P(VecOpsSwap, RegularAdoptingVectors)
    EXPECT_TRUE(IsAdopting(vadopt3));
 }
 
+TEST(VecOps, ArenaAllocation)
+{
+   using ROOT::Internal::VecOps::RVecArena;
+   using ROOT::Internal::VecOps::RVecArenaScope;
+   RVecArena arena(1024 * 1024);
+   RVec<float> outside{1.f, 2.f};
+   {
+      RVecArenaScope scope(&arena);
+      EXPECT_EQ(ROOT::Internal::VecOps::GetCurrentRVecArena(), &arena);
+      RVec<float> v(1000, 1.f);
+      EXPECT_EQ(arena.GetNChunks(), 1u);
+      EXPECT_GE(v.capacity(), 1000u);
+      v.push_back(2.f);
+      v.resize(2000, 3.f);
+      EXPECT_FLOAT_EQ(Sum(v), 1000.f + 2.f + 999 * 3.f);
+      // a vector allocated on the heap moves to the arena when it grows
+      outside.resize(500, 4.f);
+      EXPECT_FLOAT_EQ(Sum(outside), 3.f + 498 * 4.f);
+      // buffers larger than a quarter of the chunk are allocated on the heap
+      RVec<double> large(100000, 1.);
+      EXPECT_DOUBLE_EQ(Sum(large), 100000.);
+      // types that are not trivially copyable never use the arena
+      RVec<std::string> strings(100, "a");
+      EXPECT_EQ(strings[99], "a");
+      RVec<float> moved = std::move(v);
+      EXPECT_EQ(moved.size(), 2000u);
+   }
+   EXPECT_EQ(ROOT::Internal::VecOps::GetCurrentRVecArena(), nullptr);
+   // RVecs in the arena can grow out of it and are destroyed without freeing their buffer
+   outside.resize(1000, 5.f);
+   EXPECT_FLOAT_EQ(Sum(outside), 3.f + 498 * 4.f + 500 * 5.f);
+   arena.Reset();
+   {
+      RVecArenaScope scope(&arena);
+      for (int i = 0; i < 100; ++i) {
+         RVec<int> v(1000, i);
+         EXPECT_EQ(v.back(), i);
+         arena.Reset();
+      }
+   }
+   // Reset makes the memory available again without releasing it
+   EXPECT_EQ(arena.GetNChunks(), 1u);
+}
+
+TEST(VecOps, RecordFilterAndSort)
+{
+   RVecF pt{10.f, 50.f, 30.f, 20.f};
+   RVecF eta{0.5f, -3.f, 1.f, -2.f};
+   RVecI charge{1, -1, -1, 1};
+   RVecRecord<float, float, int> r(pt, eta, charge);
+   EXPECT_EQ(r.size(), 4u);
+   EXPECT_EQ(std::get<2>(r[1]), -1);
+
+   auto central = r[abs(r.Get<1>()) < 2.5];
+   CheckEqual(central.Get<0>(), RVecF{10.f, 30.f, 20.f});
+   CheckEqual(central.Get<2>(), RVecI{1, -1, 1});
+
+   auto sorted = central.SortBy<0>([](float x, float y) { return x > y; });
+   CheckEqual(sorted.Get<0>(), RVecF{30.f, 20.f, 10.f});
+   CheckEqual(sorted.Get<1>(), RVecF{1.f, -2.f, 0.5f});
+   CheckEqual(sorted.Get<2>(), RVecI{-1, 1, 1});
+   CheckEqual(Reverse(sorted).Get<0>(), RVecF{10.f, 20.f, 30.f});
+   CheckEqual(Take(r, {3, 0}).Get<1>(), RVecF{-2.f, 0.5f});
+
+   EXPECT_THROW((RVecRecord<float, int>(pt, RVecI{1})), std::runtime_error);
+   EXPECT_THROW((r[RVecI{1, 0}]), std::runtime_error);
+}
+
+TEST(VecOps, RecordViewAndCombinations)
+{
+   RVecD pt{10., 20., 30.};
+   RVecD phi{0., 1., 2.};
+   auto r = RecordView(pt, phi);
+   // the record views the RVecs without copying them
+   EXPECT_EQ(r.Get<0>().data(), pt.data());
+   EXPECT_TRUE(IsAdopting(r.Get<1>()));
+   EXPECT_FALSE(IsAdopting(r.SortBy<1>().Get<1>()));
+
+   auto pairs = Combinations(r, 2);
+   ASSERT_EQ(pairs.size(), 2u);
+   CheckEqual(pairs[0].Get<0>(), RVecD{10., 10., 20.});
+   CheckEqual(pairs[1].Get<0>(), RVecD{20., 30., 30.});
+   CheckEqual(pairs[1].Get<1>(), RVecD{1., 2., 2.});
+
+   RVecRecord<int> other(RVecI{7, 8});
+   auto product = Combinations(r, other);
+   CheckEqual(product.first.Get<0>(), RVecD{10., 10., 20., 20., 30., 30.});
+   CheckEqual(product.second.Get<0>(), RVecI{7, 8, 7, 8, 7, 8});
+}
+
 INSTANTIATE_TEST_SUITE_P(ROOTVecOpsswap, VecOpsSwap, ::testing::Values(true));
 INSTANTIATE_TEST_SUITE_P(stdswap, VecOpsSwap, ::testing::Values(false));
@@ -49,6 +49,8 @@
 //Davix.S3.SecretKey
 //Davix.S3.Region
 //Davix.S3.Token
+//Davix.ParallelReads
+//Davix.ParallelReads.Retries
 //
 // Environment variables:
 // X509_USER_CERT, X509_USER_KEY, X509_USER_PROXY ... usual meaning for the X509 Grid things. gEnv vars have higher priority.
@@ -75,6 +77,7 @@ private:
     Long64_t DavixReadBuffer(Davix_fd *fd, char *buf, Int_t len);
     Long64_t DavixPReadBuffer(Davix_fd *fd, char *buf, Long64_t pos, Int_t len);
     Long64_t DavixReadBuffers(Davix_fd *fd, char *buf, Long64_t *pos, Int_t *len, Int_t nbuf);
+    Long64_t DavixParallelReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf);
     Long64_t DavixWriteBuffer(Davix_fd *fd, const char *buf, Int_t len);
     Int_t DavixStat(struct stat *st) const;
 
@@ -13,6 +13,7 @@
 
 #include <TError.h>
 
+#include <future>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -89,6 +90,13 @@ size_t ROOT::Internal::RRawFileDavix::ReadAtImpl(void *buffer, size_t nbytes, st
    return static_cast<size_t>(retval);
 }
 
+std::future<void> ROOT::Internal::RRawFileDavix::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   // Davix has no asynchronous interface, but vector reads of the same file descriptor can run concurrently since
+   // they do not use the file position
+   return std::async(std::launch::async, [this, ioVec, nReq] { ReadVImpl(ioVec, nReq); });
+}
+
 void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
    Davix::DavixError *davixErr = NULL;
@@ -42,8 +42,14 @@
 #include "TDavixFileInternal.h"
 #include "snprintf.h"
 
+#include <algorithm>
 #include <cerrno>
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <unistd.h>
 #include <fcntl.h>
 #include <davix.hpp>
@@ -81,6 +87,162 @@ static Context* davix_context_s = NULL;
 
 ////////////////////////////////////////////////////////////////////////////////
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Process-wide pool of threads issuing independent HTTP range requests for
+/// TDavixFile::ReadBuffers when Davix.ParallelReads is set.
+///
+/// Object stores often serve multi-range (multipart/byteranges) requests
+/// badly or not at all; instead every buffer is fetched with its own range
+/// request. All requests go through the shared Davix context, whose session
+/// pool keeps the connections open and reuses them across the TDavixFile
+/// instances of the process (over HTTP/2 when the davix backend supports it).
+///
+/// The number of requests in flight adapts to the server: it grows by one
+/// after a full window of successful requests and is halved whenever a
+/// request fails, between 1 and Davix.ParallelReads. Failed requests are
+/// retried Davix.ParallelReads.Retries times with an increasing delay.
+
+class TDavixRangeReader {
+public:
+   struct Batch_t {
+      Int_t fPending = 0;   ///< Number of requests of the batch not yet completed
+      Long64_t fBytes = 0;  ///< Bytes read by the completed requests
+      std::string fError;   ///< Message of the first failed request, empty on success
+   };
+
+private:
+   struct Request_t {
+      Davix::DavFile *fFile;
+      const Davix::RequestParams *fParams;
+      char *fBuffer;
+      Long64_t fOffset;
+      Int_t fLength;
+      Batch_t *fBatch;
+   };
+
+   std::mutex fMutex;
+   std::condition_variable fWorkCond;  ///< Signalled when requests are queued or the window grows
+   std::condition_variable fDoneCond;  ///< Signalled when a request completes
+   std::deque<Request_t> fQueue;
+   Int_t fMaxConcurrency;
+   Int_t fRetries;
+   Int_t fWindow;        ///< Current number of requests allowed in flight
+   Int_t fInFlight = 0;
+   Int_t fSuccesses = 0; ///< Successful requests since the window last changed
+   Int_t fThreads = 0;
+
+   TDavixRangeReader(Int_t maxConcurrency, Int_t retries)
+      : fMaxConcurrency(maxConcurrency), fRetries(retries), fWindow(std::min(maxConcurrency, 4))
+   {
+   }
+
+   bool Fetch(const Request_t &req, std::string &error)
+   {
+      Long64_t done = 0;
+      while (done < req.fLength) {
+         DavixError *davixErr = NULL;
+         dav_ssize_t ret = req.fFile->readPartial(req.fParams, req.fBuffer + done, req.fLength - done,
+                                                  req.fOffset + done, &davixErr);
+         if (ret <= 0) {
+            if (davixErr) {
+               error = davixErr->getErrMsg() + " (" + std::to_string(davixErr->getStatus()) + ")";
+               DavixError::clearError(&davixErr);
+            } else {
+               error = "unexpected end of file at offset " + std::to_string(req.fOffset + done);
+            }
+            return false;
+         }
+         done += ret;
+      }
+      return true;
+   }
+
+   void Process(const Request_t &req)
+   {
+      std::string error;
+      bool ok = false;
+      for (Int_t attempt = 0; !ok && attempt <= fRetries; ++attempt) {
+         if (attempt > 0) {
+            {
+               // back off: the server is likely overloaded, shrink the window for everybody
+               std::lock_guard<std::mutex> lock(fMutex);
+               fWindow = std::max(1, fWindow / 2);
+               fSuccesses = 0;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(50 << (attempt - 1)));
+         }
+         ok = Fetch(req, error);
+      }
+
+      std::lock_guard<std::mutex> lock(fMutex);
+      if (ok) {
+         req.fBatch->fBytes += req.fLength;
+         if (++fSuccesses >= fWindow && fWindow < fMaxConcurrency) {
+            ++fWindow;
+            fSuccesses = 0;
+            fWorkCond.notify_one();
+         }
+      } else if (req.fBatch->fError.empty()) {
+         req.fBatch->fError = error;
+      }
+      --fInFlight;
+      --req.fBatch->fPending;
+      fDoneCond.notify_all();
+   }
+
+   void Work()
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      while (true) {
+         fWorkCond.wait(lock, [this] { return !fQueue.empty() && fInFlight < fWindow; });
+         Request_t req = fQueue.front();
+         fQueue.pop_front();
+         ++fInFlight;
+         lock.unlock();
+         Process(req);
+         lock.lock();
+      }
+   }
+
+public:
+   /// Return the pool shared by all the TDavixFile of the process. Like the
+   /// davix context, it lives until the end of the process.
+   static TDavixRangeReader &Instance()
+   {
+      static TDavixRangeReader *reader =
+         new TDavixRangeReader(std::max(1, gEnv->GetValue("Davix.ParallelReads", 0)),
+                               std::max(0, gEnv->GetValue("Davix.ParallelReads.Retries", 2)));
+      return *reader;
+   }
+
+   /// Read the `nbuf` buffers of lengths `len` at offsets `pos` of `file` into
+   /// the consecutive memory starting at `buf`, wait for all of them and fill `batch`.
+   void Read(Davix::DavFile *file, const Davix::RequestParams *params, char *buf, Long64_t *pos, Int_t *len,
+             Int_t nbuf, Batch_t &batch)
+   {
+      std::unique_lock<std::mutex> lock(fMutex);
+      Long64_t bufPos = 0;
+      for (Int_t i = 0; i < nbuf; ++i) {
+         fQueue.push_back(Request_t{file, params, buf + bufPos, pos[i], len[i], &batch});
+         bufPos += len[i];
+      }
+      batch.fPending += nbuf;
+      // threads are started lazily, they idle once the file is read
+      while (fThreads < std::min(fMaxConcurrency, static_cast<Int_t>(fQueue.size()) + fInFlight)) {
+         std::thread(&TDavixRangeReader::Work, this).detach();
+         ++fThreads;
+      }
+      fWorkCond.notify_all();
+      fDoneCond.wait(lock, [&batch] { return batch.fPending == 0; });
+   }
+};
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
 ROOT::Experimental::RLogChannel &TDavixLogChannel()
 {
    static ROOT::Experimental::RLogChannel sLog("ROOT.TDavix");
@@ -343,6 +505,7 @@ static int TDavixFile_http_authn_cert_X509(void *userdata, const Davix::SessionI
 
 TDavixFileInternal::~TDavixFileInternal()
 {
+   delete davixFile;
    delete davixPosix;
    delete davixParam;
 }
@@ -401,6 +564,18 @@ Davix_fd *TDavixFileInternal::Open()
 
 ////////////////////////////////////////////////////////////////////////////////
 
+Davix::DavFile *TDavixFileInternal::getDavixRangeFile()
+{
+   if (davixFile == nullptr) {
+      TLockGuard l(&(openLock));
+      if (davixFile == nullptr)
+         davixFile = new DavFile(*davixContext, Davix::Uri(fUrl.GetUrl()));
+   }
+   return davixFile;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void TDavixFileInternal::Close()
 {
    DavixError *davixErr = NULL;
@@ -564,6 +739,11 @@ void TDavixFileInternal::parseConfig()
    env_var = gEnv->GetValue("Davix.GSI.GridMode", (const char *)"y");
    if (!isno(env_var))
       enableGridMode();
+
+   parallelReads = gEnv->GetValue("Davix.ParallelReads", 0) > 0;
+   if (gDebug > 0 && parallelReads)
+      Info("parseConfig", "Reading lists of buffers with up to %d parallel range requests",
+           gEnv->GetValue("Davix.ParallelReads", 0));
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -793,7 +973,8 @@ Bool_t TDavixFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
    if ((fd = d_ptr->getDavixFileInstance()) == NULL)
       return kTRUE;
 
-   Long64_t ret = DavixReadBuffers(fd, buf, pos, len, nbuf);
+   Long64_t ret = d_ptr->parallelReads ? DavixParallelReadBuffers(buf, pos, len, nbuf)
+                                       : DavixReadBuffers(fd, buf, pos, len, nbuf);
    if (ret < 0)
       return kTRUE;
 
@@ -994,3 +1175,22 @@ Long64_t TDavixFile::DavixReadBuffers(Davix_fd *fd, char *buf, Long64_t *pos, In
 
    return ret;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read a list of buffers with one independent range request per buffer,
+/// issued in parallel by the process-wide pool of range readers.
+
+Long64_t TDavixFile::DavixParallelReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
+{
+   Double_t start_time = eventStart();
+
+   TDavixRangeReader::Batch_t batch;
+   TDavixRangeReader::Instance().Read(d_ptr->getDavixRangeFile(), d_ptr->davixParam, buf, pos, len, nbuf, batch);
+   if (!batch.fError.empty()) {
+      Error("DavixParallelReadBuffers", "can not read data with davix: %s", batch.fError.c_str());
+      return -1;
+   }
+
+   eventStop(start_time, batch.fBytes);
+   return batch.fBytes;
+}
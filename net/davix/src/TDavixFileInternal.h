@@ -62,6 +62,8 @@ private:
       davixParam(nullptr),
       davixPosix(nullptr),
       davixFd(nullptr),
+      davixFile(nullptr),
+      parallelReads(false),
       fUrl(mUrl),
       opt(mopt),
       oflags(0),
@@ -74,6 +76,8 @@ private:
       davixParam(nullptr),
       davixPosix(nullptr),
       davixFd(nullptr),
+      davixFile(nullptr),
+      parallelReads(false),
       fUrl(url),
       opt(mopt),
       oflags(0),
@@ -95,6 +99,8 @@ private:
 
    Davix_fd * Open();
 
+   Davix::DavFile *getDavixRangeFile();
+
    void Close();
 
    void enableGridMode();
@@ -133,6 +139,8 @@ private:
    Davix::RequestParams *davixParam;
    Davix::DavPosix *davixPosix;
    Davix_fd *davixFd;
+   Davix::DavFile *davixFile; // stateless handle used by the parallel range reads
+   bool parallelReads;        // Davix.ParallelReads is set: ReadBuffers issues independent range requests
    TUrl fUrl;
    Option_t* opt;
    int oflags;
@@ -162,6 +162,9 @@ public:
    /** mark reply as 404 error - page/request not exists or refused */
    void Set404() { SetContentType("_404_"); }
 
+   /** mark reply as 304 - content identified by ETag header did not change since client requested it */
+   void SetNotModified() { SetContentType("_not_modified_"); }
+
    /** Return true if reply can be postponed by server  */
    virtual Bool_t CanPostpone() const { return kTRUE; }
 
@@ -231,6 +234,7 @@ public:
    Bool_t Is404() const { return IsContentType("_404_"); }
    Bool_t IsFile() const { return IsContentType("_file_"); }
    Bool_t IsPostponed() const { return IsContentType("_postponed_"); }
+   Bool_t IsNotModified() const { return IsContentType("_not_modified_"); }
    Bool_t IsText() const { return IsContentType("text/plain"); }
    Bool_t IsXml() const { return IsContentType("text/xml"); }
    Bool_t IsJson() const { return IsContentType("application/json"); }
@@ -16,6 +16,7 @@
 #include "TList.h"
 #include "THttpCallArg.h"
 
+#include <chrono>
 #include <mutex>
 #include <map>
 #include <string>
@@ -40,6 +41,7 @@ protected:
    Bool_t fOwnThread{kFALSE};           ///<! true when specialized thread allocated for processing requests
    std::thread fThrd;                   ///<! own thread
    Bool_t fWSOnly{kFALSE};              ///<! when true, handle only websockets / longpoll engine
+   Bool_t fMetrics{kFALSE};             ///<! when true, serve the ROOT performance metrics on the "metrics" page
 
    TString fJSROOTSYS;       ///<! location of local JSROOT files
    TString fTopName{"ROOT"}; ///<! name of top folder, default - "ROOT"
@@ -60,6 +62,23 @@ protected:
    std::mutex fWSMutex;                                      ///<! mutex to protect WS handler lists
    std::vector<std::shared_ptr<THttpWSHandler>> fWSHandlers; ///<! list of WS handlers
 
+   /// Reply on object request, kept to answer identical requests in the engine threads
+   struct CachedReply {
+      std::chrono::steady_clock::time_point fTime; ///< when reply was produced
+      TString fPathName;                           ///< requested item path
+      Bool_t fHierarchy{kFALSE};                   ///< reply describes objects hierarchy like h.json
+      TString fContentType;                        ///< content type of reply
+      TString fHeader;                             ///< reply header, including ETag
+      Int_t fZipping{0};                           ///< zipping mode of reply
+      std::string fContent;                        ///< reply content
+      std::string fZipped;                         ///< content compressed once with gzip, empty if not required
+      std::string fETag;                           ///< entity tag of the content
+   };
+
+   Long_t fCacheLifetime{0};                                    ///<! lifetime of cached replies in ms, 0 - disabled
+   std::mutex fCacheMutex;                                      ///<! mutex to protect cached replies
+   std::map<std::string, std::shared_ptr<CachedReply>> fCache; ///<! cached replies on object requests
+
    virtual void MissedRequest(THttpCallArg *arg);
 
    virtual void ProcessRequest(std::shared_ptr<THttpCallArg> arg);
@@ -72,6 +91,12 @@ protected:
 
    void ReplaceJSROOTLinks(std::shared_ptr<THttpCallArg> &arg);
 
+   Bool_t IsCacheable(const THttpCallArg &arg, std::string &key) const;
+
+   Bool_t ReplyFromCache(std::shared_ptr<THttpCallArg> &arg);
+
+   void StoreInCache(std::shared_ptr<THttpCallArg> &arg);
+
    static Bool_t VerifyFilePath(const char *fname);
 
    THttpServer(const THttpServer &) = delete;
@@ -123,6 +148,11 @@ public:
    /** Returns specified CORS credentials value - if any */
    const char *GetCorsCredentials() const { return fCorsCredentials.c_str(); }
 
+   void SetMetrics(Bool_t on = kTRUE);
+
+   /** Returns kTRUE if the ROOT performance metrics are served on the "metrics" page */
+   Bool_t IsMetrics() const { return fMetrics; }
+
    /** set name of top item in objects hierarchy */
    void SetTopName(const char *top) { fTopName = top; }
 
@@ -141,6 +171,13 @@ public:
 
    void CreateServerThread();
 
+   void SetReplyCaching(Long_t milliSec = 1000);
+
+   /** returns lifetime of cached replies in ms, 0 when caching is disabled */
+   Long_t GetReplyCaching() const { return fCacheLifetime; }
+
+   void InvalidateCache(const char *path = nullptr);
+
    /** Check if file is requested, thread safe */
    Bool_t IsFileRequested(const char *uri, TString &res) const;
 
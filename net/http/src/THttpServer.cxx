@@ -20,6 +20,7 @@
 #include "TError.h"
 #include "TClass.h"
 #include "RConfigure.h"
+#include "RZip.h"
 #include "TRegexp.h"
 #include "TObjArray.h"
 
@@ -31,6 +32,9 @@
 #include "TCivetweb.h"
 #include "TFastCgi.h"
 
+#include "ROOT/RMetricsRegistry.hxx"
+
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <cstring>
@@ -121,6 +125,14 @@ If objects content is changing in the application, one could
 enable monitoring flag in the browser - than objects view
 will be regularly updated.
 
+The performance metrics of ROOT (see ROOT::Experimental::RMetricsRegistry) can be
+exported to monitoring systems like Prometheus with:
+
+    serv->SetMetrics();
+
+They are then served in the OpenMetrics text format on "http://localhost:8080/metrics".
+The "metrics" option does the same: `new THttpServer("http:8080;metrics")`.
+
 More information: https://root.cern/root/htmldoc/guides/HttpServer/HttpServer.html
 */
 
@@ -149,6 +161,8 @@ ClassImp(THttpServer);
 ///     cors           - enable CORS header with origin="*"
 ///     cors=domain    - enable CORS header with origin="domain"
 ///     basic_sniffer  - use basic sniffer without support of hist, gpad, graph classes
+///     cache=ms       - reply identical object requests from cache during ms, see SetReplyCaching()
+///     metrics        - serve ROOT performance metrics on the "metrics" page, see SetMetrics()
 ///
 /// For example, create http server, which allows cors headers and disable scan of global lists,
 /// one should provide "http:8080;cors;noglobal" as parameter
@@ -221,6 +235,10 @@ THttpServer::THttpServer(const char *engine) : TNamed("http", "ROOT http server"
             SetCors(opt + 5);
          } else if (strcmp(opt, "cors") == 0) {
             SetCors("*");
+         } else if (strcmp(opt, "metrics") == 0) {
+            SetMetrics(kTRUE);
+         } else if (strncmp(opt, "cache=", 6) == 0) {
+            SetReplyCaching(TString(opt + 6).Atoi());
          } else
             CreateEngine(opt);
       }
@@ -259,6 +277,7 @@ THttpServer::~THttpServer()
 void THttpServer::SetSniffer(TRootSniffer *sniff)
 {
    fSniffer.reset(sniff);
+   InvalidateCache();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -289,6 +308,7 @@ void THttpServer::SetReadOnly(Bool_t readonly)
 {
    if (fSniffer)
       fSniffer->SetReadOnly(readonly);
+   InvalidateCache();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -312,6 +332,20 @@ void THttpServer::SetWSOnly(Bool_t on)
    fWSOnly = on;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Serve the ROOT performance metrics on the "metrics" page
+///
+/// The metrics of ROOT::Experimental::RMetricsRegistry are returned in the OpenMetrics
+/// text format, which can be scraped by Prometheus. Enabling the page also enables
+/// the measurement of the timing metrics, see RMetricsRegistry::Enable().
+
+void THttpServer::SetMetrics(Bool_t on)
+{
+   fMetrics = on;
+   if (on)
+      ROOT::Experimental::RMetricsRegistry::Enable();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Add files location, which could be used in the server
 ///
@@ -546,6 +580,62 @@ void THttpServer::StopServerThread()
    fMainThrdId = 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable caching of replies on object requests
+///
+/// Requests like "root.json", "root.bin" or "h.json" typically stream the same objects
+/// again and again for every connected client. When caching is enabled, such reply is kept
+/// during milliSec and identical requests are answered directly in the threads of the http engine,
+/// without waiting for the main thread and without running TRootSniffer or TBufferJSON again.
+/// Content compression is also performed only once per cached reply.
+///
+/// Each cached reply gets an ETag header, computed from its content. Browser providing
+/// this tag in "If-None-Match" header gets "304 Not Modified" reply without any content.
+/// Since the tag depends only on the content, it does not change when unchanged object is streamed again.
+///
+/// Cache is invalidated when objects are registered or unregistered, when item fields are changed
+/// and after each method execution. If objects are modified by the application, one should either
+/// select lifetime which is acceptable for the clients or call InvalidateCache() after the modification.
+///
+/// By default caching is disabled, milliSec = 0 disables it again.
+
+void THttpServer::SetReplyCaching(Long_t milliSec)
+{
+   std::lock_guard<std::mutex> grd(fCacheMutex);
+   fCacheLifetime = milliSec > 0 ? milliSec : 0;
+   fCache.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove cached replies
+///
+/// If path is specified, only replies for items in this path and descriptions of the hierarchy are removed
+
+void THttpServer::InvalidateCache(const char *path)
+{
+   std::lock_guard<std::mutex> grd(fCacheMutex);
+   if (!path || !*path) {
+      fCache.clear();
+      return;
+   }
+
+   // normalize path like "/hist/hpx/" into "hist/hpx"
+   TString prefix = path;
+   while (prefix.BeginsWith("/"))
+      prefix.Remove(0, 1);
+   while (prefix.EndsWith("/"))
+      prefix.Resize(prefix.Length() - 1);
+
+   for (auto iter = fCache.begin(); iter != fCache.end();) {
+      TString &item = iter->second->fPathName;
+      if (iter->second->fHierarchy || prefix.IsNull() ||
+          (item.BeginsWith(prefix) && ((item.Length() == prefix.Length()) || (item[prefix.Length()] == '/'))))
+         iter = fCache.erase(iter);
+      else
+         ++iter;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Checked that filename does not contains relative path below current directory
 ///
@@ -636,11 +726,16 @@ Bool_t THttpServer::ExecuteHttp(std::shared_ptr<THttpCallArg> arg)
    if (fTerminated)
       return kFALSE;
 
+   if (ReplyFromCache(arg))
+      return kTRUE;
+
    if ((fMainThrdId != 0) && (fMainThrdId == TThread::SelfId())) {
       // should not happen, but one could process requests directly without any signaling
 
       ProcessRequest(arg);
 
+      StoreInCache(arg);
+
       return kTRUE;
    }
 
@@ -675,8 +770,14 @@ Bool_t THttpServer::SubmitHttp(std::shared_ptr<THttpCallArg> arg, Bool_t can_run
    if (fTerminated)
       return kFALSE;
 
+   if (ReplyFromCache(arg)) {
+      arg->NotifyCondition();
+      return kTRUE;
+   }
+
    if (can_run_immediately && (fMainThrdId != 0) && (fMainThrdId == TThread::SelfId())) {
       ProcessRequest(arg);
+      StoreInCache(arg);
       arg->NotifyCondition();
       return kTRUE;
    }
@@ -745,6 +846,7 @@ Int_t THttpServer::ProcessRequests()
          cnt++;
          ProcessRequest(arg);
          fSniffer->SetCurrentCallArg(nullptr);
+         StoreInCache(arg);
       } catch (...) {
          fSniffer->SetCurrentCallArg(nullptr);
       }
@@ -865,6 +967,143 @@ void THttpServer::ReplaceJSROOTLinks(std::shared_ptr<THttpCallArg> &arg)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Checks if reply on the request can be cached
+///
+/// Only GET requests for objects data and objects hierarchy are cached,
+/// requests executing methods or commands are never cached.
+/// Returns in key the string, identifying request
+
+Bool_t THttpServer::IsCacheable(const THttpCallArg &arg, std::string &key) const
+{
+   if (!arg.IsMethod("GET") || (arg.fFileName == "root_batch_holder.js"))
+      return kFALSE;
+
+   TString filename = arg.fFileName;
+   if (filename.EndsWith(".gz"))
+      filename.Resize(filename.Length() - 3);
+
+   static const char *cacheable[] = {"root.json", "root.bin", "root.xml", "root.png", "root.jpeg", "root.gif",
+                                     "item.json", "item.xml", "h.json",   "h.xml",    "get.xml"};
+
+   if (std::none_of(std::begin(cacheable), std::end(cacheable), [&filename](const char *name) { return filename == name; }))
+      return kFALSE;
+
+   // user name is part of the key, while access rights may differ between users
+   key.clear();
+   for (auto part : {&arg.fTopName, &arg.fUserName, &arg.fPathName, &arg.fFileName, &arg.fQuery}) {
+      key.append(part->Data());
+      key.append(1, '\n');
+   }
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fills reply from cache if possible
+///
+/// Method is thread safe and invoked in the threads of http engine
+
+Bool_t THttpServer::ReplyFromCache(std::shared_ptr<THttpCallArg> &arg)
+{
+   std::string key;
+   if (!IsCacheable(*arg, key))
+      return kFALSE;
+
+   std::shared_ptr<CachedReply> entry;
+   {
+      std::lock_guard<std::mutex> grd(fCacheMutex);
+      if (fCacheLifetime <= 0)
+         return kFALSE;
+      auto iter = fCache.find(key);
+      if (iter == fCache.end())
+         return kFALSE;
+      if (std::chrono::steady_clock::now() - iter->second->fTime > std::chrono::milliseconds(fCacheLifetime)) {
+         fCache.erase(iter);
+         return kFALSE;
+      }
+      entry = iter->second;
+   }
+
+   // entry is not changed after it was stored, therefore data can be copied without lock
+   arg->fHeader = entry->fHeader;
+   arg->SetZipping(THttpCallArg::kNoZip);
+
+   if (arg->GetRequestHeader("If-None-Match") == entry->fETag.c_str()) {
+      arg->SetNotModified();
+      return kTRUE;
+   }
+
+   arg->SetContentType(entry->fContentType.Data());
+
+   Bool_t dozip = kFALSE;
+   if (!entry->fZipped.empty()) {
+      if (entry->fZipping == THttpCallArg::kZipAlways)
+         dozip = kTRUE;
+      else
+         dozip = arg->GetRequestHeader("Accept-Encoding").Index("gzip", 0, TString::kIgnoreCase) != kNPOS;
+   }
+
+   if (dozip) {
+      arg->fContent = entry->fZipped;
+      arg->SetEncoding("gzip");
+   } else {
+      arg->fContent = entry->fContent;
+   }
+
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stores reply in cache
+///
+/// Adds ETag header to the reply and, if required, compresses content for the future requests
+
+void THttpServer::StoreInCache(std::shared_ptr<THttpCallArg> &arg)
+{
+   if (fCacheLifetime <= 0)
+      return;
+
+   std::string key;
+   if (!IsCacheable(*arg, key)) {
+      // methods execution may change objects, cached replies are no longer valid
+      if (arg->fFileName.BeginsWith("exe.") || (arg->fFileName == "cmd.json") || arg->fFileName.BeginsWith("multi."))
+         InvalidateCache();
+      return;
+   }
+
+   if (arg->Is404() || arg->IsFile() || arg->IsPostponed() || arg->IsNotModified())
+      return;
+
+   auto entry = std::make_shared<CachedReply>();
+
+   unsigned long crc = R__crc32(0, nullptr, 0);
+   crc = R__crc32(crc, (const unsigned char *)arg->fContent.data(), arg->fContent.length());
+   entry->fETag = TString::Format("\"%lx-%lx\"", (unsigned long)arg->fContent.length(), crc).Data();
+
+   // browser is allowed to keep reply, but must always verify it with the server
+   arg->AddHeader("Cache-Control", "private, no-cache");
+   arg->AddHeader("ETag", entry->fETag.c_str());
+
+   entry->fTime = std::chrono::steady_clock::now();
+   entry->fPathName = arg->fPathName;
+   entry->fHierarchy = arg->fFileName.BeginsWith("h.") || arg->fFileName.BeginsWith("get.");
+   entry->fContentType = arg->fContentType;
+   entry->fHeader = arg->fHeader;
+   entry->fZipping = arg->GetZipping();
+   entry->fContent = arg->fContent;
+
+   if ((entry->fZipping == THttpCallArg::kZip) || (entry->fZipping == THttpCallArg::kZipAlways) ||
+       ((entry->fZipping == THttpCallArg::kZipLarge) && (entry->fContent.length() >= 10000))) {
+      THttpCallArg zipped;
+      zipped.fContent = entry->fContent;
+      zipped.CompressWithGzip();
+      entry->fZipped = std::move(zipped.fContent);
+   }
+
+   std::lock_guard<std::mutex> grd(fCacheMutex);
+   fCache[key] = entry;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Process single http request
 ///
@@ -1000,6 +1239,13 @@ void THttpServer::ProcessRequest(std::shared_ptr<THttpCallArg> arg)
       return;
    }
 
+   if (fMetrics && (arg->fFileName == "metrics") && arg->fPathName.IsNull()) {
+      arg->SetContent(ROOT::Experimental::RMetricsRegistry::Instance().ToOpenMetrics());
+      arg->SetContentType("application/openmetrics-text; version=1.0.0; charset=utf-8");
+      arg->AddNoCacheHeader();
+      return;
+   }
+
    TString filename;
    if (IsFileRequested(arg->fFileName.Data(), filename)) {
       arg->SetFile(filename);
@@ -1129,6 +1375,7 @@ void THttpServer::ProcessRequest(std::shared_ptr<THttpCallArg> arg)
 
 Bool_t THttpServer::Register(const char *subfolder, TObject *obj)
 {
+   InvalidateCache();
    return fSniffer->RegisterObject(subfolder, obj);
 }
 
@@ -1139,6 +1386,7 @@ Bool_t THttpServer::Register(const char *subfolder, TObject *obj)
 
 Bool_t THttpServer::Unregister(TObject *obj)
 {
+   InvalidateCache();
    return fSniffer->UnregisterObject(obj);
 }
 
@@ -1272,6 +1520,7 @@ Bool_t THttpServer::ExecuteWS(std::shared_ptr<THttpCallArg> &arg, Bool_t externa
 
 void THttpServer::Restrict(const char *path, const char *options)
 {
+   InvalidateCache();
    fSniffer->Restrict(path, options);
 }
 
@@ -1314,6 +1563,7 @@ void THttpServer::Restrict(const char *path, const char *options)
 
 Bool_t THttpServer::RegisterCommand(const char *cmdname, const char *method, const char *icon)
 {
+   InvalidateCache();
    return fSniffer->RegisterCommand(cmdname, method, icon);
 }
 
@@ -1341,6 +1591,7 @@ Bool_t THttpServer::SetIcon(const char *fullname, const char *iconname)
 
 Bool_t THttpServer::CreateItem(const char *fullname, const char *title)
 {
+   InvalidateCache();
    return fSniffer->CreateItem(fullname, title);
 }
 
@@ -1349,6 +1600,7 @@ Bool_t THttpServer::CreateItem(const char *fullname, const char *title)
 
 Bool_t THttpServer::SetItemField(const char *fullname, const char *name, const char *value)
 {
+   InvalidateCache(fullname);
    return fSniffer->SetItemField(fullname, name, value);
 }
 
@@ -0,0 +1,62 @@
+// $Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_THttpHistWSHandler
+#define ROOT_THttpHistWSHandler
+
+#include "THttpWSHandler.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+class TH1;
+
+class THttpHistWSHandler : public THttpWSHandler {
+public:
+   enum { kBlockSize = 1024 }; ///< number of bins in the blocks compared and sent together
+
+protected:
+   /// State of a published histogram: last seen content and the version in which each block changed
+   struct HistEntry {
+      TH1 *fHist{nullptr};                   ///< published histogram, not owned
+      ULong64_t fVersion{0};                 ///< incremented every time a change of the histogram is detected
+      ULong64_t fFullVersion{0};             ///< version in which binning or errors structure changed last time
+      Int_t fNcells{0};                      ///< number of cells in the snapshot
+      Bool_t fSumw2{kFALSE};                 ///< true when snapshot includes sum of squares of weights
+      std::vector<Double_t> fContent;        ///< snapshot of bin contents, followed by sum of squares of weights
+      std::vector<Double_t> fStats;          ///< snapshot of statistics and number of entries
+      std::vector<ULong64_t> fBlockVersion;  ///< version in which each block of bins changed last time
+   };
+
+   std::map<std::string, HistEntry> fHists; ///<! published histograms
+
+   Bool_t UpdateEntry(HistEntry &entry);
+
+   void SendFull(UInt_t wsid, const std::string &name, HistEntry &entry);
+
+   void SendDelta(UInt_t wsid, const std::string &name, HistEntry &entry, ULong64_t version);
+
+public:
+   THttpHistWSHandler(const char *name, const char *title = "histograms with delta updates");
+   virtual ~THttpHistWSHandler();
+
+   Bool_t Publish(const char *name, TH1 *hist);
+
+   Bool_t Unpublish(const char *name);
+
+   ULong64_t GetVersion(const char *name);
+
+   Bool_t ProcessWS(THttpCallArg *arg) override;
+
+   ClassDefOverride(THttpHistWSHandler, 0) // WS handler sending only changed bins of published histograms
+};
+
+#endif
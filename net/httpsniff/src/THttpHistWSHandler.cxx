@@ -0,0 +1,288 @@
+// $Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "THttpHistWSHandler.h"
+
+#include "TH1.h"
+#include "TArray.h"
+#include "TBufferJSON.h"
+#include "THttpCallArg.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+/** \class THttpHistWSHandler
+\ingroup http
+
+Web-socket handler sending only changed bins of published histograms
+
+Live monitoring clients typically request the same histograms again and again,
+while only few bins change between two requests. THttpHistWSHandler keeps for each
+published histogram a version counter and the version in which every block of
+kBlockSize bins changed last time. A client indicates which version it already has,
+and receives only the blocks which changed since this version.
+
+Usage:
+
+    auto handler = std::make_shared<THttpHistWSHandler>("hists");
+    handler->Publish("hpxpy", hpxpy);
+    serv->RegisterWS(handler);
+
+Client connects to "hists/root.websocket" and sends text messages "GET:name:version",
+where version is 0 when client has no data yet. Server replies with one of:
+
+  - "FULL:name:version" header, followed by JSON representation of the histogram (TBufferJSON)
+  - "DELTA:name:version" header, followed by binary data: TH1::kNstat statistics values and the number
+    of entries (doubles), then for every changed block Int_t index of its first bin, Int_t number of bins,
+    that many bin contents and, if histogram has Sumw2, that many sums of squares of weights (doubles)
+  - "SAME:name:version" text message if histogram did not change
+  - "ERR:name" text message if histogram is not published
+
+Binary data are sent in the byte order of the server, which is little-endian on all supported platforms.
+Full reply is sent when the binning changes, when the client version is unknown and for classes
+like TProfile whose bins are not described by the single array of bin contents.
+Histograms are compared with their snapshot when requested, therefore processing of requests
+is done in the main thread, where histograms are filled.
+*/
+
+ClassImp(THttpHistWSHandler);
+
+namespace {
+
+/// Returns array of bin contents of histogram, nullptr when bins cannot be updated separately
+const TArray *GetContentArray(TH1 *hist)
+{
+   if (hist->InheritsFrom("TProfile") || hist->InheritsFrom("TProfile2D") || hist->InheritsFrom("TProfile3D"))
+      return nullptr;
+   return dynamic_cast<const TArray *>(hist);
+}
+
+/// Returns description of axes, used to detect binning changes
+std::vector<Double_t> GetAxesLayout(TH1 *hist)
+{
+   std::vector<Double_t> res;
+   for (auto axis : {hist->GetXaxis(), hist->GetYaxis(), hist->GetZaxis()}) {
+      res.push_back(axis->GetNbins());
+      res.push_back(axis->GetXmin());
+      res.push_back(axis->GetXmax());
+   }
+   return res;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor
+
+THttpHistWSHandler::THttpHistWSHandler(const char *name, const char *title) : THttpWSHandler(name, title)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor
+
+THttpHistWSHandler::~THttpHistWSHandler() = default;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Publish histogram under specified name
+///
+/// Histogram is not owned by the handler and must be unpublished before it is deleted
+
+Bool_t THttpHistWSHandler::Publish(const char *name, TH1 *hist)
+{
+   if (!name || !*name || !hist)
+      return kFALSE;
+
+   HistEntry &entry = fHists[name];
+   entry = HistEntry();
+   entry.fHist = hist;
+   UpdateEntry(entry);
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stop publishing histogram with specified name
+
+Bool_t THttpHistWSHandler::Unpublish(const char *name)
+{
+   return name && (fHists.erase(name) > 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns current version of published histogram, 0 if it does not exist
+///
+/// Histogram is compared with its snapshot, therefore version is incremented if it was modified
+
+ULong64_t THttpHistWSHandler::GetVersion(const char *name)
+{
+   auto iter = fHists.find(name ? name : "");
+   if (iter == fHists.end())
+      return 0;
+   UpdateEntry(iter->second);
+   return iter->second.fVersion;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compares histogram with its snapshot
+///
+/// Increments version when histogram changed and marks changed blocks with it.
+/// Returns kTRUE if histogram changed
+
+Bool_t THttpHistWSHandler::UpdateEntry(HistEntry &entry)
+{
+   TH1 *hist = entry.fHist;
+   const TArray *arr = GetContentArray(hist);
+
+   std::vector<Double_t> stats(TH1::kNstat + 1, 0.);
+   hist->GetStats(stats.data());
+   stats[TH1::kNstat] = hist->GetEntries();
+
+   Int_t ncells = hist->GetNcells();
+   Bool_t sumw2 = hist->GetSumw2N() == ncells;
+   auto layout = GetAxesLayout(hist);
+
+   // axes layout is stored at the end of statistics vector
+   stats.insert(stats.end(), layout.begin(), layout.end());
+
+   if (!arr || (ncells != entry.fNcells) || (sumw2 != entry.fSumw2) || (entry.fStats.size() != stats.size()) ||
+       !std::equal(layout.begin(), layout.end(), entry.fStats.end() - layout.size())) {
+      // structure changed or histogram cannot be compared, any client needs full reply
+      entry.fVersion++;
+      entry.fFullVersion = entry.fVersion;
+      entry.fNcells = ncells;
+      entry.fSumw2 = sumw2;
+      entry.fStats = std::move(stats);
+      entry.fContent.clear();
+      entry.fBlockVersion.assign((ncells + kBlockSize - 1) / kBlockSize, entry.fVersion);
+      if (arr) {
+         entry.fContent.resize(sumw2 ? 2 * ncells : ncells);
+         for (Int_t n = 0; n < ncells; ++n)
+            entry.fContent[n] = arr->GetAt(n);
+         if (sumw2)
+            std::copy(hist->GetSumw2()->GetArray(), hist->GetSumw2()->GetArray() + ncells, entry.fContent.begin() + ncells);
+      }
+      return kTRUE;
+   }
+
+   const Double_t *sw2 = sumw2 ? hist->GetSumw2()->GetArray() : nullptr;
+   Bool_t changed = kFALSE;
+
+   for (Int_t block = 0; block < (Int_t)entry.fBlockVersion.size(); ++block) {
+      Int_t first = block * kBlockSize, last = std::min(ncells, first + kBlockSize);
+      Bool_t block_changed = kFALSE;
+      for (Int_t n = first; n < last; ++n) {
+         Double_t value = arr->GetAt(n);
+         if (value != entry.fContent[n]) {
+            entry.fContent[n] = value;
+            block_changed = kTRUE;
+         }
+         if (sw2 && (sw2[n] != entry.fContent[ncells + n])) {
+            entry.fContent[ncells + n] = sw2[n];
+            block_changed = kTRUE;
+         }
+      }
+      if (block_changed) {
+         if (!changed)
+            entry.fVersion++;
+         changed = kTRUE;
+         entry.fBlockVersion[block] = entry.fVersion;
+      }
+   }
+
+   if (!changed && (stats != entry.fStats)) {
+      // only statistics changed, for instance entries filled in underflow with zero weight
+      entry.fVersion++;
+      changed = kTRUE;
+   }
+
+   entry.fStats = std::move(stats);
+
+   return changed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Send JSON representation of the histogram
+
+void THttpHistWSHandler::SendFull(UInt_t wsid, const std::string &name, HistEntry &entry)
+{
+   TString json = TBufferJSON::ToJSON(entry.fHist, TBufferJSON::kNoSpaces);
+   std::string hdr = "FULL:" + name + ":" + std::to_string(entry.fVersion);
+   SendHeaderWS(wsid, hdr.c_str(), json.Data(), json.Length());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Send blocks of bins which changed after specified version
+
+void THttpHistWSHandler::SendDelta(UInt_t wsid, const std::string &name, HistEntry &entry, ULong64_t version)
+{
+   std::string buf;
+
+   auto append = [&buf](const void *data, std::size_t len) { buf.append((const char *)data, len); };
+
+   append(entry.fStats.data(), (TH1::kNstat + 1) * sizeof(Double_t));
+
+   for (Int_t block = 0; block < (Int_t)entry.fBlockVersion.size(); ++block) {
+      if (entry.fBlockVersion[block] <= version)
+         continue;
+      Int_t first = block * kBlockSize, len = std::min(entry.fNcells, first + kBlockSize) - first;
+      append(&first, sizeof(Int_t));
+      append(&len, sizeof(Int_t));
+      append(entry.fContent.data() + first, len * sizeof(Double_t));
+      if (entry.fSumw2)
+         append(entry.fContent.data() + entry.fNcells + first, len * sizeof(Double_t));
+   }
+
+   std::string hdr = "DELTA:" + name + ":" + std::to_string(entry.fVersion);
+   SendHeaderWS(wsid, hdr.c_str(), buf.data(), buf.length());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Process websocket requests
+///
+/// Accepts any number of connections, replies on "GET:name:version" messages
+
+Bool_t THttpHistWSHandler::ProcessWS(THttpCallArg *arg)
+{
+   if (!arg || (arg->GetWSId() == 0))
+      return kTRUE;
+
+   if (arg->IsMethod("WS_CONNECT") || arg->IsMethod("WS_READY") || arg->IsMethod("WS_CLOSE"))
+      return kTRUE;
+
+   if (!arg->IsMethod("WS_DATA"))
+      return kFALSE;
+
+   std::string msg((const char *)arg->GetPostData(), arg->GetPostDataLength());
+   if (msg.compare(0, 4, "GET:") != 0)
+      return kFALSE;
+
+   auto separ = msg.rfind(':');
+   std::string name = msg.substr(4, separ > 4 ? separ - 4 : std::string::npos);
+   ULong64_t version = separ > 4 ? std::strtoull(msg.c_str() + separ + 1, nullptr, 10) : 0;
+
+   auto iter = fHists.find(name);
+   if (iter == fHists.end()) {
+      SendCharStarWS(arg->GetWSId(), ("ERR:" + name).c_str());
+      return kTRUE;
+   }
+
+   HistEntry &entry = iter->second;
+   UpdateEntry(entry);
+
+   if (version == entry.fVersion)
+      SendCharStarWS(arg->GetWSId(), ("SAME:" + name + ":" + std::to_string(entry.fVersion)).c_str());
+   else if ((version == 0) || (version < entry.fFullVersion) || (version > entry.fVersion) || entry.fContent.empty())
+      SendFull(arg->GetWSId(), name, entry);
+   else
+      SendDelta(arg->GetWSId(), name, entry, version);
+
+   return kTRUE;
+}
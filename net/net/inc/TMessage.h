@@ -27,6 +27,9 @@
 #include "MessageTypes.h"
 #include "TBits.h"
 
+#include <utility>
+#include <vector>
+
 class TList;
 class TVirtualStreamerInfo;
 
@@ -48,6 +51,12 @@ private:
    char    *fBufCompCur{nullptr}; // Current position in compressed buffer
    char    *fCompPos{nullptr};    // Position of fBufCur when message was compressed
    Bool_t   fEvolution{kFALSE};   // True if support for schema evolution required
+   Int_t    fBufCompSize{0};      // Allocated size of fBufComp
+   Bool_t   fBufCompOwner{kTRUE}; // True if fBufComp is deleted by the message
+   char    *fBufCompSpare{nullptr}; // Compressed buffer kept for the next compression of the message
+   Int_t    fBufCompSpareSize{0}; // Allocated size of fBufCompSpare
+   std::vector<std::pair<const char *, Int_t>> fAttached; //! Buffers sent after the message content, not copied
+   Int_t    fAttachedLength{0};   // Total length of the attached buffers
 
    static Bool_t fgEvolution;  //True if global support for schema evolution required
 
@@ -57,9 +66,13 @@ private:
 
    // used by friend TSocket
    Bool_t TestBitNumber(UInt_t bitnumber) const { return fBitsPIDs.TestBitNumber(bitnumber); }
+   void   SetScatterLength() const;
+
+   void   ReleaseCompBuffer();
+   void   CopyAttachedBuffers();
 
 protected:
-   TMessage(void *buf, Int_t bufsize);   // only called by T(P)Socket::Recv()
+   TMessage(void *buf, Int_t bufsize, Bool_t adopt = kTRUE);   // only called by T(P)Socket::Recv()
    void SetLength() const;               // only called by T(P)Socket::Send()
 
 public:
@@ -88,6 +101,8 @@ public:
    Int_t    Uncompress();
    char    *CompBuffer() const { return fBufComp; }
    Int_t    CompLength() const { return (Int_t)(fBufCompCur - fBufComp); }
+   void     AttachBuffer(const void *buf, Int_t len);
+   Int_t    GetAttachedLength() const { return fAttachedLength; }
    UShort_t WriteProcessID(TProcessID *pid) override;
 
    static void   EnableSchemaEvolutionForAll(Bool_t enable = kTRUE);
@@ -0,0 +1,98 @@
+// @(#)root/net:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TParallelMergingServer
+#define ROOT_TParallelMergingServer
+
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// TParallelMergingServer                                               //
+//                                                                      //
+// Server collecting the content uploaded by TParallelMergingFile       //
+// clients and merging it into the output files. The merging of the     //
+// output files is done on a pool of threads, while the server keeps    //
+// receiving; clients are throttled when too much data waits for being  //
+// merged.                                                              //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "TObject.h"
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TMessage;
+class TMonitor;
+class TServerSocket;
+
+class TParallelMergingServer : public TObject
+{
+public:
+   enum { kProtocolVersion = 1 };
+
+private:
+   struct TOutput;           // One output file and the files of its clients, defined in the source
+
+   TServerSocket *fServerSocket{nullptr};  //! Socket accepting the connections of the clients
+   TMonitor      *fMonitor{nullptr};       //! Monitor of the server and client sockets
+   Int_t          fNThreads{0};            // Number of merging threads
+   Long64_t       fMaxPendingBytes{0};     // Received bytes waiting for being merged above which clients are throttled
+   Float_t        fMergeThreshold{0.75};   // Fraction of the clients which must have reported before merging
+   Int_t          fMaxClients{100};        // Maximal number of connected clients
+   Long64_t       fCacheSize{0};           // Size of the write cache of the output files, 0 if none
+   Bool_t         fThrottling{kFALSE};     // True while the client sockets are not read
+   Int_t          fNThrottlings{0};        // Number of times the clients were throttled
+
+   std::vector<std::thread>  fWorkers;     //! Merging threads
+   mutable std::mutex        fMutex;       //! Protects the members below
+   std::condition_variable   fWorkCond;    //! Signals outputs ready for merging
+   std::condition_variable   fIdleCond;    //! Signals workers becoming idle
+   std::map<std::string, std::unique_ptr<TOutput>> fOutputs; //! Output files, by name
+   std::deque<TOutput *>     fReady;       //! Outputs with inputs waiting for being merged
+   Long64_t                  fPendingBytes{0};   // Received bytes waiting for being merged
+   Int_t                     fBusy{0};           // Number of workers merging an output
+   Bool_t                    fStop{kFALSE};      // Tells the workers to terminate
+
+   TParallelMergingServer(const TParallelMergingServer &) = delete;
+   TParallelMergingServer &operator=(const TParallelMergingServer &) = delete;
+
+   void     Enqueue(TMessage *mess);
+   void     MergeInputs(TOutput &output);
+   void     UpdateThrottling();
+   void     Work();
+   void     WaitIdle();
+
+public:
+   TParallelMergingServer(Int_t port = 1095, Int_t nthreads = 0, Long64_t maxPendingBytes = 512 * 1024 * 1024);
+   virtual ~TParallelMergingServer();
+
+   Bool_t   IsValid() const;
+   Bool_t   IsThrottling() const { return fThrottling; }
+   Int_t    GetNThrottlings() const { return fNThrottlings; }
+   Long64_t GetPendingBytes() const;
+   Int_t    GetNThreads() const { return fNThreads; }
+
+   void     SetCacheSize(Long64_t size) { fCacheSize = size; }
+   void     SetMaxClients(Int_t n) { fMaxClients = n; }
+   void     SetMergeThreshold(Float_t fraction) { fMergeThreshold = fraction; }
+
+   Int_t    Run();
+
+   ClassDefOverride(TParallelMergingServer, 0);  // Server merging the files uploaded by TParallelMergingFile clients on a thread pool
+};
+
+#endif // ROOT_TParallelMergingServer
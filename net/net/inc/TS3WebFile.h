@@ -83,9 +83,14 @@ protected:
    void SetAccessKey(const TString& accessKey) { fS3Request.SetAccessKey(accessKey); }
    void SetSecretKey(const TString& secretKey) { fS3Request.SetSecretKey(secretKey); }
 
+   Bool_t FetchBuffers(char* buf, Long64_t* pos, Int_t* len, Int_t nbuf) override;
+   TWebFile *NewConnection() override;
+
    // Data members
    TS3HTTPRequest fS3Request;      // S3 HTTP request
    Bool_t         fUseMultiRange;  // Is the S3 server capable of serving multirange requests?
+   TString        fPath;           // Path given to the constructor, used to open more connections
+   TString        fOptions;        // Options given to the constructor
 
 public:
    // Constructors & Destructor
@@ -99,9 +104,6 @@ public:
    const TString&  GetObjectKey() const { return fS3Request.GetObjectKey(); }
    const TUrl&     GetUrl() const { return fUrl; }
 
-   // Modifiers
-   Bool_t ReadBuffers(char* buf, Long64_t* pos, Int_t* len, Int_t nbuf) override;
-
    ClassDefOverride(TS3WebFile, 0)  // Read a ROOT file from a S3 server
 };
 
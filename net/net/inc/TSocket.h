@@ -131,6 +131,7 @@ public:
    virtual Bool_t        IsAuthenticated() const { return fSecContext ? kTRUE : kFALSE; }
    virtual Bool_t        IsValid() const { return fSocket < 0 ? kFALSE : kTRUE; }
    virtual Int_t         Recv(TMessage *&mess);
+   Int_t                 Recv(TMessage *&mess, void *buffer, Int_t size);
    virtual Int_t         Recv(Int_t &status, Int_t &kind);
    virtual Int_t         Recv(char *mess, Int_t max);
    virtual Int_t         Recv(char *mess, Int_t max, Int_t &kind);
@@ -26,8 +26,11 @@
 #include "TUrl.h"
 #include "TSystem.h"
 
+#include <vector>
+
 class TSocket;
 class TWebSocket;
+class TWebBlockCache;
 
 
 class TWebFile : public TFile {
@@ -53,6 +56,13 @@ protected:
    TString           fBasicUrlOrg;      // save original url in case of temp redirection
    void             *fFullCache;        //! complete content of the file, some http server may return complete content
    Long64_t          fFullCacheSize;    //! size of the cached content
+   TString           fETag;             //! ETag of the file returned by the server, validates the block cache
+   TString           fLastModified;     //! Last-Modified date of the file returned by the server
+   Bool_t            fUseBlockCache{kFALSE};     //! read the file through a local disk cache of blocks
+   TWebBlockCache   *fBlockCache{nullptr};       //! local disk cache of the blocks already read
+   Int_t             fParallel{1};               //! maximal number of connections used by large reads
+   Int_t             fParallelMinBytes{0};       //! size from which reads are split over several connections
+   std::vector<TWebFile *> fConnections;         //! additional connections for parallel reads
 
    static TUrl       fgProxy;           // globally set proxy URL
    static Long64_t   fgMaxFullCacheSize; // maximal size of full-cached content, 500 MB by default
@@ -71,6 +81,11 @@ protected:
    virtual Bool_t      ReadBuffers10(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf);
    virtual void        SetMsgReadBuffer10(const char *redirectLocation = nullptr, Bool_t tempRedirect = kFALSE);
    virtual void        ProcessHttpHeader(const TString& headerLine);
+   virtual Bool_t      FetchBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf);
+   virtual TWebFile   *NewConnection();
+           Bool_t      FetchParallel(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf);
+           Bool_t      ReadViaBlockCache(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf);
+           void        InitReadOptions(Option_t *opt);
 
 public:
    TWebFile(const char *url, Option_t *opt="");
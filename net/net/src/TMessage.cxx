@@ -67,9 +67,11 @@ TMessage::TMessage(UInt_t what, Int_t bufsiz) :
 ////////////////////////////////////////////////////////////////////////////////
 /// Create a TMessage object for reading objects. The objects will be
 /// read from buf. Use the What() method to get the message type.
+/// If adopt is false, buf is not deleted by the message and must stay
+/// valid as long as the message is used.
 
-TMessage::TMessage(void *buf, Int_t bufsize) : TBufferFile(TBuffer::kRead, bufsize, buf),
-                                               fCompress(ROOT::RCompressionSetting::EAlgorithm::kUseGlobal)
+TMessage::TMessage(void *buf, Int_t bufsize, Bool_t adopt) : TBufferFile(TBuffer::kRead, bufsize, buf, adopt),
+                                                             fCompress(ROOT::RCompressionSetting::EAlgorithm::kUseGlobal)
 {
    // skip space at the beginning of the message reserved for the message length
    fBufCur += sizeof(UInt_t);
@@ -86,7 +88,11 @@ TMessage::TMessage(void *buf, Int_t bufsize) : TBufferFile(TBuffer::kRead, bufsi
       // if buffer has kMESS_ZIP set, move it to fBufComp and uncompress
       fBufComp    = fBuffer;
       fBufCompCur = fBuffer + bufsize;
+      fBufCompSize  = bufsize;
+      fBufCompOwner = adopt;
       fBuffer     = nullptr;
+      // the uncompressed buffer is always allocated, and owned, by the message
+      SetBit(kIsOwner);
       Uncompress();
    }
 
@@ -105,7 +111,9 @@ TMessage::TMessage(void *buf, Int_t bufsize) : TBufferFile(TBuffer::kRead, bufsi
 
 TMessage::~TMessage()
 {
-   delete [] fBufComp;
+   if (fBufCompOwner)
+      delete [] fBufComp;
+   delete [] fBufCompSpare;
    delete fInfos;
 }
 
@@ -181,12 +189,10 @@ void TMessage::Reset()
    SetBufferOffset(sizeof(UInt_t) + sizeof(fWhat));
    ResetMap();
 
-   if (fBufComp) {
-      delete [] fBufComp;
-      fBufComp    = nullptr;
-      fBufCompCur = nullptr;
-      fCompPos    = nullptr;
-   }
+   ReleaseCompBuffer();
+
+   fAttached.clear();
+   fAttachedLength = 0;
 
    if (fgEvolution || fEvolution) {
       if (fInfos)
@@ -195,6 +201,68 @@ void TMessage::Reset()
    fBitsPIDs.ResetAllBits();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Drop the compressed buffer. The buffer is kept for the next compression
+/// of the message, so that a re-used message does not allocate it again.
+
+void TMessage::ReleaseCompBuffer()
+{
+   if (fBufComp && fBufCompOwner) {
+      if (fBufCompSize > fBufCompSpareSize) {
+         delete [] fBufCompSpare;
+         fBufCompSpare     = fBufComp;
+         fBufCompSpareSize = fBufCompSize;
+      } else {
+         delete [] fBufComp;
+      }
+   }
+   fBufComp      = nullptr;
+   fBufCompCur   = nullptr;
+   fCompPos      = nullptr;
+   fBufCompSize  = 0;
+   fBufCompOwner = kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Attach len bytes at buf to the message. They are sent after the content
+/// of the message, as if they had been written with WriteFastArray(), but
+/// TSocket::Send() passes them to the kernel without copying them into the
+/// message (or compresses them directly from buf). The buffer is not owned
+/// by the message and must stay unchanged until the message is sent; since
+/// attached buffers always follow the content, they must be attached after
+/// everything else has been written. Reset() detaches all buffers.
+
+void TMessage::AttachBuffer(const void *buf, Int_t len)
+{
+   if (!IsWriting()) {
+      Error("AttachBuffer", "cannot attach a buffer to a message used for reading");
+      return;
+   }
+   if (!buf || len <= 0)
+      return;
+   if (len > kMaxInt - Length() - fAttachedLength) {
+      Error("AttachBuffer", "message would exceed the maximal size of %d bytes", kMaxInt);
+      return;
+   }
+
+   ReleaseCompBuffer();
+   fAttached.emplace_back(static_cast<const char *>(buf), len);
+   fAttachedLength += len;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the attached buffers at the end of the message content, for the
+/// transports which send the message as one contiguous buffer.
+
+void TMessage::CopyAttachedBuffers()
+{
+   auto attached = std::move(fAttached);
+   fAttached.clear();
+   fAttachedLength = 0;
+   for (auto &buf : attached)
+      WriteFastArray(buf.first, buf.second);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the message length at the beginning of the message buffer.
 /// This method is only called by TSocket::Send().
@@ -202,6 +270,10 @@ void TMessage::Reset()
 void TMessage::SetLength() const
 {
    if (IsWriting()) {
+      // the transports using this method send the message as one buffer
+      if (!fAttached.empty())
+         const_cast<TMessage *>(this)->CopyAttachedBuffers();
+
       char *buf = Buffer();
       if (buf)
          tobuf(buf, (UInt_t)(Length() - sizeof(UInt_t)));
@@ -213,6 +285,25 @@ void TMessage::SetLength() const
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the message length, including the attached buffers, at the beginning
+/// of the message buffer. Only called by TSocket::Send(), which sends the
+/// attached buffers after the message buffer with a scatter-gather write.
+
+void TMessage::SetScatterLength() const
+{
+   if (IsWriting()) {
+      char *buf = Buffer();
+      if (buf)
+         tobuf(buf, (UInt_t)(Length() + fAttachedLength - sizeof(UInt_t)));
+
+      if (fBufComp) {
+         buf = fBufComp;
+         tobuf(buf, (UInt_t)(CompLength() - sizeof(UInt_t)));
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Using this method one can change the message type a-posteriori
 /// In case you OR "what" with kMESS_ACK, the message will wait for
@@ -250,10 +341,7 @@ void TMessage::SetCompressionAlgorithm(Int_t algorithm)
       newCompress = 100 * algorithm + level;
    }
    if (newCompress != fCompress && fBufComp) {
-      delete [] fBufComp;
-      fBufComp    = nullptr;
-      fBufCompCur = nullptr;
-      fCompPos    = nullptr;
+      ReleaseCompBuffer();
    }
    fCompress = newCompress;
 }
@@ -274,10 +362,7 @@ void TMessage::SetCompressionLevel(Int_t level)
       newCompress = 100 * algorithm + level;
    }
    if (newCompress != fCompress && fBufComp) {
-      delete [] fBufComp;
-      fBufComp    = nullptr;
-      fBufCompCur = nullptr;
-      fCompPos    = nullptr;
+      ReleaseCompBuffer();
    }
    fCompress = newCompress;
 }
@@ -288,10 +373,7 @@ void TMessage::SetCompressionLevel(Int_t level)
 void TMessage::SetCompressionSettings(Int_t settings)
 {
    if (settings != fCompress && fBufComp) {
-      delete [] fBufComp;
-      fBufComp    = nullptr;
-      fBufCompCur = nullptr;
-      fCompPos    = nullptr;
+      ReleaseCompBuffer();
    }
    fCompress = settings;
 }
@@ -310,10 +392,7 @@ Int_t TMessage::Compress()
    if (compressionLevel <= 0) {
       // no compression specified
       if (fBufComp) {
-         delete [] fBufComp;
-         fBufComp    = nullptr;
-         fBufCompCur = nullptr;
-         fCompPos    = nullptr;
+         ReleaseCompBuffer();
       }
       return 0;
    }
@@ -325,13 +404,10 @@ Int_t TMessage::Compress()
 
    // remove any existing compressed buffer before compressing modified message
    if (fBufComp) {
-      delete [] fBufComp;
-      fBufComp    = nullptr;
-      fBufCompCur = nullptr;
-      fCompPos    = nullptr;
+      ReleaseCompBuffer();
    }
 
-   if (Length() <= (Int_t)(256 + 2*sizeof(UInt_t))) {
+   if (Length() + fAttachedLength <= (Int_t)(256 + 2*sizeof(UInt_t))) {
       // this message is too small to be compressed
       return 0;
    }
@@ -341,34 +417,44 @@ Int_t TMessage::Compress()
       return -1;
    }
 
+   // the message content is followed by the attached buffers, compressed in place
    Int_t hdrlen   = 2*sizeof(UInt_t);
-   Int_t messlen  = Length() - hdrlen;
-   Int_t nbuffers = 1 + (messlen - 1) / kMAXZIPBUF;
+   std::vector<std::pair<const char *, Int_t>> segments;
+   segments.emplace_back(Buffer() + hdrlen, Length() - hdrlen);
+   segments.insert(segments.end(), fAttached.begin(), fAttached.end());
+
+   Int_t messlen  = Length() - hdrlen + fAttachedLength;
+   Int_t nbuffers = 0;
+   for (auto &seg : segments)
+      nbuffers += (seg.second > 0) ? 1 + (seg.second - 1) / kMAXZIPBUF : 0;
    Int_t chdrlen  = 3*sizeof(UInt_t);   // compressed buffer header length
    Int_t buflen   = std::max(512, chdrlen + messlen + 9*nbuffers);
-   fBufComp       = new char[buflen];
-   char *messbuf  = Buffer() + hdrlen;
+   if (fBufCompSpare && fBufCompSpareSize >= buflen) {
+      // re-use the buffer of the previous compression
+      fBufComp         = fBufCompSpare;
+      fBufCompSize     = fBufCompSpareSize;
+      fBufCompSpare    = nullptr;
+      fBufCompSpareSize = 0;
+   } else {
+      fBufComp     = new char[buflen];
+      fBufCompSize = buflen;
+   }
    char *bufcur   = fBufComp + chdrlen;
-   Int_t nzip     = 0;
    Int_t nout, bufmax;
-   for (Int_t i = 0; i < nbuffers; ++i) {
-      if (i == nbuffers - 1)
-         bufmax = messlen - nzip;
-      else
-         bufmax = kMAXZIPBUF;
-      R__zipMultipleAlgorithm(compressionLevel, &bufmax, messbuf, &bufmax, bufcur, &nout,
-                              static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(compressionAlgorithm));
-      if (nout == 0 || nout >= messlen) {
-         //this happens when the buffer cannot be compressed
-         delete [] fBufComp;
-         fBufComp    = nullptr;
-         fBufCompCur = nullptr;
-         fCompPos    = nullptr;
-         return -1;
+   for (auto &seg : segments) {
+      char *messbuf = const_cast<char *>(seg.first);
+      for (Int_t nzip = 0; nzip < seg.second; nzip += bufmax) {
+         bufmax = std::min(seg.second - nzip, (Int_t)kMAXZIPBUF);
+         Int_t srcsize = bufmax, tgtsize = bufmax;
+         R__zipMultipleAlgorithm(compressionLevel, &srcsize, messbuf + nzip, &tgtsize, bufcur, &nout,
+                                 static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(compressionAlgorithm));
+         if (nout == 0 || nout >= messlen) {
+            //this happens when the buffer cannot be compressed
+            ReleaseCompBuffer();
+            return -1;
+         }
+         bufcur  += nout;
       }
-      bufcur  += nout;
-      messbuf += kMAXZIPBUF;
-      nzip    += kMAXZIPBUF;
    }
    fBufCompCur = bufcur;
    fCompPos    = fBufCur;
@@ -377,7 +463,7 @@ Int_t TMessage::Compress()
    tobuf(bufcur, (UInt_t)(CompLength() - sizeof(UInt_t)));
    Int_t what = fWhat | kMESS_ZIP;
    tobuf(bufcur, what);
-   tobuf(bufcur, Length());    // original uncompressed buffer length
+   tobuf(bufcur, Length() + fAttachedLength);    // original uncompressed buffer length
 
    return 0;
 }
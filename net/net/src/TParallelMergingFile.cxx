@@ -118,7 +118,9 @@ Bool_t TParallelMergingFile::UploadAndReset()
    fMessage.WriteInt(fServerIdx);
    fMessage.WriteTString(GetName());
    fMessage.WriteLong64(GetEND());
-   CopyTo(fMessage);
+   // the memory blocks of the file are sent as they are, without copying them into the message
+   for (auto &block : GetBlocks())
+      fMessage.AttachBuffer(block.fStart, (Int_t)block.fSize);
 
    // FIXME: CXX17: Use init-statement in if to declare `error` variable
    int error;
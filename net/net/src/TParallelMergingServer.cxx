@@ -0,0 +1,571 @@
+// @(#)root/net:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/**
+\class TParallelMergingServer
+\ingroup net
+
+Server merging the files uploaded by TParallelMergingFile clients.
+
+This is the production version of the tutorial parallelMergeServer.C. The main
+thread accepts the connections of the clients and receives their uploads, the
+merging itself is done by a pool of threads: uploads for different output files
+are merged concurrently, the uploads for the same output file are merged in the
+order in which they were received, one thread at a time.
+
+The received data are kept in memory until they are merged. When the amount of
+pending data exceeds maxPendingBytes, the server stops reading from the client
+sockets until half of it is merged; the clients are then blocked by the TCP flow
+control in TParallelMergingFile::UploadAndReset, and the memory of the server is
+bounded whatever the rate at which the clients upload.
+
+The resetable objects (like TTree) are merged into the output as soon as they
+are received, the other objects are merged when enough clients reported (see
+SetMergeThreshold) and finally when all the clients finished. The output files
+are therefore written incrementally.
+
+~~~{.cpp}
+   TParallelMergingServer server(1095, 4);
+   if (server.IsValid())
+      server.Run();   // returns when all the clients finished
+~~~
+
+The clients open their output with TFile::Open("output.root?pmerge=host:1095", "RECREATE"),
+this works as well for the outputs of multi-process RDataFrame jobs (Snapshot).
+*/
+
+#include "TParallelMergingServer.h"
+
+#include "TBits.h"
+#include "TClass.h"
+#include "TError.h"
+#include "TFileCacheWrite.h"
+#include "TFileMerger.h"
+#include "TKey.h"
+#include "TMath.h"
+#include "TMemFile.h"
+#include "TMessage.h"
+#include "TMonitor.h"
+#include "TROOT.h"
+#include "TServerSocket.h"
+#include "TSystem.h"
+#include "TTimeStamp.h"
+
+#include <utility>
+
+ClassImp(TParallelMergingServer);
+
+namespace {
+
+enum EStatusKind {
+   kStartConnection = 0,
+   kProtocol = 1
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if the directory contains any object which is reset after merge (like TTree).
+
+Bool_t NeedInitialMerge(TDirectory *dir)
+{
+   if (!dir)
+      return kFALSE;
+
+   TIter nextkey(dir->GetListOfKeys());
+   while (auto key = (TKey *)nextkey()) {
+      TClass *cl = TClass::GetClass(key->GetClassName());
+      if (!cl)
+         continue;
+      if (cl->InheritsFrom(TDirectory::Class())) {
+         auto subdir = (TDirectory *)dir->GetList()->FindObject(key->GetName());
+         if (!subdir)
+            subdir = (TDirectory *)key->ReadObj();
+         if (NeedInitialMerge(subdir))
+            return kTRUE;
+      } else if (cl->GetResetAfterMerge()) {
+         return kTRUE;
+      }
+   }
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete from the directory the keys of the objects which are reset after
+/// merge (withReset) or of the objects which are not.
+
+void DeleteObjects(TDirectory *dir, Bool_t withReset)
+{
+   if (!dir)
+      return;
+
+   TIter nextkey(dir->GetListOfKeys());
+   while (auto key = (TKey *)nextkey()) {
+      TClass *cl = TClass::GetClass(key->GetClassName());
+      if (!cl)
+         continue;
+      if (cl->InheritsFrom(TDirectory::Class())) {
+         auto subdir = (TDirectory *)dir->GetList()->FindObject(key->GetName());
+         if (!subdir)
+            subdir = (TDirectory *)key->ReadObj();
+         DeleteObjects(subdir, withReset);
+      } else if (withReset == (cl->GetResetAfterMerge() != nullptr)) {
+         key->Delete();
+         dir->GetListOfKeys()->Remove(key);
+         delete key;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy the keys of source into destination, replacing the keys with the same name.
+
+void MigrateKeys(TDirectory *destination, TDirectory *source)
+{
+   if (!destination || !source)
+      return;
+
+   TIter nextkey(source->GetListOfKeys());
+   while (auto key = (TKey *)nextkey()) {
+      TClass *cl = TClass::GetClass(key->GetClassName());
+      if (cl && cl->InheritsFrom(TDirectory::Class())) {
+         auto source_subdir = (TDirectory *)source->GetList()->FindObject(key->GetName());
+         if (!source_subdir)
+            source_subdir = (TDirectory *)key->ReadObj();
+         TDirectory *destination_subdir = destination->GetDirectory(key->GetName());
+         if (!destination_subdir)
+            destination_subdir = destination->mkdir(key->GetName());
+         MigrateKeys(destination_subdir, source_subdir);
+      } else {
+         if (TKey *oldkey = destination->GetKey(key->GetName())) {
+            oldkey->Delete();
+            delete oldkey;
+         }
+         auto newkey = new TKey(destination, *key, 0 /* pidoffset */); // the files come from the same client
+         destination->GetFile()->SumBuffer(newkey->GetObjlen());
+         newkey->WriteFile(0);
+         if (destination->GetFile()->TestBit(TFile::kWriteError))
+            return;
+      }
+   }
+   destination->SaveSelf();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Latest content uploaded by one client for one output file.
+
+struct TClientInfo {
+   std::unique_ptr<TFile> fFile;           // Accumulated content of the client
+   UInt_t     fContactsCount{0};           // Number of uploads
+   TTimeStamp fLastContact;                // Time of the last upload
+   Double_t   fTimeSincePrevContact{0};    // Time between the two last uploads (seconds)
+
+   void Set(TFile *file)
+   {
+      if (file != fFile.get()) {
+         if (fFile) {
+            // keep the keys of the previous uploads which are not in this one
+            MigrateKeys(fFile.get(), file);
+            delete file;
+         } else {
+            fFile.reset(file);
+         }
+      }
+      TTimeStamp now;
+      fTimeSincePrevContact = now.AsDouble() - fLastContact.AsDouble();
+      fLastContact = now;
+      ++fContactsCount;
+   }
+};
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// One output file, the content of its clients and the uploads waiting for being merged.
+/// The members except fInputs and fScheduled are only used by the thread merging it.
+
+struct TParallelMergingServer::TOutput {
+   struct TInput {
+      std::unique_ptr<TMessage> fMessage;  // Received message, owning the uploaded content
+      Int_t    fClientId{0};               // Index of the client given at connection
+      Long64_t fOffset{0};                 // Offset of the file content in the message buffer
+      Long64_t fLength{0};                 // Length of the file content
+   };
+
+   TString                   fFilename;            // Name of the output file
+   std::unique_ptr<TFileMerger> fMerger;           // Merger writing into the output file, created on first merge
+   std::vector<TClientInfo>  fClients;             // Content of the clients, indexed by client id
+   TBits                     fClientsContact;      // Clients which uploaded since the last merge
+   UInt_t                    fNClientsContact{0};  // Number of uploads since the last merge
+   TTimeStamp                fLastMerge;           // Time of the last merge
+   std::deque<TInput>        fInputs;              // Uploads waiting for being merged, protected by the server mutex
+   Bool_t                    fScheduled{kFALSE};   // True when queued or being merged, protected by the server mutex
+
+   TOutput(const char *filename) : fFilename(filename) {}
+
+   Bool_t Open(Long64_t cachesize)
+   {
+      if (fMerger)
+         return kTRUE;
+      fMerger.reset(new TFileMerger(kFALSE, kTRUE));
+      fMerger->SetPrintLevel(0);
+      if (!fMerger->OutputFile(fFilename, "RECREATE")) {
+         ::Error("TParallelMergingServer::TOutput::Open", "cannot open output file %s", fFilename.Data());
+         fMerger.reset();
+         return kFALSE;
+      }
+      if (cachesize > 0)
+         new TFileCacheWrite(fMerger->GetOutputFile(), cachesize);
+      return kTRUE;
+   }
+
+   Bool_t InitialMerge(TFile *input)
+   {
+      // copy the resetable objects into the output and remove them from the input
+      fMerger->AddFile(input);
+      Bool_t result = fMerger->PartialMerge(TFileMerger::kIncremental | TFileMerger::kResetable);
+      DeleteObjects(input, kTRUE);
+      return result;
+   }
+
+   void RegisterClient(UInt_t clientId, TFile *file)
+   {
+      ++fNClientsContact;
+      fClientsContact.SetBitNumber(clientId);
+      if (fClients.size() < clientId + 1)
+         fClients.resize(clientId + 1);
+      fClients[clientId].Set(file);
+   }
+
+   Bool_t NeedFinalMerge() const { return fClientsContact.CountBits() > 0; }
+
+   Bool_t NeedMerge(Float_t clientThreshold) const
+   {
+      UInt_t nclients = 0;
+      Double_t sum = 0, sum2 = 0;
+      for (auto &client : fClients) {
+         if (!client.fFile)
+            continue;
+         ++nclients;
+         sum += client.fTimeSincePrevContact;
+         sum2 += client.fTimeSincePrevContact * client.fTimeSincePrevContact;
+      }
+      if (nclients == 0)
+         return kFALSE;
+
+      // merge when the slowest clients should have reported
+      Double_t avg = sum / nclients;
+      Double_t sigma = sum2 ? TMath::Sqrt(TMath::Max(0., sum2 / nclients - avg * avg)) : 0;
+      TTimeStamp now;
+      if ((now.AsDouble() - fLastMerge.AsDouble()) > avg + 2 * sigma)
+         return kTRUE;
+
+      Float_t cut = clientThreshold * nclients;
+      return fClientsContact.CountBits() > cut || fNClientsContact > 2 * cut;
+   }
+
+   Bool_t Merge()
+   {
+      // remove the objects which cannot be merged incrementally and are not reset by the clients
+      DeleteObjects(fMerger->GetOutputFile(), kFALSE);
+      for (auto &client : fClients)
+         if (client.fFile)
+            fMerger->AddFile(client.fFile.get());
+      Bool_t result = fMerger->PartialMerge(TFileMerger::kAllIncremental);
+      // keep only the objects which always need to be re-merged (histograms)
+      for (auto &client : fClients)
+         if (client.fFile)
+            DeleteObjects(client.fFile.get(), kTRUE);
+      fLastMerge = TTimeStamp();
+      fNClientsContact = 0;
+      fClientsContact.Clear();
+      return result;
+   }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a server listening on port, merging with nthreads threads
+/// (0 for the number of cores) and throttling clients when more than
+/// maxPendingBytes received bytes wait for being merged.
+
+TParallelMergingServer::TParallelMergingServer(Int_t port, Int_t nthreads, Long64_t maxPendingBytes)
+   : fNThreads(nthreads > 0 ? nthreads : TMath::Max(1, (Int_t)std::thread::hardware_concurrency())),
+     fMaxPendingBytes(maxPendingBytes)
+{
+   fServerSocket = new TServerSocket(port, kTRUE, 100);
+   if (!fServerSocket->IsValid()) {
+      Error("TParallelMergingServer", "cannot listen on port %d", port);
+      return;
+   }
+   fMonitor = new TMonitor;
+   fMonitor->Add(fServerSocket);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor, stops the merging threads and closes the outputs.
+
+TParallelMergingServer::~TParallelMergingServer()
+{
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fStop = kTRUE;
+   }
+   fWorkCond.notify_all();
+   for (auto &worker : fWorkers)
+      worker.join();
+   fOutputs.clear();
+
+   if (fMonitor) {
+      fMonitor->RemoveAll();
+      delete fMonitor;
+   }
+   delete fServerSocket;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if the server socket is listening.
+
+Bool_t TParallelMergingServer::IsValid() const
+{
+   return fServerSocket && fServerSocket->IsValid() && fMonitor;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of received bytes waiting for being merged.
+
+Long64_t TParallelMergingServer::GetPendingBytes() const
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   return fPendingBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Queue an upload message for merging into its output file.
+
+void TParallelMergingServer::Enqueue(TMessage *mess)
+{
+   TOutput::TInput input;
+   input.fMessage.reset(mess);
+
+   TString filename;
+   mess->ReadInt(input.fClientId);
+   mess->ReadTString(filename);
+   mess->ReadLong64(input.fLength);
+   input.fOffset = mess->Length();
+
+   if (input.fLength < 0 || input.fOffset + input.fLength > mess->BufferSize()) {
+      Error("Enqueue", "invalid upload from client %d for %s", input.fClientId, filename.Data());
+      return;
+   }
+
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      auto &output = fOutputs[filename.Data()];
+      if (!output)
+         output.reset(new TOutput(filename));
+      fPendingBytes += input.fLength;
+      output->fInputs.emplace_back(std::move(input));
+      if (!output->fScheduled) {
+         output->fScheduled = kTRUE;
+         fReady.push_back(output.get());
+      }
+   }
+   fWorkCond.notify_one();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Merge the queued uploads of one output, called by the merging threads.
+
+void TParallelMergingServer::MergeInputs(TOutput &output)
+{
+   std::deque<TOutput::TInput> inputs;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      inputs.swap(output.fInputs);
+   }
+
+   Long64_t merged = 0;
+   Bool_t opened = output.Open(fCacheSize);
+
+   for (auto &input : inputs) {
+      merged += input.fLength;
+      if (!opened)
+         continue;
+      // UPDATE because the resetable objects are removed after being merged
+      auto transient = new TMemFile(output.fFilename, input.fMessage->Buffer() + input.fOffset, input.fLength, "UPDATE");
+      input.fMessage.reset();
+      if (NeedInitialMerge(transient))
+         output.InitialMerge(transient);
+      output.RegisterClient(input.fClientId, transient);
+   }
+
+   if (opened && output.NeedMerge(fMergeThreshold)) {
+      if (gDebug > 0)
+         Info("MergeInputs", "merging input from %d clients into %s", (Int_t)output.fClients.size(),
+              output.fFilename.Data());
+      output.Merge();
+   }
+
+   std::lock_guard<std::mutex> lock(fMutex);
+   fPendingBytes -= merged;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Loop of the merging threads.
+
+void TParallelMergingServer::Work()
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   while (true) {
+      fWorkCond.wait(lock, [this] { return fStop || !fReady.empty(); });
+      if (fReady.empty())
+         return;
+
+      TOutput *output = fReady.front();
+      fReady.pop_front();
+      ++fBusy;
+
+      lock.unlock();
+      MergeInputs(*output);
+      lock.lock();
+
+      --fBusy;
+      if (!output->fInputs.empty())
+         fReady.push_back(output); // received while merging, still scheduled
+      else
+         output->fScheduled = kFALSE;
+      fIdleCond.notify_all();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait until all the received uploads are merged.
+
+void TParallelMergingServer::WaitIdle()
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   fIdleCond.wait(lock, [this] { return fReady.empty() && fBusy == 0; });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stop reading the client sockets when too much data waits for being merged,
+/// resume when half of it was merged.
+
+void TParallelMergingServer::UpdateThrottling()
+{
+   Long64_t pending = GetPendingBytes();
+
+   if (!fThrottling && fMaxPendingBytes > 0 && pending > fMaxPendingBytes) {
+      if (gDebug > 0)
+         Info("UpdateThrottling", "%lld bytes waiting for merge, throttling clients", pending);
+      fThrottling = kTRUE;
+      ++fNThrottlings;
+      fMonitor->DeActivateAll();
+      if (fServerSocket->IsValid())
+         fMonitor->Activate(fServerSocket);
+   } else if (fThrottling && pending <= fMaxPendingBytes / 2) {
+      fThrottling = kFALSE;
+      fMonitor->ActivateAll();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Serve the clients until all of them finished, then do the final merge
+/// and close the output files. Returns the number of served clients, -1 in
+/// case of error.
+
+Int_t TParallelMergingServer::Run()
+{
+   if (!IsValid())
+      return -1;
+
+   ROOT::EnableThreadSafety();
+
+   for (Int_t n = (Int_t)fWorkers.size(); n < fNThreads; ++n)
+      fWorkers.emplace_back(&TParallelMergingServer::Work, this);
+
+   Int_t clientCount = 0, clientIndex = 0;
+
+   while (true) {
+      UpdateThrottling();
+
+      TSocket *s = fMonitor->Select(fThrottling ? 100 : 1000);
+      if (!s || s == (TSocket *)-1)
+         continue;
+
+      if (s == fServerSocket) {
+         TSocket *client = fServerSocket->Accept();
+         if (!client || client == (TSocket *)-1)
+            continue;
+         if (clientCount >= fMaxClients) {
+            Warning("Run", "only %d client connections accepted, refusing new one", fMaxClients);
+            client->Close();
+            delete client;
+            continue;
+         }
+         client->Send(clientIndex, kStartConnection);
+         client->Send(kProtocolVersion, kProtocol);
+         ++clientCount;
+         ++clientIndex;
+         fMonitor->Add(client);
+         if (fThrottling)
+            fMonitor->DeActivate(client);
+         if (gDebug > 0)
+            Info("Run", "accepted connection %d", clientIndex);
+         continue;
+      }
+
+      TMessage *mess = nullptr;
+      Int_t n = s->Recv(mess);
+
+      Bool_t finished = kFALSE;
+      if (n <= 0 || !mess) {
+         Error("Run", "connection to a client lost");
+         finished = kTRUE;
+      } else if (mess->What() == kMESS_ANY) {
+         Enqueue(mess);
+         mess = nullptr;
+      } else if (mess->What() == kMESS_STRING) {
+         // "Finished"
+         finished = kTRUE;
+      }
+      delete mess;
+
+      if (finished) {
+         fMonitor->Remove(s);
+         s->Close();
+         delete s;
+         if (--clientCount == 0)
+            break;
+      }
+   }
+
+   WaitIdle();
+
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fStop = kTRUE;
+   }
+   fWorkCond.notify_all();
+   for (auto &worker : fWorkers)
+      worker.join();
+   fWorkers.clear();
+   fStop = kFALSE;
+
+   for (auto &entry : fOutputs) {
+      TOutput &output = *entry.second;
+      if (output.fMerger && output.NeedFinalMerge())
+         output.Merge();
+   }
+   fOutputs.clear();
+
+   fThrottling = kFALSE;
+   fMonitor->ActivateAll();
+
+   return clientIndex;
+}
@@ -150,8 +150,10 @@ ClassImp(TS3WebFile);
 /// any unidentified user to read the file.
 
 TS3WebFile::TS3WebFile(const char* path, Option_t* options)
-           : TWebFile(path, "IO")
+           : TWebFile(path, "IO"), fPath(path), fOptions(options)
 {
+   InitReadOptions(options);
+
    // Make sure this is a valid S3 path. We accept 'as3' as a scheme, for
    // backwards compatibility
    Bool_t doMakeZombie = kFALSE;
@@ -308,16 +310,16 @@ void TS3WebFile::SetMsgReadBuffer10(const char* redirectLocation, Bool_t tempRed
 
 ////////////////////////////////////////////////////////////////////////////////
 
-Bool_t TS3WebFile::ReadBuffers(char* buf, Long64_t* pos, Int_t* len, Int_t nbuf)
+Bool_t TS3WebFile::FetchBuffers(char* buf, Long64_t* pos, Int_t* len, Int_t nbuf)
 {
-   // Overwrites TWebFile::ReadBuffers() for reading specified byte ranges.
+   // Overwrites TWebFile::FetchBuffers() for reading specified byte ranges.
    // According to the kind of server this file is hosted by, we use a
    // single HTTP request with a muti-range header or we generate multiple
    // requests with a single range each.
 
    // Does this server support multi-range GET requests?
    if (fUseMultiRange)
-      return TWebFile::ReadBuffers(buf, pos, len, nbuf);
+      return TWebFile::FetchBuffers(buf, pos, len, nbuf);
 
    // Send multiple GET requests with a single range of bytes
    // Adapted from original version by Wang Lu
@@ -333,6 +335,23 @@ Bool_t TS3WebFile::ReadBuffers(char* buf, Long64_t* pos, Int_t* len, Int_t nbuf)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Overwrites TWebFile::NewConnection() for opening the additional
+/// connections of the parallel reads with the same credentials as this file.
+
+TWebFile* TS3WebFile::NewConnection()
+{
+   TString options = fOptions;
+   options.ReplaceAll("BLOCKCACHE", "");
+   auto conn = new TS3WebFile(fPath, options);
+   if (conn->IsZombie()) {
+      delete conn;
+      return nullptr;
+   }
+   return conn;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This method is called by the super-class TWebFile when a HTTP header
 /// for this file is retrieved. We scan the 'Server' header to detect the
@@ -36,6 +36,8 @@
 #include "TStreamerInfo.h"
 #include "TProcessID.h"
 
+#include <vector>
+
 
 ULong64_t TSocket::fgBytesSent = 0;
 ULong64_t TSocket::fgBytesRecv = 0;
@@ -518,6 +520,8 @@ Int_t TSocket::Send(const char *str, Int_t kind)
 /// Returns -5 if pipe broken or reset by peer (EPIPE || ECONNRESET).
 /// support for streaming TStreamerInfo added by Rene Brun May 2008
 /// support for streaming TProcessID added by Rene Brun June 2008
+/// Buffers attached with TMessage::AttachBuffer() are sent after the message
+/// in the same scatter-gather write, or compressed directly from their memory.
 
 Int_t TSocket::Send(const TMessage &mess)
 {
@@ -536,7 +540,12 @@ Int_t TSocket::Send(const TMessage &mess)
    // send the process id's so TRefs work
    SendProcessIDs(mess);
 
-   mess.SetLength();   //write length in first word of buffer
+   // buffers attached to the message are sent after it without copying them
+   Bool_t scatter = mess.GetAttachedLength() > 0;
+   if (scatter)
+      mess.SetScatterLength();
+   else
+      mess.SetLength();   //write length in first word of buffer
 
    if (GetCompressionLevel() > 0 && mess.GetCompressionLevel() == 0)
       const_cast<TMessage&>(mess).SetCompressionSettings(fCompress);
@@ -549,11 +558,23 @@ Int_t TSocket::Send(const TMessage &mess)
    if (mess.CompBuffer()) {
       mbuf = mess.CompBuffer();
       mlen = mess.CompLength();
+      scatter = kFALSE;
    }
 
    ResetBit(TSocket::kBrokenConn);
    Int_t nsent;
-   if ((nsent = gSystem->SendRaw(fSocket, mbuf, mlen, 0)) <= 0) {
+   if (scatter) {
+      std::vector<const void *> bufs(1, mbuf);
+      std::vector<int> lens(1, mlen);
+      for (auto &buf : mess.fAttached) {
+         bufs.push_back(buf.first);
+         lens.push_back(buf.second);
+      }
+      nsent = gSystem->SendRawBuffers(fSocket, bufs.data(), lens.data(), bufs.size(), 0);
+   } else {
+      nsent = gSystem->SendRaw(fSocket, mbuf, mlen, 0);
+   }
+   if (nsent <= 0) {
       if (nsent == -5) {
          // Connection reset by peer or broken
          MarkBrokenConnection();
@@ -816,6 +837,20 @@ Int_t TSocket::Recv(Int_t &status, Int_t &kind)
 /// or reset by peer (EPIPE || ECONNRESET). In those case mess == 0.
 
 Int_t TSocket::Recv(TMessage *&mess)
+{
+   return Recv(mess, nullptr, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Receive a TMessage object into the user provided buffer of size bytes.
+/// The message is read directly into buffer when it fits, the returned
+/// TMessage then does not own buffer, which must stay valid as long as the
+/// message is used. A larger message is read into a buffer allocated as by
+/// Recv(TMessage *&). Compressed messages are uncompressed into a buffer owned
+/// by the message. The user must delete the TMessage object. Returns the same
+/// values as Recv(TMessage *&).
+
+Int_t TSocket::Recv(TMessage *&mess, void *buffer, Int_t size)
 {
    TSystem::ResetErrno();
 
@@ -839,13 +874,15 @@ oncemore:
    len = net2host(len);  //from network to host byte order
 
    ResetBit(TSocket::kBrokenConn);
-   char *buf = new char[len+sizeof(UInt_t)];
+   Bool_t adopt = !buffer || (ULong64_t)len + sizeof(UInt_t) > (ULong64_t)size;
+   char *buf = adopt ? new char[len+sizeof(UInt_t)] : static_cast<char *>(buffer);
    if ((n = gSystem->RecvRaw(fSocket, buf+sizeof(UInt_t), len, 0)) <= 0) {
       if (n == 0 || n == -5) {
          // Connection closed, reset or broken
          MarkBrokenConnection();
       }
-      delete [] buf;
+      if (adopt)
+         delete [] buf;
       mess = 0;
       return n;
    }
@@ -853,7 +890,7 @@ oncemore:
    fBytesRecv  += n + sizeof(UInt_t);
    fgBytesRecv += n + sizeof(UInt_t);
 
-   mess = new TMessage(buf, len+sizeof(UInt_t));
+   mess = new TMessage(buf, len+sizeof(UInt_t), adopt);
 
    // receive any streamer infos
    if (RecvStreamerInfos(mess))
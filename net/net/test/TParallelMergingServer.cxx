@@ -0,0 +1,119 @@
+#include "gtest/gtest.h"
+
+#include "TFile.h"
+#include "TH1D.h"
+#include "TParallelMergingServer.h"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kNClients = 4;
+constexpr int kNUploads = 3;
+constexpr int kNEntriesPerUpload = 1000;
+
+/// Create a server on the first free port from 19095
+std::unique_ptr<TParallelMergingServer> MakeServer(Long64_t maxPendingBytes, int &port)
+{
+   for (port = 19095; port < 19195; ++port) {
+      auto server = std::make_unique<TParallelMergingServer>(port, 2, maxPendingBytes);
+      if (server->IsValid())
+         return server;
+   }
+   return nullptr;
+}
+
+/// Fill a histogram and a tree in the output, uploading them several times: the histogram is uploaded with its
+/// accumulated content, the entries of the tree since the previous upload
+void RunClient(const std::string &url, int clientIdx, std::atomic<int> &nConnected)
+{
+   std::unique_ptr<TFile> file(TFile::Open(url.c_str(), "RECREATE"));
+   ASSERT_NE(file, nullptr);
+   ASSERT_TRUE(file->InheritsFrom("TParallelMergingFile"));
+
+   auto h = new TH1D("h", "h", 10, 0, 10);
+   auto tree = new TTree("tree", "tree");
+   int value = 0;
+   tree->Branch("value", &value);
+
+   for (int upload = 0; upload < kNUploads; ++upload) {
+      for (int i = 0; i < kNEntriesPerUpload; ++i) {
+         value = clientIdx;
+         h->Fill(clientIdx + 0.5);
+         tree->Fill();
+      }
+      file->Write();
+      if (upload == 0) {
+         // the server stops when all the connected clients finished: connect all of them first
+         ++nConnected;
+         while (nConnected < kNClients)
+            std::this_thread::yield();
+      }
+   }
+   file->Close();
+}
+
+void RunMerge(Long64_t maxPendingBytes, bool expectThrottling)
+{
+   ROOT::EnableThreadSafety();
+
+   int port = 0;
+   auto server = MakeServer(maxPendingBytes, port);
+   ASSERT_NE(server, nullptr);
+
+   const std::string output = "TParallelMergingServerTest_" + std::to_string(gSystem->GetPid()) + ".root";
+   const std::string url = output + "?pmerge=localhost:" + std::to_string(port);
+
+   Int_t nServed = 0;
+   std::thread serverThread([&] { nServed = server->Run(); });
+
+   std::atomic<int> nConnected{0};
+   std::vector<std::thread> clients;
+   for (int i = 0; i < kNClients; ++i)
+      clients.emplace_back(RunClient, url, i, std::ref(nConnected));
+   for (auto &client : clients)
+      client.join();
+   serverThread.join();
+
+   EXPECT_EQ(nServed, kNClients);
+   if (expectThrottling)
+      EXPECT_GT(server->GetNThrottlings(), 0);
+   else
+      EXPECT_EQ(server->GetNThrottlings(), 0);
+
+   std::unique_ptr<TFile> merged(TFile::Open(output.c_str()));
+   ASSERT_NE(merged, nullptr);
+   auto h = merged->Get<TH1D>("h");
+   ASSERT_NE(h, nullptr);
+   EXPECT_EQ(h->GetEntries(), kNClients * kNUploads * kNEntriesPerUpload);
+   for (int i = 0; i < kNClients; ++i)
+      EXPECT_EQ(h->GetBinContent(i + 1), kNUploads * kNEntriesPerUpload);
+   auto tree = merged->Get<TTree>("tree");
+   ASSERT_NE(tree, nullptr);
+   EXPECT_EQ(tree->GetEntries(), kNClients * kNUploads * kNEntriesPerUpload);
+   for (int i = 0; i < kNClients; ++i)
+      EXPECT_EQ(tree->GetEntries(("value==" + std::to_string(i)).c_str()), kNUploads * kNEntriesPerUpload);
+
+   merged.reset();
+   gSystem->Unlink(output.c_str());
+}
+
+} // namespace
+
+TEST(TParallelMergingServer, MergeClients)
+{
+   RunMerge(512 * 1024 * 1024, /*expectThrottling=*/false);
+}
+
+// With a tiny limit on the pending bytes, the clients are throttled at each upload
+TEST(TParallelMergingServer, BackPressure)
+{
+   RunMerge(1, /*expectThrottling=*/true);
+}
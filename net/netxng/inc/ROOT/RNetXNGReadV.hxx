@@ -0,0 +1,83 @@
+// @(#)root/netxng:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef NET_NETXNG_INC_ROOT_RNETXNGREADV_HXX_
+#define NET_NETXNG_INC_ROOT_RNETXNGREADV_HXX_
+
+#include <RtypesCore.h>
+
+#include <memory>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace NetXNG {
+
+/// A chunk of a vector read: fLength bytes at fOffset in the file, read into fBuffer
+struct RReadVChunk {
+   Long64_t fOffset;
+   Int_t fLength;
+   char *fBuffer;
+};
+
+using ReadVChunkList_t = std::vector<RReadVChunk>;
+
+/// Return the index of the first chunk after `first` which cannot be read together with the previous ones because
+/// it starts before their end or more than `maxGap` bytes after it; `end` is set to the end of the merged range
+Int_t MergeChunks(const Long64_t *position, const Int_t *length, Int_t first, Int_t nbuffs, Int_t maxGap,
+                  Long64_t &end);
+
+/// Append to `lists` the chunks reading `length` bytes at `offset` into `buffer`, honoring the server limits on the
+/// size of a chunk (`iorMax`) and on the number of chunks of a vector read (`iovMax`)
+void AddChunks(std::vector<ReadVChunkList_t> &lists, Long64_t offset, Long64_t length, char *buffer, Int_t iorMax,
+               Int_t iovMax);
+
+/** \class RReadVPlan RNetXNGReadV.hxx
+
+The vector reads filling a user buffer with scattered chunks of a file, as done by TNetXNGFile::ReadBuffers().
+Chunks separated by at most `maxGap` bytes are read as one range into a temporary buffer, from which they are
+copied into the user buffer by CopyPieces() once the vector reads completed.
+*/
+class RReadVPlan {
+public:
+   /// A piece of a merged range, copied to the user buffer after the read
+   struct RPiece {
+      char *fTo;
+      const char *fFrom;
+      Int_t fLength;
+   };
+
+private:
+   std::vector<ReadVChunkList_t> fLists;
+   std::vector<std::unique_ptr<char[]>> fGapBuffers;
+   std::vector<RPiece> fPieces;
+   Long64_t fBytes = 0;
+   Long64_t fExtraBytes = 0;
+
+public:
+   RReadVPlan(char *buffer, const Long64_t *position, const Int_t *length, Int_t nbuffs, Int_t maxGap, Int_t iorMax,
+              Int_t iovMax);
+
+   /// The chunk lists, each to be sent as one vector read
+   const std::vector<ReadVChunkList_t> &GetLists() const { return fLists; }
+   const std::vector<RPiece> &GetPieces() const { return fPieces; }
+   /// The number of bytes copied to the user buffer
+   Long64_t GetBytes() const { return fBytes; }
+   /// The number of bytes read in the gaps between the chunks
+   Long64_t GetExtraBytes() const { return fExtraBytes; }
+
+   void CopyPieces() const;
+};
+
+} // namespace NetXNG
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -23,6 +23,7 @@
 
 #include "TFile.h"
 #include "TSemaphore.h"
+#include <vector>
 #ifndef __CLING__
 #include <XrdCl/XrdClFileSystem.hh>
 #endif
@@ -32,6 +33,7 @@ namespace XrdCl {
    class URL;
 }
 class XrdSysCondVar;
+class TNetXNGReadahead;
 
 #ifdef __CLING__
 namespace XrdCl {
@@ -51,12 +53,16 @@ private:
    Int_t                   fReadvIorMax; // Max size of a single readv chunk
    Int_t                   fReadvIovMax; // Max number of readv chunks
    Int_t                   fQueryReadVParams;
+   Int_t                   fReadvGap;    // Max gap between coalesced readv chunks
+   TNetXNGReadahead       *fReadahead;   // Blocks read asynchronously, read statistics
    TString                 fNewUrl;
 
 public:
+   enum { kReadLatencyBins = 16 }; // Number of bins of the read latency histogram
+
    TNetXNGFile() : TFile(),
       fFile(nullptr), fUrl(nullptr), fMode(XrdCl::OpenFlags::None), fInitCondVar(nullptr),
-      fReadvIorMax(0), fReadvIovMax(0) {}
+      fReadvIorMax(0), fReadvIovMax(0), fQueryReadVParams(1), fReadvGap(0), fReadahead(nullptr) {}
    TNetXNGFile(const char *url, const char *lurl, Option_t *mode, const char *title,
                Int_t compress, Int_t netopt, Bool_t parallelopen);
    TNetXNGFile(const char *url, Option_t *mode = "", const char *title = "",
@@ -77,12 +83,18 @@ public:
    Bool_t   ReadBuffer(char *buffer, Long64_t position, Int_t length) override;
    Bool_t   ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
                         Int_t nbuffs) override;
+   Bool_t   ReadBufferAsync(Long64_t offset, Int_t length) override;
    TString  GetNewUrl() override { return fNewUrl; }
 
+   Long64_t              GetBytesInFlight() const;
+   std::vector<Long64_t> GetReadLatencyCounts() const;
+
 private:
    virtual Bool_t IsUseable() const;
    virtual Bool_t GetVectorReadLimits();
    virtual void   SetEnv();
+   Bool_t ReadAhead(const Long64_t *position, const Int_t *length, Int_t nbuffs);
+   Bool_t ReadFromReadahead(char *buffer, Long64_t position, Int_t length);
    Int_t ParseOpenMode(Option_t *in, TString &modestr,
                        XrdCl::OpenFlags::Flags &mode, Bool_t assumeRead);
 
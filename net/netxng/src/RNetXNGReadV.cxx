@@ -0,0 +1,78 @@
+// @(#)root/netxng:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RNetXNGReadV.hxx"
+
+#include <algorithm>
+#include <cstring>
+
+Int_t ROOT::Internal::NetXNG::MergeChunks(const Long64_t *position, const Int_t *length, Int_t first, Int_t nbuffs,
+                                          Int_t maxGap, Long64_t &end)
+{
+   end = position[first] + length[first];
+   Int_t next = first + 1;
+   while (next < nbuffs && position[next] >= end && position[next] - end <= maxGap) {
+      end = position[next] + length[next];
+      ++next;
+   }
+   return next;
+}
+
+void ROOT::Internal::NetXNG::AddChunks(std::vector<ReadVChunkList_t> &lists, Long64_t offset, Long64_t length,
+                                       char *buffer, Int_t iorMax, Int_t iovMax)
+{
+   while (length > 0) {
+      if (lists.empty() || (Int_t)lists.back().size() >= iovMax)
+         lists.emplace_back();
+      const Int_t len = (Int_t)std::min<Long64_t>(length, iorMax);
+      lists.back().push_back({offset, len, buffer});
+      offset += len;
+      buffer += len;
+      length -= len;
+   }
+}
+
+ROOT::Internal::NetXNG::RReadVPlan::RReadVPlan(char *buffer, const Long64_t *position, const Int_t *length,
+                                               Int_t nbuffs, Int_t maxGap, Int_t iorMax, Int_t iovMax)
+{
+   char *cursor = buffer;
+   for (Int_t i = 0; i < nbuffs;) {
+      Long64_t end;
+      const Int_t next = MergeChunks(position, length, i, nbuffs, maxGap, end);
+      Long64_t bytes = 0;
+      for (Int_t j = i; j < next; ++j)
+         bytes += length[j];
+
+      if (end - position[i] == bytes) {
+         // Contiguous in the file as in the buffer, read in place
+         AddChunks(fLists, position[i], bytes, cursor, iorMax, iovMax);
+      } else {
+         fGapBuffers.emplace_back(new char[end - position[i]]);
+         char *gapBuffer = fGapBuffers.back().get();
+         AddChunks(fLists, position[i], end - position[i], gapBuffer, iorMax, iovMax);
+         char *to = cursor;
+         for (Int_t j = i; j < next; ++j) {
+            fPieces.push_back({to, gapBuffer + (position[j] - position[i]), length[j]});
+            to += length[j];
+         }
+         fExtraBytes += end - position[i] - bytes;
+      }
+      cursor += bytes;
+      fBytes += bytes;
+      i = next;
+   }
+}
+
+/// Copy the chunks read as part of a larger range to the user buffer
+void ROOT::Internal::NetXNG::RReadVPlan::CopyPieces() const
+{
+   for (const auto &piece : fPieces)
+      memcpy(piece.fTo, piece.fFrom, piece.fLength);
+}
@@ -13,8 +13,11 @@
 
 #include <TError.h>
 
+#include <exception>
+#include <future>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <vector>
 #include <XrdCl/XrdClFile.hh>
 #include <XrdCl/XrdClFileSystem.hh>
@@ -22,6 +25,39 @@
 
 namespace {
 constexpr int kDefaultBlockSize = 128 * 1024; // Read in relatively large 128k blocks for better network utilization
+
+/// Completes the future of an asynchronous vector read; deletes itself after the response
+class RVectorReadHandler : public XrdCl::ResponseHandler {
+   ROOT::Internal::RRawFile::RIOVec *fIoVec;
+   unsigned int fNReq;
+   std::string fUrl;
+   std::promise<void> fPromise;
+
+public:
+   RVectorReadHandler(ROOT::Internal::RRawFile::RIOVec *ioVec, unsigned int nReq, const std::string &url)
+      : fIoVec(ioVec), fNReq(nReq), fUrl(url)
+   {
+   }
+   std::future<void> GetFuture() { return fPromise.get_future(); }
+
+   void HandleResponse(XrdCl::XRootDStatus *status, XrdCl::AnyObject *response) final
+   {
+      if (status->IsOK()) {
+         XrdCl::VectorReadInfo *info = nullptr;
+         response->Get(info);
+         XrdCl::ChunkList &rsp = info->GetChunks();
+         for (unsigned int i = 0; i < fNReq; ++i)
+            fIoVec[i].fOutBytes = rsp[i].length;
+         fPromise.set_value();
+      } else {
+         fPromise.set_exception(std::make_exception_ptr(std::runtime_error(
+            "Cannot do vector read from '" + fUrl + "', " + status->ToString() + "; " + status->GetErrorMessage())));
+      }
+      delete status;
+      delete response; // also deletes the VectorReadInfo
+      delete this;
+   }
+};
 } // anonymous namespace
 
 namespace ROOT {
@@ -105,3 +141,22 @@ void ROOT::Internal::RRawFileNetXNG::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    delete info;
 }
 
+std::future<void> ROOT::Internal::RRawFileNetXNG::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   XrdCl::ChunkList chunks;
+   chunks.reserve( nReq );
+   for( std::size_t i = 0; i < nReq; ++i )
+     chunks.emplace_back( ioVec[i].fOffset, ioVec[i].fSize, ioVec[i].fBuffer );
+
+   auto handler = new RVectorReadHandler( ioVec, nReq, fUrl );
+   auto future = handler->GetFuture();
+   auto st = pImpl->file.VectorRead( chunks, nullptr, handler );
+   if( !st.IsOK() ) {
+     // the handler is only called for requests that were sent
+     delete handler;
+     throw std::runtime_error( "Cannot do vector read from '" + fUrl + "', " +
+                               st.ToString() + "; " + st.GetErrorMessage() );
+   }
+   return future;
+}
+
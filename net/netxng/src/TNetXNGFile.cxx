@@ -20,7 +20,9 @@
 
 #include "TArchiveFile.h"
 #include "TNetXNGFile.h"
+#include "ROOT/RNetXNGReadV.hxx"
 #include "TEnv.h"
+#include "TError.h"
 #include "TSystem.h"
 #include "TTimeStamp.h"
 #include "TVirtualPerfStats.h"
@@ -30,7 +32,13 @@
 #include <XrdCl/XrdClXRootDResponses.hh>
 #include <XrdCl/XrdClDefaultEnv.hh>
 #include <XrdVersion.hh>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <memory>
+#include <mutex>
 
 //------------------------------------------------------------------------------
 // Open handler for async open requests
@@ -74,6 +82,133 @@ class TAsyncOpenHandler: public XrdCl::ResponseHandler
       TNetXNGFile *fFile;
 };
 
+//------------------------------------------------------------------------------
+// Blocks of the file read ahead asynchronously (see TNetXNGFile::ReadAhead)
+// and statistics of the requests sent to the server
+////////////////////////////////////////////////////////////////////////////////
+
+class TNetXNGReadahead
+{
+   public:
+      using Clock_t = std::chrono::steady_clock;
+
+      //------------------------------------------------------------------------
+      // A contiguous range of the file, read by one or more vector reads
+      //////////////////////////////////////////////////////////////////////////
+
+      struct Block {
+         Long64_t          fBegin;            // Offset of the first byte
+         Long64_t          fEnd;              // Offset past the last byte
+         std::unique_ptr<char[]> fData;       // Content of the range
+         Int_t             fPending = 0;      // Number of vector reads not yet completed
+         Bool_t            fFailed  = kFALSE; // One of the vector reads failed
+
+         Block(Long64_t begin, Long64_t end) : fBegin(begin), fEnd(end), fData(new char[end - begin]) {}
+      };
+      using BlockPtr_t = std::shared_ptr<Block>;
+      using Fill_t = std::vector<BlockPtr_t>; // Blocks requested by one ReadAhead()
+
+      std::mutex              fMutex;
+      std::condition_variable fCondVar;          // Signal the completion of requests
+      std::deque<Fill_t>      fFills;            // Most recent last
+      Int_t                   fMaxFills = 2;     // Number of fills kept
+      Long64_t                fBytesInFlight = 0;
+      Int_t                   fRequestsInFlight = 0;
+      std::vector<Long64_t>   fLatencies = std::vector<Long64_t>(TNetXNGFile::kReadLatencyBins, 0);
+
+      //------------------------------------------------------------------------
+      // Record a request of the given size sent to the server
+      //////////////////////////////////////////////////////////////////////////
+
+      void RequestStarted(Long64_t bytes)
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fBytesInFlight += bytes;
+         ++fRequestsInFlight;
+      }
+
+      //------------------------------------------------------------------------
+      // Record the completion of a request, and of the blocks it was reading
+      //////////////////////////////////////////////////////////////////////////
+
+      void RequestDone(Long64_t bytes, Clock_t::time_point start, const Fill_t &blocks, Bool_t failed)
+      {
+         const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(Clock_t::now() - start).count();
+         // Bin 0 counts the requests faster than 1 ms, bin i those between 2^(i-1) and 2^i ms.
+         Int_t bin = 0;
+         while (bin < TNetXNGFile::kReadLatencyBins - 1 && (Long64_t(1) << bin) <= ms)
+            ++bin;
+         {
+            std::lock_guard<std::mutex> lock(fMutex);
+            fBytesInFlight -= bytes;
+            --fRequestsInFlight;
+            ++fLatencies[bin];
+            for (auto &block : blocks) {
+               --block->fPending;
+               block->fFailed |= failed;
+            }
+         }
+         fCondVar.notify_all();
+      }
+
+      //------------------------------------------------------------------------
+      // Forget a request which could not be sent (bytes < 0 if it was not
+      // recorded as started), its blocks cannot be read
+      //////////////////////////////////////////////////////////////////////////
+
+      void Abandon(const Fill_t &blocks, Long64_t bytes)
+      {
+         {
+            std::lock_guard<std::mutex> lock(fMutex);
+            if (bytes >= 0) {
+               fBytesInFlight -= bytes;
+               --fRequestsInFlight;
+            }
+            for (auto &block : blocks) {
+               --block->fPending;
+               block->fFailed = kTRUE;
+            }
+         }
+         fCondVar.notify_all();
+      }
+
+      //------------------------------------------------------------------------
+      // Wait for the completion of all requests
+      //////////////////////////////////////////////////////////////////////////
+
+      void WaitIdle()
+      {
+         std::unique_lock<std::mutex> lock(fMutex);
+         fCondVar.wait(lock, [this] { return fRequestsInFlight == 0; });
+      }
+
+      //------------------------------------------------------------------------
+      // Wait for the completion of all requests and forget the blocks
+      //////////////////////////////////////////////////////////////////////////
+
+      void Clear()
+      {
+         std::unique_lock<std::mutex> lock(fMutex);
+         fCondVar.wait(lock, [this] { return fRequestsInFlight == 0; });
+         fFills.clear();
+      }
+
+      //------------------------------------------------------------------------
+      // Return the block containing the range, the caller holds fMutex
+      //////////////////////////////////////////////////////////////////////////
+
+      BlockPtr_t Find(Long64_t position, Int_t length) const
+      {
+         for (auto fill = fFills.rbegin(); fill != fFills.rend(); ++fill) {
+            for (auto &block : *fill) {
+               if (block->fBegin <= position && position + length <= block->fEnd)
+                  return block;
+            }
+         }
+         return nullptr;
+      }
+};
+
 //------------------------------------------------------------------------------
 // Async readv handler
 ////////////////////////////////////////////////////////////////////////////////
@@ -87,8 +222,14 @@ class TAsyncReadvHandler: public XrdCl::ResponseHandler
 
       TAsyncReadvHandler(std::vector<XrdCl::XRootDStatus*> *statuses,
                          Int_t                              statusIndex,
-                         TSemaphore                        *semaphore):
-         fStatuses(statuses), fStatusIndex(statusIndex), fSemaphore(semaphore) {}
+                         TSemaphore                        *semaphore,
+                         TNetXNGReadahead                  *readahead,
+                         Long64_t                           bytes):
+         fStatuses(statuses), fStatusIndex(statusIndex), fSemaphore(semaphore),
+         fReadahead(readahead), fBytes(bytes), fStart(TNetXNGReadahead::Clock_t::now())
+      {
+         fReadahead->RequestStarted(fBytes);
+      }
 
 
       //------------------------------------------------------------------------
@@ -98,6 +239,7 @@ class TAsyncReadvHandler: public XrdCl::ResponseHandler
       void HandleResponse(XrdCl::XRootDStatus *status,
                           XrdCl::AnyObject    *response) override
       {
+         fReadahead->RequestDone(fBytes, fStart, {}, !status->IsOK());
          fStatuses->at(fStatusIndex) = status;
          fSemaphore->Post();
          delete response;
@@ -108,8 +250,68 @@ class TAsyncReadvHandler: public XrdCl::ResponseHandler
       std::vector<XrdCl::XRootDStatus*> *fStatuses;    // Pointer to status vector
       Int_t                              fStatusIndex; // Index into status vector
       TSemaphore                        *fSemaphore;   // Synchronize the responses
+      TNetXNGReadahead                  *fReadahead;   // Read statistics
+      Long64_t                           fBytes;       // Size of the request
+      TNetXNGReadahead::Clock_t::time_point fStart;    // Time the request was sent
+};
+
+//------------------------------------------------------------------------------
+// Read-ahead readv handler
+////////////////////////////////////////////////////////////////////////////////
+
+class TReadaheadHandler: public XrdCl::ResponseHandler
+{
+   public:
+      //------------------------------------------------------------------------
+      // Constructor
+      //////////////////////////////////////////////////////////////////////////
+
+      TReadaheadHandler(TNetXNGReadahead *readahead, TNetXNGReadahead::Fill_t blocks, Long64_t bytes):
+         fReadahead(readahead), fBlocks(std::move(blocks)), fBytes(bytes),
+         fStart(TNetXNGReadahead::Clock_t::now())
+      {
+         fReadahead->RequestStarted(fBytes);
+      }
+
+      //------------------------------------------------------------------------
+      // Handle readv response
+      //////////////////////////////////////////////////////////////////////////
+
+      void HandleResponse(XrdCl::XRootDStatus *status,
+                          XrdCl::AnyObject    *response) override
+      {
+         if (!status->IsOK() && gDebug > 0)
+            ::Info("TNetXNGFile::ReadAhead", "%s", status->ToStr().c_str());
+         fReadahead->RequestDone(fBytes, fStart, fBlocks, !status->IsOK());
+         delete status;
+         delete response;
+         delete this;
+      }
+
+   private:
+      TNetXNGReadahead                     *fReadahead; // Blocks and read statistics
+      TNetXNGReadahead::Fill_t              fBlocks;    // Blocks read by the request
+      Long64_t                              fBytes;     // Size of the request
+      TNetXNGReadahead::Clock_t::time_point fStart;     // Time the request was sent
 };
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Convert the chunk lists of the readv helpers to the XrdCl ones
+
+std::vector<XrdCl::ChunkList> ToChunkLists(const std::vector<ROOT::Internal::NetXNG::ReadVChunkList_t> &lists)
+{
+   std::vector<XrdCl::ChunkList> chunkLists(lists.size());
+   for (size_t l = 0; l < lists.size(); ++l) {
+      for (const auto &chunk : lists[l])
+         chunkLists[l].push_back(XrdCl::ChunkInfo(chunk.fOffset, chunk.fLength, chunk.fBuffer));
+   }
+   return chunkLists;
+}
+
+} // namespace
+
 
 ClassImp(TNetXNGFile);
 
@@ -155,10 +357,12 @@ TNetXNGFile::TNetXNGFile(const char *url, const char *lurl, Option_t *mode, cons
 
    fFile        = new File();
    fInitCondVar = new XrdSysCondVar();
+   fReadahead   = new TNetXNGReadahead();
    fUrl->SetProtocol(std::string("root"));
    fQueryReadVParams = 1;
    fReadvIorMax = 2097136;
    fReadvIovMax = 1024;
+   fReadvGap    = 0;
 
    if (ParseOpenMode(mode, fOption, fMode, kTRUE)<0) {
       Error("Open", "could not parse open mode %s", mode);
@@ -227,6 +431,9 @@ TNetXNGFile::~TNetXNGFile()
 {
    if (IsOpen())
       Close();
+   if (fReadahead)
+      fReadahead->WaitIdle();
+   delete fReadahead;
    delete fUrl;
    delete fInitCondVar;
 }
@@ -324,6 +531,9 @@ void TNetXNGFile::Close(const Option_t */*option*/)
 
    if (!fFile) return;
 
+   // The handlers of the pending read-ahead requests use the file
+   fReadahead->Clear();
+
    XrdCl::XRootDStatus status = fFile->Close();
    if (!status.IsOK()) {
       Error("Close", "%s", status.ToStr().c_str());
@@ -362,6 +572,7 @@ Int_t TNetXNGFile::ReOpen(Option_t *modestr)
       return 1;
    }
 
+   fReadahead->Clear();
    XRootDStatus st = fFile->Close();
    if (!st.IsOK()) {
       Error("ReOpen", "%s", st.ToStr().c_str());
@@ -409,6 +620,13 @@ Bool_t TNetXNGFile::ReadBuffer(char *buffer, Long64_t position, Int_t length)
    if (!IsUseable())
       return kTRUE;
 
+   // Try to read from the blocks read ahead, they are looked up first since
+   // TFileCacheRead relies on us for the blocks it asked to read asynchronously
+   if (ReadFromReadahead(buffer, position, length)) {
+      SetOffset(position + length);
+      return kFALSE;
+   }
+
    // Try to read from cache
    SetOffset(position);
    Int_t status;
@@ -423,7 +641,10 @@ Bool_t TNetXNGFile::ReadBuffer(char *buffer, Long64_t position, Int_t length)
 
    // Read the data
    uint32_t bytesRead = 0;
+   fReadahead->RequestStarted(length);
+   const auto requestStart = TNetXNGReadahead::Clock_t::now();
    XRootDStatus st = fFile->Read(fOffset, length, buffer, bytesRead);
+   fReadahead->RequestDone(length, requestStart, {}, !st.IsOK());
    if (gDebug > 0)
       Info("ReadBuffer", "%s bytes read: %u", st.ToStr().c_str(), bytesRead);
 
@@ -475,13 +696,22 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    if (!IsUseable())
       return kTRUE;
 
-   std::vector<ChunkList>      chunkLists;
-   ChunkList                   chunks;
+   // Called without buffer by TFileCacheRead to pass the blocks to read ahead
+   if (!buffer)
+      return ReadAhead(position, length, nbuffs);
+
+   // Use the blocks read ahead if they contain all the chunks
+   {
+      Int_t i = 0;
+      char *cursor = buffer;
+      while (i < nbuffs && ReadFromReadahead(cursor, position[i], length[i]))
+         cursor += length[i++];
+      if (i == nbuffs)
+         return kFALSE;
+   }
+
    std::vector<XRootDStatus*> *statuses;
    TSemaphore                 *semaphore;
-   Int_t                       totalBytes = 0;
-   Long64_t                    offset     = 0;
-   char                       *cursor     = buffer;
 
    Double_t start = 0;
    if (gPerfStats) start = TTimeStamp();
@@ -490,46 +720,13 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
       for (Int_t i = 0; i < nbuffs; i++)
          position[i] += fArchiveOffset;
 
-   // Build a list of chunks. Put the buffers in the ChunkInfo's
-   for (Int_t i = 0; i < nbuffs; ++i) {
-      totalBytes += length[i];
-
-      // If the length is bigger than max readv size, split into smaller chunks
-      if (length[i] > fReadvIorMax) {
-         Int_t nsplit = length[i] / fReadvIorMax;
-         Int_t rem    = length[i] % fReadvIorMax;
-         Int_t j;
-
-         // Add as many max-size chunks as are divisible
-         for (j = 0; j < nsplit; ++j) {
-            offset = position[i] + (j * fReadvIorMax);
-            chunks.push_back(ChunkInfo(offset, fReadvIorMax, cursor));
-            cursor += fReadvIorMax;
-         }
-
-         // Add the remainder
-         offset = position[i] + (j * fReadvIorMax);
-         chunks.push_back(ChunkInfo(offset, rem, cursor));
-         cursor += rem;
-      } else {
-         chunks.push_back(ChunkInfo(position[i], length[i], cursor));
-         cursor += length[i];
-      }
-
-      // If there are more than or equal to max chunks, make another chunk list
-      if ((Int_t) chunks.size() == fReadvIovMax) {
-         chunkLists.push_back(chunks);
-         chunks = ChunkList();
-      } else if ((Int_t) chunks.size() > fReadvIovMax) {
-         chunkLists.push_back(ChunkList(chunks.begin(),
-                                        chunks.begin() + fReadvIovMax));
-         chunks = ChunkList(chunks.begin() + fReadvIovMax, chunks.end());
-      }
-   }
-
-   // Push back the last chunk list
-   if( !chunks.empty() )
-      chunkLists.push_back(chunks);
+   // Build a list of chunks. Put the buffers in the ChunkInfo's. Chunks which
+   // are too big are split, consecutive chunks whose gap is at most fReadvGap
+   // bytes are read together into a temporary buffer, from which they are
+   // copied once read.
+   ROOT::Internal::NetXNG::RReadVPlan plan(buffer, position, length, nbuffs, fReadvGap, fReadvIorMax, fReadvIovMax);
+   std::vector<ChunkList> chunkLists = ToChunkLists(plan.GetLists());
+   const Long64_t totalBytes = plan.GetBytes();
 
    TAsyncReadvHandler *handler;
    XRootDStatus        status;
@@ -540,12 +737,17 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    std::vector<ChunkList>::iterator it;
    for (it = chunkLists.begin(); it != chunkLists.end(); ++it)
    {
+      Long64_t listBytes = 0;
+      for (const auto &chunk : *it)
+         listBytes += chunk.length;
       handler = new TAsyncReadvHandler(statuses, it - chunkLists.begin(),
-                                       semaphore);
+                                       semaphore, fReadahead, listBytes);
       status = fFile->VectorRead(*it, 0, handler);
 
       if (!status.IsOK()) {
          Error("ReadBuffers", "%s", status.ToStr().c_str());
+         delete handler;
+         fReadahead->Abandon({}, listBytes);
          return kTRUE;
       }
    }
@@ -574,9 +776,12 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
       delete st;
    }
 
+   plan.CopyPieces();
+
    // Bump the globals
-   fBytesRead  += totalBytes;
-   fgBytesRead += totalBytes;
+   fBytesRead      += totalBytes;
+   fgBytesRead     += totalBytes;
+   fBytesReadExtra += plan.GetExtraBytes();
    fReadCalls  ++;
    fgReadCalls ++;
 
@@ -593,6 +798,178 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    return kFALSE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Start reading the given range asynchronously, see ReadAhead()
+///
+/// param offset: offset from the beginning of the file
+/// param length: number of bytes to be read, 0 to query if asynchronous
+///               reading is supported
+/// returns:      kTRUE in case of failure or if asynchronous reading is not
+///               supported
+
+Bool_t TNetXNGFile::ReadBufferAsync(Long64_t offset, Int_t length)
+{
+   // The blocks read ahead would not see the data written to the file
+   if (!IsUseable() || IsWritable())
+      return kTRUE;
+
+   if (length == 0)
+      return kFALSE;
+
+   return ReadAhead(&offset, &length, 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start reading scattered data chunks asynchronously, they are kept in
+/// memory to serve the subsequent ReadBuffer() and ReadBuffers() calls.
+///
+/// The chunks are merged into contiguous blocks when their gap is at most
+/// NetXNG.ReadVGap bytes and read by vector reads which are not waited for.
+/// The blocks of the last NetXNG.ReadAheadBlocks calls are kept, so that
+/// TFileCacheRead (when TFile.AsyncReading is set) can request the next
+/// cache blocks while the current ones are still being read and used.
+///
+/// param position: position[i] is the seek position of chunk i of len
+///                 length[i]
+/// param length:   length[i] is the length of the chunk at offset
+///                 position[i]
+/// param nbuffs:   number of chunks, 0 does nothing
+/// returns:        kTRUE in case of failure
+
+Bool_t TNetXNGFile::ReadAhead(const Long64_t *position, const Int_t *length, Int_t nbuffs)
+{
+   using namespace XrdCl;
+
+   // The blocks read ahead would not see the data written to the file
+   if (IsWritable())
+      return kTRUE;
+
+   if (nbuffs <= 0)
+      return kFALSE;
+
+   std::vector<ROOT::Internal::NetXNG::ReadVChunkList_t> lists;
+   std::vector<TNetXNGReadahead::Fill_t>                 listBlocks;
+   {
+      std::lock_guard<std::mutex> lock(fReadahead->fMutex);
+
+      TNetXNGReadahead::Fill_t fill;
+      for (Int_t i = 0; i < nbuffs; ) {
+         // Skip the chunks which are already being read
+         if (fReadahead->Find(position[i], length[i])) {
+            ++i;
+            continue;
+         }
+         Long64_t end;
+         const Int_t next = ROOT::Internal::NetXNG::MergeChunks(position, length, i, nbuffs, fReadvGap, end);
+         fill.push_back(std::make_shared<TNetXNGReadahead::Block>(position[i], end));
+         i = next;
+      }
+      if (fill.empty())
+         return kFALSE;
+
+      for (auto &block : fill) {
+         const size_t first = lists.empty() ? 0 : lists.size() - 1;
+         ROOT::Internal::NetXNG::AddChunks(lists, block->fBegin + fArchiveOffset, block->fEnd - block->fBegin,
+                                           block->fData.get(), fReadvIorMax, fReadvIovMax);
+         listBlocks.resize(lists.size());
+         for (size_t l = first; l < lists.size(); ++l) {
+            if (listBlocks[l].empty() || listBlocks[l].back() != block) {
+               listBlocks[l].push_back(block);
+               ++block->fPending;
+            }
+         }
+      }
+
+      // The handlers keep the blocks they read alive, we can forget the oldest ones
+      fReadahead->fFills.push_back(std::move(fill));
+      while ((Int_t)fReadahead->fFills.size() > fReadahead->fMaxFills)
+         fReadahead->fFills.pop_front();
+   }
+
+   std::vector<ChunkList> chunkLists = ToChunkLists(lists);
+   for (size_t l = 0; l < chunkLists.size(); ++l) {
+      Long64_t listBytes = 0;
+      for (const auto &chunk : chunkLists[l])
+         listBytes += chunk.length;
+      auto handler = new TReadaheadHandler(fReadahead, listBlocks[l], listBytes);
+      XRootDStatus status = fFile->VectorRead(chunkLists[l], 0, handler);
+      if (!status.IsOK()) {
+         Error("ReadAhead", "%s", status.ToStr().c_str());
+         // The handler will not be called, the blocks of the lists not sent cannot be read
+         delete handler;
+         fReadahead->Abandon(listBlocks[l], listBytes);
+         for (size_t m = l + 1; m < chunkLists.size(); ++m)
+            fReadahead->Abandon(listBlocks[m], -1);
+         return kTRUE;
+      }
+   }
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy a data chunk from the blocks read ahead, waiting for their reading to
+/// complete if needed.
+///
+/// returns: kTRUE if the chunk was found and read
+
+Bool_t TNetXNGFile::ReadFromReadahead(char *buffer, Long64_t position, Int_t length)
+{
+   if (!fReadahead)
+      return kFALSE;
+
+   std::unique_lock<std::mutex> lock(fReadahead->fMutex);
+   if (fReadahead->fFills.empty())
+      return kFALSE;
+   auto block = fReadahead->Find(position, length);
+   if (!block)
+      return kFALSE;
+
+   const Bool_t pending = block->fPending > 0;
+   Double_t start = 0;
+   if (pending && gPerfStats) start = TTimeStamp();
+   fReadahead->fCondVar.wait(lock, [&block] { return block->fPending == 0; });
+   if (block->fFailed)
+      return kFALSE;
+   memcpy(buffer, block->fData.get() + (position - block->fBegin), length);
+   lock.unlock();
+
+   // Account for the bytes read ahead when they are used
+   fBytesRead  += length;
+   fgBytesRead += length;
+   fReadCalls  ++;
+   fgReadCalls ++;
+
+   if (gPerfStats)
+      gPerfStats->FileReadEvent(this, length, start);
+
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of bytes requested to the server and not received yet
+
+Long64_t TNetXNGFile::GetBytesInFlight() const
+{
+   if (!fReadahead)
+      return 0;
+   std::lock_guard<std::mutex> lock(fReadahead->fMutex);
+   return fReadahead->fBytesInFlight;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the histogram of the latencies of the read requests sent to the
+/// server: bin 0 counts the requests answered in less than 1 ms, bin i the
+/// requests answered in [2^(i-1), 2^i) ms, the last bin also counts the
+/// slower requests.
+
+std::vector<Long64_t> TNetXNGFile::GetReadLatencyCounts() const
+{
+   if (!fReadahead)
+      return std::vector<Long64_t>(kReadLatencyBins, 0);
+   std::lock_guard<std::mutex> lock(fReadahead->fMutex);
+   return fReadahead->fLatencies;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Write a data chunk
 ///
@@ -877,6 +1254,8 @@ void TNetXNGFile::SetEnv()
       env->PutString("ClientMonitorParam", val.Data());
 
    fQueryReadVParams = gEnv->GetValue("NetXNG.QueryReadVParams", 1);
+   fReadvGap = std::max(0, gEnv->GetValue("NetXNG.ReadVGap", 0));
+   fReadahead->fMaxFills = std::max(1, gEnv->GetValue("NetXNG.ReadAheadBlocks", 2));
    env->PutInt( "MultiProtocol", gEnv->GetValue("TFile.CrossProtocolRedirects", 1));
 
    // Old style netrc file
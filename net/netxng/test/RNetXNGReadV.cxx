@@ -0,0 +1,158 @@
+#include "ROOT/RNetXNGReadV.hxx"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using ROOT::Internal::NetXNG::RReadVPlan;
+
+namespace {
+
+/// Play the role of the server: fill the chunk lists of the plan from the file content
+void Execute(const RReadVPlan &plan, const std::string &file)
+{
+   for (const auto &list : plan.GetLists()) {
+      for (const auto &chunk : list) {
+         ASSERT_LE(chunk.fOffset + chunk.fLength, (Long64_t)file.size());
+         memcpy(chunk.fBuffer, file.data() + chunk.fOffset, chunk.fLength);
+      }
+   }
+   plan.CopyPieces();
+}
+
+std::string MakeFile(std::size_t size)
+{
+   std::string file(size, '\0');
+   for (std::size_t i = 0; i < size; ++i)
+      file[i] = static_cast<char>('a' + (i * 7 + i / 26) % 26);
+   return file;
+}
+
+std::string Expected(const std::string &file, const std::vector<Long64_t> &position, const std::vector<Int_t> &length)
+{
+   std::string result;
+   for (std::size_t i = 0; i < position.size(); ++i)
+      result += file.substr(position[i], length[i]);
+   return result;
+}
+
+std::size_t CountChunks(const RReadVPlan &plan)
+{
+   std::size_t n = 0;
+   for (const auto &list : plan.GetLists())
+      n += list.size();
+   return n;
+}
+
+} // namespace
+
+TEST(RNetXNGReadV, NoGap)
+{
+   const auto file = MakeFile(1000);
+   std::vector<Long64_t> position{0, 100, 150, 400};
+   std::vector<Int_t> length{10, 50, 20, 30};
+   std::string buffer(110, '\0');
+
+   RReadVPlan plan(&buffer[0], position.data(), length.data(), position.size(), 0, 1000, 1000);
+   // 100 and 150 are adjacent and read in place as one chunk
+   ASSERT_EQ(1u, plan.GetLists().size());
+   EXPECT_EQ(3u, CountChunks(plan));
+   EXPECT_TRUE(plan.GetPieces().empty());
+   EXPECT_EQ(110, plan.GetBytes());
+   EXPECT_EQ(0, plan.GetExtraBytes());
+   const auto &chunks = plan.GetLists()[0];
+   EXPECT_EQ(100, chunks[1].fOffset);
+   EXPECT_EQ(70, chunks[1].fLength);
+   EXPECT_EQ(&buffer[10], chunks[1].fBuffer);
+
+   Execute(plan, file);
+   EXPECT_EQ(Expected(file, position, length), buffer);
+}
+
+TEST(RNetXNGReadV, Gaps)
+{
+   const auto file = MakeFile(2000);
+   // gaps of 40, 100, 101 and 5 bytes
+   std::vector<Long64_t> position{10, 60, 200, 401, 506};
+   std::vector<Int_t> length{10, 40, 100, 100, 50};
+   std::string buffer(300, '\0');
+
+   RReadVPlan plan(&buffer[0], position.data(), length.data(), position.size(), 100, 1000, 1000);
+   // [10, 300) with the first three chunks and [401, 556) with the last two
+   ASSERT_EQ(1u, plan.GetLists().size());
+   const auto &chunks = plan.GetLists()[0];
+   ASSERT_EQ(2u, chunks.size());
+   EXPECT_EQ(10, chunks[0].fOffset);
+   EXPECT_EQ(290, chunks[0].fLength);
+   EXPECT_EQ(401, chunks[1].fOffset);
+   EXPECT_EQ(155, chunks[1].fLength);
+   // the merged ranges are read into temporary buffers
+   EXPECT_NE(&buffer[0], chunks[0].fBuffer);
+   EXPECT_EQ(5u, plan.GetPieces().size());
+   EXPECT_EQ(300, plan.GetBytes());
+   EXPECT_EQ(140 + 5, plan.GetExtraBytes());
+
+   Execute(plan, file);
+   EXPECT_EQ(Expected(file, position, length), buffer);
+}
+
+TEST(RNetXNGReadV, Unordered)
+{
+   const auto file = MakeFile(1000);
+   // overlapping or backwards chunks are never merged
+   std::vector<Long64_t> position{100, 120, 50, 500};
+   std::vector<Int_t> length{30, 30, 10, 20};
+   std::string buffer(90, '\0');
+
+   RReadVPlan plan(&buffer[0], position.data(), length.data(), position.size(), 1000, 1000, 1000);
+   EXPECT_EQ(3u, CountChunks(plan));
+   EXPECT_EQ(90, plan.GetBytes());
+   EXPECT_EQ(440, plan.GetExtraBytes());
+
+   Execute(plan, file);
+   EXPECT_EQ(Expected(file, position, length), buffer);
+}
+
+TEST(RNetXNGReadV, Split)
+{
+   const auto file = MakeFile(1000);
+   std::vector<Long64_t> position{0, 30, 100};
+   std::vector<Int_t> length{25, 10, 7};
+   std::string buffer(42, '\0');
+
+   // chunks of at most 10 bytes, at most 2 chunks per vector read
+   RReadVPlan plan(&buffer[0], position.data(), length.data(), position.size(), 5, 10, 2);
+   ASSERT_EQ(3u, plan.GetLists().size());
+   for (const auto &list : plan.GetLists()) {
+      EXPECT_LE(list.size(), 2u);
+      for (const auto &chunk : list)
+         EXPECT_LE(chunk.fLength, 10);
+   }
+   // [0, 40) merged over a gap of 5 bytes and split in 4, [100, 107) in place
+   EXPECT_EQ(5u, CountChunks(plan));
+   EXPECT_EQ(30, plan.GetLists()[1][1].fOffset);
+   EXPECT_EQ(100, plan.GetLists()[2][0].fOffset);
+   EXPECT_EQ(&buffer[35], plan.GetLists()[2][0].fBuffer);
+   EXPECT_EQ(5, plan.GetExtraBytes());
+
+   Execute(plan, file);
+   EXPECT_EQ(Expected(file, position, length), buffer);
+}
+
+TEST(RNetXNGReadV, AddChunks)
+{
+   std::vector<ROOT::Internal::NetXNG::ReadVChunkList_t> lists;
+   char buffer[64];
+   ROOT::Internal::NetXNG::AddChunks(lists, 1000, 64, buffer, 16, 3);
+   ASSERT_EQ(2u, lists.size());
+   EXPECT_EQ(3u, lists[0].size());
+   EXPECT_EQ(1u, lists[1].size());
+   EXPECT_EQ(1048, lists[1][0].fOffset);
+   EXPECT_EQ(buffer + 48, lists[1][0].fBuffer);
+   // the next range continues the last list
+   ROOT::Internal::NetXNG::AddChunks(lists, 2000, 10, buffer, 16, 3);
+   ASSERT_EQ(2u, lists.size());
+   EXPECT_EQ(2u, lists[1].size());
+}
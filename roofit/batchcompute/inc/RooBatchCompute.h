@@ -50,6 +50,7 @@ typedef double *__restrict RestrictArr;
 typedef const double *__restrict InputArr;
 
 void init();
+std::vector<std::string> supportedCpuLibraries();
 
 /// Minimal configuration struct to steer the evaluation of a single node with
 /// the RooBatchCompute library.
@@ -62,14 +63,20 @@ public:
 #else
    bool useCuda() const { return false; }
 #endif
+   /// Whether the CPU computation may be split across the threads of the
+   /// implicit multithreading pool, if it is enabled. This is disabled for the
+   /// computations that are already run in parallel on ranges of the events.
+   bool useImplicitMT() const { return _useImplicitMT; }
+   void setUseImplicitMT(bool flag) { _useImplicitMT = flag; }
 
 private:
 #ifdef R__HAS_CUDA
    RooFit::Detail::CudaInterface::CudaStream *_cudaStream = nullptr;
 #endif
+   bool _useImplicitMT = true;
 };
 
-enum class Architecture { AVX512, AVX2, AVX, SSE4, GENERIC, CUDA };
+enum class Architecture { AVX512, AVX2, AVX, SSE4, SVE, NEON, GENERIC, CUDA };
 
 enum Computer {
    AddPdf,
@@ -134,7 +141,7 @@ struct ReduceNLLOutput {
  * This interface contains the signatures of the compute functions of every PDF that has an optimised implementation
  * available. These are the functions that perform the actual computations in batches.
  *
- * Several implementations of this interface may be provided, e.g. SSE, AVX, AVX2 etc. At run time, the fastest
+ * Several implementations of this interface may be provided, e.g. SSE, AVX, AVX2, NEON etc. At run time, the fastest
  * implementation of this interface is selected, and using a virtual call, the computation is dispatched to the best
  * backend.
  *
@@ -19,6 +19,12 @@
 #include <string>
 #include <exception>
 #include <stdexcept>
+#include <vector>
+
+#if defined(R__RF_ARCHITECTURE_SPECIFIC_LIBS) && defined(__aarch64__) && defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
 
 // First initialisation of the pointers. When implementations of the batch compute library
 // are loaded, they will overwrite the pointers.
@@ -36,6 +42,43 @@ void loadWithErrorChecking(const std::string &libName)
    }
 }
 
+/// A CPU library, with its name for the `RooFit.BatchCompute` option.
+struct CpuLibrary {
+   std::string option;
+   std::string libName;
+   bool supported;
+};
+
+/// The CPU libraries, from the fastest to the generic one, and whether the
+/// instruction set of each of them is supported by this CPU.
+std::vector<CpuLibrary> getCpuLibraries()
+{
+   std::vector<CpuLibrary> libs;
+#ifdef R__RF_ARCHITECTURE_SPECIFIC_LIBS
+#if defined(__x86_64__)
+   __builtin_cpu_init();
+#if __GNUC__ > 5 || defined(__clang__)
+   bool supported_avx512 = __builtin_cpu_supports("avx512cd") && __builtin_cpu_supports("avx512vl") &&
+                           __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq");
+#else
+   bool supported_avx512 = false;
+#endif
+   libs.push_back({"avx512", "libRooBatchCompute_AVX512", supported_avx512});
+   libs.push_back({"avx2", "libRooBatchCompute_AVX2", __builtin_cpu_supports("avx2") != 0});
+   libs.push_back({"avx", "libRooBatchCompute_AVX", __builtin_cpu_supports("avx") != 0});
+   libs.push_back({"sse", "libRooBatchCompute_SSE4.1", __builtin_cpu_supports("sse4.1") != 0});
+#elif defined(__aarch64__)
+#if defined(R__RF_HAS_SVE) && defined(__linux__) && defined(HWCAP_SVE)
+   libs.push_back({"sve", "libRooBatchCompute_SVE", (getauxval(AT_HWCAP) & HWCAP_SVE) != 0});
+#endif
+   // Advanced SIMD is mandatory in ARMv8-A
+   libs.push_back({"neon", "libRooBatchCompute_NEON", true});
+#endif
+#endif // R__RF_ARCHITECTURE_SPECIFIC_LIBS
+   libs.push_back({"generic", "libRooBatchCompute_GENERIC", true});
+   return libs;
+}
+
 } // end anonymous namespace
 
 namespace RooBatchCompute {
@@ -56,39 +99,46 @@ void init()
       RooBatchCompute::dispatchCUDA = nullptr;
    }
 #endif // R__HAS_CUDA
+#endif // R__RF_ARCHITECTURE_SPECIFIC_LIBS
 
-   __builtin_cpu_init();
-#if __GNUC__ > 5 || defined(__clang__)
-   bool supported_avx512 = __builtin_cpu_supports("avx512cd") && __builtin_cpu_supports("avx512vl") &&
-                           __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq");
-#else
-   bool supported_avx512 = false;
-#endif
+   const std::vector<CpuLibrary> libs = getCpuLibraries();
 
-   if (userChoice == "auto") {
-      if (supported_avx512)
-         loadWithErrorChecking("libRooBatchCompute_AVX512");
-      else if (__builtin_cpu_supports("avx2"))
-         loadWithErrorChecking("libRooBatchCompute_AVX2");
-      else if (__builtin_cpu_supports("avx"))
-         loadWithErrorChecking("libRooBatchCompute_AVX");
-      else if (__builtin_cpu_supports("sse4.1"))
-         loadWithErrorChecking("libRooBatchCompute_SSE4.1");
-   } else if (userChoice == "avx512")
-      loadWithErrorChecking("libRooBatchCompute_AVX512");
-   else if (userChoice == "avx2")
-      loadWithErrorChecking("libRooBatchCompute_AVX2");
-   else if (userChoice == "avx")
-      loadWithErrorChecking("libRooBatchCompute_AVX");
-   else if (userChoice == "sse")
-      loadWithErrorChecking("libRooBatchCompute_SSE4.1");
-   else if (userChoice != "generic")
-      throw std::invalid_argument(
-         "Supported options for `RooFit.BatchCompute` are `auto`, `avx512`, `avx2`, `avx`, `sse`, `generic`.");
+   std::string options;
+   bool validChoice = userChoice == "auto";
+   for (CpuLibrary const &lib : libs) {
+      options += "`" + lib.option + "`, ";
+      if (userChoice == lib.option) {
+         validChoice = true;
+         loadWithErrorChecking(lib.libName);
+         break;
+      }
+      if (userChoice == "auto" && lib.supported) {
+         loadWithErrorChecking(lib.libName);
+         break;
+      }
+   }
+#ifdef R__RF_ARCHITECTURE_SPECIFIC_LIBS
+   if (!validChoice) {
+      throw std::invalid_argument("Supported options for `RooFit.BatchCompute` are `auto`, " +
+                                  options.substr(0, options.size() - 2) + ".");
+   }
 #endif // R__RF_ARCHITECTURE_SPECIFIC_LIBS
 
    if (RooBatchCompute::dispatchCPU == nullptr)
       loadWithErrorChecking("libRooBatchCompute_GENERIC");
 }
 
+/// The names of the CPU libraries whose instruction set is supported by this
+/// CPU, from the fastest to the generic one. The first one is loaded by init()
+/// unless the `RooFit.BatchCompute` option says otherwise.
+std::vector<std::string> supportedCpuLibraries()
+{
+   std::vector<std::string> out;
+   for (CpuLibrary const &lib : getCpuLibraries()) {
+      if (lib.supported)
+         out.push_back(lib.libName);
+   }
+   return out;
+}
+
 } // namespace RooBatchCompute
@@ -103,20 +103,22 @@ public:
 
    /** Compute multiple values using optimized functions.
    This method creates a Batches object and passes it to the correct compute function.
-   In case Implicit Multithreading is enabled, the events to be processed are equally
-   divided among the tasks to be generated and computed in parallel.
+   In case Implicit Multithreading is enabled and allowed by the configuration, the events to be processed are
+   equally divided among the tasks to be generated and computed in parallel.
    \param computer An enum specifying the compute function to be used.
    \param output The array where the computation results are stored.
    \param nEvents The number of events to be processed.
    \param vars A std::vector containing pointers to the variables involved in the computation.
    \param extraArgs An optional std::vector containing extra double values that may participate in the computation. **/
-   void compute(Config const &, Computer computer, RestrictArr output, size_t nEvents, const VarVector &vars,
+   void compute(Config const &cfg, Computer computer, RestrictArr output, size_t nEvents, const VarVector &vars,
                 ArgVector &extraArgs) override
    {
-      static std::vector<double> buffer;
+      // One buffer per thread, because the Evaluator can call this function
+      // from several threads for different ranges of the events.
+      thread_local std::vector<double> buffer;
       buffer.resize(vars.size() * bufferSize);
 
-      if (ROOT::IsImplicitMTEnabled()) {
+      if (cfg.useImplicitMT() && ROOT::IsImplicitMTEnabled()) {
          ROOT::Internal::TExecutor ex;
          std::size_t nThreads = ex.GetPoolSize();
 
@@ -185,6 +187,10 @@ public:
 
 namespace {
 
+/// The number of events of the partial sums in reduceNLL(). It doesn't depend
+/// on the number of threads, so that neither does the result.
+constexpr std::size_t nllChunkSize = 16384;
+
 inline std::pair<double, double> getLog(double prob, ReduceNLLOutput &out)
 {
    if (std::abs(prob) > 1e6) {
@@ -204,21 +210,17 @@ inline std::pair<double, double> getLog(double prob, ReduceNLLOutput &out)
    return {std::log(prob), 0.0};
 }
 
-} // namespace
-
-double RooBatchComputeClass::reduceSum(Config const &, InputArr input, size_t n)
-{
-   return ROOT::Math::KahanSum<double, 4u>::Accumulate(input, input + n).Sum();
-}
-
-ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &, std::span<const double> probas,
-                                                std::span<const double> weights, std::span<const double> offsetProbas)
+/// Sum of the NLL terms of the events in [begin, end), with the sum of the
+/// "badness" of the events with evaluation errors.
+std::pair<ReduceNLLOutput, double> reduceNLLRange(std::span<const double> probas, std::span<const double> weights,
+                                                  std::span<const double> offsetProbas, std::size_t begin,
+                                                  std::size_t end)
 {
    ReduceNLLOutput out;
 
    double badness = 0.0;
 
-   for (std::size_t i = 0; i < probas.size(); ++i) {
+   for (std::size_t i = begin; i < end; ++i) {
 
       const double eventWeight = weights.size() > 1 ? weights[i] : weights[0];
 
@@ -238,6 +240,64 @@ ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &, std::span<const
       out.nllSum.Add(term);
    }
 
+   return {out, badness};
+}
+
+} // namespace
+
+double RooBatchComputeClass::reduceSum(Config const &, InputArr input, size_t n)
+{
+   return ROOT::Math::KahanSum<double, 4u>::Accumulate(input, input + n).Sum();
+}
+
+/// The events are summed in chunks of fixed size, which are computed in
+/// parallel if Implicit Multithreading is enabled and allowed by the
+/// configuration. The partial sums are then added pairwise in a fixed order,
+/// so that the result is the same for any number of threads.
+ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const &cfg, std::span<const double> probas,
+                                                std::span<const double> weights, std::span<const double> offsetProbas)
+{
+   const std::size_t nEvents = probas.size();
+   const std::size_t nChunks = nEvents / nllChunkSize + (nEvents % nllChunkSize > 0);
+   if (nChunks == 0) {
+      return {};
+   }
+
+   std::vector<std::pair<ReduceNLLOutput, double>> partials(nChunks);
+   auto task = [&](std::size_t idx) -> int {
+      partials[idx] = reduceNLLRange(probas, weights, offsetProbas, idx * nllChunkSize,
+                                     std::min(nEvents, (idx + 1) * nllChunkSize));
+      return 0;
+   };
+
+   if (nChunks > 1 && cfg.useImplicitMT() && ROOT::IsImplicitMTEnabled()) {
+      ROOT::Internal::TExecutor ex;
+      std::vector<std::size_t> indices(nChunks);
+      for (std::size_t i = 1; i < nChunks; i++) {
+         indices[i] = i;
+      }
+      ex.Map(task, indices);
+   } else {
+      for (std::size_t i = 0; i < nChunks; i++) {
+         task(i);
+      }
+   }
+
+   for (std::size_t step = 1; step < nChunks; step *= 2) {
+      for (std::size_t i = 0; i + step < nChunks; i += 2 * step) {
+         ReduceNLLOutput &out = partials[i].first;
+         ReduceNLLOutput const &other = partials[i + step].first;
+         out.nllSum += other.nllSum;
+         out.nLargeValues += other.nLargeValues;
+         out.nNonPositiveValues += other.nNonPositiveValues;
+         out.nNaNValues += other.nNaNValues;
+         partials[i].second += partials[i + step].second;
+      }
+   }
+
+   ReduceNLLOutput out = partials[0].first;
+   const double badness = partials[0].second;
+
    if (badness != 0.) {
       // Some events with evaluation errors. Return "badness" of errors.
       out.nllSum = ROOT::Math::KahanSum<double>(RooNaNPacker::packFloatIntoNaN(badness));
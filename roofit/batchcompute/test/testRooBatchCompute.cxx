@@ -0,0 +1,174 @@
+// Tests and throughput benchmark for the CPU libraries of RooBatchCompute
+
+#include <RooBatchCompute.h>
+
+#include <TSystem.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using RooBatchCompute::ArgVector;
+using RooBatchCompute::Computer;
+using RooBatchCompute::RooBatchComputeInterface;
+
+namespace {
+
+constexpr std::size_t nEvents = 100000;
+
+/// The inputs of a compute function: the number of input arrays and the extra arguments.
+struct ComputeSpec {
+   Computer computer;
+   const char *name;
+   std::size_t nVars;
+   ArgVector extraArgs;
+};
+
+std::vector<ComputeSpec> const &computeSpecs()
+{
+   static const std::vector<ComputeSpec> specs{{Computer::AddPdf, "AddPdf", 3, {0.2, 0.3, 0.5}},
+                                               {Computer::ArgusBG, "ArgusBG", 4, {}},
+                                               {Computer::BMixDecay, "BMixDecay", 6, {}},
+                                               {Computer::Bernstein, "Bernstein", 1, {0.1, 0.2, 0.3, 0.4, 0.0, 2.0}},
+                                               {Computer::BifurGauss, "BifurGauss", 4, {}},
+                                               {Computer::BreitWigner, "BreitWigner", 3, {}},
+                                               {Computer::Bukin, "Bukin", 6, {}},
+                                               {Computer::CBShape, "CBShape", 5, {}},
+                                               {Computer::Chebychev, "Chebychev", 1, {0.1, 0.2, 0.3, 0.0, 2.0}},
+                                               {Computer::ChiSquare, "ChiSquare", 1, {3.0}},
+                                               {Computer::DeltaFunction, "DeltaFunction", 1, {}},
+                                               {Computer::DstD0BG, "DstD0BG", 5, {}},
+                                               {Computer::ExpPoly, "ExpPoly", 3, {0.0, 2.0}},
+                                               {Computer::Exponential, "Exponential", 2, {}},
+                                               {Computer::ExponentialNeg, "ExponentialNeg", 2, {}},
+                                               {Computer::Gamma, "Gamma", 4, {}},
+                                               {Computer::GaussModelExpBasis, "GaussModelExpBasis", 6, {0.0}},
+                                               {Computer::Gaussian, "Gaussian", 3, {}},
+                                               {Computer::Identity, "Identity", 1, {}},
+                                               {Computer::Johnson, "Johnson", 5, {0.0}},
+                                               {Computer::Landau, "Landau", 3, {}},
+                                               {Computer::Lognormal, "Lognormal", 3, {}},
+                                               {Computer::LognormalStandard, "LognormalStandard", 3, {}},
+                                               {Computer::NegativeLogarithms, "NegativeLogarithms", 2, {1.0}},
+                                               {Computer::NormalizedPdf, "NormalizedPdf", 2, {0.0, 0.0, 0.0}},
+                                               {Computer::Novosibirsk, "Novosibirsk", 4, {}},
+                                               {Computer::Poisson, "Poisson", 2, {1.0, 0.0}},
+                                               {Computer::Polynomial, "Polynomial", 4, {3.0}},
+                                               {Computer::Power, "Power", 5, {2.0}},
+                                               {Computer::ProdPdf, "ProdPdf", 3, {3.0}},
+                                               {Computer::Ratio, "Ratio", 2, {}},
+                                               {Computer::TruthModelExpBasis, "TruthModelExpBasis", 3, {0.0}},
+                                               {Computer::TruthModelSinBasis, "TruthModelSinBasis", 3, {0.0}},
+                                               {Computer::TruthModelCosBasis, "TruthModelCosBasis", 3, {0.0}},
+                                               {Computer::TruthModelLinBasis, "TruthModelLinBasis", 3, {0.0}},
+                                               {Computer::TruthModelQuadBasis, "TruthModelQuadBasis", 3, {0.0}},
+                                               {Computer::TruthModelSinhBasis, "TruthModelSinhBasis", 3, {0.0}},
+                                               {Computer::TruthModelCoshBasis, "TruthModelCoshBasis", 3, {0.0}},
+                                               {Computer::Voigtian, "Voigtian", 4, {}}};
+   return specs;
+}
+
+/// The implementations of the computation functions in the CPU libraries that
+/// this CPU supports, from the fastest to the generic one.
+std::vector<std::pair<std::string, RooBatchComputeInterface *>> const &cpuLibraries()
+{
+   static const std::vector<std::pair<std::string, RooBatchComputeInterface *>> libs = [] {
+      std::vector<std::pair<std::string, RooBatchComputeInterface *>> out;
+      for (std::string const &libName : RooBatchCompute::supportedCpuLibraries()) {
+         // Loading a library sets the dispatch pointer to its implementation
+         if (gSystem->Load(libName.c_str()) == 0) {
+            out.emplace_back(libName, RooBatchCompute::dispatchCPU);
+         }
+      }
+      return out;
+   }();
+   return libs;
+}
+
+/// Input arrays with values in [0.5, 1.5).
+std::vector<std::vector<double>> makeInputs(std::size_t nVars)
+{
+   std::vector<std::vector<double>> inputs(nVars, std::vector<double>(nEvents));
+   for (std::size_t iVar = 0; iVar < nVars; ++iVar) {
+      for (std::size_t i = 0; i < nEvents; ++i) {
+         inputs[iVar][i] = 0.5 + std::fmod(0.6180339887 * (i * nVars + iVar + 1), 1.0);
+      }
+   }
+   return inputs;
+}
+
+std::vector<double> compute(RooBatchComputeInterface &dispatch, ComputeSpec const &spec,
+                            std::vector<std::vector<double>> const &inputs)
+{
+   RooBatchCompute::VarVector vars(inputs.begin(), inputs.end());
+   // Some compute functions modify their extra arguments
+   ArgVector extraArgs = spec.extraArgs;
+   std::vector<double> output(nEvents);
+   dispatch.compute(RooBatchCompute::Config{}, spec.computer, output.data(), nEvents, vars, extraArgs);
+   return output;
+}
+
+} // namespace
+
+/// The vectorized libraries must give the same results as the generic one.
+TEST(RooBatchCompute, CompareCpuLibraries)
+{
+   auto const &libs = cpuLibraries();
+   ASSERT_FALSE(libs.empty());
+   RooBatchComputeInterface &generic = *libs.back().second;
+   EXPECT_EQ(generic.architecture(), RooBatchCompute::Architecture::GENERIC);
+
+   for (ComputeSpec const &spec : computeSpecs()) {
+      auto inputs = makeInputs(spec.nVars);
+      const std::vector<double> ref = compute(generic, spec, inputs);
+
+      for (std::size_t iLib = 0; iLib + 1 < libs.size(); ++iLib) {
+         const std::vector<double> out = compute(*libs[iLib].second, spec, inputs);
+         double maxDiff = 0.0;
+         for (std::size_t i = 0; i < nEvents; ++i) {
+            if (std::isnan(ref[i]) && std::isnan(out[i]))
+               continue;
+            maxDiff = std::max(maxDiff, std::abs(out[i] - ref[i]) / std::max(1.0, std::abs(ref[i])));
+         }
+         EXPECT_LT(maxDiff, 1e-9) << spec.name << " in " << libs[iLib].first;
+      }
+   }
+}
+
+/// Reports the number of events per second of each compute function in each
+/// of the CPU libraries.
+TEST(RooBatchCompute, Throughput)
+{
+   constexpr int nRepetitions = 20;
+
+   auto const &libs = cpuLibraries();
+
+   std::cout << std::setw(20) << "[Mevents/s]";
+   for (auto const &lib : libs) {
+      std::cout << std::setw(12) << lib.second->architectureName();
+   }
+   std::cout << std::endl;
+
+   for (ComputeSpec const &spec : computeSpecs()) {
+      auto inputs = makeInputs(spec.nVars);
+      std::cout << std::setw(20) << spec.name;
+      for (auto const &lib : libs) {
+         compute(*lib.second, spec, inputs);
+         auto start = std::chrono::steady_clock::now();
+         for (int i = 0; i < nRepetitions; ++i) {
+            compute(*lib.second, spec, inputs);
+         }
+         std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+         std::cout << std::setw(12) << std::fixed << std::setprecision(1)
+                   << nRepetitions * nEvents / elapsed.count();
+      }
+      std::cout << std::endl;
+   }
+}
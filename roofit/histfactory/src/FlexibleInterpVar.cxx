@@ -16,6 +16,7 @@
  */
 
 #include <RooMsgService.h>
+#include <RooNumber.h>
 #include <RooTrace.h>
 
 #include <RooFit/Detail/EvaluateFuncs.h>
@@ -218,7 +219,7 @@ void FlexibleInterpVar::translate(RooFit::Detail::CodeSquashContext &ctx) const
    unsigned int n = _interpCode.size();
 
    std::string resName = "total_" + ctx.getTmpVarName();
-   ctx.addToCodeBody(this, "double " + resName + " = " + std::to_string(_nominal) + ";\n");
+   ctx.addToCodeBody(this, "double " + resName + " = " + RooNumber::toString(_nominal) + ";\n");
    std::string code = "";
    for (std::size_t i = 0; i < n; ++i) {
       code += resName + " = " +
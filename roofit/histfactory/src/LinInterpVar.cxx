@@ -22,6 +22,7 @@
 #include "RooRealVar.h"
 #include "RooArgList.h"
 #include "RooMsgService.h"
+#include "RooFit/Detail/EvaluateFuncs.h"
 
 #include "RooStats/HistFactory/LinInterpVar.h"
 
@@ -109,5 +110,15 @@ double LinInterpVar::evaluate() const
   return sum;
 }
 
+void LinInterpVar::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+   std::string const &lowName = ctx.buildArg(_low);
+   std::string const &highName = ctx.buildArg(_high);
+   std::string const &paramNames = ctx.buildArg(_paramList);
+
+   ctx.addResult(this, ctx.buildCall("RooFit::Detail::EvaluateFuncs::linInterpEvaluate", paramNames, lowName,
+                                     highName, _paramList.size(), _nominal));
+}
+
 
 
@@ -220,15 +220,12 @@ void PiecewiseInterpolation::translate(RooFit::Detail::CodeSquashContext &ctx) c
          coutE(InputArguments) << "PiecewiseInterpolation::evaluate ERROR:  " << _paramSet[i].GetName()
                                << " with unknown interpolation code" << _interpCode[i] << endl;
       }
-      std::string funcCall;
-      if (_interpCode[i] < 4)
-         funcCall = ctx.buildCall("RooFit::Detail::EvaluateFuncs::flexibleInterp", _interpCode[i], 0,
-                                  _lowSet[i], _highSet[i], 1, _nominal, _paramSet[i], resName);
-      else
-         funcCall = ctx.buildCall("RooFit::Detail::EvaluateFuncs::piecewiseInterpolation", _interpCode[i],
-                                  _lowSet[i], _highSet[i], _nominal, _paramSet[i], resName);
-
-      code += resName + " = " + funcCall + ";\n";
+      // Use the same interpolation function as evaluate() and computeBatch(),
+      // such that the generated code gives identical results for all codes.
+      code += resName + " = " +
+              ctx.buildCall("RooFit::Detail::EvaluateFuncs::piecewiseInterpolation", _interpCode[i], _lowSet[i],
+                            _highSet[i], _nominal, _paramSet[i], resName) +
+              ";\n";
    }
    if (_positiveDefinite)
       code += resName + " = " + resName + " < 0 ? 0 : " + resName + ";\n";
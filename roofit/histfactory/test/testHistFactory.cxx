@@ -774,12 +774,12 @@ INSTANTIATE_TEST_SUITE_P(HistFactory, HFFixtureFit,
                          getNameFromInfo);
 
 #ifdef TEST_CODEGEN_AD
-// TODO: merge with the previous HFFixtureFix test suite once the codegen AD
-// supports all of HistFactory
+// The codegen AD tests are only run if clad is available, so they can't be
+// merged with the previous HFFixtureFit test suite.
 INSTANTIATE_TEST_SUITE_P(HistFactoryCodeGen, HFFixtureFit,
                          testing::Combine(testing::Values(MakeModelMode::OverallSyst, MakeModelMode::HistoSyst,
                                                           MakeModelMode::StatSyst, MakeModelMode::ShapeSyst),
-                                          testing::Values(false), // no non-uniform bins
+                                          testing::Values(false, true), // non-uniform bins or not
                                           testing::Values(RooFit::EvalBackend::Codegen())),
                          getNameFromInfo);
 #endif
@@ -1304,16 +1304,7 @@ void RooJSONFactoryWSTool::exportHisto(RooArgSet const &vars, std::size_t n, dou
  */
 void RooJSONFactoryWSTool::exportArray(std::size_t n, double const *contents, JSONNode &output)
 {
-   output.set_seq();
-   for (std::size_t i = 0; i < n; ++i) {
-      double w = contents[i];
-      // To make sure there are no unnecessary floating points in the JSON
-      if (int(w) == w) {
-         output.append_child() << int(w);
-      } else {
-         output.append_child() << w;
-      }
-   }
+   output.fill_seq_double(contents, n);
 }
 
 /**
@@ -1562,17 +1553,10 @@ RooJSONFactoryWSTool::readBinnedData(const JSONNode &n, const std::string &name,
       RooJSONFactoryWSTool::error(errMsg.str());
    }
    auto dh = std::make_unique<RooDataHist>(name, name, vars);
-   std::vector<double> contentVals;
-   contentVals.reserve(contents.num_children());
-   for (auto const &cont : contents.children()) {
-      contentVals.push_back(cont.val_double());
-   }
+   const std::vector<double> contentVals = contents.val_seq_double();
    std::vector<double> errorVals;
    if (errors) {
-      errorVals.reserve(errors->num_children());
-      for (auto const &err : errors->children()) {
-         errorVals.push_back(err.val_double());
-      }
+      errorVals = errors->val_seq_double();
    }
    for (size_t ibin = 0; ibin < bins.size(); ++ibin) {
       const double err = errors ? errorVals[ibin] : -1;
@@ -2,12 +2,15 @@
 // Authors: Carsten D. Burgard, DESY/ATLAS, 12/2021
 //          Jonas Rembser, CERN 12/2022
 
+#include <RooFit/Detail/JSONInterface.h>
 #include <RooFitHS3/JSONIO.h>
 #include <RooFitHS3/RooJSONFactoryWSTool.h>
 
 #include <RooAddPdf.h>
+#include <RooBinning.h>
 #include <RooCategory.h>
 #include <RooConstVar.h>
+#include <RooDataHist.h>
 #include <RooExponential.h>
 #include <RooGaussian.h>
 #include <RooGlobalFunc.h>
@@ -27,6 +30,8 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+
 namespace {
 
 // If the JSON files should be written out for debugging purpose.
@@ -250,6 +255,80 @@ TEST(RooFitHS3, RooHistPdf)
    EXPECT_EQ(status, 0);
 }
 
+// Check that the contents and errors of binned data survive a round trip
+// through the JSON text with all available JSON backends.
+TEST(RooFitHS3, BinnedDataRoundTrip)
+{
+   using RooFit::Detail::JSONNode;
+   using RooFit::Detail::JSONTree;
+
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x{"x", "x", 0.0, 10.0};
+   x.setBins(5);
+   RooRealVar y{"y", "y", 0.0, 4.0};
+   RooBinning yBinning{0.0, 4.0};
+   yBinning.addBoundary(1.0);
+   yBinning.addBoundary(1.5);
+   y.setBinning(yBinning);
+
+   // Values with short exact decimal representations, so that the comparison
+   // can be exact independent of how the backend formats doubles.
+   RooDataHist dataHist{"dataHist", "dataHist", {x, y}};
+   std::vector<double> errors(dataHist.numEntries());
+   for (int i = 0; i < dataHist.numEntries(); ++i) {
+      const double weight = (i % 3 == 0) ? i : 0.25 * i + 0.125;
+      errors[i] = 0.5 * i + 0.375;
+      dataHist.set(i, weight, errors[i]);
+   }
+
+   const std::string backendBefore = JSONTree::getBackend();
+
+   for (std::string const &backend : {"nlohmann-json", "rapidyaml"}) {
+      if (!JSONTree::hasBackend(backend))
+         continue;
+      SCOPED_TRACE(backend);
+      JSONTree::setBackend(backend);
+
+      // Contents via the full workspace IO.
+      RooWorkspace ws1;
+      ws1.import(dataHist, RooFit::Silence());
+      RooWorkspace ws2;
+      RooJSONFactoryWSTool{ws2}.importJSONfromString(RooJSONFactoryWSTool{ws1}.exportJSONtoString());
+
+      auto *dataHist2 = dynamic_cast<RooDataHist *>(ws2.data("dataHist"));
+      ASSERT_NE(dataHist2, nullptr);
+      ASSERT_EQ(dataHist2->numEntries(), dataHist.numEntries());
+      for (int i = 0; i < dataHist.numEntries(); ++i) {
+         EXPECT_EQ(dataHist2->weight(i), dataHist.weight(i)) << "bin " << i;
+      }
+
+      // Contents and errors via the binned data node.
+      std::stringstream ss;
+      {
+         std::unique_ptr<JSONTree> tree = JSONTree::create();
+         auto &output = tree->rootnode().set_map();
+         RooJSONFactoryWSTool::exportHisto(*dataHist.get(), dataHist.numEntries(), dataHist.weightArray(), output);
+         output["errors"].fill_seq_double(errors.data(), errors.size());
+         tree->rootnode().writeJSON(ss);
+      }
+      std::unique_ptr<JSONTree> tree = JSONTree::create(ss);
+      JSONNode const &node = tree->rootnode();
+      std::unique_ptr<RooDataHist> dataHist3 =
+         RooJSONFactoryWSTool::readBinnedData(node, "dataHist3", RooJSONFactoryWSTool::readAxes(node));
+      ASSERT_EQ(dataHist3->numEntries(), dataHist.numEntries());
+      for (int i = 0; i < dataHist.numEntries(); ++i) {
+         dataHist.get(i);
+         dataHist3->get(i);
+         EXPECT_EQ(dataHist3->weight(i), dataHist.weight(i)) << "bin " << i;
+         EXPECT_EQ(dataHist3->weightError(RooAbsData::SumW2), dataHist.weightError(RooAbsData::SumW2))
+            << "bin " << i;
+      }
+   }
+
+   JSONTree::setBackend(backendBefore);
+}
+
 TEST(RooFitHS3, RooLandau)
 {
    int status = validate({"Landau::landau(x[0, 10], mean[5], sigma[1.0, 0.1, 10])"});
@@ -153,6 +153,12 @@ public:
       }
    }
 
+   /// Fill this node with a sequence of numbers, the integral ones written as integers. Backends implement it
+   /// without creating a node per element, which matters for the contents of large histograms.
+   virtual void fill_seq_double(double const *values, std::size_t n);
+   /// Return the numbers held by this sequence node.
+   virtual std::vector<double> val_seq_double() const;
+
    JSONNode const *find(std::string const &key) const
    {
       auto &n = *this;
@@ -62,6 +62,33 @@ JSONNode::const_children_view JSONNode::children() const
            const_child_iterator(std::make_unique<::ChildItImpl<const JSONNode>>(*this, this->num_children()))};
 }
 
+void JSONNode::fill_seq_double(double const *values, std::size_t n)
+{
+   set_seq();
+   for (std::size_t i = 0; i < n; ++i) {
+      const double v = values[i];
+      // To make sure there are no unnecessary floating points in the JSON
+      if (int(v) == v) {
+         append_child() << int(v);
+      } else {
+         append_child() << v;
+      }
+   }
+}
+
+std::vector<double> JSONNode::val_seq_double() const
+{
+   if (!is_seq()) {
+      throw std::runtime_error("node " + key() + " is not of sequence type!");
+   }
+   std::vector<double> values;
+   values.reserve(num_children());
+   for (auto const &child : children()) {
+      values.push_back(child.val_double());
+   }
+   return values;
+}
+
 std::ostream &operator<<(std::ostream &os, JSONNode const &s)
 {
    s.writeJSON(os);
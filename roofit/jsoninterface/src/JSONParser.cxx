@@ -294,6 +294,39 @@ size_t TJSONTree::Node::num_children() const
    return node->get().size();
 }
 
+// The elements are set on the nlohmann::json array directly: going through
+// append_child() would add a node per element to the node cache of the tree.
+void TJSONTree::Node::fill_seq_double(double const *values, std::size_t n)
+{
+   set_seq();
+   auto &array = node->get();
+   array.clear();
+   array.get_ref<nlohmann::json::array_t &>().reserve(n);
+   for (std::size_t i = 0; i < n; ++i) {
+      const double v = values[i];
+      // To make sure there are no unnecessary floating points in the JSON
+      if (int(v) == v) {
+         array.push_back(int(v));
+      } else {
+         array.push_back(v);
+      }
+   }
+}
+
+std::vector<double> TJSONTree::Node::val_seq_double() const
+{
+   auto const &array = node->get();
+   if (!array.is_array()) {
+      throw std::runtime_error("node " + this->key() + " is not of sequence type!");
+   }
+   std::vector<double> values;
+   values.reserve(array.size());
+   for (auto const &element : array) {
+      values.push_back(element.get<double>());
+   }
+   return values;
+}
+
 TJSONTree::Node &TJSONTree::Node::child(size_t pos)
 {
    return Impl::mkNode(tree, "", node->get().at(pos));
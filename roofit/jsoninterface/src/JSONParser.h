@@ -66,6 +66,8 @@ public:
       bool has_child(std::string const &) const override;
       Node &append_child() override;
       size_t num_children() const override;
+      void fill_seq_double(double const *values, std::size_t n) override;
+      std::vector<double> val_seq_double() const override;
       Node &child(size_t pos) override;
       const Node &child(size_t pos) const override;
 
@@ -150,6 +150,7 @@ private:
 // Messages from master to queue
 enum class M2Q : int {
    enqueue = 10,
+   enqueue_batch = 11,
 };
 
 // Messages from worker to queue
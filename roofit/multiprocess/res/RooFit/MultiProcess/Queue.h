@@ -16,6 +16,8 @@
 #include "RooFit/MultiProcess/types.h"
 #include "RooFit/MultiProcess/Messenger.h"
 
+#include <vector>
+
 namespace RooFit {
 namespace MultiProcess {
 
@@ -34,6 +36,8 @@ public:
    /// \param[in] job_task JobTask object that contains the Job ID and the task index.
    virtual void add(JobTask job_task) = 0;
 
+   void add_batch(std::vector<JobTask> const &job_tasks);
+
    void loop();
 
    void process_master_message(M2Q message);
@@ -477,6 +477,7 @@ std::ostream &operator<<(std::ostream &out, const M2Q value)
    std::string s;
    switch (value) {
       PROCESS_VAL(M2Q::enqueue);
+      PROCESS_VAL(M2Q::enqueue_batch);
    default: s = std::to_string(static_cast<int>(value));
    }
    return out << s;
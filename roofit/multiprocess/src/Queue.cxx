@@ -53,6 +53,39 @@ void Queue::process_master_message(M2Q message)
       N_tasks_++;
       break;
    }
+   case M2Q::enqueue_batch: {
+      auto message = JobManager::instance()->messenger().receive_from_master_on_queue<zmq::message_t>();
+      auto message_begin = message.data<JobTask>();
+      auto message_end = message_begin + message.size() / sizeof(JobTask);
+      for (auto it = message_begin; it != message_end; ++it) {
+         add(*it);
+         N_tasks_++;
+      }
+      break;
+   }
+   }
+}
+
+/// \brief Enqueue multiple tasks at once
+///
+/// On the master process, all tasks are sent to the queue process in a single
+/// message. This is much cheaper than calling 'add()' for each task, which
+/// sends each task separately, so Jobs that queue many tasks at once should
+/// use this function. On the queue process, the tasks are added one by one.
+///
+/// \param[in] job_tasks JobTask objects that contain the Job IDs, state IDs and task indices.
+void Queue::add_batch(std::vector<JobTask> const &job_tasks)
+{
+   if (JobManager::instance()->process_manager().is_master()) {
+      if (job_tasks.empty()) {
+         return;
+      }
+      zmq::message_t message(job_tasks.begin(), job_tasks.end());
+      JobManager::instance()->messenger().send_from_master_to_queue(M2Q::enqueue_batch, std::move(message));
+   } else {
+      for (auto const &job_task : job_tasks) {
+         add(job_task);
+      }
    }
 }
 
@@ -58,8 +58,9 @@ public:
 
 class xSquaredPlusBVectorParallel : public RooFit::MultiProcess::Job {
 public:
-   explicit xSquaredPlusBVectorParallel(xSquaredPlusBVectorSerial *serial, bool update_state = false)
-      : serial_(serial), update_state_(update_state)
+   explicit xSquaredPlusBVectorParallel(xSquaredPlusBVectorSerial *serial, bool update_state = false,
+                                        bool enqueue_batch = false)
+      : serial_(serial), update_state_(update_state), enqueue_batch_(enqueue_batch)
    {
    }
 
@@ -70,11 +71,19 @@ public:
             update_state();
          }
          // master fills queue with tasks
+         std::vector<RooFit::MultiProcess::JobTask> job_tasks;
          for (std::size_t task_id = 0; task_id < serial_->x_.size(); ++task_id) {
             RooFit::MultiProcess::JobTask job_task{id_, state_id_, task_id};
-            get_manager()->queue()->add(job_task);
+            if (enqueue_batch_) {
+               job_tasks.push_back(job_task);
+            } else {
+               get_manager()->queue()->add(job_task);
+            }
             ++N_tasks_at_workers_;
          }
+         if (enqueue_batch_) {
+            get_manager()->queue()->add_batch(job_tasks);
+         }
 
          // wait for task results back from workers to master
          gather_worker_results();
@@ -138,6 +147,7 @@ private:
 
    xSquaredPlusBVectorSerial *serial_;
    bool update_state_ = false;
+   bool enqueue_batch_ = false;
    std::size_t N_tasks_at_workers_ = 0;
 };
 
@@ -251,4 +261,27 @@ TEST_P(TestMPJob, singleJobUpdateState)
    EXPECT_EQ(Hex(y_parallel_after_change[3]), Hex(y_expected[3]));
 }
 
+TEST_P(TestMPJob, singleJobEnqueueBatch)
+{
+   // Same as singleJobGetResult, but all tasks are sent to the queue in a
+   // single message using Queue::add_batch.
+   std::vector<double> x{0, 1, 2, 3};
+   double b_initial = 3.;
+
+   std::vector<double> y_expected{3, 4, 7, 12};
+
+   std::size_t NumCPU = GetParam();
+
+   xSquaredPlusBVectorSerial x_sq_plus_b(b_initial, x);
+   xSquaredPlusBVectorParallel x_sq_plus_b_parallel(&x_sq_plus_b, false, true);
+   RooFit::MultiProcess::Config::setDefaultNWorkers(NumCPU);
+
+   auto y_parallel = x_sq_plus_b_parallel.get_result();
+
+   EXPECT_EQ(Hex(y_parallel[0]), Hex(y_expected[0]));
+   EXPECT_EQ(Hex(y_parallel[1]), Hex(y_expected[1]));
+   EXPECT_EQ(Hex(y_parallel[2]), Hex(y_expected[2]));
+   EXPECT_EQ(Hex(y_parallel[3]), Hex(y_expected[3]));
+}
+
 INSTANTIATE_TEST_SUITE_P(NumberOfWorkerProcesses, TestMPJob, ::testing::Values(1, 2, 3));
@@ -47,6 +47,7 @@ public:
 
   void computeBatch(double* output, size_t size, RooFit::Detail::DataMap const&) const override;
   inline bool canComputeBatchWithCuda() const override { return true; }
+  inline bool canComputeBatchInParallel() const override { return true; }
 
 protected:
 
@@ -45,6 +45,7 @@ protected:
   double evaluate() const override;
   void computeBatch(double* output, size_t nEvents, RooFit::Detail::DataMap const&) const override;
   inline bool canComputeBatchWithCuda() const override { return true; }
+  inline bool canComputeBatchInParallel() const override { return true; }
 
 private:
 
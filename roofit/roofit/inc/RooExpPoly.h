@@ -49,6 +49,7 @@ protected:
    // CUDA support
    void computeBatch(double *output, size_t size, RooFit::Detail::DataMap const &) const override;
    inline bool canComputeBatchWithCuda() const override { return true; }
+   inline bool canComputeBatchInParallel() const override { return true; }
 
    /// Evaluation
    double evaluate() const override;
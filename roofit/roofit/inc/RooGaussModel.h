@@ -62,6 +62,7 @@ public:
   void computeBatch(double* output, size_t size, RooFit::Detail::DataMap const&) const override;
 
   bool canComputeBatchWithCuda() const override { return getBasisType(_basisCode) == expBasis; }
+  bool canComputeBatchInParallel() const override { return getBasisType(_basisCode) == expBasis; }
 
 protected:
 
@@ -65,6 +65,7 @@ protected:
 
    // It doesn't make sense to use the GPU if the polynomial has no terms.
    inline bool canComputeBatchWithCuda() const override { return !_coefList.empty(); }
+   inline bool canComputeBatchInParallel() const override { return !_coefList.empty(); }
 
 private:
    ClassDefOverride(RooPolynomial, 1); // Polynomial PDF
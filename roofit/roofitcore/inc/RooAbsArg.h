@@ -575,6 +575,12 @@ public:
   };
 
   virtual bool canComputeBatchWithCuda() const { return false; }
+  /// Whether computeBatch() can be called concurrently for disjoint ranges of
+  /// the events: each output value must only depend on the input values of the
+  /// same event, and computeBatch() must not modify the state of the object.
+  /// The RooFit::Evaluator then splits the events of this node across the
+  /// threads of the implicit multithreading pool.
+  virtual bool canComputeBatchInParallel() const { return false; }
   virtual bool isReducerNode() const { return false; }
 
   virtual void applyWeightSquared(bool flag);
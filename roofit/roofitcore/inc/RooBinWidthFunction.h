@@ -68,6 +68,7 @@ public:
   const RooHistFunc& histFunc() const { return (*_histFunc); }
   double evaluate() const override;
   void computeBatch(double* output, size_t size, RooFit::Detail::DataMap const&) const override;
+  void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
 
 private:
   RooTemplateProxy<const RooHistFunc> _histFunc;
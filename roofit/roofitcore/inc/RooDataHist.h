@@ -100,6 +100,7 @@ public:
                std::function<double(int)> getBinScale = [](int){ return 1.0; } );
 
   void weights(double* output, std::span<double const> xVals, int intOrder, bool correctForBinSize, bool cdfBoundaries);
+  bool binIndices(int* output, std::size_t n, std::vector<std::span<const double>> const& coords) const;
   /// Return weight of i-th bin. \see getIndex()
   double weight(std::size_t i) const { return _wgt[i]; }
   double weightFast(const RooArgSet& bin, int intOrder, bool correctForBinSize, bool cdfBoundaries);
@@ -19,6 +19,10 @@
 #include "RooHistPdf.h"
 #include "TVirtualFFT.h"
 
+#include <map>
+#include <memory>
+#include <vector>
+
 class RooRealVar;
 
 ///PDF for the numerical (FFT) convolution of two PDFs.
@@ -89,6 +93,22 @@ protected:
 
     std::unique_ptr<RooAbsBinning> histBinning;
     std::unique_ptr<RooAbsBinning> scanBinning;
+
+    /// Fourier transform of the sampling of an input p.d.f. in one cache slice
+    struct InputTransform {
+      Int_t nBins = 0;             ///< Number of bins of the cache histogram
+      Int_t nBufferedBins = 0;     ///< Number of sampled bins, including the buffer zones
+      Int_t zeroBin = 0;           ///< Bin of the sampling containing zero
+      std::vector<double> values;  ///< Real and imaginary parts of the nBufferedBins/2+1 transformed points
+    };
+    /// Transforms of an input p.d.f. for each slice position, valid as long as its parameters keep their values
+    struct InputTransforms {
+      RooArgSet params;
+      std::vector<double> paramValues;
+      std::map<std::vector<double>, InputTransform> slices;
+    };
+    InputTransforms transforms1;
+    InputTransforms transforms2;
   };
 
   friend class FFTCacheElem ;
@@ -100,6 +120,8 @@ protected:
   RooAbsArg& pdfObservable(RooAbsArg& histObservable) const override ;
   void fillCacheObject(PdfCacheElem& cache) const override ;
   void fillCacheSlice(FFTCacheElem& cache, const RooArgSet& slicePosition) const ;
+  const FFTCacheElem::InputTransform& transformInput(FFTCacheElem& cache, FFTCacheElem::InputTransforms& transforms, RooAbsPdf& pdf,
+                                                     std::unique_ptr<TVirtualFFT>& fft, const RooArgSet& slicePos, double shift) const ;
 
   PdfCacheElem* createCache(const RooArgSet* nset) const override ;
   TString histNameSuffix() const override ;
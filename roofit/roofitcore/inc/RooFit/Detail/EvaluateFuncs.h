@@ -83,6 +83,18 @@ inline unsigned int getUniformBinning(double low, double high, double val, unsig
    return val >= high ? numBins - 1 : std::abs((val - low) / binWidth);
 }
 
+/// Find the bin index of `val` for the bin boundaries `boundaries`. Values
+/// outside of the range are assigned to the first or last bin, like in
+/// RooBinning::binNumbers().
+inline unsigned int getNonUniformBinning(double const *boundaries, unsigned int numBins, double val)
+{
+   unsigned int bin = 0;
+   while (bin + 1 < numBins && val >= boundaries[bin + 1]) {
+      ++bin;
+   }
+   return bin;
+}
+
 inline double poissonEvaluate(double x, double par)
 {
    if (par < 0)
@@ -219,6 +231,19 @@ piecewiseInterpolation(unsigned int code, double low, double high, double nomina
    return sum;
 }
 
+inline double linInterpEvaluate(double const *params, double const *low, double const *high, unsigned int n,
+                                double nominal)
+{
+   double sum = nominal;
+   for (unsigned int i = 0; i < n; ++i) {
+      if (params[i] > 0)
+         sum += params[i] * (high[i] - nominal);
+      else
+         sum += params[i] * (nominal - low[i]);
+   }
+   return sum <= 0 ? 1E-9 : sum;
+}
+
 inline double logNormalEvaluate(double x, double k, double m0)
 {
    return ROOT::Math::lognormal_pdf(x, std::log(m0), std::abs(std::log(k)));
@@ -55,6 +55,7 @@ private:
    void assignToGPU(NodeInfo &info);
 #endif
    void computeCPUNode(const RooAbsArg *node, NodeInfo &info);
+   void computeCPUNodesInParallel();
    void setOperMode(RooAbsArg *arg, RooAbsArg::OperMode opMode);
    void syncDataTokens();
    void updateOutputSizes();
@@ -69,6 +70,7 @@ private:
    RooFit::Detail::DataMap _dataMapCUDA;
 #endif
    std::vector<NodeInfo> _nodes;                                    // the ordered computation graph
+   std::vector<NodeInfo *> _parallelNodes;                          // dirty nodes to compute on event ranges
    std::stack<RooHelpers::ChangeOperModeRAII> _changeOperModeRAIIs; // for resetting state of computation graph
 };
 
@@ -22,7 +22,10 @@
 #include "RooRealProxy.h"
 #include "RooSetProxy.h"
 #include "RooListProxy.h"
+#include <deque>
 #include <list>
+#include <utility>
+#include <vector>
 
 class RooArgSet ;
 class TH1F ;
@@ -71,6 +74,10 @@ public:
 
   static Int_t getCacheAllNumeric() ;
 
+  static void setNumericMemoSize(std::size_t size) ;
+
+  static std::size_t getNumericMemoSize() ;
+
   std::list<double>* plotSamplingHint(RooAbsRealLValue& obs, double xlo, double xhi) const override {
     // Forward plot sampling hint of integrand
     return _function->plotSamplingHint(obs,xlo,xhi) ;
@@ -91,6 +98,8 @@ protected:
 
   const RooArgSet& parameters() const ;
 
+  bool numericMemoKey(std::vector<double>& key) const ;
+
   enum IntOperMode { Hybrid, Analytic, PassThrough } ;
   //friend class RooAbsPdf ;
 
@@ -149,6 +158,10 @@ protected:
   bool _cacheNum = false;           ///< Cache integral if numeric
   static Int_t _cacheAllNDim ; ///<! Cache all integrals with given numeric dimension
 
+  /// Values of the last numeric integrations, keyed by the parameter values
+  mutable std::deque<std::pair<std::vector<double>, double>> _numericMemo; ///<!
+  static std::size_t _numericMemoSize ; ///<! Number of remembered numeric integral values
+
   ClassDefOverride(RooRealIntegral,4) // Real-valued function representing an integral over a RooAbsReal object
 };
 
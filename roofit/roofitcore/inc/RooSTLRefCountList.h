@@ -26,6 +26,8 @@
 #include <string>
 #include <algorithm>
 #include <cassert>
+#include <type_traits>
+#include <unordered_map>
 
 class RooLinkedList;
 
@@ -44,6 +46,7 @@ class RooSTLRefCountList {
     using Container_t = std::vector<T*>;
 
     static constexpr std::size_t minSizeForNamePointerOrdering = 7;
+    static constexpr std::size_t minSizeForPointerIndex = 32;
 
     RooSTLRefCountList() {
       // The static _renameCounter member gets connected to the RooNameReg as
@@ -72,6 +75,9 @@ class RooSTLRefCountList {
         if(!_orderedStorage.empty()) {
           _orderedStorage.insert(lowerBoundByNamePointer(obj), obj);
         }
+        if(pointerIndexIsValid()) {
+          _pointerIndex.emplace(obj, _storage.size());
+        }
         _storage.push_back(obj);
         _refCount.push_back(initialCount);
       }
@@ -137,6 +143,16 @@ class RooSTLRefCountList {
     ///Find an item by comparing its address.
     template<typename Obj_t>
     typename Container_t::const_iterator findByPointer(const Obj_t * item) const {
+      //Long lists, e.g. the clients of a parameter shared by all the pdfs of a
+      //large workspace, are searched with a hash map from the address to the
+      //position, so that filling them does not scale quadratically.
+      if constexpr (std::is_convertible<const Obj_t *, const T *>::value) {
+        if(_storage.size() >= minSizeForPointerIndex) {
+          if(!pointerIndexIsValid()) initializePointerIndex();
+          auto found = _pointerIndex.find(item);
+          return found != _pointerIndex.end() ? _storage.begin() + found->second : _storage.end();
+        }
+      }
       return std::find(_storage.begin(), _storage.end(), item);
     }
 
@@ -217,6 +233,14 @@ class RooSTLRefCountList {
           //Therefore, erase at begin + pos instead of 'item'
           _storage.erase(_storage.begin() + pos);
           _refCount.erase(_refCount.begin() + pos);
+          if(pointerIndexIsValid(1)) {
+            _pointerIndex.erase(obj);
+            for(std::size_t i = pos; i < _storage.size(); ++i) {
+              _pointerIndex[_storage[i]] = i;
+            }
+          } else {
+            _pointerIndex.clear();
+          }
           if(!_orderedStorage.empty()) {
             // For the ordered storage, we could find by name pointer address
             // with binary search, but this will not work anymore if one of the
@@ -245,6 +269,10 @@ class RooSTLRefCountList {
       if (item != _storage.end()) {
         const std::size_t pos = item - _storage.begin();
         _storage[pos] = newObj;
+        if(pointerIndexIsValid()) {
+          _pointerIndex.erase(oldObj);
+          _pointerIndex[newObj] = pos;
+        }
         // The content has changed, so the ordered-by-name storage was invalidated.
         _orderedStorage.clear();
         return _refCount[pos];
@@ -303,9 +331,24 @@ class RooSTLRefCountList {
       _renameCounterForLastSorting = *_renameCounter;
     }
 
+    //The index holds one entry per element of _storage while it is in use.
+    //`extra` is the number of elements just removed from _storage.
+    bool pointerIndexIsValid(std::size_t extra = 0) const {
+      return !_pointerIndex.empty() && _pointerIndex.size() == _storage.size() + extra;
+    }
+
+    void initializePointerIndex() const {
+      _pointerIndex.clear();
+      _pointerIndex.reserve(_storage.size());
+      for(std::size_t i = 0; i < _storage.size(); ++i) {
+        _pointerIndex.emplace(_storage[i], i);
+      }
+    }
+
     Container_t _storage;
     std::vector<UInt_t> _refCount;
     mutable std::vector<T*> _orderedStorage; //!
+    mutable std::unordered_map<const T*, std::size_t> _pointerIndex; //!
     mutable unsigned long _renameCounterForLastSorting = 0; ///<!
 
     // It is expensive to access the RooNameReg instance to get the counter for
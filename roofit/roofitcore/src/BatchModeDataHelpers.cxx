@@ -19,6 +19,7 @@
 
 #include <ROOT/StringUtils.hxx>
 
+#include <algorithm>
 #include <numeric>
 
 namespace {
@@ -30,9 +31,11 @@ void assignSpan(std::span<T> &to, std::span<T> const &from)
    to = from;
 }
 
+// If `canUseDataMemory` is true, the spans point directly to the memory of
+// the dataset if no entries need to be skipped, avoiding a copy of the data.
 std::map<RooFit::Detail::DataKey, std::span<const double>>
 getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::string const &prefix,
-                   std::stack<std::vector<double>> &buffers, bool skipZeroWeights)
+                   std::stack<std::vector<double>> &buffers, bool skipZeroWeights, bool canUseDataMemory)
 {
    std::map<RooFit::Detail::DataKey, std::span<const double>> dataSpans; // output variable
 
@@ -63,10 +66,22 @@ getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::stri
    hasZeroWeight.resize(nEvents);
    std::size_t nNonZeroWeight = 0;
 
+   if (!weight.empty() && skipZeroWeights) {
+      for (std::size_t i = 0; i < nEvents; ++i) {
+         hasZeroWeight[i] = weight[i] == 0;
+      }
+   }
+   const bool anyZeroWeight = std::find(hasZeroWeight.begin(), hasZeroWeight.end(), true) != hasZeroWeight.end();
+   const bool copyData = !canUseDataMemory || anyZeroWeight;
+
    // Add weights to the datamap. They should have the names expected by the
    // RooNLLVarNew. We also add the sumW2 weights here under a different name,
    // so we can apply the sumW2 correction by easily swapping the spans.
-   {
+   if (!weight.empty() && !copyData) {
+      nNonZeroWeight = nEvents;
+      insert(RooNLLVarNew::weightVarName, weight);
+      insert(RooNLLVarNew::weightVarNameSumW2, weightSumW2);
+   } else {
       buffers.emplace();
       auto &buffer = buffers.top();
       buffers.emplace();
@@ -84,12 +99,10 @@ getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::stri
          buffer.reserve(nEvents);
          bufferSumW2.reserve(nEvents);
          for (std::size_t i = 0; i < nEvents; ++i) {
-            if (!skipZeroWeights || weight[i] != 0) {
+            if (!hasZeroWeight[i]) {
                buffer.push_back(weight[i]);
                bufferSumW2.push_back(weightSumW2[i]);
                ++nNonZeroWeight;
-            } else {
-               hasZeroWeight[i] = true;
             }
          }
          assignSpan(weight, {buffer.data(), nNonZeroWeight});
@@ -105,6 +118,11 @@ getSingleDataSpans(RooAbsData const &data, std::string_view rangeName, std::stri
 
       std::span<const double> span{item.second};
 
+      if (!copyData) {
+         insert(item.first->GetName(), span);
+         continue;
+      }
+
       buffers.emplace();
       auto &buffer = buffers.top();
       buffer.reserve(nNonZeroWeight);
@@ -214,6 +232,9 @@ RooFit::BatchModeDataHelpers::getDataSpans(RooAbsData const &data, std::string c
    std::vector<bool> isBinnedL;
    bool splitRange = false;
    std::vector<std::unique_ptr<RooAbsData>> splitDataSets;
+   // The split datasets are deleted at the end of this function, so their
+   // memory can't be referenced by the output spans.
+   bool canUseDataMemory = true;
 
    if (simPdf) {
       std::unique_ptr<TList> splits{data.split(*simPdf, true)};
@@ -225,10 +246,10 @@ RooFit::BatchModeDataHelpers::getDataSpans(RooAbsData const &data, std::string c
          }
          datasets.emplace_back(std::string("_") + d->GetName() + "_", d);
          isBinnedL.emplace_back(simComponent->getAttribute("BinnedLikelihoodActive"));
-         // The dataset need to be kept alive because the datamap points to their content
          splitDataSets.emplace_back(d);
       }
       splitRange = simPdf->getAttribute("SplitRange");
+      canUseDataMemory = false;
    } else {
       datasets.emplace_back("", &data);
       isBinnedL.emplace_back(false);
@@ -240,7 +261,7 @@ RooFit::BatchModeDataHelpers::getDataSpans(RooAbsData const &data, std::string c
       auto const &toAdd = datasets[iData];
       auto spans = getSingleDataSpans(
          *toAdd.second, RooHelpers::getRangeNameForSimComponent(rangeName, splitRange, toAdd.second->GetName()),
-         toAdd.first, buffers, skipZeroWeights && !isBinnedL[iData]);
+         toAdd.first, buffers, skipZeroWeights && !isBinnedL[iData], canUseDataMemory);
       for (auto const &item : spans) {
          dataSpans.insert(item);
       }
@@ -94,6 +94,24 @@ double RooBinWidthFunction::evaluate() const {
 }
 
 
+void RooBinWidthFunction::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+   if (!_enabled) {
+      ctx.addResult(this, "1.0");
+      return;
+   }
+
+   RooDataHist const &dataHist = _histFunc->dataHist();
+   std::string const &idxName = dataHist.calculateTreeIndexForCodeSquash(this, ctx, _histFunc->variables());
+   std::string const &widthArrName = ctx.buildArg(dataHist.binVolumes(0, dataHist.numEntries()));
+
+   if (_divideByBinWidth) {
+      ctx.addResult(this, "1.0 / " + widthArrName + "[" + idxName + "]");
+   } else {
+      ctx.addResult(this, widthArrName + "[" + idxName + "]");
+   }
+}
+
 /// Compute bin index for all values of the observable(s) in `evalData`, and return their volumes or inverse volumes, depending
 /// on the configuration chosen in the constructor.
 /// If a bin is not valid, return a volume of 1.
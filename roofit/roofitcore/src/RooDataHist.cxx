@@ -51,6 +51,7 @@ See RooAbsData::plotOn().
 #include "RooArgList.h"
 #include "RooRealVar.h"
 #include "RooMath.h"
+#include "RooNumber.h"
 #include "RooBinning.h"
 #include "RooPlot.h"
 #include "RooHistError.h"
@@ -993,7 +994,8 @@ std::string RooDataHist::declWeightArrayForCodeSquash(RooAbsArg const *klass, Ro
 
    std::string arrayDecl = "double " + weightName + "[" + std::to_string(_arrSize) + "] = {";
    for (Int_t i = 0; i < _arrSize; i++) {
-      arrayDecl += " " + std::to_string(_wgt[i]) + (correctForBinSize ? " / " + std::to_string(_binv[i]) : "") + ",";
+      arrayDecl += " " + RooNumber::toString(_wgt[i]) +
+                   (correctForBinSize ? " / " + RooNumber::toString(_binv[i]) : "") + ",";
    }
    arrayDecl.back() = ' ';
    arrayDecl += "};\n";
@@ -1023,15 +1025,19 @@ std::string RooDataHist::calculateTreeIndexForCodeSquash(RooAbsArg const *klass,
          coutE(InputArguments) << "RooHistPdf::weight(" << GetName()
                                << ") ERROR: Code Squashing currently does not support category values." << std::endl;
          return "";
-      } else if (!dynamic_cast<RooUniformBinning const *>(binning)) {
-         coutE(InputArguments) << "RooHistPdf::weight(" << GetName()
-                               << ") ERROR: Code Squashing currently only supports uniformly binned cases."
-                               << std::endl;
-         return "";
       }
 
-      std::string const &bin = ctx.buildCall("RooFit::Detail::EvaluateFuncs::getUniformBinning", binning->lowBound(),
-                                             binning->highBound(), *theVar, binning->numBins());
+      std::string bin;
+      if (binning->isUniform()) {
+         bin = ctx.buildCall("RooFit::Detail::EvaluateFuncs::getUniformBinning", binning->lowBound(),
+                             binning->highBound(), *theVar, binning->numBins());
+      } else {
+         // For non-uniform binnings, the bin boundaries are written into the
+         // code as an array that is searched for the bin index.
+         std::span<const double> boundaries{binning->array(), static_cast<std::size_t>(binning->numBoundaries())};
+         bin = ctx.buildCall("RooFit::Detail::EvaluateFuncs::getNonUniformBinning", ctx.buildArg(boundaries),
+                             binning->numBins(), *theVar);
+      }
       ctx.addToCodeBody(klass, idxName + " += " + std::to_string(idxMult) + " * " + bin + ";\n");
 
       // Use RooAbsLValue here because it also generalized to categories, which
@@ -1377,6 +1383,58 @@ void RooDataHist::weights(double* output, std::span<double const> xVals, int int
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Calculate the bin indices for many coordinates at once, without setting the
+/// values of the histogram variables like calcTreeIndex() does.
+/// \param[out] output Array of length `n` for the bin indices. Coordinates
+///                    outside of the binning range get the index -1.
+/// \param[in] n Number of coordinates.
+/// \param[in] coords Values for each histogram variable, aligned with the
+///                   internal variables. A span can either have `n` elements
+///                   or a single element if the value is the same for all
+///                   coordinates.
+/// \return `false` if the indices can't be computed this way because the
+///         histogram has category dimensions. The output is not filled then.
+bool RooDataHist::binIndices(int* output, std::size_t n, std::vector<std::span<const double>> const& coords) const
+{
+  assert(coords.size() == _vars.size());
+
+  for (auto const& binning : _lvbins) {
+    if (!binning) return false;
+  }
+
+  std::fill(output, output + n, 0);
+
+  for (std::size_t iVar = 0; iVar < _vars.size(); ++iVar) {
+    RooAbsBinning const& binning = *_lvbins[iVar];
+    std::span<const double> x = coords[iVar];
+    if (x.size() == n) {
+      binning.binNumbers(x.data(), output, n, _idxMult[iVar]);
+    } else {
+      const int offset = _idxMult[iVar] * binning.binNumber(x[0]);
+      for (std::size_t i = 0; i < n; ++i) {
+        output[i] += offset;
+      }
+    }
+  }
+
+  // The binNumbers() function maps values outside of the range to the
+  // first or last bin, so we need to flag them in a second pass.
+  for (std::size_t iVar = 0; iVar < _vars.size(); ++iVar) {
+    RooAbsBinning const& binning = *_lvbins[iVar];
+    const double lo = binning.lowBound();
+    const double hi = binning.highBound();
+    std::span<const double> x = coords[iVar];
+    for (std::size_t i = 0; i < n; ++i) {
+      const double val = x[x.size() == n ? i : 0];
+      if (val < lo || val > hi) output[i] = -1;
+    }
+  }
+
+  return true;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// A faster version of RooDataHist::weight that assumes the passed arguments
 /// are aligned with the histogram variables.
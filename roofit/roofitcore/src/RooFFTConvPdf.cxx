@@ -111,6 +111,7 @@
 #include "RooFFTConvPdf.h"
 
 #include "RooAbsReal.h"
+#include "RooAbsCategory.h"
 #include "RooMsgService.h"
 #include "RooDataHist.h"
 #include "RooHistPdf.h"
@@ -135,6 +136,24 @@ using namespace std;
 
 ClassImp(RooFFTConvPdf);
 
+namespace {
+
+/// Values of the given arguments, identifying the position of a cache slice or the state of the parameters of an input p.d.f.
+std::vector<double> argValues(const RooArgSet& args)
+{
+  std::vector<double> values ;
+  for (RooAbsArg* arg : args) {
+    if (auto real = dynamic_cast<RooAbsReal*>(arg)) {
+      values.push_back(real->getVal()) ;
+    } else if (auto cat = dynamic_cast<RooAbsCategory*>(arg)) {
+      values.push_back(cat->getCurrentIndex()) ;
+    }
+  }
+  return values ;
+}
+
+} // namespace
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor for numerical (FFT) convolution of PDFs.
@@ -368,6 +387,10 @@ RooFFTConvPdf::FFTCacheElem::FFTCacheElem(const RooFFTConvPdf& self, const RooAr
   // and set all nodes on both pdfs to operMode AlwaysDirty
   hist()->setDirtyProp(false) ;
   convObs->setOperMode(ADirty,true) ;
+
+  // Parameters deciding whether the cached transforms of the inputs are still valid
+  pdf1Clone->getParameters(hist()->get(), transforms1.params) ;
+  pdf2Clone->getParameters(hist()->get(), transforms2.params) ;
 }
 
 
@@ -501,43 +524,32 @@ void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos)
   //
   //
 
-  Int_t N,N2,binShift1,binShift2 ;
-
   RooRealVar* histX = (RooRealVar*) cacheHist.get()->find(_x.arg().GetName()) ;
   if (_bufStrat==Extend) histX->setBinning(*aux.scanBinning) ;
-  std::vector<double> input1 = scanPdf((RooRealVar&)_x.arg(),*aux.pdf1Clone,cacheHist,slicePos,N,N2,binShift1,_shift1) ;
-  std::vector<double> input2 = scanPdf((RooRealVar&)_x.arg(),*aux.pdf2Clone,cacheHist,slicePos,N,N2,binShift2,_shift2) ;
+  const FFTCacheElem::InputTransform& transform1 = transformInput(aux,aux.transforms1,*aux.pdf1Clone,aux.fftr2c1,slicePos,_shift1) ;
+  const FFTCacheElem::InputTransform& transform2 = transformInput(aux,aux.transforms2,*aux.pdf2Clone,aux.fftr2c2,slicePos,_shift2) ;
   if (_bufStrat==Extend) histX->setBinning(*aux.histBinning) ;
 
+  Int_t N = transform1.nBins ;
+  Int_t N2 = transform1.nBufferedBins ;
+  Int_t binShift1 = transform1.zeroBin ;
 
-
-
-  // Retrieve previously defined FFT transformation plans
-  if (!aux.fftr2c1) {
-    aux.fftr2c1.reset(TVirtualFFT::FFT(1, &N2, "R2CK"));
-    aux.fftr2c2.reset(TVirtualFFT::FFT(1, &N2, "R2CK"));
+  // Retrieve previously defined FFT transformation plan
+  if (!aux.fftc2r) {
     aux.fftc2r.reset(TVirtualFFT::FFT(1, &N2, "C2RK"));
-
-    if (aux.fftr2c1 == nullptr || aux.fftr2c2 == nullptr || aux.fftc2r == nullptr) {
+    if (aux.fftc2r == nullptr) {
       coutF(Eval) << "RooFFTConvPdf::fillCacheSlice(" << GetName() << "Cannot get a handle to fftw. Maybe ROOT was built without it?" << std::endl;
       throw std::runtime_error("Cannot get a handle to fftw.");
     }
   }
 
-  // Real->Complex FFT Transform on p.d.f. 1 sampling
-  aux.fftr2c1->SetPoints(input1.data());
-  aux.fftr2c1->Transform();
-
-  // Real->Complex FFT Transform on p.d.f 2 sampling
-  aux.fftr2c2->SetPoints(input2.data());
-  aux.fftr2c2->Transform();
-
   // Loop over first half +1 of complex output results, multiply
   // and set as input of reverse transform
+  const double* t1 = transform1.values.data() ;
+  const double* t2 = transform2.values.data() ;
   for (Int_t i=0 ; i<N2/2+1 ; i++) {
-    double re1,re2,im1,im2 ;
-    aux.fftr2c1->GetPointComplex(i,re1,im1) ;
-    aux.fftr2c2->GetPointComplex(i,re2,im2) ;
+    double re1 = t1[2*i], im1 = t1[2*i+1] ;
+    double re2 = t2[2*i], im2 = t2[2*i+1] ;
     double re = re1*re2 - im1*im2 ;
     double im = re1*im2 + re2*im1 ;
     TComplex t(re,im) ;
@@ -567,6 +579,55 @@ void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the Real->Complex FFT transform of the sampling of 'pdf' at slice position 'slicePos'.
+/// The transforms are kept for each slice position as long as the parameters of 'pdf' keep their
+/// values, so that a change of the parameters of one input p.d.f. only requires to sample and
+/// transform that input again, e.g. the resolution model when fitting the physics p.d.f.
+
+const RooFFTConvPdf::FFTCacheElem::InputTransform&
+RooFFTConvPdf::transformInput(FFTCacheElem& aux, FFTCacheElem::InputTransforms& transforms, RooAbsPdf& pdf,
+                              std::unique_ptr<TVirtualFFT>& fft, const RooArgSet& slicePos, double shift) const
+{
+  RooDataHist& cacheHist = *aux.hist() ;
+  RooRealVar* histX = (RooRealVar*) cacheHist.get()->find(_x.arg().GetName()) ;
+
+  std::vector<double> paramValues = argValues(transforms.params) ;
+  if (paramValues != transforms.paramValues) {
+    transforms.paramValues = std::move(paramValues) ;
+    transforms.slices.clear() ;
+  }
+
+  FFTCacheElem::InputTransform& transform = transforms.slices[argValues(slicePos)] ;
+  if (!transform.values.empty() && transform.nBins == histX->numBins(binningName())) {
+    return transform ;
+  }
+
+  Int_t N2 = 0 ;
+  std::vector<double> input = scanPdf((RooRealVar&)_x.arg(),pdf,cacheHist,slicePos,transform.nBins,N2,transform.zeroBin,shift) ;
+  transform.nBufferedBins = N2 ;
+
+  // Retrieve previously defined FFT transformation plan
+  if (!fft) {
+    fft.reset(TVirtualFFT::FFT(1, &N2, "R2CK"));
+    if (fft == nullptr) {
+      coutF(Eval) << "RooFFTConvPdf::fillCacheSlice(" << GetName() << "Cannot get a handle to fftw. Maybe ROOT was built without it?" << std::endl;
+      throw std::runtime_error("Cannot get a handle to fftw.");
+    }
+  }
+
+  fft->SetPoints(input.data()) ;
+  fft->Transform() ;
+
+  transform.values.resize(2*(N2/2+1)) ;
+  for (Int_t i=0 ; i<N2/2+1 ; i++) {
+    fft->GetPointComplex(i,transform.values[2*i],transform.values[2*i+1]) ;
+  }
+
+  return transform ;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Scan the values of 'pdf' in observable 'obs' using the bin values stored in 'hist' at slice position 'slicePos'
 /// N is filled with the number of bins defined in hist, N2 is filled with N plus the number of buffer bins
@@ -257,7 +257,7 @@ std::string CodeSquashContext::buildArg(std::span<const double> arr)
    std::string arrName = getTmpVarName();
    std::string arrDecl = "double " + arrName + "[" + std::to_string(n) + "] = {";
    for (unsigned int i = 0; i < n; i++) {
-      arrDecl += " " + std::to_string(arr[i]) + ",";
+      arrDecl += " " + RooNumber::toString(arr[i]) + ",";
    }
    arrDecl.back() = '}';
    arrDecl += ";\n";
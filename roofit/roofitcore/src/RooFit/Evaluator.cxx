@@ -24,6 +24,15 @@ computations take place in the RooBatchCompute library and can be carried off
 by either the CPU or a CUDA-supporting GPU. The Evaluator class takes care
 of data transfers. An instance of this class is created every time
 RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
+
+If implicit multithreading is enabled with ROOT::EnableImplicitMT(), the CPU
+computations of the nodes that support it (see
+RooAbsArg::canComputeBatchInParallel()) are split into ranges of a fixed
+number of events, which are computed in parallel by the threads of the pool.
+The other nodes split their RooBatchCompute calls across the threads. The
+negative log-likelihood is the pairwise sum of partial sums over a fixed number
+of events, so that the result of the reduction doesn't depend on the number of
+threads either.
 **/
 
 #include <RooFit/Evaluator.h>
@@ -42,6 +51,13 @@ RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
 #include "BatchModeHelpers.h"
 #include "Detail/Buffers.h"
 
+#include <TROOT.h>
+
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
+
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <numeric>
@@ -59,6 +75,10 @@ namespace RooFit {
 
 namespace {
 
+/// The number of events of the ranges that are computed in parallel. It
+/// doesn't depend on the number of threads, so that neither do the results.
+constexpr std::size_t parallelChunkSize = 4096;
+
 void logArchitectureInfo(bool useGPU)
 {
    // We have to exit early if the message stream is not active. Otherwise it's
@@ -122,6 +142,8 @@ struct NodeInfo {
    bool isDirty = true;
    bool isCategory = false;
    bool hasLogged = false;
+   bool computeInParallel = false; ///< whether the node can be computed in parallel on ranges of the events
+   bool isWaitingForParallel = false;
    std::size_t outputSize = 1;
    std::size_t lastSetValCount = std::numeric_limits<std::size_t>::max();
    double scalarBuffer = 0.0;
@@ -333,6 +355,17 @@ void Evaluator::updateOutputSizes()
       }
    }
 
+   for (auto &info : _nodes) {
+      info.computeInParallel = !_useGPU && !info.isScalar() && !info.fromArrayInput && !info.isVariable &&
+                               info.absArg->canComputeBatchInParallel();
+      // All the inputs that are not scalar must be values of the same events
+      for (NodeInfo *serverInfo : info.serverInfos) {
+         if (!serverInfo->isScalar() && serverInfo->outputSize != info.outputSize) {
+            info.computeInParallel = false;
+         }
+      }
+   }
+
 #ifdef R__HAS_CUDA
    if (_useGPU) {
       markGPUNodes();
@@ -398,6 +431,81 @@ void Evaluator::computeCPUNode(const RooAbsArg *node, NodeInfo &info)
 #endif
 }
 
+/// Compute the nodes in _parallelNodes, splitting their events into ranges of
+/// parallelChunkSize events that are computed by the threads of the implicit
+/// multithreading pool. Each thread computes all the nodes for its range, in
+/// the order of the computation graph, with a copy of the data map that only
+/// has the values of the events of the range.
+void Evaluator::computeCPUNodesInParallel()
+{
+   if (_parallelNodes.empty())
+      return;
+
+   // The nodes are grouped by their number of events. The output buffers and
+   // data map entries are set up in this thread.
+   struct Group {
+      std::size_t nEvents = 0;
+      std::vector<std::pair<NodeInfo *, double *>> nodes;
+   };
+   std::vector<Group> groups;
+   for (NodeInfo *info : _parallelNodes) {
+      const std::size_t nOut = info->outputSize;
+      if (!info->buffer) {
+         info->buffer = _bufferManager->makeCpuBuffer(nOut);
+      }
+      double *buffer = info->buffer->cpuWritePtr();
+      _dataMapCPU.set(info->absArg, {buffer, nOut});
+      auto found = std::find_if(groups.begin(), groups.end(), [&](Group const &g) { return g.nEvents == nOut; });
+      if (found == groups.end()) {
+         groups.emplace_back();
+         found = groups.end() - 1;
+         found->nEvents = nOut;
+      }
+      found->nodes.emplace_back(info, buffer);
+      info->isWaitingForParallel = false;
+   }
+   _parallelNodes.clear();
+
+   std::vector<std::pair<Group const *, std::size_t>> tasks; // the group and the first event of each range
+   for (Group const &group : groups) {
+      for (std::size_t begin = 0; begin < group.nEvents; begin += parallelChunkSize) {
+         tasks.emplace_back(&group, begin);
+      }
+   }
+
+   // The RooBatchCompute calls of the nodes don't split the events any further
+   RooBatchCompute::Config config;
+   config.setUseImplicitMT(false);
+
+   auto task = [&](unsigned int iTask) {
+      Group const &group = *tasks[iTask].first;
+      const std::size_t begin = tasks[iTask].second;
+      const std::size_t nEvents = std::min(parallelChunkSize, group.nEvents - begin);
+      Detail::DataMap dataMap{_dataMapCPU};
+      for (NodeInfo const &info : _nodes) {
+         auto span = _dataMapCPU.at(info.absArg);
+         if (span.size() == group.nEvents) {
+            dataMap.set(info.absArg, {span.data() + begin, nEvents});
+         }
+      }
+      for (auto const &node : group.nodes) {
+         dataMap.setConfig(node.first->absArg, config);
+         static_cast<RooAbsReal const *>(node.first->absArg)->computeBatch(node.second + begin, nEvents, dataMap);
+      }
+   };
+
+#ifdef R__USE_IMT
+   if (tasks.size() > 1) {
+      ROOT::TThreadExecutor executor;
+      executor.Foreach(task, ROOT::TSeqU(tasks.size()));
+      return;
+   }
+#endif
+   for (unsigned int iTask = 0; iTask < tasks.size(); ++iTask) {
+      task(iTask);
+   }
+}
+
 /// Process a variable in the computation graph. This is a separate non-inlined
 /// function such that we can see in performance profiles how long this takes.
 void Evaluator::processVariable(NodeInfo &nodeInfo)
@@ -437,6 +545,8 @@ std::span<const double> Evaluator::run()
    }
 #endif
 
+   const bool inParallel = ROOT::IsImplicitMTEnabled();
+
    for (auto &nodeInfo : _nodes) {
       if (!nodeInfo.fromArrayInput) {
          if (nodeInfo.isVariable) {
@@ -444,12 +554,26 @@ std::span<const double> Evaluator::run()
          } else {
             if (nodeInfo.isDirty) {
                setClientsDirty(nodeInfo);
-               computeCPUNode(nodeInfo.absArg, nodeInfo);
+               if (inParallel && nodeInfo.computeInParallel) {
+                  // Computed together with the other nodes that are computed
+                  // in parallel, before the first node that needs its values.
+                  nodeInfo.isWaitingForParallel = true;
+                  _parallelNodes.push_back(&nodeInfo);
+               } else {
+                  for (NodeInfo *serverInfo : nodeInfo.serverInfos) {
+                     if (serverInfo->isWaitingForParallel) {
+                        computeCPUNodesInParallel();
+                        break;
+                     }
+                  }
+                  computeCPUNode(nodeInfo.absArg, nodeInfo);
+               }
                nodeInfo.isDirty = false;
             }
          }
       }
    }
+   computeCPUNodesInParallel();
 
    // return the final output
    return _dataMapCPU.at(&_topNode);
@@ -559,10 +683,13 @@ void Evaluator::assignToGPU(NodeInfo &info)
    }
    _dataMapCUDA.set(node, {buffer, nOut});
    node->computeBatch(buffer, nOut, _dataMapCUDA);
-   CudaInterface::cudaEventRecord(*info.event, *info.stream);
    if (info.copyAfterEvaluation) {
+      // The copy to the host is enqueued in the stream of this node and
+      // doesn't block. The CPU clients are only computed once the stream is
+      // idle, which is checked in getValHeterogeneous().
       _dataMapCPU.set(node, {info.buffer->cpuReadPtr(), nOut});
    }
+   CudaInterface::cudaEventRecord(*info.event, *info.stream);
 }
 
 /// Decides which nodes are assigned to the GPU in a CUDA fit.
@@ -207,6 +207,7 @@ void RooHistFunc::computeBatch(double* output, size_t size, RooFit::Detail::Data
   }
 
   std::vector<std::span<const double>> inputValues;
+  bool allReal = true;
   for (const auto& obs : _depList) {
     auto realObs = dynamic_cast<const RooAbsReal*>(obs);
     if (realObs) {
@@ -214,6 +215,21 @@ void RooHistFunc::computeBatch(double* output, size_t size, RooFit::Detail::Data
       inputValues.push_back(std::move(inputs));
     } else {
       inputValues.emplace_back();
+      allReal = false;
+    }
+  }
+
+  // Without interpolation, the weights can be looked up directly by bin index
+  // without going through the histogram variables for each entry.
+  if (_intOrder == 0 && allReal) {
+    // Like in RooDataHist::weights(), use the tail of the output buffer for the bin indices.
+    auto binIndices = reinterpret_cast<int*>(output + size) - size;
+    if (_dataHist->binIndices(binIndices, size, inputValues)) {
+      for (std::size_t i = 0; i < size; ++i) {
+        const int binIdx = binIndices[i];
+        output[i] = binIdx >= 0 ? _dataHist->weight(binIdx) : 0.;
+      }
+      return;
     }
   }
 
@@ -581,24 +597,27 @@ std::vector<Int_t> RooHistFunc::getBins(RooFit::Detail::DataMap const& dataMap)
 
   const auto batchSize = std::max_element(depData.begin(), depData.end(),
       [](const std::span<const double>& a, const std::span<const double>& b){ return a.size() < b.size(); })->size();
-  std::vector<Int_t> results;
+  std::vector<Int_t> results(batchSize);
+
+  if (_dataHist->binIndices(results.data(), batchSize, depData)) {
+    return results;
+  }
 
   for (std::size_t evt = 0; evt < batchSize; ++evt) {
-    if (!_depList.empty()) {
-      for (auto i = 0u; i < _histObsList.size(); ++i) {
-        const auto harg = _histObsList[i];
+    bool skip = false;
+    for (auto i = 0u; i < _histObsList.size(); ++i) {
+      const auto harg = _histObsList[i];
 
-        if (evt < depData[i].size())
-          harg->setCachedValue(depData[i][evt], false);
+      if (evt < depData[i].size())
+        harg->setCachedValue(depData[i][evt], false);
 
-        if (!harg->inRange(nullptr)) {
-          results.push_back(-1);
-          continue;
-        }
+      if (!harg->inRange(nullptr)) {
+        skip = true;
+        break;
       }
     }
 
-    results.push_back(_dataHist->getIndex(_histObsList, true));
+    results[evt] = skip ? -1 : _dataHist->getIndex(_histObsList, true);
   }
 
   return results;
@@ -38,6 +38,7 @@ computation times.
 #include <TMath.h>
 #include <Math/Util.h>
 
+#include <algorithm>
 #include <numeric>
 #include <stdexcept>
 #include <vector>
@@ -211,6 +212,17 @@ double RooNLLVarNew::computeBatchBinnedL(std::span<const double> preds, std::spa
 
    const bool predsAreYields = _binw.empty();
 
+   // The log-gamma terms only depend on the observed bin counts. They are
+   // expensive to evaluate, so they are cached as long as the data doesn't
+   // change. Comparing the weights is much cheaper than recomputing them.
+   if (!std::equal(weights.begin(), weights.end(), _binnedLWeights.begin(), _binnedLWeights.end())) {
+      _binnedLWeights.assign(weights.begin(), weights.end());
+      _binnedLLnGamma.resize(weights.size());
+      for (std::size_t i = 0; i < weights.size(); ++i) {
+         _binnedLLnGamma[i] = TMath::LnGamma(weights[i] + 1);
+      }
+   }
+
    for (std::size_t i = 0; i < preds.size(); ++i) {
 
       double eventWeight = weights[i];
@@ -234,7 +246,7 @@ double RooNLLVarNew::computeBatchBinnedL(std::span<const double> preds, std::spa
 
       } else {
 
-         result += -1 * (-mu + N * log(mu) - TMath::LnGamma(N + 1));
+         result += -1 * (-mu + N * std::log(mu) - _binnedLLnGamma[i]);
          sumWeightKahanSum += eventWeight;
       }
    }
@@ -75,6 +75,8 @@ private:
    int _simCount = 1;
    std::string _prefix;
    std::vector<double> _binw;
+   mutable std::vector<double> _binnedLWeights; ///<! Weights for which the log-gamma terms were cached
+   mutable std::vector<double> _binnedLLnGamma; ///<! Cached TMath::LnGamma(N + 1) for each bin
    mutable ROOT::Math::KahanSum<double> _offset{0.}; ///<! Offset as KahanSum to avoid loss of precision
 
 }; // end class RooNLLVar
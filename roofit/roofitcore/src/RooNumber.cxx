@@ -24,17 +24,30 @@ Class RooNumber implements numeric constants used by RooFit
 
 #include <RooNumber.h>
 
-/// @brief  Returns an std::to_string compatible number (i.e. rounds infinities back to the nearest representable
-/// value). This function is primarily used in the code-squashing for AD and as such encodes infinities to double's
-/// maximum value. We do this because 1, std::to_string cannot handle infinities correctly on some platforms
-/// (e.g. 32 bit debian) and 2, Clad (the AD tool) cannot handle differentiating std::numeric_limits::infinity directly.
+#include <iomanip>
+#include <sstream>
+
+/// @brief  Returns a string representation of a number that can be used as a floating point literal in C++ code
+/// (i.e. rounds infinities back to the nearest representable value). This function is primarily used in the
+/// code-squashing for AD and as such encodes infinities to double's maximum value. We do this because 1, printing
+/// infinities is not handled correctly on some platforms (e.g. 32 bit debian) and 2, Clad (the AD tool) cannot
+/// handle differentiating std::numeric_limits::infinity directly. All significant digits are printed, such that
+/// small values like histogram bin contents survive the round trip through the generated code.
 std::string RooNumber::toString(double x)
 {
    int sign = isInfinite(x);
    double out = x;
    if (sign)
-      out = sign == 1 ? std::numeric_limits<double>::max() : std::numeric_limits<double>::min();
-   return std::to_string(out);
+      out = sign == 1 ? std::numeric_limits<double>::max() : std::numeric_limits<double>::lowest();
+
+   std::stringstream ss;
+   ss << std::setprecision(std::numeric_limits<double>::max_digits10) << out;
+   std::string str = ss.str();
+   // Make sure that the number is not parsed as an integer literal, which
+   // would change the meaning of expressions like "1 / 2".
+   if (str.find_first_of(".e") == std::string::npos)
+      str += ".0";
+   return str;
 }
 
 double &RooNumber::staticRangeEpsRel()
@@ -2349,6 +2349,27 @@ public:
       _prodPdf->calculateBatch(this, *_cache, output, nEvents, dataMap);
    }
 
+   void translate(RooFit::Detail::CodeSquashContext &ctx) const override
+   {
+      // Same structure as in RooProdPdf::calculateBatch: either the ratio of
+      // the rearranged numerator and denominator, or the product of the parts.
+      if (_cache->_isRearranged) {
+         ctx.addResult(this, "(" + ctx.getResult(*_cache->_rearrangedNum) + " / " +
+                                ctx.getResult(*_cache->_rearrangedDen) + ")");
+         return;
+      }
+      if (_cache->_partList.empty()) {
+         ctx.addResult(this, "1.0");
+         return;
+      }
+      std::string result = "(";
+      for (const RooAbsArg *part : _cache->_partList) {
+         result += ctx.getResult(*part) + "*";
+      }
+      result.back() = ')';
+      ctx.addResult(this, result);
+   }
+
    ExtendMode extendMode() const override { return _prodPdf->extendMode(); }
    double expectedEvents(const RooArgSet * /*nset*/) const override { return _prodPdf->expectedEvents(&_normSet); }
    std::unique_ptr<RooAbsReal> createExpectedEventsFunc(const RooArgSet * /*nset*/) const override
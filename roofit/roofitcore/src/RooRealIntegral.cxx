@@ -48,6 +48,7 @@ integration is performed in the various implementations of the RooAbsIntegrator
 
 #include "TClass.h"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 
@@ -220,6 +221,7 @@ using namespace std;
 
 
 Int_t RooRealIntegral::_cacheAllNDim(2) ;
+std::size_t RooRealIntegral::_numericMemoSize(4) ;
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -823,6 +825,13 @@ double RooRealIntegral::getValV(const RooArgSet* nset) const
   if (nset && nset->uniqueId().value() != _lastNormSetId) {
     const_cast<RooRealIntegral*>(this)->setProxyNormSet(nset);
     _lastNormSetId = nset->uniqueId().value();
+    _numericMemo.clear();
+  }
+
+  // A shape change, e.g. of the integration ranges, invalidates the
+  // remembered integral values.
+  if (isShapeDirty()) {
+    _numericMemo.clear();
   }
 
   if (isValueOrShapeDirtyAndClear()) {
@@ -850,7 +859,23 @@ double RooRealIntegral::evaluate() const
     {
       // Cache numeric integrals in >1d expensive object cache
       RooDouble* cacheVal(nullptr) ;
-      if ((_cacheNum && !_intList.empty()) || _intList.getSize()>=_cacheAllNDim) {
+      const bool cacheNumeric = (_cacheNum && !_intList.empty()) || _intList.getSize()>=_cacheAllNDim;
+
+      // Remember the last few numeric integral values for this integral
+      // object. Minimizers like Minuit often return to previous parameter
+      // points, e.g. when computing numerical derivatives.
+      std::vector<double> memoKey;
+      const bool useMemo = cacheNumeric && _numericMemoSize > 0 && numericMemoKey(memoKey);
+      if (useMemo) {
+        auto found = std::find_if(_numericMemo.begin(), _numericMemo.end(),
+                                  [&](auto const &entry) { return entry.first == memoKey; });
+        if (found != _numericMemo.end()) {
+          retVal = found->second;
+          break;
+        }
+      }
+
+      if (cacheNumeric) {
         cacheVal = (RooDouble*) expensiveObjectCache().retrieveObject(GetName(),RooDouble::Class(),parameters())  ;
       }
 
@@ -888,13 +913,20 @@ double RooRealIntegral::evaluate() const
         _sumList.assign(_saveSum) ;
 
         // Cache numeric integrals in >1d expensive object cache
-        if ((_cacheNum && !_intList.empty()) || _intList.getSize()>=_cacheAllNDim) {
+        if (cacheNumeric) {
           RooDouble* val = new RooDouble(retVal) ;
           expensiveObjectCache().registerObject(_function->GetName(),GetName(),*val,parameters())  ;
           //     cout << "### caching value of integral" << GetName() << " in " << &expensiveObjectCache() << std::endl ;
         }
 
       }
+
+      if (useMemo) {
+        if (_numericMemo.size() >= _numericMemoSize) {
+          _numericMemo.pop_back();
+        }
+        _numericMemo.emplace_front(std::move(memoKey), retVal);
+      }
       break ;
     }
   case Analytic:
@@ -1041,6 +1073,7 @@ bool RooRealIntegral::redirectServersHook(const RooAbsCollection& newServerList,
 
   // Delete parameters cache if we have one
   _params.reset();
+  _numericMemo.clear();
 
   return RooAbsReal::redirectServersHook(newServerList, mustReplaceAll, nameChange, isRecursive);
 }
@@ -1064,6 +1097,31 @@ const RooArgSet& RooRealIntegral::parameters() const
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the key for the memo of numeric integral values with the current
+/// values of all parameters. Returns `false` if the integral can't be
+/// memoized, because a parameter is neither real-valued nor a category, or
+/// because the global component selection might change the integrand.
+
+bool RooRealIntegral::numericMemoKey(std::vector<double>& key) const
+{
+  if (_respectCompSelect && _globalSelectComp) return false ;
+
+  key.clear() ;
+  key.reserve(parameters().size()) ;
+  for (RooAbsArg const* arg : parameters()) {
+    if (auto real = dynamic_cast<RooAbsReal const*>(arg)) {
+      key.push_back(real->getVal()) ;
+    } else if (auto cat = dynamic_cast<RooAbsCategory const*>(arg)) {
+      key.push_back(cat->getCurrentIndex()) ;
+    } else {
+      return false ;
+    }
+  }
+  return true ;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Check if current value is valid
 
@@ -1176,6 +1234,27 @@ Int_t RooRealIntegral::getCacheAllNumeric()
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Global switch to set how many of the last numeric integral values are
+/// remembered by each cached integral (see setCacheAllNumeric() and
+/// setCacheNumeric()), keyed by the exact values of the integral parameters.
+/// This avoids repeating expensive numeric integrations when a minimizer
+/// comes back to a previous parameter point. A size of zero disables it.
+
+void RooRealIntegral::setNumericMemoSize(std::size_t size) {
+  _numericMemoSize = size ;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return how many numeric integral values are remembered by each cached integral.
+
+std::size_t RooRealIntegral::getNumericMemoSize()
+{
+  return _numericMemoSize ;
+}
+
+
 std::unique_ptr<RooAbsArg>
 RooRealIntegral::compileForNormSet(RooArgSet const &normSet, RooFit::Detail::CompileContext &ctx) const
 {
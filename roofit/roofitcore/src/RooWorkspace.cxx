@@ -81,6 +81,7 @@ and try reading again.
 #include <iostream>
 #include <fstream>
 #include <cstring>
+#include <unordered_set>
 
 namespace {
 
@@ -2480,12 +2481,15 @@ void RooWorkspace::Streamer(TBuffer &R__b)
 
      map<RooAbsArg*,vector<RooAbsArg *> > extClients, extValueClients, extShapeClients ;
 
+     // RooAbsCollection::containsInstance() is a linear search, too slow for large workspaces
+     const std::unordered_set<RooAbsArg const*> ownedNodes(_allOwnedNodes.begin(), _allOwnedNodes.end());
+
      for(RooAbsArg* tmparg : _allOwnedNodes) {
 
        // Loop over client list of this arg
        std::vector<RooAbsArg *> clientsTmp{tmparg->_clientList.begin(), tmparg->_clientList.end()};
        for (auto client : clientsTmp) {
-         if (!_allOwnedNodes.containsInstance(*client)) {
+         if (ownedNodes.find(client) == ownedNodes.end()) {
 
            const auto refCount = tmparg->_clientList.refCount(client);
            auto& bufferVec = extClients[tmparg];
@@ -2498,7 +2502,7 @@ void RooWorkspace::Streamer(TBuffer &R__b)
        // Loop over value client list of this arg
        clientsTmp.assign(tmparg->_clientListValue.begin(), tmparg->_clientListValue.end());
        for (auto vclient : clientsTmp) {
-         if (!_allOwnedNodes.containsInstance(*vclient)) {
+         if (ownedNodes.find(vclient) == ownedNodes.end()) {
            cxcoutD(ObjectHandling) << "RooWorkspace::Streamer(" << GetName() << ") element " << tmparg->GetName()
                    << " has external value client link to " << vclient << " (" << vclient->GetName() << ") with ref count " << tmparg->_clientListValue.refCount(vclient) << endl ;
 
@@ -2513,7 +2517,7 @@ void RooWorkspace::Streamer(TBuffer &R__b)
        // Loop over shape client list of this arg
        clientsTmp.assign(tmparg->_clientListShape.begin(), tmparg->_clientListShape.end());
        for (auto sclient : clientsTmp) {
-         if (!_allOwnedNodes.containsInstance(*sclient)) {
+         if (ownedNodes.find(sclient) == ownedNodes.end()) {
            cxcoutD(ObjectHandling) << "RooWorkspace::Streamer(" << GetName() << ") element " << tmparg->GetName()
                      << " has external shape client link to " << sclient << " (" << sclient->GetName() << ") with ref count " << tmparg->_clientListShape.refCount(sclient) << endl ;
 
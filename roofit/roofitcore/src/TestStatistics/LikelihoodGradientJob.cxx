@@ -190,10 +190,12 @@ void LikelihoodGradientJob::calculate_all()
       update_workers_state();
 
       // master fills queue with tasks
+      std::vector<MultiProcess::JobTask> job_tasks;
+      job_tasks.reserve(N_tasks_);
       for (std::size_t ix = 0; ix < N_tasks_; ++ix) {
-         MultiProcess::JobTask job_task{id_, state_id_, ix};
-         get_manager()->queue()->add(job_task);
+         job_tasks.push_back({id_, state_id_, ix});
       }
+      get_manager()->queue()->add_batch(job_tasks);
       N_tasks_at_workers_ = N_tasks_;
       // wait for task results back from workers to master (put into _grad)
       gather_worker_results();
@@ -186,9 +186,12 @@ void LikelihoodJob::evaluate()
 
       // master fills queue with tasks
       auto N_tasks = getNEventTasks() * getNComponentTasks();
+      std::vector<MultiProcess::JobTask> job_tasks;
+      job_tasks.reserve(N_tasks);
       for (std::size_t ix = 0; ix < N_tasks; ++ix) {
-         get_manager()->queue()->add({id_, state_id_, ix});
+         job_tasks.push_back({id_, state_id_, ix});
       }
+      get_manager()->queue()->add_batch(job_tasks);
       n_tasks_at_workers_ = N_tasks;
 
       // wait for task results back from workers to master
@@ -765,6 +765,46 @@ INSTANTIATE_TEST_SUITE_P(RooDataHist, WeightsTest,
                             return ss.str();
                          });
 
+// Test that the vectorized lookup of the bin weights in a 2D RooHistFunc gives
+// the same results as the scalar evaluation, also for non-uniform bins.
+TEST(RooDataHist, VectorizedWeights2D)
+{
+   RooHelpers::LocalChangeMsgLevel chmsglvl{RooFit::WARNING, 0u, RooFit::DataHandling, true};
+
+   std::vector<double> yBoundaries{-1.0, -0.5, -0.2, 0.0, 0.1, 0.5, 1.0};
+   TH2D h2("h2", "h2", 20, -1, 1, yBoundaries.size() - 1, yBoundaries.data());
+   for (int i = 0; i < 10000; ++i) {
+      h2.Fill(RooRandom::randomGenerator()->Gaus(0.0, 0.5), RooRandom::randomGenerator()->Gaus(0.0, 0.5));
+   }
+
+   RooRealVar x("x", "x", 0, -1, 1);
+   RooRealVar y("y", "y", 0, -1, 1);
+   RooDataHist dh{"dh", "dh", {x, y}, &h2};
+   RooHistFunc histFunc{"histFunc", "histFunc", {x, y}, dh, 0};
+
+   std::size_t nVals = 10000;
+   std::vector<double> xVals(nVals);
+   std::vector<double> yVals(nVals);
+   std::vector<double> weightsGetVal(nVals);
+   for (std::size_t i = 0; i < nVals; ++i) {
+      xVals[i] = -1 + RooRandom::uniform() * 2;
+      yVals[i] = -1 + RooRandom::uniform() * 2;
+      x.setVal(xVals[i]);
+      y.setVal(yVals[i]);
+      weightsGetVal[i] = histFunc.getVal();
+   }
+
+   std::unique_ptr<RooAbsReal> clone = RooFit::Detail::compileForNormSet<RooAbsReal>(histFunc, {x, y});
+   RooFit::Evaluator evaluator(*clone);
+   evaluator.setInput(x.GetName(), xVals, false);
+   evaluator.setInput(y.GetName(), yVals, false);
+   std::span<const double> weightsGetValues = evaluator.run();
+
+   for (std::size_t i = 0; i < nVals; ++i) {
+      EXPECT_DOUBLE_EQ(weightsGetVal[i], weightsGetValues[i]);
+   }
+}
+
 // Test that splitting a RooDataSet by index category does preserve the sum of
 // weights squared and weight errors.
 TEST(RooDataHist, SplitDataHistWithSumW2)
@@ -12,6 +12,9 @@
 #include <RooVectorDataStore.h>
 #include <RooStringVar.h>
 
+#include "../src/RooFit/BatchModeDataHelpers.h"
+
+
 #include <TFile.h>
 #include <TTree.h>
 #include <TChain.h>
@@ -486,3 +489,37 @@ TEST(RooDataSet,RooStringVarStorage) {
    ASSERT_STREQ(dataClone.get(1)->getStringValue("str"),"str2");
 
 }
+
+// The data spans for the RooFit::Evaluator should point directly to the
+// memory of the dataset if no entries have to be skipped, and only be copied
+// if entries with zero weight are removed.
+TEST(RooDataSet, DataSpansWithoutCopy)
+{
+   RooRealVar x("x", "x", 0, 10);
+   RooRealVar w("w", "w", 0, 10);
+   RooDataSet data{"data", "data", {x, w}, RooFit::WeightVar(w)};
+   for (int i = 0; i < 10; ++i) {
+      x.setVal(i);
+      data.add(RooArgSet{x}, i % 3 == 0 ? 0.0 : 1.0);
+   }
+
+   auto xInternal = static_cast<RooAbsReal const *>(data.get()->find(x));
+   std::span<const double> xBatch = data.getBatches(0, data.numEntries()).at(xInternal);
+
+   {
+      std::stack<std::vector<double>> buffers;
+      auto spans = RooFit::BatchModeDataHelpers::getDataSpans(data, "", nullptr, /*skipZeroWeights=*/false,
+                                                              /*takeGlobalObservablesFromData=*/false, buffers);
+      EXPECT_EQ(spans.at(&x).data(), xBatch.data());
+      EXPECT_EQ(spans.at(&x).size(), 10u);
+   }
+
+   {
+      std::stack<std::vector<double>> buffers;
+      auto spans = RooFit::BatchModeDataHelpers::getDataSpans(data, "", nullptr, /*skipZeroWeights=*/true,
+                                                              /*takeGlobalObservablesFromData=*/false, buffers);
+      EXPECT_NE(spans.at(&x).data(), xBatch.data());
+      ASSERT_EQ(spans.at(&x).size(), 6u);
+      EXPECT_EQ(spans.at(&x)[0], 1.0);
+   }
+}
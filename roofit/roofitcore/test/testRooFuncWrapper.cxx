@@ -33,6 +33,7 @@
 #include <RooRealSumPdf.h>
 #include <RooSimultaneous.h>
 #include <RooWorkspace.h>
+#include <RooStats/HistFactory/LinInterpVar.h>
 
 #include <ROOT/StringUtils.hxx>
 #include <TROOT.h>
@@ -573,9 +574,48 @@ FactoryTestParams param10{"PoissonNoRounding",
                           1e-4,
                           /*randomizeParameters=*/true};
 
+FactoryTestParams param11{"ProdPdf",
+                          [](RooWorkspace &ws) {
+                             ws.factory("Gaussian::gx(x[0, -10, 10], mux[0, -5, 5], sigmax[2.0, 0.1, 5.0])");
+                             ws.factory("Gaussian::gy(y[0, -10, 10], muy[0, -5, 5], sigmay[3.0, 0.1, 5.0])");
+                             ws.factory("PROD::model(gx, gy)");
+                             ws.var("x")->setBins(20);
+                             ws.var("y")->setBins(20);
+                             ws.defineSet("observables", "x,y");
+                          },
+                          [](RooAbsPdf &pdf, RooAbsData &data, RooWorkspace &, RooFit::EvalBackend backend) {
+                             return std::unique_ptr<RooAbsReal>{pdf.createNLL(data, backend)};
+                          },
+                          1e-4,
+                          /*randomizeParameters=*/true};
+
+namespace {
+void getLinInterpVarModel(RooWorkspace &ws)
+{
+   RooRealVar x("x", "x", 0, -10, 10);
+   RooRealVar mu("mu", "mu", 0, -5, 5);
+   RooRealVar alpha("alpha", "alpha", 0.5, -3, 3);
+
+   // The width of the Gaussian is interpolated linearly like a HistFactory
+   // normalization systematic.
+   RooStats::HistFactory::LinInterpVar sigma("sigma", "sigma", RooArgList{alpha}, 2.0, {1.5}, {3.0});
+   RooGaussian model("model", "model", x, mu, sigma);
+
+   ws.import(model);
+   ws.defineSet("observables", {x});
+}
+} // namespace
+
+FactoryTestParams param12{"LinInterpVar", getLinInterpVarModel,
+                          [](RooAbsPdf &pdf, RooAbsData &data, RooWorkspace &, RooFit::EvalBackend backend) {
+                             return std::unique_ptr<RooAbsReal>{pdf.createNLL(data, backend)};
+                          },
+                          1e-4,
+                          /*randomizeParameters=*/true};
+
 INSTANTIATE_TEST_SUITE_P(RooFuncWrapper, FactoryTest,
                          testing::Values(param1, param2, param3, param4, param5, param6, param7, param8, param8p1,
-                                         param9, param10),
+                                         param9, param10, param11, param12),
                          [](testing::TestParamInfo<FactoryTest::ParamType> const &paramInfo) {
                             return paramInfo.param._name;
                          });
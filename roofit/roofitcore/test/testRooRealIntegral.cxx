@@ -386,3 +386,39 @@ TEST(RooRealIntegral, RooLinearVarModelIntegratedOverVariableClones)
    std::unique_ptr<RooAbsReal> integral2{gauss.createIntegral({yCopy}, {xCopy, yCopy})};
    EXPECT_TRUE(static_cast<RooRealIntegral &>(*integral2).numIntRealVars().empty());
 }
+
+// Check that the memo of numeric integral values gives the same results as
+// integrating again when the parameters go back and forth, like in a
+// numerical gradient computation.
+TEST(RooRealIntegral, NumericMemo)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x("x", "x", -3, 3);
+   RooRealVar y("y", "y", -3, 3);
+   RooRealVar a("a", "a", 1.0, 0.1, 10);
+   RooRealVar b("b", "b", 2.0, 0.1, 10);
+   RooGenericPdf pdf("pdf", "std::exp(-a*x*x - b*y*y) * (1 + 0.1*x*y)", {x, y, a, b});
+
+   std::unique_ptr<RooAbsReal> integral{pdf.createIntegral({x, y})};
+   ASSERT_EQ(static_cast<RooRealIntegral &>(*integral).numIntRealVars().size(), 2u);
+
+   const std::vector<std::pair<double, double>> points{{1.0, 2.0}, {1.1, 2.0}, {1.0, 2.0}, {1.0, 2.1}, {1.0, 2.0}};
+
+   std::vector<double> memoized;
+   for (auto const &point : points) {
+      a.setVal(point.first);
+      b.setVal(point.second);
+      memoized.push_back(integral->getVal());
+   }
+
+   const std::size_t oldSize = RooRealIntegral::getNumericMemoSize();
+   RooRealIntegral::setNumericMemoSize(0);
+   for (std::size_t i = 0; i < points.size(); ++i) {
+      a.setVal(points[i].first);
+      b.setVal(points[i].second);
+      std::unique_ptr<RooAbsReal> reference{pdf.createIntegral({x, y})};
+      EXPECT_DOUBLE_EQ(memoized[i], reference->getVal()) << "at point " << i;
+   }
+   RooRealIntegral::setNumericMemoSize(oldSize);
+}
@@ -56,3 +56,54 @@ TEST(RooSTLRefCountList, TestRenaming)
    }
    EXPECT_EQ(nMatches, nElements);
 }
+
+// Test the lookup by pointer of long lists, which uses an index, while
+// elements are added, removed and replaced.
+TEST(RooSTLRefCountList, TestPointerIndex)
+{
+   const std::size_t nElements = 4 * RooSTLRefCountList<RooAbsArg>::minSizeForPointerIndex;
+
+   std::vector<RooRealVar> vars;
+   vars.reserve(nElements + 1);
+   RooSTLRefCountList<RooAbsArg> list;
+
+   for (std::size_t i = 0; i < nElements; ++i) {
+      auto name = std::string("v") + std::to_string(i);
+      vars.emplace_back(name.c_str(), name.c_str(), i);
+      list.Add(&vars.back());
+      list.Add(&vars.back());
+   }
+   vars.emplace_back("other", "other", 0.);
+   RooAbsArg *other = &vars.back();
+
+   auto checkList = [&list](const std::vector<RooAbsArg const *> &expected) {
+      ASSERT_EQ(list.size(), expected.size());
+      for (std::size_t i = 0; i < expected.size(); ++i) {
+         EXPECT_EQ(list[i], expected[i]);
+         EXPECT_EQ(list.findByPointer(expected[i]) - list.begin(), static_cast<std::ptrdiff_t>(i));
+      }
+   };
+
+   std::vector<RooAbsArg const *> expected;
+   for (std::size_t i = 0; i < nElements; ++i)
+      expected.push_back(&vars[i]);
+   checkList(expected);
+   EXPECT_EQ(list.refCount(&vars[5]), 2u);
+   EXPECT_FALSE(list.containsByPointer(other));
+
+   // Decreasing the ref count keeps the element, removing it shifts the following ones
+   EXPECT_EQ(list.Remove(&vars[5]), 1);
+   EXPECT_EQ(list.refCount(&vars[5]), 1u);
+   EXPECT_EQ(list.Remove(&vars[5], true), 1);
+   expected.erase(expected.begin() + 5);
+   checkList(expected);
+
+   EXPECT_EQ(list.Replace(&vars[7], other), 2);
+   expected[6] = other;
+   checkList(expected);
+   EXPECT_FALSE(list.containsByPointer(&vars[7]));
+
+   list.Add(&vars[7]);
+   expected.push_back(&vars[7]);
+   checkList(expected);
+}
@@ -20,6 +20,8 @@
 #include <RooRealVar.h>
 #include <RooWorkspace.h>
 
+#include <TROOT.h>
+
 #include "gtest_wrapper.h"
 
 #include <memory>
@@ -339,6 +341,43 @@ TEST(RooNLLVar, CopyRangedNLL)
    EXPECT_FLOAT_EQ(nllrange->getVal(), nllrangeClone->getVal());
 }
 
+/// The CPU backend evaluates the pdfs on ranges of events in parallel when
+/// Implicit Multithreading is enabled. The NLL value must not depend on it.
+TEST(RooNLLVar, ImplicitMT)
+{
+#ifdef R__USE_IMT
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace ws;
+   ws.factory("Gaussian::gauss(x[-10, 10], mean[0, -10, 10], sigma[2, 0.1, 10])");
+   ws.factory("Exponential::expo(x, c[-0.1, -1, 0])");
+   ws.factory("SUM::model(f[0.7, 0, 1] * gauss, expo)");
+
+   RooRealVar &x = *ws.var("x");
+   RooAbsPdf &model = *ws.pdf("model");
+
+   std::unique_ptr<RooDataSet> data{model.generate(x, 100000)};
+
+   using namespace RooFit;
+   std::unique_ptr<RooAbsReal> nll{model.createNLL(*data, EvalBackend::Cpu())};
+   const double nllRef = nll->getVal();
+
+   ROOT::EnableImplicitMT(4);
+   std::unique_ptr<RooAbsReal> nllMT{model.createNLL(*data, EvalBackend::Cpu())};
+   const double nllVal = nllMT->getVal();
+   ws.var("mean")->setVal(0.5);
+   const double nllValShifted = nllMT->getVal();
+   ROOT::DisableImplicitMT();
+
+   EXPECT_NEAR(nllVal, nllRef, 1e-9 * std::abs(nllRef));
+
+   ws.var("mean")->setVal(0.5);
+   EXPECT_NEAR(nllValShifted, nll->getVal(), 1e-9 * std::abs(nllRef));
+#else
+   GTEST_SKIP() << "ROOT was built without Implicit Multithreading";
+#endif
+}
+
 /// When using the Integrate() command argument in chi2FitTo, the result should
 /// be identical to a fit without bin integration if the fit function is
 /// linear. This is a good cross check to see if the integration works.
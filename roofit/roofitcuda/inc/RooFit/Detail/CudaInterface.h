@@ -84,13 +84,15 @@ void copyDeviceToHostImpl(const void *src, void *dest, std::size_t n, CudaStream
  *
  * @param[in] src             Pointer to the source memory on the host.
  * @param[in] dest            Pointer to the destination memory on the device.
- * @param[in] nBytes          Number of bytes to copy.
+ * @param[in] n               Number of elements to copy.
  * @param[in] stream          CudaStream for asynchronous memory transfer (optional).
+ *                            If given, the copy is enqueued in the stream and
+ *                            the function returns without waiting for it.
  */
 template <class T>
-void copyHostToDevice(const T *src, T *dest, std::size_t n, CudaStream * = nullptr)
+void copyHostToDevice(const T *src, T *dest, std::size_t n, CudaStream *stream = nullptr)
 {
-   copyHostToDeviceImpl(src, dest, sizeof(T) * n);
+   copyHostToDeviceImpl(src, dest, sizeof(T) * n, stream);
 }
 
 /**
@@ -98,13 +100,15 @@ void copyHostToDevice(const T *src, T *dest, std::size_t n, CudaStream * = nullp
  *
  * @param[in] src             Pointer to the source memory on the device.
  * @param[in] dest            Pointer to the destination memory on the host.
- * @param[in] nBytes          Number of bytes to copy.
+ * @param[in] n               Number of elements to copy.
  * @param[in] stream          CudaStream for asynchronous memory transfer (optional).
+ *                            If given, the copy is enqueued in the stream and
+ *                            the function returns without waiting for it.
  */
 template <class T>
-void copyDeviceToHost(const T *src, T *dest, std::size_t n, CudaStream * = nullptr)
+void copyDeviceToHost(const T *src, T *dest, std::size_t n, CudaStream *stream = nullptr)
 {
-   copyDeviceToHostImpl(src, dest, sizeof(T) * n);
+   copyDeviceToHostImpl(src, dest, sizeof(T) * n, stream);
 }
 
 /// \cond ROOFIT_INTERNAL
@@ -22,6 +22,7 @@ class TGraphErrors;
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace RooStats {
 
@@ -146,6 +147,10 @@ public:
    /// set numerical error in test statistic evaluation (default is zero)
    void SetNumErr(double err) { fNumErr = err; }
 
+   /// set the number of local processes used to run the points of a fixed
+   /// scan in parallel (default is one, i.e. the points are run sequentially)
+   void SetNWorkers(int nWorkers) { fNWorkers = nWorkers; }
+
    /// set flag to close proof for every new run
    static void SetCloseProof(bool flag);
 
@@ -163,6 +168,15 @@ protected:
    /// run the hybrid at a single point
    HypoTestResult * Eval( HypoTestCalculatorGeneric &hc, bool adaptive , double clsTarget) const;
 
+   /// compute the hypothesis test result at a single point without adding it to the results
+   HypoTestResult * EvalOnePoint( double &rVal, bool adaptive, double clTarget ) const;
+
+   /// add the hypothesis test result of a single point to the results
+   void AddResult( double rVal, std::unique_ptr<HypoTestResult> result ) const;
+
+   /// run the points of a fixed scan on several processes
+   bool RunPointsMultiProcess( const std::vector<double> & xValues ) const;
+
    /// helper functions
    static RooRealVar * GetVariableToScan(const HypoTestCalculatorGeneric &hc);
    static void CheckInputModels(const HypoTestCalculatorGeneric &hc, const RooRealVar & scanVar);
@@ -199,6 +213,7 @@ private:
    double fXmin;
    double fXmax;
    double fNumErr;
+   int fNWorkers = 1;  ///<! number of local processes for the fixed scan
 
 protected:
 
@@ -228,6 +228,11 @@ class ToyMCSampler: public TestStatSampler {
       /// calling with argument or nullptr deactivates proof
       void SetProofConfig(ProofConfig *pc = nullptr) { fProofConfig = pc; }
 
+      /// Generate and evaluate the toys in `nWorkers` forked processes
+      /// (ignored if a ProofConfig is set). A value of one means serial running.
+      void SetNWorkers(Int_t nWorkers) { fNWorkers = nWorkers; }
+      Int_t GetNWorkers() const { return fNWorkers; }
+
       void SetProtoData(const RooDataSet* d) { fProtoData = d; }
 
    protected:
@@ -240,6 +245,9 @@ class ToyMCSampler: public TestStatSampler {
       /// helper method for clearing  the cache
       virtual void ClearCache();
 
+      /// helper for GetSamplingDistributions() to run on several local processes
+      RooDataSet* GetSamplingDistributionsMultiProcess(RooArgSet& paramPoint);
+
 
       /// densities, snapshots, and test statistics to reweight to
       RooAbsPdf *fPdf; ///< model (can be alt or null)
@@ -273,6 +281,7 @@ class ToyMCSampler: public TestStatSampler {
       const RooDataSet *fProtoData; ///< in dev
 
       ProofConfig *fProofConfig;   ///<!
+      Int_t fNWorkers = 1;         ///<! number of local worker processes
 
       mutable NuisanceParametersSampler *fNuisanceParametersSampler; ///<!
 
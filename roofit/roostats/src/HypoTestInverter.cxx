@@ -64,6 +64,12 @@ call HypoTestInverter::UseCLs().
 
 #include "RooStats/ProofConfig.h"
 
+#ifndef _MSC_VER
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <memory>
@@ -405,6 +411,7 @@ HypoTestInverter & HypoTestInverter::operator= (const HypoTestInverter & rhs) {
    fXmin = rhs.fXmin;
    fXmax = rhs.fXmax;
    fNumErr = rhs.fNumErr;
+   fNWorkers = rhs.fNWorkers;
 
    return *this;
 }
@@ -642,15 +649,18 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
      return false;
    }
 
-   double thisX = xMin;
-   for (int i=0; i<nBins; i++) {
+   std::vector<double> xValues(nBins, xMin);
+   for (int i=1; i<nBins; i++) { // avoids case of nBins = 1
+      if (scanLog)
+         xValues[i] = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
+      else
+         xValues[i] = xMin + i*(xMax-xMin)/(nBins-1);          // linear scan in x
+   }
 
-      if (i > 0) { // avoids case of nBins = 1
-         if (scanLog)
-            thisX = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
-         else
-            thisX = xMin + i*(xMax-xMin)/(nBins-1);          // linear scan in x
-      }
+   if (fNWorkers > 1 && nBins > 1)
+      return RunPointsMultiProcess(xValues);
+
+   for (double thisX : xValues) {
 
       const bool status = RunOnePoint(thisX);
 
@@ -671,6 +681,22 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
 
    CreateResults();
 
+   std::unique_ptr<HypoTestResult> result{EvalOnePoint(rVal, adaptive, clTarget)};
+   if (!result) return false;
+
+   AddResult(rVal, std::move(result));
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the hypothesis test at the given POI value (internal function
+/// called by RunOnePoint). The value is moved inside the range of the scanned
+/// variable if needed. Returns nullptr if the test failed or gave an invalid
+/// result.
+
+HypoTestResult * HypoTestInverter::EvalOnePoint( double &rVal, bool adaptive, double clTarget) const
+{
    // check if rVal is in the range specified for fScannedVariable
    if ( rVal < fScannedVariable->getMin() ) {
       oocoutE(nullptr,InputArguments) << "HypoTestInverter::RunOnePoint - Out of range: using the lower bound "
@@ -708,7 +734,8 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
    if (!result) {
       oocoutE(nullptr,Eval) << "HypoTestInverter - Error running point " << fScannedVariable->GetName() << " = " <<
    fScannedVariable->getVal() << endl;
-      return false;
+      fScannedVariable->setVal(oldValue);
+      return nullptr;
    }
    // in case of a dummy result
    const double nullPV = result->NullPValue();
@@ -716,9 +743,21 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
    if (!std::isfinite(nullPV) || nullPV < 0. || nullPV > 1. || !std::isfinite(altPV) || altPV < 0. || altPV > 1.) {
       oocoutW(nullptr,Eval) << "HypoTestInverter - Skipping invalid result for  point " << fScannedVariable->GetName() << " = " <<
          fScannedVariable->getVal() << ". null p-value=" << nullPV << ", alternate p-value=" << altPV << endl;
-      return false;
+      fScannedVariable->setVal(oldValue);
+      return nullptr;
    }
 
+   fScannedVariable->setVal(oldValue);
+
+   return result.release();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the result for the given POI value to the HypoTestInverterResult,
+/// merging it with the last result if that was for the same value.
+
+void HypoTestInverter::AddResult( double rVal, std::unique_ptr<HypoTestResult> result ) const
+{
    double lastXtested;
    if ( fResults->ArraySize()!=0 ) lastXtested = fResults->GetXValue(fResults->ArraySize()-1);
    else lastXtested = -999;
@@ -748,10 +787,56 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
      fResults->fYObjects.Add(result.release());
 
    }
+}
 
-   fScannedVariable->setVal(oldValue);
+////////////////////////////////////////////////////////////////////////////////
+/// Run the points of a fixed scan on fNWorkers forked processes with a
+/// ROOT::TProcessExecutor. The random seed for each point is drawn from the
+/// global RooRandom generator before forking, so that the toys of different
+/// points are independent and the scan is reproducible. The results are
+/// added in the order of the scanned values.
+
+bool HypoTestInverter::RunPointsMultiProcess( const std::vector<double> & xValues ) const
+{
+#ifdef _MSC_VER
+   oocoutW(nullptr,InputArguments) << "HypoTestInverter::RunFixedScan - running on several processes is not supported"
+                                   << " on Windows, running the points sequentially" << std::endl;
+   for (double thisX : xValues) {
+      if (!RunOnePoint(thisX))
+        oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << thisX << " failed. Skipping." << std::endl;
+   }
+   return true;
+#else
+   std::vector<UInt_t> seeds(xValues.size());
+   for (auto &seed : seeds)
+      seed = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max());
+
+   const unsigned int nWorkers = std::min<std::size_t>(fNWorkers, xValues.size());
+   oocoutP(nullptr,Eval) << "HypoTestInverter::RunFixedScan - running " << xValues.size() << " points on "
+                         << nWorkers << " worker processes" << std::endl;
+
+   auto work = [&](unsigned int i) -> HypoTestResult * {
+      RooRandom::randomGenerator()->SetSeed(seeds[i]);
+      double rVal = xValues[i];
+      return EvalOnePoint(rVal, false, -1);
+   };
+
+   ROOT::TProcessExecutor pool(nWorkers);
+   std::vector<HypoTestResult *> results = pool.Map(work, ROOT::TSeqU(xValues.size()));
+
+   for (std::size_t i = 0; i < xValues.size(); ++i) {
+      std::unique_ptr<HypoTestResult> result{results[i]};
+      // same clipping of the scanned value as in EvalOnePoint()
+      const double rVal = std::max(fScannedVariable->getMin(), std::min(xValues[i], fScannedVariable->getMax()));
+      if (!result) {
+        oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << xValues[i] << " failed. Skipping." << std::endl;
+        continue;
+      }
+      AddResult(rVal, std::move(result));
+   }
 
    return true;
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -24,7 +24,10 @@ ToyMCSampler is an implementation of the TestStatSampler interface.
 It generates Toy Monte Carlo for a given parameter point and evaluates a
 TestStatistic.
 
-For parallel runs, ToyMCSampler can be given an instance of ProofConfig
+For parallel runs on the local machine, call SetNWorkers(). The toys are then
+split between forked worker processes, each with its own random seed drawn
+from RooRandom::randomGenerator(), and the resulting datasets are merged.
+Alternatively, ToyMCSampler can be given an instance of ProofConfig
 and then run in parallel using proof or proof-lite. Internally, it uses
 ToyMCStudy with the RooStudyManager.
 */
@@ -50,6 +53,13 @@ ToyMCStudy with the RooStudyManager.
 
 #include "TMath.h"
 
+#ifndef _MSC_VER
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
+#include <vector>
 
 using namespace RooFit;
 using namespace std;
@@ -307,8 +317,11 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
 {
 
    // ======= S I N G L E   R U N ? =======
-   if(!fProofConfig)
+   if(!fProofConfig) {
+      if (fNWorkers > 1)
+         return GetSamplingDistributionsMultiProcess(paramPointIn);
       return GetSamplingDistributionsSingleWorker(paramPointIn);
+   }
 
    // ======= P A R A L L E L   R U N =======
    if (!CheckConfig()){
@@ -350,6 +363,85 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
    return output;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Distribute the toys over fNWorkers forked processes with a
+/// ROOT::TProcessExecutor. Each worker runs
+/// GetSamplingDistributionsSingleWorker() on its share of the toys with a
+/// seed drawn from the global RooRandom generator, so that the result is
+/// reproducible for a given initial seed and number of workers.
+
+RooDataSet* ToyMCSampler::GetSamplingDistributionsMultiProcess(RooArgSet& paramPointIn)
+{
+#ifdef _MSC_VER
+   oocoutW(nullptr, InputArguments) << "ToyMCSampler: running on several processes is not supported on Windows, "
+                                       "generating the toys serially." << endl;
+   return GetSamplingDistributionsSingleWorker(paramPointIn);
+#else
+   if (!CheckConfig()){
+      oocoutE(nullptr, InputArguments)
+         << "Bad COnfiguration in ToyMCSampler "
+         << endl;
+      return nullptr;
+   }
+
+   const int nWorkers = std::min(fNWorkers, fNToys);
+   if (nWorkers <= 1)
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+
+   // adaptive sampling needs the toys of all workers to decide when to stop
+   const double toysInTails = fToysInTails;
+   if(fToysInTails) {
+      fToysInTails = 0;
+      oocoutW(nullptr, InputArguments)
+         << "Adaptive sampling in ToyMCSampler is not supported for parallel runs."
+         << endl;
+   }
+
+   // split the toys such that the total number is unchanged, and draw the
+   // worker seeds here so they don't depend on the process scheduling
+   const Int_t totToys = fNToys;
+   std::vector<Int_t> toysPerWorker(nWorkers, totToys / nWorkers);
+   std::vector<UInt_t> seeds(nWorkers);
+   for (int i = 0; i < nWorkers; ++i) {
+      if (i < totToys % nWorkers)
+         ++toysPerWorker[i];
+      seeds[i] = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max());
+   }
+
+   oocoutP(nullptr, Generation) << "ToyMCSampler: generating " << totToys << " toys on " << nWorkers
+                                << " worker processes" << endl;
+
+   // the work item runs in the forked process, so modifying the state of
+   // this sampler doesn't affect the other workers or the parent
+   auto work = [&](unsigned int iWorker) {
+      fNToys = toysPerWorker[iWorker];
+      RooRandom::randomGenerator()->SetSeed(seeds[iWorker]);
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+   };
+
+   ROOT::TProcessExecutor pool(nWorkers);
+   std::vector<RooDataSet *> results = pool.Map(work, ROOT::TSeqU(nWorkers));
+
+   fToysInTails = toysInTails;
+
+   RooDataSet *output = nullptr;
+   for (RooDataSet *result : results) {
+      if (!result) {
+         oocoutW(nullptr, Generation) << "ToyMCSampler: a worker didn't return toys" << endl;
+         continue;
+      }
+      if (!output) {
+         output = result;
+         continue;
+      }
+      output->append(*result);
+      delete result;
+   }
+
+   return output;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This is the main function for serial runs. It is called automatically
 /// from inside GetSamplingDistribution when no ProofConfig is given.
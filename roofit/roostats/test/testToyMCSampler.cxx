@@ -0,0 +1,49 @@
+// Tests for the RooStats::ToyMCSampler
+
+#include <RooStats/ToyMCSampler.h>
+#include <RooStats/NumEventsTestStat.h>
+
+#include <RooGaussian.h>
+#include <RooRandom.h>
+#include <RooRealVar.h>
+
+#include <gtest/gtest.h>
+
+// Check that running the toys on several worker processes gives the requested
+// total number of toys, and that the result is reproducible for a given seed.
+TEST(ToyMCSampler, MultiProcess)
+{
+   RooRealVar x("x", "x", -10, 10);
+   RooRealVar mu("mu", "mu", 0, -5, 5);
+   RooRealVar sigma("sigma", "sigma", 1, 0.1, 10);
+   RooGaussian gauss("gauss", "gauss", x, mu, sigma);
+
+   RooStats::NumEventsTestStat testStat{gauss};
+   RooArgSet observables{x};
+
+   constexpr int nToys = 11;
+   RooStats::ToyMCSampler sampler{testStat, nToys};
+   sampler.SetPdf(gauss);
+   sampler.SetObservables(observables);
+   sampler.SetParametersForTestStat(RooArgSet{mu});
+   sampler.SetNEventsPerToy(100);
+   sampler.SetNWorkers(3);
+
+   RooArgSet paramPoint{mu};
+
+   RooRandom::randomGenerator()->SetSeed(1234);
+   std::unique_ptr<RooDataSet> result1{sampler.GetSamplingDistributions(paramPoint)};
+   RooRandom::randomGenerator()->SetSeed(1234);
+   std::unique_ptr<RooDataSet> result2{sampler.GetSamplingDistributions(paramPoint)};
+
+   ASSERT_NE(result1, nullptr);
+   ASSERT_NE(result2, nullptr);
+   EXPECT_EQ(result1->numEntries(), nToys);
+   ASSERT_EQ(result2->numEntries(), result1->numEntries());
+   EXPECT_EQ(sampler.GetNToys(), nToys);
+
+   for (int i = 0; i < result1->numEntries(); ++i) {
+      EXPECT_DOUBLE_EQ(static_cast<RooRealVar &>((*result1->get(i))[0]).getVal(),
+                       static_cast<RooRealVar &>((*result2->get(i))[0]).getVal());
+   }
+}
@@ -29,3 +29,5 @@
 #include "TMVA/ROperator_Gather.hxx"
 #include "TMVA/ROperator_Swish.hxx"
 #include "TMVA/ROperator_Erf.hxx"
+#include "TMVA/ROperator_QuantizeLinear.hxx"
+#include "TMVA/ROperator_QLinearMatMul.hxx"
@@ -52,7 +52,8 @@ public:
         return function_block;
     }
 
-    std::string GenerateModel(const std::string& filename, long read_pos=0, long block_size=1);
+    std::string GenerateModel(const std::string& filename, long read_pos=0, long block_size=1,
+                              std::underlying_type_t<Options> options=0);
     std::string Generate(const std::vector<std::string>& inputPtrs);
     FunctionTarget GetFunctionTarget() {
         return fTarget;
@@ -22,6 +22,12 @@ private:
 
     std::vector<std::unique_ptr<ROperator>> fOperators;
 
+    bool fFuseOperators = true; //! fuse elementwise operators into their producer when generating the code
+    bool fUseIntraOpParallel = false; //! split the operator work in tasks run by the Session fParallelFor
+
+    void FuseOperators();
+    size_t PlanIntermediateMemoryPool(std::unordered_map<std::string, size_t> &offsets) const;
+
 public:
 
     //explicit move ctor/assn
@@ -123,6 +129,10 @@ public:
         return fUseSession;
     }
 
+    bool UseIntraOpParallel() const {
+        return fUseIntraOpParallel;
+    }
+
     ~RModel() {}
 
     ClassDef(RModel,1);
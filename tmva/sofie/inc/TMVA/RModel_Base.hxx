@@ -26,6 +26,8 @@ enum class Options {
     kRootBinaryWeightFile = 0x4,
     kGNN = 0x8,
     kGNNComponent = 0x10,
+    kNoOperatorFusion = 0x20,
+    kIntraOpParallel = 0x40,
 };
 
 enum class WeightFileType {None, RootBinary, Text};
@@ -43,7 +45,7 @@ protected:
 
     std::unordered_set<std::string> fNeededBlasRoutines;
 
-    const std::unordered_set<std::string> fAllowedStdLib = {"vector", "algorithm", "cmath"};
+    const std::unordered_set<std::string> fAllowedStdLib = {"vector", "algorithm", "cmath", "functional"};
     std::unordered_set<std::string> fNeededStdLib = {"vector"};
     std::unordered_set<std::string> fCustomOpHeaders;
 
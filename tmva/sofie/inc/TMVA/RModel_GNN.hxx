@@ -125,7 +125,10 @@ public:
     RModel_GNN(GNN_Init& graph_input_struct);
     RModel_GNN() {}
 
-    void Generate();
+    void Generate(std::underlying_type_t<Options> options);
+    void Generate(Options options = Options::kDefault) {
+        Generate(static_cast<std::underlying_type_t<Options>>(options));
+    }
 
     ~RModel_GNN() {}
 //    ClassDef(RModel_GNN,1);
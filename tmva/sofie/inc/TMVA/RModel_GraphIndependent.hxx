@@ -86,7 +86,10 @@ public:
     RModel_GraphIndependent(GraphIndependent_Init& graph_input_struct);
     RModel_GraphIndependent() {}
 
-    void Generate();
+    void Generate(std::underlying_type_t<Options> options);
+    void Generate(Options options = Options::kDefault) {
+        Generate(static_cast<std::underlying_type_t<Options>>(options));
+    }
 
     ~RModel_GraphIndependent() {}
 //    ClassDef(RModel_GNN,1);
@@ -1,8 +1,10 @@
 #ifndef TMVA_SOFIE_ROPERATOR
 #define TMVA_SOFIE_ROPERATOR
 
+#include <algorithm>
 #include <vector>
 #include <memory>
+#include <string>
 
 #include "TMVA/SOFIE_common.hxx"
 //#include "RModel.hxx"
@@ -30,6 +32,14 @@ public:
    // generate session data members specific to operator
    virtual std::string GenerateSessionMembersCode(std::string /*opName*/) { return ""; }
    virtual std::string Header() { return "";}
+   // names of the tensors read and written by the operator, filled in the constructor. Used to fuse operators
+   // and to plan the memory of the intermediate tensors: if an operator leaves them empty, none of this is done
+   const std::vector<std::string> & GetOpInputTensors() const { return fInputTensorNames; }
+   const std::vector<std::string> & GetOpOutputTensors() const { return fOutputTensorNames; }
+   // activation computed by an elementwise operator, which can then be fused into the producer of its input
+   virtual EActivationType GetActivationType() const { return EActivationType::UNDEFINED; }
+   // fuse a following activation: apply it in place on the output, renamed to the output of the activation
+   virtual bool FuseActivation(EActivationType /*activation*/, const std::string & /*outputName*/) { return false; }
 
 
    //virtual void Forward_reference() = 0;
@@ -40,6 +50,40 @@ protected:
 
    const std::string SP = "   ";    ///< space used to correctly indent the generated C++ code
    bool fUseSession = false;        ///< flag to identify if using the session class
+   bool fUseParallelFor = false;    ///< flag to split the operator work in tasks run by the session fParallelFor
+   EActivationType fActivation = EActivationType::UNDEFINED; ///< activation fused into the operator output
+   std::vector<std::string> fInputTensorNames;  ///< names of the tensors read by the operator
+   std::vector<std::string> fOutputTensorNames; ///< names of the tensors fully written by the operator
+
+   // number of tasks in which to split an operator computing `work` multiply-adds over `n` output
+   // channels: 1 (no splitting) unless fUseParallelFor is set and the work is large enough
+   size_t GetNumberOfParallelTasks(size_t n, size_t work) const {
+      constexpr size_t kMinTaskWork = 16384;
+      constexpr size_t kMaxTasks = 16;
+      if (!fUseParallelFor)
+         return 1;
+      size_t nTasks = std::min(std::min(n, work / kMinTaskWork), kMaxTasks);
+      if (nTasks < 2)
+         return 1;
+      // all tasks have the same number of channels, but the last one
+      size_t chunk = (n + nTasks - 1) / nTasks;
+      return (n + chunk - 1) / chunk;
+   }
+
+   // generate the code applying the fused activation in place on a tensor
+   std::string GenerateFusedActivation(const std::string & tensorName, size_t length) const {
+      if (fActivation == EActivationType::UNDEFINED)
+         return "";
+      std::string y = "tensor_" + tensorName + "[id]";
+      std::string code = SP + "for (int id = 0; id < " + std::to_string(length) + " ; id++){\n" + SP + SP + y + " = ";
+      if (fActivation == EActivationType::RELU)
+         code += "((" + y + " > 0 )? " + y + " : 0);\n";
+      else if (fActivation == EActivationType::SIGMOID)
+         code += "1 / (1 + std::exp( - " + y + "));\n";
+      else if (fActivation == EActivationType::TANH)
+         code += "std::tanh(" + y + ");\n";
+      return code + SP + "}\n";
+   }
 };
 
 
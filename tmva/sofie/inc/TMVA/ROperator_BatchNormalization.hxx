@@ -52,6 +52,8 @@ public:
    fNB(UTILITY::Clean_name(nameB)), fNMean(UTILITY::Clean_name(nameMean)),
    fNVar(UTILITY::Clean_name(nameVar)), fNY(UTILITY::Clean_name(nameY))
    {
+      fInputTensorNames = {fNX, fNScale, fNB, fNMean, fNVar};
+      fOutputTensorNames = {fNY};
       if(std::is_same<T, float>::value){
       fType = "float";
       }
@@ -62,6 +64,8 @@ public:
    }
 
 
+   float GetEpsilon() const { return fepsilon; }
+
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input) {
       ETensorType out = input[0];
       return {out};
@@ -11,6 +11,7 @@
 #include <stdexcept>
 #include <vector>
 #include <cassert>
+#include <cmath>
 
 namespace TMVA {
 namespace Experimental {
@@ -56,6 +57,8 @@ public:
       fNX(UTILITY::Clean_name(nameX)), fNW(UTILITY::Clean_name(nameW)),
       fNB(UTILITY::Clean_name(nameB)), fNY(UTILITY::Clean_name(nameY))
    {
+      fInputTensorNames = {fNX, fNW, fNB};
+      fOutputTensorNames = {fNY};
       if(std::is_same<T, float>::value) {
          fType = "float";
       } else {
@@ -72,6 +75,8 @@ public:
       fAttrPads(pads), fAttrStrides(strides),
       fNX(UTILITY::Clean_name(nameX)), fNW(UTILITY::Clean_name(nameW)), fNY(UTILITY::Clean_name(nameY))
    {
+      fInputTensorNames = {fNX, fNW};
+      fOutputTensorNames = {fNY};
       if(std::is_same<T, float>::value) {
          fType = "float";
       } else {
@@ -196,6 +201,7 @@ public:
 
    void Initialize(RModel& model) {
       fUseSession = model.UseSession();
+      fUseParallelFor = model.UseIntraOpParallel();
       if (!model.CheckIfTensorAlreadyExist(fNX)) {
          throw
             std::runtime_error("TMVA SOFIE Conv op Input Tensor " + fNX + " is not found in model");
@@ -459,11 +465,29 @@ public:
                 << OpName << "_xcol);\n\n ";
          }
          // BLAS
-         out << SP << SP << "BLAS::sgemm_(&" << OpName << "_transA, &" << OpName << "_transB, &" << OpName << "_m, &"
-             << OpName << "_n, &" << OpName << "_k, &" << OpName << "_alpha, " << OpName << "_xcol, &" << OpName
-             << "_m,\n"; // use m if op_xcol is not transpose , otherwise k
-         out << SP << SP << SP << OpName << "_f, &" << OpName << "_k, &" << OpName << "_beta, tensor_" << fNY
-             << " + out_offset, &" << OpName << "_m);\n";
+         size_t kernelSize = fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1] * fAttrKernelShape[2];
+         size_t nTasks = GetNumberOfParallelTasks(fShapeW[0], fShapeW[0] * kernelSize * oDepth * oHeight * oWidth);
+         if (nTasks > 1) {
+            // split the output channels (columns of the result) in tasks
+            size_t chunk = (fShapeW[0] + nTasks - 1) / nTasks;
+            out << SP << SP << "fParallelFor(" << nTasks << ", [&](unsigned int task) {\n";
+            out << SP << SP << SP << "int " << OpName << "_n0 = task * " << chunk << ";\n";
+            out << SP << SP << SP << "int " << OpName << "_nc = std::min(" << chunk << ", " << OpName << "_n - "
+                << OpName << "_n0);\n";
+            out << SP << SP << SP << "BLAS::sgemm_(&" << OpName << "_transA, &" << OpName << "_transB, &" << OpName
+                << "_m, &" << OpName << "_nc, &" << OpName << "_k, &" << OpName << "_alpha, " << OpName << "_xcol, &"
+                << OpName << "_m,\n";
+            out << SP << SP << SP << SP << OpName << "_f + " << OpName << "_n0 * " << OpName << "_k, &" << OpName
+                << "_k, &" << OpName << "_beta, tensor_" << fNY << " + out_offset + " << OpName << "_n0 * " << OpName
+                << "_m, &" << OpName << "_m);\n";
+            out << SP << SP << "});\n";
+         } else {
+            out << SP << SP << "BLAS::sgemm_(&" << OpName << "_transA, &" << OpName << "_transB, &" << OpName << "_m, &"
+                << OpName << "_n, &" << OpName << "_k, &" << OpName << "_alpha, " << OpName << "_xcol, &" << OpName
+                << "_m,\n"; // use m if op_xcol is not transpose , otherwise k
+            out << SP << SP << SP << OpName << "_f, &" << OpName << "_k, &" << OpName << "_beta, tensor_" << fNY
+                << " + out_offset, &" << OpName << "_m);\n";
+         }
       } else {
          // case of group convolution
          // Unroll (IM2COL) the input tensor- make loop on groups and repeat operations (IM2COL + GEMM for each
@@ -532,10 +556,80 @@ public:
 
       }
       out << SP << "}\n"; // end of batch size loop
+      out << GenerateFusedActivation(fNY, ConvertShapeToLength(fShapeY));
 
       return out.str();
       }
 
+   bool FuseActivation(EActivationType activation, const std::string & outputName) {
+      if (fActivation != EActivationType::UNDEFINED)
+         return false;
+      fActivation = activation;
+      fNY = UTILITY::Clean_name(outputName);
+      fOutputTensorNames = {fNY};
+      return true;
+   }
+
+   /*! \brief Fold a following inference BatchNormalization into the weight and bias tensors
+    *
+    * The output channel m is scaled by s = scale[m] / sqrt(var[m] + epsilon) and shifted
+    * by bias[m] - s * mean[m]. Must be called before Initialize, with the weight and bias tensors
+    * not used by other operators. Returns false, leaving the operator unchanged, if the
+    * tensors are not initialized float tensors with one value per output channel.
+    */
+   bool FuseBatchNormalization(RModel &model, const std::string &nameScale, const std::string &nameB,
+                               const std::string &nameMean, const std::string &nameVar, float epsilon,
+                               const std::string &outputName)
+   {
+      if (fType != "float" || fActivation != EActivationType::UNDEFINED || !model.IsInitializedTensor(fNW))
+         return false;
+      auto shapeW = model.GetTensorShape(fNW);
+      if (shapeW.empty() || model.GetTensorType(fNW) != ETensorType::FLOAT)
+         return false;
+      // name of the bias tensor to create if the convolution has none
+      std::string foldedBiasName = fNW + "_bnbias";
+      if (fNB.empty() && model.CheckIfTensorAlreadyExist(foldedBiasName))
+         return false;
+      size_t nChannels = shapeW[0];
+      std::vector<size_t> channelShape = {nChannels};
+      for (auto & name : {fNB, nameScale, nameB, nameMean, nameVar}) {
+         if (name.empty())
+            continue;
+         if (!model.IsInitializedTensor(name) || model.GetTensorType(name) != ETensorType::FLOAT ||
+             model.GetTensorShape(name) != channelShape)
+            return false;
+      }
+      auto scale = static_cast<float *>(model.GetInitializedTensorData(nameScale).get());
+      auto bnBias = static_cast<float *>(model.GetInitializedTensorData(nameB).get());
+      auto mean = static_cast<float *>(model.GetInitializedTensorData(nameMean).get());
+      auto var = static_cast<float *>(model.GetInitializedTensorData(nameVar).get());
+      auto w = static_cast<float *>(model.GetInitializedTensorData(fNW).get());
+      float *b = fNB.empty() ? nullptr : static_cast<float *>(model.GetInitializedTensorData(fNB).get());
+
+      size_t channelSize = ConvertShapeToLength(shapeW) / nChannels;
+      std::shared_ptr<void> newW(new float[nChannels * channelSize], std::default_delete<float[]>());
+      std::shared_ptr<void> newB(new float[nChannels], std::default_delete<float[]>());
+      auto wData = static_cast<float *>(newW.get());
+      auto bData = static_cast<float *>(newB.get());
+      for (size_t m = 0; m < nChannels; m++) {
+         float s = scale[m] / std::sqrt(var[m] + epsilon);
+         for (size_t i = 0; i < channelSize; i++)
+            wData[m * channelSize + i] = w[m * channelSize + i] * s;
+         bData[m] = ((b ? b[m] : 0.f) - mean[m]) * s + bnBias[m];
+      }
+      model.UpdateInitializedTensor(fNW, ETensorType::FLOAT, shapeW, newW);
+      if (fNB.empty()) {
+         fNB = foldedBiasName;
+         model.AddInitializedTensor(fNB, ETensorType::FLOAT, channelShape, newB);
+      } else {
+         model.UpdateInitializedTensor(fNB, ETensorType::FLOAT, channelShape, newB);
+      }
+      fNY = UTILITY::Clean_name(outputName);
+      fInputTensorNames = {fNX, fNW, fNB};
+      fOutputTensorNames = {fNY};
+      return true;
+   }
+
    /*! \brief Returns the blas routines needed to compile the generated code
     */
    std::vector<std::string> GetBlasRoutines() { return { std::string("Gemm"), std::string("Axpy") }; }
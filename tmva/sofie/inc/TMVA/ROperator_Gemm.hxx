@@ -46,6 +46,8 @@ namespace SOFIE{
       ROperator_Gemm(float alpha, float beta, int_t transA, int_t transB, std::string nameA, std::string nameB, std::string nameY):
          fAttrAlpha(alpha), fAttrBeta(beta), fAttrTransA(transA), fAttrTransB(transB), fNA(UTILITY::Clean_name(nameA)),
          fNB(UTILITY::Clean_name(nameB)), fNY(UTILITY::Clean_name(nameY)) {
+         fInputTensorNames = {fNA, fNB};
+         fOutputTensorNames = {fNY};
 
          if (std::is_same<T, float>::value) {
             fType = "float";
@@ -57,6 +59,8 @@ namespace SOFIE{
       ROperator_Gemm(float alpha, float beta, int_t transA, int_t transB, std::string nameA, std::string nameB, std::string nameC, std::string nameY):
          fAttrAlpha(alpha), fAttrBeta(beta), fAttrTransA(transA), fAttrTransB(transB), fNA(UTILITY::Clean_name(nameA)),
          fNB(UTILITY::Clean_name(nameB)), fNC(UTILITY::Clean_name(nameC)), fNY(UTILITY::Clean_name(nameY)) {
+         fInputTensorNames = {fNA, fNB, fNC};
+         fOutputTensorNames = {fNY};
 
          if (std::is_same<T, float>::value) {
             fType = "float";
@@ -162,6 +166,7 @@ namespace SOFIE{
 
          model.AddIntermediateTensor(fNY, model.GetTensorType(fNA), fShapeY);
          model.AddNeededStdLib("algorithm");
+         fUseParallelFor = model.UseIntraOpParallel();
 
       }
 
@@ -216,17 +221,40 @@ namespace SOFIE{
                throw std::runtime_error("TMVA SOFIE Gemm Op : Bias tensor is not present but beta value in Gemm is not zero");
             }
          }
-         if (fType == "float"){
+         size_t nTasks = GetNumberOfParallelTasks(n, size_t(m) * n * k);
+         if (fType == "float" && nTasks > 1) {
+            // split the output features (rows of the column-major result) in tasks
+            size_t chunk = (n + nTasks - 1) / nTasks;
+            out << SP << "fParallelFor(" << nTasks << ", [&](unsigned int task) {\n";
+            out << SP << SP << "int " << OpName << "_n0 = task * " << chunk << ";\n";
+            out << SP << SP << "int " << OpName << "_nc = std::min(" << chunk << ", " << OpName << "_n - " << OpName << "_n0);\n";
+            out << SP << SP << "BLAS::sgemm_(&" << OpName << "_transB, &" << OpName << "_transA, &" << OpName
+             << "_nc, &" << OpName << "_m, &" << OpName << "_k, &" << OpName << "_alpha, " << "tensor_" << fNB
+             << " + " << OpName << "_n0" << (fAttrTransB ? " * " + OpName + "_k" : std::string(""))
+             << ", &" << OpName << "_ldb, " << "tensor_" << fNA << ", &" << OpName << "_lda, &" << OpName << "_beta, "
+             << "tensor_" << fNY << " + " << OpName << "_n0, &" << OpName << "_n);\n";
+            out << SP << "});\n";
+         } else if (fType == "float"){
             out << SP << "BLAS::sgemm_(&" << OpName << "_transB, &" << OpName << "_transA, &" << OpName
              << "_n, &" << OpName << "_m, &" << OpName << "_k, &" << OpName << "_alpha, " << "tensor_" << fNB
              << ", &" << OpName << "_ldb, " << "tensor_" << fNA << ", &" << OpName << "_lda, &" << OpName << "_beta, " << "tensor_" << fNY << ", &"
              << OpName << "_n);\n";
           }
+         out << GenerateFusedActivation(fNY, ConvertShapeToLength(fShapeY));
 
           return out.str();
 
          }
 
+         bool FuseActivation(EActivationType activation, const std::string & outputName) {
+            if (fActivation != EActivationType::UNDEFINED || fType != "float")
+               return false;
+            fActivation = activation;
+            fNY = UTILITY::Clean_name(outputName);
+            fOutputTensorNames = {fNY};
+            return true;
+         }
+
          std::vector<std::string> GetBlasRoutines() { return { std::string("Gemm"), std::string("Gemv") }; }
 
    };
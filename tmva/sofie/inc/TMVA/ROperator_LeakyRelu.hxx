@@ -29,6 +29,8 @@ public:
    ROperator_LeakyRelu(float alpha,std::string nameX, std::string nameY):
    falpha(alpha),fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY))
    {
+      fInputTensorNames = {fNX};
+      fOutputTensorNames = {fNY};
       if(std::is_same<T, float>::value){
          fType = "float";
       }
@@ -74,6 +74,8 @@ public:
         fAttrDilations(attr.dilations), fAttrKernelShape(attr.kernel_shape), fAttrPads(attr.pads), fAttrStrides(attr.strides),
         fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY))
    {
+      fInputTensorNames = {fNX};
+      fOutputTensorNames = {fNY};
       if(std::is_same<T, float>::value) {
          fType = "float";
       } else {
@@ -0,0 +1,124 @@
+#ifndef TMVA_SOFIE_ROPERATOR_QLinearMatMul
+#define TMVA_SOFIE_ROPERATOR_QLinearMatMul
+
+#include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator.hxx"
+#include "TMVA/ROperator_QuantizeLinear.hxx"
+#include "TMVA/RModel.hxx"
+
+#include <sstream>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+// Matrix product of quantized tensors, Y[M,N] = A[M,K] * B[K,N].
+// The products are accumulated as int32 integers and the result is requantized with
+// the output scale and zero point. B can be quantized per column.
+class ROperator_QLinearMatMul final : public ROperator
+{
+
+private:
+
+   std::string fNA;
+   std::string fNB;
+   std::string fNY;
+   std::vector<std::string> fNParams; // scale and zero point names of A, B and Y
+   std::vector<size_t> fShapeA;
+   std::vector<size_t> fShapeB;
+   std::vector<size_t> fShapeY;
+   QuantizationParameters fParamsA;
+   QuantizationParameters fParamsB;
+   QuantizationParameters fParamsY;
+
+public:
+   ROperator_QLinearMatMul(){}
+   ROperator_QLinearMatMul(std::string nameA, std::string nameScaleA, std::string nameZeroPointA,
+                           std::string nameB, std::string nameScaleB, std::string nameZeroPointB,
+                           std::string nameScaleY, std::string nameZeroPointY, std::string nameY):
+   fNA(UTILITY::Clean_name(nameA)), fNB(UTILITY::Clean_name(nameB)), fNY(UTILITY::Clean_name(nameY)) {
+      for (auto & name : {nameScaleA, nameZeroPointA, nameScaleB, nameZeroPointB, nameScaleY, nameZeroPointY})
+         fNParams.push_back(UTILITY::Clean_name(name));
+      fInputTensorNames = {fNA, fNB};
+      fOutputTensorNames = {fNY};
+   }
+
+   std::vector<ETensorType> TypeInference(std::vector<ETensorType> /*input*/){
+      return {fParamsY.fType};
+   }
+
+   std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>> input){
+      if (input.size() != 2 || input[0].size() > 2 || input[1].size() != 2)
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op Shape Inference supports only matrices");
+      std::vector<size_t> s_a(input[0]);
+      if (s_a.size() == 1)
+         s_a = {1, s_a[0]};
+      if (s_a[1] != input[1][0])
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op has inconsistent shapes " + ConvertShapeToString(input[0])
+                                  + " and " + ConvertShapeToString(input[1]));
+      return {{s_a[0], input[1][1]}};
+   }
+
+   void Initialize(RModel& model){
+      if ((model.CheckIfTensorAlreadyExist(fNA) == false) || (model.CheckIfTensorAlreadyExist(fNB) == false)){
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op Input Tensor " + fNA + " or " + fNB + " is not found in model");
+      }
+      fShapeA = model.GetTensorShape(fNA);
+      fShapeB = model.GetTensorShape(fNB);
+      fShapeY = ShapeInference({fShapeA, fShapeB})[0];
+      fParamsA.Read(model, fNParams[0], fNParams[1], "QLinearMatMul");
+      fParamsB.Read(model, fNParams[2], fNParams[3], "QLinearMatMul");
+      fParamsY.Read(model, fNParams[4], fNParams[5], "QLinearMatMul");
+      if (!fParamsA.IsPerTensor() || !fParamsY.IsPerTensor())
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op supports only a per tensor quantization of the input A and of the output");
+      if (!fParamsB.IsPerTensor() && fParamsB.fScale.size() != fShapeY[1])
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op supports only a per tensor or per column quantization of B");
+      if (model.GetTensorType(fNA) != fParamsA.fType || model.GetTensorType(fNB) != fParamsB.fType)
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul Op input tensors have a type different from their zero points");
+      model.AddIntermediateTensor(fNY, fParamsY.fType, fShapeY);
+   }
+
+   std::string Generate(std::string OpName){
+      OpName = "op_" + OpName;
+      if (fShapeY.empty()) {
+         throw std::runtime_error("TMVA SOFIE QLinearMatMul called to Generate without being initialized first");
+      }
+      size_t m = fShapeY[0];
+      size_t n = fShapeY[1];
+      size_t k = fShapeB[0];
+      std::stringstream out;
+      out << "\n//------ QLinearMatMul\n";
+      out << fParamsB.GenerateArrays(OpName + "_B", SP);
+      // accumulate the products of a row of A with B in int32, looping on B rows to read it contiguously
+      out << SP << "std::vector<int32_t> " << OpName << "_acc(" << n << ");\n";
+      out << SP << "for (int i = 0; i < " << m << "; i++) {\n";
+      out << SP << SP << "std::fill(" << OpName << "_acc.begin(), " << OpName << "_acc.end(), 0);\n";
+      out << SP << SP << "for (int l = 0; l < " << k << "; l++) {\n";
+      out << SP << SP << SP << "int32_t a = static_cast<int32_t>(tensor_" << fNA << "[i * " << k << " + l]) - "
+          << fParamsA.ZeroPoint("", "") << ";\n";
+      out << SP << SP << SP << "for (int j = 0; j < " << n << "; j++)\n";
+      out << SP << SP << SP << SP << OpName << "_acc[j] += a * (static_cast<int32_t>(tensor_" << fNB << "[l * " << n
+          << " + j]) - " << fParamsB.ZeroPoint(OpName + "_B", "j") << ");\n";
+      out << SP << SP << "}\n";
+      // requantize with the output scale, rounding half to even as QuantizeLinear
+      out << SP << SP << "for (int j = 0; j < " << n << "; j++) {\n";
+      out << SP << SP << SP << "float q = std::nearbyint(" << OpName << "_acc[j] * (" << fParamsA.Scale("", "") << " * "
+          << fParamsB.Scale(OpName + "_B", "j") << " / " << fParamsY.Scale("", "") << ")) + " << fParamsY.ZeroPoint("", "") << ";\n";
+      out << SP << SP << SP << "q = (q < " << fParamsY.Min() << ") ? " << fParamsY.Min() << " : ((q > " << fParamsY.Max()
+          << ") ? " << fParamsY.Max() << " : q);\n";
+      out << SP << SP << SP << "tensor_" << fNY << "[i * " << n << " + j] = static_cast<"
+          << ConvertTypeToString(fParamsY.fType) << ">(q);\n";
+      out << SP << SP << "}\n";
+      out << SP << "}\n";
+      return out.str();
+   }
+
+   std::vector<std::string> GetStdLibs() { return { std::string("cmath"), std::string("algorithm") }; }
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+
+#endif //TMVA_SOFIE_ROPERATOR_QLinearMatMul
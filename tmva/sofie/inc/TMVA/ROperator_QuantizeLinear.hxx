@@ -0,0 +1,211 @@
+#ifndef TMVA_SOFIE_ROPERATOR_QuantizeLinear
+#define TMVA_SOFIE_ROPERATOR_QuantizeLinear
+
+#include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator.hxx"
+#include "TMVA/RModel.hxx"
+
+#include <sstream>
+#include <iomanip>
+#include <limits>
+
+namespace TMVA{
+namespace Experimental{
+namespace SOFIE{
+
+// Parameters of a linear quantization: q = saturate(round(x / scale) + zero_point), x = (q - zero_point) * scale.
+// Scale and zero point are given per tensor (one value) or per axis (one value for each element along the axis).
+struct QuantizationParameters {
+   std::vector<float> fScale;
+   std::vector<int32_t> fZeroPoint;
+   ETensorType fType = ETensorType::UNINT8; // type of the quantized tensor, given by the one of the zero point
+
+   // read the parameters from the model: scale and zero point must be initialized tensors.
+   // If the zero point is not given it is 0 and the quantized type is uint8
+   void Read(RModel &model, const std::string &nameScale, const std::string &nameZeroPoint, const std::string &opName) {
+      if (!model.IsInitializedTensor(nameScale))
+         throw std::runtime_error("TMVA SOFIE " + opName + " Op supports only an initialized scale tensor, " + nameScale + " is not");
+      size_t n = ConvertShapeToLength(model.GetTensorShape(nameScale));
+      if (model.GetTensorType(nameScale) != ETensorType::FLOAT)
+         throw std::runtime_error("TMVA SOFIE " + opName + " Op supports only a float scale tensor");
+      auto scale = static_cast<float *>(model.GetInitializedTensorData(nameScale).get());
+      fScale.assign(scale, scale + n);
+      fZeroPoint.assign(n, 0);
+      if (nameZeroPoint.empty())
+         return;
+      if (!model.IsInitializedTensor(nameZeroPoint))
+         throw std::runtime_error("TMVA SOFIE " + opName + " Op supports only an initialized zero point tensor, " + nameZeroPoint + " is not");
+      if (ConvertShapeToLength(model.GetTensorShape(nameZeroPoint)) != n)
+         throw std::runtime_error("TMVA SOFIE " + opName + " Op scale and zero point tensors have different sizes");
+      fType = model.GetTensorType(nameZeroPoint);
+      auto data = model.GetInitializedTensorData(nameZeroPoint);
+      for (size_t i = 0; i < n; i++) {
+         if (fType == ETensorType::INT8)
+            fZeroPoint[i] = static_cast<int8_t *>(data.get())[i];
+         else if (fType == ETensorType::UNINT8)
+            fZeroPoint[i] = static_cast<uint8_t *>(data.get())[i];
+         else
+            throw std::runtime_error("TMVA SOFIE " + opName + " Op supports only int8 and uint8 quantized tensors");
+      }
+   }
+
+   bool IsPerTensor() const { return fScale.size() == 1; }
+   int32_t Min() const { return (fType == ETensorType::INT8) ? -128 : 0; }
+   int32_t Max() const { return (fType == ETensorType::INT8) ? 127 : 255; }
+
+   // generate the code of the scale and zero point of the element with index `channel`: a constant
+   // for a per tensor quantization, otherwise an element of the arrays declared by GenerateArrays
+   std::string Scale(const std::string &arrayName, const std::string &channel) const {
+      if (IsPerTensor()) {
+         std::stringstream out;
+         out << std::setprecision(std::numeric_limits<float>::max_digits10) << fScale[0] << "f";
+         return out.str();
+      }
+      return arrayName + "_scale[" + channel + "]";
+   }
+   std::string ZeroPoint(const std::string &arrayName, const std::string &channel) const {
+      return (IsPerTensor()) ? std::to_string(fZeroPoint[0]) : arrayName + "_zero_point[" + channel + "]";
+   }
+   std::string GenerateArrays(const std::string &arrayName, const std::string &SP) const {
+      if (IsPerTensor())
+         return "";
+      std::stringstream out;
+      out << SP << "const float " << arrayName << "_scale[] = {";
+      for (size_t i = 0; i < fScale.size(); i++)
+         out << std::setprecision(std::numeric_limits<float>::max_digits10) << fScale[i] << ((i < fScale.size() - 1) ? ", " : "};\n");
+      out << SP << "const int32_t " << arrayName << "_zero_point[] = {";
+      for (size_t i = 0; i < fZeroPoint.size(); i++)
+         out << fZeroPoint[i] << ((i < fZeroPoint.size() - 1) ? ", " : "};\n");
+      return out.str();
+   }
+};
+
+enum EQuantizeLinearOperator { QuantizeLinear, DequantizeLinear };
+
+// QuantizeLinear (float to int8/uint8) and DequantizeLinear (int8/uint8 to float) operators
+template <EQuantizeLinearOperator Op>
+class ROperator_QuantizeLinear final : public ROperator
+{
+
+private:
+
+   std::string fNX;
+   std::string fNScale;
+   std::string fNZeroPoint;
+   std::string fNY;
+   int fAttrAxis = 1;
+   std::vector<size_t> fShape;
+   QuantizationParameters fParams;
+   // dequantizing an initialized tensor is done once in Initialize
+   bool fIsOutputConstant = false;
+
+   std::string Name() const { return (Op == QuantizeLinear) ? "QuantizeLinear" : "DequantizeLinear"; }
+
+public:
+   ROperator_QuantizeLinear(){}
+   ROperator_QuantizeLinear(std::string nameX, std::string nameScale, std::string nameZeroPoint, std::string nameY, int axis = 1):
+   fNX(UTILITY::Clean_name(nameX)), fNScale(UTILITY::Clean_name(nameScale)), fNZeroPoint(UTILITY::Clean_name(nameZeroPoint)),
+   fNY(UTILITY::Clean_name(nameY)), fAttrAxis(axis) {
+      fInputTensorNames = {fNX};
+      fOutputTensorNames = {fNY};
+   }
+
+   std::vector<ETensorType> TypeInference(std::vector<ETensorType> /*input*/){
+      if (Op == QuantizeLinear)
+         return {fParams.fType};
+      return {ETensorType::FLOAT};
+   }
+
+   std::vector<std::vector<size_t>> ShapeInference(std::vector<std::vector<size_t>> input){
+      auto ret = input; //suggest copy to compiler
+      return ret;
+   }
+
+   void Initialize(RModel& model){
+       //input must be a graph input, or already initialized intermediate tensor
+      if (model.CheckIfTensorAlreadyExist(fNX) == false){
+        throw std::runtime_error("TMVA SOFIE " + Name() + " Op Input Tensor " + fNX + " is not found in model");
+      }
+      fShape = model.GetTensorShape(fNX);
+      fParams.Read(model, fNScale, fNZeroPoint, Name());
+      if (!fParams.IsPerTensor()) {
+         if (fAttrAxis < 0)
+            fAttrAxis += fShape.size();
+         if (fAttrAxis < 0 || fAttrAxis >= (int) fShape.size() || fShape[fAttrAxis] != fParams.fScale.size())
+            throw std::runtime_error("TMVA SOFIE " + Name() + " Op scale tensor " + fNScale + " has a wrong size for axis "
+                                     + std::to_string(fAttrAxis) + " of the input shape " + ConvertShapeToString(fShape));
+      }
+      ETensorType inputType = model.GetTensorType(fNX);
+      if (Op == QuantizeLinear && inputType != ETensorType::FLOAT)
+         throw std::runtime_error("TMVA SOFIE QuantizeLinear Op supports only a float input tensor");
+      if (Op == DequantizeLinear && inputType != fParams.fType)
+         throw std::runtime_error("TMVA SOFIE DequantizeLinear Op input tensor " + fNX + " has a type different from its zero point");
+
+      // quantized weights: dequantize them here and use them as float initialized tensors
+      if (Op == DequantizeLinear && model.IsInitializedTensor(fNX)) {
+         size_t length = ConvertShapeToLength(fShape);
+         size_t stride = 1;
+         for (size_t i = fAttrAxis + 1; !fParams.IsPerTensor() && i < fShape.size(); i++)
+            stride *= fShape[i];
+         auto data = model.GetInitializedTensorData(fNX);
+         std::shared_ptr<void> output(malloc(length * sizeof(float)), free);
+         float * y = static_cast<float *>(output.get());
+         for (size_t id = 0; id < length; id++) {
+            size_t ic = (fParams.IsPerTensor()) ? 0 : (id / stride) % fParams.fScale.size();
+            int32_t q = (inputType == ETensorType::INT8) ? static_cast<int8_t *>(data.get())[id]
+                                                        : static_cast<uint8_t *>(data.get())[id];
+            y[id] = (q - fParams.fZeroPoint[ic]) * fParams.fScale[ic];
+         }
+         model.AddInitializedTensor(fNY, ETensorType::FLOAT, fShape, output);
+         fIsOutputConstant = true;
+         return;
+      }
+      model.AddIntermediateTensor(fNY, TypeInference({inputType})[0], fShape);
+   }
+
+
+   std::string Generate(std::string OpName){
+      OpName = "op_" + OpName;
+      if (fShape.empty()) {
+         throw std::runtime_error("TMVA SOFIE " + Name() + " called to Generate without being initialized first");
+      }
+      if (fIsOutputConstant)
+         return "";
+      std::stringstream out;
+      size_t length = ConvertShapeToLength(fShape);
+      std::string channel = "0";
+      out << "\n//------ " << Name() << "\n";
+      out << fParams.GenerateArrays(OpName, SP);
+      out << SP << "for (int id = 0; id < " << length << " ; id++){\n";
+      if (!fParams.IsPerTensor()) {
+         size_t stride = 1;
+         for (size_t i = fAttrAxis + 1; i < fShape.size(); i++)
+            stride *= fShape[i];
+         out << SP << SP << "int ic = (id / " << stride << ") % " << fShape[fAttrAxis] << ";\n";
+         channel = "ic";
+      }
+      std::string scale = fParams.Scale(OpName, channel);
+      std::string zeroPoint = fParams.ZeroPoint(OpName, channel);
+      if (Op == QuantizeLinear) {
+         // std::nearbyint rounds half to even, as required by ONNX
+         out << SP << SP << "float q = std::nearbyint(tensor_" << fNX << "[id] / " << scale << ") + " << zeroPoint << ";\n";
+         out << SP << SP << "q = (q < " << fParams.Min() << ") ? " << fParams.Min() << " : ((q > " << fParams.Max() << ") ? "
+             << fParams.Max() << " : q);\n";
+         out << SP << SP << "tensor_" << fNY << "[id] = static_cast<" << ConvertTypeToString(fParams.fType) << ">(q);\n";
+      } else {
+         out << SP << SP << "tensor_" << fNY << "[id] = (static_cast<int32_t>(tensor_" << fNX << "[id]) - " << zeroPoint
+             << ") * " << scale << ";\n";
+      }
+      out << SP << "}\n";
+      return out.str();
+   }
+
+   std::vector<std::string> GetStdLibs() { return { std::string("cmath") }; }
+};
+
+}//SOFIE
+}//Experimental
+}//TMVA
+
+
+#endif //TMVA_SOFIE_ROPERATOR_QuantizeLinear
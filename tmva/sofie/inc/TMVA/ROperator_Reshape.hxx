@@ -39,6 +39,8 @@ public:
       : fOpMode(opMode), fNData(UTILITY::Clean_name(nameData)), fNShape(UTILITY::Clean_name(nameShape)),
       fNOutput(UTILITY::Clean_name(nameOutput))
    {
+      fInputTensorNames = {fNData, fNShape};
+      fOutputTensorNames = {fNOutput};
       if (opMode == Reshape) fAllowZero = attr_value;
       if (opMode == Flatten) fAxis = attr_value;
    }
@@ -49,6 +51,8 @@ public:
       : fOpMode(opMode), fNData(UTILITY::Clean_name(nameData)), fNOutput(UTILITY::Clean_name(nameOutput)),
         fAttrAxes(attrAxes)
    {
+      fInputTensorNames = {fNData};
+      fOutputTensorNames = {fNOutput};
       assert(fOpMode == Squeeze || fOpMode == Unsqueeze);
    }
 
@@ -24,7 +24,10 @@ private:
 public:
    ROperator_Selu(){}
    ROperator_Selu(std::string nameX, std::string nameY):
-      fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){}
+      fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){
+      fInputTensorNames = {fNX};
+      fOutputTensorNames = {fNY};
+   }
 
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
       return input;
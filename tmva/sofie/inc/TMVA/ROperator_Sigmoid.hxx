@@ -24,7 +24,10 @@ private:
 public:
    ROperator_Sigmoid(){}
    ROperator_Sigmoid(std::string nameX, std::string nameY):
-      fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){}
+      fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){
+      fInputTensorNames = {fNX};
+      fOutputTensorNames = {fNY};
+   }
 
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
       return input;
@@ -44,6 +47,8 @@ public:
    }
 
 
+   EActivationType GetActivationType() const { return EActivationType::SIGMOID; }
+
    std::string Generate(std::string OpName){
       OpName = "op_" + OpName;
       if (fShape.empty()){
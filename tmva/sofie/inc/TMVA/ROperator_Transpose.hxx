@@ -32,10 +32,14 @@ public:
    ROperator_Transpose(){}
    ROperator_Transpose(std::vector<int_t> attr_perm, std::string nameData, std::string nameOutput):
       fAttrPerm(attr_perm), fNData(UTILITY::Clean_name(nameData)), fNOutput(UTILITY::Clean_name(nameOutput)) {
+      fInputTensorNames = {fNData};
+      fOutputTensorNames = {fNOutput};
    }
 
    ROperator_Transpose(std::string nameData, std::string nameOutput):
       fNData(UTILITY::Clean_name(nameData)), fNOutput(UTILITY::Clean_name(nameOutput)) {
+      fInputTensorNames = {fNData};
+      fOutputTensorNames = {fNOutput};
    }
 
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
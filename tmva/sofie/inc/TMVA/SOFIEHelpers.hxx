@@ -2,11 +2,19 @@
 #define TMVA_SOFIE_SOFIE_HELPERS
 
 
+#include "ROOT/RDF/RActionImpl.hxx"
+#include "ROOT/RVec.hxx"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
 #include <string>
 
+class TTreeReader;
+
 
 namespace TMVA{
 namespace Experimental{
@@ -63,6 +71,149 @@ auto SofieFunctor(unsigned int nslots = 0, const std::string & weightsFile = "")
    return SofieFunctorHelper<std::make_index_sequence<N>, Session_t, float>(nslots, weightsFile);
 }
 
+///Helper class used by SofieRVecFunctor to pass the data of
+///a RVec column directly to the infer function, without copies
+template <typename Session_t, typename T>
+class SofieRVecFunctorHelper {
+   std::vector<Session_t> fSessions;
+
+public:
+
+   SofieRVecFunctorHelper(unsigned int nslots = 0, const std::string & filename = "")
+   {
+      if (nslots < 1) nslots = 1;
+      fSessions.reserve(nslots);
+      for (unsigned int i = 0; i < nslots; i++) {
+         fSessions.emplace_back(filename);
+      }
+   }
+
+   std::vector<T> operator()(unsigned slot, const ROOT::RVec<T> & x) {
+      // the generated infer function does not modify its input
+      return fSessions[slot].infer(const_cast<T *>(x.data()));
+   }
+};
+
+/// SofieRVecFunctor : as SofieFunctor, but reading all the model inputs of an event
+/// from a single RVec column and returning all the model outputs.
+/// The column size must be the model input size.
+template <typename Session_t>
+auto SofieRVecFunctor(unsigned int nslots = 0, const std::string & weightsFile = "") -> SofieRVecFunctorHelper<Session_t, float>
+{
+   return SofieRVecFunctorHelper<Session_t, float>(nslots, weightsFile);
+}
+
+/// RDataFrame action helper evaluating a SOFIE model on batches of events.
+/// The inputs of the events processed by each slot are accumulated in a buffer
+/// of the batch size used when generating the model, and the Session is run once per
+/// full batch; the last partial batch of each slot is padded with zeros.
+/// The inputs are either one column per model input or a single RVec column with
+/// the model input size. The result contains the model outputs of all events:
+/// in the order of processing in a sequential event loop, grouped by slot otherwise.
+/// Example:
+/// ~~~{.cpp}
+/// TMVA::Experimental::SofieBatchedHelper<TMVA_SOFIE_Model::Session> helper(64, 7, df.GetNSlots());
+/// auto outputs = df.Book<float, float, float, float, float, float, float>(std::move(helper), inputColumns);
+/// ~~~
+template <typename Session_t, typename T = float>
+class SofieBatchedHelper : public ROOT::Detail::RDF::RActionImpl<SofieBatchedHelper<Session_t, T>> {
+public:
+   using Result_t = std::vector<T>;
+
+private:
+   std::size_t fBatchSize;
+   std::size_t fInputSize;
+   std::vector<Session_t> fSessions;
+   std::vector<std::vector<T>> fInputs;    ///< batch of inputs for each slot
+   std::vector<std::size_t> fNEvents;      ///< number of events in the batch of each slot
+   std::vector<std::vector<T>> fOutputs;   ///< outputs of the events processed by each slot
+   std::shared_ptr<Result_t> fResult;
+
+   void RunBatch(unsigned int slot)
+   {
+      std::size_t nEvents = fNEvents[slot];
+      if (nEvents == 0)
+         return;
+      auto & input = fInputs[slot];
+      std::fill(input.begin() + nEvents * fInputSize, input.end(), T(0));
+      auto y = fSessions[slot].infer(input.data());
+      std::size_t outputSize = y.size() / fBatchSize;
+      fOutputs[slot].insert(fOutputs[slot].end(), y.begin(), y.begin() + nEvents * outputSize);
+      fNEvents[slot] = 0;
+   }
+
+   T *NextEventInput(unsigned int slot) { return fInputs[slot].data() + fNEvents[slot] * fInputSize; }
+
+   void EventAdded(unsigned int slot)
+   {
+      if (++fNEvents[slot] == fBatchSize)
+         RunBatch(slot);
+   }
+
+public:
+   /// \param batchSize batch size of the generated model
+   /// \param inputSize number of model inputs of a single event
+   /// \param nslots number of RDataFrame slots, one Session is created for each of them
+   /// \param filename weight file of the Sessions
+   SofieBatchedHelper(std::size_t batchSize, std::size_t inputSize, unsigned int nslots = 0,
+                      const std::string & filename = "")
+      : fBatchSize(batchSize), fInputSize(inputSize), fResult(std::make_shared<Result_t>())
+   {
+      if (fBatchSize == 0 || fInputSize == 0)
+         throw std::invalid_argument("SofieBatchedHelper: batch and input sizes must be positive");
+      if (nslots < 1) nslots = 1;
+      fSessions.reserve(nslots);
+      for (unsigned int i = 0; i < nslots; i++) {
+         fSessions.emplace_back(filename);
+      }
+      fInputs.assign(nslots, std::vector<T>(fBatchSize * fInputSize));
+      fNEvents.assign(nslots, 0);
+      fOutputs.resize(nslots);
+   }
+   SofieBatchedHelper(SofieBatchedHelper &&) = default;
+   SofieBatchedHelper(const SofieBatchedHelper &) = delete;
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fResult; }
+
+   void Initialize() {}
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   /// one column per model input
+   template <typename... Inputs>
+   void Exec(unsigned int slot, Inputs... inputs)
+   {
+      static_assert(sizeof...(Inputs) > 0, "SofieBatchedHelper needs at least one input column");
+      if (sizeof...(Inputs) != fInputSize)
+         throw std::runtime_error("SofieBatchedHelper: the number of input columns is not the model input size");
+      T *x = NextEventInput(slot);
+      std::size_t i = 0;
+      using expander = int[];
+      (void)expander{0, (x[i++] = static_cast<T>(inputs), 0)...};
+      EventAdded(slot);
+   }
+
+   /// all model inputs in a RVec column
+   void Exec(unsigned int slot, const ROOT::RVec<T> & inputs)
+   {
+      if (inputs.size() != fInputSize)
+         throw std::runtime_error("SofieBatchedHelper: the size of the input column is not the model input size");
+      std::copy(inputs.begin(), inputs.end(), NextEventInput(slot));
+      EventAdded(slot);
+   }
+
+   void Finalize()
+   {
+      for (unsigned int slot = 0; slot < fSessions.size(); slot++) {
+         RunBatch(slot);
+         fResult->insert(fResult->end(), fOutputs[slot].begin(), fOutputs[slot].end());
+         fOutputs[slot].clear();
+      }
+   }
+
+   std::string GetActionName() { return "SofieBatchedInference"; }
+};
+
 }//Experimental
 }//TMVA
 
@@ -25,6 +25,11 @@ enum class ETensorType{
     FLOAT16 = 10, DOUBLE = 11, UINT32 = 12, UINT64 = 13, COMPLEX64 = 14, COMPLEX28 = 15, BFLOAT16 = 16
 };
 
+// elementwise activations which can be fused into the operator producing their input
+enum class EActivationType{
+   UNDEFINED = 0, RELU = 1, SIGMOID = 2, TANH = 3
+};
+
 typedef std::int64_t int_t;
 
 std::string ConvertTypeToString(ETensorType type);
@@ -69,6 +74,8 @@ struct InitializedTensor{
          case ETensorType::DOUBLE: fSize*=sizeof(double); break;
          case ETensorType::INT32: fSize*=sizeof(int32_t); break;
          case ETensorType::INT64: fSize*=sizeof(int64_t); break;
+         case ETensorType::INT8: fSize*=sizeof(int8_t); break;
+         case ETensorType::UNINT8: fSize*=sizeof(uint8_t); break;
          default:
           throw std::runtime_error("TMVA::SOFIE doesn't yet supports serialising data-type " + ConvertTypeToString(fType));
       }
@@ -100,6 +107,13 @@ struct InitializedTensor{
           fData = tData;
           break;
       }
+      case ETensorType::INT8:
+      case ETensorType::UNINT8: {
+          std::shared_ptr<void> tData(malloc(fSize), free);
+          std::memcpy(tData.get(), fPersistentData, fSize);
+          fData = tData;
+          break;
+      }
       default: {
           throw std::runtime_error("TMVA::SOFIE doesn't yet supports serialising data-type " +
                                    ConvertTypeToString(fType));
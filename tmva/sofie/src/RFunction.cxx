@@ -53,10 +53,11 @@ void RFunction_Update::AddInputTensors(const std::vector<std::vector<std::size_t
     }
 }
 
-std::string RFunction_Update::GenerateModel(const std::string& filename, long read_pos, long block_size) {
+std::string RFunction_Update::GenerateModel(const std::string& filename, long read_pos, long block_size,
+                                            std::underlying_type_t<Options> options) {
     function_block->SetFilename(filename);
     // use batch size as block size in RModel::generate
-    function_block->Generate(Options::kGNNComponent,block_size,read_pos);
+    function_block->Generate(options | Options::kGNNComponent,block_size,read_pos);
     std::string modelGenerationString;
     modelGenerationString = "\n//--------- GNN_Update_Function---"+fFuncName+"\n"+function_block->ReturnGenerated();
     return modelGenerationString;
@@ -1,11 +1,16 @@
 #include <limits>
 #include <algorithm>
 #include <cctype>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <unordered_set>
 
 #include "TFile.h"
 
 #include "TMVA/RModel.hxx"
+#include "TMVA/ROperator_BatchNormalization.hxx"
+#include "TMVA/ROperator_Conv.hxx"
 #include "TMVA/SOFIE_common.hxx"
 
 namespace TMVA {
@@ -227,11 +232,75 @@ void RModel::Initialize(int batchSize) {
         if (!modelHasWeights) fUseWeightFile = false;
     }
 
+    if (fFuseOperators)
+        FuseOperators();
+
     for (auto& i : fOperators) {
         i->Initialize(*this);
     }
 }
 
+// Merge operators before their initialization: an activation (Relu, Sigmoid, Tanh) is applied in place
+// by the Gemm or Conv producing its input, and an inference BatchNormalization following a Conv is folded
+// into the convolution weights. The tensor between the two operators must be read only by the removed
+// operator and must not be a model output.
+void RModel::FuseOperators() {
+    // number of operators reading each tensor
+    std::unordered_map<std::string, size_t> nReaders;
+    for (auto & op : fOperators) {
+        // cannot know who reads the tensors written by this operator
+        if (op->GetOpOutputTensors().empty())
+            return;
+        for (auto & name : op->GetOpInputTensors())
+            nReaders[name]++;
+    }
+    std::unordered_set<std::string> modelOutputs(fOutputTensorNames.begin(), fOutputTensorNames.end());
+
+    for (size_t i = 0; i < fOperators.size(); i++) {
+        auto & outputs = fOperators[i]->GetOpOutputTensors();
+        if (outputs.size() != 1 || modelOutputs.count(outputs[0]) > 0 || nReaders[outputs[0]] != 1)
+            continue;
+        std::string name = outputs[0];
+        size_t j = i + 1;
+        for (; j < fOperators.size(); j++) {
+            auto & inputs = fOperators[j]->GetOpInputTensors();
+            if (std::find(inputs.begin(), inputs.end(), name) != inputs.end())
+                break;
+        }
+        if (j == fOperators.size())
+            continue;
+        ROperator * consumer = fOperators[j].get();
+        if (consumer->GetOpOutputTensors().size() != 1)
+            continue;
+        const std::string & consumerOutput = consumer->GetOpOutputTensors()[0];
+
+        bool fused = false;
+        if (consumer->GetActivationType() != EActivationType::UNDEFINED) {
+            fused = fOperators[i]->FuseActivation(consumer->GetActivationType(), consumerOutput);
+        } else {
+            auto conv = dynamic_cast<ROperator_Conv<float> *>(fOperators[i].get());
+            auto bn = dynamic_cast<ROperator_BatchNormalization<float> *>(consumer);
+            if (conv && bn) {
+                // the weights are modified: they must belong to this convolution only
+                auto & convInputs = conv->GetOpInputTensors();
+                bool ownWeights = std::all_of(convInputs.begin() + 1, convInputs.end(),
+                                              [&](const std::string & n) { return n.empty() || nReaders[n] == 1; });
+                auto & bnInputs = bn->GetOpInputTensors();
+                if (ownWeights && bnInputs.size() == 5)
+                    fused = conv->FuseBatchNormalization(*this, bnInputs[1], bnInputs[2], bnInputs[3], bnInputs[4],
+                                                         bn->GetEpsilon(), consumerOutput);
+            }
+        }
+        if (fused) {
+            for (auto & input : consumer->GetOpInputTensors())
+                nReaders[input]--;
+            fOperators.erase(fOperators.begin() + j);
+            // try to fuse also the next operator, e.g. Conv + BatchNormalization + Relu
+            i--;
+        }
+    }
+}
+
 void RModel::GenerateInitializedTensorInfo() {
     for (auto& i: fInitializedTensors) {
         if (i.second.fType == ETensorType::FLOAT) {
@@ -256,12 +325,121 @@ void RModel::GenerateInitializedTensorInfo() {
             }
 
         }
+        // quantized tensors (e.g. int8 weights) are always written in the code, since the weight file
+        // supports only float tensors
+        else if (i.second.fType == ETensorType::INT8 || i.second.fType == ETensorType::UNINT8) {
+            size_t length = ConvertShapeToLength(i.second.fShape);
+            bool isSigned = (i.second.fType == ETensorType::INT8);
+            fGC += ConvertTypeToString(i.second.fType) + " tensor_" + i.first + "[" + std::to_string(length) + "] = {";
+            std::stringstream values;
+            for (size_t idx = 0; idx < length; idx++) {
+                if (isSigned)
+                    values << static_cast<int>(static_cast<const int8_t *>(i.second.fData.get())[idx]);
+                else
+                    values << static_cast<int>(static_cast<const uint8_t *>(i.second.fData.get())[idx]);
+                if (idx < length-1) values << ", ";
+            }
+            fGC += values.str();
+            fGC += "};\n";
+        }
     }
 }
 
+// Plan the memory of the float intermediate tensors in a single pool, shared by tensors whose
+// lifetimes do not overlap. A tensor is alive from the operator writing it to the last operator
+// reading it, and it is placed with a first-fit strategy in the pool.
+// Model outputs and tensors not written by an operator (e.g. broadcasted weights filled in the
+// Session constructor) keep their own buffer.
+// Return the size of the pool, or zero if an operator does not declare its input and output
+// tensors: in this case nothing is planned.
+size_t RModel::PlanIntermediateMemoryPool(std::unordered_map<std::string, size_t> &offsets) const {
+    offsets.clear();
+    if (fIsGNN || fIsGNNComponent || fOperators.empty())
+        return 0;
+
+    std::unordered_set<std::string> modelOutputs(fOutputTensorNames.begin(), fOutputTensorNames.end());
+    std::vector<std::vector<std::string>> producedBy(fOperators.size());
+    std::unordered_map<std::string, size_t> lastUse;
+    for (size_t op = 0; op < fOperators.size(); op++) {
+        auto & outputs = fOperators[op]->GetOpOutputTensors();
+        if (outputs.empty())
+            return 0;
+        for (auto & name : outputs) {
+            auto f = fIntermediateTensorInfos.find(name);
+            if (f == fIntermediateTensorInfos.end() || f->second.type != ETensorType::FLOAT ||
+                modelOutputs.count(name) > 0 || lastUse.count(name) > 0)
+                continue;
+            producedBy[op].push_back(name);
+            lastUse[name] = op;
+        }
+        for (auto & name : fOperators[op]->GetOpInputTensors()) {
+            auto f = lastUse.find(name);
+            if (f != lastUse.end())
+                f->second = op;
+        }
+    }
+    std::vector<std::vector<std::string>> releasedAfter(fOperators.size());
+    for (auto & t : lastUse)
+        releasedAfter[t.second].push_back(t.first);
+
+    // free chunks of the pool: offset -> length
+    std::map<size_t, size_t> freeChunks;
+    size_t poolSize = 0;
+    for (size_t op = 0; op < fOperators.size(); op++) {
+        for (auto & name : producedBy[op]) {
+            size_t length = ConvertShapeToLength(fIntermediateTensorInfos.at(name).shape);
+            auto chunk = std::find_if(freeChunks.begin(), freeChunks.end(),
+                                      [&](const std::pair<const size_t, size_t> &c) { return c.second >= length; });
+            if (chunk != freeChunks.end()) {
+                offsets[name] = chunk->first;
+                if (chunk->second > length)
+                    freeChunks[chunk->first + length] = chunk->second - length;
+                freeChunks.erase(chunk);
+            } else if (!freeChunks.empty() && std::prev(freeChunks.end())->first + std::prev(freeChunks.end())->second == poolSize) {
+                // grow the pool from the last free chunk
+                auto last = std::prev(freeChunks.end());
+                offsets[name] = last->first;
+                poolSize = last->first + length;
+                freeChunks.erase(last);
+            } else {
+                offsets[name] = poolSize;
+                poolSize += length;
+            }
+        }
+        for (auto & name : releasedAfter[op]) {
+            size_t offset = offsets[name];
+            size_t length = ConvertShapeToLength(fIntermediateTensorInfos.at(name).shape);
+            auto next = freeChunks.lower_bound(offset);
+            if (next != freeChunks.end() && offset + length == next->first) {
+                length += next->second;
+                next = freeChunks.erase(next);
+            }
+            if (next != freeChunks.begin()) {
+                auto prev = std::prev(next);
+                if (prev->first + prev->second == offset) {
+                    prev->second += length;
+                    continue;
+                }
+            }
+            freeChunks[offset] = length;
+        }
+    }
+    return poolSize;
+}
+
 void RModel::GenerateIntermediateTensorInfo() {
+    std::unordered_map<std::string, size_t> poolOffsets;
+    size_t poolSize = PlanIntermediateMemoryPool(poolOffsets);
+    if (poolSize > 0) {
+        fGC += "std::vector<float> fIntermediateMemoryPool = std::vector<float>(" + std::to_string(poolSize) + ");\n";
+    }
     for (auto&i: fIntermediateTensorInfos) {
         size_t length = ConvertShapeToLength(i.second.shape);
+        auto poolOffset = poolOffsets.find(i.first);
+        if (poolOffset != poolOffsets.end()) {
+            fGC += "float * tensor_" + i.first + " = fIntermediateMemoryPool.data() + " + std::to_string(poolOffset->second) + ";\n";
+            continue;
+        }
         if (i.second.type == ETensorType::FLOAT) {
             fGC += "std::vector<float> fTensor_" + i.first  + " = std::vector<float>(" + std::to_string(length) + ");\n";
             fGC += "float * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
@@ -274,6 +452,11 @@ void RModel::GenerateIntermediateTensorInfo() {
             fGC += "std::vector<int64_t> fTensor_" + i.first  + " = std::vector<int64_t>(" + std::to_string(length) + ");\n";
             fGC += "int64_t * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
         }
+        if (i.second.type == ETensorType::INT8 || i.second.type == ETensorType::UNINT8) {
+            std::string type = ConvertTypeToString(i.second.type);
+            fGC += "std::vector<" + type + "> fTensor_" + i.first  + " = std::vector<" + type + ">(" + std::to_string(length) + ");\n";
+            fGC += type + " * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
+        }
     }
 }
 
@@ -330,6 +513,11 @@ void RModel::GenerateOutput() {
             fGC += "double* tensor_" + fInputTensorNames[i] + ",";
             break;
         }
+        case  ETensorType::INT8 :
+        case  ETensorType::UNINT8 : {
+            fGC += ConvertTypeToString(fReadyInputTensorInfos[fInputTensorNames[i]].type) + "* tensor_" + fInputTensorNames[i] + ",";
+            break;
+        }
         default: {
             throw std::runtime_error("TMVA-SOFIE: input tensor " + fInputTensorNames[i] + " is of a data type which is not yet supported.");
         }
@@ -401,6 +589,17 @@ void RModel::Generate(std::underlying_type_t<Options> options, int batchSize, lo
         fIsGNN = true;
     if (static_cast<std::underlying_type_t<Options>>(Options::kGNNComponent) & options)
         fIsGNNComponent = true;
+    if (static_cast<std::underlying_type_t<Options>>(Options::kNoOperatorFusion) & options)
+        fFuseOperators = false;
+    if (static_cast<std::underlying_type_t<Options>>(Options::kIntraOpParallel) & options) {
+        if (!fUseSession) {
+            throw
+            std::runtime_error("TMVA-SOFIE: RModel::Generate: intra-operator parallelism requires generating a Session class");
+        }
+        fUseIntraOpParallel = true;
+        AddNeededStdLib("functional");
+        AddNeededStdLib("algorithm");
+    }
 
     Initialize(batchSize);
     std::string hgname;
@@ -416,6 +615,15 @@ void RModel::Generate(std::underlying_type_t<Options> options, int batchSize, lo
     GenerateIntermediateTensorInfo();
 
     if (fUseSession) {
+        if (fUseIntraOpParallel) {
+            fGC += "\n// runs the tasks in which the operators split their work, by default sequentially.\n";
+            fGC += "// Use SetParallelFor to run them in a thread pool, e.g. with ROOT::TThreadExecutor::Foreach\n";
+            fGC += "using ParallelFor_t = std::function<void(unsigned int, const std::function<void(unsigned int)> &)>;\n";
+            fGC += "ParallelFor_t fParallelFor = [](unsigned int n, const std::function<void(unsigned int)> &task) {\n";
+            fGC += "   for (unsigned int i = 0; i < n; i++) task(i);\n";
+            fGC += "};\n";
+            fGC += "void SetParallelFor(ParallelFor_t parallelFor) { fParallelFor = parallelFor; }\n";
+        }
         // add here specific operator code that needs to define session data members
         fGC += "\n";
         for (size_t id = 0; id < fOperators.size(); id++) {
@@ -76,7 +76,13 @@ RModel_GNN::RModel_GNN(GNN_Init& graph_input_struct) {
     fParseTime  = std::asctime(gmt_time);
 }
 
-void RModel_GNN::Generate() {
+void RModel_GNN::Generate(std::underlying_type_t<Options> options) {
+    // options forwarded to the code generation of the update functions
+    auto componentOptions = options & static_cast<std::underlying_type_t<Options>>(Options::kIntraOpParallel);
+    if (componentOptions) {
+        AddNeededStdLib("functional");
+        AddNeededStdLib("algorithm");
+    }
     std::string hgname;
     GenerateHeaderInfo(hgname);
 
@@ -91,7 +97,7 @@ void RModel_GNN::Generate() {
     std::vector<std::vector<std::size_t>> Update_Input_edges = {{block_size, num_edge_features},{block_size, num_node_features},{block_size, num_node_features},{block_size, num_global_features}};
     edges_update_block->Initialize();
     edges_update_block->AddInputTensors(Update_Input_edges);
-    fGC+=edges_update_block->GenerateModel(fName);
+    fGC+=edges_update_block->GenerateModel(fName, 0, 1, componentOptions);
     next_pos = edges_update_block->GetFunctionBlock()->WriteInitializedTensorsToFile(fName+".dat");
     fGC+="};\n}\n";
 
@@ -109,7 +115,7 @@ void RModel_GNN::Generate() {
     std::vector<std::vector<std::size_t>>  Update_Input_nodes = {{block_size, num_edge_features},{block_size, num_node_features},{block_size, num_global_features}};
     nodes_update_block->Initialize();
     nodes_update_block->AddInputTensors(Update_Input_nodes);
-    fGC+=nodes_update_block->GenerateModel(fName,next_pos);
+    fGC+=nodes_update_block->GenerateModel(fName, next_pos, 1, componentOptions);
     next_pos = nodes_update_block->GetFunctionBlock()->WriteInitializedTensorsToFile(fName+".dat");
     fGC+="};\n}\n";
 
@@ -124,7 +130,7 @@ void RModel_GNN::Generate() {
     std::vector<std::vector<std::size_t>> Update_Input_globals = {{1, num_edge_features},{1, num_node_features},{1, num_global_features}};
     globals_update_block->Initialize();
     globals_update_block->AddInputTensors(Update_Input_globals);
-    fGC+=globals_update_block->GenerateModel(fName,next_pos);
+    fGC+=globals_update_block->GenerateModel(fName, next_pos, 1, componentOptions);
     next_pos = globals_update_block->GetFunctionBlock()->WriteInitializedTensorsToFile(fName+".dat");
     fGC+="};\n}\n";
 
@@ -150,6 +156,13 @@ void RModel_GNN::Generate() {
     fGC += "Edge_Update::Session edge_update;\n";
     fGC += "Node_Update::Session node_update;\n";
     fGC += "Global_Update::Session global_update;\n\n";
+    if (componentOptions) {
+        fGC += "void SetParallelFor(Edge_Update::Session::ParallelFor_t parallelFor) {\n";
+        fGC += "   edge_update.SetParallelFor(parallelFor);\n";
+        fGC += "   node_update.SetParallelFor(parallelFor);\n";
+        fGC += "   global_update.SetParallelFor(parallelFor);\n";
+        fGC += "}\n\n";
+    }
 
     fGC += "std::vector<int> fSenders = { ";
     for(int k=0; k<num_edges; ++k) {
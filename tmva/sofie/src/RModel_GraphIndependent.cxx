@@ -55,7 +55,13 @@ RModel_GraphIndependent::RModel_GraphIndependent(GraphIndependent_Init& graph_in
     fParseTime  = std::asctime(gmt_time);
 }
 
-void RModel_GraphIndependent::Generate() {
+void RModel_GraphIndependent::Generate(std::underlying_type_t<Options> options) {
+    // options forwarded to the code generation of the update functions
+    auto componentOptions = options & static_cast<std::underlying_type_t<Options>>(Options::kIntraOpParallel);
+    if (componentOptions) {
+        AddNeededStdLib("functional");
+        AddNeededStdLib("algorithm");
+    }
     std::string hgname;
     GenerateHeaderInfo(hgname);
 
@@ -70,7 +76,7 @@ void RModel_GraphIndependent::Generate() {
     std::vector<std::vector<std::size_t>> Update_Input = {{block_size, num_edge_features}};
     edges_update_block->Initialize();
     edges_update_block->AddInputTensors(Update_Input);
-    fGC+=edges_update_block->GenerateModel(fName);
+    fGC+=edges_update_block->GenerateModel(fName, 0, 1, componentOptions);
     next_pos = edges_update_block->GetFunctionBlock()->WriteInitializedTensorsToFile(fName+".dat");
     fGC+="};\n}\n";
 
@@ -87,7 +93,7 @@ void RModel_GraphIndependent::Generate() {
     Update_Input = {{block_size, num_node_features}};
     nodes_update_block->Initialize();
     nodes_update_block->AddInputTensors(Update_Input);
-    fGC+=nodes_update_block->GenerateModel(fName,next_pos);
+    fGC+=nodes_update_block->GenerateModel(fName, next_pos, 1, componentOptions);
     next_pos = nodes_update_block->GetFunctionBlock()->WriteInitializedTensorsToFile(fName+".dat");
     fGC+="};\n}\n";
 
@@ -102,7 +108,7 @@ void RModel_GraphIndependent::Generate() {
     Update_Input = {{1, num_global_features}};
     globals_update_block->Initialize();
     globals_update_block->AddInputTensors(Update_Input);
-    fGC+=globals_update_block->GenerateModel(fName,next_pos);
+    fGC+=globals_update_block->GenerateModel(fName, next_pos, 1, componentOptions);
     next_pos = globals_update_block->GetFunctionBlock()->WriteInitializedTensorsToFile(fName+".dat");
     fGC+="};\n}\n";
 
@@ -120,6 +126,13 @@ void RModel_GraphIndependent::Generate() {
     fGC += "Edge_Update::Session edge_update;\n";
     fGC += "Node_Update::Session node_update;\n";
     fGC += "Global_Update::Session global_update;\n\n";
+    if (componentOptions) {
+        fGC += "void SetParallelFor(Edge_Update::Session::ParallelFor_t parallelFor) {\n";
+        fGC += "   edge_update.SetParallelFor(parallelFor);\n";
+        fGC += "   node_update.SetParallelFor(parallelFor);\n";
+        fGC += "   global_update.SetParallelFor(parallelFor);\n";
+        fGC += "}\n\n";
+    }
 
     // create temp vector for edge and node updates
     fGC += "std::vector<float> fEdgeUpdates = std::vector<float>(" + std::to_string(num_edges) + "*" + std::to_string(num_edge_features) + ");";
@@ -27,6 +27,12 @@ std::string ConvertTypeToString(ETensorType type){
       case ETensorType::FLOAT : {
          return "float";
       }
+      case ETensorType::INT8 : {
+         return "int8_t";
+      }
+      case ETensorType::UNINT8 : {
+         return "uint8_t";
+      }
       case ETensorType::INT16 : {
          return "int16_t";
       }
@@ -64,6 +70,12 @@ ETensorType ConvertStringToType(std::string type){
    else if (type == "double" || type == "float64"){
       return ETensorType::DOUBLE;
    }
+   else if (type == "int8" || type == "int8_t"){
+      return ETensorType::INT8;
+   }
+   else if (type == "uint8" || type == "uint8_t"){
+      return ETensorType::UNINT8;
+   }
    else{
       return ETensorType::UNDEFINED;
    }
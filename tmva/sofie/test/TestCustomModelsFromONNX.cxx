@@ -257,6 +257,9 @@
 #include "Log_FromONNX.hxx"
 #include "input_models/references/Log.ref.hxx"
 
+#include "QLinearMatMul_FromONNX.hxx"
+#include "input_models/references/QLinearMatMul.ref.hxx"
+
 #include "gtest/gtest.h"
 
 constexpr float DEFAULT_TOLERANCE = 1e-3f;
@@ -476,6 +479,28 @@ TEST(ONNX, Cast)
    }
 }
 
+TEST(ONNX, QLinearMatMul)
+{
+   constexpr float TOLERANCE = DEFAULT_TOLERANCE;
+
+   // QuantizeLinear -> QLinearMatMul -> DequantizeLinear with uint8 tensors
+   std::vector<float> input({-1.0, -0.5, 0.1, 0.3, 0.7, 0.9});
+
+   TMVA_SOFIE_QLinearMatMul::Session s("QLinearMatMul_FromONNX.dat");
+
+   auto output = s.infer(input.data());
+
+   // Checking output size
+   EXPECT_EQ(output.size(), sizeof(QLinearMatMul_ExpectedOutput::outputs) / sizeof(float));
+
+   float *correct = QLinearMatMul_ExpectedOutput::outputs;
+
+   // Checking every output value, one by one
+   for (size_t i = 0; i < output.size(); ++i) {
+      EXPECT_LE(std::abs(output[i] - correct[i]), TOLERANCE);
+   }
+}
+
 TEST(ONNX, Linear64)
 {
    constexpr float TOLERANCE = DEFAULT_TOLERANCE;
@@ -0,0 +1,80 @@
+#include "TMVA/SOFIEHelpers.hxx"
+
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RVec.hxx"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace TMVA::Experimental;
+
+// mock of a generated Session with the given batch size and two inputs per event:
+// the outputs of an event are the sum and the difference of its inputs
+template <std::size_t BatchSize>
+struct SumSession {
+   static int fNCalls;
+   SumSession(const std::string & = "") {}
+   std::vector<float> infer(float *x)
+   {
+      fNCalls++;
+      std::vector<float> y(2 * BatchSize);
+      for (std::size_t i = 0; i < BatchSize; i++) {
+         y[2 * i] = x[2 * i] + x[2 * i + 1];
+         y[2 * i + 1] = x[2 * i] - x[2 * i + 1];
+      }
+      return y;
+   }
+};
+template <std::size_t BatchSize>
+int SumSession<BatchSize>::fNCalls = 0;
+
+ROOT::RDF::RNode MakeInputs(ROOT::RDataFrame &df)
+{
+   return df.Define("x", [](ULong64_t e) { return float(e); }, {"rdfentry_"})
+      .Define("y", [](ULong64_t e) { return 2.f * e; }, {"rdfentry_"})
+      .Define("v", [](float x, float y) { return ROOT::RVecF{x, y}; }, {"x", "y"});
+}
+
+void CheckOutputs(const std::vector<float> &outputs, std::size_t nEvents)
+{
+   ASSERT_EQ(outputs.size(), 2 * nEvents);
+   for (std::size_t i = 0; i < nEvents; i++) {
+      EXPECT_FLOAT_EQ(outputs[2 * i], 3.f * i);
+      EXPECT_FLOAT_EQ(outputs[2 * i + 1], -1.f * i);
+   }
+}
+
+TEST(SofieHelpers, BatchedScalarColumns)
+{
+   ROOT::RDataFrame df(10);
+   SumSession<4>::fNCalls = 0;
+   SofieBatchedHelper<SumSession<4>> helper(4, 2);
+   auto outputs = MakeInputs(df).Book<float, float>(std::move(helper), {"x", "y"});
+   CheckOutputs(*outputs, 10);
+   // two full batches and a padded one
+   EXPECT_EQ(SumSession<4>::fNCalls, 3);
+}
+
+TEST(SofieHelpers, BatchedRVecColumn)
+{
+   ROOT::RDataFrame df(8);
+   SumSession<4>::fNCalls = 0;
+   SofieBatchedHelper<SumSession<4>> helper(4, 2);
+   auto outputs = MakeInputs(df).Book<ROOT::RVecF>(std::move(helper), {"v"});
+   CheckOutputs(*outputs, 8);
+   EXPECT_EQ(SumSession<4>::fNCalls, 2);
+}
+
+TEST(SofieHelpers, RVecFunctor)
+{
+   ROOT::RDataFrame df(5);
+   auto outputs = MakeInputs(df)
+                     .DefineSlot("out", SofieRVecFunctor<SumSession<1>>(), {"v"})
+                     .Take<std::vector<float>>("out");
+   std::vector<float> flat;
+   for (auto &y : *outputs)
+      flat.insert(flat.end(), y.begin(), y.end());
+   CheckOutputs(flat, 5);
+}
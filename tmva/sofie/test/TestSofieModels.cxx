@@ -16,14 +16,20 @@
 bool verbose = true;
 int sessionId = 0;
 
-void ExecuteSofieParser(std::string modelName) {
+// generate the code of the model, with the given name if different from the ONNX one
+void ExecuteSofieParser(std::string modelName, std::string codeName = "",
+                        TMVA::Experimental::SOFIE::Options options = TMVA::Experimental::SOFIE::Options::kDefault) {
    using namespace TMVA::Experimental;
    SOFIE::RModelParser_ONNX parser;
    std::string inputName = modelName + ".onnx";
    std::cout << "parsing file " << inputName << std::endl;
    SOFIE::RModel model = parser.Parse(inputName);
+   if (!codeName.empty()) {
+      model.SetFilename(codeName);
+      modelName = codeName;
+   }
    std::cout << "generating model.....\n";
-   model.Generate();
+   model.Generate(options);
    std::string outputName = modelName + ".hxx";
    std::cout << "writing model as header .....\n";
    model.OutputGenerated(); // outputName);
@@ -55,7 +61,7 @@ std::vector<float> RunInference(float * x, int sId) {
    return *result;
 }
 
-void TestLinear(int nbatches, bool useBN = false, int inputSize = 10, int nlayers = 4)
+void TestLinear(int nbatches, bool useBN = false, int inputSize = 10, int nlayers = 4, bool intraOpParallel = false)
 {
    std::string modelName = "LinearModel";
    if (useBN) modelName += "_BN";
@@ -73,9 +79,22 @@ void TestLinear(int nbatches, bool useBN = false, int inputSize = 10, int nlayer
    printf("executing %s\n", command.c_str());
    gSystem->Exec(command.c_str());
 
-   ExecuteSofieParser(modelName);
-
-   int id = DeclareCode(modelName);
+   int id = 0;
+   if (intraOpParallel) {
+      std::string codeName = modelName + "_MT";
+      ExecuteSofieParser(modelName, codeName, TMVA::Experimental::SOFIE::Options::kIntraOpParallel);
+      id = DeclareCode(codeName);
+      // run the operator tasks in separate threads
+      gInterpreter->Declare("#include <thread>");
+      gROOT->ProcessLine(TString::Format(
+         "s%d.SetParallelFor([](unsigned int n, const std::function<void(unsigned int)> &task) {"
+         "   std::vector<std::thread> threads;"
+         "   for (unsigned int i = 0; i < n; i++) threads.emplace_back(task, i);"
+         "   for (auto &t : threads) t.join(); });", id));
+   } else {
+      ExecuteSofieParser(modelName);
+      id = DeclareCode(modelName);
+   }
 
    // input data
    std::vector<float> xinput(nbatches * inputSize);
@@ -353,6 +372,11 @@ TEST(SOFIE, Linear_B4)
    // test batch =4 (equal output size)
    TestLinear(4);
 }
+TEST(SOFIE, Linear_B4_IntraOpParallel)
+{
+   // split the Gemm of the wider layers in tasks run in parallel
+   TestLinear(4, false, 10, 4, true);
+}
 TEST(SOFIE,Conv2d_B1) {
    TestConv("2d", 1);
 }
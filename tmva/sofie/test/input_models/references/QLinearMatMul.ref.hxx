@@ -0,0 +1,5 @@
+namespace QLinearMatMul_ExpectedOutput{
+	float outputs[] = {
+        1.25, 1.375, 1.5, 0.4375
+	};
+} // namespace QLinearMatMul_ExpectedOutput
@@ -0,0 +1,35 @@
+#include "TMVA/RModelParser_ONNX.hxx"
+#include "TMVA/ROperator_QLinearMatMul.hxx"
+#include "onnx_proto3.pb.h"
+
+namespace TMVA {
+namespace Experimental {
+namespace SOFIE {
+
+ParserFuncSignature ParseQLinearMatMul = [](RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto) {
+   if (nodeproto.input_size() != 8) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser QLinearMatMul op needs 8 input tensors");
+   }
+   for (int i = 0; i < 8; i++) {
+      if (!parser.IsRegisteredTensorType(nodeproto.input(i))) {
+         throw std::runtime_error("TMVA::SOFIE ONNX Parser QLinearMatMul op has input tensor " + nodeproto.input(i) +
+                                  " but its type is not yet registered");
+      }
+   }
+
+   std::string output_name = nodeproto.output(0);
+   std::unique_ptr<ROperator> op(new ROperator_QLinearMatMul(nodeproto.input(0), nodeproto.input(1), nodeproto.input(2),
+                                                             nodeproto.input(3), nodeproto.input(4), nodeproto.input(5),
+                                                             nodeproto.input(6), nodeproto.input(7), output_name));
+
+   // the output has the type of its zero point
+   if (!parser.IsRegisteredTensorType(output_name)) {
+      parser.RegisterTensorType(output_name, parser.GetTensorType(nodeproto.input(7)));
+   }
+
+   return op;
+};
+
+} // namespace SOFIE
+} // namespace Experimental
+} // namespace TMVA
@@ -0,0 +1,58 @@
+#include "TMVA/RModelParser_ONNX.hxx"
+#include "TMVA/ROperator_QuantizeLinear.hxx"
+#include "onnx_proto3.pb.h"
+
+namespace TMVA {
+namespace Experimental {
+namespace SOFIE {
+
+template <EQuantizeLinearOperator Op>
+std::unique_ptr<ROperator> ParseQuantizeLinearOperator(RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto)
+{
+   const std::string opName = (Op == QuantizeLinear) ? "QuantizeLinear" : "DequantizeLinear";
+   auto input_name = nodeproto.input(0);
+   if (!parser.IsRegisteredTensorType(input_name)) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser " + opName + " op has input tensor " + input_name +
+                               " but its type is not yet registered");
+   }
+   if (nodeproto.input_size() < 2) {
+      throw std::runtime_error("TMVA::SOFIE ONNX Parser " + opName + " op has no scale input tensor");
+   }
+
+   int attr_axis = 1;
+   for (int_t i = 0; i < nodeproto.attribute_size(); i++) {
+      std::string attribute_name = nodeproto.attribute(i).name();
+      if (attribute_name == "axis")
+         attr_axis = nodeproto.attribute(i).i();
+   }
+
+   // the zero point is optional: without it the quantized type is uint8
+   std::string zero_point_name = (nodeproto.input_size() > 2) ? nodeproto.input(2) : "";
+   ETensorType quantized_type = ETensorType::UNINT8;
+   if (!zero_point_name.empty() && parser.IsRegisteredTensorType(zero_point_name))
+      quantized_type = parser.GetTensorType(zero_point_name);
+
+   std::string output_name = nodeproto.output(0);
+   std::unique_ptr<ROperator> op(
+      new ROperator_QuantizeLinear<Op>(input_name, nodeproto.input(1), zero_point_name, output_name, attr_axis));
+
+   if (!parser.IsRegisteredTensorType(output_name)) {
+      parser.RegisterTensorType(output_name, (Op == QuantizeLinear) ? quantized_type : ETensorType::FLOAT);
+   }
+
+   return op;
+}
+
+// Parse QuantizeLinear
+ParserFuncSignature ParseQuantizeLinear = [](RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto) {
+   return ParseQuantizeLinearOperator<EQuantizeLinearOperator::QuantizeLinear>(parser, nodeproto);
+};
+
+// Parse DequantizeLinear
+ParserFuncSignature ParseDequantizeLinear = [](RModelParser_ONNX &parser, const onnx::NodeProto &nodeproto) {
+   return ParseQuantizeLinearOperator<EQuantizeLinearOperator::DequantizeLinear>(parser, nodeproto);
+};
+
+} // namespace SOFIE
+} // namespace Experimental
+} // namespace TMVA
@@ -63,6 +63,9 @@ extern ParserFuncSignature ParseMatMul;
 extern ParserFuncSignature ParseLayerNormalization;
 extern ParserFuncSignature ParseGather;
 extern ParserFuncSignature ParseErf;
+extern ParserFuncSignature ParseQuantizeLinear;
+extern ParserFuncSignature ParseDequantizeLinear;
+extern ParserFuncSignature ParseQLinearMatMul;
 // Decalaration of fused operators
 extern ParserFuseFuncSignature ParseFuseConvAdd;
 extern ParserFuseFuncSignature ParseFuseConvTransposeAdd;
@@ -132,6 +135,9 @@ RModelParser_ONNX::RModelParser_ONNX() noexcept : fOperatorsMapImpl(std::make_un
    RegisterOperator("Expand", ParseExpand);
    RegisterOperator("Gather", ParseGather);
    RegisterOperator("Erf", ParseErf);
+   RegisterOperator("QuantizeLinear", ParseQuantizeLinear);
+   RegisterOperator("DequantizeLinear", ParseDequantizeLinear);
+   RegisterOperator("QLinearMatMul", ParseQLinearMatMul);
 }
 
 // Destructor of the parser
@@ -285,7 +291,8 @@ RModel RModelParser_ONNX::Parse(std::string filename, bool verbose)
       std::string input_name = valueinfoproto.name();
 
       ETensorType type = static_cast<ETensorType>(valueinfoproto.type().tensor_type().elem_type());
-      if (type != ETensorType::FLOAT && type != ETensorType::INT32 && type != ETensorType::INT64) {
+      if (type != ETensorType::FLOAT && type != ETensorType::INT32 && type != ETensorType::INT64 &&
+          type != ETensorType::INT8 && type != ETensorType::UNINT8) {
          throw std::runtime_error("TMVA::SOFIE Data type in input tensor " + input_name + " not supported!\n");
       }
 
@@ -349,6 +356,10 @@ RModel RModelParser_ONNX::Parse(std::string filename, bool verbose)
          std::cout << "\t initializer " << i << " name " << input_name << " type " << graph.initializer(i).data_type()
                    << std::endl;
 
+      // register the type also for initializers not listed in the graph inputs
+      if (!IsRegisteredTensorType(input_name))
+         RegisterTensorType(input_name, static_cast<ETensorType>(graph.initializer(i).data_type()));
+
       switch (static_cast<ETensorType>(graph.initializer(i).data_type())) {
       case ETensorType::FLOAT: {
          std::shared_ptr<void> data(malloc(fLength * sizeof(float)), free);
@@ -382,6 +393,30 @@ RModel RModelParser_ONNX::Parse(std::string filename, bool verbose)
          allInitializedTensors[input_name] = i;
          break;
       }
+      case ETensorType::INT8:
+      case ETensorType::UNINT8: {
+         // quantized tensors: 8 bit integers are stored in int32_data when they are not given as raw data
+         ETensorType type = static_cast<ETensorType>(tensorproto->data_type());
+         std::shared_ptr<void> data(malloc(fLength), free);
+
+         if (tensorproto->raw_data().empty() == false) {
+            std::memcpy(data.get(), tensorproto->raw_data().c_str(), fLength);
+         } else {
+            if (static_cast<size_t>(tensorproto->int32_data_size()) != fLength)
+               throw std::runtime_error("TMVA::SOFIE - Wrong number of values in quantized tensor " + input_name);
+            for (size_t j = 0; j < fLength; j++) {
+               if (type == ETensorType::INT8)
+                  static_cast<int8_t *>(data.get())[j] = static_cast<int8_t>(tensorproto->int32_data(j));
+               else
+                  static_cast<uint8_t *>(data.get())[j] = static_cast<uint8_t>(tensorproto->int32_data(j));
+            }
+         }
+
+         if (verbose) std::cout << "add " << ConvertTypeToString(type) << " initialized tensor " << input_name << " shape " << ConvertShapeToString(shape) << std::endl;
+         rmodel.AddInitializedTensor(input_name, type, shape, data);
+         allInitializedTensors[input_name] = i;
+         break;
+      }
       default:
          throw std::runtime_error("Data type in weight tensor " + graph.initializer(i).name() + " not supported!\n");
       }
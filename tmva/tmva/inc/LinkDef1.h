@@ -75,5 +75,6 @@
 // BDT inference
 #pragma link C++ class TMVA::Experimental::RBDT<TMVA::Experimental::BranchlessForest<float>>;
 #pragma link C++ class TMVA::Experimental::RBDT<TMVA::Experimental::BranchlessJittedForest<float>>;
+#pragma link C++ class TMVA::Experimental::RBDT<TMVA::Experimental::IfElseJittedForest<float>>;
 #endif
 #endif
@@ -0,0 +1,80 @@
+/**********************************************************************************
+ * Project: TMVA - a Root-integrated toolkit for multivariate data analysis       *
+ * Package: TMVA                                                                  *
+ * Class  : BinnedEventSample                                                     *
+ * Web    : http://tmva.sourceforge.net                                           *
+ *                                                                                *
+ * Description:                                                                   *
+ *      Training sample with pre-binned input variables, used for the             *
+ *      histogram based node splitting of the decision trees                      *
+ *                                                                                *
+ * Copyright (c) 2026:                                                            *
+ *      CERN, Switzerland                                                         *
+ *                                                                                *
+ * Redistribution and use in source and binary forms, with or without             *
+ * modification, are permitted according to the terms listed in LICENSE           *
+ * (http://tmva.sourceforge.net/LICENSE)                                          *
+ **********************************************************************************/
+
+#ifndef ROOT_TMVA_BinnedEventSample
+#define ROOT_TMVA_BinnedEventSample
+
+#include "RtypesCore.h"
+
+#include <vector>
+
+namespace TMVA {
+
+   class Event;
+
+   class BinnedEventSample {
+
+   public:
+
+      // Sums of the weights and targets of the events of a tree node in the bins of all the variables
+      class Histogram {
+      public:
+         enum EQuantity { kSigWeight = 0, kBkgWeight, kSig, kBkg, kTarget, kTarget2, kNQuantities };
+
+         Histogram() = default;
+         Histogram( UInt_t nvars, UInt_t nbins ) : fNBins(nbins), fContent(nvars * nbins * kNQuantities, 0.) {}
+
+         Double_t *GetBin( UInt_t ivar, UInt_t ibin ) { return &fContent[(ivar * fNBins + ibin) * kNQuantities]; }
+         const Double_t *GetBin( UInt_t ivar, UInt_t ibin ) const { return &fContent[(ivar * fNBins + ibin) * kNQuantities]; }
+
+         Histogram &operator+=( const Histogram &other );
+         Histogram &operator-=( const Histogram &other );
+
+      private:
+         UInt_t fNBins = 0;               ///< maximum number of bins of the variables
+         std::vector<Double_t> fContent;  ///< quantities of each bin, [ivar][ibin][quantity]
+      };
+
+      // bin the variables of the events in at most maxBins bins (<= 256) with the same number of events
+      BinnedEventSample( const std::vector<const Event*> &eventSample, UInt_t nvars, UInt_t maxBins );
+
+      UInt_t GetNVars() const { return fNvars; }
+      UInt_t GetMaxBins() const { return fMaxBins; }
+      UInt_t GetNBins( UInt_t ivar ) const { return fCutValues[ivar].size() + 1; }
+
+      // lower edge of the bin icut+1, events with a value >= cut value are above the cut
+      Float_t GetCutValue( UInt_t ivar, UInt_t icut ) const { return fCutValues[ivar][icut]; }
+
+      // bins of all the variables of an event of the sample, nullptr for an unknown event
+      const UChar_t *GetBins( const Event *event ) const;
+
+      // fill the histogram of the given events, in parallel with the TMVA thread pool
+      Histogram Fill( const std::vector<const Event*> &eventSample, UInt_t sigClass, Bool_t regression ) const;
+
+   private:
+
+      UInt_t fNvars;                                ///< number of variables
+      UInt_t fMaxBins;                              ///< maximum number of bins of the variables
+      std::vector<std::vector<Float_t>> fCutValues; ///< bin edges of each variable, bin i holds the values in [cut[i-1], cut[i])
+      std::vector<const Event*> fEvents;            ///< events of the sample ordered by address, to find their bins
+      std::vector<UChar_t> fBins;                   ///< bins of the variables of the events, [ievt][ivar]
+   };
+
+} // namespace TMVA
+
+#endif
@@ -42,6 +42,7 @@
 
 #include "TH2.h"
 #include <vector>
+#include <map>
 
 #include "TMVA/Types.h"
 #include "TMVA/DecisionTreeNode.h"
@@ -50,6 +51,7 @@
 #include "TMVA/SeparationBase.h"
 #include "TMVA/RegressionVariance.h"
 #include "TMVA/DataSetInfo.h"
+#include "TMVA/BinnedEventSample.h"
 
 #ifdef R__USE_IMT
 #include <ROOT/TThreadExecutor.hxx>
@@ -108,6 +110,7 @@ namespace TMVA {
       Double_t TrainNode( const EventConstList & eventSample,  DecisionTreeNode *node ) { return TrainNodeFast( eventSample, node ); }
       Double_t TrainNodeFast( const EventConstList & eventSample,  DecisionTreeNode *node );
       Double_t TrainNodeFull( const EventConstList & eventSample,  DecisionTreeNode *node );
+      Double_t TrainNodeHistogram( const EventConstList & eventSample,  DecisionTreeNode *node );
       void    GetRandomisedVariables(Bool_t *useVariable, UInt_t *variableMap, UInt_t & nVars);
       std::vector<Double_t>  GetFisherCoefficients(const EventConstList &eventSample, UInt_t nFisherVars, UInt_t *mapVarInFisher);
 
@@ -192,6 +195,8 @@ namespace TMVA {
       inline void SetMinLinCorrForFisher(Double_t min){fMinLinCorrForFisher = min;}
       inline void SetUseExclusiveVars(Bool_t t=kTRUE){fUseExclusiveVars = t;}
       inline void SetNVars(Int_t n){fNvars = n;}
+      // use the histogram based node splitting with the bins of the given sample (not owned by the tree)
+      inline void SetBinnedSample(const BinnedEventSample *s){fBinnedSample = s;}
 
    private:
       // utility functions
@@ -202,6 +207,11 @@ namespace TMVA {
       // calculates the purity S/(S+B) of a given event sample
       Double_t SamplePurity(EventList eventSample);
 
+      // fill the histograms of the daughter nodes of a split node, one of them from the parent histogram
+      void SplitNodeHistogram( const DecisionTreeNode *node,
+                               DecisionTreeNode *leftNode, const EventConstList &leftSample,
+                               DecisionTreeNode *rightNode, const EventConstList &rightSample );
+
       UInt_t    fNvars;               ///< number of variables used to separate S and B
       Int_t     fNCuts;               ///< number of grid point in variable cut scans
       Bool_t    fUseFisherCuts;       ///< use multivariate splits using the Fisher criterium
@@ -240,6 +250,9 @@ namespace TMVA {
 
       DataSetInfo*  fDataSetInfo;
 
+      const BinnedEventSample *fBinnedSample; ///<! pre-binned training sample for the histogram based node splitting
+      std::map<const DecisionTreeNode*, BinnedEventSample::Histogram> fNodeHistograms; ///<! histograms of the nodes still to be split
+
       ClassDef(DecisionTree,0);               // implementation of a Decision Tree
    };
 
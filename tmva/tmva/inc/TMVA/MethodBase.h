@@ -115,6 +115,7 @@ namespace TMVA {
       friend class RootFinder;
       friend class MethodBoost;
       friend class MethodCrossValidation;
+      friend class Reader;
       friend class Experimental::Classification;
 
    public:
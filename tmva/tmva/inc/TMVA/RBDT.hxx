@@ -21,12 +21,14 @@
 
 #include "TMVA/RTensor.hxx"
 #include "TMVA/TreeInference/Forest.hxx"
+#include "TMVA/Config.h"
 #include "TFile.h"
 
 #include <vector>
 #include <string>
 #include <sstream> // std::stringstream
 #include <memory>
+#include <algorithm> // std::min
 
 namespace TMVA {
 namespace Experimental {
@@ -96,22 +98,45 @@ public:
    std::vector<Value_t> Compute(const std::vector<Value_t> &x) { return this->Compute<std::vector<Value_t>>(x); }
 
    /// Compute model prediction on input RTensor
+   ///
+   /// Row major inputs with many events are split in chunks, which are computed in
+   /// parallel with the thread pool of TMVA if multi-threading is enabled.
    RTensor<Value_t> Compute(const RTensor<Value_t> &x)
    {
       const auto rows = x.GetShape()[0];
       RTensor<Value_t> y({rows, static_cast<std::size_t>(fNumOutputs)}, MemoryLayout::ColumnMajor);
       const bool layout = x.GetMemoryLayout() == MemoryLayout::ColumnMajor ? false : true;
-      for (int i = 0; i < fNumOutputs; i++)
-         fBackends[i].Inference(x.GetData(), rows, layout, &y(0, i));
-      if (fNormalizeOutputs) {
-         Value_t s;
-         for (int i = 0; i < static_cast<int>(rows); i++) {
-            s = 0.0;
-            for (int j = 0; j < fNumOutputs; j++)
-               s += y(i, j);
-            for (int j = 0; j < fNumOutputs; j++)
-               y(i, j) /= s;
+
+      // Compute the predictions of the events [first, first + n), the chunks of a
+      // column major input cannot be addressed separately
+      auto computeChunk = [&](std::size_t first, std::size_t n) {
+         const auto inputs = layout ? x.GetData() + first * x.GetShape()[1] : x.GetData();
+         for (int i = 0; i < fNumOutputs; i++)
+            fBackends[i].Inference(inputs, static_cast<int>(n), layout, &y(first, i));
+         if (fNormalizeOutputs) {
+            Value_t s;
+            for (std::size_t i = first; i < first + n; i++) {
+               s = 0.0;
+               for (int j = 0; j < fNumOutputs; j++)
+                  s += y(i, j);
+               for (int j = 0; j < fNumOutputs; j++)
+                  y(i, j) /= s;
+            }
          }
+      };
+
+      auto &executor = TMVA::Config::Instance().GetThreadExecutor();
+      const std::size_t chunkSize = 4096;
+      if (layout && rows > chunkSize && executor.GetPoolSize() > 1) {
+         const std::size_t numChunks = (rows + chunkSize - 1) / chunkSize;
+         executor.Foreach(
+            [&](unsigned int chunk) {
+               const std::size_t first = chunk * chunkSize;
+               computeChunk(first, std::min(chunkSize, rows - first));
+            },
+            ROOT::TSeqU(numChunks));
+      } else {
+         computeChunk(0, rows);
       }
       return y;
    }
@@ -119,6 +144,7 @@ public:
 
 extern template class TMVA::Experimental::RBDT<TMVA::Experimental::BranchlessForest<float>>;
 extern template class TMVA::Experimental::RBDT<TMVA::Experimental::BranchlessJittedForest<float>>;
+extern template class TMVA::Experimental::RBDT<TMVA::Experimental::IfElseJittedForest<float>>;
 
 } // namespace Experimental
 } // namespace TMVA
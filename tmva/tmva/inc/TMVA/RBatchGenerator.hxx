@@ -7,12 +7,17 @@
 #include <memory>
 #include <cmath>
 #include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <map>
 
 #include "TMVA/RTensor.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
 #include "TMVA/RChunkLoader.hxx"
 #include "TMVA/RBatchLoader.hxx"
 #include "TMVA/Tools.h"
+#include "TChain.h"
 #include "TRandom3.h"
 #include "TROOT.h"
 
@@ -25,7 +30,7 @@ class RBatchGenerator {
 private:
    TMVA::RandomGenerator<TRandom3> fRng = TMVA::RandomGenerator<TRandom3>(0);
 
-   std::string fFileName;
+   std::vector<std::string> fFileNames;
    std::string fTreeName;
 
    std::vector<std::string> fCols;
@@ -38,24 +43,40 @@ private:
    std::size_t fNumColumns;
    std::size_t fNumEntries;
    std::size_t fCurrentRow = 0;
+   std::size_t fNumLoadingThreads;
+   std::atomic<std::size_t> fNextChunk{0};
+   std::atomic<std::size_t> fNumActiveLoaders{0};
 
    float fValidationSplit;
 
    std::unique_ptr<TMVA::Experimental::Internal::RChunkLoader<Args...>> fChunkLoader;
    std::unique_ptr<TMVA::Experimental::Internal::RBatchLoader> fBatchLoader;
 
-   std::unique_ptr<std::thread> fLoadingThread;
+   std::vector<std::thread> fLoadingThreads;
 
    bool fUseWholeFile = true;
 
-   std::unique_ptr<TMVA::Experimental::RTensor<float>> fChunkTensor;
+   // one chunk tensor for each loading thread
+   std::vector<std::unique_ptr<TMVA::Experimental::RTensor<float>>> fChunkTensors;
    std::unique_ptr<TMVA::Experimental::RTensor<float>> fCurrentBatch;
 
-   std::vector<std::vector<std::size_t>> fTrainingIdxs;
-   std::vector<std::vector<std::size_t>> fValidationIdxs;
+   // training and validation events of each chunk, created in the first epoch
+   std::map<std::size_t, std::vector<std::size_t>> fTrainingIdxs;
+   std::map<std::size_t, std::vector<std::size_t>> fValidationIdxs;
+   std::mutex fIdxsLock;
 
    // filled batch elements
    std::mutex fIsActiveLock;
+   // the chunks are batched in order, see LoadChunks; guarded by fIsActiveLock
+   std::condition_variable fChunkOrderCondition;
+   std::size_t fNextBatchedChunk = 0;
+
+   // loading statistics
+   std::mutex fStatsLock;
+   std::size_t fNumLoadedEvents = 0;
+   double fLoadingTime = 0; // in seconds, wall time of the finished epochs
+   bool fIsLoading = false;
+   std::chrono::steady_clock::time_point fLoadingStart;
 
    bool fShuffle = true;
    bool fIsActive = false;
@@ -64,64 +85,86 @@ private:
    float fVecPadding;
 
 public:
-   RBatchGenerator(const std::string &treeName, const std::string &fileName, const std::size_t chunkSize,
+   /// \brief Constructor of the RBatchGenerator
+   /// The tree is read from all the given files (or glob patterns) as a chain. Chunks are loaded by
+   /// numLoadingThreads threads in parallel when no filters are given: with filters the first entry of a chunk
+   /// depends on the previous one, and a single loading thread is used.
+   /// The batches are queued in the order of the chunks whatever the number of loading threads, so that
+   /// without shuffling the batches always come in the order of the entries.
+   RBatchGenerator(const std::string &treeName, const std::vector<std::string> &fileNames, const std::size_t chunkSize,
                    const std::size_t batchSize, const std::vector<std::string> &cols,
                    const std::vector<std::string> &filters = {}, const std::vector<std::size_t> &vecSizes = {},
                    const float vecPadding = 0.0, const float validationSplit = 0.0, const std::size_t maxChunks = 0,
-                   const std::size_t numColumns = 0, bool shuffle = true)
-      : fTreeName(treeName),
-        fFileName(fileName),
-        fChunkSize(chunkSize),
-        fBatchSize(batchSize),
+                   const std::size_t numColumns = 0, bool shuffle = true, const std::size_t numLoadingThreads = 1)
+      : fFileNames(fileNames),
+        fTreeName(treeName),
         fCols(cols),
         fFilters(filters),
-        fVecSizes(vecSizes),
-        fVecPadding(vecPadding),
-        fValidationSplit(validationSplit),
+        fChunkSize(chunkSize),
         fMaxChunks(maxChunks),
+        fBatchSize(batchSize),
         fNumColumns((numColumns != 0) ? numColumns : cols.size()),
+        fNumLoadingThreads((filters.empty() && numLoadingThreads > 1) ? numLoadingThreads : 1),
+        fValidationSplit(validationSplit),
+        fUseWholeFile(maxChunks == 0),
         fShuffle(shuffle),
-        fUseWholeFile(maxChunks == 0)
+        fVecSizes(vecSizes),
+        fVecPadding(vecPadding)
    {
       // limits the number of batches that can be contained in the batchqueue based on the chunksize
       fMaxBatches = ceil((fChunkSize / fBatchSize) * (1 - fValidationSplit));
 
-      // get the number of fNumEntries in the dataframe
-      std::unique_ptr<TFile> f{TFile::Open(fFileName.c_str())};
-      std::unique_ptr<TTree> t{f->Get<TTree>(fTreeName.c_str())};
-      fNumEntries = t->GetEntries();
+      // get the number of fNumEntries in all the files
+      TChain chain(fTreeName.c_str());
+      for (auto &fileName : fFileNames)
+         chain.Add(fileName.c_str());
+      fNumEntries = chain.GetEntries();
 
       fChunkLoader = std::make_unique<TMVA::Experimental::Internal::RChunkLoader<Args...>>(
-         fTreeName, fFileName, fChunkSize, fCols, fFilters, fVecSizes, fVecPadding);
+         fTreeName, fFileNames, fChunkSize, fCols, fFilters, fVecSizes, fVecPadding);
       fBatchLoader = std::make_unique<TMVA::Experimental::Internal::RBatchLoader>(fBatchSize, fNumColumns, fMaxBatches);
 
-      // Create tensor to load the chunk into
-      fChunkTensor =
-         std::make_unique<TMVA::Experimental::RTensor<float>>((std::vector<std::size_t>){fChunkSize, fNumColumns});
+      // Create the tensors to load the chunks into
+      for (std::size_t i = 0; i < fNumLoadingThreads; i++) {
+         fChunkTensors.emplace_back(
+            std::make_unique<TMVA::Experimental::RTensor<float>>((std::vector<std::size_t>){fChunkSize, fNumColumns}));
+      }
+   }
+
+   RBatchGenerator(const std::string &treeName, const std::string &fileName, const std::size_t chunkSize,
+                   const std::size_t batchSize, const std::vector<std::string> &cols,
+                   const std::vector<std::string> &filters = {}, const std::vector<std::size_t> &vecSizes = {},
+                   const float vecPadding = 0.0, const float validationSplit = 0.0, const std::size_t maxChunks = 0,
+                   const std::size_t numColumns = 0, bool shuffle = true, const std::size_t numLoadingThreads = 1)
+      : RBatchGenerator(treeName, std::vector<std::string>{fileName}, chunkSize, batchSize, cols, filters, vecSizes,
+                        vecPadding, validationSplit, maxChunks, numColumns, shuffle, numLoadingThreads)
+   {
    }
 
    ~RBatchGenerator() { DeActivate(); }
 
    /// \brief De-activate the loading process by deactivating the batchgenerator
-   /// and joining the loading thread
+   /// and joining the loading threads
    void DeActivate()
    {
       {
          std::lock_guard<std::mutex> lock(fIsActiveLock);
          fIsActive = false;
       }
+      fChunkOrderCondition.notify_all();
 
       fBatchLoader->DeActivate();
 
-      if (fLoadingThread) {
-         if (fLoadingThread->joinable()) {
-            fLoadingThread->join();
+      for (auto &thread : fLoadingThreads) {
+         if (thread.joinable()) {
+            thread.join();
          }
       }
+      fLoadingThreads.clear();
    }
 
    /// \brief Activate the loading process by starting the batchloader, and
-   /// spawning the loading thread.
+   /// spawning the loading threads.
    void Activate()
    {
       if (fIsActive)
@@ -130,11 +173,21 @@ public:
       {
          std::lock_guard<std::mutex> lock(fIsActiveLock);
          fIsActive = true;
+         fNextBatchedChunk = 0;
+      }
+      {
+         std::lock_guard<std::mutex> lock(fStatsLock);
+         fIsLoading = true;
+         fLoadingStart = std::chrono::steady_clock::now();
       }
 
       fCurrentRow = 0;
+      fNextChunk = 0;
+      fNumActiveLoaders = fNumLoadingThreads;
       fBatchLoader->Activate();
-      fLoadingThread = std::make_unique<std::thread>(&RBatchGenerator::LoadChunks, this);
+      for (std::size_t i = 0; i < fNumLoadingThreads; i++) {
+         fLoadingThreads.emplace_back(&RBatchGenerator::LoadChunks, this, i);
+      }
    }
 
    /// \brief Returns the next batch of training data if available.
@@ -159,25 +212,86 @@ public:
 
    bool HasValidationData() { return fBatchLoader->HasValidationData(); }
 
-   void LoadChunks()
+   /// \brief Number of events loaded from the files, in all epochs
+   std::size_t GetNumLoadedEvents()
+   {
+      std::lock_guard<std::mutex> lock(fStatsLock);
+      return fNumLoadedEvents;
+   }
+
+   /// \brief Loading throughput, in events per second of wall time while the loading threads were running.
+   /// To be compared with the consumer rate: if GetConsumerWaitTime is large the consumer is
+   /// starved, and more loading threads or larger chunks can help.
+   double GetLoadingThroughput()
+   {
+      std::lock_guard<std::mutex> lock(fStatsLock);
+      double loadingTime = fLoadingTime;
+      if (fIsLoading)
+         loadingTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - fLoadingStart).count();
+      return (loadingTime > 0) ? fNumLoadedEvents / loadingTime : 0.;
+   }
+
+   /// \brief Total time, in seconds, spent by the consumer waiting for a training batch
+   double GetConsumerWaitTime() { return fBatchLoader->GetConsumerWaitTime(); }
+
+   /// \brief Number of training batches returned to the consumer, in all epochs
+   std::size_t GetNumConsumedBatches() { return fBatchLoader->GetNumConsumedBatches(); }
+
+   std::size_t GetNumLoadingThreads() const { return fNumLoadingThreads; }
+
+   /// \brief Load chunks in the tensor of the given loading thread, and split them in batches.
+   /// The loading threads take the next chunk to be loaded from the shared chunk counter. The chunks are read
+   /// in parallel, but a chunk is only split in batches after the previous one, which keeps the order of the
+   /// batches, and of the shuffling random numbers, independent of the number of loading threads.
+   /// \param threadIdx
+   void LoadChunks(std::size_t threadIdx)
    {
       ROOT::EnableThreadSafety();
 
-      for (std::size_t current_chunk = 0; ((current_chunk < fMaxChunks) || fUseWholeFile) && fCurrentRow < fNumEntries;
-           current_chunk++) {
+      auto &chunkTensor = *fChunkTensors[threadIdx];
 
+      while (true) {
          // stop the loop when the loading is not active anymore
          {
             std::lock_guard<std::mutex> lock(fIsActiveLock);
             if (!fIsActive)
-               return;
+               break;
          }
 
+         std::size_t currentChunk = fNextChunk++;
+         if (!fUseWholeFile && currentChunk >= fMaxChunks)
+            break;
+
+         // without filters the chunks start at fixed rows, and they can be loaded in parallel
+         std::size_t startRow = fFilters.empty() ? currentChunk * fChunkSize : fCurrentRow;
+         if (startRow >= fNumEntries)
+            break;
+
          // A pair that consists the proccessed, and passed events while loading the chunk
-         std::pair<std::size_t, std::size_t> report = fChunkLoader->LoadChunk(*fChunkTensor, fCurrentRow);
-         fCurrentRow += report.first;
+         std::pair<std::size_t, std::size_t> report = fChunkLoader->LoadChunk(chunkTensor, startRow);
+         if (!fFilters.empty())
+            fCurrentRow += report.first;
+
+         // wait until the previous chunks are batched
+         {
+            std::unique_lock<std::mutex> lock(fIsActiveLock);
+            fChunkOrderCondition.wait(lock, [&]() { return fNextBatchedChunk == currentChunk || !fIsActive; });
+            if (!fIsActive)
+               break;
+         }
+
+         CreateBatches(currentChunk, chunkTensor, report.second);
+
+         {
+            std::lock_guard<std::mutex> lock(fIsActiveLock);
+            fNextBatchedChunk++;
+         }
+         fChunkOrderCondition.notify_all();
 
-         CreateBatches(current_chunk, report.second);
+         {
+            std::lock_guard<std::mutex> lock(fStatsLock);
+            fNumLoadedEvents += report.second;
+         }
 
          // Stop loading if the number of processed events is smaller than the desired chunk size
          if (report.first < fChunkSize) {
@@ -185,29 +299,50 @@ public:
          }
       }
 
-      fBatchLoader->DeActivate();
+      // the last loading thread stops the batch loader
+      if (--fNumActiveLoaders == 0) {
+         {
+            std::lock_guard<std::mutex> lock(fStatsLock);
+            fLoadingTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - fLoadingStart).count();
+            fIsLoading = false;
+         }
+         fBatchLoader->DeActivate();
+      }
    }
 
    /// \brief Create batches for the current_chunk.
    /// \param currentChunk
+   /// \param chunkTensor
    /// \param processedEvents
-   void CreateBatches(std::size_t currentChunk, std::size_t processedEvents)
+   void CreateBatches(std::size_t currentChunk, const TMVA::Experimental::RTensor<float> &chunkTensor,
+                      std::size_t processedEvents)
    {
+      std::vector<std::size_t> trainingIdxs;
+      std::vector<std::size_t> validationIdxs;
+      bool isFirstEpoch = false;
 
       // Check if the indices in this chunk where already split in train and validations
-      if (fTrainingIdxs.size() > currentChunk) {
-         fBatchLoader->CreateTrainingBatches(*fChunkTensor, fTrainingIdxs[currentChunk], fShuffle);
-      } else {
-         // Create the Validation batches if this is not the first epoch
-         createIdxs(processedEvents);
-         fBatchLoader->CreateTrainingBatches(*fChunkTensor, fTrainingIdxs[currentChunk], fShuffle);
-         fBatchLoader->CreateValidationBatches(*fChunkTensor, fValidationIdxs[currentChunk]);
+      {
+         std::lock_guard<std::mutex> lock(fIdxsLock);
+         if (fTrainingIdxs.find(currentChunk) == fTrainingIdxs.end()) {
+            createIdxs(currentChunk, processedEvents);
+            isFirstEpoch = true;
+            validationIdxs = fValidationIdxs[currentChunk];
+         }
+         trainingIdxs = fTrainingIdxs[currentChunk];
       }
+
+      fBatchLoader->CreateTrainingBatches(chunkTensor, trainingIdxs, fShuffle);
+      // Create the Validation batches only in the first epoch
+      if (isFirstEpoch)
+         fBatchLoader->CreateValidationBatches(chunkTensor, validationIdxs);
    }
 
    /// \brief plit the events of the current chunk into validation and training events
+   /// Must be called with fIdxsLock held
+   /// \param currentChunk
    /// \param processedEvents
-   void createIdxs(std::size_t processedEvents)
+   void createIdxs(std::size_t currentChunk, std::size_t processedEvents)
    {
       // Create a vector of number 1..processedEvents
       std::vector<std::size_t> row_order = std::vector<std::size_t>(processedEvents);
@@ -224,8 +359,8 @@ public:
       std::vector<std::size_t> valid_idx({row_order.begin(), row_order.begin() + num_validation});
       std::vector<std::size_t> train_idx({row_order.begin() + num_validation, row_order.end()});
 
-      fTrainingIdxs.push_back(train_idx);
-      fValidationIdxs.push_back(valid_idx);
+      fTrainingIdxs[currentChunk] = train_idx;
+      fValidationIdxs[currentChunk] = valid_idx;
    }
 
    void StartValidation() { fBatchLoader->StartValidation(); }
@@ -4,6 +4,7 @@
 #include <iostream>
 #include <vector>
 #include <memory>
+#include <chrono>
 
 // Imports for threading
 #include <queue>
@@ -26,6 +27,7 @@ private:
 
    bool fIsActive = false;
    TMVA::RandomGenerator<TRandom3> fRng = TMVA::RandomGenerator<TRandom3>(0);
+   std::mutex fRngLock; // batches can be created concurrently by several loading threads
 
    std::mutex fBatchLock;
    std::condition_variable fBatchCondition;
@@ -36,6 +38,10 @@ private:
 
    std::size_t fValidationIdx = 0;
 
+   // consumer statistics, to be compared with the loading rate
+   std::size_t fNumConsumedBatches = 0;
+   double fConsumerWaitTime = 0; // in seconds
+
    TMVA::Experimental::RTensor<float> fEmptyTensor = TMVA::Experimental::RTensor<float>({0});
 
 public:
@@ -52,8 +58,10 @@ public:
    /// \return Training batch
    const TMVA::Experimental::RTensor<float> &GetTrainBatch()
    {
+      auto start = std::chrono::steady_clock::now();
       std::unique_lock<std::mutex> lock(fBatchLock);
       fBatchCondition.wait(lock, [this]() { return !fTrainingBatchQueue.empty() || !fIsActive; });
+      fConsumerWaitTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
 
       if (fTrainingBatchQueue.empty()) {
          fCurrentBatch = std::make_unique<TMVA::Experimental::RTensor<float>>(std::vector<std::size_t>({0}));
@@ -62,6 +70,7 @@ public:
 
       fCurrentBatch = std::move(fTrainingBatchQueue.front());
       fTrainingBatchQueue.pop();
+      fNumConsumedBatches++;
 
       fBatchCondition.notify_all();
 
@@ -102,6 +111,21 @@ public:
       return fValidationIdx < fValidationBatches.size();
    }
 
+   /// \brief Number of training batches returned by GetTrainBatch
+   std::size_t GetNumConsumedBatches()
+   {
+      std::lock_guard<std::mutex> lock(fBatchLock);
+      return fNumConsumedBatches;
+   }
+
+   /// \brief Total time, in seconds, spent in GetTrainBatch waiting for a batch to be loaded.
+   /// A large value means that the consumer is faster than the loading.
+   double GetConsumerWaitTime()
+   {
+      std::lock_guard<std::mutex> lock(fBatchLock);
+      return fConsumerWaitTime;
+   }
+
    /// \brief Activate the batchloader so it will accept chunks to batch
    void Activate()
    {
@@ -159,8 +183,10 @@ public:
             return;
       }
 
-      if (shuffle)
+      if (shuffle) {
+         std::lock_guard<std::mutex> lock(fRngLock);
          std::shuffle(eventIndices.begin(), eventIndices.end(), fRng); // Shuffle the order of idx
+      }
 
       std::vector<std::unique_ptr<TMVA::Experimental::RTensor<float>>> batches;
 
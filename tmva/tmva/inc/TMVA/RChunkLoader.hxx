@@ -115,7 +115,7 @@ class RChunkLoader {
 
 private:
    std::string fTreeName;
-   std::string fFileName;
+   std::vector<std::string> fFileNames;
    std::size_t fChunkSize;
    std::size_t fNumColumns;
 
@@ -128,17 +128,17 @@ private:
 public:
    /// \brief Constructor for the RChunkLoader
    /// \param treeName
-   /// \param fileName
+   /// \param fileNames names of the files (or glob patterns) containing the tree, read as a chain
    /// \param chunkSize
    /// \param cols
    /// \param filters
    /// \param vecSizes
    /// \param vecPadding
-   RChunkLoader(const std::string &treeName, const std::string &fileName, const std::size_t chunkSize,
+   RChunkLoader(const std::string &treeName, const std::vector<std::string> &fileNames, const std::size_t chunkSize,
                 const std::vector<std::string> &cols, const std::vector<std::string> &filters = {},
                 const std::vector<std::size_t> &vecSizes = {}, const float vecPadding = 0.0)
       : fTreeName(treeName),
-        fFileName(fileName),
+        fFileNames(fileNames),
         fChunkSize(chunkSize),
         fCols(cols),
         fFilters(filters),
@@ -148,7 +148,15 @@ public:
    {
    }
 
+   RChunkLoader(const std::string &treeName, const std::string &fileName, const std::size_t chunkSize,
+                const std::vector<std::string> &cols, const std::vector<std::string> &filters = {},
+                const std::vector<std::size_t> &vecSizes = {}, const float vecPadding = 0.0)
+      : RChunkLoader(treeName, std::vector<std::string>{fileName}, chunkSize, cols, filters, vecSizes, vecPadding)
+   {
+   }
+
    /// \brief Load a chunk of data using the RChunkLoaderFunctor
+   /// Different chunks can be loaded concurrently from different threads, each one with its own chunkTensor
    /// \param chunkTensor
    /// \param currentRow
    /// \return A pair of size_t defining the number of events processed and how many passed all filters
@@ -162,7 +170,7 @@ public:
       long long start_l = currentRow;
       ROOT::RDF::Experimental::RDatasetSpec x_spec =
          ROOT::RDF::Experimental::RDatasetSpec()
-            .AddSample({"", fTreeName, fFileName})
+            .AddSample({"", fTreeName, fFileNames})
             .WithGlobalRange({start_l, std::numeric_limits<Long64_t>::max()});
 
       ROOT::RDataFrame x_rdf(x_spec);
@@ -198,6 +198,14 @@ public:
       if (fAnalysisType == Internal::AnalysisType::Multiclass)
          y = y.Reshape({numEntries, numClasses});
 
+      // Classification: evaluate all entries as one batch with the thread-safe Reader interface
+      if (fAnalysisType == Internal::AnalysisType::Classification) {
+         const auto values = fReader->EvaluateMVA(x, name);
+         for (std::size_t i = 0; i < numEntries; i++)
+            y(i) = values[i];
+         return y;
+      }
+
       // Fill output tensor
       for (std::size_t i = 0; i < numEntries; i++) {
          for (std::size_t j = 0; j < numVars; j++) {
@@ -48,9 +48,11 @@
 #include "TMVA/DataSetInfo.h"
 #include "TMVA/DataInputHandler.h"
 #include "TMVA/DataSetManager.h"
+#include "TMVA/RTensor.hxx"
 
 #include <vector>
 #include <map>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 
@@ -93,6 +95,11 @@ namespace TMVA {
       Double_t EvaluateMVA( MethodBase* method,           Double_t aux = 0 );
       Double_t EvaluateMVA( const TString& methodTag,     Double_t aux = 0 );
 
+      // returns the MVA responses for a batch of events, the rows of a [nevents, nvariables] tensor;
+      // can be called concurrently from several threads
+      std::vector<Double_t> EvaluateMVA( const TMVA::Experimental::RTensor<Float_t>& events, const TString& methodTag,
+                                         Double_t aux = 0 ) const;
+
       // returns error on MVA response for given event
       // NOTE: must be called AFTER "EvaluateMVA(...)" call !
       Double_t GetMVAError() const { return fMvaEventError; }
@@ -162,6 +169,8 @@ namespace TMVA {
 
       std::vector<Float_t> fTmpEvalVec; ///< temporary evaluation vector (if user input is v<double>)
 
+      mutable std::mutex fBatchMutex; ///<! serialises the batch evaluations, the methods are not re-entrant
+
       mutable MsgLogger* fLogger;   ///< message logger
       MsgLogger& Log() const { return *fLogger; }
 
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <string>
 #include <sstream>
+#include <limits>
 
 namespace TMVA {
 namespace Experimental {
@@ -52,6 +53,40 @@ void RecursiveFill(int thisIndex, int lastIndex, int treeDepth, int maxTreeDepth
    }
 }
 
+/// Get the code of the subtree below the given node as nested if-else statements
+///
+/// Subtrees with identical children, e.g. the parts of a sparse tree filled by
+/// FillSparse, are collapsed so that the cut is not written in the code.
+template <typename T>
+std::string RecursiveIfElseCode(int thisIndex, int treeDepth, int maxTreeDepth, const std::vector<T> &thresholds,
+                                const std::vector<int> &inputs, const std::string &typeName, const std::string &indent)
+{
+   std::stringstream ss;
+   ss.precision(std::numeric_limits<T>::max_digits10);
+   if (treeDepth == maxTreeDepth) {
+      ss << indent << "return " << thresholds[thisIndex] << ";\n";
+      return ss.str();
+   }
+   const auto left = RecursiveIfElseCode<T>(2 * thisIndex + 1, treeDepth + 1, maxTreeDepth, thresholds, inputs,
+                                            typeName, indent + "   ");
+   const auto right = RecursiveIfElseCode<T>(2 * thisIndex + 2, treeDepth + 1, maxTreeDepth, thresholds, inputs,
+                                             typeName, indent + "   ");
+   // Both children give the same result: skip the cut and remove one level of indentation
+   if (left == right) {
+      std::string code;
+      std::string line;
+      std::istringstream lines(left);
+      while (std::getline(lines, line))
+         code += line.substr(3) + "\n";
+      return code;
+   }
+   ss << indent << "if (input[" << inputs[thisIndex] << " * stride] > static_cast<" << typeName << ">("
+      << thresholds[thisIndex] << ")) {\n"
+      << right << indent << "} else {\n"
+      << left << indent << "}\n";
+   return ss.str();
+}
+
 } // namespace Internal
 
 /// \class BranchlessTree
@@ -64,9 +99,14 @@ struct BranchlessTree {
    std::vector<T> fThresholds; ///< Cut thresholds or scores if corresponding node is a leaf
    std::vector<int> fInputs;   ///< Cut variables / inputs
 
+   static constexpr int kBlockSize = 16; ///< Maximum number of events processed together by InferenceBlock
+
    inline T Inference(const T *input, const int stride);
+   inline void InferenceBlock(const T *input, const int rows, const int strideTree, const int strideBatch,
+                              T *predictions);
    inline void FillSparse();
    inline std::string GetInferenceCode(const std::string& funcName, const std::string& typeName);
+   inline std::string GetIfElseInferenceCode(const std::string& funcName, const std::string& typeName);
 };
 
 /// Perform inference on a single input vector
@@ -83,6 +123,33 @@ inline T BranchlessTree<T>::Inference(const T *input, const int stride)
    return fThresholds[index];
 }
 
+/// Perform inference on a block of input vectors and add the tree scores to the predictions
+///
+/// The events of the block traverse the tree level by level together. The iterations
+/// of the loop over the events are independent, which allows the compiler to vectorize
+/// the traversal instead of waiting for the result of each comparison event by event.
+/// \param[in] input Pointer to data containing the input values of the first event
+/// \param[in] rows Number of events in the block, at most kBlockSize
+/// \param[in] strideTree Stride to go from one input variable to the next one
+/// \param[in] strideBatch Stride to go from one event to the next one
+/// \param[in,out] predictions Pointer to the buffer to which the tree scores are added
+template <typename T>
+inline void BranchlessTree<T>::InferenceBlock(const T *input, const int rows, const int strideTree,
+                                              const int strideBatch, T *predictions)
+{
+   const int *inputs = fInputs.data();
+   const T *thresholds = fThresholds.data();
+   int index[kBlockSize] = {};
+   for (int level = 0; level < fTreeDepth; ++level) {
+      for (int i = 0; i < rows; i++) {
+         const auto node = index[i];
+         index[i] = 2 * node + 1 + (input[i * strideBatch + inputs[node] * strideTree] > thresholds[node]);
+      }
+   }
+   for (int i = 0; i < rows; i++)
+      predictions[i] += thresholds[index[i]];
+}
+
 /// Fill nodes of a sparse tree forming a full tree
 ///
 /// Sparse parts of the tree are marked with -1 values in the feature vector. The
@@ -145,6 +212,27 @@ inline std::string BranchlessTree<T>::GetInferenceCode(const std::string& funcNa
    return ss.str();
 }
 
+/// Get code for compiling the inference function of the tree as nested if-else
+/// statements with the current thresholds and cut variables
+///
+/// The function has the same signature as the one of GetInferenceCode. The
+/// branches are usually faster than the branchless traversal for small forests,
+/// where the compiler can inline all the cuts as constants.
+///
+/// \param[in] funcName Name of the function
+/// \param[in] typeName Name of the type used for the computation
+/// \return Code of the inference function as string
+template <typename T>
+inline std::string BranchlessTree<T>::GetIfElseInferenceCode(const std::string& funcName, const std::string& typeName)
+{
+   std::stringstream ss;
+   ss << "inline " << typeName << " " << funcName << "(const " << typeName << "* input, const int stride)";
+   ss << "\n{\n";
+   ss << Internal::RecursiveIfElseCode<T>(0, 0, fTreeDepth, fThresholds, fInputs, typeName, "   ");
+   ss << "}";
+   return ss.str();
+}
+
 } // namespace Experimental
 } // namespace TMVA
 
@@ -84,12 +84,17 @@ inline void ForestBase<T, ForestType>::Inference(const T *inputs, const int rows
 {
    const auto strideTree = layout ? 1 : rows;
    const auto strideBatch = layout ? fNumInputs : 1;
-   for (int i = 0; i < rows; i++) {
-      predictions[i] = 0.0;
+   constexpr int blockSize = ForestType::value_type::kBlockSize;
+   // Loop over the trees for a block of events so that the events traverse each tree together
+   // while the inputs of the block stay in the cache
+   for (int first = 0; first < rows; first += blockSize) {
+      const int n = std::min(blockSize, rows - first);
+      std::fill(predictions + first, predictions + first + n, 0.0);
       for (auto &tree : fTrees) {
-         predictions[i] += tree.Inference(inputs + i * strideBatch, strideTree);
+         tree.InferenceBlock(inputs + first * strideBatch, n, strideTree, strideBatch, predictions + first);
       }
-      predictions[i] = fObjectiveFunc(predictions[i]);
+      for (int i = first; i < first + n; i++)
+         predictions[i] = fObjectiveFunc(predictions[i]);
    }
 }
 
@@ -185,7 +190,9 @@ BranchlessForest<T>::Load(const std::string &key, const std::string &filename, c
 /// \tparam T Value type for the computation (usually floating point type)
 template <typename T>
 struct BranchlessJittedForest : public ForestBase<T, std::function<void (const T *, const int, bool, T*)>> {
-    std::string Load(const std::string &key, const std::string &filename, const int output = 0, const bool sortTrees = true);
+   bool fIfElseCode = false; ///< Jit the trees as nested if-else statements instead of the branchless traversal
+
+   std::string Load(const std::string &key, const std::string &filename, const int output = 0, const bool sortTrees = true);
    void Inference(const T *inputs, const int rows, bool layout, T *predictions);
 };
 
@@ -269,7 +276,8 @@ BranchlessJittedForest<T>::Load(const std::string &key, const std::string &filen
       // Save code for jitting
       std::stringstream ss;
       ss << "tree" << c;
-      codes[c] = tree.GetInferenceCode(ss.str(), typeName);
+      codes[c] = fIfElseCode ? tree.GetIfElseInferenceCode(ss.str(), typeName)
+                             : tree.GetInferenceCode(ss.str(), typeName);
 
       c++;
    }
@@ -309,13 +317,19 @@ BranchlessJittedForest<T>::Load(const std::string &key, const std::string &filen
              << "\n{\n"
              << "   const auto strideTree = layout ? 1 : rows;\n"
              << "   const auto strideBatch = layout ? " << this->fNumInputs << " : 1;\n"
-             << "   for (int i = 0; i < rows; i++) {\n"
-             << "      predictions[i] = 0.0;\n";
+             << "   for (int first = 0; first < rows; first += " << BranchlessTree<T>::kBlockSize << ") {\n"
+             << "      const int last = first + " << BranchlessTree<T>::kBlockSize << " < rows ? first + "
+             << BranchlessTree<T>::kBlockSize << " : rows;\n"
+             << "      for (int i = first; i < last; i++)\n"
+             << "         predictions[i] = 0.0;\n";
+   // Loop over the events of a block for each tree, which keeps the tree constants in registers
+   // and lets the compiler interleave the independent events
    for (int i = 0; i < static_cast<int>(codes.size()); i++) {
       std::stringstream ss;
       ss << "tree" << i;
       const std::string funcName = ss.str();
-      jitForest << "      predictions[i] += " << funcName << "(inputs + i * strideBatch, strideTree);\n";
+      jitForest << "      for (int i = first; i < last; i++)\n"
+                << "         predictions[i] += " << funcName << "(inputs + i * strideBatch, strideTree);\n";
    }
    jitForest << "   }\n"
              << "}\n"
@@ -362,6 +376,17 @@ void BranchlessJittedForest<T>::Inference(const T *inputs, const int rows, bool
       predictions[i] = this->fObjectiveFunc(predictions[i]);
 }
 
+/// Forest using jitted trees written as nested if-else statements
+///
+/// The generated code grows with the number of cuts of the trees, this backend
+/// is therefore best suited for small forests.
+///
+/// \tparam T Value type for the computation (usually floating point type)
+template <typename T>
+struct IfElseJittedForest : public BranchlessJittedForest<T> {
+   IfElseJittedForest() { this->fIfElseCode = true; }
+};
+
 } // namespace Experimental
 } // namespace TMVA
 
@@ -0,0 +1,188 @@
+/**********************************************************************************
+ * Project: TMVA - a Root-integrated toolkit for multivariate data analysis       *
+ * Package: TMVA                                                                  *
+ * Class  : BinnedEventSample                                                     *
+ * Web    : http://tmva.sourceforge.net                                           *
+ *                                                                                *
+ * Description:                                                                   *
+ *      Training sample with pre-binned input variables, used for the             *
+ *      histogram based node splitting of the decision trees                      *
+ *                                                                                *
+ * Copyright (c) 2026:                                                            *
+ *      CERN, Switzerland                                                         *
+ *                                                                                *
+ * Redistribution and use in source and binary forms, with or without             *
+ * modification, are permitted according to the terms listed in LICENSE           *
+ * (http://tmva.sourceforge.net/LICENSE)                                          *
+ **********************************************************************************/
+
+/*! \class TMVA::BinnedEventSample
+\ingroup TMVA
+
+Training sample with pre-binned input variables.
+
+The bin edges of each variable are the quantiles of its distribution in the
+training sample, such that the bins hold about the same number of events.
+They are computed once for the whole forest, together with the bin of each
+variable of each event. The node splitting of the decision trees then only
+needs to fill histograms of the events in the node, which is done in
+parallel over the events, and to scan the bin edges as possible cuts.
+The histogram of one of the two daughter nodes is obtained by subtracting
+the histogram of its sibling from the one of the parent node.
+*/
+
+#include "TMVA/BinnedEventSample.h"
+
+#include "TMVA/Config.h"
+#include "TMVA/Event.h"
+#include "TMVA/MsgLogger.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace {
+// maximum number of events used to compute the quantiles of the variables
+const UInt_t kMaxQuantileEvents = 100000;
+// minimum number of events filled by each task of the thread pool
+const UInt_t kMinEventsPerPartition = 10000;
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// add the content of another histogram with the same binning
+
+TMVA::BinnedEventSample::Histogram &TMVA::BinnedEventSample::Histogram::operator+=( const Histogram &other )
+{
+   for (UInt_t i = 0; i < fContent.size(); i++) fContent[i] += other.fContent[i];
+   return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// subtract the content of another histogram with the same binning, e.g. the
+/// histogram of a daughter node from the one of its parent
+
+TMVA::BinnedEventSample::Histogram &TMVA::BinnedEventSample::Histogram::operator-=( const Histogram &other )
+{
+   for (UInt_t i = 0; i < fContent.size(); i++) fContent[i] -= other.fContent[i];
+   return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// constructor: compute the bin edges of each variable from its quantiles
+/// and the bins of the variables of all the events of the sample
+
+TMVA::BinnedEventSample::BinnedEventSample( const std::vector<const Event*> &eventSample, UInt_t nvars, UInt_t maxBins )
+   : fNvars(nvars),
+     fMaxBins(1),
+     fCutValues(nvars),
+     fEvents(eventSample)
+{
+   if (maxBins > 256) {
+      MsgLogger logger("BinnedEventSample");
+      logger << kWARNING << "At most 256 bins are supported, using 256 bins instead of " << maxBins << Endl;
+      maxBins = 256;
+   }
+   std::sort(fEvents.begin(), fEvents.end(), std::less<const Event*>());
+   fEvents.erase(std::unique(fEvents.begin(), fEvents.end()), fEvents.end());
+   const UInt_t nevents = fEvents.size();
+   const UInt_t step = std::max(1u, nevents / kMaxQuantileEvents);
+
+   std::vector<Float_t> values;
+   for (UInt_t ivar = 0; ivar < fNvars; ivar++) {
+      values.clear();
+      for (UInt_t ievt = 0; ievt < nevents; ievt += step) values.push_back(fEvents[ievt]->GetValueFast(ivar));
+      if (values.empty()) continue;
+      std::sort(values.begin(), values.end());
+
+      std::vector<Float_t> &cuts = fCutValues[ivar];
+      std::vector<Float_t> distinct(values);
+      distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+      if (distinct.size() <= maxBins) {
+         // one bin per value, e.g. for integer variables
+         cuts.assign(distinct.begin() + 1, distinct.end());
+      } else {
+         for (UInt_t ibin = 1; ibin < maxBins; ibin++) {
+            const Float_t cut = values[(ULong64_t)ibin * values.size() / maxBins];
+            if (cut > values.front() && (cuts.empty() || cut > cuts.back())) cuts.push_back(cut);
+         }
+      }
+      fMaxBins = std::max(fMaxBins, GetNBins(ivar));
+   }
+
+   // find the bin of each variable of each event, events are split in chunks filled in parallel
+   fBins.resize((ULong64_t)nevents * fNvars);
+   auto &executor = TMVA::Config::Instance().GetThreadExecutor();
+   const UInt_t nPartitions = std::max(1u, std::min(executor.GetPoolSize(), nevents / kMinEventsPerPartition));
+   auto fillBins = [this, nevents, nPartitions](UInt_t partition) {
+      const UInt_t start = (ULong64_t)partition * nevents / nPartitions;
+      const UInt_t end = (ULong64_t)(partition + 1) * nevents / nPartitions;
+      for (UInt_t ievt = start; ievt < end; ievt++) {
+         UChar_t *bins = &fBins[(ULong64_t)ievt * fNvars];
+         for (UInt_t ivar = 0; ivar < fNvars; ivar++) {
+            const std::vector<Float_t> &cuts = fCutValues[ivar];
+            bins[ivar] = std::upper_bound(cuts.begin(), cuts.end(), fEvents[ievt]->GetValueFast(ivar)) - cuts.begin();
+         }
+      }
+   };
+   executor.Foreach(fillBins, ROOT::TSeqU(nPartitions));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// return the bins of all the variables of the event, nullptr if the event
+/// is not in the sample
+
+const UChar_t *TMVA::BinnedEventSample::GetBins( const Event *event ) const
+{
+   auto it = std::lower_bound(fEvents.begin(), fEvents.end(), event, std::less<const Event*>());
+   if (it == fEvents.end() || *it != event) return nullptr;
+   return &fBins[(ULong64_t)(it - fEvents.begin()) * fNvars];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// fill the histogram of the weights and targets of the given events: the
+/// events are split in chunks filled in parallel, whose histograms are summed
+
+TMVA::BinnedEventSample::Histogram TMVA::BinnedEventSample::Fill( const std::vector<const Event*> &eventSample,
+                                                                  UInt_t sigClass, Bool_t regression ) const
+{
+   const UInt_t nevents = eventSample.size();
+   auto &executor = TMVA::Config::Instance().GetThreadExecutor();
+   const UInt_t nPartitions = std::max(1u, std::min(executor.GetPoolSize(), nevents / kMinEventsPerPartition));
+
+   auto fill = [this, &eventSample, nevents, nPartitions, sigClass, regression](UInt_t partition) {
+      Histogram histogram(fNvars, fMaxBins);
+      const UInt_t start = (ULong64_t)partition * nevents / nPartitions;
+      const UInt_t end = (ULong64_t)(partition + 1) * nevents / nPartitions;
+      for (UInt_t ievt = start; ievt < end; ievt++) {
+         const Event *event = eventSample[ievt];
+         const UChar_t *bins = GetBins(event);
+         if (bins == nullptr) {
+            MsgLogger logger("BinnedEventSample");
+            logger << kFATAL << "<Fill> event is not part of the binned training sample" << Endl;
+         }
+         const Double_t weight = event->GetWeight();
+         const Bool_t isSignal = event->GetClass() == sigClass;
+         const Double_t target = regression ? event->GetTarget(0) : 0.;
+         for (UInt_t ivar = 0; ivar < fNvars; ivar++) {
+            Double_t *bin = histogram.GetBin(ivar, bins[ivar]);
+            if (isSignal) {
+               bin[Histogram::kSigWeight] += weight;
+               bin[Histogram::kSig] += 1;
+            } else {
+               bin[Histogram::kBkgWeight] += weight;
+               bin[Histogram::kBkg] += 1;
+            }
+            if (regression) {
+               bin[Histogram::kTarget] += weight * target;
+               bin[Histogram::kTarget2] += weight * target * target;
+            }
+         }
+      }
+      return histogram;
+   };
+   auto sum = [](const std::vector<Histogram> &histograms) {
+      Histogram result = histograms.front();
+      for (UInt_t i = 1; i < histograms.size(); i++) result += histograms[i];
+      return result;
+   };
+   return executor.MapReduce(fill, ROOT::TSeqU(nPartitions), sum);
+}
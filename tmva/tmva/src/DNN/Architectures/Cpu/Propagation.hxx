@@ -560,23 +560,20 @@ void TCpu<AFloat>::CalculateConvWeightGradients(TCpuMatrix<AFloat> &weightGradie
 
    TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(fmap, ROOT::TSeqI( batchSize ) );
 
-//   auto freduce = [&](const TCpuTensor<AFloat> & vres) {
-      R__ASSERT(vres.GetFirstSize() == batchSize);
+   // sum the gradients of the batch events, in parallel over the filters (rows of the weight gradients)
+   R__ASSERT(vres.GetFirstSize() == batchSize);
+   auto freduce = [&](int j) {
       for (size_t i = 0; i < batchSize; i++) {
-         //TMVA_DNN_PrintTCpuMatrix(vres[i],"res");
          Matrix_t vres_m = vres.At(i).GetMatrix();
-         for (size_t j = 0; j < depth; j++) {
-            for (size_t k = 0; k < filterDepth; k++) {
-               size_t kOffset = k * filterSize;
-               for (size_t l = 0; l < filterSize; l++) {
-                  //weightGradients(j, k * (filterHeight * filterWidth) + l) += res(k, (tempNLocalViews - 1) - l);
-                  weightGradients(j, kOffset + l) += vres_m(j,  kOffset + l);
-               }
+         for (size_t k = 0; k < filterDepth; k++) {
+            size_t kOffset = k * filterSize;
+            for (size_t l = 0; l < filterSize; l++) {
+               weightGradients(j, kOffset + l) += vres_m(j,  kOffset + l);
             }
          }
-         // TMVA_DNN_PrintTCpuMatrix(weightGradients,"weights_i");
       }
-      //  };
+   };
+   TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(freduce, ROOT::TSeqI( depth ) );
 
    //TCpuMatrix<AFloat>::GetThreadExecutor().MapReduce(fmap, ROOT::TSeqI( batchSize ) , freduce);
    //TMVA_DNN_PrintTCpuMatrix(weightGradients,"W-Grad");
@@ -588,16 +585,17 @@ void TCpu<AFloat>::CalculateConvBiasGradients(TCpuMatrix<AFloat> &biasGradients,
                                               size_t batchSize, size_t depth, size_t nLocalViews)
 {
    biasGradients.Zero();
-   for (size_t i = 0; i < depth; i++) {
+   // in parallel over the filters, keeping the summation order of the serial version
+   auto f = [&](int i) {
       AFloat sum = 0;
       for (size_t j = 0; j < nLocalViews; j++) {
          for (size_t k = 0; k < batchSize; k++) {
             sum += df(k,i,j);
-            //sum += df[k](i, j);
          }
       }
       biasGradients(i, 0) = sum;
-   }
+   };
+   TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(f, ROOT::TSeqI( depth ) );
 }
 
 //____________________________________________________________________________
@@ -611,7 +609,8 @@ void TCpu<AFloat>::Downsample(TCpuTensor<AFloat> &tA, TCpuTensor<AFloat> &tB, co
    // A is output , B is a cached index tensor used for backward pass and C is the input
 
    assert( tA.GetFirstSize() == tC.GetFirstSize());
-   for (size_t ifirst = 0; ifirst < tC.GetFirstSize(); ++ifirst) {
+   // the events of the batch are pooled in parallel
+   auto f = [&](int ifirst) {
 
       Matrix_t A = tA.At(ifirst).GetMatrix();
       Matrix_t B = tB.At(ifirst).GetMatrix();
@@ -642,7 +641,8 @@ void TCpu<AFloat>::Downsample(TCpuTensor<AFloat> &tA, TCpuTensor<AFloat> &tB, co
             currLocalView++;
          }
       }
-   }
+   };
+   TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(f, ROOT::TSeqI( tC.GetFirstSize() ) );
 }
 
 //____________________________________________________________________________
@@ -664,7 +664,7 @@ void TCpu<AFloat>::MaxPoolLayerBackward(TCpuTensor<AFloat> &activationGradientsB
 {
 
    assert( activationGradientsBackward.GetFirstSize() == activationGradients.GetFirstSize());
-   for (size_t l = 0; l < activationGradients.GetFirstSize(); ++l) {
+   auto f = [&](int l) {
 
       Matrix_t activationGradientsBackward_m = activationGradientsBackward.At(l).GetMatrix();
       Matrix_t activationGradients_m = activationGradients.At(l).GetMatrix();
@@ -685,7 +685,8 @@ void TCpu<AFloat>::MaxPoolLayerBackward(TCpuTensor<AFloat> &activationGradientsB
             activationGradientsBackward_m(j, winningIdx) += grad;
          }
       }
-   }
+   };
+   TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(f, ROOT::TSeqI( activationGradients.GetFirstSize() ) );
 }
 
 //____________________________________________________________________________
@@ -923,13 +924,14 @@ void TCpu<AFloat>::Flatten(TCpuTensor<AFloat> &A, const TCpuTensor<AFloat> &B )
    assert (  A.GetHSize() == bsize);
    assert (  A.GetWSize() == nRows*nCols);
 
-   for (size_t i = 0; i < bsize; i++) {
+   auto f = [&](int i) {
       for (size_t j = 0; j < nRows; j++) {
          for (size_t k = 0; k < nCols; k++) {
             A( 0, i, j * nCols + k) = B(i, j, k);
          }
       }
-   }
+   };
+   TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(f, ROOT::TSeqI( bsize ) );
 
    // size_t bsize = B.GetFirstSize();
    // size_t n = B.GetSize()/bsize;
@@ -954,13 +956,14 @@ void TCpu<AFloat>::Deflatten(TCpuTensor<AFloat> &A, const TCpuTensor<AFloat> &B
    assert (  B.GetFirstSize() == 1);
    assert (  B.GetHSize() == size);
    assert (  B.GetWSize() == nRows*nCols);
-   for (size_t i = 0; i < (size_t)size; i++) {
+   auto f = [&](int i) {
       for (size_t j = 0; j < (size_t)nRows; j++) {
          for (size_t k = 0; k < (size_t)nCols; k++) {
                A(i, j, k) = B(0, i, j * nCols + k);
          }
       }
-   }
+   };
+   TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(f, ROOT::TSeqI( size ) );
 }
 
 //______________________________________________________________________________
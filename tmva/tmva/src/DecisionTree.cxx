@@ -137,7 +137,8 @@ TMVA::DecisionTree::DecisionTree():
    fSigClass       (0),
    fTreeID         (0),
    fAnalysisType   (Types::kClassification),
-   fDataSetInfo    (NULL)
+   fDataSetInfo    (NULL),
+   fBinnedSample   (NULL)
 
 {}
 
@@ -174,7 +175,8 @@ TMVA::DecisionTree::DecisionTree( TMVA::SeparationBase *sepType, Float_t minSize
    fSigClass       (cls),
    fTreeID         (treeID),
    fAnalysisType   (Types::kClassification),
-   fDataSetInfo    (dataInfo)
+   fDataSetInfo    (dataInfo),
+   fBinnedSample   (NULL)
 {
    if (sepType == NULL) { // it is interpreted as a regression tree, where
                           // currently the separation type (simple least square)
@@ -221,7 +223,8 @@ TMVA::DecisionTree::DecisionTree( const DecisionTree &d ):
    fSigClass   (d.fSigClass),
    fTreeID     (d.fTreeID),
    fAnalysisType(d.fAnalysisType),
-   fDataSetInfo    (d.fDataSetInfo)
+   fDataSetInfo    (d.fDataSetInfo),
+   fBinnedSample   (d.fBinnedSample)
 {
    this->SetRoot( new TMVA::DecisionTreeNode ( *((DecisionTreeNode*)(d.GetRoot())) ) );
    this->SetParentTreeInNodes();
@@ -515,7 +518,10 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
 
       // Train the node and figure out the separation gain and split points
       Double_t separationGain;
-      if (fNCuts > 0){
+      if (fBinnedSample){
+         separationGain = this->TrainNodeHistogram(eventSample, node);
+      }
+      else if (fNCuts > 0){
          separationGain = this->TrainNodeFast(eventSample, node);
       }
       else {
@@ -594,6 +600,8 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
          node->SetLeft(leftNode);
          node->SetRight(rightNode);
 
+         if (fBinnedSample) this->SplitNodeHistogram(node, leftNode, leftSample, rightNode, rightSample);
+
          this->BuildTree(rightSample, rightNode);
          this->BuildTree(leftSample,  leftNode );
 
@@ -624,6 +632,9 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
       if (node->GetDepth() > this->GetTotalTreeDepth()) this->SetTotalTreeDepth(node->GetDepth());
    }
 
+   // the histogram of the node is not needed anymore once its daughters are built
+   fNodeHistograms.erase(node);
+
    //   if (IsRootNode) this->CleanTree();
    return fNNodes;
 }
@@ -759,7 +770,10 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
    if ((eventSample.size() >= 2*fMinSize  && s+b >= 2*fMinSize) && node->GetDepth() < fMaxDepth
        && ( ( s!=0 && b !=0 && !DoRegression()) || ( (s+b)!=0 && DoRegression()) ) ) {
       Double_t separationGain;
-      if (fNCuts > 0){
+      if (fBinnedSample){
+         separationGain = this->TrainNodeHistogram(eventSample, node);
+      }
+      else if (fNCuts > 0){
          separationGain = this->TrainNodeFast(eventSample, node);
       } else {
          separationGain = this->TrainNodeFull(eventSample, node);
@@ -837,6 +851,8 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
          node->SetLeft(leftNode);
          node->SetRight(rightNode);
 
+         if (fBinnedSample) this->SplitNodeHistogram(node, leftNode, leftSample, rightNode, rightSample);
+
          this->BuildTree(rightSample, rightNode);
          this->BuildTree(leftSample,  leftNode );
 
@@ -867,6 +883,9 @@ UInt_t TMVA::DecisionTree::BuildTree( const std::vector<const TMVA::Event*> & ev
       if (node->GetDepth() > this->GetTotalTreeDepth()) this->SetTotalTreeDepth(node->GetDepth());
    }
 
+   // the histogram of the node is not needed anymore once its daughters are built
+   fNodeHistograms.erase(node);
+
    //   if (IsRootNode) this->CleanTree();
    return fNNodes;
 }
@@ -2529,6 +2548,132 @@ std::vector<Double_t>  TMVA::DecisionTree::GetFisherCoefficients(const EventCons
    return fisherCoeff;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Decide how to split a node using the pre-binned variables of the training
+/// sample: the cuts scanned for each variable are the bin edges of the binned
+/// sample, common to all the nodes and the trees of the forest. The histogram
+/// of the node is either filled here (root node) or has been obtained when the
+/// parent node was split (see SplitNodeHistogram).
+
+Double_t TMVA::DecisionTree::TrainNodeHistogram( const EventConstList & eventSample,
+                                                 TMVA::DecisionTreeNode *node )
+{
+   auto it = fNodeHistograms.find(node);
+   if (it == fNodeHistograms.end())
+      it = fNodeHistograms.emplace(node, fBinnedSample->Fill(eventSample, fSigClass, DoRegression())).first;
+   const BinnedEventSample::Histogram &histogram = it->second;
+   typedef BinnedEventSample::Histogram H;
+
+   std::vector<Bool_t> useVariable(fNvars, kTRUE);
+   if (fRandomisedTree) { // choose for each node splitting a random subset of variables to choose from
+      Bool_t *useRandomVariable = new Bool_t[fNvars];
+      UInt_t *mapVariable = new UInt_t[fNvars];
+      UInt_t tmp=fUseNvars;
+      GetRandomisedVariables(useRandomVariable,mapVariable,tmp);
+      for (UInt_t ivar=0; ivar < fNvars; ivar++) useVariable[ivar] = useRandomVariable[ivar];
+      delete [] useRandomVariable;
+      delete [] mapVariable;
+   }
+
+   // the totals of the node, from the bins of any of the variables
+   Double_t nTotS = 0, nTotB = 0, nTotS_unWeighted = 0, nTotB_unWeighted = 0, targetTot = 0, target2Tot = 0;
+   for (UInt_t ibin=0; ibin < fBinnedSample->GetNBins(0); ibin++) {
+      const Double_t *bin = histogram.GetBin(0, ibin);
+      nTotS += bin[H::kSigWeight];
+      nTotB += bin[H::kBkgWeight];
+      nTotS_unWeighted += bin[H::kSig];
+      nTotB_unWeighted += bin[H::kBkg];
+      targetTot += bin[H::kTarget];
+      target2Tot += bin[H::kTarget2];
+   }
+
+   // scan the cuts of each variable: the events below the cut are accumulated bin by bin
+   Double_t separationGainTotal = -1;
+   Int_t mxVar = -1, mxCut = -1;
+   Double_t mxSelS = 0, mxSelB = 0;
+   for (UInt_t ivar=0; ivar < fNvars; ivar++) {
+      if (!useVariable[ivar]) continue;
+      Double_t sl = 0, bl = 0, slW = 0, blW = 0, target = 0, target2 = 0;
+      for (UInt_t icut=0; icut+1 < fBinnedSample->GetNBins(ivar); icut++) {
+         const Double_t *bin = histogram.GetBin(ivar, icut);
+         sl += bin[H::kSig];
+         bl += bin[H::kBkg];
+         slW += bin[H::kSigWeight];
+         blW += bin[H::kBkgWeight];
+         target += bin[H::kTarget];
+         target2 += bin[H::kTarget2];
+
+         // only allow splits where both daughter nodes match the specified minimum number,
+         // both for the unweighted and the weighted events as in TrainNodeFast
+         const Double_t sr = nTotS_unWeighted-sl, br = nTotB_unWeighted-bl;
+         const Double_t srW = nTotS-slW, brW = nTotB-blW;
+         if ( !((sl+bl)>=fMinSize && (sr+br)>=fMinSize && (slW+blW)>=fMinSize && (srW+brW)>=fMinSize) ) continue;
+
+         Double_t sepTmp;
+         if (DoRegression()) {
+            sepTmp = fRegType->GetSeparationGain(slW+blW, target, target2, nTotS+nTotB, targetTot, target2Tot);
+         } else {
+            sepTmp = fSepType->GetSeparationGain(slW, blW, nTotS, nTotB);
+         }
+         if (separationGainTotal < sepTmp) {
+            separationGainTotal = sepTmp;
+            mxVar = ivar;
+            mxCut = icut;
+            mxSelS = slW;
+            mxSelB = blW;
+         }
+      }
+   }
+
+   if (mxVar < 0) return 0;
+
+   Bool_t cutType = kTRUE;
+   if (DoRegression()) {
+      node->SetSeparationIndex(fRegType->GetSeparationIndex(nTotS+nTotB,targetTot,target2Tot));
+      node->SetResponse(targetTot/(nTotS+nTotB));
+      if ( almost_equal_double(target2Tot/(nTotS+nTotB), targetTot/(nTotS+nTotB)*targetTot/(nTotS+nTotB)) ) {
+         node->SetRMS(0);
+      }else{
+         node->SetRMS(TMath::Sqrt(target2Tot/(nTotS+nTotB) - targetTot/(nTotS+nTotB)*targetTot/(nTotS+nTotB)));
+      }
+   }
+   else {
+      node->SetSeparationIndex(fSepType->GetSeparationIndex(nTotS,nTotB));
+      if (mxSelS/nTotS > mxSelB/nTotB) cutType=kTRUE;
+      else cutType=kFALSE;
+   }
+   node->SetSelector((UInt_t)mxVar);
+   node->SetCutValue(fBinnedSample->GetCutValue(mxVar, mxCut));
+   node->SetCutType(cutType);
+   node->SetSeparationGain(separationGainTotal);
+   node->SetNFisherCoeff(0);
+   fVariableImportance[mxVar] += separationGainTotal*separationGainTotal * (nTotS+nTotB) * (nTotS+nTotB) ;
+
+   return separationGainTotal;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare the histograms of the daughters of a split node: the histogram of
+/// the daughter with fewer events is filled, the one of its sibling is the
+/// histogram of the parent node minus the filled one.
+
+void TMVA::DecisionTree::SplitNodeHistogram( const DecisionTreeNode *node,
+                                             DecisionTreeNode *leftNode, const EventConstList &leftSample,
+                                             DecisionTreeNode *rightNode, const EventConstList &rightSample )
+{
+   auto it = fNodeHistograms.find(node);
+   if (it == fNodeHistograms.end()) return;
+
+   const Bool_t leftIsSmaller = leftSample.size() <= rightSample.size();
+   BinnedEventSample::Histogram smaller = fBinnedSample->Fill(leftIsSmaller ? leftSample : rightSample,
+                                                              fSigClass, DoRegression());
+   BinnedEventSample::Histogram larger = std::move(it->second);
+   fNodeHistograms.erase(it);
+   larger -= smaller;
+   fNodeHistograms[leftIsSmaller ? leftNode : rightNode] = std::move(smaller);
+   fNodeHistograms[leftIsSmaller ? rightNode : leftNode] = std::move(larger);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// train a node by finding the single optimal cut for a single variable
 /// that best separates signal and background (maximizes the separation gain)
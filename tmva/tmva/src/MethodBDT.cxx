@@ -181,6 +181,7 @@ TMVA::MethodBDT::MethodBDT( const TString& jobName,
    , fUseFisherCuts(0)        // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fMinLinCorrForFisher(.8) // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fUseExclusiveVars(0)     // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
+   , fUseHistogramSplits(kFALSE)
    , fUseYesNoLeaf(kFALSE)
    , fNodePurityLimit(0)
    , fNNodesMax(0)
@@ -236,6 +237,7 @@ TMVA::MethodBDT::MethodBDT( DataSetInfo& theData,
    , fUseFisherCuts(0)        // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fMinLinCorrForFisher(.8) // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
    , fUseExclusiveVars(0)     // don't use this initialisation, only here to make  Coverity happy. Is set in DeclarOptions()
+   , fUseHistogramSplits(kFALSE)
    , fUseYesNoLeaf(kFALSE)
    , fNodePurityLimit(0)
    , fNNodesMax(0)
@@ -311,6 +313,10 @@ Bool_t TMVA::MethodBDT::HasAnalysisType( Types::EAnalysisType type, UInt_t numbe
 ///  - nCuts:           the number of steps in the optimisation of the cut for a node (if < 0, then
 ///                  step size is determined by the events)
 ///  - UseFisherCuts:   use multivariate splits using the Fisher criterion
+///  - UseHistogramSplits: find the node splits with pre-binned variables: the nCuts+1 bins of each
+///                  variable hold about the same number of training events and are computed once
+///                  for the whole forest; the node histograms are filled in parallel over the events
+///                  and the histogram of one of the two daughters of a node is obtained by subtraction
 ///  - UseYesNoLeaf     decide if the classification is done simply by the node type, or the S/B
 ///                  (from the training) in the leaf node
 ///  - NodePurityLimit  the minimum purity to classify a node as a signal node (used in pruning and boosting to determine
@@ -419,6 +425,7 @@ void TMVA::MethodBDT::DeclareOptions()
    DeclareOptionRef(fUseFisherCuts=kFALSE, "UseFisherCuts", "Use multivariate splits using the Fisher criterion");
    DeclareOptionRef(fMinLinCorrForFisher=.8,"MinLinCorrForFisher", "The minimum linear correlation between two variables demanded for use in Fisher criterion in node splitting");
    DeclareOptionRef(fUseExclusiveVars=kFALSE,"UseExclusiveVars","Variables already used in fisher criterion are not anymore analysed individually for node splitting");
+   DeclareOptionRef(fUseHistogramSplits=kFALSE,"UseHistogramSplits","Find the node splits with pre-binned variables (nCuts+1 bins by quantiles of the training sample, at most 256), faster for large training samples");
 
 
    DeclareOptionRef(fDoPreselection=kFALSE,"DoPreselection","and and apply automatic pre-selection for 100% efficient signal (bkg) cuts prior to training");
@@ -606,6 +613,17 @@ void TMVA::MethodBDT::ProcessOptions()
       fNCuts=20;
    }
 
+   if (fUseHistogramSplits) {
+      if (fUseFisherCuts) {
+         Log() << kWARNING << "UseHistogramSplits is not available with UseFisherCuts, I will ignore it!" << Endl;
+         fUseHistogramSplits = kFALSE;
+      }
+      else if (fNCuts <= 0 || fNCuts > 255) {
+         Log() << kWARNING << "UseHistogramSplits requires 0 < nCuts < 256 --> I set nCuts = 255" << Endl;
+         fNCuts = 255;
+      }
+   }
+
    if (fNTrees==0){
       Log() << kERROR << " Zero Decision Trees demanded... that does not work !! "
             << " I set it to 1 .. just so that the program does not crash"
@@ -1263,6 +1281,11 @@ void TMVA::MethodBDT::Train()
       InitGradBoost(fEventSample);
    }
 
+   // the variables of the training events are binned once for all the trees
+   if (fUseHistogramSplits) {
+      fBinnedSample.reset(new BinnedEventSample(fEventSample, GetNvar(), fNCuts+1));
+   }
+
    Int_t itree=0;
    Bool_t continueBoost=kTRUE;
    //for (int itree=0; itree<fNTrees; itree++) {
@@ -1301,6 +1324,7 @@ void TMVA::MethodBDT::Train()
                fForest.back()->SetMinLinCorrForFisher(fMinLinCorrForFisher);
                fForest.back()->SetUseExclusiveVars(fUseExclusiveVars);
             }
+            fForest.back()->SetBinnedSample(fBinnedSample.get());
             // the minimum linear correlation between two variables demanded for use in fisher criterion in node splitting
 
             nNodesBeforePruning = fForest.back()->BuildTree(*fTrainSample);
@@ -1328,6 +1352,7 @@ void TMVA::MethodBDT::Train()
             fForest.back()->SetMinLinCorrForFisher(fMinLinCorrForFisher);
             fForest.back()->SetUseExclusiveVars(fUseExclusiveVars);
          }
+         fForest.back()->SetBinnedSample(fBinnedSample.get());
 
          nNodesBeforePruning = fForest.back()->BuildTree(*fTrainSample);
 
@@ -1400,6 +1425,8 @@ void TMVA::MethodBDT::Train()
    }
    TMVA::DecisionTreeNode::SetIsTraining(false);
 
+   for (auto tree : fForest) tree->SetBinnedSample(nullptr);
+   fBinnedSample.reset();
 
    // reset all previously stored/accumulated BOOST weights in the event sample
    //   for (UInt_t iev=0; iev<fEventSample.size(); iev++) fEventSample[iev]->SetBoostWeight(1.);
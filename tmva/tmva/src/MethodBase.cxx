@@ -939,9 +939,23 @@ std::vector<Double_t> TMVA::MethodBase::GetMvaValues(Long64_t firstEvt, Long64_t
 // (this is used by Method Category and it does not need to be re-implmented by derived classes )
 std::vector<Double_t> TMVA::MethodBase::GetDataMvaValues(DataSet * data, Long64_t firstEvt, Long64_t lastEvt, Bool_t logProgress)
 {
+   // the transformed event collections cached by GetEventCollection belong to the own data set:
+   // set them aside while evaluating on the given one
+   std::vector<const std::vector<TMVA::Event*>*> ownCollections(fEventCollections.size(), nullptr);
+   if (data) ownCollections.swap(fEventCollections);
+
    fTmpData = data;
    auto result = GetMvaValues(firstEvt, lastEvt, logProgress);
    fTmpData = nullptr;
+
+   if (data) {
+      for (auto collection : fEventCollections) {
+         if (!collection) continue;
+         for (auto event : *collection) delete event;
+         delete collection;
+      }
+      fEventCollections.swap(ownCollections);
+   }
    return result;
 }
 
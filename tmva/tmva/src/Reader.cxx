@@ -94,6 +94,7 @@
 #include "TMVA/Configurable.h"
 #include "TMVA/ClassifierFactory.h"
 #include "TMVA/DataInputHandler.h"
+#include "TMVA/DataSet.h"
 #include "TMVA/DataSetInfo.h"
 #include "TMVA/DataSetManager.h"
 #include "TMVA/IMethod.h"
@@ -559,6 +560,91 @@ Double_t TMVA::Reader::EvaluateMVA( MethodBase* method, Double_t aux )
                                (fCalculateError?&fMvaEventErrorUpper:0) );
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the MVA for a batch of events, given as the rows of a tensor of
+/// shape [nevents, nvariables]. Events with a NaN variable get the value -999.
+/// The parameter aux is obligatory for the cuts method where it represents the efficiency cutoff
+///
+/// Contrary to the other EvaluateMVA functions the input values are not read
+/// from the variables bound with AddVariable, and the function can be called
+/// concurrently from several threads with the same Reader: each call builds
+/// its own data set of events, and the evaluations of the batches by the
+/// method are serialised. The events are evaluated with the batched
+/// evaluation of the method when it has one, e.g. for MethodDL.
+/// External memory, e.g. a span of floats, can be passed with an RTensor
+/// adopting it:
+///
+/// ~~~ {.cpp}
+///    TMVA::Experimental::RTensor<float> x(data, {nevents, nvariables});
+///    auto y = reader->EvaluateMVA( x, "BDT method" );
+/// ~~~
+
+std::vector<Double_t> TMVA::Reader::EvaluateMVA( const TMVA::Experimental::RTensor<Float_t>& events,
+                                                 const TString& methodTag, Double_t aux ) const
+{
+   auto it = fMethodMap.find( methodTag );
+   if (it == fMethodMap.end()) {
+      Log() << kINFO << "<EvaluateMVA> unknown classifier in map; "
+            << "you looked for \"" << methodTag << "\" within available methods: " << Endl;
+      for (it = fMethodMap.begin(); it!=fMethodMap.end(); ++it) Log() << "--> " << it->first << Endl;
+      Log() << "Check calling string" << kFATAL << Endl;
+      return std::vector<Double_t>();
+   }
+   MethodBase* method = dynamic_cast<TMVA::MethodBase*>(it->second);
+   if (method == nullptr) {
+      Log() << kFATAL << methodTag << " is not a method" << Endl;
+      return std::vector<Double_t>();
+   }
+
+   const auto& shape = events.GetShape();
+   const UInt_t nvars = DataInfo().GetNVariables();
+   if (shape.size() != 2 || shape[1] != nvars) {
+      Log() << kFATAL << "<EvaluateMVA> the events must be given as a tensor of shape [nevents, " << nvars << "]" << Endl;
+      return std::vector<Double_t>();
+   }
+
+   // events with NaN variables are not evaluated
+   const UInt_t nevents = shape[0];
+   std::vector<Double_t> mvaValues(nevents, -999.);
+   std::vector<UInt_t> rows;
+   std::vector<Event*> eventCollection;
+   rows.reserve(nevents);
+   eventCollection.reserve(nevents);
+   std::vector<Float_t> values(nvars);
+   for (UInt_t ievt = 0; ievt < nevents; ievt++) {
+      Bool_t isNaN = kFALSE;
+      for (UInt_t ivar = 0; ivar < nvars; ivar++) {
+         values[ivar] = events(ievt, ivar);
+         isNaN |= TMath::IsNaN(values[ivar]);
+      }
+      if (isNaN) continue;
+      rows.push_back(ievt);
+      eventCollection.push_back(new Event(values, 0));
+   }
+
+   // the data set owns the events
+   DataSet data(DataInfo());
+   data.SetEventCollection(&eventCollection, Types::kTesting, kFALSE);
+   data.SetCurrentType(Types::kTesting);
+
+   std::vector<Double_t> batchValues;
+   {
+      std::lock_guard<std::mutex> lock(fBatchMutex);
+      if (rows.size() < nevents)
+         Log() << kERROR << (nevents - rows.size()) << " events with a NaN variable --> return MVA value -999 for them" << Endl;
+      if (rows.empty()) return mvaValues;
+
+      if (method->GetMethodType() == TMVA::Types::kCuts) {
+         TMVA::MethodCuts* mc = dynamic_cast<TMVA::MethodCuts*>(method);
+         if(mc)
+            mc->SetTestSignalEfficiency( aux );
+      }
+      batchValues = method->GetDataMvaValues( &data, 0, rows.size(), kFALSE );
+   }
+   for (UInt_t i = 0; i < rows.size(); i++) mvaValues[rows[i]] = batchValues[i];
+   return mvaValues;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// evaluates MVA for given set of input variables
 
@@ -0,0 +1,168 @@
+// @(#)root/tmva/tmva/cnn:$Id$
+
+/**********************************************************************************
+ * Project: TMVA - a Root-integrated toolkit for multivariate data analysis       *
+ * Package: TMVA                                                                  *
+ * Class  :                                                                       *
+ * Web    : http://tmva.sourceforge.net                                           *
+ *                                                                                *
+ * Description:                                                                   *
+ *      Testing that the multi-threaded CPU kernels of the convolutional and      *
+ *      pooling layers give the same results as with a single thread             *
+ *                                                                                *
+ * Copyright (c) 2005-2026:                                                       *
+ *      CERN, Switzerland                                                         *
+ *      U. of Victoria, Canada                                                    *
+ *      MPI-K Heidelberg, Germany                                                 *
+ *      U. of Bonn, Germany                                                       *
+ *                                                                                *
+ * Redistribution and use in source and binary forms, with or without             *
+ * modification, are permitted according to the terms listed in LICENSE           *
+ * (http://tmva.sourceforge.net/LICENSE)                                          *
+ **********************************************************************************/
+
+////////////////////////////////////////////////////////////////////
+// Testing Downsample, MaxPoolLayerBackward, Flatten, Deflatten   //
+// and the convolution weight and bias gradients with 1 and 4     //
+// threads: the results must be bitwise identical                 //
+////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <limits>
+
+#include "TMVA/Config.h"
+#include "TMVA/DNN/Architectures/Cpu.h"
+#include "TRandom3.h"
+
+using namespace TMVA::DNN;
+
+using Architecture_t = TCpu<Double_t>;
+using Tensor_t = Architecture_t::Tensor_t;
+using Matrix_t = Architecture_t::Matrix_t;
+
+const size_t batchSize = 16;
+const size_t inputDepth = 3;
+const size_t imgHeight = 8;
+const size_t imgWidth = 8;
+const size_t nFilters = 4;
+const size_t fltHeight = 3;
+const size_t fltWidth = 3;
+
+void Randomize(Tensor_t &t, UInt_t seed)
+{
+   TRandom3 rng(seed);
+   for (size_t i = 0; i < t.GetSize(); ++i)
+      t.GetData()[i] = rng.Gaus();
+}
+
+bool Equal(const Double_t *a, const Double_t *b, size_t n, const char *what)
+{
+   for (size_t i = 0; i < n; ++i) {
+      if (a[i] != b[i]) {
+         std::cerr << "ERROR - " << what << " differs at element " << i << ": " << a[i] << " != " << b[i]
+                   << std::endl;
+         return false;
+      }
+   }
+   return true;
+}
+
+bool Equal(const Tensor_t &a, const Tensor_t &b, const char *what)
+{
+   return a.GetSize() == b.GetSize() && Equal(a.GetData(), b.GetData(), a.GetSize(), what);
+}
+
+bool Equal(const Matrix_t &a, const Matrix_t &b, const char *what)
+{
+   return a.GetNoElements() == b.GetNoElements() && Equal(a.GetRawDataPointer(), b.GetRawDataPointer(),
+                                                          a.GetNoElements(), what);
+}
+
+/// The outputs of the kernels for a given number of threads
+struct Results {
+   Tensor_t fPooled{batchSize, inputDepth, 16};
+   Tensor_t fPoolIndices{batchSize, inputDepth, 16};
+   Tensor_t fPoolGradients{batchSize, inputDepth, imgHeight * imgWidth};
+   Tensor_t fFlat{1, batchSize, inputDepth * imgHeight * imgWidth};
+   Tensor_t fDeflat{batchSize, inputDepth, imgHeight * imgWidth};
+   Matrix_t fWeightGradients{nFilters, inputDepth * fltHeight * fltWidth};
+   Matrix_t fBiasGradients{nFilters, 1};
+};
+
+Results Run(int nThreads)
+{
+   if (nThreads > 1)
+      TMVA::Config::Instance().EnableMT(nThreads);
+   else
+      TMVA::Config::Instance().DisableMT();
+
+   Tensor_t input(batchSize, inputDepth, imgHeight * imgWidth);
+   Randomize(input, 1);
+   Results results;
+
+   // 2x2 max pooling with stride 2
+   Architecture_t::PoolingDescriptors_t descriptors;
+   Architecture_t::PoolingWorkspace_t workspace;
+   Architecture_t::Downsample(results.fPooled, results.fPoolIndices, input, descriptors, workspace, imgHeight,
+                              imgWidth, 2, 2, 2, 2);
+   Tensor_t outputGradients(batchSize, inputDepth, 16);
+   Randomize(outputGradients, 2);
+   Architecture_t::MaxPoolLayerBackward(results.fPoolGradients, outputGradients, results.fPoolIndices, input,
+                                        results.fPooled, descriptors, workspace, imgHeight, imgWidth, 2, 2, 2, 2, 16);
+
+   Architecture_t::Flatten(results.fFlat, input);
+   Architecture_t::Deflatten(results.fDeflat, results.fFlat);
+
+   // 3x3 convolution keeping the image size
+   const size_t nLocalViews = imgHeight * imgWidth;
+   Tensor_t df(batchSize, nFilters, nLocalViews);
+   Randomize(df, 3);
+   Architecture_t::CalculateConvWeightGradients(results.fWeightGradients, df, input, batchSize, imgHeight, imgWidth,
+                                                nFilters, imgHeight, imgWidth, inputDepth, fltHeight, fltWidth,
+                                                nLocalViews);
+   Architecture_t::CalculateConvBiasGradients(results.fBiasGradients, df, batchSize, nFilters, nLocalViews);
+
+   // the bias gradients must be summed in the order of the serial loops
+   for (size_t i = 0; i < nFilters; i++) {
+      Double_t sum = 0;
+      for (size_t j = 0; j < nLocalViews; j++) {
+         for (size_t k = 0; k < batchSize; k++) {
+            sum += df(k, i, j);
+         }
+      }
+      if (results.fBiasGradients(i, 0) != sum) {
+         std::cerr << "ERROR - bias gradient " << i << " is not the serial sum" << std::endl;
+         results.fBiasGradients(i, 0) = std::numeric_limits<Double_t>::quiet_NaN();
+      }
+   }
+
+   return results;
+}
+
+int main()
+{
+   std::cout << "Testing the multi-threaded CPU kernels:" << std::endl;
+
+   const Results serial = Run(1);
+   const Results parallel = Run(4);
+   TMVA::Config::Instance().DisableMT();
+
+   bool ok = true;
+   ok &= Equal(serial.fPooled, parallel.fPooled, "Downsample output");
+   ok &= Equal(serial.fPoolIndices, parallel.fPoolIndices, "Downsample indices");
+   ok &= Equal(serial.fPoolGradients, parallel.fPoolGradients, "MaxPoolLayerBackward");
+   ok &= Equal(serial.fFlat, parallel.fFlat, "Flatten");
+   ok &= Equal(serial.fDeflat, parallel.fDeflat, "Deflatten");
+   ok &= Equal(serial.fWeightGradients, parallel.fWeightGradients, "CalculateConvWeightGradients");
+   ok &= Equal(serial.fBiasGradients, parallel.fBiasGradients, "CalculateConvBiasGradients");
+   // Deflatten inverts Flatten
+   Tensor_t input(batchSize, inputDepth, imgHeight * imgWidth);
+   Randomize(input, 1);
+   ok &= Equal(input, parallel.fDeflat, "Deflatten of Flatten");
+
+   if (!ok) {
+      std::cerr << "ERROR - the multi-threaded kernels differ from the serial ones" << std::endl;
+      return -1;
+   }
+   return 0;
+}
@@ -0,0 +1,89 @@
+// TMVA
+#include "TMVA/BinnedEventSample.h"
+#include "TMVA/DecisionTree.h"
+#include "TMVA/DecisionTreeNode.h"
+#include "TMVA/Event.h"
+#include "TMVA/GiniIndex.h"
+
+// Stdlib
+#include <memory>
+#include <vector>
+
+// External
+#include "gtest/gtest.h"
+
+using TMVA::BinnedEventSample;
+
+class BinnedEventSampleFixture : public ::testing::Test {
+protected:
+   // events with x = 0, ..., 999 and y = x % 3, signal (class 0) if x >= 500
+   void SetUp() override
+   {
+      for (Int_t i = 0; i < 1000; ++i)
+         fEvents.emplace_back(new TMVA::Event(std::vector<Float_t>{Float_t(i), Float_t(i % 3)}, i >= 500 ? 0 : 1));
+      for (auto &e : fEvents)
+         fSample.push_back(e.get());
+   }
+
+   std::vector<std::unique_ptr<TMVA::Event>> fEvents;
+   std::vector<const TMVA::Event *> fSample;
+};
+
+TEST_F(BinnedEventSampleFixture, QuantileBins)
+{
+   BinnedEventSample binned(fSample, 2, 10);
+   EXPECT_EQ(binned.GetNBins(0), 10u);
+   for (UInt_t icut = 0; icut < 9; ++icut)
+      EXPECT_FLOAT_EQ(binned.GetCutValue(0, icut), 100. * (icut + 1));
+   // one bin per value of the discrete variable
+   EXPECT_EQ(binned.GetNBins(1), 3u);
+   EXPECT_FLOAT_EQ(binned.GetCutValue(1, 0), 1.);
+   EXPECT_FLOAT_EQ(binned.GetCutValue(1, 1), 2.);
+   EXPECT_EQ(binned.GetMaxBins(), 10u);
+
+   const UChar_t *bins = binned.GetBins(fSample[250]);
+   ASSERT_NE(bins, nullptr);
+   EXPECT_EQ(bins[0], 2);
+   EXPECT_EQ(bins[1], 1);
+   TMVA::Event other(std::vector<Float_t>{0., 0.}, 0);
+   EXPECT_EQ(binned.GetBins(&other), nullptr);
+}
+
+TEST_F(BinnedEventSampleFixture, FillAndSubtract)
+{
+   BinnedEventSample binned(fSample, 2, 10);
+   auto all = binned.Fill(fSample, 0, kFALSE);
+   EXPECT_DOUBLE_EQ(all.GetBin(0, 0)[BinnedEventSample::Histogram::kBkg], 100.);
+   EXPECT_DOUBLE_EQ(all.GetBin(0, 9)[BinnedEventSample::Histogram::kSigWeight], 100.);
+   EXPECT_DOUBLE_EQ(all.GetBin(1, 0)[BinnedEventSample::Histogram::kSig], 167.);
+
+   std::vector<const TMVA::Event *> low(fSample.begin(), fSample.begin() + 300);
+   std::vector<const TMVA::Event *> high(fSample.begin() + 300, fSample.end());
+   auto subtracted = all;
+   subtracted -= binned.Fill(low, 0, kFALSE);
+   auto filled = binned.Fill(high, 0, kFALSE);
+   for (UInt_t ivar = 0; ivar < 2; ++ivar) {
+      for (UInt_t ibin = 0; ibin < binned.GetNBins(ivar); ++ibin) {
+         for (Int_t q = 0; q < BinnedEventSample::Histogram::kNQuantities; ++q)
+            EXPECT_DOUBLE_EQ(subtracted.GetBin(ivar, ibin)[q], filled.GetBin(ivar, ibin)[q]);
+      }
+   }
+}
+
+TEST_F(BinnedEventSampleFixture, DecisionTreeSplit)
+{
+   BinnedEventSample binned(fSample, 2, 20);
+   TMVA::GiniIndex gini;
+   TMVA::DecisionTree tree(&gini, 5., 19, nullptr, 0, kFALSE, 0, kFALSE, 2);
+   tree.SetNVars(2);
+   tree.SetBinnedSample(&binned);
+   TMVA::DecisionTreeNode::SetIsTraining(true);
+   tree.BuildTree(fSample);
+   TMVA::DecisionTreeNode::SetIsTraining(false);
+
+   TMVA::DecisionTreeNode *root = tree.GetRoot();
+   EXPECT_EQ(root->GetSelector(), 0);
+   EXPECT_FLOAT_EQ(root->GetCutValue(), 500.);
+   for (const auto event : fSample)
+      EXPECT_EQ(tree.CheckEvent(event, kTRUE), event->GetClass() == 0 ? 1. : -1.);
+}
@@ -81,6 +81,31 @@ TEST(BranchlessTree, InferenceSparseTreeDepth2)
    EXPECT_FLOAT_EQ(tree.Inference(input3, 1), 6.0);
 }
 
+TEST(BranchlessTree, InferenceBlock)
+{
+   BranchlessTree<float> tree;
+   tree.fTreeDepth = 2;
+   tree.fThresholds = {0.0, 1.0, 2.0, 0.0, 0.0, 5.0, 6.0};
+   tree.fInputs = {0, -1, 2};
+   tree.FillSparse();
+   const auto rows = 4;
+   float inputs[3 * rows] = {-1.0, 0.0, -999.0, -1.0, 2.0, -999.0, 1.0, -999.0, 1.0, 1.0, -999.0, 3.0};
+   float predictions[rows] = {1.0, 1.0, 1.0, 1.0};
+   tree.InferenceBlock(inputs, rows, 1, 3, predictions);
+   for (int i = 0; i < rows; i++)
+      EXPECT_FLOAT_EQ(predictions[i], 1.0 + tree.Inference(inputs + 3 * i, 1));
+
+   // Column major layout
+   float inputsColumnMajor[3 * rows];
+   for (int i = 0; i < rows; i++)
+      for (int j = 0; j < 3; j++)
+         inputsColumnMajor[j * rows + i] = inputs[i * 3 + j];
+   float predictionsColumnMajor[rows] = {0.0, 0.0, 0.0, 0.0};
+   tree.InferenceBlock(inputsColumnMajor, rows, rows, 1, predictionsColumnMajor);
+   for (int i = 0; i < rows; i++)
+      EXPECT_FLOAT_EQ(predictionsColumnMajor[i], tree.Inference(inputs + 3 * i, 1));
+}
+
 TEST(BranchlessJittedTree, InferenceFullTreeDepth0)
 {
    BranchlessTree<float> tree;
@@ -132,6 +157,38 @@ TEST(BranchlessJittedTree, InferenceFullTreeDepth2)
    EXPECT_FLOAT_EQ(tree.Inference(input3, 1), r3);
 }
 
+TEST(IfElseJittedTree, InferenceFullTreeDepth0)
+{
+   BranchlessTree<float> tree;
+   tree.fTreeDepth = 0;
+   tree.fThresholds = {-1.0};
+   tree.fInputs = {};
+   const auto code = tree.GetIfElseInferenceCode("foo", "float");
+   float r = JittedTreeInference<float>("IfElseJittedTree001", "foo", code, nullptr, 1);
+   EXPECT_FLOAT_EQ(tree.Inference(nullptr, 1), r);
+}
+
+TEST(IfElseJittedTree, InferenceSparseTreeDepth2)
+{
+   BranchlessTree<float> tree;
+   tree.fTreeDepth = 2;
+   tree.fThresholds = {0.0, 1.0, 2.0, 0.0, 0.0, 5.0, 6.0};
+   tree.fInputs = {0, -1, 2};
+   tree.FillSparse();
+
+   // The filled sparse branch does not need a cut
+   const auto code = tree.GetIfElseInferenceCode("foo", "float");
+   EXPECT_EQ(code.find("input[1 * stride]"), std::string::npos);
+
+   float inputs[4][3] = {{-1.0, 0.0, -999.0}, {-1.0, 2.0, -999.0}, {1.0, -999.0, 1.0}, {1.0, -999.0, 3.0}};
+   for (int i = 0; i < 4; i++) {
+      const std::string funcName = "foo" + std::to_string(i);
+      float r = JittedTreeInference<float>("IfElseJittedTree002", funcName, tree.GetIfElseInferenceCode(funcName, "float"),
+                                           inputs[i], 1);
+      EXPECT_FLOAT_EQ(tree.Inference(inputs[i], 1), r);
+   }
+}
+
 template <typename ForestType>
 void TestInferenceSingleTree(const std::string& tag)
 {
@@ -163,6 +220,11 @@ TEST(BranchlessForest, InferenceSingleTree)
    TestInferenceSingleTree<BranchlessForest<float>>("BranchlessForest");
 }
 
+TEST(IfElseJittedForest, InferenceSingleTree)
+{
+   TestInferenceSingleTree<IfElseJittedForest<float>>("IfElseJittedForest");
+}
+
 template <typename ForestType>
 void TestInferenceSingleTreeObjectiveLogistic(const std::string& tag)
 {
@@ -194,6 +256,11 @@ TEST(BranchlessForest, InferenceSingleTreeObjectiveLogistic)
    TestInferenceSingleTreeObjectiveLogistic<BranchlessForest<float>>("BranchlessForest");
 }
 
+TEST(IfElseJittedForest, InferenceSingleTreeObjectiveLogistic)
+{
+   TestInferenceSingleTreeObjectiveLogistic<IfElseJittedForest<float>>("IfElseJittedForest");
+}
+
 template <typename ForestType>
 void TestInferenceTwoTrees(const std::string& tag)
 {
@@ -225,6 +292,11 @@ TEST(BranchlessForest, InferenceTwoTrees)
    TestInferenceTwoTrees<BranchlessForest<float>>("BranchlessForest");
 }
 
+TEST(IfElseJittedForest, InferenceTwoTrees)
+{
+   TestInferenceTwoTrees<IfElseJittedForest<float>>("IfElseJittedForest");
+}
+
 TEST(BranchlessForest, SortTrees)
 {
    const auto maxDepth = 1;
@@ -277,3 +349,34 @@ TEST(BranchlessJittedForest, SortTrees)
    for (int i = 0; i < rows; i++)
       EXPECT_FLOAT_EQ(predictions1[i], predictions2[i]);
 }
+
+TEST(BranchlessForest, InferenceManyEvents)
+{
+   // More events than the size of a block, the last block is incomplete
+   const auto maxDepth = 1;
+   const auto numInputs = 2;
+   const auto numTrees = 2;
+   WriteModel("myModel", "TestBranchlessForest4.root", "identity", {0, 1}, {0, 0},
+              {0.0, 1.0, -1.0, 0.0, 2.0, -2.0}, {maxDepth}, {numTrees}, {numInputs}, {1});
+
+   BranchlessForest<float> forest;
+   forest.Load("myModel", "TestBranchlessForest4.root", 0);
+   IfElseJittedForest<float> jittedForest;
+   jittedForest.Load("myModel", "TestBranchlessForest4.root", 0);
+
+   const auto rows = 3 * BranchlessTree<float>::kBlockSize + 5;
+   std::vector<float> inputs(numInputs * rows);
+   for (int i = 0; i < rows; i++) {
+      inputs[i * numInputs] = (i % 2 == 0) ? -1.0 : 1.0;
+      inputs[i * numInputs + 1] = (i % 3 == 0) ? -1.0 : 1.0;
+   }
+   std::vector<float> predictions(rows);
+   forest.Inference(inputs.data(), rows, true, predictions.data());
+   std::vector<float> jittedPredictions(rows);
+   jittedForest.Inference(inputs.data(), rows, true, jittedPredictions.data());
+   for (int i = 0; i < rows; i++) {
+      const float expected = ((i % 2 == 0) ? 1.0 : -1.0) + ((i % 3 == 0) ? 2.0 : -2.0);
+      EXPECT_FLOAT_EQ(predictions[i], expected);
+      EXPECT_FLOAT_EQ(jittedPredictions[i], expected);
+   }
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <TMVA/RBatchGenerator.hxx>
+#include <ROOT/RDataFrame.hxx>
+#include <TSystem.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+using TMVA::Experimental::Internal::RBatchGenerator;
+
+namespace {
+
+constexpr std::size_t kNumEntries = 2050;
+const std::string kTreeName = "tree";
+// two files, so that the chunks span a chain
+const std::vector<std::string> kFileNames = {"rbatchgenerator_1.root", "rbatchgenerator_2.root"};
+
+// Each entry holds its index, so that the delivered entries can be identified
+struct RInputFiles {
+   RInputFiles()
+   {
+      const std::size_t nFirst = 1234;
+      ROOT::RDataFrame(nFirst)
+         .Define("idx", [](ULong64_t e) { return float(e); }, {"rdfentry_"})
+         .Snapshot(kTreeName, kFileNames[0], {"idx"});
+      ROOT::RDataFrame(kNumEntries - nFirst)
+         .Define("idx", [](ULong64_t e) { return float(e + nFirst); }, {"rdfentry_"})
+         .Snapshot(kTreeName, kFileNames[1], {"idx"});
+   }
+   ~RInputFiles()
+   {
+      for (auto &fileName : kFileNames)
+         gSystem->Unlink(fileName.c_str());
+   }
+};
+
+std::vector<float> ConsumeEpoch(RBatchGenerator<float> &generator)
+{
+   std::vector<float> entries;
+   generator.Activate();
+   while (generator.HasTrainData()) {
+      auto &batch = generator.GetTrainBatch();
+      entries.insert(entries.end(), batch.GetData(), batch.GetData() + batch.GetSize());
+   }
+   generator.DeActivate();
+   return entries;
+}
+
+std::vector<float> AllEntries()
+{
+   std::vector<float> entries(kNumEntries);
+   std::iota(entries.begin(), entries.end(), 0.f);
+   return entries;
+}
+
+} // namespace
+
+class RBatchGeneratorTest : public ::testing::Test {
+protected:
+   RInputFiles fFiles;
+};
+
+TEST_F(RBatchGeneratorTest, ParallelLoadingInOrder)
+{
+   for (std::size_t nThreads : {1u, 4u}) {
+      RBatchGenerator<float> generator(kTreeName, kFileNames, 100, 10, {"idx"}, {}, {}, 0., 0., 0, 0,
+                                       /*shuffle=*/false, nThreads);
+      EXPECT_EQ(generator.GetNumLoadingThreads(), nThreads);
+      // every entry exactly once, in the order of the chain
+      EXPECT_EQ(ConsumeEpoch(generator), AllEntries()) << "with " << nThreads << " threads";
+      EXPECT_EQ(generator.GetNumLoadedEvents(), kNumEntries);
+      EXPECT_GT(generator.GetLoadingThroughput(), 0.);
+   }
+}
+
+TEST_F(RBatchGeneratorTest, ParallelLoadingShuffled)
+{
+   RBatchGenerator<float> generator(kTreeName, kFileNames, 100, 10, {"idx"}, {}, {}, 0., 0., 0, 0,
+                                    /*shuffle=*/true, 4);
+   for (int epoch = 0; epoch < 2; ++epoch) {
+      auto entries = ConsumeEpoch(generator);
+      std::sort(entries.begin(), entries.end());
+      EXPECT_EQ(entries, AllEntries()) << "in epoch " << epoch;
+   }
+}
+
+TEST_F(RBatchGeneratorTest, ParallelLoadingValidationSplit)
+{
+   RBatchGenerator<float> generator(kTreeName, kFileNames, 100, 10, {"idx"}, {}, {}, 0., 0.2, 0, 0,
+                                    /*shuffle=*/true, 4);
+   auto training = ConsumeEpoch(generator);
+   std::vector<float> validation;
+   while (generator.HasValidationData()) {
+      auto &batch = generator.GetValidationBatch();
+      validation.insert(validation.end(), batch.GetData(), batch.GetData() + batch.GetSize());
+   }
+   // 20% of each of the 20 full chunks and of the last chunk of 50 entries
+   EXPECT_EQ(validation.size(), 410u);
+
+   // the training and validation entries are disjoint and cover all the entries
+   std::sort(training.begin(), training.end());
+   auto entries = training;
+   entries.insert(entries.end(), validation.begin(), validation.end());
+   std::sort(entries.begin(), entries.end());
+   EXPECT_EQ(entries, AllEntries());
+
+   // later epochs use the same training entries
+   auto training2 = ConsumeEpoch(generator);
+   std::sort(training2.begin(), training2.end());
+   EXPECT_EQ(training2, training);
+}
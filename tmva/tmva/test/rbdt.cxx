@@ -125,3 +125,46 @@ TEST(RBDT, ColumnMajorInput)
    EXPECT_FLOAT_EQ(y(0, 0), 1.0);
    EXPECT_FLOAT_EQ(y(1, 0), 1.0);
 }
+
+template <typename Backend>
+void TestBatchManyEvents(const std::string &tag)
+{
+   const auto maxDepth = 1;
+   const auto numInputs = 2;
+   const auto numOutputs = 3;
+   const auto numTrees = 3;
+   WriteModel("myModel", "TestRBDT6" + tag + ".root", "softmax", {0, 1, 0}, {0, 1, 2},
+              {0.0, 1.0, -1.0, 0.0, -1.0, 1.0, 0.5, 2.0, -2.0}, {maxDepth}, {numTrees}, {numInputs}, {numOutputs});
+
+   // More events than the size of a chunk computed in parallel
+   RBDT<Backend> bdt("myModel", "TestRBDT6" + tag + ".root");
+   const std::size_t rows = 10000;
+   RTensor<float> x({rows, 2});
+   for (std::size_t i = 0; i < rows; i++) {
+      x(i, 0) = std::sin(0.1 * i);
+      x(i, 1) = std::cos(0.3 * i);
+   }
+   auto y = bdt.Compute(x);
+   EXPECT_EQ(y.GetShape()[0], rows);
+   EXPECT_EQ(y.GetShape()[1], 3u);
+   for (std::size_t i = 0; i < rows; i++) {
+      auto yi = bdt.Compute({x(i, 0), x(i, 1)});
+      for (std::size_t j = 0; j < 3; j++)
+         EXPECT_FLOAT_EQ(y(i, j), yi[j]);
+   }
+}
+
+TEST(RBDT, BatchManyEvents)
+{
+   TestBatchManyEvents<BranchlessJittedForest<float>>("BranchlessJittedForest");
+}
+
+TEST(RBDT, BatchManyEventsBranchlessForest)
+{
+   TestBatchManyEvents<BranchlessForest<float>>("BranchlessForest");
+}
+
+TEST(RBDT, BatchManyEventsIfElseJittedForest)
+{
+   TestBatchManyEvents<IfElseJittedForest<float>>("IfElseJittedForest");
+}
@@ -5,12 +5,15 @@
 #include <TSystem.h>
 #include <TMVA/Factory.h>
 #include <TMVA/DataLoader.h>
+#include <TMVA/Reader.h>
 
 #include <TMVA/RReader.hxx>
 #include <TMVA/RInferenceUtils.hxx>
 #include <TMVA/RTensor.hxx>
 #include <TMVA/RTensorUtils.hxx>
 
+#include <thread>
+
 using namespace TMVA::Experimental;
 
 // Classification
@@ -187,6 +190,48 @@ TEST(RReader, ClassificationComputeDataFrame)
    EXPECT_EQ(y->size(), *c);
 }
 
+TEST(RReader, ClassificationReaderBatch)
+{
+   TrainClassificationModel();
+   ROOT::RDataFrame df("TreeS", filenameClassification);
+   auto x = AsTensor<float>(df, variablesClassification);
+   const auto numEntries = x.GetShape()[0];
+
+   std::vector<float> values(variablesClassification.size());
+   TMVA::Reader reader("Silent");
+   for (std::size_t i = 0; i < values.size(); i++)
+      reader.AddVariable(variablesClassification[i], &values[i]);
+   reader.BookMVA("BDT", modelClassification);
+
+   auto y = reader.EvaluateMVA(x, "BDT");
+   ASSERT_EQ(y.size(), numEntries);
+   for (std::size_t i = 0; i < numEntries; i++) {
+      for (std::size_t j = 0; j < values.size(); j++)
+         values[j] = x(i, j);
+      EXPECT_FLOAT_EQ(y[i], reader.EvaluateMVA("BDT"));
+   }
+
+   // concurrent evaluation of slices of the events with the same reader
+   const std::size_t numThreads = 4;
+   std::vector<std::vector<double>> results(numThreads);
+   std::vector<std::thread> threads;
+   for (std::size_t t = 0; t < numThreads; t++) {
+      threads.emplace_back([&, t]() {
+         const std::size_t first = t * numEntries / numThreads;
+         const std::size_t last = (t + 1) * numEntries / numThreads;
+         RTensor<float> slice(x.GetData() + first * values.size(), {last - first, values.size()});
+         results[t] = reader.EvaluateMVA(slice, "BDT");
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+   std::size_t i = 0;
+   for (const auto &result : results)
+      for (auto value : result)
+         EXPECT_EQ(value, y[i++]);
+   EXPECT_EQ(i, numEntries);
+}
+
 TEST(RReader, RegressionGetVariables)
 {
    TrainRegressionModel();
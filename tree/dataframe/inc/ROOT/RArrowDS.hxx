@@ -13,6 +13,8 @@
 #include "ROOT/RDataSource.hxx"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace arrow {
 class Table;
@@ -54,6 +56,8 @@ public:
 
 RDataFrame FromArrow(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columnNames);
 
+RDataFrame FromArrowIPC(std::string_view fileName, std::vector<std::string> const &columnNames = {});
+
 } // namespace RDF
 
 } // namespace ROOT
@@ -16,7 +16,6 @@
 
 #include <cstdint>
 #include <deque>
-#include <list>
 #include <unordered_map>
 #include <set>
 #include <memory>
@@ -53,25 +52,28 @@ private:
    std::vector<std::string> fHeaders; // the column names
    std::unordered_map<std::string, ColType_t> fColTypes;
    std::set<std::string> fColContainingEmpty; // store columns which had empty entry
-   std::list<ColType_t> fColTypesList; // column types, order is the same as fHeaders, values the same as fColTypes
-   std::vector<std::vector<void *>> fColAddresses;         // fColAddresses[column][slot] (same ordering as fHeaders)
-   std::vector<Record_t> fRecords;                         // fRecords[entry][column] (same ordering as fHeaders)
-   std::vector<std::vector<double>> fDoubleEvtValues;      // one per column per slot
-   std::vector<std::vector<Long64_t>> fLong64EvtValues;    // one per column per slot
-   std::vector<std::vector<std::string>> fStringEvtValues; // one per column per slot
+   std::vector<ColType_t> fColTypesList; // column types, order is the same as fHeaders, values the same as fColTypes
+   std::vector<std::vector<void *>> fColAddresses; // fColAddresses[column][slot] (same ordering as fHeaders)
+   // The values of the records of the current chunk, stored by column (same ordering as fHeaders): only the
+   // container that corresponds to the type of the column is filled, with one value per record.
+   // The column addresses of the slots point into these containers.
+   std::vector<std::vector<double>> fDoubleValues;
+   std::vector<std::vector<Long64_t>> fLong64Values;
+   std::vector<std::vector<std::string>> fStringValues;
    // This must be a deque to avoid the specialisation vector<bool>. This would not
    // work given that the pointer to the boolean in that case cannot be taken
-   std::vector<std::deque<bool>> fBoolEvtValues; // one per column per slot
+   std::vector<std::deque<bool>> fBoolValues;
 
    void FillHeaders(const std::string &);
-   void FillRecord(const std::string &, Record_t &);
+   void FillRecord(const std::string &, std::size_t, std::vector<unsigned char> &);
+   void FillRecords(const std::vector<std::string> &);
    void GenerateHeaders(size_t);
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &) final;
    void ValidateColTypes(std::vector<std::string> &) const;
    void InferColTypes(std::vector<std::string> &);
    void InferType(const std::string &, unsigned int);
-   std::vector<std::string> ParseColumns(const std::string &);
-   size_t ParseValue(const std::string &, std::vector<std::string> &, size_t);
+   std::vector<std::string> ParseColumns(const std::string &) const;
+   size_t ParseValue(const std::string &, std::vector<std::string> &, size_t) const;
    ColType_t GetType(std::string_view colName) const;
    void FreeRecords();
 
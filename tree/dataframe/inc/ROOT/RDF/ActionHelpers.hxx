@@ -20,6 +20,7 @@
 #define ROOT_RDFOPERATIONS
 
 #include "Compression.h"
+#include "RConfigure.h" // R__HAS_ROOT7
 #include "ROOT/RStringView.hxx"
 #include "ROOT/RVec.hxx"
 #include "ROOT/TBufferMerger.hxx" // for SnapshotHelper
@@ -48,9 +49,13 @@
 #include "ROOT/RDF/RMergeableValue.hxx"
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -59,6 +64,25 @@
 #include <iomanip>
 #include <numeric> // std::accumulate in MeanHelper
 
+#ifdef R__HAS_ROOT7
+#include "ROOT/REntry.hxx"
+#include "ROOT/RField.hxx"
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleParallelWriter.hxx" // for SnapshotRNTupleHelper
+
+namespace ROOT {
+namespace Detail {
+namespace RDF {
+class RLoopManager;
+} // namespace RDF
+} // namespace Detail
+namespace RDF {
+template <typename Proxied, typename DataSource>
+class RInterface;
+} // namespace RDF
+} // namespace ROOT
+#endif
+
 /// \cond HIDDEN_SYMBOLS
 
 namespace ROOT {
@@ -344,6 +368,7 @@ public:
 template <typename HIST = Hist_t>
 class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
    std::vector<HIST *> fObjects;
+   std::unique_ptr<HIST> fModel; ///< The object that the slots other than the first copy in InitTask
 
    template <typename H = HIST, typename = decltype(std::declval<H>().Reset())>
    void ResetIfPossible(H *h)
@@ -460,14 +485,21 @@ public:
    FillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots) : fObjects(nSlots, nullptr)
    {
       fObjects[0] = h.get();
-      // Initialize all other slots
-      for (unsigned int i = 1; i < nSlots; ++i) {
-         fObjects[i] = new HIST(*fObjects[0]);
-         UnsetDirectoryIfPossible(fObjects[i]);
+      // the objects of the other slots are copied from the model by the thread that first fills them, so that their
+      // memory is local to it
+      if (nSlots > 1) {
+         fModel.reset(new HIST(*fObjects[0]));
+         UnsetDirectoryIfPossible(fModel.get());
       }
    }
 
-   void InitTask(TTreeReader *, unsigned int) {}
+   void InitTask(TTreeReader *, unsigned int slot)
+   {
+      if (!fObjects[slot]) {
+         fObjects[slot] = new HIST(*fModel);
+         UnsetDirectoryIfPossible(fObjects[slot]);
+      }
+   }
 
    // no container arguments
    template <typename... ValTypes, std::enable_if_t<!Disjunction<IsDataContainer<ValTypes>...>::value, int> = 0>
@@ -518,7 +550,11 @@ public:
       if (fObjects.size() == 1)
          return;
 
-      Merge(fObjects, /*toselectcorrectoverload=*/0);
+      // the slots which were never used have no object
+      std::vector<HIST *> objects;
+      std::copy_if(fObjects.begin(), fObjects.end(), std::back_inserter(objects), [](HIST *h) { return h; });
+      if (objects.size() > 1)
+         Merge(objects, /*toselectcorrectoverload=*/0);
 
       // delete the copies we created for the slots other than the first
       for (auto it = ++fObjects.begin(); it != fObjects.end(); ++it)
@@ -557,6 +593,418 @@ public:
    }
 };
 
+/// The binning of a histogram axis with bins of equal width, see FixedBinFillHelper
+struct RFixedBinAxis {
+   int fNBins = 0;
+   double fMin = 0.;
+   double fMax = 0.;
+
+   RFixedBinAxis(const TAxis &axis) : fNBins(axis.GetNbins()), fMin(axis.GetXmin()), fMax(axis.GetXmax()) {}
+};
+
+/// Compute the global bins of the n points with the given coordinates, one vector of coordinates per axis, with the
+/// same arithmetic as TAxis::FindBin() and TH1::GetBin(). inRange flags the points that are not in an under- or
+/// overflow bin of any axis.
+void ComputeFixedBins(const std::vector<RFixedBinAxis> &axes, const std::vector<double> *coords,
+                      std::vector<int> &bins, std::vector<unsigned char> &inRange);
+
+/// Add the contributions of the points to the statistics, in the layout of TH1::GetStats(). weights is empty for
+/// unweighted fills.
+void AddFixedBinStats(std::size_t nDims, const std::vector<double> *coords, const std::vector<double> &weights,
+                      const std::vector<unsigned char> &inRange, bool statOverflows, double *stats);
+
+/// Add the points to the bin contents and, if not null, to the sums of squared weights of a histogram, and update its
+/// statistics. bins and inRange are scratch space.
+void FillFixedBins(const std::vector<RFixedBinAxis> &axes, const std::vector<double> *coords,
+                   const std::vector<double> &weights, bool statOverflows, double *contents, double *sumw2,
+                   double *stats, std::vector<int> &bins, std::vector<unsigned char> &inRange);
+
+/// Whether the under- and overflows of the histogram enter its statistics, see TH1::StatOverflows()
+bool GetStatOverflowsBehaviour(const TH1 &h);
+
+/// The values passed to the Exec calls of a fill helper for histograms with fixed-width bins, buffered per slot
+template <unsigned int NDim>
+class RFixedBinFillBuffer {
+   template <typename T>
+   static std::size_t GetSize(const T &val)
+   {
+      if constexpr (IsDataContainer<T>::value)
+         return std::size(val);
+      else
+         return 1;
+   }
+
+   template <typename T>
+   static double GetValue(const T &val, std::size_t i)
+   {
+      if constexpr (IsDataContainer<T>::value)
+         return val[i];
+      else
+         return val;
+   }
+
+public:
+   /// Number of values per axis that are buffered. Sized so that the buffers of a slot stay in the L2 cache.
+   static constexpr std::size_t kMaxSize = 1024;
+
+   std::array<std::vector<double>, NDim> fCoords;
+   std::vector<double> fWeights; ///< Empty for unweighted fills
+   std::vector<int> fBins;
+   std::vector<unsigned char> fInRange;
+
+   std::size_t GetSize() const { return fCoords[0].size(); }
+   void Clear()
+   {
+      for (auto &coords : fCoords)
+         coords.clear();
+      fWeights.clear();
+   }
+
+   /// Append the values of one entry, calling flush() whenever the buffer is full. The values are NDim coordinates,
+   /// optionally followed by a weight; containers contribute one point per element, scalars are used for every
+   /// element of the containers.
+   template <typename Flush_t, typename... Xs>
+   void Push(Flush_t &&flush, const Xs &...xs)
+   {
+      static_assert(sizeof...(Xs) == NDim || sizeof...(Xs) == NDim + 1,
+                    "The number of columns does not match the dimension of the histogram.");
+      constexpr std::array<bool, sizeof...(Xs)> isContainer{{IsDataContainer<Xs>::value...}};
+      const std::array<std::size_t, sizeof...(Xs)> sizes{{GetSize(xs)...}};
+      std::size_t nValues = 1;
+      bool hasContainer = false;
+      for (std::size_t i = 0; i < sizeof...(Xs); ++i) {
+         if (!isContainer[i])
+            continue;
+         if (hasContainer && sizes[i] != nValues)
+            throw std::runtime_error("Cannot fill histogram with values in containers of different sizes.");
+         nValues = sizes[i];
+         hasContainer = true;
+      }
+
+      for (std::size_t i = 0; i < nValues; ++i) {
+         const std::array<double, sizeof...(Xs)> values{{GetValue(xs, i)...}};
+         for (unsigned int d = 0; d < NDim; ++d)
+            fCoords[d].push_back(values[d]);
+         if constexpr (sizeof...(Xs) > NDim)
+            fWeights.push_back(values[NDim]);
+         if (GetSize() == kMaxSize)
+            flush();
+      }
+   }
+
+   bool HasWeightsOtherThanOne() const
+   {
+      return std::any_of(fWeights.begin(), fWeights.end(), [](double w) { return w != 1.; });
+   }
+};
+
+/// Fill helper for TH1D, TH2D and TH3D histograms whose axes all have bins of equal width, used by Histo1D, Histo2D
+/// and Histo3D instead of FillHelper where possible, see HasFixedBinAxes(). Rather than calling TH1::Fill for every
+/// value, the values are buffered per slot; the bins of a full buffer are computed in one pass without virtual calls,
+/// in loops that the compiler can vectorize, and the buffer is then added directly to the bin arrays of the histogram
+/// of the slot. As with FillHelper, the per-slot histograms are merged at the end of the event loop.
+template <typename HIST, unsigned int NDim>
+class R__CLING_PTRCHECK(off) FixedBinFillHelper : public RActionImpl<FixedBinFillHelper<HIST, NDim>> {
+   struct RSlotData {
+      RFixedBinFillBuffer<NDim> fBuffer;
+      std::array<double, TH1::kNstat> fStats{}; ///< The statistics of the slot's histogram, see TH1::GetStats()
+      double fNEntries = 0.;
+   };
+
+   std::vector<HIST *> fObjects;
+   std::unique_ptr<HIST> fModel; ///< The histogram that the slots other than the first copy in InitTask
+   std::vector<RSlotData> fSlotData;
+   std::vector<RFixedBinAxis> fAxes;
+   bool fStatOverflows = false;
+
+   /// Add the buffered values of the slot to its histogram
+   void Flush(unsigned int slot)
+   {
+      auto &data = fSlotData[slot];
+      auto &buffer = data.fBuffer;
+      const auto n = buffer.GetSize();
+      if (n == 0)
+         return;
+      auto &h = *fObjects[slot];
+      // as in TH1::Fill, the first weight different from 1 triggers the storage of the sums of squared weights
+      if (h.GetSumw2N() == 0 && !h.TestBit(TH1::kIsNotW) && buffer.HasWeightsOtherThanOne())
+         h.Sumw2();
+      FillFixedBins(fAxes, buffer.fCoords.data(), buffer.fWeights, fStatOverflows, h.GetArray(),
+                    h.GetSumw2N() > 0 ? h.GetSumw2()->GetArray() : nullptr, data.fStats.data(), buffer.fBins,
+                    buffer.fInRange);
+      data.fNEntries += n;
+      h.PutStats(data.fStats.data());
+      h.SetEntries(data.fNEntries);
+      buffer.Clear();
+   }
+
+public:
+   FixedBinFillHelper(FixedBinFillHelper &&) = default;
+   FixedBinFillHelper(const FixedBinFillHelper &) = delete;
+
+   FixedBinFillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots)
+      : fObjects(nSlots, nullptr), fSlotData(nSlots)
+   {
+      fObjects[0] = h.get();
+      // the histograms of the other slots are copied from the model by the thread that first fills them, so that
+      // their memory is local to it
+      if (nSlots > 1) {
+         fModel.reset(new HIST(*fObjects[0]));
+         fModel->SetDirectory(nullptr);
+      }
+      const TAxis *axes[] = {h->GetXaxis(), h->GetYaxis(), h->GetZaxis()};
+      for (unsigned int d = 0; d < NDim; ++d)
+         fAxes.emplace_back(*axes[d]);
+      fStatOverflows = GetStatOverflowsBehaviour(*h);
+      for (unsigned int i = 0; i < nSlots; ++i) {
+         (i == 0 ? fObjects[0] : fModel.get())->GetStats(fSlotData[i].fStats.data());
+         fSlotData[i].fNEntries = fObjects[0]->GetEntries();
+      }
+   }
+
+   void InitTask(TTreeReader *, unsigned int slot)
+   {
+      if (!fObjects[slot]) {
+         fObjects[slot] = new HIST(*fModel);
+         fObjects[slot]->SetDirectory(nullptr);
+      }
+   }
+
+   template <typename... Xs>
+   void Exec(unsigned int slot, const Xs &...xs)
+   {
+      fSlotData[slot].fBuffer.Push([this, slot]() { Flush(slot); }, xs...);
+   }
+
+   void Initialize() { /* noop */}
+
+   void Finalize()
+   {
+      for (unsigned int slot = 0; slot < fObjects.size(); ++slot) {
+         if (fObjects[slot])
+            Flush(slot);
+      }
+      if (fObjects.size() == 1)
+         return;
+
+      TList l;
+      for (auto it = ++fObjects.begin(); it != fObjects.end(); ++it) {
+         // the slots which were never used have no histogram
+         if (*it)
+            l.Add(*it);
+      }
+      if (!l.IsEmpty())
+         fObjects[0]->Merge(&l);
+
+      // delete the copies we created for the slots other than the first
+      for (auto it = ++fObjects.begin(); it != fObjects.end(); ++it)
+         delete *it;
+   }
+
+   HIST &PartialUpdate(unsigned int slot)
+   {
+      Flush(slot);
+      return *fObjects[slot];
+   }
+
+   std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
+   {
+      return std::make_unique<RMergeableFill<HIST>>(*fObjects[0]);
+   }
+
+   std::string GetActionName()
+   {
+      return std::string(fObjects[0]->IsA()->GetName()) + "\\n" + std::string(fObjects[0]->GetName());
+   }
+
+   FixedBinFillHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<HIST> *>(newResult);
+      result->Reset();
+      result->SetDirectory(nullptr);
+      return FixedBinFillHelper(result, fObjects.size());
+   }
+};
+
+/// Fill helper that fills a single histogram from all slots, for histograms with so many bins that per-slot copies
+/// would take too much memory, see ROOT::RDF::Experimental::EnableSharedHistogramFilling(). As in histv7's concurrent
+/// fill manager, every slot buffers its values (see RFixedBinFillBuffer) and adds a full buffer to the shared
+/// histogram at once. The bins are divided into blocks that are assigned in turn to a fixed number of mutexes
+/// ("lock striping"), so that slots filling different parts of the histogram do not wait for each other. The
+/// statistics are accumulated separately under their own mutex. There is no merge step.
+template <typename HIST, unsigned int NDim>
+class R__CLING_PTRCHECK(off) SharedFillHelper : public RActionImpl<SharedFillHelper<HIST, NDim>> {
+   static constexpr std::size_t kNStripes = 256;
+   /// Number of consecutive bins protected by the same mutex (512 bytes of bin contents)
+   static constexpr std::size_t kStripeBlockSize = 64;
+
+   struct RSlotData {
+      RFixedBinFillBuffer<NDim> fBuffer;
+      std::vector<std::uint32_t> fStripeOffsets; ///< Per stripe, the first index into fOrder
+      std::vector<std::uint32_t> fOrder;         ///< Indexes of the buffered points, sorted by stripe
+      std::unique_ptr<HIST> fPartialResult;      ///< Snapshot of the shared histogram, see PartialUpdate()
+   };
+
+   /// The state shared by all slots, on the heap so that the helper stays movable
+   struct RSharedState {
+      std::array<std::mutex, kNStripes> fStripeMutexes;
+      std::mutex fStatsMutex;
+      std::array<double, TH1::kNstat> fStats{}; ///< Protected by fStatsMutex
+      double fNEntries = 0.;                    ///< Protected by fStatsMutex
+   };
+
+   std::shared_ptr<HIST> fResult;
+   std::vector<RSlotData> fSlotData;
+   std::vector<RFixedBinAxis> fAxes;
+   bool fStatOverflows = false;
+   std::unique_ptr<RSharedState> fShared;
+
+   static std::size_t GetStripe(int bin) { return (bin / kStripeBlockSize) % kNStripes; }
+
+   void LockAllStripes()
+   {
+      for (std::size_t i = 0; i < kNStripes; ++i)
+         fShared->fStripeMutexes[i].lock();
+   }
+
+   void UnlockAllStripes()
+   {
+      for (std::size_t i = 0; i < kNStripes; ++i)
+         fShared->fStripeMutexes[i].unlock();
+   }
+
+   /// Add the buffered values of the slot to the shared histogram
+   void Flush(unsigned int slot)
+   {
+      auto &data = fSlotData[slot];
+      auto &buffer = data.fBuffer;
+      const auto n = buffer.GetSize();
+      if (n == 0)
+         return;
+
+      // as in TH1::Fill, the first weight different from 1 triggers the storage of the sums of squared weights
+      if (!fResult->TestBit(TH1::kIsNotW) && buffer.HasWeightsOtherThanOne()) {
+         LockAllStripes();
+         if (fResult->GetSumw2N() == 0)
+            fResult->Sumw2();
+         UnlockAllStripes();
+      }
+
+      ComputeFixedBins(fAxes, buffer.fCoords.data(), buffer.fBins, buffer.fInRange);
+
+      // counting sort of the points by stripe, so that every stripe is locked at most once per buffer
+      auto &offsets = data.fStripeOffsets;
+      offsets.assign(kNStripes + 1, 0);
+      for (std::size_t i = 0; i < n; ++i)
+         ++offsets[GetStripe(buffer.fBins[i]) + 1];
+      for (std::size_t s = 0; s < kNStripes; ++s)
+         offsets[s + 1] += offsets[s];
+      data.fOrder.resize(n);
+      {
+         auto next = offsets;
+         for (std::size_t i = 0; i < n; ++i)
+            data.fOrder[next[GetStripe(buffer.fBins[i])]++] = i;
+      }
+
+      const bool hasWeights = !buffer.fWeights.empty();
+      double *contents = fResult->GetArray();
+      for (std::size_t s = 0; s < kNStripes; ++s) {
+         if (offsets[s] == offsets[s + 1])
+            continue;
+         std::lock_guard<std::mutex> lock(fShared->fStripeMutexes[s]);
+         // Sumw2() is only called while holding all the stripe mutexes
+         double *sumw2 = fResult->GetSumw2N() > 0 ? fResult->GetSumw2()->GetArray() : nullptr;
+         for (auto j = offsets[s]; j < offsets[s + 1]; ++j) {
+            const auto i = data.fOrder[j];
+            const double w = hasWeights ? buffer.fWeights[i] : 1.;
+            contents[buffer.fBins[i]] += w;
+            if (sumw2)
+               sumw2[buffer.fBins[i]] += w * w;
+         }
+      }
+
+      std::array<double, TH1::kNstat> stats{};
+      AddFixedBinStats(NDim, buffer.fCoords.data(), buffer.fWeights, buffer.fInRange, fStatOverflows, stats.data());
+      {
+         std::lock_guard<std::mutex> lock(fShared->fStatsMutex);
+         for (std::size_t i = 0; i < stats.size(); ++i)
+            fShared->fStats[i] += stats[i];
+         fShared->fNEntries += n;
+      }
+      buffer.Clear();
+   }
+
+public:
+   SharedFillHelper(SharedFillHelper &&) = default;
+   SharedFillHelper(const SharedFillHelper &) = delete;
+
+   SharedFillHelper(const std::shared_ptr<HIST> &h, const unsigned int nSlots)
+      : fResult(h), fSlotData(nSlots), fShared(std::make_unique<RSharedState>())
+   {
+      const TAxis *axes[] = {h->GetXaxis(), h->GetYaxis(), h->GetZaxis()};
+      for (unsigned int d = 0; d < NDim; ++d)
+         fAxes.emplace_back(*axes[d]);
+      fStatOverflows = GetStatOverflowsBehaviour(*h);
+      h->GetStats(fShared->fStats.data());
+      fShared->fNEntries = h->GetEntries();
+   }
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   template <typename... Xs>
+   void Exec(unsigned int slot, const Xs &...xs)
+   {
+      fSlotData[slot].fBuffer.Push([this, slot]() { Flush(slot); }, xs...);
+   }
+
+   void Initialize() { /* noop */}
+
+   void Finalize()
+   {
+      for (unsigned int slot = 0; slot < fSlotData.size(); ++slot)
+         Flush(slot);
+      fResult->PutStats(fShared->fStats.data());
+      fResult->SetEntries(fShared->fNEntries);
+   }
+
+   /// Return a snapshot of the shared histogram, which includes the values filled by the other slots so far
+   HIST &PartialUpdate(unsigned int slot)
+   {
+      Flush(slot);
+      auto &partial = fSlotData[slot].fPartialResult;
+      LockAllStripes();
+      if (!partial) {
+         partial = std::make_unique<HIST>(*fResult);
+         partial->SetDirectory(nullptr);
+      } else {
+         fResult->Copy(*partial);
+      }
+      UnlockAllStripes();
+      std::lock_guard<std::mutex> lock(fShared->fStatsMutex);
+      partial->PutStats(fShared->fStats.data());
+      partial->SetEntries(fShared->fNEntries);
+      return *partial;
+   }
+
+   std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
+   {
+      return std::make_unique<RMergeableFill<HIST>>(*fResult);
+   }
+
+   std::string GetActionName()
+   {
+      return std::string(fResult->IsA()->GetName()) + "\\n" + std::string(fResult->GetName());
+   }
+
+   SharedFillHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<HIST> *>(newResult);
+      result->Reset();
+      result->SetDirectory(nullptr);
+      return SharedFillHelper(result, fSlotData.size());
+   }
+};
+
 class R__CLING_PTRCHECK(off) FillTGraphHelper : public ROOT::Detail::RDF::RActionImpl<FillTGraphHelper> {
 public:
    using Result_t = ::TGraph;
@@ -1639,6 +2087,9 @@ public:
       return [this](unsigned int, const RSampleInfo &) mutable { fBranchAddressesNeedReset = true; };
    }
 
+   // the output branches point to the addresses of the input values
+   bool SupportsBulkProcessing() const final { return false; }
+
    /**
     * @brief Create a new SnapshotHelper with a different output file name
     *
@@ -1824,6 +2275,9 @@ public:
       return [this](unsigned int slot, const RSampleInfo &) mutable { fBranchAddressesNeedReset[slot] = 1; };
    }
 
+   // the output branches point to the addresses of the input values
+   bool SupportsBulkProcessing() const final { return false; }
+
    /**
     * @brief Create a new SnapshotHelperMT with a different output file name
     *
@@ -1843,6 +2297,122 @@ public:
    }
 };
 
+#ifdef R__HAS_ROOT7
+using SnapshotOutputDataFrame_t = ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager, void>;
+
+/// Throw if the snapshot options or the output directory are not supported for RNTuple output
+void ValidateSnapshotRNTupleOutput(const RSnapshotOptions &opts, const std::string &dirName);
+/// Create the parallel writer of an RNTuple Snapshot according to the snapshot options
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+MakeSnapshotRNTupleWriter(std::unique_ptr<ROOT::Experimental::RNTupleModel> model, const std::string &ntupleName,
+                          const std::string &fileName, const RSnapshotOptions &options);
+/// Make the RDataFrame returned by an RNTuple Snapshot read the written ntuple
+void SetSnapshotRNTupleOutput(SnapshotOutputDataFrame_t &outputDataFrame, const std::string &ntupleName,
+                              const std::string &fileName);
+
+/// Helper object for a Snapshot action that writes an RNTuple, used both in single-thread and multi-thread runs
+///
+/// Every slot fills the entries through its own RNTupleFillContext of a common RNTupleParallelWriter, so that the
+/// pages are compressed in parallel by the slots.  Only the commit of the filled clusters to the output file is
+/// serialized.  As with the TTree output in multi-thread runs, the order of the entries in the output is not
+/// deterministic.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   unsigned int fNSlots;
+   std::string fFileName;
+   std::string fNTupleName;
+   RSnapshotOptions fOptions;
+   ColumnNames_t fOutputFieldNames;
+   /// The RDataFrame returned by Snapshot, reset to read the output once it is written
+   std::shared_ptr<SnapshotOutputDataFrame_t> fOutputDataFrame;
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   std::vector<std::shared_ptr<ROOT::Experimental::RNTupleFillContext>> fFillContexts;
+   /// Per slot, an entry of the fill context's model whose values point to the column values of the slot
+   std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fEntries;
+   /// Per slot, the addresses of the column values the entry currently points to
+   std::vector<std::vector<void *>> fValueAddresses;
+
+   template <std::size_t... S>
+   void AddFields(ROOT::Experimental::RNTupleModel &model, std::index_sequence<S...> /*dummy*/)
+   {
+      int expander[] = {
+         (model.AddField(std::make_unique<ROOT::Experimental::RField<ColTypes>>(fOutputFieldNames[S])), 0)..., 0};
+      (void)expander;
+   }
+
+   template <std::size_t... S>
+   void UpdateValuePtrs(unsigned int slot, ColTypes &...values, std::index_sequence<S...> /*dummy*/)
+   {
+      // The addresses of the column values change rarely, e.g. when a new input tree is opened
+      auto &addresses = fValueAddresses[slot];
+      int expander[] = {(addresses[S] != &values ? fEntries[slot]->CaptureValueUnsafe(fOutputFieldNames[S], &values),
+                         addresses[S] = &values, 0 : 0, 0)...,
+                        0};
+      (void)expander;
+   }
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &fieldNames, const RSnapshotOptions &options,
+                         std::shared_ptr<SnapshotOutputDataFrame_t> outputDataFrame)
+      : fNSlots(nSlots), fFileName(filename), fNTupleName(ntuplename), fOptions(options),
+        fOutputFieldNames(ReplaceDotWithUnderscore(fieldNames)), fOutputDataFrame(std::move(outputDataFrame)),
+        fFillContexts(fNSlots), fEntries(fNSlots), fValueAddresses(fNSlots, std::vector<void *>(fieldNames.size()))
+   {
+      ValidateSnapshotRNTupleOutput(fOptions, std::string(dirname));
+   }
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+   ~SnapshotRNTupleHelper()
+   {
+      if (!fNTupleName.empty() /*not moved from*/ && fOptions.fLazy && fOutputDataFrame /* never run */)
+         Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
+   }
+
+   void Initialize()
+   {
+      auto model = ROOT::Experimental::RNTupleModel::Create();
+      AddFields(*model, std::index_sequence_for<ColTypes...>{});
+      fWriter = MakeSnapshotRNTupleWriter(std::move(model), fNTupleName, fFileName, fOptions);
+   }
+
+   void InitTask(TTreeReader *, unsigned int slot)
+   {
+      if (!fFillContexts[slot]) {
+         fFillContexts[slot] = fWriter->CreateFillContext();
+         fEntries[slot] = fFillContexts[slot]->GetModel()->CreateBareEntry();
+         std::fill(fValueAddresses[slot].begin(), fValueAddresses[slot].end(), nullptr);
+      }
+   }
+
+   void Exec(unsigned int slot, ColTypes &...values)
+   {
+      UpdateValuePtrs(slot, values..., std::index_sequence_for<ColTypes...>{});
+      fFillContexts[slot]->Fill(*fEntries[slot]);
+   }
+
+   void Finalize()
+   {
+      if (std::all_of(fFillContexts.begin(), fFillContexts.end(), [](const auto &c) { return !c; })) {
+         Warning("Snapshot",
+                 "No input entries (input dataset was empty or no entry passed the Filters). Output RNTuple is empty.");
+      }
+      // Destructing the fill contexts commits their last clusters, destructing the writer writes the footer
+      fEntries.clear();
+      fFillContexts.clear();
+      fWriter.reset();
+      SetSnapshotRNTupleOutput(*fOutputDataFrame, fNTupleName, fFileName);
+      fOutputDataFrame.reset();
+   }
+
+   std::string GetActionName() { return "Snapshot"; }
+
+   // the entries point to the addresses of the input values
+   bool SupportsBulkProcessing() const final { return false; }
+};
+#endif // R__HAS_ROOT7
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class R__CLING_PTRCHECK(off) AggregateHelper
@@ -29,6 +29,8 @@
 #include <ROOT/TypeTraits.hxx>
 #include <TError.h> // gErrorIgnoreLevel
 #include <TH1.h>
+#include <TH2.h>
+#include <TH3.h>
 #include <TROOT.h> // IsImplicitMTEnabled
 
 #include <deque>
@@ -125,7 +127,47 @@ struct HistoUtils<T, false> {
    static bool HasAxisLimits(T &) { return true; }
 };
 
-// Generic filling (covers Histo2D, Histo3D, HistoND, Profile1D and Profile2D actions, with and without weights)
+/// Whether all the axes of the histogram have bins of equal width and can neither be extended nor carry labels, and
+/// whether the histogram is unbuffered, so that FixedBinFillHelper can fill it
+bool HasFixedBinAxes(const TH1 &h);
+
+/// Whether FixedBinFillHelper can fill a histogram with the values of a column of type T: scalars convertible to
+/// double and containers of such values with element access by index
+template <typename T, typename = void>
+struct IsFixedBinFillable
+   : std::integral_constant<bool, !IsDataContainer<T>::value && std::is_convertible<T, double>::value> {};
+
+template <typename T>
+struct IsFixedBinFillable<
+   T, std::enable_if_t<IsDataContainer<T>::value, std::void_t<decltype(std::declval<const T &>()[0])>>>
+   : std::is_convertible<decltype(std::declval<const T &>()[0]), double> {};
+
+/// Use SharedFillHelper for large histograms if requested, FixedBinFillHelper where possible, FillHelper otherwise
+template <unsigned int NDim, typename... ColTypes, typename Hist_t, typename PrevNodeType>
+std::unique_ptr<RActionBase> BuildHistoAction(const ColumnNames_t &bl, const std::shared_ptr<Hist_t> &h,
+                                              const unsigned int nSlots, std::shared_ptr<PrevNodeType> prevNode,
+                                              const RColumnRegister &colRegister)
+{
+   if constexpr ((IsFixedBinFillable<ColTypes>::value && ...)) {
+      const auto sharedFillMinNCells = prevNode->GetLoopManagerUnchecked()->GetSharedFillMinNCells();
+      if (nSlots > 1 && sharedFillMinNCells > 0 && std::size_t(h->GetNcells()) >= sharedFillMinNCells &&
+          HasFixedBinAxes(*h)) {
+         using Helper_t = SharedFillHelper<Hist_t, NDim>;
+         using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+         return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+      }
+      if (HasFixedBinAxes(*h)) {
+         using Helper_t = FixedBinFillHelper<Hist_t, NDim>;
+         using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+         return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+      }
+   }
+   using Helper_t = FillHelper<Hist_t>;
+   using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+   return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+}
+
+// Generic filling (covers HistoND, Profile1D and Profile2D actions, with and without weights)
 template <typename... ColTypes, typename ActionTag, typename ActionResultType, typename PrevNodeType>
 std::unique_ptr<RActionBase>
 BuildAction(const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &h, const unsigned int nSlots,
@@ -145,9 +187,7 @@ BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH1D> &h, const uns
    auto hasAxisLimits = HistoUtils<::TH1D>::HasAxisLimits(*h);
 
    if (hasAxisLimits || !IsImplicitMTEnabled()) {
-      using Helper_t = FillHelper<::TH1D>;
-      using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
-      return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+      return BuildHistoAction<1, ColTypes...>(bl, h, nSlots, std::move(prevNode), colRegister);
    } else {
       using Helper_t = BufferedFillHelper;
       using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
@@ -155,6 +195,22 @@ BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH1D> &h, const uns
    }
 }
 
+template <typename... ColTypes, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH2D> &h, const unsigned int nSlots,
+            std::shared_ptr<PrevNodeType> prevNode, ActionTags::Histo2D, const RColumnRegister &colRegister)
+{
+   return BuildHistoAction<2, ColTypes...>(bl, h, nSlots, std::move(prevNode), colRegister);
+}
+
+template <typename... ColTypes, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH3D> &h, const unsigned int nSlots,
+            std::shared_ptr<PrevNodeType> prevNode, ActionTags::Histo3D, const RColumnRegister &colRegister)
+{
+   return BuildHistoAction<3, ColTypes...>(bl, h, nSlots, std::move(prevNode), colRegister);
+}
+
 template <typename... ColTypes, typename PrevNodeType>
 std::unique_ptr<RActionBase>
 BuildAction(const ColumnNames_t &bl, const std::shared_ptr<TGraph> &g, const unsigned int nSlots,
@@ -250,6 +306,8 @@ struct SnapshotHelperArgs {
    std::string fTreeName;
    std::vector<std::string> fOutputColNames;
    ROOT::RDF::RSnapshotOptions fOptions;
+   /// For RNTuple output, the RDataFrame returned by Snapshot that is switched to the output after the event loop
+   std::shared_ptr<ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager, void>> fOutputDataFrame;
 };
 
 // Snapshot action
@@ -275,6 +333,19 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    std::vector<bool> isDefine = makeIsDefine();
 
    std::unique_ptr<RActionBase> actionPtr;
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+#ifdef R__HAS_ROOT7
+      // single- and multi-thread snapshot, with one fill context per slot
+      using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+      using Action_t = RAction<Helper_t, PrevNodeType>;
+      actionPtr.reset(new Action_t(Helper_t(nSlots, filename, dirname, treename, outputColNames, options,
+                                            snapHelperArgs->fOutputDataFrame),
+                                   colNames, prevNode, colRegister));
+      return actionPtr;
+#else
+      throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7");
+#endif
+   }
    if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
@@ -781,6 +852,13 @@ AddSizeBranches(const std::vector<std::string> &branches, TTree *tree, std::vect
 
 void RemoveDuplicates(ColumnNames_t &columnNames);
 
+/// Writes the columns of a PersistentCache, given the name of the RNTuple and the file to write
+using PersistentCacheWriter_t = std::function<void(const std::string &, const std::string &)>;
+/// Make cachedDF read the cache file of the given columns of the node, calling writeCache first if there is none
+void OpenPersistentCache(RInterface<RLoopManager, void> &cachedDF, const std::string &cacheDir, RNodeBase &node,
+                         const ColumnNames_t &columns, const ColumnNames_t &columnTypes,
+                         const PersistentCacheWriter_t &writeCache);
+
 } // namespace RDF
 } // namespace Internal
 
@@ -13,9 +13,11 @@
 
 #include "ROOT/RDataFrame.hxx"
 
-#include <vector>
+#include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
@@ -69,6 +71,71 @@ ROOT::RDF::RResultPtr<std::vector<T>> RDataFrameTake(ROOT::RDF::RNode df, std::s
    return df.Take<T>(column);
 }
 
+/// Content of a collection column, stored as in Arrow list arrays: the values of all entries one after
+/// the other and the offsets of the first value of each entry, followed by the total number of values.
+template <typename T>
+struct RFlattenedColumn {
+   using Value_t = std::conditional_t<std::is_same<T, bool>::value, unsigned char, T>;
+   std::vector<Value_t> fValues;      ///< values of all entries
+   std::vector<Long64_t> fOffsets{0}; ///< offset of each entry in fValues, size is the number of entries + 1
+};
+
+/// Action filling a RFlattenedColumn, used by AsNumpy to export collections of fundamental types
+/// to contiguous NumPy buffers without creating one object per entry.
+template <typename T>
+class FlattenHelper : public ROOT::Detail::RDF::RActionImpl<FlattenHelper<T>> {
+   using Column_t = RFlattenedColumn<T>;
+   std::shared_ptr<Column_t> fResult;
+   std::vector<Column_t> fSlots; ///< partial results, appended in slot order, as in Take
+
+public:
+   using ColumnTypes_t = ROOT::TypeTraits::TypeList<ROOT::RVec<T>>;
+   using Result_t = Column_t;
+
+   FlattenHelper(const std::shared_ptr<Column_t> &result, unsigned int nSlots) : fResult(result), fSlots(nSlots) {}
+   FlattenHelper(FlattenHelper &&) = default;
+   FlattenHelper(const FlattenHelper &) = delete;
+
+   void InitTask(TTreeReader *, unsigned int) {}
+   void Initialize() {}
+
+   void Exec(unsigned int slot, const ROOT::RVec<T> &values)
+   {
+      auto &column = fSlots[slot];
+      column.fValues.insert(column.fValues.end(), values.begin(), values.end());
+      column.fOffsets.push_back(column.fValues.size());
+   }
+
+   void Finalize()
+   {
+      std::size_t nValues = 0, nEntries = 0;
+      for (auto &column : fSlots) {
+         nValues += column.fValues.size();
+         nEntries += column.fOffsets.size() - 1;
+      }
+      fResult->fValues.reserve(nValues);
+      fResult->fOffsets.reserve(nEntries + 1);
+      for (auto &column : fSlots) {
+         const Long64_t shift = fResult->fValues.size();
+         fResult->fValues.insert(fResult->fValues.end(), column.fValues.begin(), column.fValues.end());
+         for (std::size_t i = 1; i < column.fOffsets.size(); ++i)
+            fResult->fOffsets.push_back(shift + column.fOffsets[i]);
+         column = Column_t{};
+      }
+   }
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fResult; }
+
+   std::string GetActionName() { return "TakeFlattened"; }
+};
+
+template <typename T>
+ROOT::RDF::RResultPtr<RFlattenedColumn<T>> RDataFrameTakeFlattened(ROOT::RDF::RNode df, std::string_view column)
+{
+   auto result = std::make_shared<RFlattenedColumn<T>>();
+   return df.Book<ROOT::RVec<T>>(FlattenHelper<T>(result, df.GetNSlots()), {std::string(column)});
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
@@ -17,12 +17,15 @@
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t, IsInternalColumn
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RDF/RVariedAction.hxx"
 
+#include <algorithm>
 #include <array>
 #include <cstddef> // std::size_t
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace ROOT {
@@ -62,10 +65,14 @@ class R__CLING_PTRCHECK(off) RAction : public RActionBase {
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
+   /// Per slot, the entries of the current bulk that pass the filters upstream, see RunBulk()
+   std::vector<ROOT::RVecB> fBulkMask;
+
 public:
    RAction(Helper &&h, const ColumnNames_t &columns, std::shared_ptr<PrevNode> pd, const RColumnRegister &colRegister)
       : RActionBase(pd->GetLoopManagerUnchecked(), columns, colRegister, pd->GetVariations()),
-        fHelper(std::forward<Helper>(h)), fPrevNodePtr(std::move(pd)), fPrevNode(*fPrevNodePtr), fValues(GetNSlots())
+        fHelper(std::forward<Helper>(h)), fPrevNodePtr(std::move(pd)), fPrevNode(*fPrevNodePtr), fValues(GetNSlots()),
+        fBulkMask(GetNSlots())
    {
       fLoopManager->Register(this);
 
@@ -108,8 +115,48 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       // check if entry passes all filters
-      if (fPrevNode.CheckFilters(slot, entry))
+      if (fPrevNode.CheckFilters(slot, entry)) {
+         if (fProfiler)
+            fProfiler->CountCall(slot, fProfileId);
+         RProfiler::RScope profileScope(fProfiler, slot, fProfileId);
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+      }
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void CallExecBulk(unsigned int slot, Long64_t firstEntry, const ROOT::RVecB &mask, TypeList<ColTypes...>,
+                     std::index_sequence<S...>)
+   {
+      const auto size = mask.size();
+      std::tuple<ColTypes *...> bulkValues{
+         fValues[slot][S]->template TryGetBulk<ColTypes>(firstEntry, mask.data(), size)...};
+      for (std::size_t i = 0; i < size; ++i) {
+         if (!mask[i])
+            continue;
+         fHelper.Exec(slot, (std::get<S>(bulkValues) ? std::get<S>(bulkValues)[i]
+                                                      : fValues[slot][S]->template Get<ColTypes>(firstEntry + i))...);
+      }
+      (void)bulkValues; // avoid unused variable warnings for actions without input columns
+   }
+
+   void RunBulk(unsigned int slot, Long64_t firstEntry, const ROOT::RVecB &mask) final
+   {
+      auto &bulkMask = fBulkMask[slot];
+      bulkMask = mask;
+      fPrevNode.CheckFiltersBulk(slot, firstEntry, bulkMask);
+      CallExecBulk(slot, firstEntry, bulkMask, ColumnTypes_t{}, TypeInd_t{});
+   }
+
+   bool CanRunBulk() const final
+   {
+      return fHelper.SupportsBulkProcessing() &&
+             std::none_of(fIsDefine.begin(), fIsDefine.end(), [](bool isDefine) { return isDefine; }) &&
+             fPrevNode.CanCheckFiltersBulk();
+   }
+
+   std::vector<ROOT::RDF::Experimental::RColumnPredicate> GetPushdownPredicates() const final
+   {
+      return fPrevNode.GetPushdownPredicates();
    }
 
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
@@ -137,8 +184,9 @@ public:
 
       // Action nodes do not need to go through CreateFilterNode: they are never common nodes between multiple branches
       const auto nodeType = HasRun() ? RDFGraphDrawing::ENodeType::kUsedAction : RDFGraphDrawing::ENodeType::kAction;
-      auto thisNode =
-         std::make_shared<RDFGraphDrawing::GraphNode>(fHelper.GetActionName(), visitedMap.size(), nodeType);
+      const auto profileLabel = fProfiler ? "\\n" + fProfiler->GetGraphLabel(fProfileId) : "";
+      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>(fHelper.GetActionName() + profileLabel,
+                                                                   visitedMap.size(), nodeType);
       visitedMap[(void *)this] = thisNode;
 
       auto upmostNode = AddDefinesToGraph(thisNode, GetColRegister(), prevColumns, visitedMap);
@@ -152,6 +200,14 @@ public:
    /// user-defined callback registered via RResultPtr::RegisterCallback
    void *PartialUpdate(unsigned int slot) final { return fHelper.CallPartialUpdate(slot); }
 
+   void SetProfiler(RProfiler &profiler) final
+   {
+      if (fProfiler)
+         return;
+      fProfiler = &profiler;
+      fProfileId = profiler.RegisterNode(RProfiler::ENodeKind::kAction, fHelper.GetActionName());
+   }
+
    std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) final
    {
       const auto nVariations = GetVariations().size();
@@ -11,13 +11,16 @@
 #ifndef ROOT_RACTIONBASE
 #define ROOT_RACTIONBASE
 
+#include "ROOT/RDF/RColumnPredicate.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
+#include "ROOT/RVec.hxx"
 #include "RtypesCore.h"
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ROOT {
 
@@ -34,6 +37,7 @@ namespace RDF {
 namespace GraphDrawing {
 class GraphNode;
 }
+class RProfiler;
 
 using namespace ROOT::Detail::RDF;
 
@@ -42,6 +46,8 @@ protected:
    /// A raw pointer to the RLoopManager at the root of this functional graph.
    /// Never null: children nodes have shared ownership of parent nodes in the graph.
    RLoopManager *fLoopManager;
+   RProfiler *fProfiler = nullptr; ///< Set if profiling is enabled, see RLoopManager::EnableProfiling()
+   unsigned int fProfileId = 0;    ///< The id of this node in fProfiler
 
 private:
    const unsigned int fNSlots; ///< Number of thread slots used by this node.
@@ -64,6 +70,20 @@ public:
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Process the entries [firstEntry, firstEntry + mask.size()) whose flag is set in the mask
+   virtual void RunBulk(unsigned int slot, Long64_t firstEntry, const ROOT::RVecB &mask)
+   {
+      for (std::size_t i = 0; i < mask.size(); ++i) {
+         if (mask[i])
+            Run(slot, firstEntry + i);
+      }
+   }
+   /// Whether the action can process a bulk of entries with RunBulk() before the rest of the computation graph
+   /// processes these entries
+   virtual bool CanRunBulk() const { return false; }
+   /// The column predicates that all the entries processed by this action satisfy, see
+   /// RNodeBase::GetPushdownPredicates()
+   virtual std::vector<ROOT::RDF::Experimental::RColumnPredicate> GetPushdownPredicates() const { return {}; }
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -92,6 +112,10 @@ public:
 
    virtual std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) = 0;
    virtual std::unique_ptr<RActionBase> CloneAction(void *newResult) = 0;
+
+   /// Register this node with the profiler unless it is registered already. Only RAction is profiled: jitted actions
+   /// are registered through their concrete action.
+   virtual void SetProfiler(RProfiler &) {}
 };
 } // namespace RDF
 } // namespace Internal
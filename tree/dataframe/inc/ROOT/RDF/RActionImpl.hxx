@@ -71,6 +71,11 @@ public:
    /// Override this method to register a callback that is executed before the processing a new data sample starts.
    /// The callback will be invoked in the same conditions as with DefinePerSample().
    virtual ROOT::RDF::SampleCallback_t GetSampleCallback() { return {}; }
+
+   /// Override this method to return false if the helper relies on the addresses of the column values staying the
+   /// same from one entry to the next, e.g. because it keeps pointers to them. With bulk processing (see
+   /// ROOT::RDF::Experimental::EnableBulkProcessing()), the values of consecutive entries are at different addresses.
+   virtual bool SupportsBulkProcessing() const { return true; }
 };
 
 } // namespace RDF
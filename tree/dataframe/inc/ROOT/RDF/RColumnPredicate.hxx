@@ -0,0 +1,58 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RCOLUMNPREDICATE
+#define ROOT_RDF_RCOLUMNPREDICATE
+
+#include <string>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/**
+\ingroup dataframe
+\brief A comparison of the values of a data source column with a constant, e.g. `pt > 10`
+
+Column predicates are extracted from jitted Filter expressions that are conjunctions of such comparisons. Before an
+event loop, RDataFrame offers the predicates that every entry of interest satisfies to the data source, see
+RDataSource::SetPredicates().
+*/
+struct RColumnPredicate {
+   enum class EOperator { kLess, kLessEqual, kGreater, kGreaterEqual, kEqual, kNotEqual };
+
+   std::string fColumnName;
+   EOperator fOperator = EOperator::kEqual;
+   double fValue = 0.0;
+
+   bool operator==(const RColumnPredicate &other) const
+   {
+      return fColumnName == other.fColumnName && fOperator == other.fOperator && fValue == other.fValue;
+   }
+   bool operator!=(const RColumnPredicate &other) const { return !(*this == other); }
+
+   /// Whether the value passes the predicate
+   bool Test(double value) const
+   {
+      switch (fOperator) {
+      case EOperator::kLess: return value < fValue;
+      case EOperator::kLessEqual: return value <= fValue;
+      case EOperator::kGreater: return value > fValue;
+      case EOperator::kGreaterEqual: return value >= fValue;
+      case EOperator::kEqual: return value == fValue;
+      case EOperator::kNotEqual: return value != fValue;
+      }
+      return true;
+   }
+};
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_RCOLUMNPREDICATE
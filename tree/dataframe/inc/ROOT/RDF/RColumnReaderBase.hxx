@@ -13,7 +13,15 @@
 
 #include <Rtypes.h>
 
+#include <cstddef>
+
 namespace ROOT {
+namespace Internal {
+namespace RDF {
+class RProfiledColumnReader;
+}
+} // namespace Internal
+
 namespace Detail {
 namespace RDF {
 
@@ -26,6 +34,8 @@ This pure virtual class provides a common base class for the different column re
 RDSColumnReader.
 **/
 class R__CLING_PTRCHECK(off) RColumnReaderBase {
+   friend class ROOT::Internal::RDF::RProfiledColumnReader;
+
 public:
    virtual ~RColumnReaderBase() = default;
 
@@ -38,8 +48,19 @@ public:
       return *static_cast<T *>(GetImpl(entry));
    }
 
+   /// Return the array of the column values for the `size` entries starting at `firstEntry`, or nullptr if the reader
+   /// cannot provide the values of this range in bulk (the caller then falls back to Get()). Only the values of the
+   /// entries whose flag is set in `mask` are guaranteed to be valid; they remain valid until the next call.
+   /// \tparam T The column type
+   template <typename T>
+   T *TryGetBulk(Long64_t firstEntry, const bool *mask, std::size_t size)
+   {
+      return static_cast<T *>(GetBulkImpl(firstEntry, mask, size));
+   }
+
 private:
    virtual void *GetImpl(Long64_t entry) = 0;
+   virtual void *GetBulkImpl(Long64_t /*firstEntry*/, const bool * /*mask*/, std::size_t /*size*/) { return nullptr; }
 };
 
 } // namespace RDF
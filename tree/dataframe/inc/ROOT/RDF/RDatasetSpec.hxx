@@ -49,6 +49,7 @@ private:
    std::vector<RSample> fSamples;             ///< List of samples
    ROOT::TreeUtils::RFriendInfo fFriendInfo;  ///< List of friends
    REntryRange fEntryRange; ///< Start (inclusive) and end (exclusive) entry for the dataset processing
+   std::string fMetadataCatalog; ///< Cache of the entries and cluster boundaries of the trees, see WithMetadataCatalog()
 
    std::vector<RSample> MoveOutSamples();
 
@@ -62,6 +63,7 @@ public:
    const ROOT::TreeUtils::RFriendInfo &GetFriendInfo() const;
    Long64_t GetEntryRangeBegin() const;
    Long64_t GetEntryRangeEnd() const;
+   const std::string &GetMetadataCatalog() const;
 
    RDatasetSpec &AddSample(RSample sample);
 
@@ -78,6 +80,8 @@ public:
                                    const std::vector<std::string> &fileNameGlobs, const std::string &alias = "");
 
    RDatasetSpec &WithGlobalRange(const RDatasetSpec::REntryRange &entryRange = {});
+
+   RDatasetSpec &WithMetadataCatalog(const std::string &catalog);
 };
 
 } // namespace Experimental
@@ -15,13 +15,16 @@
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RStringView.hxx"
+#include "ROOT/RVec.hxx"
 #include "ROOT/TypeTraits.hxx"
 #include "RtypesCore.h"
 
 #include <array>
 #include <deque>
+#include <tuple>
 #include <type_traits>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -59,10 +62,20 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    // Avoid instantiating vector<bool> as `operator[]` returns temporaries in that case. Use std::deque instead.
    using ValuesPerSlot_t =
       std::conditional_t<std::is_same<ret_type, bool>::value, std::deque<ret_type>, std::vector<ret_type>>;
+   // only expressions of fundamental type without extra arguments are evaluated in bulks
+   static constexpr bool kIsBulkCallable = std::is_same<ExtraArgsTag, NoneTag>::value &&
+                                           std::is_arithmetic<ret_type>::value &&
+                                           RDFInternal::IsBulkCallable<F, ret_type, ColumnTypes_t>::value;
 
    F fExpression;
    ValuesPerSlot_t fLastResults;
 
+   /// Per slot (with a stride of CacheLineStep), the first entry of the bulk whose values are in fBulkValues
+   std::vector<Long64_t> fBulkFirstEntry;
+   /// Per slot, the values of the expression for the entries of the last bulk, empty if they could not be computed
+   /// in one call. Only used for bulk callables.
+   std::vector<ROOT::RVec<std::conditional_t<kIsBulkCallable, ret_type, char>>> fBulkValues;
+
    /// Column readers per slot and per input column
    std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>> fValues;
 
@@ -70,19 +83,35 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    /// The map key is the full variation name, e.g. "pt:up".
    std::unordered_map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
 
+   /// Cache the value of the expression for the current entry.
+   void StoreResult(unsigned int slot, ret_type &&result)
+   {
+      auto &value = fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()];
+      if constexpr (!std::is_trivially_copyable<ret_type>::value) {
+         if (fLoopManager->GetRVecArena(slot)) {
+            // the cached value may hold RVec buffers in the arena, which was reset after the previous entry:
+            // it must be replaced rather than assigned to, lest the new value is copied into those buffers
+            value.~ret_type();
+            new (&value) ret_type(std::move(result));
+            return;
+         }
+      }
+      value = std::move(result);
+   }
+
    template <typename... ColTypes, std::size_t... S>
    void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      StoreResult(slot, RDFInternal::CallWithRVecArena(fLoopManager->GetRVecArena(slot), fExpression,
+                                                       fValues[slot][S]->template Get<ColTypes>(entry)...));
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
 
    template <typename... ColTypes, std::size_t... S>
    void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      StoreResult(slot, RDFInternal::CallWithRVecArena(fLoopManager->GetRVecArena(slot), fExpression, slot,
+                                                       fValues[slot][S]->template Get<ColTypes>(entry)...));
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
 
@@ -90,8 +119,43 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    void
    UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotAndEntryTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      StoreResult(slot, RDFInternal::CallWithRVecArena(fLoopManager->GetRVecArena(slot), fExpression, slot, entry,
+                                                       fValues[slot][S]->template Get<ColTypes>(entry)...));
+   }
+
+   /// Evaluate the expression for all entries of the bulk that the event loop is processing, if the input values of
+   /// the bulk are available at once. Return false if the value of the entry must be computed on its own.
+   bool UpdateFromBulk(unsigned int slot, Long64_t entry)
+   {
+      const auto &bulk = fLoopManager->GetCurrentBulk(slot);
+      if (bulk.fSize <= 1 || entry < bulk.fFirstEntry ||
+          entry >= bulk.fFirstEntry + static_cast<Long64_t>(bulk.fSize))
+         return false;
+      auto &bulkFirstEntry = fBulkFirstEntry[slot * RDFInternal::CacheLineStep<Long64_t>()];
+      auto &values = fBulkValues[slot];
+      if (bulkFirstEntry != bulk.fFirstEntry) {
+         bulkFirstEntry = bulk.fFirstEntry;
+         UpdateBulkHelper(slot, bulk, ColumnTypes_t{}, TypeInd_t{});
+      }
+      if (values.empty())
+         return false;
+      StoreResult(slot, ret_type(values[entry - bulkFirstEntry]));
+      return true;
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateBulkHelper(unsigned int slot, const RBulkRange &bulk, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      auto &values = fBulkValues[slot];
+      values.clear();
+      // which entries pass the filters upstream is not known yet: all entries of the bulk are evaluated
+      const ROOT::RVecB mask(bulk.fSize, true);
+      std::tuple<ColTypes *...> bulkValues{
+         fValues[slot][S]->template TryGetBulk<ColTypes>(bulk.fFirstEntry, mask.data(), bulk.fSize)...};
+      if (!(true && ... && std::get<S>(bulkValues)))
+         return;
+      values.resize(bulk.fSize);
+      fExpression.CallBulk(bulk.fSize, mask.data(), values.data(), std::get<S>(bulkValues)...);
    }
 
 public:
@@ -99,7 +163,9 @@ public:
            const RDFInternal::RColumnRegister &colRegister, RLoopManager &lm,
            const std::string &variationName = "nominal")
       : RDefineBase(name, type, colRegister, lm, columns, variationName), fExpression(std::move(expression)),
-        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots())
+        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()),
+        fBulkFirstEntry(kIsBulkCallable ? lm.GetNSlots() * RDFInternal::CacheLineStep<Long64_t>() : 0u, -1),
+        fBulkValues(kIsBulkCallable ? lm.GetNSlots() : 0u), fValues(lm.GetNSlots())
    {
       fLoopManager->Register(this);
    }
@@ -113,6 +179,10 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      if constexpr (kIsBulkCallable) {
+         fBulkFirstEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+         fBulkValues[slot].clear();
+      }
    }
 
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
@@ -124,9 +194,16 @@ public:
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    void Update(unsigned int slot, Long64_t entry) final
    {
+      if (fProfiler)
+         fProfiler->CountCall(slot, fProfileId);
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
+         RDFInternal::RProfiler::RScope profileScope(fProfiler, slot, fProfileId);
          // evaluate this define expression, cache the result
-         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+         bool fromBulk = false;
+         if constexpr (kIsBulkCallable)
+            fromBulk = UpdateFromBulk(slot, entry);
+         if (!fromBulk)
+            UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
    }
@@ -135,6 +212,8 @@ public:
 
    const std::type_info &GetTypeId() const final { return typeid(ret_type); }
 
+   bool HasBulkCallable() const final { return kIsBulkCallable; }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinalizeSlot(unsigned int slot) final
    {
@@ -29,6 +29,11 @@ namespace ROOT {
 namespace RDF {
 class RDataSource;
 }
+namespace Internal {
+namespace RDF {
+class RProfiler;
+}
+} // namespace Internal
 namespace Detail {
 namespace RDF {
 
@@ -48,6 +53,8 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   RDFInternal::RProfiler *fProfiler = nullptr; ///< Set if profiling is enabled, see RLoopManager::EnableProfiling()
+   unsigned int fProfileId = 0;                 ///< The id of this node in fProfiler
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -68,6 +75,8 @@ public:
    virtual void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) {}
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
+   /// Whether the define expression evaluates a whole bulk of entries in one call, see RDFInternal::IsBulkCallable
+   virtual bool HasBulkCallable() const { return false; }
 
    const std::vector<std::string> &GetVariations() const { return fVariationDeps; }
 
@@ -76,6 +85,12 @@ public:
 
    /// Return a clone of this Define that works with values in the variationName "universe".
    virtual RDefineBase &GetVariedDefine(const std::string &variationName) = 0;
+
+   /// Register this node with the profiler unless it is registered already
+   void SetProfiler(RDFInternal::RProfiler &profiler);
+   /// The counters of this node for the SaveGraph() output, empty if profiling is not enabled.
+   /// Overridden by RJittedDefine, which forwards to the concrete define.
+   virtual std::string GetProfileLabel() const;
 };
 
 } // ns RDF
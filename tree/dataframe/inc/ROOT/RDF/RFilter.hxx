@@ -17,6 +17,7 @@
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/TypeTraits.hxx"
 #include "RtypesCore.h"
 
@@ -24,6 +25,7 @@
 #include <cassert>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility> // std::index_sequence
 #include <vector>
@@ -61,10 +63,13 @@ class R__CLING_PTRCHECK(off) RFilter final : public RFilterBase {
    // variations we'll have a RJittedFilter node for the nominal case but other "universes" will use concrete filters,
    // so we normalize the "previous node type" to the base type RFilterBase.
    using PrevNode_t = std::conditional_t<std::is_same<PrevNodeRaw, RJittedFilter>::value, RFilterBase, PrevNodeRaw>;
+   static constexpr bool kIsBulkCallable = RDFInternal::IsBulkCallable<FilterF, bool, ColumnTypes_t>::value;
 
    FilterF fFilter;
    /// Column readers per slot and per input column
    std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>> fValues;
+   /// Per slot, the results of the last FilterF::CallBulk() call, only used for bulk callables
+   std::vector<ROOT::RVecB> fBulkCallResults;
    const std::shared_ptr<PrevNode_t> fPrevNodePtr;
    PrevNode_t &fPrevNode;
 
@@ -74,8 +79,9 @@ public:
            const std::string &variationName = "nominal")
       : RFilterBase(pd->GetLoopManagerUnchecked(), name, pd->GetLoopManagerUnchecked()->GetNSlots(), colRegister,
                     columns, pd->GetVariations(), variationName),
-        fFilter(std::move(f)), fValues(pd->GetLoopManagerUnchecked()->GetNSlots()), fPrevNodePtr(std::move(pd)),
-        fPrevNode(*fPrevNodePtr)
+        fFilter(std::move(f)), fValues(pd->GetLoopManagerUnchecked()->GetNSlots()),
+        fBulkCallResults(kIsBulkCallable ? pd->GetLoopManagerUnchecked()->GetNSlots() : 0u),
+        fPrevNodePtr(std::move(pd)), fPrevNode(*fPrevNodePtr)
    {
       fLoopManager->Register(this);
    }
@@ -90,7 +96,18 @@ public:
 
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
+      if constexpr (kIsBulkCallable)
+         CheckCurrentBulk(slot, entry);
+      // the entry may have been checked already as part of a bulk (see CheckFiltersBulk)
+      const auto bulkFirstEntry = fBulkFirstEntry[slot * RDFInternal::CacheLineStep<Long64_t>()];
+      if (bulkFirstEntry >= 0 && entry >= bulkFirstEntry &&
+          entry < bulkFirstEntry + static_cast<Long64_t>(fBulkResult[slot].size()))
+         return fBulkResult[slot][entry - bulkFirstEntry];
+
+      if (fProfiler)
+         fProfiler->CountCall(slot, fProfileId);
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
+         RDFInternal::RProfiler::RScope profileScope(fProfiler, slot, fProfileId);
          if (!fPrevNode.CheckFilters(slot, entry)) {
             // a filter upstream returned false, cache the result
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = false;
@@ -106,20 +123,107 @@ public:
       return fLastResult[slot * RDFInternal::CacheLineStep<int>()];
    }
 
+   /// Bulk callables evaluate the whole bulk that the event loop is processing when the first of its entries is
+   /// checked, also if the actions downstream run entry by entry.
+   void CheckCurrentBulk(unsigned int slot, Long64_t entry)
+   {
+      const auto &bulk = fLoopManager->GetCurrentBulk(slot);
+      if (bulk.fSize <= 1 || entry < bulk.fFirstEntry ||
+          entry >= bulk.fFirstEntry + static_cast<Long64_t>(bulk.fSize))
+         return;
+      const auto bulkFirstEntry = fBulkFirstEntry[slot * RDFInternal::CacheLineStep<Long64_t>()];
+      if (bulkFirstEntry == bulk.fFirstEntry && fBulkResult[slot].size() == bulk.fSize)
+         return;
+      if (!CanCheckFiltersBulk())
+         return;
+      ROOT::RVecB mask(bulk.fSize, true);
+      CheckFiltersBulk(slot, bulk.fFirstEntry, mask);
+   }
+
    template <typename... ColTypes, std::size_t... S>
    bool CheckFilterHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
-      return fFilter(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      return RDFInternal::CallWithRVecArena(fLoopManager->GetRVecArena(slot), fFilter,
+                                            fValues[slot][S]->template Get<ColTypes>(entry)...);
       // avoid unused parameter warnings (gcc 12.1)
       (void)slot;
       (void)entry;
    }
 
+   void CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, ROOT::RVecB &mask) final
+   {
+      auto &result = fBulkResult[slot];
+      auto &bulkFirstEntry = fBulkFirstEntry[slot * RDFInternal::CacheLineStep<Long64_t>()];
+      if (firstEntry != bulkFirstEntry || result.size() != mask.size()) {
+         // evaluate the filter chain for all entries of the bulk, independently of the caller's mask, so that the
+         // result can be reused by other children of this node
+         result.assign(mask.size(), true);
+         fPrevNode.CheckFiltersBulk(slot, firstEntry, result);
+         CheckFilterBulkHelper(slot, firstEntry, result, ColumnTypes_t{}, TypeInd_t{});
+         bulkFirstEntry = firstEntry;
+      }
+      for (std::size_t i = 0; i < mask.size(); ++i)
+         mask[i] = mask[i] && result[i];
+   }
+
+   bool HasBulkCallable() const final { return kIsBulkCallable; }
+
+   bool CanCheckFiltersBulk() const final
+   {
+      return std::none_of(fIsDefine.begin(), fIsDefine.end(), [](bool isDefine) { return isDefine; }) &&
+             fPrevNode.CanCheckFiltersBulk();
+   }
+
+   /// The predicates of the filter itself are unknown, only jitted filters provide them
+   std::vector<ROOT::RDF::Experimental::RColumnPredicate> GetPushdownPredicates() const final
+   {
+      return fPrevNode.GetPushdownPredicates();
+   }
+
+   /// Evaluate the filter for the entries of the bulk whose mask is set. Columns whose readers cannot provide the
+   /// bulk values are read entry by entry.
+   template <typename... ColTypes, std::size_t... S>
+   void CheckFilterBulkHelper(unsigned int slot, Long64_t firstEntry, ROOT::RVecB &mask, TypeList<ColTypes...>,
+                              std::index_sequence<S...>)
+   {
+      const auto size = mask.size();
+      std::tuple<ColTypes *...> bulkValues{
+         fValues[slot][S]->template TryGetBulk<ColTypes>(firstEntry, mask.data(), size)...};
+      auto &accepted = fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()];
+      auto &rejected = fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()];
+      if constexpr (kIsBulkCallable) {
+         if ((true && ... && std::get<S>(bulkValues))) {
+            auto &passed = fBulkCallResults[slot];
+            passed.resize(size);
+            fFilter.CallBulk(size, mask.data(), passed.data(), std::get<S>(bulkValues)...);
+            for (std::size_t i = 0; i < size; ++i) {
+               if (!mask[i])
+                  continue;
+               passed[i] ? ++accepted : ++rejected;
+               mask[i] = passed[i];
+            }
+            return;
+         }
+      }
+      for (std::size_t i = 0; i < size; ++i) {
+         if (!mask[i])
+            continue;
+         const bool passed =
+            fFilter((std::get<S>(bulkValues) ? std::get<S>(bulkValues)[i]
+                                              : fValues[slot][S]->template Get<ColTypes>(firstEntry + i))...);
+         passed ? ++accepted : ++rejected;
+         mask[i] = passed;
+      }
+      (void)bulkValues; // avoid unused variable warnings for filters without input columns
+   }
+
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkFirstEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkResult[slot].clear();
    }
 
    // recursive chain of `Report`s
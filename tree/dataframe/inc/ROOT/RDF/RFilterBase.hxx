@@ -25,6 +25,12 @@ class TTreeReader;
 
 namespace ROOT {
 
+namespace Internal {
+namespace RDF {
+class RProfiler;
+}
+} // namespace Internal
+
 namespace RDF {
 class RCutFlowReport;
 } // ns RDF
@@ -41,6 +47,10 @@ protected:
    std::vector<int> fLastResult = {true}; // std::vector<bool> cannot be used in a MT context safely
    std::vector<ULong64_t> fAccepted = {0};
    std::vector<ULong64_t> fRejected = {0};
+   /// Per slot, the first entry of the last bulk of entries checked with CheckFiltersBulk() (-1 if there is none)
+   std::vector<Long64_t> fBulkFirstEntry;
+   /// Per slot, the results of the filter chain up to this node for the entries of the last bulk
+   std::vector<ROOT::RVecB> fBulkResult;
    const std::string fName;
    const ROOT::RDF::ColumnNames_t fColumnNames;
    RDFInternal::RColumnRegister fColRegister;
@@ -48,6 +58,8 @@ protected:
    ROOT::RVecB fIsDefine;
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
+   RDFInternal::RProfiler *fProfiler = nullptr; ///< Set if profiling is enabled, see RLoopManager::EnableProfiling()
+   unsigned int fProfileId = 0;                 ///< The id of this node in fProfiler
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -72,6 +84,13 @@ public:
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
    virtual void InitNode();
+   /// Whether the filter expression evaluates a whole bulk of entries in one call, see RDFInternal::IsBulkCallable
+   virtual bool HasBulkCallable() const { return false; }
+   /// Register this node with the profiler unless it is registered already. Overridden by RJittedFilter, whose
+   /// concrete filter is registered by itself.
+   virtual void SetProfiler(RDFInternal::RProfiler &profiler);
+   /// The counters of this node for the SaveGraph() output, empty if profiling is not enabled
+   std::string GetProfileLabel() const;
 };
 
 } // ns RDF
@@ -81,6 +81,15 @@ template <typename Proxied, typename DataSource>
 class RInterface;
 
 using RNode = RInterface<::ROOT::Detail::RDF::RNodeBase, void>;
+
+namespace Experimental {
+void EnableBulkProcessing(const RNode &node, unsigned int bulkSize = 1024);
+void EnableProfiling(const RNode &node);
+std::string GetProfileJSON(const RNode &node);
+void EnableSharedHistogramFilling(const RNode &node, std::size_t minNCells = 1000000);
+void DisableJitting(const RNode &node);
+void EnableRVecArenas(const RNode &node);
+} // namespace Experimental
 } // namespace RDF
 
 namespace Internal {
@@ -121,6 +130,12 @@ class RInterface : public RInterfaceBase {
    friend void RDFInternal::TriggerRun(RNode node);
    friend void RDFInternal::ChangeEmptyEntryRange(const RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
    friend void RDFInternal::ChangeSpec(const RNode &node, ROOT::RDF::Experimental::RDatasetSpec &&spec);
+   friend void ROOT::RDF::Experimental::EnableBulkProcessing(const RNode &node, unsigned int bulkSize);
+   friend void ROOT::RDF::Experimental::EnableProfiling(const RNode &node);
+   friend std::string ROOT::RDF::Experimental::GetProfileJSON(const RNode &node);
+   friend void ROOT::RDF::Experimental::EnableSharedHistogramFilling(const RNode &node, std::size_t minNCells);
+   friend void ROOT::RDF::Experimental::DisableJitting(const RNode &node);
+   friend void ROOT::RDF::Experimental::EnableRVecArenas(const RNode &node);
 
    std::shared_ptr<Proxied> fProxiedPtr; ///< Smart pointer to the graph node encapsulated by this RInterface.
 
@@ -975,6 +990,16 @@ public:
    /// opts.fLazy = true;
    /// df.Snapshot("outputTree", "outputFile.root", {"x"}, opts);
    /// ~~~
+   ///
+   /// With `RSnapshotOptions::fOutputFormat` set to `ESnapshotOutputFormat::kRNTuple`, the output is an RNTuple
+   /// instead of a TTree. Every processing slot fills its own clusters, which are compressed in parallel and appended
+   /// to the output file as they are completed; the entries are not in a deterministic order. The compression settings
+   /// and `fApproxZippedClusterSize` of the options apply; only the "RECREATE" mode is supported.
+   /// ~~~{.cpp}
+   /// RSnapshotOptions opts;
+   /// opts.fOutputFormat = ESnapshotOutputFormat::kRNTuple;
+   /// df.Snapshot("outputNTuple", "outputFile.root", {"x"}, opts);
+   /// ~~~
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>>
    Snapshot(std::string_view treename, std::string_view filename, const ColumnNames_t &columnList,
@@ -1022,7 +1047,8 @@ public:
                                          colListWithAliasesAndSizeBranches, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, colListNoAliasesWithSizeBranches);
+      auto newRDF = MakeSnapshotOutputDataFrame(fullTreeName, filename, colListNoAliasesWithSizeBranches,
+                                                *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          colListNoAliasesWithSizeBranches, newRDF, snapHelperArgs, fProxiedPtr,
@@ -1152,6 +1178,7 @@ public:
          return emptyRDF;
       }
 
+      fLoopManager->ThrowIfJittingDisabled("Cache without template parameters");
       std::stringstream cacheCall;
       auto upcastNode = RDFInternal::UpcastNode(fProxiedPtr);
       RInterface<TTraits::TakeFirstParameter_t<decltype(upcastNode)>> upcastInterface(fProxiedPtr, *fLoopManager,
@@ -1223,6 +1250,47 @@ public:
       return Cache(selectedColumns);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns to disk, or read them back from disk if a previous run already saved them.
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] cacheDir directory of the cache files, created if needed.
+   /// \return a `RDataFrame` that reads the cached dataset.
+   ///
+   /// Like Cache(), this returns a new `RDataFrame` object that only contains the cached columns of the entries that
+   /// pass the upstream Filters. The columns are not kept in memory but written to an RNTuple in `cacheDir`, so that
+   /// later processes building the same graph read the cached columns instead of recomputing them, e.g. to avoid
+   /// recomputing expensive Defines when only the downstream part of an analysis changes. If there is no cache file
+   /// yet, it is written by an event loop that runs immediately, like for Snapshot().
+   ///
+   /// The cache file is chosen according to the kinds and names of the upstream nodes, the names and types of the
+   /// cached columns and the names, sizes and modification times of the input files. Changes to the code of Defines
+   /// and Filters are not detected: remove the cache files when such code changes.
+   /// Persistent caching is supported for TTree/TChain inputs and empty sources and requires RNTuple support.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto calibrated = df.Define("jet_pt_cal", Calibrate, {"jet_pt"}).PersistentCache({"jet_pt_cal"}, "rdfcache");
+   /// ~~~
+   RInterface<RLoopManager> PersistentCache(const ColumnNames_t &columnList, std::string_view cacheDir)
+   {
+      const auto columnListWithoutSizeColumns = RDFInternal::FilterArraySizeColNames(columnList, "PersistentCache");
+      const auto validColumnNames =
+         GetValidatedColumnNames(columnListWithoutSizeColumns.size(), columnListWithoutSizeColumns);
+      ColumnNames_t colTypes;
+      for (const auto &colName : validColumnNames)
+         colTypes.emplace_back(GetColumnType(colName));
+
+      auto writeCache = [this, &validColumnNames](const std::string &ntupleName, const std::string &fileName) {
+         RSnapshotOptions options;
+         options.fOutputFormat = ESnapshotOutputFormat::kRNTuple;
+         Snapshot(ntupleName, fileName, validColumnNames, options);
+      };
+      RInterface<RLoopManager> cachedRDF(std::make_shared<RLoopManager>(0));
+      RDFInternal::OpenPersistentCache(cachedRDF, std::string(cacheDir), *fProxiedPtr, validColumnNames, colTypes,
+                                       writeCache);
+      return cachedRDF;
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates a node that filters entries based on range: [begin, end).
@@ -2829,6 +2897,20 @@ private:
       return *this; // never reached
    }
 
+   /// Create the RDataFrame returned by Snapshot. For RNTuple output, this is a placeholder that the Snapshot action
+   /// resets to an RDataFrame reading the written ntuple at the end of the event loop.
+   std::shared_ptr<ROOT::RDataFrame>
+   MakeSnapshotOutputDataFrame(std::string_view fullTreeName, std::string_view filename,
+                               const ColumnNames_t &defaultColumns, RDFInternal::SnapshotHelperArgs &snapHelperArgs)
+   {
+      if (snapHelperArgs.fOptions.fOutputFormat == ESnapshotOutputFormat::kRNTuple) {
+         auto newRDF = std::make_shared<ROOT::RDataFrame>(ULong64_t(0));
+         snapHelperArgs.fOutputDataFrame = newRDF;
+         return newRDF;
+      }
+      return std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, defaultColumns);
+   }
+
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>> SnapshotImpl(std::string_view fullTreeName, std::string_view filename,
                                                      const ColumnNames_t &columnList, const RSnapshotOptions &options)
@@ -2850,7 +2932,8 @@ private:
 
       ::TDirectory::TContext ctxt;
       auto newRDF =
-         std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns);
+         MakeSnapshotOutputDataFrame(fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns,
+                                     *snapHelperArgs);
 
       // The Snapshot helper will use validCols (with aliases resolved) as input columns, and
       // columnListWithoutSizeColumns (still with aliases in it, passed through snapHelperArgs) as output column names.
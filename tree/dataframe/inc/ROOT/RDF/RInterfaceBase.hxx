@@ -174,6 +174,7 @@ protected:
                                              const std::shared_ptr<HelperArgType> &helperArg,
                                              const std::shared_ptr<RDFNode> &proxiedPtr, const int nColumns = -1)
    {
+      fLoopManager->ThrowIfJittingDisabled("an action without template parameters");
       auto realNColumns = (nColumns > -1 ? nColumns : sizeof...(ColTypes));
 
       const auto validColumnNames = GetValidatedColumnNames(realNColumns, columns);
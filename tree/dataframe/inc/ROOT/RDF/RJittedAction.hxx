@@ -48,6 +48,9 @@ public:
    void SetAction(std::unique_ptr<RActionBase> a) { fConcreteAction = std::move(a); }
 
    void Run(unsigned int slot, Long64_t entry) final;
+   void RunBulk(unsigned int slot, Long64_t firstEntry, const ROOT::RVecB &mask) final;
+   bool CanRunBulk() const final;
+   std::vector<ROOT::RDF::Experimental::RColumnPredicate> GetPushdownPredicates() const final;
    void Initialize() final;
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void TriggerChildrenCount() final;
@@ -63,6 +63,7 @@ public:
    void FinalizeSlot(unsigned int slot) final;
    void MakeVariations(const std::vector<std::string> &variations) final;
    RDefineBase &GetVariedDefine(const std::string &variationName) final;
+   std::string GetProfileLabel() const final;
 };
 
 } // ns RDF
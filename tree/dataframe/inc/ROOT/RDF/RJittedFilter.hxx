@@ -38,15 +38,25 @@ namespace RDFGraphDrawing = ROOT::Internal::RDF::GraphDrawing;
 /// at a later time, from jitted code.
 class RJittedFilter final : public RFilterBase {
    std::unique_ptr<RFilterBase> fConcreteFilter = nullptr;
+   /// The comparisons that the filter expression consists of, if it is a conjunction of comparisons between
+   /// dataset columns and constants; otherwise empty
+   std::vector<ROOT::RDF::Experimental::RColumnPredicate> fPredicates;
 
 public:
    RJittedFilter(RLoopManager *lm, std::string_view name, const std::vector<std::string> &variations);
    ~RJittedFilter();
 
    void SetFilter(std::unique_ptr<RFilterBase> f);
+   void SetPredicates(const std::vector<ROOT::RDF::Experimental::RColumnPredicate> &predicates)
+   {
+      fPredicates = predicates;
+   }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    bool CheckFilters(unsigned int slot, Long64_t entry) final;
+   void CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, ROOT::RVecB &mask) final;
+   bool CanCheckFiltersBulk() const final;
+   std::vector<ROOT::RDF::Experimental::RColumnPredicate> GetPushdownPredicates() const final;
    void Report(ROOT::RDF::RCutFlowReport &) const final;
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final;
    void FillReport(ROOT::RDF::RCutFlowReport &) const final;
@@ -56,6 +66,8 @@ public:
    void TriggerChildrenCount() final;
    void ResetReportCount() final;
    void InitNode() final;
+   /// No-op: the concrete filter registers with the loop manager and with the profiler by itself
+   void SetProfiler(RDFInternal::RProfiler &) final {}
    void AddFilterName(std::vector<std::string> &filters) final;
    void FinalizeSlot(unsigned int slot) final;
    std::shared_ptr<RDFGraphDrawing::GraphNode>
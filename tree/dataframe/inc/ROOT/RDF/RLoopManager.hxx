@@ -16,7 +16,9 @@
 #include "ROOT/RDF/RDatasetSpec.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
+#include "ROOT/RVec.hxx"
 
 #include <functional>
 #include <limits>
@@ -103,6 +105,12 @@ class RRangeBase;
 class RDefineBase;
 using ROOT::RDF::RDataSource;
 
+/// A range of consecutive entries processed together in bulk processing mode
+struct RBulkRange {
+   Long64_t fFirstEntry = -1;
+   std::size_t fSize = 0;
+};
+
 /// The head node of a RDF computation graph.
 /// This class is responsible of running the event loop.
 class RLoopManager : public RNodeBase {
@@ -147,10 +155,46 @@ class RLoopManager : public RNodeBase {
    std::unordered_map<void *, ROOT::RDF::SampleCallback_t> fSampleCallbacks;
    RDFInternal::RNewSampleNotifier fNewSampleNotifier;
    std::vector<ROOT::RDF::RSampleInfo> fSampleInfos;
+   /// Per slot (with a stride of CacheLineStep), the entries processed in the current event loop, for the metrics
+   /// exported by ROOT::Experimental::RMetricsRegistry
+   std::vector<ULong64_t> fNProcessedEntries;
    unsigned int fNRuns{0}; ///< Number of event loops run
+   /// Number of entries processed together by the actions that support it, see SetBulkSize(). 0 or 1 means off.
+   unsigned int fBulkSize{0};
+   /// The subsets of fBookedActions that are run in bulks (RunBulk) and entry by entry (Run) in the current event loop.
+   /// Both are empty if the current event loop does not use bulk processing.
+   std::vector<RDFInternal::RActionBase *> fBulkActions;
+   std::vector<RDFInternal::RActionBase *> fPerEntryActions;
+   /// Whether the current event loop processes the entries in bulks, see SetupBulkProcessing()
+   bool fBulkProcessing{false};
+   /// Per slot (with a stride of CacheLineStep), the bulk of entries being processed, see GetCurrentBulk()
+   std::vector<RBulkRange> fCurrentBulks;
 
    /// Readers for TTree/RDataSource columns (one per slot), shared by all nodes in the computation graph.
    std::vector<std::unordered_map<std::string, std::unique_ptr<RColumnReaderBase>>> fDatasetColumnReaders;
+   /// Names of the RDataSource columns for which column readers were requested, see RDataSource::SetActiveColumns()
+   std::vector<std::string> fDataSourceColumnNames;
+
+   /// Graphs that are processed by the event loop of this one, see RunShared(). Set for the duration of the event loop.
+   std::vector<RLoopManager *> fSharedLoops;
+   /// The loop manager that processes this graph in its event loop and provides the dataset column readers, if any
+   RLoopManager *fSharedLoopOwner = nullptr;
+
+   /// Set by EnableProfiling(); from then on, the nodes of the graph and the dataset column readers are profiled
+   std::unique_ptr<RDFInternal::RProfiler> fProfiler;
+
+   /// Set by EnableRVecArenas(); one arena per slot for the RVecs created by Filter and Define expressions, reset
+   /// after every entry. Empty if the arenas are not enabled.
+   std::vector<std::unique_ptr<ROOT::Internal::VecOps::RVecArena>> fRVecArenas;
+
+   /// Minimum number of cells of the histograms that are filled without per-slot copies, see SharedFillHelper.
+   /// 0 means off.
+   std::size_t fSharedFillMinNCells{0};
+
+   /// Set by DisableJitting(); from then on, booking an operation that requires just-in-time compilation throws
+   bool fJittingDisabled{false};
+   /// Whether code was booked for just-in-time compilation for this graph
+   mutable bool fHasJittedNodes{false};
 
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
@@ -164,6 +208,13 @@ class RLoopManager : public RNodeBase {
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   bool HasActiveChildren() const;
+   void CheckCanShareLoop(const RLoopManager &other) const;
+   static void UpdateEventLoopMetrics(ULong64_t nEntries, double realTime);
+   void RunAndCheckFiltersBulk(unsigned int slot, Long64_t start, Long64_t end);
+   void SetupBulkProcessing();
+   void PushDownToDataSource();
+   bool IsBulkProcessing() const { return fBulkProcessing; }
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
    void CleanUpNodes();
@@ -185,6 +236,7 @@ public:
    void Jit();
    RLoopManager *GetLoopManagerUnchecked() final { return this; }
    void Run(bool jit = true);
+   void RunShared(const std::vector<RLoopManager *> &others);
    const ColumnNames_t &GetDefaultColumnNames() const;
    TTree *GetTree() const;
    ::TDirectory *GetDirectory() const;
@@ -201,6 +253,9 @@ public:
    void Register(RDFInternal::RVariationBase *varPtr);
    void Deregister(RDFInternal::RVariationBase *varPtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   /// End of recursive chain of calls, all entries pass
+   void CheckFiltersBulk(unsigned int, Long64_t, ROOT::RVecB &) final {}
+   bool CanCheckFiltersBulk() const final { return true; }
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -236,9 +291,51 @@ public:
    const ColumnNames_t &GetBranchNames();
 
    void AddSampleCallback(void *nodePtr, ROOT::RDF::SampleCallback_t &&callback);
+   std::unique_ptr<RColumnReaderBase>
+   MakeProfiledColumnReader(unsigned int slot, const std::string &col, std::unique_ptr<RColumnReaderBase> reader);
 
    void SetEmptyEntryRange(std::pair<ULong64_t, ULong64_t> &&newRange);
    void ChangeSpec(ROOT::RDF::Experimental::RDatasetSpec &&spec);
+
+   /// Process the entries in bulks of the given size wherever possible. Bulk processing is used for empty sources and
+   /// for data sources that support it (see RDataSource::SupportsBulkProcessing()); it applies to the actions whose
+   /// chain of filters only reads dataset columns, and to the Filters and Defines with bulk callables (see
+   /// RDFInternal::IsBulkCallable). The other actions process the entries one by one as usual.
+   void SetBulkSize(unsigned int bulkSize) { fBulkSize = bulkSize; }
+   unsigned int GetBulkSize() const { return fBulkSize; }
+   /// The bulk of entries the given slot is processing, with a size of 0 outside of bulk processing. Filters and
+   /// Defines with bulk callables evaluate the whole bulk when its first entry is requested.
+   const RBulkRange &GetCurrentBulk(unsigned int slot) const
+   {
+      return fCurrentBulks[slot * RDFInternal::CacheLineStep<RBulkRange>()];
+   }
+
+   /// Record the time spent in the nodes of the graph and in the dataset column readers, as well as the number of
+   /// entries they process, in all the following event loops. Profiling cannot be disabled again.
+   void EnableProfiling();
+   /// Null unless EnableProfiling() was called
+   const RDFInternal::RProfiler *GetProfiler() const { return fProfiler.get(); }
+
+   /// Allocate the RVecs that grow while the Filter and Define expressions are evaluated in a per-slot arena, reset
+   /// after every entry, in all the following event loops. The arenas cannot be disabled again.
+   void EnableRVecArenas();
+   /// The RVec arena of the given slot, null unless EnableRVecArenas() was called
+   ROOT::Internal::VecOps::RVecArena *GetRVecArena(unsigned int slot) const
+   {
+      return fRVecArenas.empty() ? nullptr : fRVecArenas[slot].get();
+   }
+
+   /// Fill the TH1D, TH2D and TH3D histograms with fixed-width bins and at least the given number of cells that are
+   /// booked from now on into a single histogram shared by all slots. 0 means off.
+   void SetSharedFillMinNCells(std::size_t minNCells) { fSharedFillMinNCells = minNCells; }
+   std::size_t GetSharedFillMinNCells() const { return fSharedFillMinNCells; }
+
+   /// Make the booking of operations that require just-in-time compilation throw from now on. Throws if such
+   /// operations were already booked.
+   void DisableJitting();
+   bool IsJittingDisabled() const { return fJittingDisabled; }
+   /// Throw if just-in-time compilation is disabled; `what` describes the operation that requires it
+   void ThrowIfJittingDisabled(const std::string &what) const;
 };
 
 } // ns RDF
@@ -11,6 +11,8 @@
 #ifndef ROOT_RDFNODEBASE
 #define ROOT_RDFNODEBASE
 
+#include "ROOT/RDF/RColumnPredicate.hxx"
+#include "ROOT/RVec.hxx"
 #include "RtypesCore.h"
 #include "TError.h" // R__ASSERT
 
@@ -54,6 +56,20 @@ public:
    }
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Bulk version of CheckFilters() for the entries [firstEntry, firstEntry + mask.size()). On input, the mask flags
+   /// the entries to be checked; on output, it flags the entries that pass all the filters up to this node.
+   virtual void CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, ROOT::RVecB &mask)
+   {
+      for (std::size_t i = 0; i < mask.size(); ++i)
+         mask[i] = mask[i] && CheckFilters(slot, firstEntry + i);
+   }
+   /// Whether CheckFiltersBulk() can be called for a bulk of entries before the rest of the computation graph
+   /// processes these entries, i.e. no node up to this one reads a Define or depends on the order of the entries.
+   virtual bool CanCheckFiltersBulk() const { return false; }
+   /// The column predicates that all the entries passing this node satisfy, as far as they are known from the
+   /// jitted filters up to this node (see RDataSource::SetPredicates()). Nodes that change the set of entries in
+   /// other ways than filters on dataset columns, e.g. ranges, return an empty list.
+   virtual std::vector<ROOT::RDF::Experimental::RColumnPredicate> GetPushdownPredicates() const { return {}; }
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
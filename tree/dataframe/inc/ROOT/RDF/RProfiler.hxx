@@ -0,0 +1,167 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RPROFILER
+#define ROOT_RDF_RPROFILER
+
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include <Rtypes.h>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/**
+\class ROOT::Internal::RDF::RProfiler
+\ingroup dataframe
+\brief Records, per processing slot, the time spent in the nodes of a computation graph and in the column readers
+
+Filters, Defines and actions count how often they are asked for an entry (calls) and how often they actually evaluate
+the entry (evaluations); the difference is the number of times the value cached for the current entry was reused.
+The time of a node is exclusive: the time spent in the nodes and column readers that it calls is attributed to them.
+Times are wall-clock times of the slot that processes the node. The counters of all the event loops add up.
+*/
+class RProfiler {
+public:
+   enum class ENodeKind { kFilter, kDefine, kAction, kColumn };
+
+   struct RCounters {
+      double fTime = 0.;           ///< Exclusive wall-clock time in seconds
+      ULong64_t fNCalls = 0;       ///< Number of entries the node was asked for
+      ULong64_t fNEvaluations = 0; ///< Number of entries the node evaluated, i.e. that were not cached yet
+
+      RCounters &operator+=(const RCounters &other)
+      {
+         fTime += other.fTime;
+         fNCalls += other.fNCalls;
+         fNEvaluations += other.fNEvaluations;
+         return *this;
+      }
+   };
+
+private:
+   using Clock_t = std::chrono::steady_clock;
+
+   struct RNodeInfo {
+      ENodeKind fKind;
+      std::string fName;
+   };
+
+   /// Aligned to the cache line size so that slots do not share cache lines
+   struct alignas(64) RSlotData {
+      std::vector<RCounters> fCounters; ///< Indexed by node id, grown on demand by the thread that owns the slot
+      double fChildrenTime = 0.;        ///< Time spent in the callees of the node that is currently evaluated
+   };
+
+   std::vector<RNodeInfo> fNodes;
+   std::vector<RSlotData> fSlots;
+   mutable std::mutex fNodesMutex; ///< Column readers may be registered concurrently by several slots
+
+   RCounters &GetSlotCounters(unsigned int slot, unsigned int id)
+   {
+      auto &counters = fSlots[slot].fCounters;
+      if (id >= counters.size())
+         counters.resize(id + 1);
+      return counters[id];
+   }
+
+public:
+   /// Times one evaluation of a node, minus the time of the scopes opened for its callees in the meantime.
+   /// Does nothing if the profiler is null.
+   class RScope {
+      RProfiler *fProfiler;
+      unsigned int fSlot;
+      unsigned int fId;
+      Clock_t::time_point fStart;
+      double fOuterChildrenTime = 0.;
+
+   public:
+      RScope(RProfiler *profiler, unsigned int slot, unsigned int id) : fProfiler(profiler), fSlot(slot), fId(id)
+      {
+         if (!fProfiler)
+            return;
+         auto &slotData = fProfiler->fSlots[fSlot];
+         fOuterChildrenTime = slotData.fChildrenTime;
+         slotData.fChildrenTime = 0.;
+         fStart = Clock_t::now();
+      }
+      RScope(const RScope &) = delete;
+      RScope &operator=(const RScope &) = delete;
+      ~RScope()
+      {
+         if (!fProfiler)
+            return;
+         const double elapsed = std::chrono::duration<double>(Clock_t::now() - fStart).count();
+         auto &slotData = fProfiler->fSlots[fSlot];
+         auto &counters = fProfiler->GetSlotCounters(fSlot, fId);
+         counters.fTime += elapsed - slotData.fChildrenTime;
+         ++counters.fNEvaluations;
+         slotData.fChildrenTime = fOuterChildrenTime + elapsed;
+      }
+   };
+
+   explicit RProfiler(unsigned int nSlots) : fSlots(nSlots) {}
+
+   /// Return the id of a new node
+   unsigned int RegisterNode(ENodeKind kind, const std::string &name);
+   /// Return the id of the dataset column with the given name, registering it if needed
+   unsigned int RegisterColumn(const std::string &name);
+
+   void CountCall(unsigned int slot, unsigned int id) { ++GetSlotCounters(slot, id).fNCalls; }
+
+   /// The counters of the given node, summed over all slots. Must not be called during an event loop.
+   RCounters GetCounters(unsigned int id) const;
+   /// A short summary of the counters of the node for the labels of the SaveGraph() output
+   std::string GetGraphLabel(unsigned int id) const;
+   /// A short summary of the time spent in all the column readers for the label of the graph root
+   std::string GetColumnsGraphLabel() const;
+   /// The counters of all the nodes, in total and per slot, as a JSON document
+   std::string AsJSON() const;
+};
+
+/// Forwards to another column reader and records the time spent reading, see RProfiler
+class R__CLING_PTRCHECK(off) RProfiledColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   std::unique_ptr<RColumnReaderBase> fReader;
+   RProfiler &fProfiler;
+   unsigned int fSlot;
+   unsigned int fId;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      fProfiler.CountCall(fSlot, fId);
+      RProfiler::RScope scope(&fProfiler, fSlot, fId);
+      return fReader->GetImpl(entry);
+   }
+
+   void *GetBulkImpl(Long64_t firstEntry, const bool *mask, std::size_t size) final
+   {
+      fProfiler.CountCall(fSlot, fId);
+      RProfiler::RScope scope(&fProfiler, fSlot, fId);
+      return fReader->GetBulkImpl(firstEntry, mask, size);
+   }
+
+public:
+   RProfiledColumnReader(std::unique_ptr<RColumnReaderBase> reader, RProfiler &profiler, unsigned int slot,
+                         unsigned int id)
+      : fReader(std::move(reader)), fProfiler(profiler), fSlot(slot), fId(id)
+   {
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RPROFILER
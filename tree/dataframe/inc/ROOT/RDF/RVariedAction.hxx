@@ -46,6 +46,9 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
    std::vector<Helper> fHelpers; ///< Action helpers per variation.
    /// Owning pointers to upstream nodes for each systematic variation.
    std::vector<std::shared_ptr<PrevNodeType>> fPrevNodes;
+   /// For each distinct upstream node, the indices of the variations that share it. The upstream node of a
+   /// variation that does not affect any filter is the nominal one: its filters are checked once for all of them.
+   std::vector<std::pair<PrevNodeType *, std::vector<unsigned int>>> fVariationGroups;
 
    /// Column readers per slot (outer dimension), per variation and per input column (inner dimension, std::array).
    std::vector<std::vector<std::array<RColumnReaderBase *, ColumnTypes_t::list_size>>> fInputValues;
@@ -95,6 +98,16 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
          if (fIsDefine[i])
             define->MakeVariations(GetVariations());
       }
+
+      for (auto varIdx = 0u; varIdx < fPrevNodes.size(); ++varIdx) {
+         auto *prevNode = fPrevNodes[varIdx].get();
+         auto group = std::find_if(fVariationGroups.begin(), fVariationGroups.end(),
+                                   [prevNode](const auto &g) { return g.first == prevNode; });
+         if (group == fVariationGroups.end())
+            fVariationGroups.emplace_back(prevNode, std::vector<unsigned int>{varIdx});
+         else
+            group->second.push_back(varIdx);
+      }
    }
 
    /// This constructor takes in input a vector of previous nodes, motivated by the CloneAction logic.
@@ -150,9 +163,11 @@ public:
 
    void Run(unsigned int slot, Long64_t entry) final
    {
-      for (auto varIdx = 0u; varIdx < GetVariations().size(); ++varIdx) {
-         if (fPrevNodes[varIdx]->CheckFilters(slot, entry))
-            CallExec(slot, varIdx, entry, ColumnTypes_t{}, TypeInd_t{});
+      for (const auto &group : fVariationGroups) {
+         if (group.first->CheckFilters(slot, entry)) {
+            for (auto varIdx : group.second)
+               CallExec(slot, varIdx, entry, ColumnTypes_t{}, TypeInd_t{});
+         }
       }
    }
 
@@ -197,6 +197,16 @@ void InterpreterDeclare(const std::string &code);
 /// The pointer returned by the call to TInterpreter::Calc is returned in case of success.
 Long64_t InterpreterCalc(const std::string &code, const std::string &context = "");
 
+/// The directory of the on-disk cache of jitted code, empty if the cache is disabled (the default). Initialized from
+/// the `RDataFrame.JitCacheDir` rootrc variable.
+std::string &GetJitCacheDirectory();
+
+/// Execute the jitted code through a shared library in the given cache directory. The library is compiled with ACLiC
+/// the first time the code is seen and reused by all later processes that jit the same code, where the addresses of
+/// the objects the code operates on are passed as arguments.
+/// Returns false if the code cannot be compiled into a library; the caller should then fall back to InterpreterCalc.
+bool InterpreterCalcCached(const std::string &code, const std::string &cacheDir);
+
 /// Whether custom column with name colName is an "internal" column such as rdfentry_ or rdfslot_
 bool IsInternalColumn(std::string_view colName);
 
@@ -221,6 +231,32 @@ constexpr std::size_t CacheLineStep() {
    return (kCacheLineSize + sizeof(T) - 1) / sizeof(T);
 }
 
+/// Call f with the given arguments, allocating the buffers of the RVecs that grow during the call in the given arena,
+/// if not null. The arguments are evaluated before, so the reading of the input columns does not use the arena.
+template <typename F, typename... Args>
+auto CallWithRVecArena(ROOT::Internal::VecOps::RVecArena *arena, F &f, Args &&...args)
+   -> decltype(f(std::forward<Args>(args)...))
+{
+   ROOT::Internal::VecOps::RVecArenaScope arenaScope(arena);
+   return f(std::forward<Args>(args)...);
+}
+
+/// Detect the Filter and Define callables that can also evaluate a whole bulk of entries in one call, i.e. that
+/// provide `void CallBulk(std::size_t size, const bool *mask, Ret *results, const ColTypes *...values)`. The results
+/// of the entries whose mask is not set are ignored. Such callables are used in bulk processing mode, see
+/// ROOT::RDF::Experimental::EnableBulkProcessing(); otherwise, and when the input values of a bulk are not available
+/// at once, they are called entry by entry.
+template <typename F, typename Ret, typename ColTypes, typename = void>
+struct IsBulkCallable : std::false_type {
+};
+
+template <typename F, typename Ret, typename... ColTypes>
+struct IsBulkCallable<F, Ret, ROOT::TypeTraits::TypeList<ColTypes...>,
+                      std::void_t<decltype(std::declval<F &>().CallBulk(
+                         std::size_t{}, std::declval<const bool *>(), std::declval<Ret *>(),
+                         std::declval<const ColTypes *>()...))>> : std::true_type {
+};
+
 void CheckReaderTypeMatches(const std::type_info &colType, const std::type_info &requestedType,
                             const std::string &colName);
 
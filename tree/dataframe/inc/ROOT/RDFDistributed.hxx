@@ -0,0 +1,146 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// This header contains the building blocks to run one RDataFrame analysis on several processes, e.g. MPI ranks
+
+#ifndef ROOT_RDF_DISTRIBUTED
+#define ROOT_RDF_DISTRIBUTED
+
+#include <ROOT/RDF/RDatasetSpec.hxx>
+#include <ROOT/RDF/RMergeableValue.hxx>
+#include <ROOT/RResultPtr.hxx>
+#include <RtypesCore.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/**
+\class ROOT::RDF::Experimental::RCommunicator
+\ingroup dataframe
+\brief The message transport between the processes ("ranks") that run the same RDataFrame analysis
+
+RDataFrame does not depend on any particular transport. An implementation for MPI takes a few lines:
+~~~{.cpp}
+class RMPICommunicator final : public ROOT::RDF::Experimental::RCommunicator {
+public:
+   int GetRank() const final { int r; MPI_Comm_rank(MPI_COMM_WORLD, &r); return r; }
+   int GetNRanks() const final { int n; MPI_Comm_size(MPI_COMM_WORLD, &n); return n; }
+   void Send(int dest, const std::vector<char> &msg) final
+   {
+      MPI_Send(msg.data(), msg.size(), MPI_CHAR, dest, 0, MPI_COMM_WORLD);
+   }
+   std::vector<char> Receive(int source) final
+   {
+      MPI_Status status;
+      MPI_Probe(source, 0, MPI_COMM_WORLD, &status);
+      int size;
+      MPI_Get_count(&status, MPI_CHAR, &size);
+      std::vector<char> msg(size);
+      MPI_Recv(msg.data(), size, MPI_CHAR, source, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+      return msg;
+   }
+};
+~~~
+*/
+class RCommunicator {
+public:
+   virtual ~RCommunicator() = default;
+   /// The rank of this process, between 0 and GetNRanks() - 1
+   virtual int GetRank() const = 0;
+   virtual int GetNRanks() const = 0;
+   /// Send a message to the given rank. May block until the message is received.
+   virtual void Send(int destRank, const std::vector<char> &message) = 0;
+   /// Wait for the next message from the given rank
+   virtual std::vector<char> Receive(int sourceRank) = 0;
+};
+
+/// The entries of a dataset with nEntries entries that the given rank processes: the dataset is divided into
+/// contiguous parts of equal size (up to one entry), one per rank, in rank order. Use it with
+/// RDatasetSpec::WithGlobalRange() or Range().
+RDatasetSpec::REntryRange GetRankEntryRange(Long64_t nEntries, int rank, int nRanks);
+
+} // namespace Experimental
+} // namespace RDF
+
+namespace Internal {
+namespace RDF {
+/// Stream a mergeable value, including the information of its concrete type, with ROOT I/O. Throws if there is no
+/// dictionary for the concrete type.
+std::vector<char> SerializeMergeableValue(const ROOT::Detail::RDF::RMergeableValueBase &value);
+/// The inverse of SerializeMergeableValue()
+std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase> DeserializeMergeableValue(const std::vector<char> &buffer);
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+namespace Experimental {
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Merge the result of an action over all ranks.
+/// \param[in] result The result of the action on this rank. Triggers the event loop if it has not run yet.
+/// \param[in] comm The transport between the ranks.
+/// \param[in] rootRank The rank that receives the merged result.
+/// \return The merged result on rootRank, null on the other ranks.
+///
+/// Every rank runs the same program: it books the same computation graph, including jitted expressions, on its part
+/// of the dataset (see GetRankEntryRange()) and calls ReduceOverRanks() for the same results in the same order. The
+/// partial results are wrapped in their mergeable values (see ROOT::Detail::RDF::GetMergeableValue()), streamed with
+/// ROOT I/O and merged along a binomial tree, so that the root rank receives log2(nRanks) messages.
+///
+/// ~~~{.cpp}
+/// RMPICommunicator comm; // see RCommunicator
+/// auto spec = ROOT::RDF::Experimental::RDatasetSpec().AddSample({"sample", "tree", "data_*.root"});
+/// spec.WithGlobalRange(GetRankEntryRange(nEntries, comm.GetRank(), comm.GetNRanks()));
+/// ROOT::RDataFrame df(spec);
+/// auto h = df.Filter("pt > 10").Histo1D("pt");
+/// auto merged = ReduceOverRanks(h, comm);
+/// if (merged)
+///    merged->GetValue().Draw();
+/// ~~~
+template <typename T>
+std::unique_ptr<ROOT::Detail::RDF::RMergeableValue<T>>
+ReduceOverRanks(ROOT::RDF::RResultPtr<T> &result, RCommunicator &comm, int rootRank = 0)
+{
+   using Mergeable_t = ROOT::Detail::RDF::RMergeableValue<T>;
+   auto mergeable = ROOT::Detail::RDF::GetMergeableValue(result);
+
+   const int nRanks = comm.GetNRanks();
+   if (rootRank < 0 || rootRank >= nRanks)
+      throw std::invalid_argument("ReduceOverRanks: invalid root rank " + std::to_string(rootRank) + ".");
+   // ranks relative to the root, so that the root is 0 in the binomial tree
+   const int relRank = (comm.GetRank() - rootRank + nRanks) % nRanks;
+   for (int step = 1; step < nRanks; step *= 2) {
+      if (relRank % (2 * step) != 0) {
+         const int dest = (relRank - step + rootRank) % nRanks;
+         comm.Send(dest, ROOT::Internal::RDF::SerializeMergeableValue(*mergeable));
+         return nullptr;
+      }
+      if (relRank + step < nRanks) {
+         const int source = (relRank + step + rootRank) % nRanks;
+         auto other = ROOT::Internal::RDF::DeserializeMergeableValue(comm.Receive(source));
+         auto otherTyped = dynamic_cast<Mergeable_t *>(other.get());
+         if (!otherTyped)
+            throw std::runtime_error("ReduceOverRanks: received a result of a different type from rank " +
+                                     std::to_string(source) + ".");
+         ROOT::Detail::RDF::MergeValues(*mergeable, *otherTyped);
+      }
+   }
+   return mergeable;
+}
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_DISTRIBUTED
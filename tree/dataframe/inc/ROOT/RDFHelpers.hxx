@@ -17,6 +17,7 @@
 #include <ROOT/RDF/RActionBase.hxx>
 #include <ROOT/RDF/RResultMap.hxx>
 #include <ROOT/RResultHandle.hxx> // users of RunGraphs might rely on this transitive include
+#include <ROOT/RStringView.hxx>
 #include <ROOT/TypeTraits.hxx>
 
 #include <array>
@@ -272,6 +273,40 @@ SnapshotPtr_t VariationsFor(SnapshotPtr_t resPtr);
 void AddProgressbar(ROOT::RDF::RNode df);
 void AddProgressbar(ROOT::RDataFrame df);
 
+/// \brief Enable the on-disk cache of jitted code in the given directory, or disable it with an empty string.
+/// The code that RDataFrame jits at the beginning of an event loop is compiled into a shared library in the directory
+/// and later processes jitting the same code, i.e. building the same computation graph with the same ROOT version,
+/// load the library instead of jitting the code again. The cache is shared by all the RDataFrames of the process and
+/// can also be enabled with the `RDataFrame.JitCacheDir` rootrc variable.
+/// Code that uses types or functions only known to the interpreter cannot be cached; it is jitted as usual.
+void SetJitCacheDirectory(std::string_view dir);
+
+// clang-format off
+/// Trigger the event loops of multiple RDataFrames over the same dataset as a single event loop
+/// \param[in] handles A vector of RResultHandles
+/// \return The number of distinct computation graphs that have been processed
+///
+/// Differently from ROOT::RDF::RunGraphs(), which runs one event loop per computation graph, all the graphs are
+/// processed by one event loop: every entry is read once and then passed to the filters and actions of every graph.
+/// Columns that several graphs read with the same type are read and decompressed only once per entry.
+/// All the graphs must run over the same TTree/TChain (same trees, files, friends and entry range) or over empty
+/// sources of the same size; RDataFrames that read from an RDataSource are not supported. Jitted code is compiled once
+/// for all the graphs and identical jitted expressions share the same compiled function, but the Defines of
+/// different graphs are still evaluated separately.
+///
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df1("tree", "file.root");
+/// auto r1 = df1.Filter("nMuon == 2").Histo1D("pt");
+///
+/// ROOT::RDataFrame df2("tree", "file.root");
+/// auto r2 = df2.Filter("nElectron == 2").Histo1D("pt");
+///
+/// // "pt" is read once per entry
+/// ROOT::RDF::Experimental::RunGraphsInOneLoop({r1, r2});
+/// ~~~
+// clang-format on
+unsigned int RunGraphsInOneLoop(std::vector<RResultHandle> handles);
+
 } // namespace Experimental
 
 /// RDF progress helper.
@@ -11,6 +11,7 @@
 #ifndef ROOT_RDATASOURCE
 #define ROOT_RDATASOURCE
 
+#include "RDF/RColumnPredicate.hxx"
 #include "RDF/RColumnReaderBase.hxx"
 #include "ROOT/RStringView.hxx"
 #include "RtypesCore.h" // ULong64_t
@@ -225,6 +226,23 @@ public:
    /// Concrete datasources can override the default implementation.
    virtual std::string GetLabel() { return "Custom Datasource"; }
 
+   /// \brief Whether the column readers of this data source can read any entry of the current task in any order.
+   /// If true, RDataFrame may call SetEntry() for a bulk of entries before reading the column values of these entries
+   /// (see ROOT::RDF::Experimental::EnableBulkProcessing()). Column readers can then provide the values of a bulk of
+   /// entries at once by overriding RColumnReaderBase::GetBulkImpl().
+   virtual bool SupportsBulkProcessing() const { return false; }
+
+   /// \brief Receive the predicates that every entry of interest of the next event loop satisfies.
+   /// Called before Initialize() at the start of every event loop, possibly with an empty list. The predicates stem
+   /// from Filter expressions that all the actions of the event loop depend on. The data source may skip entries that
+   /// do not satisfy them, e.g. based on statistics of the stored values. Skipping is optional: RDataFrame still
+   /// applies the filters to every entry that the data source provides.
+   virtual void SetPredicates(const std::vector<ROOT::RDF::Experimental::RColumnPredicate> & /*predicates*/) {}
+
+   /// \brief Receive the names of the columns for which RDataFrame requested column readers.
+   /// Called before Initialize() at the start of every event loop. Columns not in the list are not read.
+   virtual void SetActiveColumns(const std::vector<std::string> & /*columnNames*/) {}
+
 protected:
    /// type-erased vector of pointers to pointers to column values - one per slot
    virtual Record_t GetColumnReadersImpl(std::string_view name, const std::type_info &) = 0;
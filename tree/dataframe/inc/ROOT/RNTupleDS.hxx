@@ -19,10 +19,12 @@
 
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RDataSource.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RStringView.hxx>
 
 #include <cstdint>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -44,8 +46,32 @@ class RNTupleColumnReader;
 }
 
 class RNTupleDS final : public ROOT::RDF::RDataSource {
-   /// Clones of the first source, one for each slot
-   std::vector<std::unique_ptr<ROOT::Experimental::Detail::RPageSource>> fSources;
+   friend class Internal::RNTupleColumnReader;
+
+   /// The ntuple in one of the files of the data source
+   struct RNTupleFile {
+      /// Empty if the data source is constructed from a page source
+      std::string fFileName;
+      /// The page source the data source is constructed with; slots use it or its clones.  Otherwise, slots open
+      /// their own page sources for fFileName.
+      std::shared_ptr<ROOT::Experimental::Detail::RPageSource> fSource;
+      /// Read once when the data source is constructed and copied by the page sources of the slots
+      std::unique_ptr<RNTupleDescriptor> fDescriptor;
+      /// The first entry of the file in the entry numbering of the data source
+      ULong64_t fFirstEntry = 0;
+      ULong64_t fNEntries = 0;
+   };
+   /// The page source of a slot, attached to the file of the entries that the slot currently reads
+   struct RSlotSource {
+      std::shared_ptr<ROOT::Experimental::Detail::RPageSource> fSource;
+      std::size_t fFileIndex = 0;
+   };
+
+   std::string fNTupleName;
+   RNTupleReadOptions fOptions;
+   /// The files in the order of their entries; the ntuples must have the same schema
+   std::vector<RNTupleFile> fFiles;
+   std::vector<RSlotSource> fSlotSources;
 
    /// We prepare a column reader prototype for every column. If a column reader is actually requested
    /// in GetColumnReaders(), we move a clone of the prototype into the hands of RDataFrame.
@@ -53,11 +79,34 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    std::vector<std::unique_ptr<ROOT::Experimental::Internal::RNTupleColumnReader>> fColumnReaderPrototypes;
    std::vector<std::string> fColumnNames;
    std::vector<std::string> fColumnTypes;
+   /// Indexes into fColumnNames of the columns read by the current event loop, see SetActiveColumns()
    std::vector<size_t> fActiveColumns;
 
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
 
+   /// A restriction of the values of a column that is used to skip clusters, see AddValueRangeHint()
+   struct RValueRangeHint {
+      DescriptorId_t fPhysicalColumnId;
+      double fMin;
+      double fMax;
+   };
+   std::vector<RValueRangeHint> fValueRangeHints;
+   /// The value range hints derived from the predicates of the current event loop, see SetPredicates()
+   std::vector<RValueRangeHint> fPredicateHints;
+
+   /// Returns the physical column id of the scalar column that backs the given RDF column, or kInvalidDescriptorId
+   /// if there is no such column, e.g. for collections
+   DescriptorId_t FindValueRangeColumnId(std::string_view colName) const;
+
+   /// Adds the file, whose fDescriptor is set, after the existing files and checks that its schema matches
+   void AddFile(RNTupleFile &&file);
+   /// Returns the index into fFiles of the file that contains the given entry
+   std::size_t FindFile(ULong64_t entry) const;
+   /// Returns the page source of the slot for the given file.  If the slot read from another file before, the
+   /// page source of that file is released once the column readers of the slot switched to the new page source.
+   std::shared_ptr<ROOT::Experimental::Detail::RPageSource> GetSlotSource(unsigned int slot, std::size_t fileIndex);
+
    /// Provides the RDF column "colName" given the field identified by fieldID. For records and collections,
    /// AddField recurses into the sub fields. The skeinIDs is the list of field IDs of the outer collections
    /// of fieldId. For instance, if fieldId refers to an `std::vector<Jet>`, with
@@ -73,6 +122,10 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
 
 public:
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource);
+   /// Reads the ntuple from several files, one after the other.  The meta-data of every file is read once and
+   /// shared by the page sources of all the slots.
+   RNTupleDS(std::string_view ntupleName, const std::vector<std::string> &fileNames,
+             const RNTupleReadOptions &options = RNTupleReadOptions());
    ~RNTupleDS();
    void SetNSlots(unsigned int nSlots) final;
    const std::vector<std::string> &GetColumnNames() const final { return fColumnNames; }
@@ -82,6 +135,18 @@ public:
    std::string GetLabel() final { return "RNTupleDS"; }
 
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
+   bool SupportsBulkProcessing() const final;
+
+   /// Announce that only entries with values of `colName` in the closed interval [min, max] are of interest.
+   /// Clusters whose value statistics show that they cannot contain such entries are then skipped entirely.
+   /// The hint does not filter individual entries, i.e. the selection still needs to be applied (e.g. by a Filter).
+   /// Only scalar, numerical columns outside of collections are supported.  Must be called before the event loop.
+   void AddValueRangeHint(std::string_view colName, double min, double max);
+
+   /// Predicates on scalar columns outside of collections are used like value range hints (see AddValueRangeHint())
+   /// for the next event loop
+   void SetPredicates(const std::vector<ROOT::RDF::Experimental::RColumnPredicate> &predicates) final;
+   void SetActiveColumns(const std::vector<std::string> &columnNames) final;
 
    void Initialize() final;
    void Finalize() final;
@@ -98,6 +163,7 @@ protected:
 namespace RDF {
 namespace Experimental {
 RDataFrame FromRNTuple(std::string_view ntupleName, std::string_view fileName);
+RDataFrame FromRNTuple(std::string_view ntupleName, const std::vector<std::string> &fileNames);
 RDataFrame FromRNTuple(ROOT::Experimental::RNTuple *ntuple);
 } // namespace Experimental
 } // namespace RDF
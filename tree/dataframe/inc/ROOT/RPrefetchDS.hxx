@@ -0,0 +1,116 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RPREFETCHDS
+#define ROOT_RPREFETCHDS
+
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDataSource.hxx"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/**
+\class ROOT::RDF::Experimental::RPrefetchDS
+\ingroup dataframe
+\brief A data source that reads another data source ahead of the event loop on a background thread
+
+Data sources such as RCsvDS and RSqliteDS load their data synchronously in GetEntryRanges() and SetEntry(), so that
+the event loop waits for the I/O. RPrefetchDS runs the wrapped data source on a background thread: the thread
+requests the entry ranges of the wrapped source, sets each entry and copies the values of the columns read by the
+event loop into a buffer. A bounded number of such buffered batches of ranges is kept ahead of the event loop, which
+then only reads from memory. With implicit multi-threading, the ranges of a batch are split among the slots.
+
+Batches are filled with the values of the columns for which RDataFrame requested column readers, i.e. the columns
+used by the computation graph when the event loop starts. Reading ahead only overlaps I/O and processing if the
+wrapped data source returns its entries in several calls of GetEntryRanges(), e.g. an RCsvDS with a chunk size:
+
+~~~{.cpp}
+auto csv = std::make_unique<ROOT::RDF::RCsvDS>("data.csv", true, ',', 10000LL);
+auto df = ROOT::RDF::Experimental::FromPrefetchedSource(std::move(csv));
+auto h = df.Histo1D("x");
+~~~
+
+The wrapped source is always used with a single slot. Columns of fundamental types, std::string,
+std::vector<unsigned char> and ROOT::RVec of fundamental types can be prefetched.
+*/
+class RPrefetchDS final : public ROOT::RDF::RDataSource {
+public:
+   struct RColumn;
+   struct RBatch;
+
+private:
+   std::unique_ptr<RDataSource> fSource;
+   unsigned int fNSlots = 0U;
+   /// Maximum number of batches that are read ahead of the event loop
+   std::size_t fNBufferedBatches;
+   /// The columns for which column readers were requested, in the order of the requests
+   std::vector<std::unique_ptr<RColumn>> fColumns;
+
+   /// The batch whose entries are currently processed by the event loop
+   std::unique_ptr<RBatch> fCurrentBatch;
+   /// Per slot, the index of the range of fCurrentBatch that contains the entry of the last SetEntry() call
+   std::vector<std::size_t> fSlotRanges;
+
+   std::thread fProducer;
+   std::mutex fQueueMutex;
+   std::condition_variable fQueueCv;
+   std::deque<std::unique_ptr<RBatch>> fQueue; ///< Protected by fQueueMutex
+   bool fProducerDone = false;                 ///< Protected by fQueueMutex
+   bool fStopProducer = false;                 ///< Protected by fQueueMutex
+   std::exception_ptr fProducerError;          ///< Protected by fQueueMutex
+
+   /// The loop of the background thread
+   void Produce();
+   /// Wait for the background thread to terminate and discard the batches that were not processed
+   void StopProducer();
+
+   Record_t GetColumnReadersImpl(std::string_view name, const std::type_info &) final;
+
+public:
+   explicit RPrefetchDS(std::unique_ptr<RDataSource> source, std::size_t nBufferedBatches = 4);
+   ~RPrefetchDS();
+   RPrefetchDS(const RPrefetchDS &) = delete;
+   RPrefetchDS &operator=(const RPrefetchDS &) = delete;
+
+   void SetNSlots(unsigned int nSlots) final;
+   const std::vector<std::string> &GetColumnNames() const final;
+   bool HasColumn(std::string_view colName) const final;
+   std::string GetTypeName(std::string_view colName) const final;
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
+   bool SetEntry(unsigned int slot, ULong64_t entry) final;
+   void Initialize() final;
+   void Finalize() final;
+   std::string GetLabel() final;
+   void SetPredicates(const std::vector<ROOT::RDF::Experimental::RColumnPredicate> &predicates) final;
+   void SetActiveColumns(const std::vector<std::string> &columnNames) final;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Factory method to create an RDataFrame that reads the given data source ahead of the event loop.
+/// \param[in] source The data source to read, e.g. an RCsvDS or an RSqliteDS.
+/// \param[in] nBufferedBatches The maximum number of batches of entry ranges that are read ahead.
+RDataFrame FromPrefetchedSource(std::unique_ptr<RDataSource> source, std::size_t nBufferedBatches = 4);
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RPREFETCHDS
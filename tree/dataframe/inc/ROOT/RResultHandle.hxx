@@ -20,10 +20,16 @@
 #include <sstream>
 #include <typeinfo>
 #include <stdexcept> // std::runtime_error
+#include <vector>
 
 namespace ROOT {
 namespace RDF {
 
+class RResultHandle;
+namespace Experimental {
+unsigned int RunGraphsInOneLoop(std::vector<RResultHandle>);
+}
+
 /// \brief A type-erased version of RResultPtr and RResultMap.
 /// RResultHandles are used to invoke ROOT::RDF::RunGraphs() and can also be useful
 /// to store result pointers of different types in the same collection. Knowledge
@@ -43,6 +49,7 @@ class RResultHandle {
 
    // The ROOT::RDF::RunGraphs helper has to access the loop manager to check whether two RResultHandles belong to the same computation graph
    friend unsigned int RunGraphs(std::vector<RResultHandle>);
+   friend unsigned int Experimental::RunGraphsInOneLoop(std::vector<RResultHandle>);
 
    /// Get the pointer to the encapsulated result.
    /// Ownership is not transferred to the caller.
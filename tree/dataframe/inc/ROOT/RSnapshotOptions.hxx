@@ -13,11 +13,20 @@
 
 #include <Compression.h>
 #include <ROOT/RStringView.hxx>
+#include <cstddef>
 #include <string>
 
 namespace ROOT {
 
 namespace RDF {
+
+/// The data format of the dataset written by Snapshot
+enum class ESnapshotOutputFormat {
+   kDefault, ///< Currently TTree
+   kTTree,
+   kRNTuple ///< Requires ROOT to be built with root7
+};
+
 /// A collection of options to steer the creation of the dataset on file
 struct RSnapshotOptions {
    using ECAlgo = ROOT::ECompressionAlgorithm;
@@ -37,6 +46,9 @@ struct RSnapshotOptions {
    int fSplitLevel = 99;                       ///< Split level of output tree
    bool fLazy = false;                         ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kDefault; ///< Data format of the output dataset
+   /// For RNTuple output: approximate compressed size of the clusters filled by every slot, 0 for the RNTuple default
+   std::size_t fApproxZippedClusterSize = 0;
 };
 } // ns RDF
 } // ns ROOT
@@ -23,6 +23,14 @@ ROOT::RDF::FromArrow, which accepts one parameter:
 The types of the columns are derived from the types in the associated
 arrow::Schema.
 
+Files in the Arrow IPC format (including Feather V2 files) and in the Arrow IPC stream format can be read with
+ROOT::RDF::FromArrowIPC. The file is memory-mapped and the columns refer directly to the mapped buffers, so nothing
+is copied unless the file is compressed.
+
+Primitive columns and list columns of primitive types are not copied: their values and ROOT::RVec views point into
+the Arrow buffers. If all the columns are split in the same chunks, e.g. the record batches of an IPC file, the
+entry ranges follow the chunk boundaries.
+
 */
 // clang-format on
 
@@ -32,8 +40,10 @@ arrow::Schema.
 #include <snprintf.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 
 #if defined(__GNUC__)
@@ -41,6 +51,9 @@ arrow::Schema.
 #pragma GCC diagnostic ignored "-Wshadow"
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #endif
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/record_batch.h>
 #include <arrow/table.h>
 #include <arrow/stl.h>
 #if defined(__GNUC__)
@@ -200,6 +213,24 @@ public:
    using ::arrow::ArrayVisitor::Visit;
 };
 
+/// The address of the first value of an array of a fixed-width primitive type, null for other arrays
+const std::uint8_t *GetRawValues(const arrow::Array &array, std::size_t &valueSize)
+{
+   switch (array.type_id()) {
+   case arrow::Type::INT32:
+   case arrow::Type::UINT32:
+   case arrow::Type::FLOAT: valueSize = 4; break;
+   case arrow::Type::INT64:
+   case arrow::Type::UINT64:
+   case arrow::Type::DOUBLE: valueSize = 8; break;
+   default: return nullptr;
+   }
+   const auto &data = *array.data();
+   if (data.buffers.size() < 2 || !data.buffers[1])
+      return nullptr;
+   return data.buffers[1]->data() + data.offset * valueSize;
+}
+
 /// Helper class which keeps track for each slot where to get the entry.
 class TValueGetter {
 private:
@@ -213,6 +244,10 @@ private:
    /// quickly move to the correct chunk.
    std::vector<ULong64_t> fChunkIndex;
    arrow::ArrayVector fChunks;
+   /// For columns of fixed-width primitive types, the address of the first value of each chunk: SetEntry() then
+   /// computes the address of the value without visiting the array.
+   std::vector<const std::uint8_t *> fRawValuesPerChunk;
+   std::size_t fValueSize = 0;
 
 public:
    TValueGetter(size_t slots, arrow::ArrayVector chunks)
@@ -224,6 +259,7 @@ public:
          fFirstEntryPerChunk.push_back(next);
          next += chunk->length();
          fChunkIndex.push_back(next);
+         fRawValuesPerChunk.push_back(GetRawValues(*chunk, fValueSize));
       }
       for (size_t si = 0, se = fValuesPtrPerSlot.size(); si != se; ++si) {
          fArrayVisitorPerSlot.push_back(ArrayPtrVisitor{fValuesPtrPerSlot.data() + si});
@@ -282,6 +318,15 @@ public:
       if (fLastEntryPerSlot[slot] == entry) {
          return;
       }
+      // Fast path: a primitive value in the same chunk as the previous entry
+      const auto ci = fLastChunkPerSlot[slot];
+      const auto rawValues = fRawValuesPerChunk[ci];
+      if (rawValues && entry >= fFirstEntryPerChunk[ci] && entry < fChunkIndex[ci]) {
+         fValuesPtrPerSlot[slot] =
+            const_cast<std::uint8_t *>(rawValues) + (entry - fFirstEntryPerChunk[ci]) * fValueSize;
+         fLastEntryPerSlot[slot] = entry;
+         return;
+      }
       UncachedSlotLookup(slot, entry);
    }
 };
@@ -532,6 +577,24 @@ void splitInEqualRanges(std::vector<std::pair<ULong64_t, ULong64_t>> &ranges, in
    ranges.back().second += remainder;
 }
 
+/// Split every chunk in as many ranges as needed so that there are at least nSlots ranges
+void splitInChunkRanges(std::vector<std::pair<ULong64_t, ULong64_t>> &ranges,
+                        const std::vector<ULong64_t> &chunkBoundaries, unsigned int nSlots)
+{
+   ranges.clear();
+   const auto nChunks = chunkBoundaries.size() - 1;
+   const auto nRangesPerChunk = std::max<std::size_t>(1, (nSlots + nChunks - 1) / nChunks);
+   for (std::size_t ci = 0; ci < nChunks; ++ci) {
+      const auto begin = chunkBoundaries[ci];
+      const auto length = chunkBoundaries[ci + 1] - begin;
+      if (length == 0)
+         continue;
+      const auto nRanges = std::min<ULong64_t>(nRangesPerChunk, length);
+      for (ULong64_t ri = 0; ri < nRanges; ++ri)
+         ranges.emplace_back(begin + length * ri / nRanges, begin + length * (ri + 1) / nRanges);
+   }
+}
+
 int getNRecords(std::shared_ptr<arrow::Table> &table, std::vector<std::string> &columnNames)
 {
    auto index = table->schema()->GetFieldIndex(columnNames.front());
@@ -551,6 +614,24 @@ getData<std::shared_ptr<arrow::ChunkedArray>>(std::shared_ptr<arrow::ChunkedArra
    return p;
 }
 
+/// The first entry of each chunk followed by the number of entries, if all the given columns are split in the same
+/// chunks; empty otherwise
+std::vector<ULong64_t> getCommonChunkBoundaries(std::shared_ptr<arrow::Table> &table,
+                                                const std::vector<std::pair<size_t, size_t>> &getterIndex)
+{
+   std::vector<ULong64_t> result;
+   for (std::size_t i = 0; i < getterIndex.size(); ++i) {
+      std::vector<ULong64_t> boundaries{0};
+      for (auto &chunk : getData(table->column(getterIndex[i].first))->chunks())
+         boundaries.push_back(boundaries.back() + chunk->length());
+      if (i == 0)
+         result = std::move(boundaries);
+      else if (boundaries != result)
+         return {};
+   }
+   return result;
+}
+
 void RArrowDS::SetNSlots(unsigned int nSlots)
 {
    assert(0U == fNSlots && "Setting the number of slots even if the number of slots is different from zero.");
@@ -588,6 +669,11 @@ std::vector<void *> RArrowDS::GetColumnReadersImpl(std::string_view colName, con
 
 void RArrowDS::Initialize()
 {
+   const auto chunkBoundaries = getCommonChunkBoundaries(fTable, fGetterIndex);
+   if (chunkBoundaries.size() > 2) {
+      splitInChunkRanges(fEntryRanges, chunkBoundaries, fNSlots);
+      return;
+   }
    auto nRecords = getNRecords(fTable, fColumnNames);
    splitInEqualRanges(fEntryRanges, nRecords, fNSlots);
 }
@@ -609,6 +695,65 @@ RDataFrame FromArrow(std::shared_ptr<arrow::Table> table, std::vector<std::strin
    return tdf;
 }
 
+namespace {
+
+void ThrowIfError(const arrow::Status &status, std::string_view fileName)
+{
+   if (!status.ok()) {
+      std::string msg = "FromArrowIPC: cannot read ";
+      msg += fileName;
+      throw std::runtime_error(msg + ": " + status.ToString());
+   }
+}
+
+template <typename T>
+T ValueOrThrow(arrow::Result<T> result, std::string_view fileName)
+{
+   ThrowIfError(result.status(), fileName);
+   return std::move(result).ValueOrDie();
+}
+
+} // anonymous namespace
+
+/// \brief Factory method to create an RDataFrame from an Arrow IPC file.
+///
+/// The file is memory-mapped; the record batches of the file are read without copying their buffers (unless they
+/// are compressed) and are used as entry ranges. Both the IPC file format, i.e. Feather V2, and the IPC stream format
+/// are supported.
+/// \param[in] fileName the path of the file.
+/// \param[in] columnNames the name of the columns to use
+/// In case columnNames is empty, we use all the columns found in the file
+RDataFrame FromArrowIPC(std::string_view fileName, std::vector<std::string> const &columnNames)
+{
+   auto file = ValueOrThrow(arrow::io::MemoryMappedFile::Open(std::string(fileName), arrow::io::FileMode::READ),
+                            fileName);
+
+   std::shared_ptr<arrow::Schema> schema;
+   std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+   auto fileReader = arrow::ipc::RecordBatchFileReader::Open(file);
+   if (fileReader.ok()) {
+      auto reader = *fileReader;
+      schema = reader->schema();
+      for (int i = 0; i < reader->num_record_batches(); ++i)
+         batches.emplace_back(ValueOrThrow(reader->ReadRecordBatch(i), fileName));
+   } else {
+      // Not in the IPC file format: try the stream format, e.g. a dump of an Arrow Flight stream
+      ThrowIfError(file->Seek(0), fileName);
+      auto reader = ValueOrThrow(arrow::ipc::RecordBatchStreamReader::Open(file), fileName);
+      schema = reader->schema();
+      while (true) {
+         std::shared_ptr<arrow::RecordBatch> batch;
+         ThrowIfError(reader->ReadNext(&batch), fileName);
+         if (!batch)
+            break;
+         batches.emplace_back(std::move(batch));
+      }
+   }
+
+   auto table = ValueOrThrow(arrow::Table::FromRecordBatches(schema, batches), fileName);
+   return FromArrow(table, columnNames);
+}
+
 } // namespace RDF
 
 } // namespace ROOT
@@ -71,6 +71,7 @@ double-quote characters must be represented by a pair of double-quote characters
 The current implementation of RCsvDS reads the entire CSV file content into memory before
 RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
 important to check both how much memory is available and the size of the CSV file.
+When implicit multi-threading is enabled, the records of each chunk are parsed in parallel.
 
 RCsvDS can handle empty cells and also allows the usage of the special keywords "NaN" and "nan" to
 indicate `nan` values. If the column is of type double, these cells are stored internally as `nan`.
@@ -82,12 +83,62 @@ Empty cells and explicit `nan`-s inside columns of type Long64_t/bool are stored
 #include <ROOT/RCsvDS.hxx>
 #include <ROOT/RRawFile.hxx>
 #include <TError.h>
+#include <TROOT.h>
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
 
 #include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
 
+namespace {
+
+// The parsers below take the fast path for well-formed values and fall back to the standard library functions
+// otherwise, so that e.g. leading whitespace, a leading '+' sign and errors are handled as before.
+
+Long64_t ParseLong64(const std::string &str)
+{
+   Long64_t value = 0;
+   const auto end = str.data() + str.size();
+   const auto result = std::from_chars(str.data(), end, value);
+   if (result.ec == std::errc() && result.ptr == end)
+      return value;
+   return std::stoll(str);
+}
+
+double ParseDouble(const std::string &str)
+{
+   // std::from_chars for floating point numbers is not available with all the supported compilers
+   char *end = nullptr;
+   errno = 0;
+   const double value = std::strtod(str.c_str(), &end);
+   if (end == str.c_str() + str.size() && errno != ERANGE)
+      return value;
+   return std::stod(str);
+}
+
+bool ParseBool(const std::string &str)
+{
+   if (str == "true")
+      return true;
+   if (str == "false")
+      return false;
+   bool value = false;
+   std::istringstream(str) >> std::boolalpha >> value;
+   return value;
+}
+
+// Below this number of records in a chunk, the records are parsed sequentially
+constexpr std::size_t kMinRecordsForParallelParsing = 1024;
+
+} // anonymous namespace
+
 namespace ROOT {
 
 namespace RDF {
@@ -117,46 +168,85 @@ void RCsvDS::FillHeaders(const std::string &line)
    }
 }
 
-void RCsvDS::FillRecord(const std::string &line, Record_t &record)
+void RCsvDS::FillRecord(const std::string &line, std::size_t record, std::vector<unsigned char> &colContainsEmpty)
 {
-   auto i = 0U;
-
    auto columns = ParseColumns(line);
+   // fields missing at the end of the line keep their default value
+   const auto nColumns = std::min(columns.size(), fColTypesList.size());
 
-   for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
+   for (std::size_t i = 0; i < nColumns; ++i) {
+      auto &col = columns[i];
 
-      switch (colType) {
+      switch (fColTypesList[i]) {
       case 'D': {
-         record.emplace_back(new double((col != "nan") ? std::stod(col) : std::numeric_limits<double>::quiet_NaN()));
+         fDoubleValues[i][record] = (col != "nan") ? ParseDouble(col) : std::numeric_limits<double>::quiet_NaN();
          break;
       }
       case 'L': {
-         if (col != "nan") {
-            record.emplace_back(new Long64_t(std::stoll(col)));
-         } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            record.emplace_back(new Long64_t(0));
-         }
+         if (col != "nan")
+            fLong64Values[i][record] = ParseLong64(col);
+         else
+            colContainsEmpty[i] = 1;
          break;
       }
       case 'O': {
-         auto b = new bool();
-         record.emplace_back(b);
-         if (col != "nan") {
-            std::istringstream(col) >> std::boolalpha >> *b;
-         } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            *b = false;
-         }
+         if (col != "nan")
+            fBoolValues[i][record] = ParseBool(col);
+         else
+            colContainsEmpty[i] = 1;
          break;
       }
       case 'T': {
-         record.emplace_back(new std::string(col));
+         fStringValues[i][record] = std::move(col);
          break;
       }
       }
-      ++i;
+   }
+}
+
+void RCsvDS::FillRecords(const std::vector<std::string> &lines)
+{
+   const auto nRecords = lines.size();
+   const auto nColumns = fColTypesList.size();
+   for (std::size_t i = 0; i < nColumns; ++i) {
+      switch (fColTypesList[i]) {
+      case 'D': fDoubleValues[i].assign(nRecords, 0.); break;
+      case 'L': fLong64Values[i].assign(nRecords, 0); break;
+      case 'O': fBoolValues[i].assign(nRecords, false); break;
+      case 'T': fStringValues[i].assign(nRecords, std::string()); break;
+      }
+   }
+
+   // Every record only writes its own elements of the value containers, so records can be parsed concurrently
+   auto fillRange = [&](std::size_t begin, std::size_t end, std::vector<unsigned char> &colContainsEmpty) {
+      for (auto record = begin; record < end; ++record)
+         FillRecord(lines[record], record, colContainsEmpty);
+   };
+
+   std::vector<unsigned char> colContainsEmpty(nColumns, 0);
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nRecords >= kMinRecordsForParallelParsing) {
+      ROOT::TThreadExecutor pool;
+      const auto nTasks = std::min<std::size_t>(4 * pool.GetPoolSize(), nRecords / kMinRecordsForParallelParsing);
+      std::vector<std::vector<unsigned char>> taskContainsEmpty(nTasks, std::vector<unsigned char>(nColumns, 0));
+      pool.Foreach(
+         [&](unsigned int task) {
+            fillRange(nRecords * task / nTasks, nRecords * (task + 1) / nTasks, taskContainsEmpty[task]);
+         },
+         ROOT::TSeqU(nTasks));
+      for (const auto &taskFlags : taskContainsEmpty) {
+         for (std::size_t i = 0; i < nColumns; ++i)
+            colContainsEmpty[i] |= taskFlags[i];
+      }
+   } else
+#endif
+   {
+      fillRange(0, nRecords, colContainsEmpty);
+   }
+
+   for (std::size_t i = 0; i < nColumns; ++i) {
+      if (colContainsEmpty[i])
+         fColContainingEmpty.insert(fHeaders[i]);
    }
 }
 
@@ -184,19 +274,9 @@ std::vector<void *> RCsvDS::GetColumnReadersImpl(std::string_view colName, const
    const auto &colNames = GetColumnNames();
    const auto index = std::distance(colNames.begin(), std::find(colNames.begin(), colNames.end(), colName));
    std::vector<void *> ret(fNSlots);
-   for (auto slot : ROOT::TSeqU(fNSlots)) {
-      auto &val = fColAddresses[index][slot];
-      if (ti == typeid(double)) {
-         val = &fDoubleEvtValues[index][slot];
-      } else if (ti == typeid(Long64_t)) {
-         val = &fLong64EvtValues[index][slot];
-      } else if (ti == typeid(std::string)) {
-         val = &fStringEvtValues[index][slot];
-      } else {
-         val = &fBoolEvtValues[index][slot];
-      }
-      ret[slot] = &val;
-   }
+   // the addresses are set by SetEntry() to point to the values of the current record
+   for (auto slot : ROOT::TSeqU(fNSlots))
+      ret[slot] = &fColAddresses[index][slot];
    return ret;
 }
 
@@ -273,7 +353,7 @@ void RCsvDS::InferType(const std::string &col, unsigned int idxCol)
    fColTypesList.push_back(type);
 }
 
-std::vector<std::string> RCsvDS::ParseColumns(const std::string &line)
+std::vector<std::string> RCsvDS::ParseColumns(const std::string &line) const
 {
    std::vector<std::string> columns;
 
@@ -284,7 +364,7 @@ std::vector<std::string> RCsvDS::ParseColumns(const std::string &line)
    return columns;
 }
 
-size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &columns, size_t i)
+size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &columns, size_t i) const
 {
    std::string val;
    bool quoted = false;
@@ -376,31 +456,14 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
 
 void RCsvDS::FreeRecords()
 {
-   for (auto &record : fRecords) {
-      for (size_t i = 0; i < record.size(); ++i) {
-         void *p = record[i];
-         const auto colType = fColTypes[fHeaders[i]];
-         switch (colType) {
-         case 'D': {
-            delete static_cast<double *>(p);
-            break;
-         }
-         case 'L': {
-            delete static_cast<Long64_t *>(p);
-            break;
-         }
-         case 'O': {
-            delete static_cast<bool *>(p);
-            break;
-         }
-         case 'T': {
-            delete static_cast<std::string *>(p);
-            break;
-         }
-         }
-      }
-   }
-   fRecords.clear();
+   for (auto &values : fDoubleValues)
+      std::vector<double>().swap(values);
+   for (auto &values : fLong64Values)
+      std::vector<Long64_t>().swap(values);
+   for (auto &values : fStringValues)
+      std::vector<std::string>().swap(values);
+   for (auto &values : fBoolValues)
+      std::deque<bool>().swap(values);
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -429,13 +492,15 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
    auto linesToRead = fLinesChunkSize;
    FreeRecords();
 
+   std::vector<std::string> lines;
    std::string line;
    while ((-1LL == fLinesChunkSize || 0 != linesToRead) && fCsvFile->Readln(line)) {
       if (line.empty()) continue; // skip empty lines
-      fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
+      lines.emplace_back(std::move(line));
       --linesToRead;
    }
+   FillRecords(lines);
+   const auto nRecords = lines.size();
 
    if (!fColContainingEmpty.empty()) {
       std::string msg = "";
@@ -451,14 +516,13 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 
    if (gDebug > 0) {
       if (fLinesChunkSize == -1LL) {
-         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", fRecords.size());
+         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", nRecords);
       } else {
-         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fRecords.size());
+         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, nRecords);
       }
    }
 
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   const auto nRecords = fRecords.size();
    if (0 == nRecords)
       return entryRanges;
 
@@ -509,22 +573,22 @@ bool RCsvDS::SetEntry(unsigned int slot, ULong64_t entry)
    const auto recordPos = entry - offset;
    int colIndex = 0;
    for (auto &colType : fColTypesList) {
-      auto dataPtr = fRecords[recordPos][colIndex];
+      auto &address = fColAddresses[colIndex][slot];
       switch (colType) {
       case 'D': {
-         fDoubleEvtValues[colIndex][slot] = *static_cast<double *>(dataPtr);
+         address = &fDoubleValues[colIndex][recordPos];
          break;
       }
       case 'L': {
-         fLong64EvtValues[colIndex][slot] = *static_cast<Long64_t *>(dataPtr);
+         address = &fLong64Values[colIndex][recordPos];
          break;
       }
       case 'O': {
-         fBoolEvtValues[colIndex][slot] = *static_cast<bool *>(dataPtr);
+         address = &fBoolValues[colIndex][recordPos];
          break;
       }
       case 'T': {
-         fStringEvtValues[colIndex][slot] = *static_cast<std::string *>(dataPtr);
+         address = &fStringValues[colIndex][recordPos];
          break;
       }
       }
@@ -543,11 +607,11 @@ void RCsvDS::SetNSlots(unsigned int nSlots)
    // Initialize the entire set of addresses
    fColAddresses.resize(nColumns, std::vector<void *>(fNSlots, nullptr));
 
-   // Initialize the per event data holders
-   fDoubleEvtValues.resize(nColumns, std::vector<double>(fNSlots));
-   fLong64EvtValues.resize(nColumns, std::vector<Long64_t>(fNSlots));
-   fStringEvtValues.resize(nColumns, std::vector<std::string>(fNSlots));
-   fBoolEvtValues.resize(nColumns, std::deque<bool>(fNSlots));
+   // Initialize the containers of the values of the records, filled by GetEntryRanges()
+   fDoubleValues.resize(nColumns);
+   fLong64Values.resize(nColumns);
+   fStringValues.resize(nColumns);
+   fBoolValues.resize(nColumns);
 }
 
 std::string RCsvDS::GetLabel()
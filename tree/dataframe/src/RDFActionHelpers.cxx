@@ -10,6 +10,10 @@
 
 #include "ROOT/RDF/ActionHelpers.hxx"
 #include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#ifdef R__HAS_ROOT7
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RNTupleDS.hxx" // FromRNTuple
+#endif
 
 namespace ROOT {
 namespace Internal {
@@ -107,6 +111,93 @@ void BufferedFillHelper::Finalize()
    }
 }
 
+namespace {
+/// Gives access to the protected TH1::GetStatOverflowsBehaviour()
+struct RStatOverflowsAccess : public TH1 {
+   static bool Get(const TH1 &h) { return (h.*(&RStatOverflowsAccess::GetStatOverflowsBehaviour))(); }
+};
+} // anonymous namespace
+
+bool GetStatOverflowsBehaviour(const TH1 &h)
+{
+   return RStatOverflowsAccess::Get(h);
+}
+
+void ComputeFixedBins(const std::vector<RFixedBinAxis> &axes, const std::vector<double> *coords,
+                      std::vector<int> &bins, std::vector<unsigned char> &inRange)
+{
+   const auto n = coords[0].size();
+   bins.assign(n, 0);
+   inRange.assign(n, 1);
+
+   // The global bin is computed one axis at a time, with the same arithmetic as TAxis::FindBin() and TH1::GetBin().
+   // These loops have no branches that the compiler cannot turn into selects, so that they can be vectorized.
+   int stride = 1;
+   for (std::size_t d = 0; d < axes.size(); ++d) {
+      const auto nBins = axes[d].fNBins;
+      const auto min = axes[d].fMin;
+      const auto max = axes[d].fMax;
+      const double *x = coords[d].data();
+      int *b = bins.data();
+      unsigned char *r = inRange.data();
+      for (std::size_t i = 0; i < n; ++i) {
+         const int bin = x[i] < min ? 0 : (x[i] < max ? 1 + int(nBins * (x[i] - min) / (max - min)) : nBins + 1);
+         b[i] += stride * bin;
+         r[i] &= (bin > 0) & (bin <= nBins);
+      }
+      stride *= nBins + 2;
+   }
+}
+
+void AddFixedBinStats(std::size_t nDims, const std::vector<double> *coords, const std::vector<double> &weights,
+                      const std::vector<unsigned char> &inRange, bool statOverflows, double *stats)
+{
+   // The statistics follow TH1::Fill(), TH2::Fill() and TH3::Fill(), including the order of the operations
+   const auto n = coords[0].size();
+   const bool hasWeights = !weights.empty();
+   const double *x = coords[0].data();
+   const double *y = nDims > 1 ? coords[1].data() : nullptr;
+   const double *z = nDims > 2 ? coords[2].data() : nullptr;
+   for (std::size_t i = 0; i < n; ++i) {
+      if (!inRange[i] && !statOverflows)
+         continue;
+      const double w = hasWeights ? weights[i] : 1.;
+      stats[0] += w;
+      stats[1] += w * w;
+      stats[2] += w * x[i];
+      stats[3] += w * x[i] * x[i];
+      if (y) {
+         stats[4] += w * y[i];
+         stats[5] += w * y[i] * y[i];
+         stats[6] += w * x[i] * y[i];
+      }
+      if (z) {
+         stats[7] += w * z[i];
+         stats[8] += w * z[i] * z[i];
+         stats[9] += w * x[i] * z[i];
+         stats[10] += w * y[i] * z[i];
+      }
+   }
+}
+
+void FillFixedBins(const std::vector<RFixedBinAxis> &axes, const std::vector<double> *coords,
+                   const std::vector<double> &weights, bool statOverflows, double *contents, double *sumw2,
+                   double *stats, std::vector<int> &bins, std::vector<unsigned char> &inRange)
+{
+   ComputeFixedBins(axes, coords, bins, inRange);
+
+   const auto n = coords[0].size();
+   const bool hasWeights = !weights.empty();
+   for (std::size_t i = 0; i < n; ++i) {
+      const double w = hasWeights ? weights[i] : 1.;
+      contents[bins[i]] += w;
+      if (sumw2)
+         sumw2[bins[i]] += w * w;
+   }
+
+   AddFixedBinStats(axes.size(), coords, weights, inRange, statOverflows, stats);
+}
+
 MeanHelper::MeanHelper(const std::shared_ptr<double> &meanVPtr, const unsigned int nSlots)
    : fResultMean(meanVPtr), fCounts(nSlots, 0), fSums(nSlots, 0), fPartialMeans(nSlots), fCompensations(nSlots)
 {
@@ -254,6 +345,35 @@ void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &tre
    }
 }
 
+#ifdef R__HAS_ROOT7
+void ValidateSnapshotRNTupleOutput(const RSnapshotOptions &opts, const std::string &dirName)
+{
+   TString fileMode = opts.fMode;
+   fileMode.ToLower();
+   if (fileMode != "recreate")
+      throw std::invalid_argument("Snapshot: RNTuple output only supports the RECREATE file mode");
+   if (!dirName.empty())
+      throw std::invalid_argument("Snapshot: RNTuple output cannot be written to a subdirectory (" + dirName + ")");
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+MakeSnapshotRNTupleWriter(std::unique_ptr<ROOT::Experimental::RNTupleModel> model, const std::string &ntupleName,
+                          const std::string &fileName, const RSnapshotOptions &options)
+{
+   ROOT::Experimental::RNTupleWriteOptions writeOptions;
+   writeOptions.SetCompression(ROOT::CompressionSettings(options.fCompressionAlgorithm, options.fCompressionLevel));
+   if (options.fApproxZippedClusterSize > 0)
+      writeOptions.SetApproxZippedClusterSize(options.fApproxZippedClusterSize);
+   return ROOT::Experimental::RNTupleParallelWriter::Recreate(std::move(model), ntupleName, fileName, writeOptions);
+}
+
+void SetSnapshotRNTupleOutput(SnapshotOutputDataFrame_t &outputDataFrame, const std::string &ntupleName,
+                              const std::string &fileName)
+{
+   outputDataFrame = ROOT::RDF::Experimental::FromRNTuple(ntupleName, fileName);
+}
+#endif // R__HAS_ROOT7
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
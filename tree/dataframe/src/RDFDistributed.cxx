@@ -0,0 +1,54 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDFDistributed.hxx>
+#include <TBufferFile.h>
+#include <TClass.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+
+ROOT::RDF::Experimental::RDatasetSpec::REntryRange
+ROOT::RDF::Experimental::GetRankEntryRange(Long64_t nEntries, int rank, int nRanks)
+{
+   if (nRanks <= 0 || rank < 0 || rank >= nRanks)
+      throw std::invalid_argument("GetRankEntryRange: invalid rank " + std::to_string(rank) + " of " +
+                                  std::to_string(nRanks) + ".");
+   if (nEntries < 0)
+      throw std::invalid_argument("GetRankEntryRange: invalid number of entries " + std::to_string(nEntries) + ".");
+   // the first nEntries % nRanks ranks process one entry more than the others
+   const Long64_t nPerRank = nEntries / nRanks;
+   const Long64_t remainder = nEntries % nRanks;
+   const Long64_t begin = rank * nPerRank + std::min<Long64_t>(rank, remainder);
+   const Long64_t end = begin + nPerRank + (rank < remainder ? 1 : 0);
+   return RDatasetSpec::REntryRange(begin, end);
+}
+
+std::vector<char> ROOT::Internal::RDF::SerializeMergeableValue(const ROOT::Detail::RDF::RMergeableValueBase &value)
+{
+   auto cl = TClass::GetClass(typeid(value));
+   if (!cl)
+      throw std::runtime_error("SerializeMergeableValue: no dictionary for the result type.");
+   TBufferFile buffer(TBuffer::kWrite);
+   buffer.WriteObjectAny(&value, cl);
+   return std::vector<char>(buffer.Buffer(), buffer.Buffer() + buffer.Length());
+}
+
+std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase>
+ROOT::Internal::RDF::DeserializeMergeableValue(const std::vector<char> &buffer)
+{
+   // the buffer is only read from
+   TBufferFile reader(TBuffer::kRead, buffer.size(), const_cast<char *>(buffer.data()), /*adopt=*/false);
+   auto value = reader.ReadObjectAny(TClass::GetClass<ROOT::Detail::RDF::RMergeableValueBase>());
+   if (!value)
+      throw std::runtime_error("DeserializeMergeableValue: the buffer does not contain a mergeable value.");
+   return std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase>(
+      static_cast<ROOT::Detail::RDF::RMergeableValueBase *>(value));
+}
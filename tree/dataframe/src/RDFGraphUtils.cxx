@@ -27,7 +27,10 @@ GraphDrawing::CreateDefineNode(const std::string &columnName, const ROOT::Detail
    if (duplicateDefineIt != visitedMap.end())
       return duplicateDefineIt->second;
 
-   auto node = std::make_shared<GraphNode>("Define\\n" + columnName, visitedMap.size(), ENodeType::kDefine);
+   const auto profileLabel = columnPtr->GetProfileLabel();
+   auto node =
+      std::make_shared<GraphNode>("Define\\n" + columnName + (profileLabel.empty() ? "" : "\\n" + profileLabel),
+                                  visitedMap.size(), ENodeType::kDefine);
    visitedMap[(void *)columnPtr] = node;
    return node;
 }
@@ -43,8 +46,10 @@ GraphDrawing::CreateFilterNode(const ROOT::Detail::RDF::RFilterBase *filterPtr,
       return duplicateFilterIt->second;
    }
 
-   auto node = std::make_shared<GraphNode>((filterPtr->HasName() ? filterPtr->GetName() : "Filter"), visitedMap.size(),
-                                           ENodeType::kFilter);
+   const auto profileLabel = filterPtr->GetProfileLabel();
+   auto node = std::make_shared<GraphNode>((filterPtr->HasName() ? filterPtr->GetName() : "Filter") +
+                                              (profileLabel.empty() ? "" : "\\n" + profileLabel),
+                                           visitedMap.size(), ENodeType::kFilter);
    visitedMap[(void *)filterPtr] = node;
    return node;
 }
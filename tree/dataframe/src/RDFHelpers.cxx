@@ -12,6 +12,7 @@
 #include "TROOT.h"      // IsImplicitMTEnabled
 #include "TError.h"     // Warning
 #include "TStopwatch.h"
+#include "TVirtualMutex.h" // R__LOCKGUARD
 #include "RConfigure.h" // R__USE_IMT
 #include "ROOT/RLogger.hxx"
 #include "ROOT/RDF/RLoopManager.hxx" // for RLoopManager
@@ -337,6 +338,44 @@ void AddProgressbar(ROOT::RDataFrame dataframe)
    auto node = ROOT::RDF::AsRNode(dataframe);
    ROOT::RDF::Experimental::AddProgressbar(node);
 }
+
+void SetJitCacheDirectory(std::string_view dir)
+{
+   R__LOCKGUARD(gROOTMutex);
+   ROOT::Internal::RDF::GetJitCacheDirectory() = std::string(dir);
+}
+
+unsigned int RunGraphsInOneLoop(std::vector<RResultHandle> handles)
+{
+   if (handles.empty()) {
+      Warning("RunGraphsInOneLoop", "Got an empty list of handles, now quitting.");
+      return 0u;
+   }
+
+   // Find the unique computation graphs that still have results to produce, keeping the order of the handles
+   std::vector<ROOT::Detail::RDF::RLoopManager *> loops;
+   for (const auto &h : handles) {
+      if (!h.IsReady() && std::find(loops.begin(), loops.end(), h.fLoopManager) == loops.end())
+         loops.emplace_back(h.fLoopManager);
+   }
+   const std::size_t nReady = std::count_if(handles.begin(), handles.end(), [](const auto &h) { return h.IsReady(); });
+   if (nReady > 0) {
+      Warning("RunGraphsInOneLoop", "Got %lu handles from which %lu link to results which are already ready.",
+              handles.size(), nReady);
+   }
+   if (loops.empty())
+      return 0u;
+
+   TStopwatch sw;
+   sw.Start();
+   loops[0]->RunShared(std::vector<ROOT::Detail::RDF::RLoopManager *>(loops.begin() + 1, loops.end()));
+   sw.Stop();
+   R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel())
+      << "Finished RunGraphsInOneLoop run (" << loops.size() << " unique computation graphs, " << sw.CpuTime()
+      << "s CPU, " << sw.RealTime() << "s elapsed).";
+
+   return loops.size();
+}
 } // namespace Experimental
 } // namespace RDF
 } // namespace ROOT
@@ -9,6 +9,7 @@
  *************************************************************************/
 
 #include <ROOT/RDataSource.hxx>
+#include <ROOT/RDF/GraphNode.hxx>
 #include <ROOT/RDF/InterfaceUtils.hxx>
 #include <ROOT/RDF/RColumnRegister.hxx>
 #include <ROOT/RDF/RDisplay.hxx>
@@ -19,17 +20,23 @@
 #include <ROOT/RDF/RLoopManager.hxx>
 #include <ROOT/RDF/RNodeBase.hxx>
 #include <ROOT/RDF/Utils.hxx>
+#include <ROOT/InternalTreeUtils.hxx> // GetFileNamesFromTree
+#include <ROOT/RLogger.hxx>
 #include <ROOT/RStringView.hxx>
+#include <RConfigure.h> // R__HAS_ROOT7
 #include <TBranch.h>
 #include <TClass.h>
 #include <TClassEdit.h>
 #include <TDataType.h>
 #include <TError.h>
 #include <TLeaf.h>
+#include <TMD5.h>
 #include <TObjArray.h>
+#include <TObjString.h>
 #include <TPRegexp.h>
 #include <TROOT.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 #include <TVirtualMutex.h>
 
@@ -219,6 +226,70 @@ static ParsedExpression ParseRDFExpression(std::string_view expr, const ColumnNa
    return ParsedExpression{std::string(std::move(exprWithVars)), std::move(usedCols), std::move(varNames)};
 }
 
+/// Split a Filter expression that is a conjunction of comparisons between dataset columns and numerical constants,
+/// e.g. "pt > 10 && 2.5 >= eta", into column predicates. Return an empty list if the expression has any other form
+/// or if it uses Defines, Aliases or columns with systematic variations.
+static std::vector<ROOT::RDF::Experimental::RColumnPredicate>
+ExtractColumnPredicates(std::string_view expr, const ROOT::Internal::RDF::RColumnRegister &colRegister,
+                        const ROOT::RDF::RDataSource &ds)
+{
+   using ROOT::RDF::Experimental::RColumnPredicate;
+   using EOperator = RColumnPredicate::EOperator;
+
+   const std::string kColumn = R"(([A-Za-z_][\w.]*))";
+   const std::string kOperator = R"((<=|>=|==|!=|<|>))";
+   const std::string kNumber = R"(([-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?))";
+   TPRegexp columnFirst("^\\s*" + kColumn + "\\s*" + kOperator + "\\s*" + kNumber + "\\s*$");
+   TPRegexp numberFirst("^\\s*" + kNumber + "\\s*" + kOperator + "\\s*" + kColumn + "\\s*$");
+
+   const auto toOperator = [](const TString &op, bool mirror) {
+      if (op == "<")
+         return mirror ? EOperator::kGreater : EOperator::kLess;
+      if (op == "<=")
+         return mirror ? EOperator::kGreaterEqual : EOperator::kLessEqual;
+      if (op == ">")
+         return mirror ? EOperator::kLess : EOperator::kGreater;
+      if (op == ">=")
+         return mirror ? EOperator::kLessEqual : EOperator::kGreaterEqual;
+      if (op == "==")
+         return EOperator::kEqual;
+      return EOperator::kNotEqual;
+   };
+
+   std::vector<RColumnPredicate> predicates;
+   const std::string expression(expr);
+   std::string::size_type start = 0;
+   while (true) {
+      const auto end = expression.find("&&", start);
+      const TString term = expression.substr(start, end == std::string::npos ? end : end - start);
+
+      bool mirror = false;
+      std::unique_ptr<TObjArray> groups(columnFirst.MatchS(term));
+      if (groups->GetLast() != 3) {
+         groups.reset(numberFirst.MatchS(term));
+         mirror = true;
+      }
+      if (groups->GetLast() != 3)
+         return {};
+      const auto group = [&groups](int i) { return static_cast<TObjString *>(groups->At(i))->GetString(); };
+
+      RColumnPredicate predicate;
+      predicate.fColumnName = (mirror ? group(3) : group(1)).Data();
+      predicate.fOperator = toOperator(group(2), mirror);
+      predicate.fValue = std::stod((mirror ? group(1) : group(3)).Data());
+      const auto &colName = predicate.fColumnName;
+      if (colRegister.IsDefineOrAlias(colName) || !ds.HasColumn(colName) ||
+          !colRegister.GetVariationDeps(ColumnNames_t{colName}).empty())
+         return {};
+      predicates.emplace_back(std::move(predicate));
+
+      if (end == std::string::npos)
+         break;
+      start = end + 2;
+   }
+   return predicates;
+}
+
 /// Return the static global map of Filter/Define functions that have been jitted.
 /// It's used to check whether a given expression has already been jitted, and
 /// to look up its associated variable name if it is.
@@ -643,6 +714,8 @@ std::shared_ptr<RDFDetail::RJittedFilter>
 BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string_view name, std::string_view expression,
               const ColumnNames_t &branches, const RColumnRegister &colRegister, TTree *tree, RDataSource *ds)
 {
+   (*prevNodeOnHeap)->GetLoopManagerUnchecked()->ThrowIfJittingDisabled("the Filter expression \"" +
+                                                                        std::string(expression) + "\"");
    const auto &dsColumns = ds ? ds->GetColumnNames() : ColumnNames_t{};
 
    const auto parsedExpr = ParseRDFExpression(expression, branches, colRegister, dsColumns);
@@ -661,6 +734,8 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
    const auto jittedFilter = std::make_shared<RDFDetail::RJittedFilter>(
       (*prevNodeOnHeap)->GetLoopManagerUnchecked(), name,
       Union(colRegister.GetVariationDeps(parsedExpr.fUsedCols), (*prevNodeOnHeap)->GetVariations()));
+   if (ds)
+      jittedFilter->SetPredicates(ExtractColumnPredicates(expression, colRegister, *ds));
 
    // Produce code snippet that creates the filter and registers it with the corresponding RJittedFilter
    // Windows requires std::hex << std::showbase << (size_t)pointer to produce notation "0x1234"
@@ -694,6 +769,8 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
                                              const ColumnNames_t &branches,
                                              std::shared_ptr<RNodeBase> *upcastNodeOnHeap)
 {
+   lm.ThrowIfJittingDisabled("the expression \"" + std::string(expression) + "\" of Define(\"" + std::string(name) +
+                             "\")");
    auto *const tree = lm.GetTree();
    const auto &dsColumns = ds ? ds->GetColumnNames() : ColumnNames_t{};
 
@@ -736,6 +813,8 @@ std::shared_ptr<RJittedDefine> BookDefinePerSampleJit(std::string_view name, std
                                                       RLoopManager &lm, const RColumnRegister &colRegister,
                                                       std::shared_ptr<RNodeBase> *upcastNodeOnHeap)
 {
+   lm.ThrowIfJittingDisabled("the expression \"" + std::string(expression) + "\" of DefinePerSample(\"" +
+                             std::string(name) + "\")");
    const auto funcName = DeclareFunction(std::string(expression), {"rdfslot_", "rdfsampleinfo_"},
                                          {"unsigned int", "const ROOT::RDF::RSampleInfo"});
    const auto retType = RetTypeOfFunc(funcName);
@@ -769,6 +848,8 @@ BookVariationJit(const std::vector<std::string> &colNames, std::string_view vari
                  RDataSource *ds, const RColumnRegister &colRegister, const ColumnNames_t &branches,
                  std::shared_ptr<RNodeBase> *upcastNodeOnHeap, bool isSingleColumn)
 {
+   lm.ThrowIfJittingDisabled("the expression \"" + std::string(expression) + "\" of Vary(\"" +
+                             std::string(variationName) + "\")");
    auto *const tree = lm.GetTree();
    const auto &dsColumns = ds ? ds->GetColumnNames() : ColumnNames_t{};
 
@@ -875,6 +956,18 @@ std::string JitBuildAction(const ColumnNames_t &cols, std::shared_ptr<RDFDetail:
    return createAction_str.str();
 }
 
+bool HasFixedBinAxes(const TH1 &h)
+{
+   if (h.GetBufferSize() > 0)
+      return false;
+   const TAxis *axes[] = {h.GetXaxis(), h.GetYaxis(), h.GetZaxis()};
+   for (int d = 0; d < h.GetDimension(); ++d) {
+      if (axes[d]->GetXbins()->GetSize() > 0 || axes[d]->CanExtend() || axes[d]->IsAlphanumeric())
+         return false;
+   }
+   return true;
+}
+
 bool AtLeastOneEmptyString(const std::vector<std::string_view> strings)
 {
    for (const auto &s : strings) {
@@ -1015,6 +1108,67 @@ void RemoveDuplicates(ColumnNames_t &columnNames)
       columnNames.end());
 }
 
+/// The cache file name is derived from everything that determines the content of the cached columns and that is known
+/// without running the event loop: the ROOT version, the kinds and names of the upstream nodes, the names and types
+/// of the cached columns and the names, sizes and modification times of the input files.
+#ifdef R__HAS_ROOT7
+void OpenPersistentCache(RInterface<RLoopManager, void> &cachedDF, const std::string &cacheDir, RNodeBase &node,
+                         const ColumnNames_t &columns, const ColumnNames_t &columnTypes,
+                         const PersistentCacheWriter_t &writeCache)
+{
+   auto &lm = *node.GetLoopManagerUnchecked();
+   if (lm.GetDataSource())
+      throw std::runtime_error("PersistentCache: only supported for TTree/TChain inputs and empty sources.");
+
+   // Jitted filters and ranges only become part of the graph once they are jitted
+   lm.Jit();
+   std::string key = std::string(gROOT->GetVersion()) + '\n';
+   std::unordered_map<void *, std::shared_ptr<GraphDrawing::GraphNode>> visitedMap;
+   const auto leaf = node.GetGraph(visitedMap);
+   for (const auto *graphNode = leaf.get(); graphNode; graphNode = graphNode->GetPrevNode())
+      key += graphNode->GetShape() + ' ' + graphNode->GetName() + '\n';
+   for (std::size_t i = 0; i < columns.size(); ++i)
+      key += columns[i] + ' ' + columnTypes[i] + '\n';
+   if (auto *tree = lm.GetTree()) {
+      for (const auto &fileName : ROOT::Internal::TreeUtils::GetFileNamesFromTree(*tree)) {
+         key += fileName;
+         FileStat_t stat;
+         if (gSystem->GetPathInfo(fileName.c_str(), stat) == 0)
+            key += ' ' + std::to_string(stat.fSize) + ' ' + std::to_string(stat.fMtime);
+         key += '\n';
+      }
+   } else {
+      key += "empty source " + std::to_string(lm.GetNEmptyEntries()) + '\n';
+   }
+
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   const std::string ntupleName = "R_rdf_cache";
+   const std::string fileName = cacheDir + "/R_rdf_cache_" + md5.AsString() + ".root";
+
+   // AccessPathName returns false if the file exists
+   if (gSystem->AccessPathName(fileName.c_str())) {
+      R__LOG_INFO(RDFLogChannel()) << "PersistentCache: writing " << fileName;
+      gSystem->mkdir(cacheDir.c_str(), /*recursive=*/true);
+      // Write to a process-specific file first so that concurrent processes never read a partial cache file
+      const auto tmpFileName = fileName + ".tmp" + std::to_string(gSystem->GetPid());
+      writeCache(ntupleName, tmpFileName);
+      if (gSystem->Rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+         throw std::runtime_error("PersistentCache: could not move " + tmpFileName + " to " + fileName);
+   } else {
+      R__LOG_INFO(RDFLogChannel()) << "PersistentCache: reading " << fileName;
+   }
+   SetSnapshotRNTupleOutput(cachedDF, ntupleName, fileName);
+}
+#else
+void OpenPersistentCache(RInterface<RLoopManager, void> &, const std::string &, RNodeBase &, const ColumnNames_t &,
+                         const ColumnNames_t &, const PersistentCacheWriter_t &)
+{
+   throw std::runtime_error("PersistentCache: RDataFrame was built without RNTuple support (root7=OFF).");
+}
+#endif
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
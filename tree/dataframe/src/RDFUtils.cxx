@@ -20,16 +20,23 @@
 #include "TClass.h"
 #include "TClassEdit.h"
 #include "TClassRef.h"
+#include "TEnv.h"
 #include "TError.h" // Info
 #include "TInterpreter.h"
 #include "TLeaf.h"
+#include "TLockFile.h"
+#include "TMD5.h"
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
+#include "TSystem.h"
 #include "TTree.h"
 
+#include <cctype>
+#include <fstream>
 #include <stdexcept>
 #include <string>
 #include <cstring>
 #include <typeinfo>
+#include <vector>
 
 using namespace ROOT::Detail::RDF;
 using namespace ROOT::RDF;
@@ -312,6 +319,14 @@ std::vector<std::string> ReplaceDotWithUnderscore(const std::vector<std::string>
    return newColNames;
 }
 
+/// All the code successfully declared through InterpreterDeclare, in declaration order. The jitted code executed by
+/// InterpreterCalcCached refers to these declarations, so they are part of the cached libraries.
+static std::string &GetDeclaredCode()
+{
+   static std::string code;
+   return code;
+}
+
 void InterpreterDeclare(const std::string &code)
 {
    R__LOG_DEBUG(10, RDFLogChannel()) << "Declaring the following code to cling:\n\n" << code << '\n';
@@ -322,6 +337,7 @@ void InterpreterDeclare(const std::string &code)
          "the crash\n All RDF objects that have not run an event loop yet should be considered in an invalid state.\n";
       throw std::runtime_error(msg);
    }
+   GetDeclaredCode() += code + "\n";
 }
 
 Long64_t InterpreterCalc(const std::string &code, const std::string &context)
@@ -360,6 +376,113 @@ Long64_t InterpreterCalc(const std::string &code, const std::string &context)
    return 0; // we used to forward the return value of Calc, but that's not possible anymore.
 }
 
+std::string &GetJitCacheDirectory()
+{
+   static std::string dir = gEnv->GetValue("RDataFrame.JitCacheDir", "");
+   return dir;
+}
+
+/// Replace the addresses of the objects that the jitted code operates on, i.e. the hexadecimal literals of the
+/// `reinterpret_cast<T*>(0x...)` expressions, by the elements of the `rdfJitArgs` array. The addresses are collected
+/// in `args`. Hexadecimal digits in string literals, e.g. in filter names, are left untouched.
+static std::string AbstractAddresses(const std::string &code, std::vector<void *> &args)
+{
+   std::string result;
+   result.reserve(code.size());
+   bool inString = false;
+   for (std::size_t i = 0; i < code.size(); ++i) {
+      const char c = code[i];
+      if (inString) {
+         result += c;
+         if (c == '\\' && i + 1 < code.size())
+            result += code[++i];
+         else if (c == '"')
+            inString = false;
+         continue;
+      }
+      if (c == '"') {
+         inString = true;
+      } else if (c == '0' && i > 0 && code[i - 1] == '(' && i + 2 < code.size() && code[i + 1] == 'x' &&
+                 std::isxdigit(static_cast<unsigned char>(code[i + 2]))) {
+         std::size_t end = i + 2;
+         while (end < code.size() && std::isxdigit(static_cast<unsigned char>(code[end])))
+            ++end;
+         args.emplace_back(reinterpret_cast<void *>(std::stoull(code.substr(i, end - i), nullptr, 16)));
+         result += "rdfJitArgs[" + std::to_string(args.size() - 1) + "]";
+         i = end - 1;
+         continue;
+      }
+      result += c;
+   }
+   return result;
+}
+
+bool InterpreterCalcCached(const std::string &code, const std::string &cacheDir)
+{
+   std::vector<void *> args;
+   const auto body = AbstractAddresses(code, args);
+
+   // The key covers the ROOT version, the declarations the code depends on and the address-free code itself
+   const std::string keyInput = std::string(gROOT->GetVersion()) + "\n" + GetDeclaredCode() + body;
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(keyInput.data()), keyInput.size());
+   md5.Final();
+   const std::string name = std::string("R_rdf_jitcache_") + md5.AsString();
+   const std::string basePath = cacheDir + "/" + name;
+   const std::string sourcePath = basePath + ".cxx";
+   const std::string failedPath = basePath + ".failed";
+
+   // gSystem->AccessPathName returns true if the path does _not_ exist
+   if (!gSystem->AccessPathName(failedPath.c_str()))
+      return false;
+   if (gSystem->AccessPathName(cacheDir.c_str()) && gSystem->mkdir(cacheDir.c_str(), /*recursive=*/true) != 0) {
+      R__LOG_WARNING(RDFLogChannel()) << "cannot create the jit cache directory " << cacheDir;
+      return false;
+   }
+
+   {
+      // Serializes the compilation of the same code by concurrent processes sharing the cache directory
+      TLockFile lock((basePath + ".lock").c_str(), /*timeLimit=*/600);
+      if (!gSystem->AccessPathName(failedPath.c_str()))
+         return false;
+
+      if (gSystem->AccessPathName(sourcePath.c_str())) {
+         // The declarations are wrapped in a namespace of their own in order to not clash with the ones in cling
+         std::ofstream source(sourcePath);
+         source << "// Jitted RDataFrame code, generated by ROOT " << gROOT->GetVersion() << "\n"
+                << "#include \"ROOT/RDataFrame.hxx\"\n#include \"TH1D.h\"\n#include \"TH2D.h\"\n"
+                << "#include \"TH3D.h\"\n#include \"TProfile.h\"\n#include \"TProfile2D.h\"\n"
+                << "#include \"TGraph.h\"\n#include \"TGraphAsymmErrors.h\"\n#include \"TStatistic.h\"\n"
+                << "namespace " << name << " {\nusing namespace std;\n"
+                << GetDeclaredCode() << "void Run(void **rdfJitArgs)\n{\n"
+                << body << "\n}\n} // namespace " << name << "\n"
+                << "extern \"C\" void " << name << "_run(void **rdfJitArgs) { " << name << "::Run(rdfJitArgs); }\n";
+         if (!source) {
+            R__LOG_WARNING(RDFLogChannel()) << "cannot write to the jit cache directory " << cacheDir;
+            return false;
+         }
+      }
+
+      // ACLiC reuses the library if it is up to date and (re-)builds it otherwise
+      if (!gSystem->CompileMacro(sourcePath.c_str(), "kOs-", "", cacheDir.c_str())) {
+         R__LOG_WARNING(RDFLogChannel()) << "the jitted code cannot be compiled into a library, e.g. because it uses "
+                                            "types or functions only known to the interpreter. Falling back to "
+                                            "jitting, the code will not be cached again.";
+         std::ofstream failed(failedPath);
+         return false;
+      }
+   }
+
+   using JitFunc_t = void (*)(void **);
+   auto func = reinterpret_cast<JitFunc_t>(gSystem->DynFindSymbol("*", (name + "_run").c_str()));
+   if (!func)
+      return false;
+
+   R__LOG_INFO(RDFLogChannel()) << "Executing cached jitted code from " << sourcePath;
+   func(args.data());
+   return true;
+}
+
 bool IsInternalColumn(std::string_view colName)
 {
    const auto str = colName.data();
@@ -1669,7 +1669,8 @@ namespace Experimental {
 /// The main key, "samples", is required and at least one sample is needed. Each
 /// sample must have at least one key "trees" and at least one key "files" from
 /// which the data is read. Optionally, one or more metadata information can be
-/// added, as well as the friend list information.
+/// added, as well as the friend list information, the global range of entries and
+/// the metadata catalog, see RDatasetSpec::WithMetadataCatalog().
 ///
 /// ### Example specification file JSON:
 /// The following is an example of the dataset specification JSON file formatting: 
@@ -1688,6 +1689,7 @@ namespace Experimental {
 ///       },
 ///       ...
 ///     },
+///    "metadataCatalog": "catalog.txt",
 /// }
 ///~~~
 ROOT::RDataFrame FromSpec(const std::string &jsonFile)
@@ -1764,6 +1766,9 @@ ROOT::RDataFrame FromSpec(const std::string &jsonFile)
       else if (range.size() == 2)
          spec.WithGlobalRange({range[0], range[1]});
    }
+
+   if (fullData.contains("metadataCatalog"))
+      spec.WithMetadataCatalog(fullData["metadataCatalog"].get<std::string>());
    return ROOT::RDataFrame(spec);
 }
 
@@ -81,6 +81,11 @@ Long64_t RDatasetSpec::GetEntryRangeEnd() const
    return fEntryRange.fEnd;
 }
 
+const std::string &RDatasetSpec::GetMetadataCatalog() const
+{
+   return fMetadataCatalog;
+}
+
 std::vector<RSample> RDatasetSpec::MoveOutSamples()
 {
    return std::move(fSamples);
@@ -137,6 +142,30 @@ RDatasetSpec &RDatasetSpec::WithGlobalRange(const RDatasetSpec::REntryRange &ent
    return *this;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Cache the number of entries and the cluster boundaries of the trees in a catalog file
+///
+/// \param[in] catalog Path to the catalog, a text file with one line per tree.
+///
+/// The trees listed in the catalog are not opened to plan the event loop: with implicit multi-threading, the tasks
+/// are created from the cluster boundaries of the catalog, and each file is only opened by the tasks processing it.
+/// The trees missing from the catalog are read concurrently when the RDataFrame is created, then the catalog is
+/// rewritten with all the trees of the dataset. The catalog is not checked against the files, it must be removed
+/// when they change. See TChain::PrefetchMetadata() for the details.
+///
+/// ### Example usage:
+/// ~~~{.cpp}
+/// ROOT::RDF::Experimental::RDatasetSpec spec;
+/// spec.AddSample({"data", "events", "root://server//data/run*.root"});
+/// spec.WithMetadataCatalog("run_catalog.txt");
+/// ROOT::RDataFrame df(spec);
+/// ~~~
+RDatasetSpec &RDatasetSpec::WithMetadataCatalog(const std::string &catalog)
+{
+   fMetadataCatalog = catalog;
+   return *this;
+}
+
 RDatasetSpec &RDatasetSpec::WithGlobalFriends(const std::vector<std::string> &treeNames,
                                         const std::vector<std::string> &fileNameGlobs, const std::string &alias)
 {
@@ -10,6 +10,7 @@
 
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RStringView.hxx"
 #include "RtypesCore.h" // Long64_t
@@ -48,3 +49,16 @@ std::string RDefineBase::GetTypeName() const
 {
    return fType;
 }
+
+void RDefineBase::SetProfiler(RDFInternal::RProfiler &profiler)
+{
+   if (fProfiler)
+      return;
+   fProfiler = &profiler;
+   fProfileId = profiler.RegisterNode(RDFInternal::RProfiler::ENodeKind::kDefine, fName);
+}
+
+std::string RDefineBase::GetProfileLabel() const
+{
+   return fProfiler ? fProfiler->GetGraphLabel(fProfileId) : "";
+}
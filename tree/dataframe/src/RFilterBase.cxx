@@ -11,6 +11,7 @@
 #include "ROOT/RDF/RCutFlowReport.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include <numeric> // std::accumulate
 
@@ -23,7 +24,9 @@ RFilterBase::RFilterBase(RLoopManager *implPtr, std::string_view name, const uns
      fLastCheckedEntry(nSlots * RDFInternal::CacheLineStep<Long64_t>(), -1),
      fLastResult(nSlots * RDFInternal::CacheLineStep<int>()),
      fAccepted(nSlots * RDFInternal::CacheLineStep<ULong64_t>()),
-     fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()), fName(name), fColumnNames(columns),
+     fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()),
+     fBulkFirstEntry(nSlots * RDFInternal::CacheLineStep<Long64_t>(), -1), fBulkResult(nSlots), fName(name),
+     fColumnNames(columns),
      fColRegister(colRegister), fIsDefine(columns.size()), fVariation(variation)
 {
    const auto nColumns = fColumnNames.size();
@@ -61,3 +64,16 @@ void RFilterBase::InitNode()
    if (!fName.empty()) // if this is a named filter we care about its report count
       ResetReportCount();
 }
+
+void RFilterBase::SetProfiler(RDFInternal::RProfiler &profiler)
+{
+   if (fProfiler)
+      return;
+   fProfiler = &profiler;
+   fProfileId = profiler.RegisterNode(RDFInternal::RProfiler::ENodeKind::kFilter, HasName() ? fName : "Filter");
+}
+
+std::string RFilterBase::GetProfileLabel() const
+{
+   return fProfiler ? fProfiler->GetGraphLabel(fProfileId) : "";
+}
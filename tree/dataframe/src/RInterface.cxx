@@ -28,6 +28,148 @@ void ROOT::Internal::RDF::ChangeSpec(const ROOT::RDF::RNode &node, ROOT::RDF::Ex
    node.GetLoopManager()->ChangeSpec(std::move(spec));
 }
 
+/**
+ * \brief Process the entries of an RDataFrame in bulks of consecutive entries.
+ *
+ * \param node Any node of the computation graph.
+ * \param bulkSize The number of entries per bulk; 0 or 1 switches bulk processing off.
+ *
+ * With bulk processing, filters and actions that only read columns of the dataset evaluate a whole bulk of entries
+ * at a time, reading the column values of the entire bulk at once where the data source supports it (e.g. RNTuple
+ * through RNTupleDS). This reduces the per-entry overhead of the event loop. Bulks never straddle the entry ranges of
+ * a task. Bulk processing is used for empty sources and for data sources that support it, see
+ * RDataSource::SupportsBulkProcessing(); other event loops, as well as filters and actions that depend on Defines or
+ * Ranges, process the entries one by one as usual. The results are identical in either case.
+ *
+ * ~~~{.cpp}
+ * auto df = ROOT::RDF::Experimental::FromRNTuple("ntpl", "data.root");
+ * ROOT::RDF::Experimental::EnableBulkProcessing(df, 1024);
+ * auto h = df.Filter("pt > 10").Histo1D("pt");
+ * ~~~
+ */
+void ROOT::RDF::Experimental::EnableBulkProcessing(const ROOT::RDF::RNode &node, unsigned int bulkSize)
+{
+   node.GetLoopManager()->SetBulkSize(bulkSize);
+}
+
+/**
+ * \brief Profile the nodes of an RDataFrame computation graph in all the following event loops.
+ *
+ * \param node Any node of the computation graph.
+ *
+ * For every Filter, Define and action, as well as for the reading of every dataset column, the profile records the
+ * number of entries the node was asked for, the number of entries it actually evaluated (the others reused the value
+ * cached for the current entry) and the exclusive wall-clock time spent in the node, i.e. without the time spent in
+ * the nodes and columns it depends on. Entries processed in bulks, see EnableBulkProcessing(), count towards the
+ * column readers only. The counters add up over the event loops and are kept per processing slot. Once profiling is
+ * enabled, SaveGraph() annotates the nodes with their counters and GetProfileJSON() returns all of them. Profiling
+ * adds two clock readings per evaluation and cannot be switched off again.
+ *
+ * ~~~{.cpp}
+ * ROOT::RDataFrame df("tree", "data.root");
+ * ROOT::RDF::Experimental::EnableProfiling(df);
+ * auto h = df.Define("pt2", "pt * pt").Filter("pt2 > 100").Histo1D("pt2");
+ * h->Draw();
+ * std::cout << ROOT::RDF::Experimental::GetProfileJSON(df);
+ * ~~~
+ */
+void ROOT::RDF::Experimental::EnableProfiling(const ROOT::RDF::RNode &node)
+{
+   node.GetLoopManager()->EnableProfiling();
+}
+
+/**
+ * \brief Return the profile of an RDataFrame computation graph as a JSON document.
+ *
+ * \param node Any node of the computation graph.
+ *
+ * The document lists the profiled nodes with their kind ("filter", "define", "action" or "column"), name, time in
+ * seconds, number of calls and number of evaluations, in total and per processing slot. Throws if profiling was not
+ * enabled with EnableProfiling().
+ */
+std::string ROOT::RDF::Experimental::GetProfileJSON(const ROOT::RDF::RNode &node)
+{
+   const auto *profiler = node.GetLoopManager()->GetProfiler();
+   if (!profiler)
+      throw std::logic_error("GetProfileJSON: profiling is not enabled for this computation graph.");
+   return profiler->AsJSON();
+}
+
+/**
+ * \brief Fill large histograms of an RDataFrame computation graph without per-slot copies.
+ *
+ * \param node Any node of the computation graph.
+ * \param minNCells The minimum number of cells, including under- and overflow bins, of the histograms that are
+ *                  filled this way. 0 switches the feature off again.
+ *
+ * With implicit multi-threading, every processing slot normally fills its own copy of a histogram, and the copies are
+ * merged at the end of the event loop. For a TH3D with millions of bins, the copies can take more memory than the
+ * rest of the application. The TH1D, TH2D and TH3D results of Histo1D(), Histo2D() and Histo3D() that are booked
+ * after this call, whose axes have bins of equal width and that have at least minNCells cells are instead filled
+ * concurrently into a single histogram: the slots buffer their values and add them in batches, synchronizing on
+ * locks that each protect a part of the bins. Other histograms, and the histograms booked before the call, are not
+ * affected.
+ *
+ * ~~~{.cpp}
+ * ROOT::EnableImplicitMT();
+ * ROOT::RDataFrame df("tree", "data.root");
+ * ROOT::RDF::Experimental::EnableSharedHistogramFilling(df);
+ * auto h = df.Histo3D({"h", "h", 200, 0, 1, 200, 0, 1, 200, 0, 1}, "x", "y", "z");
+ * ~~~
+ */
+void ROOT::RDF::Experimental::EnableSharedHistogramFilling(const ROOT::RDF::RNode &node, std::size_t minNCells)
+{
+   node.GetLoopManager()->SetSharedFillMinNCells(minNCells);
+}
+
+/**
+ * \brief Guarantee that the computation graph never uses the interpreter to compile code just in time.
+ * \param node Any node of the computation graph.
+ *
+ * From this call on, booking an operation that requires just-in-time compilation, e.g. a Filter() or Define() with
+ * a string expression, or an action without template parameters such as Snapshot("t", "f.root") or Histo1D("x"),
+ * throws std::logic_error at booking time instead of compiling code with the interpreter when the event loop starts.
+ * This makes sure that a fully typed computation graph does not pay for just-in-time compilation. Throws if the
+ * graph already contains such operations.
+ *
+ * ~~~{.cpp}
+ * ROOT::RDataFrame df("tree", "data.root");
+ * ROOT::RDF::Experimental::DisableJitting(df);
+ * auto h = df.Filter([](float pt) { return pt > 10; }, {"pt"}).Histo1D<float>("pt"); // fine
+ * auto m = df.Mean("pt");                                                             // throws
+ * ~~~
+ */
+void ROOT::RDF::Experimental::DisableJitting(const ROOT::RDF::RNode &node)
+{
+   node.GetLoopManager()->DisableJitting();
+}
+
+/**
+ * \brief Allocate the RVecs created by the Filter and Define expressions of a computation graph in per-slot arenas.
+ * \param node Any node of the computation graph.
+ *
+ * In all the following event loops, the RVecs of arithmetic (more generally trivially copyable) types whose buffer
+ * is allocated while a Filter or Define expression is evaluated take it from an arena of the processing slot instead
+ * of the heap. The arena is reset after every entry, so the temporary collections of an analysis, e.g. the results
+ * of `pt[eta < 2.4]` or `sqrt(px * px + py * py)`, are allocated without calls to malloc and free once the arenas
+ * have grown to the largest entry. The values of the Define'd columns are cached as usual for the rest of the entry.
+ *
+ * The expressions must not keep RVecs that grew during the call beyond the processing of the entry, e.g. in a
+ * captured variable: their buffer may be reused by the next entry. Expressions that start parallel work, and Vary
+ * expressions, should not be used with the arenas. Copies made by the actions, e.g. Take() or Snapshot(), are
+ * allocated on the heap. The arenas cannot be disabled again.
+ *
+ * ~~~{.cpp}
+ * ROOT::RDataFrame df("Events", "data.root");
+ * ROOT::RDF::Experimental::EnableRVecArenas(df);
+ * auto h = df.Define("goodJet_pt", "Jet_pt[Jet_pt > 30 && abs(Jet_eta) < 2.4]").Histo1D("goodJet_pt");
+ * ~~~
+ */
+void ROOT::RDF::Experimental::EnableRVecArenas(const ROOT::RDF::RNode &node)
+{
+   node.GetLoopManager()->EnableRVecArenas();
+}
+
 /**
  * \brief Trigger the execution of an RDataFrame computation graph.
  * \param[in] node A node of the computation graph (not a result).
@@ -73,6 +73,24 @@ void RJittedAction::Run(unsigned int slot, Long64_t entry)
    fConcreteAction->Run(slot, entry);
 }
 
+void RJittedAction::RunBulk(unsigned int slot, Long64_t firstEntry, const ROOT::RVecB &mask)
+{
+   assert(fConcreteAction != nullptr);
+   fConcreteAction->RunBulk(slot, firstEntry, mask);
+}
+
+bool RJittedAction::CanRunBulk() const
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->CanRunBulk();
+}
+
+std::vector<ROOT::RDF::Experimental::RColumnPredicate> RJittedAction::GetPushdownPredicates() const
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->GetPushdownPredicates();
+}
+
 void RJittedAction::Initialize()
 {
    assert(fConcreteAction != nullptr);
@@ -68,3 +68,8 @@ RDefineBase &RJittedDefine::GetVariedDefine(const std::string &variationName)
    assert(fConcreteDefine != nullptr);
    return fConcreteDefine->GetVariedDefine(variationName);
 }
+
+std::string RJittedDefine::GetProfileLabel() const
+{
+   return fConcreteDefine ? fConcreteDefine->GetProfileLabel() : "";
+}
@@ -59,6 +59,26 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+void RJittedFilter::CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, ROOT::RVecB &mask)
+{
+   assert(fConcreteFilter != nullptr);
+   fConcreteFilter->CheckFiltersBulk(slot, firstEntry, mask);
+}
+
+bool RJittedFilter::CanCheckFiltersBulk() const
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->CanCheckFiltersBulk();
+}
+
+std::vector<ROOT::RDF::Experimental::RColumnPredicate> RJittedFilter::GetPushdownPredicates() const
+{
+   assert(fConcreteFilter != nullptr);
+   auto predicates = fConcreteFilter->GetPushdownPredicates();
+   predicates.insert(predicates.end(), fPredicates.begin(), fPredicates.end());
+   return predicates;
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    assert(fConcreteFilter != nullptr);
@@ -14,9 +14,12 @@
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RProfiler.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RVariationBase.hxx"
 #include "ROOT/RLogger.hxx"
+#include "ROOT/RMetricsRegistry.hxx"
+#include "ROOT/RTraceRecorder.hxx"
 #include "RtypesCore.h" // Long64_t
 #include "TStopwatch.h"
 #include "TBranchElement.h"
@@ -38,9 +41,11 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <numeric> // std::accumulate
 #include <stdexcept>
 #include <string>
 #include <sstream>
@@ -346,7 +351,8 @@ RLoopManager::RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches)
    : fTree(std::shared_ptr<TTree>(tree, [](TTree *) {})), fDefaultColumns(defaultBranches),
      fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
-     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots),
+     fNProcessedEntries(fNSlots * RDFInternal::CacheLineStep<ULong64_t>()), fDatasetColumnReaders(fNSlots)
 {
 }
 
@@ -356,6 +362,7 @@ RLoopManager::RLoopManager(ULong64_t nEmptyEntries)
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kNoFilesMT : ELoopType::kNoFiles),
      fNewSampleNotifier(fNSlots),
      fSampleInfos(fNSlots),
+     fNProcessedEntries(fNSlots * RDFInternal::CacheLineStep<ULong64_t>()),
      fDatasetColumnReaders(fNSlots)
 {
 }
@@ -363,7 +370,8 @@ RLoopManager::RLoopManager(ULong64_t nEmptyEntries)
 RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t &defaultBranches)
    : fDefaultColumns(defaultBranches), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kDataSourceMT : ELoopType::kDataSource),
-     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots),
+     fNProcessedEntries(fNSlots * RDFInternal::CacheLineStep<ULong64_t>()), fDatasetColumnReaders(fNSlots)
 {
    fDataSource->SetNSlots(fNSlots);
 }
@@ -373,6 +381,7 @@ RLoopManager::RLoopManager(ROOT::RDF::Experimental::RDatasetSpec &&spec)
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
      fNewSampleNotifier(fNSlots),
      fSampleInfos(fNSlots),
+     fNProcessedEntries(fNSlots * RDFInternal::CacheLineStep<ULong64_t>()),
      fDatasetColumnReaders(fNSlots)
 {
    ChangeSpec(std::move(spec));
@@ -418,6 +427,9 @@ void RLoopManager::ChangeSpec(ROOT::RDF::Experimental::RDatasetSpec &&spec)
          fSampleMap.insert({sampleId, &sample});
       }
    }
+   // Read the entries and the cluster boundaries of all the trees upfront, or take them from the catalog
+   if (!spec.GetMetadataCatalog().empty())
+      chain->PrefetchMetadata(spec.GetMetadataCatalog().c_str());
    SetTree(std::move(chain));
 
    // Create friends from the specification and connect them to the main chain
@@ -455,13 +467,18 @@ void RLoopManager::RunEmptySourceMT()
    auto genFunction = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       auto slot = slotRAII.fSlot;
+      R__TRACE_SCOPE_ARG("rdf", "ProcessRange", "slot", slot);
       RCallCleanUpTask cleanup(*this, slot);
       InitNodeSlots(nullptr, slot);
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({"an empty source", range.first, range.second, slot});
       try {
          UpdateSampleInfo(slot, range);
-         for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+         if (IsBulkProcessing()) {
+            RunAndCheckFiltersBulk(slot, range.first, range.second);
+         } else {
+            for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
+               RunAndCheckFilters(slot, currEntry);
+            }
          }
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
@@ -485,9 +502,13 @@ void RLoopManager::RunEmptySource()
    RCallCleanUpTask cleanup(*this);
    try {
       UpdateSampleInfo(/*slot*/ 0, fEmptyEntryRange);
-      for (ULong64_t currEntry = fEmptyEntryRange.first;
-           currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+      if (IsBulkProcessing()) {
+         RunAndCheckFiltersBulk(0, fEmptyEntryRange.first, fEmptyEntryRange.second);
+      } else {
+         for (ULong64_t currEntry = fEmptyEntryRange.first;
+              currEntry < fEmptyEntryRange.second && HasActiveChildren(); ++currEntry) {
+            RunAndCheckFilters(0, currEntry);
+         }
       }
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -495,6 +516,18 @@ void RLoopManager::RunEmptySource()
    }
 }
 
+#ifdef R__USE_IMT
+/// Report how long each slot did not process entries during a multi-thread event loop
+static void LogSlotIdleTimes(const std::vector<double> &busyTimes, double loopTime)
+{
+   std::stringstream msg;
+   msg << "Idle time per slot during the event loop of " << loopTime << "s:";
+   for (std::size_t slot = 0; slot < busyTimes.size(); ++slot)
+      msg << " " << slot << ": " << std::max(0., loopTime - busyTimes[slot]) << "s";
+   R__LOG_INFO(RDFLogChannel()) << msg.str();
+}
+#endif
+
 /// Run event loop over one or multiple ROOT files, in parallel.
 void RLoopManager::RunTreeProcessorMT()
 {
@@ -507,11 +540,19 @@ void RLoopManager::RunTreeProcessorMT()
                 ? std::make_unique<ROOT::TTreeProcessorMT>(*fTree, fNSlots, std::make_pair(fBeginEntry, fEndEntry))
                 : std::make_unique<ROOT::TTreeProcessorMT>(*fTree, entryList, fNSlots);
 
+   // Split the tasks when workers go idle, e.g. at the end of a loop over files of very different sizes
+   tp->SetDynamicScheduling(true);
+
    std::atomic<ULong64_t> entryCount(0ull);
+   // Time spent by each slot processing entries; every element is only accessed by the task holding the slot
+   std::vector<double> busyTimes(fNSlots, 0.);
+   TStopwatch loopWatch;
 
-   tp->Process([this, &slotStack, &entryCount](TTreeReader &r) -> void {
+   tp->Process([this, &slotStack, &entryCount, &busyTimes](TTreeReader &r) -> void {
+      const auto taskStart = std::chrono::steady_clock::now();
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       auto slot = slotRAII.fSlot;
+      R__TRACE_SCOPE_ARG("rdf", "ProcessRange", "slot", slot);
       RCallCleanUpTask cleanup(*this, slot, &r);
       InitNodeSlots(&r, slot);
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing(TreeDatasetLogInfo(r, slot));
@@ -532,12 +573,15 @@ void RLoopManager::RunTreeProcessorMT()
       }
       // fNStopsReceived < fNChildren is always true at the moment as we don't support event loop early quitting in
       // multi-thread runs, but it costs nothing to be safe and future-proof in case we add support for that later.
-      if (r.GetEntryStatus() != TTreeReader::kEntryBeyondEnd && fNStopsReceived < fNChildren) {
+      if (r.GetEntryStatus() != TTreeReader::kEntryBeyondEnd && HasActiveChildren()) {
          // something went wrong in the TTreeReader event loop
          throw std::runtime_error("An error was encountered while processing the data. TTreeReader status code is: " +
                                   std::to_string(r.GetEntryStatus()));
       }
+      busyTimes[slot] += std::chrono::duration<double>(std::chrono::steady_clock::now() - taskStart).count();
    });
+   loopWatch.Stop();
+   LogSlotIdleTimes(busyTimes, loopWatch.RealTime());
 #endif // no-op otherwise (will not be called)
 }
 
@@ -561,7 +605,7 @@ void RLoopManager::RunTreeReader()
    // recursive call to check filters and conditionally execute actions
    // in the non-MT case processing can be stopped early by ranges, hence the check on fNStopsReceived
    try {
-      while (r.Next() && fNStopsReceived < fNChildren) {
+      while (r.Next() && HasActiveChildren()) {
          if (fNewSampleNotifier.CheckFlag(0)) {
             UpdateSampleInfo(/*slot*/0, r);
          }
@@ -571,7 +615,7 @@ void RLoopManager::RunTreeReader()
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
    }
-   if (r.GetEntryStatus() != TTreeReader::kEntryBeyondEnd && fNStopsReceived < fNChildren) {
+   if (r.GetEntryStatus() != TTreeReader::kEntryBeyondEnd && HasActiveChildren()) {
       // something went wrong in the TTreeReader event loop
       throw std::runtime_error("An error was encountered while processing the data. TTreeReader status code is: " +
                                std::to_string(r.GetEntryStatus()));
@@ -582,6 +626,7 @@ void RLoopManager::RunTreeReader()
 void RLoopManager::RunDataSource()
 {
    assert(fDataSource != nullptr);
+   PushDownToDataSource();
    fDataSource->Initialize();
    auto ranges = fDataSource->GetEntryRanges();
    while (!ranges.empty() && fNStopsReceived < fNChildren) {
@@ -593,6 +638,10 @@ void RLoopManager::RunDataSource()
             const auto start = range.first;
             const auto end = range.second;
             R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
+            if (IsBulkProcessing()) {
+               RunAndCheckFiltersBulk(0u, start, end);
+               continue;
+            }
             for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
                if (fDataSource->SetEntry(0u, entry)) {
                   RunAndCheckFilters(0u, entry);
@@ -621,6 +670,7 @@ void RLoopManager::RunDataSourceMT()
    auto runOnRange = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
       ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
       const auto slot = slotRAII.fSlot;
+      R__TRACE_SCOPE_ARG("rdf", "ProcessRange", "slot", slot);
       InitNodeSlots(nullptr, slot);
       RCallCleanUpTask cleanup(*this, slot);
       fDataSource->InitSlot(slot, range.first);
@@ -628,9 +678,13 @@ void RLoopManager::RunDataSourceMT()
       const auto end = range.second;
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, slot});
       try {
-         for (auto entry = start; entry < end; ++entry) {
-            if (fDataSource->SetEntry(slot, entry)) {
-               RunAndCheckFilters(slot, entry);
+         if (IsBulkProcessing()) {
+            RunAndCheckFiltersBulk(slot, start, end);
+         } else {
+            for (auto entry = start; entry < end; ++entry) {
+               if (fDataSource->SetEntry(slot, entry)) {
+                  RunAndCheckFilters(slot, entry);
+               }
             }
          }
       } catch (...) {
@@ -640,6 +694,7 @@ void RLoopManager::RunDataSourceMT()
       fDataSource->FinalizeSlot(slot);
    };
 
+   PushDownToDataSource();
    fDataSource->Initialize();
    auto ranges = fDataSource->GetEntryRanges();
    while (!ranges.empty()) {
@@ -650,10 +705,34 @@ void RLoopManager::RunDataSourceMT()
 #endif // not implemented otherwise (never called)
 }
 
+/// Offer the data source the column predicates that all the actions of this event loop depend on, as well as the
+/// names of the columns that are read.
+void RLoopManager::PushDownToDataSource()
+{
+   std::vector<ROOT::RDF::Experimental::RColumnPredicate> predicates;
+   // Named filters must see all the entries to produce correct reports
+   if (fBookedNamedFilters.empty() && !fBookedActions.empty()) {
+      predicates = fBookedActions[0]->GetPushdownPredicates();
+      for (std::size_t i = 1; i < fBookedActions.size() && !predicates.empty(); ++i) {
+         const auto actionPredicates = fBookedActions[i]->GetPushdownPredicates();
+         predicates.erase(std::remove_if(predicates.begin(), predicates.end(),
+                                         [&actionPredicates](const ROOT::RDF::Experimental::RColumnPredicate &p) {
+                                            return std::find(actionPredicates.begin(), actionPredicates.end(), p) ==
+                                                   actionPredicates.end();
+                                         }),
+                          predicates.end());
+      }
+   }
+   fDataSource->SetPredicates(predicates);
+   fDataSource->SetActiveColumns(fDataSourceColumnNames);
+}
+
 /// Execute actions and make sure named filters are called for each event.
 /// Named filters must be called even if the analysis logic would not require it, lest they report confusing results.
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
+   ++fNProcessedEntries[slot * RDFInternal::CacheLineStep<ULong64_t>()];
+
    // data-block callbacks run before the rest of the graph
    if (fNewSampleNotifier.CheckFlag(slot)) {
       for (auto &callback : fSampleCallbacks)
@@ -667,6 +746,102 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       namedFilterPtr->CheckFilters(slot, entry);
    for (auto &callback : fCallbacks)
       callback(slot);
+
+   for (auto *lm : fSharedLoops) {
+      if (lm->fNStopsReceived < lm->fNChildren)
+         lm->RunAndCheckFilters(slot, entry);
+   }
+
+   // the RVecs allocated in the arena by Filter and Define expressions only live until the end of the entry
+   if (!fRVecArenas.empty())
+      fRVecArenas[slot]->Reset();
+}
+
+/// Whether this graph or one of the graphs processed in its event loop still needs entries
+bool RLoopManager::HasActiveChildren() const
+{
+   if (fNStopsReceived < fNChildren)
+      return true;
+   return std::any_of(fSharedLoops.begin(), fSharedLoops.end(),
+                      [](const RLoopManager *lm) { return lm->fNStopsReceived < lm->fNChildren; });
+}
+
+/// Process the entries [start, end) in bulks of fBulkSize entries. For every bulk, the bulk actions run first, then
+/// the remaining actions and the named filters process the entries one by one. Filters evaluated in bulk cache their
+/// results, so every filter is still evaluated at most once per entry.
+void RLoopManager::RunAndCheckFiltersBulk(unsigned int slot, Long64_t start, Long64_t end)
+{
+   ROOT::RVecB mask;
+   auto &currentBulk = fCurrentBulks[slot * RDFInternal::CacheLineStep<RBulkRange>()];
+   for (auto firstEntry = start; firstEntry < end && fNStopsReceived < fNChildren; firstEntry += fBulkSize) {
+      const auto size = static_cast<std::size_t>(std::min<Long64_t>(fBulkSize, end - firstEntry));
+      currentBulk = RBulkRange{firstEntry, size};
+      mask.assign(size, true);
+      if (fDataSource) {
+         for (std::size_t i = 0; i < size; ++i)
+            mask[i] = fDataSource->SetEntry(slot, firstEntry + i);
+      }
+
+      // data-block callbacks run before the rest of the graph
+      if (fNewSampleNotifier.CheckFlag(slot)) {
+         for (auto &callback : fSampleCallbacks)
+            callback.second(slot, fSampleInfos[slot]);
+         fNewSampleNotifier.UnsetFlag(slot);
+      }
+
+      fNProcessedEntries[slot * RDFInternal::CacheLineStep<ULong64_t>()] += std::count(mask.begin(), mask.end(), true);
+      for (auto *actionPtr : fBulkActions)
+         actionPtr->RunBulk(slot, firstEntry, mask);
+      for (std::size_t i = 0; i < size && fNStopsReceived < fNChildren; ++i) {
+         if (!mask[i])
+            continue;
+         const Long64_t entry = firstEntry + i;
+         for (auto *actionPtr : fPerEntryActions)
+            actionPtr->Run(slot, entry);
+         for (auto *namedFilterPtr : fBookedNamedFilters)
+            namedFilterPtr->CheckFilters(slot, entry);
+         for (auto &callback : fCallbacks)
+            callback(slot);
+         if (!fRVecArenas.empty())
+            fRVecArenas[slot]->Reset();
+      }
+   }
+   currentBulk = RBulkRange{};
+}
+
+/// Split the booked actions into the ones that are run in bulks and the ones that are run entry by entry, if the
+/// bulk size and the kind of event loop allow for bulk processing.
+void RLoopManager::SetupBulkProcessing()
+{
+   fBulkActions.clear();
+   fPerEntryActions.clear();
+   fBulkProcessing = false;
+   fCurrentBulks.assign(fNSlots * RDFInternal::CacheLineStep<RBulkRange>(), RBulkRange{});
+   if (fBulkSize <= 1)
+      return;
+   // The graphs of a shared event loop are processed entry by entry, interleaved
+   if (!fSharedLoops.empty() || fSharedLoopOwner)
+      return;
+   // TTree column readers are bound to the current entry of their TTreeReader
+   if (fLoopType == ELoopType::kROOTFiles || fLoopType == ELoopType::kROOTFilesMT)
+      return;
+   if (fDataSource && !fDataSource->SupportsBulkProcessing())
+      return;
+
+   for (auto *actionPtr : fBookedActions) {
+      if (actionPtr->CanRunBulk())
+         fBulkActions.emplace_back(actionPtr);
+      else
+         fPerEntryActions.emplace_back(actionPtr);
+   }
+   // without bulk actions, bulks are only worth it for the filters and defines that evaluate them in one call
+   fBulkProcessing = !fBulkActions.empty() ||
+                     std::any_of(fBookedFilters.begin(), fBookedFilters.end(),
+                                 [](const RFilterBase *f) { return f->HasBulkCallable(); }) ||
+                     std::any_of(fBookedDefines.begin(), fBookedDefines.end(),
+                                 [](const RDefineBase *d) { return d->HasBulkCallable(); });
+   if (!fBulkProcessing)
+      fPerEntryActions.clear();
 }
 
 /// Build TTreeReaderValues for all nodes
@@ -686,6 +861,9 @@ void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 
    for (auto &callback : fCallbacksOnce)
       callback(slot);
+
+   for (auto *lm : fSharedLoops)
+      lm->InitNodeSlots(r, slot);
 }
 
 void RLoopManager::SetupSampleCallbacks(TTreeReader *r, unsigned int slot) {
@@ -705,6 +883,8 @@ void RLoopManager::SetupSampleCallbacks(TTreeReader *r, unsigned int slot) {
 void RLoopManager::UpdateSampleInfo(unsigned int slot, const std::pair<ULong64_t, ULong64_t> &range) {
    fSampleInfos[slot] = RSampleInfo(
       "Empty source, range: {" + std::to_string(range.first) + ", " + std::to_string(range.second) + "}", range);
+   for (auto *lm : fSharedLoops)
+      lm->UpdateSampleInfo(slot, range);
 }
 
 void RLoopManager::UpdateSampleInfo(unsigned int slot, TTreeReader &r) {
@@ -722,6 +902,9 @@ void RLoopManager::UpdateSampleInfo(unsigned int slot, TTreeReader &r) {
    }
    const std::string &id = fname + '/' + treename;
    fSampleInfos[slot] = fSampleMap.empty() ? RSampleInfo(id, range) : RSampleInfo(id, range, fSampleMap[id]);
+   // The notifiers of the shared graphs are linked to the same chain, so they all see the new tree at the same time
+   for (auto *lm : fSharedLoops)
+      lm->UpdateSampleInfo(slot, r);
 }
 
 /// Initialize all nodes of the functional graph before running the event loop.
@@ -731,12 +914,24 @@ void RLoopManager::UpdateSampleInfo(unsigned int slot, TTreeReader &r) {
 void RLoopManager::InitNodes()
 {
    EvalChildrenCounts();
+   if (fProfiler) {
+      // nodes that are already registered keep their id, so that the counters accumulate over the event loops
+      for (auto *filter : fBookedFilters)
+         filter->SetProfiler(*fProfiler);
+      for (auto *define : fBookedDefines)
+         define->SetProfiler(*fProfiler);
+      for (auto *action : fBookedActions)
+         action->SetProfiler(*fProfiler);
+   }
    for (auto *filter : fBookedFilters)
       filter->InitNode();
    for (auto *range : fBookedRanges)
       range->InitNode();
    for (auto *ptr : fBookedActions)
       ptr->Initialize();
+   SetupBulkProcessing();
+   for (auto *lm : fSharedLoops)
+      lm->InitNodes();
 }
 
 /// Perform clean-up operations. To be called at the end of each event loop.
@@ -750,6 +945,9 @@ void RLoopManager::CleanUpNodes()
 
    fRunActions.insert(fRunActions.begin(), fBookedActions.begin(), fBookedActions.end());
    fBookedActions.clear();
+   fBulkActions.clear();
+   fPerEntryActions.clear();
+   fBulkProcessing = false;
 
    // reset children counts
    fNChildren = 0;
@@ -762,11 +960,17 @@ void RLoopManager::CleanUpNodes()
    fCallbacks.clear();
    fCallbacksOnce.clear();
    fSampleCallbacks.clear();
+
+   for (auto *lm : fSharedLoops)
+      lm->CleanUpNodes();
 }
 
 /// Perform clean-up operations. To be called at the end of each task execution.
 void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
 {
+   // The shared graphs hold pointers to the column readers of this loop manager, which are reset below
+   for (auto *lm : fSharedLoops)
+      lm->CleanUpTask(r, slot);
    if (r != nullptr)
       fNewSampleNotifier.GetChainNotifyLink(slot).RemoveLink(*r->GetTree());
    for (auto *ptr : fBookedActions)
@@ -799,7 +1003,9 @@ void RLoopManager::Jit()
 
    TStopwatch s;
    s.Start();
-   RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   const auto &cacheDir = RDFInternal::GetJitCacheDirectory();
+   if (cacheDir.empty() || !RDFInternal::InterpreterCalcCached(code, cacheDir))
+      RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
    s.Stop();
    R__LOG_INFO(RDFLogChannel()) << "Just-in-time compilation phase completed"
                                 << (s.RealTime() > 1e-3 ? " in " + std::to_string(s.RealTime()) + " seconds."
@@ -832,8 +1038,10 @@ void RLoopManager::Run(bool jit)
 
    ThrowIfNSlotsChanged(GetNSlots());
 
-   if (jit)
+   if (jit) {
+      R__TRACE_SCOPE("rdf", "Jit");
       Jit();
+   }
 
    InitNodes();
 
@@ -850,6 +1058,8 @@ void RLoopManager::Run(bool jit)
 
    NodesCleanerRAII runKeeper(*this);
 
+   std::fill(fNProcessedEntries.begin(), fNProcessedEntries.end(), 0ull);
+   R__TRACE_SCOPE("rdf", "EventLoop");
    TStopwatch s;
    s.Start();
 
@@ -864,11 +1074,88 @@ void RLoopManager::Run(bool jit)
    s.Stop();
 
    fNRuns++;
+   for (auto *lm : fSharedLoops)
+      lm->fNRuns++;
+   UpdateEventLoopMetrics(std::accumulate(fNProcessedEntries.begin(), fNProcessedEntries.end(), 0ull), s.RealTime());
 
    R__LOG_INFO(RDFLogChannel()) << "Finished event loop number " << fNRuns - 1 << " (" << s.CpuTime() << "s CPU, "
                                 << s.RealTime() << "s elapsed).";
 }
 
+/// Add a finished event loop to the process-wide metrics, see ROOT::Experimental::RMetricsRegistry
+void RLoopManager::UpdateEventLoopMetrics(ULong64_t nEntries, double realTime)
+{
+   using ROOT::Experimental::RMetric;
+   using ROOT::Experimental::RMetricsRegistry;
+   static auto &loops =
+      RMetricsRegistry::Instance().GetMetric("root_rdf_event_loops", "Event loops run by RDataFrame");
+   static auto &entries =
+      RMetricsRegistry::Instance().GetMetric("root_rdf_entries", "Entries processed by RDataFrame event loops");
+   static auto &time = RMetricsRegistry::Instance().GetMetric(
+      "root_rdf_event_loop_seconds", "Real time spent in RDataFrame event loops", RMetric::EKind::kCounter, "seconds",
+      1e-9);
+   loops.Inc();
+   entries.Add(nEntries);
+   time.Add(static_cast<std::int64_t>(realTime * 1e9));
+}
+
+/// Throw if the other graph cannot be processed in the event loop of this one, i.e. if it does not run over the
+/// same dataset in the same way.
+void RLoopManager::CheckCanShareLoop(const RLoopManager &other) const
+{
+   if (&other == this || other.fSharedLoopOwner || !other.fSharedLoops.empty())
+      throw std::logic_error("RDataFrame: a computation graph can only take part in one shared event loop.");
+   if (fDataSource || other.fDataSource)
+      throw std::runtime_error("RDataFrame: shared event loops are not supported for data sources.");
+   if (other.fLoopType != fLoopType || other.fNSlots != fNSlots || other.fBeginEntry != fBeginEntry ||
+       other.fEndEntry != fEndEntry || other.fEmptyEntryRange != fEmptyEntryRange)
+      throw std::runtime_error(
+         "RDataFrame: computation graphs that share an event loop must process the same entries.");
+   if (!fTree)
+      return;
+
+   const auto countFriends = [](const TTree &t) { return t.GetListOfFriends() ? t.GetListOfFriends()->GetSize() : 0; };
+   const bool sameTrees = ROOT::Internal::TreeUtils::GetTreeFullPaths(*fTree) ==
+                             ROOT::Internal::TreeUtils::GetTreeFullPaths(*other.fTree) &&
+                          ROOT::Internal::TreeUtils::GetFileNamesFromTree(*fTree) ==
+                             ROOT::Internal::TreeUtils::GetFileNamesFromTree(*other.fTree);
+   if (!sameTrees || countFriends(*fTree) != countFriends(*other.fTree) ||
+       fTree->GetEntryList() != other.fTree->GetEntryList())
+      throw std::runtime_error("RDataFrame: computation graphs that share an event loop must read the same dataset.");
+}
+
+/// Run the event loop of this graph and, in the same event loop, process the given graphs over the same dataset.
+/// The dataset columns are read once per entry through the column readers of this loop manager and shared by all the
+/// graphs that read the same column with the same type. Jitted code is compiled once for all graphs, and identical
+/// jitted expressions are compiled into the same function. Bulk processing is not used in shared event loops.
+void RLoopManager::RunShared(const std::vector<RLoopManager *> &others)
+{
+   for (std::size_t i = 0; i < others.size(); ++i) {
+      CheckCanShareLoop(*others[i]);
+      if (std::find(others.begin(), others.begin() + i, others[i]) != others.begin() + i)
+         throw std::logic_error("RDataFrame: a computation graph can only take part in one shared event loop.");
+   }
+
+   // Detach the graphs even if the event loop is interrupted
+   struct RSharedLoopsRAII {
+      RLoopManager &fLoopManager;
+      RSharedLoopsRAII(RLoopManager &lm, const std::vector<RLoopManager *> &others) : fLoopManager(lm)
+      {
+         fLoopManager.fSharedLoops = others;
+         for (auto *other : others)
+            other->fSharedLoopOwner = &fLoopManager;
+      }
+      ~RSharedLoopsRAII()
+      {
+         for (auto *other : fLoopManager.fSharedLoops)
+            other->fSharedLoopOwner = nullptr;
+         fLoopManager.fSharedLoops.clear();
+      }
+   } sharedLoops(*this, others);
+
+   Run();
+}
+
 /// Return the list of default columns -- empty if none was provided when constructing the RDataFrame
 const ColumnNames_t &RLoopManager::GetDefaultColumnNames() const
 {
@@ -963,10 +1250,27 @@ void RLoopManager::SetTree(std::shared_ptr<TTree> tree)
 
 void RLoopManager::ToJitExec(const std::string &code) const
 {
+   ThrowIfJittingDisabled("an operation booked without template parameters");
+   fHasJittedNodes = true;
    R__LOCKGUARD(gROOTMutex);
    GetCodeToJit().append(code);
 }
 
+void RLoopManager::DisableJitting()
+{
+   if (fHasJittedNodes)
+      throw std::logic_error("DisableJitting: the computation graph already contains operations that require "
+                             "just-in-time compilation.");
+   fJittingDisabled = true;
+}
+
+void RLoopManager::ThrowIfJittingDisabled(const std::string &what) const
+{
+   if (fJittingDisabled)
+      throw std::logic_error("RDataFrame: just-in-time compilation is disabled for this computation graph, but " +
+                             what + " requires it. Specify the column types as template parameters instead.");
+}
+
 void RLoopManager::RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f)
 {
    if (everyNEvents == 0ull)
@@ -1017,6 +1321,8 @@ std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RLoopManager::GetG
    } else {
       name = "Empty source\\nEntries: " + std::to_string(GetNEmptyEntries());
    }
+   if (fProfiler)
+      name += "\\n" + fProfiler->GetColumnsGraphLabel();
    auto thisNode = std::make_shared<ROOT::Internal::RDF::GraphDrawing::GraphNode>(
       name, visitedMap.size(), ROOT::Internal::RDF::GraphDrawing::ENodeType::kRoot);
    visitedMap[(void *)this] = thisNode;
@@ -1053,8 +1359,10 @@ void RLoopManager::AddDataSourceColumnReaders(const std::string &col,
    assert(readers.size() == fNSlots);
 
    for (auto slot = 0u; slot < fNSlots; ++slot) {
-      fDatasetColumnReaders[slot][key] = std::move(readers[slot]);
+      fDatasetColumnReaders[slot][key] = MakeProfiledColumnReader(slot, col, std::move(readers[slot]));
    }
+   if (std::find(fDataSourceColumnNames.begin(), fDataSourceColumnNames.end(), col) == fDataSourceColumnNames.end())
+      fDataSourceColumnNames.emplace_back(col);
 }
 
 // Differently from AddDataSourceColumnReaders, this can be called from multiple threads concurrently
@@ -1064,18 +1372,59 @@ RColumnReaderBase *RLoopManager::AddTreeColumnReader(unsigned int slot, const st
                                                      std::unique_ptr<RColumnReaderBase> &&reader,
                                                      const std::type_info &ti)
 {
+   if (fSharedLoopOwner)
+      return fSharedLoopOwner->AddTreeColumnReader(slot, col, std::move(reader), ti);
    auto &readers = fDatasetColumnReaders[slot];
    const auto key = MakeDatasetColReadersKey(col, ti);
    // if a reader for this column and this slot was already there, we are doing something wrong
    assert(readers.find(key) == readers.end() || readers[key] == nullptr);
-   auto *rptr = reader.get();
-   readers[key] = std::move(reader);
-   return rptr;
+   auto &entry = readers[key];
+   entry = MakeProfiledColumnReader(slot, col, std::move(reader));
+   return entry.get();
+}
+
+/// Wrap the reader in an RProfiledColumnReader if profiling is enabled, return it unchanged otherwise
+std::unique_ptr<RColumnReaderBase>
+RLoopManager::MakeProfiledColumnReader(unsigned int slot, const std::string &col,
+                                       std::unique_ptr<RColumnReaderBase> reader)
+{
+   if (!fProfiler || !reader)
+      return reader;
+   const auto id = fProfiler->RegisterColumn(col);
+   return std::make_unique<RDFInternal::RProfiledColumnReader>(std::move(reader), *fProfiler, slot, id);
+}
+
+void RLoopManager::EnableProfiling()
+{
+   if (fProfiler)
+      return;
+   fProfiler = std::make_unique<RDFInternal::RProfiler>(fNSlots);
+   // the readers of data source columns persist across event loops, the ones of TTree branches are re-created
+   for (auto slot = 0u; slot < fNSlots; ++slot) {
+      for (auto &keyAndReader : fDatasetColumnReaders[slot]) {
+         if (!keyAndReader.second)
+            continue;
+         // the key is the column name followed by ':' and the type name, see MakeDatasetColReadersKey
+         const auto &key = keyAndReader.first;
+         keyAndReader.second =
+            MakeProfiledColumnReader(slot, key.substr(0, key.rfind(':')), std::move(keyAndReader.second));
+      }
+   }
+}
+
+void RLoopManager::EnableRVecArenas()
+{
+   if (!fRVecArenas.empty())
+      return;
+   for (auto slot = 0u; slot < fNSlots; ++slot)
+      fRVecArenas.emplace_back(std::make_unique<ROOT::Internal::VecOps::RVecArena>());
 }
 
 RColumnReaderBase *
 RLoopManager::GetDatasetColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const
 {
+   if (fSharedLoopOwner)
+      return fSharedLoopOwner->GetDatasetColumnReader(slot, col, ti);
    const auto key = MakeDatasetColReadersKey(col, ti);
    auto it = fDatasetColumnReaders[slot].find(key);
    if (it != fDatasetColumnReaders[slot].end())
@@ -15,6 +15,7 @@
  *************************************************************************/
 
 #include <ROOT/RDF/RColumnReaderBase.hxx>
+#include <ROOT/RError.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
@@ -25,6 +26,9 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <limits>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -41,9 +45,36 @@
 * For each column containing an array or a collection, a corresponding column `#colname` is available to access
 * `colname.size()` without reading and deserializing the collection values.
 *
+* If the RNTuple was written with value ranges (see RNTupleWriteOptions::SetHasValueRanges()), AddValueRangeHint()
+* can be used to skip the clusters that cannot contain entries within a selection on a scalar column.
+*
+* The data source can read the ntuple from several files with the same schema, one after the other.  The meta-data of
+* every file is read once, when the data source is constructed.  The entry ranges consist of whole clusters and never
+* cross a file boundary.  Every slot has a single page source, for the file of the entries that it currently reads,
+* which is attached with a copy of the meta-data of that file; thus, the number of page sources, and of the I/O
+* threads of their cluster pools, is bounded by the number of slots rather than by the number of slots times files.
+*
 **/
 // clang-format on
 
+namespace {
+
+/// Checks, recursively, that the subfields of the given field have the same IDs, names and types in both descriptors
+bool HasSameFields(const ROOT::Experimental::RNTupleDescriptor &desc, const ROOT::Experimental::RNTupleDescriptor &other,
+                   ROOT::Experimental::DescriptorId_t fieldId)
+{
+   for (const auto &f : desc.GetFieldIterable(fieldId)) {
+      if (other.FindFieldId(f.GetFieldName(), fieldId) != f.GetId() ||
+          other.GetFieldDescriptor(f.GetId()).GetTypeName() != f.GetTypeName() ||
+          !HasSameFields(desc, other, f.GetId())) {
+         return false;
+      }
+   }
+   return true;
+}
+
+} // anonymous namespace
+
 namespace ROOT {
 namespace Experimental {
 namespace Internal {
@@ -114,39 +145,112 @@ class RNTupleColumnReader : public ROOT::Detail::RDF::RColumnReaderBase {
    using RFieldBase = ROOT::Experimental::Detail::RFieldBase;
    using RPageSource = ROOT::Experimental::Detail::RPageSource;
 
-   std::unique_ptr<RFieldBase> fField; ///< The field backing the RDF column
-   RFieldBase::RValue fValue;          ///< The memory location used to read from fField
-   Long64_t fLastEntry;                ///< Last entry number that was read
-
-public:
-   RNTupleColumnReader(std::unique_ptr<RFieldBase> f)
-      : fField(std::move(f)), fValue(fField->GenerateValue()), fLastEntry(-1)
+   /// The entry range of a cluster, used to translate global entry numbers to cluster indexes in bulk reads
+   struct RClusterRange {
+      Long64_t fFirstEntry;
+      Long64_t fNEntries;
+      DescriptorId_t fClusterId;
+   };
+
+   RNTupleDS *fDataSource;                ///< Provides the page sources of fSlot; nullptr for the prototypes
+   unsigned int fSlot;                    ///< The slot of the RDF event loop that uses the reader
+   std::shared_ptr<RPageSource> fSource;  ///< The page source fField is connected to, must outlive fField
+   std::unique_ptr<RFieldBase> fField;    ///< The field backing the RDF column
+   RFieldBase::RValue fValue;             ///< The memory location used to read from fField
+   RFieldBase::RBulk fBulk;               ///< The memory location used to read bulks of values from fField
+   Long64_t fLastEntry;                   ///< Last entry number that was read
+   Long64_t fFirstEntry = 0;              ///< First entry of the file of fSource in the entry numbering of fDataSource
+   Long64_t fEndEntry = 0;                ///< One past the last entry of the file of fSource
+   std::vector<RClusterRange> fClusterRanges; ///< The clusters of the file of fSource, sorted by first entry
+   std::size_t fLastClusterRange = 0;         ///< Cluster range of the last bulk read
+
+   /// Connect a clone of the field and of its subfields to the page source of the slot for the file that contains
+   /// `entry`.  Fields can only be connected once, so the field connected to the page source of the previous file is
+   /// replaced; it is destructed before that page source is released.
+   void Connect(Long64_t entry)
    {
+      const auto fileIndex = fDataSource->FindFile(entry);
+      const auto &file = fDataSource->fFiles[fileIndex];
+      auto source = fDataSource->GetSlotSource(fSlot, fileIndex);
+
+      auto field = fField->Clone(fField->GetName());
+      field->ConnectPageSource(*source);
+      for (auto &f : *field)
+         f.ConnectPageSource(*source);
+      {
+         auto bulk = field->GenerateBulk();
+         fValue = field->GenerateValue();
+         // The previous bulk is destructed at the end of this scope, while its field still exists
+         std::swap(fBulk, bulk);
+      }
+      fField = std::move(field);
+      fSource = std::move(source);
+
+      fFirstEntry = file.fFirstEntry;
+      fEndEntry = file.fFirstEntry + file.fNEntries;
+      fLastEntry = -1;
+      fLastClusterRange = 0;
+      fClusterRanges.clear();
+      // The descriptor of the file is immutable and can be read without taking the lock of the page source
+      for (const auto &clusterDesc : file.fDescriptor->GetClusterIterable()) {
+         fClusterRanges.push_back({static_cast<Long64_t>(clusterDesc.GetFirstEntryIndex()),
+                                   static_cast<Long64_t>(clusterDesc.GetNEntries()), clusterDesc.GetId()});
+      }
+      std::sort(fClusterRanges.begin(), fClusterRanges.end(),
+                [](const RClusterRange &a, const RClusterRange &b) { return a.fFirstEntry < b.fFirstEntry; });
    }
-   ~RNTupleColumnReader() = default;
 
-   /// Column readers are created as prototype and then cloned for every slot
-   std::unique_ptr<RNTupleColumnReader> Clone()
+public:
+   RNTupleColumnReader(std::unique_ptr<RFieldBase> f, RNTupleDS *dataSource = nullptr, unsigned int slot = 0)
+      : fDataSource(dataSource),
+        fSlot(slot),
+        fField(std::move(f)),
+        fValue(fField->GenerateValue()),
+        fBulk(fField->GenerateBulk()),
+        fLastEntry(-1)
    {
-      return std::make_unique<RNTupleColumnReader>(fField->Clone(fField->GetName()));
    }
+   ~RNTupleColumnReader() = default;
 
-   /// Connect the field and its subfields to the page source
-   void Connect(RPageSource &source)
+   /// Column readers are created as prototype and then cloned for every slot.  The clones connect to the page
+   /// source of their slot when they read the first entry of a file.
+   std::unique_ptr<RNTupleColumnReader> Clone(RNTupleDS &dataSource, unsigned int slot)
    {
-      fField->ConnectPageSource(source);
-      for (auto &f : *fField)
-         f.ConnectPageSource(source);
+      return std::make_unique<RNTupleColumnReader>(fField->Clone(fField->GetName()), &dataSource, slot);
    }
 
    void *GetImpl(Long64_t entry) final
    {
       if (entry != fLastEntry) {
-         fValue.Read(entry);
+         if (entry < fFirstEntry || entry >= fEndEntry)
+            Connect(entry);
+         fValue.Read(entry - fFirstEntry);
          fLastEntry = entry;
       }
       return fValue.GetRawPtr();
    }
+
+   /// Bulks are read from a single cluster; for entry ranges that straddle a cluster boundary, the caller falls back
+   /// to reading the values entry by entry.
+   void *GetBulkImpl(Long64_t globalFirstEntry, const bool *mask, std::size_t size) final
+   {
+      if (globalFirstEntry < fFirstEntry || globalFirstEntry >= fEndEntry)
+         Connect(globalFirstEntry);
+      const auto firstEntry = globalFirstEntry - fFirstEntry;
+      if (fLastClusterRange >= fClusterRanges.size() || firstEntry < fClusterRanges[fLastClusterRange].fFirstEntry ||
+          firstEntry >= fClusterRanges[fLastClusterRange].fFirstEntry + fClusterRanges[fLastClusterRange].fNEntries) {
+         auto itr =
+            std::upper_bound(fClusterRanges.begin(), fClusterRanges.end(), firstEntry,
+                             [](Long64_t entry, const RClusterRange &range) { return entry < range.fFirstEntry; });
+         if (itr == fClusterRanges.begin())
+            return nullptr;
+         fLastClusterRange = std::distance(fClusterRanges.begin(), itr) - 1;
+      }
+      const auto &range = fClusterRanges[fLastClusterRange];
+      if (firstEntry + static_cast<Long64_t>(size) > range.fFirstEntry + range.fNEntries)
+         return nullptr;
+      return fBulk.ReadBulk(RClusterIndex(range.fClusterId, firstEntry - range.fFirstEntry), mask, size);
+   }
 };
 
 } // namespace Internal
@@ -270,10 +374,75 @@ void RNTupleDS::AddField(const RNTupleDescriptor &desc, std::string_view colName
 RNTupleDS::RNTupleDS(std::unique_ptr<Detail::RPageSource> pageSource)
 {
    pageSource->Attach();
-   auto descriptorGuard = pageSource->GetSharedDescriptorGuard();
-   fSources.emplace_back(std::move(pageSource));
+   RNTupleFile file;
+   file.fDescriptor = pageSource->GetSharedDescriptorGuard()->Clone();
+   fNTupleName = file.fDescriptor->GetName();
+   fOptions = pageSource->GetReadOptions();
+   file.fSource = std::move(pageSource);
+   AddFile(std::move(file));
+
+   const auto &desc = *fFiles[0].fDescriptor;
+   AddField(desc, "", desc.GetFieldZeroId(), std::vector<DescriptorId_t>());
+}
+
+RNTupleDS::RNTupleDS(std::string_view ntupleName, const std::vector<std::string> &fileNames,
+                     const RNTupleReadOptions &options)
+   : fNTupleName(ntupleName), fOptions(options)
+{
+   if (fileNames.empty())
+      throw RException(R__FAIL("RNTupleDS: no input files"));
+
+   for (const auto &fileName : fileNames) {
+      // The page source that reads the meta-data is closed right away, so that the files that are not being read do
+      // not hold file descriptors and I/O threads
+      auto source = Detail::RPageSource::Create(ntupleName, fileName, options);
+      source->Attach();
+      RNTupleFile file;
+      file.fFileName = fileName;
+      file.fDescriptor = source->GetSharedDescriptorGuard()->Clone();
+      AddFile(std::move(file));
+   }
 
-   AddField(descriptorGuard.GetRef(), "", descriptorGuard->GetFieldZeroId(), std::vector<DescriptorId_t>());
+   const auto &desc = *fFiles[0].fDescriptor;
+   AddField(desc, "", desc.GetFieldZeroId(), std::vector<DescriptorId_t>());
+}
+
+void RNTupleDS::AddFile(RNTupleFile &&file)
+{
+   if (!fFiles.empty()) {
+      const auto &desc = *fFiles[0].fDescriptor;
+      if (desc.GetNPhysicalColumns() != file.fDescriptor->GetNPhysicalColumns() ||
+          !HasSameFields(desc, *file.fDescriptor, desc.GetFieldZeroId())) {
+         throw RException(R__FAIL("RNTupleDS: the schema of ntuple '" + fNTupleName + "' in " + file.fFileName +
+                                  " differs from the one in " + fFiles[0].fFileName));
+      }
+      file.fFirstEntry = fFiles.back().fFirstEntry + fFiles.back().fNEntries;
+   }
+   file.fNEntries = file.fDescriptor->GetNEntries();
+   fFiles.emplace_back(std::move(file));
+}
+
+std::size_t RNTupleDS::FindFile(ULong64_t entry) const
+{
+   // Files without entries have the same first entry as the next file and are skipped
+   auto itr = std::upper_bound(fFiles.begin(), fFiles.end(), entry,
+                               [](ULong64_t e, const RNTupleFile &file) { return e < file.fFirstEntry; });
+   R__ASSERT(itr != fFiles.begin());
+   return std::distance(fFiles.begin(), itr) - 1;
+}
+
+std::shared_ptr<Detail::RPageSource> RNTupleDS::GetSlotSource(unsigned int slot, std::size_t fileIndex)
+{
+   auto &slotSource = fSlotSources[slot];
+   if (!slotSource.fSource || slotSource.fFileIndex != fileIndex) {
+      const auto &file = fFiles[fileIndex];
+      auto source = file.fSource ? file.fSource->Clone()
+                                 : Detail::RPageSource::Create(fNTupleName, file.fFileName, fOptions);
+      source->Attach(*file.fDescriptor);
+      slotSource.fSource = std::move(source);
+      slotSource.fFileIndex = fileIndex;
+   }
+   return slotSource.fSource;
 }
 
 RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view /* name */, const std::type_info & /* ti */)
@@ -288,9 +457,7 @@ RNTupleDS::GetColumnReaders(unsigned int slot, std::string_view name, const std:
    // at this point we can assume that `name` will be found in fColumnNames, RDF is in charge validation
    // TODO(jblomer): check incoming type
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), name));
-   auto clone = fColumnReaderPrototypes[index]->Clone();
-   clone->Connect(*fSources[slot]);
-   return clone;
+   return fColumnReaderPrototypes[index]->Clone(*this, slot);
 }
 
 bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
@@ -298,26 +465,133 @@ bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
    return true;
 }
 
+bool RNTupleDS::SupportsBulkProcessing() const
+{
+   // The column readers read by entry number and do not depend on SetEntry()
+   return true;
+}
+
+DescriptorId_t RNTupleDS::FindValueRangeColumnId(std::string_view colName) const
+{
+   const auto &desc = *fFiles[0].fDescriptor;
+
+   // Resolve the (possibly nested) record member, e.g. "event.id", to its field; collections are not supported
+   auto fieldId = desc.GetFieldZeroId();
+   std::string_view::size_type pos = 0;
+   while (fieldId != kInvalidDescriptorId) {
+      const auto sep = colName.find('.', pos);
+      fieldId = desc.FindFieldId(colName.substr(pos, sep == std::string_view::npos ? sep : sep - pos), fieldId);
+      if (sep == std::string_view::npos)
+         break;
+      pos = sep + 1;
+      if (fieldId != kInvalidDescriptorId &&
+          desc.GetFieldDescriptor(fieldId).GetStructure() != ENTupleStructure::kRecord) {
+         fieldId = kInvalidDescriptorId;
+      }
+   }
+   if (fieldId == kInvalidDescriptorId || desc.GetFieldDescriptor(fieldId).GetStructure() != ENTupleStructure::kLeaf)
+      return kInvalidDescriptorId;
+   return desc.FindPhysicalColumnId(fieldId, 0);
+}
+
+void RNTupleDS::AddValueRangeHint(std::string_view colName, double min, double max)
+{
+   const auto physicalColumnId = FindValueRangeColumnId(colName);
+   if (physicalColumnId == kInvalidDescriptorId)
+      throw RException(R__FAIL("value range hints require a scalar column outside of collections: " +
+                               std::string(colName)));
+
+   fValueRangeHints.push_back({physicalColumnId, min, max});
+}
+
+void RNTupleDS::SetPredicates(const std::vector<ROOT::RDF::Experimental::RColumnPredicate> &predicates)
+{
+   using EOperator = ROOT::RDF::Experimental::RColumnPredicate::EOperator;
+
+   // Predicates are turned into value range hints; since they only serve to skip clusters, strict comparisons can be
+   // relaxed to closed intervals.  Predicates on columns without value ranges are ignored.
+   fPredicateHints.clear();
+   for (const auto &p : predicates) {
+      const auto physicalColumnId = FindValueRangeColumnId(p.fColumnName);
+      if (physicalColumnId == kInvalidDescriptorId)
+         continue;
+      RValueRangeHint hint{physicalColumnId, -std::numeric_limits<double>::infinity(),
+                           std::numeric_limits<double>::infinity()};
+      switch (p.fOperator) {
+      case EOperator::kLess:
+      case EOperator::kLessEqual: hint.fMax = p.fValue; break;
+      case EOperator::kGreater:
+      case EOperator::kGreaterEqual: hint.fMin = p.fValue; break;
+      case EOperator::kEqual: hint.fMin = hint.fMax = p.fValue; break;
+      case EOperator::kNotEqual: continue;
+      }
+      fPredicateHints.emplace_back(hint);
+   }
+}
+
+void RNTupleDS::SetActiveColumns(const std::vector<std::string> &columnNames)
+{
+   fActiveColumns.clear();
+   for (const auto &name : columnNames) {
+      const auto itr = std::find(fColumnNames.begin(), fColumnNames.end(), name);
+      if (itr != fColumnNames.end())
+         fActiveColumns.emplace_back(std::distance(fColumnNames.begin(), itr));
+   }
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
-   // TODO(jblomer): use cluster boundaries for the entry ranges
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
    if (fHasSeenAllRanges)
       return ranges;
+   fHasSeenAllRanges = true;
+
+   auto hints = fValueRangeHints;
+   hints.insert(hints.end(), fPredicateHints.begin(), fPredicateHints.end());
+   if (!hints.empty()) {
+      // Only return the entries of the clusters that pass all value range hints, one entry range per cluster
+      for (const auto &file : fFiles) {
+         const auto &desc = *file.fDescriptor;
+         auto clusterIds = desc.FindClustersInValueRange(hints[0].fPhysicalColumnId, hints[0].fMin, hints[0].fMax);
+         for (std::size_t i = 1; i < hints.size(); ++i) {
+            const auto &hint = hints[i];
+            const auto passed = desc.FindClustersInValueRange(hint.fPhysicalColumnId, hint.fMin, hint.fMax);
+            clusterIds.erase(std::remove_if(clusterIds.begin(), clusterIds.end(),
+                                            [&passed](DescriptorId_t id) {
+                                               return std::find(passed.begin(), passed.end(), id) == passed.end();
+                                            }),
+                             clusterIds.end());
+         }
 
-   auto nEntries = fSources[0]->GetNEntries();
-   const auto chunkSize = nEntries / fNSlots;
-   const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
-   auto start = 0UL;
-   auto end = 0UL;
-   for (auto i : ROOT::TSeqU(fNSlots)) {
-      start = end;
-      end += chunkSize;
-      ranges.emplace_back(start, end);
-      (void)i;
+         for (auto clusterId : clusterIds) {
+            const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+            const auto start = file.fFirstEntry + clusterDesc.GetFirstEntryIndex();
+            ranges.emplace_back(start, start + clusterDesc.GetNEntries());
+         }
+      }
+      return ranges;
+   }
+
+   // Entry ranges consist of whole clusters of a single file, so that every cluster is read by a single page source.
+   // The ranges have about the number of entries of an even split of all entries over the slots; as the tasks of the
+   // event loop pick up the ranges in turn, slots that processed a range quickly pick up further ranges.
+   const ULong64_t nEntries = fFiles.back().fFirstEntry + fFiles.back().fNEntries;
+   const ULong64_t targetSize = std::max<ULong64_t>(1, nEntries / fNSlots);
+   for (const auto &file : fFiles) {
+      std::vector<ULong64_t> clusterEnds;
+      for (const auto &clusterDesc : file.fDescriptor->GetClusterIterable())
+         clusterEnds.emplace_back(clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries());
+      std::sort(clusterEnds.begin(), clusterEnds.end());
+
+      ULong64_t start = file.fFirstEntry;
+      for (auto clusterEnd : clusterEnds) {
+         const auto end = file.fFirstEntry + clusterEnd;
+         if (end - start >= targetSize || clusterEnd == file.fNEntries) {
+            ranges.emplace_back(start, end);
+            start = end;
+         }
+      }
    }
-   ranges.back().second += reminder;
-   fHasSeenAllRanges = true;
    return ranges;
 }
 
@@ -345,11 +619,11 @@ void RNTupleDS::SetNSlots(unsigned int nSlots)
    R__ASSERT(nSlots > 0);
    fNSlots = nSlots;
 
-   for (unsigned int i = 1; i < fNSlots; ++i) {
-      fSources.emplace_back(fSources[0]->Clone());
-      assert(i == (fSources.size() - 1));
-      fSources[i]->Attach();
-   }
+   // Page sources are opened by the slots when they start reading a file; as before, the first slot reads with the
+   // page source the data source was constructed with
+   fSlotSources.resize(fNSlots);
+   if (fFiles[0].fSource)
+      fSlotSources[0].fSource = fFiles[0].fSource;
 }
 } // namespace Experimental
 } // namespace ROOT
@@ -361,6 +635,13 @@ ROOT::RDataFrame ROOT::RDF::Experimental::FromRNTuple(std::string_view ntupleNam
    return rdf;
 }
 
+ROOT::RDataFrame
+ROOT::RDF::Experimental::FromRNTuple(std::string_view ntupleName, const std::vector<std::string> &fileNames)
+{
+   ROOT::RDataFrame rdf(std::make_unique<ROOT::Experimental::RNTupleDS>(ntupleName, fileNames));
+   return rdf;
+}
+
 ROOT::RDataFrame ROOT::RDF::Experimental::FromRNTuple(ROOT::Experimental::RNTuple *ntuple)
 {
    ROOT::RDataFrame rdf(std::make_unique<ROOT::Experimental::RNTupleDS>(ntuple->MakePageSource()));
@@ -0,0 +1,329 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RPrefetchDS.hxx>
+#include <ROOT/RDF/RColumnReaderBase.hxx>
+#include <ROOT/RDF/Utils.hxx>
+#include <ROOT/RVec.hxx>
+#include <ROOT/TypeTraits.hxx>
+#include <TError.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <typeinfo>
+
+namespace {
+
+using ROOT::RDF::RDataSource;
+using ROOT::RDF::Experimental::RPrefetchDS;
+
+/// The values of one column for all the entries of a batch
+class RColumnValuesBase {
+public:
+   virtual ~RColumnValuesBase() = default;
+   virtual void *GetValuePtr(std::size_t index) = 0;
+};
+
+template <typename T>
+class RColumnValues final : public RColumnValuesBase {
+public:
+   /// A deque rather than a vector: std::vector<bool> does not provide addressable elements
+   std::deque<T> fValues;
+   void *GetValuePtr(std::size_t index) final { return &fValues[index]; }
+};
+
+} // anonymous namespace
+
+/// A column of the wrapped data source that is read by the event loop
+struct ROOT::RDF::Experimental::RPrefetchDS::RColumn {
+   std::string fName;
+   const std::type_info &fTypeId;
+   /// Per slot, the address of the value of the current entry; the event loop reads through pointers to these
+   std::vector<void *> fSlotValues;
+
+   RColumn(std::string_view name, const std::type_info &typeId) : fName(name), fTypeId(typeId) {}
+   virtual ~RColumn() = default;
+   virtual std::unique_ptr<RColumnValuesBase> MakeValues() const = 0;
+   /// Append the value of the given entry, which the wrapped data source has just been set to, to the values of a
+   /// batch. The values of the entries that the wrapped data source rejected are default-constructed.
+   virtual void ReadValue(RColumnValuesBase &values, ULong64_t entry, bool isValid) = 0;
+};
+
+/// Entry ranges of the wrapped data source together with the values of the columns for all their entries
+struct ROOT::RDF::Experimental::RPrefetchDS::RBatch {
+   std::vector<std::pair<ULong64_t, ULong64_t>> fRanges;
+   /// Per range, the index of the values of its first entry
+   std::vector<std::size_t> fRangeOffsets;
+   /// Per entry, whether the wrapped data source accepted it, see RDataSource::SetEntry()
+   std::vector<unsigned char> fIsValid;
+   /// Per column, in the order of RPrefetchDS::fColumns
+   std::vector<std::unique_ptr<RColumnValuesBase>> fValues;
+};
+
+namespace {
+
+template <typename T>
+class RTypedColumn final : public RPrefetchDS::RColumn {
+   T **fCursor = nullptr;
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> fReader;
+
+public:
+   RTypedColumn(RDataSource &source, std::string_view name) : RColumn(name, typeid(T))
+   {
+      // Data sources provide either cursors or column readers, see RDataSource::GetColumnReaders()
+      auto cursors = source.GetColumnReaders<T>(name);
+      if (!cursors.empty())
+         fCursor = cursors[0];
+      else
+         fReader = source.GetColumnReaders(0u, name, typeid(T));
+      if (!fCursor && !fReader)
+         throw std::runtime_error("RPrefetchDS: the wrapped data source provides no reader for column \"" +
+                                  std::string(name) + "\".");
+   }
+
+   std::unique_ptr<RColumnValuesBase> MakeValues() const final { return std::make_unique<RColumnValues<T>>(); }
+
+   void ReadValue(RColumnValuesBase &values, ULong64_t entry, bool isValid) final
+   {
+      auto &typedValues = static_cast<RColumnValues<T> &>(values).fValues;
+      if (!isValid)
+         typedValues.emplace_back();
+      else if (fCursor)
+         typedValues.emplace_back(**fCursor);
+      else
+         typedValues.emplace_back(fReader->Get<T>(entry));
+   }
+};
+
+template <typename... Ts>
+std::unique_ptr<RPrefetchDS::RColumn> MakeColumnImpl(ROOT::TypeTraits::TypeList<Ts...>, RDataSource &source,
+                                                     std::string_view name, const std::type_info &typeId)
+{
+   std::unique_ptr<RPrefetchDS::RColumn> column;
+   ((typeId == typeid(Ts) && (column = std::make_unique<RTypedColumn<Ts>>(source, name), true)) || ...);
+   return column;
+}
+
+/// Return the column of the given type, or null if values of this type cannot be prefetched
+std::unique_ptr<RPrefetchDS::RColumn>
+MakeColumn(RDataSource &source, std::string_view name, const std::type_info &typeId)
+{
+   using ROOT::RVec;
+   using Types_t = ROOT::TypeTraits::TypeList<
+      bool, char, signed char, unsigned char, short, unsigned short, int, unsigned int, long, unsigned long,
+      long long, unsigned long long, float, double, std::string, std::vector<unsigned char>, RVec<bool>, RVec<char>,
+      RVec<unsigned char>, RVec<short>, RVec<unsigned short>, RVec<int>, RVec<unsigned int>, RVec<long>,
+      RVec<unsigned long>, RVec<long long>, RVec<unsigned long long>, RVec<float>, RVec<double>>;
+   return MakeColumnImpl(Types_t(), source, name, typeId);
+}
+
+} // anonymous namespace
+
+ROOT::RDF::Experimental::RPrefetchDS::RPrefetchDS(std::unique_ptr<RDataSource> source, std::size_t nBufferedBatches)
+   : fSource(std::move(source)), fNBufferedBatches(std::max<std::size_t>(nBufferedBatches, 1))
+{
+   if (!fSource)
+      throw std::invalid_argument("RPrefetchDS: the data source to prefetch must not be null.");
+}
+
+ROOT::RDF::Experimental::RPrefetchDS::~RPrefetchDS()
+{
+   StopProducer();
+}
+
+void ROOT::RDF::Experimental::RPrefetchDS::SetNSlots(unsigned int nSlots)
+{
+   fNSlots = nSlots;
+   fSlotRanges.assign(fNSlots, 0);
+   fSource->SetNSlots(1);
+}
+
+const std::vector<std::string> &ROOT::RDF::Experimental::RPrefetchDS::GetColumnNames() const
+{
+   return fSource->GetColumnNames();
+}
+
+bool ROOT::RDF::Experimental::RPrefetchDS::HasColumn(std::string_view colName) const
+{
+   return fSource->HasColumn(colName);
+}
+
+std::string ROOT::RDF::Experimental::RPrefetchDS::GetTypeName(std::string_view colName) const
+{
+   return fSource->GetTypeName(colName);
+}
+
+ROOT::RDF::RDataSource::Record_t
+ROOT::RDF::Experimental::RPrefetchDS::GetColumnReadersImpl(std::string_view name, const std::type_info &ti)
+{
+   auto itr = std::find_if(fColumns.begin(), fColumns.end(), [name](const auto &c) { return c->fName == name; });
+   if (itr == fColumns.end()) {
+      auto column = MakeColumn(*fSource, name, ti);
+      if (!column) {
+         throw std::runtime_error("RPrefetchDS: cannot prefetch column \"" + std::string(name) + "\" of type " +
+                                  ROOT::Internal::RDF::TypeID2TypeName(ti) + ".");
+      }
+      column->fSlotValues.resize(fNSlots, nullptr);
+      fColumns.emplace_back(std::move(column));
+      itr = fColumns.end() - 1;
+   } else if ((*itr)->fTypeId != ti) {
+      throw std::runtime_error("RPrefetchDS: column \"" + std::string(name) + "\" was already requested with type " +
+                               ROOT::Internal::RDF::TypeID2TypeName((*itr)->fTypeId) + ".");
+   }
+
+   Record_t ptrs;
+   for (auto &value : (*itr)->fSlotValues)
+      ptrs.emplace_back(&value);
+   return ptrs;
+}
+
+void ROOT::RDF::Experimental::RPrefetchDS::Produce()
+{
+   try {
+      auto ranges = fSource->GetEntryRanges();
+      while (!ranges.empty()) {
+         auto batch = std::make_unique<RBatch>();
+         for (const auto &column : fColumns)
+            batch->fValues.emplace_back(column->MakeValues());
+         for (const auto &range : ranges) {
+            {
+               std::lock_guard<std::mutex> lock(fQueueMutex);
+               if (fStopProducer)
+                  break;
+            }
+            batch->fRangeOffsets.emplace_back(batch->fIsValid.size());
+            fSource->InitSlot(0u, range.first);
+            for (auto entry = range.first; entry < range.second; ++entry) {
+               const bool isValid = fSource->SetEntry(0u, entry);
+               batch->fIsValid.emplace_back(isValid);
+               for (std::size_t i = 0; i < fColumns.size(); ++i)
+                  fColumns[i]->ReadValue(*batch->fValues[i], entry, isValid);
+            }
+            fSource->FinalizeSlot(0u);
+         }
+         batch->fRanges = std::move(ranges);
+
+         std::unique_lock<std::mutex> lock(fQueueMutex);
+         fQueueCv.wait(lock, [this] { return fStopProducer || fQueue.size() < fNBufferedBatches; });
+         if (fStopProducer)
+            break;
+         fQueue.emplace_back(std::move(batch));
+         fQueueCv.notify_all();
+         lock.unlock();
+
+         ranges = fSource->GetEntryRanges();
+      }
+   } catch (...) {
+      std::lock_guard<std::mutex> lock(fQueueMutex);
+      fProducerError = std::current_exception();
+   }
+
+   std::lock_guard<std::mutex> lock(fQueueMutex);
+   fProducerDone = true;
+   fQueueCv.notify_all();
+}
+
+void ROOT::RDF::Experimental::RPrefetchDS::StopProducer()
+{
+   if (fProducer.joinable()) {
+      {
+         std::lock_guard<std::mutex> lock(fQueueMutex);
+         fStopProducer = true;
+      }
+      fQueueCv.notify_all();
+      fProducer.join();
+   }
+   fQueue.clear();
+   fCurrentBatch.reset();
+}
+
+void ROOT::RDF::Experimental::RPrefetchDS::Initialize()
+{
+   // a previous event loop might have been interrupted
+   StopProducer();
+   fSource->Initialize();
+   fProducerDone = false;
+   fStopProducer = false;
+   fProducerError = nullptr;
+   fProducer = std::thread([this]() { Produce(); });
+}
+
+std::vector<std::pair<ULong64_t, ULong64_t>> ROOT::RDF::Experimental::RPrefetchDS::GetEntryRanges()
+{
+   // RDataFrame only asks for new ranges once all the entries of the previous ones have been processed
+   fCurrentBatch.reset();
+   {
+      std::unique_lock<std::mutex> lock(fQueueMutex);
+      fQueueCv.wait(lock, [this] { return !fQueue.empty() || fProducerDone; });
+      if (fQueue.empty()) {
+         if (fProducerError)
+            std::rethrow_exception(fProducerError);
+         return {};
+      }
+      fCurrentBatch = std::move(fQueue.front());
+      fQueue.pop_front();
+      fQueueCv.notify_all();
+   }
+   std::fill(fSlotRanges.begin(), fSlotRanges.end(), 0);
+
+   if (fNSlots <= 1)
+      return fCurrentBatch->fRanges;
+   // split the ranges so that all the slots can process the batch
+   std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
+   for (const auto &[first, last] : fCurrentBatch->fRanges) {
+      const auto nEntries = last - first;
+      const auto nParts = std::max<ULong64_t>(1, std::min<ULong64_t>(fNSlots, nEntries));
+      for (ULong64_t i = 0; i < nParts; ++i)
+         ranges.emplace_back(first + nEntries * i / nParts, first + nEntries * (i + 1) / nParts);
+   }
+   return ranges;
+}
+
+bool ROOT::RDF::Experimental::RPrefetchDS::SetEntry(unsigned int slot, ULong64_t entry)
+{
+   const auto &batch = *fCurrentBatch;
+   auto &rangeIdx = fSlotRanges[slot];
+   if (entry < batch.fRanges[rangeIdx].first || entry >= batch.fRanges[rangeIdx].second) {
+      const auto itr = std::find_if(batch.fRanges.begin(), batch.fRanges.end(),
+                                    [entry](const auto &r) { return entry >= r.first && entry < r.second; });
+      R__ASSERT(itr != batch.fRanges.end());
+      rangeIdx = itr - batch.fRanges.begin();
+   }
+   const auto index = batch.fRangeOffsets[rangeIdx] + (entry - batch.fRanges[rangeIdx].first);
+   for (std::size_t i = 0; i < fColumns.size(); ++i)
+      fColumns[i]->fSlotValues[slot] = batch.fValues[i]->GetValuePtr(index);
+   return batch.fIsValid[index];
+}
+
+void ROOT::RDF::Experimental::RPrefetchDS::Finalize()
+{
+   StopProducer();
+   fSource->Finalize();
+}
+
+std::string ROOT::RDF::Experimental::RPrefetchDS::GetLabel()
+{
+   return fSource->GetLabel();
+}
+
+void ROOT::RDF::Experimental::RPrefetchDS::SetPredicates(
+   const std::vector<ROOT::RDF::Experimental::RColumnPredicate> &predicates)
+{
+   fSource->SetPredicates(predicates);
+}
+
+void ROOT::RDF::Experimental::RPrefetchDS::SetActiveColumns(const std::vector<std::string> &columnNames)
+{
+   fSource->SetActiveColumns(columnNames);
+}
+
+ROOT::RDataFrame
+ROOT::RDF::Experimental::FromPrefetchedSource(std::unique_ptr<RDataSource> source, std::size_t nBufferedBatches)
+{
+   return ROOT::RDataFrame(std::make_unique<RPrefetchDS>(std::move(source), nBufferedBatches));
+}
@@ -0,0 +1,137 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RProfiler.hxx"
+
+#include <cstdio>
+#include <sstream>
+
+namespace {
+
+using ROOT::Internal::RDF::RProfiler;
+
+const char *GetKindName(RProfiler::ENodeKind kind)
+{
+   switch (kind) {
+   case RProfiler::ENodeKind::kFilter: return "filter";
+   case RProfiler::ENodeKind::kDefine: return "define";
+   case RProfiler::ENodeKind::kAction: return "action";
+   case RProfiler::ENodeKind::kColumn: return "column";
+   }
+   return "";
+}
+
+std::string EscapeJSON(const std::string &str)
+{
+   std::string result;
+   for (const char c : str) {
+      switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\t': result += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned int>(c));
+            result += buf;
+         } else {
+            result += c;
+         }
+      }
+   }
+   return result;
+}
+
+void WriteCounters(std::ostream &os, const RProfiler::RCounters &counters)
+{
+   os << "\"time\": " << counters.fTime << ", \"calls\": " << counters.fNCalls
+      << ", \"evaluations\": " << counters.fNEvaluations;
+}
+
+std::string FormatTime(double seconds)
+{
+   char buf[32];
+   if (seconds < 1.)
+      snprintf(buf, sizeof(buf), "%.3g ms", seconds * 1000.);
+   else
+      snprintf(buf, sizeof(buf), "%.3g s", seconds);
+   return buf;
+}
+
+} // anonymous namespace
+
+unsigned int ROOT::Internal::RDF::RProfiler::RegisterNode(ENodeKind kind, const std::string &name)
+{
+   std::lock_guard<std::mutex> lock(fNodesMutex);
+   fNodes.push_back({kind, name});
+   return fNodes.size() - 1;
+}
+
+unsigned int ROOT::Internal::RDF::RProfiler::RegisterColumn(const std::string &name)
+{
+   std::lock_guard<std::mutex> lock(fNodesMutex);
+   for (unsigned int id = 0; id < fNodes.size(); ++id) {
+      if (fNodes[id].fKind == ENodeKind::kColumn && fNodes[id].fName == name)
+         return id;
+   }
+   fNodes.push_back({ENodeKind::kColumn, name});
+   return fNodes.size() - 1;
+}
+
+ROOT::Internal::RDF::RProfiler::RCounters ROOT::Internal::RDF::RProfiler::GetCounters(unsigned int id) const
+{
+   RCounters result;
+   for (const auto &slotData : fSlots) {
+      if (id < slotData.fCounters.size())
+         result += slotData.fCounters[id];
+   }
+   return result;
+}
+
+std::string ROOT::Internal::RDF::RProfiler::GetGraphLabel(unsigned int id) const
+{
+   const auto counters = GetCounters(id);
+   return FormatTime(counters.fTime) + ", " + std::to_string(counters.fNEvaluations) + "/" +
+          std::to_string(counters.fNCalls) + " evaluated";
+}
+
+std::string ROOT::Internal::RDF::RProfiler::GetColumnsGraphLabel() const
+{
+   std::lock_guard<std::mutex> lock(fNodesMutex);
+   double time = 0.;
+   for (unsigned int id = 0; id < fNodes.size(); ++id) {
+      if (fNodes[id].fKind == ENodeKind::kColumn)
+         time += GetCounters(id).fTime;
+   }
+   return "Reading columns: " + FormatTime(time);
+}
+
+std::string ROOT::Internal::RDF::RProfiler::AsJSON() const
+{
+   std::lock_guard<std::mutex> lock(fNodesMutex);
+   std::ostringstream os;
+   os.precision(9);
+   os << "{\"nodes\": [";
+   for (unsigned int id = 0; id < fNodes.size(); ++id) {
+      os << (id == 0 ? "\n" : ",\n");
+      os << "  {\"id\": " << id << ", \"kind\": \"" << GetKindName(fNodes[id].fKind) << "\", \"name\": \""
+         << EscapeJSON(fNodes[id].fName) << "\", ";
+      WriteCounters(os, GetCounters(id));
+      os << ", \"slots\": [";
+      for (std::size_t slot = 0; slot < fSlots.size(); ++slot) {
+         const auto &slotCounters = fSlots[slot].fCounters;
+         os << (slot == 0 ? "{" : ", {");
+         WriteCounters(os, id < slotCounters.size() ? slotCounters[id] : RCounters());
+         os << "}";
+      }
+      os << "]}";
+   }
+   os << "\n]}\n";
+   return os.str();
+}
@@ -4,6 +4,7 @@
 #include "TH1F.h"
 #include "TRandom.h"
 #include "TSystem.h"
+#include "RConfigure.h" // R__HAS_ROOT7
 
 #include "gtest/gtest.h"
 
@@ -336,3 +337,41 @@ TEST(Cache, Alias)
    auto df4 = df3.Cache({"y"});
    EXPECT_EQ(df4.Sum("y").GetValue(), 3u);
 }
+
+#ifdef R__HAS_ROOT7
+TEST(Cache, PersistentCache)
+{
+   const auto cacheDir = "dataframe_cache_persistentcache";
+   gSystem->Exec((std::string("rm -rf ") + cacheDir).c_str());
+
+   unsigned int nCalls = 0;
+   auto makeGraph = [&nCalls](unsigned int nEntries) {
+      return ROOT::RDataFrame(nEntries)
+         .Define("x",
+                 [&nCalls](ULong64_t e) {
+                    ++nCalls;
+                    return double(e);
+                 },
+                 {"rdfentry_"})
+         .Filter([](double x) { return x < 5; }, {"x"}, "x < 5");
+   };
+
+   auto cached = makeGraph(10).PersistentCache({"x"}, cacheDir);
+   EXPECT_EQ(10u, nCalls);
+   EXPECT_EQ(5u, *cached.Count());
+   EXPECT_DOUBLE_EQ(10., *cached.Sum<double>("x"));
+   EXPECT_EQ(std::vector<std::string>{"x"}, cached.GetColumnNames());
+
+   // The same graph reads the cache instead of recomputing the Define
+   auto reread = makeGraph(10).PersistentCache({"x"}, cacheDir);
+   EXPECT_EQ(10u, nCalls);
+   EXPECT_DOUBLE_EQ(10., *reread.Sum<double>("x"));
+
+   // A different dataset does not match the cached one
+   auto other = makeGraph(20).PersistentCache({"x"}, cacheDir);
+   EXPECT_EQ(30u, nCalls);
+   EXPECT_EQ(5u, *other.Count());
+
+   gSystem->Exec((std::string("rm -rf ") + cacheDir).c_str());
+}
+#endif
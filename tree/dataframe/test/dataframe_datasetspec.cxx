@@ -15,6 +15,7 @@
 #include <nlohmann/json.hpp>
 #include <TSystem.h>
 
+#include <fstream>
 #include <thread> // std::thread::hardware_concurrency
 
 using namespace ROOT;
@@ -429,6 +430,34 @@ TEST_P(RDatasetSpecTest, Histo1D)
    CheckBins(h2edgesd->GetXaxis(), edgesd);
 }
 
+TEST_P(RDatasetSpecTest, MetadataCatalog)
+{
+   const auto catalog = "specTestCatalog.txt"s;
+   auto makeSpec = [&catalog] {
+      RDatasetSpec spec;
+      spec.AddSample({"simulated", "tree"s, {"specTestFile0*.root"s}});
+      spec.AddSample({"real", "subTree"s, {"specTestFile1.root"s}});
+      spec.WithMetadataCatalog(catalog);
+      return spec;
+   };
+
+   // the first data frame writes the catalog, the second one takes the clusters from it
+   EXPECT_EQ(*RDataFrame(makeSpec()).Sum<ULong64_t>("x"), 21ull * 22 / 2);
+   std::ifstream in(catalog);
+   std::string line;
+   std::size_t nLines = 0;
+   while (std::getline(in, line))
+      ++nLines;
+   EXPECT_EQ(nLines, 4u);
+
+   auto takeRes = RDataFrame(makeSpec()).Take<ULong64_t>("x");
+   auto &res = *takeRes;
+   std::sort(res.begin(), res.end());
+   EXPECT_VEC_SEQ_EQ(res, ROOT::TSeq<ULong64_t>(0, 22));
+
+   gSystem->Unlink(catalog.c_str());
+}
+
 TEST_P(RDatasetSpecTest, FilterDependingOnVariation)
 {
    RDatasetSpec spec;
@@ -0,0 +1,145 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFDistributed.hxx>
+#include <TH1D.h>
+#include <TROOT.h>
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using ROOT::RDF::Experimental::GetRankEntryRange;
+using ROOT::RDF::Experimental::RCommunicator;
+using ROOT::RDF::Experimental::ReduceOverRanks;
+
+namespace {
+
+/// The messages between ranks that are threads of the same process
+struct RMailbox {
+   std::mutex fMutex;
+   std::condition_variable fCv;
+   std::map<std::pair<int, int>, std::deque<std::vector<char>>> fMessages; ///< Indexed by (source, destination)
+};
+
+class RThreadCommunicator final : public RCommunicator {
+   int fRank;
+   int fNRanks;
+   RMailbox &fMailbox;
+
+public:
+   RThreadCommunicator(int rank, int nRanks, RMailbox &mailbox) : fRank(rank), fNRanks(nRanks), fMailbox(mailbox) {}
+   int GetRank() const final { return fRank; }
+   int GetNRanks() const final { return fNRanks; }
+   void Send(int destRank, const std::vector<char> &message) final
+   {
+      std::lock_guard<std::mutex> lock(fMailbox.fMutex);
+      fMailbox.fMessages[{fRank, destRank}].push_back(message);
+      fMailbox.fCv.notify_all();
+   }
+   std::vector<char> Receive(int sourceRank) final
+   {
+      std::unique_lock<std::mutex> lock(fMailbox.fMutex);
+      auto &queue = fMailbox.fMessages[{sourceRank, fRank}];
+      fMailbox.fCv.wait(lock, [&queue] { return !queue.empty(); });
+      auto message = std::move(queue.front());
+      queue.pop_front();
+      return message;
+   }
+};
+
+} // anonymous namespace
+
+TEST(RDFDistributed, RankEntryRange)
+{
+   std::vector<std::pair<Long64_t, Long64_t>> ranges;
+   for (int rank = 0; rank < 4; ++rank) {
+      auto range = GetRankEntryRange(10, rank, 4);
+      ranges.emplace_back(range.fBegin, range.fEnd);
+   }
+   EXPECT_EQ((std::vector<std::pair<Long64_t, Long64_t>>{{0, 3}, {3, 6}, {6, 8}, {8, 10}}), ranges);
+
+   auto empty = GetRankEntryRange(2, 3, 4);
+   EXPECT_EQ(empty.fBegin, empty.fEnd);
+   EXPECT_THROW(GetRankEntryRange(10, 4, 4), std::invalid_argument);
+   EXPECT_THROW(GetRankEntryRange(-1, 0, 4), std::invalid_argument);
+}
+
+TEST(RDFDistributed, SerializeMergeableValue)
+{
+   auto h = ROOT::RDataFrame(10).Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"}).Histo1D<double>(
+      {"h", "h", 10, 0., 10.}, "x");
+   auto mergeable = ROOT::Detail::RDF::GetMergeableValue(h);
+   auto buffer = ROOT::Internal::RDF::SerializeMergeableValue(*mergeable);
+   auto value = ROOT::Internal::RDF::DeserializeMergeableValue(buffer);
+   auto typed = dynamic_cast<ROOT::Detail::RDF::RMergeableValue<TH1D> *>(value.get());
+   ASSERT_NE(nullptr, typed);
+   EXPECT_EQ(10, typed->GetValue().GetEntries());
+   EXPECT_DOUBLE_EQ(h->GetMean(), typed->GetValue().GetMean());
+}
+
+TEST(RDFDistributed, ReduceOverRanks)
+{
+   ROOT::EnableThreadSafety();
+   const ULong64_t nEntries = 1000;
+   for (int nRanks : {1, 3, 4, 7}) {
+      for (int rootRank : {0, nRanks - 1}) {
+         RMailbox mailbox;
+         std::vector<std::unique_ptr<ROOT::Detail::RDF::RMergeableValue<ULong64_t>>> counts(nRanks);
+         std::vector<std::unique_ptr<ROOT::Detail::RDF::RMergeableValue<double>>> sums(nRanks);
+         std::vector<std::unique_ptr<ROOT::Detail::RDF::RMergeableValue<double>>> means(nRanks);
+         std::vector<std::unique_ptr<ROOT::Detail::RDF::RMergeableValue<TH1D>>> histos(nRanks);
+         std::vector<std::exception_ptr> errors(nRanks);
+
+         std::vector<std::thread> ranks;
+         for (int rank = 0; rank < nRanks; ++rank) {
+            ranks.emplace_back([&, rank]() {
+               try {
+                  RThreadCommunicator comm(rank, nRanks, mailbox);
+                  const auto range = GetRankEntryRange(nEntries, rank, nRanks);
+                  const auto begin = range.fBegin;
+                  auto df = ROOT::RDataFrame(range.fEnd - range.fBegin)
+                               .Define("x", [begin](ULong64_t e) { return double(begin + e); }, {"rdfentry_"});
+                  auto count = df.Filter([](double x) { return x >= 100; }, {"x"}).Count();
+                  auto sum = df.Sum<double>("x");
+                  auto mean = df.Mean<double>("x");
+                  auto histo = df.Histo1D<double>({"h", "h", 10, 0., 1000.}, "x");
+                  counts[rank] = ReduceOverRanks(count, comm, rootRank);
+                  sums[rank] = ReduceOverRanks(sum, comm, rootRank);
+                  means[rank] = ReduceOverRanks(mean, comm, rootRank);
+                  histos[rank] = ReduceOverRanks(histo, comm, rootRank);
+               } catch (...) {
+                  errors[rank] = std::current_exception();
+               }
+            });
+         }
+         for (auto &t : ranks)
+            t.join();
+         for (auto &e : errors) {
+            if (e)
+               std::rethrow_exception(e);
+         }
+
+         for (int rank = 0; rank < nRanks; ++rank) {
+            if (rank == rootRank)
+               continue;
+            EXPECT_EQ(nullptr, counts[rank]);
+            EXPECT_EQ(nullptr, histos[rank]);
+         }
+         ASSERT_NE(nullptr, counts[rootRank]);
+         EXPECT_EQ(900U, counts[rootRank]->GetValue());
+         EXPECT_DOUBLE_EQ(499500., sums[rootRank]->GetValue());
+         EXPECT_DOUBLE_EQ(499.5, means[rootRank]->GetValue());
+         const auto &h = histos[rootRank]->GetValue();
+         EXPECT_EQ(1000, h.GetEntries());
+         for (int bin = 1; bin <= 10; ++bin)
+            EXPECT_EQ(100, h.GetBinContent(bin));
+      }
+   }
+}
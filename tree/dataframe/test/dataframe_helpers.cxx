@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <sstream>
 #include <vector>
 #include <string>
 
@@ -689,6 +690,58 @@ TEST(RunGraphs, AlreadyRun)
                        "Got 4 handles from which 2 link to results which are already ready.");
 }
 
+TEST(RunGraphs, RunGraphsInOneLoop)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif // R__USE_IMT
+
+   const auto fname = "dataframe_helpers_rungraphsinoneloop.root";
+   ROOT::RDataFrame(100)
+      .Define("x", [](ULong64_t e) { return float(e); }, {"rdfentry_"})
+      .Snapshot<float>("t", fname, {"x"});
+
+   ROOT::RDataFrame df1("t", fname);
+   auto r1 = df1.Filter("x < 50").Count();
+   auto r2 = df1.Sum<float>("x");
+   ROOT::RDataFrame df2("t", fname);
+   auto r3 = df2.Define("y", [](float x) { return 2.f * x; }, {"x"}).Sum<float>("y");
+   ROOT::RDataFrame df3("t", fname);
+
+   EXPECT_EQ(2u, ROOT::RDF::Experimental::RunGraphsInOneLoop({r1, r2, r3}));
+   EXPECT_EQ(df1.GetNRuns(), 1u);
+   EXPECT_EQ(df2.GetNRuns(), 1u);
+   EXPECT_EQ(df3.GetNRuns(), 0u);
+   EXPECT_EQ(*r1, 50u);
+   EXPECT_FLOAT_EQ(*r2, 4950.f);
+   EXPECT_FLOAT_EQ(*r3, 9900.f);
+
+   // The graphs are detached after the shared event loop
+   auto r4 = df2.Max<float>("x");
+   EXPECT_FLOAT_EQ(*r4, 99.f);
+   EXPECT_EQ(df1.GetNRuns(), 1u);
+   EXPECT_EQ(df2.GetNRuns(), 2u);
+
+   gSystem->Unlink(fname);
+}
+
+TEST(RunGraphs, RunGraphsInOneLoopDifferentDatasets)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif // R__USE_IMT
+
+   ROOT::RDataFrame df1(10);
+   auto r1 = df1.Count();
+   ROOT::RDataFrame df2(20);
+   auto r2 = df2.Count();
+
+   EXPECT_THROW(ROOT::RDF::Experimental::RunGraphsInOneLoop({r1, r2}), std::runtime_error);
+   EXPECT_FALSE(r1.IsReady());
+   EXPECT_EQ(*r1, 10u);
+   EXPECT_EQ(*r2, 20u);
+}
+
 int ret42 () {return 42;}
 int ret1 () {return 1;}
 
@@ -753,6 +806,75 @@ TEST(RDFHelpers, Cleanup_After_Exception)
       << "The Finalize method should have changed the value of testVal during the post-exception cleanup." << std::endl;
 }
 
+TEST(RDFHelpers, JitCache)
+{
+   const std::string cacheDir = "rdfhelpers_jitcache";
+   ROOT::RDF::Experimental::SetJitCacheDirectory(cacheDir);
+
+   auto makeGraph = [] {
+      return ROOT::RDataFrame(10).Define("x", "int(rdfentry_)").Filter("x > 4", "cut 0x1").Sum<int>("x");
+   };
+   auto sum1 = makeGraph();
+   EXPECT_EQ(35, *sum1);
+   // The same code, operating on different objects, reuses the compiled library
+   auto sum2 = makeGraph();
+   EXPECT_EQ(35, *sum2);
+
+   ROOT::RDF::Experimental::SetJitCacheDirectory("");
+   void *dir = gSystem->OpenDirectory(cacheDir.c_str());
+   ASSERT_NE(nullptr, dir);
+   bool hasSource = false;
+   while (const char *entry = gSystem->GetDirEntry(dir))
+      hasSource |= std::string(entry).find(".cxx") != std::string::npos;
+   gSystem->FreeDirectory(dir);
+   EXPECT_TRUE(hasSource);
+   gSystem->Exec(("rm -rf " + cacheDir).c_str());
+}
+
+TEST(RDFHelpers, Profiling)
+{
+   ROOT::RDataFrame df(10);
+   EXPECT_THROW(ROOT::RDF::Experimental::GetProfileJSON(df), std::logic_error);
+   ROOT::RDF::Experimental::EnableProfiling(df);
+
+   auto filtered = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"}).Filter([](double x) {
+      return x > 4;
+   }, {"x"});
+   auto sum = filtered.Sum<double>("x");
+   auto count = filtered.Count();
+   auto jitted = df.Define("y", "rdfentry_ * 2").Sum<ULong64_t>("y");
+   EXPECT_DOUBLE_EQ(35., *sum);
+   EXPECT_EQ(5ull, *count);
+   EXPECT_EQ(90ull, *jitted);
+   // The counters add up over the event loops
+   EXPECT_EQ(5ull, *filtered.Count());
+
+   const auto json = ROOT::RDF::Experimental::GetProfileJSON(df);
+   auto getNodeLine = [&json](const std::string &kindAndName) {
+      std::istringstream is(json);
+      std::string line;
+      while (std::getline(is, line)) {
+         if (line.find(kindAndName) != std::string::npos)
+            return line;
+      }
+      return std::string();
+   };
+   // The filter reads x for every entry, Sum reads the cached value of the entries that pass the filter
+   EXPECT_NE(std::string::npos,
+             getNodeLine("\"kind\": \"define\", \"name\": \"x\"").find("\"calls\": 25, \"evaluations\": 20"));
+   EXPECT_NE(std::string::npos,
+             getNodeLine("\"kind\": \"define\", \"name\": \"y\"").find("\"calls\": 10, \"evaluations\": 10"));
+   // Both Sum and Count ask the filter for every entry in the first event loop
+   EXPECT_NE(std::string::npos,
+             getNodeLine("\"kind\": \"filter\"").find("\"calls\": 30, \"evaluations\": 20"));
+   EXPECT_NE(std::string::npos,
+             getNodeLine("\"name\": \"Count\"").find("\"calls\": 5, \"evaluations\": 5"));
+
+   const auto graph = ROOT::RDF::SaveGraph(df);
+   EXPECT_NE(std::string::npos, graph.find("20/25 evaluated"));
+   EXPECT_NE(std::string::npos, graph.find("Reading columns"));
+}
+
 // The code below is a unit test for a function called `ProgressHelper_Existence_MT` in the `RDFHelpers` class.
 
 #ifdef R__USE_IMT
@@ -1,8 +1,11 @@
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/TSeq.hxx"
+#include "TStatistic.h"
 
 #include "gtest/gtest.h"
 
+#include <cmath>
+
 using namespace ROOT::RDF;
 
 template <typename COLL>
@@ -346,3 +349,133 @@ TEST(RDataFrameHisto, FillVecBool)
     EXPECT_EQ(h->GetBinContent(2), n);
     EXPECT_EQ(h->GetBinContent(3), 0u);
 }
+
+void CheckSameHistos(const TH1 &h, const TH1 &ref)
+{
+   ASSERT_EQ(ref.GetNcells(), h.GetNcells());
+   for (int bin = 0; bin < ref.GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(ref.GetBinContent(bin), h.GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(ref.GetBinError(bin), h.GetBinError(bin));
+   }
+   EXPECT_DOUBLE_EQ(ref.GetEntries(), h.GetEntries());
+   double stats[TH1::kNstat] = {};
+   double refStats[TH1::kNstat] = {};
+   h.GetStats(stats);
+   ref.GetStats(refStats);
+   for (int i = 0; i < TH1::kNstat; ++i)
+      EXPECT_DOUBLE_EQ(refStats[i], stats[i]);
+}
+
+// Histograms with fixed-width bins are filled without TH1::Fill, check that the results are the same
+TEST(RDataFrameHisto, FixedBinFill)
+{
+   // enough entries for several flushes of the per-slot buffers, with under- and overflows on all axes
+   const auto n = 5000u;
+   auto getX = [](ULong64_t e) { return (e % 37) * 0.4 - 2.; };
+   auto getY = [](ULong64_t e) { return (e % 23) * 0.5 - 1.; };
+   auto getZ = [](ULong64_t e) { return (e % 11) * 1.1 - 0.5; };
+   auto getW = [](ULong64_t e) { return 0.5 + e % 3; };
+   auto df = ROOT::RDataFrame(n)
+                .Define("x", getX, {"rdfentry_"})
+                .Define("y", getY, {"rdfentry_"})
+                .Define("z", getZ, {"rdfentry_"})
+                .Define("w", getW, {"rdfentry_"})
+                .Define("v", [](double x) { return ROOT::RVecD{x, x + 1.}; }, {"x"});
+
+   auto h1 = df.Histo1D<double>({"h1", "h1", 10, 0., 10.}, "x");
+   auto h1w = df.Histo1D<double, double>({"h1w", "h1w", 10, 0., 10.}, "x", "w");
+   auto h1v = df.Histo1D<ROOT::RVecD, double>({"h1v", "h1v", 10, 0., 10.}, "v", "w");
+   auto h2w = df.Histo2D<double, double, double>({"h2w", "h2w", 10, 0., 10., 5, 0., 10.}, "x", "y", "w");
+   auto h3 = df.Histo3D<double, double, double>({"h3", "h3", 10, 0., 10., 5, 0., 10., 4, 0., 10.}, "x", "y", "z");
+
+   TH1D ref1("ref1", "ref1", 10, 0., 10.);
+   TH1D ref1w("ref1w", "ref1w", 10, 0., 10.);
+   TH1D ref1v("ref1v", "ref1v", 10, 0., 10.);
+   TH2D ref2w("ref2w", "ref2w", 10, 0., 10., 5, 0., 10.);
+   TH3D ref3("ref3", "ref3", 10, 0., 10., 5, 0., 10., 4, 0., 10.);
+   for (ULong64_t e = 0; e < n; ++e) {
+      ref1.Fill(getX(e));
+      ref1w.Fill(getX(e), getW(e));
+      ref1v.Fill(getX(e), getW(e));
+      ref1v.Fill(getX(e) + 1., getW(e));
+      ref2w.Fill(getX(e), getY(e), getW(e));
+      ref3.Fill(getX(e), getY(e), getZ(e));
+   }
+
+   CheckSameHistos(*h1, ref1);
+   CheckSameHistos(*h1w, ref1w);
+   CheckSameHistos(*h1v, ref1v);
+   CheckSameHistos(*h2w, ref2w);
+   CheckSameHistos(*h3, ref3);
+}
+
+#ifdef R__USE_IMT
+// Large histograms can be filled by all slots into one shared histogram, check that the results are the same as with
+// per-slot copies
+TEST(RDataFrameHisto, SharedFill)
+{
+   ROOT::EnableImplicitMT(4);
+   const auto n = 100000u;
+   auto getX = [](ULong64_t e) { return (e % 37) * 0.4 - 2.; };
+   auto getY = [](ULong64_t e) { return (e % 23) * 0.5 - 1.; };
+   auto getZ = [](ULong64_t e) { return (e % 11) * 1.1 - 0.5; };
+   auto getW = [](ULong64_t e) { return 0.5 + e % 3; };
+   ROOT::RDataFrame df(n);
+   ROOT::RDF::Experimental::EnableSharedHistogramFilling(df, 100);
+   auto d = df.Define("x", getX, {"rdfentry_"})
+               .Define("y", getY, {"rdfentry_"})
+               .Define("z", getZ, {"rdfentry_"})
+               .Define("w", getW, {"rdfentry_"});
+
+   auto h1w = d.Histo1D<double, double>({"h1w", "h1w", 200, 0., 10.}, "x", "w");
+   auto h3 = d.Histo3D<double, double, double>({"h3", "h3", 10, 0., 10., 5, 0., 10., 4, 0., 10.}, "x", "y", "z");
+   // too small to be shared
+   auto h2w = d.Histo2D<double, double, double>({"h2w", "h2w", 5, 0., 10., 5, 0., 10.}, "x", "y", "w");
+
+   TH1D ref1w("ref1w", "ref1w", 200, 0., 10.);
+   TH2D ref2w("ref2w", "ref2w", 5, 0., 10., 5, 0., 10.);
+   TH3D ref3("ref3", "ref3", 10, 0., 10., 5, 0., 10., 4, 0., 10.);
+   for (ULong64_t e = 0; e < n; ++e) {
+      ref1w.Fill(getX(e), getW(e));
+      ref2w.Fill(getX(e), getY(e), getW(e));
+      ref3.Fill(getX(e), getY(e), getZ(e));
+   }
+
+   // the weights are exact in binary, so the bin contents do not depend on the order of the fills; the statistics do
+   auto checkClose = [](const TH1 &h, const TH1 &ref) {
+      ASSERT_EQ(ref.GetNcells(), h.GetNcells());
+      for (int bin = 0; bin < ref.GetNcells(); ++bin) {
+         EXPECT_DOUBLE_EQ(ref.GetBinContent(bin), h.GetBinContent(bin));
+         EXPECT_DOUBLE_EQ(ref.GetBinError(bin), h.GetBinError(bin));
+      }
+      EXPECT_DOUBLE_EQ(ref.GetEntries(), h.GetEntries());
+      double stats[TH1::kNstat] = {};
+      double refStats[TH1::kNstat] = {};
+      h.GetStats(stats);
+      ref.GetStats(refStats);
+      for (int i = 0; i < TH1::kNstat; ++i)
+         EXPECT_NEAR(refStats[i], stats[i], 1e-9 * std::abs(refStats[i]));
+   };
+   checkClose(*h1w, ref1w);
+   checkClose(*h2w, ref2w);
+   checkClose(*h3, ref3);
+
+   ROOT::DisableImplicitMT();
+}
+
+// The histograms of the slots are created by the threads that fill them; slots which are never used have none
+TEST(RDataFrameHisto, FewerTasksThanSlots)
+{
+   ROOT::EnableImplicitMT(4);
+   ROOT::RDataFrame df(3);
+   auto d = df.Define("x", [](ULong64_t e) { return e * 1.; }, {"rdfentry_"});
+   auto h = d.Histo1D<double>({"h", "h", 10, 0., 10.}, "x");
+   auto stat = d.Fill<double>(TStatistic(), {"x"});
+   EXPECT_EQ(3., h->GetEntries());
+   EXPECT_DOUBLE_EQ(1., h->GetMean());
+   EXPECT_EQ(1., h->GetBinContent(3));
+   EXPECT_EQ(3, stat->GetN());
+   EXPECT_DOUBLE_EQ(1., stat->GetMean());
+   ROOT::DisableImplicitMT();
+}
+#endif // R__USE_IMT
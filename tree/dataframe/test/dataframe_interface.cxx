@@ -877,3 +877,24 @@ TEST(RDataFrameUtils, RegexWithFriendsInJittedFilters)
    EXPECT_EQ(df.Filter("fr.x < 0 && x > 0").Count().GetValue(), 1);
    EXPECT_EQ(df.Filter("x > 0 && fr.x < 0").Count().GetValue(), 1);
 }
+
+TEST(RDataFrameInterface, DisableJitting)
+{
+   ROOT::RDataFrame df(10);
+   ROOT::RDF::Experimental::DisableJitting(df);
+   auto dfx = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"});
+
+   EXPECT_THROW(dfx.Filter("x > 2"), std::logic_error);
+   EXPECT_THROW(dfx.Define("y", "x * 2"), std::logic_error);
+   EXPECT_THROW(dfx.Vary("x", "ROOT::RVecD{x - 1, x + 1}", 2, "v"), std::logic_error);
+   EXPECT_THROW(dfx.Mean("x"), std::logic_error);
+
+   auto sum = dfx.Filter([](double x) { return x > 2; }, {"x"}).Sum<double>("x");
+   EXPECT_DOUBLE_EQ(42., *sum);
+
+   // graphs that already contain jitted operations cannot disable jitting
+   ROOT::RDataFrame df2(1);
+   auto m = df2.Define("x", "42").Max("x");
+   EXPECT_THROW(ROOT::RDF::Experimental::DisableJitting(df2), std::logic_error);
+   EXPECT_EQ(42, *m);
+}
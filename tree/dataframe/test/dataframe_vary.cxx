@@ -1619,6 +1619,45 @@ TEST_P(RDFVary, ManyVariationsManyColumns)
    }
 }
 
+// Filters that do not depend on a variation are shared by the nominal and varied results
+TEST_P(RDFVary, SharedAndVariedFilters)
+{
+   std::atomic_uint nCalls{0u};
+   auto d = ROOT::RDataFrame(10)
+               .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+               .Define("y", [](ULong64_t e) { return int(e % 2); }, {"rdfentry_"})
+               .Vary(
+                  "x",
+                  [](int x) {
+                     ROOT::RVecI shifted(20);
+                     for (int i = 0; i < 20; ++i)
+                        shifted[i] = x + i;
+                     return shifted;
+                  },
+                  {"x"}, 20, "shift")
+               .Filter(
+                  [&nCalls](int y) {
+                     ++nCalls;
+                     return y == 0;
+                  },
+                  {"y"})
+               .Filter([](int x) { return x < 10; }, {"x"});
+
+   auto sx = d.Sum<int>("x");
+   auto sxs = VariationsFor(sx);
+
+   // x is one of 0, 2, 4, 6, 8, shifted by i, and kept if below 10
+   for (int i = 0; i < 20; ++i) {
+      int expected = 0;
+      for (int x = 0; x < 10; x += 2)
+         expected += x + i < 10 ? x + i : 0;
+      EXPECT_EQ(sxs["shift:" + std::to_string(i)], expected) << "shift:" << i;
+   }
+   EXPECT_EQ(sxs["nominal"], 20);
+   // the filter on y ran once per entry, not once per variation
+   EXPECT_EQ(nCalls, 10u);
+}
+
 struct HelperWithCallback : ROOT::Detail::RDF::RActionImpl<HelperWithCallback> {
    using Result_t = int;
    std::shared_ptr<Result_t> fResult = std::make_shared<Result_t>(0);
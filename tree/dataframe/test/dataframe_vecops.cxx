@@ -131,3 +131,24 @@ TEST(RDFAndVecOps, RVecBool)
    gSystem->Unlink(filename);
 }
 
+
+TEST(RDFAndVecOps, RVecArenas)
+{
+   ROOT::RDataFrame df(100);
+   ROOT::RDF::Experimental::EnableRVecArenas(df);
+   auto dfv = df.Define("v", [](ULong64_t e) { return RVec<double>(100 + e % 7, double(e)); }, {"rdfentry_"})
+                 .Filter([](const RVec<double> &v) { return Sum(v * v) > 0.; }, {"v"})
+                 .Define("w", [](const RVec<double> &v) { return v[v > 10.] * 2.; }, {"v"})
+                 .Define("s", [](const RVec<double> &w) { return Sum(w); }, {"w"});
+   auto sums = dfv.Take<double>("s");
+   // the values taken are copies of the ones in the arenas, which are reused by the following entries
+   auto ws = dfv.Take<RVec<double>>("w");
+   ASSERT_EQ(sums->size(), 99u);
+   ASSERT_EQ(ws->size(), 99u);
+   for (auto i = 0u; i < 99u; ++i) {
+      const auto e = i + 1;
+      const auto expected = e > 10 ? 2. * e * (100 + e % 7) : 0.;
+      EXPECT_DOUBLE_EQ((*sums)[i], expected);
+      EXPECT_DOUBLE_EQ(Sum((*ws)[i]), expected);
+   }
+}
@@ -8,6 +8,8 @@
 #pragma GCC diagnostic ignored "-Wshadow"
 #endif
 #include <arrow/builder.h>
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
 #include <arrow/memory_pool.h>
 #include <arrow/record_batch.h>
 #include <arrow/table.h>
@@ -18,6 +20,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
 #include <iostream>
 using namespace arrow;
 
@@ -134,6 +137,19 @@ std::shared_ptr<Table> createTestTable()
    return table_;
 }
 
+// The test table, split in chunks of two entries
+std::shared_ptr<Table> createChunkedTestTable()
+{
+   auto table = createTestTable();
+   std::vector<std::shared_ptr<ChunkedArray>> columns;
+   for (int i = 0; i < table->num_columns(); ++i) {
+      auto array = table->column(i)->chunk(0);
+      columns.emplace_back(std::make_shared<ChunkedArray>(
+         ArrayVector{array->Slice(0, 2), array->Slice(2, 2), array->Slice(4, 2)}));
+   }
+   return Table::Make(table->schema(), columns);
+}
+
 TEST(RArrowDS, ColTypeNames)
 {
    RArrowDS tds(createTestTable(), {"Name", "Age", "Height", "Married", "Babies"});
@@ -226,6 +242,62 @@ TEST(RArrowDS, ColumnReadersString)
    }
 }
 
+TEST(RArrowDS, ChunkedEntryRanges)
+{
+   RArrowDS tds(createChunkedTestTable(), {});
+   tds.SetNSlots(2U);
+   auto valsAge = tds.GetColumnReaders<Long64_t>("Age");
+   auto valsHeight = tds.GetColumnReaders<double>("Height");
+   tds.Initialize();
+
+   // one range per chunk
+   auto ranges = tds.GetEntryRanges();
+   ASSERT_EQ(3U, ranges.size());
+   for (auto i : ROOT::TSeqU(3)) {
+      EXPECT_EQ(2U * i, ranges[i].first);
+      EXPECT_EQ(2U * i + 2, ranges[i].second);
+   }
+
+   std::vector<Long64_t> refsAge = {64, 50, 40, 30, 2, 0};
+   std::vector<double> refsHeight = {180.0, 200.5, 1.7, 1.9, 1.0, 0.8};
+   for (auto &&range : ranges) {
+      tds.InitSlot(1U, range.first);
+      for (auto i : ROOT::TSeq<int>(range.first, range.second)) {
+         tds.SetEntry(1U, i);
+         EXPECT_EQ(refsAge[i], **valsAge[1]);
+         EXPECT_DOUBLE_EQ(refsHeight[i], **valsHeight[1]);
+      }
+   }
+}
+
+TEST(RArrowDS, FromArrowIPC)
+{
+   const auto fileName = "RArrowDS_test_ipc.arrow";
+   {
+      auto table = createChunkedTestTable();
+      auto stream = io::FileOutputStream::Open(fileName);
+      ASSERT_OK(stream.status());
+      auto writer = ipc::MakeFileWriter(*stream, table->schema());
+      ASSERT_OK(writer.status());
+      ASSERT_OK((*writer)->WriteTable(*table));
+      ASSERT_OK((*writer)->Close());
+      ASSERT_OK((*stream)->Close());
+   }
+
+   auto rdf = FromArrowIPC(fileName, {});
+   auto c = rdf.Count();
+   auto sumAge = rdf.Sum<Long64_t>("Age");
+   auto max = rdf.Max<double>("Height");
+   auto nMarried = rdf.Filter([](bool m) { return m; }, {"Married"}).Count();
+
+   EXPECT_EQ(6U, *c);
+   EXPECT_EQ(186, *sumAge);
+   EXPECT_DOUBLE_EQ(200.5, *max);
+   EXPECT_EQ(3U, *nMarried);
+
+   std::remove(fileName);
+}
+
 #ifndef NDEBUG
 
 TEST(RArrowDS, SetNSlotsTwice)
@@ -6,6 +6,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
+
 using namespace ROOT::RDF;
 
 auto fileName0 = "RCsvDS_test_headers.csv";
@@ -320,6 +323,34 @@ TEST(RCsvDS, ProgressiveReadingRDFMT)
    EXPECT_EQ(6U, *c2);
 }
 
+// Chunks that are large enough to be parsed by several tasks
+TEST(RCsvDS, ParallelParsingMT)
+{
+   const auto fileName = "RCsvDS_test_parallel.csv";
+   const int nLines = 20000;
+   {
+      std::ofstream f(fileName);
+      f << "i,x,b,s\n";
+      for (int i = 0; i < nLines; ++i)
+         f << i << ',' << i * 0.5 << ',' << (i % 2 ? "true" : "false") << ",\"s" << i << "\"\n";
+   }
+
+   for (auto chunkSize : {-1LL, 5000LL}) {
+      auto df = ROOT::RDF::FromCSV(fileName, true, ',', chunkSize);
+      auto sumI = df.Sum<Long64_t>("i");
+      auto sumX = df.Sum<double>("x");
+      auto nTrue = df.Filter([](bool b) { return b; }, {"b"}).Count();
+      auto nMatching =
+         df.Filter([](Long64_t i, const std::string &s) { return s == "s" + std::to_string(i); }, {"i", "s"}).Count();
+      EXPECT_EQ(Long64_t(nLines) * (nLines - 1) / 2, *sumI);
+      EXPECT_DOUBLE_EQ(0.5 * nLines * (nLines - 1) / 2, *sumX);
+      EXPECT_EQ(ULong64_t(nLines / 2), *nTrue);
+      EXPECT_EQ(ULong64_t(nLines), *nMatching);
+   }
+
+   std::remove(fileName);
+}
+
 TEST(RCsvDS, SpecifyColumnTypes)
 {
    RCsvDS tds0(fileName0, true, ',', -1LL, {{"Age", 'D'}, {"Name", 'T'}}); // with headers
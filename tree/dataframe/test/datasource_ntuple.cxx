@@ -99,6 +99,234 @@ TEST_F(RNTupleDSTest, CardinalityColumn)
    EXPECT_EQ(3, *max_rvec2);
 }
 
+TEST(RNTupleDS, ValueRangeHint)
+{
+   const std::string fileName = "RNTupleDS_test_valuerange.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      model->MakeField<std::vector<float>>("jets");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetHasValueRanges(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      for (int c = 0; c < 4; ++c) {
+         for (int i = 0; i < 10; ++i) {
+            *fldPt = 10 * c + i;
+            ntuple->Fill();
+         }
+         ntuple->CommitCluster();
+      }
+   }
+
+   auto ds = std::make_unique<RNTupleDS>(RPageSource::Create("ntuple", fileName));
+   ds->AddValueRangeHint("pt", 15.0, 25.0);
+   EXPECT_THROW(ds->AddValueRangeHint("jets", 0.0, 1.0), ROOT::Experimental::RException);
+   EXPECT_THROW(ds->AddValueRangeHint("R_rdf_sizeof_jets", 0.0, 1.0), ROOT::Experimental::RException);
+   ROOT::RDataFrame df(std::move(ds));
+   // Only the second and the third cluster are read
+   EXPECT_EQ(20ull, *df.Count());
+   EXPECT_EQ(11ull, *df.Filter([](float pt) { return pt >= 15.f && pt <= 25.f; }, {"pt"}).Count());
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, PredicatePushdown)
+{
+   const std::string fileName = "RNTupleDS_test_pushdown.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      options.SetHasValueRanges(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      for (int c = 0; c < 4; ++c) {
+         for (int i = 0; i < 10; ++i) {
+            *fldPt = 10 * c + i;
+            ntuple->Fill();
+         }
+         ntuple->CommitCluster();
+      }
+   }
+
+   auto df = ROOT::RDF::Experimental::FromRNTuple("ntuple", fileName);
+   unsigned int nEntriesRead = 0;
+   auto counted = df.Filter(
+      [&nEntriesRead](float) {
+         ++nEntriesRead;
+         return true;
+      },
+      {"pt"});
+
+   // Only the last two clusters can contain entries with pt > 25
+   EXPECT_EQ(14ull, *counted.Filter("pt > 25").Count());
+   EXPECT_EQ(20u, nEntriesRead);
+
+   nEntriesRead = 0;
+   EXPECT_EQ(14ull, *counted.Filter("25 < pt && pt <= 100").Count());
+   EXPECT_EQ(20u, nEntriesRead);
+
+   // Expressions that are not conjunctions of simple comparisons are not pushed down
+   nEntriesRead = 0;
+   EXPECT_EQ(14ull, *counted.Filter("pt > 25 || pt < -1").Count());
+   EXPECT_EQ(40u, nEntriesRead);
+
+   // Predicates are only pushed down if all actions depend on them
+   nEntriesRead = 0;
+   auto c1 = counted.Filter("pt > 25").Count();
+   auto c2 = counted.Filter("pt < 5").Count();
+   EXPECT_EQ(14ull, *c1);
+   EXPECT_EQ(5ull, *c2);
+   EXPECT_EQ(40u, nEntriesRead);
+
+   // Named filters report on all entries
+   nEntriesRead = 0;
+   EXPECT_EQ(14ull, *counted.Filter("pt > 25", "ptCut").Count());
+   EXPECT_EQ(40u, nEntriesRead);
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, BulkProcessing)
+{
+   const std::string fileName = "RNTupleDS_test_bulk.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto fldJets = model->MakeField<std::vector<float>>("jets");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName);
+      for (int i = 0; i < 1000; ++i) {
+         *fldPt = i;
+         fldJets->assign(i % 3, i);
+         ntuple->Fill();
+         // Clusters of 37 entries, such that some bulks straddle cluster boundaries
+         if (i % 37 == 36)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto runGraph = [&fileName](unsigned int bulkSize) {
+      auto df = ROOT::RDF::Experimental::FromRNTuple("ntuple", fileName);
+      ROOT::RDF::Experimental::EnableBulkProcessing(df, bulkSize);
+      auto filtered = df.Filter([](float pt) { return pt > 100.f; }, {"pt"}, "ptCut")
+                         .Filter([](const ROOT::RVecF &jets) { return jets.size() > 1; }, {"jets"}, "jetsCut");
+      auto sumPt = filtered.Sum<float>("pt");
+      auto takePt = filtered.Take<float>("pt");
+      auto sumJets = filtered.Sum<ROOT::RVecF>("jets");
+      // Actions and filters that read Defines process the entries one by one
+      auto sumDefine = filtered.Define("twicePt", [](float pt) { return 2 * pt; }, {"pt"}).Sum<float>("twicePt");
+      auto report = df.Report();
+
+      std::vector<std::string> results;
+      results.emplace_back(std::to_string(*sumPt));
+      results.emplace_back(std::to_string(*sumJets));
+      results.emplace_back(std::to_string(*sumDefine));
+      results.emplace_back(std::to_string(takePt->size()));
+      for (auto &&cut : *report)
+         results.emplace_back(cut.GetName() + std::to_string(cut.GetPass()) + "/" + std::to_string(cut.GetAll()));
+      EXPECT_EQ(1U, df.GetNRuns());
+      return results;
+   };
+
+   const auto expected = runGraph(0);
+   EXPECT_EQ(6U, expected.size());
+   EXPECT_EQ("ptCut899/1000", expected[4]);
+   EXPECT_EQ(expected, runGraph(16));
+   EXPECT_EQ(expected, runGraph(1000));
+
+   std::remove(fileName.c_str());
+}
+
+namespace {
+// Callables that also evaluate whole bulks, counting the calls of both kinds
+struct BulkPtCut {
+   int *fNBulkCalls;
+   bool operator()(float pt) const { return pt > 100.f; }
+   void CallBulk(std::size_t size, const bool *, bool *results, const float *pt) const
+   {
+      ++*fNBulkCalls;
+      for (std::size_t i = 0; i < size; ++i)
+         results[i] = pt[i] > 100.f;
+   }
+};
+
+struct BulkTwice {
+   int *fNBulkCalls;
+   double operator()(float pt) const { return 2. * pt; }
+   void CallBulk(std::size_t size, const bool *, double *results, const float *pt) const
+   {
+      ++*fNBulkCalls;
+      for (std::size_t i = 0; i < size; ++i)
+         results[i] = 2. * pt[i];
+   }
+};
+} // namespace
+
+TEST(RNTupleDS, BulkCallables)
+{
+   const std::string fileName = "RNTupleDS_test_bulk_callables.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto fldPt = model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName);
+      for (int i = 0; i < 1000; ++i) {
+         *fldPt = i;
+         ntuple->Fill();
+         if (i % 37 == 36)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto runGraph = [&fileName](unsigned int bulkSize, int &nBulkCalls) {
+      auto df = ROOT::RDF::Experimental::FromRNTuple("ntuple", fileName);
+      ROOT::RDF::Experimental::EnableBulkProcessing(df, bulkSize);
+      // the Sum reads a Define, so there are no bulk actions: the bulk callables still evaluate the bulks
+      auto filtered = df.Filter(BulkPtCut{&nBulkCalls}, {"pt"}, "ptCut");
+      auto sum = filtered.Define("twicePt", BulkTwice{&nBulkCalls}, {"pt"}).Sum<double>("twicePt");
+      auto report = df.Report();
+      return std::to_string(*sum) + " " + std::to_string(report->At("ptCut").GetPass());
+   };
+
+   int nBulkCalls = 0;
+   const auto expected = runGraph(0, nBulkCalls);
+   EXPECT_EQ(0, nBulkCalls);
+   EXPECT_EQ(std::to_string(2. * (999. * 1000. / 2. - 100. * 101. / 2.)) + " 899", expected);
+   EXPECT_EQ(expected, runGraph(16, nBulkCalls));
+   // bulks straddling cluster boundaries are evaluated entry by entry
+   EXPECT_GT(nBulkCalls, 0);
+
+   std::remove(fileName.c_str());
+}
+
+void SnapshotTest(const std::string &fname)
+{
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   opts.fApproxZippedClusterSize = 1024;
+   auto df = ROOT::RDataFrame(1000)
+                .Define("x", [](ULong64_t e) { return float(e); }, {"rdfentry_"})
+                .Define("v", [](ULong64_t e) { return ROOT::RVecI(e % 3, int(e)); }, {"rdfentry_"});
+   // A typed and a jitted Snapshot
+   auto snap = df.Snapshot<float, ROOT::RVecI>("ntuple", fname, {"x", "v"}, opts);
+   EXPECT_DOUBLE_EQ(999. * 1000. / 2., snap->Sum<float>("x").GetValue());
+   EXPECT_EQ(1000U, *snap->Count());
+   EXPECT_EQ(999U, *snap->Define("n", "v.size()").Sum<std::size_t>("n"));
+
+   const auto jittedFname = "jitted_" + fname;
+   auto jittedSnap = df.Filter("x < 500").Snapshot("ntuple", jittedFname, {"x"}, opts);
+   EXPECT_EQ(500U, *jittedSnap->Count());
+   EXPECT_EQ(std::vector<std::string>{"x"}, jittedSnap->GetColumnNames());
+
+   opts.fMode = "UPDATE";
+   EXPECT_THROW(df.Snapshot<float>("ntuple", fname, {"x"}, opts), std::invalid_argument);
+   std::remove(fname.c_str());
+   std::remove(jittedFname.c_str());
+}
+
+TEST(RNTupleDS, Snapshot)
+{
+   SnapshotTest("RNTupleDS_test_snapshot.root");
+}
+
 void ReadTest(const std::string &name, const std::string &fname) {
    auto df = ROOT::RDF::Experimental::FromRNTuple(name, fname);
 
@@ -147,6 +375,78 @@ TEST_F(RNTupleDSTest, Read)
    ReadTest(fNtplName, fFileName);
 }
 
+/// Writes an ntuple with `pt` running from `first` in clusters of 10 entries, with value ranges
+static void WriteMultiFileNTuple(const std::string &fileName, int first, int nEntries)
+{
+   auto model = RNTupleModel::Create();
+   auto fldPt = model->MakeField<float>("pt");
+   auto fldJets = model->MakeField<std::vector<float>>("jets");
+   ROOT::Experimental::RNTupleWriteOptions options;
+   options.SetHasValueRanges(true);
+   auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+   for (int i = 0; i < nEntries; ++i) {
+      *fldPt = first + i;
+      *fldJets = std::vector<float>(i % 3, 1.f);
+      ntuple->Fill();
+      if (i % 10 == 9)
+         ntuple->CommitCluster();
+   }
+}
+
+static void MultiFileTest(const std::vector<std::string> &fileNames)
+{
+   auto df = ROOT::RDF::Experimental::FromRNTuple("ntuple", fileNames);
+   // 0..29, 30..49 and 50..84
+   EXPECT_EQ(85ull, *df.Count());
+   EXPECT_EQ(84. * 85 / 2, *df.Sum<float>("pt"));
+   EXPECT_EQ(30ull + 19 + 34, *df.Sum<std::size_t>("R_rdf_sizeof_jets"));
+   EXPECT_EQ(0.f, *df.Min<float>("pt"));
+   EXPECT_EQ(84.f, *df.Max<float>("pt"));
+
+   auto ds = std::make_unique<RNTupleDS>("ntuple", fileNames);
+   // Selects the last cluster of the first file and the first cluster of the second file
+   ds->AddValueRangeHint("pt", 25.0, 35.0);
+   ROOT::RDataFrame dfHint(std::move(ds));
+   EXPECT_EQ(20ull, *dfHint.Count());
+   EXPECT_EQ(20. * 29.5, *dfHint.Sum<float>("pt"));
+}
+
+struct MultiFileRAII {
+   std::vector<std::string> fFileNames{"RNTupleDS_test_multi1.root", "RNTupleDS_test_multi2.root",
+                                       "RNTupleDS_test_multi3.root"};
+   MultiFileRAII()
+   {
+      WriteMultiFileNTuple(fFileNames[0], 0, 30);
+      WriteMultiFileNTuple(fFileNames[1], 30, 20);
+      WriteMultiFileNTuple(fFileNames[2], 50, 35);
+   }
+   ~MultiFileRAII()
+   {
+      for (const auto &f : fFileNames)
+         std::remove(f.c_str());
+   }
+};
+
+TEST(RNTupleDS, MultiFile)
+{
+   MultiFileRAII files;
+   MultiFileTest(files.fFileNames);
+
+   const std::string otherFileName = "RNTupleDS_test_multi_other.root";
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<double>("pt");
+      RNTupleWriter::Recreate(std::move(model), "ntuple", otherFileName)->Fill();
+   }
+   try {
+      RNTupleDS ds("ntuple", {files.fFileNames[0], otherFileName});
+      FAIL() << "files with different schemas should throw";
+   } catch (const ROOT::Experimental::RException &err) {
+      EXPECT_NE(std::string(err.what()).find("schema"), std::string::npos);
+   }
+   std::remove(otherFileName.c_str());
+}
+
 #ifdef R__USE_IMT
 struct IMTRAII {
    IMTRAII() { ROOT::EnableImplicitMT(); }
@@ -159,4 +459,18 @@ TEST_F(RNTupleDSTest, ReadMT)
 
    ReadTest(fNtplName, fFileName);
 }
+
+TEST(RNTupleDS, SnapshotMT)
+{
+   IMTRAII _;
+
+   SnapshotTest("RNTupleDS_test_snapshot_mt.root");
+}
+TEST(RNTupleDS, MultiFileMT)
+{
+   IMTRAII _;
+   MultiFileRAII files;
+
+   MultiFileTest(files.fFileNames);
+}
 #endif
@@ -0,0 +1,87 @@
+#include <ROOT/RCsvDS.hxx>
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RPrefetchDS.hxx>
+#include <ROOT/RTrivialDS.hxx>
+#include <TROOT.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ROOT::RDF;
+using ROOT::RDF::Experimental::FromPrefetchedSource;
+using ROOT::RDF::Experimental::RPrefetchDS;
+
+namespace {
+auto fileName0 = "RCsvDS_test_headers.csv";
+} // anonymous namespace
+
+TEST(RPrefetchDS, ForwardsColumnInfo)
+{
+   RPrefetchDS ds(std::make_unique<RCsvDS>(fileName0));
+   ds.SetNSlots(1);
+   EXPECT_EQ(5U, ds.GetColumnNames().size());
+   EXPECT_TRUE(ds.HasColumn("Age"));
+   EXPECT_FALSE(ds.HasColumn("Weight"));
+   EXPECT_EQ("Long64_t", ds.GetTypeName("Age"));
+   EXPECT_EQ("std::string", ds.GetTypeName("Name"));
+   EXPECT_THROW(ds.GetColumnReaders<double>("Age"), std::runtime_error);
+   EXPECT_THROW(RPrefetchDS(nullptr), std::invalid_argument);
+}
+
+TEST(RPrefetchDS, CSV)
+{
+   for (auto chunkSize : {-1LL, 2LL, 4LL}) {
+      auto df = FromPrefetchedSource(std::make_unique<RCsvDS>(fileName0, true, ',', chunkSize), 1);
+      auto names = df.Take<std::string>("Name");
+      auto ages = df.Take<Long64_t>("Age");
+      auto married = df.Filter([](bool m) { return m; }, {"Married"}).Count();
+      auto maxHeight = df.Max<double>("Height");
+
+      auto ref = ROOT::RDF::FromCSV(fileName0, true, ',', chunkSize);
+      EXPECT_EQ(*ref.Take<std::string>("Name"), *names);
+      EXPECT_EQ(*ref.Take<Long64_t>("Age"), *ages);
+      EXPECT_EQ(3U, *married);
+      EXPECT_DOUBLE_EQ(200.5, *maxHeight);
+
+      // the columns are read again in a second event loop
+      EXPECT_EQ(6U, *df.Count());
+      EXPECT_EQ(*ages, *df.Take<Long64_t>("Age"));
+   }
+}
+
+TEST(RPrefetchDS, SkippedEntries)
+{
+   auto df = FromPrefetchedSource(std::make_unique<RTrivialDS>(10, /*skipEvenEntries=*/true));
+   auto values = df.Take<ULong64_t>("col0");
+   EXPECT_EQ(std::vector<ULong64_t>({1, 3, 5, 7, 9}), *values);
+}
+
+TEST(RPrefetchDS, StopEarly)
+{
+   // the wrapped source is infinite: the background thread must stop when the event loop ends
+   auto df = FromPrefetchedSource(std::make_unique<RTrivialDS>());
+   auto values = df.Range(25).Take<ULong64_t>("col0");
+   ASSERT_EQ(25U, values->size());
+   for (ULong64_t i = 0; i < 10; ++i)
+      EXPECT_EQ(i, (*values)[i]);
+}
+
+#ifdef R__USE_IMT
+TEST(RPrefetchDS, CSVMT)
+{
+   ROOT::EnableImplicitMT(4);
+   auto df = FromPrefetchedSource(std::make_unique<RCsvDS>(fileName0, true, ',', 4LL));
+   auto sumAge = df.Sum<Long64_t>("Age");
+   auto count = df.Filter("Height > 180").Count();
+   EXPECT_EQ(180, *sumAge);
+   EXPECT_EQ(2U, *count);
+
+   auto trivial = FromPrefetchedSource(std::make_unique<RTrivialDS>(1000));
+   EXPECT_EQ(499500ULL, *trivial.Sum<ULong64_t>("col0"));
+   ROOT::DisableImplicitMT();
+}
+#endif // R__USE_IMT
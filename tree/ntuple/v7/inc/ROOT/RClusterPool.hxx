@@ -17,9 +17,12 @@
 #define ROOT7_RClusterPool
 
 #include <ROOT/RCluster.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -50,6 +53,13 @@ the unzip thread is supposed to submit multi-threaded, CPU heavy work to the app
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threadin
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
 compressed pages and the page source has to uncompresses pages at a later point when data from the page is requested.
+
+The I/O thread can combine several cluster bunches in a single call to RPageSource::LoadClusters(). Page sources
+that submit vector reads asynchronously can then keep a large number of read requests in flight.
+
+The RClusterCachePolicy can widen the look-ahead window, keep clusters of a look-back window, and impose a budget on
+the bytes on storage of the clusters in the pool and in flight.  The pool counts cache hits, misses, and evictions
+in its metrics, which are observed by the metrics of the page source.
 */
 // clang-format on
 class RClusterPool {
@@ -78,6 +88,8 @@ private:
       /// By the time a cluster has been loaded, this cluster might not be necessary anymore. This can happen if
       /// there are jumps in the access pattern (i.e. the access pattern deviates from linear access).
       bool fIsExpired = false;
+      /// The estimated number of bytes on storage of the requested pages, used for the byte budget
+      std::uint64_t fNBytesOnStorage = 0;
 
       bool operator ==(const RInFlightCluster &other) const {
          return (fClusterKey.fClusterId == other.fClusterKey.fClusterId) &&
@@ -92,10 +104,18 @@ private:
    /// (GetCluster()) and is used for implementing the I/O and cluster memory allocation (PageSource::LoadClusters()).
    RPageSource &fPageSource;
    /// The number of clusters before the currently active cluster that should stay in the pool if present
-   /// Reserved for later use.
    unsigned int fWindowPre = 0;
+   /// The number of clusters, starting at the currently active cluster, that should be made available
+   unsigned int fWindowPost;
+   /// The maximum number of bytes on storage in the pool and in flight; zero means unlimited
+   std::uint64_t fMaxInFlightBytes = 0;
    /// The number of clusters that are being read in a single vector read.
    unsigned int fClusterBunchSize;
+   /// The maximum number of cluster bunches that the I/O thread combines into a single call to
+   /// RPageSource::LoadClusters(). Together with fClusterBunchSize, this determines the look-ahead window.
+   /// Storage backends that submit the read requests asynchronously (e.g., io_uring) can then keep
+   /// many requests in flight at once.
+   unsigned int fMaxBunchesInFlight;
    /// Used as an ever-growing counter in GetCluster() to separate bunches of clusters from each other
    std::int64_t fBunchId = 0;
    /// The cache of clusters around the currently active cluster
@@ -126,6 +146,15 @@ private:
    /// schedules the unzipping of pages using the application's task scheduler.
    std::thread fThreadUnzip;
 
+   /// The cluster pool counters are observed by the page source metrics
+   RNTupleMetrics fMetrics;
+   struct RCounters {
+      RNTupleAtomicCounter &fNHit;
+      RNTupleAtomicCounter &fNMiss;
+      RNTupleAtomicCounter &fNEvict;
+   };
+   std::unique_ptr<RCounters> fCounters;
+
    /// Every cluster id has at most one corresponding RCluster pointer in the pool
    RCluster *FindInPool(DescriptorId_t clusterId) const;
    /// Returns an index of an unused element in fPool; callers of this function (GetCluster() and WaitFor())
@@ -140,10 +169,25 @@ private:
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
    /// Ideally, the function returns without blocking if the cluster is already in the pool.
    RCluster *WaitFor(DescriptorId_t clusterId, const RCluster::ColumnSet_t &physicalColumns);
+   /// Removes clusters from the pool until the clusters in the pool and in flight together with `nBytesRequired`
+   /// fit into the byte budget.  The cluster `clusterId` is never evicted.  Called with fLockWorkQueue held.
+   void EvictForBudget(DescriptorId_t clusterId, const RCluster::ColumnSet_t &physicalColumns,
+                       const std::vector<DescriptorId_t> &lookahead, std::uint64_t nBytesRequired,
+                       std::uint64_t &nBytesUsed);
 
 public:
    static constexpr unsigned int kDefaultClusterBunchSize = 1;
-   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize);
+   static constexpr unsigned int kDefaultMaxBunchesInFlight = 1;
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize, unsigned int maxBunchesInFlight,
+                const RClusterCachePolicy &policy);
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize, unsigned int maxBunchesInFlight)
+      : RClusterPool(pageSource, clusterBunchSize, maxBunchesInFlight, RClusterCachePolicy())
+   {
+   }
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
+      : RClusterPool(pageSource, clusterBunchSize, kDefaultMaxBunchesInFlight)
+   {
+   }
    explicit RClusterPool(RPageSource &pageSource) : RClusterPool(pageSource, kDefaultClusterBunchSize) {}
    RClusterPool(const RClusterPool &other) = delete;
    RClusterPool &operator =(const RClusterPool &other) = delete;
@@ -151,14 +195,16 @@ public:
 
    /// Returns the requested cluster either from the pool or, in case of a cache miss, lets the I/O thread load
    /// the cluster in the pool, blocks until done, and then returns it.  Triggers along the way the background loading
-   /// of the following fWindowPost number of clusters.  The returned cluster has at least all the pages of
-   /// `physicalColumns` and possibly pages of other columns, too.  If implicit multi-threading is turned on, the
-   /// uncompressed pages of the returned cluster are already pushed into the page pool associated with the page source
-   /// upon return. The cluster remains valid until the next call to GetCluster().
+   /// of the clusters of the look-ahead window, as far as the byte budget permits.  The returned cluster has at least
+   /// all the pages of `physicalColumns` and possibly pages of other columns, too.  If implicit multi-threading is
+   /// turned on, the uncompressed pages of the returned cluster are already pushed into the page pool associated with
+   /// the page source upon return. The cluster remains valid until the next call to GetCluster().
    RCluster *GetCluster(DescriptorId_t clusterId, const RCluster::ColumnSet_t &physicalColumns);
 
    /// Used by the unit tests to drain the queue of clusters to be preloaded
    void WaitForInFlightClusters();
+
+   RNTupleMetrics &GetMetrics() { return fMetrics; }
 }; // class RClusterPool
 
 } // namespace Detail
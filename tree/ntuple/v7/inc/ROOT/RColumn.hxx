@@ -88,6 +88,10 @@ private:
       fWritePage[fWritePageIdx].Reset(fNElements);
    }
 
+   /// Called when both write pages are empty.  If the write options ask for a target page size on storage,
+   /// the write pages are resized according to the compression ratio observed so far for this column.
+   void AdaptPageSize();
+
    /// When the main write page surpasses the 50% fill level, the (full) shadow write page gets flushed
    void FlushShadowWritePage() {
       auto otherIdx = 1 - fWritePageIdx;
@@ -104,7 +108,7 @@ public:
    static std::unique_ptr<RColumn> Create(const RColumnModel &model, std::uint32_t index)
    {
       auto column = std::unique_ptr<RColumn>(new RColumn(model, index));
-      column->fElement = RColumnElementBase::Generate<CppT>(model.GetType());
+      column->fElement = RColumnElementBase::Generate<CppT>(model);
       return column;
    }
 
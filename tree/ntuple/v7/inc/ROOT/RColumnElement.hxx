@@ -24,12 +24,16 @@
 #include <Byteswap.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstring> // for memcpy
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
+#include <utility>
 
 #ifndef R__LITTLE_ENDIAN
 #ifdef R__BYTESWAP
@@ -62,7 +66,7 @@ namespace {
 //
 //  - Delta/Zigzag + Splitting (there is no only-delta/zigzag encoding)
 //  - (Delta/Zigzag + ) Splitting + Casting
-//  - Everything + Byteswap
+//  - Everything + Byteswap (implicit for split encodings, which extract the little-endian bytes arithmetically)
 
 /// \brief Copy and byteswap `count` elements of size `N` from `source` to `destination`.
 ///
@@ -125,41 +129,77 @@ static void CastUnpack(void *destination, const void *source, std::size_t count)
    }
 }
 
-/// \brief Split encoding of elements, possibly into narrower column
+/// \brief Reinterpret the bits of a value as unsigned integer of the same size and back
+template <typename T>
+static typename RByteSwap<sizeof(T)>::value_type ToUIntBits(T value)
+{
+   typename RByteSwap<sizeof(T)>::value_type bits;
+   std::memcpy(&bits, &value, sizeof(T));
+   return bits;
+}
+
+template <typename T>
+static T FromUIntBits(typename RByteSwap<sizeof(T)>::value_type bits)
+{
+   T value;
+   std::memcpy(&value, &bits, sizeof(T));
+   return value;
+}
+
+/// \brief Write the little-endian bytes of `count` N-byte values into N consecutive byte streams
 ///
-/// Used to first cast and then split-encode in-memory values to the on-disk column. Swap bytes if necessary.
-template <typename DestT, typename SourceT>
-static void CastSplitPack(void *destination, const void *source, std::size_t count)
+/// `getBits(i)` returns the i-th value as unsigned integer.  The bytes are extracted arithmetically, so no byte swap
+/// is needed on big-endian architectures.  Every byte stream is written sequentially, which lets the compiler
+/// vectorize the inner loop.
+template <std::size_t N, typename GetBitsT>
+static void SplitBytes(void *destination, std::size_t count, GetBitsT getBits)
 {
-   constexpr std::size_t N = sizeof(DestT);
-   auto splitArray = reinterpret_cast<char *>(destination);
-   auto src = reinterpret_cast<const SourceT *>(source);
+   auto splitArray = reinterpret_cast<unsigned char *>(destination);
+   for (std::size_t b = 0; b < N; ++b) {
+      auto byteStream = splitArray + b * count;
+      for (std::size_t i = 0; i < count; ++i) {
+         byteStream[i] = static_cast<unsigned char>(getBits(i) >> (8 * b));
+      }
+   }
+}
+
+/// \brief Reverse SplitBytes(): assemble `count` N-byte unsigned integers from N byte streams
+///
+/// `setBits(i, bits)` receives the i-th value.  All byte streams are read sequentially.
+template <std::size_t N, typename SetBitsT>
+static void UnsplitBytes(const void *source, std::size_t count, SetBitsT setBits)
+{
+   using UIntT = typename RByteSwap<N>::value_type;
+   auto splitArray = reinterpret_cast<const unsigned char *>(source);
    for (std::size_t i = 0; i < count; ++i) {
-      DestT val = src[i];
-      ByteSwapIfNecessary(val);
+      UIntT bits = 0;
       for (std::size_t b = 0; b < N; ++b) {
-         splitArray[b * count + i] = reinterpret_cast<const char *>(&val)[b];
+         bits |= static_cast<UIntT>(static_cast<UIntT>(splitArray[b * count + i]) << (8 * b));
       }
+      setBits(i, bits);
    }
 }
 
+/// \brief Split encoding of elements, possibly into narrower column
+///
+/// Used to first cast and then split-encode in-memory values to the on-disk column.
+template <typename DestT, typename SourceT>
+static void CastSplitPack(void *destination, const void *source, std::size_t count)
+{
+   auto src = reinterpret_cast<const SourceT *>(source);
+   SplitBytes<sizeof(DestT)>(destination, count,
+                             [src](std::size_t i) { return ToUIntBits(static_cast<DestT>(src[i])); });
+}
+
 /// \brief Reverse split encoding of elements
 ///
-/// Used to first unsplit a column, possibly storing elements in wider C++ types. Swaps bytes if necessary
+/// Used to first unsplit a column, possibly storing elements in wider C++ types.
 template <typename DestT, typename SourceT>
 static void CastSplitUnpack(void *destination, const void *source, std::size_t count)
 {
-   constexpr std::size_t N = sizeof(SourceT);
    auto dst = reinterpret_cast<DestT *>(destination);
-   auto splitArray = reinterpret_cast<const char *>(source);
-   for (std::size_t i = 0; i < count; ++i) {
-      SourceT val = 0;
-      for (std::size_t b = 0; b < N; ++b) {
-         reinterpret_cast<char *>(&val)[b] = splitArray[b * count + i];
-      }
-      ByteSwapIfNecessary(val);
-      dst[i] = val;
-   }
+   UnsplitBytes<sizeof(SourceT)>(source, count,
+                                 [dst](std::size_t i, auto bits) { dst[i] = FromUIntBits<SourceT>(bits); });
 }
 
 /// \brief Packing of columns with delta + split encoding
@@ -168,16 +208,11 @@ static void CastSplitUnpack(void *destination, const void *source, std::size_t c
 template <typename DestT, typename SourceT>
 static void CastDeltaSplitPack(void *destination, const void *source, std::size_t count)
 {
-   constexpr std::size_t N = sizeof(DestT);
    auto src = reinterpret_cast<const SourceT *>(source);
-   auto splitArray = reinterpret_cast<char *>(destination);
-   for (std::size_t i = 0; i < count; ++i) {
+   SplitBytes<sizeof(DestT)>(destination, count, [src](std::size_t i) {
       DestT val = (i == 0) ? src[0] : src[i] - src[i - 1];
-      ByteSwapIfNecessary(val);
-      for (std::size_t b = 0; b < N; ++b) {
-         splitArray[b * count + i] = reinterpret_cast<char *>(&val)[b];
-      }
-   }
+      return ToUIntBits(val);
+   });
 }
 
 /// \brief Unsplit and unwind delta encoding
@@ -186,17 +221,11 @@ static void CastDeltaSplitPack(void *destination, const void *source, std::size_
 template <typename DestT, typename SourceT>
 static void CastDeltaSplitUnpack(void *destination, const void *source, std::size_t count)
 {
-   constexpr std::size_t N = sizeof(SourceT);
-   auto splitArray = reinterpret_cast<const char *>(source);
    auto dst = reinterpret_cast<DestT *>(destination);
-   for (std::size_t i = 0; i < count; ++i) {
-      SourceT val = 0;
-      for (std::size_t b = 0; b < N; ++b) {
-         reinterpret_cast<char *>(&val)[b] = splitArray[b * count + i];
-      }
-      ByteSwapIfNecessary(val);
+   UnsplitBytes<sizeof(SourceT)>(source, count, [dst](std::size_t i, auto bits) {
+      SourceT val = FromUIntBits<SourceT>(bits);
       dst[i] = (i == 0) ? val : dst[i - 1] + val;
-   }
+   });
 }
 
 /// \brief Packing of columns with zigzag + split encoding
@@ -207,16 +236,10 @@ static void CastZigzagSplitPack(void *destination, const void *source, std::size
 {
    using UDestT = std::make_unsigned_t<DestT>;
    constexpr std::size_t kNBitsDestT = sizeof(DestT) * 8;
-   constexpr std::size_t N = sizeof(DestT);
    auto src = reinterpret_cast<const SourceT *>(source);
-   auto splitArray = reinterpret_cast<char *>(destination);
-   for (std::size_t i = 0; i < count; ++i) {
-      UDestT val = (static_cast<DestT>(src[i]) << 1) ^ (static_cast<DestT>(src[i]) >> (kNBitsDestT - 1));
-      ByteSwapIfNecessary(val);
-      for (std::size_t b = 0; b < N; ++b) {
-         splitArray[b * count + i] = reinterpret_cast<char *>(&val)[b];
-      }
-   }
+   SplitBytes<sizeof(DestT)>(destination, count, [src](std::size_t i) {
+      return static_cast<UDestT>((static_cast<DestT>(src[i]) << 1) ^ (static_cast<DestT>(src[i]) >> (kNBitsDestT - 1)));
+   });
 }
 
 /// \brief Unsplit and unwind zigzag encoding
@@ -225,17 +248,139 @@ static void CastZigzagSplitPack(void *destination, const void *source, std::size
 template <typename DestT, typename SourceT>
 static void CastZigzagSplitUnpack(void *destination, const void *source, std::size_t count)
 {
-   using USourceT = std::make_unsigned_t<SourceT>;
-   constexpr std::size_t N = sizeof(SourceT);
-   auto splitArray = reinterpret_cast<const char *>(source);
    auto dst = reinterpret_cast<DestT *>(destination);
+   UnsplitBytes<sizeof(SourceT)>(source, count, [dst](std::size_t i, auto bits) {
+      dst[i] = static_cast<SourceT>((bits >> 1) ^ -(static_cast<SourceT>(bits) & 1));
+   });
+}
+
+/// \brief Find the smallest and largest of `count` in-memory values, converted to double
+///
+/// Used to collect the optional per-page value statistics.  NaN values are ignored.  For 64bit integers, the bounds
+/// are widened by one ulp so that the rounding to double cannot make the range narrower than the actual values.
+/// Returns false for non-arithmetic types, for characters (string payload), and if there is no value to compare.
+template <typename T>
+static bool FindValueRange(const void *source, std::size_t count, double &min, double &max)
+{
+   if constexpr (!std::is_arithmetic_v<T> || std::is_same_v<T, char>) {
+      return false;
+   } else {
+      auto src = reinterpret_cast<const T *>(source);
+      bool hasValue = false;
+      T lo{};
+      T hi{};
+      for (std::size_t i = 0; i < count; ++i) {
+         const T val = src[i];
+         if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(val))
+               continue;
+         }
+         if (!hasValue) {
+            lo = hi = val;
+            hasValue = true;
+            continue;
+         }
+         lo = std::min(lo, val);
+         hi = std::max(hi, val);
+      }
+      if (!hasValue)
+         return false;
+      min = static_cast<double>(lo);
+      max = static_cast<double>(hi);
+      if constexpr (std::is_integral_v<T> && (sizeof(T) > 4)) {
+         min = std::nextafter(min, -std::numeric_limits<double>::infinity());
+         max = std::nextafter(max, std::numeric_limits<double>::infinity());
+      }
+      return true;
+   }
+}
+
+/// \brief Convert a float to an IEEE 754 half precision float, rounding to the nearest even value
+///
+/// Values beyond the half precision range become infinity, tiny values become subnormals or zero.
+/// NaN payloads are not preserved but NaNs stay (quiet) NaNs.
+static std::uint16_t FloatToHalf(float value)
+{
+   const std::uint32_t bits = ToUIntBits(value);
+   const std::uint16_t sign = (bits >> 16) & 0x8000;
+   const std::uint32_t absBits = bits & 0x7fffffff;
+   if (absBits >= 0x7f800000) // infinity or NaN
+      return sign | 0x7c00 | ((absBits > 0x7f800000) ? 0x0200 : 0);
+   if (absBits >= 0x477ff000) // rounds to a value larger than the largest half (65504)
+      return sign | 0x7c00;
+   if (absBits < 0x38800000) {   // smaller than the smallest normal half (2^-14)
+      if (absBits <= 0x33000000) // rounds to zero (at most half of the smallest subnormal half, 2^-24)
+         return sign;
+      const std::uint32_t exponent = absBits >> 23;
+      const std::uint32_t mantissa = (absBits & 0x7fffff) | 0x800000;
+      const std::uint32_t shift = 126 - exponent;
+      std::uint32_t half = mantissa >> shift;
+      const std::uint32_t remainder = mantissa & ((1u << shift) - 1);
+      const std::uint32_t halfway = 1u << (shift - 1);
+      if ((remainder > halfway) || ((remainder == halfway) && (half & 1)))
+         half++;
+      return sign | half;
+   }
+   // Rebias the exponent from 127 to 15 and round the mantissa from 23 to 10 bits; a rounding carry correctly
+   // propagates into the exponent
+   const std::uint32_t rebiased = absBits - 0x38000000;
+   return sign | ((rebiased + 0xfff + ((rebiased >> 13) & 1)) >> 13);
+}
+
+/// \brief Convert an IEEE 754 half precision float to a float, which is exact
+static float HalfToFloat(std::uint16_t half)
+{
+   const std::uint32_t sign = static_cast<std::uint32_t>(half & 0x8000) << 16;
+   const std::uint32_t exponent = (half >> 10) & 0x1f;
+   const std::uint32_t mantissa = half & 0x3ff;
+   if (exponent == 0x1f)
+      return FromUIntBits<float>(sign | 0x7f800000 | (mantissa << 13));
+   if (exponent == 0) {
+      // Zero or subnormal: mantissa * 2^-24
+      const float value = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+      return sign ? -value : value;
+   }
+   return FromUIntBits<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+/// \brief Densely pack the lower `nBits` bits of `count` unsigned integers into a little-endian bit stream
+///
+/// `getBits(i)` returns the i-th value.  The destination buffer must provide `(count * nBits + 7) / 8` bytes.
+template <typename GetBitsT>
+static void PackBits(void *destination, std::size_t count, std::size_t nBits, GetBitsT getBits)
+{
+   auto bytes = reinterpret_cast<unsigned char *>(destination);
+   std::uint64_t accumulator = 0;
+   std::size_t nAccumulated = 0;
    for (std::size_t i = 0; i < count; ++i) {
-      USourceT val = 0;
-      for (std::size_t b = 0; b < N; ++b) {
-         reinterpret_cast<char *>(&val)[b] = splitArray[b * count + i];
+      accumulator |= static_cast<std::uint64_t>(getBits(i)) << nAccumulated;
+      nAccumulated += nBits;
+      while (nAccumulated >= 8) {
+         *bytes++ = static_cast<unsigned char>(accumulator);
+         accumulator >>= 8;
+         nAccumulated -= 8;
       }
-      ByteSwapIfNecessary(val);
-      dst[i] = static_cast<SourceT>((val >> 1) ^ -(static_cast<SourceT>(val) & 1));
+   }
+   if (nAccumulated > 0)
+      *bytes = static_cast<unsigned char>(accumulator);
+}
+
+/// \brief Reverse PackBits(): `setBits(i, bits)` receives the i-th `nBits` wide value of the bit stream
+template <typename SetBitsT>
+static void UnpackBits(const void *source, std::size_t count, std::size_t nBits, SetBitsT setBits)
+{
+   auto bytes = reinterpret_cast<const unsigned char *>(source);
+   const std::uint64_t mask = (std::uint64_t(1) << nBits) - 1;
+   std::uint64_t accumulator = 0;
+   std::size_t nAccumulated = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      while (nAccumulated < nBits) {
+         accumulator |= static_cast<std::uint64_t>(*bytes++) << nAccumulated;
+         nAccumulated += 8;
+      }
+      setBits(i, static_cast<std::uint32_t>(accumulator & mask));
+      accumulator >>= nBits;
+      nAccumulated -= nBits;
    }
 }
 
@@ -277,7 +422,13 @@ public:
    /// If CppT == void, use the default C++ type for the given column type
    template <typename CppT = void>
    static std::unique_ptr<RColumnElementBase> Generate(EColumnType type);
+   /// Generates the element for the column model's type and applies the model's bit width and value range
+   template <typename CppT = void>
+   static std::unique_ptr<RColumnElementBase> Generate(const RColumnModel &model);
+   /// For column types with a configurable width, returns the default width
    static std::size_t GetBitsOnStorage(EColumnType type);
+   /// The smallest and largest valid number of bits on storage; identical for column types of fixed width
+   static std::pair<std::size_t, std::size_t> GetValidBitRange(EColumnType type);
    static std::string GetTypeName(EColumnType type);
 
    /// Derived, typed classes tell whether the on-storage layout is bitwise identical to the memory layout
@@ -296,6 +447,36 @@ public:
       std::memcpy(destination, source, count);
    }
 
+   /// Determines the smallest and largest of `count` in-memory elements at `source` as doubles.  Used for the optional
+   /// page and cluster value statistics.  Returns false, leaving `min` and `max` untouched, if the element type has no
+   /// natural order (e.g., offsets and switches) or if there are no values to compare.
+   virtual bool GetValueRange(const void * /* source */, std::size_t /* count */, double & /* min */,
+                              double & /* max */) const
+   {
+      return false;
+   }
+
+   /// Column types with a configurable width, such as truncated or quantized floats, accept a range of bit widths.
+   /// For all other types, only the fixed width of the type is valid.
+   virtual void SetBitsOnStorage(std::size_t bitsOnStorage)
+   {
+      if (bitsOnStorage != GetBitsOnStorage())
+         throw RException(R__FAIL("invalid number of bits on storage: " + std::to_string(bitsOnStorage)));
+   }
+   /// Quantized column types map the values of the interval [min, max] to unsigned integers of the given width
+   virtual void SetValueRange(double /* min */, double /* max */)
+   {
+      throw RException(R__FAIL("column type does not support a value range"));
+   }
+   /// Applies the bit width and the value range of the column model, if they are set
+   void Configure(const RColumnModel &model)
+   {
+      if (model.GetBitsOnStorage() > 0)
+         SetBitsOnStorage(model.GetBitsOnStorage());
+      if (model.GetValueRange())
+         SetValueRange(model.GetValueRange()->first, model.GetValueRange()->second);
+   }
+
    std::size_t GetSize() const { return fSize; }
    std::size_t GetPackedSize(std::size_t nElements = 1U) const { return (nElements * GetBitsOnStorage() + 7) / 8; }
 };
@@ -409,6 +590,168 @@ public:
    }
 }; // class RColumnElementZigzagSplitLE
 
+/**
+ * Base class for IEEE 754 half precision columns of float and double values.
+ * Values are rounded to the nearest half precision value; values beyond +-65504 become infinity.
+ */
+template <typename CppT>
+class RColumnElementReal16 : public RColumnElementBase {
+protected:
+   explicit RColumnElementReal16(std::size_t size) : RColumnElementBase(size) {}
+
+public:
+   static constexpr bool kIsMappable = false;
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      auto srcArray = reinterpret_cast<const CppT *>(src);
+      auto bytes = reinterpret_cast<unsigned char *>(dst);
+      for (std::size_t i = 0; i < count; ++i) {
+         const auto half = FloatToHalf(static_cast<float>(srcArray[i]));
+         bytes[2 * i] = static_cast<unsigned char>(half);
+         bytes[2 * i + 1] = static_cast<unsigned char>(half >> 8);
+      }
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      auto bytes = reinterpret_cast<const unsigned char *>(src);
+      auto dstArray = reinterpret_cast<CppT *>(dst);
+      for (std::size_t i = 0; i < count; ++i) {
+         dstArray[i] = HalfToFloat(static_cast<std::uint16_t>(bytes[2 * i] | (bytes[2 * i + 1] << 8)));
+      }
+   }
+}; // class RColumnElementReal16
+
+/**
+ * Base class for float and double values stored as IEEE 754 single precision floats with a truncated mantissa.
+ * Only the sign, the exponent, and the highest mantissa bits are stored, bit-packed to the configured width.
+ * The mantissa is rounded to the nearest value; NaN and infinity are preserved.
+ */
+template <typename CppT>
+class RColumnElementTruncReal32 : public RColumnElementBase {
+protected:
+   std::size_t fBitsOnStorage = 32;
+
+   explicit RColumnElementTruncReal32(std::size_t size) : RColumnElementBase(size) {}
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kMinBitsOnStorage = 10;
+   static constexpr std::size_t kMaxBitsOnStorage = 32;
+
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+   void SetBitsOnStorage(std::size_t bitsOnStorage) final
+   {
+      if (bitsOnStorage < kMinBitsOnStorage || bitsOnStorage > kMaxBitsOnStorage)
+         throw RException(R__FAIL("invalid number of bits for truncated floats: " + std::to_string(bitsOnStorage)));
+      fBitsOnStorage = bitsOnStorage;
+   }
+   bool GetValueRange(const void *source, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRange<CppT>(source, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      auto srcArray = reinterpret_cast<const CppT *>(src);
+      const std::size_t nDropped = 32 - fBitsOnStorage;
+      PackBits(dst, count, fBitsOnStorage, [srcArray, nDropped](std::size_t i) -> std::uint32_t {
+         const float value = static_cast<float>(srcArray[i]);
+         std::uint32_t bits = ToUIntBits(value);
+         if (nDropped == 0)
+            return bits;
+         if (std::isnan(value)) {
+            // Make sure that the NaN does not turn into infinity by dropping the payload
+            return (bits | 0x00400000) >> nDropped;
+         }
+         // Round to nearest, ties to even
+         bits += ((1u << (nDropped - 1)) - 1) + ((bits >> nDropped) & 1);
+         return bits >> nDropped;
+      });
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      auto dstArray = reinterpret_cast<CppT *>(dst);
+      const std::size_t nDropped = 32 - fBitsOnStorage;
+      UnpackBits(src, count, fBitsOnStorage, [dstArray, nDropped](std::size_t i, std::uint32_t bits) {
+         dstArray[i] = FromUIntBits<float>(static_cast<std::uint32_t>(std::uint64_t(bits) << nDropped));
+      });
+   }
+}; // class RColumnElementTruncReal32
+
+/**
+ * Base class for float and double values quantized as unsigned integers of the configured width.
+ * The values of the interval [min, max] are mapped linearly to the integers [0, 2^nbits - 1], i.e. the absolute
+ * precision is (max - min) / (2^nbits - 1) / 2.  Values outside the interval are clamped to its bounds and NaN is
+ * stored as min.  Packing happens only when pages are flushed, i.e. possibly in a destructor, so it does not throw.
+ */
+template <typename CppT>
+class RColumnElementQuantReal32 : public RColumnElementBase {
+protected:
+   std::size_t fBitsOnStorage = 32;
+   double fMin = 0.0;
+   double fMax = 0.0;
+   bool fHasValueRange = false;
+
+   explicit RColumnElementQuantReal32(std::size_t size) : RColumnElementBase(size) {}
+
+   double GetMaxQuantValue() const { return static_cast<double>((std::uint64_t(1) << fBitsOnStorage) - 1); }
+
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kMinBitsOnStorage = 1;
+   static constexpr std::size_t kMaxBitsOnStorage = 32;
+
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+   void SetBitsOnStorage(std::size_t bitsOnStorage) final
+   {
+      if (bitsOnStorage < kMinBitsOnStorage || bitsOnStorage > kMaxBitsOnStorage)
+         throw RException(R__FAIL("invalid number of bits for quantized floats: " + std::to_string(bitsOnStorage)));
+      fBitsOnStorage = bitsOnStorage;
+   }
+   void SetValueRange(double min, double max) final
+   {
+      if (!std::isfinite(min) || !std::isfinite(max) || !(min < max))
+         throw RException(R__FAIL("invalid value range for quantized floats"));
+      fMin = min;
+      fMax = max;
+      fHasValueRange = true;
+   }
+   bool GetValueRange(const void *source, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRange<CppT>(source, count, min, max);
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      // The column model of quantized fields always carries the value range
+      R__ASSERT(fHasValueRange);
+      auto srcArray = reinterpret_cast<const CppT *>(src);
+      const double maxQuant = GetMaxQuantValue();
+      const double scale = maxQuant / (fMax - fMin);
+      const double min = fMin;
+      const double max = fMax;
+      PackBits(dst, count, fBitsOnStorage, [srcArray, maxQuant, scale, min, max](std::size_t i) {
+         // Written such that NaN maps to min
+         const double value = (srcArray[i] > min) ? std::min(static_cast<double>(srcArray[i]), max) : min;
+         return static_cast<std::uint32_t>(std::min(std::round((value - min) * scale), maxQuant));
+      });
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      if (!fHasValueRange)
+         throw RException(R__FAIL("quantized floats require a value range"));
+      auto dstArray = reinterpret_cast<CppT *>(dst);
+      const double step = (fMax - fMin) / GetMaxQuantValue();
+      const double min = fMin;
+      UnpackBits(src, count, fBitsOnStorage, [dstArray, step, min](std::size_t i, std::uint32_t bits) {
+         dstArray[i] = static_cast<CppT>(min + bits * step);
+      });
+   }
+}; // class RColumnElementQuantReal32
+
 ////////////////////////////////////////////////////////////////////////////////
 // Pairs of C++ type and column type, like float and EColumnType::kReal32
 ////////////////////////////////////////////////////////////////////////////////
@@ -594,6 +937,11 @@ public:
    std::size_t GetBitsOnStorage() const final                   \
    {                                                            \
       return kBitsOnStorage;                                    \
+   }                                                            \
+   bool GetValueRange(const void *source, std::size_t count,    \
+                      double &min, double &max) const final     \
+   {                                                            \
+      return FindValueRange<CppT>(source, count, min, max);     \
    }
 /// These macros are used to declare `RColumnElement` template specializations below.  Additional arguments can be used
 /// to forward template parameters to the base class, e.g.
@@ -677,11 +1025,41 @@ DECLARE_RCOLUMNELEMENT_SPEC(std::uint64_t, EColumnType::kSplitInt64, 64, RColumn
 
 DECLARE_RCOLUMNELEMENT_SPEC(float, EColumnType::kReal32, 32, RColumnElementLE, <float>);
 DECLARE_RCOLUMNELEMENT_SPEC(float, EColumnType::kSplitReal32, 32, RColumnElementSplitLE, <float, float>);
+DECLARE_RCOLUMNELEMENT_SPEC(float, EColumnType::kReal16, 16, RColumnElementReal16, <float>);
+
+template <>
+class RColumnElement<float, EColumnType::kReal32Trunc> : public RColumnElementTruncReal32<float> {
+public:
+   static constexpr std::size_t kSize = sizeof(float);
+   RColumnElement() : RColumnElementTruncReal32<float>(kSize) {}
+};
+
+template <>
+class RColumnElement<float, EColumnType::kReal32Quant> : public RColumnElementQuantReal32<float> {
+public:
+   static constexpr std::size_t kSize = sizeof(float);
+   RColumnElement() : RColumnElementQuantReal32<float>(kSize) {}
+};
 
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kReal64, 64, RColumnElementLE, <double>);
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kSplitReal64, 64, RColumnElementSplitLE, <double, double>);
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kReal32, 32, RColumnElementCastLE, <double, float>);
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kSplitReal32, 32, RColumnElementSplitLE, <double, float>);
+DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kReal16, 16, RColumnElementReal16, <double>);
+
+template <>
+class RColumnElement<double, EColumnType::kReal32Trunc> : public RColumnElementTruncReal32<double> {
+public:
+   static constexpr std::size_t kSize = sizeof(double);
+   RColumnElement() : RColumnElementTruncReal32<double>(kSize) {}
+};
+
+template <>
+class RColumnElement<double, EColumnType::kReal32Quant> : public RColumnElementQuantReal32<double> {
+public:
+   static constexpr std::size_t kSize = sizeof(double);
+   RColumnElement() : RColumnElementQuantReal32<double>(kSize) {}
+};
 
 DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kIndex64, 64, RColumnElementLE, <std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kIndex32, 32, RColumnElementCastLE,
@@ -703,6 +1081,7 @@ std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType typ
    case EColumnType::kBit: return std::make_unique<RColumnElement<CppT, EColumnType::kBit>>();
    case EColumnType::kReal64: return std::make_unique<RColumnElement<CppT, EColumnType::kReal64>>();
    case EColumnType::kReal32: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32>>();
+   case EColumnType::kReal16: return std::make_unique<RColumnElement<CppT, EColumnType::kReal16>>();
    case EColumnType::kInt64: return std::make_unique<RColumnElement<CppT, EColumnType::kInt64>>();
    case EColumnType::kUInt64: return std::make_unique<RColumnElement<CppT, EColumnType::kUInt64>>();
    case EColumnType::kInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kInt32>>();
@@ -721,12 +1100,22 @@ std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType typ
    case EColumnType::kSplitUInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitUInt32>>();
    case EColumnType::kSplitInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitInt16>>();
    case EColumnType::kSplitUInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitUInt16>>();
+   case EColumnType::kReal32Trunc: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32Trunc>>();
+   case EColumnType::kReal32Quant: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32Quant>>();
    default: R__ASSERT(false);
    }
    // never here
    return nullptr;
 }
 
+template <typename CppT>
+std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(const RColumnModel &model)
+{
+   auto element = Generate<CppT>(model.GetType());
+   element->Configure(model);
+   return element;
+}
+
 template <>
 std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate<void>(EColumnType type);
 
@@ -18,7 +18,10 @@
 
 #include <ROOT/RStringView.hxx>
 
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <utility>
 
 namespace ROOT {
 namespace Experimental {
@@ -72,6 +75,10 @@ enum class EColumnType {
    kSplitUInt32,
    kSplitInt16,
    kSplitUInt16,
+   // IEEE single precision floats with a truncated mantissa; the number of bits on storage is set by the column model
+   kReal32Trunc,
+   // Floats quantized as unsigned integers within a value range; bits on storage and range are set by the column model
+   kReal32Quant,
    kMax,
 };
 
@@ -83,9 +90,17 @@ enum class EColumnType {
 */
 // clang-format on
 class RColumnModel {
+public:
+   /// The [min, max] interval of the values of a quantized column
+   using ValueRange_t = std::pair<double, double>;
+
 private:
    EColumnType fType;
    bool fIsSorted;
+   /// Only set for column types with a configurable width; zero means the column type's default width
+   std::uint16_t fBitsOnStorage = 0;
+   /// Only set for column types that require a value range, such as kReal32Quant
+   std::optional<ValueRange_t> fValueRange;
 
 public:
    RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false) {}
@@ -94,12 +109,21 @@ public:
    {
    }
    RColumnModel(EColumnType type, bool isSorted) : fType(type), fIsSorted(isSorted) {}
+   RColumnModel(EColumnType type, bool isSorted, std::uint16_t bitsOnStorage,
+                const std::optional<ValueRange_t> &valueRange = std::nullopt)
+      : fType(type), fIsSorted(isSorted), fBitsOnStorage(bitsOnStorage), fValueRange(valueRange)
+   {
+   }
 
    EColumnType GetType() const { return fType; }
    bool GetIsSorted() const { return fIsSorted; }
+   /// Returns zero if the column uses the default width of its type
+   std::uint16_t GetBitsOnStorage() const { return fBitsOnStorage; }
+   const std::optional<ValueRange_t> &GetValueRange() const { return fValueRange; }
 
    bool operator ==(const RColumnModel &other) const {
-      return (fType == other.fType) && (fIsSorted == other.fIsSorted);
+      return (fType == other.fType) && (fIsSorted == other.fIsSorted) && (fBitsOnStorage == other.fBitsOnStorage) &&
+             (fValueRange == other.fValueRange);
    }
    bool operator!=(const RColumnModel &other) const { return !(other == *this); }
 };
@@ -196,8 +196,11 @@ public:
             fIndices.emplace(fDataRequests[i].fAkey, i);
       };
       explicit RWOperation(ROidDkeyPair &k) : fOid(k.oid), fDistributionKey(k.dkey){};
+      RWOperation(ROidDkeyPair &k, ObjClassId_t cid) : fOid(k.oid), fDistributionKey(k.dkey), fCid(cid){};
       daos_obj_id_t fOid{};
       DistributionKey_t fDistributionKey{};
+      /// The object class used to qualify `fOid`; if unknown, the class passed to `ReadV`/`WriteV` is used
+      ObjClassId_t fCid{OC_UNKNOWN};
       std::vector<RDaosObject::RAkeyRequest> fDataRequests{};
       std::unordered_map<AttributeKey_t, unsigned> fIndices{};
 
@@ -242,7 +245,7 @@ private:
    /**
      \brief Perform a vector read/write operation on different objects.
      \param map A `MultiObjectRWOperation_t` that describes read/write operations to perform.
-     \param cid The `daos_oclass_id_t` used to qualify OIDs.
+     \param cid The `daos_oclass_id_t` used to qualify OIDs of operations that do not specify an object class.
      \param fn Either `&RDaosObject::Fetch` (read) or `&RDaosObject::Update` (write).
      \return 0 if the operation succeeded; a negative DAOS error number otherwise.
      */
@@ -289,18 +292,19 @@ public:
    { return WriteSingleAkey(buffer, length, oid, dkey, akey, fDefaultObjectClass); }
 
    /**
-     \brief Perform a vector read operation on multiple objects.
+     \brief Perform a vector read operation on multiple objects. All the operations are in flight at the same time
+     in the event queue of the pool; the call returns once all of them completed.
      \param map A `MultiObjectRWOperation_t` that describes read operations to perform.
-     \param cid An object class ID.
+     \param cid The object class ID of the operations that do not specify one.
      \return Number of operations that could not complete.
      */
    int ReadV(MultiObjectRWOperation_t &map, ObjClassId_t cid) { return VectorReadWrite(map, cid, &RDaosObject::Fetch); }
    int ReadV(MultiObjectRWOperation_t &map) { return ReadV(map, fDefaultObjectClass); }
 
    /**
-     \brief Perform a vector write operation on multiple objects.
+     \brief Perform a vector write operation on multiple objects, see `ReadV`.
      \param map A `MultiObjectRWOperation_t` that describes write operations to perform.
-     \param cid An object class ID.
+     \param cid The object class ID of the operations that do not specify one.
      \return Number of operations that could not complete.
      */
    int WriteV(MultiObjectRWOperation_t &map, ObjClassId_t cid)
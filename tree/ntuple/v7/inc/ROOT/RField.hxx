@@ -37,6 +37,7 @@
 #include <iterator>
 #include <memory>
 #include <new>
+#include <optional>
 #include <set>
 #include <string>
 #include <type_traits>
@@ -1153,11 +1154,24 @@ public:
 /// Sparse nullable fields use a (Split)Index[64|32] column to point to the available items.
 /// By default, items whose size is smaller or equal to 4 bytes (size of (Split)Index32 column element) are stored
 /// densely.
+/// Compact nullable fields, for values that are rarely set, combine the two: they have a bitmask like dense fields
+/// but, like sparse fields, only serialize the available items.  The missing items cost one bit per entry and entries
+/// without items never touch the pages of the item field.  The item of an entry is found by counting the set bits of
+/// the cluster up to that entry, which is cheap for entries read in order.  Compact fields have field version 1.
 class RNullableField : public Detail::RFieldBase {
    /// For a dense nullable field, used to write a default-constructed item for missing ones.
    std::unique_ptr<RValue> fDefaultItemValue;
    /// For a sparse nullable field, the number of written non-null items in this cluster
    ClusterSize_t fNWritten{0};
+   /// Whether the bitmask of a kBit column is the one of a compact rather than a dense field
+   bool fIsCompact = false;
+   /// For reading a compact field: the number of set bits before fRankIndex in the cluster fRankClusterId
+   DescriptorId_t fRankClusterId = kInvalidDescriptorId;
+   ClusterSize_t::ValueType fRankIndex = 0;
+   ClusterSize_t::ValueType fRank = 0;
+
+   /// For a compact field, returns the number of available items in the cluster before the given entry
+   ClusterSize_t::ValueType GetRank(const RClusterIndex &clusterIndex);
 
 protected:
    const Detail::RFieldBase::RColumnRepresentations &GetColumnRepresentations() const final;
@@ -1179,10 +1193,26 @@ public:
    RNullableField &operator=(RNullableField &&other) = default;
    ~RNullableField() override = default;
 
-   bool IsDense() const { return GetColumnRepresentative()[0] ==  EColumnType::kBit; }
-   bool IsSparse() const { return !IsDense(); }
-   void SetDense() { SetColumnRepresentative({EColumnType::kBit}); }
-   void SetSparse() { SetColumnRepresentative({EColumnType::kSplitIndex32}); }
+   bool IsDense() const { return !fIsCompact && GetColumnRepresentative()[0] == EColumnType::kBit; }
+   bool IsSparse() const { return !fIsCompact && !IsDense(); }
+   bool IsCompact() const { return fIsCompact; }
+   void SetDense()
+   {
+      fIsCompact = false;
+      SetColumnRepresentative({EColumnType::kBit});
+   }
+   void SetSparse()
+   {
+      fIsCompact = false;
+      SetColumnRepresentative({EColumnType::kSplitIndex32});
+   }
+   void SetCompact()
+   {
+      SetColumnRepresentative({EColumnType::kBit});
+      fIsCompact = true;
+   }
+
+   std::uint32_t GetFieldVersion() const final { return fIsCompact ? 1 : 0; }
 
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
 };
@@ -1596,9 +1626,18 @@ public:
 
 template <>
 class RField<float> : public Detail::RFieldBase {
+private:
+   /// Set by SetTruncated() and SetQuantized()
+   std::uint16_t fColumnBitsOnStorage = 0;
+   /// Set by SetQuantized()
+   std::optional<RColumnModel::ValueRange_t> fColumnValueRange;
+
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
+      auto clone = std::make_unique<RField>(newName);
+      clone->fColumnBitsOnStorage = fColumnBitsOnStorage;
+      clone->fColumnValueRange = fColumnValueRange;
+      return clone;
    }
 
    const RColumnRepresentations &GetColumnRepresentations() const final;
@@ -1634,14 +1673,32 @@ public:
    size_t GetValueSize() const final { return sizeof(float); }
    size_t GetAlignment() const final { return alignof(float); }
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
+
+   /// Store the values as IEEE 754 half precision floats (16 bit).  Values beyond +-65504 are stored as infinity.
+   void SetHalfPrecision();
+   /// Store the values as single precision floats of which only the sign, the exponent, and the highest mantissa bits
+   /// are kept.  The mantissa is rounded.  nBits is the total width on storage and must be between 10 and 32.
+   void SetTruncated(std::size_t nBits);
+   /// Store the values as unsigned integers of nBits bits (1 to 32) that linearly map the interval [min, max].
+   /// Values outside of the interval are stored as the closest interval bound, NaN is stored as min.
+   void SetQuantized(double min, double max, std::size_t nBits);
 };
 
 
 template <>
 class RField<double> : public Detail::RFieldBase {
+private:
+   /// Set by SetTruncated() and SetQuantized()
+   std::uint16_t fColumnBitsOnStorage = 0;
+   /// Set by SetQuantized()
+   std::optional<RColumnModel::ValueRange_t> fColumnValueRange;
+
 protected:
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
+      auto clone = std::make_unique<RField>(newName);
+      clone->fColumnBitsOnStorage = fColumnBitsOnStorage;
+      clone->fColumnValueRange = fColumnValueRange;
+      return clone;
    }
 
    const RColumnRepresentations &GetColumnRepresentations() const final;
@@ -1680,6 +1737,15 @@ public:
 
    // Set the column representation to 32 bit floating point and the type alias to Double32_t
    void SetDouble32();
+
+   /// Store the values as IEEE 754 half precision floats (16 bit).  Values beyond +-65504 are stored as infinity.
+   void SetHalfPrecision();
+   /// Store the values as single precision floats of which only the sign, the exponent, and the highest mantissa bits
+   /// are kept.  The mantissa is rounded.  nBits is the total width on storage and must be between 10 and 32.
+   void SetTruncated(std::size_t nBits);
+   /// Store the values as unsigned integers of nBits bits (1 to 32) that linearly map the interval [min, max].
+   /// Values outside of the interval are stored as the closest interval bound, NaN is stored as min.
+   void SetQuantized(double min, double max, std::size_t nBits);
 };
 
 template <>
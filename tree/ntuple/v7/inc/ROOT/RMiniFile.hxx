@@ -32,6 +32,7 @@ class TFileMergeInfo;
 namespace ROOT {
 
 namespace Internal {
+class RFileWriteEngine;
 class RRawFile;
 }
 
@@ -147,6 +148,9 @@ private:
    struct RFileSimple {
       /// For the simplest cases, a C file stream can be used for writing
       FILE *fFile = nullptr;
+      /// Alternatively, a file descriptor written through the write engine
+      int fFileDes = -1;
+      std::unique_ptr<ROOT::Internal::RFileWriteEngine> fWriteEngine;
       /// Keeps track of the seek offset
       std::uint64_t fFilePos = 0;
       /// Keeps track of TFile control structures, which need to be updated on committing the data set
@@ -161,6 +165,8 @@ private:
 
       /// Writes bytes in the open stream, either at fFilePos or at the given offset
       void Write(const void *buffer, size_t nbytes, std::int64_t offset = -1);
+      /// Makes sure that all the data written so far reached the file
+      void Flush();
       /// Writes a TKey including the data record, given by buffer, into fFile; returns the file offset to the payload.
       /// The payload is already compressed
       std::uint64_t WriteKey(const void *buffer, std::size_t nbytes, std::size_t len, std::int64_t offset = -1,
@@ -168,7 +174,7 @@ private:
                              const std::string &className = "",
                              const std::string &objectName = "",
                              const std::string &title = "");
-      operator bool() const { return fFile; }
+      operator bool() const { return fFile || fWriteEngine; }
    };
 
    // TODO(jblomer): wrap in an std::variant with C++17
@@ -203,9 +209,10 @@ private:
 
 public:
    /// Create or truncate the local file given by path with the new empty RNTuple identified by ntupleName.
-   /// Uses a C stream for writing
+   /// Uses a C stream for writing, or the write engine if requested by the (optional) writeOptions
    static RNTupleFileWriter *Recreate(std::string_view ntupleName, std::string_view path, int defaultCompression,
-                                      ENTupleContainerFormat containerFormat);
+                                      ENTupleContainerFormat containerFormat,
+                                      const RNTupleWriteOptions *writeOptions = nullptr);
    /// Create or truncate the local or remote file given by path with the new empty RNTuple identified by ntupleName.
    /// Creates a new TFile object for writing and hands over ownership of the object to the user.
    static RNTupleFileWriter *Recreate(std::string_view ntupleName, std::string_view path,
@@ -148,7 +148,7 @@ public:
       bool      operator!=(const iterator& rh) const { return fIndex != rh.fIndex; }
    };
 
-   /// Used to specify the underlying RNTuples in OpenFriends()
+   /// Used to specify the underlying RNTuples in OpenFriends() and OpenChain()
    struct ROpenSpec {
       std::string fNTupleName;
       std::string fStorage;
@@ -186,6 +186,9 @@ public:
    /// have an identical number of entries.  Fields in the combined RNTuple are named with the ntuple name
    /// as a prefix, e.g. myNTuple1.px and myNTuple2.pt (see tutorial ntpl006_friends)
    static std::unique_ptr<RNTupleReader> OpenFriends(std::span<ROpenSpec> ntuples);
+   /// Open RNTuples with the same schema as one virtual ntuple that consists of the entries of all the given
+   /// RNTuples, one after the other.  The combined RNTuple is named after the first one.
+   static std::unique_ptr<RNTupleReader> OpenChain(std::span<ROpenSpec> ntuples);
 
    /// The user imposes an ntuple model, which must be compatible with the model found in the data on
    /// storage.
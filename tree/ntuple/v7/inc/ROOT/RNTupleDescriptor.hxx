@@ -30,6 +30,7 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <vector>
 #include <string>
@@ -212,6 +213,17 @@ class RClusterDescriptor {
    friend class RClusterDescriptorBuilder;
 
 public:
+   /// The smallest and largest value of the elements of a page or a column range, converted to double.
+   /// Value ranges are optional; they are only stored for arithmetic columns if requested by the write options.
+   struct RValueRange {
+      double fMin = 0.0;
+      double fMax = 0.0;
+
+      bool operator==(const RValueRange &other) const { return fMin == other.fMin && fMax == other.fMax; }
+      /// Whether there may be values in the closed interval [min, max]
+      bool Overlaps(double min, double max) const { return (fMin <= max) && (fMax >= min); }
+   };
+
    /// The window of element indexes of a particular column in a particular cluster
    struct RColumnRange {
       DescriptorId_t fPhysicalColumnId = kInvalidDescriptorId;
@@ -222,13 +234,13 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// The union of the value ranges of the pages; only set if all the pages of the column range have one.
+      std::optional<RValueRange> fValueRange;
 
       bool operator==(const RColumnRange &other) const {
          return fPhysicalColumnId == other.fPhysicalColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fValueRange == other.fValueRange;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -245,9 +257,11 @@ public:
          std::uint32_t fNElements = std::uint32_t(-1);
          /// The meaning of fLocator depends on the storage backend.
          RNTupleLocator fLocator;
+         /// Optional statistics of the values stored in the page
+         std::optional<RValueRange> fValueRange;
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fValueRange == other.fValueRange;
          }
       };
       struct RPageInfoExtended : RPageInfo {
@@ -773,6 +787,9 @@ public:
    DescriptorId_t FindClusterId(DescriptorId_t physicalColumnId, NTupleSize_t index) const;
    DescriptorId_t FindNextClusterId(DescriptorId_t clusterId) const;
    DescriptorId_t FindPrevClusterId(DescriptorId_t clusterId) const;
+   /// Returns the IDs of the clusters, in the order of their entries, that may contain values of the given column
+   /// in the closed interval [min, max].  Clusters without value statistics for the column are always returned.
+   std::vector<DescriptorId_t> FindClustersInValueRange(DescriptorId_t physicalColumnId, double min, double max) const;
 
    /// Walks up the parents of the field ID and returns a field name of the form a.b.c.d
    /// In case of invalid field ID, an empty string is returned.
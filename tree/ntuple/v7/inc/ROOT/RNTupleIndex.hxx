@@ -0,0 +1,107 @@
+/// \file ROOT/RNTupleIndex.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleIndex
+#define ROOT7_RNTupleIndex
+
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class TFile;
+
+namespace ROOT {
+namespace Experimental {
+
+namespace Detail {
+class RPageSource;
+}
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleIndex
+\ingroup NTuple
+\brief Maps the values of one or two integral key fields, e.g. (run, event), to entry numbers of an ntuple
+
+The index is the RNTuple equivalent of TTreeIndex.  It is built once by reading the key fields of all the entries,
+optionally distributing the clusters over several threads.  The index is kept as a vector sorted by the key so that
+lookups take logarithmic time.  Key values of any integral type are converted to 64bit unsigned integers; lookups
+need to convert the key in the same way, e.g. static_cast<std::uint64_t>(-1) for a signed key of value -1.
+
+The index can be persisted as an ntuple of its own, typically in the same file as the indexed ntuple, and read back
+with Open().  The names of the key fields are stored as the descriptions of the fields of the index ntuple.
+
+~~~ {.cpp}
+auto index = RNTupleIndex::Create({"run", "event"}, *pageSource);
+auto entry = index->GetEntryIndex(run, event);
+if (entry != kInvalidNTupleIndex)
+   reader->LoadEntry(entry);
+~~~
+*/
+// clang-format on
+class RNTupleIndex {
+public:
+   struct RIndexEntry {
+      std::uint64_t fKey0 = 0;
+      /// Zero for indexes with a single key field
+      std::uint64_t fKey1 = 0;
+      NTupleSize_t fEntryIndex = kInvalidNTupleIndex;
+
+      bool operator<(const RIndexEntry &other) const
+      {
+         if (fKey0 != other.fKey0)
+            return fKey0 < other.fKey0;
+         if (fKey1 != other.fKey1)
+            return fKey1 < other.fKey1;
+         return fEntryIndex < other.fEntryIndex;
+      }
+   };
+
+private:
+   std::vector<std::string> fFieldNames;
+   /// Sorted by key; entries with the same key are sorted by entry number
+   std::vector<RIndexEntry> fEntries;
+
+   explicit RNTupleIndex(const std::vector<std::string> &fieldNames) : fFieldNames(fieldNames) {}
+
+public:
+   /// Builds the index from one or two top-level fields of integral type of the attached page source.  With more
+   /// than one thread, the clusters are distributed over the given number of threads, each of them reading from a
+   /// clone of the page source.
+   static std::unique_ptr<RNTupleIndex>
+   Create(const std::vector<std::string> &fieldNames, Detail::RPageSource &pageSource, unsigned int nThreads = 1);
+   /// Reads back an index that was written by Write()
+   static std::unique_ptr<RNTupleIndex> Open(std::string_view indexName, std::string_view storage);
+
+   /// Stores the index as an ntuple with the given name in the file, which must be writable
+   void Write(std::string_view indexName, TFile &file) const;
+
+   /// Returns the smallest entry number with the given key or kInvalidNTupleIndex if there is no such entry
+   NTupleSize_t GetEntryIndex(std::uint64_t key0, std::uint64_t key1 = 0) const;
+   /// Returns the entry numbers of all the entries with the given key in increasing order
+   std::vector<NTupleSize_t> GetAllEntryIndexes(std::uint64_t key0, std::uint64_t key1 = 0) const;
+
+   const std::vector<std::string> &GetFieldNames() const { return fFieldNames; }
+   /// The number of indexed entries
+   std::size_t GetSize() const { return fEntries.size(); }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
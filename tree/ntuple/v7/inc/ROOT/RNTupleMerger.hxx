@@ -19,10 +19,16 @@
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 
 namespace ROOT {
 namespace Experimental {
 
+namespace Detail {
+class RPageSink;
+class RPageSource;
+} // namespace Detail
+
 // clang-format off
 /**
 \class ROOT::Experimental::RFieldMerger
@@ -38,6 +44,27 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Given a set of RPageSources merge them into an RPageSink
+
+The merger concatenates the clusters of all the sources, in the order of the sources, into the destination.  All the
+sources need to have the same schema as the first source, which determines the schema of the destination.  Pages are
+copied as sealed pages, i.e. without unpacking the page content.  If a page is compressed with the compression
+settings of the destination, it is copied byte by byte; otherwise, it is decompressed and recompressed, in parallel
+if implicit multi-threading is enabled.  The clusters of every source are read ahead by a cluster pool according to
+the source's read options, and the pages of a cluster are committed to the destination with a single vector write.
+*/
+// clang-format on
+class RNTupleMerger {
+public:
+   /// Merge the given sources into the destination.  The sources must not be attached yet and the destination must
+   /// not be created yet; both are done by Merge().  Throws an exception if the schemas of the sources do not match.
+   void Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination);
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -320,6 +320,10 @@ public:
 
    RFieldZero *GetFieldZero() const { return fFieldZero.get(); }
    const Detail::RFieldBase *GetField(std::string_view fieldName) const;
+   /// Creates a bulk to read arrays of consecutive values of the given (sub) field, e.g. "jets.pt".  The model must
+   /// be connected to a page source, i.e. it must be the model of an RNTupleReader.  The returned bulk refers to the
+   /// field and must not outlive the model.
+   Detail::RFieldBase::RBulk CreateBulk(std::string_view fieldName) const;
 
    std::string GetDescription() const { return fDescription; }
    void SetDescription(std::string_view description);
@@ -19,7 +19,10 @@
 #include <Compression.h>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <string>
 
 namespace ROOT {
 namespace Experimental {
@@ -60,10 +63,25 @@ protected:
    /// fApproxUnzippedPageSize in size and tail pages (the last page in a cluster) is between
    /// fApproxUnzippedPageSize/2 and fApproxUnzippedPageSize * 1.5 in size.
    std::size_t fApproxUnzippedPageSize = 64 * 1024;
+   /// If non-zero, the page size of every column is adapted at the cluster boundaries such that the pages of the
+   /// column approximately reach this size on storage, based on the compression ratio observed so far for the column.
+   /// Highly compressible columns thus get larger pages and poorly compressible columns get smaller pages than given by
+   /// fApproxUnzippedPageSize, which is still used for the first cluster.
+   std::size_t fApproxZippedPageSize = 0;
    bool fUseBufferedWrite = true;
    /// If set, 64bit index columns are replaced by 32bit index columns. This limits the cluster size to 512MB
    /// but it can result in smaller file sizes for data sets with many collections and lz4 or no compression.
    bool fHasSmallClusters = false;
+   /// If set, the smallest and largest value of every page of arithmetic columns is stored in the page list.
+   /// Readers can use these value ranges to skip clusters that cannot satisfy a selection.
+   bool fHasValueRanges = false;
+   /// If set, a local file written without a TFile object is written through an RFileWriteEngine: the data is
+   /// gathered in two large aligned buffers, one of which is written in the background while the other one is filled.
+   bool fUseWriteEngine = false;
+   /// With the write engine, bypass the page cache for the bulk of the data (O_DIRECT, Linux only)
+   bool fUseDirectIO = false;
+   /// With the write engine, sync the data to storage every fSyncInterval bytes; zero never syncs before closing
+   std::uint64_t fSyncInterval = 0;
 
 public:
    /// A maximum size of 512MB still allows for a vector of bool to be stored in a small cluster.  This is the
@@ -92,11 +110,26 @@ public:
    std::size_t GetApproxUnzippedPageSize() const { return fApproxUnzippedPageSize; }
    void SetApproxUnzippedPageSize(std::size_t val);
 
+   std::size_t GetApproxZippedPageSize() const { return fApproxZippedPageSize; }
+   void SetApproxZippedPageSize(std::size_t val) { fApproxZippedPageSize = val; }
+
    bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
    void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
 
    bool GetHasSmallClusters() const { return fHasSmallClusters; }
    void SetHasSmallClusters(bool val) { fHasSmallClusters = val; }
+
+   bool GetHasValueRanges() const { return fHasValueRanges; }
+   void SetHasValueRanges(bool val) { fHasValueRanges = val; }
+
+   bool GetUseWriteEngine() const { return fUseWriteEngine; }
+   void SetUseWriteEngine(bool val) { fUseWriteEngine = val; }
+
+   bool GetUseDirectIO() const { return fUseDirectIO; }
+   void SetUseDirectIO(bool val) { fUseDirectIO = val; }
+
+   std::uint64_t GetSyncInterval() const { return fSyncInterval; }
+   void SetSyncInterval(std::uint64_t val) { fSyncInterval = val; }
 };
 
 // clang-format off
@@ -112,6 +145,8 @@ class RNTupleWriteOptionsDaos : public RNTupleWriteOptions {
    /// cage size yields acceptable results in throughput and page granularity for most use cases. A `fMaxCageSize` of 0
    /// disables the caging mechanism.
    uint32_t fMaxCageSize = 16 * RNTupleWriteOptions::fApproxUnzippedPageSize;
+   /// Maps qualified field names to the object class of the pages of their columns
+   std::map<std::string, std::string> fColumnObjectClasses;
 
 public:
    ~RNTupleWriteOptionsDaos() override = default;
@@ -129,6 +164,50 @@ public:
    /// that cage size will be no smaller than the approximate uncompressed page size.
    /// To disable page concatenation, set this value to 0.
    void SetMaxCageSize(uint32_t cageSz) { fMaxCageSize = cageSz; }
+
+   const std::map<std::string, std::string> &GetColumnObjectClasses() const { return fColumnObjectClasses; }
+   /// Set the object class of the pages of the columns of the given field and of its subfields, overriding the one
+   /// given by `SetObjectClass()`. The field is given by its qualified name, e.g. `jets.pt`. Since the object class
+   /// also determines the sharding and the redundancy of the objects, this allows, e.g., to spread the pages of the
+   /// large columns across all targets (`SX`) and to keep the small ones in a single shard (`S1`).
+   void SetColumnObjectClass(const std::string &fieldName, const std::string &val)
+   {
+      fColumnObjectClasses[fieldName] = val;
+   }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RClusterCachePolicy
+\ingroup NTuple
+\brief Tunes the window and the memory budget of the cluster pool that preloads clusters in the background
+
+By default, the look-ahead window of the cluster pool is given by the cluster bunch size and the number of cluster
+bunches in flight.  An explicit look-ahead depth overrides this window, e.g. to hide the latency of remote reads.
+The byte budget limits the compressed size of the clusters in the pool and in flight, which bounds the memory used by
+every reader in case of many concurrent readers.  The cluster that is currently requested is always loaded, even if
+it alone exceeds the budget.  If the budget is exhausted, prefetching stops and clusters are evicted from the pool,
+first the ones that do not contain any of the currently active columns, then the ones of the look-back window,
+and finally the ones furthest ahead.
+*/
+// clang-format on
+class RClusterCachePolicy {
+private:
+   /// The number of clusters after the current cluster that are preloaded; zero means that the window is given
+   /// by the cluster bunch size and the number of cluster bunches in flight
+   unsigned int fLookahead = 0;
+   /// The number of clusters before the current cluster that are kept in the pool if present
+   unsigned int fLookbehind = 0;
+   /// The maximum number of bytes on storage of the clusters in the pool and in flight; zero means unlimited
+   std::uint64_t fMaxInFlightBytes = 0;
+
+public:
+   unsigned int GetLookahead() const { return fLookahead; }
+   void SetLookahead(unsigned int val) { fLookahead = val; }
+   unsigned int GetLookbehind() const { return fLookbehind; }
+   void SetLookbehind(unsigned int val) { fLookbehind = val; }
+   std::uint64_t GetMaxInFlightBytes() const { return fMaxInFlightBytes; }
+   void SetMaxInFlightBytes(std::uint64_t val) { fMaxInFlightBytes = val; }
 };
 
 // clang-format off
@@ -148,15 +227,45 @@ public:
       kDefault = kOn,
    };
 
+   enum class EImplicitMT {
+      kOff,
+      kDefault,
+   };
+
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
+   /// The number of cluster bunches that the cluster pool requests from storage in a single vector read.
+   /// With a larger value, the I/O thread keeps more read requests in flight, which helps to saturate devices
+   /// with deep queues (e.g., NVMe drives read through io_uring). It also increases the look-ahead window and
+   /// thus the memory used by the cluster pool.
+   unsigned int fMaxClusterBunchesInFlight = 1;
+   /// If implicit multi-threading is turned on (and this option is not kOff), the pages of the clusters preloaded
+   /// by the cluster pool are decompressed in parallel by tasks submitted to the IMT task arena.
+   EImplicitMT fUseImplicitMT = EImplicitMT::kDefault;
+   /// If set and supported by the storage backend, the file is memory mapped and uncompressed pages whose on-disk
+   /// representation matches the in-memory layout are served directly from the mapping, without any copy.
+   bool fUseMmap = false;
+   /// If set, the file is read through the process-wide block cache (see ROOT::Internal::RRawFileBlockCache), so that
+   /// concurrent readers of the same file share the blocks read from storage, e.g. the header, footer and hot clusters.
+   bool fUseSharedBlockCache = false;
+   RClusterCachePolicy fClusterCachePolicy;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
    unsigned int GetClusterBunchSize() const  { return fClusterBunchSize; }
    void SetClusterBunchSize(unsigned int val) { fClusterBunchSize = val; }
+   unsigned int GetMaxClusterBunchesInFlight() const { return fMaxClusterBunchesInFlight; }
+   void SetMaxClusterBunchesInFlight(unsigned int val) { fMaxClusterBunchesInFlight = val; }
+   EImplicitMT GetUseImplicitMT() const { return fUseImplicitMT; }
+   void SetUseImplicitMT(EImplicitMT val) { fUseImplicitMT = val; }
+   bool GetUseMmap() const { return fUseMmap; }
+   void SetUseMmap(bool val) { fUseMmap = val; }
+   bool GetUseSharedBlockCache() const { return fUseSharedBlockCache; }
+   void SetUseSharedBlockCache(bool val) { fUseSharedBlockCache = val; }
+   const RClusterCachePolicy &GetClusterCachePolicy() const { return fClusterCachePolicy; }
+   void SetClusterCachePolicy(const RClusterCachePolicy &val) { fClusterCachePolicy = val; }
 };
 
 } // namespace Experimental
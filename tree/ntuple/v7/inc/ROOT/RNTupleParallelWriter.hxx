@@ -0,0 +1,188 @@
+/// \file ROOT/RNTupleParallelWriter.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleParallelWriter
+#define ROOT7_RNTupleParallelWriter
+
+#include <ROOT/RConfig.hxx> // for R__unlikely
+#include <ROOT/REntry.hxx>
+#include <ROOT/RError.hxx>
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RSpan.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+
+class RNTupleParallelWriter;
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleFillContext
+\ingroup NTuple
+\brief A per-thread context to fill entries into an RNTuple that is written by an RNTupleParallelWriter
+
+A fill context owns a private copy of the writer's model and collects the filled entries in its own clusters.  Pages
+are compressed in the thread that fills the context.  Once a cluster is full, the sealed pages are handed over to the
+parallel writer that appends them as a new cluster to the ntuple.  Only this last step is serialized among the fill
+contexts of the same writer.  A fill context must only be used by one thread at a time.
+*/
+// clang-format on
+class RNTupleFillContext {
+   friend class RNTupleParallelWriter;
+
+private:
+   /// The private page sink that collects the sealed pages of the currently open cluster
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// Needs to be destructed before fSink
+   std::unique_ptr<RNTupleModel> fModel;
+   NTupleSize_t fLastCommitted = 0;
+   NTupleSize_t fNEntries = 0;
+   /// Keeps track of the number of bytes written into the current cluster
+   std::size_t fUnzippedClusterSize = 0;
+   /// The total number of bytes written to storage by this context (i.e., after compression)
+   std::uint64_t fNBytesCommitted = 0;
+   /// The total number of bytes filled into all the so far committed clusters of this context
+   std::uint64_t fNBytesFilled = 0;
+   /// Limit for committing cluster no matter the other tunables
+   std::size_t fMaxUnzippedClusterSize;
+   /// Estimator of uncompressed cluster size, taking into account the estimated compression ratio
+   NTupleSize_t fUnzippedClusterSizeEst;
+
+   RNTupleFillContext(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext &) = delete;
+   RNTupleFillContext &operator=(const RNTupleFillContext &) = delete;
+   /// Commits the remaining entries, if any, as a final cluster
+   ~RNTupleFillContext();
+
+   /// Fill the default entry of the context's model.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill() { return Fill(*fModel->GetDefaultEntry()); }
+   /// The entry must have been created by CreateEntry() of this very fill context.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill(REntry &entry)
+   {
+      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
+         throw RException(R__FAIL("mismatch between entry and model"));
+
+      std::size_t bytesWritten = 0;
+      for (auto &value : entry) {
+         bytesWritten += value.Append();
+      }
+      fUnzippedClusterSize += bytesWritten;
+      fNEntries++;
+      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
+         CommitCluster();
+      return bytesWritten;
+   }
+   /// Seal the data from the so far seen Fill calls and append it as a new cluster to the ntuple
+   void CommitCluster();
+
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+   /// The model of the fill context is a copy of the parallel writer's model
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+   /// The number of entries filled into this context so far
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief An RNTuple that gets filled concurrently by multiple threads, each through its own RNTupleFillContext
+
+The parallel writer creates the ntuple from the given model but it is not filled directly.  Instead, every thread
+creates its own fill context by CreateFillContext() and fills entries through it.  The fill contexts build private
+clusters and commit them to the writer, which appends them to the ntuple in the order in which they are committed.
+Consequently, the entries of different threads are not interleaved within a cluster, and the global order of the
+entries is not deterministic.  On destruction, the writer commits the outstanding clusters of all fill contexts that
+are still alive and writes the ntuple footer.  Fill contexts must not be used after the writer has been destructed.
+
+~~~ {.cpp}
+auto model = RNTupleModel::Create();
+model->MakeField<float>("pt");
+auto writer = RNTupleParallelWriter::Recreate(std::move(model), "myNTuple", "some/file.root");
+// In every thread:
+auto fillContext = writer->CreateFillContext();
+auto entry = fillContext->CreateEntry();
+auto pt = entry->Get<float>("pt");
+for (...) {
+   *pt = ...;
+   fillContext->Fill(*entry);
+}
+~~~
+*/
+// clang-format on
+class RNTupleParallelWriter {
+private:
+   /// Serializes the cluster commits of the fill contexts and the creation of new fill contexts
+   std::mutex fMutex;
+   /// The page sink that receives the sealed pages from the fill contexts
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// Needs to be destructed before fSink; its fields are connected to fSink but never filled
+   std::unique_ptr<RNTupleModel> fModel;
+   Detail::RNTupleMetrics fMetrics;
+   /// The fill contexts handed out so far; the ones still alive are committed on destruction of the writer
+   std::vector<std::weak_ptr<RNTupleFillContext>> fFillContexts;
+   /// The number of entries in all the clusters committed so far
+   NTupleSize_t fNEntries = 0;
+
+   /// Appends a cluster of nEntries entries made of the given sealed pages; called by the fill contexts
+   std::uint64_t CommitSealedCluster(std::span<Detail::RPageStorage::RSealedPageGroup> ranges, NTupleSize_t nEntries);
+
+public:
+   /// Throws an exception if the model is null.  Buffered writing is not used by the parallel writer because the
+   /// fill contexts already hand over the pages of entire clusters.
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName, std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model or the sink is null.
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter &) = delete;
+   RNTupleParallelWriter &operator=(const RNTupleParallelWriter &) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Creates a new fill context with its own copy of the model.  Thread-safe.
+   std::shared_ptr<RNTupleFillContext> CreateFillContext();
+   /// Creates a new fill context for a model that was built independently of the writer's model, e.g. because its
+   /// untyped collections are filled through per-thread collection writers, which a copy of the model would share.
+   /// The model must have the same fields as the writer's model, otherwise an exception is thrown.  The model is
+   /// frozen if it is not yet; entries that were created from the frozen model remain valid.  Thread-safe.
+   std::shared_ptr<RNTupleFillContext> CreateFillContext(std::unique_ptr<RNTupleModel> model);
+
+   /// The number of entries in the clusters committed so far by all the fill contexts.  Thread-safe.
+   NTupleSize_t GetNEntries();
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
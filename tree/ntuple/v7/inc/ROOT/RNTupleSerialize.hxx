@@ -65,6 +65,10 @@ public:
    static constexpr std::uint32_t kFlagSortDesColumn     = 0x02;
    static constexpr std::uint32_t kFlagNonNegativeColumn = 0x04;
    static constexpr std::uint32_t kFlagDeferredColumn    = 0x08;
+   static constexpr std::uint32_t kFlagHasValueRange     = 0x10;
+
+   /// Tags of the optional records following the compression settings of a column in the page list
+   static constexpr std::uint32_t kPageListTagValueRanges = 0x01;
 
    static constexpr DescriptorId_t kZeroFieldId = std::uint64_t(-2);
 
@@ -189,6 +193,10 @@ public:
    static std::uint32_t SerializeUInt64(std::uint64_t val, void *buffer);
    static std::uint32_t DeserializeUInt64(const void *buffer, std::uint64_t &val);
 
+   /// Doubles are stored as the IEEE 754 bit pattern in a little-endian 64bit integer
+   static std::uint32_t SerializeDouble(double val, void *buffer);
+   static std::uint32_t DeserializeDouble(const void *buffer, double &val);
+
    static std::uint32_t SerializeString(const std::string &val, void *buffer);
    static RResult<std::uint32_t> DeserializeString(const void *buffer, std::uint32_t bufSize, std::string &val);
 
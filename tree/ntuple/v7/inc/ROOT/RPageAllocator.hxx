@@ -16,11 +16,18 @@
 #ifndef ROOT7_RPageAllocator
 #define ROOT7_RPageAllocator
 
+#include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPage.hxx>
 
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -77,6 +84,79 @@ public:
    static void DeletePage(const RPage &page);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageAllocatorPool
+\ingroup NTuple
+\brief Recycles page buffers in power-of-two size classes instead of returning them to the heap
+
+Reading and writing a cluster allocates and frees a page buffer per page, typically of very few distinct sizes.
+The pool rounds up the requested buffer size to the next power of two between kMinPooledSize and kMaxPooledSize
+and keeps the buffers of deleted pages in a free list per size class, so that the pages of the next cluster reuse
+them.  Larger pages bypass the pool.  The number of bytes kept in the free lists is bounded by the retention limit;
+buffers that would exceed the limit are returned to the heap.
+
+Every size class is protected by its own lock, so that concurrent unzip tasks and page sinks only contend if they
+use pages of the same size class.  The pages keep their requested capacity, i.e. the rounding is invisible to the
+users of the pages.  Pages must be deleted by the same pool that created them.  The global pool is used by
+RPageSource::UnsealPage() and by RPageSinkBuf.
+*/
+// clang-format on
+class RPageAllocatorPool {
+public:
+   static constexpr std::size_t kMinPooledSize = 4 * 1024;
+   static constexpr std::size_t kMaxPooledSize = 16 * 1024 * 1024;
+   static constexpr std::size_t kNSizeClasses = 13;
+   static_assert((kMinPooledSize << (kNSizeClasses - 1)) == kMaxPooledSize, "inconsistent pool size classes");
+   static constexpr std::size_t kDefaultMaxRetained = 256 * 1024 * 1024;
+
+private:
+   struct RSizeClass {
+      std::mutex fLock;
+      std::vector<unsigned char *> fFreeBuffers;
+   };
+
+   /// I/O performance counters that get registered in fMetrics
+   struct RCounters {
+      RNTupleAtomicCounter &fNHit;
+      RNTupleAtomicCounter &fNMiss;
+      RNTupleCalcPerf &fSzRetained;
+   };
+
+   std::array<RSizeClass, kNSizeClasses> fSizeClasses;
+   std::atomic<std::size_t> fMaxRetained;
+   /// The number of bytes in the free lists; kept independently of the counters because they may be disabled
+   std::atomic<std::size_t> fSzRetained{0};
+   RNTupleMetrics fMetrics;
+   std::unique_ptr<RCounters> fCounters;
+
+   /// Returns kNSizeClasses for buffers that are not pooled
+   static std::size_t GetSizeClass(std::size_t nbytes);
+
+public:
+   explicit RPageAllocatorPool(std::size_t maxRetained = kDefaultMaxRetained);
+   RPageAllocatorPool(const RPageAllocatorPool &other) = delete;
+   RPageAllocatorPool &operator=(const RPageAllocatorPool &other) = delete;
+   ~RPageAllocatorPool();
+
+   /// The process-wide pool; it is never destructed so that pages can safely be deleted during static destruction
+   static RPageAllocatorPool &GetGlobal();
+
+   /// Reserves memory large enough to hold nElements of the given size, if possible from a recycled buffer
+   RPage NewPage(ColumnId_t columnId, std::size_t elementSize, std::size_t nElements);
+   /// Puts the memory pointed to by page into the free list of its size class or releases it to the heap
+   void DeletePage(const RPage &page);
+   /// Returns all the retained buffers to the heap
+   void Release();
+
+   /// Buffers that would increase the number of retained bytes beyond the limit are returned to the heap
+   void SetMaxRetained(std::size_t maxRetained);
+   std::size_t GetMaxRetained() const { return fMaxRetained; }
+   std::size_t GetSzRetained() const { return fSzRetained; }
+
+   RNTupleMetrics &GetMetrics() { return fMetrics; }
+};
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
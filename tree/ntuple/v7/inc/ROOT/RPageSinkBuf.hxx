@@ -82,6 +82,7 @@ private:
       bool IsEmpty() const { return fBufferedPages.empty(); }
       bool HasSealedPagesOnly() const { return fBufferedPages.size() == fSealedPages.size(); }
       const RPageStorage::SealedPageSequence_t &GetSealedPages() const { return fSealedPages; }
+      RPageStorage::SealedPageSequence_t &GetSealedPages() { return fSealedPages; }
 
       using BufferedPages_t = std::tuple<std::deque<RPageZipItem>, RPageStorage::SealedPageSequence_t>;
       /// When the return value of DrainBufferedPages() is destroyed, all references
@@ -150,6 +151,11 @@ public:
    void UpdateSchema(const RNTupleModelChangeset &changeset, NTupleSize_t firstEntry) final;
    RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final;
    void ReleasePage(RPage &page) final;
+   /// The pages are written, and thus accounted for, by the inner sink
+   double GetNElementsPerStorageByte(DescriptorId_t physicalColumnId) const final
+   {
+      return fInnerSink->GetNElementsPerStorageByte(physicalColumnId);
+   }
 
    RNTupleMetrics &GetMetrics() final { return fMetrics; }
 };
@@ -107,6 +107,72 @@ public:
    RNTupleMetrics &GetMetrics() final { return fMetrics; }
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSourceChain
+\ingroup NTuple
+\brief Virtual storage that concatenates the entries of several other sources with the same schema
+
+The chain presents the entries of all the sources, in the order of the sources, with a global entry numbering.  The
+schema is taken from the first source; all the other sources must provide the same fields and columns, although
+possibly with different IDs.  The clusters of the sources become the clusters of the chain.  Pages are populated by the
+underlying sources, so that every source uses its own cluster prefetching, and the page windows are shifted by the
+number of elements of the preceding sources.
+*/
+// clang-format on
+class RPageSourceChain final : public RPageSource {
+private:
+   /// Translation of the IDs of the chain to the IDs of a particular source
+   struct RSourceInfo {
+      std::unique_ptr<RPageSource> fSource;
+      /// The first entry of the source in the global entry numbering of the chain
+      NTupleSize_t fFirstEntry = 0;
+      std::unordered_map<DescriptorId_t, DescriptorId_t> fVirtual2OriginField;
+      std::unordered_map<DescriptorId_t, DescriptorId_t> fVirtual2OriginColumn;
+      std::unordered_map<DescriptorId_t, DescriptorId_t> fOrigin2VirtualCluster;
+   };
+   struct ROriginCluster {
+      std::size_t fSourceIdx = 0;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+   };
+
+   RNTupleMetrics fMetrics;
+   std::vector<RSourceInfo> fSources;
+   /// Maps the virtual cluster IDs to the source and the cluster ID within the source
+   std::vector<ROriginCluster> fVirtual2OriginCluster;
+   /// For every physical column, the first element index of the column in every source; the last element of each
+   /// vector is the total number of elements of the column in the chain
+   std::unordered_map<DescriptorId_t, std::vector<NTupleSize_t>> fColumnOffsets;
+
+   /// Returns the index of the source that contains the given element of the virtual column
+   std::size_t FindSourceIdx(DescriptorId_t physicalColumnId, NTupleSize_t globalIndex) const;
+   /// Shifts the window of a page populated by the source with the given index into the ID and index space of the chain
+   void TranslatePage(RPage &page, std::size_t sourceIdx, DescriptorId_t physicalColumnId) const;
+
+protected:
+   RNTupleDescriptor AttachImpl() final;
+
+public:
+   RPageSourceChain(std::string_view ntupleName, std::span<std::unique_ptr<RPageSource>> sources);
+
+   std::unique_ptr<RPageSource> Clone() const final;
+   ~RPageSourceChain() final;
+
+   ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
+   void DropColumn(ColumnHandle_t columnHandle) final;
+
+   RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) final;
+   RPage PopulatePage(ColumnHandle_t columnHandle, const RClusterIndex &clusterIndex) final;
+   void ReleasePage(RPage &page) final;
+
+   void
+   LoadSealedPage(DescriptorId_t physicalColumnId, const RClusterIndex &clusterIndex, RSealedPage &sealedPage) final;
+
+   std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final;
+
+   RNTupleMetrics &GetMetrics() final { return fMetrics; }
+};
+
 
 } // namespace Detail
 } // namespace Experimental
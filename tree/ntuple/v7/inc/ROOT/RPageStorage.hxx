@@ -31,8 +31,10 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <shared_mutex>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace ROOT {
@@ -88,6 +90,8 @@ public:
       const void *fBuffer = nullptr;
       std::uint32_t fSize = 0;
       std::uint32_t fNElements = 0;
+      /// Optional statistics of the page values, see RNTupleWriteOptions::SetHasValueRanges()
+      std::optional<RClusterDescriptor::RValueRange> fValueRange;
 
       RSealedPage() = default;
       RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
@@ -208,6 +212,9 @@ protected:
    std::vector<RClusterDescriptor::RColumnRange> fOpenColumnRanges;
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
+   /// The number of elements and the number of bytes on storage of all the pages committed so far whose size on
+   /// storage is known. Used to estimate the compression ratio of the columns. Indexed by column id.
+   std::vector<std::pair<std::uint64_t, std::uint64_t>> fColumnStorageStats;
    RNTupleDescriptorBuilder fDescriptorBuilder;
 
    virtual void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) = 0;
@@ -239,6 +246,11 @@ protected:
    static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element,
       int compressionSetting, void *buf);
 
+   /// Determines the value range of the elements of the page if value ranges are enabled in the write options
+   /// and the element type supports it; used to fill the optional page statistics.
+   std::optional<RClusterDescriptor::RValueRange> GetValueRange(const RPage &page,
+                                                                const RColumnElementBase &element) const;
+
    /// Enables the default set of metrics provided by RPageSink. `prefix` will be used as the prefix for
    /// the counters registered in the internal RNTupleMetrics object.
    /// This set of counters can be extended by a subclass by calling `fMetrics.MakeCounter<...>()`.
@@ -265,6 +277,8 @@ public:
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
    /// Returns the sink's write options.
    const RNTupleWriteOptions &GetWriteOptions() const { return *fOptions; }
+   /// The descriptor of the ntuple as written so far, i.e. the schema and the committed clusters
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
@@ -297,6 +311,10 @@ public:
    /// the page sink picks an appropriate size.
    virtual RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) = 0;
 
+   /// Returns the average number of elements per byte on storage of the so far committed pages of the given column,
+   /// or zero if not yet known.  Used by columns to adapt their page size to a target size on storage.
+   virtual double GetNElementsPerStorageByte(DescriptorId_t physicalColumnId) const;
+
    /// Returns the default metrics object.  Subclasses might alternatively provide their own metrics object by overriding this.
    RNTupleMetrics &GetMetrics() override { return fMetrics; };
 };
@@ -371,6 +389,7 @@ protected:
       RNTupleAtomicCounter &fNClusterLoaded;
       RNTupleAtomicCounter &fNPageLoaded;
       RNTupleAtomicCounter &fNPagePopulated;
+      RNTupleAtomicCounter &fNPageMapped;
       RNTupleAtomicCounter &fTimeWallRead;
       RNTupleAtomicCounter &fTimeWallUnzip;
       RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpuRead;
@@ -380,6 +399,7 @@ protected:
       RNTupleCalcPerf &fBandwidthUnzip;
       RNTupleCalcPerf &fFractionReadOverhead;
       RNTupleCalcPerf &fCompressionRatio;
+      RNTupleCalcPerf &fReadQueueDepth;
    };
 
    /// Keeps track of the requested physical column IDs. When using alias columns (projected fields), physical
@@ -409,15 +429,25 @@ protected:
    std::unique_ptr<RNTupleDecompressor> fDecompressor;
 
    virtual RNTupleDescriptor AttachImpl() = 0;
+   /// Used by Attach(const RNTupleDescriptor &); page sources that need more than the descriptor from the storage
+   /// keep the default, which reads and deserializes the meta-data again.
+   virtual RNTupleDescriptor AttachWithDescriptorImpl(RNTupleDescriptor && /* desc */) { return AttachImpl(); }
    // Only called if a task scheduler is set. No-op be default.
    virtual void UnzipClusterImpl(RCluster * /* cluster */)
       { }
 
+   /// Helper for the UnzipClusterImpl() of concrete page sources that preload the unzipped pages into a page pool.
+   /// Schedules the decompression of all the on-disk pages of `cluster` in the task scheduler and waits for all
+   /// tasks to finish. The unit of work is a batch of consecutive pages of the same column with approximately
+   /// kUnzipBatchSize uncompressed bytes, so that columns with many small pages do not flood the scheduler with
+   /// tiny tasks while large columns are still spread over several workers.
+   void UnzipClusterPages(const RCluster &cluster, RPagePool &pagePool);
+
    /// Helper for unstreaming a page. This is commonly used in derived, concrete page sources.  The implementation
    /// currently always makes a memory copy, even if the sealed page is uncompressed and in the final memory layout.
    /// The optimization of directly mapping pages is left to the concrete page source implementations.
    /// Usage of this method requires construction of fDecompressor. Memory is allocated via
-   /// `RPageAllocatorHeap`; use `RPageAllocatorHeap::DeletePage()` to deallocate returned pages.
+   /// the global `RPageAllocatorPool`; use `RPageAllocatorPool::GetGlobal().DeletePage()` to deallocate returned pages.
    RPage UnsealPage(const RSealedPage &sealedPage, const RColumnElementBase &element, DescriptorId_t physicalColumnId);
 
    /// Prepare a page range read for the column set in `clusterKey`.  Specifically, pages referencing the
@@ -439,6 +469,9 @@ protected:
    RExclDescriptorGuard GetExclDescriptorGuard() { return RExclDescriptorGuard(fDescriptor, fDescriptorLock); }
 
 public:
+   /// Target size of uncompressed bytes that are decompressed in a single task by UnzipClusterPages()
+   static constexpr std::size_t kUnzipBatchSize = 1024 * 1024;
+
    RPageSource(std::string_view ntupleName, const RNTupleReadOptions &fOptions);
    RPageSource(const RPageSource&) = delete;
    RPageSource& operator=(const RPageSource&) = delete;
@@ -471,9 +504,20 @@ public:
 
    /// Open the physical storage container for the tree
    void Attach() { GetExclDescriptorGuard().MoveIn(AttachImpl()); }
+   /// Open the physical storage container with a copy of the descriptor of another page source that is attached to
+   /// the same ntuple, e.g. the one this page source was cloned from; this saves reading and deserializing the header,
+   /// footer and page lists again
+   void Attach(const RNTupleDescriptor &desc)
+   {
+      GetExclDescriptorGuard().MoveIn(AttachWithDescriptorImpl(std::move(*desc.Clone())));
+   }
    NTupleSize_t GetNEntries();
    NTupleSize_t GetNElements(ColumnHandle_t columnHandle);
    ColumnId_t GetColumnId(ColumnHandle_t columnHandle);
+   /// Returns the IDs of the clusters, in the order of their entries, that may contain values of the given column
+   /// in the closed interval [min, max].  Clusters without value statistics for the column are always returned.
+   /// Used to skip clusters that cannot satisfy a selection, see RNTupleWriteOptions::SetHasValueRanges().
+   std::vector<DescriptorId_t> FindClustersInValueRange(DescriptorId_t physicalColumnId, double min, double max);
 
    /// Allocates and fills a page that contains the index-th element
    virtual RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) = 0;
@@ -25,9 +25,11 @@
 #include <array>
 #include <atomic>
 #include <cstdio>
+#include <map>
 #include <memory>
 #include <string>
 #include <optional>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -56,13 +58,14 @@ using ntuple_index_t = std::uint32_t;
 \ingroup NTuple
 \brief Entry point for an RNTuple in a DAOS container. It encodes essential
 information to read the ntuple; currently, it contains (un)compressed size of
-the header/footer blobs and the object class for user data OIDs.
+the header/footer blobs, the object class for user data OIDs and, since version 1, the size of the list of
+columns that use a different object class.
 The length of a serialized anchor cannot be greater than the value returned by the `GetSize` function.
 */
 // clang-format on
 struct RDaosNTupleAnchor {
    /// Allows for evolving the struct in future versions
-   std::uint32_t fVersion = 0;
+   std::uint32_t fVersion = 1;
    /// The size of the compressed ntuple header
    std::uint32_t fNBytesHeader = 0;
    /// The size of the uncompressed ntuple header
@@ -73,6 +76,9 @@ struct RDaosNTupleAnchor {
    std::uint32_t fLenFooter = 0;
    /// The object class for user data OIDs, e.g. `SX`
    std::string fObjClass{};
+   /// The size of the list of physical columns whose pages use a different object class than `fObjClass`; zero if
+   /// there are none.  Only present since version 1.
+   std::uint32_t fNBytesColumnObjClasses = 0;
 
    bool operator ==(const RDaosNTupleAnchor &other) const {
       return fVersion == other.fVersion &&
@@ -80,7 +86,8 @@ struct RDaosNTupleAnchor {
          fLenHeader == other.fLenHeader &&
          fNBytesFooter == other.fNBytesFooter &&
          fLenFooter == other.fLenFooter &&
-         fObjClass == other.fObjClass;
+         fObjClass == other.fObjClass &&
+         fNBytesColumnObjClasses == other.fNBytesColumnObjClasses;
    }
 
    std::uint32_t Serialize(void *buffer) const;
@@ -138,6 +145,8 @@ struct RDaosContainerNTupleLocator {
 
 Currently, an object is allocated for ntuple metadata (anchor/header/footer).
 Objects can correspond to pages or clusters of pages depending on the RNTuple-DAOS mapping strategy.
+Pages committed one by one are buffered until the cluster is committed and then written by a single vector write,
+whose fetch/update operations are all in flight at the same time in the event queue of the DAOS pool.
 */
 // clang-format on
 class RPageSinkDaos : public RPageSink {
@@ -158,9 +167,24 @@ private:
    /// Tracks the number of bytes committed to the current cluster
    std::uint64_t fNBytesCurrentCluster{0};
 
+   /// A page committed by `CommitSealedPageImpl()` whose write is deferred to `CommitClusterImpl()`
+   struct RPendingPage {
+      DescriptorId_t fPhysicalColumnId = 0;
+      std::uint64_t fPosition = 0;
+      std::unique_ptr<unsigned char[]> fBuffer;
+      std::size_t fSize = 0;
+   };
+   std::vector<RPendingPage> fPendingPages;
+
    RDaosNTupleAnchor fNTupleAnchor;
    ntuple_index_t fNTupleIndex{0};
    uint32_t fCageSizeLimit{};
+   /// The object class of the physical columns that do not use the one of the anchor, see
+   /// `RNTupleWriteOptionsDaos::SetColumnObjectClass()`
+   std::map<DescriptorId_t, std::string> fColumnObjClasses;
+
+   /// Write the pending pages of the current cluster with a single vector write
+   void FlushPendingPages();
 
 protected:
    void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) final;
@@ -173,6 +197,7 @@ protected:
    void CommitDatasetImpl(unsigned char *serializedFooter, std::uint32_t length) final;
    void WriteNTupleHeader(const void *data, size_t nbytes, size_t lenHeader);
    void WriteNTupleFooter(const void *data, size_t nbytes, size_t lenFooter);
+   void WriteColumnObjClasses();
    void WriteNTupleAnchor();
 
 public:
@@ -214,6 +239,8 @@ private:
    std::string fURI;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
+   /// The object class of the physical columns that do not use the one of the anchor
+   std::map<DescriptorId_t, std::string> fColumnObjClasses;
 
    RNTupleDescriptorBuilder fDescriptorBuilder;
 
@@ -242,6 +269,8 @@ public:
 
    /// Return the object class used for user data OIDs in this ntuple.
    std::string GetObjectClass() const;
+   /// Return the object class used for the pages of the given physical column.
+   std::string GetColumnObjectClass(DescriptorId_t physicalColumnId) const;
 };
 
 } // namespace Detail
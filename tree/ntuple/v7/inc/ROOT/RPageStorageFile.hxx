@@ -57,6 +57,10 @@ The written file can be either in ROOT format or in RNTuple bare format.
 */
 // clang-format on
 class RPageSinkFile : public RPageSink {
+public:
+   /// Upper limit for the size of the blob that merges the sealed pages of a vector commit
+   static constexpr std::size_t kMaxSealedPageVBlobSize = 256 * 1024 * 1024;
+
 private:
    std::unique_ptr<RPageAllocatorHeap> fPageAllocator;
 
@@ -73,6 +77,9 @@ protected:
    RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
    RNTupleLocator
    CommitSealedPageImpl(DescriptorId_t physicalColumnId, const RPageStorage::RSealedPage &sealedPage) final;
+   /// Writes the sealed pages of all the ranges into as few blobs as possible, each of them at most
+   /// kMaxSealedPageVBlobSize bytes large (unless a single page is larger)
+   std::vector<RNTupleLocator> CommitSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges) final;
    std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final;
    RNTupleLocator CommitClusterGroupImpl(unsigned char *serializedPageList, std::uint32_t length) final;
    void CommitDatasetImpl(unsigned char *serializedFooter, std::uint32_t length) final;
@@ -125,6 +132,10 @@ private:
    RNTupleDescriptorBuilder fDescriptorBuilder;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
+   /// Read-only mapping of the entire file, only used if requested by RNTupleReadOptions::SetUseMmap()
+   unsigned char *fMappedFile = nullptr;
+   /// The length of fMappedFile, needed to unmap the file again
+   std::size_t fMappedFileSize = 0;
 
    /// Deserialized header and footer into a minimal descriptor held by fDescriptorBuilder
    void InitDescriptor(const Internal::RFileNTupleAnchor &anchor);
@@ -135,6 +146,9 @@ private:
                                                             std::string_view path, const RNTupleReadOptions &options);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo,
                                  ClusterSize_t::ValueType idxInCluster);
+   /// Returns a page that points directly into fMappedFile or a null page if the given page is compressed, has
+   /// a different on-disk representation, or is not suitably aligned in the file
+   RPage MapPage(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo);
 
    /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the
    /// read requests for a given cluster and columns.  The reead requests are appended to
@@ -143,15 +157,19 @@ private:
    std::unique_ptr<RCluster> PrepareSingleCluster(
       const RCluster::RKey &clusterKey,
       std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests);
+   /// Maps the file into memory if requested by the read options and supported by the raw file
+   void MapFile();
 
 protected:
    RNTupleDescriptor AttachImpl() final;
+   RNTupleDescriptor AttachWithDescriptorImpl(RNTupleDescriptor &&desc) final;
    void UnzipClusterImpl(RCluster *cluster) final;
 
 public:
    RPageSourceFile(std::string_view ntupleName, std::string_view path, const RNTupleReadOptions &options);
    /// The cloned page source creates a new raw file and reader and opens its own file descriptor to the data.
-   /// The meta-data (header and footer) is reread and parsed by the clone.
+   /// The meta-data (header and footer) is reread and parsed by the clone, unless the clone is attached with the
+   /// descriptor of this page source.
    std::unique_ptr<RPageSource> Clone() const final;
 
    RPageSourceFile(const RPageSourceFile&) = delete;
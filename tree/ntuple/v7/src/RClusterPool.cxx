@@ -16,6 +16,7 @@
 #include <ROOT/RClusterPool.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RPageStorage.hxx>
+#include <ROOT/RTraceRecorder.hxx>
 
 #include <TError.h>
 
@@ -48,14 +49,29 @@ bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(cons
    return fClusterKey.fClusterId < other.fClusterKey.fClusterId;
 }
 
-ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
+ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize,
+                                                       unsigned int maxBunchesInFlight,
+                                                       const RClusterCachePolicy &policy)
    : fPageSource(pageSource)
+   , fWindowPre(policy.GetLookbehind())
+   , fWindowPost((policy.GetLookahead() > 0) ? (1 + policy.GetLookahead())
+                                              : (1 + maxBunchesInFlight) * clusterBunchSize)
+   , fMaxInFlightBytes(policy.GetMaxInFlightBytes())
    , fClusterBunchSize(clusterBunchSize)
-   , fPool(2 * clusterBunchSize)
+   , fMaxBunchesInFlight(maxBunchesInFlight)
+   , fPool(fWindowPre + fWindowPost)
+   , fMetrics("RClusterPool")
    , fThreadIo(&RClusterPool::ExecReadClusters, this)
    , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
 {
    R__ASSERT(clusterBunchSize > 0);
+   R__ASSERT(maxBunchesInFlight > 0);
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nHit", "",
+                                                    "number of requested clusters that were already in the pool"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nMiss", "",
+                                                    "number of requested clusters that had to be waited for"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nEvict", "", "number of clusters evicted from the pool")});
 }
 
 ROOT::Experimental::Detail::RClusterPool::~RClusterPool()
@@ -95,6 +111,7 @@ void ROOT::Experimental::Detail::RClusterPool::ExecUnzipClusters()
          if (!item.fCluster)
             return;
 
+         R__TRACE_SCOPE_ARG("ntuple", "UnzipCluster", "cluster", item.fCluster->GetId());
          fPageSource.UnzipCluster(item.fCluster.get());
 
          // Afterwards the GetCluster() method in the main thread can pick-up the cluster
@@ -115,8 +132,11 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
       }
 
       while (!readItems.empty()) {
+         // Up to fMaxBunchesInFlight consecutive bunches are combined in a single LoadClusters() call, so that
+         // the page source can submit all the corresponding read requests at once
          std::vector<RCluster::RKey> clusterKeys;
          std::int64_t bunchId = -1;
+         unsigned int nBunches = 0;
          for (unsigned i = 0; i < readItems.size(); ++i) {
             const auto &item = readItems[i];
             // `kInvalidDescriptorId` is used as a marker for thread cancellation. Such item causes the
@@ -125,13 +145,20 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
                R__ASSERT(i == (readItems.size() - 1));
                return;
             }
-            if ((bunchId >= 0) && (item.fBunchId != bunchId))
-               break;
-            bunchId = item.fBunchId;
+            if (item.fBunchId != bunchId) {
+               if (nBunches == fMaxBunchesInFlight)
+                  break;
+               bunchId = item.fBunchId;
+               nBunches++;
+            }
             clusterKeys.emplace_back(item.fClusterKey);
          }
 
-         auto clusters = fPageSource.LoadClusters(clusterKeys);
+         std::vector<std::unique_ptr<RCluster>> clusters;
+         {
+            R__TRACE_SCOPE_ARG("ntuple", "LoadClusters", "clusters", clusterKeys.size());
+            clusters = fPageSource.LoadClusters(clusterKeys);
+         }
          bool unzipQueueDirty = false;
          for (std::size_t i = 0; i < clusters.size(); ++i) {
             // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
@@ -186,6 +213,24 @@ size_t ROOT::Experimental::Detail::RClusterPool::FindFreeSlot() const
 
 namespace {
 
+/// Sums up the bytes on storage of the pages of the given columns in the given cluster
+std::uint64_t EstimateBytesOnStorage(const ROOT::Experimental::RNTupleDescriptor &desc,
+                                     ROOT::Experimental::DescriptorId_t clusterId,
+                                     const ROOT::Experimental::Detail::RCluster::ColumnSet_t &physicalColumns)
+{
+   const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+   std::uint64_t nBytes = 0;
+   for (auto physicalColumnId : physicalColumns) {
+      if (!clusterDesc.ContainsColumn(physicalColumnId))
+         continue;
+      for (const auto &pageInfo : clusterDesc.GetPageRange(physicalColumnId).fPageInfos) {
+         if (pageInfo.fLocator.fType != ROOT::Experimental::RNTupleLocator::kTypePageZero)
+            nBytes += pageInfo.fLocator.fBytesOnStorage;
+      }
+   }
+   return nBytes;
+}
+
 /// Helper class for the (cluster, column list) pairs that should be loaded in the background
 class RProvides {
    using DescriptorId_t = ROOT::Experimental::DescriptorId_t;
@@ -196,6 +241,8 @@ public:
       std::int64_t fBunchId = -1;
       std::int64_t fFlags = 0;
       ColumnSet_t fPhysicalColumnSet;
+      /// Only set if the cluster pool has a byte budget
+      std::uint64_t fNBytesOnStorage = 0;
    };
 
    static constexpr std::int64_t kFlagRequired = 0x01;
@@ -214,6 +261,14 @@ public:
       return fMap.count(clusterId) > 0;
    }
 
+   RInfo *Find(DescriptorId_t clusterId)
+   {
+      auto itr = fMap.find(clusterId);
+      return (itr == fMap.end()) ? nullptr : &itr->second;
+   }
+
+   void Erase(DescriptorId_t clusterId) { fMap.erase(clusterId); }
+
    std::size_t GetSize() const { return fMap.size(); }
 
    void Erase(DescriptorId_t clusterId, const ColumnSet_t &physicalColumns)
@@ -244,6 +299,8 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
 {
    std::set<DescriptorId_t> keep;
    RProvides provide;
+   // The clusters of the look-ahead window, ordered by increasing distance from clusterId
+   std::vector<DescriptorId_t> lookahead;
    {
       auto descriptorGuard = fPageSource.GetSharedDescriptorGuard();
 
@@ -261,8 +318,8 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
       provideInfo.fPhysicalColumnSet = physicalColumns;
       provideInfo.fBunchId = fBunchId;
       provideInfo.fFlags = RProvides::kFlagRequired;
-      for (DescriptorId_t i = 0, next = clusterId; i < 2 * fClusterBunchSize; ++i) {
-         if (i == fClusterBunchSize)
+      for (DescriptorId_t i = 0, next = clusterId; i < fWindowPost; ++i) {
+         if ((i > 0) && (i % fClusterBunchSize == 0))
             provideInfo.fBunchId = ++fBunchId;
 
          auto cid = next;
@@ -271,6 +328,7 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
             provideInfo.fFlags |= RProvides::kFlagLast;
 
          provide.Insert(cid, provideInfo);
+         lookahead.emplace_back(cid);
 
          if (next == kInvalidDescriptorId)
             break;
@@ -287,6 +345,7 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
       if (keep.count(cptr->GetId()) > 0)
          continue;
       cptr.reset();
+      fCounters->fNEvict.Inc();
    }
 
    // Move clusters that meanwhile arrived into cache pool
@@ -329,6 +388,41 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
          itr = fInFlightClusters.erase(itr);
       }
 
+      // Count the request as a hit if it can be served without waiting for I/O
+      auto requested = FindInPool(clusterId);
+      if (requested && std::all_of(physicalColumns.begin(), physicalColumns.end(),
+                                   [requested](DescriptorId_t id) { return requested->ContainsColumn(id); })) {
+         fCounters->fNHit.Inc();
+      } else {
+         fCounters->fNMiss.Inc();
+      }
+
+      std::uint64_t nBytesUsed = 0;
+      if (fMaxInFlightBytes > 0) {
+         // The descriptor guard is a shared lock; the pipeline threads never take fLockWorkQueue while holding it
+         auto descriptorGuard = fPageSource.GetSharedDescriptorGuard();
+         for (const auto &inFlight : fInFlightClusters) {
+            if (!inFlight.fIsExpired)
+               nBytesUsed += inFlight.fNBytesOnStorage;
+         }
+         for (const auto &cptr : fPool) {
+            if (!cptr)
+               continue;
+            nBytesUsed +=
+               EstimateBytesOnStorage(descriptorGuard.GetRef(), cptr->GetId(), cptr->GetAvailPhysicalColumns());
+         }
+         // The columns of the requested cluster that are neither in flight nor in the pool
+         std::uint64_t nBytesRequired = 0;
+         if (auto info = provide.Find(clusterId)) {
+            RCluster::ColumnSet_t missing;
+            std::copy_if(info->fPhysicalColumnSet.begin(), info->fPhysicalColumnSet.end(),
+                         std::inserter(missing, missing.end()),
+                         [requested](DescriptorId_t id) { return !requested || !requested->ContainsColumn(id); });
+            nBytesRequired = EstimateBytesOnStorage(descriptorGuard.GetRef(), clusterId, missing);
+         }
+         EvictForBudget(clusterId, physicalColumns, lookahead, nBytesRequired, nBytesUsed);
+      }
+
       // Determine clusters which get triggered for background loading
       for (auto &cptr : fPool) {
          if (!cptr)
@@ -336,6 +430,29 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
          provide.Erase(cptr->GetId(), cptr->GetAvailPhysicalColumns());
       }
 
+      // Within the byte budget, preload the clusters of the look-ahead window in order; the requested cluster is
+      // always loaded
+      if (fMaxInFlightBytes > 0) {
+         auto descriptorGuard = fPageSource.GetSharedDescriptorGuard();
+         bool isBudgetExhausted = false;
+         for (auto cid : lookahead) {
+            auto info = provide.Find(cid);
+            if (!info)
+               continue;
+            if (isBudgetExhausted) {
+               provide.Erase(cid);
+               continue;
+            }
+            info->fNBytesOnStorage = EstimateBytesOnStorage(descriptorGuard.GetRef(), cid, info->fPhysicalColumnSet);
+            if ((cid != clusterId) && (nBytesUsed + info->fNBytesOnStorage > fMaxInFlightBytes)) {
+               isBudgetExhausted = true;
+               provide.Erase(cid);
+               continue;
+            }
+            nBytesUsed += info->fNBytesOnStorage;
+         }
+      }
+
       // Figure out if enough work accumulated to justify I/O calls
       bool skipPrefetch = false;
       if (provide.GetSize() < fClusterBunchSize) {
@@ -364,6 +481,7 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
             RInFlightCluster inFlightCluster;
             inFlightCluster.fClusterKey.fClusterId = kv.first;
             inFlightCluster.fClusterKey.fPhysicalColumnSet = kv.second.fPhysicalColumnSet;
+            inFlightCluster.fNBytesOnStorage = kv.second.fNBytesOnStorage;
             inFlightCluster.fFuture = readItem.fPromise.get_future();
             fInFlightClusters.emplace_back(std::move(inFlightCluster));
 
@@ -377,6 +495,67 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
    return WaitFor(clusterId, physicalColumns);
 }
 
+void ROOT::Experimental::Detail::RClusterPool::EvictForBudget(DescriptorId_t clusterId,
+                                                              const RCluster::ColumnSet_t &physicalColumns,
+                                                              const std::vector<DescriptorId_t> &lookahead,
+                                                              std::uint64_t nBytesRequired, std::uint64_t &nBytesUsed)
+{
+   if (nBytesUsed + nBytesRequired <= fMaxInFlightBytes)
+      return;
+
+   // Eviction order: clusters without any of the active columns first, then the clusters of the look-back window,
+   // then the clusters of the look-ahead window; within these groups, the clusters furthest away go first.
+   struct RCandidate {
+      std::size_t fSlot;
+      bool fHasActiveColumn;
+      bool fIsLookahead;
+      std::size_t fDistance;
+      std::uint64_t fNBytesOnStorage;
+   };
+   std::vector<RCandidate> candidates;
+   {
+      auto descriptorGuard = fPageSource.GetSharedDescriptorGuard();
+      for (std::size_t i = 0; i < fPool.size(); ++i) {
+         if (!fPool[i] || (fPool[i]->GetId() == clusterId))
+            continue;
+         RCandidate candidate;
+         candidate.fSlot = i;
+         candidate.fHasActiveColumn =
+            std::any_of(physicalColumns.begin(), physicalColumns.end(),
+                        [cptr = fPool[i].get()](DescriptorId_t id) { return cptr->ContainsColumn(id); });
+         auto itrLookahead = std::find(lookahead.begin(), lookahead.end(), fPool[i]->GetId());
+         candidate.fIsLookahead = (itrLookahead != lookahead.end());
+         candidate.fDistance = candidate.fIsLookahead ? std::distance(lookahead.begin(), itrLookahead) : 0;
+         if (!candidate.fIsLookahead) {
+            // Look-back cluster: determine its distance from the requested cluster
+            auto prev = clusterId;
+            while (prev != kInvalidDescriptorId && prev != fPool[i]->GetId()) {
+               prev = descriptorGuard->FindPrevClusterId(prev);
+               candidate.fDistance++;
+            }
+         }
+         candidate.fNBytesOnStorage =
+            EstimateBytesOnStorage(descriptorGuard.GetRef(), fPool[i]->GetId(), fPool[i]->GetAvailPhysicalColumns());
+         candidates.emplace_back(candidate);
+      }
+   }
+   std::sort(candidates.begin(), candidates.end(), [](const RCandidate &a, const RCandidate &b) {
+      if (a.fHasActiveColumn != b.fHasActiveColumn)
+         return !a.fHasActiveColumn;
+      if (a.fIsLookahead != b.fIsLookahead)
+         return !a.fIsLookahead;
+      return a.fDistance > b.fDistance;
+   });
+
+   for (const auto &candidate : candidates) {
+      if (nBytesUsed + nBytesRequired <= fMaxInFlightBytes)
+         break;
+      fPool[candidate.fSlot].reset();
+      nBytesUsed -= std::min(nBytesUsed, candidate.fNBytesOnStorage);
+      fCounters->fNEvict.Inc();
+   }
+}
+
 ROOT::Experimental::Detail::RCluster *
 ROOT::Experimental::Detail::RClusterPool::WaitFor(DescriptorId_t clusterId,
                                                   const RCluster::ColumnSet_t &physicalColumns)
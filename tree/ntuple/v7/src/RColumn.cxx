@@ -20,6 +20,10 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 ROOT::Experimental::Detail::RColumn::RColumn(const RColumnModel& model, std::uint32_t index)
    : fModel(model), fIndex(index)
 {
@@ -87,6 +91,35 @@ void ROOT::Experimental::Detail::RColumn::Flush()
    R__ASSERT(fWritePage[otherIdx].IsEmpty());
    fPageSink->CommitPage(fHandleSink, fWritePage[fWritePageIdx]);
    fWritePage[fWritePageIdx].Reset(fNElements);
+
+   AdaptPageSize();
+}
+
+void ROOT::Experimental::Detail::RColumn::AdaptPageSize()
+{
+   const auto &writeOpts = fPageSink->GetWriteOptions();
+   const auto zippedPageSize = writeOpts.GetApproxZippedPageSize();
+   if (zippedPageSize == 0)
+      return;
+   const auto nElementsPerByte = fPageSink->GetNElementsPerStorageByte(fHandleSink.fPhysicalId);
+   if (nElementsPerByte == 0.0)
+      return;
+
+   // The write pages are 50% larger than the target size and must not exceed the maximum cluster size
+   const double maxNElements = 2. * writeOpts.GetMaxUnzippedClusterSize() / 3. / fElement->GetSize();
+   const auto nElements = std::max(
+      2., std::min(maxNElements, std::min<double>(std::numeric_limits<std::uint32_t>::max() / 2,
+                                                  nElementsPerByte * zippedPageSize)));
+   // Avoid reallocating the write pages for small fluctuations of the compression ratio
+   if (std::abs(nElements - fApproxNElementsPerPage) < 0.1 * fApproxNElementsPerPage)
+      return;
+
+   fApproxNElementsPerPage = static_cast<std::uint32_t>(nElements);
+   for (auto &page : fWritePage) {
+      fPageSink->ReleasePage(page);
+      page = fPageSink->ReservePage(fHandleSink, fApproxNElementsPerPage + fApproxNElementsPerPage / 2);
+   }
+   fWritePage[fWritePageIdx].Reset(fNElements);
 }
 
 void ROOT::Experimental::Detail::RColumn::MapPage(const NTupleSize_t index)
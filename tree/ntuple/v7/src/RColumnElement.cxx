@@ -36,6 +36,7 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate<void>(EColumnType type)
    case EColumnType::kBit: return std::make_unique<RColumnElement<bool, EColumnType::kBit>>();
    case EColumnType::kReal64: return std::make_unique<RColumnElement<double, EColumnType::kReal64>>();
    case EColumnType::kReal32: return std::make_unique<RColumnElement<float, EColumnType::kReal32>>();
+   case EColumnType::kReal16: return std::make_unique<RColumnElement<float, EColumnType::kReal16>>();
    case EColumnType::kInt64: return std::make_unique<RColumnElement<std::int64_t, EColumnType::kInt64>>();
    case EColumnType::kUInt64: return std::make_unique<RColumnElement<std::uint64_t, EColumnType::kUInt64>>();
    case EColumnType::kInt32: return std::make_unique<RColumnElement<std::int32_t, EColumnType::kInt32>>();
@@ -56,6 +57,8 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate<void>(EColumnType type)
    case EColumnType::kSplitUInt32: return std::make_unique<RColumnElement<std::uint32_t, EColumnType::kSplitUInt32>>();
    case EColumnType::kSplitInt16: return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>();
    case EColumnType::kSplitUInt16: return std::make_unique<RColumnElement<std::uint16_t, EColumnType::kSplitUInt16>>();
+   case EColumnType::kReal32Trunc: return std::make_unique<RColumnElement<float, EColumnType::kReal32Trunc>>();
+   case EColumnType::kReal32Quant: return std::make_unique<RColumnElement<float, EColumnType::kReal32Quant>>();
    default: R__ASSERT(false);
    }
    // never here
@@ -72,6 +75,7 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
    case EColumnType::kBit: return 1;
    case EColumnType::kReal64: return 64;
    case EColumnType::kReal32: return 32;
+   case EColumnType::kReal16: return 16;
    case EColumnType::kInt64: return 64;
    case EColumnType::kUInt64: return 64;
    case EColumnType::kInt32: return 32;
@@ -90,12 +94,29 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
    case EColumnType::kSplitUInt32: return 32;
    case EColumnType::kSplitInt16: return 16;
    case EColumnType::kSplitUInt16: return 16;
+   case EColumnType::kReal32Trunc: return 32;
+   case EColumnType::kReal32Quant: return 32;
    default: R__ASSERT(false);
    }
    // never here
    return 0;
 }
 
+std::pair<std::size_t, std::size_t>
+ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(EColumnType type)
+{
+   switch (type) {
+   case EColumnType::kReal32Trunc:
+      return {RColumnElementTruncReal32<float>::kMinBitsOnStorage, RColumnElementTruncReal32<float>::kMaxBitsOnStorage};
+   case EColumnType::kReal32Quant:
+      return {RColumnElementQuantReal32<float>::kMinBitsOnStorage, RColumnElementQuantReal32<float>::kMaxBitsOnStorage};
+   default: {
+      const auto bitsOnStorage = GetBitsOnStorage(type);
+      return {bitsOnStorage, bitsOnStorage};
+   }
+   }
+}
+
 std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnType type) {
    switch (type) {
    case EColumnType::kIndex64: return "Index64";
@@ -106,6 +127,7 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
    case EColumnType::kBit: return "Bit";
    case EColumnType::kReal64: return "Real64";
    case EColumnType::kReal32: return "Real32";
+   case EColumnType::kReal16: return "Real16";
    case EColumnType::kInt64: return "Int64";
    case EColumnType::kUInt64: return "UInt64";
    case EColumnType::kInt32: return "Int32";
@@ -124,6 +146,8 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
    case EColumnType::kSplitUInt32: return "SplitUInt32";
    case EColumnType::kSplitInt16: return "SplitInt16";
    case EColumnType::kSplitUInt16: return "SplitUInt16";
+   case EColumnType::kReal32Trunc: return "Real32Trunc";
+   case EColumnType::kReal32Quant: return "Real32Quant";
    default: return "UNKNOWN";
    }
 }
@@ -244,7 +244,7 @@ int ROOT::Experimental::Detail::RDaosContainer::VectorReadWrite(MultiObjectRWOpe
 
    for (auto &[key, batch] : map) {
       requests.emplace_back(
-         std::make_unique<RDaosObject>(*this, batch.fOid, cid.fCid),
+         std::make_unique<RDaosObject>(*this, batch.fOid, batch.fCid.IsUnknown() ? cid.fCid : batch.fCid.fCid),
          RDaosObject::FetchUpdateArgs{batch.fDistributionKey, batch.fDataRequests, /*is_async=*/true});
 
       if ((ret = fPool->fEventQueue->InitializeEvent(std::get<1>(requests.back()).GetEventPointer(), &parent_event)) <
@@ -41,12 +41,14 @@
 #include <algorithm>
 #include <cctype> // for isspace
 #include <charconv>
+#include <cmath>
 #include <cstdint>
 #include <cstdlib> // for malloc, free
 #include <cstring> // for memset
 #include <exception>
 #include <iostream>
 #include <new> // hardware_destructive_interference_size
+#include <optional>
 #include <type_traits>
 #include <unordered_map>
 
@@ -198,8 +200,8 @@ std::tuple<void **, std::int32_t *, std::int32_t *> GetRVecDataMembers(void *rve
    std::int32_t *size = reinterpret_cast<std::int32_t *>(begin + 1);
    R__ASSERT(*size >= 0);
    // int32_t fCapacity is the third data member (1 int32_t after fSize)
+   // (-1 for an RVec adopting memory, < -1 for a buffer allocated in an RVecArena)
    std::int32_t *capacity = size + 1;
-   R__ASSERT(*capacity >= -1);
    return {begin, size, capacity};
 }
 
@@ -220,6 +222,39 @@ void SyncFieldIDs(const ROOT::Experimental::Detail::RFieldBase &from, ROOT::Expe
    }
 }
 
+/// Builds the column model of a float or double field, taking into account the width and the value range of truncated
+/// and quantized representations
+ROOT::Experimental::RColumnModel
+MakeRealColumnModel(ROOT::Experimental::EColumnType type, std::uint16_t bitsOnStorage,
+                    const std::optional<ROOT::Experimental::RColumnModel::ValueRange_t> &valueRange)
+{
+   using ROOT::Experimental::EColumnType;
+   switch (type) {
+   case EColumnType::kReal32Trunc: return ROOT::Experimental::RColumnModel(type, false, bitsOnStorage);
+   case EColumnType::kReal32Quant:
+      if (!valueRange)
+         throw ROOT::Experimental::RException(R__FAIL("quantized floats require a value range, use SetQuantized()"));
+      return ROOT::Experimental::RColumnModel(type, false, bitsOnStorage, valueRange);
+   default: return ROOT::Experimental::RColumnModel(type);
+   }
+}
+
+/// Throws if nBits is not a valid width for the given column type
+void EnsureValidBitsOnStorage(ROOT::Experimental::EColumnType type, std::size_t nBits)
+{
+   const auto validRange = ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(type);
+   if (nBits < validRange.first || nBits > validRange.second) {
+      throw ROOT::Experimental::RException(R__FAIL("invalid number of bits on storage: " + std::to_string(nBits)));
+   }
+}
+
+/// Throws if [min, max] is not a valid, non-empty interval for quantized floats
+void EnsureValidQuantRange(double min, double max)
+{
+   if (!std::isfinite(min) || !std::isfinite(max) || !(min < max))
+      throw ROOT::Experimental::RException(R__FAIL("invalid value range for quantized floats"));
+}
+
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -247,7 +282,8 @@ ROOT::Experimental::Detail::RFieldBase::RBulk::RBulk(RBulk &&other)
      fCapacity(other.fCapacity),
      fSize(other.fSize),
      fNValidValues(other.fNValidValues),
-     fFirstIndex(other.fFirstIndex)
+     fFirstIndex(other.fFirstIndex),
+     fAuxData(std::move(other.fAuxData))
 {
    std::swap(fValues, other.fValues);
    std::swap(fMaskAvail, other.fMaskAvail);
@@ -263,6 +299,7 @@ ROOT::Experimental::Detail::RFieldBase::RBulk &ROOT::Experimental::Detail::RFiel
    std::swap(fMaskAvail, other.fMaskAvail);
    std::swap(fNValidValues, other.fNValidValues);
    std::swap(fFirstIndex, other.fFirstIndex);
+   std::swap(fAuxData, other.fAuxData);
    return *this;
 }
 
@@ -966,19 +1003,27 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<float>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitReal32}, {EColumnType::kReal32}}, {});
+   static RColumnRepresentations representations({{EColumnType::kSplitReal32},
+                                                  {EColumnType::kReal32},
+                                                  {EColumnType::kReal16},
+                                                  {EColumnType::kReal32Trunc},
+                                                  {EColumnType::kReal32Quant}},
+                                                 {});
    return representations;
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
-   fColumns.emplace_back(Detail::RColumn::Create<float>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   fColumns.emplace_back(Detail::RColumn::Create<float>(
+      MakeRealColumnModel(GetColumnRepresentative()[0], fColumnBitsOnStorage, fColumnValueRange), 0));
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
-   fColumns.emplace_back(Detail::RColumn::Create<float>(RColumnModel(onDiskTypes[0]), 0));
+   EnsureCompatibleColumnTypes(desc);
+   // The on-disk column model carries the width and the value range of truncated and quantized columns
+   const auto &columnModel = desc.GetColumnDescriptor(desc.FindLogicalColumnId(GetOnDiskId(), 0)).GetModel();
+   fColumns.emplace_back(Detail::RColumn::Create<float>(columnModel, 0));
 }
 
 void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -986,26 +1031,56 @@ void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &vis
    visitor.VisitFloatField(*this);
 }
 
+void ROOT::Experimental::RField<float>::SetHalfPrecision()
+{
+   SetColumnRepresentative({EColumnType::kReal16});
+}
+
+void ROOT::Experimental::RField<float>::SetTruncated(std::size_t nBits)
+{
+   EnsureValidBitsOnStorage(EColumnType::kReal32Trunc, nBits);
+   SetColumnRepresentative({EColumnType::kReal32Trunc});
+   fColumnBitsOnStorage = nBits;
+}
+
+void ROOT::Experimental::RField<float>::SetQuantized(double min, double max, std::size_t nBits)
+{
+   EnsureValidBitsOnStorage(EColumnType::kReal32Quant, nBits);
+   EnsureValidQuantRange(min, max);
+   SetColumnRepresentative({EColumnType::kReal32Quant});
+   fColumnBitsOnStorage = nBits;
+   fColumnValueRange = RColumnModel::ValueRange_t(min, max);
+}
+
 
 //------------------------------------------------------------------------------
 
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<double>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitReal64}, {EColumnType::kReal64}, {EColumnType::kSplitReal32}, {EColumnType::kReal32}}, {});
+   static RColumnRepresentations representations({{EColumnType::kSplitReal64},
+                                                  {EColumnType::kReal64},
+                                                  {EColumnType::kSplitReal32},
+                                                  {EColumnType::kReal32},
+                                                  {EColumnType::kReal16},
+                                                  {EColumnType::kReal32Trunc},
+                                                  {EColumnType::kReal32Quant}},
+                                                 {});
    return representations;
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl()
 {
-   fColumns.emplace_back(Detail::RColumn::Create<double>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   fColumns.emplace_back(Detail::RColumn::Create<double>(
+      MakeRealColumnModel(GetColumnRepresentative()[0], fColumnBitsOnStorage, fColumnValueRange), 0));
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
-   fColumns.emplace_back(Detail::RColumn::Create<double>(RColumnModel(onDiskTypes[0]), 0));
+   EnsureCompatibleColumnTypes(desc);
+   // The on-disk column model carries the width and the value range of truncated and quantized columns
+   const auto &columnModel = desc.GetColumnDescriptor(desc.FindLogicalColumnId(GetOnDiskId(), 0)).GetModel();
+   fColumns.emplace_back(Detail::RColumn::Create<double>(columnModel, 0));
 }
 
 void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -1018,6 +1093,27 @@ void ROOT::Experimental::RField<double>::SetDouble32()
    fTypeAlias = "Double32_t";
 }
 
+void ROOT::Experimental::RField<double>::SetHalfPrecision()
+{
+   SetColumnRepresentative({EColumnType::kReal16});
+}
+
+void ROOT::Experimental::RField<double>::SetTruncated(std::size_t nBits)
+{
+   EnsureValidBitsOnStorage(EColumnType::kReal32Trunc, nBits);
+   SetColumnRepresentative({EColumnType::kReal32Trunc});
+   fColumnBitsOnStorage = nBits;
+}
+
+void ROOT::Experimental::RField<double>::SetQuantized(double min, double max, std::size_t nBits)
+{
+   EnsureValidBitsOnStorage(EColumnType::kReal32Quant, nBits);
+   EnsureValidQuantRange(min, max);
+   SetColumnRepresentative({EColumnType::kReal32Quant});
+   fColumnBitsOnStorage = nBits;
+   fColumnValueRange = RColumnModel::ValueRange_t(min, max);
+}
+
 //------------------------------------------------------------------------------
 
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
@@ -1996,7 +2092,7 @@ void ROOT::Experimental::RRVecField::ReadGlobalImpl(NTupleSize_t globalIndex, vo
       }
 
       // TODO Increment capacity by a factor rather than just enough to fit the elements.
-      if (owns) {
+      if (owns && *capacityPtr >= 0) {
          // *beginPtr points to the array of item values (allocated in an earlier call by the following malloc())
          free(*beginPtr);
       }
@@ -2144,8 +2240,9 @@ void ROOT::Experimental::RRVecField::DestroyValue(void *objPtr, bool dtorOnly) c
       paddingMiddle = alignOfT - paddingMiddle;
    const bool isSmall = (reinterpret_cast<void *>(begin) == (beginPtr + dataMemberSz + paddingMiddle));
 
+   // buffers in an RVecArena (capacity < -1) are released by resetting the arena
    const bool owns = (*capacityPtr != -1);
-   if (!isSmall && owns)
+   if (!isSmall && owns && *capacityPtr >= 0)
       free(begin);
 
    if (!dtorOnly)
@@ -2637,6 +2734,8 @@ void ROOT::Experimental::RNullableField::GenerateColumnsImpl()
    if (IsDense()) {
       fDefaultItemValue = std::make_unique<RValue>(fSubFields[0]->GenerateValue());
       fColumns.emplace_back(Detail::RColumn::Create<bool>(RColumnModel(EColumnType::kBit), 0));
+   } else if (IsCompact()) {
+      fColumns.emplace_back(Detail::RColumn::Create<bool>(RColumnModel(EColumnType::kBit), 0));
    } else {
       fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(GetColumnRepresentative()[0]), 0));
    }
@@ -2646,6 +2745,7 @@ void ROOT::Experimental::RNullableField::GenerateColumnsImpl(const RNTupleDescri
 {
    auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
    if (onDiskTypes[0] == EColumnType::kBit) {
+      fIsCompact = desc.GetFieldDescriptor(GetOnDiskId()).GetFieldVersion() >= 1;
       fColumns.emplace_back(Detail::RColumn::Create<bool>(RColumnModel(EColumnType::kBit), 0));
    } else {
       fColumns.emplace_back(Detail::RColumn::Create<ClusterSize_t>(RColumnModel(onDiskTypes[0]), 0));
@@ -2658,6 +2758,10 @@ std::size_t ROOT::Experimental::RNullableField::AppendNull()
       bool mask = false;
       fPrincipalColumn->Append(&mask);
       return 1 + CallAppendOn(*fSubFields[0], fDefaultItemValue->GetRawPtr());
+   } else if (IsCompact()) {
+      bool mask = false;
+      fPrincipalColumn->Append(&mask);
+      return 1;
    } else {
       fPrincipalColumn->Append(&fNWritten);
       return sizeof(ClusterSize_t);
@@ -2667,7 +2771,7 @@ std::size_t ROOT::Experimental::RNullableField::AppendNull()
 std::size_t ROOT::Experimental::RNullableField::AppendValue(const void *from)
 {
    auto nbytesItem = CallAppendOn(*fSubFields[0], from);
-   if (IsDense()) {
+   if (IsDense() || IsCompact()) {
       bool mask = true;
       fPrincipalColumn->Append(&mask);
       return 1 + nbytesItem;
@@ -2684,6 +2788,11 @@ ROOT::Experimental::RClusterIndex ROOT::Experimental::RNullableField::GetItemInd
    if (IsDense()) {
       const bool isValidItem = *fPrincipalColumn->Map<bool>(globalIndex);
       return isValidItem ? fPrincipalColumn->GetClusterIndex(globalIndex) : nullIndex;
+   } else if (IsCompact()) {
+      if (!*fPrincipalColumn->Map<bool>(globalIndex))
+         return nullIndex;
+      const auto clusterIndex = fPrincipalColumn->GetClusterIndex(globalIndex);
+      return RClusterIndex(clusterIndex.GetClusterId(), GetRank(clusterIndex));
    } else {
       RClusterIndex collectionStart;
       ClusterSize_t collectionSize;
@@ -2692,6 +2801,25 @@ ROOT::Experimental::RClusterIndex ROOT::Experimental::RNullableField::GetItemInd
    }
 }
 
+ROOT::Experimental::ClusterSize_t::ValueType
+ROOT::Experimental::RNullableField::GetRank(const RClusterIndex &clusterIndex)
+{
+   if (clusterIndex.GetClusterId() != fRankClusterId || clusterIndex.GetIndex() < fRankIndex) {
+      fRankClusterId = clusterIndex.GetClusterId();
+      fRankIndex = 0;
+      fRank = 0;
+   }
+   // Count the set bits page by page from the last counted entry
+   while (fRankIndex < clusterIndex.GetIndex()) {
+      NTupleSize_t nItems;
+      const bool *mask = fPrincipalColumn->MapV<bool>(RClusterIndex(fRankClusterId, fRankIndex), nItems);
+      nItems = std::min<NTupleSize_t>(nItems, clusterIndex.GetIndex() - fRankIndex);
+      fRank += std::count(mask, mask + nItems, true);
+      fRankIndex += nItems;
+   }
+   return fRank;
+}
+
 void ROOT::Experimental::RNullableField::AcceptVisitor(Detail::RFieldVisitor &visitor) const
 {
    visitor.VisitNullableField(*this);
@@ -2709,7 +2837,10 @@ std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
 ROOT::Experimental::RUniquePtrField::CloneImpl(std::string_view newName) const
 {
    auto newItemField = fSubFields[0]->Clone(fSubFields[0]->GetName());
-   return std::make_unique<RUniquePtrField>(newName, GetType(), std::move(newItemField));
+   auto clone = std::make_unique<RUniquePtrField>(newName, GetType(), std::move(newItemField));
+   if (IsCompact())
+      clone->SetCompact();
+   return clone;
 }
 
 std::size_t ROOT::Experimental::RUniquePtrField::AppendImpl(const void *from)
@@ -17,6 +17,7 @@
 
 #include "ROOT/RMiniFile.hxx"
 
+#include <ROOT/RFileWriteEngine.hxx>
 #include <ROOT/RRawFile.hxx>
 #include <ROOT/RNTuple.hxx> // For converting an anchor to an RNTuple object
 #include <ROOT/RNTupleZip.hxx>
@@ -29,10 +30,18 @@
 #include <cstdio>
 #include <cstring>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <chrono>
 
+#include <fcntl.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 namespace {
 
 // The following types are used to read and write the TFile binary format
@@ -1091,12 +1100,28 @@ ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::~RFileSimple()
 {
    if (fFile)
       fclose(fFile);
+   // Writes the remaining data before the descriptor is closed
+   fWriteEngine.reset();
+   if (fFileDes >= 0)
+      close(fFileDes);
 }
 
 
 void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::Write(
    const void *buffer, size_t nbytes, std::int64_t offset)
 {
+   if (fWriteEngine) {
+      if (offset >= 0)
+         fFilePos = offset;
+      try {
+         fWriteEngine->Write(buffer, nbytes, fFilePos);
+      } catch (const std::runtime_error &e) {
+         throw RException(R__FAIL(e.what()));
+      }
+      fFilePos += nbytes;
+      return;
+   }
+
    R__ASSERT(fFile);
    size_t retval;
    if ((offset >= 0) && (static_cast<std::uint64_t>(offset) != fFilePos)) {
@@ -1114,6 +1139,20 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::Write(
 }
 
 
+void ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::Flush()
+{
+   if (!fWriteEngine) {
+      fflush(fFile);
+      return;
+   }
+   try {
+      fWriteEngine->Flush();
+   } catch (const std::runtime_error &e) {
+      throw RException(R__FAIL(e.what()));
+   }
+}
+
+
 std::uint64_t ROOT::Experimental::Internal::RNTupleFileWriter::RFileSimple::WriteKey(
    const void *buffer, std::size_t nbytes, std::size_t len, std::int64_t offset,
    std::uint64_t directoryOffset,
@@ -1201,23 +1240,38 @@ ROOT::Experimental::Internal::RNTupleFileWriter::~RNTupleFileWriter()
 
 
 ROOT::Experimental::Internal::RNTupleFileWriter *ROOT::Experimental::Internal::RNTupleFileWriter::Recreate(
-   std::string_view ntupleName, std::string_view path, int defaultCompression, ENTupleContainerFormat containerFormat)
+   std::string_view ntupleName, std::string_view path, int defaultCompression, ENTupleContainerFormat containerFormat,
+   const RNTupleWriteOptions *writeOptions)
 {
    std::string fileName(path);
    size_t idxDirSep = fileName.find_last_of("\\/");
    if (idxDirSep != std::string::npos) {
       fileName.erase(0, idxDirSep + 1);
    }
+   auto writer = new RNTupleFileWriter(ntupleName);
+   writer->fFileName = fileName;
+
+   if (writeOptions && writeOptions->GetUseWriteEngine()) {
+#ifdef _WIN32
+      const int fileDes = _open(std::string(path).c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, 0644);
+#else
+      const int fileDes = open(std::string(path).c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+#endif
+      R__ASSERT(fileDes >= 0);
+      ROOT::Internal::RFileWriteEngine::ROptions engineOptions;
+      engineOptions.fDirectIO = writeOptions->GetUseDirectIO();
+      engineOptions.fSyncInterval = writeOptions->GetSyncInterval();
+      writer->fFileSimple.fFileDes = fileDes;
+      writer->fFileSimple.fWriteEngine = std::make_unique<ROOT::Internal::RFileWriteEngine>(fileDes, engineOptions);
+   } else {
 #ifdef R__SEEK64
-   FILE *fileStream = fopen64(std::string(path.data(), path.size()).c_str(), "wb");
+      FILE *fileStream = fopen64(std::string(path.data(), path.size()).c_str(), "wb");
 #else
-   FILE *fileStream = fopen(std::string(path.data(), path.size()).c_str(), "wb");
+      FILE *fileStream = fopen(std::string(path.data(), path.size()).c_str(), "wb");
 #endif
-   R__ASSERT(fileStream);
-
-   auto writer = new RNTupleFileWriter(ntupleName);
-   writer->fFileSimple.fFile = fileStream;
-   writer->fFileName = fileName;
+      R__ASSERT(fileStream);
+      writer->fFileSimple.fFile = fileStream;
+   }
 
    switch (containerFormat) {
    case ENTupleContainerFormat::kTFile:
@@ -1272,7 +1326,7 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::Commit()
    if (fIsBare) {
       RTFNTuple ntupleOnDisk(fNTupleAnchor);
       fFileSimple.Write(&ntupleOnDisk, ntupleOnDisk.GetSize(), fFileSimple.fControlBlock->fSeekNTuple);
-      fflush(fFileSimple.fFile);
+      fFileSimple.Flush();
       return;
    }
 
@@ -1285,7 +1339,7 @@ void ROOT::Experimental::Internal::RNTupleFileWriter::Commit()
    fFileSimple.Write(&fFileSimple.fControlBlock->fHeader, fFileSimple.fControlBlock->fHeader.GetSize(), 0);
    fFileSimple.Write(&fFileSimple.fControlBlock->fFileRecord, fFileSimple.fControlBlock->fFileRecord.GetSize(),
                      fFileSimple.fControlBlock->fSeekFileRecord);
-   fflush(fFileSimple.fFile);
+   fFileSimple.Flush();
 }
 
 
@@ -82,7 +82,8 @@ void ROOT::Experimental::RNTupleReader::ConnectModel(const RNTupleModel &model)
 void ROOT::Experimental::RNTupleReader::InitPageSource()
 {
 #ifdef R__USE_IMT
-   if (IsImplicitMTEnabled()) {
+   if (IsImplicitMTEnabled() &&
+       fSource->GetReadOptions().GetUseImplicitMT() == RNTupleReadOptions::EImplicitMT::kDefault) {
       fUnzipTasks = std::make_unique<RNTupleImtTaskScheduler>();
       fSource->SetTaskScheduler(fUnzipTasks.get());
    }
@@ -150,6 +151,19 @@ ROOT::Experimental::RNTupleReader::OpenFriends(std::span<ROpenSpec> ntuples)
    return std::make_unique<RNTupleReader>(std::make_unique<Detail::RPageSourceFriends>("_friends", sources));
 }
 
+std::unique_ptr<ROOT::Experimental::RNTupleReader>
+ROOT::Experimental::RNTupleReader::OpenChain(std::span<ROpenSpec> ntuples)
+{
+   if (ntuples.empty())
+      throw RException(R__FAIL("empty chain of RNTuples"));
+   std::vector<std::unique_ptr<Detail::RPageSource>> sources;
+   for (const auto &n : ntuples) {
+      sources.emplace_back(Detail::RPageSource::Create(n.fNTupleName, n.fStorage, n.fOptions));
+   }
+   return std::make_unique<RNTupleReader>(
+      std::make_unique<Detail::RPageSourceChain>(ntuples[0].fNTupleName, sources));
+}
+
 ROOT::Experimental::RNTupleModel *ROOT::Experimental::RNTupleReader::GetModel()
 {
    if (!fModel) {
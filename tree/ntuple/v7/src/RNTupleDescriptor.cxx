@@ -358,6 +358,28 @@ ROOT::Experimental::RNTupleDescriptor::FindPrevClusterId(DescriptorId_t clusterI
    return kInvalidDescriptorId;
 }
 
+std::vector<ROOT::Experimental::DescriptorId_t>
+ROOT::Experimental::RNTupleDescriptor::FindClustersInValueRange(DescriptorId_t physicalColumnId, double min,
+                                                                double max) const
+{
+   std::vector<std::pair<NTupleSize_t, DescriptorId_t>> clusters;
+   for (const auto &clusterDesc : GetClusterIterable()) {
+      if (clusterDesc.HasPageLocations() && clusterDesc.ContainsColumn(physicalColumnId)) {
+         const auto &valueRange = clusterDesc.GetColumnRange(physicalColumnId).fValueRange;
+         if (valueRange && !valueRange->Overlaps(min, max))
+            continue;
+      }
+      clusters.emplace_back(clusterDesc.GetFirstEntryIndex(), clusterDesc.GetId());
+   }
+   std::sort(clusters.begin(), clusters.end());
+
+   std::vector<DescriptorId_t> result;
+   result.reserve(clusters.size());
+   for (const auto &c : clusters)
+      result.emplace_back(c.second);
+   return result;
+}
+
 std::vector<ROOT::Experimental::DescriptorId_t>
 ROOT::Experimental::RNTupleDescriptor::RHeaderExtension::GetTopLevelFields(const RNTupleDescriptor &desc) const
 {
@@ -502,9 +524,24 @@ ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(DescriptorId_t
       return R__FAIL("column ID conflict");
    RClusterDescriptor::RColumnRange columnRange{physicalId, firstElementIndex, RClusterSize(0)};
    columnRange.fCompressionSettings = compressionSettings;
+   // The column range has a value range only if all of its pages have one
+   bool hasValueRange = !pageRange.fPageInfos.empty();
+   RClusterDescriptor::RValueRange valueRange;
    for (const auto &pi : pageRange.fPageInfos) {
       columnRange.fNElements += pi.fNElements;
+      if (!hasValueRange)
+         continue;
+      if (!pi.fValueRange) {
+         hasValueRange = false;
+      } else if (&pi == &pageRange.fPageInfos.front()) {
+         valueRange = *pi.fValueRange;
+      } else {
+         valueRange.fMin = std::min(valueRange.fMin, pi.fValueRange->fMin);
+         valueRange.fMax = std::max(valueRange.fMax, pi.fValueRange->fMax);
+      }
    }
+   if (hasValueRange)
+      columnRange.fValueRange = valueRange;
    fCluster.fPageRanges[physicalId] = pageRange.Clone();
    fCluster.fColumnRanges[physicalId] = columnRange;
    return RResult<void>::Success();
@@ -553,8 +590,10 @@ ROOT::Experimental::RClusterDescriptorBuilder::AddDeferredColumnRanges(const RNT
                if (c.IsDeferredColumn()) {
                   columnRange.fFirstElementIndex = fCluster.GetFirstEntryIndex() * nRepetitions;
                   columnRange.fNElements = fCluster.GetNEntries() * nRepetitions;
-                  const auto element = Detail::RColumnElementBase::Generate<void>(c.GetModel().GetType());
-                  pageRange.ExtendToFitColumnRange(columnRange, *element, Detail::RPage::kPageZeroSize);
+                  const auto element = Detail::RColumnElementBase::Generate<void>(c.GetModel());
+                  // The synthesized zero pages carry no value statistics
+                  if (pageRange.ExtendToFitColumnRange(columnRange, *element, Detail::RPage::kPageZeroSize) > 0)
+                     columnRange.fValueRange.reset();
                }
             }
          },
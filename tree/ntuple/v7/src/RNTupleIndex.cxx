@@ -0,0 +1,281 @@
+/// \file RNTupleIndex.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RNTupleIndex.hxx>
+
+#include <ROOT/RError.hxx>
+#include <ROOT/RField.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <utility>
+
+namespace {
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::NTupleSize_t;
+using ROOT::Experimental::RException;
+using ROOT::Experimental::RNTupleIndex;
+using ROOT::Experimental::Detail::RFieldBase;
+using ROOT::Experimental::Detail::RPageSource;
+
+using KeyConverter_t = std::uint64_t (*)(const void *);
+
+template <typename T>
+std::uint64_t ConvertKey(const void *from)
+{
+   return static_cast<std::uint64_t>(*static_cast<const T *>(from));
+}
+
+KeyConverter_t GetKeyConverter(const std::string &typeName)
+{
+   if (typeName == "bool")
+      return ConvertKey<bool>;
+   if (typeName == "char")
+      return ConvertKey<char>;
+   if (typeName == "std::int8_t")
+      return ConvertKey<std::int8_t>;
+   if (typeName == "std::uint8_t")
+      return ConvertKey<std::uint8_t>;
+   if (typeName == "std::int16_t")
+      return ConvertKey<std::int16_t>;
+   if (typeName == "std::uint16_t")
+      return ConvertKey<std::uint16_t>;
+   if (typeName == "std::int32_t")
+      return ConvertKey<std::int32_t>;
+   if (typeName == "std::uint32_t")
+      return ConvertKey<std::uint32_t>;
+   if (typeName == "std::int64_t")
+      return ConvertKey<std::int64_t>;
+   if (typeName == "std::uint64_t")
+      return ConvertKey<std::uint64_t>;
+   return nullptr;
+}
+
+/// Reads the values of an integral key field from a page source and converts them to the index key type
+class RKeyReader {
+private:
+   std::unique_ptr<RFieldBase> fField;
+   RFieldBase::RValue fValue;
+   KeyConverter_t fConverter;
+
+public:
+   RKeyReader(std::unique_ptr<RFieldBase> field, KeyConverter_t converter)
+      : fField(std::move(field)), fValue(fField->GenerateValue()), fConverter(converter)
+   {
+   }
+
+   void Connect(DescriptorId_t fieldId, RPageSource &pageSource)
+   {
+      fField->SetOnDiskId(fieldId);
+      fField->ConnectPageSource(pageSource);
+   }
+
+   std::uint64_t operator()(NTupleSize_t globalIndex)
+   {
+      fValue.Read(globalIndex);
+      return fConverter(fValue.GetRawPtr());
+   }
+};
+
+/// Appends the index entries of the given clusters, reading the key fields from the attached page source
+void IndexClusters(const std::vector<DescriptorId_t> &fieldIds, const std::vector<DescriptorId_t> &clusterIds,
+                   RPageSource &pageSource, std::vector<RNTupleIndex::RIndexEntry> &entries)
+{
+   std::vector<RKeyReader> keyReaders;
+   std::vector<std::pair<NTupleSize_t, NTupleSize_t>> entryRanges;
+   {
+      auto descriptorGuard = pageSource.GetSharedDescriptorGuard();
+      for (auto fieldId : fieldIds) {
+         const auto &fieldDesc = descriptorGuard->GetFieldDescriptor(fieldId);
+         keyReaders.emplace_back(RFieldBase::Create(fieldDesc.GetFieldName(), fieldDesc.GetTypeName()).Unwrap(),
+                                 GetKeyConverter(fieldDesc.GetTypeName()));
+      }
+      for (auto clusterId : clusterIds) {
+         const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+         entryRanges.emplace_back(clusterDesc.GetFirstEntryIndex(), clusterDesc.GetNEntries());
+      }
+   }
+   // Connecting the fields acquires the descriptor lock by itself
+   for (std::size_t i = 0; i < fieldIds.size(); ++i)
+      keyReaders[i].Connect(fieldIds[i], pageSource);
+
+   for (const auto &[firstEntry, nEntries] : entryRanges) {
+      for (auto i = firstEntry; i < firstEntry + nEntries; ++i) {
+         RNTupleIndex::RIndexEntry indexEntry;
+         indexEntry.fKey0 = keyReaders[0](i);
+         if (keyReaders.size() > 1)
+            indexEntry.fKey1 = keyReaders[1](i);
+         indexEntry.fEntryIndex = i;
+         entries.emplace_back(indexEntry);
+      }
+   }
+}
+
+} // anonymous namespace
+
+std::unique_ptr<ROOT::Experimental::RNTupleIndex>
+ROOT::Experimental::RNTupleIndex::Create(const std::vector<std::string> &fieldNames, Detail::RPageSource &pageSource,
+                                         unsigned int nThreads)
+{
+   if (fieldNames.empty() || fieldNames.size() > 2)
+      throw RException(R__FAIL("an ntuple index requires one or two key fields"));
+   if (nThreads == 0)
+      nThreads = 1;
+
+   std::vector<DescriptorId_t> fieldIds;
+   std::vector<DescriptorId_t> clusterIds;
+   NTupleSize_t nEntries = 0;
+   {
+      auto descriptorGuard = pageSource.GetSharedDescriptorGuard();
+      for (const auto &name : fieldNames) {
+         auto fieldId = descriptorGuard->FindFieldId(name);
+         if (fieldId == kInvalidDescriptorId)
+            throw RException(R__FAIL("no such key field: " + name));
+         const auto &typeName = descriptorGuard->GetFieldDescriptor(fieldId).GetTypeName();
+         if (!GetKeyConverter(typeName))
+            throw RException(R__FAIL("key field " + name + " has non-integral type " + typeName));
+         fieldIds.emplace_back(fieldId);
+      }
+      for (const auto &clusterDesc : descriptorGuard->GetClusterIterable())
+         clusterIds.emplace_back(clusterDesc.GetId());
+      nEntries = descriptorGuard->GetNEntries();
+   }
+
+   auto index = std::unique_ptr<RNTupleIndex>(new RNTupleIndex(fieldNames));
+   index->fEntries.reserve(nEntries);
+
+   nThreads = std::min<std::size_t>(nThreads, clusterIds.size());
+   if (nThreads <= 1) {
+      IndexClusters(fieldIds, clusterIds, pageSource, index->fEntries);
+   } else {
+      // Consecutive clusters are assigned to the same thread so that every thread reads a contiguous part of the file
+      std::vector<std::vector<RIndexEntry>> threadEntries(nThreads);
+      std::vector<std::unique_ptr<Detail::RPageSource>> threadSources;
+      std::vector<std::thread> threads;
+      std::vector<std::exception_ptr> threadErrors(nThreads);
+      for (unsigned int t = 0; t < nThreads; ++t)
+         threadSources.emplace_back(pageSource.Clone());
+      for (unsigned int t = 0; t < nThreads; ++t) {
+         const auto first = clusterIds.size() * t / nThreads;
+         const auto last = clusterIds.size() * (t + 1) / nThreads;
+         threads.emplace_back([&, t, first, last]() {
+            try {
+               std::vector<DescriptorId_t> threadClusterIds(clusterIds.begin() + first, clusterIds.begin() + last);
+               threadSources[t]->Attach();
+               IndexClusters(fieldIds, threadClusterIds, *threadSources[t], threadEntries[t]);
+            } catch (...) {
+               threadErrors[t] = std::current_exception();
+            }
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+      for (unsigned int t = 0; t < nThreads; ++t) {
+         if (threadErrors[t])
+            std::rethrow_exception(threadErrors[t]);
+         index->fEntries.insert(index->fEntries.end(), threadEntries[t].begin(), threadEntries[t].end());
+      }
+   }
+
+   std::sort(index->fEntries.begin(), index->fEntries.end());
+   return index;
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleIndex>
+ROOT::Experimental::RNTupleIndex::Open(std::string_view indexName, std::string_view storage)
+{
+   auto reader = RNTupleReader::Open(indexName, storage);
+
+   std::vector<std::string> fieldNames;
+   {
+      const auto &desc = *reader->GetDescriptor();
+      for (const auto name : {"key0", "key1"}) {
+         auto fieldId = desc.FindFieldId(name);
+         if (fieldId == kInvalidDescriptorId)
+            throw RException(R__FAIL("not an ntuple index: " + std::string(indexName)));
+         auto fieldName = desc.GetFieldDescriptor(fieldId).GetFieldDescription();
+         if (!fieldName.empty())
+            fieldNames.emplace_back(fieldName);
+      }
+   }
+   if (fieldNames.empty())
+      throw RException(R__FAIL("not an ntuple index: " + std::string(indexName)));
+
+   auto index = std::unique_ptr<RNTupleIndex>(new RNTupleIndex(fieldNames));
+   auto viewKey0 = reader->GetView<std::uint64_t>("key0");
+   auto viewKey1 = reader->GetView<std::uint64_t>("key1");
+   auto viewEntry = reader->GetView<std::uint64_t>("entry");
+   index->fEntries.reserve(reader->GetNEntries());
+   for (auto i : reader->GetEntryRange()) {
+      RIndexEntry indexEntry;
+      indexEntry.fKey0 = viewKey0(i);
+      indexEntry.fKey1 = viewKey1(i);
+      indexEntry.fEntryIndex = viewEntry(i);
+      index->fEntries.emplace_back(indexEntry);
+   }
+   // The index is written in sorted order; sorting again is cheap and protects against foreign writers
+   if (!std::is_sorted(index->fEntries.begin(), index->fEntries.end()))
+      std::sort(index->fEntries.begin(), index->fEntries.end());
+   return index;
+}
+
+void ROOT::Experimental::RNTupleIndex::Write(std::string_view indexName, TFile &file) const
+{
+   auto model = RNTupleModel::Create();
+   auto key0 = model->MakeField<std::uint64_t>({"key0", fFieldNames[0]});
+   auto key1 = model->MakeField<std::uint64_t>({"key1", fFieldNames.size() > 1 ? fFieldNames[1] : ""});
+   auto entry = model->MakeField<std::uint64_t>("entry");
+
+   auto writer = RNTupleWriter::Append(std::move(model), indexName, file);
+   for (const auto &indexEntry : fEntries) {
+      *key0 = indexEntry.fKey0;
+      *key1 = indexEntry.fKey1;
+      *entry = indexEntry.fEntryIndex;
+      writer->Fill();
+   }
+}
+
+ROOT::Experimental::NTupleSize_t
+ROOT::Experimental::RNTupleIndex::GetEntryIndex(std::uint64_t key0, std::uint64_t key1) const
+{
+   RIndexEntry probe;
+   probe.fKey0 = key0;
+   probe.fKey1 = key1;
+   probe.fEntryIndex = 0;
+   auto itr = std::lower_bound(fEntries.begin(), fEntries.end(), probe);
+   if (itr == fEntries.end() || itr->fKey0 != key0 || itr->fKey1 != key1)
+      return kInvalidNTupleIndex;
+   return itr->fEntryIndex;
+}
+
+std::vector<ROOT::Experimental::NTupleSize_t>
+ROOT::Experimental::RNTupleIndex::GetAllEntryIndexes(std::uint64_t key0, std::uint64_t key1) const
+{
+   RIndexEntry probe;
+   probe.fKey0 = key0;
+   probe.fKey1 = key1;
+   probe.fEntryIndex = 0;
+   std::vector<NTupleSize_t> result;
+   for (auto itr = std::lower_bound(fEntries.begin(), fEntries.end(), probe);
+        itr != fEntries.end() && itr->fKey0 == key0 && itr->fKey1 == key1; ++itr) {
+      result.emplace_back(itr->fEntryIndex);
+   }
+   return result;
+}
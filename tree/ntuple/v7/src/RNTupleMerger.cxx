@@ -13,11 +13,118 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RClusterPool.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
+#include <ROOT/RField.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPage.hxx>
+#include <ROOT/RPageStorage.hxx>
+#ifdef R__USE_IMT
+#include <ROOT/TTaskGroup.hxx>
+#endif
+
+#include <TROOT.h> // for IsImplicitMTEnabled()
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::EColumnType;
+using ROOT::Experimental::kInvalidDescriptorId;
+using ROOT::Experimental::NTupleSize_t;
+using ROOT::Experimental::RColumnModel;
+using ROOT::Experimental::RException;
+using ROOT::Experimental::RField;
+using ROOT::Experimental::RNTupleDescriptor;
+using ROOT::Experimental::RNTupleModel;
+using ROOT::Experimental::Detail::RColumnElementBase;
+using ROOT::Experimental::Detail::RFieldBase;
+using ROOT::Experimental::Detail::RPageStorage;
+
+struct RColumnInfo {
+   DescriptorId_t fPhysicalColumnId = kInvalidDescriptorId;
+   RColumnModel fModel;
+};
+
+/// Maps the qualified field name and the column index, separated by '#', to the physical columns of the ntuple
+std::unordered_map<std::string, RColumnInfo> CollectColumns(const RNTupleDescriptor &desc)
+{
+   std::unordered_map<std::string, RColumnInfo> columns;
+   for (const auto &columnDesc : desc.GetColumnIterable()) {
+      if (columnDesc.IsAliasColumn())
+         continue;
+      const auto key =
+         desc.GetQualifiedFieldName(columnDesc.GetFieldId()) + "#" + std::to_string(columnDesc.GetIndex());
+      columns[key] = RColumnInfo{columnDesc.GetPhysicalId(), columnDesc.GetModel()};
+   }
+   return columns;
+}
+
+/// The fields of a model generated from a descriptor use their default column representation.  For byte-wise page
+/// copies, the destination needs to use the column representation of the source instead.
+void ApplyOnDiskColumnModels(RFieldBase &field, const RNTupleDescriptor &desc)
+{
+   if (field.GetOnDiskId() == kInvalidDescriptorId)
+      return;
+
+   std::vector<RColumnModel> columnModels;
+   RFieldBase::ColumnRepresentation_t onDiskRepresentation;
+   for (std::uint32_t i = 0;; ++i) {
+      const auto columnId = desc.FindLogicalColumnId(field.GetOnDiskId(), i);
+      if (columnId == kInvalidDescriptorId)
+         break;
+      columnModels.emplace_back(desc.GetColumnDescriptor(columnId).GetModel());
+      onDiskRepresentation.emplace_back(columnModels.back().GetType());
+   }
+   if (onDiskRepresentation.empty() || onDiskRepresentation == field.GetColumnRepresentative())
+      return;
+
+   const auto &model = columnModels[0];
+   const auto nBits = model.GetBitsOnStorage();
+   if (auto floatField = dynamic_cast<RField<float> *>(&field)) {
+      if (model.GetType() == EColumnType::kReal32Trunc)
+         return floatField->SetTruncated(nBits);
+      if (model.GetType() == EColumnType::kReal32Quant)
+         return floatField->SetQuantized(model.GetValueRange()->first, model.GetValueRange()->second, nBits);
+   }
+   if (auto doubleField = dynamic_cast<RField<double> *>(&field)) {
+      if (model.GetType() == EColumnType::kReal32Trunc)
+         return doubleField->SetTruncated(nBits);
+      if (model.GetType() == EColumnType::kReal32Quant)
+         return doubleField->SetQuantized(model.GetValueRange()->first, model.GetValueRange()->second, nBits);
+   }
+   field.SetColumnRepresentative(onDiskRepresentation);
+}
+
+/// Decompresses the sealed page and compresses it again with the given compression settings into a new buffer
+void RecompressSealedPage(RPageStorage::RSealedPage &sealedPage, const RColumnElementBase &element, int compression,
+                          std::unique_ptr<unsigned char[]> &buffer)
+{
+   using ROOT::Experimental::Detail::RNTupleCompressor;
+   using ROOT::Experimental::Detail::RNTupleDecompressor;
+
+   const auto bytesPacked = element.GetPackedSize(sealedPage.fNElements);
+   auto unzipBuffer = std::make_unique<unsigned char[]>(bytesPacked);
+   RNTupleDecompressor::Unzip(sealedPage.fBuffer, sealedPage.fSize, bytesPacked, unzipBuffer.get());
+   buffer = std::make_unique<unsigned char[]>(bytesPacked);
+   sealedPage.fSize = RNTupleCompressor::Zip(unzipBuffer.get(), bytesPacked, compression, buffer.get());
+   sealedPage.fBuffer = buffer.get();
+}
+
+} // anonymous namespace
 
 Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
    if (inputs == nullptr || mergeInfo == nullptr) {
@@ -36,3 +143,132 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+////////////////////////////////////////////////////////////////////////////////
+
+void ROOT::Experimental::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination)
+{
+   if (sources.empty())
+      throw RException(R__FAIL("no sources to merge"));
+
+   for (auto source : sources)
+      source->Attach();
+
+   // The first source determines the schema of the destination
+   std::unique_ptr<RNTupleModel> model;
+   {
+      auto descriptorGuard = sources[0]->GetSharedDescriptorGuard();
+      model = descriptorGuard->GenerateModel();
+      for (auto &field : *model->GetFieldZero())
+         ApplyOnDiskColumnModels(field, descriptorGuard.GetRef());
+   }
+   destination.Create(*model);
+   const auto dstColumns = CollectColumns(destination.GetDescriptor());
+   const auto dstCompression = destination.GetWriteOptions().GetCompression();
+
+   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> taskScheduler;
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled())
+      taskScheduler = std::make_unique<RNTupleImtTaskScheduler>();
+#endif
+
+   NTupleSize_t nEntries = 0;
+   for (auto source : sources) {
+      // For every destination column, the source column and the element used to recompress pages
+      struct RColumnMapping {
+         DescriptorId_t fSrcColumnId;
+         DescriptorId_t fDstColumnId;
+         std::unique_ptr<Detail::RColumnElementBase> fElement;
+      };
+      std::vector<RColumnMapping> columnMappings;
+      Detail::RCluster::ColumnSet_t srcColumnIds;
+      std::vector<DescriptorId_t> clusterIds;
+      {
+         auto descriptorGuard = source->GetSharedDescriptorGuard();
+         const auto srcColumns = CollectColumns(descriptorGuard.GetRef());
+         if (srcColumns.size() != dstColumns.size())
+            throw RException(R__FAIL("cannot merge ntuple " + descriptorGuard->GetName() + ": schema mismatch"));
+         for (const auto &[key, dstInfo] : dstColumns) {
+            auto itr = srcColumns.find(key);
+            if (itr == srcColumns.end() || !(itr->second.fModel == dstInfo.fModel)) {
+               throw RException(R__FAIL("cannot merge ntuple " + descriptorGuard->GetName() +
+                                        ": schema mismatch for column " + key));
+            }
+            columnMappings.emplace_back(RColumnMapping{itr->second.fPhysicalColumnId, dstInfo.fPhysicalColumnId,
+                                                       Detail::RColumnElementBase::Generate(dstInfo.fModel)});
+            srcColumnIds.insert(itr->second.fPhysicalColumnId);
+         }
+         for (const auto &clusterDesc : descriptorGuard->GetClusterIterable())
+            clusterIds.emplace_back(clusterDesc.GetId());
+         std::sort(clusterIds.begin(), clusterIds.end(), [&descriptorGuard](DescriptorId_t a, DescriptorId_t b) {
+            return descriptorGuard->GetClusterDescriptor(a).GetFirstEntryIndex() <
+                   descriptorGuard->GetClusterDescriptor(b).GetFirstEntryIndex();
+         });
+      }
+
+      // The cluster pool reads the following clusters in the background while the current one is copied
+      const auto &readOptions = source->GetReadOptions();
+      Detail::RClusterPool clusterPool(*source, readOptions.GetClusterBunchSize(),
+                                       readOptions.GetMaxClusterBunchesInFlight(),
+                                       readOptions.GetClusterCachePolicy());
+
+      for (auto clusterId : clusterIds) {
+         auto cluster = clusterPool.GetCluster(clusterId, srcColumnIds);
+         const auto clusterDesc = source->GetSharedDescriptorGuard()->GetClusterDescriptor(clusterId).Clone();
+
+         std::deque<Detail::RPageStorage::SealedPageSequence_t> sealedPages;
+         std::vector<Detail::RPageStorage::RSealedPageGroup> sealedPageGroups;
+         // Owns the buffers of the recompressed pages
+         std::deque<std::unique_ptr<unsigned char[]>> recompressedBuffers;
+
+         for (const auto &mapping : columnMappings) {
+            if (!clusterDesc.ContainsColumn(mapping.fSrcColumnId)) {
+               throw RException(R__FAIL("cannot merge ntuple " + source->GetSharedDescriptorGuard()->GetName() +
+                                        ": cluster without column"));
+            }
+            const auto &columnRange = clusterDesc.GetColumnRange(mapping.fSrcColumnId);
+            const auto needsRecompression = columnRange.fCompressionSettings != dstCompression;
+
+            auto &columnPages = sealedPages.emplace_back();
+            const auto &pageRange = clusterDesc.GetPageRange(mapping.fSrcColumnId);
+            std::uint64_t pageNo = 0;
+            for (const auto &pageInfo : pageRange.fPageInfos) {
+               auto &sealedPage = columnPages.emplace_back();
+               sealedPage.fNElements = pageInfo.fNElements;
+               sealedPage.fValueRange = pageInfo.fValueRange;
+               sealedPage.fSize = pageInfo.fLocator.fBytesOnStorage;
+               if (pageInfo.fLocator.fType == RNTupleLocator::kTypePageZero) {
+                  sealedPage.fBuffer = Detail::RPage::GetPageZeroBuffer();
+               } else {
+                  auto onDiskPage = cluster->GetOnDiskPage(Detail::ROnDiskPage::Key{mapping.fSrcColumnId, pageNo});
+                  R__ASSERT(onDiskPage && (onDiskPage->GetSize() == sealedPage.fSize));
+                  sealedPage.fBuffer = onDiskPage->GetAddress();
+               }
+               ++pageNo;
+
+               if (!needsRecompression)
+                  continue;
+               auto &buffer = recompressedBuffers.emplace_back();
+               auto fnRecompress = [&sealedPage, &mapping, &buffer, dstCompression]() {
+                  RecompressSealedPage(sealedPage, *mapping.fElement, dstCompression, buffer);
+               };
+               if (taskScheduler)
+                  taskScheduler->AddTask(fnRecompress);
+               else
+                  fnRecompress();
+            }
+            sealedPageGroups.emplace_back(mapping.fDstColumnId, columnPages.cbegin(), columnPages.cend());
+         }
+         if (taskScheduler) {
+            taskScheduler->Wait();
+            taskScheduler->Reset();
+         }
+
+         destination.CommitSealedPageV(sealedPageGroups);
+         nEntries += clusterDesc.GetNEntries();
+         destination.CommitCluster(nEntries);
+      }
+   }
+   destination.CommitClusterGroup();
+   destination.CommitDataset();
+}
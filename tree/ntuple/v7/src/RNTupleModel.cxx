@@ -308,6 +308,21 @@ ROOT::Experimental::RNTupleModel::GetField(std::string_view fieldName) const
    return field;
 }
 
+ROOT::Experimental::Detail::RFieldBase::RBulk
+ROOT::Experimental::RNTupleModel::CreateBulk(std::string_view fieldName) const
+{
+   if (!IsFrozen())
+      throw RException(R__FAIL("invalid attempt to create bulk of unfrozen model"));
+
+   auto field = const_cast<Detail::RFieldBase *>(GetField(fieldName));
+   if (!field)
+      throw RException(R__FAIL("invalid field name: " + std::string(fieldName)));
+   if (field->GetState() != Detail::RFieldBase::EState::kConnectedToSource)
+      throw RException(R__FAIL("invalid attempt to create bulk of field not connected to a page source: " +
+                               std::string(fieldName)));
+   return field->GenerateBulk();
+}
+
 ROOT::Experimental::REntry *ROOT::Experimental::RNTupleModel::GetDefaultEntry() const
 {
    if (!IsFrozen())
@@ -0,0 +1,310 @@
+/// \file RNTupleParallelWriter.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RNTupleParallelWriter.hxx>
+
+#include <ROOT/RLogger.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <utility>
+
+namespace {
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::NTupleSize_t;
+using ROOT::Experimental::RException;
+using ROOT::Experimental::RNTupleLocator;
+using ROOT::Experimental::RNTupleModel;
+using ROOT::Experimental::RNTupleWriteOptions;
+using ROOT::Experimental::Detail::RPage;
+using ROOT::Experimental::Detail::RPageAllocatorHeap;
+using ROOT::Experimental::Detail::RPageSink;
+using ROOT::Experimental::Detail::RPageStorage;
+
+/// The private page sink of a fill context.  It seals the committed pages right away, in the filling thread, and
+/// keeps them until the cluster is committed.  Then the sealed pages are forwarded to the parallel writer by means
+/// of the commit function.  The fields of the fill context's model are connected to this sink; since the model is
+/// a copy of the writer's model, the physical column ids match the ones of the writer's sink.
+class RPageSinkFillContext final : public RPageSink {
+public:
+   using CommitFunc_t = std::function<std::uint64_t(std::span<RSealedPageGroup>, NTupleSize_t)>;
+
+private:
+   /// The sealed pages of a column in the currently open cluster together with their buffers
+   struct RColumnSeal {
+      RColumnSeal() = default;
+      RColumnSeal(const RColumnSeal &) = delete;
+      RColumnSeal &operator=(const RColumnSeal &) = delete;
+      RColumnSeal(RColumnSeal &&) = default;
+      RColumnSeal &operator=(RColumnSeal &&) = default;
+
+      SealedPageSequence_t fSealedPages;
+      std::vector<std::unique_ptr<unsigned char[]>> fBuffers;
+   };
+
+   CommitFunc_t fCommitFunc;
+   /// Indexed by physical column id
+   std::vector<RColumnSeal> fColumns;
+
+   void AddSealedPage(DescriptorId_t physicalColumnId, const void *buffer, std::uint32_t size,
+                      std::uint32_t nElements)
+   {
+      auto &column = fColumns.at(physicalColumnId);
+      column.fBuffers.emplace_back(std::make_unique<unsigned char[]>(size));
+      memcpy(column.fBuffers.back().get(), buffer, size);
+      column.fSealedPages.emplace_back(column.fBuffers.back().get(), size, nElements);
+   }
+
+protected:
+   void CreateImpl(const RNTupleModel & /* model */, unsigned char * /* serializedHeader */,
+                   std::uint32_t /* length */) final
+   {
+      fColumns.resize(fDescriptorBuilder.GetDescriptor().GetNPhysicalColumns());
+   }
+
+   RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final
+   {
+      auto buffer = std::make_unique<unsigned char[]>(page.GetNBytes());
+      auto sealedPage =
+         SealPage(page, *columnHandle.fColumn->GetElement(), GetWriteOptions().GetCompression(), buffer.get());
+      if (sealedPage.fBuffer == buffer.get()) {
+         auto &column = fColumns.at(columnHandle.fPhysicalId);
+         column.fBuffers.emplace_back(std::move(buffer));
+         column.fSealedPages.emplace_back(std::move(sealedPage));
+      } else {
+         // Uncompressed, mappable pages are not copied by SealPage()
+         AddSealedPage(columnHandle.fPhysicalId, sealedPage.fBuffer, sealedPage.fSize, sealedPage.fNElements);
+      }
+      // The locators of the private sink are never written out; the size is used for the compression statistics
+      RNTupleLocator locator;
+      locator.fBytesOnStorage = fColumns.at(columnHandle.fPhysicalId).fSealedPages.back().fSize;
+      return locator;
+   }
+
+   RNTupleLocator CommitSealedPageImpl(DescriptorId_t physicalColumnId, const RSealedPage &sealedPage) final
+   {
+      AddSealedPage(physicalColumnId, sealedPage.fBuffer, sealedPage.fSize, sealedPage.fNElements);
+      return RNTupleLocator{};
+   }
+
+   std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final
+   {
+      std::vector<RSealedPageGroup> toCommit;
+      toCommit.reserve(fColumns.size());
+      for (DescriptorId_t i = 0; i < fColumns.size(); ++i) {
+         auto &sealedPages = fColumns[i].fSealedPages;
+         // The page value ranges, if any, were determined by RPageSink::CommitPage()
+         const auto &pageInfos = fOpenPageRanges.at(i).fPageInfos;
+         R__ASSERT(pageInfos.size() == sealedPages.size());
+         for (std::size_t j = 0; j < sealedPages.size(); ++j)
+            sealedPages[j].fValueRange = pageInfos[j].fValueRange;
+         toCommit.emplace_back(i, sealedPages.cbegin(), sealedPages.cend());
+      }
+      auto nbytes = fCommitFunc(toCommit, nEntries - fPrevClusterNEntries);
+      for (auto &column : fColumns) {
+         column.fSealedPages.clear();
+         column.fBuffers.clear();
+      }
+      return nbytes;
+   }
+
+   RNTupleLocator CommitClusterGroupImpl(unsigned char * /* serializedPageList */, std::uint32_t /* length */) final
+   {
+      return RNTupleLocator{};
+   }
+
+   void CommitDatasetImpl(unsigned char * /* serializedFooter */, std::uint32_t /* length */) final {}
+
+public:
+   RPageSinkFillContext(std::string_view ntupleName, const RNTupleWriteOptions &options, CommitFunc_t commitFunc)
+      : RPageSink(ntupleName, options), fCommitFunc(std::move(commitFunc))
+   {
+   }
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final
+   {
+      if (nElements == 0)
+         throw RException(R__FAIL("invalid call: request empty page"));
+      auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+      return RPageAllocatorHeap::NewPage(columnHandle.fPhysicalId, elementSize, nElements);
+   }
+
+   void ReleasePage(RPage &page) final { RPageAllocatorHeap::DeletePage(page); }
+};
+
+/// The fill context's sink connects the fields in the order of the field tree; the physical column ids match the
+/// ones of the writer's sink if the fields have the same names, types and column representations
+bool HasSameFields(const ROOT::Experimental::Detail::RFieldBase &a, const ROOT::Experimental::Detail::RFieldBase &b)
+{
+   if (a.GetName() != b.GetName() || a.GetType() != b.GetType() ||
+       a.GetColumnRepresentative() != b.GetColumnRepresentative())
+      return false;
+   const auto subFieldsA = a.GetSubFields();
+   const auto subFieldsB = b.GetSubFields();
+   if (subFieldsA.size() != subFieldsB.size())
+      return false;
+   for (std::size_t i = 0; i < subFieldsA.size(); ++i) {
+      if (!HasSameFields(*subFieldsA[i], *subFieldsB[i]))
+         return false;
+   }
+   return true;
+}
+
+} // anonymous namespace
+
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(std::unique_ptr<RNTupleModel> model,
+                                                           std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model))
+{
+   fSink->Create(*fModel);
+
+   const auto &writeOpts = fSink->GetWriteOptions();
+   fMaxUnzippedClusterSize = writeOpts.GetMaxUnzippedClusterSize();
+   // First estimate is a factor 2 compression if compression is used at all
+   const int scale = writeOpts.GetCompression() ? 2 : 1;
+   fUnzippedClusterSizeEst = scale * writeOpts.GetApproxZippedClusterSize();
+}
+
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   try {
+      CommitCluster();
+   } catch (const RException &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure committing cluster of fill context: " << err.GetError().GetReport();
+   }
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted)
+      return;
+   if (fSink->GetWriteOptions().GetHasSmallClusters() &&
+       (fUnzippedClusterSize > RNTupleWriteOptions::kMaxSmallClusterSize)) {
+      throw RException(R__FAIL("invalid attempt to write a cluster > 512MiB with 'small clusters' option enabled"));
+   }
+   for (auto &field : *fModel->GetFieldZero()) {
+      field.CommitCluster();
+   }
+   fNBytesCommitted += fSink->CommitCluster(fNEntries);
+   fNBytesFilled += fUnzippedClusterSize;
+
+   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
+   const float compressionFactor =
+      std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
+   fUnzippedClusterSizeEst =
+      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+
+   fLastCommitted = fNEntries;
+   fUnzippedClusterSize = 0;
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleParallelWriter")
+{
+   if (!fModel) {
+      throw RException(R__FAIL("null model"));
+   }
+   if (!fSink) {
+      throw RException(R__FAIL("null sink"));
+   }
+   fModel->Freeze();
+   fSink->Create(*fModel.get());
+   fMetrics.ObserveMetrics(fSink->GetMetrics());
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   try {
+      // No need to hold the lock: concurrent use of the writer during its destruction is not allowed
+      for (const auto &weakContext : fFillContexts) {
+         if (auto context = weakContext.lock())
+            context->CommitCluster();
+      }
+      fSink->CommitClusterGroup();
+      fSink->CommitDataset();
+   } catch (const RException &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure committing ntuple: " << err.GetError().GetReport();
+   }
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                    std::string_view storage, const RNTupleWriteOptions &options)
+{
+   auto sinkOptions = options.Clone();
+   sinkOptions->SetUseBufferedWrite(false);
+   return std::make_unique<RNTupleParallelWriter>(std::move(model),
+                                                  Detail::RPageSink::Create(ntupleName, storage, *sinkOptions));
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext> ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   auto model = fModel->Clone();
+   // Assign a new model id so that entries of the writer's model or of other fill contexts are rejected by Fill()
+   model->Unfreeze();
+   model->Freeze();
+   return CreateFillContext(std::move(model));
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext>
+ROOT::Experimental::RNTupleParallelWriter::CreateFillContext(std::unique_ptr<RNTupleModel> model)
+{
+   if (!model)
+      throw RException(R__FAIL("null model"));
+   if (!HasSameFields(*model->GetFieldZero(), *fModel->GetFieldZero()))
+      throw RException(R__FAIL("the fields of the fill context's model do not match the writer's model"));
+   if (!model->IsFrozen())
+      model->Freeze();
+
+   std::lock_guard<std::mutex> g(fMutex);
+
+   auto sink = std::make_unique<RPageSinkFillContext>(
+      fSink->GetNTupleName(), fSink->GetWriteOptions(),
+      [this](std::span<Detail::RPageStorage::RSealedPageGroup> ranges, NTupleSize_t nEntries) {
+         return CommitSealedCluster(ranges, nEntries);
+      });
+   auto context = std::shared_ptr<RNTupleFillContext>(new RNTupleFillContext(std::move(model), std::move(sink)));
+
+   // Take the opportunity to forget about the fill contexts that are gone
+   fFillContexts.erase(std::remove_if(fFillContexts.begin(), fFillContexts.end(),
+                                      [](const std::weak_ptr<RNTupleFillContext> &c) { return c.expired(); }),
+                       fFillContexts.end());
+   fFillContexts.emplace_back(context);
+   return context;
+}
+
+ROOT::Experimental::NTupleSize_t ROOT::Experimental::RNTupleParallelWriter::GetNEntries()
+{
+   std::lock_guard<std::mutex> g(fMutex);
+   return fNEntries;
+}
+
+std::uint64_t
+ROOT::Experimental::RNTupleParallelWriter::CommitSealedCluster(std::span<Detail::RPageStorage::RSealedPageGroup> ranges,
+                                                               NTupleSize_t nEntries)
+{
+   std::lock_guard<std::mutex> g(fMutex);
+   fSink->CommitSealedPageV(ranges);
+   fNEntries += nEntries;
+   return fSink->CommitCluster(fNEntries);
+}
@@ -23,8 +23,10 @@
 #include <RVersion.h>
 #include <RZip.h> // for R__crc32
 
+#include <algorithm>
 #include <cstring> // for memcpy
 #include <deque>
+#include <optional>
 #include <set>
 #include <unordered_map>
 
@@ -187,7 +189,9 @@ std::uint32_t SerializeColumnListV1(const ROOT::Experimental::RNTupleDescriptor
 
          auto type = c.GetModel().GetType();
          pos += RNTupleSerializer::SerializeColumnType(type, *where);
-         pos += RNTupleSerializer::SerializeUInt16(RColumnElementBase::GetBitsOnStorage(type), *where);
+         const auto bitsOnStorage = c.GetModel().GetBitsOnStorage();
+         pos += RNTupleSerializer::SerializeUInt16(
+            bitsOnStorage > 0 ? bitsOnStorage : RColumnElementBase::GetBitsOnStorage(type), *where);
          pos += RNTupleSerializer::SerializeUInt32(context.GetOnDiskFieldId(c.GetFieldId()), *where);
          std::uint32_t flags = 0;
          // TODO(jblomer): add support for descending columns in the column model
@@ -199,9 +203,16 @@ std::uint32_t SerializeColumnListV1(const ROOT::Experimental::RNTupleDescriptor
          const std::uint64_t firstElementIdx = c.GetFirstElementIndex();
          if (firstElementIdx > 0)
             flags |= RNTupleSerializer::kFlagDeferredColumn;
+         const auto &valueRange = c.GetModel().GetValueRange();
+         if (valueRange)
+            flags |= RNTupleSerializer::kFlagHasValueRange;
          pos += RNTupleSerializer::SerializeUInt32(flags, *where);
          if (flags & RNTupleSerializer::kFlagDeferredColumn)
             pos += RNTupleSerializer::SerializeUInt64(firstElementIdx, *where);
+         if (flags & RNTupleSerializer::kFlagHasValueRange) {
+            pos += RNTupleSerializer::SerializeDouble(valueRange->first, *where);
+            pos += RNTupleSerializer::SerializeDouble(valueRange->second, *where);
+         }
 
          pos += RNTupleSerializer::SerializeFramePostscript(buffer ? frame : nullptr, pos - frame);
       }
@@ -249,12 +260,27 @@ RResult<std::uint32_t> DeserializeColumnV1(
          return R__FAIL("column record frame too short");
       bytes += RNTupleSerializer::DeserializeUInt64(bytes, firstElementIdx);
    }
+   std::optional<ROOT::Experimental::RColumnModel::ValueRange_t> valueRange;
+   if (flags & RNTupleSerializer::kFlagHasValueRange) {
+      if (fnFrameSizeLeft() < 2 * sizeof(double))
+         return R__FAIL("column record frame too short");
+      double min;
+      double max;
+      bytes += RNTupleSerializer::DeserializeDouble(bytes, min);
+      bytes += RNTupleSerializer::DeserializeDouble(bytes, max);
+      valueRange = {min, max};
+   }
 
-   if (ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(type) != bitsOnStorage)
+   const auto validBitRange = ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(type);
+   if (bitsOnStorage < validBitRange.first || bitsOnStorage > validBitRange.second)
       return R__FAIL("column element size mismatch");
+   // Only store the width in the column model if the column type has a configurable width
+   const std::uint16_t modelBitsOnStorage = (validBitRange.first == validBitRange.second) ? 0 : bitsOnStorage;
 
    const bool isSorted = (flags & (RNTupleSerializer::kFlagSortAscColumn | RNTupleSerializer::kFlagSortDesColumn));
-   columnDesc.FieldId(fieldId).Model({type, isSorted}).FirstElementIndex(firstElementIdx);
+   columnDesc.FieldId(fieldId)
+      .Model({type, isSorted, modelBitsOnStorage, valueRange})
+      .FirstElementIndex(firstElementIdx);
 
    return frameSize;
 }
@@ -471,6 +497,22 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeUInt64
    return DeserializeInt64(buffer, *reinterpret_cast<std::int64_t *>(&val));
 }
 
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeDouble(double val, void *buffer)
+{
+   static_assert(sizeof(double) == sizeof(std::uint64_t));
+   std::uint64_t bits;
+   memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::DeserializeDouble(const void *buffer, double &val)
+{
+   std::uint64_t bits;
+   auto nbytes = DeserializeUInt64(buffer, bits);
+   memcpy(&val, &bits, sizeof(val));
+   return nbytes;
+}
+
 std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeString(const std::string &val, void *buffer)
 {
    if (buffer) {
@@ -533,6 +575,8 @@ std::uint16_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnTy
    case EColumnType::kSplitUInt32: return SerializeUInt16(0x14, buffer);
    case EColumnType::kSplitInt16: return SerializeUInt16(0x1C, buffer);
    case EColumnType::kSplitUInt16: return SerializeUInt16(0x15, buffer);
+   case EColumnType::kReal32Trunc: return SerializeUInt16(0x1D, buffer);
+   case EColumnType::kReal32Quant: return SerializeUInt16(0x1E, buffer);
    default: throw RException(R__FAIL("ROOT bug: unexpected column type"));
    }
 }
@@ -572,6 +616,8 @@ RResult<std::uint16_t> ROOT::Experimental::Internal::RNTupleSerializer::Deserial
    case 0x14: type = EColumnType::kSplitUInt32; break;
    case 0x1C: type = EColumnType::kSplitInt16; break;
    case 0x15: type = EColumnType::kSplitUInt16; break;
+   case 0x1D: type = EColumnType::kReal32Trunc; break;
+   case 0x1E: type = EColumnType::kReal32Quant; break;
    default: return R__FAIL("unexpected on-disk column type");
    }
    return result;
@@ -1286,6 +1332,21 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList
          pos += SerializeUInt64(columnRange.fFirstElementIndex, *where);
          pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
 
+         // Optional value statistics, written only if every page of the column range has them
+         const bool hasValueRanges =
+            !pageRange.fPageInfos.empty() && std::all_of(pageRange.fPageInfos.begin(), pageRange.fPageInfos.end(),
+                                                         [](const auto &pi) { return pi.fValueRange.has_value(); });
+         if (hasValueRanges) {
+            pos += SerializeUInt32(kPageListTagValueRanges, *where);
+            auto rangeFrame = pos;
+            pos += SerializeListFramePreamble(pageRange.fPageInfos.size(), *where);
+            for (const auto &pi : pageRange.fPageInfos) {
+               pos += SerializeDouble(pi.fValueRange->fMin, *where);
+               pos += SerializeDouble(pi.fValueRange->fMax, *where);
+            }
+            pos += SerializeFramePostscript(buffer ? rangeFrame : nullptr, pos - rangeFrame);
+         }
+
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
       }
       pos += SerializeFramePostscript(buffer ? outerFrame : nullptr, pos - outerFrame);
@@ -1608,6 +1669,37 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
          std::uint32_t compressionSettings;
          bytes += DeserializeUInt32(bytes, compressionSettings);
 
+         // Optional tagged records. Unknown records, e.g. from newer writers, end the list and are skipped with the
+         // rest of the inner frame.
+         while (fnInnerFrameSizeLeft() >= static_cast<int>(sizeof(std::uint32_t))) {
+            std::uint32_t tag;
+            DeserializeUInt32(bytes, tag);
+            if (tag != kPageListTagValueRanges)
+               break;
+            bytes += sizeof(std::uint32_t);
+
+            // List frame with the value ranges of the pages
+            std::uint32_t rangeFrameSize;
+            auto rangeFrame = bytes;
+            auto fnRangeFrameSizeLeft = [&]() { return rangeFrameSize - (bytes - rangeFrame); };
+            std::uint32_t nRanges;
+            result = DeserializeFrameHeader(bytes, fnInnerFrameSizeLeft(), rangeFrameSize, nRanges);
+            if (!result)
+               return R__FORWARD_ERROR(result);
+            bytes += result.Unwrap();
+            if (nRanges != nPages)
+               return R__FAIL("mismatch of page value ranges and pages");
+            if (fnRangeFrameSizeLeft() < static_cast<int>(nRanges * 2 * sizeof(std::uint64_t)))
+               return R__FAIL("page value range frame too short");
+            for (auto &pi : pageRange.fPageInfos) {
+               RClusterDescriptor::RValueRange valueRange;
+               bytes += DeserializeDouble(bytes, valueRange.fMin);
+               bytes += DeserializeDouble(bytes, valueRange.fMax);
+               pi.fValueRange = valueRange;
+            }
+            bytes = rangeFrame + rangeFrameSize;
+         }
+
          clusters[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
          bytes = innerFrame + innerFrameSize;
       }
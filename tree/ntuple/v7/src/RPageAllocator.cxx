@@ -18,6 +18,8 @@
 
 #include <TError.h>
 
+#include <utility>
+
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageAllocatorHeap::NewPage(
    ColumnId_t columnId, std::size_t elementSize, std::size_t nElements)
 {
@@ -32,3 +34,111 @@ void ROOT::Experimental::Detail::RPageAllocatorHeap::DeletePage(const RPage& pag
    if (!page.IsPageZero())
       delete[] reinterpret_cast<unsigned char *>(page.GetBuffer());
 }
+
+std::size_t ROOT::Experimental::Detail::RPageAllocatorPool::GetSizeClass(std::size_t nbytes)
+{
+   if (nbytes > kMaxPooledSize)
+      return kNSizeClasses;
+   std::size_t sizeClass = 0;
+   for (auto classSize = kMinPooledSize; classSize < nbytes; classSize <<= 1)
+      sizeClass++;
+   return sizeClass;
+}
+
+ROOT::Experimental::Detail::RPageAllocatorPool::RPageAllocatorPool(std::size_t maxRetained)
+   : fMaxRetained(maxRetained), fMetrics("RPageAllocatorPool")
+{
+   fCounters = std::unique_ptr<RCounters>(new RCounters{
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nHit", "", "number of pages served from recycled buffers"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter *>("nMiss", "", "number of pages allocated from the heap"),
+      *fMetrics.MakeCounter<RNTupleCalcPerf *>("szRetained", "B", "volume of recycled buffers kept for reuse",
+                                               fMetrics, [this](const RNTupleMetrics &) -> std::pair<bool, double> {
+                                                  return {true, static_cast<double>(fSzRetained.load())};
+                                               })});
+}
+
+ROOT::Experimental::Detail::RPageAllocatorPool::~RPageAllocatorPool()
+{
+   Release();
+}
+
+ROOT::Experimental::Detail::RPageAllocatorPool &ROOT::Experimental::Detail::RPageAllocatorPool::GetGlobal()
+{
+   static auto *pool = new RPageAllocatorPool();
+   return *pool;
+}
+
+ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageAllocatorPool::NewPage(
+   ColumnId_t columnId, std::size_t elementSize, std::size_t nElements)
+{
+   R__ASSERT((elementSize > 0) && (nElements > 0));
+   const auto nbytes = elementSize * nElements;
+   const auto sizeClass = GetSizeClass(nbytes);
+   if (sizeClass == kNSizeClasses) {
+      fCounters->fNMiss.Inc();
+      return RPage(columnId, new unsigned char[nbytes], elementSize, nElements);
+   }
+
+   const auto classSize = kMinPooledSize << sizeClass;
+   unsigned char *buffer = nullptr;
+   {
+      auto &freeList = fSizeClasses[sizeClass];
+      std::lock_guard<std::mutex> guard(freeList.fLock);
+      if (!freeList.fFreeBuffers.empty()) {
+         buffer = freeList.fFreeBuffers.back();
+         freeList.fFreeBuffers.pop_back();
+      }
+   }
+   if (buffer) {
+      fSzRetained -= classSize;
+      fCounters->fNHit.Inc();
+   } else {
+      buffer = new unsigned char[classSize];
+      fCounters->fNMiss.Inc();
+   }
+   return RPage(columnId, buffer, elementSize, nElements);
+}
+
+void ROOT::Experimental::Detail::RPageAllocatorPool::DeletePage(const RPage &page)
+{
+   if (page.IsNull() || page.IsPageZero())
+      return;
+
+   auto buffer = reinterpret_cast<unsigned char *>(page.GetBuffer());
+   const auto sizeClass = GetSizeClass(std::size_t(page.GetElementSize()) * page.GetMaxElements());
+   if (sizeClass == kNSizeClasses) {
+      delete[] buffer;
+      return;
+   }
+
+   const auto classSize = kMinPooledSize << sizeClass;
+   if (fSzRetained.fetch_add(classSize) + classSize > fMaxRetained) {
+      fSzRetained -= classSize;
+      delete[] buffer;
+      return;
+   }
+   auto &freeList = fSizeClasses[sizeClass];
+   std::lock_guard<std::mutex> guard(freeList.fLock);
+   freeList.fFreeBuffers.emplace_back(buffer);
+}
+
+void ROOT::Experimental::Detail::RPageAllocatorPool::Release()
+{
+   for (std::size_t i = 0; i < kNSizeClasses; ++i) {
+      std::vector<unsigned char *> buffers;
+      {
+         std::lock_guard<std::mutex> guard(fSizeClasses[i].fLock);
+         std::swap(buffers, fSizeClasses[i].fFreeBuffers);
+      }
+      fSzRetained -= buffers.size() * (kMinPooledSize << i);
+      for (auto buffer : buffers)
+         delete[] buffer;
+   }
+}
+
+void ROOT::Experimental::Detail::RPageAllocatorPool::SetMaxRetained(std::size_t maxRetained)
+{
+   fMaxRetained = maxRetained;
+   if (fSzRetained > maxRetained)
+      Release();
+}
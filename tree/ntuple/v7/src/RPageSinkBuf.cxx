@@ -15,9 +15,12 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RColumn.hxx>
+#include <ROOT/RError.hxx>
 #include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageAllocator.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
 
 #include <algorithm>
@@ -43,6 +46,7 @@ ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink
          "compressing pages in parallel")
    });
    fMetrics.ObserveMetrics(fInnerSink->GetMetrics());
+   fMetrics.ObserveMetrics(RPageAllocatorPool::GetGlobal().GetMetrics());
 }
 
 ROOT::Experimental::Detail::RPageSinkBuf::~RPageSinkBuf()
@@ -155,8 +159,17 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
       std::vector<RSealedPageGroup> toCommit;
       toCommit.reserve(fBufferedColumns.size());
       for (auto &bufColumn : fBufferedColumns) {
-         const auto &sealedPages = bufColumn.GetSealedPages();
-         toCommit.emplace_back(bufColumn.GetHandle().fPhysicalId, sealedPages.cbegin(), sealedPages.cend());
+         const auto physicalId = bufColumn.GetHandle().fPhysicalId;
+         auto &sealedPages = bufColumn.GetSealedPages();
+         // The page value ranges, if any, were already determined by RPageSink::CommitPage(); forward them to the
+         // inner sink along with the sealed pages
+         if (!sealedPages.empty()) {
+            const auto &pageInfos = fOpenPageRanges.at(physicalId).fPageInfos;
+            R__ASSERT(pageInfos.size() == sealedPages.size());
+            for (std::size_t i = 0; i < sealedPages.size(); ++i)
+               sealedPages[i].fValueRange = pageInfos[i].fValueRange;
+         }
+         toCommit.emplace_back(physicalId, sealedPages.cbegin(), sealedPages.cend());
       }
       fInnerSink->CommitSealedPageV(toCommit);
 
@@ -175,14 +188,20 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
 
       // Slow path: if the buffered column contains both sealed and unsealed pages, commit them one by one.
       // TODO(jalopezg): coalesce contiguous sealed pages and commit via `CommitSealedPageV()`.
+      if (bufColumn.IsEmpty())
+         continue;
+      const auto &pageInfos = fOpenPageRanges.at(bufColumn.GetHandle().fPhysicalId).fPageInfos;
+      std::size_t pageIdx = 0;
       auto drained = bufColumn.DrainBufferedPages();
       for (auto &bufPage : std::get<std::deque<RColumnBuf::RPageZipItem>>(drained)) {
          if (bufPage.IsSealed()) {
+            bufPage.fSealedPage->fValueRange = pageInfos.at(pageIdx).fValueRange;
             fInnerSink->CommitSealedPage(bufColumn.GetHandle().fPhysicalId, *bufPage.fSealedPage);
          } else {
             fInnerSink->CommitPage(bufColumn.GetHandle(), bufPage.fPage);
          }
          ReleasePage(bufPage.fPage);
+         ++pageIdx;
       }
    }
    return fInnerSink->CommitCluster(nEntries);
@@ -206,10 +225,13 @@ void ROOT::Experimental::Detail::RPageSinkBuf::CommitDatasetImpl(unsigned char *
 ROOT::Experimental::Detail::RPage
 ROOT::Experimental::Detail::RPageSinkBuf::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
 {
-   return fInnerSink->ReservePage(columnHandle, nElements);
+   if (nElements == 0)
+      throw RException(R__FAIL("invalid call: request empty page"));
+   const auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   return RPageAllocatorPool::GetGlobal().NewPage(columnHandle.fPhysicalId, elementSize, nElements);
 }
 
 void ROOT::Experimental::Detail::RPageSinkBuf::ReleasePage(RPage &page)
 {
-   fInnerSink->ReleasePage(page);
+   RPageAllocatorPool::GetGlobal().DeletePage(page);
 }
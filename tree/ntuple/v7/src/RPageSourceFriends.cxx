@@ -19,8 +19,30 @@
 #include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RPageSourceFriends.hxx>
 
+#include <algorithm>
+#include <string>
 #include <utility>
 
+namespace {
+
+/// Appends the IDs of the given field and of all its sub fields, recursively
+void CollectFieldIds(const ROOT::Experimental::RNTupleDescriptor &desc, ROOT::Experimental::DescriptorId_t fieldId,
+                     std::vector<ROOT::Experimental::DescriptorId_t> &fieldIds)
+{
+   fieldIds.emplace_back(fieldId);
+   for (const auto &f : desc.GetFieldIterable(fieldId))
+      CollectFieldIds(desc, f.GetId(), fieldIds);
+}
+
+/// Identifies a physical column independent of its ID by the qualified name of its field and its column index
+std::string GetColumnKey(const ROOT::Experimental::RNTupleDescriptor &desc,
+                         const ROOT::Experimental::RColumnDescriptor &columnDesc)
+{
+   return desc.GetQualifiedFieldName(columnDesc.GetFieldId()) + "#" + std::to_string(columnDesc.GetIndex());
+}
+
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RPageSourceFriends::RPageSourceFriends(
    std::string_view ntupleName, std::span<std::unique_ptr<RPageSource>> sources)
    : RPageSource(ntupleName, RNTupleReadOptions())
@@ -185,7 +207,7 @@ void ROOT::Experimental::Detail::RPageSourceFriends::LoadSealedPage(DescriptorId
       fIdBiMap.GetOriginId(clusterIndex.GetClusterId()).fId,
       clusterIndex.GetIndex());
 
-   fSources[originColumnId.fSourceIdx]->LoadSealedPage(physicalColumnId, originClusterIndex, sealedPage);
+   fSources[originColumnId.fSourceIdx]->LoadSealedPage(originColumnId.fId, originClusterIndex, sealedPage);
 }
 
 
@@ -205,3 +227,240 @@ ROOT::Experimental::Detail::RPageSourceFriends::LoadClusters(std::span<RCluster:
    // that are combined may well do it.
    return std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>(clusterKeys.size());
 }
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::Detail::RPageSourceChain::RPageSourceChain(std::string_view ntupleName,
+                                                               std::span<std::unique_ptr<RPageSource>> sources)
+   : RPageSource(ntupleName, RNTupleReadOptions()), fMetrics(std::string(ntupleName))
+{
+   for (auto &s : sources) {
+      fSources.emplace_back();
+      fSources.back().fSource = std::move(s);
+      fMetrics.ObserveMetrics(fSources.back().fSource->GetMetrics());
+   }
+}
+
+ROOT::Experimental::Detail::RPageSourceChain::~RPageSourceChain() = default;
+
+
+ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceChain::AttachImpl()
+{
+   if (fSources.empty())
+      throw RException(R__FAIL("empty chain of RNTuples"));
+
+   fVirtual2OriginCluster.clear();
+   fColumnOffsets.clear();
+   RNTupleDescriptorBuilder builder;
+   // The schema of the chain is the one of the first source, identified by qualified field names and column keys
+   std::unordered_map<std::string, DescriptorId_t> virtualFields;
+   std::unordered_map<std::string, const RColumnDescriptor *> virtualColumns;
+   std::unique_ptr<RNTupleDescriptor> schemaDesc;
+   NTupleSize_t nEntries = 0;
+
+   for (std::size_t i = 0; i < fSources.size(); ++i) {
+      auto &sourceInfo = fSources[i];
+      sourceInfo.fSource->Attach();
+      sourceInfo.fFirstEntry = nEntries;
+      sourceInfo.fVirtual2OriginField.clear();
+      sourceInfo.fVirtual2OriginColumn.clear();
+      sourceInfo.fOrigin2VirtualCluster.clear();
+
+      auto descriptorGuard = sourceInfo.fSource->GetSharedDescriptorGuard();
+      const auto &desc = descriptorGuard.GetRef();
+      std::vector<DescriptorId_t> fieldIds;
+      CollectFieldIds(desc, desc.GetFieldZeroId(), fieldIds);
+
+      if (i == 0) {
+         schemaDesc = desc.Clone();
+         builder.SetNTuple(fNTupleName, desc.GetDescription());
+         for (auto fieldId : fieldIds) {
+            builder.AddField(desc.GetFieldDescriptor(fieldId));
+            virtualFields[desc.GetQualifiedFieldName(fieldId)] = fieldId;
+         }
+         for (const auto &c : desc.GetColumnIterable()) {
+            builder.AddColumn(c.Clone()).ThrowOnError();
+            if (!c.IsAliasColumn())
+               fColumnOffsets[c.GetPhysicalId()] = std::vector<NTupleSize_t>{0};
+         }
+         for (const auto &c : schemaDesc->GetColumnIterable()) {
+            if (!c.IsAliasColumn())
+               virtualColumns[GetColumnKey(*schemaDesc, c)] = &c;
+         }
+      }
+
+      if (fieldIds.size() != virtualFields.size())
+         throw RException(R__FAIL("mismatch in the schema of chained RNTuples"));
+      for (auto fieldId : fieldIds) {
+         auto itr = virtualFields.find(desc.GetQualifiedFieldName(fieldId));
+         if (itr == virtualFields.end() ||
+             desc.GetFieldDescriptor(fieldId).GetTypeName() !=
+                schemaDesc->GetFieldDescriptor(itr->second).GetTypeName()) {
+            throw RException(R__FAIL("mismatch in the schema of chained RNTuples"));
+         }
+         sourceInfo.fVirtual2OriginField[itr->second] = fieldId;
+      }
+      std::unordered_map<DescriptorId_t, DescriptorId_t> origin2VirtualColumn;
+      for (const auto &c : desc.GetColumnIterable()) {
+         if (c.IsAliasColumn())
+            continue;
+         auto itr = virtualColumns.find(GetColumnKey(desc, c));
+         if (itr == virtualColumns.end() || !(itr->second->GetModel() == c.GetModel()))
+            throw RException(R__FAIL("mismatch in the column representation of chained RNTuples"));
+         sourceInfo.fVirtual2OriginColumn[itr->second->GetPhysicalId()] = c.GetPhysicalId();
+         origin2VirtualColumn[c.GetPhysicalId()] = itr->second->GetPhysicalId();
+      }
+      if (origin2VirtualColumn.size() != fColumnOffsets.size())
+         throw RException(R__FAIL("mismatch in the column representation of chained RNTuples"));
+
+      std::vector<DescriptorId_t> clusterIds;
+      for (const auto &c : desc.GetClusterIterable())
+         clusterIds.emplace_back(c.GetId());
+      std::sort(clusterIds.begin(), clusterIds.end(), [&desc](DescriptorId_t a, DescriptorId_t b) {
+         return desc.GetClusterDescriptor(a).GetFirstEntryIndex() < desc.GetClusterDescriptor(b).GetFirstEntryIndex();
+      });
+
+      // The number of elements of every column in this source
+      std::unordered_map<DescriptorId_t, NTupleSize_t> nElements;
+      for (auto clusterId : clusterIds) {
+         const auto &c = desc.GetClusterDescriptor(clusterId);
+         const auto virtualClusterId = fVirtual2OriginCluster.size();
+         RClusterDescriptorBuilder clusterBuilder(virtualClusterId, nEntries + c.GetFirstEntryIndex(),
+                                                  c.GetNEntries());
+         for (auto originColumnId : c.GetColumnIds()) {
+            const auto virtualColumnId = origin2VirtualColumn.at(originColumnId);
+            const auto &columnRange = c.GetColumnRange(originColumnId);
+
+            auto pageRange = c.GetPageRange(originColumnId).Clone();
+            pageRange.fPhysicalColumnId = virtualColumnId;
+            clusterBuilder.CommitColumnRange(virtualColumnId,
+                                             fColumnOffsets.at(virtualColumnId)[i] + columnRange.fFirstElementIndex,
+                                             columnRange.fCompressionSettings, pageRange);
+            auto &n = nElements[virtualColumnId];
+            n = std::max(n, columnRange.fFirstElementIndex + columnRange.fNElements);
+         }
+         builder.AddClusterWithDetails(clusterBuilder.MoveDescriptor().Unwrap());
+         fVirtual2OriginCluster.emplace_back(ROriginCluster{i, c.GetId()});
+         sourceInfo.fOrigin2VirtualCluster[c.GetId()] = virtualClusterId;
+      }
+      for (auto &[columnId, offsets] : fColumnOffsets)
+         offsets.emplace_back(offsets.back() + nElements[columnId]);
+      nEntries += desc.GetNEntries();
+   }
+
+   builder.EnsureValidDescriptor();
+   return builder.MoveDescriptor();
+}
+
+
+std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Detail::RPageSourceChain::Clone() const
+{
+   std::vector<std::unique_ptr<RPageSource>> cloneSources;
+   for (const auto &s : fSources)
+      cloneSources.emplace_back(s.fSource->Clone());
+   return std::make_unique<RPageSourceChain>(fNTupleName, cloneSources);
+}
+
+
+std::size_t ROOT::Experimental::Detail::RPageSourceChain::FindSourceIdx(DescriptorId_t physicalColumnId,
+                                                                        NTupleSize_t globalIndex) const
+{
+   const auto &offsets = fColumnOffsets.at(physicalColumnId);
+   // The last element of offsets is the total number of elements, i.e. one past the last source
+   auto itr = std::upper_bound(offsets.begin(), offsets.end() - 1, globalIndex);
+   R__ASSERT(itr != offsets.begin());
+   return std::distance(offsets.begin(), itr) - 1;
+}
+
+
+void ROOT::Experimental::Detail::RPageSourceChain::TranslatePage(RPage &page, std::size_t sourceIdx,
+                                                                 DescriptorId_t physicalColumnId) const
+{
+   if (page.IsNull())
+      return;
+   const auto offset = fColumnOffsets.at(physicalColumnId)[sourceIdx];
+   const auto virtualClusterId = fSources[sourceIdx].fOrigin2VirtualCluster.at(page.GetClusterInfo().GetId());
+   page.SetWindow(page.GetGlobalRangeFirst() + offset,
+                  RPage::RClusterInfo(virtualClusterId, page.GetClusterInfo().GetIndexOffset() + offset));
+   page.ChangeIds(physicalColumnId, virtualClusterId);
+}
+
+
+ROOT::Experimental::Detail::RPageStorage::ColumnHandle_t
+ROOT::Experimental::Detail::RPageSourceChain::AddColumn(DescriptorId_t fieldId, const RColumn &column)
+{
+   for (auto &s : fSources)
+      s.fSource->AddColumn(s.fVirtual2OriginField.at(fieldId), column);
+   return RPageSource::AddColumn(fieldId, column);
+}
+
+void ROOT::Experimental::Detail::RPageSourceChain::DropColumn(ColumnHandle_t columnHandle)
+{
+   RPageSource::DropColumn(columnHandle);
+   for (auto &s : fSources) {
+      auto originHandle = columnHandle;
+      originHandle.fPhysicalId = s.fVirtual2OriginColumn.at(columnHandle.fPhysicalId);
+      s.fSource->DropColumn(originHandle);
+   }
+}
+
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSourceChain::PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex)
+{
+   const auto virtualColumnId = columnHandle.fPhysicalId;
+   const auto sourceIdx = FindSourceIdx(virtualColumnId, globalIndex);
+   auto &sourceInfo = fSources[sourceIdx];
+   columnHandle.fPhysicalId = sourceInfo.fVirtual2OriginColumn.at(virtualColumnId);
+
+   auto page = sourceInfo.fSource->PopulatePage(columnHandle,
+                                                globalIndex - fColumnOffsets.at(virtualColumnId)[sourceIdx]);
+   TranslatePage(page, sourceIdx, virtualColumnId);
+   return page;
+}
+
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSourceChain::PopulatePage(ColumnHandle_t columnHandle,
+                                                           const RClusterIndex &clusterIndex)
+{
+   const auto virtualColumnId = columnHandle.fPhysicalId;
+   const auto &originCluster = fVirtual2OriginCluster.at(clusterIndex.GetClusterId());
+   auto &sourceInfo = fSources[originCluster.fSourceIdx];
+   columnHandle.fPhysicalId = sourceInfo.fVirtual2OriginColumn.at(virtualColumnId);
+
+   auto page =
+      sourceInfo.fSource->PopulatePage(columnHandle, RClusterIndex(originCluster.fClusterId, clusterIndex.GetIndex()));
+   TranslatePage(page, originCluster.fSourceIdx, virtualColumnId);
+   return page;
+}
+
+void ROOT::Experimental::Detail::RPageSourceChain::LoadSealedPage(DescriptorId_t physicalColumnId,
+                                                                  const RClusterIndex &clusterIndex,
+                                                                  RSealedPage &sealedPage)
+{
+   const auto &originCluster = fVirtual2OriginCluster.at(clusterIndex.GetClusterId());
+   auto &sourceInfo = fSources[originCluster.fSourceIdx];
+   sourceInfo.fSource->LoadSealedPage(sourceInfo.fVirtual2OriginColumn.at(physicalColumnId),
+                                      RClusterIndex(originCluster.fClusterId, clusterIndex.GetIndex()), sealedPage);
+}
+
+
+void ROOT::Experimental::Detail::RPageSourceChain::ReleasePage(RPage &page)
+{
+   if (page.IsNull())
+      return;
+   const auto sourceIdx = fVirtual2OriginCluster.at(page.GetClusterInfo().GetId()).fSourceIdx;
+   fSources[sourceIdx].fSource->ReleasePage(page);
+}
+
+
+std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
+ROOT::Experimental::Detail::RPageSourceChain::LoadClusters(std::span<RCluster::RKey> clusterKeys)
+{
+   // As for friends, the chain does not pre-load clusters itself; every source prefetches the clusters of its own
+   // entry range.
+   return std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>(clusterKeys.size());
+}
@@ -20,6 +20,7 @@
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageAllocator.hxx>
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
 #include <ROOT/RPageStorageFile.hxx>
@@ -31,6 +32,7 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <algorithm>
 #include <utility>
 
 
@@ -135,6 +137,14 @@ ROOT::Experimental::ColumnId_t ROOT::Experimental::Detail::RPageSource::GetColum
    return columnHandle.fPhysicalId;
 }
 
+std::vector<ROOT::Experimental::DescriptorId_t>
+ROOT::Experimental::Detail::RPageSource::FindClustersInValueRange(DescriptorId_t physicalColumnId, double min,
+                                                                  double max)
+{
+   auto descriptorGuard = GetSharedDescriptorGuard();
+   return descriptorGuard->FindClustersInValueRange(physicalColumnId, min, max);
+}
+
 void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
 {
    if (fTaskScheduler)
@@ -154,8 +164,8 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSource::Unsea
    }
 
    const auto bytesPacked = element.GetPackedSize(sealedPage.fNElements);
-   using Allocator_t = RPageAllocatorHeap;
-   auto page = Allocator_t::NewPage(physicalColumnId, element.GetSize(), sealedPage.fNElements);
+   auto &allocator = RPageAllocatorPool::GetGlobal();
+   auto page = allocator.NewPage(physicalColumnId, element.GetSize(), sealedPage.fNElements);
    if (sealedPage.fSize != bytesPacked) {
       fDecompressor->Unzip(sealedPage.fBuffer, sealedPage.fSize, bytesPacked, page.GetBuffer());
    } else {
@@ -166,9 +176,9 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSource::Unsea
    }
 
    if (!element.IsMappable()) {
-      auto tmp = Allocator_t::NewPage(physicalColumnId, element.GetSize(), sealedPage.fNElements);
+      auto tmp = allocator.NewPage(physicalColumnId, element.GetSize(), sealedPage.fNElements);
       element.Unpack(tmp.GetBuffer(), page.GetBuffer(), sealedPage.fNElements);
-      Allocator_t::DeletePage(page);
+      allocator.DeletePage(page);
       page = tmp;
    }
 
@@ -176,6 +186,87 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSource::Unsea
    return page;
 }
 
+void ROOT::Experimental::Detail::RPageSource::UnzipClusterPages(const RCluster &cluster, RPagePool &pagePool)
+{
+   RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+   fTaskScheduler->Reset();
+
+   struct RUnzipPage {
+      const ROnDiskPage *fOnDiskPage = nullptr;
+      /// The cluster-local index of the first element in the page
+      NTupleSize_t fFirstInPage = 0;
+      ClusterSize_t::ValueType fNElements = 0;
+   };
+   /// The on-disk pages of a single column whose decompression is carried out by the same task
+   struct RUnzipBatch {
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      const RColumnElementBase *fElement = nullptr;
+      /// The global index of the first element of the column in the cluster
+      NTupleSize_t fIndexOffset = 0;
+      std::vector<RUnzipPage> fPages;
+   };
+
+   const auto clusterId = cluster.GetId();
+   std::vector<std::unique_ptr<RColumnElementBase>> allElements;
+   std::vector<RUnzipBatch> batches;
+   {
+      auto descriptorGuard = GetSharedDescriptorGuard();
+      const auto &clusterDescriptor = descriptorGuard->GetClusterDescriptor(clusterId);
+
+      for (const auto columnId : cluster.GetAvailPhysicalColumns()) {
+         const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
+         allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel()));
+         const auto element = allElements.back().get();
+         const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
+
+         const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
+         std::uint64_t pageNo = 0;
+         std::uint64_t firstInPage = 0;
+         std::size_t szBatch = 0;
+         for (const auto &pi : pageRange.fPageInfos) {
+            ROnDiskPage::Key key(columnId, pageNo);
+            auto onDiskPage = cluster.GetOnDiskPage(key);
+            R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
+
+            if (batches.empty() || (batches.back().fColumnId != columnId) || (szBatch >= kUnzipBatchSize)) {
+               batches.emplace_back();
+               batches.back().fColumnId = columnId;
+               batches.back().fElement = element;
+               batches.back().fIndexOffset = indexOffset;
+               szBatch = 0;
+            }
+            batches.back().fPages.push_back({onDiskPage, firstInPage, pi.fNElements});
+            szBatch += element->GetSize() * pi.fNElements;
+
+            firstInPage += pi.fNElements;
+            pageNo++;
+         } // for all pages in column
+      }    // for all columns in cluster
+   }       // descriptorGuard
+
+   for (const auto &batch : batches) {
+      fTaskScheduler->AddTask([this, &batch, &pagePool, clusterId]() {
+         for (const auto &p : batch.fPages) {
+            auto newPage = UnsealPage({p.fOnDiskPage->GetAddress(), p.fOnDiskPage->GetSize(), p.fNElements},
+                                      *batch.fElement, batch.fColumnId);
+            fCounters->fSzUnzip.Add(batch.fElement->GetSize() * p.fNElements);
+
+            newPage.SetWindow(batch.fIndexOffset + p.fFirstInPage,
+                              RPage::RClusterInfo(clusterId, batch.fIndexOffset));
+            pagePool.PreloadPage(
+               newPage,
+               RPageDeleter(
+                  [](const RPage &page, void * /*userData*/) { RPageAllocatorPool::GetGlobal().DeletePage(page); },
+                  nullptr));
+         }
+      });
+   }
+
+   fCounters->fNPagePopulated.Add(cluster.GetNOnDiskPages());
+
+   fTaskScheduler->Wait();
+}
+
 void ROOT::Experimental::Detail::RPageSource::PrepareLoadCluster(
    const RCluster::RKey &clusterKey, ROnDiskPageMap &pageZeroMap,
    std::function<void(DescriptorId_t, NTupleSize_t, const RClusterDescriptor::RPageRange::RPageInfo &)> perPageFunc)
@@ -212,6 +303,7 @@ void ROOT::Experimental::Detail::RPageSource::EnableDefaultMetrics(const std::st
                                                    "number of partial clusters preloaded from storage"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageLoaded", "", "number of pages loaded from storage"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPagePopulated", "", "number of populated pages"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageMapped", "", "number of pages served from a memory map"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallRead", "ns", "wall clock time spent reading"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallUnzip", "ns", "wall clock time spent decompressing"),
       *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter>*>("timeCpuRead", "ns", "CPU time spent reading"),
@@ -286,8 +378,22 @@ void ROOT::Experimental::Detail::RPageSource::EnableDefaultMetrics(const std::st
             }
             return {false, -1.};
          }
+      ),
+      *fMetrics.MakeCounter<RNTupleCalcPerf*> ("rtReadQueueDepth", "",
+         "average number of byte ranges submitted together in a vector read",
+         fMetrics, [](const RNTupleMetrics &metrics) -> std::pair<bool, double> {
+            if (const auto nReadV = metrics.GetLocalCounter("nReadV")) {
+               if (const auto nRead = metrics.GetLocalCounter("nRead")) {
+                  if (auto readV = nReadV->GetValueAsInt()) {
+                     return {true, (1. * nRead->GetValueAsInt()) / readV};
+                  }
+               }
+            }
+            return {false, -1.};
+         }
       )
    });
+   fMetrics.ObserveMetrics(RPageAllocatorPool::GetGlobal().GetMetrics());
 }
 
 
@@ -387,6 +493,7 @@ void ROOT::Experimental::Detail::RPageSink::UpdateSchema(const RNTupleModelChang
       RClusterDescriptor::RPageRange pageRange;
       pageRange.fPhysicalColumnId = i;
       fOpenPageRanges.emplace_back(std::move(pageRange));
+      fColumnStorageStats.emplace_back(0, 0);
    }
 
    // Mapping of memory to on-disk column IDs usually happens during serialization of the ntuple header. If the
@@ -427,6 +534,12 @@ void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHand
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
    pageInfo.fLocator = CommitPageImpl(columnHandle, page);
+   pageInfo.fValueRange = GetValueRange(page, *columnHandle.fColumn->GetElement());
+   // Wrapper sinks may return locators without size; their pages are accounted for by the inner sink
+   if (pageInfo.fLocator.fBytesOnStorage > 0) {
+      fColumnStorageStats[columnHandle.fPhysicalId].first += page.GetNElements();
+      fColumnStorageStats[columnHandle.fPhysicalId].second += pageInfo.fLocator.fBytesOnStorage;
+   }
    fOpenPageRanges.at(columnHandle.fPhysicalId).fPageInfos.emplace_back(pageInfo);
 }
 
@@ -439,6 +552,9 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
    pageInfo.fLocator = CommitSealedPageImpl(physicalColumnId, sealedPage);
+   pageInfo.fValueRange = sealedPage.fValueRange;
+   fColumnStorageStats[physicalColumnId].first += sealedPage.fNElements;
+   fColumnStorageStats[physicalColumnId].second += sealedPage.fSize;
    fOpenPageRanges.at(physicalColumnId).fPageInfos.emplace_back(pageInfo);
 }
 
@@ -465,6 +581,9 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPageV(std::span<RPageSto
          RClusterDescriptor::RPageRange::RPageInfo pageInfo;
          pageInfo.fNElements = sealedPageIt->fNElements;
          pageInfo.fLocator = locators[i++];
+         pageInfo.fValueRange = sealedPageIt->fValueRange;
+         fColumnStorageStats[range.fPhysicalColumnId].first += sealedPageIt->fNElements;
+         fColumnStorageStats[range.fPhysicalColumnId].second += sealedPageIt->fSize;
          fOpenPageRanges.at(range.fPhysicalColumnId).fPageInfos.emplace_back(pageInfo);
       }
    }
@@ -532,6 +651,14 @@ void ROOT::Experimental::Detail::RPageSink::CommitDataset()
    CommitDatasetImpl(bufFooter.get(), szFooter);
 }
 
+double ROOT::Experimental::Detail::RPageSink::GetNElementsPerStorageByte(DescriptorId_t physicalColumnId) const
+{
+   const auto &[nElements, nBytes] = fColumnStorageStats.at(physicalColumnId);
+   if (nBytes == 0)
+      return 0.0;
+   return static_cast<double>(nElements) / static_cast<double>(nBytes);
+}
+
 ROOT::Experimental::Detail::RPageStorage::RSealedPage
 ROOT::Experimental::Detail::RPageSink::SealPage(const RPage &page,
    const RColumnElementBase &element, int compressionSetting, void *buf)
@@ -569,6 +696,17 @@ ROOT::Experimental::Detail::RPageSink::SealPage(
    return SealPage(page, element, compressionSetting, fCompressor->GetZipBuffer());
 }
 
+std::optional<ROOT::Experimental::RClusterDescriptor::RValueRange>
+ROOT::Experimental::Detail::RPageSink::GetValueRange(const RPage &page, const RColumnElementBase &element) const
+{
+   if (!fOptions->GetHasValueRanges())
+      return std::nullopt;
+   RClusterDescriptor::RValueRange valueRange;
+   if (!element.GetValueRange(page.GetBuffer(), page.GetNElements(), valueRange.fMin, valueRange.fMax))
+      return std::nullopt;
+   return valueRange;
+}
+
 void ROOT::Experimental::Detail::RPageSink::EnableDefaultMetrics(const std::string &prefix)
 {
    fMetrics = RNTupleMetrics(prefix);
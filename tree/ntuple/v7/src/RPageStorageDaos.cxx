@@ -34,6 +34,7 @@
 #include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <limits>
 #include <utility>
 #include <regex>
@@ -42,6 +43,8 @@
 namespace {
 using AttributeKey_t = ROOT::Experimental::Detail::RDaosContainer::AttributeKey_t;
 using DistributionKey_t = ROOT::Experimental::Detail::RDaosContainer::DistributionKey_t;
+using ObjClassId_t = ROOT::Experimental::Detail::RDaosContainer::ObjClassId_t;
+using ColumnObjClasses_t = std::map<ROOT::Experimental::DescriptorId_t, std::string>;
 
 /// \brief RNTuple page-DAOS mappings
 enum EDaosMapping { kOidPerCluster, kOidPerPage };
@@ -56,11 +59,13 @@ struct RDaosKey {
 /// pagelist values; optionally it can be used for ntuple pages (if under the `kOidPerPage` mapping strategy).
 /// `kAttributeKeyDefault` is the attribute key for ntuple pages under `kOidPerPage`.
 /// `kAttributeKey{Anchor,Header,Footer}` are the respective attribute keys for anchor/header/footer metadata elements.
+/// `kAttributeKeyColumnObjClasses` is the attribute key of the list of columns that use a non-default object class.
 static constexpr DistributionKey_t kDistributionKeyDefault = 0x5a3c69f0cafe4a11;
 static constexpr AttributeKey_t kAttributeKeyDefault = 0x4243544b53444229;
 static constexpr AttributeKey_t kAttributeKeyAnchor = 0x4243544b5344422a;
 static constexpr AttributeKey_t kAttributeKeyHeader = 0x4243544b5344422b;
 static constexpr AttributeKey_t kAttributeKeyFooter = 0x4243544b5344422c;
+static constexpr AttributeKey_t kAttributeKeyColumnObjClasses = 0x4243544b5344422d;
 
 /// \brief Pre-defined 64 LSb of the OIDs for ntuple metadata (holds anchor/header/footer) and clusters' pagelists.
 static constexpr decltype(daos_obj_id_t::lo) kOidLowMetadata = -1;
@@ -85,6 +90,92 @@ RDaosKey GetPageDaosKey(ROOT::Experimental::Detail::ntuple_index_t ntplId, long
    }
 }
 
+/// \brief Returns the object class of the pages of the given physical column
+ObjClassId_t GetColumnObjClass(const ColumnObjClasses_t &columnObjClasses, ROOT::Experimental::DescriptorId_t columnId,
+                               ObjClassId_t defaultObjClass)
+{
+   auto itr = columnObjClasses.find(columnId);
+   return (itr == columnObjClasses.end()) ? defaultObjClass : ObjClassId_t(itr->second);
+}
+
+/// \brief Serializes the list of <physical column id, object class name> pairs that is referenced by the anchor.
+/// If `buffer` is nullptr, only the size is returned.
+std::uint32_t SerializeColumnObjClasses(const ColumnObjClasses_t &columnObjClasses, void *buffer)
+{
+   using RNTupleSerializer = ROOT::Experimental::Internal::RNTupleSerializer;
+   auto base = reinterpret_cast<unsigned char *>(buffer);
+   auto pos = base;
+   void **where = (buffer == nullptr) ? &buffer : reinterpret_cast<void **>(&pos);
+
+   pos += RNTupleSerializer::SerializeUInt32(columnObjClasses.size(), *where);
+   for (const auto &[columnId, objClass] : columnObjClasses) {
+      pos += RNTupleSerializer::SerializeUInt64(columnId, *where);
+      pos += RNTupleSerializer::SerializeString(objClass, *where);
+   }
+   return pos - base;
+}
+
+ROOT::Experimental::RResult<void>
+DeserializeColumnObjClasses(const void *buffer, std::uint32_t bufSize, ColumnObjClasses_t &columnObjClasses)
+{
+   using RNTupleSerializer = ROOT::Experimental::Internal::RNTupleSerializer;
+   auto bytes = reinterpret_cast<const unsigned char *>(buffer);
+   if (bufSize < sizeof(std::uint32_t))
+      return R__FAIL("DAOS column object class list too short");
+   std::uint32_t nColumns;
+   bytes += RNTupleSerializer::DeserializeUInt32(bytes, nColumns);
+   bufSize -= sizeof(std::uint32_t);
+   for (std::uint32_t i = 0; i < nColumns; ++i) {
+      if (bufSize < sizeof(std::uint64_t))
+         return R__FAIL("DAOS column object class list too short");
+      std::uint64_t columnId;
+      bytes += RNTupleSerializer::DeserializeUInt64(bytes, columnId);
+      bufSize -= sizeof(std::uint64_t);
+      std::string objClass;
+      auto result = RNTupleSerializer::DeserializeString(bytes, bufSize, objClass);
+      if (!result)
+         return R__FORWARD_ERROR(result);
+      bytes += result.Unwrap();
+      bufSize -= result.Unwrap();
+      columnObjClasses[columnId] = objClass;
+   }
+   return ROOT::Experimental::RResult<void>::Success();
+}
+
+/// \brief Maps the physical columns of the given fields and of their subfields to the given object classes.
+/// The fields are sorted by name, i.e. the object class of a subfield takes precedence over the one of its parent.
+ColumnObjClasses_t ResolveColumnObjClasses(const ROOT::Experimental::RNTupleDescriptor &desc,
+                                           const std::map<std::string, std::string> &fieldObjClasses)
+{
+   using ROOT::Experimental::DescriptorId_t;
+   using ROOT::Experimental::RException;
+
+   ColumnObjClasses_t columnObjClasses;
+   for (const auto &[fieldName, objClass] : fieldObjClasses) {
+      if (ObjClassId_t(objClass).IsUnknown())
+         throw RException(R__FAIL("Unknown object class " + objClass + " for field " + fieldName));
+
+      auto fieldId = desc.GetFieldZeroId();
+      for (std::size_t start = 0, end = 0; end != std::string::npos; start = end + 1) {
+         end = fieldName.find('.', start);
+         fieldId = desc.FindFieldId(std::string_view(fieldName).substr(start, end - start), fieldId);
+         if (fieldId == ROOT::Experimental::kInvalidDescriptorId)
+            throw RException(R__FAIL("Unknown field " + fieldName + " for object class " + objClass));
+      }
+
+      std::vector<DescriptorId_t> fieldIds{fieldId};
+      while (!fieldIds.empty()) {
+         const auto id = fieldIds.back();
+         fieldIds.pop_back();
+         for (const auto &c : desc.GetColumnIterable(id))
+            columnObjClasses[c.GetPhysicalId()] = objClass;
+         for (const auto &f : desc.GetFieldIterable(id))
+            fieldIds.push_back(f.GetId());
+      }
+   }
+   return columnObjClasses;
+}
+
 struct RDaosURI {
    /// \brief Label of the DAOS pool
    std::string fPoolLabel;
@@ -135,8 +226,10 @@ std::uint32_t ROOT::Experimental::Detail::RDaosNTupleAnchor::Serialize(void *buf
       bytes += RNTupleSerializer::SerializeUInt32(fNBytesFooter, bytes);
       bytes += RNTupleSerializer::SerializeUInt32(fLenFooter, bytes);
       bytes += RNTupleSerializer::SerializeString(fObjClass, bytes);
+      if (fVersion >= 1)
+         bytes += RNTupleSerializer::SerializeUInt32(fNBytesColumnObjClasses, bytes);
    }
-   return RNTupleSerializer::SerializeString(fObjClass, nullptr) + 20;
+   return RNTupleSerializer::SerializeString(fObjClass, nullptr) + 20 + (fVersion >= 1 ? 4 : 0);
 }
 
 ROOT::Experimental::RResult<std::uint32_t>
@@ -155,7 +248,15 @@ ROOT::Experimental::Detail::RDaosNTupleAnchor::Deserialize(const void *buffer, s
    auto result = RNTupleSerializer::DeserializeString(bytes, bufSize - 20, fObjClass);
    if (!result)
       return R__FORWARD_ERROR(result);
-   return result.Unwrap() + 20;
+   bytes += result.Unwrap();
+   fNBytesColumnObjClasses = 0;
+   if (fVersion < 1)
+      return result.Unwrap() + 20;
+
+   if (bufSize < result.Unwrap() + 24)
+      return R__FAIL("DAOS anchor too short");
+   RNTupleSerializer::DeserializeUInt32(bytes, fNBytesColumnObjClasses);
+   return result.Unwrap() + 24;
 }
 
 std::uint32_t ROOT::Experimental::Detail::RDaosNTupleAnchor::GetSize()
@@ -246,6 +347,9 @@ void ROOT::Experimental::Detail::RPageSinkDaos::CreateImpl(const RNTupleModel &
    if (oclass.IsUnknown())
       throw ROOT::Experimental::RException(R__FAIL("Unknown object class " + fNTupleAnchor.fObjClass));
 
+   if (opts)
+      fColumnObjClasses = ResolveColumnObjClasses(fDescriptorBuilder.GetDescriptor(), opts->GetColumnObjectClasses());
+
    size_t cageSz = opts ? opts->GetMaxCageSize() : RNTupleWriteOptionsDaos().GetMaxCageSize();
    size_t pageSz = opts ? opts->GetApproxUnzippedPageSize() : RNTupleWriteOptionsDaos().GetApproxUnzippedPageSize();
    fCageSizeLimit = std::max(cageSz, pageSz);
@@ -285,13 +389,15 @@ ROOT::Experimental::Detail::RPageSinkDaos::CommitSealedPageImpl(DescriptorId_t p
                                                                 const RPageStorage::RSealedPage &sealedPage)
 {
    auto offsetData = fPageId.fetch_add(1);
-   DescriptorId_t clusterId = fDescriptorBuilder.GetDescriptor().GetNClusters();
 
-   {
-      RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
-      RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(fNTupleIndex, clusterId, physicalColumnId, offsetData);
-      fDaosContainer->WriteSingleAkey(sealedPage.fBuffer, sealedPage.fSize, daosKey.fOid, daosKey.fDkey, daosKey.fAkey);
-   }
+   // The sealed page buffer is only valid during the call: keep a copy until the cluster is written
+   RPendingPage pendingPage;
+   pendingPage.fPhysicalColumnId = physicalColumnId;
+   pendingPage.fPosition = offsetData;
+   pendingPage.fBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[sealedPage.fSize]);
+   pendingPage.fSize = sealedPage.fSize;
+   memcpy(pendingPage.fBuffer.get(), sealedPage.fBuffer, sealedPage.fSize);
+   fPendingPages.emplace_back(std::move(pendingPage));
 
    RNTupleLocator result;
    result.fPosition = EncodeDaosPagePosition(offsetData);
@@ -330,6 +436,8 @@ ROOT::Experimental::Detail::RPageSinkDaos::CommitSealedPageVImpl(std::span<RPage
       /// first cage and indicate the next one, also ensuring subsequent pages of different columns do not end up caged
       /// together. This increment is not necessary in the absence of caging, as each page is trivially caged.
       positionIndex = useCaging ? fPageId.fetch_add(1) : fPageId.load();
+      const auto columnObjClass =
+         GetColumnObjClass(fColumnObjClasses, range.fPhysicalColumnId, fDaosContainer->GetDefaultObjectClass());
 
       for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
 
@@ -346,7 +454,7 @@ ROOT::Experimental::Detail::RPageSinkDaos::CommitSealedPageVImpl(std::span<RPage
          RDaosKey daosKey =
             GetPageDaosKey<kDefaultDaosMapping>(fNTupleIndex, clusterId, range.fPhysicalColumnId, positionIndex);
          auto odPair = RDaosContainer::ROidDkeyPair{daosKey.fOid, daosKey.fDkey};
-         auto [it, ret] = writeRequests.emplace(odPair, RDaosContainer::RWOperation(odPair));
+         auto [it, ret] = writeRequests.emplace(odPair, RDaosContainer::RWOperation(odPair, columnObjClass));
          it->second.Insert(daosKey.fAkey, pageIov);
 
          RNTupleLocator locator;
@@ -374,9 +482,38 @@ ROOT::Experimental::Detail::RPageSinkDaos::CommitSealedPageVImpl(std::span<RPage
    return locators;
 }
 
+void ROOT::Experimental::Detail::RPageSinkDaos::FlushPendingPages()
+{
+   if (fPendingPages.empty())
+      return;
+
+   DescriptorId_t clusterId = fDescriptorBuilder.GetDescriptor().GetNClusters();
+   const auto defaultObjClass = fDaosContainer->GetDefaultObjectClass();
+   RDaosContainer::MultiObjectRWOperation_t writeRequests;
+   for (const auto &p : fPendingPages) {
+      d_iov_t pageIov;
+      d_iov_set(&pageIov, p.fBuffer.get(), p.fSize);
+
+      RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(fNTupleIndex, clusterId, p.fPhysicalColumnId, p.fPosition);
+      auto odPair = RDaosContainer::ROidDkeyPair{daosKey.fOid, daosKey.fDkey};
+      auto [it, ret] = writeRequests.emplace(
+         odPair,
+         RDaosContainer::RWOperation(odPair, GetColumnObjClass(fColumnObjClasses, p.fPhysicalColumnId, defaultObjClass)));
+      it->second.Insert(daosKey.fAkey, pageIov);
+   }
+
+   {
+      RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
+      if (int err = fDaosContainer->WriteV(writeRequests))
+         throw ROOT::Experimental::RException(R__FAIL("WriteV: error" + std::string(d_errstr(err))));
+   }
+   fPendingPages.clear();
+}
+
 std::uint64_t
 ROOT::Experimental::Detail::RPageSinkDaos::CommitClusterImpl(ROOT::Experimental::NTupleSize_t /* nEntries */)
 {
+   FlushPendingPages();
    return std::exchange(fNBytesCurrentCluster, 0);
 }
 
@@ -407,6 +544,7 @@ void ROOT::Experimental::Detail::RPageSinkDaos::CommitDatasetImpl(unsigned char
    auto szFooterZip = fCompressor->Zip(serializedFooter, length, GetWriteOptions().GetCompression(),
                                        RNTupleCompressor::MakeMemCopyWriter(bufFooterZip.get()));
    WriteNTupleFooter(bufFooterZip.get(), szFooterZip, length);
+   WriteColumnObjClasses();
    WriteNTupleAnchor();
 }
 
@@ -428,6 +566,21 @@ void ROOT::Experimental::Detail::RPageSinkDaos::WriteNTupleFooter(const void *da
    fNTupleAnchor.fNBytesFooter = nbytes;
 }
 
+void ROOT::Experimental::Detail::RPageSinkDaos::WriteColumnObjClasses()
+{
+   fNTupleAnchor.fNBytesColumnObjClasses = 0;
+   if (fColumnObjClasses.empty())
+      return;
+
+   const auto nbytes = SerializeColumnObjClasses(fColumnObjClasses, nullptr);
+   auto buffer = std::make_unique<unsigned char[]>(nbytes);
+   SerializeColumnObjClasses(fColumnObjClasses, buffer.get());
+   fDaosContainer->WriteSingleAkey(
+      buffer.get(), nbytes, daos_obj_id_t{kOidLowMetadata, static_cast<decltype(daos_obj_id_t::hi)>(fNTupleIndex)},
+      kDistributionKeyDefault, kAttributeKeyColumnObjClasses, kCidMetadata);
+   fNTupleAnchor.fNBytesColumnObjClasses = nbytes;
+}
+
 void ROOT::Experimental::Detail::RPageSinkDaos::WriteNTupleAnchor()
 {
    const auto ntplSize = RDaosNTupleAnchor::GetSize();
@@ -459,10 +612,13 @@ ROOT::Experimental::Detail::RPageSourceDaos::RPageSourceDaos(std::string_view nt
    : RPageSource(ntupleName, options),
      fPagePool(std::make_shared<RPagePool>()),
      fURI(uri),
-     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize(),
+                                                 options.GetMaxClusterBunchesInFlight(),
+                                                 options.GetClusterCachePolicy()))
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceDaos");
+   fMetrics.ObserveMetrics(fClusterPool->GetMetrics());
 
    auto args = ParseDaosURI(uri);
    auto pool = std::make_shared<RDaosPool>(args.fPoolLabel);
@@ -489,6 +645,22 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceDao
    fDaosContainer->SetDefaultObjectClass(oclass);
    fNTupleIndex = locator.GetIndex();
 
+   fColumnObjClasses.clear();
+   if (const auto nbytes = locator.fAnchor->fNBytesColumnObjClasses) {
+      buffer = std::make_unique<unsigned char[]>(nbytes);
+      if (int err = fDaosContainer->ReadSingleAkey(
+             buffer.get(), nbytes, daos_obj_id_t{kOidLowMetadata, static_cast<decltype(daos_obj_id_t::hi)>(fNTupleIndex)},
+             kDistributionKeyDefault, kAttributeKeyColumnObjClasses, kCidMetadata)) {
+         throw ROOT::Experimental::RException(
+            R__FAIL("Attach: cannot read the column object classes: " + std::string(d_errstr(err))));
+      }
+      DeserializeColumnObjClasses(buffer.get(), nbytes, fColumnObjClasses).ThrowOnError();
+      for (const auto &[_, objClass] : fColumnObjClasses) {
+         if (RDaosObject::ObjClassId(objClass).IsUnknown())
+            throw ROOT::Experimental::RException(R__FAIL("Attach: unknown object class " + objClass));
+      }
+   }
+
    ntplDesc = descBuilder.MoveDescriptor();
    daos_obj_id_t oidPageList{kOidLowPageList, static_cast<decltype(daos_obj_id_t::hi)>(fNTupleIndex)};
 
@@ -516,6 +688,11 @@ std::string ROOT::Experimental::Detail::RPageSourceDaos::GetObjectClass() const
    return fDaosContainer->GetDefaultObjectClass().ToString();
 }
 
+std::string ROOT::Experimental::Detail::RPageSourceDaos::GetColumnObjectClass(DescriptorId_t physicalColumnId) const
+{
+   return GetColumnObjClass(fColumnObjClasses, physicalColumnId, fDaosContainer->GetDefaultObjectClass()).ToString();
+}
+
 void ROOT::Experimental::Detail::RPageSourceDaos::LoadSealedPage(DescriptorId_t physicalColumnId,
                                                                  const RClusterIndex &clusterIndex,
                                                                  RSealedPage &sealedPage)
@@ -537,13 +714,15 @@ void ROOT::Experimental::Detail::RPageSourceDaos::LoadSealedPage(DescriptorId_t
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    sealedPage.fSize = bytesOnStorage;
    sealedPage.fNElements = pageInfo.fNElements;
+   sealedPage.fValueRange = pageInfo.fValueRange;
    if (!sealedPage.fBuffer)
       return;
    if (pageInfo.fLocator.fType != RNTupleLocator::kTypePageZero) {
       RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(
          fNTupleIndex, clusterId, physicalColumnId, pageInfo.fLocator.GetPosition<RNTupleLocatorObject64>().fLocation);
-      fDaosContainer->ReadSingleAkey(const_cast<void *>(sealedPage.fBuffer), bytesOnStorage, daosKey.fOid,
-                                     daosKey.fDkey, daosKey.fAkey);
+      fDaosContainer->ReadSingleAkey(
+         const_cast<void *>(sealedPage.fBuffer), bytesOnStorage, daosKey.fOid, daosKey.fDkey, daosKey.fAkey,
+         GetColumnObjClass(fColumnObjClasses, physicalColumnId, fDaosContainer->GetDefaultObjectClass()));
    } else {
       memcpy(const_cast<void *>(sealedPage.fBuffer), RPage::GetPageZeroBuffer(), bytesOnStorage);
    }
@@ -583,8 +762,9 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
       directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
       RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(
          fNTupleIndex, clusterId, columnId, pageInfo.fLocator.GetPosition<RNTupleLocatorObject64>().fLocation);
-      fDaosContainer->ReadSingleAkey(directReadBuffer.get(), bytesOnStorage, daosKey.fOid, daosKey.fDkey,
-                                     daosKey.fAkey);
+      fDaosContainer->ReadSingleAkey(
+         directReadBuffer.get(), bytesOnStorage, daosKey.fOid, daosKey.fDkey, daosKey.fAkey,
+         GetColumnObjClass(fColumnObjClasses, columnId, fDaosContainer->GetDefaultObjectClass()));
       fCounters->fNPageLoaded.Inc();
       fCounters->fNRead.Inc();
       fCounters->fSzReadPayload.Add(bytesOnStorage);
@@ -615,7 +795,8 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
                      RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
    fPagePool->RegisterPage(
       newPage,
-      RPageDeleter([](const RPage &page, void * /*userData*/) { RPageAllocatorHeap::DeletePage(page); }, nullptr));
+      RPageDeleter([](const RPage &page, void * /*userData*/) { RPageAllocatorPool::GetGlobal().DeletePage(page); },
+                   nullptr));
    fCounters->fNPagePopulated.Inc();
    return newPage;
 }
@@ -743,7 +924,9 @@ ROOT::Experimental::Detail::RPageSourceDaos::LoadClusters(std::span<RCluster::RK
 
          RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(fNTupleIndex, clusterId, columnId, cageIndex);
          auto odPair = RDaosContainer::ROidDkeyPair{daosKey.fOid, daosKey.fDkey};
-         auto [itReq, ret] = readRequests.emplace(odPair, RDaosContainer::RWOperation(odPair));
+         auto [itReq, ret] = readRequests.emplace(
+            odPair, RDaosContainer::RWOperation(
+                       odPair, GetColumnObjClass(fColumnObjClasses, columnId, fDaosContainer->GetDefaultObjectClass())));
          itReq->second.Insert(daosKey.fAkey, iov);
 
          cageBuffer += cageSz;
@@ -780,50 +963,5 @@ ROOT::Experimental::Detail::RPageSourceDaos::LoadClusters(std::span<RCluster::RK
 
 void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *cluster)
 {
-   RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-   fTaskScheduler->Reset();
-
-   const auto clusterId = cluster->GetId();
-   auto descriptorGuard = GetSharedDescriptorGuard();
-   const auto &clusterDescriptor = descriptorGuard->GetClusterDescriptor(clusterId);
-
-   std::vector<std::unique_ptr<RColumnElementBase>> allElements;
-
-   const auto &columnsInCluster = cluster->GetAvailPhysicalColumns();
-   for (const auto columnId : columnsInCluster) {
-      const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
-
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
-
-      const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
-      std::uint64_t pageNo = 0;
-      std::uint64_t firstInPage = 0;
-      for (const auto &pi : pageRange.fPageInfos) {
-         ROnDiskPage::Key key(columnId, pageNo);
-         auto onDiskPage = cluster->GetOnDiskPage(key);
-         R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
-
-         auto taskFunc = [this, columnId, clusterId, firstInPage, onDiskPage, element = allElements.back().get(),
-                          nElements = pi.fNElements,
-                          indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex]() {
-            auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element, columnId);
-            fCounters->fSzUnzip.Add(element->GetSize() * nElements);
-
-            newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
-            fPagePool->PreloadPage(
-               newPage,
-               RPageDeleter([](const RPage &page, void * /*userData*/) { RPageAllocatorHeap::DeletePage(page); },
-                            nullptr));
-         };
-
-         fTaskScheduler->AddTask(taskFunc);
-
-         firstInPage += pi.fNElements;
-         pageNo++;
-      } // for all pages in column
-   }    // for all columns in cluster
-
-   fCounters->fNPagePopulated.Add(cluster->GetNOnDiskPages());
-
-   fTaskScheduler->Wait();
+   UnzipClusterPages(*cluster, *fPagePool);
 }
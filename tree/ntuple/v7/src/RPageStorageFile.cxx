@@ -26,6 +26,7 @@
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RRawFile.hxx>
+#include <ROOT/RRawFileCached.hxx>
 
 #include <RVersion.h>
 #include <TError.h>
@@ -34,6 +35,8 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <exception>
+#include <future>
 #include <iostream>
 #include <utility>
 
@@ -61,7 +64,7 @@ ROOT::Experimental::Detail::RPageSinkFile::RPageSinkFile(std::string_view ntuple
    : RPageSinkFile(ntupleName, options)
 {
    fWriter = std::unique_ptr<Internal::RNTupleFileWriter>(Internal::RNTupleFileWriter::Recreate(
-      ntupleName, path, options.GetCompression(), options.GetContainerFormat()));
+      ntupleName, path, options.GetCompression(), options.GetContainerFormat(), &options));
 }
 
 
@@ -142,6 +145,56 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(DescriptorId_t p
 }
 
 
+std::vector<ROOT::Experimental::RNTupleLocator>
+ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges)
+{
+   std::vector<RNTupleLocator> locators;
+   std::vector<unsigned char> blob;
+   std::size_t bytesPacked = 0;
+   // Indexes into locators of the pages that are collected in the blob
+   std::size_t firstPageInBlob = 0;
+
+   auto fnFlushBlob = [&]() {
+      if (blob.empty())
+         return;
+      std::uint64_t offsetData;
+      {
+         RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
+         offsetData = fWriter->WriteBlob(blob.data(), blob.size(), bytesPacked);
+      }
+      for (auto i = firstPageInBlob; i < locators.size(); ++i)
+         locators[i].fPosition = offsetData + locators[i].GetPosition<std::uint64_t>();
+      fCounters->fSzWritePayload.Add(blob.size());
+      fNBytesCurrentCluster += blob.size();
+      blob.clear();
+      bytesPacked = 0;
+      firstPageInBlob = locators.size();
+   };
+
+   for (auto &range : ranges) {
+      const auto bitsOnStorage = RColumnElementBase::GetBitsOnStorage(
+         fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(range.fPhysicalColumnId).GetModel().GetType());
+      for (auto sealedPageIt = range.fFirst; sealedPageIt != range.fLast; ++sealedPageIt) {
+         if (!blob.empty() && (blob.size() + sealedPageIt->fSize > kMaxSealedPageVBlobSize))
+            fnFlushBlob();
+
+         // The position is relative to the beginning of the blob until the blob is written
+         RNTupleLocator locator;
+         locator.fPosition = std::uint64_t(blob.size());
+         locator.fBytesOnStorage = sealedPageIt->fSize;
+         locators.emplace_back(locator);
+
+         auto buffer = static_cast<const unsigned char *>(sealedPageIt->fBuffer);
+         blob.insert(blob.end(), buffer, buffer + sealedPageIt->fSize);
+         bytesPacked += (bitsOnStorage * sealedPageIt->fNElements + 7) / 8;
+         fCounters->fNPageCommitted.Inc();
+      }
+   }
+   fnFlushBlob();
+
+   return locators;
+}
+
 std::uint64_t
 ROOT::Experimental::Detail::RPageSinkFile::CommitClusterImpl(ROOT::Experimental::NTupleSize_t /* nEntries */)
 {
@@ -194,10 +247,13 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
                                                              const RNTupleReadOptions &options)
    : RPageSource(ntupleName, options),
      fPagePool(std::make_shared<RPagePool>()),
-     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize(),
+                                                 options.GetMaxClusterBunchesInFlight(),
+                                                 options.GetClusterCachePolicy()))
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceFile");
+   fMetrics.ObserveMetrics(fClusterPool->GetMetrics());
 }
 
 
@@ -207,6 +263,8 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
 {
    fFile = ROOT::Internal::RRawFile::Create(path);
    R__ASSERT(fFile);
+   if (options.GetUseSharedBlockCache())
+      fFile = std::make_unique<ROOT::Internal::RRawFileCached>(std::move(fFile));
    fReader = Internal::RMiniFileReader(fFile.get());
 }
 
@@ -237,7 +295,11 @@ ROOT::Experimental::Detail::RPageSourceFile::CreateFromAnchor(const Internal::RF
    return pageSource;
 }
 
-ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile() = default;
+ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile()
+{
+   if (fMappedFile)
+      fFile->Unmap(fMappedFile, fMappedFileSize);
+}
 
 
 ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFile::AttachImpl()
@@ -266,9 +328,26 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
       }
    }
 
+   MapFile();
    return ntplDesc;
 }
 
+ROOT::Experimental::RNTupleDescriptor
+ROOT::Experimental::Detail::RPageSourceFile::AttachWithDescriptorImpl(RNTupleDescriptor &&desc)
+{
+   MapFile();
+   return std::move(desc);
+}
+
+void ROOT::Experimental::Detail::RPageSourceFile::MapFile()
+{
+   if (fOptions.GetUseMmap() && !fMappedFile && (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap)) {
+      fMappedFileSize = fFile->GetSize();
+      std::uint64_t mapdOffset;
+      fMappedFile = static_cast<unsigned char *>(fFile->Map(fMappedFileSize, 0, mapdOffset));
+   }
+}
+
 void ROOT::Experimental::Detail::RPageSourceFile::LoadSealedPage(DescriptorId_t physicalColumnId,
                                                                  const RClusterIndex &clusterIndex,
                                                                  RSealedPage &sealedPage)
@@ -285,6 +364,7 @@ void ROOT::Experimental::Detail::RPageSourceFile::LoadSealedPage(DescriptorId_t
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    sealedPage.fSize = bytesOnStorage;
    sealedPage.fNElements = pageInfo.fNElements;
+   sealedPage.fValueRange = pageInfo.fValueRange;
    if (!sealedPage.fBuffer)
       return;
    if (pageInfo.fLocator.fType != RNTupleLocator::kTypePageZero) {
@@ -320,6 +400,12 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       return pageZero;
    }
 
+   if (fMappedFile) {
+      auto mappedPage = MapPage(columnHandle, clusterInfo);
+      if (!mappedPage.IsNull())
+         return mappedPage;
+   }
+
    if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
       directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
       fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.GetPosition<std::uint64_t>());
@@ -353,12 +439,38 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
                      RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
    fPagePool->RegisterPage(
       newPage,
-      RPageDeleter([](const RPage &page, void * /*userData*/) { RPageAllocatorHeap::DeletePage(page); }, nullptr));
+      RPageDeleter([](const RPage &page, void * /*userData*/) { RPageAllocatorPool::GetGlobal().DeletePage(page); },
+                   nullptr));
    fCounters->fNPagePopulated.Inc();
    return newPage;
 }
 
 
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSourceFile::MapPage(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo)
+{
+   const auto &pageInfo = clusterInfo.fPageInfo;
+   const auto element = columnHandle.fColumn->GetElement();
+   const auto elementSize = element->GetSize();
+   const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
+   const auto position = pageInfo.fLocator.GetPosition<std::uint64_t>();
+
+   // Only uncompressed pages with the in-memory layout can be used as is
+   if (!element->IsMappable() || (bytesOnStorage != element->GetPackedSize(pageInfo.fNElements)))
+      return RPage();
+   if ((position + bytesOnStorage > fMappedFileSize) || (position % elementSize != 0))
+      return RPage();
+
+   // The mapping is read-only and lives as long as the page source; the page pool must not free the page buffer
+   RPage mappedPage(columnHandle.fPhysicalId, fMappedFile + position, elementSize, pageInfo.fNElements);
+   mappedPage.GrowUnchecked(pageInfo.fNElements);
+   mappedPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
+                        RPage::RClusterInfo(clusterInfo.fClusterId, clusterInfo.fColumnOffset));
+   fPagePool->RegisterPage(mappedPage, RPageDeleter([](const RPage &, void *) {}, nullptr));
+   fCounters->fNPageMapped.Inc();
+   return mappedPage;
+}
+
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::PopulatePage(
    ColumnHandle_t columnHandle, NTupleSize_t globalIndex)
 {
@@ -539,17 +651,44 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RK
 
    std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>> clusters;
    std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   // The first read request of every cluster, followed by the total number of requests
+   std::vector<std::size_t> clusterRequests;
 
    for (auto key: clusterKeys) {
+      clusterRequests.emplace_back(readRequests.size());
       clusters.emplace_back(PrepareSingleCluster(key, readRequests));
    }
+   clusterRequests.emplace_back(readRequests.size());
 
    auto nReqs = readRequests.size();
-   {
+   if (clusterKeys.size() > 1 && (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasAsyncIo)) {
+      // One vector read per cluster, all of them in flight at the same time
+      RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+      std::vector<std::future<void>> reads;
+      for (std::size_t i = 0; i < clusterKeys.size(); ++i) {
+         auto nClusterReqs = clusterRequests[i + 1] - clusterRequests[i];
+         if (nClusterReqs == 0)
+            continue;
+         reads.emplace_back(fFile->ReadVAsync(&readRequests[clusterRequests[i]], nClusterReqs));
+         fCounters->fNReadV.Inc();
+      }
+      // Wait for all reads before rethrowing the first error: the buffers are released on throw
+      std::exception_ptr error;
+      for (auto &r : reads) {
+         try {
+            r.get();
+         } catch (...) {
+            if (!error)
+               error = std::current_exception();
+         }
+      }
+      if (error)
+         std::rethrow_exception(error);
+   } else {
       RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
       fFile->ReadV(&readRequests[0], nReqs);
+      fCounters->fNReadV.Inc();
    }
-   fCounters->fNReadV.Inc();
    fCounters->fNRead.Add(nReqs);
 
    return clusters;
@@ -558,50 +697,5 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RK
 
 void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *cluster)
 {
-   RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-   fTaskScheduler->Reset();
-
-   const auto clusterId = cluster->GetId();
-   auto descriptorGuard = GetSharedDescriptorGuard();
-   const auto &clusterDescriptor = descriptorGuard->GetClusterDescriptor(clusterId);
-
-   std::vector<std::unique_ptr<RColumnElementBase>> allElements;
-
-   const auto &columnsInCluster = cluster->GetAvailPhysicalColumns();
-   for (const auto columnId : columnsInCluster) {
-      const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
-
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
-
-      const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
-      std::uint64_t pageNo = 0;
-      std::uint64_t firstInPage = 0;
-      for (const auto &pi : pageRange.fPageInfos) {
-         ROnDiskPage::Key key(columnId, pageNo);
-         auto onDiskPage = cluster->GetOnDiskPage(key);
-         R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
-
-         auto taskFunc = [this, columnId, clusterId, firstInPage, onDiskPage, element = allElements.back().get(),
-                          nElements = pi.fNElements,
-                          indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex]() {
-            auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element, columnId);
-            fCounters->fSzUnzip.Add(element->GetSize() * nElements);
-
-            newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
-            fPagePool->PreloadPage(
-               newPage,
-               RPageDeleter([](const RPage &page, void * /*userData*/) { RPageAllocatorHeap::DeletePage(page); },
-                            nullptr));
-         };
-
-         fTaskScheduler->AddTask(taskFunc);
-
-         firstInPage += pi.fNElements;
-         pageNo++;
-      } // for all pages in column
-   } // for all columns in cluster
-
-   fCounters->fNPagePopulated.Add(cluster->GetNOnDiskPages());
-
-   fTaskScheduler->Wait();
+   UnzipClusterPages(*cluster, *fPagePool);
 }
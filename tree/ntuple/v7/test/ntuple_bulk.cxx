@@ -14,14 +14,7 @@ TEST(RNTupleBulk, Simple)
    }
 
    auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
-   // TODO(jblomer): find a better way to expose the GenerateBulk method of the target field
-   auto fieldZero = reader->GetModel()->GetFieldZero();
-   std::unique_ptr<RFieldBase::RBulk> bulk;
-   for (auto &f : *fieldZero) {
-      if (f.GetName() != "int")
-         continue;
-      bulk = std::make_unique<RFieldBase::RBulk>(f.GenerateBulk());
-   }
+   auto bulk = std::make_unique<RFieldBase::RBulk>(reader->GetModel()->CreateBulk("int"));
 
    auto mask = std::make_unique<bool[]>(10);
    std::fill(mask.get(), mask.get() + 10, true);
@@ -199,3 +192,45 @@ TEST(RNTupleBulk, RVec)
       }
    }
 }
+
+TEST(RNTupleBulk, CreateBulk)
+{
+   FileRaii fileGuard("test_ntuple_bulk_create.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldS = model->MakeField<CustomStruct>("S");
+      auto fldVecI = model->MakeField<ROOT::RVecI>("vint");
+      EXPECT_THROW(model->CreateBulk("S"), RException);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      EXPECT_THROW(writer->GetModel()->CreateBulk("S"), RException);
+      for (int i = 0; i < 10; ++i) {
+         fldS->a = i;
+         fldVecI->assign(i, i);
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_THROW(reader->GetModel()->CreateBulk("invalid"), RException);
+
+   auto mask = std::make_unique<bool[]>(10);
+   std::fill(mask.get(), mask.get() + 10, true);
+
+   // Sub fields of records can be read directly
+   auto bulkA = reader->GetModel()->CreateBulk("S.a");
+   auto aArr = static_cast<float *>(bulkA.ReadBulk(RClusterIndex(0, 0), mask.get(), 10));
+   for (int i = 0; i < 10; ++i) {
+      EXPECT_FLOAT_EQ(i, aArr[i]);
+   }
+
+   // Moving a bulk preserves the item values of collections
+   auto bulkVI = reader->GetModel()->CreateBulk("vint");
+   auto viArr = static_cast<ROOT::RVecI *>(bulkVI.ReadBulk(RClusterIndex(0, 0), mask.get(), 10));
+   auto movedBulkVI = std::move(bulkVI);
+   EXPECT_EQ(viArr, movedBulkVI.ReadBulk(RClusterIndex(0, 0), mask.get(), 10));
+   for (int i = 0; i < 10; ++i) {
+      ASSERT_EQ(i, viArr[i].size());
+      for (auto v : viArr[i])
+         EXPECT_EQ(i, v);
+   }
+}
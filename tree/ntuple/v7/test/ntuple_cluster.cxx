@@ -55,8 +55,13 @@ public:
    /// Records the cluster IDs requests by LoadClusters() calls
    std::vector<ROOT::Experimental::DescriptorId_t> fReqsClusterIds;
    std::vector<ROOT::Experimental::Detail::RCluster::ColumnSet_t> fReqsColumns;
+   /// Number of clusters requested by every LoadClusters() call
+   std::vector<std::size_t> fReqsBatchSizes;
 
-   RPageSourceMock() : RPageSource("test", ROOT::Experimental::RNTupleReadOptions()) {
+   /// If nBytesPerPage is larger than zero, every cluster gets one page of that size for the columns 0 and 1
+   explicit RPageSourceMock(std::uint32_t nBytesPerPage = 0)
+      : RPageSource("test", ROOT::Experimental::RNTupleReadOptions())
+   {
       ROOT::Experimental::RNTupleDescriptorBuilder descBuilder;
       for (unsigned i = 0; i <= 5; ++i) {
          descBuilder.AddClusterSummary(i, i, 1);
@@ -64,8 +69,17 @@ public:
       auto descriptorGuard = GetExclDescriptorGuard();
       descriptorGuard.MoveIn(descBuilder.MoveDescriptor());
       for (unsigned i = 0; i <= 5; ++i) {
-         descriptorGuard->AddClusterDetails(
-            ROOT::Experimental::RClusterDescriptorBuilder(i, i, 1).MoveDescriptor().Unwrap());
+         ROOT::Experimental::RClusterDescriptorBuilder clusterBuilder(i, i, 1);
+         for (ROOT::Experimental::DescriptorId_t colId = 0; (nBytesPerPage > 0) && (colId < 2); ++colId) {
+            ROOT::Experimental::RClusterDescriptor::RPageRange pageRange;
+            pageRange.fPhysicalColumnId = colId;
+            ROOT::Experimental::RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+            pageInfo.fNElements = 1;
+            pageInfo.fLocator.fBytesOnStorage = nBytesPerPage;
+            pageRange.fPageInfos.emplace_back(pageInfo);
+            clusterBuilder.CommitColumnRange(colId, i, 0, pageRange).ThrowOnError();
+         }
+         descriptorGuard->AddClusterDetails(clusterBuilder.MoveDescriptor().Unwrap());
       }
    }
    std::unique_ptr<RPageSource> Clone() const final { return nullptr; }
@@ -78,6 +92,7 @@ public:
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final
    {
       std::vector<std::unique_ptr<RCluster>> result;
+      fReqsBatchSizes.emplace_back(clusterKeys.size());
       for (auto key : clusterKeys) {
          fReqsClusterIds.emplace_back(key.fClusterId);
          fReqsColumns.emplace_back(key.fPhysicalColumnSet);
@@ -263,6 +278,93 @@ TEST(ClusterPool, GetClusterBasics)
 }
 
 
+TEST(ClusterPool, GetClusterBunchesInFlight)
+{
+   RPageSourceMock p1;
+   {
+      RClusterPool c1(p1, 1, 3);
+      c1.GetCluster(0, {0});
+      c1.WaitForInFlightClusters();
+   }
+   // The look-ahead window spans the current cluster and three more bunches of one cluster each
+   ASSERT_EQ(4U, p1.fReqsClusterIds.size());
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(i, p1.fReqsClusterIds[i]);
+   // Up to three of the four bunches are combined in a single LoadClusters() call
+   std::size_t nRequested = 0;
+   for (auto s : p1.fReqsBatchSizes)
+      nRequested += s;
+   EXPECT_EQ(4U, nRequested);
+   EXPECT_GE(2U, p1.fReqsBatchSizes.size());
+
+   RPageSourceMock p2;
+   {
+      RClusterPool c2(p2, 2, 2);
+      c2.GetCluster(0, {0});
+      c2.WaitForInFlightClusters();
+   }
+   ASSERT_EQ(6U, p2.fReqsClusterIds.size());
+   for (unsigned i = 0; i < 6; ++i)
+      EXPECT_EQ(i, p2.fReqsClusterIds[i]);
+   nRequested = 0;
+   for (auto s : p2.fReqsBatchSizes) {
+      EXPECT_EQ(0U, s % 2);
+      nRequested += s;
+   }
+   EXPECT_EQ(6U, nRequested);
+}
+
+
+TEST(ClusterPool, CachePolicy)
+{
+   ROOT::Experimental::RClusterCachePolicy policy;
+   policy.SetLookahead(4);
+   RPageSourceMock p1;
+   {
+      RClusterPool c1(p1, 1, 1, policy);
+      c1.GetCluster(0, {0});
+      c1.WaitForInFlightClusters();
+   }
+   // The explicit look-ahead depth overrides the window given by the bunch size and the bunches in flight
+   ASSERT_EQ(5U, p1.fReqsClusterIds.size());
+   for (unsigned i = 0; i < 5; ++i)
+      EXPECT_EQ(i, p1.fReqsClusterIds[i]);
+
+   // Every page is 100 bytes, so with a budget of 150 bytes only one cluster fits
+   policy.SetLookahead(1);
+   policy.SetLookbehind(1);
+   policy.SetMaxInFlightBytes(150);
+   RPageSourceMock p2(100);
+   RClusterPool c2(p2, 1, 1, policy);
+   c2.GetMetrics().Enable();
+   auto fnGetCounter = [&c2](const std::string &name) {
+      return c2.GetMetrics().GetCounter("RClusterPool." + name)->GetValueAsInt();
+   };
+
+   c2.GetCluster(0, {0});
+   ASSERT_EQ(1U, p2.fReqsClusterIds.size());
+   EXPECT_EQ(0U, p2.fReqsClusterIds[0]);
+   EXPECT_EQ(1, fnGetCounter("nMiss"));
+
+   // Cluster 0 is in the look-back window but it is evicted to make room for the requested cluster
+   c2.GetCluster(1, {0});
+   ASSERT_EQ(2U, p2.fReqsClusterIds.size());
+   EXPECT_EQ(1U, p2.fReqsClusterIds[1]);
+   EXPECT_EQ(2, fnGetCounter("nMiss"));
+   EXPECT_EQ(1, fnGetCounter("nEvict"));
+
+   c2.GetCluster(1, {0});
+   EXPECT_EQ(2U, p2.fReqsClusterIds.size());
+   EXPECT_EQ(1, fnGetCounter("nHit"));
+
+   // The requested cluster is loaded even if it exceeds the budget
+   c2.GetCluster(1, {1});
+   ASSERT_EQ(3U, p2.fReqsClusterIds.size());
+   EXPECT_EQ(1U, p2.fReqsClusterIds[2]);
+   EXPECT_EQ(RCluster::ColumnSet_t({1}), p2.fReqsColumns[2]);
+}
+
+
 TEST(ClusterPool, GetClusterIncrementally)
 {
    RPageSourceMock p1;
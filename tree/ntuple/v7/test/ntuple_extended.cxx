@@ -113,6 +113,47 @@ TEST(RNTuple, RandomAccess)
 }
 
 
+// Columns with many pages per cluster are decompressed in several batches by the unzip tasks
+TEST(RNTuple, ParallelUnzip)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif
+   FileRaii fileGuard("test_ntuple_parallel_unzip.root");
+
+   auto modelWrite = RNTupleModel::Create();
+   auto wrValue = modelWrite->MakeField<std::int32_t>("value");
+   auto wrEnergy = modelWrite->MakeField<double>("energy");
+
+   constexpr unsigned int nEvents = 1000000;
+   std::int64_t chksumWrite = 0;
+   {
+      RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(4096);
+      auto ntuple = RNTupleWriter::Recreate(std::move(modelWrite), "myNTuple", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < nEvents; ++i) {
+         *wrValue = i % 1000;
+         *wrEnergy = 2. * (i % 7);
+         chksumWrite += *wrValue + static_cast<std::int64_t>(*wrEnergy);
+         ntuple->Fill();
+      }
+   }
+
+   for (auto useImt : {RNTupleReadOptions::EImplicitMT::kDefault, RNTupleReadOptions::EImplicitMT::kOff}) {
+      RNTupleReadOptions options;
+      options.SetUseImplicitMT(useImt);
+      auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath(), options);
+      auto viewValue = ntuple->GetView<std::int32_t>("value");
+      auto viewEnergy = ntuple->GetView<double>("energy");
+      std::int64_t chksumRead = 0;
+      for (auto i : ntuple->GetEntryRange()) {
+         chksumRead += viewValue(i) + static_cast<std::int64_t>(viewEnergy(i));
+      }
+      EXPECT_EQ(chksumWrite, chksumRead);
+   }
+}
+
+
 #if !defined(_MSC_VER) || defined(R__ENABLE_BROKEN_WIN_TESTS)
 TEST(RNTuple, LargeFile1)
 {
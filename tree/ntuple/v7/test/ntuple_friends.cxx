@@ -131,3 +131,119 @@ TEST(RPageStorageFriends, FailOnEntryCountMismatch)
    RPageSourceFriends friendSource("myNTuple", realSources);
    EXPECT_THROW(friendSource.Attach(), ROOT::Experimental::RException);
 }
+
+TEST(RPageStorageFriends, SealedPage)
+{
+   FileRaii fileGuard1("test_ntuple_friends_sealed1.root");
+   FileRaii fileGuard2("test_ntuple_friends_sealed2.root");
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<std::int32_t>("a", 1);
+      model->MakeField<std::int32_t>("b", 2);
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      RNTupleWriter::Recreate(std::move(model), "ntpl1", fileGuard1.GetPath(), options)->Fill();
+   }
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<std::int32_t>("c", 3);
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      RNTupleWriter::Recreate(std::move(model), "ntpl2", fileGuard2.GetPath(), options)->Fill();
+   }
+
+   std::vector<std::unique_ptr<RPageSource>> realSources;
+   realSources.emplace_back(std::make_unique<RPageSourceFile>("ntpl1", fileGuard1.GetPath(), RNTupleReadOptions()));
+   realSources.emplace_back(std::make_unique<RPageSourceFile>("ntpl2", fileGuard2.GetPath(), RNTupleReadOptions()));
+   RPageSourceFriends friendSource("myNTuple", realSources);
+   friendSource.Attach();
+
+   // The column of the second friend has a different physical ID in the virtual source than in its origin
+   DescriptorId_t columnId;
+   DescriptorId_t clusterId;
+   {
+      auto descriptorGuard = friendSource.GetSharedDescriptorGuard();
+      columnId = descriptorGuard->FindPhysicalColumnId(descriptorGuard->FindFieldId("ntpl2.c"), 0);
+      clusterId = descriptorGuard->FindClusterId(columnId, 0);
+   }
+   RPageStorage::RSealedPage sealedPage;
+   friendSource.LoadSealedPage(columnId, RClusterIndex(clusterId, 0), sealedPage);
+   ASSERT_EQ(4U, sealedPage.fSize);
+   std::int32_t value = 0;
+   sealedPage.fBuffer = &value;
+   friendSource.LoadSealedPage(columnId, RClusterIndex(clusterId, 0), sealedPage);
+   EXPECT_EQ(3, value);
+}
+
+TEST(RPageStorageChain, Basic)
+{
+   FileRaii fileGuard1("test_ntuple_chain_basic1.root");
+   FileRaii fileGuard2("test_ntuple_chain_basic2.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto pt = model->MakeField<float>("pt");
+      auto vec = model->MakeField<std::vector<int>>("vec");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard1.GetPath());
+      for (int i = 0; i < 3; ++i) {
+         *pt = i;
+         vec->assign(i, i);
+         ntuple->Fill();
+         if (i == 0)
+            ntuple->CommitCluster();
+      }
+   }
+   {
+      // Same schema but different field order, hence different column IDs
+      auto model = RNTupleModel::Create();
+      auto vec = model->MakeField<std::vector<int>>("vec");
+      auto pt = model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard2.GetPath());
+      for (int i = 3; i < 5; ++i) {
+         *pt = i;
+         vec->assign(i, i);
+         ntuple->Fill();
+      }
+   }
+
+   std::vector<RNTupleReader::ROpenSpec> chain{{"ntpl", fileGuard1.GetPath()}, {"ntpl", fileGuard2.GetPath()}};
+   auto ntuple = RNTupleReader::OpenChain(chain);
+   EXPECT_EQ(5U, ntuple->GetNEntries());
+   EXPECT_EQ(3U, ntuple->GetDescriptor()->GetNClusters());
+
+   auto clone = ntuple->Clone();
+   auto viewPt = clone->GetView<float>("pt");
+   auto viewVec = clone->GetView<std::vector<int>>("vec");
+   for (auto i : clone->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(i, viewPt(i));
+      EXPECT_EQ(std::vector<int>(i, i), viewVec(i));
+   }
+   // Backwards across the source boundary
+   EXPECT_FLOAT_EQ(2.0, viewPt(2));
+   EXPECT_EQ(std::vector<int>(2, 2), viewVec(2));
+}
+
+TEST(RPageStorageChain, FailOnSchemaMismatch)
+{
+   FileRaii fileGuard1("test_ntuple_chain_mismatch1.root");
+   FileRaii fileGuard2("test_ntuple_chain_mismatch2.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard1.GetPath())->Fill();
+   }
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<double>("pt");
+      RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard2.GetPath())->Fill();
+   }
+
+   std::vector<RNTupleReader::ROpenSpec> chain{{"ntpl", fileGuard1.GetPath()}, {"ntpl", fileGuard2.GetPath()}};
+   try {
+      auto ntuple = RNTupleReader::OpenChain(chain);
+      FAIL() << "chaining ntuples with different schemas should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("mismatch in the schema of chained RNTuples"));
+   }
+}
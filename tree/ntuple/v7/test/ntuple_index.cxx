@@ -0,0 +1,124 @@
+#include "ntuple_test.hxx"
+
+namespace {
+void CreateRunEventNTuple(const std::string &path)
+{
+   auto model = RNTupleModel::Create();
+   auto run = model->MakeField<std::uint32_t>("run");
+   auto event = model->MakeField<std::int64_t>("event");
+   auto pt = model->MakeField<float>("pt");
+   RNTupleWriteOptions options;
+   options.SetApproxZippedClusterSize(1024);
+   auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", path, options);
+   // Entries are not sorted by key; (run 1, event 3) appears twice
+   for (std::uint32_t r : {2, 1, 3}) {
+      for (std::int64_t e = 999; e >= 0; --e) {
+         *run = r;
+         *event = e;
+         *pt = r * 1000 + e;
+         writer->Fill();
+      }
+   }
+   *run = 1;
+   *event = 3;
+   *pt = -1.0;
+   writer->Fill();
+}
+} // anonymous namespace
+
+TEST(RNTupleIndex, Lookup)
+{
+   FileRaii fileGuard("test_ntuple_index_lookup.root");
+   CreateRunEventNTuple(fileGuard.GetPath());
+
+   auto pageSource = RPageSource::Create("ntpl", fileGuard.GetPath());
+   pageSource->Attach();
+
+   EXPECT_THROW(RNTupleIndex::Create({}, *pageSource), RException);
+   EXPECT_THROW(RNTupleIndex::Create({"run", "event", "pt"}, *pageSource), RException);
+   EXPECT_THROW(RNTupleIndex::Create({"nonexistent"}, *pageSource), RException);
+   EXPECT_THROW(RNTupleIndex::Create({"pt"}, *pageSource), RException);
+
+   auto index = RNTupleIndex::Create({"run", "event"}, *pageSource);
+   EXPECT_EQ(3001U, index->GetSize());
+   EXPECT_EQ(std::vector<std::string>({"run", "event"}), index->GetFieldNames());
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_LT(1U, reader->GetDescriptor()->GetNClusters());
+   auto viewPt = reader->GetView<float>("pt");
+   for (std::uint32_t r = 1; r <= 3; ++r) {
+      for (std::int64_t e = 0; e < 1000; ++e) {
+         auto entryIndex = index->GetEntryIndex(r, e);
+         ASSERT_NE(ROOT::Experimental::kInvalidNTupleIndex, entryIndex);
+         EXPECT_FLOAT_EQ(r * 1000 + e, viewPt(entryIndex));
+      }
+   }
+   EXPECT_EQ(ROOT::Experimental::kInvalidNTupleIndex, index->GetEntryIndex(4, 0));
+   EXPECT_EQ(ROOT::Experimental::kInvalidNTupleIndex, index->GetEntryIndex(1, 1000));
+   EXPECT_EQ(ROOT::Experimental::kInvalidNTupleIndex, index->GetEntryIndex(0));
+
+   auto duplicates = index->GetAllEntryIndexes(1, 3);
+   ASSERT_EQ(2U, duplicates.size());
+   EXPECT_EQ(index->GetEntryIndex(1, 3), duplicates[0]);
+   EXPECT_EQ(3000U, duplicates[1]);
+   EXPECT_TRUE(index->GetAllEntryIndexes(4, 0).empty());
+
+   auto runIndex = RNTupleIndex::Create({"run"}, *pageSource);
+   EXPECT_EQ(3001U, runIndex->GetSize());
+   EXPECT_EQ(1000U, runIndex->GetEntryIndex(1));
+   EXPECT_EQ(1001U, runIndex->GetAllEntryIndexes(1).size());
+   EXPECT_EQ(1000U, runIndex->GetAllEntryIndexes(3).size());
+}
+
+TEST(RNTupleIndex, Parallel)
+{
+   FileRaii fileGuard("test_ntuple_index_parallel.root");
+   CreateRunEventNTuple(fileGuard.GetPath());
+
+   auto pageSource = RPageSource::Create("ntpl", fileGuard.GetPath());
+   pageSource->Attach();
+
+   auto serialIndex = RNTupleIndex::Create({"run", "event"}, *pageSource);
+   auto parallelIndex = RNTupleIndex::Create({"run", "event"}, *pageSource, 4);
+   ASSERT_EQ(serialIndex->GetSize(), parallelIndex->GetSize());
+   for (std::uint32_t r = 1; r <= 3; ++r) {
+      for (std::int64_t e = 0; e < 1000; ++e) {
+         EXPECT_EQ(serialIndex->GetAllEntryIndexes(r, e), parallelIndex->GetAllEntryIndexes(r, e));
+      }
+   }
+}
+
+TEST(RNTupleIndex, WriteAndOpen)
+{
+   FileRaii fileGuard("test_ntuple_index_write.root");
+   CreateRunEventNTuple(fileGuard.GetPath());
+
+   auto pageSource = RPageSource::Create("ntpl", fileGuard.GetPath());
+   pageSource->Attach();
+   auto index = RNTupleIndex::Create({"run", "event"}, *pageSource);
+   auto runIndex = RNTupleIndex::Create({"run"}, *pageSource);
+   {
+      std::unique_ptr<TFile> file(TFile::Open(fileGuard.GetPath().c_str(), "UPDATE"));
+      index->Write("ntpl_index", *file);
+      runIndex->Write("ntpl_run_index", *file);
+   }
+
+   EXPECT_THROW(RNTupleIndex::Open("ntpl", fileGuard.GetPath()), RException);
+
+   auto readIndex = RNTupleIndex::Open("ntpl_index", fileGuard.GetPath());
+   EXPECT_EQ(index->GetFieldNames(), readIndex->GetFieldNames());
+   ASSERT_EQ(index->GetSize(), readIndex->GetSize());
+   for (std::uint32_t r = 1; r <= 3; ++r) {
+      for (std::int64_t e = 0; e < 1000; ++e) {
+         EXPECT_EQ(index->GetAllEntryIndexes(r, e), readIndex->GetAllEntryIndexes(r, e));
+      }
+   }
+
+   auto readRunIndex = RNTupleIndex::Open("ntpl_run_index", fileGuard.GetPath());
+   EXPECT_EQ(std::vector<std::string>({"run"}), readRunIndex->GetFieldNames());
+   EXPECT_EQ(runIndex->GetAllEntryIndexes(2), readRunIndex->GetAllEntryIndexes(2));
+
+   // The indexed ntuple is unaffected
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(3001U, reader->GetNEntries());
+}
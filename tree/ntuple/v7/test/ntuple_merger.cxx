@@ -79,3 +79,91 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+namespace {
+void WriteMergeInput(const std::string &path, int first, int compression)
+{
+   auto model = RNTupleModel::Create();
+   auto pt = model->MakeField<float>("pt");
+   auto vec = model->MakeField<std::vector<int>>("vec");
+   RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", path, options);
+   for (int i = first; i < first + 100; ++i) {
+      *pt = i;
+      vec->assign(i % 3, i);
+      writer->Fill();
+      if (i % 40 == 39)
+         writer->CommitCluster();
+   }
+}
+} // anonymous namespace
+
+TEST(RNTupleMerger, Merge)
+{
+   FileRaii fileGuard1("test_ntuple_merger_input1.root");
+   FileRaii fileGuard2("test_ntuple_merger_input2.root");
+   FileRaii fileGuardOut("test_ntuple_merger_output.root");
+   WriteMergeInput(fileGuard1.GetPath(), 0, 505);
+   WriteMergeInput(fileGuard2.GetPath(), 100, 0);
+
+   {
+      RPageSourceFile source1("ntpl", fileGuard1.GetPath(), RNTupleReadOptions());
+      RPageSourceFile source2("ntpl", fileGuard2.GetPath(), RNTupleReadOptions());
+      std::vector<RPageSource *> sources{&source1, &source2};
+      RNTupleWriteOptions options;
+      options.SetCompression(505);
+      RPageSinkFile destination("ntpl", fileGuardOut.GetPath(), options);
+      RNTupleMerger merger;
+      merger.Merge(sources, destination);
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuardOut.GetPath());
+   ASSERT_EQ(200U, reader->GetNEntries());
+   EXPECT_EQ(6U, reader->GetDescriptor()->GetNClusters());
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewVec = reader->GetView<std::vector<int>>("vec");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(i, viewPt(i));
+      EXPECT_EQ(std::vector<int>(i % 3, i), viewVec(i));
+   }
+
+   // The pages of the first input are copied byte by byte, the ones of the second input are recompressed
+   auto reader1 = RNTupleReader::Open("ntpl", fileGuard1.GetPath());
+   const auto &desc = *reader->GetDescriptor();
+   const auto &desc1 = *reader1->GetDescriptor();
+   const auto ptColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("pt"), 0);
+   const auto ptColumnId1 = desc1.FindPhysicalColumnId(desc1.FindFieldId("pt"), 0);
+   const auto &pageInfo = desc.GetClusterDescriptor(desc.FindClusterId(ptColumnId, 0)).GetPageRange(ptColumnId);
+   const auto &pageInfo1 = desc1.GetClusterDescriptor(desc1.FindClusterId(ptColumnId1, 0)).GetPageRange(ptColumnId1);
+   ASSERT_EQ(pageInfo1.fPageInfos.size(), pageInfo.fPageInfos.size());
+   EXPECT_EQ(pageInfo1.fPageInfos[0].fLocator.fBytesOnStorage, pageInfo.fPageInfos[0].fLocator.fBytesOnStorage);
+   for (const auto &cluster : desc.GetClusterIterable())
+      EXPECT_EQ(505, cluster.GetColumnRange(ptColumnId).fCompressionSettings);
+}
+
+TEST(RNTupleMerger, SchemaMismatch)
+{
+   FileRaii fileGuard1("test_ntuple_merger_mismatch1.root");
+   FileRaii fileGuard2("test_ntuple_merger_mismatch2.root");
+   FileRaii fileGuardOut("test_ntuple_merger_mismatch_output.root");
+   WriteMergeInput(fileGuard1.GetPath(), 0, 505);
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<double>("pt");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard2.GetPath());
+      writer->Fill();
+   }
+
+   RPageSourceFile source1("ntpl", fileGuard1.GetPath(), RNTupleReadOptions());
+   RPageSourceFile source2("ntpl", fileGuard2.GetPath(), RNTupleReadOptions());
+   std::vector<RPageSource *> sources{&source1, &source2};
+   RPageSinkFile destination("ntpl", fileGuardOut.GetPath(), RNTupleWriteOptions());
+   RNTupleMerger merger;
+   try {
+      merger.Merge(sources, destination);
+      FAIL() << "merging ntuples with different schemas should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("schema mismatch"));
+   }
+}
@@ -88,6 +88,45 @@ TEST(MiniFile, Stream)
 }
 
 
+TEST(MiniFile, WriteEngine)
+{
+   FileRaii fileGuard("test_ntuple_minifile_write_engine.root");
+
+   RNTupleWriteOptions options;
+   options.SetUseWriteEngine(true);
+   options.SetUseDirectIO(true);
+   auto writer = std::unique_ptr<RNTupleFileWriter>(RNTupleFileWriter::Recreate(
+      "MyNTuple", fileGuard.GetPath(), 0, ENTupleContainerFormat::kTFile, &options));
+   char header = 'h';
+   char footer = 'f';
+   std::vector<unsigned char> blob(100000);
+   for (std::size_t i = 0; i < blob.size(); ++i)
+      blob[i] = i % 251;
+   auto offHeader = writer->WriteNTupleHeader(&header, 1, 1);
+   auto offBlob = writer->WriteBlob(blob.data(), blob.size(), blob.size());
+   auto offFooter = writer->WriteNTupleFooter(&footer, 1, 1);
+   writer->Commit();
+
+   auto rawFile = RRawFile::Create(fileGuard.GetPath());
+   RMiniFileReader reader(rawFile.get());
+   auto ntuple = reader.GetNTuple("MyNTuple").Inspect();
+   EXPECT_EQ(offHeader, ntuple.fSeekHeader);
+   EXPECT_EQ(offFooter, ntuple.fSeekFooter);
+
+   std::vector<unsigned char> buf(blob.size());
+   reader.ReadBuffer(buf.data(), buf.size(), offBlob);
+   EXPECT_EQ(blob, buf);
+   char c;
+   reader.ReadBuffer(&c, 1, offFooter);
+   EXPECT_EQ(footer, c);
+
+   auto file = std::unique_ptr<TFile>(TFile::Open(fileGuard.GetPath().c_str(), "READ"));
+   ASSERT_TRUE(file);
+   auto k = std::unique_ptr<ROOT::Experimental::RNTuple>(file->Get<ROOT::Experimental::RNTuple>("MyNTuple"));
+   EXPECT_TRUE(IsEqual(ntuple, ROOT::Experimental::Internal::RNTupleTester(*k).GetAnchor()));
+}
+
+
 TEST(MiniFile, Proper)
 {
    FileRaii fileGuard("test_ntuple_minifile_proper.root");
@@ -79,6 +79,43 @@ TEST(RNTuple, ModelExtensionSimple)
    EXPECT_EQ(1337.0, array(3)[1]);
 }
 
+TEST(RNTuple, ModelExtensionCompactNullable)
+{
+   FileRaii fileGuard("test_ntuple_modelext_compact.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt", 42.0);
+
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      ntuple->Fill();
+      ntuple->CommitCluster();
+      ntuple->Fill();
+
+      auto modelUpdater = ntuple->CreateModelUpdater();
+      modelUpdater->BeginUpdate();
+      auto field = std::make_unique<RField<std::unique_ptr<double>>>("trigger");
+      field->SetCompact();
+      modelUpdater->AddField(std::move(field));
+      modelUpdater->CommitUpdate();
+
+      auto trigger = ntuple->GetModel()->GetDefaultEntry()->Get<std::unique_ptr<double>>("trigger");
+      ntuple->Fill();
+      *trigger = std::make_unique<double>(1.0);
+      ntuple->Fill();
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   EXPECT_EQ(4U, ntuple->GetNEntries());
+   EXPECT_EQ(2U, GetFirstEntry(ntuple->GetModel()->GetField("trigger")));
+
+   // The entries before the addition of the field have no item
+   auto trigger = ntuple->GetView<std::unique_ptr<double>>("trigger");
+   EXPECT_FALSE(trigger(0));
+   EXPECT_FALSE(trigger(1));
+   EXPECT_FALSE(trigger(2));
+   EXPECT_EQ(1.0, *trigger(3));
+}
+
 TEST(RNTuple, ModelExtensionInvalidUse)
 {
    FileRaii fileGuard("test_ntuple_modelext_invalid.root");
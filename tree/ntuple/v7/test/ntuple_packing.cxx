@@ -303,3 +303,127 @@ TEST(Packing, OnDiskEncoding)
    EXPECT_EQ(std::string("abc"), viewStr(0));
    EXPECT_EQ(std::string("de"), viewStr(1));
 }
+
+TEST(Packing, Real16)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16> element;
+   EXPECT_EQ(16u, element.GetBitsOnStorage());
+
+   float in[] = {0.f, -2.f, 1.f / 3.f, 65504.f, 1e6f, 5.9604645e-8f, std::numeric_limits<float>::quiet_NaN()};
+   constexpr std::size_t kN = sizeof(in) / sizeof(in[0]);
+   unsigned char packed[2 * kN];
+   element.Pack(packed, in, kN);
+   // 1/3 rounds to 0x3555, stored little-endian
+   EXPECT_EQ(0x55, packed[4]);
+   EXPECT_EQ(0x35, packed[5]);
+
+   float out[kN];
+   element.Unpack(out, packed, kN);
+   EXPECT_EQ(0.f, out[0]);
+   EXPECT_EQ(-2.f, out[1]);
+   EXPECT_FLOAT_EQ(0.33325195f, out[2]);
+   EXPECT_EQ(65504.f, out[3]);
+   EXPECT_EQ(std::numeric_limits<float>::infinity(), out[4]);
+   EXPECT_EQ(5.9604645e-8f, out[5]);
+   EXPECT_TRUE(std::isnan(out[6]));
+}
+
+TEST(Packing, TruncatedAndQuantizedReal32)
+{
+   using ROOT::Experimental::RColumnModel;
+   using ROOT::Experimental::Detail::RColumnElementBase;
+
+   auto truncated = RColumnElementBase::Generate<float>(RColumnModel(EColumnType::kReal32Trunc, false, 12));
+   EXPECT_EQ(12u, truncated->GetBitsOnStorage());
+   EXPECT_EQ(3u, truncated->GetPackedSize(2));
+   EXPECT_THROW(truncated->SetBitsOnStorage(9), RException);
+
+   // 1.f + 2^-3 + 2^-4 rounds up to 1.25 with 3 mantissa bits; the infinity survives as such
+   float inTrunc[] = {1.1875f, -std::numeric_limits<float>::infinity()};
+   unsigned char packedTrunc[3];
+   truncated->Pack(packedTrunc, inTrunc, 2);
+   float outTrunc[2];
+   truncated->Unpack(outTrunc, packedTrunc, 2);
+   EXPECT_EQ(1.25f, outTrunc[0]);
+   EXPECT_EQ(-std::numeric_limits<float>::infinity(), outTrunc[1]);
+
+   EXPECT_THROW(RColumnElementBase::Generate<double>(RColumnModel(EColumnType::kReal32Quant, false, 8, {{1.0, 1.0}})),
+                RException);
+   auto quantized =
+      RColumnElementBase::Generate<double>(RColumnModel(EColumnType::kReal32Quant, false, 4, {{-1.0, 2.0}}));
+   EXPECT_EQ(4u, quantized->GetBitsOnStorage());
+
+   // Out of range values are clamped, NaN is stored as the lower bound
+   double inQuant[] = {-1.0, 2.0, 0.0, 0.2, 100.0, std::numeric_limits<double>::quiet_NaN()};
+   unsigned char packedQuant[3];
+   quantized->Pack(packedQuant, inQuant, 6);
+   EXPECT_EQ(0xf0, packedQuant[0]);
+   double outQuant[6];
+   quantized->Unpack(outQuant, packedQuant, 6);
+   EXPECT_NEAR(-1.0, outQuant[0], 1e-12);
+   EXPECT_NEAR(2.0, outQuant[1], 1e-12);
+   EXPECT_NEAR(0.0, outQuant[2], 1e-12);
+   EXPECT_NEAR(0.2, outQuant[3], 1e-12);
+   EXPECT_NEAR(2.0, outQuant[4], 1e-12);
+   EXPECT_NEAR(-1.0, outQuant[5], 1e-12);
+}
+
+TEST(Packing, ReducedPrecisionReal)
+{
+   FileRaii fileGuard("test_ntuple_packing_reduced_precision.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto fldHalf = std::make_unique<RField<float>>("half");
+      fldHalf->SetHalfPrecision();
+      model->AddField(std::move(fldHalf));
+      auto fldTrunc = std::make_unique<RField<double>>("trunc");
+      fldTrunc->SetTruncated(16);
+      model->AddField(std::move(fldTrunc));
+      auto fldQuant = std::make_unique<RField<float>>("quant");
+      EXPECT_THROW(fldQuant->SetQuantized(0.0, 0.0, 10), RException);
+      EXPECT_THROW(fldQuant->SetQuantized(0.0, 1.0, 33), RException);
+      fldQuant->SetQuantized(-10.0, 10.0, 10);
+      model->AddField(std::move(fldQuant));
+      auto fldItem = std::make_unique<RField<float>>("_0");
+      fldItem->SetTruncated(20);
+      model->AddField(std::make_unique<ROOT::Experimental::RVectorField>("vec", std::move(fldItem)));
+
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto e = writer->CreateEntry();
+      for (int i = 0; i < 1000; ++i) {
+         const float value = -10.f + i * 0.02f;
+         *e->Get<float>("half") = value;
+         *e->Get<double>("trunc") = value;
+         *e->Get<float>("quant") = value;
+         e->Get<std::vector<float>>("vec")->assign(i % 3, value);
+         writer->Fill(*e);
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = *reader->GetDescriptor();
+   const auto &modelQuant = desc.GetColumnDescriptor(desc.FindLogicalColumnId(desc.FindFieldId("quant"), 0)).GetModel();
+   EXPECT_EQ(EColumnType::kReal32Quant, modelQuant.GetType());
+   EXPECT_EQ(10u, modelQuant.GetBitsOnStorage());
+   ASSERT_TRUE(modelQuant.GetValueRange());
+   EXPECT_DOUBLE_EQ(-10.0, modelQuant.GetValueRange()->first);
+   EXPECT_DOUBLE_EQ(10.0, modelQuant.GetValueRange()->second);
+   const auto &modelTrunc = desc.GetColumnDescriptor(desc.FindLogicalColumnId(desc.FindFieldId("trunc"), 0)).GetModel();
+   EXPECT_EQ(EColumnType::kReal32Trunc, modelTrunc.GetType());
+   EXPECT_EQ(16u, modelTrunc.GetBitsOnStorage());
+
+   auto viewHalf = reader->GetView<float>("half");
+   auto viewTrunc = reader->GetView<double>("trunc");
+   auto viewQuant = reader->GetView<float>("quant");
+   auto viewVec = reader->GetView<std::vector<float>>("vec");
+   for (auto i : reader->GetEntryRange()) {
+      const float value = -10.f + i * 0.02f;
+      EXPECT_NEAR(value, viewHalf(i), std::abs(value) / 1024 + 1e-7);
+      EXPECT_NEAR(value, viewTrunc(i), std::abs(value) / 64);
+      EXPECT_NEAR(value, viewQuant(i), 20. / 1023 / 2 + 1e-6);
+      ASSERT_EQ(i % 3, viewVec(i).size());
+      for (auto v : viewVec(i))
+         EXPECT_NEAR(value, v, std::abs(value) / 2048);
+   }
+}
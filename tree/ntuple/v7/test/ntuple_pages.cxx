@@ -12,6 +12,62 @@ TEST(Pages, Allocation)
    allocator.DeletePage(page);
 }
 
+TEST(Pages, AllocatorPool)
+{
+   RPageAllocatorPool allocator(2 * RPageAllocatorPool::kMinPooledSize);
+   allocator.GetMetrics().Enable();
+   auto nHit = allocator.GetMetrics().GetCounter("RPageAllocatorPool.nHit");
+   auto nMiss = allocator.GetMetrics().GetCounter("RPageAllocatorPool.nMiss");
+   auto szRetained = allocator.GetMetrics().GetCounter("RPageAllocatorPool.szRetained");
+   ASSERT_NE(nullptr, nHit);
+   ASSERT_NE(nullptr, nMiss);
+   ASSERT_NE(nullptr, szRetained);
+
+   auto page1 = allocator.NewPage(42, 4, 16);
+   EXPECT_FALSE(page1.IsNull());
+   EXPECT_EQ(16U, page1.GetMaxElements());
+   EXPECT_EQ(0U, page1.GetNElements());
+   auto buffer1 = page1.GetBuffer();
+   allocator.DeletePage(page1);
+   EXPECT_EQ(RPageAllocatorPool::kMinPooledSize, allocator.GetSzRetained());
+   EXPECT_EQ(RPageAllocatorPool::kMinPooledSize, static_cast<std::size_t>(szRetained->GetValueAsInt()));
+
+   // Pages of the same size class reuse the buffer, the page capacity is the requested one
+   auto page2 = allocator.NewPage(43, 8, 100);
+   EXPECT_EQ(buffer1, page2.GetBuffer());
+   EXPECT_EQ(100U, page2.GetMaxElements());
+   EXPECT_EQ(0U, allocator.GetSzRetained());
+   EXPECT_EQ(1, nHit->GetValueAsInt());
+   EXPECT_EQ(1, nMiss->GetValueAsInt());
+
+   // Only a single buffer of the second size class fits in the retention limit
+   auto page3 = allocator.NewPage(44, 1, RPageAllocatorPool::kMinPooledSize + 1);
+   auto page4 = allocator.NewPage(45, 1, 2 * RPageAllocatorPool::kMinPooledSize);
+   allocator.DeletePage(page3);
+   EXPECT_EQ(2 * RPageAllocatorPool::kMinPooledSize, allocator.GetSzRetained());
+   allocator.DeletePage(page4);
+   allocator.DeletePage(page2);
+   EXPECT_EQ(2 * RPageAllocatorPool::kMinPooledSize, allocator.GetSzRetained());
+
+   // Large pages are not pooled
+   auto page5 = allocator.NewPage(46, 1, RPageAllocatorPool::kMaxPooledSize + 1);
+   EXPECT_FALSE(page5.IsNull());
+   allocator.DeletePage(page5);
+   EXPECT_EQ(2 * RPageAllocatorPool::kMinPooledSize, allocator.GetSzRetained());
+   EXPECT_EQ(1, nHit->GetValueAsInt());
+   EXPECT_EQ(4, nMiss->GetValueAsInt());
+
+   // The page zero is never deleted
+   allocator.DeletePage(RPage::MakePageZero(47, 4));
+   EXPECT_EQ(2 * RPageAllocatorPool::kMinPooledSize, allocator.GetSzRetained());
+
+   allocator.Release();
+   EXPECT_EQ(0U, allocator.GetSzRetained());
+   allocator.SetMaxRetained(0);
+   allocator.DeletePage(allocator.NewPage(48, 4, 16));
+   EXPECT_EQ(0U, allocator.GetSzRetained());
+}
+
 TEST(Pages, Pool)
 {
    RPagePool pool;
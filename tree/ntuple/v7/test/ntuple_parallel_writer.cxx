@@ -0,0 +1,128 @@
+#include "ntuple_test.hxx"
+
+#include <algorithm>
+
+TEST(RNTupleParallelWriter, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_basics.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      model->MakeField<std::vector<int>>("vec");
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+
+      auto fillContext = writer->CreateFillContext();
+      auto entry = fillContext->CreateEntry();
+      auto pt = entry->Get<float>("pt");
+      auto vec = entry->Get<std::vector<int>>("vec");
+      for (int i = 0; i < 3; ++i) {
+         *pt = i;
+         vec->assign(i, i);
+         fillContext->Fill(*entry);
+         if (i == 1)
+            fillContext->CommitCluster();
+      }
+      EXPECT_EQ(3U, fillContext->GetNEntries());
+      EXPECT_EQ(2U, writer->GetNEntries());
+
+      // Entries of the writer's model or of other fill contexts cannot be used
+      auto otherContext = writer->CreateFillContext();
+      EXPECT_THROW(fillContext->Fill(*otherContext->CreateEntry()), RException);
+      EXPECT_THROW(fillContext->Fill(*writer->GetModel()->CreateEntry()), RException);
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(3U, reader->GetNEntries());
+   EXPECT_EQ(2U, reader->GetDescriptor()->GetNClusters());
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewVec = reader->GetView<std::vector<int>>("vec");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(i, viewPt(i));
+      EXPECT_EQ(std::vector<int>(i, i), viewVec(i));
+   }
+}
+
+TEST(RNTupleParallelWriter, ContextOutlivesWriter)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_outlives.root");
+
+   std::shared_ptr<RNTupleFillContext> fillContext;
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<std::string>("str");
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      fillContext = writer->CreateFillContext();
+      *fillContext->GetModel()->GetDefaultEntry()->Get<std::string>("str") = "abc";
+      fillContext->Fill();
+   }
+   // The writer has committed the outstanding cluster
+   fillContext.reset();
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   ASSERT_EQ(1U, reader->GetNEntries());
+   EXPECT_EQ("abc", reader->GetView<std::string>("str")(0));
+}
+
+TEST(RNTupleParallelWriter, Multithreaded)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_mt.root");
+
+   constexpr int kNThreads = 4;
+   constexpr int kNEntriesPerThread = 10000;
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<std::int32_t>("id");
+      model->MakeField<std::vector<float>>("vec");
+      RNTupleWriteOptions options;
+      options.SetApproxZippedClusterSize(8 * 1024);
+      options.SetApproxUnzippedPageSize(1024);
+      options.SetHasValueRanges(true);
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t]() {
+            auto fillContext = writer->CreateFillContext();
+            auto entry = fillContext->CreateEntry();
+            auto id = entry->Get<std::int32_t>("id");
+            auto vec = entry->Get<std::vector<float>>("vec");
+            for (int i = 0; i < kNEntriesPerThread; ++i) {
+               *id = t * kNEntriesPerThread + i;
+               vec->assign(i % 5, static_cast<float>(*id));
+               fillContext->Fill(*entry);
+            }
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+      EXPECT_EQ(static_cast<NTupleSize_t>(kNThreads * kNEntriesPerThread), writer->GetNEntries());
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   ASSERT_EQ(static_cast<NTupleSize_t>(kNThreads * kNEntriesPerThread), reader->GetNEntries());
+   EXPECT_LT(kNThreads, reader->GetDescriptor()->GetNClusters());
+
+   auto viewId = reader->GetView<std::int32_t>("id");
+   auto viewVec = reader->GetView<std::vector<float>>("vec");
+   std::vector<std::int32_t> ids;
+   for (auto i : reader->GetEntryRange()) {
+      const auto id = viewId(i);
+      ids.emplace_back(id);
+      const auto &vec = viewVec(i);
+      ASSERT_EQ(static_cast<std::size_t>((id % kNEntriesPerThread) % 5), vec.size());
+      for (auto v : vec)
+         EXPECT_FLOAT_EQ(id, v);
+   }
+
+   // Within a cluster, the entries stem from a single thread and are in order
+   for (const auto &cluster : reader->GetDescriptor()->GetClusterIterable()) {
+      const auto first = cluster.GetFirstEntryIndex();
+      for (NTupleSize_t i = first + 1; i < first + cluster.GetNEntries(); ++i)
+         EXPECT_EQ(ids[i - 1] + 1, ids[i]);
+   }
+
+   std::sort(ids.begin(), ids.end());
+   for (int i = 0; i < kNThreads * kNEntriesPerThread; ++i)
+      EXPECT_EQ(i, ids[i]);
+}
@@ -624,6 +624,80 @@ TEST(RNTuple, SerializeFooter)
    EXPECT_EQ(7000u, pageRange.fPageInfos[0].fLocator.GetPosition<std::uint64_t>());
 }
 
+TEST(RNTuple, SerializePageListRecords)
+{
+   // A page list with one cluster, one column and one page, followed by the given optional records
+   auto fnSerialize = [](void *buffer, bool unknownFirst) -> std::uint32_t {
+      auto base = reinterpret_cast<unsigned char *>(buffer);
+      auto pos = base;
+      void **where = (buffer == nullptr) ? &buffer : reinterpret_cast<void **>(&pos);
+
+      auto fnValueRanges = [&]() {
+         pos += RNTupleSerializer::SerializeUInt32(RNTupleSerializer::kPageListTagValueRanges, *where);
+         auto frame = pos;
+         pos += RNTupleSerializer::SerializeListFramePreamble(1, *where);
+         pos += RNTupleSerializer::SerializeDouble(-1.5, *where);
+         pos += RNTupleSerializer::SerializeDouble(2.5, *where);
+         pos += RNTupleSerializer::SerializeFramePostscript(buffer ? frame : nullptr, pos - frame);
+      };
+      auto fnUnknown = [&]() {
+         pos += RNTupleSerializer::SerializeUInt32(0x7F, *where);
+         pos += RNTupleSerializer::SerializeUInt64(42, *where);
+      };
+
+      pos += RNTupleSerializer::SerializeEnvelopePreamble(*where);
+      auto topMostFrame = pos;
+      pos += RNTupleSerializer::SerializeListFramePreamble(1, *where);
+      auto outerFrame = pos;
+      pos += RNTupleSerializer::SerializeListFramePreamble(1, *where);
+      auto innerFrame = pos;
+      pos += RNTupleSerializer::SerializeListFramePreamble(1, *where);
+      pos += RNTupleSerializer::SerializeUInt32(100, *where);
+      RNTupleLocator locator;
+      locator.fPosition = 7000U;
+      locator.fBytesOnStorage = 400;
+      pos += RNTupleSerializer::SerializeLocator(locator, *where);
+      pos += RNTupleSerializer::SerializeUInt64(0, *where);
+      pos += RNTupleSerializer::SerializeUInt32(505, *where);
+      if (unknownFirst) {
+         fnUnknown();
+         fnValueRanges();
+      } else {
+         fnValueRanges();
+         fnUnknown();
+      }
+      pos += RNTupleSerializer::SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
+      pos += RNTupleSerializer::SerializeFramePostscript(buffer ? outerFrame : nullptr, pos - outerFrame);
+      pos += RNTupleSerializer::SerializeFramePostscript(buffer ? topMostFrame : nullptr, pos - topMostFrame);
+      std::uint32_t size = pos - base;
+      size += RNTupleSerializer::SerializeEnvelopePostscript(base, size, *where);
+      return size;
+   };
+
+   for (bool unknownFirst : {false, true}) {
+      const auto size = fnSerialize(nullptr, unknownFirst);
+      auto buffer = std::make_unique<unsigned char[]>(size);
+      EXPECT_EQ(size, fnSerialize(buffer.get(), unknownFirst));
+
+      std::vector<RClusterDescriptorBuilder> clusters;
+      clusters.emplace_back(0, 0, 100);
+      RNTupleSerializer::DeserializePageListV1(buffer.get(), size, clusters).ThrowOnError();
+      const auto clusterDesc = clusters[0].MoveDescriptor().Unwrap();
+      const auto &pageInfo = clusterDesc.GetPageRange(0).fPageInfos.at(0);
+      EXPECT_EQ(100u, pageInfo.fNElements);
+      EXPECT_EQ(7000u, pageInfo.fLocator.GetPosition<std::uint64_t>());
+      EXPECT_EQ(505u, clusterDesc.GetColumnRange(0).fCompressionSettings);
+      if (unknownFirst) {
+         // the records after an unknown one are skipped
+         EXPECT_FALSE(pageInfo.fValueRange.has_value());
+      } else {
+         ASSERT_TRUE(pageInfo.fValueRange.has_value());
+         EXPECT_EQ(-1.5, pageInfo.fValueRange->fMin);
+         EXPECT_EQ(2.5, pageInfo.fValueRange->fMax);
+      }
+   }
+}
+
 TEST(RNTuple, SerializeFooterXHeader)
 {
    RNTupleDescriptorBuilder builder;
@@ -212,6 +212,55 @@ TEST(RNTuple, PageFilling) {
    EXPECT_EQ(1u, pr3.fPageInfos[1].fNElements);
 }
 
+TEST(RNTuple, AdaptivePageSize)
+{
+   FileRaii fileGuard("test_ntuple_adaptive_page_size.root");
+
+   auto model = RNTupleModel::Create();
+   auto fldConst = model->MakeField<std::int32_t>("const");
+   auto fldNoise = model->MakeField<std::uint32_t>("noise");
+
+   RNTupleWriteOptions options;
+   options.SetApproxZippedPageSize(8 * 1024);
+
+   constexpr int kNEntriesPerCluster = 100000;
+   std::uint32_t state = 42;
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int c = 0; c < 3; ++c) {
+         for (int i = 0; i < kNEntriesPerCluster; ++i) {
+            *fldConst = 137;
+            state = state * 1664525u + 1013904223u;
+            *fldNoise = state;
+            ntuple->Fill();
+         }
+         ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   ASSERT_EQ(3u * kNEntriesPerCluster, ntuple->GetNEntries());
+   auto viewConst = ntuple->GetView<std::int32_t>("const");
+   for (auto i : ntuple->GetEntryRange())
+      EXPECT_EQ(137, viewConst(i));
+
+   const auto desc = ntuple->GetDescriptor();
+   ASSERT_EQ(3u, desc->GetNClusters());
+   const auto constColId = desc->FindPhysicalColumnId(desc->FindFieldId("const"), 0);
+   const auto noiseColId = desc->FindPhysicalColumnId(desc->FindFieldId("noise"), 0);
+   const auto &firstCluster = desc->GetClusterDescriptor(desc->FindClusterId(constColId, 0));
+   const auto &lastCluster =
+      desc->GetClusterDescriptor(desc->FindClusterId(constColId, 3 * kNEntriesPerCluster - 1));
+   // The first cluster uses the default page size; the compressible column gets larger pages later on, the
+   // incompressible column gets smaller pages
+   EXPECT_LT(lastCluster.GetPageRange(constColId).fPageInfos.size(),
+             firstCluster.GetPageRange(constColId).fPageInfos.size());
+   EXPECT_GT(lastCluster.GetPageRange(noiseColId).fPageInfos.size(),
+             firstCluster.GetPageRange(noiseColId).fPageInfos.size());
+   for (const auto &pageInfo : lastCluster.GetPageRange(noiseColId).fPageInfos)
+      EXPECT_LT(pageInfo.fLocator.fBytesOnStorage, 2 * 8 * 1024);
+}
+
 TEST(RNTuple, PageFillingString) {
    FileRaii fileGuard("test_ntuple_page_filling_string.root");
 
@@ -528,3 +577,120 @@ TEST(RPageSink, MultipleClusterGroups)
    ntuple->LoadEntry(2);
    EXPECT_EQ(12.0, *rdPt);
 }
+
+TEST(RPageSink, ValueRanges)
+{
+   FileRaii fileGuard("test_ntuple_value_ranges.ntuple");
+
+   for (bool useBufferedWrite : {true, false}) {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTag = model->MakeField<std::string>("tag");
+      RNTupleWriteOptions options;
+      options.SetHasValueRanges(true);
+      options.SetUseBufferedWrite(useBufferedWrite);
+      {
+         auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options);
+         // Three clusters with the pt values [0, 9], [100, 109], and [NaN, 20, 29]
+         for (int i = 0; i < 10; ++i) {
+            *wrPt = i;
+            ntuple->Fill();
+         }
+         ntuple->CommitCluster();
+         for (int i = 100; i < 110; ++i) {
+            *wrPt = i;
+            ntuple->Fill();
+         }
+         ntuple->CommitCluster();
+         *wrPt = std::numeric_limits<float>::quiet_NaN();
+         ntuple->Fill();
+         for (int i = 20; i < 30; ++i) {
+            *wrPt = i;
+            ntuple->Fill();
+         }
+      }
+
+      auto source = RPageSource::Create("f", fileGuard.GetPath());
+      source->Attach();
+      DescriptorId_t ptColumnId;
+      DescriptorId_t tagColumnId;
+      {
+         auto descriptorGuard = source->GetSharedDescriptorGuard();
+         ASSERT_EQ(3U, descriptorGuard->GetNClusters());
+         ptColumnId = descriptorGuard->FindPhysicalColumnId(descriptorGuard->FindFieldId("pt"), 0);
+         tagColumnId = descriptorGuard->FindPhysicalColumnId(descriptorGuard->FindFieldId("tag"), 1);
+         const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(descriptorGuard->FindClusterId(ptColumnId, 0));
+         const auto &valueRange = clusterDesc.GetColumnRange(ptColumnId).fValueRange;
+         ASSERT_TRUE(valueRange.has_value());
+         EXPECT_EQ(0.0, valueRange->fMin);
+         EXPECT_EQ(9.0, valueRange->fMax);
+         for (const auto &pi : clusterDesc.GetPageRange(ptColumnId).fPageInfos)
+            EXPECT_TRUE(pi.fValueRange.has_value());
+         // Characters of strings have no meaningful value range
+         EXPECT_FALSE(clusterDesc.GetColumnRange(tagColumnId).fValueRange.has_value());
+      }
+
+      EXPECT_EQ(3U, source->FindClustersInValueRange(ptColumnId, -10.0, 200.0).size());
+      EXPECT_EQ(2U, source->FindClustersInValueRange(ptColumnId, 5.0, 25.0).size());
+      EXPECT_EQ(1U, source->FindClustersInValueRange(ptColumnId, 109.0, 1000.0).size());
+      EXPECT_TRUE(source->FindClustersInValueRange(ptColumnId, 10.0, 19.0).empty());
+      // Columns without value ranges never exclude a cluster
+      EXPECT_EQ(3U, source->FindClustersInValueRange(tagColumnId, 10.0, 19.0).size());
+   }
+
+   // Value ranges are disabled by default
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt", 1.0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath());
+      ntuple->Fill();
+   }
+   auto source = RPageSource::Create("f", fileGuard.GetPath());
+   source->Attach();
+   auto descriptorGuard = source->GetSharedDescriptorGuard();
+   const auto ptColumnId = descriptorGuard->FindPhysicalColumnId(descriptorGuard->FindFieldId("pt"), 0);
+   EXPECT_FALSE(descriptorGuard->GetClusterDescriptor(0).GetColumnRange(ptColumnId).fValueRange.has_value());
+}
+
+TEST(RPageSourceFile, Mmap)
+{
+   FileRaii fileGuard("test_ntuple_mmap.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrByte = model->MakeField<std::uint8_t>("byte");
+      auto wrPx = model->MakeField<double>("px");
+      auto wrTag = model->MakeField<std::string>("tag");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; ++i) {
+         *wrByte = i % 256;
+         *wrPx = 0.5 * i;
+         *wrTag = std::to_string(i);
+         ntuple->Fill();
+         if (i == 499)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      RNTupleReadOptions options;
+      options.SetUseMmap(true);
+      options.SetClusterCache(clusterCache);
+      auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      auto viewByte = ntuple->GetView<std::uint8_t>("byte");
+      auto viewPx = ntuple->GetView<double>("px");
+      auto viewTag = ntuple->GetView<std::string>("tag");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_EQ(i % 256, viewByte(i));
+         EXPECT_DOUBLE_EQ(0.5 * i, viewPx(i));
+         EXPECT_EQ(std::to_string(i), viewTag(i));
+      }
+      // Byte columns have no alignment constraints and are thus always served from the mapping
+      auto nPageMapped = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPageMapped");
+      ASSERT_NE(nullptr, nPageMapped);
+      EXPECT_GE(nPageMapped->GetValueAsInt(), 2);
+   }
+}
@@ -210,6 +210,74 @@ TEST_F(RPageStorageDaos, MultipleNTuplesPerContainer)
    EXPECT_THROW(RNTupleReader::Open("ntuple3", daosUri), ROOT::Experimental::RException);
 }
 
+TEST_F(RPageStorageDaos, ColumnObjectClass)
+{
+   std::string daosUri = RegisterLabel("ntuple-test-column-oclass");
+   const std::string_view ntupleName("ntuple");
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+
+      RNTupleWriteOptionsDaos options;
+      options.SetColumnObjectClass("pt", "UNKNOWN");
+      EXPECT_THROW(RNTupleWriter::Recreate(std::move(model), ntupleName, daosUri, options),
+                   ROOT::Experimental::RException);
+   }
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+
+      RNTupleWriteOptionsDaos options;
+      options.SetColumnObjectClass("eta", "RP_XSF");
+      EXPECT_THROW(RNTupleWriter::Recreate(std::move(model), ntupleName, daosUri, options),
+                   ROOT::Experimental::RException);
+   }
+
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt", 42.0);
+      auto wrVector = model->MakeField<std::vector<float>>("vector");
+
+      RNTupleWriteOptionsDaos options;
+      options.SetMaxCageSize(0);
+      options.SetColumnObjectClass("vector", "RP_XSF");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), ntupleName, daosUri, options);
+      for (unsigned int i = 0; i < 100; ++i) {
+         *wrPt = i;
+         wrVector->assign(i % 10, i);
+         ntuple->Fill();
+         if (i % 30 == 0)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto readOptions = RNTupleReadOptions();
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      readOptions.SetClusterCache(clusterCache);
+      auto ntuple = RNTupleReader::Open(ntupleName, daosUri, readOptions);
+      ASSERT_EQ(100U, ntuple->GetNEntries());
+      auto rdPt = ntuple->GetModel()->GetDefaultEntry()->Get<float>("pt");
+      auto rdVector = ntuple->GetModel()->GetDefaultEntry()->Get<std::vector<float>>("vector");
+      for (auto entryId : *ntuple) {
+         ntuple->LoadEntry(entryId);
+         EXPECT_EQ(static_cast<float>(entryId), *rdPt);
+         EXPECT_EQ(std::vector<float>(entryId % 10, entryId), *rdVector);
+      }
+   }
+
+   ROOT::Experimental::Detail::RPageSourceDaos source(ntupleName, daosUri, readOptions);
+   source.Attach();
+   EXPECT_EQ("SX", source.GetObjectClass());
+   auto descriptorGuard = source.GetSharedDescriptorGuard();
+   const auto &desc = descriptorGuard.GetRef();
+   const auto ptId = desc.FindFieldId("pt");
+   const auto vectorId = desc.FindFieldId("vector");
+   const auto itemId = desc.FindFieldId("_0", vectorId);
+   EXPECT_EQ("SX", source.GetColumnObjectClass(desc.FindPhysicalColumnId(ptId, 0)));
+   EXPECT_EQ("RP_XSF", source.GetColumnObjectClass(desc.FindPhysicalColumnId(vectorId, 0)));
+   EXPECT_EQ("RP_XSF", source.GetColumnObjectClass(desc.FindPhysicalColumnId(itemId, 0)));
+}
+
 #ifdef R__USE_IMT
 // This feature depends on RPageSinkBuf and the ability to issue a single `CommitSealedPageV()` call; thus, disable if
 // ROOT was built with `-Dimt=OFF`
@@ -659,7 +659,9 @@ TEST(RNTuple, Bitset)
 struct RTagNullableFieldDefault {};
 struct RTagNullableFieldSparse {};
 struct RTagNullableFieldDense {};
-using UniquePtrTags = ::testing::Types<RTagNullableFieldDefault, RTagNullableFieldSparse, RTagNullableFieldDense>;
+struct RTagNullableFieldCompact {};
+using UniquePtrTags = ::testing::Types<RTagNullableFieldDefault, RTagNullableFieldSparse, RTagNullableFieldDense,
+                                       RTagNullableFieldCompact>;
 
 template <typename TagT>
 class UniquePtr : public ::testing::Test {
@@ -679,6 +681,9 @@ static void AddUniquePtrField(RNTupleModel &model, const std::string &fieldName)
    if constexpr (std::is_same_v<TagT, RTagNullableFieldDense>) {
       fld->SetDense();
    }
+   if constexpr (std::is_same_v<TagT, RTagNullableFieldCompact>) {
+      fld->SetCompact();
+   }
    model.AddField(std::move(fld));
 }
 
@@ -724,6 +729,12 @@ TYPED_TEST(UniquePtr, Basics)
          EXPECT_TRUE(dynamic_cast<const RUniquePtrField *>(writer->GetModel()->GetField("PPString"))->IsDense());
          EXPECT_TRUE(dynamic_cast<const RUniquePtrField *>(writer->GetModel()->GetField("PArray"))->IsDense());
       }
+      if constexpr (std::is_same_v<typename TestFixture::Tag_t, RTagNullableFieldCompact>) {
+         EXPECT_TRUE(dynamic_cast<const RUniquePtrField *>(writer->GetModel()->GetField("PBool"))->IsCompact());
+         EXPECT_TRUE(dynamic_cast<const RUniquePtrField *>(writer->GetModel()->GetField("PCustomStruct"))->IsCompact());
+         EXPECT_FALSE(dynamic_cast<const RUniquePtrField *>(writer->GetModel()->GetField("PCustomStruct"))->IsDense());
+         EXPECT_FALSE(dynamic_cast<const RUniquePtrField *>(writer->GetModel()->GetField("PArray"))->IsSparse());
+      }
 
       auto pBool = writer->GetModel()->Get<std::unique_ptr<bool>>("PBool");
       auto pCustomStruct = writer->GetModel()->Get<std::unique_ptr<CustomStruct>>("PCustomStruct");
@@ -810,6 +821,65 @@ TYPED_TEST(UniquePtr, Basics)
    EXPECT_EQ(nullptr, pIOConstructor->get());
    EXPECT_EQ("de", *(ppString->get()->get()));
    EXPECT_EQ(nullptr, pArray->get());
+
+   // Reading backwards
+   reader->LoadEntry(2);
+   EXPECT_FLOAT_EQ(42.0, pCustomStruct->get()->a);
+   EXPECT_EQ("abc", *(ppString->get()->get()));
+   reader->LoadEntry(0);
+   EXPECT_TRUE(*(pBool->get()));
+   EXPECT_EQ(nullptr, pCustomStruct->get());
+}
+
+TEST(RNTuple, UniquePtrCompact)
+{
+   FileRaii fileGuard("test_ntuple_unique_ptr_compact.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto fld = std::make_unique<RField<std::unique_ptr<float>>>("trigger");
+      fld->SetCompact();
+      model->AddField(std::move(fld));
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto trigger = writer->GetModel()->Get<std::unique_ptr<float>>("trigger");
+      for (int i = 0; i < 1000; ++i) {
+         if (i % 100 == 7)
+            *trigger = std::make_unique<float>(i);
+         else
+            trigger->reset();
+         writer->Fill();
+         if (i == 499)
+            writer->CommitCluster();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = *reader->GetDescriptor();
+   const auto fieldId = desc.FindFieldId("trigger");
+   EXPECT_EQ(1u, desc.GetFieldDescriptor(fieldId).GetFieldVersion());
+   // Only the available items are stored
+   const auto itemColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("_0", fieldId), 0);
+   for (const auto &clusterDesc : desc.GetClusterIterable())
+      EXPECT_EQ(5u, clusterDesc.GetColumnRange(itemColumnId).fNElements);
+
+   EXPECT_TRUE(dynamic_cast<const ROOT::Experimental::RUniquePtrField *>(reader->GetModel()->GetField("trigger"))
+                  ->IsCompact());
+   auto trigger = reader->GetModel()->GetDefaultEntry()->Get<std::unique_ptr<float>>("trigger");
+   for (auto i : reader->GetEntryRange()) {
+      reader->LoadEntry(i);
+      if (i % 100 == 7) {
+         ASSERT_TRUE(*trigger);
+         EXPECT_FLOAT_EQ(i, **trigger);
+      } else {
+         EXPECT_FALSE(*trigger);
+      }
+   }
+   reader->LoadEntry(907);
+   EXPECT_FLOAT_EQ(907, **trigger);
+   reader->LoadEntry(107);
+   EXPECT_FLOAT_EQ(107, **trigger);
+   reader->LoadEntry(607);
+   EXPECT_FLOAT_EQ(607, **trigger);
 }
 
 TEST(RNTuple, UnsupportedStdTypes)
@@ -24,12 +24,14 @@
 #include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <TChain.h>
 #include <TFile.h>
 #include <TTree.h>
 
 #include <cstdlib>
 #include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
 class TLeaf;
@@ -87,6 +89,13 @@ Most RNTuple fields have a type identical to the corresponding TTree input branc
       ROOT::RVec<float> jet_eta (projected from _collection0.jet_eta)
     These projections are meta-data only operations and don't involve duplicating the data.
 
+With `SetParallelImport(true)` and implicit multi-threading enabled (`ROOT::EnableImplicitMT()`), the entries are
+imported by tasks that each read a range of input clusters through their own handle of the input tree and fill the
+RNTuple through their own RNTupleFillContext of an RNTupleParallelWriter. The pages are thus compressed in parallel
+by the import tasks, and the reading of a range of clusters is prefetched by the TTreeCache of the task. Note that the
+order of the entries in the RNTuple then differs from the order of the input tree: the entries of a cluster of the
+input stay together, but the clusters are written in the order in which the tasks finish them.
+
 Current limitations of the importer:
   - No support for trees containing TObject (or derived classes) or TClonesArray collections
   - Due to RNTuple currently storing data fully split, "don't split" markers are ignored
@@ -204,10 +213,19 @@ private:
       void ResetEntry() final { fNum = 0; }
    };
 
+   /// State of a task of the parallel import: its own handle of the input and its own fill context
+   struct RImportTask;
+
    RNTupleImporter() = default;
 
    std::unique_ptr<TFile> fSourceFile;
    TTree *fSourceTree;
+   /// The input file and the path of the tree in the file, used to open the input again in the parallel import
+   /// tasks; empty if the input was given as a tree that is not stored in a file
+   std::string fSourceFileName;
+   std::string fSourceTreeName;
+   /// Set in the importers of the parallel import tasks if the input is a chain
+   std::unique_ptr<TChain> fSourceChain;
 
    std::string fDestFileName;
    std::string fNTupleName;
@@ -221,6 +239,9 @@ private:
    /// The maximum number of entries to import. When this value is -1 (default), import all entries.
    std::int64_t fMaxEntries = -1;
 
+   /// Import clusters of the input in parallel, see SetParallelImport()
+   bool fIsParallel = false;
+
    /// No standard output, conversely if set to false, schema information and progress is printed.
    bool fIsQuiet = false;
    std::unique_ptr<RProgressCallback> fProgressCallback;
@@ -241,6 +262,15 @@ private:
    /// buffers used for reading and writing.
    RResult<void> PrepareSchema();
    void ReportSchema();
+   /// Reads the given input entry and applies the transformations, so that fEntry can be filled into the RNTuple
+   void ReadEntry(Long64_t entry);
+   /// Returns a new importer that reads the same input through its own tree, with its schema prepared, for a task of
+   /// the parallel import; nullptr if the input cannot be opened again
+   std::unique_ptr<RNTupleImporter> CloneForTask() const;
+   /// Returns the entry ranges of the parallel import tasks, aligned with the input clusters
+   std::vector<std::pair<Long64_t, Long64_t>> GetTaskRanges(Long64_t nEntries, unsigned int nTasks) const;
+   void ImportSequential(Long64_t nEntries);
+   void ImportParallel(Long64_t nEntries);
 
 public:
    RNTupleImporter(const RNTupleImporter &other) = delete;
@@ -268,11 +298,17 @@ public:
    /// Whether or not information and progress is printed to stdout.
    void SetIsQuiet(bool value) { fIsQuiet = value; }
 
+   /// Whether the clusters of the input are imported in parallel, using the implicit multi-threading thread pool.
+   /// Without implicit multi-threading enabled, or if the input tree cannot be opened again by the import tasks (e.g.
+   /// an in-memory tree), the import is sequential.  Note that the order of the entries is not preserved.
+   void SetParallelImport(bool value) { fIsParallel = value; }
+
    /// Import works in two steps:
    /// 1. PrepareSchema() calls SetBranchAddress() on all the TTree branches and creates the corresponding RNTuple
    ///    fields and the model
    /// 2. An event loop reads every entry from the TTree, applies transformations where necessary, and writes the
-   ///    output entry to the RNTuple.
+   ///    output entry to the RNTuple.  In the parallel import, every task prepares its own schema for its own input
+   ///    tree and runs the event loop over its entry ranges.
    void Import();
 }; // class RNTupleImporter
 
@@ -22,8 +22,12 @@
 
 #include <TFile.h>
 
+#include <cstdint>
 #include <cstdlib>
+#include <map>
 #include <memory>
+#include <ostream>
+#include <string>
 #include <vector>
 #include <regex>
 
@@ -55,6 +59,15 @@ std::cout << "The compression factor is " << std::fixed << std::setprecision(2)
                                           << inspector->GetCompressionFactor()
                                           << std::endl;
 ~~~
+
+In order to find the columns that are expensive to store or to decode in a large data set, `Scan()` reads and
+decodes all the pages of an RNTuple stored in a list of files, distributing the files over several threads:
+
+~~~ {.cpp}
+auto nThreads = 8;
+auto report = RNTupleInspector::Scan("NTupleName", {"data1.rntuple", "data2.rntuple"}, nThreads);
+report.PrintJSON(std::cout);
+~~~
 */
 // clang-format on
 class RNTupleInspector {
@@ -98,6 +111,36 @@ public:
       std::uint64_t GetInMemorySize() const { return fInMemorySize; }
    };
 
+   /// Aggregated storage and decoding information of the columns with the same field and column index in all the
+   /// scanned RNTuples, see `Scan()`.
+   struct RColumnScanInfo {
+      EColumnType fType = EColumnType::kUnknown;
+      std::uint64_t fNPages = 0;
+      std::uint64_t fNElements = 0;
+      std::uint64_t fOnDiskSize = 0;
+      std::uint64_t fInMemorySize = 0;
+      /// Wall clock time spent on decompressing and unpacking the pages
+      std::uint64_t fDecodeTimeNs = 0;
+      /// Bin i counts the pages whose on-disk size is in [2^i, 2^(i+1)) bytes; empty pages count to bin 0
+      std::vector<std::uint64_t> fPageSizeHistogram;
+
+      void Merge(const RColumnScanInfo &other);
+   };
+
+   /// The result of `Scan()`. Columns are identified by the qualified name of their field and the column index,
+   /// e.g. `jets.pt#0`, so that the columns of RNTuples with the same schema but different ids can be aggregated.
+   struct RScanReport {
+      std::string fNTupleName;
+      std::uint64_t fNFiles = 0;
+      std::uint64_t fNEntries = 0;
+      std::uint64_t fNClusters = 0;
+      std::map<std::string, RColumnScanInfo> fColumnScanInfo;
+
+      void Merge(const RScanReport &other);
+      /// Writes the report as a JSON object; the columns are sorted by decreasing on-disk size
+      void PrintJSON(std::ostream &output) const;
+   };
+
 private:
    std::unique_ptr<TFile> fSourceFile;
    std::unique_ptr<Detail::RPageSource> fPageSource;
@@ -142,6 +185,13 @@ public:
    static std::unique_ptr<RNTupleInspector> Create(RNTuple *sourceNTuple);
    static std::unique_ptr<RNTupleInspector> Create(std::string_view ntupleName, std::string_view storage);
 
+   /// Reads and decodes all the pages of the RNTuple with the given name in each of the storage locations in order to
+   /// measure the on-disk size, the page sizes and the decoding time of every column. The storage locations are
+   /// distributed over the given number of threads; zero threads use all the available cores. The RNTuples must have
+   /// compatible schemas, i.e. the same column types for the same fields.
+   static RScanReport
+   Scan(std::string_view ntupleName, const std::vector<std::string> &storages, unsigned int nThreads = 0);
+
    /// Get the descriptor for the RNTuple being inspected.
    RNTupleDescriptor *GetDescriptor() const { return fDescriptor.get(); }
 
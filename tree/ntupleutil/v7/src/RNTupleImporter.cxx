@@ -18,6 +18,7 @@
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleImporter.hxx>
 #include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RNTupleParallelWriter.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
@@ -25,17 +26,25 @@
 
 #include <TBranch.h>
 #include <TChain.h>
+#include <TChainElement.h>
 #include <TClass.h>
 #include <TDataType.h>
 #include <TLeaf.h>
 #include <TLeafC.h>
 #include <TLeafElement.h>
 #include <TLeafObject.h>
+#include <TROOT.h> // for IsImplicitMTEnabled()
+
+#ifdef R__USE_IMT
+#include <ROOT/RSlotStack.hxx>
+#include <ROOT/TThreadExecutor.hxx>
+#endif
 
 #include <cassert>
 #include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <mutex>
 #include <utility>
 
 namespace {
@@ -96,6 +105,8 @@ ROOT::Experimental::RNTupleImporter::Create(std::string_view sourceFileName, std
    if (!importer->fSourceTree) {
       throw RException(R__FAIL("cannot read TTree " + std::string(treeName) + " from " + std::string(sourceFileName)));
    }
+   importer->fSourceFileName = sourceFileName;
+   importer->fSourceTreeName = treeName;
 
    // If we have IMT enabled, its best use is for parallel page compression
    importer->fSourceTree->SetImplicitMT(false);
@@ -121,6 +132,14 @@ ROOT::Experimental::RNTupleImporter::Create(TTree *sourceTree, std::string_view
    }
 
    importer->fSourceTree = sourceTree;
+   if (sourceTree->IsA() != TChain::Class() && sourceTree->GetCurrentFile()) {
+      // The path of the tree within its file, e.g. "dir/tree" for the directory "file.root:/dir"
+      std::string dirPath = sourceTree->GetDirectory()->GetPath();
+      const auto pos = dirPath.find(":/");
+      dirPath = (pos == std::string::npos) ? "" : dirPath.substr(pos + 2);
+      importer->fSourceFileName = sourceTree->GetCurrentFile()->GetName();
+      importer->fSourceTreeName = dirPath.empty() ? sourceTree->GetName() : dirPath + "/" + sourceTree->GetName();
+   }
 
    // If we have IMT enabled, its best use is for parallel page compression
    importer->fSourceTree->SetImplicitMT(false);
@@ -366,11 +385,57 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::RNTupleImporter::PrepareSc
    return RResult<void>::Success();
 }
 
+void ROOT::Experimental::RNTupleImporter::ReadEntry(Long64_t entry)
+{
+   fSourceTree->GetEntry(entry);
+
+   for (const auto &[_, c] : fLeafCountCollections) {
+      for (Int_t l = 0; l < *c.fCountVal; ++l) {
+         for (auto &t : c.fTransformations) {
+            auto result = t->Transform(fImportBranches[t->fImportBranchIdx], fImportFields[t->fImportFieldIdx]);
+            if (!result)
+               throw RException(R__FORWARD_ERROR(result));
+         }
+         c.fCollectionWriter->Fill(c.fCollectionEntry.get());
+      }
+      for (auto &t : c.fTransformations)
+         t->ResetEntry();
+   }
+
+   for (auto &t : fImportTransformations) {
+      auto result = t->Transform(fImportBranches[t->fImportBranchIdx], fImportFields[t->fImportFieldIdx]);
+      if (!result)
+         throw RException(R__FORWARD_ERROR(result));
+      t->ResetEntry();
+   }
+}
+
 void ROOT::Experimental::RNTupleImporter::Import()
 {
    if (fDestFile->FindKey(fNTupleName.c_str()) != nullptr)
       throw RException(R__FAIL("Key '" + fNTupleName + "' already exists in file " + fDestFileName));
 
+   auto nEntries = fSourceTree->GetEntries();
+
+   if (fMaxEntries >= 0 && fMaxEntries < nEntries) {
+      nEntries = fMaxEntries;
+   }
+
+   bool canImportInParallel = fIsParallel && (nEntries > 0) &&
+                              (!fSourceFileName.empty() || fSourceTree->IsA() == TChain::Class());
+#ifdef R__USE_IMT
+   canImportInParallel = canImportInParallel && IsImplicitMTEnabled();
+#else
+   canImportInParallel = false;
+#endif
+   if (canImportInParallel)
+      ImportParallel(nEntries);
+   else
+      ImportSequential(nEntries);
+}
+
+void ROOT::Experimental::RNTupleImporter::ImportSequential(Long64_t nEntries)
+{
    PrepareSchema();
 
    auto sink = std::make_unique<Detail::RPageSinkFile>(fNTupleName, *fDestFile, fWriteOptions);
@@ -383,40 +448,149 @@ void ROOT::Experimental::RNTupleImporter::Import()
 
    fProgressCallback = fIsQuiet ? nullptr : std::make_unique<RDefaultProgressCallback>();
 
-   auto nEntries = fSourceTree->GetEntries();
+   for (decltype(nEntries) i = 0; i < nEntries; ++i) {
+      ReadEntry(i);
 
-   if (fMaxEntries >= 0 && fMaxEntries < nEntries) {
-      nEntries = fMaxEntries;
+      ntplWriter->Fill(*fEntry);
+
+      if (fProgressCallback)
+         fProgressCallback->Call(ctrZippedBytes->GetValueAsInt(), i);
    }
+   if (fProgressCallback)
+      fProgressCallback->Finish(ctrZippedBytes->GetValueAsInt(), nEntries);
+}
 
-   for (decltype(nEntries) i = 0; i < nEntries; ++i) {
-      fSourceTree->GetEntry(i);
-
-      for (const auto &[_, c] : fLeafCountCollections) {
-         for (Int_t l = 0; l < *c.fCountVal; ++l) {
-            for (auto &t : c.fTransformations) {
-               auto result = t->Transform(fImportBranches[t->fImportBranchIdx], fImportFields[t->fImportFieldIdx]);
-               if (!result)
-                  throw RException(R__FORWARD_ERROR(result));
-            }
-            c.fCollectionWriter->Fill(c.fCollectionEntry.get());
-         }
-         for (auto &t : c.fTransformations)
-            t->ResetEntry();
-      }
+struct ROOT::Experimental::RNTupleImporter::RImportTask {
+   /// Has its own input tree and its own schema, whose model is owned by fFillContext
+   std::unique_ptr<RNTupleImporter> fImporter;
+   /// Declared after fImporter so that it is destructed first, as its last Fill() used the entry of fImporter
+   std::shared_ptr<RNTupleFillContext> fFillContext;
+};
 
-      for (auto &t : fImportTransformations) {
-         auto result = t->Transform(fImportBranches[t->fImportBranchIdx], fImportFields[t->fImportFieldIdx]);
-         if (!result)
-            throw RException(R__FORWARD_ERROR(result));
-         t->ResetEntry();
+std::unique_ptr<ROOT::Experimental::RNTupleImporter> ROOT::Experimental::RNTupleImporter::CloneForTask() const
+{
+   auto importer = std::unique_ptr<RNTupleImporter>(new RNTupleImporter());
+   if (fSourceTree->IsA() == TChain::Class()) {
+      auto sourceChain = static_cast<TChain *>(fSourceTree);
+      importer->fSourceChain = std::make_unique<TChain>(sourceChain->GetName(), sourceChain->GetTitle());
+      for (auto element : TRangeDynCast<TChainElement>(*sourceChain->GetListOfFiles()))
+         importer->fSourceChain->AddFile(element->GetTitle(), element->GetEntries(), element->GetName());
+      importer->fSourceTree = importer->fSourceChain.get();
+   } else {
+      importer->fSourceFile = std::unique_ptr<TFile>(TFile::Open(fSourceFileName.c_str()));
+      if (!importer->fSourceFile || importer->fSourceFile->IsZombie())
+         return nullptr;
+      importer->fSourceTree = importer->fSourceFile->Get<TTree>(fSourceTreeName.c_str());
+      if (!importer->fSourceTree)
+         return nullptr;
+   }
+   importer->fSourceTree->SetImplicitMT(false);
+   importer->fConvertDotsInBranchNames = fConvertDotsInBranchNames;
+   importer->fIsQuiet = true;
+
+   auto result = importer->PrepareSchema();
+   if (!result)
+      throw RException(R__FORWARD_ERROR(result));
+   return importer;
+}
+
+std::vector<std::pair<Long64_t, Long64_t>>
+ROOT::Experimental::RNTupleImporter::GetTaskRanges(Long64_t nEntries, unsigned int nTasks) const
+{
+   // The cluster boundaries of the input, or the tree boundaries for a chain
+   std::vector<Long64_t> boundaries{0};
+   if (fSourceTree->IsA() == TChain::Class()) {
+      auto chain = static_cast<TChain *>(fSourceTree);
+      chain->GetEntries(); // makes sure that the tree offsets are known
+      for (Int_t i = 1; i <= chain->GetNtrees(); ++i)
+         boundaries.emplace_back(chain->GetTreeOffset()[i]);
+   } else {
+      auto clusterIter = fSourceTree->GetClusterIterator(0);
+      Long64_t start;
+      while ((start = clusterIter()) < nEntries)
+         boundaries.emplace_back(clusterIter.GetNextEntry());
+   }
+
+   // Group the clusters into ranges of at least nEntries / nTasks entries
+   const Long64_t minEntriesPerTask = std::max(Long64_t(1), nEntries / nTasks);
+   std::vector<std::pair<Long64_t, Long64_t>> ranges;
+   Long64_t first = 0;
+   for (auto boundary : boundaries) {
+      boundary = std::min(boundary, nEntries);
+      if (boundary - first >= minEntriesPerTask || (boundary == nEntries && boundary > first)) {
+         ranges.emplace_back(first, boundary);
+         first = boundary;
       }
+      if (first == nEntries)
+         break;
+   }
+   if (first < nEntries)
+      ranges.emplace_back(first, nEntries);
+   return ranges;
+}
 
-      ntplWriter->Fill(*fEntry);
+void ROOT::Experimental::RNTupleImporter::ImportParallel(Long64_t nEntries)
+{
+#ifdef R__USE_IMT
+   // The schema of the importer itself only provides the model of the writer; every task fills through its own model
+   PrepareSchema();
 
+   auto writeOptions = fWriteOptions.Clone();
+   // The fill contexts already hand over the pages of entire clusters
+   writeOptions->SetUseBufferedWrite(false);
+   auto sink = std::make_unique<Detail::RPageSinkFile>(fNTupleName, *fDestFile, *writeOptions);
+   auto ntplWriter = std::make_unique<RNTupleParallelWriter>(std::move(fModel), std::move(sink));
+   ntplWriter->EnableMetrics();
+   auto ctrZippedBytes = ntplWriter->GetMetrics().GetCounter("RNTupleParallelWriter.RPageSinkFile.szWritePayload");
+   // The guard needs to be destructed before the writer goes out of scope
+   RImportGuard importGuard(*this);
+
+   fProgressCallback = fIsQuiet ? nullptr : std::make_unique<RDefaultProgressCallback>();
+   std::mutex progressMutex;
+   std::uint64_t nEntriesDone = 0;
+
+   ROOT::TThreadExecutor pool;
+   const auto nSlots = pool.GetPoolSize();
+   // Several tasks per slot balance the load if the clusters take different times to import
+   const auto ranges = GetTaskRanges(nEntries, 4 * nSlots);
+
+   // Created on first use of a slot; destructed before the writer, which commits their last clusters
+   std::vector<std::unique_ptr<RImportTask>> tasks(nSlots);
+   ROOT::Internal::RSlotStack slotStack(nSlots);
+
+   auto importRange = [&](const std::pair<Long64_t, Long64_t> &range) {
+      ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
+      auto &task = tasks[slotRAII.fSlot];
+      if (!task) {
+         task = std::make_unique<RImportTask>();
+         task->fImporter = CloneForTask();
+         if (!task->fImporter)
+            throw RException(R__FAIL("cannot open the input tree " + fSourceTreeName + " again from " +
+                                     fSourceFileName));
+         task->fFillContext = ntplWriter->CreateFillContext(std::move(task->fImporter->fModel));
+      }
+      auto &importer = *task->fImporter;
+      // Prefetch the baskets of the range with vectored reads; the entries of a chain are global, not per tree
+      auto tree = importer.fSourceTree;
+      if (!importer.fSourceChain && tree->GetReadCache(tree->GetCurrentFile(), kTRUE))
+         tree->SetCacheEntryRange(range.first, range.second);
+      for (auto i = range.first; i < range.second; ++i) {
+         importer.ReadEntry(i);
+         task->fFillContext->Fill(*importer.fEntry);
+      }
+
+      std::lock_guard<std::mutex> lock(progressMutex);
+      nEntriesDone += range.second - range.first;
       if (fProgressCallback)
-         fProgressCallback->Call(ctrZippedBytes->GetValueAsInt(), i);
-   }
+         fProgressCallback->Call(ctrZippedBytes->GetValueAsInt(), nEntriesDone);
+   };
+   pool.Foreach(importRange, ranges);
+
+   // Commits the last clusters of the tasks
+   tasks.clear();
    if (fProgressCallback)
       fProgressCallback->Finish(ctrZippedBytes->GetValueAsInt(), nEntries);
+#else
+   ImportSequential(nEntries);
+#endif
 }
@@ -14,18 +14,132 @@
  *************************************************************************/
 
 #include <ROOT/RError.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleInspector.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorage.hxx>
 #include <ROOT/RError.hxx>
 
 #include <TFile.h>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstring>
 #include <deque>
 #include <exception>
 #include <iostream>
+#include <thread>
+
+namespace {
+
+using ROOT::Experimental::DescriptorId_t;
+using ROOT::Experimental::RClusterIndex;
+using ROOT::Experimental::RException;
+using ROOT::Experimental::RNTupleInspector;
+using ROOT::Experimental::RNTupleLocator;
+using ROOT::Experimental::Detail::RColumnElementBase;
+using ROOT::Experimental::Detail::RNTupleDecompressor;
+using ROOT::Experimental::Detail::RPageSource;
+
+std::string EscapeJSON(const std::string &str)
+{
+   std::string result;
+   for (auto c : str) {
+      if (c == '"' || c == '\\')
+         result.push_back('\\');
+      result.push_back(c);
+   }
+   return result;
+}
+
+std::size_t GetPageSizeBin(std::uint64_t nbytes)
+{
+   std::size_t bin = 0;
+   while (nbytes >>= 1)
+      bin++;
+   return bin;
+}
+
+/// Reads and decodes every page of every physical column of the given RNTuple and adds the results to the report
+void ScanNTuple(std::string_view ntupleName, const std::string &storage, RNTupleInspector::RScanReport &report)
+{
+   auto pageSource = RPageSource::Create(ntupleName, storage);
+   pageSource->Attach();
+   auto descriptor = pageSource->GetSharedDescriptorGuard()->Clone();
+
+   report.fNFiles++;
+   report.fNEntries += descriptor->GetNEntries();
+   report.fNClusters += descriptor->GetNClusters();
+
+   std::vector<unsigned char> sealedBuffer;
+   std::vector<unsigned char> packedBuffer;
+   std::vector<unsigned char> unpackedBuffer;
+   for (const auto &columnDesc : descriptor->GetColumnIterable()) {
+      if (columnDesc.IsAliasColumn())
+         continue;
+      const auto columnId = columnDesc.GetPhysicalId();
+      const auto columnName =
+         descriptor->GetQualifiedFieldName(columnDesc.GetFieldId()) + "#" + std::to_string(columnDesc.GetIndex());
+      auto element = RColumnElementBase::Generate(columnDesc.GetModel());
+
+      auto &columnInfo = report.fColumnScanInfo[columnName];
+      if (columnInfo.fNPages == 0) {
+         columnInfo.fType = columnDesc.GetModel().GetType();
+      } else if (columnInfo.fType != columnDesc.GetModel().GetType()) {
+         throw RException(R__FAIL("column type mismatch of " + columnName + " in " + storage));
+      }
+
+      for (const auto &clusterDesc : descriptor->GetClusterIterable()) {
+         if (!clusterDesc.ContainsColumn(columnId))
+            continue;
+
+         std::uint64_t firstInPage = 0;
+         for (const auto &pageInfo : clusterDesc.GetPageRange(columnId).fPageInfos) {
+            const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
+            const auto bytesPacked = element->GetPackedSize(pageInfo.fNElements);
+            const auto bytesUnpacked = element->GetSize() * pageInfo.fNElements;
+
+            columnInfo.fNPages++;
+            columnInfo.fNElements += pageInfo.fNElements;
+            columnInfo.fOnDiskSize += bytesOnStorage;
+            columnInfo.fInMemorySize += bytesUnpacked;
+            const auto bin = GetPageSizeBin(bytesOnStorage);
+            if (columnInfo.fPageSizeHistogram.size() <= bin)
+               columnInfo.fPageSizeHistogram.resize(bin + 1, 0);
+            columnInfo.fPageSizeHistogram[bin]++;
+
+            if (pageInfo.fLocator.fType == RNTupleLocator::kTypePageZero) {
+               firstInPage += pageInfo.fNElements;
+               continue;
+            }
+
+            sealedBuffer.resize(bytesOnStorage);
+            ROOT::Experimental::Detail::RPageStorage::RSealedPage sealedPage;
+            sealedPage.fBuffer = sealedBuffer.data();
+            pageSource->LoadSealedPage(columnId, RClusterIndex(clusterDesc.GetId(), firstInPage), sealedPage);
+            firstInPage += pageInfo.fNElements;
+
+            packedBuffer.resize(bytesPacked);
+            unpackedBuffer.resize(bytesUnpacked);
+            const auto start = std::chrono::steady_clock::now();
+            if (bytesOnStorage != bytesPacked) {
+               RNTupleDecompressor::Unzip(sealedBuffer.data(), bytesOnStorage, bytesPacked, packedBuffer.data());
+            } else {
+               memcpy(packedBuffer.data(), sealedBuffer.data(), bytesPacked);
+            }
+            if (!element->IsMappable())
+               element->Unpack(unpackedBuffer.data(), packedBuffer.data(), pageInfo.fNElements);
+            const auto stop = std::chrono::steady_clock::now();
+            columnInfo.fDecodeTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+         }
+      }
+   }
+}
+
+} // anonymous namespace
 
 ROOT::Experimental::RNTupleInspector::RNTupleInspector(
    std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource)
@@ -279,3 +393,111 @@ ROOT::Experimental::RNTupleInspector::GetFieldsByName(const std::regex &fieldNam
 
    return fieldIds;
 }
+
+//------------------------------------------------------------------------------
+
+void ROOT::Experimental::RNTupleInspector::RColumnScanInfo::Merge(const RColumnScanInfo &other)
+{
+   if (fNPages == 0) {
+      fType = other.fType;
+   } else if (other.fNPages > 0 && fType != other.fType) {
+      throw RException(R__FAIL("column type mismatch"));
+   }
+   fNPages += other.fNPages;
+   fNElements += other.fNElements;
+   fOnDiskSize += other.fOnDiskSize;
+   fInMemorySize += other.fInMemorySize;
+   fDecodeTimeNs += other.fDecodeTimeNs;
+   if (fPageSizeHistogram.size() < other.fPageSizeHistogram.size())
+      fPageSizeHistogram.resize(other.fPageSizeHistogram.size(), 0);
+   for (std::size_t i = 0; i < other.fPageSizeHistogram.size(); ++i)
+      fPageSizeHistogram[i] += other.fPageSizeHistogram[i];
+}
+
+void ROOT::Experimental::RNTupleInspector::RScanReport::Merge(const RScanReport &other)
+{
+   fNFiles += other.fNFiles;
+   fNEntries += other.fNEntries;
+   fNClusters += other.fNClusters;
+   for (const auto &[columnName, columnInfo] : other.fColumnScanInfo) {
+      try {
+         fColumnScanInfo[columnName].Merge(columnInfo);
+      } catch (const RException &) {
+         throw RException(R__FAIL("column type mismatch of " + columnName));
+      }
+   }
+}
+
+void ROOT::Experimental::RNTupleInspector::RScanReport::PrintJSON(std::ostream &output) const
+{
+   std::vector<const std::pair<const std::string, RColumnScanInfo> *> columns;
+   for (const auto &column : fColumnScanInfo)
+      columns.emplace_back(&column);
+   std::stable_sort(columns.begin(), columns.end(),
+                    [](const auto *a, const auto *b) { return a->second.fOnDiskSize > b->second.fOnDiskSize; });
+
+   output << "{\n";
+   output << "  \"ntuple\": \"" << EscapeJSON(fNTupleName) << "\",\n";
+   output << "  \"nFiles\": " << fNFiles << ",\n";
+   output << "  \"nEntries\": " << fNEntries << ",\n";
+   output << "  \"nClusters\": " << fNClusters << ",\n";
+   output << "  \"columns\": [";
+   for (std::size_t i = 0; i < columns.size(); ++i) {
+      const auto &[columnName, info] = *columns[i];
+      output << (i == 0 ? "\n" : ",\n");
+      output << "    {\"name\": \"" << EscapeJSON(columnName) << "\", ";
+      output << "\"type\": \"" << Detail::RColumnElementBase::GetTypeName(info.fType) << "\", ";
+      output << "\"nPages\": " << info.fNPages << ", ";
+      output << "\"nElements\": " << info.fNElements << ", ";
+      output << "\"onDiskSize\": " << info.fOnDiskSize << ", ";
+      output << "\"inMemorySize\": " << info.fInMemorySize << ", ";
+      output << "\"decodeTimeNs\": " << info.fDecodeTimeNs << ", ";
+      output << "\"pageSizeHistogram\": [";
+      for (std::size_t bin = 0; bin < info.fPageSizeHistogram.size(); ++bin)
+         output << (bin == 0 ? "" : ", ") << info.fPageSizeHistogram[bin];
+      output << "]}";
+   }
+   output << (columns.empty() ? "]\n" : "\n  ]\n");
+   output << "}" << std::endl;
+}
+
+ROOT::Experimental::RNTupleInspector::RScanReport
+ROOT::Experimental::RNTupleInspector::Scan(std::string_view ntupleName, const std::vector<std::string> &storages,
+                                           unsigned int nThreads)
+{
+   if (nThreads == 0)
+      nThreads = std::max(1U, std::thread::hardware_concurrency());
+   nThreads = std::min<std::size_t>(nThreads, storages.size());
+
+   RScanReport report;
+   report.fNTupleName = std::string(ntupleName);
+   if (nThreads <= 1) {
+      for (const auto &storage : storages)
+         ScanNTuple(ntupleName, storage, report);
+      return report;
+   }
+
+   // Threads pick the next storage location from the shared counter, so that large and small files balance out
+   std::atomic<std::size_t> nextStorage{0};
+   std::vector<RScanReport> threadReports(nThreads);
+   std::vector<std::exception_ptr> threadErrors(nThreads);
+   std::vector<std::thread> threads;
+   for (unsigned int t = 0; t < nThreads; ++t) {
+      threads.emplace_back([&, t]() {
+         try {
+            for (auto i = nextStorage++; i < storages.size(); i = nextStorage++)
+               ScanNTuple(ntupleName, storages[i], threadReports[t]);
+         } catch (...) {
+            threadErrors[t] = std::current_exception();
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+   for (unsigned int t = 0; t < nThreads; ++t) {
+      if (threadErrors[t])
+         std::rethrow_exception(threadErrors[t]);
+      report.Merge(threadReports[t]);
+   }
+   return report;
+}
@@ -3,7 +3,9 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TChain.h>
+#include <TROOT.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <string>
 #include <tuple>
@@ -656,3 +658,57 @@ TEST(RNTUpleImporter, MaxEntries)
    reader = RNTupleReader::Open("ntuple4", fileGuard.GetPath());
    EXPECT_EQ(5U, reader->GetNEntries());
 }
+
+#ifdef R__USE_IMT
+TEST(RNTupleImporter, ParallelImport)
+{
+   FileRaii fileGuard("test_ntuple_importer_parallel.root");
+   {
+      std::unique_ptr<TFile> file(TFile::Open(fileGuard.GetPath().c_str(), "RECREATE"));
+      auto tree = std::make_unique<TTree>("tree", "");
+      tree->SetAutoFlush(100);
+      Int_t id;
+      Int_t n;
+      float x[2];
+      tree->Branch("id", &id);
+      tree->Branch("n", &n);
+      tree->Branch("x", x, "x[n]");
+      for (id = 0; id < 1000; ++id) {
+         n = id % 3;
+         for (Int_t j = 0; j < n; ++j)
+            x[j] = id + j;
+         tree->Fill();
+      }
+      tree->Write();
+   }
+
+   ROOT::EnableImplicitMT(4);
+   auto importer = RNTupleImporter::Create(fileGuard.GetPath(), "tree", fileGuard.GetPath());
+   importer->SetIsQuiet(true);
+   importer->SetNTupleName("ntuple");
+   importer->SetParallelImport(true);
+   importer->SetMaxEntries(950);
+   importer->Import();
+   ROOT::DisableImplicitMT();
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   ASSERT_EQ(950U, reader->GetNEntries());
+   auto viewId = reader->GetView<std::int32_t>("id");
+   auto viewN = reader->GetView<ROOT::Experimental::RNTupleCardinality<std::uint32_t>>("n");
+   auto viewX = reader->GetView<ROOT::RVec<float>>("x");
+   // The order of the entries is not preserved, but the entries of an input cluster stay together
+   std::vector<int> ids;
+   for (auto i : reader->GetEntryRange()) {
+      const auto id = viewId(i);
+      ids.emplace_back(id);
+      ASSERT_EQ(static_cast<std::uint32_t>(id % 3), viewN(i));
+      const auto x = viewX(i);
+      ASSERT_EQ(static_cast<std::size_t>(id % 3), x.size());
+      for (std::size_t j = 0; j < x.size(); ++j)
+         EXPECT_FLOAT_EQ(id + j, x[j]);
+   }
+   std::sort(ids.begin(), ids.end());
+   for (int i = 0; i < 950; ++i)
+      EXPECT_EQ(i, ids[i]);
+}
+#endif
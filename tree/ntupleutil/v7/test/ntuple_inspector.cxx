@@ -7,6 +7,10 @@
 #include "CustomStructUtil.hxx"
 #include "ntupleutil_test.hxx"
 
+#include "gmock/gmock.h"
+
+#include <sstream>
+
 using ROOT::Experimental::RField;
 using ROOT::Experimental::RNTuple;
 using ROOT::Experimental::RNTupleInspector;
@@ -468,3 +472,88 @@ TEST(RNTupleInspector, FieldsByName)
       EXPECT_EQ("std::int32_t", inspector->GetFieldTreeInfo(fieldId).GetDescriptor().GetTypeName());
    }
 }
+
+TEST(RNTupleInspector, Scan)
+{
+   FileRaii fileGuard1("test_ntuple_inspector_scan1.root");
+   FileRaii fileGuard2("test_ntuple_inspector_scan2.root");
+   FileRaii fileGuard3("test_ntuple_inspector_scan3.root");
+   for (const auto &path : {fileGuard1.GetPath(), fileGuard2.GetPath(), fileGuard3.GetPath()}) {
+      auto model = RNTupleModel::Create();
+      auto nFldPt = model->MakeField<float>("pt");
+      auto nFldVec = model->MakeField<std::vector<std::int32_t>>("vec");
+
+      auto writeOptions = RNTupleWriteOptions();
+      writeOptions.SetCompression(505);
+      writeOptions.SetApproxUnzippedPageSize(1024);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", path, writeOptions);
+      for (int i = 0; i < 1000; ++i) {
+         *nFldPt = i;
+         nFldVec->assign(i % 3, i);
+         ntuple->Fill();
+      }
+   }
+   const std::vector<std::string> storages{fileGuard1.GetPath(), fileGuard2.GetPath(), fileGuard3.GetPath()};
+
+   auto report = RNTupleInspector::Scan("ntuple", storages, 2);
+   EXPECT_EQ("ntuple", report.fNTupleName);
+   EXPECT_EQ(3U, report.fNFiles);
+   EXPECT_EQ(3000U, report.fNEntries);
+   EXPECT_EQ(3U, report.fNClusters);
+   ASSERT_EQ(3U, report.fColumnScanInfo.size());
+
+   auto inspector = RNTupleInspector::Create("ntuple", fileGuard1.GetPath());
+   const auto ptColumnId = inspector->GetDescriptor()->FindPhysicalColumnId(
+      inspector->GetDescriptor()->FindFieldId("pt"), 0);
+   const auto &ptInfo = report.fColumnScanInfo.at("pt#0");
+   EXPECT_EQ(inspector->GetColumnInfo(ptColumnId).GetType(), ptInfo.fType);
+   EXPECT_EQ(3000U, ptInfo.fNElements);
+   EXPECT_EQ(3 * inspector->GetColumnInfo(ptColumnId).GetOnDiskSize(), ptInfo.fOnDiskSize);
+   EXPECT_EQ(3 * inspector->GetColumnInfo(ptColumnId).GetInMemorySize(), ptInfo.fInMemorySize);
+   EXPECT_LT(3U, ptInfo.fNPages);
+   std::uint64_t nPages = 0;
+   for (auto n : ptInfo.fPageSizeHistogram)
+      nPages += n;
+   EXPECT_EQ(ptInfo.fNPages, nPages);
+   EXPECT_GT(ptInfo.fDecodeTimeNs, 0U);
+   EXPECT_EQ(1U, report.fColumnScanInfo.count("vec#0"));
+   EXPECT_EQ(1U, report.fColumnScanInfo.count("vec._0#0"));
+
+   // The scan does not depend on the number of threads
+   auto serialReport = RNTupleInspector::Scan("ntuple", storages, 1);
+   EXPECT_EQ(ptInfo.fOnDiskSize, serialReport.fColumnScanInfo.at("pt#0").fOnDiskSize);
+   EXPECT_EQ(ptInfo.fPageSizeHistogram, serialReport.fColumnScanInfo.at("pt#0").fPageSizeHistogram);
+
+   std::ostringstream json;
+   report.PrintJSON(json);
+   EXPECT_NE(std::string::npos, json.str().find("\"nFiles\": 3,"));
+   EXPECT_NE(std::string::npos, json.str().find("{\"name\": \"pt#0\", \"type\": \"SplitReal32\""));
+
+   EXPECT_THROW(RNTupleInspector::Scan("ntuple", {fileGuard1.GetPath(), "nonexistent.root"}, 2),
+                ROOT::Experimental::RException);
+}
+
+TEST(RNTupleInspector, ScanTypeMismatch)
+{
+   FileRaii fileGuard1("test_ntuple_inspector_scan_mismatch1.root");
+   FileRaii fileGuard2("test_ntuple_inspector_scan_mismatch2.root");
+   {
+      auto model = RNTupleModel::Create();
+      *model->MakeField<float>("x") = 1.0;
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard1.GetPath());
+      ntuple->Fill();
+   }
+   {
+      auto model = RNTupleModel::Create();
+      *model->MakeField<std::int32_t>("x") = 1;
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard2.GetPath());
+      ntuple->Fill();
+   }
+
+   try {
+      RNTupleInspector::Scan("ntuple", {fileGuard1.GetPath(), fileGuard2.GetPath()});
+      FAIL() << "scanning RNTuples with incompatible schemas should throw";
+   } catch (const ROOT::Experimental::RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("column type mismatch of x#0"));
+   }
+}
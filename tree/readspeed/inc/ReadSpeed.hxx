@@ -19,6 +19,27 @@
 
 namespace ReadSpeed {
 
+/// The interface used to read the data.
+enum class EReadMode {
+   /// Call TBranch::GetEntry on each of the selected TTree branches.
+   kBranches,
+   /// Read the values of the selected TTree branches through TTreeReaderValues.
+   kTreeReader,
+   /// Read whole baskets of the selected TTree branches with the bulk I/O interface (TBranch::GetBulkRead()).
+   kBulk,
+   /// Only fetch the compressed baskets of the selected TTree branches from storage, without decompressing them.
+   kIOOnly,
+   /// Read the selected top-level fields of RNTuples with RNTupleReader::LoadEntry.
+   kRNTuple,
+   /// Run an RDataFrame event loop that reads the selected TTree branches.
+   kRDataFrame
+};
+
+/// Return the name of the read mode as used on the command line, e.g. "io-only".
+std::string ToString(EReadMode mode);
+/// Return the read mode with the given name, throw std::invalid_argument if there is none.
+EReadMode ParseReadMode(const std::string &name);
+
 struct Data {
    /// Either a single tree name common for all files, or one tree name per file.
    std::vector<std::string> fTreeNames;
@@ -28,6 +49,13 @@ struct Data {
    std::vector<std::string> fBranchNames;
    /// If the branch names should use regex matching.
    bool fUseRegex = false;
+   /// How to read the data. For EReadMode::kRNTuple, fTreeNames are the names of the RNTuples and fBranchNames are
+   /// the names of their top-level fields.
+   EReadMode fReadMode = EReadMode::kBranches;
+   /// If the RNTuple cluster cache (asynchronous prefetching of clusters) should be used.
+   bool fUseClusterCache = true;
+   /// Number of RNTuple clusters to read together, 0 keeps the RNTupleReadOptions default.
+   unsigned int fClusterBunchSize = 0;
 };
 
 struct Result {
@@ -45,6 +73,14 @@ struct Result {
    ULong64_t fCompressedBytesRead;
    /// Size of ROOT's thread pool for the run (0 indicates a single-thread run with no thread pool present).
    unsigned int fThreadPoolSize;
+   /// Number of entries read in total.
+   ULong64_t fEntriesRead = 0;
+   /// Real time spent fetching data from storage, in seconds (negative if not measured separately).
+   double fIORealTime = -1.;
+   /// Real time spent decompressing data, in seconds (negative if not measured separately).
+   double fDecompressionRealTime = -1.;
+   /// The read mode of the run.
+   EReadMode fReadMode = EReadMode::kBranches;
 };
 
 struct EntryRange {
@@ -55,6 +91,7 @@ struct EntryRange {
 struct ByteData {
    ULong64_t fUncompressedBytesRead;
    ULong64_t fCompressedBytesRead;
+   ULong64_t fEntriesRead = 0;
 };
 
 struct ReadSpeedRegex {
@@ -67,10 +104,27 @@ struct ReadSpeedRegex {
 std::vector<std::string> GetMatchingBranchNames(const std::string &fileName, const std::string &treeName,
                                                 const std::vector<ReadSpeedRegex> &regexes);
 
+std::vector<std::string> GetMatchingFieldNames(const std::string &fileName, const std::string &ntupleName,
+                                               const std::vector<ReadSpeedRegex> &regexes);
+
 // Read branches listed in branchNames in tree treeName in file fileName, return number of uncompressed bytes read.
 ByteData ReadTree(TFile *file, const std::string &treeName, const std::vector<std::string> &branchNames,
                   EntryRange range = {-1, -1});
 
+// Same as ReadTree, but read the branch values through TTreeReaderValues.
+ByteData ReadTreeWithReader(TFile *file, const std::string &treeName, const std::vector<std::string> &branchNames,
+                            EntryRange range = {-1, -1});
+
+// Same as ReadTree, but read the branches basket by basket with the bulk I/O interface. The range must start at a
+// basket boundary, as cluster boundaries do, and the branches must support bulk reading.
+ByteData ReadTreeBulk(TFile *file, const std::string &treeName, const std::vector<std::string> &branchNames,
+                      EntryRange range = {-1, -1});
+
+// Only read from storage the compressed baskets of the branches that start within the range, without decompressing
+// them. The number of uncompressed bytes returned is always zero.
+ByteData ReadTreeIOOnly(TFile *file, const std::string &treeName, const std::vector<std::string> &branchNames,
+                        EntryRange range = {-1, -1});
+
 Result EvalThroughputST(const Data &d);
 
 // Return a vector of EntryRanges per file, i.e. a vector of vectors of EntryRanges with outer size equal to
@@ -85,6 +139,14 @@ MergeClusters(std::vector<std::vector<EntryRange>> &&clusters, unsigned int maxT
 
 Result EvalThroughputMT(const Data &d, unsigned nThreads);
 
+// Read the RNTuples with one RNTupleReader per file. With nThreads > 0, implicit multi-threading is enabled for the
+// run so that the pages are decompressed in parallel.
+Result EvalThroughputRNTuple(const Data &d, unsigned nThreads);
+
+// Read the trees with one RDataFrame event loop per file. With nThreads > 0, implicit multi-threading is enabled for
+// the run.
+Result EvalThroughputRDF(const Data &d, unsigned nThreads);
+
 Result EvalThroughput(const Data &d, unsigned nThreads);
 
 } // namespace ReadSpeed
@@ -16,19 +16,32 @@
 
 #include "ReadSpeed.hxx"
 
+#include <ostream>
+#include <string>
 #include <vector>
 
 namespace ReadSpeed {
 
 void PrintThroughput(const Result &r);
 
+// If the results contain both a decompressing TTree run and an I/O-only run, print how the time splits between
+// fetching the data and decompressing/deserializing it.
+void PrintTimeSplit(const std::vector<Result> &results);
+
 struct Args {
    Data fData;
    unsigned int fNThreads = 0;
    bool fAllBranches = false;
    bool fShouldRun = false;
+   /// The read modes to benchmark, one after the other.
+   std::vector<EReadMode> fReadModes{EReadMode::kBranches};
+   /// If not empty, the file to which the results are written in JSON format.
+   std::string fJSONFileName;
 };
 
+// Write the configuration of the benchmark, the ROOT version and the results as a JSON object.
+void WriteJSON(std::ostream &os, const Args &args, const std::vector<Result> &results);
+
 Args ParseArgs(const std::vector<std::string> &args);
 Args ParseArgs(int argc, char **argv);
 
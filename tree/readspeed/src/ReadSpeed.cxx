@@ -19,9 +19,18 @@
 #endif
 
 #include <ROOT/InternalTreeUtils.hxx> // for ROOT::Internal::TreeUtils::GetTopLevelBranchNames
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <TBranch.h>
+#include <TBufferFile.h>
+#include <TLeaf.h>
+#include <TROOT.h> // ROOT::EnableImplicitMT, ROOT::GetThreadPoolSize
 #include <TStopwatch.h>
 #include <TTree.h>
+#include <TTreeReader.h>
+#include <TTreeReaderValue.h>
 
 #include <algorithm>
 #include <cassert>
@@ -33,29 +42,51 @@
 #include <iostream>
 
 using namespace ReadSpeed;
+using ROOT::Experimental::RNTupleModel;
+using ROOT::Experimental::RNTupleReader;
+using ROOT::Experimental::RNTupleReadOptions;
+using ROOT::Experimental::Detail::RFieldBase;
 
-std::vector<std::string> ReadSpeed::GetMatchingBranchNames(const std::string &fileName, const std::string &treeName,
-                                                           const std::vector<ReadSpeedRegex> &regexes)
+std::string ReadSpeed::ToString(EReadMode mode)
 {
-   const auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
-   if (f == nullptr || f->IsZombie())
-      throw std::runtime_error("Could not open file '" + fileName + '\'');
-   std::unique_ptr<TTree> t(f->Get<TTree>(treeName.c_str()));
-   if (t == nullptr)
-      throw std::runtime_error("Could not retrieve tree '" + treeName + "' from file '" + fileName + '\'');
+   switch (mode) {
+   case EReadMode::kBranches: return "branches";
+   case EReadMode::kTreeReader: return "treereader";
+   case EReadMode::kBulk: return "bulk";
+   case EReadMode::kIOOnly: return "io-only";
+   case EReadMode::kRNTuple: return "rntuple";
+   case EReadMode::kRDataFrame: return "rdataframe";
+   }
+   return "";
+}
 
-   const auto unfilteredBranchNames = ROOT::Internal::TreeUtils::GetTopLevelBranchNames(*t);
+EReadMode ReadSpeed::ParseReadMode(const std::string &name)
+{
+   for (auto mode : {EReadMode::kBranches, EReadMode::kTreeReader, EReadMode::kBulk, EReadMode::kIOOnly,
+                     EReadMode::kRNTuple, EReadMode::kRDataFrame}) {
+      if (ToString(mode) == name)
+         return mode;
+   }
+   throw std::invalid_argument("Unknown read mode '" + name + '\'');
+}
+
+// Select the names matching the regexes. `kind` is "branch" or "field" and `where` describes the dataset, for
+// example "branches in tree 't' from file 'f.root'".
+static std::vector<std::string> FilterNames(const std::vector<std::string> &unfilteredNames,
+                                            const std::vector<ReadSpeedRegex> &regexes, const std::string &kind,
+                                            const std::string &where)
+{
    std::set<ReadSpeedRegex> usedRegexes;
-   std::vector<std::string> branchNames;
+   std::vector<std::string> names;
 
-   auto filterBranchName = [regexes, &usedRegexes](const std::string &bName) {
+   auto filterName = [regexes, &usedRegexes](const std::string &name) {
       if (regexes.size() == 1 && regexes[0].text == ".*") {
          usedRegexes.insert(regexes[0]);
          return true;
       }
 
-      const auto matchBranch = [&usedRegexes, bName](const ReadSpeedRegex &regex) {
-         bool match = std::regex_match(bName, regex.regex);
+      const auto matchName = [&usedRegexes, name](const ReadSpeedRegex &regex) {
+         bool match = std::regex_match(name, regex.regex);
 
          if (match)
             usedRegexes.insert(regex);
@@ -63,20 +94,17 @@ std::vector<std::string> ReadSpeed::GetMatchingBranchNames(const std::string &fi
          return match;
       };
 
-      const auto iterator = std::find_if(regexes.begin(), regexes.end(), matchBranch);
+      const auto iterator = std::find_if(regexes.begin(), regexes.end(), matchName);
       return iterator != regexes.end();
    };
-   std::copy_if(unfilteredBranchNames.begin(), unfilteredBranchNames.end(), std::back_inserter(branchNames),
-                filterBranchName);
+   std::copy_if(unfilteredNames.begin(), unfilteredNames.end(), std::back_inserter(names), filterName);
 
-   if (branchNames.empty()) {
-      std::cerr << "Provided branch regexes didn't match any branches in tree '" + treeName + "' from file '" +
-                      fileName + ".\n";
+   if (names.empty()) {
+      std::cerr << "Provided " + kind + " regexes didn't match any " + where + ".\n";
       std::terminate();
    }
    if (usedRegexes.size() != regexes.size()) {
-      std::string errString = "The following regexes didn't match any branches in tree '" + treeName + "' from file '" +
-                              fileName + "', this is probably unintended:\n";
+      std::string errString = "The following regexes didn't match any " + where + ", this is probably unintended:\n";
       for (const auto &regex : regexes) {
          if (usedRegexes.find(regex) == usedRegexes.end())
             errString += '\t' + regex.text + '\n';
@@ -85,7 +113,35 @@ std::vector<std::string> ReadSpeed::GetMatchingBranchNames(const std::string &fi
       std::terminate();
    }
 
-   return branchNames;
+   return names;
+}
+
+std::vector<std::string> ReadSpeed::GetMatchingBranchNames(const std::string &fileName, const std::string &treeName,
+                                                           const std::vector<ReadSpeedRegex> &regexes)
+{
+   const auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+   if (f == nullptr || f->IsZombie())
+      throw std::runtime_error("Could not open file '" + fileName + '\'');
+   std::unique_ptr<TTree> t(f->Get<TTree>(treeName.c_str()));
+   if (t == nullptr)
+      throw std::runtime_error("Could not retrieve tree '" + treeName + "' from file '" + fileName + '\'');
+
+   const auto unfilteredBranchNames = ROOT::Internal::TreeUtils::GetTopLevelBranchNames(*t);
+   return FilterNames(unfilteredBranchNames, regexes, "branch",
+                      "branches in tree '" + treeName + "' from file '" + fileName + '\'');
+}
+
+std::vector<std::string> ReadSpeed::GetMatchingFieldNames(const std::string &fileName, const std::string &ntupleName,
+                                                          const std::vector<ReadSpeedRegex> &regexes)
+{
+   auto reader = RNTupleReader::Open(ntupleName, fileName);
+   const auto &desc = *reader->GetDescriptor();
+
+   std::vector<std::string> unfilteredFieldNames;
+   for (const auto &f : desc.GetTopLevelFields())
+      unfilteredFieldNames.emplace_back(f.GetFieldName());
+   return FilterNames(unfilteredFieldNames, regexes, "field",
+                      "fields in RNTuple '" + ntupleName + "' from file '" + fileName + '\'');
 }
 
 std::vector<std::vector<std::string>> GetPerFileBranchNames(const Data &d)
@@ -102,7 +158,8 @@ std::vector<std::vector<std::string>> GetPerFileBranchNames(const Data &d)
    for (const auto &fName : d.fFileNames) {
       std::vector<std::string> branchNames;
       if (d.fUseRegex)
-         branchNames = GetMatchingBranchNames(fName, d.fTreeNames[treeIdx], regexes);
+         branchNames = d.fReadMode == EReadMode::kRNTuple ? GetMatchingFieldNames(fName, d.fTreeNames[treeIdx], regexes)
+                                                          : GetMatchingBranchNames(fName, d.fTreeNames[treeIdx], regexes);
       else
          branchNames = d.fBranchNames;
 
@@ -122,38 +179,58 @@ ByteData SumBytes(const std::vector<ByteData> &bytesData) {
    const auto compressedBytes =
       std::accumulate(bytesData.begin(), bytesData.end(), 0ull,
                         [](ULong64_t sum, const ByteData &o) { return sum + o.fCompressedBytesRead; });
+   const auto entries = std::accumulate(bytesData.begin(), bytesData.end(), 0ull,
+                                        [](ULong64_t sum, const ByteData &o) { return sum + o.fEntriesRead; });
 
-   return {uncompressedBytes, compressedBytes};
+   return {uncompressedBytes, compressedBytes, entries};
 };
 
-// Read branches listed in branchNames in tree treeName in file fileName, return number of uncompressed bytes read.
-ByteData ReadSpeed::ReadTree(TFile *f, const std::string &treeName, const std::vector<std::string> &branchNames,
-                             EntryRange range)
+static std::unique_ptr<TTree> GetTree(TFile *f, const std::string &treeName)
 {
    std::unique_ptr<TTree> t(f->Get<TTree>(treeName.c_str()));
    if (t == nullptr)
       throw std::runtime_error("Could not retrieve tree '" + treeName + "' from file '" + f->GetName() + '\'');
+   return t;
+}
 
-   t->SetBranchStatus("*", 0);
+// Enable only the branches listed in branchNames and return them.
+static std::vector<TBranch *> GetBranches(TTree &t, const std::vector<std::string> &branchNames)
+{
+   t.SetBranchStatus("*", 0);
 
    std::vector<TBranch *> branches;
    for (const auto &bName : branchNames) {
-      auto *b = t->GetBranch(bName.c_str());
+      auto *b = t.GetBranch(bName.c_str());
       if (b == nullptr)
-         throw std::runtime_error("Could not retrieve branch '" + bName + "' from tree '" + t->GetName() +
-                                  "' in file '" + t->GetCurrentFile()->GetName() + '\'');
+         throw std::runtime_error("Could not retrieve branch '" + bName + "' from tree '" + t.GetName() +
+                                  "' in file '" + t.GetCurrentFile()->GetName() + '\'');
 
       b->SetStatus(1);
       branches.push_back(b);
    }
+   return branches;
+}
 
-   const auto nEntries = t->GetEntries();
+// Return the range to read: the whole tree for the default range.
+static EntryRange GetRange(TTree &t, EntryRange range)
+{
+   const auto nEntries = t.GetEntries();
    if (range.fStart == -1ll)
-      range = EntryRange{0ll, nEntries};
-   else if (range.fEnd > nEntries)
+      return EntryRange{0ll, nEntries};
+   if (range.fEnd > nEntries)
       throw std::runtime_error("Range end (" + std::to_string(range.fEnd) + ") is beyond the end of tree '" +
-                               t->GetName() + "' in file '" + t->GetCurrentFile()->GetName() + "' with " +
+                               t.GetName() + "' in file '" + t.GetCurrentFile()->GetName() + "' with " +
                                std::to_string(nEntries) + " entries.");
+   return range;
+}
+
+// Read branches listed in branchNames in tree treeName in file fileName, return number of uncompressed bytes read.
+ByteData ReadSpeed::ReadTree(TFile *f, const std::string &treeName, const std::vector<std::string> &branchNames,
+                             EntryRange range)
+{
+   auto t = GetTree(f, treeName);
+   const auto branches = GetBranches(*t, branchNames);
+   range = GetRange(*t, range);
 
    ULong64_t bytesRead = 0;
    const ULong64_t fileStartBytes = f->GetBytesRead();
@@ -162,7 +239,147 @@ ByteData ReadSpeed::ReadTree(TFile *f, const std::string &treeName, const std::v
          bytesRead += b->GetEntry(e);
 
    const ULong64_t fileBytesRead = f->GetBytesRead() - fileStartBytes;
-   return {bytesRead, fileBytesRead};
+   return {bytesRead, fileBytesRead, ULong64_t(range.fEnd - range.fStart)};
+}
+
+namespace {
+/// A TTreeReaderValue for a branch whose type is only known at runtime.
+class RUntypedReaderValue final : public ROOT::Internal::TTreeReaderValueBase {
+   std::string fTypeName;
+
+public:
+   RUntypedReaderValue(TTreeReader &reader, const std::string &branchName, TDictionary *dict,
+                       const std::string &typeName)
+      : TTreeReaderValueBase(&reader, branchName.c_str(), dict), fTypeName(typeName)
+   {
+   }
+
+   /// Return the dictionary of the type of the branch and set its name, or return nullptr if
+   /// TTreeReaderValue does not support the branch (e.g. for arrays of variable size).
+   static TDictionary *GetBranchDictionary(TBranch *branch, std::string &typeName)
+   {
+      TDictionary *dict = nullptr;
+      const char *name = GetBranchDataType(branch, dict, nullptr);
+      typeName = name ? name : "";
+      return name ? dict : nullptr;
+   }
+
+   const char *GetDerivedTypeName() const final { return fTypeName.c_str(); }
+};
+} // namespace
+
+ByteData ReadSpeed::ReadTreeWithReader(TFile *f, const std::string &treeName,
+                                       const std::vector<std::string> &branchNames, EntryRange range)
+{
+   auto t = GetTree(f, treeName);
+   const auto branches = GetBranches(*t, branchNames);
+   range = GetRange(*t, range);
+
+   TTreeReader reader(t.get());
+   std::vector<std::unique_ptr<RUntypedReaderValue>> values;
+   for (auto *b : branches) {
+      std::string typeName;
+      auto *dict = RUntypedReaderValue::GetBranchDictionary(b, typeName);
+      if (dict == nullptr)
+         throw std::runtime_error("Branch '" + std::string(b->GetName()) + "' from tree '" + treeName +
+                                  "' cannot be read with a TTreeReaderValue");
+      values.emplace_back(std::make_unique<RUntypedReaderValue>(reader, b->GetName(), dict, typeName));
+   }
+
+   ULong64_t entries = 0;
+   const ULong64_t fileStartBytes = f->GetBytesRead();
+   if (range.fEnd > range.fStart) {
+      reader.SetEntriesRange(range.fStart, range.fEnd);
+      while (reader.Next()) {
+         for (auto &v : values) {
+            if (v->GetAddress() == nullptr)
+               throw std::runtime_error("Could not read branch '" + std::string(v->GetBranchName()) +
+                                        "' from tree '" + treeName + "' at entry " +
+                                        std::to_string(reader.GetCurrentEntry()));
+         }
+         ++entries;
+      }
+   }
+
+   // TTreeReader does not report the size of the values it reads: the uncompressed bytes are not measured.
+   const ULong64_t fileBytesRead = f->GetBytesRead() - fileStartBytes;
+   return {0ull, fileBytesRead, entries};
+}
+
+ByteData ReadSpeed::ReadTreeBulk(TFile *f, const std::string &treeName, const std::vector<std::string> &branchNames,
+                                 EntryRange range)
+{
+   auto t = GetTree(f, treeName);
+   const auto branches = GetBranches(*t, branchNames);
+   range = GetRange(*t, range);
+
+   std::vector<ULong64_t> entrySizes;
+   for (auto *b : branches) {
+      auto *leaf = b->GetNleaves() == 1 ? static_cast<TLeaf *>(b->GetListOfLeaves()->UncheckedAt(0)) : nullptr;
+      if (!b->SupportsBulkRead() || leaf == nullptr || leaf->GetLeafCount() != nullptr)
+         throw std::runtime_error("Branch '" + std::string(b->GetName()) + "' from tree '" + treeName +
+                                  "' does not support bulk reading");
+      entrySizes.push_back(leaf->GetLenType() * leaf->GetLenStatic());
+   }
+
+   ULong64_t bytesRead = 0;
+   const ULong64_t fileStartBytes = f->GetBytesRead();
+   TBufferFile buf(TBuffer::kWrite, 32 * 1024);
+   for (auto i = 0u; i < branches.size(); ++i) {
+      for (auto e = range.fStart; e < range.fEnd;) {
+         const auto n = branches[i]->GetBulkRead().GetEntriesSerialized(e, buf);
+         if (n <= 0)
+            throw std::runtime_error("Could not bulk-read branch '" + std::string(branches[i]->GetName()) +
+                                     "' from tree '" + treeName + "' at entry " + std::to_string(e));
+         const auto nInRange = std::min<Long64_t>(n, range.fEnd - e);
+         bytesRead += nInRange * entrySizes[i];
+         e += nInRange;
+      }
+   }
+
+   const ULong64_t fileBytesRead = f->GetBytesRead() - fileStartBytes;
+   return {bytesRead, fileBytesRead, ULong64_t(range.fEnd - range.fStart)};
+}
+
+ByteData ReadSpeed::ReadTreeIOOnly(TFile *f, const std::string &treeName, const std::vector<std::string> &branchNames,
+                                   EntryRange range)
+{
+   auto t = GetTree(f, treeName);
+   const auto branches = GetBranches(*t, branchNames);
+   range = GetRange(*t, range);
+
+   const ULong64_t fileStartBytes = f->GetBytesRead();
+   std::vector<char> buf;
+   for (auto *b : branches) {
+      const auto *basketEntry = b->GetBasketEntry();
+      const auto *basketBytes = b->GetBasketBytes();
+      for (Int_t i = 0; i < b->GetWriteBasket(); ++i) {
+         if (basketEntry[i] < range.fStart || basketEntry[i] >= range.fEnd)
+            continue;
+         const auto seek = b->GetBasketSeek(i);
+         if (seek == 0) // the basket is not on storage
+            continue;
+         buf.resize(basketBytes[i]);
+         if (f->ReadBuffer(buf.data(), seek, basketBytes[i]))
+            throw std::runtime_error("Could not read basket " + std::to_string(i) + " of branch '" + b->GetName() +
+                                     "' from file '" + f->GetName() + '\'');
+      }
+   }
+
+   const ULong64_t fileBytesRead = f->GetBytesRead() - fileStartBytes;
+   return {0ull, fileBytesRead, ULong64_t(range.fEnd - range.fStart)};
+}
+
+using TreeReadFunc_t = ByteData (*)(TFile *, const std::string &, const std::vector<std::string> &, EntryRange);
+
+static TreeReadFunc_t GetTreeReadFunc(EReadMode mode)
+{
+   switch (mode) {
+   case EReadMode::kTreeReader: return &ReadTreeWithReader;
+   case EReadMode::kBulk: return &ReadTreeBulk;
+   case EReadMode::kIOOnly: return &ReadTreeIOOnly;
+   default: return &ReadTree;
+   }
 }
 
 Result ReadSpeed::EvalThroughputST(const Data &d)
@@ -171,9 +388,11 @@ Result ReadSpeed::EvalThroughputST(const Data &d)
    auto fileIdx = 0;
    ULong64_t uncompressedBytesRead = 0;
    ULong64_t compressedBytesRead = 0;
+   ULong64_t entriesRead = 0;
 
    TStopwatch sw;
    const auto fileBranchNames = GetPerFileBranchNames(d);
+   const auto readTree = GetTreeReadFunc(d.fReadMode);
 
    for (const auto &fileName : d.fFileNames) {
       auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
@@ -182,9 +401,10 @@ Result ReadSpeed::EvalThroughputST(const Data &d)
 
       sw.Start(kFALSE);
 
-      const auto byteData = ReadTree(f.get(), d.fTreeNames[treeIdx], fileBranchNames[fileIdx]);
+      const auto byteData = readTree(f.get(), d.fTreeNames[treeIdx], fileBranchNames[fileIdx], {-1, -1});
       uncompressedBytesRead += byteData.fUncompressedBytesRead;
       compressedBytesRead += byteData.fCompressedBytesRead;
+      entriesRead += byteData.fEntriesRead;
 
       if (d.fTreeNames.size() > 1)
          ++treeIdx;
@@ -193,7 +413,7 @@ Result ReadSpeed::EvalThroughputST(const Data &d)
       sw.Stop();
    }
 
-   return {sw.RealTime(), sw.CpuTime(), 0., 0., uncompressedBytesRead, compressedBytesRead, 0};
+   return {sw.RealTime(), sw.CpuTime(), 0., 0., uncompressedBytesRead, compressedBytesRead, 0, entriesRead};
 }
 
 // Return a vector of EntryRanges per file, i.e. a vector of vectors of EntryRanges with outer size equal to
@@ -287,6 +507,7 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
    std::cout << "Total number of tasks: " << nranges << '\n';
 
    const auto fileBranchNames = GetPerFileBranchNames(d);
+   const auto readTree = GetTreeReadFunc(d.fReadMode);
 
    ROOT::Internal::RSlotStack slotStack(actualThreads);
    std::vector<int> lastFileIdxs(actualThreads, -1);
@@ -311,7 +532,7 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
          if (file == nullptr || file->IsZombie())
             throw std::runtime_error("Could not open file '" + fileName + '\'');
 
-         auto result = ReadTree(file.get(), treeName, branchNames, range);
+         auto result = readTree(file.get(), treeName, branchNames, range);
 
          return result;
       };
@@ -332,7 +553,8 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
            clsw.CpuTime(),
            totalByteData.fUncompressedBytesRead,
            totalByteData.fCompressedBytesRead,
-           actualThreads};
+           actualThreads,
+           totalByteData.fEntriesRead};
 #else
    (void)d;
    (void)nThreads;
@@ -340,6 +562,134 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
 #endif // R__USE_IMT
 }
 
+namespace {
+/// Enable implicit multi-threading for the duration of a run, if requested.
+class RImplicitMTRAII {
+   bool fEnabled = false;
+
+public:
+   explicit RImplicitMTRAII(unsigned nThreads)
+   {
+#ifdef R__USE_IMT
+      if (nThreads > 0 && !ROOT::IsImplicitMTEnabled()) {
+         ROOT::EnableImplicitMT(nThreads);
+         fEnabled = true;
+      }
+#else
+      (void)nThreads;
+#endif
+   }
+   ~RImplicitMTRAII()
+   {
+#ifdef R__USE_IMT
+      if (fEnabled)
+         ROOT::DisableImplicitMT();
+#endif
+   }
+   RImplicitMTRAII(const RImplicitMTRAII &) = delete;
+   RImplicitMTRAII &operator=(const RImplicitMTRAII &) = delete;
+};
+
+std::int64_t GetCounterValue(const RNTupleReader &reader, const std::string &name)
+{
+   const auto *counter = reader.GetMetrics().GetCounter("RNTupleReader.RPageSourceFile." + name);
+   return counter ? counter->GetValueAsInt() : 0;
+}
+} // namespace
+
+Result ReadSpeed::EvalThroughputRNTuple(const Data &d, unsigned nThreads)
+{
+   RImplicitMTRAII imt(nThreads);
+   const unsigned int actualThreads = nThreads > 0 ? ROOT::GetThreadPoolSize() : 0u;
+
+   RNTupleReadOptions options;
+   options.SetClusterCache(d.fUseClusterCache ? RNTupleReadOptions::kOn : RNTupleReadOptions::kOff);
+   if (d.fClusterBunchSize > 0)
+      options.SetClusterBunchSize(d.fClusterBunchSize);
+   options.SetUseImplicitMT(nThreads > 0 ? RNTupleReadOptions::EImplicitMT::kDefault
+                                         : RNTupleReadOptions::EImplicitMT::kOff);
+
+   const auto fileFieldNames = GetPerFileBranchNames(d);
+
+   ULong64_t uncompressedBytesRead = 0;
+   ULong64_t compressedBytesRead = 0;
+   ULong64_t entriesRead = 0;
+   std::int64_t ioTime = 0;
+   std::int64_t unzipTime = 0;
+
+   TStopwatch sw;
+   for (auto fileIdx = 0u; fileIdx < d.fFileNames.size(); ++fileIdx) {
+      const auto &fileName = d.fFileNames[fileIdx];
+      const auto &ntupleName = d.fTreeNames.size() > 1 ? d.fTreeNames[fileIdx] : d.fTreeNames[0];
+
+      // Build a model with only the requested fields, with the types they have on storage
+      auto model = RNTupleModel::Create();
+      {
+         auto fullReader = RNTupleReader::Open(ntupleName, fileName);
+         const auto &desc = *fullReader->GetDescriptor();
+         for (const auto &fieldName : fileFieldNames[fileIdx]) {
+            const auto fieldId = desc.FindFieldId(fieldName);
+            if (fieldId == ROOT::Experimental::kInvalidDescriptorId)
+               throw std::runtime_error("Could not retrieve field '" + fieldName + "' from RNTuple '" + ntupleName +
+                                        "' in file '" + fileName + '\'');
+            const auto &fieldDesc = desc.GetFieldDescriptor(fieldId);
+            model->AddField(RFieldBase::Create(fieldName, fieldDesc.GetTypeName()).Unwrap());
+         }
+      }
+
+      sw.Start(kFALSE);
+      auto reader = RNTupleReader::Open(std::move(model), ntupleName, fileName, options);
+      reader->EnableMetrics();
+      for (auto i : reader->GetEntryRange())
+         reader->LoadEntry(i);
+      sw.Stop();
+
+      entriesRead += reader->GetNEntries();
+      uncompressedBytesRead += GetCounterValue(*reader, "szUnzip");
+      compressedBytesRead += GetCounterValue(*reader, "szReadPayload") + GetCounterValue(*reader, "szReadOverhead");
+      ioTime += GetCounterValue(*reader, "timeWallRead");
+      unzipTime += GetCounterValue(*reader, "timeWallUnzip");
+   }
+
+   Result r{sw.RealTime(), sw.CpuTime(), 0., 0., uncompressedBytesRead, compressedBytesRead, actualThreads,
+            entriesRead};
+   r.fIORealTime = ioTime * 1e-9;
+   r.fDecompressionRealTime = unzipTime * 1e-9;
+   return r;
+}
+
+Result ReadSpeed::EvalThroughputRDF(const Data &d, unsigned nThreads)
+{
+   RImplicitMTRAII imt(nThreads);
+   const unsigned int actualThreads = nThreads > 0 ? ROOT::GetThreadPoolSize() : 0u;
+
+   const auto fileBranchNames = GetPerFileBranchNames(d);
+
+   ULong64_t entriesRead = 0;
+   const ULong64_t startBytes = TFile::GetFileBytesRead();
+
+   TStopwatch sw;
+   for (auto fileIdx = 0u; fileIdx < d.fFileNames.size(); ++fileIdx) {
+      const auto &fileName = d.fFileNames[fileIdx];
+      const auto &treeName = d.fTreeNames.size() > 1 ? d.fTreeNames[fileIdx] : d.fTreeNames[0];
+
+      // A filter that uses all the columns makes the event loop read every one of them for every entry
+      std::string expression = "(";
+      for (const auto &bName : fileBranchNames[fileIdx])
+         expression += "(void)" + bName + ", ";
+      expression += "true)";
+
+      sw.Start(kFALSE);
+      ROOT::RDataFrame df(treeName, fileName);
+      entriesRead += *df.Filter(expression).Count();
+      sw.Stop();
+   }
+
+   // RDataFrame does not report the size of the values it reads: the uncompressed bytes are not measured.
+   const ULong64_t compressedBytesRead = TFile::GetFileBytesRead() - startBytes;
+   return {sw.RealTime(), sw.CpuTime(), 0., 0., 0ull, compressedBytesRead, actualThreads, entriesRead};
+}
+
 Result ReadSpeed::EvalThroughput(const Data &d, unsigned nThreads)
 {
    if (d.fTreeNames.empty()) {
@@ -359,14 +709,22 @@ Result ReadSpeed::EvalThroughput(const Data &d, unsigned nThreads)
       std::terminate();
    }
 
-#ifdef R__USE_IMT
-   return nThreads > 0 ? EvalThroughputMT(d, nThreads) : EvalThroughputST(d);
-#else
+#ifndef R__USE_IMT
    if (nThreads > 0) {
       std::cerr << nThreads
                 << " threads were requested, but ROOT was built without implicit multi-threading (IMT) support.\n";
       std::terminate();
    }
-   return EvalThroughputST(d);
 #endif
+
+   Result r;
+   switch (d.fReadMode) {
+   case EReadMode::kRNTuple: r = EvalThroughputRNTuple(d, nThreads); break;
+   case EReadMode::kRDataFrame: r = EvalThroughputRDF(d, nThreads); break;
+   default: r = nThreads > 0 ? EvalThroughputMT(d, nThreads) : EvalThroughputST(d);
+   }
+   r.fReadMode = d.fReadMode;
+   if (d.fReadMode == EReadMode::kIOOnly)
+      r.fIORealTime = r.fRealTime;
+   return r;
 }
@@ -14,8 +14,13 @@
 #include <ROOT/TTreeProcessorMT.hxx> // for TTreeProcessorMT::SetTasksPerWorkerHint
 #endif
 
+#include <RVersion.h>
+
+#include <algorithm>
+#include <iomanip>
 #include <iostream>
 #include <cstring>
+#include <sstream>
 
 using namespace ReadSpeed;
 
@@ -26,6 +31,9 @@ const auto usageText = "Usage:\n"
                        "[bregex2 ...])\n"
                        "               [--threads nthreads]\n"
                        "               [--tasks-per-worker ntasks]\n"
+                       "               [--modes mode1 [mode2 ...]]\n"
+                       "               [--no-cluster-cache] [--cluster-bunch-size nclusters]\n"
+                       "               [--json fname]\n"
                        " rootreadspeed (--help|-h)\n"
                        " \n"
                        " Use -h for usage help, --help for detailed information.\n";
@@ -34,12 +42,13 @@ const auto argUsageText =
    "Arguments:\n"
    " Specifying files and trees:\n"
    "   --files fname1 [fname2...]\n"
-   "    The list of root files to read from.\n"
+   "    The list of root files to read from. Remote files can be given as URLs, e.g. root://, http:// or"
+   "    https://, as supported by TFile::Open.\n"
    "\n"
    "   --trees tname1 [tname2...]\n"
    "    The list of trees to read from the files. If only one tree is provided then it will"
    "    be used for all files. If multiple trees are specified, each tree is read from the"
-   "    respective file."
+   "    respective file. In the rntuple mode, these are the names of the RNTuples."
    "\n"
    "\n"
    " Specifying branches:\n"
@@ -55,6 +64,32 @@ const auto argUsageText =
    "    Reads any branches with a name matching the provided regex. Will error if any provided"
    "    regex does not match at least one branch."
    "\n"
+   "  In the rntuple mode, branches are the top-level fields of the RNTuples."
+   "\n"
+   "\n"
+   " Specifying what to measure:\n"
+   "   --modes mode1 [mode2...]\n"
+   "    The ways of reading the data to benchmark, one after the other (default: branches):\n"
+   "     branches   - TBranch::GetEntry on each branch,\n"
+   "     treereader - TTreeReaderValues,\n"
+   "     bulk       - bulk I/O, basket by basket (only for branches of fundamental types or fixed-size arrays),\n"
+   "     io-only    - fetch the compressed baskets from storage without decompressing them,\n"
+   "     rntuple    - RNTupleReader::LoadEntry on RNTuples,\n"
+   "     rdataframe - an RDataFrame event loop that reads all the branches.\n"
+   "    Running both branches and io-only gives an estimate of the time spent decompressing and deserializing.\n"
+   "\n"
+   "   --no-cluster-cache\n"
+   "    Read RNTuples without the cluster cache, i.e. without prefetching the clusters."
+   "\n"
+   "   --cluster-bunch-size nclusters\n"
+   "    The number of RNTuple clusters that the cluster cache reads together."
+   "\n"
+   "\n"
+   " Output:\n"
+   "   --json fname\n"
+   "    Also write the configuration, the ROOT version and the results of all the runs to fname in JSON format,"
+   "    e.g. to compare the throughput across ROOT versions."
+   "\n"
    "\n"
    " Meta arguments:\n"
    "   --threads nthreads\n"
@@ -144,10 +179,12 @@ const auto fullUsageText =
    " with respect to the runtimes reported by `rootreadspeed` (up to a factor 2). In realistic analysis applications it has "
    " been observed that a large part of that overhead is compensated by the ability of TTreeReader and RDataFrame to read "
    " branch values selectively, based on event cuts, and this overhead will be reduced significantly when using RDataFrame "
-   " in conjunction with RNTuple.";
+   " in conjunction with RNTuple. The treereader and rdataframe modes measure the overhead for your data."
+   " The number of uncompressed bytes is not measured in these modes, compare the event rates instead.";
 
 void ReadSpeed::PrintThroughput(const Result &r)
 {
+   std::cout << "Read mode:\t\t\t" << ToString(r.fReadMode) << '\n';
    std::cout << "Thread pool size:\t\t" << r.fThreadPoolSize << '\n';
 
    if (r.fMTSetupRealTime > 0.) {
@@ -157,15 +194,24 @@ void ReadSpeed::PrintThroughput(const Result &r)
 
    std::cout << "Real time:\t\t\t" << r.fRealTime << " s\n";
    std::cout << "CPU time:\t\t\t" << r.fCpuTime << " s\n";
+   if (r.fIORealTime >= 0. && r.fReadMode != EReadMode::kIOOnly)
+      std::cout << "Real time in I/O:\t\t" << r.fIORealTime << " s\n";
+   if (r.fDecompressionRealTime >= 0.)
+      std::cout << "Real time decompressing:\t" << r.fDecompressionRealTime << " s\n";
 
-   std::cout << "Uncompressed data read:\t\t" << r.fUncompressedBytesRead << " bytes\n";
+   if (r.fUncompressedBytesRead > 0)
+      std::cout << "Uncompressed data read:\t\t" << r.fUncompressedBytesRead << " bytes\n";
    std::cout << "Compressed data read:\t\t" << r.fCompressedBytesRead << " bytes\n";
+   std::cout << "Entries read:\t\t\t" << r.fEntriesRead << '\n';
 
    const unsigned int effectiveThreads = std::max(r.fThreadPoolSize, 1u);
 
-   std::cout << "Uncompressed throughput:\t" << r.fUncompressedBytesRead / r.fRealTime / 1024 / 1024 << " MB/s\n";
-   std::cout << "\t\t\t\t" << r.fUncompressedBytesRead / r.fRealTime / 1024 / 1024 / effectiveThreads
-             << " MB/s/thread for " << effectiveThreads << " threads\n";
+   std::cout << "Event rate:\t\t\t" << r.fEntriesRead / r.fRealTime << " entries/s\n";
+   if (r.fUncompressedBytesRead > 0) {
+      std::cout << "Uncompressed throughput:\t" << r.fUncompressedBytesRead / r.fRealTime / 1024 / 1024 << " MB/s\n";
+      std::cout << "\t\t\t\t" << r.fUncompressedBytesRead / r.fRealTime / 1024 / 1024 / effectiveThreads
+                << " MB/s/thread for " << effectiveThreads << " threads\n";
+   }
    std::cout << "Compressed throughput:\t\t" << r.fCompressedBytesRead / r.fRealTime / 1024 / 1024 << " MB/s\n";
    std::cout << "\t\t\t\t" << r.fCompressedBytesRead / r.fRealTime / 1024 / 1024 / effectiveThreads
              << " MB/s/thread for " << effectiveThreads << " threads\n\n";
@@ -184,6 +230,94 @@ void ReadSpeed::PrintThroughput(const Result &r)
    std::cout << "For details run with the --help command.\n";
 }
 
+void ReadSpeed::PrintTimeSplit(const std::vector<Result> &results)
+{
+   const auto findMode = [&results](EReadMode mode) {
+      return std::find_if(results.begin(), results.end(), [mode](const Result &r) { return r.fReadMode == mode; });
+   };
+   const auto ioOnly = findMode(EReadMode::kIOOnly);
+   if (ioOnly == results.end())
+      return;
+   for (auto mode : {EReadMode::kBranches, EReadMode::kBulk, EReadMode::kTreeReader}) {
+      const auto full = findMode(mode);
+      if (full == results.end())
+         continue;
+      std::cout << "Time split for the " << ToString(mode) << " mode:\n";
+      std::cout << "I/O real time:\t\t\t" << ioOnly->fRealTime << " s\n";
+      std::cout << "Decompression and deserialization real time (estimate):\t"
+                << std::max(full->fRealTime - ioOnly->fRealTime, 0.) << " s\n";
+   }
+}
+
+// Return the string as a JSON string literal.
+static std::string ToJSONString(const std::string &str)
+{
+   std::string res = "\"";
+   for (const char c : str) {
+      switch (c) {
+      case '"': res += "\\\""; break;
+      case '\\': res += "\\\\"; break;
+      case '\n': res += "\\n"; break;
+      case '\t': res += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            std::ostringstream os;
+            os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c);
+            res += os.str();
+         } else {
+            res += c;
+         }
+      }
+   }
+   return res + '"';
+}
+
+static std::string ToJSONArray(const std::vector<std::string> &strs)
+{
+   std::string res = "[";
+   for (std::size_t i = 0; i < strs.size(); ++i)
+      res += (i > 0 ? ", " : "") + ToJSONString(strs[i]);
+   return res + ']';
+}
+
+void ReadSpeed::WriteJSON(std::ostream &os, const Args &args, const std::vector<Result> &results)
+{
+   const auto &d = args.fData;
+   os << "{\n";
+   os << "  \"rootVersion\": " << ToJSONString(ROOT_RELEASE) << ",\n";
+   os << "  \"files\": " << ToJSONArray(d.fFileNames) << ",\n";
+   os << "  \"trees\": " << ToJSONArray(d.fTreeNames) << ",\n";
+   os << "  \"branches\": " << ToJSONArray(d.fBranchNames) << ",\n";
+   os << "  \"branchesRegex\": " << (d.fUseRegex ? "true" : "false") << ",\n";
+   os << "  \"threads\": " << args.fNThreads << ",\n";
+   os << "  \"clusterCache\": " << (d.fUseClusterCache ? "true" : "false") << ",\n";
+   os << "  \"clusterBunchSize\": " << d.fClusterBunchSize << ",\n";
+   os << "  \"results\": [";
+   for (std::size_t i = 0; i < results.size(); ++i) {
+      const auto &r = results[i];
+      const auto mbPerSecond = [&r](ULong64_t bytes) {
+         return r.fRealTime > 0. ? bytes / r.fRealTime / 1024 / 1024 : 0.;
+      };
+      os << (i > 0 ? "," : "") << "\n    {\n";
+      os << "      \"mode\": " << ToJSONString(ToString(r.fReadMode)) << ",\n";
+      os << "      \"threadPoolSize\": " << r.fThreadPoolSize << ",\n";
+      os << "      \"realTime\": " << r.fRealTime << ",\n";
+      os << "      \"cpuTime\": " << r.fCpuTime << ",\n";
+      os << "      \"mtSetupRealTime\": " << r.fMTSetupRealTime << ",\n";
+      os << "      \"mtSetupCpuTime\": " << r.fMTSetupCpuTime << ",\n";
+      os << "      \"ioRealTime\": " << r.fIORealTime << ",\n";
+      os << "      \"decompressionRealTime\": " << r.fDecompressionRealTime << ",\n";
+      os << "      \"uncompressedBytes\": " << r.fUncompressedBytesRead << ",\n";
+      os << "      \"compressedBytes\": " << r.fCompressedBytesRead << ",\n";
+      os << "      \"entries\": " << r.fEntriesRead << ",\n";
+      os << "      \"uncompressedThroughputMBps\": " << mbPerSecond(r.fUncompressedBytesRead) << ",\n";
+      os << "      \"compressedThroughputMBps\": " << mbPerSecond(r.fCompressedBytesRead) << ",\n";
+      os << "      \"eventRate\": " << (r.fRealTime > 0. ? r.fEntriesRead / r.fRealTime : 0.) << "\n";
+      os << "    }";
+   }
+   os << "\n  ]\n}\n";
+}
+
 Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 {
    // Print help message and exit if "--help"
@@ -204,8 +338,20 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 
    Data d;
    unsigned int nThreads = 0;
+   std::vector<EReadMode> readModes;
+   std::string jsonFileName;
 
-   enum class EArgState { kNone, kTrees, kFiles, kBranches, kThreads, kTasksPerWorkerHint } argState = EArgState::kNone;
+   enum class EArgState {
+      kNone,
+      kTrees,
+      kFiles,
+      kBranches,
+      kThreads,
+      kTasksPerWorkerHint,
+      kModes,
+      kClusterBunchSize,
+      kJSON
+   } argState = EArgState::kNone;
    enum class EBranchState { kNone, kRegular, kRegex, kAll } branchState = EBranchState::kNone;
    const auto branchOptionsErrMsg =
       "Options --all-branches, --branches, and --branches-regex are mutually exclusive. You can use only one.\n";
@@ -245,6 +391,15 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
          argState = EArgState::kThreads;
       } else if (arg == "--tasks-per-worker") {
          argState = EArgState::kTasksPerWorkerHint;
+      } else if (arg == "--modes") {
+         argState = EArgState::kModes;
+      } else if (arg == "--no-cluster-cache") {
+         argState = EArgState::kNone;
+         d.fUseClusterCache = false;
+      } else if (arg == "--cluster-bunch-size") {
+         argState = EArgState::kClusterBunchSize;
+      } else if (arg == "--json") {
+         argState = EArgState::kJSON;
       } else if (arg[0] == '-') {
          std::cerr << "Unrecognized option '" << arg << "'\n";
          return {};
@@ -266,12 +421,33 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
                          "will be ignored.\n";
 #endif
             break;
+         case EArgState::kModes:
+            try {
+               readModes.emplace_back(ParseReadMode(arg));
+            } catch (const std::invalid_argument &e) {
+               std::cerr << e.what() << '\n';
+               return {};
+            }
+            break;
+         case EArgState::kClusterBunchSize:
+            d.fClusterBunchSize = std::stoi(arg);
+            argState = EArgState::kNone;
+            break;
+         case EArgState::kJSON:
+            jsonFileName = arg;
+            argState = EArgState::kNone;
+            break;
          default: std::cerr << "Unrecognized option '" << arg << "'\n"; return {};
          }
       }
    }
 
-   return Args{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true};
+   if (readModes.empty())
+      readModes.emplace_back(EReadMode::kBranches);
+   d.fReadMode = readModes[0];
+
+   return Args{std::move(d),         nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true,
+               std::move(readModes), std::move(jsonFileName)};
 }
 
 Args ReadSpeed::ParseArgs(int argc, char **argv)
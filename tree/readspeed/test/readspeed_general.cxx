@@ -14,10 +14,15 @@
 #include "ROOT/TTreeProcessorMT.hxx" // for TTreeProcessorMT::GetTasksPerWorkerHint
 #endif
 
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+
 #include "TFile.h"
 #include "TSystem.h"
 #include "TTree.h"
 
+#include <sstream>
+
 using namespace ReadSpeed;
 
 // Helper function to generate a .root file with some dummy data in it.
@@ -39,6 +44,22 @@ void RequireFile(const std::string &fname, const std::vector<std::string> &branc
    t.Write();
 }
 
+// Helper function to generate a .root file with an RNTuple "ntpl" with some dummy data in it.
+void RequireNTupleFile(const std::string &fname, const std::vector<std::string> &fieldNames = {"x"})
+{
+   if (gSystem->AccessPathName(fname.c_str()) == false)
+      return;
+
+   auto model = ROOT::Experimental::RNTupleModel::Create();
+   std::vector<std::shared_ptr<int>> values;
+   for (const auto &f : fieldNames)
+      values.emplace_back(model->MakeField<int>(f.c_str(), 42));
+
+   auto writer = ROOT::Experimental::RNTupleWriter::Recreate(std::move(model), "ntpl", fname);
+   for (int i = 0; i < 1000000; ++i)
+      writer->Fill();
+}
+
 // Helper function to concatenate two vectors of strings.
 std::vector<std::string> ConcatVectors(const std::vector<std::string> &first, const std::vector<std::string> &second)
 {
@@ -58,6 +79,7 @@ protected:
       RequireFile("readspeedinput1.root");
       RequireFile("readspeedinput2.root");
       RequireFile("readspeedinput3.root", {"x", "x_branch", "y_brunch", "mismatched"});
+      RequireNTupleFile("readspeedinput_ntuple.root", {"x", "y"});
    }
 
    static void TearDownTestSuite()
@@ -65,6 +87,7 @@ protected:
       gSystem->Unlink("readspeedinput1.root");
       gSystem->Unlink("readspeedinput2.root");
       gSystem->Unlink("readspeedinput3.root");
+      gSystem->Unlink("readspeedinput_ntuple.root");
    }
 };
 
@@ -144,6 +167,95 @@ TEST_F(ReadSpeedIntegration, AllBranches)
    EXPECT_EQ(result.fCompressedBytesRead, 1316837) << "Wrong number of compressed bytes read";
 }
 
+TEST_F(ReadSpeedIntegration, TreeReader)
+{
+   Data d{{"t"}, {"readspeedinput1.root", "readspeedinput2.root"}, {"x"}};
+   d.fReadMode = EReadMode::kTreeReader;
+   const auto result = EvalThroughput(d, 0);
+
+   EXPECT_EQ(result.fReadMode, EReadMode::kTreeReader);
+   EXPECT_EQ(result.fEntriesRead, 20000000) << "Wrong number of entries read";
+   EXPECT_EQ(result.fUncompressedBytesRead, 0) << "Uncompressed bytes are not measured with TTreeReader";
+   EXPECT_GT(result.fCompressedBytesRead, 0) << "Wrong number of compressed bytes read";
+}
+
+TEST_F(ReadSpeedIntegration, Bulk)
+{
+   Data d{{"t"}, {"readspeedinput1.root", "readspeedinput2.root"}, {"x"}};
+   d.fReadMode = EReadMode::kBulk;
+   const auto result = EvalThroughput(d, 0);
+
+   EXPECT_EQ(result.fEntriesRead, 20000000) << "Wrong number of entries read";
+   EXPECT_EQ(result.fUncompressedBytesRead, 80000000) << "Wrong number of uncompressed bytes read";
+   EXPECT_GT(result.fCompressedBytesRead, 0) << "Wrong number of compressed bytes read";
+}
+
+TEST_F(ReadSpeedIntegration, IOOnly)
+{
+   Data d{{"t"}, {"readspeedinput1.root", "readspeedinput2.root"}, {"x"}};
+   d.fReadMode = EReadMode::kIOOnly;
+   const auto result = EvalThroughput(d, 0);
+
+   EXPECT_EQ(result.fEntriesRead, 20000000) << "Wrong number of entries read";
+   EXPECT_EQ(result.fUncompressedBytesRead, 0) << "Nothing should be decompressed";
+   EXPECT_GT(result.fCompressedBytesRead, 0) << "Wrong number of compressed bytes read";
+   EXPECT_LE(result.fCompressedBytesRead, 643934) << "More bytes read than when decompressing the branches";
+   EXPECT_EQ(result.fIORealTime, result.fRealTime);
+}
+
+#ifdef R__USE_IMT
+TEST_F(ReadSpeedIntegration, BulkMultiThread)
+{
+   Data d{{"t"}, {"readspeedinput1.root", "readspeedinput2.root"}, {"x"}};
+   d.fReadMode = EReadMode::kBulk;
+   const auto result = EvalThroughput(d, 2);
+
+   EXPECT_EQ(result.fEntriesRead, 20000000) << "Wrong number of entries read";
+   EXPECT_EQ(result.fUncompressedBytesRead, 80000000) << "Wrong number of uncompressed bytes read";
+}
+#endif
+
+TEST_F(ReadSpeedIntegration, RNTuple)
+{
+   for (bool clusterCache : {true, false}) {
+      Data d{{"ntpl"}, {"readspeedinput_ntuple.root"}, {"x"}};
+      d.fReadMode = EReadMode::kRNTuple;
+      d.fUseClusterCache = clusterCache;
+      const auto result = EvalThroughput(d, 0);
+
+      EXPECT_EQ(result.fEntriesRead, 1000000) << "Wrong number of entries read";
+      EXPECT_EQ(result.fUncompressedBytesRead, 4000000) << "Wrong number of uncompressed bytes read";
+      EXPECT_GT(result.fCompressedBytesRead, 0) << "Wrong number of compressed bytes read";
+      EXPECT_GE(result.fDecompressionRealTime, 0.) << "Decompression time not measured";
+   }
+}
+
+TEST_F(ReadSpeedIntegration, RNTupleAllFields)
+{
+   Data d{{"ntpl"}, {"readspeedinput_ntuple.root"}, {".*"}, true};
+   d.fReadMode = EReadMode::kRNTuple;
+   const auto result = EvalThroughput(d, 0);
+
+   EXPECT_EQ(result.fUncompressedBytesRead, 8000000) << "Wrong number of uncompressed bytes read";
+}
+
+TEST_F(ReadSpeedIntegration, RNTupleNonExistentField)
+{
+   Data d{{"ntpl"}, {"readspeedinput_ntuple.root"}, {"z"}};
+   d.fReadMode = EReadMode::kRNTuple;
+   EXPECT_THROW(EvalThroughput(d, 0), std::runtime_error) << "Should throw for non-existent field";
+}
+
+TEST_F(ReadSpeedIntegration, RDataFrame)
+{
+   Data d{{"t"}, {"readspeedinput1.root", "readspeedinput2.root"}, {"x"}};
+   d.fReadMode = EReadMode::kRDataFrame;
+   const auto result = EvalThroughput(d, 0);
+
+   EXPECT_EQ(result.fEntriesRead, 20000000) << "Wrong number of entries read";
+   EXPECT_GT(result.fCompressedBytesRead, 0) << "Wrong number of compressed bytes read";
+}
+
 TEST(ReadSpeedCLI, CheckFilenames)
 {
    const std::vector<std::string> baseArgs{"root-readspeed", "--trees", "t", "--branches", "x", "--files"};
@@ -295,3 +407,72 @@ TEST(ReadSpeedCLI, WorkerThreadsHint)
    EXPECT_EQ(newTasksPerWorker, oldTasksPerWorker + 10) << "Tasks per worker hint not updated correctly";
 }
 #endif
+
+TEST(ReadSpeedCLI, Modes)
+{
+   const std::vector<std::string> allArgs{"root-readspeed", "--files", "doesnotexist.root", "--trees", "t",
+                                          "--branches", "x", "--modes", "branches", "io-only", "rntuple"};
+   const std::vector<EReadMode> modes{EReadMode::kBranches, EReadMode::kIOOnly, EReadMode::kRNTuple};
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(parsedArgs.fShouldRun) << "Program not running when given valid arguments";
+   EXPECT_EQ(parsedArgs.fReadModes, modes) << "Read modes not parsed correctly";
+   EXPECT_EQ(parsedArgs.fData.fReadMode, EReadMode::kBranches) << "Read mode not set to the first mode";
+}
+
+TEST(ReadSpeedCLI, DefaultMode)
+{
+   const std::vector<std::string> allArgs{
+      "root-readspeed", "--files", "doesnotexist.root", "--trees", "t", "--branches", "x",
+   };
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_EQ(parsedArgs.fReadModes, std::vector<EReadMode>{EReadMode::kBranches}) << "Wrong default read mode";
+   EXPECT_TRUE(parsedArgs.fData.fUseClusterCache) << "Cluster cache not used by default";
+   EXPECT_TRUE(parsedArgs.fJSONFileName.empty()) << "JSON output requested by default";
+}
+
+TEST(ReadSpeedCLI, InvalidMode)
+{
+   const std::vector<std::string> allArgs{"root-readspeed", "--files", "doesnotexist.root", "--trees",
+                                          "t",              "--branches", "x",             "--modes",
+                                          "fake-mode"};
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(!parsedArgs.fShouldRun) << "Program running when using an invalid read mode";
+}
+
+TEST(ReadSpeedCLI, RNTupleOptions)
+{
+   const std::vector<std::string> allArgs{"root-readspeed",       "--files", "doesnotexist.root", "--trees",
+                                          "ntpl",                 "--branches", "x",               "--no-cluster-cache",
+                                          "--cluster-bunch-size", "4",          "--json",          "out.json"};
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(parsedArgs.fShouldRun) << "Program not running when given valid arguments";
+   EXPECT_FALSE(parsedArgs.fData.fUseClusterCache) << "Cluster cache not disabled";
+   EXPECT_EQ(parsedArgs.fData.fClusterBunchSize, 4u) << "Wrong cluster bunch size";
+   EXPECT_EQ(parsedArgs.fJSONFileName, "out.json") << "Wrong JSON file name";
+}
+
+TEST(ReadSpeedCLI, JSONOutput)
+{
+   Args args;
+   args.fData = {{"t"}, {"some \"file\".root"}, {"x"}};
+   Result r{2., 1., 0., 0., 200, 100, 0, 10};
+   r.fReadMode = EReadMode::kBulk;
+
+   std::ostringstream os;
+   WriteJSON(os, args, {r});
+   const auto json = os.str();
+
+   EXPECT_NE(json.find("\"rootVersion\": \""), std::string::npos) << json;
+   EXPECT_NE(json.find("\"files\": [\"some \\\"file\\\".root\"]"), std::string::npos) << json;
+   EXPECT_NE(json.find("\"mode\": \"bulk\""), std::string::npos) << json;
+   EXPECT_NE(json.find("\"entries\": 10,"), std::string::npos) << json;
+   EXPECT_NE(json.find("\"eventRate\": 5\n"), std::string::npos) << json;
+}
@@ -75,6 +75,7 @@ protected:
    Int_t       fLastWriteBufferSize[3] = {0,0,0}; ///<! Size of the buffer last three buffers we wrote it to disk
    Bool_t      fResetAllocation{false};           ///<! True if last reset re-allocated the memory
    UChar_t     fNextBufferSizeRecord{0};          ///<! Index into fLastWriteBufferSize of the last buffer written to disk
+   Bool_t      fWriteBehind{kFALSE};              ///<! True if WriteBuffer() runs while the branch is filled
 #ifdef R__TRACK_BASKET_ALLOC_TIME
    ULong64_t   fResetAllocationTime{0};           ///<! Time spent reallocating baskets in microseconds during last Reset operation.
 #endif
@@ -144,11 +145,13 @@ public:
 
    Int_t           LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tree = nullptr);
    Long64_t        CopyTo(TFile *to);
+   Int_t           Recompress(Int_t compressionSettings);
 
            void    SetBranch(TBranch *branch) { fBranch = branch; }
            void    SetNevBufSize(Int_t n) { fNevBufSize=n; }
    virtual void    SetReadMode();
    virtual void    SetWriteMode();
+           void    SetWriteBehind(Int_t basketnumber);
    inline  void    Update(Int_t newlast) { Update(newlast,newlast); };
    virtual void    Update(Int_t newlast, Int_t skipped);
    virtual Int_t   WriteBuffer();
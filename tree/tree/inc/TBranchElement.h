@@ -36,6 +36,8 @@ class TVirtualArray;
 
 #include "TStreamerInfoActions.h"
 
+#include <vector>
+
 class TBranchElement : public TBranch {
 
 // Friends
@@ -182,6 +184,8 @@ public:
            TBranchElement  *GetBranchCount() const { return fBranchCount; }
            TBranchElement  *GetBranchCount2() const { return fBranchCount2; }
            Int_t           *GetBranchOffset() const { return fBranchOffset; }
+           Int_t            GetBulkCollectionEntries(Long64_t entry, TBuffer &values, std::vector<Int_t> &offsets);
+           Int_t            GetBulkCollectionValueSize() const;
            UInt_t           GetCheckSum() { return fCheckSum; }
            const char      *GetClassName() const override { return fClassName.Data(); }
    virtual TClass          *GetClass() const { return fBranchClass; }
@@ -232,6 +236,7 @@ public:
    virtual void             SetTargetClass(const char *name);
            void             SetupAddresses() override;
    virtual void             SetType(Int_t btype) { fType = btype; }
+           Bool_t           SupportsBulkCollectionRead() const { return GetBulkCollectionValueSize() > 0; }
            void             UpdateFile() override;
            void             Unroll(const char *name, TClass *cl, TStreamerInfo *sinfo, char* objptr, Int_t bufsize, Int_t splitlevel);
 
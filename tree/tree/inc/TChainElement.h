@@ -23,6 +23,9 @@
 
 #include "TNamed.h"
 
+#include <utility>
+#include <vector>
+
 class TBranch;
 
 class TChainElement : public TNamed {
@@ -46,6 +49,7 @@ protected:
    char         *fPackets;           ///<! Packet descriptor string
    TBranch     **fBranchPtr;         ///<! Address of user branch pointer (to updated upon loading a file)
    Int_t         fLoadResult;        ///<! Return value of TChain::LoadTree(); 0 means success
+   std::vector<Long64_t> fClusterBoundaries; ///<! Cluster starts and number of entries, see TChain::PrefetchMetadata()
 
 public:
    TChainElement();
@@ -57,6 +61,7 @@ public:
    virtual Bool_t      GetBaddressIsPtr() const { return fBaddressIsPtr; }
    virtual UInt_t      GetBaddressType() const { return fBaddressType; }
    virtual TBranch   **GetBranchPtr() const { return fBranchPtr; }
+   const std::vector<Long64_t> &GetClusterBoundaries() const { return fClusterBoundaries; }
    virtual Long64_t    GetEntries() const {return fEntries;}
            Int_t       GetLoadResult() const { return fLoadResult; }
            Bool_t      GetCheckedType() const { return fCheckedType; }
@@ -72,6 +77,7 @@ public:
    virtual void        SetBaddressType(UInt_t type) { fBaddressType = type; }
    virtual void        SetBranchPtr(TBranch **ptr) { fBranchPtr = ptr; }
            void        SetCheckedType(Bool_t m) { fCheckedType = m; }
+   void                SetClusterBoundaries(std::vector<Long64_t> b) { fClusterBoundaries = std::move(b); }
            void        SetDecomposedObj(Bool_t m) { fDecomposedObj = m; }
            void        SetLoadResult(Int_t result) { fLoadResult = result; }
    virtual void        SetLookedUp(Bool_t y = kTRUE);
@@ -49,6 +49,7 @@ class TEntryList: public TNamed
    Bool_t           fReapply;           ///<  If true, TTree::Draw will 'reapply' the original cut
 
    void             GetFileName(const char *filename, TString &fn, Bool_t * = nullptr);
+   void             AddSubListsOf(const TEntryList *elist);
 
  public:
    enum {kBlockSize = 64000}; //number of entries in each block (not the physical size).
@@ -73,6 +74,7 @@ class TEntryList: public TNamed
    virtual Long64_t    GetEntry(Long64_t index);
    virtual Long64_t    GetEntryAndTree(Long64_t index, Int_t &treenum);
    virtual Long64_t    GetEntriesToProcess() const {return fEntriesToProcess;}
+   virtual Long64_t    GetNEntriesBefore(Long64_t entry);
    virtual TList      *GetLists() const { return fLists; }
    virtual TDirectory *GetDirectory() const { return fDirectory; }
    virtual Long64_t    GetN() const { return fN; }
@@ -92,6 +94,7 @@ class TEntryList: public TNamed
    virtual Long64_t    Next();
    virtual void        OptimizeStorage();
    virtual Int_t       RelocatePaths(const char *newloc, const char *oldloc = nullptr);
+   virtual void        Intersect(const TEntryList *elist);
    virtual Bool_t      Remove(Long64_t entry, TTree *tree = nullptr);
    virtual void        Reset();
    virtual Int_t       ScanPaths(TList *roots, Bool_t notify = kTRUE);
@@ -159,10 +159,13 @@ private:
    mutable Bool_t fIMTFlush{false};               ///<! True if we are doing a multithreaded flush.
    mutable std::atomic<Long64_t> fIMTTotBytes;    ///<! Total bytes for the IMT flush baskets
    mutable std::atomic<Long64_t> fIMTZipBytes;    ///<! Zip bytes for the IMT flush baskets.
+   ROOT::Internal::TBranchIMTHelper *fWriteBehind{nullptr}; ///<! Pending basket writes of Fill(), see SetWriteBehind()
 
    void             InitializeBranchLists(bool checkLeafCount);
    void             SortBranchesByTime();
    Int_t            FlushBasketsImpl() const;
+   void             CollectWriteBehind() const;
+   Long64_t         CopyEntriesImpl(TTree *tree, Long64_t nentries, Option_t *option, Bool_t needCopyAddresses, TString *report);
    void             MarkEventCluster();
    Long64_t         GetMedianClusterSize();
 
@@ -542,6 +545,7 @@ public:
    virtual Double_t       *GetV4()   { return GetPlayer()->GetV4(); }
    virtual Double_t       *GetW()    { return GetPlayer()->GetW(); }
    virtual Double_t        GetWeight() const   { return fWeight; }
+           Long64_t        GetWriteBehind() const;
    virtual Long64_t        GetZipBytes() const { return fZipBytes; }
    virtual void            IncrementTotalBuffers(Int_t nbytes) { fTotalBuffers += nbytes; }
            Bool_t          IsFolder() const override { return kTRUE; }
@@ -647,6 +651,7 @@ public:
    virtual void            SetTimerInterval(Int_t msec = 333) { fTimerInterval=msec; }
    virtual void            SetTreeIndex(TVirtualIndex* index);
    virtual void            SetWeight(Double_t w = 1, Option_t* option = "");
+           void            SetWriteBehind(Long64_t maxPendingBytes = 100000000);
    virtual void            SetUpdate(Int_t freq = 0) { fUpdate = freq; }
    virtual void            Show(Long64_t entry = -1, Int_t lenmax = 20);
    virtual void            StartViewer(); // *MENU*
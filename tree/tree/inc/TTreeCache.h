@@ -63,6 +63,8 @@ protected:
    Bool_t       fEnabled{kTRUE};      ///<! cache enabled for cached reading
    EPrefillType fPrefillType;         ///<  Whether a pre-filling is enabled (and if applicable which type)
    static Int_t fgLearnEntries;       ///<  number of entries used for learning mode
+   static TString fgLearnProfile;     ///<  file with the branches learned by previous jobs, see SetLearnProfile
+   static TString fgLearnProfileLabel; ///< label of the job in the learn profile
    Bool_t       fAutoCreated{kFALSE}; ///<! true if cache was automatically created
 
    Bool_t       fLearnPrefilling{kFALSE}; ///<! true if we are in the process of executing LearnPrefill
@@ -124,6 +126,8 @@ private:
    TBranch *CalculateMissEntries(Long64_t, int, bool);    ///< Given an file read, try to determine the corresponding branch.
    Bool_t   ProcessMiss(Long64_t pos, int len); ///<! Given a file read not in the miss cache, handle (possibly) loading the data.
 
+   TString  GetLearnProfileKey() const;
+
 public:
 
    TTreeCache();
@@ -143,6 +147,8 @@ public:
    virtual Int_t        GetEntryMin() const {return fEntryMin;}
    virtual Int_t        GetEntryMax() const {return fEntryMax;}
    static Int_t         GetLearnEntries();
+   static const char   *GetLearnProfile() { return fgLearnProfile; }
+   static const char   *GetLearnProfileLabel() { return fgLearnProfileLabel; }
    virtual EPrefillType GetLearnPrefill() const {return fPrefillType;}
    Double_t             GetMissEfficiency() const;
    Double_t             GetMissEfficiencyRel() const;
@@ -154,6 +160,7 @@ public:
    virtual Bool_t       FillBuffer();
    Int_t                LearnBranch(TBranch *b, Bool_t subgbranches = kFALSE) override;
    virtual void         LearnPrefill();
+   Bool_t               LoadLearnProfile();
 
    void                 Print(Option_t *option="") const override;
    Int_t                ReadBuffer(char *buf, Long64_t pos, Int_t len) override;
@@ -161,12 +168,14 @@ public:
    virtual Int_t        ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len);
    virtual void         ResetCache();
    void                 ResetMissCache(); // Reset the miss cache.
+   Int_t                SaveLearnProfile() const;
    void                 SetAutoCreated(Bool_t val) {fAutoCreated = val;}
    Int_t                SetBufferSize(Int_t buffersize) override;
    virtual void         SetEntryRange(Long64_t emin,   Long64_t emax);
    void                 SetFile(TFile *file, TFile::ECacheAction action=TFile::kDisconnect) override;
    virtual void         SetLearnPrefill(EPrefillType type = kNoPrefill);
    static void          SetLearnEntries(Int_t n = 10);
+   static void          SetLearnProfile(const char *filename, const char *label = "");
    void                 SetOptimizeMisses(Bool_t opt);
    void                 StartLearningPhase();
    virtual void         StopLearningPhase();
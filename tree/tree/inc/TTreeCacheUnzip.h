@@ -96,6 +96,7 @@ protected:
    Int_t       fNseekMax;         ///<!  fNseek can change so we need to know its max size
    Int_t       fUnzipGroupSize;   ///<!  Min accumulated size of a group of baskets ready to be unzipped by a IMT task
    Long64_t    fUnzipBufferSize;  ///<!  Max Size for the ready unzipped blocks (default is 2*fBufferSize)
+   Int_t       fUnzipNClusters;   ///<!  Max number of clusters whose baskets are read and unzipped together
 
    static Double_t fgRelBuffSize; ///< This is the percentage of the TTreeCacheUnzip that will be used
 
@@ -140,10 +141,12 @@ public:
    Int_t          GetRecordHeader(char *buf, Int_t maxbytes, Int_t &nbytes, Int_t &objlen, Int_t &keylen);
    Int_t          GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_t *free) override;
    Int_t          GetUnzipGroupSize() { return fUnzipGroupSize; }
+   Int_t          GetUnzipNClusters() const { return fUnzipNClusters; }
    void           ResetCache() override;
    Int_t          SetBufferSize(Int_t buffersize) override;
    void           SetUnzipBufferSize(Long64_t bufferSize);
    void           SetUnzipGroupSize(Int_t groupSize) { fUnzipGroupSize = groupSize; }
+   void           SetUnzipNClusters(Int_t nclusters);
    static void    SetUnzipRelBufferSize(Float_t relbufferSize);
    Int_t          UnzipBuffer(char **dest, char *src);
    Int_t          UnzipCache(Int_t index);
@@ -152,6 +155,7 @@ public:
    Int_t  GetNUnzip() { return fNUnzip; }
    Int_t  GetNMissed(){ return fNMissed; }
    Int_t  GetNFound() { return fNFound; }
+   Int_t  GetNStalls() const { return fNStalls; }
 
    void Print(Option_t* option = "") const override;
 
@@ -53,6 +53,7 @@ class TTreeCloner {
    UShort_t   fPidOffset;        ///< Offset to be added to the copied key/basket.
 
    UInt_t     fCloneMethod;      ///< Indicates which cloning method was selected.
+   Int_t      fRecompressSettings; ///< Compression settings of the recompressed output baskets, -1 if not recompressed.
    Long64_t   fToStartEntries;   ///< Number of entries in the target tree before any addition.
 
    Int_t           fCacheSize;   ///< Requested size of the file cache
@@ -87,6 +88,8 @@ class TTreeCloner {
    void CreateCache();
    UInt_t FillCache(UInt_t from);
    void RestoreCache();
+   void WriteMemoryBasket(TBranch *from, TBranch *to, Int_t index);
+   void WriteRecompressedBaskets();
 
 private:
    TTreeCloner(const TTreeCloner&) = delete;
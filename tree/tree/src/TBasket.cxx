@@ -23,10 +23,12 @@
 #include "TVirtualMutex.h"
 #include "TVirtualPerfStats.h"
 #include "TTimeStamp.h"
+#include "ROOT/RMetricsRegistry.hxx"
 #include "ROOT/TIOFeatures.hxx"
 #include "RZip.h"
 
 #include <bitset>
+#include <vector>
 
 const UInt_t kDisplacementMask = 0xFF000000;  // In the streamer the two highest bytes of
                                               // the fEntryOffset are used to stored displacement.
@@ -158,6 +160,77 @@ Long64_t TBasket::CopyTo(TFile *to)
    return nBytes>0 ? nBytes : -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the payload of a basket loaded with LoadBasketBuffers() again with
+/// the given compression settings, such that CopyTo() writes the recompressed
+/// basket. The payload is only decompressed, the entries are not unstreamed.
+/// Does not access the branch, the tree or the file: baskets can be
+/// recompressed concurrently.
+/// Returns 0 on success and 1 if the payload could not be decompressed.
+
+Int_t TBasket::Recompress(Int_t compressionSettings)
+{
+   const Int_t nin = fNbytes - fKeylen;
+   char *payload = fBufferRef->Buffer() + fKeylen;
+
+   std::vector<char> objbuf(fObjlen);
+   if (fObjlen > nin) {
+      UChar_t *src = reinterpret_cast<UChar_t *>(payload);
+      UChar_t *tgt = reinterpret_cast<UChar_t *>(objbuf.data());
+      Int_t nintot = 0;
+      Int_t noutot = 0;
+      while (noutot < fObjlen && nintot < nin) {
+         Int_t nzip, nunzip, nout = 0;
+         if (R__unzip_header(&nzip, src + nintot, &nunzip) != 0 || nunzip > fObjlen - noutot)
+            break;
+         R__unzip(&nzip, src + nintot, &nunzip, tgt + noutot, &nout);
+         if (!nout)
+            break;
+         nintot += nzip;
+         noutot += nout;
+      }
+      if (noutot != fObjlen) {
+         Error("Recompress", "Cannot decompress basket %s (fNbytes=%d, fObjlen=%d, noutot=%d)", GetName(), fNbytes,
+               fObjlen, noutot);
+         return 1;
+      }
+   } else {
+      memcpy(objbuf.data(), payload, fObjlen);
+   }
+
+   const Int_t cxlevel = compressionSettings % 100;
+   const auto cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(compressionSettings / 100);
+   std::vector<char> zipbuf;
+   Int_t noutot = fObjlen;
+   if (cxlevel > 0) {
+      const Int_t nbuffers = 1 + (fObjlen - 1) / kMAXZIPBUF;
+      zipbuf.resize(fObjlen + 9 * nbuffers + 28);
+      noutot = 0;
+      for (Int_t i = 0; i < nbuffers; ++i) {
+         Int_t bufmax = (i == nbuffers - 1) ? fObjlen - i * kMAXZIPBUF : kMAXZIPBUF;
+         Int_t zipmax = zipbuf.size() - noutot;
+         Int_t nout = 0;
+         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf.data() + i * kMAXZIPBUF, &zipmax, zipbuf.data() + noutot,
+                                 &nout, cxAlgorithm);
+         // As in WriteBuffer(): store the payload uncompressed if compression does not help
+         if (nout == 0 || noutot + nout >= fObjlen) {
+            noutot = fObjlen;
+            zipbuf.clear();
+            break;
+         }
+         noutot += nout;
+      }
+   }
+
+   fBufferRef->SetWriteMode();
+   if (fBufferRef->BufferSize() < fKeylen + noutot)
+      fBufferRef->Expand(fKeylen + noutot);
+   memcpy(fBufferRef->Buffer() + fKeylen, zipbuf.empty() ? objbuf.data() : zipbuf.data(), noutot);
+   fBufferRef->SetReadMode();
+   fNbytes = fKeylen + noutot;
+   return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///  Delete fEntryOffset array.
 
@@ -404,6 +477,22 @@ Int_t TBasket::ReadBasketBuffersUnzip(char* buffer, Int_t size, Bool_t mustFree,
    return fObjlen+fKeylen;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Add the decompression of a basket to the process-wide metrics
+
+static void R__CountBasketUnzip(std::chrono::steady_clock::time_point start, Int_t nbytes)
+{
+   using ROOT::Experimental::RMetric;
+   using ROOT::Experimental::RMetricsRegistry;
+   static auto &unzipTime = RMetricsRegistry::Instance().GetMetric(
+      "root_tree_unzip_seconds", "Time spent decompressing TTree baskets", RMetric::EKind::kCounter, "seconds", 1e-9);
+   static auto &unzipBytes = RMetricsRegistry::Instance().GetMetric(
+      "root_tree_unzip_bytes", "Bytes of decompressed TTree baskets", RMetric::EKind::kCounter, "bytes");
+   unzipTime.Add(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+   unzipBytes.Add(nbytes);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Initialize a buffer for reading if it is not already initialized
 
@@ -598,6 +687,10 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       if (R__unlikely(gPerfStats)) {
          start = TTimeStamp();
       }
+      const bool countMetrics = ROOT::Experimental::RMetricsRegistry::IsEnabled();
+      std::chrono::steady_clock::time_point metricsStart;
+      if (R__unlikely(countMetrics))
+         metricsStart = std::chrono::steady_clock::now();
 
       memcpy(rawUncompressedBuffer, rawCompressedBuffer, fKeylen);
       char *rawUncompressedObjectBuffer = rawUncompressedBuffer+fKeylen;
@@ -634,6 +727,8 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
          return 1;
       }
       len = fObjlen+fKeylen;
+      if (R__unlikely(countMetrics))
+         R__CountBasketUnzip(metricsStart, fObjlen);
       TVirtualPerfStats* temp = gPerfStats;
       if (fBranch->GetTree()->GetPerfStats() != 0) gPerfStats = fBranch->GetTree()->GetPerfStats();
       if (R__unlikely(gPerfStats)) {
@@ -1121,6 +1216,21 @@ void TBasket::Update(Int_t offset, Int_t skipped)
    fNevBuf++;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare this basket for a WriteBuffer() that runs in a task while its branch
+/// continues to be filled in new baskets, see TTree::SetWriteBehind().
+/// basketnumber is the index of the basket in the branch. The compression
+/// buffer that the basket shares with the other baskets of the branch is
+/// replaced by a buffer of its own at the time of compression.
+
+void TBasket::SetWriteBehind(Int_t basketnumber)
+{
+   fWriteBehind = kTRUE;
+   fCycle = basketnumber;
+   if (!fOwnsCompressedBuffer)
+      fCompressedBufferRef = nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Write buffer of this basket on the current file.
 ///
@@ -1209,7 +1319,8 @@ Int_t TBasket::WriteBuffer()
    fObjlen = fBufferRef->Length() - fKeylen;
 
    fHeaderOnly = kTRUE;
-   fCycle = fBranch->GetWriteBasket();
+   if (!fWriteBehind)
+      fCycle = fBranch->GetWriteBasket();
    Int_t cxlevel = fBranch->GetCompressionLevel();
    if (cxlevel == ROOT::RCompressionSetting::ELevel::kInherit)
       cxlevel = file->GetCompressionLevel();
@@ -3210,6 +3210,47 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
       fEntryOffsetLen = 2*nevbuf; // assume some fluctuations.
    }
 
+   if (imtHelper && imtHelper->IsWriteBehind() && where == fWriteBasket) {
+      // The entries of the basket are accounted for now: Fill() continues on a new basket while the basket is
+      // compressed and written by a task. Its size and position are known once the task is collected.
+      fBaskets[where] = nullptr;
+      if (basket == fCurrentBasket) {
+         fCurrentBasket    = 0;
+         fFirstBasketEntry = -1;
+         fNextBasketEntry  = -1;
+      }
+      ++fWriteBasket;
+      if (fWriteBasket >= fMaxBaskets) {
+         ExpandBasketArrays();
+      }
+      fBaskets.AddAtAndExpand(nullptr, fWriteBasket);
+      fBasketEntry[fWriteBasket] = fEntryNumber;
+      basket->SetWriteBehind(where);
+
+      auto doWrite = [basket]() { return basket->WriteBuffer(); };
+      auto doUpdates = [this, basket, where](Int_t nout) {
+         if (nout < 0)
+            Error("WriteBasketImpl", "basket's WriteBuffer failed.");
+         fBasketBytes[where]  = basket->GetNbytes();
+         fBasketSeek[where]   = basket->GetSeekKey();
+         if (nout > 0) {
+            Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
+            fZipBytes += nout;
+            fTotBytes += addbytes;
+            fTree->AddTotBytes(addbytes);
+            fTree->AddZipBytes(nout);
+            // The branch got a new write basket in the meantime
+            --fNBaskets;
+            basket->DropBuffers();
+            delete basket;
+         } else {
+            fBaskets.AddAtAndExpand(basket, where);
+         }
+      };
+      imtHelper->RunBehind(basket->GetBufferSize(), doWrite, doUpdates);
+      return 0;
+   }
+
    // Note: captures `basket`, `where`, and `this` by value; modifies the TBranch and basket,
    // as we make a copy of the pointer.  We cannot capture `basket` by reference as the pointer
    // itself might be modified after `WriteBasketImpl` exits.
@@ -3265,7 +3306,7 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
       }
       return nout;
    };
-   if (imtHelper) {
+   if (imtHelper && !imtHelper->IsWriteBehind()) {
       imtHelper->Run(doUpdates);
       return 0;
    } else {
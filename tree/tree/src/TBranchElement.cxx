@@ -18,6 +18,7 @@ A Branch for the case of an object.
 #include "TBranchElement.h"
 
 #include "TBasket.h"
+#include "Bytes.h"
 #include "TBranchObject.h"
 #include "TBranchRef.h"
 #include "TBrowser.h"
@@ -48,6 +49,9 @@ A Branch for the case of an object.
 #include "TStreamerInfoActions.h"
 #include "TSchemaRuleSet.h"
 
+#include <algorithm>
+#include <cstring>
+
 ClassImp(TBranchElement);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -63,6 +67,25 @@ namespace {
             str.Remove(0, prefix.Length());
       }
    }
+   /// Size of the values of the given streamer type that GetBulkCollectionEntries() copies as they are from the
+   /// basket; 0 for the types that need a conversion (e.g. Double32_t, Long_t) or are not basic types.
+   Int_t GetBulkValueSize(Int_t type)
+   {
+      switch (type) {
+         case TVirtualStreamerInfo::kChar:
+         case TVirtualStreamerInfo::kUChar:
+         case TVirtualStreamerInfo::kBool: return 1;
+         case TVirtualStreamerInfo::kShort:
+         case TVirtualStreamerInfo::kUShort: return 2;
+         case TVirtualStreamerInfo::kInt:
+         case TVirtualStreamerInfo::kUInt:
+         case TVirtualStreamerInfo::kFloat: return 4;
+         case TVirtualStreamerInfo::kLong64:
+         case TVirtualStreamerInfo::kULong64:
+         case TVirtualStreamerInfo::kDouble: return 8;
+         default: return 0;
+      }
+   }
    struct R__PushCache {
       TBufferFile &fBuffer;
       TVirtualArray *fOnfileObject;
@@ -2797,6 +2820,144 @@ Int_t TBranchElement::GetEntry(Long64_t entry, Int_t getall)
    return nbytes;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the size of one value of the collection stored in this branch if
+/// GetBulkCollectionEntries() can read it, 0 otherwise.
+///
+/// Two layouts are supported: a top level, non split std::vector of a basic
+/// type (each entry is the vector header followed by the values) and a basic
+/// type data member of a split STL collection of objects (each entry is the
+/// sequence of the values of the member).
+
+Int_t TBranchElement::GetBulkCollectionValueSize() const
+{
+   if (fType == 0 && fID < 0) {
+      TClass *cl = fBranchClass.GetClass();
+      TVirtualCollectionProxy *proxy = cl ? cl->GetCollectionProxy() : nullptr;
+      if (!proxy || proxy->GetCollectionType() != ROOT::kSTLvector || proxy->GetValueClass() ||
+          proxy->HasPointers() || proxy->GetType() == kBool_t)
+         return 0;
+      return GetBulkValueSize(proxy->GetType());
+   }
+   if (fType == kSTLMemberNode && fID >= 0) {
+      TStreamerInfo *info = GetInfoImp();
+      TStreamerElement *element = info ? info->GetElement(fID) : nullptr;
+      if (!element || element->IsA() != TStreamerBasicType::Class() || element->GetArrayLength() > 0 ||
+          element->GetType() != element->GetNewType())
+         return 0;
+      return GetBulkValueSize(element->GetType());
+   }
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// \brief Read the collections of all the entries of a basket, starting at the
+/// given entry, into contiguous memory.
+///
+/// \return The number of entries read, i.e. from entry to the last entry of
+///         its basket. -1 if the branch does not support bulk collection reads
+///         (see SupportsBulkCollectionRead()) or if the basket content cannot
+///         be read in bulk.
+///
+/// On success, the values of all the collections are stored one after the
+/// other, in host byte order, at the beginning of the buffer of `values`:
+///
+/// ~~~{.cpp}
+/// T *data = reinterpret_cast<T *>(values.Buffer());
+/// ~~~
+///
+/// and the collection of entry `entry + i` consists of the values
+/// `data[offsets[i]]` to `data[offsets[i + 1] - 1]`. `offsets` is resized to
+/// the number of entries read plus one.
+///
+/// \note This interface is meant to be wrapped by higher level interfaces such
+///       as TTreeReaderArray.
+
+Int_t TBranchElement::GetBulkCollectionEntries(Long64_t entry, TBuffer &values, std::vector<Int_t> &offsets)
+{
+   const Int_t valueSize = GetBulkCollectionValueSize();
+   if (R__unlikely(valueSize == 0 || TestBit(kDoNotProcess)))
+      return -1;
+   const bool hasHeader = (fID < 0);
+
+   // Remember which entry we are reading.
+   fReadEntry = entry;
+
+   TBasket *basket = nullptr;
+   Long64_t first;
+   if (R__unlikely(GetBasketAndFirst(basket, first, nullptr) < 0))
+      return -1;
+   basket->PrepareBasket(entry);
+   TBuffer *buf = basket->GetBufferRef();
+   Int_t *entryOffset = basket->GetEntryOffset();
+   if (R__unlikely(!buf || !entryOffset || basket->GetDisplacement()))
+      return -1;
+
+   const Int_t firstInBasket = entry - first;
+   const Int_t nEntries = basket->GetNevBuf() - firstInBasket;
+   if (R__unlikely(nEntries <= 0))
+      return -1;
+   // The last entry ends with the data of the basket; a basket that is still being filled is in write mode.
+   const Int_t basketEnd = buf->IsReading() ? basket->GetLast() : buf->Length();
+
+   // First pass: find the number of values of each entry and validate the layout.
+   offsets.resize(nEntries + 1);
+   offsets[0] = 0;
+   for (Int_t i = 0; i < nEntries; ++i) {
+      const Int_t begin = entryOffset[firstInBasket + i];
+      const Int_t end = (i == nEntries - 1) ? basketEnd : entryOffset[firstInBasket + i + 1];
+      Int_t nBytes = end - begin;
+      if (R__unlikely(nBytes < 0 || end > buf->BufferSize()))
+         return -1;
+      if (hasHeader) {
+         // byte count, version and number of values of the vector streamer
+         constexpr Int_t kHeaderSize = sizeof(UInt_t) + sizeof(Version_t) + sizeof(Int_t);
+         if (R__unlikely(nBytes < kHeaderSize))
+            return -1;
+         char *header = buf->Buffer() + begin;
+         UInt_t byteCount;
+         Version_t version;
+         Int_t nValues;
+         frombuf(header, &byteCount);
+         frombuf(header, &version);
+         frombuf(header, &nValues);
+         if (R__unlikely(!(byteCount & 0x40000000) || (version & TBufferFile::kStreamedMemberWise) ||
+                         (byteCount & ~0x40000000) + sizeof(UInt_t) != static_cast<UInt_t>(nBytes)))
+            return -1;
+         nBytes -= kHeaderSize;
+         if (R__unlikely(nValues < 0 || static_cast<Long64_t>(nValues) * valueSize != nBytes))
+            return -1;
+      } else if (R__unlikely(nBytes % valueSize != 0)) {
+         return -1;
+      }
+      offsets[i + 1] = offsets[i] + nBytes / valueSize;
+   }
+
+   // Second pass: copy the values.
+   const Int_t nValues = offsets[nEntries];
+   if (values.BufferSize() < nValues * valueSize)
+      values.Expand(nValues * valueSize, kFALSE);
+   values.SetBufferOffset(0);
+   char *dest = values.Buffer();
+   for (Int_t i = 0; i < nEntries; ++i) {
+      const Int_t n = (offsets[i + 1] - offsets[i]) * valueSize;
+      if (n == 0)
+         continue;
+      const Int_t end = (i == nEntries - 1) ? basketEnd : entryOffset[firstInBasket + i + 1];
+      memcpy(dest, buf->Buffer() + end - n, n);
+      dest += n;
+   }
+#ifdef R__BYTESWAP
+   if (valueSize > 1) {
+      char *value = values.Buffer();
+      for (Int_t i = 0; i < nValues; ++i, value += valueSize)
+         std::reverse(value, value + valueSize);
+   }
+#endif
+
+   return nEntries;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill expectedClass and expectedType with information on the data type of the
 /// object/values contained in this branch (and thus the type of pointers
@@ -18,8 +18,17 @@
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+
 /** \class ROOT::Internal::TBranchIMTHelper
  A helper class for managing IMT work during TTree:Fill operations.
+
+ A write-behind helper (see TTree::SetWriteBehind()) outlives TTree::Fill(): its tasks are only waited for when
+ they are collected. The bookkeeping of a task, which must not race with the filling of the branches, then runs
+ on the collecting thread.
 */
 
 namespace ROOT {
@@ -31,7 +40,23 @@ class TBranchIMTHelper {
 using TaskGroup_t = ROOT::Experimental::TTaskGroup;
 #endif
 
+   struct RPendingWrite {
+      std::function<void(Int_t)> fDone; ///< Called with the result of the task when it is collected
+      Long64_t fSize;                   ///< Memory held until the task is collected
+      Int_t fResult{0};                 ///< Result of the task
+      std::atomic<bool> fFinished{false};
+
+      RPendingWrite(const std::function<void(Int_t)> &done, Long64_t size) : fDone(done), fSize(size) {}
+   };
+
 public:
+   TBranchIMTHelper() = default;
+   /// Create a write-behind helper that keeps at most maxPendingBytes of memory in tasks that were not collected
+   explicit TBranchIMTHelper(Long64_t maxPendingBytes) : fMaxPendingBytes(maxPendingBytes) {}
+
+   bool IsWriteBehind() const { return fMaxPendingBytes > 0; }
+   Long64_t GetMaxPendingBytes() const { return fMaxPendingBytes; }
+
    template<typename FN> void Run(const FN &lambda) {
 #ifdef R__USE_IMT
       if (!fGroup) { fGroup.reset(new TaskGroup_t()); }
@@ -48,6 +73,35 @@ public:
 #endif
    }
 
+   /// Run the lambda, which holds size bytes of memory, in a task of a write-behind helper. The result of the
+   /// lambda is passed to done when the task is collected. Collects the finished tasks first, and waits for all
+   /// of them if the memory of the pending tasks would exceed the maximum otherwise.
+   template <typename FN> void RunBehind(Long64_t size, const FN &lambda, const std::function<void(Int_t)> &done) {
+#ifdef R__USE_IMT
+      CollectFinished();
+      if (!fPending.empty() && fPendingBytes + size > fMaxPendingBytes)
+         Collect();
+      if (!fGroup) { fGroup.reset(new TaskGroup_t()); }
+      // References to the elements of a deque stay valid when elements are added at its end
+      auto &pending = fPending.emplace_back(done, size);
+      fPendingBytes += size;
+      fGroup->Run([&pending, lambda]() {
+         pending.fResult = lambda();
+         pending.fFinished = true;
+      });
+#else
+      (void)size;
+      done(lambda());
+#endif
+   }
+
+   /// Wait for all the tasks of a write-behind helper and run their bookkeeping
+   void Collect() {
+      if (fPending.empty()) return;
+      Wait();
+      CollectFinished();
+   }
+
    void Wait() {
 #ifdef R__USE_IMT
       if (fGroup) fGroup->Wait();
@@ -58,8 +112,26 @@ public:
    Long64_t GetNerrors() {  return fNerrors; }
 
 private:
+   /// Run the bookkeeping of the tasks at the front of the queue that finished, in the order of submission
+   void CollectFinished() {
+      while (!fPending.empty() && fPending.front().fFinished) {
+         auto &pending = fPending.front();
+         pending.fDone(pending.fResult);
+         if (pending.fResult >= 0) {
+            fBytes += pending.fResult;
+         } else {
+            ++fNerrors;
+         }
+         fPendingBytes -= pending.fSize;
+         fPending.pop_front();
+      }
+   }
+
    std::atomic<Long64_t> fBytes{0};   ///< Total number of bytes written by this helper.
    std::atomic<Int_t>    fNerrors{0}; ///< Total error count of all tasks done by this helper.
+   Long64_t fMaxPendingBytes{0};      ///< Memory limit of the pending write-behind tasks, 0 for a regular helper
+   Long64_t fPendingBytes{0};         ///< Memory held by the pending write-behind tasks
+   std::deque<RPendingWrite> fPending; ///< Write-behind tasks that were not collected, in the order of submission
 #ifdef R__USE_IMT
    std::unique_ptr<TaskGroup_t> fGroup;
 #endif
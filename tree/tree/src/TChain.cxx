@@ -29,7 +29,13 @@ the trees in the chain.
 
 #include <iostream>
 #include <cfloat>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "TBranch.h"
 #include "TBrowser.h"
@@ -61,9 +67,14 @@ the trees in the chain.
 #include "TFilePrefetch.h"
 #include "TVirtualMutex.h"
 #include "TVirtualPerfStats.h"
+#include "ROOT/TSeq.hxx"
 #include "strlcpy.h"
 #include "snprintf.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 ClassImp(TChain);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2202,6 +2213,157 @@ void TChain::ParseTreeFilename(const char *name, TString &filename, TString &tre
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the number of entries and the cluster boundaries of the trees of the chain
+/// without loading them, so that e.g. GetEntries() does not open the files one after
+/// the other.
+///
+/// With implicit multi-threading enabled, the files are opened concurrently by the
+/// threads of the ROOT thread pool, which bounds the number of files open at the same
+/// time; each file is closed as soon as the header of its tree is read.
+///
+/// \param[in] catalog If not empty, the name of a text file caching the metadata: the
+///            trees found in it are not opened, and it is rewritten with the metadata
+///            of all the trees of the chain. The catalog is not checked against the
+///            files, it must be removed when they change.
+/// \return The total number of entries, or -1 if some trees could not be read, in which
+///         case their number of entries stays unknown.
+///
+/// TTreeProcessorMT, and thus RDataFrame with implicit multi-threading, use the cluster
+/// boundaries read by this function instead of opening all the files to create their tasks:
+/// ~~~ {.cpp}
+///     TChain chain("events");
+///     chain.Add("root://server//data/run*.root");
+///     chain.PrefetchMetadata("run_catalog.txt");
+///     ROOT::RDataFrame df(chain);
+/// ~~~
+
+Long64_t TChain::PrefetchMetadata(const char *catalog)
+{
+   struct TreeMetadata {
+      Bool_t fRead = kFALSE;
+      Long64_t fEntries = 0;
+      std::vector<Long64_t> fClusterBoundaries;
+   };
+   auto makeKey = [](const TChainElement &element) {
+      return std::string(element.GetTitle()) + '\t' + element.GetName();
+   };
+
+   std::vector<TChainElement *> elements;
+   for (auto element : TRangeDynCast<TChainElement>(fFiles))
+      elements.push_back(element);
+
+   std::unordered_map<std::string, TreeMetadata> cached;
+   const Bool_t useCatalog = catalog && catalog[0];
+   if (useCatalog) {
+      // One line per tree: file name, tree name, number of entries and cluster boundaries, separated by tabs.
+      std::ifstream in(catalog);
+      std::string line;
+      while (std::getline(in, line)) {
+         const auto tab1 = line.find('\t');
+         const auto tab2 = tab1 == std::string::npos ? tab1 : line.find('\t', tab1 + 1);
+         const auto tab3 = tab2 == std::string::npos ? tab2 : line.find('\t', tab2 + 1);
+         if (tab3 == std::string::npos)
+            continue;
+         TreeMetadata metadata;
+         metadata.fRead = kTRUE;
+         metadata.fEntries = std::strtoll(line.c_str() + tab2 + 1, nullptr, 10);
+         std::istringstream boundaries(line.substr(tab3 + 1));
+         std::string boundary;
+         while (std::getline(boundaries, boundary, ','))
+            metadata.fClusterBoundaries.push_back(std::strtoll(boundary.c_str(), nullptr, 10));
+         if (metadata.fClusterBoundaries.empty() || metadata.fClusterBoundaries.back() != metadata.fEntries)
+            continue;
+         cached[line.substr(0, tab2)] = std::move(metadata);
+      }
+   }
+
+   std::vector<std::size_t> toRead;
+   for (std::size_t i = 0; i < elements.size(); ++i) {
+      auto element = elements[i];
+      auto cachedMetadata = cached.find(makeKey(*element));
+      if (cachedMetadata != cached.end()) {
+         element->SetNumberEntries(cachedMetadata->second.fEntries);
+         element->SetClusterBoundaries(std::move(cachedMetadata->second.fClusterBoundaries));
+      } else if (element->GetClusterBoundaries().empty()) {
+         toRead.push_back(i);
+      }
+   }
+
+   std::vector<TreeMetadata> read(toRead.size());
+   auto readMetadata = [&](std::size_t idx) {
+      TChainElement *element = elements[toRead[idx]];
+      TDirectory::TContext ctxt;
+      std::unique_ptr<TFile> file(TFile::Open(element->GetTitle(), "READ_WITHOUT_GLOBALREGISTRATION"));
+      if (!file || file->IsZombie())
+         return;
+      auto tree = file->Get<TTree>(element->GetName());
+      if (!tree)
+         return;
+      // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
+      tree->ResetBit(kMustCleanup);
+      ROOT::Internal::TreeUtils::ClearMustCleanupBits(*tree->GetListOfBranches());
+      TreeMetadata &metadata = read[idx];
+      metadata.fEntries = tree->GetEntries();
+      auto clusterIter = tree->GetClusterIterator(0);
+      Long64_t clusterStart;
+      while ((clusterStart = clusterIter()) < metadata.fEntries)
+         metadata.fClusterBoundaries.push_back(clusterStart);
+      metadata.fClusterBoundaries.push_back(metadata.fEntries);
+      metadata.fRead = kTRUE;
+   };
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && toRead.size() > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(readMetadata, ROOT::TSeqU(toRead.size()));
+   } else
+#endif
+   {
+      for (std::size_t idx = 0; idx < toRead.size(); ++idx)
+         readMetadata(idx);
+   }
+
+   Bool_t allRead = kTRUE;
+   for (std::size_t idx = 0; idx < toRead.size(); ++idx) {
+      TChainElement *element = elements[toRead[idx]];
+      if (!read[idx].fRead) {
+         Error("PrefetchMetadata", "Cannot read the tree %s from the file %s", element->GetName(), element->GetTitle());
+         allRead = kFALSE;
+         continue;
+      }
+      element->SetNumberEntries(read[idx].fEntries);
+      element->SetClusterBoundaries(std::move(read[idx].fClusterBoundaries));
+   }
+
+   // Update the offsets of the trees as LoadTree() would do when loading them.
+   for (Int_t i = 0; i < fNtrees && i < (Int_t)elements.size(); ++i) {
+      const Long64_t entries = elements[i]->GetEntries();
+      if (fTreeOffset[i] == TTree::kMaxEntries || entries == TTree::kMaxEntries)
+         fTreeOffset[i + 1] = TTree::kMaxEntries;
+      else
+         fTreeOffset[i + 1] = fTreeOffset[i] + entries;
+   }
+   if (fTreeOffset[fNtrees] != TTree::kMaxEntries)
+      fEntries = fTreeOffset[fNtrees];
+
+   if (useCatalog) {
+      std::ofstream out(catalog);
+      for (auto element : elements) {
+         const auto &boundaries = element->GetClusterBoundaries();
+         if (boundaries.empty())
+            continue;
+         out << makeKey(*element) << '\t' << element->GetEntries() << '\t';
+         for (std::size_t i = 0; i < boundaries.size(); ++i)
+            out << (i ? "," : "") << boundaries[i];
+         out << '\n';
+      }
+      if (!out)
+         Error("PrefetchMetadata", "Cannot write the catalog %s", catalog);
+   }
+
+   return allRead ? fEntries : -1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Print the header information of each tree in the chain.
 /// See TTree::Print for a list of options.
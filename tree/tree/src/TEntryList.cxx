@@ -55,6 +55,14 @@ End_Macro
 - __Subtract__() - if the lists are for the same TTree, removes the entries of the second
                list from the first list. If the lists are for TChains, loops over all
                sub-lists
+- __Intersect__() - if the lists are for the same TTree, keeps only the entries of the first
+               list that are also in the second list. If the lists are for TChains, loops
+               over all sub-lists
+- __GetNEntriesBefore(n)__ - returns the number of entries lower than n, e.g. to find the
+               entries of the list in a range of entries without iterating over them
+
+The set operations are done block by block on the bits of the TEntryListBlock objects,
+and the sub-lists of TChain lists are matched by tree and file name with a hash table.
 - __GetEntry(n)__ - returns the n-th entry number
 - __Next__()      - returns next entry number. Note, that this function is
                 much faster than GetEntry, and it's called when GetEntry() is called
@@ -155,8 +163,35 @@ See comments to those functions for more details
 #include "TSystem.h"
 #include "TObjString.h"
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 ClassImp(TEntryList);
 
+namespace {
+
+using SubListMap_t = std::unordered_map<std::string, TEntryList *>;
+
+std::string GetSubListKey(const TEntryList *elist)
+{
+   return std::string(elist->GetTreeName()) + '\n' + elist->GetFileName();
+}
+
+/// Index the sub-lists by tree and file name. If several sub-lists are for the
+/// same tree, the first one is used, like the linear searches of TEntryList do.
+SubListMap_t MakeSubListMap(TList *lists)
+{
+   SubListMap_t sublists;
+   TIter next(lists);
+   TEntryList *el = nullptr;
+   while ((el = (TEntryList *)next()))
+      sublists.emplace(GetSubListKey(el), el);
+   return sublists;
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// default c-tor
 
@@ -470,11 +505,7 @@ void TEntryList::Add(const TEntryList *elist)
          }
       } else {
          //second list already has sublists. add one by one
-         TEntryList *el = 0;
-         TIter next(elist->fLists);
-         while ((el = (TEntryList*)next())){
-            Add(el);
-         }
+         AddSubListsOf(elist);
          fCurrent = 0;
       }
    } else {
@@ -505,11 +536,7 @@ void TEntryList::Add(const TEntryList *elist)
          }
       } else {
          //add all sublists from the other list
-         TEntryList *el = 0;
-         TIter next(elist->fLists);
-         while ((el = (TEntryList*)next())){
-            Add(el);
-         }
+         AddSubListsOf(elist);
          fCurrent = 0;
       }
       if (fCurrent){
@@ -526,6 +553,40 @@ void TEntryList::Add(const TEntryList *elist)
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Add the sub-lists of elist one by one. Once this list has sub-lists, they
+/// are looked up by tree and file name in a hash table rather than with a
+/// linear search for each sub-list of elist.
+
+void TEntryList::AddSubListsOf(const TEntryList *elist)
+{
+   SubListMap_t sublists;
+   TEntryList *el = 0;
+   TIter next(elist->fLists);
+   while ((el = (TEntryList*)next())){
+      if (!fLists) {
+         Add(el);
+         continue;
+      }
+      if (sublists.empty())
+         sublists = MakeSubListMap(fLists);
+      const std::string key = GetSubListKey(el);
+      auto it = sublists.find(key);
+      if (it != sublists.end()) {
+         Long64_t oldn = it->second->GetN();
+         it->second->Add(el);
+         fN = fN - oldn + it->second->GetN();
+      } else {
+         TEntryList *copy = new TEntryList(*el);
+         copy->fLastIndexQueried = -1;
+         copy->fLastIndexReturned = 0;
+         fLists->Add(copy);
+         fN += copy->GetN();
+         sublists.emplace(key, copy);
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \brief Add a sub entry list to the current list.
 /// \param[in] elist an entry list that should be added as a sub list of this list.
@@ -824,6 +885,28 @@ Long64_t TEntryList::GetEntry(Long64_t index)
    return -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of entries of this list that are lower than entry, i.e.
+/// the index of entry in this list if the list contains it. The entries are
+/// counted block by block, without iterating over them.
+/// Only available for lists without sub-lists, returns -1 otherwise.
+
+Long64_t TEntryList::GetNEntriesBefore(Long64_t entry)
+{
+   if (fLists) {
+      Error("GetNEntriesBefore", "Not available for entry lists with sub-lists");
+      return -1;
+   }
+   if (!fBlocks || entry <= 0) return 0;
+   Long64_t nblock = entry/kBlockSize;
+   Long64_t n = 0;
+   for (Int_t i=0; i<fNBlocks && i<nblock; i++)
+      n += ((TEntryListBlock*)fBlocks->UncheckedAt(i))->GetNPassed();
+   if (nblock < fNBlocks)
+      n += ((TEntryListBlock*)fBlocks->UncheckedAt(nblock))->GetNPassedBefore(entry - nblock*kBlockSize);
+   return n;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the index of "index"-th non-zero entry in the TTree or TChain
 /// and the # of the corresponding tree in the chain
@@ -1336,6 +1419,21 @@ void TEntryList::Subtract(const TEntryList *elist)
          if (!strcmp(elist->fTreeName.Data(),fTreeName.Data()) &&
              !strcmp(elist->fFileName.Data(),fFileName.Data())){
             //same tree
+            if (IsA() == TEntryList::Class()) {
+               //subtract block by block
+               if (!elist->fBlocks) return;
+               Int_t nmin = TMath::Min(fNBlocks, elist->fNBlocks);
+               for (Int_t i=0; i<nmin; i++){
+                  TEntryListBlock *block1 = (TEntryListBlock*)fBlocks->UncheckedAt(i);
+                  TEntryListBlock *block2 = (TEntryListBlock*)elist->fBlocks->UncheckedAt(i);
+                  Long64_t nold = block1->GetNPassed();
+                  fN = fN - nold + block1->Subtract(block2);
+               }
+               fLastIndexQueried = -1;
+               fLastIndexReturned = 0;
+               return;
+            }
+            //derived classes may keep more information per entry, remove one by one
             Long64_t n2 = elist->GetN();
             Long64_t entry;
             for (Int_t i=0; i<n2; i++){
@@ -1364,18 +1462,96 @@ void TEntryList::Subtract(const TEntryList *elist)
       }
    } else {
       //this list has sublists
+      SubListMap_t sublists;
+      if (elist->fLists)
+         sublists = MakeSubListMap(elist->fLists);
       TIter next2(fLists);
       templist = 0;
       Long64_t oldn=0;
       while ((templist = (TEntryList*)next2())){
          oldn = templist->GetN();
-         templist->Subtract(elist);
+         if (elist->fLists && !templist->fLists) {
+            auto it = sublists.find(GetSubListKey(templist));
+            if (it != sublists.end())
+               templist->Subtract(it->second);
+         } else {
+            templist->Subtract(elist);
+         }
          fN = fN - oldn + templist->GetN();
       }
    }
    return;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all the entries of this entry list, that are not contained in elist
+
+void TEntryList::Intersect(const TEntryList *elist)
+{
+   if (!fLists){
+      if (!fBlocks) return;
+      //find the list for the same tree as this list, if any
+      const TEntryList *other = 0;
+      if (!elist->fLists){
+         if (!strcmp(elist->fTreeName.Data(),fTreeName.Data()) &&
+             !strcmp(elist->fFileName.Data(),fFileName.Data()))
+            other = elist;
+      } else {
+         TIter next1(elist->GetLists());
+         TEntryList *templist = 0;
+         while ((templist = (TEntryList*)next1())){
+            if (!strcmp(templist->fTreeName.Data(),fTreeName.Data()) &&
+                !strcmp(templist->fFileName.Data(),fFileName.Data())){
+               other = templist;
+               break;
+            }
+         }
+      }
+      if (IsA() != TEntryList::Class()) {
+         //derived classes may keep more information per entry, remove one by one
+         std::vector<Long64_t> toremove;
+         for (Long64_t i=0; i<fN; i++){
+            Long64_t entry = GetEntry(i);
+            if (!other || !(const_cast<TEntryList*>(other))->Contains(entry))
+               toremove.push_back(entry);
+         }
+         for (auto entry : toremove)
+            Remove(entry);
+         return;
+      }
+      //intersect block by block, the blocks missing in the other list are empty
+      TEntryListBlock empty;
+      for (Int_t i=0; i<fNBlocks; i++){
+         TEntryListBlock *block1 = (TEntryListBlock*)fBlocks->UncheckedAt(i);
+         TEntryListBlock *block2 = &empty;
+         if (other && other->fBlocks && i < other->fNBlocks)
+            block2 = (TEntryListBlock*)other->fBlocks->UncheckedAt(i);
+         Long64_t nold = block1->GetNPassed();
+         fN = fN - nold + block1->Intersect(block2);
+      }
+      fLastIndexQueried = -1;
+      fLastIndexReturned = 0;
+   } else {
+      //this list has sublists
+      SubListMap_t sublists;
+      if (elist->fLists)
+         sublists = MakeSubListMap(elist->fLists);
+      TEntryList none;
+      TIter next2(fLists);
+      TEntryList *templist = 0;
+      while ((templist = (TEntryList*)next2())){
+         Long64_t oldn = templist->GetN();
+         if (elist->fLists && !templist->fLists) {
+            auto it = sublists.find(GetSubListKey(templist));
+            templist->Intersect(it != sublists.end() ? it->second : &none);
+         } else {
+            templist->Intersect(elist);
+         }
+         fN = fN - oldn + templist->GetN();
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 TEntryList operator||(TEntryList &elist1, TEntryList &elist2)
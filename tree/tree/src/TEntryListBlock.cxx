@@ -35,9 +35,15 @@ End_Macro
 
 ## Operations on blocks (see also function comments)
 
- - __Merge__() - adds all entries from one block to the other. If the first block
-             uses array representation, it's changed to bits representation only
-             if the total number of passing entries is still less than kBlockSize
+ - __Merge__() - adds all entries from one block to the other. If both blocks
+             store the entries that pass as an array and the total number of
+             passing entries is less than kBlockSize, the arrays are merged,
+             otherwise the union is computed on the bits representation
+ - __Intersect__(), __Subtract__() - keep only the entries that are, resp. are not,
+             in the other block. They are computed on the bits representation,
+             16 entries at a time
+ - __GetNPassedBefore(n)__ - returns the number of entries lower than n, without
+             iterating over the entries
  - __GetEntry(n)__ - returns n-th non-zero entry.
  - __Next__()      - return next non-zero entry. In case of representation 1), Next()
                  is faster than GetEntry()
@@ -46,6 +52,9 @@ End_Macro
 #include "TEntryListBlock.h"
 #include "TString.h"
 
+#include <algorithm>
+#include <bitset>
+
 ClassImp(TEntryListBlock);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -242,10 +251,12 @@ Int_t TEntryListBlock::Contains(Int_t entry)
 
 Int_t TEntryListBlock::Merge(TEntryListBlock *block)
 {
-   Int_t i, j;
+   Int_t i;
    if (block->GetNPassed() == 0) return GetNPassed();
    if (GetNPassed() == 0){
       //this block is empty
+      if (fIndices)
+         delete [] fIndices;
       fN = block->fN;
       fIndices = new UShort_t[fN];
       for (i=0; i<fN; i++)
@@ -258,104 +269,44 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
       fLastIndexQueried = -1;
       return fNPassed;
    }
-   if (fType==0){
-      //stored as bits
-      if (block->fType == 0){
-         for (i=0; i<kBlockSize*16; i++){
-            if (block->Contains(i))
-               Enter(i);
-         }
-      } else {
-         if (block->fPassing){
-            //the other block stores entries that pass
-            for (i=0; i<block->fNPassed; i++){
-               Enter(block->fIndices[i]);
-            }
-         } else {
-            //the other block stores entries that don't pass
-            if (block->fNPassed==0){
-               for (i=0; i<kBlockSize*16; i++){
-                  Enter(i);
-               }
-            }
-            for (j=0; j<block->fIndices[0]; j++)
-               Enter(j);
-            for (i=0; i<block->fNPassed-1; i++){
-               for (j=block->fIndices[i]+1; j<block->fIndices[i+1]; j++){
-                  Enter(j);
-               }
-            }
-            for (j=block->fIndices[block->fNPassed-1]+1; j<kBlockSize*16; j++)
-               Enter(j);
-         }
-      }
+   if (fType==0 || block->fType==0 || GetNPassed() + block->GetNPassed() > kBlockSize){
+      //union of the bits
+      UShort_t *bits = new UShort_t[kBlockSize];
+      UShort_t *otherbits = new UShort_t[kBlockSize];
+      FillBits(bits);
+      block->FillBits(otherbits);
+      for (i=0; i<kBlockSize; i++)
+         bits[i] |= otherbits[i];
+      delete [] otherbits;
+      SetBits(bits);
    } else {
-      //stored as a list
-      if (GetNPassed() + block->GetNPassed() > kBlockSize){
-         //change to bits
-         UShort_t *bits = new UShort_t[kBlockSize];
-         Transform(1, bits);
-         Merge(block);
-      } else {
-         //this is only possible if fPassing=1 in both blocks
-         if (block->fType==1){
-            //second block stored as a list
-            //make a bigger list
-            Int_t en = block->fNPassed;
-            Int_t newsize = fNPassed + en;
-            UShort_t *newlist = new UShort_t[newsize];
-            UShort_t *elst = block->fIndices;
-            Int_t newpos, elpos;
-            newpos = elpos = 0;
-            for (i=0; i<fNPassed; i++) {
-               while (elpos < en && fIndices[i] > elst[elpos]) {
-                  newlist[newpos] = elst[elpos];
-                  newpos++;
-                  elpos++;
-               }
-               if (fIndices[i] == elst[elpos]) elpos++;
-               newlist[newpos] = fIndices[i];
-               newpos++;
-            }
-            while (elpos < en) {
-               newlist[newpos] = elst[elpos];
-               newpos++;
-               elpos++;
-            }
-            delete [] fIndices;
-            fIndices = newlist;
-            fNPassed = newpos;
-            fN = fNPassed;
-         } else {
-            //second block is stored as bits
-
-            Int_t en = block->fNPassed;
-            Int_t newsize = fNPassed + en;
-            UShort_t *newlist = new UShort_t[newsize];
-            Int_t newpos, current;
-            newpos = current = 0;
-            for (i=0; i<kBlockSize*16; i++){
-               if (!block->Contains(i)) continue;
-               while(current < fNPassed && fIndices[current]<i){
-                  newlist[newpos] = fIndices[current];
-                  current++;
-                  newpos++;
-               }
-               if (fIndices[current]==i) current++;
-               newlist[newpos] = i;
-               newpos++;
-            }
-            while(current<fNPassed){
-               newlist[newpos] = fIndices[current];
-               newpos++;
-               current++;
-            }
-            delete [] fIndices;
-            fIndices = newlist;
-            fNPassed = newpos;
-            fN = fNPassed;
+      //both blocks store the entries that pass as a list
+      //make a bigger list
+      Int_t en = block->fNPassed;
+      Int_t newsize = fNPassed + en;
+      UShort_t *newlist = new UShort_t[newsize];
+      UShort_t *elst = block->fIndices;
+      Int_t newpos, elpos;
+      newpos = elpos = 0;
+      for (i=0; i<fNPassed; i++) {
+         while (elpos < en && fIndices[i] > elst[elpos]) {
+            newlist[newpos] = elst[elpos];
+            newpos++;
+            elpos++;
          }
+         if (elpos < en && fIndices[i] == elst[elpos]) elpos++;
+         newlist[newpos] = fIndices[i];
+         newpos++;
       }
+      while (elpos < en) {
+         newlist[newpos] = elst[elpos];
+         newpos++;
+         elpos++;
+      }
+      delete [] fIndices;
+      fIndices = newlist;
+      fNPassed = newpos;
+      fN = fNPassed;
    }
    fLastIndexQueried = -1;
    fLastIndexReturned = -1;
@@ -363,6 +314,44 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
    return GetNPassed();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Keep only the entries that are also in the other block
+/// Returns the resulting number of entries in the block
+
+Int_t TEntryListBlock::Intersect(TEntryListBlock *block)
+{
+   if (GetNPassed() == 0) return 0;
+   UShort_t *bits = new UShort_t[kBlockSize];
+   UShort_t *otherbits = new UShort_t[kBlockSize];
+   FillBits(bits);
+   block->FillBits(otherbits);
+   for (Int_t i=0; i<kBlockSize; i++)
+      bits[i] &= otherbits[i];
+   delete [] otherbits;
+   SetBits(bits);
+   OptimizeStorage();
+   return GetNPassed();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the entries that are in the other block
+/// Returns the resulting number of entries in the block
+
+Int_t TEntryListBlock::Subtract(TEntryListBlock *block)
+{
+   if (GetNPassed() == 0 || block->GetNPassed() == 0) return GetNPassed();
+   UShort_t *bits = new UShort_t[kBlockSize];
+   UShort_t *otherbits = new UShort_t[kBlockSize];
+   FillBits(bits);
+   block->FillBits(otherbits);
+   for (Int_t i=0; i<kBlockSize; i++)
+      bits[i] &= ~otherbits[i];
+   delete [] otherbits;
+   SetBits(bits);
+   OptimizeStorage();
+   return GetNPassed();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the number of entries, passing the selection.
 /// In case, when the block stores entries that pass (fPassing=1) returns fNPassed
@@ -375,6 +364,30 @@ Int_t TEntryListBlock::GetNPassed()
       return kBlockSize*16-fNPassed;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the number of entries passing the selection that are lower than
+/// entry, i.e. the index of entry in the block if it passes.
+
+Int_t TEntryListBlock::GetNPassedBefore(Int_t entry)
+{
+   if (entry <= 0) return 0;
+   if (entry >= kBlockSize*16) return GetNPassed();
+   if (!fIndices)
+      return fPassing ? 0 : entry;
+   if (fType==0){
+      //bits
+      Int_t n = 0;
+      Int_t nwords = entry>>4;
+      for (Int_t i=0; i<nwords; i++)
+         n += std::bitset<16>(fIndices[i]).count();
+      n += std::bitset<16>(fIndices[nwords] & ((1<<(entry & 15))-1)).count();
+      return n;
+   }
+   //list
+   Int_t nbelow = std::lower_bound(fIndices, fIndices + fNPassed, entry) - fIndices;
+   return fPassing ? nbelow : entry - nbelow;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return entry \#entry.
 /// See also Next()
@@ -556,6 +569,47 @@ void TEntryListBlock::OptimizeStorage()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the kBlockSize words of bits with the bits representation of the
+/// entries of this block, whatever its current representation
+
+void TEntryListBlock::FillBits(UShort_t *bits) const
+{
+   Int_t i;
+   if (fType==0){
+      for (i=0; i<kBlockSize; i++)
+         bits[i] = fIndices[i];
+      return;
+   }
+   //list, or empty block if fIndices is 0
+   UShort_t fill = fPassing ? 0 : 0xFFFF;
+   for (i=0; i<kBlockSize; i++)
+      bits[i] = fill;
+   if (!fIndices) return;
+   for (i=0; i<fNPassed; i++)
+      bits[fIndices[i]>>4] ^= 1<<(fIndices[i] & 15);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Replace the entries of this block by the bits representation in bits,
+/// which is adopted by the block
+
+void TEntryListBlock::SetBits(UShort_t *bits)
+{
+   if (fIndices)
+      delete [] fIndices;
+   fIndices = bits;
+   fType = 0;
+   fN = kBlockSize;
+   fPassing = 1;
+   fNPassed = 0;
+   for (Int_t i=0; i<kBlockSize; i++)
+      fNPassed += std::bitset<16>(bits[i]).count();
+   fCurrent = 0;
+   fLastIndexQueried = -1;
+   fLastIndexReturned = -1;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Transform the existing fIndices
 /// - dir=0 - transform from bits to a list
@@ -920,6 +920,10 @@ TTree::TTree(const char* name, const char* title, Int_t splitlevel /* = 99 */,
 
 TTree::~TTree()
 {
+   CollectWriteBehind();
+   delete fWriteBehind;
+   fWriteBehind = nullptr;
+
    if (auto link = dynamic_cast<TNotifyLinkBase*>(fNotify)) {
       link->Clear();
    }
@@ -1510,6 +1514,8 @@ Long64_t TTree::AutoSave(Option_t* option)
    if (opt.Contains("flushbaskets")) {
       if (gDebug > 0) Info("AutoSave", "calling FlushBaskets \n");
       FlushBasketsImpl();
+   } else {
+      CollectWriteBehind();
    }
 
    fSavedBytes = GetZipBytes();
@@ -3096,6 +3102,12 @@ Int_t TTree::CheckBranchAddressType(TBranch* branch, TClass* ptrClass, EDataType
 /// When 'fast' is specified, 'option' can also contain a sorting
 /// order for the baskets in the output file.
 ///
+/// When 'fast' is specified and 'option' contains the word 'recompress',
+/// the baskets whose compression settings differ from the ones of the
+/// output file are decompressed and compressed again with the settings of
+/// the output file, without being unstreamed. With implicit multi-threading
+/// enabled, the baskets are recompressed in parallel.
+///
 /// There are currently 3 supported sorting order:
 ///
 /// - SortBasketsByOffset (the default)
@@ -3510,6 +3522,10 @@ namespace {
 /// When 'fast' is specified, 'option' can also contains a sorting order for the
 /// baskets in the output file.
 ///
+/// When 'fast' is specified, 'option' can also contain the word 'recompress' to
+/// recompress the baskets with the compression settings of the output file, see
+/// TTree::CloneTree.
+///
 /// There are currently 3 supported sorting order:
 ///
 /// - SortBasketsByOffset (the default)
@@ -3531,9 +3547,26 @@ namespace {
 
 Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t* option /* = "" */, Bool_t needCopyAddresses /* = false */)
 {
+   return CopyEntriesImpl(tree, nentries, option, needCopyAddresses, nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Implementation of CopyEntries(). If report is not null, the reasons why the fast
+/// cloning was not possible for some of the input trees are appended to it.
+
+Long64_t TTree::CopyEntriesImpl(TTree *tree, Long64_t nentries, Option_t *option, Bool_t needCopyAddresses, TString *report)
+{
+   auto inputName = [](TTree *input) {
+      TTree *localtree = input->GetTree();
+      if (localtree && localtree->GetDirectory() && localtree->GetDirectory()->GetFile())
+         return TString(localtree->GetDirectory()->GetFile()->GetName());
+      return TString::Format("tree number %d", input->GetTreeNumber());
+   };
    if (!tree) {
       return 0;
    }
+   // The fast cloning writes baskets to the file
+   CollectWriteBehind();
    // Options
    TString opt = option;
    opt.ToLower();
@@ -3602,11 +3635,17 @@ Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t*
          } else {
             if (i == 0) {
                Warning("CopyEntries","%s",cloner.GetWarning());
+               if (report)
+                  *report += TString::Format("; %s: fast cloning failed (%s)", inputName(tree).Data(),
+                                             cloner.GetWarning());
                // If the first cloning does not work, something is really wrong
                // (since apriori the source and target are exactly the same structure!)
                return -1;
             } else {
                if (cloner.NeedConversion()) {
+                  if (report)
+                     *report += TString::Format("; %s: copied entry by entry (%s)", inputName(tree).Data(),
+                                                cloner.GetWarning());
                   TTree *localtree = tree->GetTree();
                   Long64_t tentries = localtree->GetEntries();
                   if (needCopyAddresses) {
@@ -3628,6 +3667,8 @@ Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t*
                   }
                } else {
                   Warning("CopyEntries","%s",cloner.GetWarning());
+                  if (report)
+                     *report += TString::Format("; %s: skipped (%s)", inputName(tree).Data(), cloner.GetWarning());
                   if (tree->GetDirectory() && tree->GetDirectory()->GetFile()) {
                      Warning("CopyEntries", "Skipped file %s\n", tree->GetDirectory()->GetFile()->GetName());
                   } else {
@@ -4493,6 +4534,17 @@ Long64_t TTree::Draw(const char* varexp, const TCut& selection, Option_t* option
 /// You can use the option "goff" to turn off the graphics output
 /// of TTree::Draw in the above example.
 ///
+/// ### Compiling the expressions
+///
+/// The expressions are evaluated by the interpreter of TTreeFormula. After
+/// ~~~ {.cpp}
+///     TTreeFormula::SetJitting();
+/// ~~~
+/// the numerical expressions on scalar leaves, e.g. `"sqrt(px*px+py*py)"` or
+/// `"px>0 && abs(pz)<10"`, are compiled to native code by the interpreter the
+/// first time they are evaluated. The other expressions are still
+/// interpreted.
+///
 /// ### Automatic interface to TTree::Draw via the TTreeViewer
 ///
 /// A complete graphical interface to this function is implemented
@@ -4615,8 +4667,12 @@ Int_t TTree::Fill()
 
 #ifdef R__USE_IMT
    const auto useIMT = ROOT::IsImplicitMTEnabled() && fIMTEnabled;
+   // As long as the first cluster is defined by a number of bytes, the compressed size of each basket needs to be
+   // known by the end of Fill()
+   const auto useWriteBehind = useIMT && fWriteBehind && fAutoFlush >= 0 && fAutoSave >= 0;
+   const auto nerrorBehind = useWriteBehind ? fWriteBehind->GetNerrors() : 0;
    ROOT::Internal::TBranchIMTHelper imtHelper;
-   if (useIMT) {
+   if (useIMT && !useWriteBehind) {
       fIMTFlush = true;
       fIMTZipBytes.store(0);
       fIMTTotBytes.store(0);
@@ -4633,7 +4689,7 @@ Int_t TTree::Fill()
 #ifndef R__USE_IMT
       nwrite = branch->FillImpl(nullptr);
 #else
-      nwrite = branch->FillImpl(useIMT ? &imtHelper : nullptr);
+      nwrite = branch->FillImpl(useWriteBehind ? fWriteBehind : (useIMT ? &imtHelper : nullptr));
 #endif
       if (nwrite < 0) {
          if (nerror < 2) {
@@ -4665,6 +4721,8 @@ Int_t TTree::Fill()
       nbytes += imtHelper.GetNbytes();
       nerror += imtHelper.GetNerrors();
    }
+   if (useWriteBehind)
+      nerror += fWriteBehind->GetNerrors() - nerrorBehind;
 #endif
 
    if (fBranchRef)
@@ -5143,10 +5201,18 @@ Int_t TTree::FlushBaskets(Bool_t create_cluster) const
 ///
 Int_t TTree::FlushBasketsImpl() const
 {
-   if (!fDirectory) return 0;
    Int_t nbytes = 0;
    Int_t nerror = 0;
+   if (fWriteBehind) {
+      const auto nerrorBehind = fWriteBehind->GetNerrors();
+      CollectWriteBehind();
+      if (fWriteBehind->GetNerrors() != nerrorBehind)
+         ++nerror;
+   }
+
+   if (!fDirectory) return nerror ? -1 : 0;
    TObjArray *lb = const_cast<TTree*>(this)->GetListOfBranches();
+
    Int_t nb = lb->GetEntriesFast();
 
 #ifdef R__USE_IMT
@@ -5197,7 +5263,7 @@ Int_t TTree::FlushBasketsImpl() const
       const_cast<TTree*>(this)->AddTotBytes(fIMTTotBytes);
       const_cast<TTree*>(this)->AddZipBytes(fIMTZipBytes);
 
-      return nerrpar ? -1 : nbpar.load();
+      return (nerrpar || nerror) ? -1 : nbpar.load();
    }
 #endif
    for (Int_t j = 0; j < nb; j++) {
@@ -5644,6 +5710,9 @@ Int_t TTree::GetEntry(Long64_t entry, Int_t getall)
    Int_t nbytes = 0;
    fReadEntry = entry;
 
+   // The baskets written behind Fill() can only be read back once they are collected
+   CollectWriteBehind();
+
    // create cache if wanted
    if (fCacheDoAutoInit)
       SetCacheSizeAux();
@@ -6925,6 +6994,14 @@ Long64_t TTree::Merge(TCollection* li, Option_t *options)
 Long64_t TTree::Merge(TCollection* li, TFileMergeInfo *info)
 {
    const char *options = info ? info->fOptions.Data() : "";
+   if (info && info->fIsFirst) {
+      if (!info->fOptions.Contains("fast"))
+         info->fReport = "entry by entry copy";
+      else if (info->fOptions.Contains("recompress"))
+         info->fReport = "fast cloning with recompression of the baskets";
+      else
+         info->fReport = "fast cloning";
+   }
    if (info && info->fIsFirst && info->fOutputDirectory && info->fOutputDirectory->GetFile() != GetCurrentFile()) {
       if (GetCurrentFile() == nullptr) {
          // In memory TTree, all we need to do is ... write it.
@@ -6932,7 +7009,8 @@ Long64_t TTree::Merge(TCollection* li, TFileMergeInfo *info)
          FlushBasketsImpl();
          fDirectory->WriteTObject(this);
       } else if (info->fOptions.Contains("fast")) {
-         InPlaceClone(info->fOutputDirectory);
+         if (!InPlaceClone(info->fOutputDirectory, info->fOptions.Contains("recompress") ? "recompress" : ""))
+            info->fReport += TString::Format("; %s: fast cloning failed", GetCurrentFile()->GetName());
       } else {
          TDirectory::TContext ctxt(info->fOutputDirectory);
          TIOFeatures saved_features = fIOFeatures;
@@ -6967,7 +7045,7 @@ Long64_t TTree::Merge(TCollection* li, TFileMergeInfo *info)
          return -1;
       }
 
-      CopyEntries(tree, -1, options, kTRUE);
+      CopyEntriesImpl(tree, -1, options, kTRUE, info ? &info->fReport : nullptr);
    }
    fAutoSave = storeAutoSave;
    return GetEntries();
@@ -8000,6 +8078,8 @@ void TTree::RemoveFriend(TTree* oldFriend)
 
 void TTree::Reset(Option_t* option)
 {
+   CollectWriteBehind();
+
    fNotify        = 0;
    fEntries       = 0;
    fNClusterRange = 0;
@@ -9364,6 +9444,63 @@ void TTree::SetWeight(Double_t w, Option_t*)
    fWeight = w;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Write the full baskets behind Fill().
+///
+/// With implicit multi-threading enabled, Fill() compresses the baskets that
+/// are full in parallel but waits for them before returning. With write-behind,
+/// Fill() hands the full baskets over to tasks that compress and write them,
+/// and continues with new baskets: the latency of Fill() does not depend on the
+/// compression of the baskets anymore. The file writes of the tasks are
+/// serialized.
+///
+/// The baskets written by the tasks keep at most maxPendingBytes of memory: if a
+/// new basket would exceed this limit, Fill() waits for the pending tasks. The
+/// bookkeeping of the sizes and positions of the baskets is done when the tasks
+/// are collected, by FlushBaskets(), AutoSave(), Write(), Reset(), GetEntry()
+/// and the destructor. The entry ranges of the baskets and the event clusters
+/// are the same as without write-behind. Until the first cluster is flushed,
+/// Fill() waits for the baskets if the clusters are defined by a number of bytes
+/// (see SetAutoFlush()).
+///
+/// While tasks are pending, the file of the tree must not be written
+/// otherwise: call FlushBaskets() before writing other objects to it.
+///
+/// Write-behind is only active if implicit multi-threading is enabled for the
+/// tree. A maxPendingBytes of 0 disables write-behind.
+
+void TTree::SetWriteBehind(Long64_t maxPendingBytes)
+{
+   CollectWriteBehind();
+   delete fWriteBehind;
+   fWriteBehind = nullptr;
+#ifdef R__USE_IMT
+   if (maxPendingBytes > 0)
+      fWriteBehind = new ROOT::Internal::TBranchIMTHelper(maxPendingBytes);
+#else
+   (void)maxPendingBytes;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the maximum memory of the baskets that are written behind Fill(), 0
+/// if write-behind is disabled. See SetWriteBehind().
+
+Long64_t TTree::GetWriteBehind() const
+{
+   return fWriteBehind ? fWriteBehind->GetMaxPendingBytes() : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the baskets that are written behind Fill() and update the branches
+/// with their sizes and positions. See SetWriteBehind().
+
+void TTree::CollectWriteBehind() const
+{
+   if (fWriteBehind)
+      fWriteBehind->Collect();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Print values of all active leaves for entry.
 ///
@@ -9614,6 +9751,8 @@ void TTree::Streamer(TBuffer& b)
       b.CheckByteCount(R__s, R__c, TTree::IsA());
       //====end of old versions
    } else {
+      // The header must describe the baskets that are written behind Fill()
+      CollectWriteBehind();
       if (fBranchRef) {
          fBranchRef->Clear();
       }
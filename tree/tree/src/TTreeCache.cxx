@@ -106,6 +106,27 @@ The learning period is stopped (and prefetching is started) when:
      fEntryMin + fgLearnEntries.
    - A 'cached' TChain switches over to a new file.
 
+\anchor learnprofile
+## Skipping the learning phase in subsequent jobs
+
+During the learning phase, the branches are read one basket at a time, which
+is costly for files accessed with a high latency. Jobs that run the same
+analysis several times can save the branches learned by the first job and
+preload them in the following jobs:
+~~~ {.cpp}
+    TTreeCache::SetLearnProfile("cacheprofile.txt", "myanalysis"); //<<<
+    TTree *T;
+    f->GetObject(T, "mytree");
+    T->SetCacheSize(10000000);
+    // ... event loop
+~~~
+At the end of an automatic learning phase, the names of the learned branches
+are written to the profile file, a text file in the TEnv format, under the
+label of the job and the name of the tree. A cache that is created for a tree
+with the same name while a profile with the same label exists adds the
+branches of the profile and does not learn. Change the label or delete the
+profile file when the set of branches that the job reads changes.
+
 
 \anchor cachemisses
 ## Self-optimization in presence of cache misses
@@ -299,12 +320,28 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TMath.h"
 #include "TBranchCacheInfo.h"
 #include "TVirtualPerfStats.h"
+#include "ROOT/RMetricsRegistry.hxx"
 #include <limits.h>
+#include <memory>
 
 Int_t TTreeCache::fgLearnEntries = 100;
+TString TTreeCache::fgLearnProfile;
+TString TTreeCache::fgLearnProfileLabel;
 
 ClassImp(TTreeCache);
 
+namespace {
+/// Count a read served (hit) or not served (miss) by a TTreeCache in the process-wide metrics
+void CountCacheRead(bool hit)
+{
+   using ROOT::Experimental::RMetricsRegistry;
+   static auto &hits = RMetricsRegistry::Instance().GetMetric("root_treecache_hits", "Reads served by TTreeCaches");
+   static auto &misses =
+      RMetricsRegistry::Instance().GetMetric("root_treecache_misses", "Reads not found in TTreeCaches");
+   (hit ? hits : misses).Inc();
+}
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor.
 
@@ -322,6 +359,7 @@ TTreeCache::TTreeCache(TTree *tree, Int_t buffersize)
    fEntryNext = fEntryMin + fgLearnEntries;
    Int_t nleaves = tree->GetListOfLeaves()->GetEntriesFast();
    fBranches = new TObjArray(nleaves);
+   LoadLearnProfile();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1788,6 +1826,8 @@ Bool_t TTreeCache::FillBuffer()
          fFirstTime = kFALSE;
       }
    }
+   if (fIsLearning && !fIsManual && !fLearnPrefilling)
+      SaveLearnProfile();
    fIsLearning = kFALSE;
    return kTRUE;
 }
@@ -1926,6 +1966,7 @@ Int_t TTreeCache::ReadBufferNormal(char *buf, Long64_t pos, Int_t len){
    //Is request already in the cache?
    if (TFileCacheRead::ReadBuffer(buf,pos,len) == 1){
       fNReadOk++;
+      CountCacheRead(true);
       return 1;
    }
 
@@ -1952,10 +1993,12 @@ Int_t TTreeCache::ReadBufferNormal(char *buf, Long64_t pos, Int_t len){
    if (bufferFilled) {
       Int_t res = TFileCacheRead::ReadBuffer(buf,pos,len);
 
-      if (res == 1)
+      if (res == 1) {
          fNReadOk++;
-      else if (res == 0) {
+         CountCacheRead(true);
+      } else if (res == 0) {
          fNReadMiss++;
+         CountCacheRead(false);
          auto perfStats = GetTree()->GetPerfStats();
          if (perfStats)
             recordMiss(perfStats, fBranches, bufferFilled, pos);
@@ -1969,6 +2012,7 @@ Int_t TTreeCache::ReadBufferNormal(char *buf, Long64_t pos, Int_t len){
    }
 
    fNReadMiss++;
+   CountCacheRead(false);
    auto perfStats = GetTree()->GetPerfStats();
    if (perfStats)
       recordMiss(perfStats, fBranches, bufferFilled, pos);
@@ -1988,6 +2032,7 @@ Int_t TTreeCache::ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len)
       //(if we are currently reading from the last block available)
       FillBuffer();
       fNReadOk++;
+      CountCacheRead(true);
       return 1;
    }
 
@@ -2001,6 +2046,7 @@ Int_t TTreeCache::ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len)
       }
       FillBuffer();
       fNReadMiss++;
+      CountCacheRead(false);
       counter++;
       if (counter>1) {
         return 0;
@@ -2008,6 +2054,7 @@ Int_t TTreeCache::ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len)
    }
 
    fNReadOk++;
+   CountCacheRead(true);
    return 1;
 }
 
@@ -2145,6 +2192,82 @@ void TTreeCache::SetLearnEntries(Int_t n)
    fgLearnEntries = n;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function to set the file in which the branches learned by the caches
+/// are saved, and from which they are loaded when a cache is created for a tree
+/// with the same name. The label distinguishes the jobs that share a profile
+/// file. An empty filename disables the learn profile.
+/// See \ref learnprofile "the class documentation".
+
+void TTreeCache::SetLearnProfile(const char *filename, const char *label)
+{
+   fgLearnProfile = filename;
+   fgLearnProfileLabel = label;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name of the entry of the tree of this cache in the learn profile.
+
+TString TTreeCache::GetLearnProfileKey() const
+{
+   if (fgLearnProfileLabel.IsNull())
+      return fTree->GetName();
+   return fgLearnProfileLabel + "." + fTree->GetName();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the branches of the learn profile to the cache and stop the learning
+/// phase, see SetLearnProfile(). Returns true if the profile had an entry for
+/// the tree of this cache.
+
+Bool_t TTreeCache::LoadLearnProfile()
+{
+   if (fgLearnProfile.IsNull() || !fTree || !fIsLearning)
+      return kFALSE;
+
+   TEnv profile("");
+   if (profile.ReadFile(fgLearnProfile, kEnvLocal) != 0)
+      return kFALSE;
+   TString names = profile.GetValue(GetLearnProfileKey(), "");
+   std::unique_ptr<TObjArray> tokens(names.Tokenize(" "));
+   for (auto token : *tokens) {
+      if (TBranch *b = fTree->GetBranch(token->GetName()))
+         AddBranch(b, kFALSE);
+   }
+   if (fNbranches == 0)
+      return kFALSE;
+
+   if (gDebug > 0)
+      Info("LoadLearnProfile", "Adding %d branches of tree %s from %s", fNbranches, fTree->GetName(),
+           fgLearnProfile.Data());
+   // Same state as if the branches were learned from a previous file of a TChain
+   fIsLearning = kFALSE;
+   fEntryNext = -1;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the branches of the cache to the learn profile, see SetLearnProfile().
+/// The entries of the other trees and labels are kept. Returns 0 on success
+/// and -1 otherwise.
+
+Int_t TTreeCache::SaveLearnProfile() const
+{
+   if (fgLearnProfile.IsNull() || !fTree || !fBrNames || fBrNames->IsEmpty())
+      return -1;
+
+   TString names;
+   for (auto name : *fBrNames) {
+      if (!names.IsNull())
+         names += " ";
+      names += name->GetName();
+   }
+   TEnv profile("");
+   profile.ReadFile(fgLearnProfile, kEnvLocal);
+   profile.SetValue(GetLearnProfileKey(), names, kEnvLocal);
+   return profile.WriteFile(fgLearnProfile);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set whether the learning period is started with a prefilling of the
 /// cache and which type of prefilling is used.
@@ -28,12 +28,16 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "TROOT.h"
 #include "TMutex.h"
 
+#include "ROOT/RTraceRecorder.hxx"
+
 #ifdef R__USE_IMT
 #include "ROOT/TThreadExecutor.hxx"
 #include "ROOT/TTaskGroup.hxx"
 #endif
 
+#include <algorithm>
 #include <memory>
+#include <utility>
 
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
@@ -163,6 +167,7 @@ TTreeCacheUnzip::TTreeCacheUnzip() : TTreeCache(),
    fNseekMax(0),
    fUnzipGroupSize(0),
    fUnzipBufferSize(0),
+   fUnzipNClusters(1),
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
@@ -182,6 +187,7 @@ TTreeCacheUnzip::TTreeCacheUnzip(TTree *tree, Int_t buffersize) : TTreeCache(tre
    fNseekMax(0),
    fUnzipGroupSize(0),
    fUnzipBufferSize(0),
+   fUnzipNClusters(1),
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
@@ -308,39 +314,73 @@ Bool_t TTreeCacheUnzip::FillBuffer()
    //clear cache buffer
    TFileCacheRead::Prefetch(0,0);
 
-   //store baskets
-   for (Int_t i = 0; i < fNbranches; i++) {
-      TBranch *b = (TBranch*)fBranches->UncheckedAt(i);
-      if (b->GetDirectory() == 0) continue;
-      if (b->GetDirectory()->GetFile() != fFile) continue;
-      Int_t nb = b->GetMaxBaskets();
-      Int_t *lbaskets   = b->GetBasketBytes();
-      Long64_t *entries = b->GetBasketEntry();
-      if (!lbaskets || !entries) continue;
-      //we have found the branch. We now register all its baskets
-      //from the requested offset to the basket below fEntrymax
-      Int_t blistsize = b->GetListOfBaskets()->GetSize();
-      for (Int_t j=0;j<nb;j++) {
-         // This basket has already been read, skip it
-         if (j<blistsize && b->GetListOfBaskets()->UncheckedAt(j)) continue;
-
-         Long64_t pos = b->GetBasketSeek(j);
-         Int_t len = lbaskets[j];
-         if (pos <= 0 || len <= 0) continue;
-         //important: do not try to read fEntryNext, otherwise you jump to the next autoflush
-         if (entries[j] >= fEntryNext) continue;
-         if (entries[j] < entry && (j < nb - 1 && entries[j+1] <= entry)) continue;
-         if (elist) {
-            Long64_t emax = fEntryMax;
-            if (j < nb - 1) emax = entries[j+1] - 1;
-            if (!elist->ContainsRange(entries[j] + chainOffset, emax + chainOffset)) continue;
+   // Collect the baskets of the cached branches that contain entries in [first, last); if onlyStarting is set,
+   // only the baskets that start in that range, the other ones being already collected for the previous cluster.
+   auto collectBaskets = [&](Long64_t first, Long64_t last, Bool_t onlyStarting,
+                             std::vector<std::pair<Long64_t, Int_t>> &baskets) {
+      Long64_t nbytes = 0;
+      for (Int_t i = 0; i < fNbranches; i++) {
+         TBranch *b = (TBranch*)fBranches->UncheckedAt(i);
+         if (b->GetDirectory() == 0) continue;
+         if (b->GetDirectory()->GetFile() != fFile) continue;
+         Int_t nb = b->GetMaxBaskets();
+         Int_t *lbaskets   = b->GetBasketBytes();
+         Long64_t *entries = b->GetBasketEntry();
+         if (!lbaskets || !entries) continue;
+         //we have found the branch. We now register all its baskets
+         //from the requested offset to the basket below fEntrymax
+         Int_t blistsize = b->GetListOfBaskets()->GetSize();
+         for (Int_t j=0;j<nb;j++) {
+            // This basket has already been read, skip it
+            if (j<blistsize && b->GetListOfBaskets()->UncheckedAt(j)) continue;
+
+            Long64_t pos = b->GetBasketSeek(j);
+            Int_t len = lbaskets[j];
+            if (pos <= 0 || len <= 0) continue;
+            //important: do not try to read last, otherwise you jump to the next autoflush
+            if (entries[j] >= last) continue;
+            if (entries[j] < first && (onlyStarting || (j < nb - 1 && entries[j+1] <= first))) continue;
+            if (elist) {
+               Long64_t emax = fEntryMax;
+               if (j < nb - 1) emax = entries[j+1] - 1;
+               if (!elist->ContainsRange(entries[j] + chainOffset, emax + chainOffset)) continue;
+            }
+            baskets.emplace_back(pos, len);
+            nbytes += len;
          }
+         if (gDebug > 0)
+            printf("Entry: %lld, collecting baskets branch %s, first=%lld, last=%lld, nbaskets=%zu\n", entry,
+                   b->GetName(), first, last, baskets.size());
+      }
+      return nbytes;
+   };
+   auto registerBaskets = [&](const std::vector<std::pair<Long64_t, Int_t>> &baskets) {
+      for (const auto &basket : baskets) {
          fNReadPref++;
-
-         TFileCacheRead::Prefetch(pos, len);
+         TFileCacheRead::Prefetch(basket.first, basket.second);
       }
-      if (gDebug > 0) printf("Entry: %lld, registering baskets branch %s, fEntryNext=%lld, fNseek=%d, fNtot=%d\n", entry, ((TBranch*)fBranches->UncheckedAt(i))->GetName(), fEntryNext, fNseek, fNtot);
+   };
+
+   //store baskets
+   std::vector<std::pair<Long64_t, Int_t>> baskets;
+   collectBaskets(entry, fEntryNext, kFALSE, baskets);
+   registerBaskets(baskets);
+
+   // Also store the baskets of the following clusters, as long as they fit in the cache: they are unzipped by the
+   // unzipping tasks while the entries of the first cluster are processed.
+   for (Int_t ncluster = 1; ncluster < fUnzipNClusters && fEntryNext < fEntryMax; ++ncluster) {
+      Long64_t clusterStart = clusterIter.Next();
+      if (clusterStart != fEntryNext) break;
+      Long64_t clusterEnd = std::min(clusterIter.GetNextEntry(), fEntryMax);
+      baskets.clear();
+      Long64_t nbytes = collectBaskets(clusterStart, clusterEnd, kTRUE, baskets);
+      if (fNtot + nbytes > GetBufferSize()) break;
+      registerBaskets(baskets);
+      fEntryNext = clusterEnd;
    }
+   if (gDebug > 0)
+      printf("Entry: %lld, registered baskets, fEntryNext=%lld, fNseek=%d, fNtot=%d\n", entry, fEntryNext, fNseek,
+             fNtot);
 
    // Now fix the size of the status arrays
    ResetCache();
@@ -525,6 +565,7 @@ void TTreeCacheUnzip::ResetCache()
 
 Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
 {
+   R__TRACE_SCOPE_ARG("tree", "UnzipCache", "basket", index);
    Int_t myCycle;
    const Int_t hlen = 128;
    Int_t objlen = 0, keylen = 0;
@@ -617,6 +658,7 @@ Int_t TTreeCacheUnzip::CreateTasks()
          // If cache is invalidated and we should return immediately.
          if (!fIsTransferred) return nullptr;
 
+         R__TRACE_SCOPE_ARG("tree", "TTreeCacheUnzip task", "baskets", indices.size());
          for (auto ii : indices) {
             if(fUnzipState.TryUnzipping(ii)) {
                Int_t res = UnzipCache(ii);
@@ -824,6 +866,23 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
    return res;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the maximum number of clusters whose baskets are read and unzipped
+/// together (default 1).
+///
+/// With more than one cluster, FillBuffer() also reads the baskets of the
+/// clusters following the one of the current entry, as long as they fit in
+/// the cache buffer. While the entries of the first cluster are processed,
+/// the unzipping tasks already decompress the baskets of the next ones, in
+/// groups of SetUnzipGroupSize() bytes. The number of times the main thread
+/// had to wait for a basket being unzipped is given by GetNStalls() and is
+/// reported by TTreePerfStats.
+
+void TTreeCacheUnzip::SetUnzipNClusters(Int_t nclusters)
+{
+   fUnzipNClusters = std::max(nclusters, 1);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// static function: Sets the unzip relative buffer size
 
@@ -952,6 +1011,7 @@ void  TTreeCacheUnzip::Print(Option_t* option) const {
    printf("Number of hits: %d\n", fNFound);
    printf("Number of stalls: %d\n", fNStalls);
    printf("Number of misses: %d\n", fNMissed);
+   printf("Max number of clusters unzipped together: %d\n", fUnzipNClusters);
 
    TTreeCache::Print(option);
 }
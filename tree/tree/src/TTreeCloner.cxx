@@ -36,7 +36,14 @@ Class implementing or helping  the various TTree cloning method
 #include "TTreeCache.h"
 #include "snprintf.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -100,6 +107,13 @@ Bool_t TTreeCloner::CompareEntry::operator()(UInt_t i1, UInt_t i2)
 /// This means that on the file the baskets will be in the order
 /// in which they will be needed when reading the whole tree
 /// sequentially.
+///
+/// If method contains "recompress", the baskets of the branches whose
+/// compression settings differ from the ones of the output file are
+/// decompressed and compressed again with the settings of the output file,
+/// in parallel if implicit multi-threading is enabled. The content of the
+/// baskets is not unstreamed. The output branches then use the compression
+/// settings of the output file.
 
 TTreeCloner::TTreeCloner(TTree *from, TTree *to, Option_t *method, UInt_t options) :
    TTreeCloner(from, to, to ? to->GetDirectory() : nullptr, method, options)
@@ -144,6 +158,7 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, TDirectory *newdirectory, Optio
    fBasketIndex(new UInt_t[fMaxBaskets]),
    fPidOffset(0),
    fCloneMethod(TTreeCloner::kDefault),
+   fRecompressSettings(-1),
    fToStartEntries(0),
    fCacheSize(0LL),
    fFileCache(nullptr),
@@ -161,6 +176,9 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, TDirectory *newdirectory, Optio
       //::Info("TTreeCloner::TTreeCloner","use: kSortBasketsByOffset");
       fCloneMethod = TTreeCloner::kSortBasketsByOffset;
    }
+   if (opt.Contains("recompress") && fToFile) {
+      fRecompressSettings = fToFile->GetCompressionSettings();
+   }
    if (fToTree) fToStartEntries = fToTree->GetEntries();
 
    if (fFromTree == nullptr) {
@@ -232,6 +250,10 @@ Bool_t TTreeCloner::Exec()
    CollectBaskets();
    SortBaskets();
    WriteBaskets();
+   if (fRecompressSettings >= 0) {
+      for (Int_t i = 0; i < fToBranches.GetEntriesFast(); ++i)
+         static_cast<TBranch *>(fToBranches.UncheckedAt(i))->SetCompressionSettings(fRecompressSettings);
+   }
    CopyMemoryBaskets();
    RestoreCache();
    if (IsInPlace())
@@ -724,6 +746,11 @@ UInt_t TTreeCloner::FillCache(UInt_t from)
 
 void TTreeCloner::WriteBaskets()
 {
+   if (fRecompressSettings >= 0) {
+      WriteRecompressedBaskets();
+      return;
+   }
+
    TBasket *basket = new TBasket();
    for(UInt_t j = 0, notCached = 0; j<fMaxBaskets; ++j) {
       TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
@@ -765,14 +792,131 @@ void TTreeCloner::WriteBaskets()
          basket->CopyTo(tofile);
          to->AddBasket(*basket,kTRUE,fToStartEntries + from->GetBasketEntry()[index]);
       } else {
-         TBasket *frombasket = from->GetBasket( index );
-         if (frombasket && frombasket->GetNevBuf()>0) {
-            TBasket *tobasket = (TBasket*)frombasket->Clone();
-            tobasket->SetBranch(to);
-            to->AddBasket(*tobasket, kFALSE, fToStartEntries+from->GetBasketEntry()[index]);
-            to->FlushOneBasket(to->GetWriteBasket());
-         }
+         WriteMemoryBasket(from, to, index);
       }
    }
    delete basket;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer a basket of the input tree that is only in memory to the output
+/// file.
+
+void TTreeCloner::WriteMemoryBasket(TBranch *from, TBranch *to, Int_t index)
+{
+   TBasket *frombasket = from->GetBasket( index );
+   if (frombasket && frombasket->GetNevBuf()>0) {
+      TBasket *tobasket = (TBasket*)frombasket->Clone();
+      tobasket->SetBranch(to);
+      to->AddBasket(*tobasket, kFALSE, fToStartEntries+from->GetBasketEntry()[index]);
+      to->FlushOneBasket(to->GetWriteBasket());
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer the baskets from the input file to the output file, recompressing
+/// the baskets of the branches whose compression settings differ from
+/// fRecompressSettings.
+///
+/// The baskets are processed in batches in the order of fBasketIndex: the
+/// baskets of a batch are read, then recompressed in parallel, then written.
+
+void TTreeCloner::WriteRecompressedBaskets()
+{
+   constexpr std::size_t kMaxBatchBaskets = 256;
+   constexpr Long64_t kMaxBatchBytes = 64 * 1024 * 1024;
+
+   std::vector<std::unique_ptr<TBasket>> baskets;
+   std::vector<UInt_t> batch;        // Indices into fBasketIndex
+   std::vector<Int_t> results;
+   std::vector<Bool_t> recompressBranch(fFromBranches.GetEntriesFast());
+   for (Int_t i = 0; i < fFromBranches.GetEntriesFast(); ++i) {
+      TBranch *from = (TBranch*)fFromBranches.UncheckedAt(i);
+      Int_t settings = from->GetCompressionSettings();
+      if (settings < 0 && from->GetFile(0))
+         settings = from->GetFile(0)->GetCompressionSettings();
+      recompressBranch[i] = (settings != fRecompressSettings);
+   }
+
+   UInt_t j = 0;
+   UInt_t notCached = 0;
+   while (j < fMaxBaskets) {
+      // Read the next on-file baskets
+      batch.clear();
+      Long64_t batchBytes = 0;
+      for (; j < fMaxBaskets && batch.size() < kMaxBatchBaskets && batchBytes < kMaxBatchBytes; ++j) {
+         TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+         Int_t index = fBasketNum[ fBasketIndex[j] ];
+         Long64_t pos = from->GetBasketSeek(index);
+         if (pos == 0)
+            break;
+         if (fFileCache && j >= notCached) {
+            notCached = FillCache(notCached);
+         }
+         TFile *fromfile = from->GetFile(0);
+         if (batch.size() == baskets.size())
+            baskets.emplace_back(new TBasket());
+         TBasket *basket = baskets[batch.size()].get();
+         if (from->GetBasketBytes()[index] == 0) {
+            from->GetBasketBytes()[index] = basket->ReadBasketBytes(pos, fromfile);
+         }
+         Int_t len = from->GetBasketBytes()[index];
+         basket->LoadBasketBuffers(pos,len,fromfile,fFromTree);
+         basket->IncrementPidOffset(fPidOffset);
+         batch.push_back(j);
+         batchBytes += len;
+      }
+
+      // Recompress them
+      results.assign(batch.size(), 0);
+      auto recompress = [&](UInt_t i) {
+         if (recompressBranch[ fBasketBranchNum[ fBasketIndex[batch[i]] ] ])
+            results[i] = baskets[i]->Recompress(fRecompressSettings);
+      };
+#ifdef R__USE_IMT
+      if (ROOT::IsImplicitMTEnabled() && batch.size() > 1) {
+         ROOT::TThreadExecutor pool;
+         pool.Foreach(recompress, ROOT::TSeqU(batch.size()));
+      } else
+#endif
+      {
+         for (UInt_t i = 0; i < batch.size(); ++i)
+            recompress(i);
+      }
+
+      // Write them, in order
+      for (UInt_t i = 0; i < batch.size(); ++i) {
+         TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[batch[i]] ] );
+         TBranch *to   = (TBranch*)fToBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[batch[i]] ] );
+         Int_t index = fBasketNum[ fBasketIndex[batch[i]] ];
+         TBasket *basket = baskets[i].get();
+         if (results[i] != 0) {
+            // Keep the original compression of this basket
+            Int_t len = from->GetBasketBytes()[index];
+            basket->LoadBasketBuffers(from->GetBasketSeek(index), len, from->GetFile(0), fFromTree);
+            basket->IncrementPidOffset(fPidOffset);
+         }
+         basket->CopyTo(fToFile);
+         if (IsInPlace()) {
+            const Int_t delta = basket->GetNbytes() - to->fBasketBytes[index];
+            to->fBasketSeek[index] = basket->GetSeekKey();
+            to->fBasketBytes[index] = basket->GetNbytes();
+            to->fZipBytes += delta;
+            fToTree->AddZipBytes(delta);
+         } else {
+            to->AddBasket(*basket,kTRUE,fToStartEntries + from->GetBasketEntry()[index]);
+         }
+      }
+
+      // The basket at j, if any, is only in memory
+      if (j < fMaxBaskets) {
+         TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+         Int_t index = fBasketNum[ fBasketIndex[j] ];
+         if (from->GetBasketSeek(index) == 0) {
+            if (!IsInPlace())
+               WriteMemoryBasket(from, (TBranch*)fToBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] ), index);
+            ++j;
+         }
+      }
+   }
+}
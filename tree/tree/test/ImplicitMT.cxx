@@ -2,9 +2,12 @@
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TTree.h"
+#include "TTreeCacheUnzip.h"
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -28,4 +31,112 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, ParallelUnzipSeveralClusters)
+{
+   ROOT::EnableImplicitMT();
+   const auto fileName = "parallelUnzipClustersMT.root";
+   const Long64_t nEntries = 1000;
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(100);
+      int x = 0;
+      double y = 0.;
+      t.Branch("x", &x);
+      t.Branch("y", &y);
+      for (int i = 0; i < nEntries; ++i) {
+         x = i;
+         y = i * 0.5;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+   {
+      TFile f(fileName);
+      auto t = f.Get<TTree>("t");
+      t->SetCacheSize(10000000);
+      auto cache = dynamic_cast<TTreeCacheUnzip *>(f.GetCacheRead(t));
+      ASSERT_NE(nullptr, cache);
+      cache->SetUnzipNClusters(3);
+      EXPECT_EQ(3, cache->GetUnzipNClusters());
+      int x = -1;
+      double y = -1.;
+      t->SetBranchAddress("x", &x);
+      t->SetBranchAddress("y", &y);
+      for (Long64_t i = 0; i < nEntries; ++i) {
+         t->GetEntry(i);
+         EXPECT_EQ(i, x);
+         EXPECT_DOUBLE_EQ(i * 0.5, y);
+      }
+      EXPECT_GT(cache->GetNFound() + cache->GetNStalls() + cache->GetNMissed(), 0);
+   }
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kDisable);
+   gSystem->Unlink(fileName);
+}
+
+TEST(TTreeImplicitMT, WriteBehind)
+{
+   ROOT::EnableImplicitMT();
+   const auto fileName = "writeBehindMT.root";
+   const Long64_t nEntries = 10000;
+   auto writeTree = [&](const char *treeName, Long64_t maxPendingBytes) {
+      TTree t(treeName, treeName);
+      t.SetAutoFlush(1000);
+      t.SetAutoSave(0);
+      t.SetWriteBehind(maxPendingBytes);
+      EXPECT_EQ(maxPendingBytes, t.GetWriteBehind());
+      int x = 0;
+      std::vector<float> v;
+      t.Branch("x", &x, 1000);
+      t.Branch("v", &v, 1000);
+      for (int i = 0; i < nEntries; ++i) {
+         x = i;
+         v.assign(i % 7, i);
+         EXPECT_GT(t.Fill(), 0);
+      }
+      t.Write();
+   };
+   {
+      TFile f(fileName, "RECREATE");
+      writeTree("ref", 0);
+      writeTree("t", 10000);
+   }
+
+   TFile f(fileName);
+   auto ref = f.Get<TTree>("ref");
+   auto t = f.Get<TTree>("t");
+   ASSERT_EQ(nEntries, t->GetEntries());
+   EXPECT_EQ(ref->GetZipBytes(), t->GetZipBytes());
+   EXPECT_EQ(ref->GetTotBytes(), t->GetTotBytes());
+   for (auto name : {"x", "v"}) {
+      auto refBranch = ref->GetBranch(name);
+      auto branch = t->GetBranch(name);
+      ASSERT_EQ(refBranch->GetWriteBasket(), branch->GetWriteBasket());
+      EXPECT_GT(branch->GetWriteBasket(), 10);
+      for (Int_t i = 0; i < branch->GetWriteBasket(); ++i) {
+         EXPECT_EQ(refBranch->GetBasketEntry()[i], branch->GetBasketEntry()[i]);
+         EXPECT_NE(0, branch->GetBasketSeek(i));
+      }
+   }
+   auto clusters = t->GetClusterIterator(0);
+   for (Long64_t start = clusters(); start < nEntries; start = clusters())
+      EXPECT_EQ(0, start % 1000);
+
+   int x = -1;
+   std::vector<float> *v = nullptr;
+   t->SetBranchAddress("x", &x);
+   t->SetBranchAddress("v", &v);
+   for (Long64_t i = 0; i < nEntries; ++i) {
+      t->GetEntry(i);
+      EXPECT_EQ(i, x);
+      ASSERT_EQ(std::size_t(i % 7), v->size());
+      for (auto value : *v)
+         EXPECT_EQ(float(i), value);
+   }
+   t->ResetBranchAddresses();
+   gSystem->Unlink(fileName);
+}
+
 #endif // R__USE_IMT
@@ -2,6 +2,9 @@
 #include "TTree.h"
 #include "TBranch.h"
 #include "TRandom.h"
+#include "TClonesArray.h"
+#include "TParameter.h"
+#include "TSystem.h"
 
 #include "gtest/gtest.h"
 
@@ -229,4 +232,42 @@ TEST_F(TBranchTest, branchInheritsCompression)
 {
    for(int mode = 4; mode >= 0; --mode)
       ASSERT_TRUE(nocomp(mode)) << "Failed for mode: " << mode;
-}
\ No newline at end of file
+}
+// The split data members of a TClonesArray are read for all the elements at once, in chunks of 256 values
+TEST(TBranch, clonesArraySplitMembers)
+{
+   const char *fileName = "TBranchClonesArraySplit.root";
+   {
+      TFile file(fileName, "RECREATE");
+      TTree tree("tree", "A test tree");
+      TClonesArray clones("TParameter<Double_t>");
+      tree.Branch("clones", &clones, 32000, 99);
+      for (Int_t ev = 0; ev < 3; ev++) {
+         clones.Clear();
+         for (Int_t i = 0; i < 100 + 300 * ev; i++) {
+            auto p = new (clones[i]) TParameter<Double_t>("p", ev * 1000 + i);
+            p->SetUniqueID(i);
+         }
+         tree.Fill();
+      }
+      file.Write();
+   }
+
+   TFile file(fileName);
+   auto tree = file.Get<TTree>("tree");
+   ASSERT_NE(tree, nullptr);
+   TClonesArray *clones = nullptr;
+   tree->SetBranchAddress("clones", &clones);
+   for (Int_t ev : {2, 0, 1}) {
+      tree->GetEntry(ev);
+      ASSERT_EQ(clones->GetEntriesFast(), 100 + 300 * ev);
+      for (Int_t i = 0; i < clones->GetEntriesFast(); i++) {
+         auto p = static_cast<TParameter<Double_t> *>(clones->UncheckedAt(i));
+         EXPECT_EQ(p->GetVal(), ev * 1000 + i);
+         EXPECT_EQ(p->GetUniqueID(), (UInt_t)i);
+      }
+   }
+   tree->ResetBranchAddresses();
+   delete clones;
+   gSystem->Unlink(fileName);
+}
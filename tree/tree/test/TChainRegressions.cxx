@@ -1,10 +1,16 @@
 #include <TChain.h>
+#include <TChainElement.h>
 #include <TFile.h>
+#include <TLeaf.h>
 #include <TSystem.h>
 #include <TTree.h>
  
 #include "gtest/gtest.h"
 
+#include <fstream>
+#include <string>
+#include <vector>
+
 class TTreeCache;
 
 // ROOT-10672
@@ -30,3 +36,67 @@ TEST(TChain, GetReadCacheBug)
 
    gSystem->Unlink(filename);
 }
+
+TEST(TChain, PrefetchMetadata)
+{
+   const auto treename = "tree";
+   const std::vector<std::string> filenames{"tchain_prefetchmetadata_0.root", "tchain_prefetchmetadata_1.root"};
+   const auto catalog = "tchain_prefetchmetadata.txt";
+   for (std::size_t i = 0; i < filenames.size(); ++i) {
+      TFile f(filenames[i].c_str(), "recreate");
+      ASSERT_FALSE(f.IsZombie());
+      TTree t(treename, treename);
+      int x = 0;
+      t.Branch("x", &x);
+      t.SetAutoFlush(10);
+      for (int j = 0; j < 25 + 10 * int(i); ++j) {
+         x = j;
+         t.Fill();
+      }
+      t.Write();
+   }
+   gSystem->Unlink(catalog);
+
+   const std::vector<Long64_t> expectedBoundaries[] = {{0, 10, 20, 25}, {0, 10, 20, 30, 35}};
+   {
+      TChain chain(treename);
+      for (const auto &filename : filenames)
+         chain.Add(filename.c_str());
+      EXPECT_EQ(chain.PrefetchMetadata(catalog), 60);
+      EXPECT_EQ(chain.GetEntries(), 60);
+      for (std::size_t i = 0; i < filenames.size(); ++i) {
+         auto element = static_cast<TChainElement *>(chain.GetListOfFiles()->At(i));
+         EXPECT_EQ(element->GetClusterBoundaries(), expectedBoundaries[i]);
+      }
+      chain.GetEntry(40);
+      EXPECT_EQ(chain.GetTreeNumber(), 1);
+      EXPECT_EQ(chain.GetLeaf("x")->GetValue(), 15);
+   }
+
+   std::ifstream in(catalog);
+   std::string line;
+   std::vector<std::string> lines;
+   while (std::getline(in, line))
+      lines.push_back(line);
+   ASSERT_EQ(lines.size(), 2u);
+   EXPECT_EQ(lines[0], filenames[0] + "\ttree\t25\t0,10,20,25");
+   EXPECT_EQ(lines[1], filenames[1] + "\ttree\t35\t0,10,20,30,35");
+
+   // The files are not opened again if the catalog is up to date: a catalog with different content wins.
+   {
+      std::ofstream out(catalog);
+      out << filenames[0] << "\ttree\t25\t0,25\n" << lines[1] << '\n';
+   }
+   {
+      TChain chain(treename);
+      for (const auto &filename : filenames)
+         chain.Add(filename.c_str());
+      EXPECT_EQ(chain.PrefetchMetadata(catalog), 60);
+      auto element = static_cast<TChainElement *>(chain.GetListOfFiles()->At(0));
+      EXPECT_EQ(element->GetClusterBoundaries(), std::vector<Long64_t>({0, 25}));
+   }
+
+   gSystem->Unlink(catalog);
+   for (const auto &filename : filenames)
+      gSystem->Unlink(filename.c_str());
+}
@@ -0,0 +1,75 @@
+#include "TBranch.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+
+#include "gtest/gtest.h"
+
+TEST(TTreeCache, LearnProfile)
+{
+   const auto fileName = "ttreecache_learnprofile.root";
+   const auto profileName = "ttreecache_learnprofile.txt";
+   const Long64_t nEntries = 1000;
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int a = 0, b = 0, c = 0;
+      t.Branch("a", &a);
+      t.Branch("b", &b);
+      t.Branch("c", &c);
+      for (int i = 0; i < nEntries; ++i) {
+         a = b = c = i;
+         t.Fill();
+      }
+      t.Write();
+   }
+   gSystem->Unlink(profileName);
+   TTreeCache::SetLearnProfile(profileName, "job");
+
+   auto readAB = [&](bool expectLearning) {
+      TFile f(fileName);
+      auto t = f.Get<TTree>("t");
+      t->SetCacheSize(10000000);
+      auto cache = dynamic_cast<TTreeCache *>(f.GetCacheRead(t));
+      ASSERT_NE(nullptr, cache);
+      EXPECT_EQ(expectLearning, cache->IsLearning());
+      int a = -1, b = -1;
+      t->SetBranchAddress("a", &a);
+      t->SetBranchAddress("b", &b);
+      auto branchA = t->GetBranch("a");
+      auto branchB = t->GetBranch("b");
+      for (Long64_t i = 0; i < nEntries; ++i) {
+         t->LoadTree(i);
+         branchA->GetEntry(i);
+         branchB->GetEntry(i);
+         EXPECT_EQ(i, a);
+         EXPECT_EQ(i, b);
+      }
+      ASSERT_EQ(2, cache->GetCachedBranches()->GetEntriesFast());
+      EXPECT_NE(nullptr, cache->GetCachedBranches()->FindObject("a"));
+      EXPECT_NE(nullptr, cache->GetCachedBranches()->FindObject("b"));
+      t->ResetBranchAddresses();
+   };
+
+   // The first job learns the branches and saves them
+   readAB(true);
+   EXPECT_FALSE(gSystem->AccessPathName(profileName));
+   // The second job preloads them
+   readAB(false);
+
+   // A different label does not use the profile
+   TTreeCache::SetLearnProfile(profileName, "otherjob");
+   {
+      TFile f(fileName);
+      auto t = f.Get<TTree>("t");
+      t->SetCacheSize(10000000);
+      auto cache = dynamic_cast<TTreeCache *>(f.GetCacheRead(t));
+      ASSERT_NE(nullptr, cache);
+      EXPECT_TRUE(cache->IsLearning());
+   }
+
+   TTreeCache::SetLearnProfile("");
+   gSystem->Unlink(profileName);
+   gSystem->Unlink(fileName);
+}
@@ -115,3 +115,43 @@ TEST(TTreeRegressions, GetLeafAndFriends)
    EXPECT_EQ(t.GetLeaf("asdklj", "x"), nullptr);
    EXPECT_EQ(t.GetLeaf("asdklj", "vec"), nullptr);
 }
+
+TEST(TTreeRegressions, FastCloneRecompress)
+{
+   TMemFile src("tree_fastclonerecompress_src.root", "recreate", "", 101);
+   {
+      TTree t("t", "t");
+      int x = 0;
+      std::vector<float> v;
+      t.Branch("x", &x);
+      t.Branch("v", &v);
+      for (int i = 0; i < 10000; ++i) {
+         x = i;
+         v.assign(i % 5, i);
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TMemFile dst("tree_fastclonerecompress_dst.root", "recreate", "", 404);
+   auto t = src.Get<TTree>("t");
+   TTree *out = t->CloneTree(0);
+   out->CopyEntries(t, -1, "fast recompress");
+   out->Write();
+
+   EXPECT_EQ(out->GetEntries(), 10000);
+   EXPECT_EQ(out->GetBranch("x")->GetCompressionSettings(), 404);
+   EXPECT_NE(out->GetZipBytes(), t->GetZipBytes());
+   int x = -1;
+   std::vector<float> *v = nullptr;
+   out->SetBranchAddress("x", &x);
+   out->SetBranchAddress("v", &v);
+   for (Long64_t i = 0; i < out->GetEntries(); ++i) {
+      out->GetEntry(i);
+      EXPECT_EQ(x, i);
+      ASSERT_EQ(v->size(), std::size_t(i % 5));
+      for (float f : *v)
+         EXPECT_FLOAT_EQ(f, i);
+   }
+   out->ResetBranchAddresses();
+}
@@ -0,0 +1,94 @@
+#include <set>
+
+#include "TEntryList.h"
+
+#include "gtest/gtest.h"
+
+namespace {
+
+// Fill an entry list and its reference set with the multiples of step in [start, end)
+void Fill(TEntryList &elist, std::set<Long64_t> &ref, Long64_t start, Long64_t end, Long64_t step)
+{
+   for (auto entry = start; entry < end; entry += step) {
+      elist.Enter(entry);
+      ref.insert(entry);
+   }
+   elist.OptimizeStorage();
+}
+
+void ExpectEqual(TEntryList &elist, const std::set<Long64_t> &ref)
+{
+   ASSERT_EQ(elist.GetN(), Long64_t(ref.size()));
+   Long64_t i = 0;
+   for (auto entry : ref)
+      EXPECT_EQ(elist.GetEntry(i++), entry);
+}
+
+} // anonymous namespace
+
+// The lists mix sparse, dense and almost full blocks
+TEST(TEntryList, SetOperations)
+{
+   TEntryList l1("l1", "l1", "t", "f.root");
+   TEntryList l2("l2", "l2", "t", "f.root");
+   std::set<Long64_t> r1, r2;
+   Fill(l1, r1, 0, 200000, 3);
+   Fill(l1, r1, 250000, 260000, 1);
+   Fill(l2, r2, 0, 300000, 5);
+   Fill(l2, r2, 100000, 150000, 1);
+
+   std::set<Long64_t> runion = r1, rintersection, rdifference;
+   runion.insert(r2.begin(), r2.end());
+   for (auto entry : r1) {
+      if (r2.count(entry))
+         rintersection.insert(entry);
+      else
+         rdifference.insert(entry);
+   }
+
+   TEntryList lunion(l1);
+   lunion.Add(&l2);
+   ExpectEqual(lunion, runion);
+
+   TEntryList lintersection(l1);
+   lintersection.Intersect(&l2);
+   ExpectEqual(lintersection, rintersection);
+
+   TEntryList ldifference(l1);
+   ldifference.Subtract(&l2);
+   ExpectEqual(ldifference, rdifference);
+
+   for (Long64_t entry : {0ll, 1ll, 64000ll, 99999ll, 100000ll, 255555ll, 400000ll}) {
+      const auto nbefore = std::distance(r1.begin(), r1.lower_bound(entry));
+      EXPECT_EQ(l1.GetNEntriesBefore(entry), nbefore);
+   }
+}
+
+TEST(TEntryList, SetOperationsWithSubLists)
+{
+   TEntryList l1, l2;
+   TEntryList a1("", "", "t", "a.root"), b1("", "", "t", "b.root");
+   TEntryList a2("", "", "t", "a.root"), c2("", "", "t", "c.root");
+   a1.EnterRange(0, 100);
+   b1.EnterRange(0, 100);
+   a2.EnterRange(50, 150);
+   c2.EnterRange(0, 10);
+   l1.Add(&a1);
+   l1.Add(&b1);
+   l2.Add(&a2);
+   l2.Add(&c2);
+
+   TEntryList lunion(l1);
+   lunion.Add(&l2);
+   EXPECT_EQ(lunion.GetN(), 150 + 100 + 10);
+
+   TEntryList lintersection(l1);
+   lintersection.Intersect(&l2);
+   EXPECT_EQ(lintersection.GetN(), 50);
+   EXPECT_EQ(lintersection.GetEntryList("t", "a.root")->GetN(), 50);
+   EXPECT_EQ(lintersection.GetEntryList("t", "b.root")->GetN(), 0);
+
+   TEntryList ldifference(l1);
+   ldifference.Subtract(&l2);
+   EXPECT_EQ(ldifference.GetN(), 50 + 100);
+}
@@ -84,15 +84,20 @@ private:
    TEntryList fEntryList;
    ROOT::TreeUtils::RFriendInfo fFriendInfo;
    ROOT::TThreadExecutor fPool; ///<! Thread pool for processing.
+   /// Per file, the cluster starts followed by the number of entries, if TChain::PrefetchMetadata() read them
+   std::vector<std::vector<Long64_t>> fClusterBoundaries;
 
    /// Thread-local TreeViews
    // Must be declared after fPool, for IMT to be initialized first!
    ROOT::TThreadedObject<ROOT::Internal::TTreeView> fTreeView{TNumSlots{ROOT::GetThreadPoolSize()}};
 
    std::vector<std::string> FindTreeNames();
+   static std::vector<std::vector<Long64_t>> GetKnownClusterBoundaries(TTree &tree);
    static unsigned int fgTasksPerWorkerHint;
 
    std::pair<Long64_t, Long64_t> fGlobalRange{0, std::numeric_limits<Long64_t>::max()};
+   /// Whether tasks are split while workers are idle, see SetDynamicScheduling()
+   bool fDynamicScheduling = false;
 
 public:
    TTreeProcessorMT(std::string_view filename, std::string_view treename = "", UInt_t nThreads = 0u,
@@ -109,6 +114,11 @@ public:
 
    void Process(std::function<void(TTreeReader &)> func);
 
+   /// With dynamic scheduling, the user function is called several times per task, for consecutive chunks of
+   /// clusters. When workers run out of work, the remaining clusters of the running tasks are split into new tasks,
+   /// which avoids that a few long tasks, e.g. from a large file, determine the run time.
+   void SetDynamicScheduling(bool dynamicScheduling) { fDynamicScheduling = dynamicScheduling; }
+
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
 };
@@ -120,6 +120,9 @@ namespace Detail {
 
       TBranchProxy* GetProxy() { return this; }
       const char* GetBranchName() const { return fBranchName; }
+      TBranch *GetBranch() const { return fBranch; }
+      /// The entry of the tree that is read, -1 if there is no director
+      Long64_t GetReadEntry() const { return fDirector ? fDirector->GetReadEntry() : -1; }
 
       void Reset();
 
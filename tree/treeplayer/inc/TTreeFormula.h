@@ -131,6 +131,14 @@ protected:
 
    RealInstanceCache fRealInstanceCache;              ///<! Cache accelerating the GetRealInstance function
 
+   using JitFunc_t = Double_t (*)(const Double_t *values);
+
+   JitFunc_t            fJitFunc;                     ///<! Compiled version of the expression, see SetJitting()
+   Int_t                fJitStatus;                   ///<! 0: not tried yet, 1: compiled, -1: interpreted
+   std::vector<Int_t>   fJitCodes;                    ///<! The leaves whose values are passed to fJitFunc
+
+   static Bool_t        fgJitting;                    ///<  Whether the expressions are compiled, see SetJitting()
+
    TTreeFormula(const char *name, const char *formula, TTree *tree, const std::vector<std::string>& aliases);
    void Init(const char *name, const char *formula);
    Bool_t      BranchHasMethod(TLeaf* leaf, TBranch* branch, const char* method,const char* params, Long64_t readentry) const;
@@ -169,6 +177,9 @@ private:
 
    template<typename T> T GetConstant(Int_t k);
 
+   Bool_t      JitCompile();
+   Bool_t      JitTranslate(Int_t start, Int_t end, std::vector<std::string> &stack, std::vector<Int_t> &codes);
+
 public:
    TTreeFormula();
    TTreeFormula(const char *name,const char *formula, TTree *tree);
@@ -199,11 +210,13 @@ public:
    //NOTE: Also modify the code in PrintValue which current goes around this limitation :(
    virtual Bool_t      IsInteger(Bool_t fast=kTRUE) const;
            Bool_t      IsQuickLoad() const { return fQuickLoad; }
+   static  Bool_t      IsJitting() { return fgJitting; }
    virtual Bool_t      IsString() const;
    Bool_t      Notify() override { UpdateFormulaLeaves(); return kTRUE; }
    virtual char       *PrintValue(Int_t mode=0) const;
    virtual char       *PrintValue(Int_t mode, Int_t instance, const char *decform = "9.9") const;
    virtual void        SetAxis(TAxis *axis = nullptr);
+   static  void        SetJitting(Bool_t jit = kTRUE);
            void        SetQuickLoad(Bool_t quick) { fQuickLoad = quick; }
    virtual void        SetTree(TTree *tree) {fTree = tree;}
    virtual void        ResetLoading();
@@ -62,6 +62,9 @@ protected:
    Long64_t      fUnzipInputSize;///<  Compressed bytes seen by the decompressor.
    Long64_t      fUnzipObjSize;  ///<  Uncompressed bytes produced by the decompressor.
    Double_t      fCompress;      ///<  Tree compression factor
+   Int_t         fUnzipNFound;   ///<  Number of baskets that were found already unzipped by the parallel unzipping
+   Int_t         fUnzipNStalls;  ///<  Number of baskets for which the parallel unzipping had to be waited for
+   Int_t         fUnzipNMissed;  ///<  Number of baskets that were not unzipped in parallel while enabled
    TString       fName;          ///<  Name of this TTreePerfStats
    TString       fHostInfo;      ///<  Name of the host system, ROOT version and date
    TFile        *fFile;          ///<! Pointer to the file containing the Tree
@@ -109,6 +112,9 @@ public:
    TStopwatch      *GetStopwatch() const {return fWatch;}
    virtual Int_t    GetTreeCacheSize() const {return fTreeCacheSize;}
    virtual Double_t GetUnzipTime() const {return fUnzipTime; }
+   virtual Int_t    GetUnzipNFound() const {return fUnzipNFound;}
+   virtual Int_t    GetUnzipNStalls() const {return fUnzipNStalls;}
+   virtual Int_t    GetUnzipNMissed() const {return fUnzipNMissed;}
    void     Paint(Option_t *chopt="") override;
    void     Print(Option_t *option="") const override;
 
@@ -154,7 +160,7 @@ public:
 
    BasketList_t     GetDuplicateBasketCache() const;
 
-   ClassDefOverride(TTreePerfStats, 8) // TTree I/O performance measurement
+   ClassDefOverride(TTreePerfStats, 9) // TTree I/O performance measurement
 };
 
 #endif
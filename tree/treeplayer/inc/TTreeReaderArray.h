@@ -19,6 +19,8 @@
 #include "TTreeReaderUtils.h"
 #include <type_traits>
 
+class TBranchElement;
+
 namespace ROOT {
 namespace Internal {
 
@@ -43,6 +45,7 @@ Base class of TTreeReaderArray.
       bool GetBranchAndLeaf(TBranch* &branch, TLeaf* &myLeaf,
                             TDictionary* &branchActualType);
       void SetImpl(TBranch* branch, TLeaf* myLeaf);
+      void UseBulkCollectionReader(TBranchElement *branchElement);
       const char* GetBranchContentDataType(TBranch* branch,
                                            TString& contentTypeName,
                                            TDictionary* &dict);
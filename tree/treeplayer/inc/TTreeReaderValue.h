@@ -25,11 +25,13 @@
 #include "TDictionary.h"
 #include "TBranchProxy.h"
 
+#include <memory>
 #include <type_traits>
 #include <vector>
 #include <string>
 
 class TBranch;
+class TBufferFile;
 class TBranchElement;
 class TLeaf;
 class TTreeReader;
@@ -78,6 +80,8 @@ Base class of TTreeReaderValue.
       template <BranchProxyRead_t Func>
       ROOT::Internal::TTreeReaderValueBase::EReadStatus ProxyReadTemplate();
 
+      EReadStatus ProxyReadBulk();
+
       /// Return true if the branch was setup \em and \em read correctly.
       /// Use GetSetupStatus() to only check the setup status.
       Bool_t IsValid() const { return fProxy && 0 == (int)fSetupStatus && 0 == (int)fReadStatus; }
@@ -118,6 +122,8 @@ Base class of TTreeReaderValue.
       /// Stringify the template argument.
       static std::string GetElementTypeName(const std::type_info& ti);
 
+      bool CanReadBulk() const;
+
       bool         fHaveLeaf : 1;                 ///< Whether the data is in a leaf
       bool         fHaveStaticClassOffsets : 1;   ///< Whether !fStaticClassOffsets.empty()
       EReadStatus  fReadStatus : 2;               ///< Read status of this data access
@@ -131,6 +137,10 @@ Base class of TTreeReaderValue.
       std::vector<Long64_t> fStaticClassOffsets;
       typedef EReadStatus (TTreeReaderValueBase::*Read_t)();
       Read_t fProxyReadFunc = &TTreeReaderValueBase::ProxyReadDefaultImpl;      ///<! Pointer to the Read implementation to use.
+      std::unique_ptr<TBufferFile> fBulkBuffer; ///<! The current basket in host byte order, see ProxyReadBulk()
+      Long64_t fBulkFirst = -1;                 ///<! First entry of the values in fBulkBuffer
+      Long64_t fBulkEnd = -1;                   ///<! One past the last entry of the values in fBulkBuffer
+      Int_t    fBulkValueSize = 0;              ///<! Size in bytes of one value in fBulkBuffer
 
       // FIXME: re-introduce once we have ClassDefInline!
       //ClassDefOverride(TTreeReaderValueBase, 0);//Base class for accessors to data via TTreeReader
@@ -22,11 +22,19 @@ and kept inside this chain index.
 
 #include "TChainIndex.h"
 #include "TChain.h"
+#include "TChainElement.h"
 #include "TTreeFormula.h"
 #include "TTreeIndex.h"
 #include "TFile.h"
 #include "TError.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+#include <memory>
+
 ////////////////////////////////////////////////////////////////////////////////
 /// \class TChainIndex::TChainIndexEntry
 /// Holds a description of indices of trees in the chain.
@@ -58,7 +66,8 @@ TChainIndex::TChainIndex(): TVirtualIndex()
 /// less then any index value in the second one, and so on.
 /// If any of those requirements isn't met the object becomes a zombie.
 /// If some subtrees don't have indices the indices are created and stored inside this
-/// TChainIndex.
+/// TChainIndex. With implicit multi-threading enabled, these indices are built
+/// concurrently, each task reading its own copy of the tree.
 
 TChainIndex::TChainIndex(const TTree *T, const char *majorname, const char *minorname)
            : TVirtualIndex()
@@ -79,6 +88,32 @@ TChainIndex::TChainIndex(const TTree *T, const char *majorname, const char *mino
    fMinorName          = minorname;
    Int_t i = 0;
 
+   // The indices built ahead of the loop below for the trees that have none
+   std::vector<TVirtualIndex *> built(chain->GetNtrees(), nullptr);
+   auto deleteUnused = [&built](Int_t first) {
+      for (Int_t j = first; j < Int_t(built.size()); ++j)
+         delete built[j];
+   };
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && chain->GetNtrees() > 1) {
+      auto buildIndex = [&](unsigned int j) {
+         auto element = static_cast<TChainElement *>(chain->GetListOfFiles()->At(j));
+         std::unique_ptr<TFile> file(TFile::Open(element->GetTitle(), "READ"));
+         if (!file || file->IsZombie())
+            return;
+         auto tree = file->Get<TTree>(element->GetName());
+         // The loop below reports the errors and checks the indices stored with the trees
+         if (!tree || tree->GetTreeIndex())
+            return;
+         tree->BuildIndex(majorname, minorname);
+         built[j] = tree->GetTreeIndex();
+         tree->SetTreeIndex(0);
+      };
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(buildIndex, ROOT::TSeqU(chain->GetNtrees()));
+   }
+#endif
+
    // Go through all the trees and check if they have indeces. If not then build them.
    for (i = 0; i < chain->GetNtrees(); i++) {
       chain->LoadTree((chain->GetTreeOffset())[i]);
@@ -93,16 +128,26 @@ TChainIndex::TChainIndex(const TTree *T, const char *majorname, const char *mino
          if (strcmp(majorname,index->GetMajorName()) || strcmp(minorname,index->GetMinorName())) {
             MakeZombie();
             Error("TChainIndex","Tree in file %s has an index built with majorname=%s and minorname=%s",chain->GetTree()->GetCurrentFile()->GetName(),index->GetMajorName(),index->GetMinorName());
+            deleteUnused(i);
             return;
          }
+         delete built[i];
+         built[i] = nullptr;
       }
-      if (!index) {
+      if (!index && built[i]) {
+         index = built[i];
+         built[i] = nullptr;
+         entry.fTreeIndex = index;
+      } else if (!index) {
          chain->GetTree()->BuildIndex(majorname, minorname);
          index = chain->GetTree()->GetTreeIndex();
          chain->GetTree()->SetTreeIndex(0);
          entry.fTreeIndex = index;
       }
       if (!index || index->IsZombie() || index->GetN() == 0) {
+         // An index built here is referenced by entry, which is not in fEntries yet
+         delete entry.fTreeIndex;
+         deleteUnused(i + 1);
          DeleteIndices();
          MakeZombie();
          Error("TChainIndex", "Error creating a tree index on a tree in the chain");
@@ -113,6 +158,7 @@ TChainIndex::TChainIndex(const TTree *T, const char *majorname, const char *mino
       if (ti_index == 0) {
          Error("TChainIndex", "The underlying TTree must have a TTreeIndex but has a %s.",
                index->IsA()->GetName());
+         deleteUnused(i + 1);
          return;
       }
 
@@ -51,6 +51,10 @@
 #include <cstdlib>
 #include <typeinfo>
 #include <algorithm>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
 
 const Int_t kMaxLen     = 1024;
 
@@ -94,6 +98,8 @@ The following method are available from the TFormLeafInfo interface:
 
 ClassImp(TTreeFormula);
 
+Bool_t TTreeFormula::fgJitting = kFALSE;
+
 ////////////////////////////////////////////////////////////////////////////////
 
 inline static void R__LoadBranch(TBranch* br, Long64_t entry, Bool_t quickLoad)
@@ -122,7 +128,7 @@ public:
 ////////////////////////////////////////////////////////////////////////////////
 
 TTreeFormula::TTreeFormula(): ROOT::v5::TFormula(), fQuickLoad(kFALSE), fNeedLoading(kTRUE),
-   fDidBooleanOptimization(kFALSE), fDimensionSetup(0)
+   fDidBooleanOptimization(kFALSE), fDimensionSetup(0), fJitFunc(nullptr), fJitStatus(0)
 
 {
    // Tree Formula default constructor
@@ -156,7 +162,7 @@ TTreeFormula::TTreeFormula(): ROOT::v5::TFormula(), fQuickLoad(kFALSE), fNeedLoa
 
 TTreeFormula::TTreeFormula(const char *name,const char *expression, TTree *tree)
    :ROOT::v5::TFormula(), fTree(tree), fQuickLoad(kFALSE), fNeedLoading(kTRUE),
-    fDidBooleanOptimization(kFALSE), fDimensionSetup(0)
+    fDidBooleanOptimization(kFALSE), fDimensionSetup(0), fJitFunc(nullptr), fJitStatus(0)
 {
    Init(name,expression);
 }
@@ -167,7 +173,7 @@ TTreeFormula::TTreeFormula(const char *name,const char *expression, TTree *tree)
 TTreeFormula::TTreeFormula(const char *name,const char *expression, TTree *tree,
                            const std::vector<std::string>& aliases)
    :ROOT::v5::TFormula(), fTree(tree), fQuickLoad(kFALSE), fNeedLoading(kTRUE),
-    fDidBooleanOptimization(kFALSE), fDimensionSetup(0), fAliasesUsed(aliases)
+    fDidBooleanOptimization(kFALSE), fDimensionSetup(0), fAliasesUsed(aliases), fJitFunc(nullptr), fJitStatus(0)
 {
    Init(name,expression);
 }
@@ -3935,6 +3941,221 @@ template<> inline LongDouble_t TTreeFormula::GetConstant(Int_t k) {
 }
 template<> inline Long64_t TTreeFormula::GetConstant(Int_t k) { return (Long64_t)GetConstant<LongDouble_t>(k); }
 
+namespace {
+
+/// The helpers used by the compiled expressions, with the same conventions as the interpreter of
+/// TTreeFormula::EvalInstance (e.g. a division by zero is 0).
+const char *gJitHelpers = R"CODE(
+#include "TMath.h"
+#include <algorithm>
+#include <cmath>
+namespace R__TTreeFormulaJit {
+inline Double_t Div(Double_t a, Double_t b) { return b == 0 ? 0 : a / b; }
+inline Double_t Sq(Double_t a) { return a * a; }
+inline Double_t Tan(Double_t a) { return TMath::Cos(a) == 0 ? 0 : TMath::Tan(a); }
+inline Double_t ACos(Double_t a) { return TMath::Abs(a) > 1 ? 0 : TMath::ACos(a); }
+inline Double_t ASin(Double_t a) { return TMath::Abs(a) > 1 ? 0 : TMath::ASin(a); }
+inline Double_t TanH(Double_t a) { return TMath::CosH(a) == 0 ? 0 : TMath::TanH(a); }
+inline Double_t ACosH(Double_t a) { return a < 1 ? 0 : TMath::ACosH(a); }
+inline Double_t ATanH(Double_t a) { return TMath::Abs(a) > 1 ? 0 : TMath::ATanH(a); }
+inline Double_t Log(Double_t a) { return a > 0 ? TMath::Log(a) : 0; }
+inline Double_t Log10(Double_t a) { return a > 0 ? TMath::Log10(a) : 0; }
+inline Double_t Exp(Double_t a) { return a < -700 ? 0 : TMath::Exp(a > 700 ? 700 : a); }
+inline Double_t Sign(Double_t a) { return a < 0 ? -1 : 1; }
+}
+)CODE";
+
+/// Format a constant as a C++ floating point literal.
+std::string JitConstant(Double_t value)
+{
+   std::string literal = TString::Format("%.17g", value).Data();
+   if (literal.find_first_of(".e") == std::string::npos)
+      literal += ".";
+   return value < 0 ? "(" + literal + ")" : literal;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the operations [start, end) into C++ expressions, pushed on `stack` like the
+/// interpreter of EvalInstance pushes the values. The value of the leaf with code `c` is
+/// `v[c]`; the codes used are added to `codes`.
+/// Return false if the operations contain a construct that cannot be compiled: only
+/// numerical operations on scalar leaves that are read directly are supported.
+
+Bool_t TTreeFormula::JitTranslate(Int_t start, Int_t end, std::vector<std::string> &stack, std::vector<Int_t> &codes)
+{
+   auto unary = [&stack](const char *prefix, const char *suffix) {
+      if (stack.empty())
+         return kFALSE;
+      stack.back() = prefix + stack.back() + suffix;
+      return kTRUE;
+   };
+   auto binary = [&stack](const char *prefix, const char *separator, const char *suffix) {
+      if (stack.size() < 2)
+         return kFALSE;
+      std::string right = std::move(stack.back());
+      stack.pop_back();
+      stack.back() = prefix + stack.back() + separator + right + suffix;
+      return kTRUE;
+   };
+
+   for (Int_t i = start; i < end; ++i) {
+      const Int_t oper = GetOper()[i];
+      const Int_t action = oper >> kTFOperShift;
+      const Int_t param = oper & kTFOperMask;
+      Bool_t ok = kTRUE;
+      switch (action) {
+         case kConstant: {
+            const Double_t value = GetConstant<Double_t>(param);
+            if (!std::isfinite(value))
+               return kFALSE;
+            stack.push_back(JitConstant(value));
+            break;
+         }
+         case kEnd: return kTRUE;
+         case kAdd: ok = binary("(", " + ", ")"); break;
+         case kSubstract: ok = binary("(", " - ", ")"); break;
+         case kMultiply: ok = binary("(", " * ", ")"); break;
+         case kDivide: ok = binary("Div(", ", ", ")"); break;
+         case kModulo: ok = binary("Double_t(Long64_t(", ") % Long64_t(", "))"); break;
+
+         case kcos: ok = unary("TMath::Cos(", ")"); break;
+         case ksin: ok = unary("TMath::Sin(", ")"); break;
+         case ktan: ok = unary("Tan(", ")"); break;
+         case kacos: ok = unary("ACos(", ")"); break;
+         case kasin: ok = unary("ASin(", ")"); break;
+         case katan: ok = unary("TMath::ATan(", ")"); break;
+         case kcosh: ok = unary("TMath::CosH(", ")"); break;
+         case ksinh: ok = unary("TMath::SinH(", ")"); break;
+         case ktanh: ok = unary("TanH(", ")"); break;
+         case kacosh: ok = unary("ACosH(", ")"); break;
+         case kasinh: ok = unary("TMath::ASinH(", ")"); break;
+         case katanh: ok = unary("ATanH(", ")"); break;
+         case katan2: ok = binary("TMath::ATan2(", ", ", ")"); break;
+
+         case kfmod: ok = binary("std::fmod(", ", ", ")"); break;
+         case kpow: ok = binary("TMath::Power(", ", ", ")"); break;
+         case ksq: ok = unary("Sq(", ")"); break;
+         case ksqrt: ok = unary("TMath::Sqrt(TMath::Abs(", "))"); break;
+         case kmin: ok = binary("std::min<Double_t>(", ", ", ")"); break;
+         case kmax: ok = binary("std::max<Double_t>(", ", ", ")"); break;
+         case klog: ok = unary("Log(", ")"); break;
+         case kexp: ok = unary("Exp(", ")"); break;
+         case klog10: ok = unary("Log10(", ")"); break;
+         case kpi: stack.push_back(JitConstant(TMath::ACos(-1))); break;
+         case kabs: ok = unary("TMath::Abs(", ")"); break;
+         case ksign: ok = unary("Sign(", ")"); break;
+         case kint: ok = unary("Double_t(Long64_t(", "))"); break;
+         case kSignInv: ok = unary("(-", ")"); break;
+
+         case kAnd: ok = binary("Double_t(", " != 0 && ", " != 0)"); break;
+         case kOr: ok = binary("Double_t(", " != 0 || ", " != 0)"); break;
+         case kEqual: ok = binary("Double_t(", " == ", ")"); break;
+         case kNotEqual: ok = binary("Double_t(", " != ", ")"); break;
+         case kLess: ok = binary("Double_t(", " < ", ")"); break;
+         case kGreater: ok = binary("Double_t(", " > ", ")"); break;
+         case kLessThan: ok = binary("Double_t(", " <= ", ")"); break;
+         case kGreaterThan: ok = binary("Double_t(", " >= ", ")"); break;
+         case kNot: ok = unary("Double_t(", " == 0)"); break;
+
+         case kBitAnd: ok = binary("Double_t(ULong64_t(", ") & ULong64_t(", "))"); break;
+         case kBitOr: ok = binary("Double_t(ULong64_t(", ") | ULong64_t(", "))"); break;
+         case kLeftShift: ok = binary("Double_t(ULong64_t(", ") << ULong64_t(", "))"); break;
+         case kRightShift: ok = binary("Double_t(ULong64_t(", ") >> ULong64_t(", "))"); break;
+
+         // The short-circuit evaluation of && and || in C++ does what the optimizer does.
+         case kBoolOptimize: break;
+
+         case kJumpIf: {
+            // cond kJumpIf(else) <true part> kJump(last) <false part up to last>
+            const Int_t elseJump = param;
+            if (stack.empty() || elseJump <= i || elseJump >= end || GetAction(elseJump) != kJump)
+               return kFALSE;
+            const Int_t last = GetActionParam(elseJump);
+            if (last < elseJump || last >= end)
+               return kFALSE;
+            const std::size_t depth = stack.size();
+            if (!JitTranslate(i + 1, elseJump, stack, codes) || stack.size() != depth + 1 ||
+                !JitTranslate(elseJump + 1, last + 1, stack, codes) || stack.size() != depth + 2)
+               return kFALSE;
+            std::string falsePart = std::move(stack.back());
+            stack.pop_back();
+            std::string truePart = std::move(stack.back());
+            stack.pop_back();
+            stack.back() = "(" + stack.back() + " != 0 ? " + truePart + " : " + falsePart + ")";
+            i = last;
+            break;
+         }
+
+         case kDefinedVariable: {
+            const Int_t code = param;
+            TLeaf *leaf = (TLeaf*)fLeaves.UncheckedAt(code);
+            if (fLookupType[code] != kDirect || fCodes[code] < 0 || fNdimensions[code] != 0 || !leaf ||
+                leaf->GetLeafCount() || IsLeafString(code))
+               return kFALSE;
+            if (std::find(codes.begin(), codes.end(), code) == codes.end())
+               codes.push_back(code);
+            stack.push_back("v[" + std::to_string(code) + "]");
+            break;
+         }
+
+         default: return kFALSE;
+      }
+      if (!ok)
+         return kFALSE;
+   }
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compile the expression with the interpreter and set fJitFunc.
+/// The functions are cached per expression, so that formulas with the same expression (e.g. the
+/// formulas created for each TTree::Draw call) are only compiled once.
+/// Return false if the expression cannot be compiled.
+
+Bool_t TTreeFormula::JitCompile()
+{
+   fJitFunc = nullptr;
+   fJitCodes.clear();
+   if (!gInterpreter || fNoper < 2 || fMultiplicity != 0 || TestBit(kIsCharacter) || IsString())
+      return kFALSE;
+
+   std::vector<std::string> stack;
+   std::vector<Int_t> codes;
+   if (!JitTranslate(0, fNoper, stack, codes) || stack.size() != 1)
+      return kFALSE;
+   const std::string &expression = stack[0];
+
+   static std::mutex cacheMutex;
+   static std::unordered_map<std::string, JitFunc_t> cache;
+   static Bool_t helpersDeclared = gInterpreter->Declare(gJitHelpers);
+
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   auto cached = cache.find(expression);
+   if (cached == cache.end()) {
+      JitFunc_t func = nullptr;
+      const std::string name = "R__TTreeFormulaJit::Eval" + std::to_string(cache.size());
+      const std::string code = "#pragma cling optimize(2)\nnamespace R__TTreeFormulaJit {\nDouble_t Eval" +
+                               std::to_string(cache.size()) + "(const Double_t *v) { return " + expression +
+                               "; }\n}";
+      if (helpersDeclared && gInterpreter->Declare(code.c_str())) {
+         TInterpreter::EErrorCode error = TInterpreter::kNoError;
+         auto address = gInterpreter->Calc(("(Longptr_t)&" + name).c_str(), &error);
+         if (error == TInterpreter::kNoError)
+            func = reinterpret_cast<JitFunc_t>(address);
+      }
+      if (!func)
+         Warning("JitCompile", "Could not compile \"%s\", it is interpreted.", GetTitle());
+      // Failures are cached as well, not to retry them.
+      cached = cache.emplace(expression, func).first;
+   }
+
+   fJitFunc = cached->second;
+   fJitCodes = std::move(codes);
+   return fJitFunc != nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Evaluate this treeformula.
 
@@ -4006,6 +4227,21 @@ T TTreeFormula::EvalInstance(Int_t instance, const char *stringStackArg[])
       }
    }
 
+   if (std::is_same<T, Double_t>::value && fgJitting && !fAxis) {
+      if (fJitStatus == 0)
+         fJitStatus = JitCompile() ? 1 : -1;
+      if (fJitStatus > 0) {
+         const Bool_t willLoad = (instance==0 || fNeedLoading); fNeedLoading = kFALSE;
+         if (willLoad) fDidBooleanOptimization = kFALSE;
+         Double_t values[kMAXCODES];
+         for (Int_t code : fJitCodes) {
+            TT_EVAL_INIT_LOOP;
+            values[code] = leaf->GetValue(real_instance);
+         }
+         return fJitFunc(values);
+      }
+   }
+
    T tab[kMAXFOUND];
    const Int_t kMAXSTRINGFOUND = 10;
    const char *stringStackLocal[kMAXSTRINGFOUND];
@@ -4978,6 +5214,19 @@ void TTreeFormula::ResetLoading()
    fRealInstanceCache.fVirtAccumCache = 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compile the numerical expressions to native code with the interpreter instead of interpreting
+/// them, for all the formulas (and e.g. TTree::Draw and TTree::Scan).
+///
+/// An expression is compiled the first time it is evaluated, and only if it consists of numerical
+/// operations, functions and conditions on scalar leaves; other expressions (with arrays, strings,
+/// aliases, methods, data members, TCutG, ...) are interpreted as before.
+
+void TTreeFormula::SetJitting(Bool_t jit)
+{
+   fgJitting = jit;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the axis (in particular get the type).
 
@@ -5073,6 +5322,8 @@ void TTreeFormula::UpdateFormulaLeaves()
 {
    Int_t nleaves = fLeafNames.GetEntriesFast();
    ResetBit( kMissingLeaf );
+   // The leaves of the new tree might not be scalars anymore.
+   fJitStatus = 0;
    for (Int_t i=0;i<nleaves;i++) {
       if (!fTree) break;
       if (!fLeafNames[i]) continue;
@@ -18,8 +18,23 @@ A Tree Index with majorname and minorname.
 #include "TTreeFormula.h"
 #include "TTree.h"
 #include "TBuffer.h"
+#include "TChain.h"
+#include "TFile.h"
 #include "TMath.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "ROOT/TTreeProcessorMT.hxx"
+#include "TROOT.h"
+#include "TTreeReader.h"
+#endif
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 ClassImp(TTreeIndex);
 
 
@@ -42,6 +57,50 @@ struct IndexSortComparator {
   Long64_t *fValMajor, *fValMinor;
 };
 
+namespace {
+
+/// With implicit multi-threading, the values of trees with at least this number of entries are read in parallel
+/// and sorted in parallel. Below, starting the tasks costs more than it saves.
+constexpr Long64_t kMinEntriesMT = 100000;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Sort the n entry numbers in index according to comp. With implicit
+/// multi-threading, parts of the array are sorted in parallel and then
+/// merged pairwise, also in parallel.
+
+void SortIndex(Long64_t *index, Long64_t n, const IndexSortComparator &comp)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && n >= kMinEntriesMT) {
+      ROOT::TThreadExecutor pool;
+      const unsigned int nChunks = std::min<Long64_t>(pool.GetPoolSize(), n / (kMinEntriesMT / 2));
+      if (nChunks > 1) {
+         std::vector<Long64_t> bounds(nChunks + 1);
+         for (unsigned int i = 0; i <= nChunks; ++i)
+            bounds[i] = n * i / nChunks;
+         pool.Foreach([&](unsigned int i) { std::sort(index + bounds[i], index + bounds[i + 1], comp); },
+                      ROOT::TSeqU(nChunks));
+         std::vector<unsigned int> firsts;
+         for (unsigned int width = 1; width < nChunks; width *= 2) {
+            firsts.clear();
+            for (unsigned int i = 0; i + width < nChunks; i += 2 * width)
+               firsts.push_back(i);
+            pool.Foreach(
+               [&](unsigned int i) {
+                  std::inplace_merge(index + bounds[i], index + bounds[i + width],
+                                     index + bounds[std::min(i + 2 * width, nChunks)], comp);
+               },
+               firsts);
+         }
+         return;
+      }
+   }
+#endif
+   std::sort(index, index + n, comp);
+}
+
+} // anonymous namespace
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor for TTreeIndex
@@ -122,6 +181,11 @@ TTreeIndex::TTreeIndex(): TVirtualIndex()
 ///
 /// It is possible to play with different TreeIndex in the same Tree.
 /// see comments in TTree::SetTreeIndex.
+///
+/// With implicit multi-threading enabled, the values of a large tree read
+/// from a file that is not open for writing are evaluated in parallel over
+/// its clusters (see ROOT::TTreeProcessorMT), and the index is sorted in
+/// parallel.
 
 TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorname)
            : TVirtualIndex()
@@ -169,7 +233,70 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
    Long64_t i;
    Long64_t oldEntry = fTree->GetReadEntry();
    Int_t current = -1;
-   for (i=0;i<fN;i++) {
+   auto GetAndRangeCheck = [this](TTreeFormula *formula, bool isMajor, Long64_t entry) {
+      LongDouble_t ret = formula->EvalInstance<LongDouble_t>();
+      // Check whether the value (vs significant bits) of ldRet can represent
+      // the full precision of the returned value. If we return 10^60, the
+      // value fits into a long double, but if sizeof(long double) ==
+      // sizeof(double) it cannot store the ones: the value returned by
+      // EvalInstance() only stores the higher bits.
+      LongDouble_t retCloserToZero = ret;
+      if (ret > 0)
+         retCloserToZero -= 1;
+      else
+         retCloserToZero += 1;
+      if (retCloserToZero == ret) {
+         Warning("TTreeIndex",
+                 "In tree entry %lld, %s value %s=%Lf possibly out of range for internal `long double`", entry,
+                 isMajor ? "major" : "minor", isMajor ? fMajorName.Data() : fMinorName.Data(), ret);
+      }
+      return ret;
+   };
+   Bool_t filled = kFALSE;
+#ifdef R__USE_IMT
+   TFile *file = fTree->GetCurrentFile();
+   if (ROOT::IsImplicitMTEnabled() && fN >= kMinEntriesMT && !fTree->InheritsFrom(TChain::Class()) && file &&
+       !file->IsWritable()) {
+      // Each task reads a cluster range through its own copy of the tree
+      std::mutex formulaMutex;
+      auto fillRange = [&](TTreeReader &reader) {
+         std::unique_ptr<TTreeFormula> major, minor;
+         TTree *tree = reader.GetTree();
+         Int_t treeNumber = -1;
+         while (reader.Next()) {
+            const Long64_t entry = reader.GetCurrentEntry();
+            if (!major) {
+               std::lock_guard<std::mutex> lock(formulaMutex);
+               major.reset(new TTreeFormula("Major", fMajorName.Data(), tree));
+               minor.reset(new TTreeFormula("Minor", fMinorName.Data(), tree));
+               major->SetQuickLoad(kTRUE);
+               minor->SetQuickLoad(kTRUE);
+               treeNumber = tree->GetTreeNumber();
+            }
+            if (tree->GetTreeNumber() != treeNumber) {
+               treeNumber = tree->GetTreeNumber();
+               major->UpdateFormulaLeaves();
+               minor->UpdateFormulaLeaves();
+            }
+            if (entry < 0 || entry >= fN)
+               continue;
+            tmp_major[entry] = GetAndRangeCheck(major.get(), true, entry);
+            tmp_minor[entry] = GetAndRangeCheck(minor.get(), false, entry);
+         }
+         std::lock_guard<std::mutex> lock(formulaMutex);
+         major.reset();
+         minor.reset();
+      };
+      try {
+         ROOT::TTreeProcessorMT processor(*fTree);
+         processor.Process(fillRange);
+         filled = kTRUE;
+      } catch (const std::exception &e) {
+         Warning("TTreeIndex", "Cannot read the tree in parallel (%s), reading it sequentially", e.what());
+      }
+   }
+#endif
+   for (i=0;!filled && i<fN;i++) {
       Long64_t centry = fTree->LoadTree(i);
       if (centry < 0) break;
       if (fTree->GetTreeNumber() != current) {
@@ -177,40 +304,23 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
          fMajorFormula->UpdateFormulaLeaves();
          fMinorFormula->UpdateFormulaLeaves();
       }
-      auto GetAndRangeCheck = [this](bool isMajor, Long64_t entry) {
-         LongDouble_t ret = (isMajor ? fMajorFormula : fMinorFormula)->EvalInstance<LongDouble_t>();
-         // Check whether the value (vs significant bits) of ldRet can represent
-         // the full precision of the returned value. If we return 10^60, the
-         // value fits into a long double, but if sizeof(long double) ==
-         // sizeof(double) it cannot store the ones: the value returned by
-         // EvalInstance() only stores the higher bits.
-         LongDouble_t retCloserToZero = ret;
-         if (ret > 0)
-            retCloserToZero -= 1;
-         else
-            retCloserToZero += 1;
-         if (retCloserToZero == ret) {
-            Warning("TTreeIndex",
-                    "In tree entry %lld, %s value %s=%Lf possibly out of range for internal `long double`", entry,
-                    isMajor ? "major" : "minor", isMajor ? fMajorName.Data() : fMinorName.Data(), ret);
-         }
-         return ret;
-      };
-      tmp_major[i] = GetAndRangeCheck(true, i);
-      tmp_minor[i] = GetAndRangeCheck(false, i);
+      tmp_major[i] = GetAndRangeCheck(fMajorFormula, true, i);
+      tmp_minor[i] = GetAndRangeCheck(fMinorFormula, false, i);
    }
    fIndex = new Long64_t[fN];
    for(i = 0; i < fN; i++) { fIndex[i] = i; }
-   std::sort(fIndex, fIndex + fN, IndexSortComparator(tmp_major, tmp_minor) );
+   SortIndex(fIndex, fN, IndexSortComparator(tmp_major, tmp_minor));
    //TMath::Sort(fN,w,fIndex,0);
+   // Release each temporary array as soon as it is copied to limit the peak memory usage
    fIndexValues = new Long64_t[fN];
-   fIndexValuesMinor = new Long64_t[fN];
    for (i=0;i<fN;i++) {
       fIndexValues[i] = tmp_major[fIndex[i]];
-      fIndexValuesMinor[i] = tmp_minor[fIndex[i]];
    }
-
    delete [] tmp_major;
+   fIndexValuesMinor = new Long64_t[fN];
+   for (i=0;i<fN;i++) {
+      fIndexValuesMinor[i] = tmp_minor[fIndex[i]];
+   }
    delete [] tmp_minor;
    fTree->LoadTree(oldEntry);
 }
@@ -290,7 +400,7 @@ void TTreeIndex::Append(const TVirtualIndex *add, Bool_t delaySort )
       Long64_t *conv = new Long64_t[fN];
 
       for(Long64_t i = 0; i < fN; i++) { conv[i] = i; }
-      std::sort(conv, conv+fN, IndexSortComparator(addValues, addValues2) );
+      SortIndex(conv, fN, IndexSortComparator(addValues, addValues2));
       //Long64_t *w = fIndexValues;
       //TMath::Sort(fN,w,conv,0);
 
@@ -67,6 +67,15 @@ The Draw or Print functions print the following information:
  -  ReadRT    = Zipped MBytes per RT second
  -  ReadCP    = Zipped MBytes per CP second
 
+With the option "unzip", Print() also shows the time spent unzipping and,
+if the tree was read with a TTreeCacheUnzip, its basket statistics:
+ -  UnzipHits = Baskets already unzipped by the parallel unzipping tasks
+ -  UnzipStal = Baskets for which the main thread waited for the unzipping task
+ -  UnzipMiss = Baskets unzipped by the main thread itself
+A large number of stalls or misses indicates that the unzipping does not keep
+up with the processing, see TTreeCacheUnzip::SetUnzipNClusters() and
+TTreeCacheUnzip::SetUnzipGroupSize().
+
  ### NOTE 1 :
 The ReadTotal value indicates the effective number of zipped bytes
 returned to the application. The physical number of bytes read
@@ -85,6 +94,7 @@ The Physical disk speed is DiskIO + DiskIO*ReadExtra/100.
 #include "TFile.h"
 #include "TTree.h"
 #include "TTreeCache.h"
+#include "TTreeCacheUnzip.h"
 #include "TAxis.h"
 #include "TBranch.h"
 #include "TBrowser.h"
@@ -128,6 +138,9 @@ TTreePerfStats::TTreePerfStats() : TVirtualPerfStats()
    fUnzipInputSize= 0;
    fUnzipObjSize  = 0;
    fCompress      = 0;
+   fUnzipNFound   = 0;
+   fUnzipNStalls  = 0;
+   fUnzipNMissed  = 0;
    fRealTimeAxis  = 0;
    fHostInfoText  = 0;
 }
@@ -165,6 +178,9 @@ TTreePerfStats::TTreePerfStats(const char *name, TTree *T) : TVirtualPerfStats()
    fUnzipTime     = 0;
    fUnzipInputSize= 0;
    fUnzipObjSize  = 0;
+   fUnzipNFound   = 0;
+   fUnzipNStalls  = 0;
+   fUnzipNMissed  = 0;
    fRealTimeAxis  = 0;
    fCompress      = (T->GetTotBytes()+0.00001)/T->GetZipBytes();
 
@@ -341,6 +357,13 @@ void TTreePerfStats::Finish()
    fCpuTime       = fWatch->CpuTime();
    if (fUnzipInputSize)
       fCompress = ((double)fUnzipObjSize) / fUnzipInputSize;
+   if (TFile *file = fTree->GetCurrentFile()) {
+      if (auto unzipCache = dynamic_cast<TTreeCacheUnzip *>(file->GetCacheRead(fTree))) {
+         fUnzipNFound = unzipCache->GetNFound();
+         fUnzipNStalls = unzipCache->GetNStalls();
+         fUnzipNMissed = unzipCache->GetNMissed();
+      }
+   }
    Int_t npoints  = fGraphIO->GetN();
    if (!npoints) return;
    Double_t iomax = TMath::MaxElement(npoints,fGraphIO->GetY());
@@ -561,6 +584,11 @@ void TTreePerfStats::Print(Option_t * option) const
    if (unzip) {
       printf("Strm Time = %7.3f seconds\n",fCpuTime-fUnzipTime);
       printf("UnzipTime = %7.3f seconds\n",fUnzipTime);
+      if (fUnzipNFound + fUnzipNStalls + fUnzipNMissed) {
+         printf("UnzipHits = %d baskets\n",fUnzipNFound);
+         printf("UnzipStal = %d baskets\n",fUnzipNStalls);
+         printf("UnzipMiss = %d baskets\n",fUnzipNMissed);
+      }
    }
    printf("Disk IO   = %7.3f MBytes/s\n",1e-6*fBytesRead/fDiskTime);
    printf("ReadUZRT  = %7.3f MBytes/s\n",1e-6*fCompress*fBytesRead/fRealTime);
@@ -26,6 +26,10 @@ objects.
 
 #include "TROOT.h"
 #include "ROOT/TTreeProcessorMT.hxx"
+#include "TChainElement.h"
+
+#include <algorithm>
+#include <atomic>
 
 using namespace ROOT;
 
@@ -65,31 +69,39 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
    const bool listHasGlobalEntryNumbers = entryList.GetLists() == nullptr;
    const auto nFiles = clusters.size();
 
-   std::unique_ptr<TChain> chain;
-   using NextFn_t = Long64_t (*)(Long64_t &, TEntryList &, TChain *);
-   // A function that advances TEntryList and returns global entry numbers or -1 if we reached the end
-   // (might or might not need a TChain depending on whether listHasGlobalEntryNumbers)
-   NextFn_t Next;
    if (listHasGlobalEntryNumbers) {
-      Next = [](Long64_t &elEntry, TEntryList &elist, TChain *) {
-         ++elEntry;
-         return elist.Next();
-      };
-   } else {
-      // we need `chain` to be able to convert local entry numbers to global entry numbers in `Next`
-      chain = ROOT::Internal::TreeUtils::MakeChainForMT();
-      for (auto i = 0u; i < nFiles; ++i)
-         chain->Add((fileNames[i] + "?#" + treeNames[i]).c_str(), entriesPerFile[i]);
-      Next = [](Long64_t &elEntry, TEntryList &elist, TChain *ch) {
-         ++elEntry;
-         int treenum = -1;
-         Long64_t localEntry = elist.GetEntryAndTree(elEntry, treenum);
-         if (localEntry == -1ll)
-            return localEntry;
-         return localEntry + ch->GetTreeOffset()[treenum];
-      };
+      // The entry list ranges are the numbers of entries of the list before the cluster boundaries,
+      // which TEntryList counts per block without iterating over the entries
+      std::vector<std::vector<EntryRange>> elistClusters;
+      Long64_t elistRangeStart = 0ll;
+      for (auto fileN = 0u; fileN < nFiles; ++fileN) {
+         std::vector<EntryRange> elistClustersForFile;
+         for (const auto &c : clusters[fileN]) {
+            const Long64_t elistRangeEnd = entryList.GetNEntriesBefore(c.second);
+            if (elistRangeEnd > elistRangeStart) // otherwise no entrylist entries in this cluster
+               elistClustersForFile.emplace_back(EntryRange{elistRangeStart, elistRangeEnd});
+            elistRangeStart = elistRangeEnd;
+         }
+         elistClusters.emplace_back(std::move(elistClustersForFile));
+      }
+      R__ASSERT(ClustersAreSortedAndContiguous(elistClusters));
+      return elistClusters;
    }
 
+   // we need `chain` to be able to convert local entry numbers to global entry numbers in `Next`
+   std::unique_ptr<TChain> chain = ROOT::Internal::TreeUtils::MakeChainForMT();
+   for (auto i = 0u; i < nFiles; ++i)
+      chain->Add((fileNames[i] + "?#" + treeNames[i]).c_str(), entriesPerFile[i]);
+   // A function that advances TEntryList and returns global entry numbers or -1 if we reached the end
+   auto Next = [](Long64_t &elEntry, TEntryList &elist, TChain *ch) {
+      ++elEntry;
+      int treenum = -1;
+      Long64_t localEntry = elist.GetEntryAndTree(elEntry, treenum);
+      if (localEntry == -1ll)
+         return localEntry;
+      return localEntry + ch->GetTreeOffset()[treenum];
+   };
+
    // the call to GetEntry also serves the purpose to reset TEntryList::fLastIndexQueried,
    // so we can be sure TEntryList::Next will return the correct thing
    Long64_t elistEntry = 0ll;
@@ -124,9 +136,12 @@ using ClustersAndEntries = std::pair<std::vector<std::vector<EntryRange>>, std::
 
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector of cluster boundaries for the given tree and files.
+/// The files whose cluster boundaries are given in `knownBoundaries` (cluster starts followed by the
+/// number of entries, see TChain::PrefetchMetadata()) are not opened.
 static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
-                                       const std::vector<std::string> &fileNames, const unsigned int maxTasksPerFile,
-                                       const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()})
+                                       const std::vector<std::string> &fileNames,
+                                       const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()},
+                                       const std::vector<std::vector<Long64_t>> &knownBoundaries = {})
 {
    // Note that as a side-effect of opening all files that are going to be used in the
    // analysis once, all necessary streamers will be loaded into memory.
@@ -141,30 +156,42 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
       const auto &fileName = fileNames[i];
       const auto &treeName = treeNames[i];
 
-      std::unique_ptr<TFile> f(TFile::Open(
-         fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION")); // need TFile::Open to load plugins if need be
-      if (!f || f->IsZombie()) {
-         const auto msg = "TTreeProcessorMT::Process: an error occurred while opening file \"" + fileName + "\"";
-         throw std::runtime_error(msg);
-      }
-      auto *t = f->Get<TTree>(treeName.c_str()); // t will be deleted by f
+      std::vector<Long64_t> boundaries;
+      if (i < knownBoundaries.size() && !knownBoundaries[i].empty()) {
+         boundaries = knownBoundaries[i];
+      } else {
+         std::unique_ptr<TFile> f(TFile::Open(
+            fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION")); // need TFile::Open to load plugins if need be
+         if (!f || f->IsZombie()) {
+            const auto msg = "TTreeProcessorMT::Process: an error occurred while opening file \"" + fileName + "\"";
+            throw std::runtime_error(msg);
+         }
+         auto *t = f->Get<TTree>(treeName.c_str()); // t will be deleted by f
+
+         if (!t) {
+            const auto msg = "TTreeProcessorMT::Process: an error occurred while getting tree \"" + treeName +
+                             "\" from file \"" + fileName + "\"";
+            throw std::runtime_error(msg);
+         }
 
-      if (!t) {
-         const auto msg = "TTreeProcessorMT::Process: an error occurred while getting tree \"" + treeName +
-                          "\" from file \"" + fileName + "\"";
-         throw std::runtime_error(msg);
+         // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
+         t->ResetBit(kMustCleanup);
+         ROOT::Internal::TreeUtils::ClearMustCleanupBits(*t->GetListOfBranches());
+         auto clusterIter = t->GetClusterIterator(0);
+         Long64_t clusterStart = 0ll;
+         const Long64_t treeEntries = t->GetEntries();
+         while ((clusterStart = clusterIter()) < treeEntries)
+            boundaries.emplace_back(clusterStart);
+         boundaries.emplace_back(treeEntries);
       }
 
-      // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
-      t->ResetBit(kMustCleanup);
-      ROOT::Internal::TreeUtils::ClearMustCleanupBits(*t->GetListOfBranches());
-      auto clusterIter = t->GetClusterIterator(0);
       Long64_t clusterStart = 0ll, clusterEnd = 0ll;
-      const Long64_t entries = t->GetEntries();
+      const Long64_t entries = boundaries.back();
       // Iterate over the clusters in the current file
       std::vector<EntryRange> entryRanges;
-      while ((clusterStart = clusterIter()) < entries && !rangeEndReached) {
-         clusterEnd = clusterIter.GetNextEntry();
+      for (std::size_t c = 0; c + 1 < boundaries.size() && !rangeEndReached; ++c) {
+         clusterStart = boundaries[c];
+         clusterEnd = boundaries[c + 1];
          // Currently, if a user specified a range, the clusters will be only globally obtained
          // Assume that there are 3 files with entries: [0, 100], [0, 150], [0, 200] (in this order)
          // Since the cluster boundaries are obtained sequentially, applying the offsets, the boundaries
@@ -193,6 +220,13 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
                              "but the starting entry (" + range.first + ") is larger than the total number of " +
                              "entries (" + offset + ") in the dataset.");
 
+   return std::make_pair(std::move(clustersPerFile), std::move(entriesPerFile));
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Return the tasks for the given number of clusters of a file, as [first, last) ranges of cluster indexes.
+static std::vector<std::pair<std::size_t, std::size_t>> MakeTasks(std::size_t nClusters, unsigned int maxTasksPerFile)
+{
    // Here we "fuse" clusters together if the number of clusters is too big with respect to
    // the number of slots, otherwise we can incur in an overhead which is big enough
    // to make parallelisation detrimental to performance.
@@ -207,40 +241,90 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
    // The criterion according to which we fuse clusters together is to have around
    // TTreeProcessorMT::GetTasksPerWorkerHint() clusters per slot.
    // Concretely, for each file we will cap the number of tasks to ceil(GetTasksPerWorkerHint() * nWorkers / nFiles).
-
-   std::vector<std::vector<EntryRange>> eventRangesPerFile(clustersPerFile.size());
-   auto clustersPerFileIt = clustersPerFile.begin();
-   auto eventRangesPerFileIt = eventRangesPerFile.begin();
-   for (; clustersPerFileIt != clustersPerFile.end(); clustersPerFileIt++, eventRangesPerFileIt++) {
-      const auto clustersInThisFileSize = clustersPerFileIt->size();
-      const auto nFolds = clustersInThisFileSize / maxTasksPerFile;
-      // If the number of clusters is less than maxTasksPerFile
-      // we take the clusters as they are
-      if (nFolds == 0) {
-         *eventRangesPerFileIt = std::move(*clustersPerFileIt);
-         continue;
+   std::vector<std::pair<std::size_t, std::size_t>> tasks;
+   const auto nFolds = nClusters / maxTasksPerFile;
+   // If the number of clusters is less than maxTasksPerFile
+   // we take the clusters as they are
+   if (nFolds == 0) {
+      for (std::size_t i = 0; i < nClusters; ++i)
+         tasks.emplace_back(i, i + 1);
+      return tasks;
+   }
+   // Otherwise, we have to merge clusters, distributing the reminder evenly
+   // onto the first clusters
+   auto nReminderClusters = nClusters % maxTasksPerFile;
+   for (std::size_t i = 0; i < nClusters; ++i) {
+      const auto first = i;
+      // We lump together at least nFolds clusters, therefore
+      // we need to jump ahead of nFolds-1.
+      i += (nFolds - 1);
+      // We now add a cluster if we have some reminder left
+      if (nReminderClusters > 0) {
+         i += 1U;
+         nReminderClusters--;
       }
-      // Otherwise, we have to merge clusters, distributing the reminder evenly
-      // onto the first clusters
-      auto nReminderClusters = clustersInThisFileSize % maxTasksPerFile;
-      const auto &clustersInThisFile = *clustersPerFileIt;
-      for (auto i = 0ULL; i < clustersInThisFileSize; ++i) {
-         const auto start = clustersInThisFile[i].first;
-         // We lump together at least nFolds clusters, therefore
-         // we need to jump ahead of nFolds-1.
-         i += (nFolds - 1);
-         // We now add a cluster if we have some reminder left
-         if (nReminderClusters > 0) {
-            i += 1U;
-            nReminderClusters--;
+      tasks.emplace_back(first, i + 1);
+   }
+   return tasks;
+}
+
+/// Runs the tasks of TTreeProcessorMT::Process and, with dynamic scheduling, splits them while workers are idle
+class RTaskScheduler {
+   ROOT::TThreadExecutor &fPool;
+   const std::function<void(TTreeReader &)> &fFunc;
+   const unsigned int fPoolSize;
+   const bool fIsDynamic;
+   std::atomic<std::size_t> fNPending{0}; ///< Tasks that have been created but not yet started
+   std::atomic<unsigned int> fNBusy{0};   ///< Workers that are currently processing entries
+
+   /// There is no task left for the workers that are not busy
+   bool HasIdleWorkers() const { return fNPending == 0 && fNBusy + 1 < fPoolSize; }
+
+public:
+   RTaskScheduler(ROOT::TThreadExecutor &pool, const std::function<void(TTreeReader &)> &func, bool isDynamic)
+      : fPool(pool), fFunc(func), fPoolSize(pool.GetPoolSize()), fIsDynamic(isDynamic)
+   {
+   }
+
+   void AddPending(std::size_t nTasks) { fNPending += nTasks; }
+   void SetStarted() { --fNPending; }
+
+   /// Process the clusters [first, last) of a file. Without dynamic scheduling, the user function is called once
+   /// for the whole range. Otherwise, the task processes its clusters in chunks of decreasing size. Whenever another
+   /// worker runs out of work, the remaining clusters are split into two new tasks. These tasks contain consecutive
+   /// clusters of the same file, so that the workers that pick them up keep reading from the file they were reading.
+   template <typename MakeReader_t>
+   void
+   Run(const std::vector<EntryRange> &clusters, std::size_t first, std::size_t last, const MakeReader_t &makeReader)
+   {
+      while (first < last) {
+         if (fIsDynamic && last - first > 1 && HasIdleWorkers()) {
+            const auto middle = first + (last - first) / 2;
+            const std::vector<std::pair<std::size_t, std::size_t>> halves{{first, middle}, {middle, last}};
+            AddPending(halves.size());
+            fPool.Foreach(
+               [&](const std::pair<std::size_t, std::size_t> &half) {
+                  SetStarted();
+                  Run(clusters, half.first, half.second, makeReader);
+               },
+               halves);
+            return;
          }
-         const auto end = clustersInThisFile[i].second;
-         eventRangesPerFileIt->emplace_back(EntryRange({start, end}));
+
+         const auto chunkEnd = fIsDynamic ? first + std::max<std::size_t>(1, (last - first) / 2) : last;
+         auto r = makeReader(EntryRange{clusters[first].first, clusters[chunkEnd - 1].second});
+         ++fNBusy;
+         try {
+            fFunc(*r);
+         } catch (...) {
+            --fNBusy;
+            throw;
+         }
+         --fNBusy;
+         first = chunkEnd;
       }
    }
-
-   return std::make_pair(std::move(eventRangesPerFile), std::move(entriesPerFile));
-}
+};
 
 } // anonymous namespace
 
@@ -350,6 +434,27 @@ std::vector<std::string> TTreeProcessorMT::FindTreeNames()
    return treeNames;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Retrieve, for each file of a TChain, the cluster boundaries stored by TChain::PrefetchMetadata().
+/// Returns an empty vector if the tree is not a chain or if none of the boundaries are known.
+std::vector<std::vector<Long64_t>> TTreeProcessorMT::GetKnownClusterBoundaries(TTree &tree)
+{
+   std::vector<std::vector<Long64_t>> boundaries;
+   auto chain = dynamic_cast<TChain *>(&tree);
+   if (!chain || !chain->GetListOfFiles())
+      return boundaries;
+
+   bool anyKnown = false;
+   for (auto *obj : *chain->GetListOfFiles()) {
+      const auto &elementBoundaries = static_cast<TChainElement *>(obj)->GetClusterBoundaries();
+      anyKnown |= !elementBoundaries.empty();
+      boundaries.emplace_back(elementBoundaries);
+   }
+   if (!anyKnown)
+      boundaries.clear();
+   return boundaries;
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Constructor based on a file name.
 /// \param[in] filename Name of the file containing the tree to process.
@@ -412,7 +517,8 @@ TTreeProcessorMT::TTreeProcessorMT(TTree &tree, const TEntryList &entries, UInt_
      fTreeNames(Internal::TreeUtils::GetTreeFullPaths(tree)),
      fEntryList(entries),
      fFriendInfo(Internal::TreeUtils::GetFriendInfo(tree, /*retrieveEntries*/ true)),
-     fPool(nThreads)
+     fPool(nThreads),
+     fClusterBoundaries(GetKnownClusterBoundaries(tree))
 {
    ROOT::EnableThreadSafety();
 }
@@ -428,6 +534,7 @@ TTreeProcessorMT::TTreeProcessorMT(TTree &tree, UInt_t nThreads, const EntryRang
      fTreeNames(Internal::TreeUtils::GetTreeFullPaths(tree)),
      fFriendInfo(Internal::TreeUtils::GetFriendInfo(tree, /*retrieveEntries*/ true)),
      fPool(nThreads),
+     fClusterBoundaries(GetKnownClusterBoundaries(tree)),
      fGlobalRange(globalRange)
 {
 }
@@ -468,34 +575,53 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    auto &allClusters = allClusterAndEntries.first;
    const auto &allEntries = allClusterAndEntries.second;
    if (shouldRetrieveAllClusters) {
-      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile, fGlobalRange);
+      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, fGlobalRange, fClusterBoundaries);
       if (hasEntryList)
          allClusters = ConvertToElistClusters(std::move(allClusters), fEntryList, fTreeNames, fFileNames, allEntries);
    }
 
+   RTaskScheduler scheduler(fPool, func, fDynamicScheduling);
+
    // Per-file processing in case we retrieved all cluster info upfront
    auto processFileUsingGlobalClusters = [&](std::size_t fileIdx) {
-      auto processCluster = [&](const EntryRange &c) {
-         auto r =
-            fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList, allEntries);
-         func(*r);
+      scheduler.SetStarted();
+      const auto &clusters = allClusters[fileIdx];
+      auto makeReader = [&](const EntryRange &c) {
+         return fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList,
+                                         allEntries);
       };
-      fPool.Foreach(processCluster, allClusters[fileIdx]);
+      const auto tasks = MakeTasks(clusters.size(), maxTasksPerFile);
+      scheduler.AddPending(tasks.size());
+      auto processTask = [&](const std::pair<std::size_t, std::size_t> &t) {
+         scheduler.SetStarted();
+         scheduler.Run(clusters, t.first, t.second, makeReader);
+      };
+      fPool.Foreach(processTask, tasks);
    };
 
    // Per-file processing that also retrieves cluster info for a file
    auto processFileRetrievingClusters = [&](std::size_t fileIdx) {
+      scheduler.SetStarted();
       // Evaluate clusters (with local entry numbers) and number of entries for this file
       const auto &treeNames = std::vector<std::string>({fTreeNames[fileIdx]});
       const auto &fileNames = std::vector<std::string>({fFileNames[fileIdx]});
-      const auto clustersAndEntries = MakeClusters(treeNames, fileNames, maxTasksPerFile);
+      const auto clustersAndEntries =
+         fClusterBoundaries.empty()
+            ? MakeClusters(treeNames, fileNames)
+            : MakeClusters(treeNames, fileNames, {0, std::numeric_limits<Long64_t>::max()},
+                           {fClusterBoundaries[fileIdx]});
       const auto &clusters = clustersAndEntries.first[0];
       const auto &entries = clustersAndEntries.second[0];
-      auto processCluster = [&](const EntryRange &c) {
-         auto r = fTreeView->GetTreeReader(c.first, c.second, treeNames, fileNames, fFriendInfo, fEntryList, {entries});
-         func(*r);
+      auto makeReader = [&](const EntryRange &c) {
+         return fTreeView->GetTreeReader(c.first, c.second, treeNames, fileNames, fFriendInfo, fEntryList, {entries});
+      };
+      const auto tasks = MakeTasks(clusters.size(), maxTasksPerFile);
+      scheduler.AddPending(tasks.size());
+      auto processTask = [&](const std::pair<std::size_t, std::size_t> &t) {
+         scheduler.SetStarted();
+         scheduler.Run(clusters, t.first, t.second, makeReader);
       };
-      fPool.Foreach(processCluster, clusters);
+      fPool.Foreach(processTask, tasks);
    };
 
    const auto firstNonEmpty =
@@ -506,6 +632,7 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    std::vector<std::size_t> fileIdxs(allEntries.empty() ? fFileNames.size() : allEntries.size() - firstNonEmpty);
    std::iota(fileIdxs.begin(), fileIdxs.end(), firstNonEmpty);
 
+   scheduler.AddPending(fileIdxs.size());
    if (shouldRetrieveAllClusters)
       fPool.Foreach(processFileUsingGlobalClusters, fileIdxs);
    else
@@ -12,6 +12,7 @@
 #include "TTreeReaderArray.h"
 
 #include "TBranchClones.h"
+#include "TBufferFile.h"
 #include "TBranchElement.h"
 #include "TBranchRef.h"
 #include "TBranchSTL.h"
@@ -30,7 +31,9 @@
 #include "TGenCollectionProxy.h"
 #include "TRegexp.h"
 
+#include <cstring>
 #include <memory>
+#include <vector>
 
 // pin vtable
 ROOT::Internal::TVirtualCollectionReader::~TVirtualCollectionReader() {}
@@ -387,6 +390,93 @@ namespace {
          return TDynamicArrayReader<TLeafReader>::GetSize(proxy);
       }
    };
+
+   // Reader interface for the collections of basic types that TBranchElement::GetBulkCollectionEntries() reads
+   // a basket at a time. The values of all the entries of the basket are stored contiguously, so that they
+   // can be accessed without streaming each entry into a collection object. The entries that cannot be read in
+   // bulk are read by the fallback reader and copied to the same contiguous layout.
+   class TBulkCollectionReader final : public TVirtualCollectionReader {
+   private:
+      std::unique_ptr<TVirtualCollectionReader> fFallback;
+      TTreeReader *fTreeReader;
+      Int_t fValueSize;
+      Bool_t fBulkDisabled = kFALSE; ///< Set after the first failed bulk read
+
+      TBufferFile fValues{TBuffer::kWrite, 32 * 1024}; ///< The values of the cached entries
+      std::vector<Int_t> fOffsets;  ///< Index of the first value of each cached entry, plus the total number of values
+      TBranch *fBranch = nullptr;   ///< Branch from which the cached entries were read
+      Int_t fTreeNumber = -1;       ///< Tree number of the tree reader when the cached entries were read
+      Long64_t fFirstEntry = -1;    ///< First cached entry
+      Long64_t fEntry = -1;         ///< Current entry
+
+      Bool_t IsCached(TBranch *branch, Long64_t entry) const
+      {
+         return branch == fBranch && fTreeReader->GetTree()->GetTreeNumber() == fTreeNumber && entry >= fFirstEntry &&
+                entry < fFirstEntry + static_cast<Long64_t>(fOffsets.size()) - 1;
+      }
+
+      // Load the basket of the current entry, or only the current entry through the fallback reader
+      Bool_t Load(ROOT::Detail::TBranchProxy *proxy)
+      {
+         if (!proxy->IsInitialized() && !proxy->Setup()) {
+            fReadStatus = TTreeReaderValueBase::kReadError;
+            Error("TBulkCollectionReader::Load()", "Unable to initialize %s", proxy->GetBranchName());
+            return kFALSE;
+         }
+         TBranch *branch = proxy->GetBranch();
+         fEntry = proxy->GetReadEntry();
+         if (IsCached(branch, fEntry))
+            return kTRUE;
+
+         fBranch = branch;
+         fTreeNumber = fTreeReader->GetTree()->GetTreeNumber();
+         fFirstEntry = fEntry;
+         if (!fBulkDisabled) {
+            auto branchElement = dynamic_cast<TBranchElement *>(branch);
+            if (branchElement && branchElement->GetBulkCollectionValueSize() == fValueSize &&
+                branchElement->GetBulkCollectionEntries(fEntry, fValues, fOffsets) > 0) {
+               fReadStatus = TTreeReaderValueBase::kReadSuccess;
+               return kTRUE;
+            }
+            fBulkDisabled = kTRUE;
+         }
+
+         const size_t size = fFallback->GetSize(proxy);
+         fReadStatus = fFallback->fReadStatus;
+         if (fReadStatus != TTreeReaderValueBase::kReadSuccess) {
+            fOffsets.clear();
+            return kFALSE;
+         }
+         if (fValues.BufferSize() < static_cast<Int_t>(size) * fValueSize)
+            fValues.Expand(size * fValueSize, kFALSE);
+         for (size_t i = 0; i < size; ++i)
+            memcpy(fValues.Buffer() + i * fValueSize, fFallback->At(proxy, i), fValueSize);
+         fOffsets.assign({0, static_cast<Int_t>(size)});
+         return kTRUE;
+      }
+
+   public:
+      TBulkCollectionReader(std::unique_ptr<TVirtualCollectionReader> fallback, TTreeReader *treeReader,
+                            Int_t valueSize)
+         : fFallback(std::move(fallback)), fTreeReader(treeReader), fValueSize(valueSize)
+      {
+      }
+
+      size_t GetSize(ROOT::Detail::TBranchProxy *proxy) override
+      {
+         if (!Load(proxy))
+            return 0;
+         const auto i = fEntry - fFirstEntry;
+         return fOffsets[i + 1] - fOffsets[i];
+      }
+
+      void *At(ROOT::Detail::TBranchProxy *proxy, size_t idx) override
+      {
+         if (!Load(proxy))
+            return nullptr;
+         return fValues.Buffer() + (fOffsets[fEntry - fFirstEntry] + idx) * fValueSize;
+      }
+   };
 }
 
 
@@ -643,6 +733,19 @@ bool ROOT::Internal::TTreeReaderArrayBase::GetBranchAndLeaf(TBranch* &branch, TL
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the collections of the branch a basket at a time if the branch supports
+/// it, falling back to the current fImpl for the entries that cannot be read in bulk.
+
+void ROOT::Internal::TTreeReaderArrayBase::UseBulkCollectionReader(TBranchElement *branchElement)
+{
+   const Int_t valueSize = branchElement->GetBulkCollectionValueSize();
+   if (valueSize == 0 || !fDict || fDict->IsA() != TDataType::Class() ||
+       static_cast<TDataType *>(fDict)->Size() != valueSize)
+      return;
+   fImpl = std::make_unique<TBulkCollectionReader>(std::move(fImpl), fTreeReader, valueSize);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create the TVirtualCollectionReader object for our branch.
 
@@ -716,6 +819,7 @@ void ROOT::Internal::TTreeReaderArrayBase::SetImpl(TBranch* branch, TLeaf* myLea
          else if (element->IsA() == TStreamerBasicType::Class()){
             if (branchElement->GetType() == TBranchElement::kSTLMemberNode){
                fImpl = std::make_unique<TBasicTypeArrayReader>();
+               UseBulkCollectionReader(branchElement);
             }
             else if (branchElement->GetType() == TBranchElement::kClonesMemberNode){
                fImpl = std::make_unique<TBasicTypeClonesReader>(element->GetOffset());
@@ -744,6 +848,7 @@ void ROOT::Internal::TTreeReaderArrayBase::SetImpl(TBranch* branch, TLeaf* myLea
       else { // We are at root node?
          if (branchElement->GetClass()->GetCollectionProxy()){
             fImpl = std::make_unique<TCollectionLessSTLReader>(branchElement->GetClass()->GetCollectionProxy());
+            UseBulkCollectionReader(branchElement);
          }
       }
    } else if (branch->IsA() == TBranch::Class()) {
@@ -18,7 +18,9 @@
 #include "TBranchSTL.h"
 #include "TBranchObject.h"
 #include "TBranchProxyDirector.h"
+#include "TBufferFile.h"
 #include "TClassEdit.h"
+#include "TDataType.h"
 #include "TEnum.h"
 #include "TFriendElement.h"
 #include "TFriendProxy.h"
@@ -29,6 +31,8 @@
 #include "TStreamerElement.h"
 #include "TNtuple.h"
 #include "TROOT.h"
+#include "TMath.h"
+#include <cstring>
 #include <vector>
 
 // clang-format off
@@ -106,6 +110,8 @@ ROOT::Internal::TTreeReaderValueBase::operator=(const TTreeReaderValueBase& rhs)
       fSetupStatus = rhs.fSetupStatus;
       fReadStatus = rhs.fReadStatus;
       fStaticClassOffsets = rhs.fStaticClassOffsets;
+      fProxyReadFunc = &TTreeReaderValueBase::ProxyReadDefaultImpl;
+      fBulkFirst = fBulkEnd = -1;
    }
    return *this;
 }
@@ -181,7 +187,10 @@ ROOT::Internal::TTreeReaderValueBase::ProxyReadDefaultImpl() {
             fProxyReadFunc = &TTreeReaderValueBase::ProxyReadTemplate<&TBranchPoxy::ReadNoParentNoBranchCountCollectionNoPointer>;
             break;
          case EReadType::kReadNoParentNoBranchCountNoCollection:
-            fProxyReadFunc = &TTreeReaderValueBase::ProxyReadTemplate<&TBranchPoxy::ReadNoParentNoBranchCountNoCollection>;
+            if (CanReadBulk())
+               fProxyReadFunc = &TTreeReaderValueBase::ProxyReadBulk;
+            else
+               fProxyReadFunc = &TTreeReaderValueBase::ProxyReadTemplate<&TBranchPoxy::ReadNoParentNoBranchCountNoCollection>;
             break;
          case EReadType::kReadNoParentBranchCountCollectionPointer:
             fProxyReadFunc = &TTreeReaderValueBase::ProxyReadTemplate<&TBranchPoxy::ReadNoParentBranchCountCollectionPointer>;
@@ -210,6 +219,55 @@ ROOT::Internal::TTreeReaderValueBase::ProxyReadDefaultImpl() {
    return fReadStatus;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Whether the value can be read by ProxyReadBulk(): it is the only leaf, of a fundamental
+/// type, of a plain TBranch, without arrays.
+
+bool ROOT::Internal::TTreeReaderValueBase::CanReadBulk() const
+{
+   if (fHaveLeaf || fHaveStaticClassOffsets || !fDict || fDict->IsA() != TDataType::Class() || fProxy->IsaPointer())
+      return false;
+   TBranch *branch = fProxy->GetBranch();
+   if (!branch || branch->IsA() != TBranch::Class() || !branch->GetBulkRead().SupportsBulkRead())
+      return false;
+   TLeaf *leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->UncheckedAt(0));
+   return !leaf->GetLeafCount() && leaf->GetLenStatic() == 1 &&
+          leaf->GetLenType() == static_cast<TDataType *>(fDict)->Size() && fProxy->GetWhere();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the value of a fundamental type without going through TBranch::GetEntry():
+/// the values of a whole basket are byte swapped at once into fBulkBuffer, by
+/// TBranch::GetBulkEntries(), and the value of the current entry is copied from there
+/// to the address of the proxy. If the basket cannot be read in bulk, e.g. because
+/// it has entry offsets, the proxy reads the entries of this tree one by one instead.
+
+ROOT::Internal::TTreeReaderValueBase::EReadStatus ROOT::Internal::TTreeReaderValueBase::ProxyReadBulk()
+{
+   const Long64_t entry = fProxy->GetReadEntry();
+   if (R__unlikely(entry < fBulkFirst || entry >= fBulkEnd)) {
+      TBranch *branch = fProxy->GetBranch();
+      if (!fBulkBuffer)
+         fBulkBuffer = std::make_unique<TBufferFile>(TBuffer::kWrite, 32 * 1024);
+      const Int_t basket = entry < 0 ? -1 : TMath::BinarySearch(branch->GetWriteBasket() + 1,
+                                                                 branch->GetBasketEntry(), entry);
+      const Long64_t first = basket < 0 ? -1 : branch->GetBasketEntry()[basket];
+      const Int_t nEntries = first < 0 ? -1 : branch->GetBulkRead().GetBulkEntries(first, *fBulkBuffer);
+      if (nEntries <= 0 || entry >= first + nEntries) {
+         fBulkFirst = fBulkEnd = -1;
+         fProxyReadFunc = &TTreeReaderValueBase::ProxyReadTemplate<
+            &ROOT::Detail::TBranchProxy::ReadNoParentNoBranchCountNoCollection>;
+         return (this->*fProxyReadFunc)();
+      }
+      fBulkFirst = first;
+      fBulkEnd = first + nEntries;
+      fBulkValueSize = static_cast<TDataType *>(fDict)->Size();
+   }
+   memcpy(fProxy->GetWhere(), fBulkBuffer->GetCurrent() + (entry - fBulkFirst) * fBulkValueSize, fBulkValueSize);
+   fReadStatus = kReadSuccess;
+   return fReadStatus;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Stringify the template argument.
 std::string ROOT::Internal::TTreeReaderValueBase::GetElementTypeName(const std::type_info& ti) {
@@ -227,6 +285,7 @@ void ROOT::Internal::TTreeReaderValueBase::NotifyNewTree(TTree* newTree) {
    // Since the TTree structure might have change, let's make sure we
    // use the right reading function.
    fProxyReadFunc = &TTreeReaderValueBase::ProxyReadDefaultImpl;
+   fBulkFirst = fBulkEnd = -1;
 
    if (!fHaveLeaf || !newTree) {
       fLeaf = nullptr;
@@ -340,3 +340,60 @@ TEST(TTreeReaderArray, ULong64Size)
 {
    TestReadingNonIntArraySizes<ULong64_t>();
 }
+
+TEST(TTreeReaderArray, VectorSeveralBaskets)
+{
+   // small baskets, so that the entries are read from several baskets and from the
+   // basket that is still being filled (the tree is read before being written)
+   auto fileName = "TTreeReaderArray_VectorSeveralBaskets.root";
+   {
+      TFile f(fileName, "recreate");
+      TTree t("t", "t");
+      std::vector<double> vecd;
+      std::vector<int> veci;
+      t.Branch("vecd", &vecd, 512);
+      t.Branch("veci", &veci, 512);
+      const int nEntries = 100;
+      for (int i = 0; i < nEntries; ++i) {
+         vecd.assign(i % 7, i * 0.5);
+         veci.assign(i % 5, i);
+         t.Fill();
+      }
+      t.FlushBaskets();
+      vecd.assign(3, -1.);
+      veci.assign(2, -1);
+      t.Fill();
+      t.ResetBranchAddresses();
+
+      TTreeReader r(&t);
+      TTreeReaderArray<double> rvecd(r, "vecd");
+      TTreeReaderArray<int> rveci(r, "veci");
+      for (int i = 0; i < nEntries; ++i) {
+         ASSERT_TRUE(r.Next());
+         ASSERT_EQ(static_cast<std::size_t>(i % 7), rvecd.GetSize());
+         ASSERT_EQ(static_cast<std::size_t>(i % 5), rveci.GetSize());
+         for (std::size_t j = 0; j < rvecd.GetSize(); ++j)
+            EXPECT_DOUBLE_EQ(i * 0.5, rvecd[j]);
+         for (std::size_t j = 0; j < rveci.GetSize(); ++j)
+            EXPECT_EQ(i, rveci[j]);
+         // the values are stored contiguously
+         if (rvecd.GetSize() > 1)
+            EXPECT_EQ(&rvecd[0] + 1, &rvecd[1]);
+      }
+      ASSERT_TRUE(r.Next());
+      ASSERT_EQ(3u, rvecd.GetSize());
+      EXPECT_DOUBLE_EQ(-1., rvecd[2]);
+      ASSERT_EQ(2u, rveci.GetSize());
+      EXPECT_EQ(-1, rveci[1]);
+
+      // random access
+      r.SetEntry(42);
+      ASSERT_EQ(0u, rvecd.GetSize());
+      ASSERT_EQ(2u, rveci.GetSize());
+      EXPECT_EQ(42, rveci[0]);
+      r.SetEntry(13);
+      ASSERT_EQ(6u, rvecd.GetSize());
+      EXPECT_DOUBLE_EQ(6.5, rvecd[5]);
+   }
+   gSystem->Unlink(fileName);
+}
@@ -509,3 +509,68 @@ TEST(TTreeReaderBasic, DisappearingBranch)
    gSystem->Unlink("DisappearingBranch0.root");
    gSystem->Unlink("DisappearingBranch1.root");
 }
+
+// Values of fundamental types are read a basket at a time
+TEST(TTreeReaderBasic, FundamentalValuesAcrossBaskets)
+{
+   const auto fname = "ttreereader_fundamentalvalues.root";
+   const int nEntries = 1000;
+   {
+      TFile f(fname, "recreate");
+      TTree t("t", "t");
+      int i = 0;
+      double d = 0.;
+      float fl = 0.f;
+      bool b = false;
+      Long64_t l = 0;
+      t.Branch("i", &i);
+      t.Branch("d", &d);
+      t.Branch("fl", &fl, "fl/F");
+      t.Branch("b", &b);
+      t.Branch("l", &l);
+      t.SetAutoFlush(64);
+      for (i = 0; i < nEntries; ++i) {
+         d = i * 0.5;
+         fl = -i;
+         b = i % 3 == 0;
+         l = Long64_t(i) << 40;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(fname);
+   TTreeReader r("t", &f);
+   TTreeReaderValue<int> i(r, "i");
+   TTreeReaderValue<double> d(r, "d");
+   TTreeReaderValue<float> fl(r, "fl");
+   TTreeReaderValue<bool> b(r, "b");
+   TTreeReaderValue<Long64_t> l(r, "l");
+
+   auto check = [&](int entry) {
+      EXPECT_EQ(*i, entry);
+      EXPECT_DOUBLE_EQ(*d, entry * 0.5);
+      EXPECT_FLOAT_EQ(*fl, -entry);
+      EXPECT_EQ(*b, entry % 3 == 0);
+      EXPECT_EQ(*l, Long64_t(entry) << 40);
+   };
+
+   int entry = 0;
+   const int *address = nullptr;
+   while (r.Next()) {
+      check(entry++);
+      if (!address)
+         address = i.Get();
+      // the address of the value stays the same while reading the tree
+      EXPECT_EQ(i.Get(), address);
+   }
+   EXPECT_EQ(entry, nEntries);
+
+   // random access, also backwards and within the same basket
+   for (int e : {999, 3, 500, 64, 63, 2, 998}) {
+      ASSERT_EQ(r.SetEntry(e), TTreeReader::kEntryValid);
+      check(e);
+   }
+
+   gSystem->Unlink(fname);
+}
@@ -0,0 +1,67 @@
+#include "TTree.h"
+#include "TTreeFormula.h"
+
+#include "gtest/gtest.h"
+
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace {
+
+std::unique_ptr<TTree> MakeFormulaTree()
+{
+   double x = 0.;
+   int n = 0;
+   float arr[2]{};
+
+   auto tree = std::make_unique<TTree>("t", "t");
+   tree->Branch("x", &x);
+   tree->Branch("n", &n);
+   tree->Branch("arr", arr, "arr[2]/F");
+   for (int i = 0; i < 20; ++i) {
+      x = (i - 10) * 0.37;
+      n = i;
+      arr[0] = i;
+      arr[1] = -i;
+      tree->Fill();
+   }
+   tree->ResetBranchAddresses();
+   return tree;
+}
+
+std::vector<double> Evaluate(TTree &tree, const char *expression)
+{
+   TTreeFormula formula("f", expression, &tree);
+   std::vector<double> values;
+   for (Long64_t entry = 0; entry < tree.GetEntries(); ++entry) {
+      tree.LoadTree(entry);
+      for (int i = 0; i < formula.GetNdata(); ++i)
+         values.push_back(formula.EvalInstance(i));
+   }
+   return values;
+}
+
+} // anonymous namespace
+
+TEST(TTreeFormulaJit, SameResultsAsInterpreter)
+{
+   auto tree = MakeFormulaTree();
+   const char *expressions[] = {"x*x+2*n-1", "n/x", "n/(n-5)", "n%3", "x>0 && n<15", "x<0 || n==3",
+                                "!(x>0)", "n>10 ? x : -x", "sqrt(x)+log(x)+exp(n*100)", "tan(x)*acos(x)",
+                                "TMath::Max(x,n/10.)", "n&5 | 8", "(n<<2) + int(x)", "pi*abs(x)*sign(x)",
+                                "pow(x,2)-fmod(n,3)", "1/2", "arr[1]+x", "Sum$(arr)+n"};
+
+   std::vector<std::vector<double>> interpreted;
+   for (auto expression : expressions)
+      interpreted.push_back(Evaluate(*tree, expression));
+
+   TTreeFormula::SetJitting();
+   for (std::size_t i = 0; i < std::size(expressions); ++i) {
+      const auto compiled = Evaluate(*tree, expressions[i]);
+      ASSERT_EQ(compiled.size(), interpreted[i].size()) << expressions[i];
+      for (std::size_t j = 0; j < compiled.size(); ++j)
+         EXPECT_DOUBLE_EQ(compiled[j], interpreted[i][j]) << expressions[i] << " entry " << j;
+   }
+   TTreeFormula::SetJitting(false);
+}
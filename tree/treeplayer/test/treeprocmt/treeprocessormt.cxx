@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <mutex>
 #include <random>
 #include <string>
 #include <thread>
@@ -362,6 +363,40 @@ TEST(TreeProcessorMT, LimitNTasks_CheckClusters)
    gSystem->Unlink(filename);
 }
 
+TEST(TreeProcessorMT, DynamicScheduling)
+{
+   const auto nEvents = 500;
+   const auto filename = "TreeProcessorMT_DynamicScheduling.root";
+   const auto treename = "t";
+   WriteFileManyClusters(nEvents, treename, filename);
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> ranges;
+   std::atomic<int> nEntries(0);
+   auto f = [&](TTreeReader &t) {
+      while (t.Next())
+         ++nEntries;
+      std::lock_guard<std::mutex> l(m);
+      ranges.emplace_back(t.GetEntriesRange());
+   };
+
+   for (auto nThreads = 1; nThreads <= 4; ++nThreads) {
+      ROOT::EnableImplicitMT(nThreads);
+      ROOT::TTreeProcessorMT p(filename, treename);
+      p.SetDynamicScheduling(true);
+      p.Process(f);
+      ROOT::DisableImplicitMT();
+
+      // The chunks of the tasks cover every entry exactly once
+      EXPECT_EQ(nEvents, nEntries);
+      CheckClusters(ranges, nEvents);
+      nEntries = 0;
+      ranges.clear();
+   }
+
+   gSystem->Unlink(filename);
+}
+
 TEST(TreeProcessorMT, TreeWithFriendTree)
 {
    std::vector<std::string> fileNames = {"TreeWithFriendTree_Tree.root", "TreeWithFriendTree_Friend.root"};
@@ -518,3 +553,49 @@ TEST(TreeProcessorMT, TreesInSameFile)
    gSystem->Unlink(fname.c_str());
    ROOT::DisableImplicitMT();
 }
+
+TEST(TreeProcessorMT, BuildIndex)
+{
+   // Large enough for the values of the index to be read in parallel
+   const int nEntries = 300000;
+   const std::vector<std::string> fileNames = {"treeprocmt_buildindex0.root", "treeprocmt_buildindex1.root"};
+   for (std::size_t i = 0; i < fileNames.size(); ++i) {
+      TFile f(fileNames[i].c_str(), "recreate");
+      TTree t("t", "t");
+      int run = i;
+      int event = 0;
+      t.Branch("run", &run);
+      t.Branch("event", &event);
+      t.SetAutoFlush(10000);
+      for (int e = 0; e < nEntries; ++e) {
+         // the events are stored in a permuted order
+         event = (e * 7919) % nEntries;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   ROOT::EnableImplicitMT(4);
+   {
+      TFile f(fileNames[0].c_str());
+      auto t = f.Get<TTree>("t");
+      EXPECT_EQ(t->BuildIndex("run", "event"), nEntries);
+      for (int e = 0; e < nEntries; e += 997)
+         EXPECT_EQ(t->GetEntryNumberWithIndex(0, (e * 7919) % nEntries), e);
+      EXPECT_EQ(t->GetEntryNumberWithIndex(0, nEntries), -1);
+   }
+   {
+      TChain c("t");
+      for (const auto &name : fileNames)
+         c.Add(name.c_str());
+      EXPECT_EQ(c.BuildIndex("run", "event"), 2);
+      for (int e = 0; e < nEntries; e += 997) {
+         EXPECT_EQ(c.GetEntryNumberWithIndex(0, (e * 7919) % nEntries), e);
+         EXPECT_EQ(c.GetEntryNumberWithIndex(1, (e * 7919) % nEntries), nEntries + e);
+      }
+   }
+   ROOT::DisableImplicitMT();
+
+   for (const auto &name : fileNames)
+      gSystem->Unlink(name.c_str());
+}